@@ -45,6 +45,8 @@ def main():
         offset_address=offset_address,
         independent=args.independent,
         syscall=args.syscall,
+        optimize=args.peephole,
+        symbols_file_path=args.symbols,
     )
     try:
         assembler.assemble(add_header=args.header)
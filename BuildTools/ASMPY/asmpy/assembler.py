@@ -19,6 +19,7 @@ from asmpy.models.data_types import (
     JumpOperation,
     SingleCycleArithmeticOperation,
 )
+from asmpy import peephole
 
 
 class Assembler:
@@ -43,11 +44,15 @@ class Assembler:
         program_type: ProgramType = ProgramType.BARE_METAL,
         independent: bool = False,
         syscall: bool = False,
+        optimize: bool = False,
+        symbols_file_path: str | None = None,
     ) -> None:
         self.preprocessed_input_lines = preprocessed_input_lines
         self.output_file_path = output_file_path
+        self.symbols_file_path = symbols_file_path
         self.independent = independent
         self.syscall = syscall
+        self.optimize = optimize
         self.offset_address = Number(0) if independent else offset_address
         self.program_type = program_type
 
@@ -231,6 +236,33 @@ class Assembler:
             source_file_name=original_line.source_file_name,
         )
 
+    def _rewrite_instruction(self, line: AssemblyLine, code_str: str) -> AssemblyLine:
+        assert isinstance(line, InstructionAssemblyLine)
+        return self._instruction_from_line(line, code_str)
+
+    def _optimize_peephole(self) -> None:
+        """Run the peephole rules shared with asm-link over the parsed lines."""
+        self._remove_comment_lines()
+        tokens: list[list[str] | None] = [
+            line.code_str.split()
+            if isinstance(line, (InstructionAssemblyLine, LabelAssemblyLine))
+            else None
+            for line in self._assembly_lines
+        ]
+        counted = [
+            isinstance(line, (InstructionAssemblyLine, DataAssemblyLine))
+            for line in self._assembly_lines
+        ]
+        self._assembly_lines, hits = peephole.optimize(
+            self._assembly_lines,
+            tokens,
+            counted,
+            self._rewrite_instruction,
+        )
+        self._logger.info(
+            "Peephole: " + ", ".join(f"{name} {count}" for name, count in hits.items())
+        )
+
     def _create_label_line_mappings(self) -> None:
         """Create a mapping of labels to the instruction they point to."""
         num_lines = len(self._assembly_lines)
@@ -451,6 +483,22 @@ class Assembler:
             f"Appended relocation table: {len(self._relocation_entries)} entries"
         )
 
+    def _write_symbols_file(self) -> None:
+        """Write "address name" lines, sorted by address, for b32p3emu -sym.
+
+        Addresses are relative to the start of the image. Local labels
+        (starting with a dot) are left out, so each function's code is
+        attributed to the function's own label.
+        """
+        symbols = sorted(
+            (address - self.offset_address.value, label.label)
+            for label, address in self._label_address_mappings.items()
+            if not label.label.startswith(".")
+        )
+        with open(self.symbols_file_path, "w") as file:
+            for address, name in symbols:
+                file.write(f"{address:08x} {name}\n")
+
     def _write_output_file(self) -> None:
         """Write the assembly lines as binary strings to the output file."""
         with open(self.output_file_path, "w") as file:
@@ -464,6 +512,9 @@ class Assembler:
         self._label_address_mappings = {}
         self._assembly_lines = self._parse_input_lines(self.preprocessed_input_lines)
 
+        if self.optimize:
+            self._optimize_peephole()
+
         if add_header:
             self._add_header_instructions()
 
@@ -486,3 +537,5 @@ class Assembler:
             self._logger.debug(line)
 
         self._write_output_file()
+        if self.symbols_file_path:
+            self._write_symbols_file()
@@ -9,6 +9,7 @@ Features:
 - Validates that all referenced symbols are defined
 - Reports duplicate global symbol definitions
 - Preserves section ordering (.code/.text, .data, .bss)
+- Optionally drops sections that the program never references (gc_sections)
 """
 
 import argparse
@@ -71,6 +72,139 @@ def _rename_local_labels(lines: list[str], prefix: str) -> list[str]:
     return result
 
 
+_SECTION_RE = re.compile(r"\.(text|code|data|rdata|bss)(\s|$)")
+_WORD_RE = re.compile(r"[A-Za-z0-9_.]+")
+# Last instructions after which code never runs into the next section
+_NO_FALLTHROUGH = {"jump", "jumpo", "jumpr", "jumpro", "halt", "reti"}
+
+
+def _clean_line(line: str) -> str:
+    """Strip ';' and single-line '/* */' comments outside of strings."""
+    out = []
+    in_quote = False
+    i = 0
+    while i < len(line):
+        c = line[i]
+        if c == '"':
+            if i == 0 or line[i - 1] != "\\":
+                in_quote = not in_quote
+        elif not in_quote and c == ";":
+            break
+        elif not in_quote and line.startswith("/*", i):
+            end = line.find("*/", i + 2)
+            i = len(line) if end < 0 else end + 2
+            continue
+        out.append(c)
+        i += 1
+    return "".join(out).strip()
+
+
+def gc_sections(
+    file_data: list[tuple[Path, list[str], str]], roots: list[str]
+) -> tuple[list[tuple[Path, list[str], str]], list[str]]:
+    """Drop the sections that cannot be reached from the roots.
+
+    Every section directive starts a new section, and QBE emits one before
+    each function and data object. A section is kept when it defines a root,
+    when a kept section names one of its labels, or when the kept code before
+    it in the same file can run into it. .globl lines always stay.
+
+    asm-link --gc-sections applies the same rules (pass_gc_sections), so
+    both linkers keep the same sections. Runs after label renaming, when
+    label names are unique.
+
+    Returns the new file data and the lines of the map report.
+    """
+    # (file index, cleaned lines, line indices) per section
+    sections: list[tuple[int, list[str], list[int]]] = []
+    for file_idx, (_, lines, _) in enumerate(file_data):
+        current: tuple[int, list[str], list[int]] | None = None
+        for line_idx, line in enumerate(lines):
+            clean = _clean_line(line)
+            if not clean or clean.startswith("#"):
+                if current is not None:
+                    current[2].append(line_idx)
+                continue
+            if current is None or _SECTION_RE.match(clean):
+                current = (file_idx, [], [])
+                sections.append(current)
+            current[1].append(clean)
+            current[2].append(line_idx)
+
+    label_section: dict[str, int] = {}
+    for sec_idx, (_, code, _) in enumerate(sections):
+        for clean in code:
+            if clean.endswith(":"):
+                label_section[clean[:-1].strip()] = sec_idx
+
+    def name(sec_idx: int) -> str:
+        for clean in sections[sec_idx][1]:
+            if clean.endswith(":"):
+                return clean[:-1].strip()
+        return "-"
+
+    def is_code(sec_idx: int) -> bool:
+        first = sections[sec_idx][1][0]
+        match = _SECTION_RE.match(first)
+        return match is None or match.group(1) in ("text", "code")
+
+    def falls_through(sec_idx: int) -> bool:
+        for clean in reversed(sections[sec_idx][1]):
+            if clean.startswith(".") or clean.endswith(":"):
+                continue
+            return clean.split()[0] not in _NO_FALLTHROUGH
+        return True
+
+    why: dict[int, str] = {}
+    queue: list[int] = []
+
+    def mark(sec_idx: int | None, reason: str) -> None:
+        if sec_idx is not None and sec_idx not in why:
+            why[sec_idx] = reason
+            queue.append(sec_idx)
+
+    for root in roots:
+        mark(label_section.get(root), "root")
+    while queue:
+        sec_idx = queue.pop(0)
+        file_idx, code, _ = sections[sec_idx]
+        for clean in code:
+            if clean.startswith((".globl ", ".global ", ".ascii ")):
+                continue
+            if clean.endswith(":") or _SECTION_RE.match(clean):
+                continue
+            for word in _WORD_RE.findall(clean):
+                if not word[0].isdigit():
+                    mark(label_section.get(word), name(sec_idx))
+        if is_code(sec_idx) and falls_through(sec_idx):
+            for next_idx in range(sec_idx + 1, len(sections)):
+                if sections[next_idx][0] != file_idx:
+                    break
+                if is_code(next_idx):
+                    mark(next_idx, "fallthrough")
+                    break
+
+    report = [f"; gc-sections: kept {len(why)} of {len(sections)} sections"]
+    dropped_lines: list[set[int]] = [set() for _ in file_data]
+    for sec_idx, (file_idx, code, line_indices) in enumerate(sections):
+        prefix = file_data[file_idx][2]
+        if sec_idx in why:
+            report.append(f"kept     {name(sec_idx):<32} {prefix:<16} {why[sec_idx]}")
+            continue
+        report.append(f"dropped  {name(sec_idx):<32} {prefix}")
+        for line_idx in line_indices:
+            if not _clean_line(file_data[file_idx][1][line_idx]).startswith(
+                (".globl ", ".global ")
+            ):
+                dropped_lines[file_idx].add(line_idx)
+
+    new_data = [
+        (path, [ln for i, ln in enumerate(lines) if i not in dropped_lines[idx]], prefix)
+        for idx, (path, lines, prefix) in enumerate(file_data)
+    ]
+    return new_data, report
+
+
 def _collect_symbols(
     lines: list[str],
 ) -> tuple[set[str], set[str], set[str]]:
@@ -116,15 +250,20 @@ def link_asm_files(
     add_header: bool = False,
     independent: bool = False,
     syscall: bool = False,
+    optimize: bool = False,
+    gc: bool = False,
+    map_file: Path | None = None,
+    symbols_file: Path | None = None,
 ) -> None:
     """Link multiple assembly files into a single binary.
 
     1. Read all input .asm files
     2. Rename .L local labels per file to avoid conflicts
     3. Detect non-global label conflicts across files and rename them
-    4. Collect and validate symbols
-    5. Concatenate into one assembly stream
-    6. Assemble with ASMPY
+    4. Optionally drop unreferenced sections (gc_sections)
+    5. Collect and validate symbols
+    6. Concatenate into one assembly stream
+    7. Assemble with ASMPY, optionally running the peephole optimizer
     """
     # Phase 1: read files and rename .L labels
     file_data: list[tuple[Path, list[str], str]] = []  # (path, lines, prefix)
@@ -193,6 +332,18 @@ def link_asm_files(
                 )
             file_data[idx] = (file_path, renamed_lines, prefix)
 
+    # Phase 4b: drop sections the program cannot reach
+    if gc:
+        roots = ["Main"]
+        if add_header and not independent:
+            roots.append("Int")
+        if syscall:
+            roots.append("Syscall")
+        file_data, report = gc_sections(file_data, roots)
+        logger.info(report[0][2:])
+        if map_file is not None:
+            map_file.write_text("\n".join(report) + "\n")
+
     # Phase 5: concatenate and assemble
     all_lines: list[str] = []
     all_local_defs: set[str] = set()
@@ -221,6 +372,8 @@ def link_asm_files(
         offset_address=Number(offset_address),
         independent=independent,
         syscall=syscall,
+        optimize=optimize,
+        symbols_file_path=str(symbols_file) if symbols_file else None,
     )
     assembler.assemble(add_header=add_header)
     logger.info(f"Linked binary written to {output_file}")
@@ -263,6 +416,25 @@ def main():
         action="store_true",
         help="Add syscall vector to header",
     )
+    parser.add_argument(
+        "-p",
+        "--peephole",
+        action="store_true",
+        help="Run the peephole optimizer (rules shared with asm-link)",
+    )
+    parser.add_argument(
+        "--gc-sections",
+        action="store_true",
+        help="Drop sections not reachable from Main (same rules as asm-link)",
+    )
+    parser.add_argument(
+        "--map",
+        help="With --gc-sections, write which sections were kept and why",
+    )
+    parser.add_argument(
+        "--symbols",
+        help="Write the label addresses (relative to the image) for b32p3emu -sym",
+    )
     parser.add_argument(
         "-l",
         "--log-level",
@@ -294,6 +466,10 @@ def main():
             add_header=args.header,
             independent=args.independent,
             syscall=args.syscall,
+            optimize=args.peephole,
+            gc=args.gc_sections,
+            map_file=Path(args.map) if args.map else None,
+            symbols_file=Path(args.symbols) if args.symbols else None,
         )
     except Exception as e:
         logger.error(f"Linker failed: {e}")
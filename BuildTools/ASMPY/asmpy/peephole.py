@@ -0,0 +1,292 @@
+"""
+Table-driven peephole optimizer for B32P3 assembly.
+
+Runs on the parsed line stream, before pseudo-instructions are expanded and
+labels are resolved. The rule table is shared with asm-link.c (peep_rules[]),
+so host (ASMPY) and on-device (asm-link) builds produce identical binaries;
+test_peephole.py checks that both tables are the same.
+
+Rule syntax:
+- A pattern is a list of lines separated by ';', matched against consecutive
+  lines of the input. Tokens are compared one by one.
+- %x binds a register, #x a number and @x a label. A variable must bind the
+  same token everywhere in the rule. Different register variables bind
+  different registers, and never one that the rule spells out literally.
+- Label lines ('@x:') may only end a pattern. They are matched but kept.
+- The replacement is written over the first matched lines. Matched lines
+  beyond the replacement are removed.
+
+Code whose layout is relied upon (the span of a branch or jumpo with a numeric
+offset, and a savpc up to the next jump) is left alone.
+"""
+
+import re
+from collections.abc import Callable, Sequence
+from typing import TypeVar
+
+# (name, pattern, replacement)
+PEEPHOLE_RULES: list[tuple[str, str, str]] = [
+    ("self-copy", "or r0 %a %a", ""),
+    ("add-zero", "add %a 0 %a", ""),
+    ("xor-zero", "xor %a 0 %a", ""),
+    ("jump-next", "jump @l ; @l:", ""),
+    (
+        "store-load",
+        "write #n r14 %a ; read #n r14 %a",
+        "write #n r14 %a",
+    ),
+    (
+        "store-copy",
+        "write #n r14 %a ; read #n r14 %b",
+        "write #n r14 %a ; or r0 %a %b",
+    ),
+    (
+        "swap-same",
+        "or r0 %a %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+        "or r0 %a %b ; or r0 %a r12",
+    ),
+    (
+        "swap-same",
+        "or r0 %b %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+        "or r0 %b %a ; or r0 %b r12",
+    ),
+    (
+        "swap-load",
+        "load #k %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+        "or r0 %a r12 ; or r0 %a %b ; load #k %a",
+    ),
+    (
+        "swap-copy",
+        "or r0 %c %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+        "or r0 %a r12 ; or r0 %a %b ; or r0 %c %a",
+    ),
+    (
+        "swap-add",
+        "add %c #k %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+        "or r0 %a r12 ; or r0 %a %b ; add %c #k %a",
+    ),
+    (
+        "swap-read",
+        "read #n %c %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+        "or r0 %a r12 ; or r0 %a %b ; read #n %c %a",
+    ),
+    (
+        "swap-load",
+        "load #k %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+        "load #k r12 ; or r0 %b %a ; or r0 r12 %b",
+    ),
+    (
+        "swap-copy",
+        "or r0 %c %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+        "or r0 %c r12 ; or r0 %b %a ; or r0 r12 %b",
+    ),
+    (
+        "swap-add",
+        "add %c #k %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+        "add %c #k r12 ; or r0 %b %a ; or r0 r12 %b",
+    ),
+    (
+        "swap-read",
+        "read #n %c %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+        "read #n %c r12 ; or r0 %b %a ; or r0 r12 %b",
+    ),
+]
+
+BRANCH_OPCODES = {
+    "beq",
+    "bne",
+    "bgt",
+    "bge",
+    "blt",
+    "ble",
+    "bgts",
+    "bges",
+    "blts",
+    "bles",
+}
+JUMP_OPCODES = {"jump", "jumpo", "jumpr", "jumpro"}
+
+_REGISTER_RE = re.compile(r"r[0-9][0-9]?$")
+_NUMBER_RE = re.compile(r"-?[0-9]")
+
+T = TypeVar("T")
+
+
+def _is_register(token: str) -> bool:
+    return _REGISTER_RE.match(token) is not None
+
+
+def _is_number(token: str) -> bool:
+    return _NUMBER_RE.match(token) is not None
+
+
+def _is_label(token: str) -> bool:
+    return (token[0].isalpha() or token[0] in "_.") and not _is_register(token)
+
+
+def _parse_number(token: str) -> int | None:
+    negative = token.startswith("-")
+    digits = token[1:] if negative else token
+    try:
+        if digits[:2] in ("0x", "0X"):
+            value = int(digits[2:], 16)
+        elif digits[:2] in ("0b", "0B"):
+            value = int(digits[2:], 2)
+        else:
+            value = int(digits, 10)
+    except ValueError:
+        return None
+    return -value if negative else value
+
+
+class Rule:
+    """One parsed entry of PEEPHOLE_RULES."""
+
+    def __init__(self, name: str, pattern: str, replacement: str) -> None:
+        self.name = name
+        self.pattern = [line.split() for line in pattern.split(";")]
+        self.replacement = [
+            line.split() for line in replacement.split(";") if line.strip()
+        ]
+        # Lines that are removed or rewritten; trailing labels are context
+        self.consumed = len(self.pattern)
+        while self.consumed and self.pattern[self.consumed - 1][-1].endswith(":"):
+            self.consumed -= 1
+        self.literal_registers = {
+            token
+            for line in self.pattern
+            for token in line
+            if _is_register(token)
+        }
+
+    def _bind(self, pattern_token: str, token: str, binding: dict[str, str]) -> bool:
+        if pattern_token.endswith(":"):
+            if not token.endswith(":"):
+                return False
+            pattern_token = pattern_token[:-1]
+            token = token[:-1]
+        if pattern_token[0] not in "%#@":
+            return pattern_token == token
+        if pattern_token in binding:
+            return binding[pattern_token] == token
+        if pattern_token[0] == "%":
+            if not _is_register(token) or token in self.literal_registers:
+                return False
+            if any(
+                name[0] == "%" and value == token for name, value in binding.items()
+            ):
+                return False
+        elif pattern_token[0] == "#":
+            if not _is_number(token):
+                return False
+        elif not _is_label(token):
+            return False
+        binding[pattern_token] = token
+        return True
+
+    def match(self, lines: Sequence[list[str] | None]) -> dict[str, str] | None:
+        """Match the pattern against the token lists of consecutive lines."""
+        if len(lines) < len(self.pattern):
+            return None
+        binding: dict[str, str] = {}
+        for pattern_line, tokens in zip(self.pattern, lines):
+            if tokens is None or len(tokens) != len(pattern_line):
+                return None
+            for pattern_token, token in zip(pattern_line, tokens):
+                if not self._bind(pattern_token, token, binding):
+                    return None
+        return binding
+
+    def rewrite(self, binding: dict[str, str]) -> list[str]:
+        """Return the replacement lines with the variables filled in."""
+        return [
+            " ".join(binding.get(token, token) for token in line)
+            for line in self.replacement
+        ]
+
+
+RULES = [Rule(*rule) for rule in PEEPHOLE_RULES]
+MAX_PATTERN_LINES = max(len(rule.pattern) for rule in RULES)
+
+
+def _pinned_lines(tokens: list[list[str] | None], counted: list[bool]) -> list[bool]:
+    """Mark lines whose position relative to each other must not change."""
+    pinned = [False] * len(tokens)
+    for idx, line in enumerate(tokens):
+        if line is None or line[-1].endswith(":"):
+            continue
+        opcode = line[0]
+        if opcode == "savpc":
+            # The return address is computed with a fixed offset from savpc
+            pinned[idx] = True
+            j = idx + 1
+            while j < len(tokens):
+                if tokens[j] is not None and tokens[j][-1].endswith(":"):
+                    break
+                pinned[j] = True
+                if tokens[j] is not None and tokens[j][0] in JUMP_OPCODES:
+                    break
+                j += 1
+            continue
+        if not (opcode in BRANCH_OPCODES or opcode == "jumpo"):
+            continue
+        offset = _parse_number(line[-1]) if _is_number(line[-1]) else None
+        if offset is None:
+            continue
+        pinned[idx] = True
+        remaining = abs(offset) // 4
+        step = 1 if offset > 0 else -1
+        j = idx + step
+        while remaining > 0 and 0 <= j < len(tokens):
+            pinned[j] = True
+            if counted[j]:
+                remaining -= 1
+            j += step
+    return pinned
+
+
+def optimize(
+    lines: list[T],
+    tokens: list[list[str] | None],
+    counted: list[bool],
+    make_line: Callable[[T, str], T],
+) -> tuple[list[T], dict[str, int]]:
+    """Run the peephole rules over lines.
+
+    tokens holds the tokens of each instruction or label line ('name:'), or
+    None for any other line. counted tells which lines emit code or data.
+    make_line(old_line, code_str) builds a rewritten instruction line.
+
+    Returns the new lines and the number of hits per rule.
+    """
+    hits = {rule.name: 0 for rule in RULES}
+    pinned = _pinned_lines(tokens, counted)
+    out: list[T] = list(lines)
+    removed = [False] * len(lines)
+
+    for idx in range(len(lines)):
+        if removed[idx]:
+            continue
+        window: list[int] = []
+        j = idx
+        while j < len(lines) and len(window) < MAX_PATTERN_LINES:
+            if not removed[j]:
+                window.append(j)
+            j += 1
+        for rule in RULES:
+            binding = rule.match([tokens[i] for i in window])
+            if binding is None:
+                continue
+            consumed = window[: rule.consumed]
+            if any(pinned[i] for i in consumed):
+                continue
+            replacement = rule.rewrite(binding)
+            for i, code_str in zip(consumed, replacement):
+                out[i] = make_line(lines[i], code_str)
+                tokens[i] = code_str.split()
+            for i in consumed[len(replacement) :]:
+                removed[i] = True
+            hits[rule.name] += 1
+            break
+
+    return [line for i, line in enumerate(out) if not removed[i]], hits
@@ -47,6 +47,17 @@ def parse_args() -> argparse.Namespace:
         action="store_true",
         help="Add a syscall vector (jump Syscall) as a 4th header word at address 3. Requires --header.",
     )
+    parser.add_argument(
+        "-p",
+        "--peephole",
+        action="store_true",
+        help="Run the peephole optimizer (rules shared with asm-link) before assembling",
+    )
+    parser.add_argument(
+        "--symbols",
+        help="Write the label addresses (relative to the image) to this file, "
+        "for b32p3emu -sym",
+    )
     parser.add_argument(
         "--help",
         action="help",
@@ -441,3 +441,41 @@ def test_assembler_independent_addr2reg_becomes_load_loadhi_with_reloc():
         assert reloc_entry == 1
     finally:
         os.unlink(temp_file.name)
+
+
+def test_assembler_writes_symbols_file():
+    """Test that --symbols lists labels relative to the image, without local labels."""
+    # Arrange
+    source_lines = [
+        SourceLine(line=".code", source_line_number=1, source_file_name="test.asm"),
+        SourceLine(line="Main:", source_line_number=2, source_file_name="test.asm"),
+        SourceLine(line="load 1 r1", source_line_number=3, source_file_name="test.asm"),
+        SourceLine(line=".Lloop:", source_line_number=4, source_file_name="test.asm"),
+        SourceLine(
+            line="jump .Lloop", source_line_number=5, source_file_name="test.asm"
+        ),
+        SourceLine(line="helper:", source_line_number=6, source_file_name="test.asm"),
+        SourceLine(line="halt", source_line_number=7, source_file_name="test.asm"),
+    ]
+    temp_file = tempfile.NamedTemporaryFile(mode="w", delete=False, suffix=".bin")
+    temp_file.close()
+    symbols_path = temp_file.name + ".sym"
+
+    try:
+        assembler = Assembler(
+            source_lines,
+            temp_file.name,
+            offset_address=Number("0x1E000000"),
+            symbols_file_path=symbols_path,
+        )
+
+        # Act
+        assembler.assemble()
+
+        # Assert
+        with open(symbols_path) as f:
+            assert f.read() == "00000000 Main\n00000008 helper\n"
+    finally:
+        os.unlink(temp_file.name)
+        if os.path.exists(symbols_path):
+            os.unlink(symbols_path)
@@ -0,0 +1,81 @@
+from pathlib import Path
+
+from asmpy.linker import gc_sections
+
+
+def _gc(*files: list[str]) -> tuple[list[list[str]], list[str]]:
+    file_data = [
+        (Path(f"f{idx}.asm"), lines, f"f{idx}") for idx, lines in enumerate(files)
+    ]
+    new_data, report = gc_sections(file_data, ["Main"])
+    return [lines for _, lines, _ in new_data], report
+
+
+def test_drops_unreferenced_functions():
+    """Test that only sections reachable from Main are kept."""
+    # Arrange
+    crt0 = [".text", "Main:", "jump main"]
+    prog = [
+        ".text",
+        "main:",
+        "addr2reg msg r1",
+        "jumpr 0 r15",
+        ".text",
+        "unused:",
+        "jumpr 0 r15",
+        ".data",
+        "msg:",
+        '.ascii "unused"',
+    ]
+
+    # Act
+    (crt0_out, prog_out), report = _gc(crt0, prog)
+
+    # Assert
+    assert crt0_out == crt0
+    assert prog_out == [
+        ".text",
+        "main:",
+        "addr2reg msg r1",
+        "jumpr 0 r15",
+        ".data",
+        "msg:",
+        '.ascii "unused"',
+    ]
+    assert report[0] == "; gc-sections: kept 3 of 4 sections"
+    assert "dropped  unused" in report[3]
+
+
+def test_keeps_code_that_falls_through():
+    """Test that code running into the next code section keeps it."""
+    # Arrange
+    prog = [
+        ".text",
+        "Main:",
+        "load 1 r1",
+        ".data",
+        "table:",
+        ".dw 0",
+        ".text",
+        "next:",
+        "halt",
+        ".text",
+        "after_halt:",
+        "halt",
+    ]
+
+    # Act
+    (out,), report = _gc(prog)
+
+    # Assert
+    assert out == prog[:3] + prog[6:9]
+    assert report[3].split() == ["kept", "next", "f0", "fallthrough"]
+
+
+def test_keeps_global_directives():
+    """Test that .globl lines of dropped sections stay."""
+    # Act
+    (out,), _ = _gc([".text", "Main:", "halt", ".text", ".global f", "f:", "halt"])
+
+    # Assert
+    assert out == [".text", "Main:", "halt", ".global f"]
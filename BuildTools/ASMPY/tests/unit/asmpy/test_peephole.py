@@ -0,0 +1,95 @@
+import re
+from pathlib import Path
+
+from asmpy import peephole
+
+ASM_LINK_SRC = (
+    Path(__file__).resolve().parents[5] / "Software/C/userBDOS/asm-link.c"
+)
+
+
+def _run(code: list[str]) -> tuple[list[str], dict[str, int]]:
+    tokens = [line.split() for line in code]
+    counted = [not line.endswith(":") for line in code]
+    return peephole.optimize(
+        code, tokens, counted, lambda _old, code_str: code_str
+    )
+
+
+def test_rules_match_asm_link():
+    """Test that asm-link.c uses the same rule table, in the same order."""
+    # Arrange
+    source = ASM_LINK_SRC.read_text()
+    start = source.index("peep_rules[] = {")
+    table = source[start : source.index("};", start)]
+
+    # Act
+    c_rules = re.findall(r'\{\s*"([^"]*)",\s*"([^"]*)",\s*"([^"]*)"\s*\}', table)
+
+    # Assert
+    assert c_rules == peephole.PEEPHOLE_RULES
+
+
+def test_removes_no_op_instructions():
+    """Test removing self-copies and additions of zero."""
+    # Act
+    lines, hits = _run(["or r0 r3 r3", "add r4 0 r4", "xor r5 0 r5", "halt"])
+
+    # Assert
+    assert lines == ["halt"]
+    assert hits["self-copy"] == 1
+    assert hits["add-zero"] == 1
+    assert hits["xor-zero"] == 1
+
+
+def test_keeps_label_after_jump():
+    """Test that a jump to the next label is removed but the label is kept."""
+    # Act
+    lines, hits = _run(["jump Next", "Next:", "jump Other", "Skip:"])
+
+    # Assert
+    assert lines == ["Next:", "jump Other", "Skip:"]
+    assert hits["jump-next"] == 1
+
+
+def test_rewrites_swap_through_r12():
+    """Test folding a load into the swap that follows it."""
+    # Arrange
+    code = ["load 7 r2", "or r0 r1 r12", "or r0 r2 r1", "or r0 r12 r2"]
+
+    # Act
+    lines, hits = _run(code)
+
+    # Assert
+    assert lines == ["or r0 r1 r12", "or r0 r1 r2", "load 7 r1"]
+    assert hits["swap-load"] == 1
+
+
+def test_does_not_bind_literal_registers():
+    """Test that a register variable never binds a register named in the rule."""
+    # Act
+    lines, _ = _run(["write 0 r14 r12", "read 0 r14 r14"])
+
+    # Assert
+    assert lines == ["write 0 r14 r12", "read 0 r14 r14"]
+
+
+def test_keeps_code_covered_by_numeric_offsets():
+    """Test that savpc sequences and numeric branch spans are left alone."""
+    # Arrange
+    code = [
+        "savpc r15",
+        "add r15 3 r15",
+        "or r0 r1 r1",
+        "jump Func",
+        "beq r1 r2 8",
+        "xor r3 0 r3",
+        "halt",
+    ]
+
+    # Act
+    lines, hits = _run(code)
+
+    # Assert
+    assert lines == code
+    assert sum(hits.values()) == 0
@@ -58,6 +58,7 @@ struct Target {
 	void (*abi0)(Fn *);
 	void (*abi1)(Fn *);
 	void (*isel)(Fn *);
+	void (*sched)(Fn *);
 	void (*emitfn)(Fn *, FILE *);
 	void (*emitfin)(FILE *);
 	char asloc[4];
@@ -163,7 +164,7 @@ enum J {
 	X(jfisle) X(jfislt) X(jfiuge) X(jfiugt) \
 	X(jfiule) X(jfiult) X(jffeq)  X(jffge)  \
 	X(jffgt)  X(jffle)  X(jfflt)  X(jffne)  \
-	X(jffo)   X(jffuo)  X(hlt)
+	X(jffo)   X(jffuo)  X(hlt)    X(jtab)
 #define X(j) J##j,
 	JMPS(X)
 #undef X
@@ -192,6 +193,7 @@ enum {
 #define isstore(o) INRANGE(o, Ostoreb, Ostored)
 #define isload(o) INRANGE(o, Oloadsb, Oload)
 #define isext(o) INRANGE(o, Oextsb, Oextuw)
+#define isalloc(o) INRANGE(o, Oalloc, Oalloc1)
 #define ispar(o) INRANGE(o, Opar, Opare)
 #define isarg(o) INRANGE(o, Oarg, Oargv)
 #define isret(j) INRANGE(j, Jretw, Jret0)
@@ -238,10 +240,15 @@ struct Blk {
 	uint nins;
 	struct {
 		short type;
+		short hint; /* jnz: 1 if s1 is likely, 2 if s2 is */
 		Ref arg;
 	} jmp;
 	Blk *s1;
 	Blk *s2;
+	Blk **jtab;  /* jtab targets, each once */
+	uint njtab;
+	uint *jidx;  /* jtab entry of each index */
+	uint njidx;
 	Blk *link;
 
 	uint id;
@@ -257,6 +264,7 @@ struct Blk {
 	BSet in[1], out[1], gen[1];
 	int nlive[2];
 	int loop;
+	uint64_t cnt; /* 1 + runs in the profile, or 0 */
 	char name[NString];
 };
 
@@ -365,6 +373,7 @@ struct Addr { /* amd64 addressing */
 struct Lnk {
 	char export;
 	char thread;
+	char inl; /* -1 noinline, 1 inline, 2 alwaysinline */
 	char align;
 	char *sec;
 	char *secf;
@@ -442,6 +451,7 @@ struct Dat {
 /* main.c */
 extern Target T;
 extern char debug['Z'+1];
+extern int hwstack;
 
 /* util.c */
 typedef enum {
@@ -517,6 +527,8 @@ void elimsb(Fn *);
 /* cfg.c */
 Blk *newblk(void);
 void edgedel(Blk *, Blk **);
+void jtabdel(Blk *, Blk *);
+Blk **succlist(Blk *);
 void fillpreds(Fn *);
 void fillrpo(Fn *);
 void filldom(Fn *);
@@ -558,6 +570,21 @@ void fold(Fn *);
 /* simpl.c */
 void simpl(Fn *);
 
+/* inline.c */
+void inlref(char *);
+int inlfn(Fn *);
+void inlflush(void (Fn *));
+
+/* loop.c */
+int loopopt(Fn *, int);
+
+/* prof.c */
+extern int profgen;
+void profread(char *);
+int profile(Fn *);
+void profdat(Fn *, FILE *);
+void layout(Fn *);
+
 /* live.c */
 void liveon(BSet *, Blk *, Blk *);
 void filllive(Fn *);
@@ -68,6 +68,9 @@ void b32p3_abi(Fn *);
 /* isel.c */
 void b32p3_isel(Fn *);
 
+/* sched.c */
+void b32p3_sched(Fn *);
+
 /* emit.c */
 void b32p3_emitfn(Fn *, FILE *);
 void b32p3_emitfin(FILE *);
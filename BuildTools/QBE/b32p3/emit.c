@@ -58,6 +58,11 @@
  *
  * Return:
  *   jumpr 0 r15     ; return to caller
+ *
+ * Conditional jumps:
+ *   blts r4 r5 .L3  ; compare folded into the branch (isel.c)
+ *   bges r4 r5 8    ; same, inverted around a far jump when
+ *   jump .L3        ; .L3 may be out of branch range
  */
 
 enum {
@@ -74,6 +79,8 @@ static struct {
 	{ Osub,    Ki, "sub %0 %1 %=" },
 	{ Oneg,    Ki, "sub r0 %0 %=" },
 	{ Omul,    Ki, "mults %0 %1 %=" },
+	{ Omulhs,  Ki, "mulshi %0 %1 %=" },
+	{ Omulhu,  Ki, "multuhi %0 %1 %=" },
 	{ Omultfp, Ki, "multfp %0 %1 %=" },
 	{ Odivfp,  Ki, "divfp %0 %1 %=" },
 	{ Odiv,    Ki, "divs %0 %1 %=" },
@@ -128,6 +135,54 @@ static char *rname[] = {
 	[R15] = "r15",
 };
 
+static char *brname[] = {
+	[Cieq]  = "beq",
+	[Cine]  = "bne",
+	[Cisge] = "bges",
+	[Cisgt] = "bgts",
+	[Cisle] = "bles",
+	[Cislt] = "blts",
+	[Ciuge] = "bge",
+	[Ciugt] = "bgt",
+	[Ciule] = "ble",
+	[Ciult] = "blt",
+};
+
+enum {
+	/* branch offsets are signed 16-bit byte counts */
+	BrMax = 32767,
+	/* upper bound on the bytes emitins() or a block
+	 * terminator produce; the longest, a slot-to-slot
+	 * copy with far offsets, is 8 instructions */
+	InsMax = 10 * 4,
+	/* -H frames, see emitpro() */
+	HwPush = 3,  /* callee-saves kept on the hardware stack */
+	HwMax = 36,  /* deepest entry a prologue may push from */
+};
+
+/* label number of the jump table of the block being emitted */
+static int jtlbl;
+
+/*
+ * Frame placement.  A block needs the frame when it calls,
+ * touches a stack slot or uses a callee-save register.
+ * When no block does, the function runs without one.
+ * Otherwise the prologue is sunk from the entry into the
+ * nearest block dominating all of them (shrink-wrapping),
+ * so early exits before it return straight through r15.
+ * That block must be outside loops, and the paths that
+ * skip it may only meet framed ones at the return block.
+ * Functions without calls never save RA.
+ */
+static struct {
+	Blk *pro;     /* block that sets up the frame, or 0 */
+	char *framed; /* by block id: frame is set up */
+	int leaf;
+	int nret;     /* frameless return label used */
+	int hw;       /* -H frame, see emitpro() */
+	int npush;    /* callee-saves pushed by a -H frame */
+} fr;
+
 static int64_t
 slot(Ref r, Fn *fn)
 {
@@ -137,8 +192,8 @@ slot(Ref r, Fn *fn)
 	assert(s <= fn->slot);
 	if (s < 0)
 		return 4 * -s;   /* incoming args: positive offset from FP */
-	else
-		return -4 * (fn->slot - s); /* locals: negative offset from FP */
+	else  /* locals: negative offset from FP, below the -H save area */
+		return -4 * (fn->slot - s + fr.npush);
 }
 
 static void
@@ -283,16 +338,73 @@ fixaddr(Ref *pr, Fn *fn, FILE *f)
 	}
 }
 
+static char *
+brarg(Ref r, Fn *fn)
+{
+	if (rtype(r) == RCon) {
+		/* a compare fused into a branch only keeps zero */
+		assert(fn->con[r.val].type == CBits);
+		return "r0";
+	}
+	assert(isreg(r));
+	return rname[r.val];
+}
+
+/* Set i->to to the 0/1 result of a compare isel left
+ * for a branch that could not take it. */
+static void
+emitcmp(int c, Ins *i, Fn *fn, FILE *f)
+{
+	char *a, *b, *t, *rn, imm[16];
+	Con *pc;
+
+	a = brarg(i->arg[0], fn);
+	b = brarg(i->arg[1], fn);
+	/* plain compares from selcmp may keep an immediate */
+	if (rtype(i->arg[1]) == RCon) {
+		pc = &fn->con[i->arg[1].val];
+		if (pc->bits.i != 0) {
+			sprintf(imm, "%d", (int)pc->bits.i);
+			b = imm;
+		}
+	}
+	assert(isreg(i->to));
+	rn = rname[i->to.val];
+	switch (c) {
+	case Cieq:
+		fprintf(f, "  xor %s %s %s\n  sltu %s 1 %s\n", a, b, rn, rn, rn);
+		return;
+	case Cine:
+		fprintf(f, "  xor %s %s %s\n  sltu r0 %s %s\n", a, b, rn, rn, rn);
+		return;
+	case Cisgt:
+	case Cisle:
+	case Ciugt:
+	case Ciule:
+		t = a;
+		a = b;
+		b = t;
+		break;
+	}
+	fprintf(f, "  %s %s %s %s\n", c >= Ciuge ? "sltu" : "slt", a, b, rn);
+	if (c == Cisge || c == Cisle || c == Ciuge || c == Ciule)
+		fprintf(f, "  xor %s 1 %s\n", rn, rn);
+}
+
 static void
 emitins(Ins *i, Fn *fn, FILE *f)
 {
-	int o;
+	int o, c, k;
 	char *rn;
 	int64_t s;
 	Con *con;
 
 	switch (i->op) {
 	default:
+		if (iscmp(i->op, &k, &c)) {
+			emitcmp(c, i, fn, f);
+			break;
+		}
 		if (isload(i->op)) {
 			fixaddr(&i->arg[0], fn, f);
 			fixmem(&i->arg[0], fn, f);
@@ -464,12 +576,195 @@ emitins(Ins *i, Fn *fn, FILE *f)
 		if (!req(i->to, R))
 			fprintf(f, "  or r0 r13 %s\n", rname[i->to.val]);
 		break;
+	case Ojtaddr:
+		fprintf(f, "  addr2reg .Ljt%d %s\n", jtlbl, rname[i->to.val]);
+		break;
 	case Odbgloc:
 		emitdbgloc(i->arg[0].val, i->arg[1].val, f);
 		break;
 	}
 }
 
+/* Register holding the jump argument of b */
+static char *
+jmparg(Blk *b, Fn *fn, FILE *f)
+{
+	int64_t soff;
+
+	if (rtype(b->jmp.arg) != RSlot) {
+		assert(isreg(b->jmp.arg));
+		return rname[b->jmp.arg.val];
+	}
+	/* Spill pass turned the arg into a slot;
+	 * emit a load from the spill slot into r12 */
+	soff = slot(b->jmp.arg, fn);
+	if (soff >= -32768 && soff <= 32767) {
+		fprintf(f, "  read %d r14 r12\n", (int)soff);
+	} else {
+		fprintf(f, "  load32 %d r12\n", (int)soff);
+		fprintf(f, "  add r14 r12 r12\n");
+		fprintf(f, "  read 0 r12 r12\n");
+	}
+	return "r12";
+}
+
+/* The compare isel left for b's jnz, if it can be folded
+ * into the branch: it must still end the block, since
+ * spill code after it may reuse its operand registers. */
+static Ins *
+brcmp(Blk *b, int *pc)
+{
+	Ins *i;
+	int k;
+
+	if (b->jmp.type != Jjnz || b->nins == 0)
+		return 0;
+	i = &b->ins[b->nins-1];
+	if (!iscmp(i->op, &k, pc) || !req(i->to, b->jmp.arg))
+		return 0;
+	return i;
+}
+
+/* bound on the bytes emitted for b */
+static int64_t
+blksz(Blk *b)
+{
+	return InsMax * (b->nins + 1 + (2 + fr.hw) * (b == fr.pro));
+}
+
+/*
+ * Emit "if (a <c> b) goto .L<t>" at the end of block blk.
+ * pos[] bounds the offset of every label from above, so
+ * when t may be out of branch range the condition is
+ * inverted around a far jump instead.
+ */
+static void
+emitbr(int c, char *a, char *b, Blk *blk, int t, int64_t *pos,
+	int id0, FILE *f)
+{
+	int64_t d;
+
+	if (pos[t] > pos[blk->id])
+		d = pos[t] - pos[blk->id];
+	else
+		d = pos[blk->id] + blksz(blk) - pos[t];
+	if (d <= BrMax)
+		fprintf(f, "  %s %s %s .L%d\n",
+			brname[c], a, b, id0+t);
+	else
+		fprintf(f,
+			"  %s %s %s 8\n"
+			"  jump .L%d\n",
+			brname[cmpneg(c)], a, b, id0+t
+		);
+}
+
+static int
+isclob(Ref r)
+{
+	return rtype(r) == RTmp && r.val >= R8 && r.val <= R11;
+}
+
+static int
+needframe(Blk *b)
+{
+	Ins *i;
+	int n;
+
+	if (rtype(b->jmp.arg) == RSlot || isclob(b->jmp.arg))
+		return 1;
+	for (i=b->ins; i<&b->ins[b->nins]; i++) {
+		if (i->op == Ocall || i->op == Osalloc)
+			return 1;
+		if (rtype(i->to) == RSlot || isclob(i->to))
+			return 1;
+		for (n=0; n<2; n++)
+			if (rtype(i->arg[n]) == RSlot || isclob(i->arg[n]))
+				return 1;
+	}
+	return 0;
+}
+
+static void
+reach(Blk *b, Blk *stop, char *mark)
+{
+	uint n;
+
+	if (!b || b == stop || mark[b->id])
+		return;
+	mark[b->id] = 1;
+	reach(b->s1, stop, mark);
+	reach(b->s2, stop, mark);
+	for (n=0; n<b->njtab; n++)
+		reach(b->jtab[n], stop, mark);
+}
+
+static void
+frameplan(Fn *fn)
+{
+	Blk *b, *d;
+	Ins *i;
+	char *pre;
+	uint n;
+	int *pr;
+
+	fr.framed = alloc(fn->nblk);
+	fr.leaf = 1;
+	fr.nret = 0;
+	filldom(fn);
+	d = 0;
+	for (b=fn->start; b; b=b->link) {
+		for (i=b->ins; i<&b->ins[b->nins]; i++)
+			if (i->op == Ocall)
+				fr.leaf = 0;
+		if (needframe(b)) {
+			if (!d)
+				d = b;
+			while (!dom(d, b))
+				d = d->idom;
+		}
+	}
+	fr.hw = hwstack && !fr.leaf;
+	fr.npush = 0;
+	if (fr.hw)
+		for (pr=b32p3_rclob; *pr>=0 && fr.npush<HwPush; pr++)
+			if (fn->reg & BIT(*pr))
+				fr.npush++;
+	fr.pro = d;
+	if (fn->vararg)
+		fr.pro = fn->start;
+	if (!fr.pro)
+		return;
+	if (fr.pro != fn->start) {
+		reach(d->s1, 0, fr.framed);
+		reach(d->s2, 0, fr.framed);
+		for (n=0; n<d->njtab; n++)
+			reach(d->jtab[n], 0, fr.framed);
+		if (fr.framed[d->id])
+			goto Entry; /* in a loop */
+		fr.framed[d->id] = 1;
+		pre = alloc(fn->nblk);
+		reach(fn->start, d, pre);
+		for (b=fn->start; b; b=b->link)
+			if (pre[b->id] && fr.framed[b->id])
+			if (b->jmp.type != Jret0 || b->nins != 0)
+				goto Entry;
+		return;
+	}
+Entry:
+	fr.pro = fn->start;
+	for (n=0; n<fn->nblk; n++)
+		fr.framed[n] = 1;
+}
+
+/* s is the framed return, reached from b without a frame */
+static int
+fretblk(Blk *b, Blk *s)
+{
+	return s && s->jmp.type == Jret0
+		&& fr.framed[s->id] && !fr.framed[b->id];
+}
+
 /*
  * Stack frame layout:
  *
@@ -490,26 +785,56 @@ emitins(Ins *i, Fn *fn, FILE *f)
  *   | callee-save |
  *   |  registers  |
  *   +=============+ <- SP
+ *
+ * With -H, functions that call keep the old FP, the first
+ * HwPush callee-saves and RA on the 64-entry hardware stack
+ * instead, in one group pushed in that order.  The number
+ * of callee-saves in the group rides in the low two bits of
+ * the pushed RA.  [FP+0], [FP+4] and the HwPush words below
+ * FP (spill slots move down) stay free for the group: when
+ * the prologue finds the hardware stack deeper than HwMax
+ * entries, __hws_spill (Software/ASM/crt0/hwstack.asm) moves
+ * every group there into the frame of its function and the
+ * new function returns through __hws_fill, which pushes the
+ * group of its caller back, one per return.  Leaf functions
+ * keep the memory layout above.
  */
 
-void
-b32p3_emitfn(Fn *fn, FILE *f)
+static void
+emitpro(Fn *fn, FILE *f)
 {
-	static int id0;
-	int lbl, neg, off, frame, *pr;
-	Blk *b, *s;
-	Ins *i;
+	int off, frame, n, *pr;
 
-	/* emit function label */
-	fprintf(f, "\n.text\n");
-	fprintf(f, "; function %s\n", fn->name);
-	if (fn->lnk.export)
-		fprintf(f, ".global %s\n", fn->name);
-	fprintf(f, "%s:\n", fn->name);
-
-	/* prologue: save FP and RA, set up new frame */
-	fprintf(f, "  write 0 r13 r14\n");   /* save old FP at [SP] */
-	fprintf(f, "  write 4 r13 r15\n");   /* save RA at [SP+4] */
+	if (fr.hw) {
+		/* push the group, making room for it when the
+		 * stack is deeper than HwMax; the push of FP
+		 * hides the latency of reading the depth
+		 */
+		fprintf(f,
+			"  load32 0x1F000004 r12\n"
+			"  read 0 r12 r12\n"
+			"  push r14\n"
+			"  sub r12 %d r12\n"
+			"  blts r12 r0 16\n"
+			"  savpc r12\n"
+			"  add r12 12 r12\n"
+			"  jump __hws_spill\n",
+			HwMax + 1
+		);
+		for (n=0, pr=b32p3_rclob; n<fr.npush; pr++)
+			if (fn->reg & BIT(*pr)) {
+				fprintf(f, "  push %s\n", rname[*pr]);
+				n++;
+			}
+		if (fr.npush)
+			fprintf(f, "  add r15 %d r15\n", fr.npush);
+		fprintf(f, "  push r15\n");
+	} else {
+		/* save FP and RA */
+		fprintf(f, "  write 0 r13 r14\n");   /* save old FP at [SP] */
+		if (!fr.leaf)
+			fprintf(f, "  write 4 r13 r15\n");   /* save RA at [SP+4] */
+	}
 	fprintf(f, "  or r0 r13 r14\n");     /* FP = SP */
 
 	if (fn->vararg) {
@@ -537,88 +862,166 @@ b32p3_emitfn(Fn *fn, FILE *f)
 
 	/* save callee-save registers */
 	off = 4; /* start right below spill slots */
-	for (pr=b32p3_rclob; *pr>=0; pr++) {
-		if (fn->reg & BIT(*pr)) {
+	for (n=0, pr=b32p3_rclob; *pr>=0; pr++) {
+		if (fn->reg & BIT(*pr) && n++ >= fr.npush) {
 			fprintf(f, "  write -%d r14 %s\n",
-				off + 4 * fn->slot, rname[*pr]);
+				off + 4 * (fn->slot + fr.npush), rname[*pr]);
 			off += 4;
 		}
 	}
+}
+
+static void
+emitepi(Fn *fn, FILE *f)
+{
+	int off, n, *pr;
+
+	/* restore callee-saves, FP, RA, return */
+	off = 4;
+	for (n=0, pr=b32p3_rclob; *pr>=0; pr++) {
+		if (fn->reg & BIT(*pr) && n++ >= fr.npush) {
+			fprintf(f, "  read -%d r14 %s\n",
+				off + 4 * (fn->slot + fr.npush), rname[*pr]);
+			off += 4;
+		}
+	}
+	fprintf(f, "  or r0 r14 r13\n");     /* SP = FP */
+	if (fr.hw) {
+		fprintf(f, "  pop r15\n");
+		for (pr=&b32p3_rclob[NCLR]; pr-->b32p3_rclob;)
+			if (fn->reg & BIT(*pr) && --n < fr.npush)
+				fprintf(f, "  pop %s\n", rname[*pr]);
+		fprintf(f,
+			"  pop r14\n"
+			"  jumpr %d r15\n",   /* strip the count off RA */
+			-fr.npush
+		);
+		return;
+	}
+	if (!fr.leaf)
+		fprintf(f, "  read 4 r14 r15\n");    /* restore RA */
+	fprintf(f,
+		"  read 0 r14 r14\n"  /* restore FP */
+		"  jumpr 0 r15\n"     /* return */
+	);
+}
+
+void
+b32p3_emitfn(Fn *fn, FILE *f)
+{
+	static int id0;
+	int lbl, c, t;
+	int64_t *pos, off;
+	char *ra, *rb, *jt;
+	Blk *b, *s;
+	Ins *i, *fi;
+	uint n;
+
+	/* emit function label */
+	fprintf(f, "\n.text\n");
+	fprintf(f, "; function %s\n", fn->name);
+	if (fn->lnk.export)
+		fprintf(f, ".global %s\n", fn->name);
+	fprintf(f, "%s:\n", fn->name);
+
+	frameplan(fn);
+	if (fr.pro == fn->start)
+		emitpro(fn, f);
+
+	/* bound block offsets for branch range checks; the
+	 * layout need not follow the block ids
+	 */
+	pos = alloc((fn->nblk+1) * sizeof pos[0]);
+	off = 0;
+	for (b=fn->start; b; b=b->link) {
+		pos[b->id] = off;
+		off += blksz(b);
+	}
+	pos[fn->nblk] = off;
+
+	/* jump table targets always need a label */
+	jt = alloc(fn->nblk);
+	for (b=fn->start; b; b=b->link)
+		for (n=0; n<b->njtab; n++)
+			jt[b->jtab[n]->id] = 1;
 
 	/* emit blocks */
 	for (lbl=0, b=fn->start; b; b=b->link) {
-		if (lbl || b->npred > 1)
+		if (lbl || b->npred > 1 || jt[b->id])
 			fprintf(f, ".L%d:\n", id0+b->id);
+		if (b == fr.pro && b != fn->start)
+			emitpro(fn, f);
+		jtlbl = id0+b->id;
+		fi = brcmp(b, &c);
 		for (i=b->ins; i!=&b->ins[b->nins]; i++)
-			emitins(i, fn, f);
+			if (i != fi)
+				emitins(i, fn, f);
 		lbl = 1;
 		switch (b->jmp.type) {
 		case Jhlt:
 			fprintf(f, "  halt\n");
 			break;
+		case Jjtab:
+			fprintf(f, "  jumpr 0 %s\n", jmparg(b, fn, f));
+			break;
 		case Jret0:
-			/* epilogue: restore callee-saves, FP, RA, return */
-			off = 4;
-			for (pr=b32p3_rclob; *pr>=0; pr++) {
-				if (fn->reg & BIT(*pr)) {
-					fprintf(f, "  read -%d r14 %s\n",
-						off + 4 * fn->slot, rname[*pr]);
-					off += 4;
-				}
-			}
-			fprintf(f,
-				"  or r0 r14 r13\n"   /* SP = FP */
-				"  read 4 r14 r15\n"  /* restore RA */
-				"  read 0 r14 r14\n"  /* restore FP */
-				"  jumpr 0 r15\n"     /* return */
-			);
+			if (fr.framed[b->id])
+				emitepi(fn, f);
+			else
+				fprintf(f, "  jumpr 0 r15\n");
 			break;
 		case Jjmp:
 		Jmp:
-			if (b->s1 != b->link)
+			if (fretblk(b, b->s1))
+				fprintf(f, "  jumpr 0 r15\n");
+			else if (b->s1 != b->link)
 				fprintf(f, "  jump .L%d\n", id0+b->s1->id);
 			else
 				lbl = 0;
 			break;
 		case Jjnz:
-			neg = 0;
-			if (b->link == b->s2) {
+			if (fi) {
+				ra = brarg(fi->arg[0], fn);
+				rb = brarg(fi->arg[1], fn);
+				goto Jcc;
+			}
+			ra = jmparg(b, fn, f);
+			rb = "r0";
+			c = Cine;
+		Jcc:
+			/* branch to s2 and fall through or jump to s1;
+			 * s1 should be the next block, else branch
+			 * straight to the successor deeper in loops */
+			c = cmpneg(c);
+			s = fretblk(b, b->link) ? 0 : b->link;
+			if (s == b->s2
+			|| (s != b->s1 && b->s1->loop > b->s2->loop)) {
 				s = b->s1;
 				b->s1 = b->s2;
 				b->s2 = s;
-				neg = 1;
-			}
-			if (rtype(b->jmp.arg) == RSlot) {
-				/* Spill pass turned jnz arg into a slot;
-				 * emit a load from the spill slot into r12 */
-				int64_t soff = slot(b->jmp.arg, fn);
-				if (soff >= -32768 && soff <= 32767) {
-					fprintf(f, "  read %d r14 r12\n", (int)soff);
-				} else {
-					fprintf(f, "  load32 %d r12\n", (int)soff);
-					fprintf(f, "  add r14 r12 r12\n");
-					fprintf(f, "  read 0 r12 r12\n");
-				}
-				fprintf(f,
-					"  %s r12 r0 8\n"
-					"  jump .L%d\n",
-					neg ? "beq" : "bne",
-					id0+b->s2->id
-				);
-			} else {
-				assert(isreg(b->jmp.arg));
-				fprintf(f,
-					"  %s %s r0 8\n"
-					"  jump .L%d\n",
-					neg ? "beq" : "bne",
-					rname[b->jmp.arg.val],
-					id0+b->s2->id
-				);
+				c = cmpneg(c);
 			}
+			if (fretblk(b, b->s2)) {
+				/* frameless return, emitted last */
+				fr.nret = 1;
+				t = fn->nblk;
+			} else
+				t = b->s2->id;
+			emitbr(c, ra, rb, b, t, pos, id0, f);
 			goto Jmp;
 		}
 	}
-	id0 += fn->nblk;
+	if (fr.nret)
+		fprintf(f, ".L%d:\n  jumpr 0 r15\n", id0+fn->nblk);
+	for (b=fn->start; b; b=b->link) {
+		if (b->jmp.type != Jjtab)
+			continue;
+		fprintf(f, "\n.rdata\n.balign 4\n.Ljt%d:\n", id0+b->id);
+		for (n=0; n<b->njidx; n++)
+			fprintf(f, "  .int .L%d\n",
+				id0+b->jtab[b->jidx[n]]->id);
+	}
+	id0 += fn->nblk + 1;
 	fprintf(f, "\n");
 }
 
@@ -138,6 +138,346 @@ selcmp(Ins i, int k, int op, Fn *fn)
 	fixarg(&icmp->arg[1], k, icmp, fn);
 }
 
+/*
+ * Multiplication, division and remainder by constants.
+ *
+ * DIVS/DIVU/MODS/MODU take about 32 cycles and MULSHI/MULTUHI
+ * about 4, so x / d becomes a multiply-high by a magic
+ * reciprocal of d plus shifts (Hacker's Delight, chapter 10)
+ * and x % d becomes x - (x / d) * d.  Powers of two only need
+ * shifts and masks.  Multiplications by 2^k and 2^k +- 1 use
+ * at most two single-cycle instructions instead of MULTS.
+ *
+ * The magic numbers are computed with 32-bit arithmetic only,
+ * so the self-hosted compiler finds the same ones.
+ */
+
+static int
+log2u(uint32_t v)
+{
+	int k;
+
+	if (v == 0 || (v & (v - 1)))
+		return -1;
+	for (k=0; v>1; k++)
+		v >>= 1;
+	return k;
+}
+
+/* signed magic for 2 <= d < 2^31: x / d == mulhs(x, m) [+ x] >> s */
+static void
+magics(uint32_t d, uint32_t *m, int *s)
+{
+	uint32_t anc, delta, q1, r1, q2, r2, t;
+	int p;
+
+	t = 0x80000000u;
+	anc = t - 1 - t % d;
+	p = 31;
+	q1 = t / anc;
+	r1 = t - q1 * anc;
+	q2 = t / d;
+	r2 = t - q2 * d;
+	do {
+		p++;
+		q1 *= 2;
+		r1 *= 2;
+		if (r1 >= anc) {
+			q1++;
+			r1 -= anc;
+		}
+		q2 *= 2;
+		r2 *= 2;
+		if (r2 >= d) {
+			q2++;
+			r2 -= d;
+		}
+		delta = d - r2;
+	} while (q1 < delta || (q1 == delta && r1 == 0));
+	*m = q2 + 1;
+	*s = p - 32;
+}
+
+/* unsigned magic for 2 <= d < 2^31; when *a is set the
+ * product needs 33 bits and the add-and-halve fixup */
+static void
+magicu(uint32_t d, uint32_t *m, int *a, int *s)
+{
+	uint32_t p32, q, r, delta;
+	int p;
+
+	*a = 0;
+	p = 31;
+	p32 = 0;
+	q = 0x7FFFFFFFu / d;
+	r = 0x7FFFFFFFu - q * d;
+	do {
+		p++;
+		p32 = p == 32 ? 1 : 2 * p32;
+		if (r + 1 >= d - r) {
+			if (q >= 0x7FFFFFFFu)
+				*a = 1;
+			q = 2 * q + 1;
+			r = 2 * r + 1 - d;
+		} else {
+			if (q >= 0x80000000u)
+				*a = 1;
+			q = 2 * q;
+			r = 2 * r + 1;
+		}
+		delta = d - 1 - r;
+	} while (p < 64 && p32 < delta);
+	*m = q + 1;
+	*s = p - 32;
+}
+
+/* emit to = a op b, selected; emission runs backwards,
+ * so sequences below are emitted last instruction first */
+static void
+emitsel(int op, int k, Ref to, Ref a, Ref b, Fn *fn)
+{
+	Ins *i;
+
+	emit(op, k, to, a, b);
+	i = curi;
+	fixarg(&i->arg[0], k, i, fn);
+	if (!req(b, R))
+		fixarg(&i->arg[1], k, i, fn);
+}
+
+static Ref
+tmp(Fn *fn)
+{
+	return newtmp("isel", Kw, fn);
+}
+
+static Ref
+con(int32_t v, Fn *fn)
+{
+	return getcon(v, fn);
+}
+
+/* to = x * c */
+static void
+selmulc(int k, Ref to, Ref x, int32_t c, Fn *fn)
+{
+	Ref t;
+	int n;
+
+	if ((n = log2u(c)) >= 0) {
+		if (n == 0)
+			emitsel(Ocopy, k, to, x, R, fn);
+		else
+			emitsel(Oshl, k, to, x, con(n, fn), fn);
+	} else if (c != INT32_MIN && (n = log2u(-c)) >= 0) {
+		t = n ? tmp(fn) : x;
+		emitsel(Oneg, k, to, t, R, fn);
+		if (n)
+			emitsel(Oshl, Kw, t, x, con(n, fn), fn);
+	} else if ((n = log2u((uint32_t)c - 1)) > 0
+	|| (n = log2u((uint32_t)c + 1)) > 1) {
+		t = tmp(fn);
+		emitsel((uint32_t)c - 1 == 1u << n ? Oadd : Osub,
+			k, to, t, x, fn);
+		emitsel(Oshl, Kw, t, x, con(n, fn), fn);
+	} else
+		emitsel(Omul, k, to, x, con(c, fn), fn);
+}
+
+/* to = x / d for signed d > 1 */
+static void
+seldivs(int k, Ref to, Ref x, uint32_t d, Fn *fn)
+{
+	Ref t1, t2, t3, t4;
+	uint32_t m;
+	int n, s;
+
+	t4 = tmp(fn);
+	if ((n = log2u(d)) > 0) {
+		/* round towards zero: add d-1 to negative x */
+		t2 = tmp(fn);
+		emitsel(Osar, k, to, t2, con(n, fn), fn);
+		emitsel(Oadd, Kw, t2, x, t4, fn);
+		if (n == 1)
+			emitsel(Oshr, Kw, t4, x, con(31, fn), fn);
+		else {
+			t1 = tmp(fn);
+			emitsel(Oshr, Kw, t4, t1, con(32 - n, fn), fn);
+			emitsel(Osar, Kw, t1, x, con(31, fn), fn);
+		}
+		return;
+	}
+	magics(d, &m, &s);
+	t1 = tmp(fn);
+	t2 = (int32_t)m < 0 ? tmp(fn) : t1;
+	t3 = s ? tmp(fn) : t2;
+	/* add one for negative x */
+	emitsel(Oadd, k, to, t3, t4, fn);
+	emitsel(Oshr, Kw, t4, x, con(31, fn), fn);
+	if (s)
+		emitsel(Osar, Kw, t3, t2, con(s, fn), fn);
+	if (!req(t2, t1))
+		emitsel(Oadd, Kw, t2, t1, x, fn);
+	emitsel(Omulhs, Kw, t1, x, con(m, fn), fn);
+}
+
+/* to = x / d for unsigned d > 1 */
+static void
+seldivu(int k, Ref to, Ref x, uint32_t d, Fn *fn)
+{
+	Ref t1, t2, t3, t4;
+	uint32_t m;
+	int n, a, s;
+
+	if ((n = log2u(d)) > 0) {
+		emitsel(Oshr, k, to, x, con(n, fn), fn);
+		return;
+	}
+	if (d >= 0x80000000u) {
+		/* the quotient is 0 or 1 */
+		t1 = tmp(fn);
+		emitsel(Oxor, k, to, t1, con(1, fn), fn);
+		emitsel(Ocultl, Kw, t1, x, con(d, fn), fn);
+		return;
+	}
+	magicu(d, &m, &a, &s);
+	t1 = tmp(fn);
+	if (!a) {
+		if (s)
+			emitsel(Oshr, k, to, t1, con(s, fn), fn);
+		emitsel(Omulhu, Kw, s ? t1 : to, x, con(m, fn), fn);
+		return;
+	}
+	/* to = (((x - t1) >> 1) + t1) >> (s - 1) */
+	t2 = tmp(fn);
+	t3 = tmp(fn);
+	t4 = tmp(fn);
+	if (s > 1)
+		emitsel(Oshr, k, to, t4, con(s - 1, fn), fn);
+	emitsel(Oadd, Kw, s > 1 ? t4 : to, t3, t1, fn);
+	emitsel(Oshr, Kw, t3, t2, con(1, fn), fn);
+	emitsel(Osub, Kw, t2, x, t1, fn);
+	emitsel(Omulhu, Kw, t1, x, con(m, fn), fn);
+}
+
+/* to = x % 2^n, signed */
+static void
+selrems2(int k, Ref to, Ref x, int n, Fn *fn)
+{
+	Ref t1, t2, t3, t4;
+
+	t1 = tmp(fn);
+	t2 = tmp(fn);
+	t3 = tmp(fn);
+	t4 = tmp(fn);
+	emitsel(Osub, k, to, x, t4, fn);
+	emitsel(Oand, Kw, t4, t3, con(-(1u << n), fn), fn);
+	emitsel(Oadd, Kw, t3, x, t2, fn);
+	if (n == 1)
+		emitsel(Oshr, Kw, t2, x, con(31, fn), fn);
+	else {
+		emitsel(Oshr, Kw, t2, t1, con(32 - n, fn), fn);
+		emitsel(Osar, Kw, t1, x, con(31, fn), fn);
+	}
+}
+
+/* returns 0 if i is left for the generic path */
+static int
+selconst(Ins i, Fn *fn)
+{
+	Con *c;
+	Ref x, q, p;
+	int32_t d;
+	int k, n;
+
+	if (KBASE(i.cls) != 0)
+		return 0;
+	k = i.cls;
+	x = i.arg[0];
+	if (rtype(i.arg[1]) != RCon) {
+		if (i.op != Omul || rtype(x) != RCon)
+			return 0;
+		x = i.arg[1];
+		i.arg[1] = i.arg[0];
+	}
+	c = &fn->con[i.arg[1].val];
+	if (c->type != CBits || rtype(x) == RCon)
+		return 0;
+	d = (int32_t)c->bits.i;
+
+	if (d == 1 || (d == -1 && (i.op == Odiv || i.op == Orem))) {
+		switch (i.op) {
+		case Odiv:
+			emitsel(d < 0 ? Oneg : Ocopy, k, i.to, x, R, fn);
+			return 1;
+		case Oudiv:
+			emitsel(Ocopy, k, i.to, x, R, fn);
+			return 1;
+		case Orem:
+		case Ourem:
+			emitsel(Ocopy, k, i.to, con(0, fn), R, fn);
+			return 1;
+		}
+	}
+	switch (i.op) {
+	case Omul:
+		selmulc(k, i.to, x, d, fn);
+		return 1;
+	case Odiv:
+		if (d == 0)
+			break;
+		if (d == INT32_MIN) {
+			/* 1 for INT32_MIN, 0 otherwise */
+			q = tmp(fn);
+			emitsel(Oreqz, k, i.to, q, R, fn);
+			emitsel(Oxor, Kw, q, x, con(d, fn), fn);
+			return 1;
+		}
+		if (d > 0) {
+			seldivs(k, i.to, x, d, fn);
+			return 1;
+		}
+		q = tmp(fn);
+		emitsel(Oneg, k, i.to, q, R, fn);
+		seldivs(Kw, q, x, -d, fn);
+		return 1;
+	case Oudiv:
+		if (d == 0)
+			break;
+		seldivu(k, i.to, x, d, fn);
+		return 1;
+	case Orem:
+		/* the sign of d does not matter */
+		if (d == 0)
+			break;
+		if (d == INT32_MIN || (n = log2u(d < 0 ? -d : d)) > 0) {
+			selrems2(k, i.to, x, d == INT32_MIN ? 31 : n, fn);
+			return 1;
+		}
+		d = d < 0 ? -d : d;
+		q = tmp(fn);
+		p = tmp(fn);
+		emitsel(Osub, k, i.to, x, p, fn);
+		selmulc(Kw, p, q, d, fn);
+		seldivs(Kw, q, x, d, fn);
+		return 1;
+	case Ourem:
+		if (d == 0)
+			break;
+		if ((n = log2u(d)) > 0) {
+			emitsel(Oand, k, i.to, x, con(d - 1, fn), fn);
+			return 1;
+		}
+		q = tmp(fn);
+		p = tmp(fn);
+		emitsel(Osub, k, i.to, x, p, fn);
+		selmulc(Kw, p, q, d, fn);
+		seldivu(Kw, q, x, d, fn);
+		return 1;
+	}
+	return 0;
+}
+
 static void
 sel(Ins i, Fn *fn)
 {
@@ -154,6 +494,8 @@ sel(Ins i, Fn *fn)
 		selcmp(i, ck, cc, fn);
 		return;
 	}
+	if (selconst(i, fn))
+		return;
 	if (i.op != Onop) {
 		emiti(i);
 		i0 = curi;
@@ -162,11 +504,77 @@ sel(Ins i, Fn *fn)
 	}
 }
 
+static void
+selbrarg(Ref *r, Ins *i, Fn *fn)
+{
+	/* zero is read from r0; anything else needs a register */
+	if (rtype(*r) == RCon && fn->con[r->val].type == CBits
+	&& (int32_t)fn->con[r->val].bits.i == 0)
+		return;
+	/* without an instruction fixarg never keeps an immediate */
+	fixarg(r, Kw, rtype(*r) == RCon ? 0 : i, fn);
+}
+
+/*
+ * jtab loads its target from a table of block
+ * addresses that emit places after the function;
+ * jtaddr is the address of the table of the block.
+ */
+static void
+seljtab(Blk *b, Fn *fn)
+{
+	Ref t, o, a, d;
+	Ins *i;
+
+	t = newtmp("isel", Kw, fn);
+	o = newtmp("isel", Kw, fn);
+	a = newtmp("isel", Kw, fn);
+	d = newtmp("isel", Kw, fn);
+	emit(Oload, Kw, d, a, R);
+	emit(Oadd, Kw, a, t, o);
+	emit(Ojtaddr, Kw, t, R, R);
+	emit(Oshl, Kw, o, b->jmp.arg, getcon(2, fn));
+	i = curi;
+	fixarg(&i->arg[0], Kw, i, fn);
+	b->jmp.arg = d;
+}
+
+/*
+ * B32P3 branches compare two registers.  An integer
+ * comparison whose only use is the block's jnz is left
+ * unlowered as the last instruction of the block, so
+ * emit can fold it into the branch.
+ */
 static void
 seljmp(Blk *b, Fn *fn)
 {
-	if (b->jmp.type == Jjnz)
-		fixarg(&b->jmp.arg, Kw, 0, fn);
+	Ref r;
+	Ins *fi, *i;
+	int c, k;
+
+	if (b->jmp.type == Jjtab) {
+		seljtab(b, fn);
+		return;
+	}
+	if (b->jmp.type != Jjnz)
+		return;
+	r = b->jmp.arg;
+	fi = 0;
+	if (rtype(r) == RTmp && fn->tmp[r.val].nuse == 1)
+		for (i=&b->ins[b->nins]; i!=b->ins;)
+			if (req((--i)->to, r)) {
+				fi = i;
+				break;
+			}
+	if (fi && iscmp(fi->op, &k, &c) && KBASE(k) == 0) {
+		emiti(*fi);
+		i = curi;
+		selbrarg(&i->arg[0], i, fn);
+		selbrarg(&i->arg[1], i, fn);
+		*fi = (Ins){.op = Onop};
+		return;
+	}
+	fixarg(&b->jmp.arg, Kw, 0, fn);
 }
 
 void
@@ -200,13 +608,14 @@ b32p3_isel(Fn *fn)
 
 	for (b=fn->start; b; b=b->link) {
 		curi = &insb[NIns];
-		for (sb=(Blk*[3]){b->s1, b->s2, 0}; *sb; sb++)
+		/* first, so a fused compare stays the last instruction */
+		seljmp(b, fn);
+		for (sb=succlist(b); *sb; sb++)
 			for (p=(*sb)->phi; p; p=p->link) {
 				for (n=0; p->blk[n] != b; n++)
 					assert(n+1 < p->narg);
 				fixarg(&p->arg[n], p->cls, 0, fn);
 			}
-		seljmp(b, fn);
 		for (i=&b->ins[b->nins]; i!=b->ins;)
 			sel(*--i, fn);
 		b->nins = &insb[NIns] - curi;
@@ -0,0 +1,275 @@
+#include "all.h"
+
+/*
+ * Post-allocation list scheduling, enabled with -O.
+ *
+ * B32P3 stalls one cycle when an instruction uses the
+ * register a read (or pop) loads in the cycle before, and
+ * one cycle when two memory accesses in a row go to
+ * different cache lines.  Multiplies and divides freeze the
+ * whole pipeline while they run, so nothing can overlap
+ * them and they count as one cycle here.
+ *
+ * Each block is reordered within the dependences between
+ * its registers and memory accesses: the instruction picked
+ * next is the one that can start earliest, ties broken by
+ * the longest latency path to the end of the region.  The
+ * code of a block that is only entered by falling through
+ * is moved up and scheduled with its predecessor.  Calls
+ * and stack allocations stay in place and split a block
+ * into regions, and the compare of a fused branch stays
+ * last.  Reads through registers keep their order, since
+ * they may be memory-mapped I/O.
+ */
+
+enum {
+	Window = 64, /* max instructions scheduled together */
+	LoadLat = 2,
+};
+
+typedef struct Node Node;
+
+struct Node {
+	Ins i;
+	bits use, def;
+	Ref rd, wr;  /* memory read and written, or R */
+	int npred;
+	int h;       /* latency to the end of the region */
+	int t;       /* earliest cycle without a stall */
+	int done;
+};
+
+static Node nd[Window];
+static char dep[Window][Window];
+
+static bits
+regbit(Ref r)
+{
+	if (!isreg(r) || r.val == R12)
+		return 0;
+	return BIT(r.val);
+}
+
+static int
+barrier(Ins *i)
+{
+	return i->op == Ocall || i->op == Osalloc || i->op == Odbgloc;
+}
+
+static void
+mknode(Node *n, Ins *i)
+{
+	n->i = *i;
+	n->use = regbit(i->arg[0]) | regbit(i->arg[1]);
+	n->def = regbit(i->to);
+	n->rd = R;
+	n->wr = R;
+	if (isload(i->op))
+		n->rd = i->arg[0];
+	else if (isstore(i->op))
+		n->wr = i->arg[1];
+	else if (i->op == Ocopy) {
+		if (rtype(i->arg[0]) == RSlot)
+			n->rd = i->arg[0];
+		if (rtype(i->to) == RSlot)
+			n->wr = i->to;
+	} else if (i->op == Oswap)
+		n->def |= n->use;
+	n->npred = 0;
+	n->h = 0;
+	n->t = 0;
+	n->done = 0;
+}
+
+static int
+ismem(Node *n)
+{
+	return !req(n->rd, R) || !req(n->wr, R);
+}
+
+static int
+isld(Node *n)
+{
+	return !req(n->rd, R) && rtype(n->i.to) == RTmp;
+}
+
+/* can accesses at a and b overlap? */
+static int
+overlap(Ref a, Ref b, Fn *fn)
+{
+	Con *ca, *cb;
+
+	if (req(a, R) || req(b, R))
+		return 0;
+	if (rtype(a) == RSlot && rtype(b) == RSlot)
+		return a.val == b.val;
+	if (rtype(a) == RCon && rtype(b) == RCon) {
+		ca = &fn->con[a.val];
+		cb = &fn->con[b.val];
+		if (ca->type != CAddr || cb->type != CAddr)
+			return 1;
+		if (ca->sym.id != cb->sym.id)
+			return 0;
+		return ca->bits.i - cb->bits.i < 4
+			&& cb->bits.i - ca->bits.i < 4;
+	}
+	if ((rtype(a) == RSlot && rtype(b) == RCon)
+	|| (rtype(a) == RCon && rtype(b) == RSlot))
+		return 0;
+	return 1;
+}
+
+/* must b stay after a? */
+static int
+after(Node *a, Node *b, Fn *fn)
+{
+	if ((a->def & (b->use | b->def)) || (a->use & b->def))
+		return 1;
+	if (overlap(a->wr, b->rd, fn) || overlap(a->wr, b->wr, fn)
+	|| overlap(a->rd, b->wr, fn))
+		return 1;
+	return rtype(a->rd) == RTmp && rtype(b->rd) == RTmp;
+}
+
+static int
+lat(Node *a, bits use)
+{
+	return isld(a) && (a->def & use) ? LoadLat : 1;
+}
+
+/* probably the same cache line, as for nearby stack slots */
+static int
+sameline(Node *a, Node *b)
+{
+	Ref ra, rb;
+
+	ra = req(a->rd, R) ? a->wr : a->rd;
+	rb = req(b->rd, R) ? b->wr : b->rd;
+	if (rtype(ra) == RSlot && rtype(rb) == RSlot)
+		return rsval(ra) - rsval(rb) < 8 && rsval(rb) - rsval(ra) < 8;
+	return req(ra, rb);
+}
+
+/*
+ * Reorder ins[0..n); with pin, the last instruction stays
+ * last.  tuse holds the registers the block jump reads.
+ */
+static void
+schedule(Ins *ins, int n, int pin, bits tuse, Fn *fn)
+{
+	Node *a, *b, *last;
+	int x, y, k, c, s, best, bs;
+
+	for (x=0; x<n; x++)
+		mknode(&nd[x], &ins[x]);
+	for (y=0; y<n; y++)
+		for (x=0; x<y; x++) {
+			dep[x][y] = (pin && y == n-1) || after(&nd[x], &nd[y], fn);
+			nd[y].npred += dep[x][y];
+		}
+	for (x=n; x-->0;) {
+		a = &nd[x];
+		a->h = lat(a, tuse);
+		for (y=x+1; y<n; y++)
+			if (dep[x][y]) {
+				k = lat(a, nd[y].use) + nd[y].h;
+				if (k > a->h)
+					a->h = k;
+			}
+	}
+
+	last = 0;
+	c = 0;
+	for (k=0; k<n; k++) {
+		best = -1;
+		bs = 0;
+		for (y=0; y<n; y++) {
+			b = &nd[y];
+			if (b->done || b->npred)
+				continue;
+			s = b->t > c ? b->t : c;
+			if (last && ismem(last) && ismem(b) && !sameline(last, b))
+				s++;
+			if (best < 0 || s < bs
+			|| (s == bs && b->h > nd[best].h)) {
+				best = y;
+				bs = s;
+			}
+		}
+		assert(best >= 0);
+		a = &nd[best];
+		a->done = 1;
+		ins[k] = a->i;
+		for (y=best+1; y<n; y++)
+			if (dep[best][y]) {
+				b = &nd[y];
+				b->npred--;
+				s = bs + lat(a, b->use);
+				if (s > b->t)
+					b->t = s;
+			}
+		last = a;
+		c = bs + 1;
+	}
+}
+
+/* the compare of b folded into its branch by emit.c */
+static Ins *
+fused(Blk *b)
+{
+	Ins *i;
+	int k;
+
+	if (b->jmp.type != Jjnz || b->nins == 0)
+		return 0;
+	i = &b->ins[b->nins-1];
+	if (!iscmp(i->op, &k, &k) || !req(i->to, b->jmp.arg))
+		return 0;
+	return i;
+}
+
+void
+b32p3_sched(Fn *fn)
+{
+	Blk *b, *s;
+	Ins *i, *i0, *end, *cmp;
+	bits tuse;
+	int n;
+
+	for (b=fn->start; b; b=b->link) {
+		/* pull in the code of blocks it falls into
+		 * that have no other entry
+		 */
+		for (s=b; s->jmp.type == Jjmp && s->s1 == s->link
+		&& s->s1->npred == 1 && s->s1 != b;) {
+			s = s->s1;
+			n = s->nins - (fused(s) != 0);
+			i = alloc((b->nins + n) * sizeof i[0]);
+			icpy(icpy(i, b->ins, b->nins), s->ins, n);
+			b->ins = i;
+			b->nins += n;
+			s->ins += n;
+			s->nins -= n;
+		}
+		cmp = fused(s);
+		if (cmp && s != b)
+			tuse = regbit(cmp->arg[0]) | regbit(cmp->arg[1]);
+		else
+			tuse = regbit(s->jmp.arg);
+		end = &b->ins[b->nins];
+		for (i0=b->ins; i0<end;) {
+			if (barrier(i0)) {
+				i0++;
+				continue;
+			}
+			for (i=i0; i<end && !barrier(i) && i-i0<Window; i++)
+				;
+			n = i - i0;
+			if (n > 1)
+				schedule(i0, n, cmp && s == b && i == end,
+					i == end ? tuse : 0, fn);
+			i0 = i;
+		}
+		b = s;
+	}
+}
@@ -43,6 +43,7 @@ Target T_b32p3 = {
 	.abi0 = elimsb,
 	.abi1 = b32p3_abi,
 	.isel = b32p3_isel,
+	.sched = b32p3_sched,
 	.emitfn = b32p3_emitfn,
 	.emitfin = b32p3_emitfin,
 	.asloc = ".L",
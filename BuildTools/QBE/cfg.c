@@ -42,6 +42,38 @@ edgedel(Blk *bs, Blk **pbd)
 	}
 }
 
+/* delete the jtab edges of bs, except the one to bd */
+void
+jtabdel(Blk *bs, Blk *bd)
+{
+	uint n;
+
+	for (n=0; n<bs->njtab; n++)
+		if (bs->jtab[n] != bd)
+			edgedel(bs, &bs->jtab[n]);
+	bs->njtab = 0;
+	bs->njidx = 0;
+}
+
+/* successors of b, each once, 0-terminated */
+Blk **
+succlist(Blk *b)
+{
+	Blk **s;
+	uint n;
+
+	s = alloc((3 + b->njtab) * sizeof s[0]);
+	n = 0;
+	if (b->s1)
+		s[n++] = b->s1;
+	if (b->s2 && b->s2 != b->s1)
+		s[n++] = b->s2;
+	if (b->njtab)
+		memcpy(&s[n], b->jtab, b->njtab * sizeof s[0]);
+	s[n + b->njtab] = 0;
+	return s;
+}
+
 static void
 addpred(Blk *bp, Blk *bc)
 {
@@ -57,6 +89,7 @@ void
 fillpreds(Fn *f)
 {
 	Blk *b;
+	uint n;
 
 	for (b=f->start; b; b=b->link) {
 		b->npred = 0;
@@ -67,12 +100,16 @@ fillpreds(Fn *f)
 			b->s1->npred++;
 		if (b->s2 && b->s2 != b->s1)
 			b->s2->npred++;
+		for (n=0; n<b->njtab; n++)
+			b->jtab[n]->npred++;
 	}
 	for (b=f->start; b; b=b->link) {
 		if (b->s1)
 			addpred(b, b->s1);
 		if (b->s2 && b->s2 != b->s1)
 			addpred(b, b->s2);
+		for (n=0; n<b->njtab; n++)
+			addpred(b, b->jtab[n]);
 	}
 }
 
@@ -80,6 +117,7 @@ static int
 rporec(Blk *b, uint x)
 {
 	Blk *s1, *s2;
+	uint n;
 
 	if (!b || b->id != -1u)
 		return x;
@@ -90,6 +128,8 @@ rporec(Blk *b, uint x)
 		s1 = b->s2;
 		s2 = b->s1;
 	}
+	for (n=b->njtab; n>0; n--)
+		x = rporec(b->jtab[n-1], x);
 	x = rporec(s1, x);
 	x = rporec(s2, x);
 	b->id = x;
@@ -113,6 +153,7 @@ fillrpo(Fn *f)
 		if (b->id == -1u) {
 			edgedel(b, &b->s1);
 			edgedel(b, &b->s2);
+			jtabdel(b, 0);
 			*p = b->link;
 		} else {
 			b->id -= n;
@@ -220,6 +261,7 @@ void
 fillfron(Fn *fn)
 {
 	Blk *a, *b;
+	uint n;
 
 	for (b=fn->start; b; b=b->link)
 		b->nfron = 0;
@@ -230,6 +272,9 @@ fillfron(Fn *fn)
 		if (b->s2)
 			for (a=b; !sdom(a, b->s2); a=a->idom)
 				addfron(a, b->s2);
+		for (n=0; n<b->njtab; n++)
+			for (a=b; !sdom(a, b->jtab[n]); a=a->idom)
+				addfron(a, b->jtab[n]);
 	}
 }
 
@@ -291,6 +336,26 @@ uffind(Blk **pb, Blk **uf)
 	}
 }
 
+/* merge jtab entries that now go to the same block */
+static void
+jtabuniq(Blk *b)
+{
+	uint n, m, k, *map;
+
+	map = alloc(b->njtab * sizeof map[0]);
+	for (n=0, k=0; n<b->njtab; n++) {
+		for (m=0; m<k; m++)
+			if (b->jtab[m] == b->jtab[n])
+				break;
+		if (m == k)
+			b->jtab[k++] = b->jtab[n];
+		map[n] = m;
+	}
+	b->njtab = k;
+	for (n=0; n<b->njidx; n++)
+		b->jidx[n] = map[b->jidx[n]];
+}
+
 /* requires rpo and no phis, breaks cfg */
 void
 simpljmp(Fn *fn)
@@ -298,6 +363,7 @@ simpljmp(Fn *fn)
 
 	Blk **uf; /* union-find */
 	Blk **p, *b, *ret;
+	uint n;
 
 	ret = newblk();
 	ret->id = fn->nblk++;
@@ -325,6 +391,11 @@ simpljmp(Fn *fn)
 			b->jmp.type = Jjmp;
 			b->s2 = 0;
 		}
+		if (b->njtab) {
+			for (n=0; n<b->njtab; n++)
+				uffind(&b->jtab[n], uf);
+			jtabuniq(b);
+		}
 	}
 	*p = ret;
 	free(uf);
@@ -14,7 +14,8 @@ struct Edge {
 };
 
 static int *val;
-static Edge *flowrk, (*edge)[2];
+static Edge *flowrk, **edge; /* s1, s2, then jtab */
+static uint *nedge;
 static Use **usewrk;
 static uint nuse;
 
@@ -69,12 +70,12 @@ static int
 deadedge(int s, int d)
 {
 	Edge *e;
+	uint n;
 
 	e = edge[s];
-	if (e[0].dest == d && !e[0].dead)
-		return 0;
-	if (e[1].dest == d && !e[1].dead)
-		return 0;
+	for (n=0; n<nedge[s]; n++)
+		if (e[n].dest == d && !e[n].dead)
+			return 0;
 	return 1;
 }
 
@@ -118,10 +119,23 @@ visitins(Ins *i, Fn *fn)
 	update(i->to.val, v, fn);
 }
 
+/* queue a jtab edge once, dead = 2 while queued */
+static void
+flowedge(Edge *e)
+{
+	if (e->dead == 1) {
+		e->dead = 2;
+		e->work = flowrk;
+		flowrk = e;
+	}
+}
+
 static void
 visitjmp(Blk *b, int n, Fn *fn)
 {
 	int l;
+	uint k;
+	int64_t x;
 
 	switch (b->jmp.type) {
 	case Jjnz:
@@ -146,6 +160,17 @@ visitjmp(Blk *b, int n, Fn *fn)
 		edge[n][0].work = flowrk;
 		flowrk = &edge[n][0];
 		break;
+	case Jjtab:
+		l = latval(b->jmp.arg);
+		x = -1;
+		if (l != Bot && l != Top && fn->con[l].type == CBits)
+			x = (uint32_t)fn->con[l].bits.i;
+		if (x >= 0 && x < b->njidx)
+			flowedge(&edge[n][2 + b->jidx[x]]);
+		else
+			for (k=0; k<b->njtab; k++)
+				flowedge(&edge[n][2 + k]);
+		break;
 	case Jhlt:
 		break;
 	default:
@@ -193,6 +218,7 @@ fold(Fn *fn)
 
 	val = emalloc(fn->ntmp * sizeof val[0]);
 	edge = emalloc(fn->nblk * sizeof edge[0]);
+	nedge = emalloc(fn->nblk * sizeof nedge[0]);
 	usewrk = vnew(0, sizeof usewrk[0], PHeap);
 
 	for (t=0; t<fn->ntmp; t++)
@@ -200,8 +226,12 @@ fold(Fn *fn)
 	for (n=0; n<fn->nblk; n++) {
 		b = fn->rpo[n];
 		b->visit = 0;
+		nedge[n] = 2 + b->njtab;
+		edge[n] = alloc(nedge[n] * sizeof edge[n][0]);
 		initedge(&edge[n][0], b->s1);
 		initedge(&edge[n][1], b->s2);
+		for (a=0; a<b->njtab; a++)
+			initedge(&edge[n][2 + a], b->jtab[a]);
 	}
 	initedge(&start, fn->start);
 	flowrk = &start;
@@ -277,6 +307,7 @@ fold(Fn *fn)
 				fprintf(stderr, "%s ", b->name);
 			edgedel(b, &b->s1);
 			edgedel(b, &b->s2);
+			jtabdel(b, 0);
 			*pb = b->link;
 			continue;
 		}
@@ -310,6 +341,16 @@ fold(Fn *fn)
 				b->jmp.type = Jjmp;
 				b->jmp.arg = R;
 		}
+		if (b->jmp.type == Jjtab && rtype(b->jmp.arg) == RCon) {
+			a = fn->con[b->jmp.arg.val].bits.i;
+			if (fn->con[b->jmp.arg.val].type == CBits
+			&& a < b->njidx) {
+				b->s1 = b->jtab[b->jidx[a]];
+				jtabdel(b, b->s1);
+				b->jmp.type = Jjmp;
+				b->jmp.arg = R;
+			}
+		}
 		pb = &b->link;
 	}
 
@@ -322,6 +363,7 @@ fold(Fn *fn)
 
 	free(val);
 	free(edge);
+	free(nedge);
 	vfree(usewrk);
 }
 
@@ -0,0 +1,631 @@
+#include "all.h"
+
+/*
+ * Function inlining.  After abi0, a function that is small
+ * enough (or marked inline) is saved, and direct calls to it
+ * in functions that come later in the same file are replaced
+ * by a copy of its body.  The copy is then optimized together
+ * with the caller.  Saved functions that are not exported are
+ * only compiled at the end of the file, if some emitted code
+ * or data still refers to them.
+ */
+
+enum {
+	InlSmall  = 8,    /* cost limit without a hint */
+	InlHint   = 40,   /* cost limit for "inline" functions */
+	InlAlways = 2000, /* cost limit for "alwaysinline" */
+	InlGrow   = 1500, /* callers stop growing at this cost */
+};
+
+typedef struct Inl Inl;
+
+struct Inl {
+	Fn fn;       /* header, blocks are in blk */
+	uint32_t id;
+	Blk *blk;    /* in layout order, blk[0] is the start */
+	int npar;
+	int cost;
+	int inl;     /* may be copied into callers */
+	int defer;   /* compile at the end of the file if used */
+	Inl *link;
+};
+
+static Inl *inls;
+static uint32_t *refh; /* referenced symbols, id+1, 0 is free */
+static uint nrefh, nref;
+
+static void
+refadd(uint32_t id)
+{
+	uint32_t *h;
+	uint n, i;
+
+	if (2 * (nref + 1) > nrefh) {
+		h = refh;
+		n = nrefh;
+		nrefh = n ? 2 * n : 256;
+		refh = emalloc(nrefh * sizeof refh[0]);
+		nref = 0;
+		for (i=0; i<n; i++)
+			if (h[i])
+				refadd(h[i] - 1);
+		free(h);
+	}
+	for (i=id*2654435761u;; i++) {
+		i &= nrefh - 1;
+		if (refh[i] == id + 1)
+			return;
+		if (!refh[i])
+			break;
+	}
+	refh[i] = id + 1;
+	nref++;
+}
+
+static int
+refhas(uint32_t id)
+{
+	uint i;
+
+	if (!nrefh)
+		return 0;
+	for (i=id*2654435761u;; i++) {
+		i &= nrefh - 1;
+		if (refh[i] == id + 1)
+			return 1;
+		if (!refh[i])
+			return 0;
+	}
+}
+
+void
+inlref(char *name)
+{
+	refadd(intern(name));
+}
+
+static void
+refarg(Ref r, Fn *fn)
+{
+	Con *c;
+
+	if (rtype(r) != RCon)
+		return;
+	c = &fn->con[r.val];
+	if (c->type == CAddr)
+		refadd(c->sym.id);
+}
+
+/* record the symbols fn refers to */
+static void
+refs(Fn *fn)
+{
+	Blk *b;
+	Ins *i;
+	Phi *p;
+	uint n;
+
+	for (b=fn->start; b; b=b->link) {
+		for (p=b->phi; p; p=p->link)
+			for (n=0; n<p->narg; n++)
+				refarg(p->arg[n], fn);
+		for (i=b->ins; i<&b->ins[b->nins]; i++) {
+			refarg(i->arg[0], fn);
+			refarg(i->arg[1], fn);
+		}
+		refarg(b->jmp.arg, fn);
+	}
+}
+
+/*
+ * Roughly the number of instructions left after optimization:
+ * loads and stores of locals are expected to be promoted.
+ */
+static int
+cost(Fn *fn)
+{
+	Blk *b;
+	Ins *i;
+	Phi *p;
+	char *local;
+	int n;
+
+	local = alloc(fn->ntmp);
+	for (i=fn->start->ins; i<&fn->start->ins[fn->start->nins]; i++)
+		if (isalloc(i->op))
+			local[i->to.val] = 1;
+	n = 0;
+	for (b=fn->start; b; b=b->link) {
+		for (p=b->phi; p; p=p->link)
+			n++;
+		for (i=b->ins; i<&b->ins[b->nins]; i++) {
+			if (ispar(i->op) || isalloc(i->op)
+			|| i->op == Odbgloc || i->op == Onop)
+				continue;
+			if (isload(i->op) && rtype(i->arg[0]) == RTmp
+			&& local[i->arg[0].val])
+				continue;
+			if (isstore(i->op) && rtype(i->arg[1]) == RTmp
+			&& local[i->arg[1].val])
+				continue;
+			n++;
+		}
+		if (b->jmp.type != Jjmp && !isret(b->jmp.type))
+			n++;
+	}
+	return n;
+}
+
+/* can calls to fn be replaced by its body? */
+static int
+inlinable(Fn *fn)
+{
+	Blk *b;
+	Ins *i;
+
+	if (fn->vararg || fn->retty >= 0 || fn->start->phi)
+		return 0;
+	for (b=fn->start; b; b=b->link) {
+		if (b->jmp.type == Jretc)
+			return 0;
+		for (i=b->ins; i<&b->ins[b->nins]; i++)
+			switch (i->op) {
+			case Oparc:
+			case Opare:
+			case Ovastart:
+			case Ovaarg:
+				return 0;
+			default:
+				/* only fixed-size locals can be hoisted */
+				if (isalloc(i->op))
+				if (b != fn->start || rtype(i->arg[0]) != RCon)
+					return 0;
+				break;
+			}
+	}
+	return 1;
+}
+
+static Ins *
+insdup(Ins *s, uint n, void *f(size_t))
+{
+	Ins *d;
+
+	d = f(n * sizeof d[0] + 1);
+	if (n)
+		memcpy(d, s, n * sizeof d[0]);
+	return d;
+}
+
+/* copy the blocks of fn into heap memory */
+static Blk *
+saveblks(Fn *fn)
+{
+	Blk *b, *b1, *blk;
+	Phi *p, *p1, **pp;
+	uint *idx, n, k;
+
+	idx = emalloc(fn->nblk * sizeof idx[0]);
+	n = 0;
+	for (b=fn->start; b; b=b->link)
+		idx[b->id] = n++;
+	blk = emalloc(n * sizeof blk[0]);
+#define B(s) ((s) ? &blk[idx[(s)->id]] : 0)
+	for (b=fn->start; b; b=b->link) {
+		b1 = B(b);
+		strcpy(b1->name, b->name);
+		b1->id = idx[b->id];
+		b1->ins = insdup(b->ins, b->nins, emalloc);
+		b1->nins = b->nins;
+		b1->jmp = b->jmp;
+		b1->s1 = B(b->s1);
+		b1->s2 = B(b->s2);
+		if (b->njtab) {
+			b1->jtab = emalloc(b->njtab * sizeof b1->jtab[0]);
+			for (k=0; k<b->njtab; k++)
+				b1->jtab[k] = B(b->jtab[k]);
+			b1->njtab = b->njtab;
+			b1->jidx = emalloc(b->njidx * sizeof b1->jidx[0]);
+			memcpy(b1->jidx, b->jidx, b->njidx * sizeof b1->jidx[0]);
+			b1->njidx = b->njidx;
+		}
+		pp = &b1->phi;
+		for (p=b->phi; p; p=p->link) {
+			p1 = emalloc(sizeof *p1);
+			*p1 = *p;
+			p1->arg = emalloc(p->narg * sizeof p1->arg[0]);
+			memcpy(p1->arg, p->arg, p->narg * sizeof p1->arg[0]);
+			p1->blk = emalloc(p->narg * sizeof p1->blk[0]);
+			for (k=0; k<p->narg; k++)
+				p1->blk[k] = B(p->blk[k]);
+			*pp = p1;
+			pp = &p1->link;
+		}
+		b1->link = b->link ? B(b->link) : 0;
+	}
+#undef B
+	free(idx);
+	return blk;
+}
+
+static void
+freeblks(Blk *blk)
+{
+	Blk *b;
+	Phi *p, *p1;
+
+	for (b=blk; b; b=b->link) {
+		free(b->ins);
+		free(b->jtab);
+		free(b->jidx);
+		for (p=b->phi; p; p=p1) {
+			p1 = p->link;
+			free(p->arg);
+			free(p->blk);
+			free(p);
+		}
+	}
+	free(blk);
+}
+
+static Inl *
+find(uint32_t id)
+{
+	Inl *p;
+
+	for (p=inls; p; p=p->link)
+		if (p->id == id)
+			return p;
+	return 0;
+}
+
+typedef struct Map Map;
+
+struct Map {
+	Fn *fn;
+	Inl *in;
+	Ref *tmp;
+	Ref *con;
+	Blk **blk;
+};
+
+static Ref
+mapref(Ref r, Map *m)
+{
+	switch (rtype(r)) {
+	case RTmp:
+		if (r.val < Tmp0)
+			return r;
+		if (req(m->tmp[r.val], R))
+			m->tmp[r.val] = newtmp("inl", m->in->fn.tmp[r.val].cls, m->fn);
+		return m->tmp[r.val];
+	case RCon:
+		if (r.val == 0)
+			return UNDEF;
+		if (req(m->con[r.val], R))
+			m->con[r.val] = newcon(&m->in->fn.con[r.val], m->fn);
+		return m->con[r.val];
+	default:
+		return r;
+	}
+}
+
+/*
+ * Replace the call at b->ins[ci], whose arguments start at
+ * b->ins[ai], by a copy of in; returns the block holding the
+ * instructions after the call.
+ */
+static Blk *
+expand(Fn *fn, Blk *b, uint ai, uint ci, Inl *in)
+{
+	Map m;
+	Blk *c, *s, *q, *q1, **ps;
+	Ins *i, *i0, call;
+	Phi *p, *p1, **pp;
+	uint n, k, nb, na, nal;
+
+	call = b->ins[ci];
+	for (nb=0, q=in->blk; q; q=q->link)
+		nb++;
+	m.fn = fn;
+	m.in = in;
+	m.tmp = alloc(in->fn.ntmp * sizeof m.tmp[0]);
+	m.con = alloc(in->fn.ncon * sizeof m.con[0]);
+	m.blk = alloc(nb * sizeof m.blk[0]);
+
+	/* the instructions after the call move to c */
+	c = newblk();
+	c->id = fn->nblk++;
+	strf(c->name, "%s.%d", b->name, c->id);
+	c->ins = insdup(&b->ins[ci+1], b->nins - (ci+1), alloc);
+	c->nins = b->nins - (ci+1);
+	c->jmp = b->jmp;
+	c->s1 = b->s1;
+	c->s2 = b->s2;
+	c->jtab = b->jtab;
+	c->njtab = b->njtab;
+	c->jidx = b->jidx;
+	c->njidx = b->njidx;
+	c->link = b->link;
+	for (ps=succlist(c); (s=*ps); ps++)
+		for (p=s->phi; p; p=p->link)
+			for (n=0; n<p->narg; n++)
+				if (p->blk[n] == b)
+					p->blk[n] = c;
+
+	for (n=0, q=in->blk; q; q=q->link, n++) {
+		m.blk[n] = newblk();
+		m.blk[n]->id = fn->nblk++;
+		strf(m.blk[n]->name, "%s.%s", in->fn.name, q->name);
+	}
+
+	/* b keeps what precedes the arguments, then binds the parameters */
+	na = ci - ai;
+	i0 = alloc((ai + na + 1) * sizeof i0[0]);
+	icpy(i0, b->ins, ai);
+	for (n=0, i=in->blk->ins; n<na; i++)
+		if (ispar(i->op)) {
+			i0[ai+n] = (Ins){.op = Ocopy, .cls = i->cls};
+			i0[ai+n].to = mapref(i->to, &m);
+			i0[ai+n].arg[0] = b->ins[ai+n].arg[0];
+			n++;
+		}
+	b->ins = i0;
+	b->nins = ai + na;
+	b->jmp.type = Jjmp;
+	b->jmp.arg = R;
+	b->s1 = m.blk[0];
+	b->s2 = 0;
+	b->jtab = 0;
+	b->njtab = 0;
+	b->jidx = 0;
+	b->njidx = 0;
+
+	nal = 0;
+	for (n=0, q=in->blk; q; q=q->link, n++) {
+		q1 = m.blk[n];
+		q1->ins = alloc((q->nins + 1) * sizeof q1->ins[0]);
+		for (k=0; k<q->nins; k++) {
+			i = &q->ins[k];
+			if (ispar(i->op))
+				continue;
+			q1->ins[q1->nins] = *i;
+			i = &q1->ins[q1->nins++];
+			i->to = mapref(i->to, &m);
+			i->arg[0] = mapref(i->arg[0], &m);
+			i->arg[1] = mapref(i->arg[1], &m);
+			if (isalloc(i->op))
+				nal++;
+		}
+		q1->jmp = q->jmp;
+		q1->jmp.arg = mapref(q->jmp.arg, &m);
+		if (q->s1)
+			q1->s1 = m.blk[q->s1->id];
+		if (q->s2)
+			q1->s2 = m.blk[q->s2->id];
+		if (q->njtab) {
+			q1->jtab = alloc(q->njtab * sizeof q1->jtab[0]);
+			for (k=0; k<q->njtab; k++)
+				q1->jtab[k] = m.blk[q->jtab[k]->id];
+			q1->njtab = q->njtab;
+			q1->jidx = alloc(q->njidx * sizeof q1->jidx[0]);
+			memcpy(q1->jidx, q->jidx, q->njidx * sizeof q1->jidx[0]);
+			q1->njidx = q->njidx;
+		}
+		if (isret(q->jmp.type)) {
+			if (!req(call.to, R) && q->jmp.type != Jret0)
+				q1->ins[q1->nins++] = (Ins){
+					.op = Ocopy, .cls = call.cls,
+					.to = call.to, .arg = {q1->jmp.arg, R}
+				};
+			q1->jmp.type = Jjmp;
+			q1->jmp.arg = R;
+			q1->s1 = c;
+		}
+		pp = &q1->phi;
+		for (p=q->phi; p; p=p->link) {
+			p1 = alloc(sizeof *p1);
+			p1->to = mapref(p->to, &m);
+			p1->cls = p->cls;
+			p1->narg = p->narg;
+			p1->arg = vnew(p->narg, sizeof p1->arg[0], PFn);
+			p1->blk = vnew(p->narg, sizeof p1->blk[0], PFn);
+			for (k=0; k<p->narg; k++) {
+				p1->arg[k] = mapref(p->arg[k], &m);
+				p1->blk[k] = m.blk[p->blk[k]->id];
+			}
+			*pp = p1;
+			pp = &p1->link;
+		}
+		q1->link = q->link ? m.blk[n+1] : c;
+	}
+	b->link = m.blk[0];
+
+	/* hoist the callee's locals after the parameters of fn */
+	if (nal) {
+		q = m.blk[0];
+		s = fn->start;
+		for (k=0; k<s->nins && ispar(s->ins[k].op); k++)
+			;
+		i0 = alloc((s->nins + nal) * sizeof i0[0]);
+		icpy(i0, s->ins, k);
+		na = k;
+		for (n=0; n<q->nins; n++)
+			if (isalloc(q->ins[n].op))
+				i0[na++] = q->ins[n];
+		icpy(&i0[na], &s->ins[k], s->nins - k);
+		s->ins = i0;
+		s->nins += nal;
+		for (n=0, k=0; n<q->nins; n++)
+			if (!isalloc(q->ins[n].op))
+				q->ins[k++] = q->ins[n];
+		q->nins = k;
+	}
+	return c;
+}
+
+/* replace calls to saved functions by their bodies */
+static void
+inlcalls(Fn *fn)
+{
+	Blk *b;
+	Ins *i;
+	Con *c;
+	Inl *in;
+	uint n, ai;
+	int grow;
+
+	grow = cost(fn);
+	for (b=fn->start; b; b=b->link)
+		for (n=0; n<b->nins; n++) {
+			i = &b->ins[n];
+			if (i->op != Ocall || rtype(i->arg[0]) != RCon
+			|| !req(i->arg[1], R))
+				continue;
+			c = &fn->con[i->arg[0].val];
+			if (c->type != CAddr || c->sym.type != SGlo || c->bits.i)
+				continue;
+			in = find(c->sym.id);
+			if (!in || !in->inl)
+				continue;
+			if (grow + in->cost > InlGrow && in->fn.lnk.inl < 2)
+				continue;
+			for (ai=n; ai>0 && b->ins[ai-1].op == Oarg; ai--)
+				;
+			if (ai > 0 && isarg(b->ins[ai-1].op))
+				continue;
+			if ((int)(n - ai) != in->npar)
+				continue;
+			grow += in->cost;
+			b = expand(fn, b, ai, n, in);
+			n = -1;
+		}
+}
+
+/*
+ * Inline into fn and save it for later callers.
+ * Returns 1 when compiling fn is deferred to inlflush().
+ */
+int
+inlfn(Fn *fn)
+{
+	Inl *in;
+	Ins *i;
+	int c, lim;
+
+	inlcalls(fn);
+	c = cost(fn);
+	lim = fn->lnk.inl == 2 ? InlAlways : fn->lnk.inl ? InlHint : InlSmall;
+	if (fn->lnk.inl < 0 || !inlinable(fn)
+	|| (c > lim && (fn->lnk.export || !fn->lnk.inl))) {
+		refs(fn);
+		return 0;
+	}
+	in = emalloc(sizeof *in);
+	in->fn = *fn;
+	in->fn.tmp = emalloc(fn->ntmp * sizeof fn->tmp[0]);
+	memcpy(in->fn.tmp, fn->tmp, fn->ntmp * sizeof fn->tmp[0]);
+	in->fn.con = emalloc(fn->ncon * sizeof fn->con[0]);
+	memcpy(in->fn.con, fn->con, fn->ncon * sizeof fn->con[0]);
+	in->id = intern(fn->name);
+	in->blk = saveblks(fn);
+	for (i=fn->start->ins; i<&fn->start->ins[fn->start->nins]; i++)
+		if (ispar(i->op))
+			in->npar++;
+	in->cost = c;
+	in->inl = c <= lim;
+	in->defer = !fn->lnk.export;
+	in->link = inls;
+	inls = in;
+	if (!in->defer)
+		refs(fn);
+	return in->defer;
+}
+
+/* rebuild a saved function in the per-function pool */
+static Fn *
+restore(Inl *in)
+{
+	Fn *fn;
+	Blk *q, *b, **blk;
+	Phi *p, *p1, **pp;
+	uint n, k;
+
+	fn = alloc(sizeof *fn);
+	*fn = in->fn;
+	fn->tmp = vnew(fn->ntmp, sizeof fn->tmp[0], PFn);
+	memcpy(fn->tmp, in->fn.tmp, fn->ntmp * sizeof fn->tmp[0]);
+	fn->con = vnew(fn->ncon, sizeof fn->con[0], PFn);
+	memcpy(fn->con, in->fn.con, fn->ncon * sizeof fn->con[0]);
+	fn->mem = vnew(0, sizeof fn->mem[0], PFn);
+	blk = alloc(fn->nblk * sizeof blk[0]);
+	for (n=0, q=in->blk; q; q=q->link, n++)
+		blk[n] = newblk();
+	for (n=0, q=in->blk; q; q=q->link, n++) {
+		b = blk[n];
+		strcpy(b->name, q->name);
+		b->id = n;
+		idup(&b->ins, q->ins, q->nins);
+		b->nins = q->nins;
+		b->jmp = q->jmp;
+		b->s1 = q->s1 ? blk[q->s1->id] : 0;
+		b->s2 = q->s2 ? blk[q->s2->id] : 0;
+		if (q->njtab) {
+			b->jtab = vnew(q->njtab, sizeof b->jtab[0], PFn);
+			for (k=0; k<q->njtab; k++)
+				b->jtab[k] = blk[q->jtab[k]->id];
+			b->njtab = q->njtab;
+			b->jidx = vnew(q->njidx, sizeof b->jidx[0], PFn);
+			memcpy(b->jidx, q->jidx, q->njidx * sizeof b->jidx[0]);
+			b->njidx = q->njidx;
+		}
+		pp = &b->phi;
+		for (p=q->phi; p; p=p->link) {
+			p1 = alloc(sizeof *p1);
+			*p1 = *p;
+			p1->arg = vnew(p->narg, sizeof p1->arg[0], PFn);
+			memcpy(p1->arg, p->arg, p->narg * sizeof p1->arg[0]);
+			p1->blk = vnew(p->narg, sizeof p1->blk[0], PFn);
+			for (k=0; k<p->narg; k++)
+				p1->blk[k] = blk[p->blk[k]->id];
+			*pp = p1;
+			pp = &p1->link;
+		}
+		b->link = q->link ? blk[n+1] : 0;
+	}
+	fn->start = blk[0];
+	fn->nblk = n;
+	return fn;
+}
+
+/* compile the deferred functions still in use, forget the rest */
+void
+inlflush(void compile(Fn *))
+{
+	Inl *in;
+	Fn *fn;
+	int again;
+
+	do {
+		again = 0;
+		for (in=inls; in; in=in->link)
+			if (in->defer && refhas(in->id)) {
+				in->defer = 0;
+				fn = restore(in);
+				refs(fn);
+				compile(fn);
+				again = 1;
+			}
+	} while (again);
+	while ((in = inls)) {
+		inls = in->link;
+		freeblks(in->blk);
+		free(in->fn.tmp);
+		free(in->fn.con);
+		free(in);
+	}
+	free(refh);
+	refh = 0;
+	nrefh = 0;
+	nref = 0;
+}
@@ -65,6 +65,10 @@ Again:
 			liveon(v, b, b->s2);
 			bsunion(b->out, v);
 		}
+		for (k=0; k<(int)b->njtab; k++) {
+			liveon(v, b, b->jtab[k]);
+			bsunion(b->out, v);
+		}
 		chg |= !bsequal(b->out, u);
 
 		memset(nlv, 0, sizeof nlv);
@@ -0,0 +1,889 @@
+#include "all.h"
+
+/*
+ * Loop optimizations, enabled with -O.  Each natural loop
+ * with a single entry edge gets a preheader, and arithmetic
+ * whose operands do not change in the loop is moved there.
+ * A value of the form a*i + b, where i is a header phi that
+ * is stepped by a constant and a, b are loop invariant, gets
+ * its own induction variable when computing it takes more
+ * than one instruction: the address of x[i] then becomes a
+ * pointer advanced by the element size on each iteration.
+ * With -O2, innermost loops that run a small constant number
+ * of times are also unrolled completely.
+ *
+ * Loads are never moved: QBE has no volatile, and a load in
+ * a polling loop must stay in the loop.
+ */
+
+enum {
+	UnrollTrip = 8,  /* max iterations of an unrolled loop */
+	UnrollIns  = 64, /* max instructions after unrolling */
+	HoistSize  = 24, /* larger loops only lose multiplies and divides */
+	MaxIV      = 4,  /* new induction variables per basic one */
+};
+
+typedef struct Loop Loop;
+typedef struct Aff Aff;
+
+struct Loop {
+	Blk *hd;
+	Blk *pre;    /* preheader, only entry to hd */
+	Blk *latch;  /* only back edge to hd, or 0 */
+	Blk **blk;   /* members in rpo order, blk[0] is hd */
+	uint nblk;
+	uint id;     /* members have inloop[id] == l->id */
+	int inner;   /* contains no other loop */
+	Ins *ins;    /* appended to pre */
+	uint nins;
+	Ins *lins;   /* appended to latch */
+	uint nlins;
+};
+
+/* t = a*i + b, for i the induction variable iv */
+struct Aff {
+	Ref a, b;
+	int cost;
+	uint iv;
+};
+
+static uint *inloop;
+static uint ninloop;
+static uint nloopid;
+static Aff *aff;
+static int naff;
+static uint niv;
+static int changed;
+
+static int
+isin(Loop *l, uint bid)
+{
+	return bid < ninloop && inloop[bid] == l->id;
+}
+
+static int
+invariant(Loop *l, Ref r, Fn *fn)
+{
+	switch (rtype(r)) {
+	case RCon:
+		return 1;
+	case RTmp:
+		if (req(r, R))
+			return 1;
+		return r.val >= Tmp0 && !isin(l, fn->tmp[r.val].bid);
+	default:
+		return 0;
+	}
+}
+
+static int
+conbits(Ref r, int32_t *v, Fn *fn)
+{
+	Con *c;
+
+	if (rtype(r) != RCon)
+		return 0;
+	c = &fn->con[r.val];
+	if (c->type != CBits)
+		return 0;
+	*v = c->bits.i;
+	return 1;
+}
+
+static int
+iscon(Ref r, int32_t v, Fn *fn)
+{
+	int32_t x;
+
+	return conbits(r, &x, fn) && x == v;
+}
+
+static void
+addins(Ins **pi, uint *pn, Ins *i)
+{
+	vgrow(pi, ++*pn);
+	(*pi)[*pn-1] = *i;
+}
+
+static void
+append(Blk *b, Ins *ins, uint n)
+{
+	Ins *i0;
+
+	if (!n)
+		return;
+	i0 = alloc((b->nins + n) * sizeof i0[0]);
+	icpy(icpy(i0, b->ins, b->nins), ins, n);
+	b->ins = i0;
+	b->nins += n;
+}
+
+/* give every loop entered by a branch its own entry block */
+static void
+addpre(Fn *fn)
+{
+	Blk *hd, *pre, *b, *q;
+	Phi *p;
+	uint n, a, nb, nblk, back;
+
+	nblk = fn->nblk;
+	for (n=0; n<nblk; n++) {
+		hd = fn->rpo[n];
+		pre = 0;
+		back = 0;
+		nb = 0;
+		for (a=0; a<hd->npred; a++)
+			if (hd->pred[a]->id >= n)
+				back = 1;
+			else {
+				pre = hd->pred[a];
+				nb++;
+			}
+		if (!back || nb != 1)
+			continue;
+		if (pre->s1 == hd && !pre->s2 && !pre->njtab)
+			continue;
+		b = newblk();
+		b->id = fn->nblk++;
+		strf(b->name, "%s.%d", hd->name, b->id);
+		changed = 1;
+		b->jmp.type = Jjmp;
+		b->s1 = hd;
+		if (pre->s1 == hd)
+			pre->s1 = b;
+		if (pre->s2 == hd)
+			pre->s2 = b;
+		for (a=0; a<pre->njtab; a++)
+			if (pre->jtab[a] == hd)
+				pre->jtab[a] = b;
+		for (p=hd->phi; p; p=p->link)
+			for (a=0; a<p->narg; a++)
+				if (p->blk[a] == pre)
+					p->blk[a] = b;
+		for (q=fn->start; q->link!=hd; q=q->link)
+			;
+		q->link = b;
+		b->link = hd;
+	}
+	if (fn->nblk != nblk) {
+		fillrpo(fn);
+		fillpreds(fn);
+	}
+}
+
+static int
+findloop(Loop *l, Blk *hd, Fn *fn)
+{
+	Blk *b, **stk;
+	uint a, n, nstk, back;
+
+	*l = (Loop){.hd = hd, .id = ++nloopid, .inner = 1};
+	back = 0;
+	for (a=0; a<hd->npred; a++)
+		if (hd->pred[a]->id >= hd->id) {
+			l->latch = hd->pred[a];
+			back++;
+		} else
+			l->pre = hd->pred[a];
+	if (!back || hd == fn->start)
+		return 0;
+	if (back > 1)
+		l->latch = 0;
+	stk = alloc(fn->nblk * sizeof stk[0]);
+	stk[0] = hd;
+	nstk = 1;
+	inloop[hd->id] = l->id;
+	while (nstk) {
+		b = stk[--nstk];
+		for (a=0; a<b->npred; a++) {
+			if (b == hd && b->pred[a]->id < hd->id)
+				continue;
+			if (inloop[b->pred[a]->id] == l->id)
+				continue;
+			if (!dom(hd, b->pred[a]))
+				return 0; /* irreducible */
+			inloop[b->pred[a]->id] = l->id;
+			stk[nstk++] = b->pred[a];
+		}
+	}
+	l->blk = alloc((fn->nblk - hd->id) * sizeof l->blk[0]);
+	for (n=hd->id; n<fn->nblk; n++) {
+		b = fn->rpo[n];
+		if (inloop[n] != l->id)
+			continue;
+		l->blk[l->nblk++] = b;
+		if (b != hd)
+			for (a=0; a<b->npred; a++)
+				if (b->pred[a]->id >= b->id)
+					l->inner = 0;
+	}
+	if (!l->pre || l->pre->s1 != hd || l->pre->s2 || l->pre->njtab)
+		return 0;
+	l->ins = vnew(0, sizeof l->ins[0], PFn);
+	l->lins = vnew(0, sizeof l->lins[0], PFn);
+	return 1;
+}
+
+static int
+loopsize(Loop *l)
+{
+	Blk *b;
+	Ins *i;
+	Phi *p;
+	uint n, size;
+
+	size = 0;
+	for (n=0; n<l->nblk; n++) {
+		b = l->blk[n];
+		for (i=b->ins; i<&b->ins[b->nins]; i++)
+			size += i->op != Onop;
+		for (p=b->phi; p; p=p->link)
+			size++;
+	}
+	return size;
+}
+
+/* move invariant arithmetic to the preheader; in large
+ * loops the registers it would hold are better spent on
+ * the loop body, so only costly operations move
+ */
+static void
+hoist(Loop *l, Fn *fn)
+{
+	Blk *b;
+	Ins *i, *i1;
+	uint n;
+	int32_t v;
+	int big;
+
+	big = loopsize(l) > HoistSize;
+	for (n=0; n<l->nblk; n++) {
+		b = l->blk[n];
+		for (i=b->ins; i<&b->ins[b->nins]; i++) {
+			if (!optab[i->op].canfold || rtype(i->to) != RTmp)
+				continue;
+			if (i->op == Ocopy && rtype(i->arg[0]) == RCon)
+				continue;
+			switch (i->op) {
+			case Odiv:
+			case Orem:
+			case Oudiv:
+			case Ourem:
+				/* the loop may not run them at all */
+				if (!conbits(i->arg[1], &v, fn) || v == 0)
+					continue;
+				break;
+			case Omul:
+				break;
+			default:
+				if (big)
+					continue;
+			}
+			if (!invariant(l, i->arg[0], fn)
+			|| !invariant(l, i->arg[1], fn))
+				continue;
+			for (i1=l->ins; i1<&l->ins[l->nins]; i1++)
+				if (i1->op == i->op && i1->cls == i->cls
+				&& req(i1->arg[0], i->arg[0])
+				&& req(i1->arg[1], i->arg[1])) {
+					/* computed already */
+					i->op = Ocopy;
+					i->arg[0] = i1->to;
+					i->arg[1] = R;
+					break;
+				}
+			addins(&l->ins, &l->nins, i);
+			fn->tmp[i->to.val].bid = l->pre->id;
+			*i = (Ins){.op = Onop};
+			changed = 1;
+		}
+	}
+}
+
+/* compute op a, b in the preheader */
+static Ref
+preop(Loop *l, int op, Ref a, Ref b, Fn *fn)
+{
+	int32_t x, y;
+	Ins *i;
+	Ref r;
+
+	if (conbits(a, &x, fn) && conbits(b, &y, fn))
+		switch (op) {
+		case Oadd: return getcon((int32_t)((uint32_t)x + y), fn);
+		case Osub: return getcon((int32_t)((uint32_t)x - y), fn);
+		case Omul: return getcon((int32_t)((uint32_t)x * y), fn);
+		}
+	switch (op) {
+	case Oadd:
+		if (iscon(a, 0, fn))
+			return b;
+		/* fall through */
+	case Osub:
+		if (iscon(b, 0, fn))
+			return a;
+		break;
+	case Omul:
+		if (iscon(a, 0, fn) || iscon(b, 0, fn))
+			return getcon(0, fn);
+		if (iscon(a, 1, fn))
+			return b;
+		if (iscon(b, 1, fn))
+			return a;
+		break;
+	}
+	for (i=l->ins; i<&l->ins[l->nins]; i++)
+		if (i->op == op && i->cls == Kw
+		&& req(i->arg[0], a) && req(i->arg[1], b))
+			return i->to;
+	r = newtmp("iv", Kw, fn);
+	fn->tmp[r.val].bid = l->pre->id;
+	addins(&l->ins, &l->nins, &(Ins){op, Kw, r, {a, b}});
+	return r;
+}
+
+/* a basic induction variable starts at *init and
+ * grows by *step on each trip through the latch
+ */
+static int
+ivstep(Loop *l, Phi *p, Ref *init, int32_t *step, Fn *fn)
+{
+	Ref next;
+	Ins *d;
+	uint a;
+
+	if (p->cls != Kw || p->narg != 2 || !l->latch)
+		return 0;
+	*init = R;
+	next = R;
+	for (a=0; a<2; a++)
+		if (p->blk[a] == l->pre)
+			*init = p->arg[a];
+		else
+			next = p->arg[a];
+	if (req(*init, R) || rtype(next) != RTmp || req(next, R))
+		return 0;
+	d = fn->tmp[next.val].def;
+	if (!d || !isin(l, fn->tmp[next.val].bid))
+		return 0;
+	if (d->op == Oadd && req(d->arg[0], p->to)
+	&& conbits(d->arg[1], step, fn))
+		return 1;
+	if (d->op == Oadd && req(d->arg[1], p->to)
+	&& conbits(d->arg[0], step, fn))
+		return 1;
+	if (d->op == Osub && req(d->arg[0], p->to)
+	&& conbits(d->arg[1], step, fn)) {
+		*step = -(uint32_t)*step;
+		return 1;
+	}
+	return 0;
+}
+
+static Aff *
+affof(Ref r)
+{
+	if (rtype(r) != RTmp || r.val < Tmp0 || (int)r.val >= naff
+	|| aff[r.val].iv != niv)
+		return 0;
+	return &aff[r.val];
+}
+
+/* is t used by something else than its own a*i + b chain */
+static int
+needed(Loop *l, int t, Fn *fn)
+{
+	Tmp *tmp;
+	Ins *i;
+	Use *u;
+
+	tmp = &fn->tmp[t];
+	for (u=tmp->use; u<&tmp->use[tmp->nuse]; u++) {
+		if (u->type != UIns || !isin(l, u->bid))
+			return 1;
+		i = u->u.ins;
+		if (!req(i->arg[0], TMP(t)) && !req(i->arg[1], TMP(t)))
+			continue;
+		if (!affof(i->to))
+			return 1;
+	}
+	return 0;
+}
+
+/* give each costly a*i + b derived from p its own phi */
+static void
+reduce(Loop *l, Phi *p, Fn *fn)
+{
+	Aff *f, *fx;
+	Ins *i;
+	Phi *p1;
+	Blk *b;
+	Ref init, x, y, q, q1, inc;
+	int32_t step, s;
+	Ref qx[MaxIV], qinc[MaxIV], qs[MaxIV];
+	uint n;
+	int t, c, k, nq;
+
+	if (!ivstep(l, p, &init, &step, fn))
+		return;
+	if (naff < fn->ntmp) {
+		vgrow(&aff, fn->ntmp);
+		memset(&aff[naff], 0, (fn->ntmp - naff) * sizeof aff[0]);
+		naff = fn->ntmp;
+	}
+	nq = 0;
+	niv++;
+	aff[p->to.val] = (Aff){getcon(1, fn), getcon(0, fn), 0, niv};
+
+	for (n=0; n<l->nblk; n++) {
+		b = l->blk[n];
+		for (i=b->ins; i<&b->ins[b->nins]; i++) {
+			if (i->cls != Kw || rtype(i->to) != RTmp
+			|| (int)i->to.val >= naff)
+				continue;
+			fx = affof(i->arg[0]);
+			x = i->arg[0];
+			y = i->arg[1];
+			if (!fx && (i->op == Oadd || i->op == Omul)) {
+				fx = affof(i->arg[1]);
+				x = i->arg[1];
+				y = i->arg[0];
+			}
+			if (!fx || (i->op != Ocopy && !invariant(l, y, fn)))
+				continue;
+			f = &aff[i->to.val];
+			switch (i->op) {
+			case Ocopy:
+				*f = *fx;
+				break;
+			case Oadd:
+			case Osub:
+				f->a = fx->a;
+				f->b = preop(l, i->op, fx->b, y, fn);
+				f->cost = fx->cost + 1;
+				break;
+			case Omul:
+			case Oshl:
+				c = 1;
+				if (i->op == Oshl) {
+					if (!conbits(y, &s, fn) || s < 0 || s > 31)
+						continue;
+					y = getcon((int32_t)(1u << s), fn);
+				} else if (!conbits(y, &s, fn) || (s & (s-1)))
+					c = 3; /* multiplier, not a shift */
+				f = &aff[i->to.val];
+				f->a = preop(l, Omul, fx->a, y, fn);
+				f->b = preop(l, Omul, fx->b, y, fn);
+				f->cost = fx->cost + c;
+				break;
+			default:
+				continue;
+			}
+			f->iv = niv;
+		}
+	}
+
+	for (n=0; n<l->nblk; n++) {
+		b = l->blk[n];
+		for (i=b->ins; i<&b->ins[b->nins]; i++) {
+			f = affof(i->to);
+			if (!f || req(i->to, p->to) || f->cost < 2
+			|| iscon(f->a, 0, fn))
+				continue;
+			t = i->to.val;
+			if (!needed(l, t, fn))
+				continue;
+			x = preop(l, Omul, f->a, init, fn);
+			x = preop(l, Oadd, x, f->b, fn);
+			inc = preop(l, Omul, f->a, getcon(step, fn), fn);
+			for (k=0; k<nq; k++)
+				if (req(qx[k], x) && req(qinc[k], inc))
+					break;
+			if (k < nq) {
+				*i = (Ins){Ocopy, Kw, TMP(t), {qs[k], R}};
+				changed = 1;
+				continue;
+			}
+			if (nq == MaxIV)
+				continue;
+			q = newtmp("iv", Kw, fn);
+			q1 = newtmp("iv", Kw, fn);
+			fn->tmp[q.val].bid = l->hd->id;
+			fn->tmp[q1.val].bid = l->latch->id;
+			p1 = alloc(sizeof *p1);
+			p1->to = q;
+			p1->cls = Kw;
+			p1->narg = 2;
+			p1->arg = vnew(2, sizeof p1->arg[0], PFn);
+			p1->blk = vnew(2, sizeof p1->blk[0], PFn);
+			p1->arg[0] = x;
+			p1->blk[0] = l->pre;
+			p1->arg[1] = q1;
+			p1->blk[1] = l->latch;
+			p1->link = l->hd->phi;
+			l->hd->phi = p1;
+			addins(&l->lins, &l->nlins, &(Ins){Oadd, Kw, q1, {q, inc}});
+			*i = (Ins){Ocopy, Kw, TMP(t), {q, R}};
+			changed = 1;
+			qx[nq] = x;
+			qinc[nq] = inc;
+			qs[nq++] = q;
+		}
+	}
+}
+
+static int
+cmpeval(int c, int32_t x, int32_t y)
+{
+	uint32_t ux, uy;
+
+	ux = x;
+	uy = y;
+	switch (c) {
+	case Cieq: return x == y;
+	case Cine: return x != y;
+	case Cisge: return x >= y;
+	case Cisgt: return x > y;
+	case Cisle: return x <= y;
+	case Cislt: return x < y;
+	case Ciuge: return ux >= uy;
+	case Ciugt: return ux > uy;
+	case Ciule: return ux <= uy;
+	case Ciult: return ux < uy;
+	default: die("unreachable");
+	}
+}
+
+/* number of iterations of an innermost loop that
+ * unrolling can remove entirely, or 0
+ */
+static int
+tripcount(Loop *l, Fn *fn)
+{
+	Blk *hd, *b, **ps;
+	Ins *c, *i;
+	Phi *p;
+	Ref r, init;
+	uint n, size;
+	int k, op, in, trip;
+	int32_t v, lim, step;
+
+	hd = l->hd;
+	if (!l->inner || !l->latch || hd->jmp.type != Jjnz
+	|| rtype(hd->jmp.arg) != RTmp)
+		return 0;
+	in = isin(l, hd->s1->id);
+	if (in == isin(l, hd->s2->id))
+		return 0;
+	size = 0;
+	for (n=0; n<l->nblk; n++) {
+		b = l->blk[n];
+		if (b->njtab)
+			return 0;
+		if (b != hd)
+			for (ps=succlist(b); *ps; ps++)
+				if (!isin(l, (*ps)->id))
+					return 0;
+		for (i=b->ins; i<&b->ins[b->nins]; i++)
+			size += i->op != Onop;
+		for (p=b->phi; p; p=p->link)
+			size++;
+	}
+	c = fn->tmp[hd->jmp.arg.val].def;
+	if (!c || fn->tmp[hd->jmp.arg.val].bid != hd->id
+	|| !iscmp(c->op, &k, &op) || k != Kw)
+		return 0;
+	r = c->arg[0];
+	if (!conbits(c->arg[1], &lim, fn)) {
+		if (!conbits(c->arg[0], &lim, fn))
+			return 0;
+		r = c->arg[1];
+		op = cmpop(op);
+	}
+	for (p=hd->phi; p; p=p->link)
+		if (req(p->to, r))
+			break;
+	if (!p || !ivstep(l, p, &init, &step, fn) || !conbits(init, &v, fn))
+		return 0;
+	for (trip=0; trip<=UnrollTrip; trip++) {
+		if (cmpeval(op, v, lim) != in)
+			break;
+		v = (uint32_t)v + step;
+	}
+	if (trip == 0 || trip > UnrollTrip || trip * size > UnrollIns)
+		return 0;
+	return trip;
+}
+
+static Ref
+unmap(Loop *l, Ref r, Ref *map, Fn *fn)
+{
+	if (rtype(r) == RTmp && r.val >= Tmp0
+	&& isin(l, fn->tmp[r.val].bid))
+		return map[r.val];
+	return r;
+}
+
+/* lay out trip copies of the loop body in front of hd;
+ * the header itself is left to exit on its first test,
+ * which fold() evaluates to a constant
+ */
+static void
+unroll(Loop *l, int trip, Fn *fn)
+{
+	Blk *hd, *b, *c, *s, *q, **cb, **nb;
+	Ref *map, *prev, *tmp;
+	Phi *p, *p1, **pp;
+	Ins *i, *i1;
+	uint *pos, n, a, ntmp;
+	int j;
+
+	hd = l->hd;
+	ntmp = fn->ntmp;
+	map = alloc(ntmp * sizeof map[0]);
+	prev = alloc(ntmp * sizeof prev[0]);
+	pos = alloc(ninloop * sizeof pos[0]);
+	for (n=0; n<l->nblk; n++)
+		pos[l->blk[n]->id] = n;
+	cb = alloc(trip * l->nblk * sizeof cb[0]);
+	for (n=0; n<trip*l->nblk; n++) {
+		cb[n] = newblk();
+		cb[n]->id = fn->nblk++;
+		strf(cb[n]->name, "%s.%d", l->blk[n % l->nblk]->name, cb[n]->id);
+	}
+
+	for (j=0; j<trip; j++) {
+		nb = &cb[j * l->nblk];
+		for (n=0; n<l->nblk; n++) {
+			b = l->blk[n];
+			for (p=b->phi; p; p=p->link) {
+				map[p->to.val] = newtmp("unr", p->cls, fn);
+				fn->tmp[map[p->to.val].val].bid = nb[n]->id;
+			}
+			for (i=b->ins; i<&b->ins[b->nins]; i++)
+				if (!req(i->to, R)) {
+					map[i->to.val] = newtmp("unr", i->cls, fn);
+					fn->tmp[map[i->to.val].val].bid = nb[n]->id;
+				}
+		}
+		for (n=0; n<l->nblk; n++) {
+			b = l->blk[n];
+			c = nb[n];
+			a = 0;
+			if (b == hd)
+				for (p=b->phi; p; p=p->link)
+					a++;
+			c->ins = alloc((a + b->nins) * sizeof c->ins[0]);
+			pp = &c->phi;
+			for (p=b->phi; p; p=p->link) {
+				if (b == hd) {
+					i1 = &c->ins[c->nins++];
+					*i1 = (Ins){Ocopy, p->cls, map[p->to.val], {R, R}};
+					for (a=0; a<p->narg; a++)
+						if (p->blk[a] == l->pre && j == 0)
+							i1->arg[0] = p->arg[a];
+						else if (p->blk[a] == l->latch && j > 0)
+							i1->arg[0] = unmap(l, p->arg[a], prev, fn);
+					continue;
+				}
+				p1 = alloc(sizeof *p1);
+				p1->to = map[p->to.val];
+				p1->cls = p->cls;
+				p1->narg = p->narg;
+				p1->arg = vnew(p->narg, sizeof p1->arg[0], PFn);
+				p1->blk = vnew(p->narg, sizeof p1->blk[0], PFn);
+				for (a=0; a<p->narg; a++) {
+					p1->arg[a] = unmap(l, p->arg[a], map, fn);
+					p1->blk[a] = nb[pos[p->blk[a]->id]];
+				}
+				*pp = p1;
+				pp = &p1->link;
+			}
+			for (i=b->ins; i<&b->ins[b->nins]; i++) {
+				if (i->op == Onop)
+					continue;
+				i1 = &c->ins[c->nins++];
+				*i1 = *i;
+				i1->to = unmap(l, i->to, map, fn);
+				i1->arg[0] = unmap(l, i->arg[0], map, fn);
+				i1->arg[1] = unmap(l, i->arg[1], map, fn);
+			}
+			c->jmp.type = b->jmp.type;
+			c->jmp.hint = b->jmp.hint;
+			c->jmp.arg = unmap(l, b->jmp.arg, map, fn);
+			if (b == hd) {
+				c->jmp.type = Jjmp;
+				c->jmp.arg = R;
+				s = isin(l, hd->s1->id) ? hd->s1 : hd->s2;
+				c->s1 = nb[pos[s->id]];
+				continue;
+			}
+			for (a=0; a<2; a++) {
+				s = a ? b->s2 : b->s1;
+				if (!s)
+					continue;
+				if (s != hd)
+					s = nb[pos[s->id]];
+				else if (j+1 < trip)
+					s = nb[l->nblk];
+				if (a)
+					c->s2 = s;
+				else
+					c->s1 = s;
+			}
+		}
+		tmp = prev;
+		prev = map;
+		map = tmp;
+	}
+
+	/* the header is now entered from the last copy */
+	for (p=hd->phi; p; p=p->link)
+		for (a=0; a<p->narg; a++)
+			if (p->blk[a] == l->pre) {
+				for (n=0; n<p->narg; n++)
+					if (p->blk[n] == l->latch)
+						p->arg[a] = unmap(l, p->arg[n], prev, fn);
+				p->blk[a] = cb[(trip-1) * l->nblk + pos[l->latch->id]];
+			}
+	l->pre->s1 = cb[0];
+	for (q=fn->start; q->link!=hd; q=q->link)
+		;
+	for (n=0; n<trip*l->nblk; n++) {
+		q->link = cb[n];
+		q = cb[n];
+	}
+	q->link = hd;
+}
+
+static int
+pure(Ins *i)
+{
+	return (optab[i->op].canfold || i->op == Ocopy)
+		&& rtype(i->to) == RTmp;
+}
+
+static void
+mark(Ref r, char *live, int *stk, int *nstk)
+{
+	if (rtype(r) == RTmp && r.val >= Tmp0 && !live[r.val]) {
+		live[r.val] = 1;
+		stk[(*nstk)++] = r.val;
+	}
+}
+
+/* remove the arithmetic and phis left unused, such as an
+ * induction variable whose only users were reduced
+ */
+static void
+dce(Fn *fn)
+{
+	Blk *b;
+	Phi *p, **pp, **phi;
+	Ins *i;
+	char *live;
+	int *stk, nstk, t;
+	uint a;
+
+	live = alloc(fn->ntmp * sizeof live[0]);
+	stk = alloc(fn->ntmp * sizeof stk[0]);
+	phi = alloc(fn->ntmp * sizeof phi[0]);
+	nstk = 0;
+	for (b=fn->start; b; b=b->link) {
+		for (p=b->phi; p; p=p->link)
+			phi[p->to.val] = p;
+		for (i=b->ins; i<&b->ins[b->nins]; i++)
+			if (!pure(i)) {
+				mark(i->to, live, stk, &nstk);
+				mark(i->arg[0], live, stk, &nstk);
+				mark(i->arg[1], live, stk, &nstk);
+			}
+		mark(b->jmp.arg, live, stk, &nstk);
+	}
+	while (nstk) {
+		t = stk[--nstk];
+		if ((p = phi[t]))
+			for (a=0; a<p->narg; a++)
+				mark(p->arg[a], live, stk, &nstk);
+		else if ((i = fn->tmp[t].def)) {
+			mark(i->arg[0], live, stk, &nstk);
+			mark(i->arg[1], live, stk, &nstk);
+		}
+	}
+	for (b=fn->start; b; b=b->link) {
+		for (pp=&b->phi; (p=*pp);)
+			if (live[p->to.val])
+				pp = &p->link;
+			else
+				*pp = p->link;
+		for (i=b->ins; i<&b->ins[b->nins]; i++)
+			if (pure(i) && !live[i->to.val])
+				*i = (Ins){.op = Onop};
+	}
+}
+
+/* returns 1 if fn was changed */
+int
+loopopt(Fn *fn, int unr)
+{
+	Loop *l, *loops;
+	uint n, nl;
+	Phi *p;
+	int trip;
+
+	changed = 0;
+	fillrpo(fn);
+	fillpreds(fn);
+	addpre(fn);
+	filldom(fn);
+	filluse(fn);
+	ninloop = fn->nblk;
+	inloop = alloc(ninloop * sizeof inloop[0]);
+	loops = alloc(fn->nblk * sizeof loops[0]);
+	aff = vnew(0, sizeof aff[0], PFn);
+	naff = 0;
+
+	/* inner loops first, so their hoisted code moves on */
+	nl = 0;
+	for (n=fn->nblk; n-->0;) {
+		l = &loops[nl];
+		if (!findloop(l, fn->rpo[n], fn))
+			continue;
+		nl++;
+		hoist(l, fn);
+		if (l->latch)
+			for (p=l->hd->phi; p; p=p->link)
+				reduce(l, p, fn);
+		append(l->pre, l->ins, l->nins);
+		if (l->latch)
+			append(l->latch, l->lins, l->nlins);
+		filluse(fn);
+	}
+
+	if (unr) {
+		/* innermost loops do not share blocks, so their
+		 * membership stays valid while others are unrolled
+		 */
+		for (n=0; n<nl; n++)
+			if (loops[n].inner && !findloop(&loops[n], loops[n].hd, fn))
+				loops[n].inner = 0;
+		for (n=0; n<nl; n++)
+			if (loops[n].inner && (trip = tripcount(&loops[n], fn))) {
+				unroll(&loops[n], trip, fn);
+				changed = 1;
+			}
+	}
+
+	fillrpo(fn);
+	fillpreds(fn);
+	filldom(fn);
+	filluse(fn);
+	dce(fn);
+	filluse(fn);
+
+	if (debug['O']) {
+		fprintf(stderr, "\n> After loop optimization:\n");
+		printfn(fn, stderr);
+	}
+	return changed;
+}
@@ -6,6 +6,7 @@
 #endif
 
 Target T;
+int hwstack; /* b32p3: -H, see emitpro() */
 
 char debug['Z'+1] = {
 	['P'] = 0, /* parsing */
@@ -13,6 +14,7 @@ char debug['Z'+1] = {
 	['N'] = 0, /* ssa construction */
 	['C'] = 0, /* copy elimination */
 	['F'] = 0, /* constant folding */
+	['O'] = 0, /* loop optimization */
 	['A'] = 0, /* abi lowering */
 	['I'] = 0, /* instruction selection */
 	['L'] = 0, /* liveness */
@@ -30,10 +32,14 @@ static Target *tlist[] = {
 };
 static FILE *outf;
 static int dbg;
+static int olevel;
 
 static void
 data(Dat *d)
 {
+	if (d->type != DStart && d->type != DEnd && d->type != DZ
+	&& !d->isstr && d->isref)
+		inlref(d->u.ref.name);
 	if (dbg)
 		return;
 	emitdat(d, outf);
@@ -44,7 +50,7 @@ data(Dat *d)
 }
 
 static void
-func(Fn *fn)
+compile(Fn *fn)
 {
 	uint n;
 
@@ -54,7 +60,6 @@ func(Fn *fn)
 		fprintf(stderr, "\n> After parsing:\n");
 		printfn(fn, stderr);
 	}
-	T.abi0(fn);
 	fillrpo(fn);
 	fillpreds(fn);
 	filluse(fn);
@@ -73,6 +78,14 @@ func(Fn *fn)
 	copy(fn);
 	filluse(fn);
 	fold(fn);
+	if (olevel && loopopt(fn, olevel > 1)) {
+		ssacheck(fn);
+		copy(fn);
+		filluse(fn);
+		fold(fn);
+	}
+	if (profile(fn))
+		filluse(fn);
 	T.abi1(fn);
 	simpl(fn);
 	fillpreds(fn);
@@ -95,21 +108,37 @@ func(Fn *fn)
 			break;
 		} else
 			fn->rpo[n]->link = fn->rpo[n+1];
+	layout(fn);
+	if (olevel && T.sched)
+		T.sched(fn);
 	if (!dbg) {
 		T.emitfn(fn, outf);
 		fprintf(outf, "/* end function %s */\n\n", fn->name);
+		profdat(fn, outf);
 	} else
 		fprintf(stderr, "\n");
 	freeall();
 }
 
+static void
+func(Fn *fn)
+{
+	T.abi0(fn);
+	if (inlfn(fn)) {
+		freeall();
+		return;
+	}
+	compile(fn);
+}
+
 static void
 dbgfile(char *fn)
 {
 	emitdbgfile(fn, outf);
 }
 
-#ifdef __B32P3__
+/* the cc driver calls main with its own arguments */
+#if defined(__B32P3__) && !defined(CC_DRIVER)
 int
 main(void)
 {
@@ -129,7 +158,7 @@ main(int ac, char *av[])
 	parseinit();
 	T = Deftgt;
 	outf = stdout;
-	while ((c = getopt(ac, av, "hd:o:t:")) != -1)
+	while ((c = getopt(ac, av, "hd:o:t:O:p:PH")) != -1)
 		switch (c) {
 		case 'd':
 			for (; *optarg; optarg++)
@@ -138,6 +167,18 @@ main(int ac, char *av[])
 					dbg = 1;
 				}
 			break;
+		case 'O':
+			olevel = atoi(optarg);
+			break;
+		case 'p':
+			profread(optarg);
+			break;
+		case 'P':
+			profgen = 1;
+			break;
+		case 'H':
+			hwstack = 1;
+			break;
 		case 'o':
 			if (strcmp(optarg, "-") != 0) {
 				outf = fopen(optarg, "w");
@@ -178,6 +219,10 @@ main(int ac, char *av[])
 			}
 			fprintf(hf, "\n");
 			fprintf(hf, "\t%-11s dump debug information\n", "-d <flags>");
+			fprintf(hf, "\t%-11s 1: loop optimizations and scheduling, 2: also unroll\n", "-O <level>");
+			fprintf(hf, "\t%-11s count block runs for a profile\n", "-P");
+			fprintf(hf, "\t%-11s lay out blocks by a profile\n", "-p <file>");
+			fprintf(hf, "\t%-11s save registers on the hardware stack\n", "-H");
 			exit(c != 'h');
 		}
 
@@ -194,11 +239,12 @@ main(int ac, char *av[])
 			}
 		}
 		parse(inf, f, dbgfile, data, func);
+		inlflush(compile);
 		fclose(inf);
 	} while (++optind < ac);
 
 	if (!dbg)
 		T.emitfin(outf);
 
-	exit(0);
+	return 0;
 }
@@ -207,7 +207,7 @@ coalesce(Fn *fn)
 {
 	Range r, *br;
 	Slot *s, *s0, *sl;
-	Blk *b, **ps, *succ[3];
+	Blk *b, **ps, **succ;
 	Ins *i, **bl;
 	Use *u;
 	Tmp *t, *ts;
@@ -251,9 +251,7 @@ coalesce(Fn *fn)
 	ip = INT_MAX - 1;
 	for (n=fn->nblk-1; n>=0; n--) {
 		b = fn->rpo[n];
-		succ[0] = b->s1;
-		succ[1] = b->s2;
-		succ[2] = 0;
+		succ = succlist(b);
 		br[n].b = ip--;
 		for (s=sl; s<&sl[nsl]; s++) {
 			s->l = 0;
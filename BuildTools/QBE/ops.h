@@ -147,6 +147,9 @@ O(acmn,    T(w,l,e,e, w,l,e,e), 0) X(0, 0, 0) V(0)
 O(afcmp,   T(e,e,s,d, e,e,s,d), 0) X(0, 0, 0) V(0)
 O(reqz,    T(w,l,e,e, x,x,e,e), 0) X(0, 0, 0) V(0)
 O(rnez,    T(w,l,e,e, x,x,e,e), 0) X(0, 0, 0) V(0)
+O(mulhs,   T(w,l,e,e, w,l,e,e), 0) X(0, 0, 0) V(0)
+O(mulhu,   T(w,l,e,e, w,l,e,e), 0) X(0, 0, 0) V(0)
+O(jtaddr,  T(x,x,e,e, x,x,e,e), 0) X(0, 0, 0) V(0)
 
 /* Arguments, Parameters, and Calls */
 O(par,     T(x,x,x,x, x,x,x,x), 0) X(0, 0, 0) V(0)
@@ -0,0 +1,163 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+
+.text
+; function elimsb
+.global elimsb
+elimsb:
+  read 0 r4 r1
+.L18:
+  beq r1 r0 .L29
+  add r1 4 r2
+  read 0 r2 r2
+.L20:
+  add r1 4 r3
+  read 0 r3 r3
+  add r1 8 r4
+  read 0 r4 r4
+  shiftl r4 4 r4
+  add r3 r4 r3
+  bge r2 r3 .L26
+  read 0 r2 r3
+  shiftl r3 2 r4
+  shiftr r4 2 r4
+  load 117 r5
+  sub r4 r5 r4
+  load 3 r5
+  bgt r4 r5 .L23
+  load32 -1073741824 r4
+  and r3 r4 r4
+  load 116 r3
+  or r3 r4 r3
+  write 0 r2 r3
+.L23:
+  shiftl r3 2 r4
+  shiftr r4 2 r4
+  load 110 r5
+  sub r4 r5 r4
+  load 3 r5
+  bgt r4 r5 .L25
+  load32 -1073741824 r4
+  and r3 r4 r4
+  load 109 r3
+  or r3 r4 r3
+  write 0 r2 r3
+.L25:
+  add r2 16 r2
+  jump .L20
+.L26:
+  add r1 12 r2
+  readh 0 r2 r2
+  load 5 r3
+  sub r2 r3 r2
+  load 3 r3
+  bgt r2 r3 .L28
+  add r1 12 r3
+  load 1 r2
+  writeh 0 r3 r2
+.L28:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L18
+.L29:
+  jumpr 0 r15
+
+/* end function elimsb */
+
@@ -0,0 +1,2853 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/b32p3/../all.h\000"
+/* end data */
+
+.data
+.balign 4
+gpreg:
+	.int 4
+	.int 5
+	.int 6
+	.int 7
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "rtype(r) == RCall\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "BuildTools/QBE/b32p3/abi.c\000"
+/* end data */
+
+
+.text
+; function b32p3_retregs
+.global b32p3_retregs
+b32p3_retregs:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r5
+  load 5 r2
+  beq r1 r2 .L19
+  load 57 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r5
+.L19:
+  read -20 r14 r1
+  shiftr r1 3 r1
+  and r1 3 r1
+  beq r5 r0 .L21
+  add r5 0 r2
+  write 0 r2 r1
+  add r5 4 r3
+  load 0 r2
+  write 0 r3 r2
+.L21:
+  load 0 r2
+.L22:
+  or r0 r1 r3
+  load 1 r1
+  sub r3 r1 r1
+  beq r3 r0 .L24
+  load 1 r3
+  add r3 r1 r4
+  load 1 r3
+  shiftl r3 r4 r3
+  or r2 r3 r2
+  jump .L22
+.L24:
+  or r0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function b32p3_retregs */
+
+
+.text
+; function b32p3_argregs
+.global b32p3_argregs
+b32p3_argregs:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r5
+  load 5 r2
+  beq r1 r2 .L30
+  load 75 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r5
+.L30:
+  read -20 r14 r1
+  shiftr r1 3 r1
+  shiftrs r1 4 r1
+  and r1 15 r1
+  beq r5 r0 .L32
+  add r5 0 r2
+  write 0 r2 r1
+  add r5 4 r3
+  load 0 r2
+  write 0 r3 r2
+.L32:
+  load 0 r2
+.L33:
+  or r0 r1 r3
+  load 1 r1
+  sub r3 r1 r1
+  beq r3 r0 .L35
+  load 4 r3
+  add r3 r1 r4
+  load 1 r3
+  shiftl r3 r4 r3
+  or r2 r3 r2
+  jump .L33
+.L35:
+  or r0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function b32p3_argregs */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "abi\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "rtype(fn->retr) == RTmp\000"
+/* end data */
+
+
+.text
+; function selret
+selret:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  or r0 r5 r6
+  write -12 r14 r6
+  write -16 r14 r4
+  add r4 12 r1
+  readh 0 r1 r1
+  load 1 r2
+  sub r1 r2 r3
+  load 9 r2
+  sltu r2 r3 r2
+  xor r2 1 r3
+  load 1 r2
+  beq r3 r0 .L41
+  xor r1 10 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L41:
+  bne r2 r0 .L53
+  add r4 12 r2
+  add r2 4 r2
+  read 0 r2 r2
+  write -32 r14 r2
+  add r4 12 r3
+  load 10 r2
+  writeh 0 r3 r2
+  load 9 r2
+  beq r1 r2 .L47
+  load 1 r2
+  sub r1 r2 r5
+  load 1 r1
+  bne r5 r1 .L46
+  load 0 r1
+  or r0 r1 r5
+.L46:
+  load 8 r1
+  write -28 r14 r1
+  load 0 r1
+  write -24 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -24 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -32 r14 r7
+  read -28 r14 r6
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L52
+.L47:
+  addr2reg typ r12
+  read 0 r12 r1
+  add r6 32 r2
+  read 0 r2 r2
+  load 100 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 88 r1
+  read 0 r1 r1
+  load 4 r2
+  ble r1 r2 .L51
+  add r6 36 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -12 r14 r6
+  beq r1 r0 .L50
+  load 110 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.13 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r6
+.L50:
+  load 0 r1
+  write -28 r14 r1
+  addr2reg typ r12
+  read 0 r12 r1
+  add r6 32 r2
+  read 0 r2 r2
+  load 100 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 88 r1
+  read 0 r1 r1
+  load32 536870911 r2
+  and r1 r2 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 2 r1
+  write -24 r14 r1
+  load 0 r1
+  write -20 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -20 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -24 r14 r7
+  read -28 r14 r6
+  load 0 r5
+  load 93 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -12 r14 r6
+  load32 -12 r1
+  sub r13 r1 r13
+  load 0 r1
+  write -28 r14 r1
+  add r6 36 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  read 0 r1 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -32 r14 r7
+  read -28 r14 r6
+  load 0 r5
+  load 92 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L52
+.L51:
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  write -36 r14 r1
+  read -36 r14 r1
+  write -28 r14 r1
+  load 8 r1
+  write -24 r14 r1
+  load 0 r1
+  write -20 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -20 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -28 r14 r7
+  read -24 r14 r6
+  load 0 r5
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  load32 -12 r1
+  sub r13 r1 r13
+  load 0 r1
+  write -24 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -24 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -32 r14 r7
+  read -28 r14 r6
+  load 0 r5
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  load 1 r1
+.L52:
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 5 r1
+  add r4 12 r2
+  add r2 4 r2
+  write 0 r2 r1
+.L53:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function selret */
+
+
+.text
+; function argsclass
+argsclass:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 28 r13
+  write -20 r14 r8
+  or r0 r7 r3
+  or r0 r5 r7
+  write -16 r14 r7
+  load 4 r2
+  addr2reg gpreg r1
+  beq r3 r0 .L58
+  load 3 r2
+  addr2reg gpreg+4 r1
+.L58:
+  bge r4 r7 .L77
+  load 0 r3
+  writeb 0 r6 r3
+  add r6 16 r5
+  load 0 r3
+  write 0 r5 r3
+  read 0 r4 r3
+  shiftl r3 2 r5
+  shiftr r5 2 r5
+  load 109 r7
+  sub r5 r7 r5
+  load 15 r7
+  sltu r5 r7 r8
+  read -16 r14 r7
+  bne r8 r0 .L62
+  or r0 r7 r5
+  jump .L75
+.L62:
+  shiftl r5 2 r7
+  addr2reg .Ljt62 r5
+  add r5 r7 r7
+  read -16 r14 r5
+  read 0 r7 r7
+  jumpr 0 r7
+.L63:
+  shiftr r3 30 r3
+  add r6 12 r7
+  write 0 r7 r3
+  load 1 r7
+  bne r3 r7 .L65
+  add r6 12 r7
+  load 0 r3
+  write 0 r7 r3
+.L65:
+  bgts r2 r0 .L67
+  load 2 r3
+  writeb 0 r6 r3
+  jump .L75
+.L67:
+  load 1 r3
+  sub r2 r3 r2
+  or r0 r1 r3
+  add r1 4 r1
+  read 0 r3 r3
+  add r6 8 r7
+  write 0 r7 r3
+  add r6 16 r7
+  load 1 r3
+  write 0 r7 r3
+  jump .L75
+.L68:
+  addr2reg typ r12
+  read 0 r12 r3
+  add r4 8 r5
+  add r5 0 r5
+  read 0 r5 r5
+  shiftr r5 3 r5
+  load 100 r7
+  mults r5 r7 r5
+  add r3 r5 r3
+  add r6 4 r5
+  write 0 r5 r3
+  add r3 88 r3
+  read 0 r3 r3
+  load 4 r5
+  ble r3 r5 .L70
+  load 1 r3
+  writeb 0 r6 r3
+  load 1 r3
+  jump .L71
+.L70:
+  load 4 r3
+  writeb 0 r6 r3
+  load 4 r3
+.L71:
+  add r6 12 r7
+  load 0 r5
+  write 0 r7 r5
+  read -16 r14 r5
+  bgts r2 r0 .L73
+  shiftl r3 24 r3
+  shiftrs r3 24 r3
+  or r3 2 r3
+  writeb 0 r6 r3
+  jump .L75
+.L73:
+  load 1 r3
+  sub r2 r3 r2
+  or r0 r1 r3
+  add r1 4 r1
+  read 0 r3 r3
+  add r6 8 r7
+  write 0 r7 r3
+  add r6 16 r7
+  load 1 r3
+  write 0 r7 r3
+  jump .L75
+.L74:
+  add r6 8 r7
+  load 12 r3
+  write 0 r7 r3
+  add r6 12 r7
+  load 0 r3
+  write 0 r7 r3
+  add r6 16 r7
+  load 1 r3
+  write 0 r7 r3
+.L75:
+  add r4 16 r4
+  add r6 20 r6
+  or r0 r5 r7
+  jump .L58
+.L77:
+  addr2reg gpreg r2
+  sub r1 r2 r1
+  shiftrs r1 31 r2
+  shiftr r2 30 r2
+  add r1 r2 r1
+  shiftrs r1 2 r1
+  shiftl r1 4 r1
+  read -20 r14 r8
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt62:
+  .int .L63
+  .int .L75
+  .int .L75
+  .int .L75
+  .int .L75
+  .int .L68
+  .int .L74
+  .int .L63
+  .int .L75
+  .int .L75
+  .int .L75
+  .int .L75
+  .int .L68
+  .int .L74
+  .int .L75
+
+/* end function argsclass */
+
+
+.text
+; function stkblob
+stkblob:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 48 r13
+  write -28 r14 r7
+  write -12 r14 r6
+  write -16 r14 r5
+  add r14 -36 r1
+  write 0 r1 r4
+  load 20 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -32 r14 r1
+  read -12 r14 r5
+  read -16 r14 r1
+  add r1 84 r2
+  read 0 r2 r2
+  load 2 r3
+  sub r2 r3 r2
+  bges r2 r0 .L83
+  load 0 r2
+.L83:
+  add r1 88 r1
+  read 0 r1 r1
+  add r1 3 r1
+  load32 -4 r3
+  and r1 r3 r4
+  load 83 r1
+  add r1 r2 r1
+  load32 1073741823 r2
+  and r1 r2 r1
+  or r1 0 r1
+  load32 1073741823 r2
+  and r1 r2 r2
+  load 0 r1
+  or r1 r2 r2
+  write -24 r14 r2
+  read -36 r14 r1
+  write -20 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  or r0 r1 r3
+  read -20 r14 r4
+  read -24 r14 r2
+  read -32 r14 r1
+  read -28 r14 r7
+  write -40 r14 r3
+  read -40 r14 r3
+  write 0 r1 r2
+  add r1 4 r2
+  write 0 r2 r4
+  add r2 4 r2
+  write 0 r2 r3
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+  read 0 r7 r2
+  add r1 16 r3
+  write 0 r3 r2
+  write 0 r7 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function stkblob */
+
+
+.text
+; function selcall
+selcall:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 156 r13
+  write -40 r14 r7
+  or r0 r5 r1
+  write -60 r14 r4
+  write -52 r14 r6
+  write -76 r14 r1
+  sub r6 r1 r1
+  shiftrs r1 31 r2
+  shiftr r2 28 r2
+  add r1 r2 r1
+  shiftrs r1 4 r1
+  load 20 r2
+  mults r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -72 r14 r1
+  read -52 r14 r6
+  add r6 8 r1
+  add r1 4 r1
+  load 0 r2
+  write -96 r14 r2
+  read -96 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -72 r14 r2
+  read -52 r14 r6
+  read -76 r14 r1
+  load 0 r3
+  beq r4 r0 .L89
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  jump .L93
+.L89:
+  addr2reg typ r12
+  read 0 r12 r3
+  add r6 8 r4
+  add r4 4 r4
+  read 0 r4 r4
+  shiftr r4 3 r4
+  load 100 r5
+  mults r4 r5 r4
+  add r3 r4 r3
+  add r3 88 r3
+  read 0 r3 r3
+  load 4 r4
+  ble r3 r4 .L92
+  load 1 r3
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  jump .L93
+.L92:
+  or r0 r2 r3
+  load 4 r2
+.L93:
+  shiftl r2 24 r2
+  shiftrs r2 24 r2
+  write -68 r14 r2
+  and r2 1 r7
+  or r0 r6 r2
+  or r0 r3 r6
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump argsclass
+  write -64 r14 r1
+  read -40 r14 r7
+  read -52 r14 r6
+  read -76 r14 r1
+  read -60 r14 r5
+  or r0 r5 r4
+  or r0 r1 r5
+.L95:
+  load 0 r2
+  bge r5 r6 .L101
+  read 0 r5 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 123 r3
+  beq r2 r3 .L98
+  add r5 16 r5
+  jump .L95
+.L98:
+  read -72 r14 r2
+  or r0 r4 r5
+  load 1 r3
+  write -80 r14 r3
+  jump .L102
+.L101:
+  or r0 r4 r5
+  write -80 r14 r2
+  read -72 r14 r2
+.L102:
+  load 0 r3
+  or r0 r5 r4
+  or r0 r1 r5
+  or r0 r3 r1
+.L104:
+  write -56 r14 r5
+  write -48 r14 r2
+  write -44 r14 r1
+  bge r5 r6 .L111
+  read 0 r5 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 123 r7
+  xor r3 r7 r3
+  sltu r3 1 r3
+  read -40 r14 r7
+  bne r3 r0 .L110
+  readb 0 r2 r3
+  and r3 1 r3
+  beq r3 r0 .L108
+  or r0 r4 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -56 r14 r5
+  read -48 r14 r2
+  read -40 r14 r7
+  read -60 r14 r4
+  write -148 r14 r1
+  add r5 8 r1
+  add r1 0 r3
+  read -148 r14 r1
+  write 0 r3 r1
+  add r5 8 r1
+  add r1 0 r1
+  add r2 4 r2
+  read 0 r2 r5
+  or r0 r4 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump stkblob
+  read -56 r14 r5
+  read -48 r14 r2
+  read -44 r14 r1
+  read -40 r14 r7
+  read -52 r14 r6
+  read -60 r14 r4
+.L108:
+  readb 0 r2 r3
+  and r3 2 r3
+  beq r3 r0 .L110
+  add r1 4 r1
+.L110:
+  add r5 16 r5
+  add r2 20 r2
+  jump .L104
+.L111:
+  read -80 r14 r2
+  read -68 r14 r3
+  read -40 r14 r7
+  or r0 r4 r5
+  add r1 3 r1
+  load32 -4 r4
+  and r1 r4 r4
+  bne r2 r0 .L115
+  beq r4 r0 .L116
+  add r4 8 r4
+  jump .L116
+.L115:
+  add r4 24 r4
+.L116:
+  write -36 r14 r4
+  beq r4 r0 .L118
+  load 0 r1
+  write -96 r14 r1
+  sub r0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -144 r14 r1
+  load 0 r1
+  write -92 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -92 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -144 r14 r7
+  read -96 r14 r6
+  load 1 r5
+  load 96 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -68 r14 r3
+  read -40 r14 r7
+  read -52 r14 r6
+  read -60 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+.L118:
+  and r3 1 r1
+  bne r1 r0 .L126
+  and r3 4 r1
+  bne r1 r0 .L125
+  read 0 r6 r1
+  shiftr r1 30 r2
+  load 1 r3
+  beq r2 r3 .L122
+  shiftr r1 30 r5
+  jump .L124
+.L122:
+  load 0 r1
+  or r0 r1 r5
+.L124:
+  add r6 4 r1
+  load 8 r2
+  write -96 r14 r2
+  load 0 r2
+  write -92 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -92 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -96 r14 r7
+  read 0 r1 r6
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -64 r14 r1
+  read -52 r14 r6
+  load32 -12 r2
+  sub r13 r2 r13
+  or r1 1 r2
+  jump .L127
+.L125:
+  add r6 4 r1
+  addr2reg typ r12
+  read 0 r12 r3
+  add r6 8 r2
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  load 100 r4
+  mults r2 r4 r4
+  or r0 r5 r2
+  add r3 r4 r5
+  or r0 r2 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump stkblob
+  read -60 r14 r5
+  or r0 r5 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -52 r14 r6
+  write -140 r14 r1
+  read -140 r14 r1
+  write -96 r14 r1
+  load 0 r1
+  write -92 r14 r1
+  add r6 4 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  read 0 r1 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -96 r14 r7
+  read -92 r14 r6
+  load 0 r5
+  load 55 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  load32 -12 r1
+  sub r13 r1 r13
+  load 8 r1
+  write -92 r14 r1
+  load 0 r1
+  write -88 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -88 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -92 r14 r7
+  read -96 r14 r6
+  load 0 r5
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -64 r14 r1
+  read -52 r14 r6
+  load32 -12 r2
+  sub r13 r2 r13
+  or r1 1 r2
+  jump .L127
+.L126:
+  add r6 4 r1
+  addr2reg typ r12
+  read 0 r12 r3
+  add r6 8 r2
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  load 100 r4
+  mults r2 r4 r4
+  or r0 r5 r2
+  add r3 r4 r5
+  or r0 r2 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump stkblob
+  load 0 r1
+  write -96 r14 r1
+  load 8 r1
+  write -92 r14 r1
+  load 0 r1
+  write -88 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -88 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -92 r14 r7
+  read -96 r14 r6
+  load 0 r5
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -64 r14 r1
+  read -52 r14 r6
+  load32 -12 r2
+  sub r13 r2 r13
+  or r1 1 r2
+.L127:
+  load 0 r1
+  write -96 r14 r1
+  add r6 8 r1
+  add r1 0 r1
+  shiftl r2 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 5 r2
+  write -92 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -92 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -96 r14 r6
+  load 0 r5
+  load 124 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -68 r14 r3
+  read -72 r14 r2
+  read -52 r14 r6
+  read -76 r14 r1
+  read -60 r14 r5
+  load32 -12 r4
+  sub r13 r4 r13
+  and r3 1 r3
+  beq r3 r0 .L129
+  load 32 r1
+  write -96 r14 r1
+  add r6 4 r1
+  load 0 r2
+  write -92 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -92 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -96 r14 r6
+  load 0 r5
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -72 r14 r2
+  read -52 r14 r6
+  read -76 r14 r1
+  read -60 r14 r5
+  load32 -12 r3
+  sub r13 r3 r13
+.L129:
+  or r0 r5 r4
+  or r0 r1 r5
+.L130:
+  write -28 r14 r5
+  write -32 r14 r2
+  bge r5 r6 .L140
+  read 0 r5 r1
+  shiftl r1 2 r3
+  shiftr r3 2 r3
+  load 1 r7
+  write -24 r14 r7
+  load 123 r7
+  xor r3 r7 r7
+  sltu r7 1 r7
+  read -24 r14 r3
+  bne r7 r0 .L133
+  readb 0 r2 r3
+  and r3 2 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L133:
+  bne r3 r0 .L139
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 121 r3
+  beq r1 r3 .L136
+  add r2 12 r3
+  or r0 r5 r1
+  read 0 r3 r5
+  add r2 8 r2
+  read 0 r2 r2
+  shiftl r2 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -96 r14 r2
+  add r1 8 r1
+  add r1 0 r1
+  load 0 r2
+  write -92 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -92 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -96 r14 r6
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -28 r14 r5
+  read -32 r14 r2
+  read -52 r14 r6
+  read -60 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  jump .L139
+.L136:
+  readb 0 r2 r1
+  and r1 4 r1
+  bne r1 r0 .L138
+  load 0 r1
+  write -96 r14 r1
+  add r2 4 r1
+  read 0 r1 r1
+  add r1 88 r1
+  read 0 r1 r1
+  load32 536870911 r2
+  and r1 r2 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 2 r1
+  write -92 r14 r1
+  load 0 r1
+  write -88 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -88 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -92 r14 r7
+  read -96 r14 r6
+  load 0 r5
+  load 93 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -28 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  load 0 r1
+  write -96 r14 r1
+  add r5 8 r1
+  add r1 4 r1
+  add r5 8 r2
+  add r2 0 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  read 0 r2 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -96 r14 r6
+  load 0 r5
+  load 92 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -28 r14 r5
+  read -32 r14 r2
+  load32 -12 r1
+  sub r13 r1 r13
+  add r2 8 r1
+  read 0 r1 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -96 r14 r1
+  add r5 8 r1
+  add r1 0 r1
+  load 0 r2
+  write -92 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -92 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -96 r14 r6
+  load 0 r5
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -28 r14 r5
+  read -32 r14 r2
+  read -52 r14 r6
+  read -60 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  jump .L139
+.L138:
+  or r0 r4 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -32 r14 r2
+  write -136 r14 r1
+  read -136 r14 r1
+  write -100 r14 r1
+  add r2 8 r1
+  read 0 r1 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -96 r14 r1
+  load 0 r1
+  write -92 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -92 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -100 r14 r7
+  read -96 r14 r6
+  load 0 r5
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -28 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  add r5 8 r1
+  add r1 4 r1
+  load 0 r2
+  write -96 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -96 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -100 r14 r6
+  load 0 r5
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -28 r14 r5
+  read -32 r14 r2
+  read -52 r14 r6
+  read -60 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+.L139:
+  add r5 16 r5
+  add r2 20 r2
+  jump .L130
+.L140:
+  read -80 r14 r2
+  or r0 r4 r5
+  read -36 r14 r4
+  beq r4 r0 .L167
+  bne r2 r0 .L145
+  load 8 r1
+  write -4 r14 r1
+  jump .L147
+.L145:
+  load 24 r1
+  write -4 r14 r1
+.L147:
+  or r0 r5 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  or r0 r1 r4
+  read -4 r14 r1
+  read -72 r14 r2
+  read -52 r14 r6
+  or r0 r1 r3
+  read -76 r14 r1
+  read -60 r14 r5
+  write -132 r14 r4
+  read -132 r14 r4
+  write -100 r14 r4
+  or r0 r5 r4
+  or r0 r1 r5
+  or r0 r3 r1
+.L149:
+  write -20 r14 r5
+  write -12 r14 r2
+  write -16 r14 r1
+  bge r5 r6 .L160
+  read 0 r5 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 1 r7
+  write -8 r14 r7
+  load 123 r7
+  xor r3 r7 r7
+  sltu r7 1 r7
+  read -8 r14 r3
+  bne r7 r0 .L152
+  readb 0 r2 r3
+  and r3 2 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L152:
+  bne r3 r0 .L159
+  or r0 r4 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -20 r14 r5
+  read -12 r14 r2
+  read -60 r14 r4
+  write -128 r14 r1
+  read -128 r14 r1
+  write -96 r14 r1
+  readb 0 r2 r1
+  and r1 4 r1
+  bne r1 r0 .L157
+  read 0 r5 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 121 r2
+  beq r1 r2 .L156
+  load 0 r1
+  write -92 r14 r1
+  add r5 8 r1
+  add r1 0 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -96 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -92 r14 r6
+  load 0 r5
+  load 55 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r1
+  read -60 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -112 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -112 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -100 r14 r7
+  read -96 r14 r6
+  load 0 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -20 r14 r5
+  read -12 r14 r2
+  read -16 r14 r1
+  read -52 r14 r6
+  read -60 r14 r4
+  load32 -12 r3
+  sub r13 r3 r13
+  jump .L158
+.L156:
+  load 0 r1
+  write -92 r14 r1
+  add r5 8 r1
+  add r1 0 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -96 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -92 r14 r6
+  load 0 r5
+  load 55 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r1
+  read -60 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -116 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -116 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -100 r14 r7
+  read -96 r14 r6
+  load 0 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -12 r14 r2
+  load32 -12 r1
+  sub r13 r1 r13
+  load 0 r1
+  write -92 r14 r1
+  add r2 4 r1
+  read 0 r1 r1
+  add r1 88 r1
+  read 0 r1 r1
+  load32 536870911 r2
+  and r1 r2 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 2 r1
+  write -88 r14 r1
+  load 0 r1
+  write -84 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -84 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -88 r14 r7
+  read -92 r14 r6
+  load 0 r5
+  load 93 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -20 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  load 0 r1
+  write -92 r14 r1
+  add r5 8 r1
+  add r1 4 r1
+  add r5 8 r2
+  add r2 0 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  read 0 r2 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -92 r14 r6
+  load 0 r5
+  load 92 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -20 r14 r5
+  read -12 r14 r2
+  read -16 r14 r1
+  read -52 r14 r6
+  read -60 r14 r4
+  load32 -12 r3
+  sub r13 r3 r13
+  jump .L158
+.L157:
+  or r0 r4 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  write -120 r14 r1
+  read -120 r14 r1
+  write -92 r14 r1
+  load 0 r1
+  write -88 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -96 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -92 r14 r7
+  read -88 r14 r6
+  load 0 r5
+  load 55 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r1
+  read -60 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -124 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -124 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -100 r14 r7
+  read -96 r14 r6
+  load 0 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -20 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  add r5 8 r1
+  add r1 4 r1
+  load 0 r2
+  write -96 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -96 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -92 r14 r6
+  load 0 r5
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -20 r14 r5
+  read -12 r14 r2
+  read -16 r14 r1
+  read -52 r14 r6
+  read -60 r14 r4
+  load32 -12 r3
+  sub r13 r3 r13
+.L158:
+  add r1 4 r1
+.L159:
+  add r5 16 r5
+  add r2 20 r2
+  jump .L149
+.L160:
+  read -80 r14 r2
+  or r0 r4 r5
+  read -36 r14 r4
+  bne r2 r0 .L163
+  load 8 r2
+  jump .L164
+.L163:
+  load 24 r2
+.L164:
+  beq r1 r2 .L166
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -104 r14 r1
+  load 0 r1
+  write -96 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -96 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -104 r14 r7
+  read -100 r14 r6
+  load 1 r5
+  load 96 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  load32 -12 r1
+  sub r13 r1 r13
+  jump .L167
+.L166:
+  load 0 r1
+  write -96 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -108 r14 r1
+  load 0 r1
+  write -92 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -92 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -108 r14 r7
+  read -96 r14 r6
+  load 1 r5
+  load 96 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  load32 -12 r1
+  sub r13 r1 r13
+.L167:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function selcall */
+
+
+.text
+; function selpar
+selpar:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 116 r13
+  write -56 r14 r7
+  write -40 r14 r4
+  write -36 r14 r6
+  write -64 r14 r5
+  sub r6 r5 r1
+  shiftrs r1 31 r2
+  shiftr r2 28 r2
+  add r1 r2 r1
+  shiftrs r1 4 r1
+  load 20 r2
+  mults r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -36 r14 r6
+  read -64 r14 r5
+  read -40 r14 r4
+  write -60 r14 r1
+  addr2reg insb r12
+  read 0 r12 r2
+  load32 4194304 r3
+  add r2 r3 r2
+  addr2reg curi r12
+  write 0 r12 r2
+  add r4 32 r2
+  read 0 r2 r3
+  load 0 r2
+  blts r3 r0 .L173
+  addr2reg typ r12
+  read 0 r12 r2
+  load 100 r7
+  mults r3 r7 r3
+  add r2 r3 r2
+  add r2 88 r2
+  read 0 r2 r3
+  load 0 r2
+  load 4 r7
+  ble r3 r7 .L173
+  or r0 r4 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -40 r14 r4
+  write -108 r14 r1
+  add r4 36 r2
+  read -108 r14 r1
+  write 0 r2 r1
+  add r4 36 r1
+  load 32 r2
+  write -72 r14 r2
+  load 0 r2
+  write -76 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -76 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -72 r14 r7
+  read 0 r1 r6
+  load 0 r5
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -60 r14 r1
+  read -36 r14 r6
+  read -64 r14 r5
+  load32 -12 r2
+  sub r13 r2 r13
+  load 1 r2
+.L173:
+  shiftl r2 24 r2
+  shiftrs r2 24 r2
+  and r2 1 r7
+  or r0 r6 r2
+  or r0 r1 r6
+  or r0 r5 r1
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump argsclass
+  write -52 r14 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 5 r1
+  write -72 r14 r1
+  load 0 r5
+  read -72 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump b32p3_argregs
+  or r0 r1 r2
+  read -60 r14 r1
+  read -36 r14 r6
+  read -64 r14 r5
+  read -40 r14 r4
+  add r4 44 r3
+  write 0 r3 r2
+  load 0 r2
+  write -80 r14 r2
+.L174:
+  write -44 r14 r1
+  write -48 r14 r5
+  bge r5 r6 .L183
+  read 0 r5 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r3
+  load 0 r2
+  load 114 r7
+  beq r3 r7 .L177
+  or r0 r2 r3
+  jump .L178
+.L177:
+  readb 0 r1 r2
+  and r2 1 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L178:
+  load 0 r2
+  beq r3 r0 .L180
+  add r1 16 r2
+  read 0 r2 r3
+  load 0 r2
+  slt r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L180:
+  beq r2 r0 .L182
+  or r0 r1 r2
+  add r5 4 r1
+  add r2 4 r2
+  read 0 r2 r5
+  add r14 -80 r7
+  or r0 r4 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump stkblob
+  read -44 r14 r1
+  read -48 r14 r5
+  read -36 r14 r6
+  read -40 r14 r4
+.L182:
+  add r5 16 r5
+  add r1 20 r1
+  jump .L174
+.L183:
+  read -60 r14 r1
+  read -64 r14 r5
+  add r4 52 r2
+  readb 0 r2 r2
+  shiftl r2 2 r3
+  load 2 r2
+  add r2 r3 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L186:
+  write -24 r14 r2
+  write -20 r14 r5
+  write -16 r14 r1
+  blt r5 r6 .L193
+.L187:
+  read -80 r14 r1
+  beq r1 r0 .L190
+  add r14 -96 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -96 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -96 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r2
+  read 0 r2 r2
+  add r14 -96 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r1
+  add r14 -96 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump emiti
+  read -80 r14 r1
+  add r1 16 r1
+  read 0 r1 r1
+  write -80 r14 r1
+  jump .L187
+.L190:
+  read -16 r14 r2
+  read -52 r14 r1
+  read -56 r14 r7
+  add r7 4 r3
+  write 0 r3 r2
+  shiftrs r1 4 r1
+  and r1 15 r1
+  write 0 r7 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L193:
+  read 0 r5 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 0 r7
+  write -12 r14 r7
+  load 114 r7
+  xor r3 r7 r7
+  sltu r7 1 r7
+  read -12 r14 r3
+  beq r7 r0 .L195
+  readb 0 r2 r3
+  and r3 1 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L195:
+  bne r3 r0 .L210
+  readb 0 r2 r3
+  and r3 2 r3
+  bne r3 r0 .L203
+  add r2 16 r3
+  read 0 r3 r3
+  bgts r3 r0 .L199
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L214
+.L199:
+  add r2 12 r3
+  or r0 r5 r1
+  read 0 r3 r5
+  load 1 r3
+  bne r5 r3 .L202
+  load 0 r3
+  or r0 r3 r5
+.L202:
+  add r1 4 r1
+  add r2 8 r2
+  read 0 r2 r2
+  shiftl r2 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -72 r14 r2
+  load 0 r2
+  write -76 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -76 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -72 r14 r7
+  read 0 r1 r6
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -24 r14 r1
+  read -20 r14 r5
+  read -16 r14 r2
+  read -36 r14 r6
+  read -40 r14 r4
+  load32 -12 r3
+  sub r13 r3 r13
+  jump .L214
+.L203:
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  add r1 12 r3
+  read 0 r3 r3
+  load 1 r4
+  beq r3 r4 .L206
+  or r0 r5 r1
+  or r0 r3 r5
+  jump .L209
+.L206:
+  or r0 r5 r1
+  load 0 r3
+  or r0 r3 r5
+.L209:
+  add r1 4 r1
+  sub r0 r2 r2
+  load32 536870911 r3
+  and r2 r3 r2
+  shiftl r2 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 4 r2
+  write -72 r14 r2
+  load 0 r2
+  write -76 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -76 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -72 r14 r7
+  read 0 r1 r6
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -24 r14 r1
+  read -20 r14 r5
+  read -16 r14 r2
+  read -36 r14 r6
+  read -40 r14 r4
+  load32 -12 r3
+  sub r13 r3 r13
+  add r2 1 r2
+  jump .L214
+.L210:
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  add r1 16 r3
+  read 0 r3 r3
+  beq r3 r0 .L213
+  or r0 r4 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -40 r14 r4
+  write -100 r14 r1
+  read -100 r14 r1
+  write -72 r14 r1
+  or r0 r4 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  write -104 r14 r1
+  read -104 r14 r1
+  write -76 r14 r1
+  load 0 r1
+  write -68 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -76 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -72 r14 r7
+  read -68 r14 r6
+  load 0 r5
+  load 55 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -20 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  add r5 4 r1
+  load 0 r2
+  write -68 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -68 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -76 r14 r6
+  load 0 r5
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -24 r14 r1
+  load32 -12 r2
+  sub r13 r2 r13
+  add r1 8 r1
+  read 0 r1 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -76 r14 r1
+  load 0 r1
+  write -68 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -68 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -76 r14 r7
+  read -72 r14 r6
+  load 0 r5
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -24 r14 r1
+  read -20 r14 r5
+  read -16 r14 r2
+  read -36 r14 r6
+  read -40 r14 r4
+  load32 -12 r3
+  sub r13 r3 r13
+  jump .L214
+.L213:
+  sub r0 r2 r3
+  write -32 r14 r3
+  add r4 4 r3
+  read 0 r3 r3
+  write -28 r14 r3
+  add r5 4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  load 160 r7
+  mults r3 r7 r7
+  read -28 r14 r3
+  add r3 r7 r7
+  read -32 r14 r3
+  add r7 104 r7
+  write 0 r7 r3
+  add r2 1 r2
+.L214:
+  add r5 16 r5
+  add r1 20 r1
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L186
+
+/* end function selpar */
+
+
+.text
+; function selvaarg
+selvaarg:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 48 r13
+  write -16 r14 r5
+  or r0 r4 r5
+  write -12 r14 r5
+  or r0 r5 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -12 r14 r5
+  write -32 r14 r1
+  read -32 r14 r1
+  write -28 r14 r1
+  or r0 r5 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -16 r14 r5
+  write -36 r14 r1
+  read -36 r14 r1
+  write -24 r14 r1
+  load 0 r1
+  write -20 r14 r1
+  add r5 8 r1
+  add r1 0 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  read 0 r1 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -24 r14 r7
+  read -20 r14 r6
+  load 0 r5
+  load 55 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -12 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  load 4 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -40 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -40 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -28 r14 r7
+  read -24 r14 r6
+  load 0 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  read 0 r5 r2
+  shiftr r2 30 r1
+  load 1 r3
+  beq r1 r3 .L220
+  or r0 r5 r1
+  shiftr r2 30 r5
+  jump .L223
+.L220:
+  or r0 r5 r1
+  load 0 r2
+  or r0 r2 r5
+.L223:
+  add r1 4 r1
+  load 0 r2
+  write -24 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -24 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -28 r14 r7
+  read 0 r1 r6
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  add r5 8 r1
+  add r1 0 r1
+  load 0 r2
+  write -24 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -24 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -28 r14 r6
+  load 0 r5
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  load32 -12 r1
+  sub r13 r1 r13
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function selvaarg */
+
+
+.text
+; function selvastart
+selvastart:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  add r14 -32 r1
+  write 0 r1 r6
+  write -16 r14 r5
+  or r0 r4 r3
+  write -12 r14 r3
+  or r0 r3 r6
+  load 0 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  write -36 r14 r1
+  read -36 r14 r1
+  write -28 r14 r1
+  load 0 r1
+  write -24 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -32 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -28 r14 r7
+  read -24 r14 r6
+  load 0 r5
+  load 55 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r1
+  read -12 r14 r3
+  load32 -12 r2
+  sub r13 r2 r13
+  add r1 4 r2
+  read 0 r2 r2
+  add r3 52 r3
+  readb 0 r3 r3
+  shiftl r3 2 r4
+  load 2 r3
+  add r3 r4 r3
+  bgts r2 r3 .L229
+  read 0 r1 r2
+  load 2 r1
+  add r1 r2 r1
+  jump .L230
+.L229:
+  or r0 r2 r1
+.L230:
+  sub r0 r1 r1
+  load32 536870911 r2
+  and r1 r2 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 4 r1
+  write -24 r14 r1
+  load 0 r1
+  write -20 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -20 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -24 r14 r7
+  read -28 r14 r6
+  load 0 r5
+  load 91 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  load32 -12 r1
+  sub r13 r1 r13
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function selvastart */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "unreachable\000"
+/* end data */
+
+
+.text
+; function lowerblk
+lowerblk:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 80 r13
+  write -16 r14 r7
+  write -24 r14 r6
+  write -28 r14 r5
+  write -20 r14 r4
+  addr2reg insb r12
+  read 0 r12 r1
+  load32 4194304 r2
+  add r1 r2 r1
+  addr2reg curi r12
+  write 0 r12 r1
+  or r0 r5 r1
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump selret
+  read -24 r14 r6
+  read -28 r14 r5
+  add r5 4 r1
+  read 0 r1 r1
+  add r5 8 r2
+  read 0 r2 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+.L235:
+  add r5 4 r2
+  read 0 r2 r3
+  beq r1 r3 .L263
+  load 16 r2
+  sub r1 r2 r1
+  write -32 r14 r1
+  or r0 r1 r2
+  read 0 r1 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 116 r4
+  beq r1 r4 .L261
+  load 116 r4
+  sltu r1 r4 r4
+  write -8 r14 r4
+  read -16 r14 r7
+  read -20 r14 r4
+  read -8 r14 r12
+  bne r12 r0 .L253
+  load 124 r4
+  bne r1 r4 .L247
+  or r0 r2 r1
+.L241:
+  write -12 r14 r1
+  ble r1 r3 .L245
+  load 16 r4
+  sub r1 r4 r4
+  read 0 r4 r4
+  shiftl r4 2 r4
+  shiftr r4 2 r4
+  load 116 r7
+  sub r4 r7 r7
+  load 7 r4
+  sltu r4 r7 r4
+  xor r4 1 r4
+  beq r4 r0 .L244
+  load 16 r4
+  sub r1 r4 r1
+  jump .L241
+.L244:
+  read -20 r14 r4
+  jump .L246
+.L245:
+  read -20 r14 r4
+.L246:
+  or r0 r6 r7
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump selcall
+  read -12 r14 r1
+  read -16 r14 r7
+  read -24 r14 r6
+  read -28 r14 r5
+  read -20 r14 r4
+  jump .L235
+.L247:
+  load 124 r3
+  blt r1 r3 .L249
+  or r0 r2 r1
+  jump .L258
+.L249:
+  load 121 r3
+  beq r1 r3 .L261
+  load 121 r3
+  blt r1 r3 .L252
+  or r0 r2 r1
+  jump .L258
+.L252:
+  or r0 r2 r1
+  jump .L258
+.L253:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  load 87 r3
+  beq r2 r3 .L260
+  load 87 r3
+  bge r2 r3 .L258
+  load 86 r3
+  beq r2 r3 .L259
+  load 86 r3
+  sltu r2 r3 r2
+.L258:
+  add r14 -72 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -72 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -72 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r2
+  read 0 r2 r2
+  add r14 -72 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r1
+  add r14 -72 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump emiti
+  read -32 r14 r1
+  read -16 r14 r7
+  read -24 r14 r6
+  read -28 r14 r5
+  read -20 r14 r4
+  jump .L235
+.L259:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump selvaarg
+  read -32 r14 r1
+  read -16 r14 r7
+  read -24 r14 r6
+  read -28 r14 r5
+  read -20 r14 r4
+  jump .L235
+.L260:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r6
+  add r14 -56 r5
+  add r7 0 r1
+  read 0 r1 r1
+  add r14 -56 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r7 4 r1
+  read 0 r1 r1
+  add r14 -56 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump selvastart
+  read -32 r14 r1
+  read -16 r14 r7
+  read -24 r14 r6
+  read -28 r14 r5
+  read -20 r14 r4
+  jump .L235
+.L261:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -32 r14 r1
+  read -16 r14 r7
+  read -24 r14 r6
+  read -28 r14 r5
+  read -20 r14 r4
+  or r0 r1 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r2 r1
+  jump .L235
+.L263:
+  read -20 r14 r4
+  read 0 r4 r1
+  bne r5 r1 .L269
+.L265:
+  read 0 r6 r1
+  beq r1 r0 .L268
+  add r14 -48 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -48 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -48 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r2
+  read 0 r2 r2
+  add r14 -48 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r1
+  add r14 -48 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump emiti
+  read -24 r14 r6
+  read 0 r6 r1
+  add r1 16 r1
+  read 0 r1 r1
+  write 0 r6 r1
+  jump .L265
+.L268:
+  read -28 r14 r5
+.L269:
+  addr2reg insb r12
+  read 0 r12 r1
+  load32 4194304 r2
+  add r1 r2 r1
+  addr2reg curi r12
+  read 0 r12 r2
+  sub r1 r2 r1
+  shiftrs r1 31 r2
+  shiftr r2 28 r2
+  add r1 r2 r1
+  shiftrs r1 4 r6
+  add r5 8 r1
+  write 0 r1 r6
+  add r5 4 r4
+  addr2reg curi r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump idup
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function lowerblk */
+
+
+.text
+; function lowerparams
+lowerparams:
+  or r0 r5 r7
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  read 0 r4 r2
+  write -16 r14 r2
+  add r2 4 r1
+  read 0 r1 r5
+  or r0 r5 r3
+  or r0 r2 r1
+  or r0 r5 r2
+  or r0 r7 r5
+.L275:
+  write -4 r14 r2
+  add r1 8 r6
+  read 0 r6 r6
+  shiftl r6 4 r6
+  add r3 r6 r6
+  bge r2 r6 .L279
+  read 0 r2 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 109 r7
+  sub r6 r7 r7
+  load 6 r6
+  sltu r6 r7 r6
+  xor r6 1 r6
+  beq r6 r0 .L278
+  add r2 16 r2
+  jump .L275
+.L278:
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  or r0 r5 r7
+  or r0 r3 r5
+  jump .L280
+.L279:
+  or r0 r2 r1
+  or r0 r5 r7
+  or r0 r3 r5
+.L280:
+  or r0 r1 r6
+  or r0 r5 r3
+  savpc r15
+  add r15 12 r15
+  jump selpar
+  read -4 r14 r5
+  read -16 r14 r2
+  add r2 8 r1
+  read 0 r1 r1
+  add r2 4 r2
+  read 0 r2 r2
+  sub r5 r2 r2
+  shiftrs r2 31 r3
+  shiftr r3 28 r3
+  add r2 r3 r2
+  shiftrs r2 4 r2
+  sub r1 r2 r1
+  addr2reg insb r12
+  read 0 r12 r2
+  load32 4194304 r3
+  add r2 r3 r2
+  addr2reg curi r12
+  read 0 r12 r3
+  sub r2 r3 r2
+  shiftrs r2 31 r3
+  shiftr r3 28 r3
+  add r2 r3 r2
+  shiftrs r2 4 r2
+  add r1 r2 r3
+  write -12 r14 r3
+  shiftl r3 4 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -8 r14 r1
+  addr2reg curi r12
+  read 0 r12 r5
+  addr2reg insb r12
+  read 0 r12 r2
+  load32 4194304 r3
+  add r2 r3 r2
+  sub r2 r5 r2
+  shiftrs r2 31 r3
+  shiftr r3 28 r3
+  add r2 r3 r2
+  shiftrs r2 4 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  or r0 r1 r4
+  read -4 r14 r5
+  read -16 r14 r2
+  add r2 4 r1
+  read 0 r1 r1
+  add r2 8 r2
+  read 0 r2 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+  sub r1 r5 r1
+  shiftrs r1 31 r2
+  shiftr r2 28 r2
+  add r1 r2 r1
+  shiftrs r1 4 r6
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  read -8 r14 r1
+  read -12 r14 r3
+  read -16 r14 r2
+  add r2 8 r4
+  write 0 r4 r3
+  add r2 4 r2
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function lowerparams */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "\012> After ABI lowering:\012\000"
+/* end data */
+
+
+.text
+; function b32p3_abi
+.global b32p3_abi
+b32p3_abi:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  write -16 r14 r4
+  read 0 r4 r1
+.L285:
+  beq r1 r0 .L288
+  add r1 52 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L285
+.L288:
+  add r14 -24 r5
+  savpc r15
+  add r15 12 r15
+  jump lowerparams
+  read -16 r14 r4
+  load 0 r1
+  write -28 r14 r1
+  read 0 r4 r1
+  or r0 r1 r2
+.L290:
+  add r2 44 r2
+  read 0 r2 r2
+  beq r2 r0 .L292
+  or r0 r2 r1
+.L292:
+  write -12 r14 r1
+  add r1 52 r2
+  read 0 r2 r2
+  bne r2 r0 .L294
+  add r14 -24 r7
+  add r14 -28 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump lowerblk
+  read -12 r14 r1
+  read -16 r14 r4
+.L294:
+  read 0 r4 r2
+  beq r1 r2 .L296
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L290
+.L296:
+  addr2reg debug+65 r12
+  readb 0 r12 r1
+  beq r1 r0 .L298
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.24 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+.L298:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function b32p3_abi */
+
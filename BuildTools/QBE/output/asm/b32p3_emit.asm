@@ -0,0 +1,5540 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/b32p3/../all.h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "add %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "sub %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "sub r0 %0 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "mults %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "mulshi %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "multuhi %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "multfp %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "divfp %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "divs %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "mods %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "divu %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "modu %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "and %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "or %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "xor %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "shiftrs %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "shiftr %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "shiftl %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "slt %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "sltu %0 %1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "writeb %M1 %0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "writeh %M1 %0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "write %M1 %0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "readbu %M0 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "readhu %M0 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "read %M0 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "and %0 0xFF %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "or r0 %0 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "sltu %0 1 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "sltu r0 %0 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "or r0 %0 r12\012  or r0 %1 %0\012  or r0 r12 %1\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.39:
+	.ascii "jump %0\000"
+/* end data */
+
+.data
+.balign 4
+omap:
+	.short 1
+	.short -1
+	.int .Lstring.7+0
+	.short 2
+	.short -1
+	.int .Lstring.8+0
+	.short 3
+	.short -1
+	.int .Lstring.9+0
+	.short 8
+	.short -1
+	.int .Lstring.10+0
+	.short 106
+	.short -1
+	.int .Lstring.11+0
+	.short 107
+	.short -1
+	.int .Lstring.12+0
+	.short 9
+	.short -1
+	.int .Lstring.13+0
+	.short 10
+	.short -1
+	.int .Lstring.14+0
+	.short 4
+	.short -1
+	.int .Lstring.15+0
+	.short 5
+	.short -1
+	.int .Lstring.16+0
+	.short 6
+	.short -1
+	.int .Lstring.17+0
+	.short 7
+	.short -1
+	.int .Lstring.18+0
+	.short 11
+	.short -1
+	.int .Lstring.19+0
+	.short 12
+	.short -1
+	.int .Lstring.20+0
+	.short 13
+	.short -1
+	.int .Lstring.21+0
+	.short 14
+	.short -1
+	.int .Lstring.22+0
+	.short 15
+	.short -1
+	.int .Lstring.23+0
+	.short 16
+	.short -1
+	.int .Lstring.24+0
+	.short 32
+	.short -1
+	.int .Lstring.25+0
+	.short 36
+	.short -1
+	.int .Lstring.26+0
+	.short 53
+	.short 0
+	.int .Lstring.27+0
+	.short 54
+	.short 0
+	.int .Lstring.28+0
+	.short 55
+	.short 0
+	.int .Lstring.29+0
+	.short 56
+	.short -1
+	.int .Lstring.29+0
+	.short 60
+	.short -1
+	.int .Lstring.30+0
+	.short 62
+	.short -1
+	.int .Lstring.31+0
+	.short 63
+	.short -1
+	.int .Lstring.32+0
+	.short 64
+	.short -1
+	.int .Lstring.32+0
+	.short 65
+	.short 0
+	.int .Lstring.32+0
+	.short 65
+	.short 1
+	.int .Lstring.32+0
+	.short 67
+	.short -1
+	.int .Lstring.33+0
+	.short 69
+	.short -1
+	.int .Lstring.34+0
+	.short 70
+	.short -1
+	.int .Lstring.35+0
+	.short 71
+	.short -1
+	.int .Lstring.35+0
+	.short 104
+	.short -1
+	.int .Lstring.36+0
+	.short 105
+	.short -1
+	.int .Lstring.37+0
+	.short 88
+	.short -1
+	.int .Lstring.35+0
+	.short 94
+	.short -1
+	.int .Lstring.38+0
+	.short 124
+	.short 0
+	.int .Lstring.39+0
+	.short 143
+	.short 0
+	.int 0
+/* end data */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "r1\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.41:
+	.ascii "r2\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "r3\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "r4\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.44:
+	.ascii "r5\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.45:
+	.ascii "r6\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.46:
+	.ascii "r7\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.47:
+	.ascii "r8\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.48:
+	.ascii "r9\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.49:
+	.ascii "r10\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.50:
+	.ascii "r11\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.51:
+	.ascii "r12\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.52:
+	.ascii "r13\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.53:
+	.ascii "r14\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.54:
+	.ascii "r15\000"
+/* end data */
+
+.data
+.balign 4
+rname:
+	.fill 4,1,0
+	.int .Lstring.40+0
+	.int .Lstring.41+0
+	.int .Lstring.42+0
+	.int .Lstring.43+0
+	.int .Lstring.44+0
+	.int .Lstring.45+0
+	.int .Lstring.46+0
+	.int .Lstring.47+0
+	.int .Lstring.48+0
+	.int .Lstring.49+0
+	.int .Lstring.50+0
+	.int .Lstring.51+0
+	.int .Lstring.52+0
+	.int .Lstring.53+0
+	.int .Lstring.54+0
+/* end data */
+
+.data
+.balign 1
+.Lstring.55:
+	.ascii "beq\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.56:
+	.ascii "bne\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.57:
+	.ascii "bges\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.58:
+	.ascii "bgts\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.59:
+	.ascii "bles\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.60:
+	.ascii "blts\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.61:
+	.ascii "bge\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.62:
+	.ascii "bgt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.63:
+	.ascii "ble\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.64:
+	.ascii "blt\000"
+/* end data */
+
+.data
+.balign 4
+brname:
+	.int .Lstring.55+0
+	.int .Lstring.56+0
+	.int .Lstring.57+0
+	.int .Lstring.58+0
+	.int .Lstring.59+0
+	.int .Lstring.60+0
+	.int .Lstring.61+0
+	.int .Lstring.62+0
+	.int .Lstring.63+0
+	.int .Lstring.64+0
+/* end data */
+
+.data
+.balign 1
+.Lstring.66:
+	.ascii "s <= fn->slot\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.67:
+	.ascii "BuildTools/QBE/b32p3/emit.c\000"
+/* end data */
+
+
+.text
+; function slot
+slot:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  read -12 r14 r5
+  write -16 r14 r1
+  add r5 48 r2
+  read 0 r2 r2
+  bles r1 r2 .L19
+  load 192 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.66 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+  read -12 r14 r5
+.L19:
+  blts r1 r0 .L21
+  add r5 48 r2
+  read 0 r2 r2
+  sub r2 r1 r1
+  addr2reg fr+20 r12
+  read 0 r12 r2
+  add r1 r2 r1
+  shiftl r1 2 r1
+  sub r0 r1 r1
+  jump .L22
+.L21:
+  sub r0 r1 r1
+  shiftl r1 2 r1
+.L22:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function slot */
+
+.data
+.balign 1
+.Lstring.69:
+	.ascii "c->sym.type == SGlo\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.70:
+	.ascii "+%lli\000"
+/* end data */
+
+
+.text
+; function emitaddr
+emitaddr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  or r0 r4 r1
+  write -16 r14 r1
+  add r1 4 r2
+  read 0 r2 r2
+  beq r2 r0 .L27
+  load 202 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.69 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+.L27:
+  add r1 4 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump str
+  or r0 r1 r4
+  read -12 r14 r1
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -12 r14 r4
+  read -16 r14 r1
+  add r1 16 r2
+  read 0 r2 r6
+  beq r6 r0 .L29
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.70 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+.L29:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitaddr */
+
+.data
+.balign 1
+.Lstring.72:
+	.ascii "  \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.73:
+	.ascii "invalid escape\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.74:
+	.ascii "isreg(r)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.75:
+	.ascii "invalid second argument\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.76:
+	.ascii "pc->type == CBits\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.77:
+	.ascii "%d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.78:
+	.ascii "c == '0' || c == '1'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.79:
+	.ascii "invalid address argument\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.80:
+	.ascii "0 %s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.81:
+	.ascii "pc->type == CAddr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.82:
+	.ascii "0 r12\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.83:
+	.ascii "%d r14\000"
+/* end data */
+
+
+.text
+; function emitf
+emitf:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 76 r13
+  write -60 r14 r6
+  write -64 r14 r5
+  or r0 r7 r5
+  write -16 r14 r4
+  write -52 r14 r5
+  addr2reg .Lstring.72 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -52 r14 r5
+  read -16 r14 r4
+  or r0 r5 r7
+.L34:
+  add r4 1 r1
+  write -56 r14 r1
+  readb 0 r4 r4
+  load 37 r1
+  beq r4 r1 .L40
+  beq r4 r0 .L37
+  or r0 r7 r5
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  read -56 r14 r4
+  read -52 r14 r7
+  jump .L34
+.L37:
+  or r0 r7 r5
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L40:
+  read -56 r14 r4
+  read -64 r14 r5
+  or r0 r4 r1
+  add r4 1 r4
+  write -48 r14 r4
+  readb 0 r1 r1
+  write -32 r14 r1
+  load 61 r2
+  beq r1 r2 .L80
+  load 61 r2
+  blt r1 r2 .L63
+  load 77 r2
+  beq r1 r2 .L46
+  load 77 r2
+  sltu r1 r2 r1
+  jump .L67
+.L46:
+  add r4 1 r1
+  write -28 r14 r1
+  readb 0 r4 r2
+  write -20 r14 r2
+  load 1 r1
+  load 48 r3
+  beq r2 r3 .L48
+  xor r2 49 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L48:
+  bne r1 r0 .L50
+  load 251 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.78 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -20 r14 r2
+  read -64 r14 r5
+.L50:
+  add r5 8 r1
+  load 48 r3
+  sub r2 r3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r2
+  write -24 r14 r2
+  write -68 r14 r2
+  read -68 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -24 r14 r2
+  read -52 r14 r7
+  read -60 r14 r6
+  load 1 r3
+  beq r1 r3 .L60
+  load 1 r3
+  blt r1 r3 .L56
+  load 4 r2
+  beq r1 r2 .L55
+  load 4 r2
+  sltu r1 r2 r1
+  jump .L58
+.L55:
+  or r0 r6 r5
+  read -68 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r6
+  read -52 r14 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.83 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r4
+  read -52 r14 r7
+  read -60 r14 r6
+  read -64 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L34
+.L56:
+  beq r1 r0 .L59
+  sltu r1 r0 r1
+.L58:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.79 r5
+  addr2reg .Lstring.67 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -24 r14 r2
+  read -52 r14 r7
+  load32 -24 r1
+  sub r13 r1 r13
+.L59:
+  shiftr r2 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.80 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r4
+  read -52 r14 r7
+  read -60 r14 r6
+  read -64 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L34
+.L60:
+  add r6 8 r1
+  read 0 r1 r1
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  load 2 r2
+  beq r1 r2 .L62
+  load 263 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.81 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -52 r14 r7
+.L62:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.82 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r4
+  read -52 r14 r7
+  read -60 r14 r6
+  read -64 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L34
+.L63:
+  load 49 r2
+  beq r1 r2 .L68
+  load 49 r2
+  bge r1 r2 .L67
+  load 48 r2
+  beq r1 r2 .L80
+  load 48 r2
+  sltu r1 r2 r1
+.L67:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.73 r5
+  addr2reg .Lstring.67 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -32 r14 r1
+  read -64 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+  jump .L80
+.L68:
+  add r5 8 r1
+  add r1 4 r1
+  read 0 r1 r2
+  write -36 r14 r2
+  write -68 r14 r2
+  read -68 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -36 r14 r2
+  read -52 r14 r7
+  read -60 r14 r6
+  load 1 r3
+  beq r1 r3 .L77
+  load 1 r2
+  bge r1 r2 .L73
+  beq r1 r0 .L74
+  sltu r1 r0 r1
+.L73:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.75 r5
+  addr2reg .Lstring.67 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+.L74:
+  read -68 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  read -36 r14 r2
+  read -52 r14 r7
+  bne r1 r0 .L76
+  load 239 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.74 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -36 r14 r2
+  read -52 r14 r7
+.L76:
+  shiftr r2 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r4
+  or r0 r7 r5
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -48 r14 r4
+  read -52 r14 r7
+  read -60 r14 r6
+  read -64 r14 r5
+  jump .L34
+.L77:
+  add r6 8 r1
+  read 0 r1 r1
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  write -40 r14 r1
+  read 0 r1 r2
+  load 1 r3
+  beq r2 r3 .L79
+  load 244 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.76 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -40 r14 r1
+  read -52 r14 r7
+.L79:
+  add r1 16 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.77 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -48 r14 r4
+  read -52 r14 r7
+  read -60 r14 r6
+  read -64 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L34
+.L80:
+  load 61 r2
+  beq r1 r2 .L82
+  add r5 8 r1
+  add r1 0 r1
+  jump .L83
+.L82:
+  add r5 4 r1
+.L83:
+  read 0 r1 r1
+  write -44 r14 r1
+  write -68 r14 r1
+  read -68 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r2
+  read -44 r14 r1
+  read -52 r14 r7
+  bne r2 r0 .L85
+  load 230 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.74 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -44 r14 r1
+  read -52 r14 r7
+.L85:
+  shiftr r1 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r4
+  or r0 r7 r5
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -48 r14 r4
+  read -52 r14 r7
+  read -60 r14 r6
+  read -64 r14 r5
+  jump .L34
+
+/* end function emitf */
+
+.data
+.balign 1
+.Lstring.85:
+	.ascii "  addr2reg \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.86:
+	.ascii " %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.87:
+	.ascii "  load %d %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.88:
+	.ascii "  load32 %d %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.89:
+	.ascii "invalid constant\000"
+/* end data */
+
+
+.text
+; function loadcon
+loadcon:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r2
+  or r0 r6 r4
+  write -16 r14 r4
+  write -8 r14 r2
+  shiftl r5 2 r3
+  addr2reg rname r1
+  add r1 r3 r1
+  read 0 r1 r6
+  write -12 r14 r6
+  read 0 r2 r1
+  load 2 r3
+  beq r1 r3 .L100
+  load 2 r3
+  bge r1 r3 .L93
+  load 1 r3
+  beq r1 r3 .L94
+  load 1 r2
+  sltu r1 r2 r1
+.L93:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.89 r5
+  addr2reg .Lstring.67 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L101
+.L94:
+  or r0 r2 r1
+  add r1 16 r2
+  or r0 r6 r1
+  read 0 r2 r6
+  load 0 r2
+  blts r6 r0 .L97
+  load 32767 r2
+  slt r2 r6 r2
+  xor r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L97:
+  bne r2 r0 .L99
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r7
+  addr2reg .Lstring.88 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L101
+.L99:
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r7
+  addr2reg .Lstring.87 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L101
+.L100:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.85 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r4
+  or r0 r4 r1
+  read -8 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump emitaddr
+  read -12 r14 r6
+  read -16 r14 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.86 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+.L101:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function loadcon */
+
+.data
+.balign 1
+.Lstring.91:
+	.ascii "  load32 %d r12\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.92:
+	.ascii "  add r14 r12 r12\012\000"
+/* end data */
+
+
+.text
+; function fixmem
+fixmem:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r6
+  write -8 r14 r5
+  write -16 r14 r4
+  read 0 r4 r1
+  write -20 r14 r1
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -8 r14 r5
+  load 4 r2
+  bne r1 r2 .L109
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r6
+  read -12 r14 r4
+  load 1 r1
+  load32 -32768 r2
+  blts r6 r2 .L107
+  load 32767 r1
+  slt r1 r6 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L107:
+  beq r1 r0 .L109
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.91 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.92 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 96 r1
+  write 0 r4 r1
+.L109:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function fixmem */
+
+.data
+.balign 1
+.Lstring.94:
+	.ascii " r12\012\000"
+/* end data */
+
+
+.text
+; function fixaddr
+fixaddr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  write -28 r14 r6
+  write -16 r14 r5
+  write -32 r14 r4
+  read 0 r4 r2
+  write -20 r14 r2
+  write -36 r14 r2
+  read -36 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -20 r14 r2
+  read -28 r14 r4
+  read -16 r14 r5
+  load 1 r3
+  bne r1 r3 .L115
+  add r5 8 r1
+  read 0 r1 r1
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  write -24 r14 r1
+  read 0 r1 r1
+  load 2 r2
+  bne r1 r2 .L115
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.85 r5
+  or r0 r4 r1
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -24 r14 r4
+  read -28 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump emitaddr
+  read -28 r14 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.94 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 96 r1
+  write 0 r4 r1
+.L115:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function fixaddr */
+
+.data
+.balign 1
+.Lstring.96:
+	.ascii "fn->con[r.val].type == CBits\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.97:
+	.ascii "r0\000"
+/* end data */
+
+
+.text
+; function brarg
+brarg:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r5
+  load 1 r2
+  beq r1 r2 .L122
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  bne r1 r0 .L121
+  load 349 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.74 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+.L121:
+  read -20 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jump .L125
+.L122:
+  add r5 8 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  load 1 r2
+  beq r1 r2 .L124
+  load 346 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.96 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+.L124:
+  addr2reg .Lstring.97 r1
+.L125:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function brarg */
+
+.data
+.balign 1
+.Lstring.99:
+	.ascii "isreg(i->to)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.100:
+	.ascii "  xor %s %s %s\012  sltu %s 1 %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.101:
+	.ascii "  xor %s %s %s\012  sltu r0 %s %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.102:
+	.ascii "sltu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.103:
+	.ascii "slt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.104:
+	.ascii "  %s %s %s %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.105:
+	.ascii "  xor %s 1 %s\012\000"
+/* end data */
+
+
+.text
+; function emitcmp
+emitcmp:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  write -24 r14 r7
+  write -28 r14 r4
+  write -8 r14 r6
+  write -20 r14 r5
+  add r5 8 r1
+  add r1 0 r1
+  or r0 r6 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump brarg
+  write -12 r14 r1
+  read -8 r14 r6
+  read -20 r14 r5
+  add r5 8 r1
+  add r1 4 r1
+  or r0 r6 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump brarg
+  write -4 r14 r1
+  read -20 r14 r5
+  add r5 8 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -4 r14 r7
+  read -8 r14 r6
+  read -20 r14 r5
+  load 1 r2
+  beq r1 r2 .L130
+  write -16 r14 r7
+  jump .L134
+.L130:
+  add r6 8 r1
+  read 0 r1 r1
+  add r5 8 r2
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  add r1 16 r2
+  read 0 r2 r6
+  beq r6 r0 .L133
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.77 r5
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump sprintf
+  read -20 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  add r14 -48 r1
+  or r0 r1 r7
+.L133:
+  write -16 r14 r7
+.L134:
+  add r5 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r3
+  read -16 r14 r7
+  read -12 r14 r1
+  read -24 r14 r4
+  read -20 r14 r5
+  read -28 r14 r2
+  bne r3 r0 .L136
+  load 371 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.99 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r7
+  read -12 r14 r1
+  read -24 r14 r4
+  read -20 r14 r5
+  read -28 r14 r2
+.L136:
+  add r5 4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  shiftl r3 2 r5
+  addr2reg rname r3
+  add r3 r5 r3
+  read 0 r3 r6
+  write -32 r14 r6
+  load 9 r3
+  blt r2 r3 .L139
+  or r0 r6 r3
+  or r0 r1 r12
+  or r0 r7 r1
+  or r0 r12 r7
+  jump .L143
+.L139:
+  or r0 r6 r3
+  shiftl r2 2 r6
+  addr2reg .Ljt139 r5
+  add r5 r6 r5
+  read 0 r5 r5
+  jumpr 0 r5
+.L140:
+  load 36 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 32 r5
+  write 0 r5 r3
+  add r2 28 r5
+  write 0 r5 r3
+  add r2 24 r2
+  write 0 r2 r3
+  or r0 r1 r6
+  addr2reg .Lstring.100 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -36 r1
+  sub r13 r1 r13
+  jump .L157
+.L141:
+  load 36 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 32 r5
+  write 0 r5 r3
+  add r2 28 r5
+  write 0 r5 r3
+  add r2 24 r2
+  write 0 r2 r3
+  or r0 r1 r6
+  addr2reg .Lstring.101 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -36 r1
+  sub r13 r1 r13
+  jump .L157
+.L142:
+  or r0 r1 r12
+  or r0 r7 r1
+  or r0 r12 r7
+.L143:
+  load 6 r5
+  bges r2 r5 .L145
+  addr2reg .Lstring.103 r2
+  jump .L146
+.L145:
+  addr2reg .Lstring.102 r2
+.L146:
+  or r0 r2 r6
+  load 32 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 28 r5
+  write 0 r5 r3
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.104 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r6
+  read -24 r14 r4
+  read -28 r14 r1
+  load32 -32 r2
+  sub r13 r2 r13
+  load 1 r2
+  load 2 r3
+  beq r1 r3 .L148
+  xor r1 4 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L149
+.L148:
+  or r0 r2 r3
+.L149:
+  load 1 r2
+  bne r3 r0 .L151
+  xor r1 6 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L152
+.L151:
+  or r0 r2 r3
+.L152:
+  load 1 r2
+  bne r3 r0 .L154
+  xor r1 8 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L155
+.L154:
+  or r0 r2 r1
+.L155:
+  beq r1 r0 .L157
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r6 r7
+  addr2reg .Lstring.105 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+.L157:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt139:
+  .int .L140
+  .int .L141
+  .int .L142
+  .int .L143
+  .int .L143
+  .int .L142
+  .int .L142
+  .int .L143
+  .int .L143
+
+/* end function emitcmp */
+
+.data
+.balign 1
+.Lstring.107:
+	.ascii "no match for %s(%c)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.108:
+	.ascii "wlsd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.109:
+	.ascii "readb %M0 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.110:
+	.ascii "readh %M0 %=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.111:
+	.ascii "isreg(i->arg[0])\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.112:
+	.ascii "  shiftl %s 24 %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.113:
+	.ascii "  shiftrs %s 24 %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.114:
+	.ascii "  shiftl %s 16 %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.115:
+	.ascii "  shiftrs %s 16 %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.116:
+	.ascii "  shiftr %s 16 %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.117:
+	.ascii "  read %d r14 r12\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.118:
+	.ascii "  read 0 r12 r12\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.119:
+	.ascii "rtype(i->arg[0]) == RSlot\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.120:
+	.ascii "  add r14 %d %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.121:
+	.ascii "  load32 %d %s\012  add r14 %s %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.122:
+	.ascii "  savpc r15\012  add r15 12 r15\012  jump %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.123:
+	.ascii "  savpc r15\012  add r15 12 r15\012  jumpr 0 %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.124:
+	.ascii "invalid call argument\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.125:
+	.ascii "  sub r13 %s r13\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.126:
+	.ascii "  or r0 r13 %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.127:
+	.ascii "  addr2reg .Ljt%d %s\012\000"
+/* end data */
+
+
+.text
+; function emitins
+emitins:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 52 r13
+  or r0 r4 r1
+  or r0 r6 r4
+  or r0 r5 r6
+  write -32 r14 r4
+  write -12 r14 r6
+  write -24 r14 r1
+  read 0 r1 r2
+  shiftl r2 2 r3
+  shiftr r3 2 r3
+  load 108 r5
+  bne r3 r5 8
+  jump .L271
+  load 108 r5
+  blt r3 r5 .L183
+  load 124 r4
+  beq r3 r4 .L166
+  or r0 r2 r1
+  or r0 r1 r2
+  load 124 r1
+  sltu r3 r1 r1
+  jump .L229
+.L166:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -12 r14 r6
+  or r0 r1 r2
+  read -24 r14 r1
+  load 1 r3
+  beq r2 r3 .L175
+  load 1 r3
+  bge r2 r3 .L182
+  beq r2 r0 .L172
+  or r0 r2 r1
+  sltu r1 r0 r1
+  jump .L182
+.L172:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r2
+  read -32 r14 r4
+  read -24 r14 r1
+  bne r2 r0 .L174
+  load 559 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.111 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r4
+  read -24 r14 r1
+.L174:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.123 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L272
+.L175:
+  or r0 r1 r2
+  add r6 8 r1
+  read 0 r1 r1
+  add r2 8 r2
+  add r2 0 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  read 0 r1 r3
+  load 1 r2
+  load 2 r4
+  bne r3 r4 .L177
+  add r1 4 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L178
+.L177:
+  or r0 r2 r3
+.L178:
+  load 1 r2
+  bne r3 r0 .L180
+  add r1 16 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L180:
+  bne r2 r0 .L182
+  add r1 4 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump str
+  or r0 r1 r6
+  read -32 r14 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.122 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L272
+.L182:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.124 r5
+  addr2reg .Lstring.67 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L272
+.L183:
+  load 88 r5
+  blt r3 r5 .L226
+  load 88 r5
+  sub r3 r5 r3
+  load 9 r5
+  bge r3 r5 .L229
+  shiftl r3 2 r5
+  addr2reg .Ljt185 r3
+  add r3 r5 r3
+  read 0 r3 r3
+  jumpr 0 r3
+.L186:
+  or r0 r1 r2
+  add r1 4 r1
+  add r2 8 r2
+  add r2 0 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -24 r14 r1
+  beq r2 r0 8
+  jump .L272
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -24 r14 r1
+  load 4 r3
+  beq r2 r3 .L199
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r2
+  read -24 r14 r1
+  bne r2 r0 .L190
+  load 513 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.99 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -24 r14 r1
+.L190:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  load 4 r3
+  beq r2 r3 .L198
+  load 4 r3
+  bge r2 r3 .L195
+  load 1 r3
+  beq r2 r3 .L197
+  load 1 r3
+  sltu r2 r3 r2
+.L195:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r2
+  read -24 r14 r1
+  bne r2 r0 .L241
+  load 523 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.111 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -24 r14 r1
+  jump .L241
+.L197:
+  or r0 r1 r2
+  add r6 8 r1
+  read 0 r1 r3
+  or r0 r4 r1
+  add r2 8 r4
+  add r4 0 r4
+  read 0 r4 r4
+  shiftr r4 3 r4
+  shiftl r4 5 r4
+  add r3 r4 r4
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r5
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump loadcon
+  jump .L272
+.L198:
+  read 0 r1 r2
+  load32 -1073741824 r3
+  and r2 r3 r3
+  load 65 r2
+  or r2 r3 r2
+  write 0 r1 r2
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 0 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixmem
+  read -24 r14 r1
+  jump .L241
+.L199:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  load 4 r3
+  beq r2 r3 .L208
+  load 4 r3
+  bge r2 r3 .L204
+  load 1 r3
+  beq r2 r3 .L207
+  load 1 r3
+  sltu r2 r3 r2
+.L204:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r2
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  bne r2 r0 .L206
+  load 504 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.111 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+.L206:
+  add r1 4 r2
+  add r1 8 r3
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  add r1 4 r3
+  load 0 r2
+  write 0 r3 r2
+  read 0 r1 r2
+  load32 -1073741824 r3
+  and r2 r3 r3
+  load 55 r2
+  or r2 r3 r2
+  write 0 r1 r2
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 4 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixmem
+  read -24 r14 r1
+  jump .L241
+.L207:
+  add r6 8 r2
+  read 0 r2 r2
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 5 r3
+  or r0 r4 r1
+  add r2 r3 r4
+  or r0 r1 r6
+  load 12 r5
+  savpc r15
+  add r15 12 r15
+  jump loadcon
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  add r1 8 r2
+  add r2 0 r3
+  load 96 r2
+  write 0 r3 r2
+  add r1 4 r2
+  add r1 8 r3
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  add r1 4 r3
+  load 0 r2
+  write 0 r3 r2
+  read 0 r1 r2
+  load32 -1073741824 r3
+  and r2 r3 r3
+  load 55 r2
+  or r2 r3 r2
+  write 0 r1 r2
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 4 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixmem
+  read -24 r14 r1
+  jump .L241
+.L208:
+  add r1 8 r1
+  add r1 0 r1
+  or r0 r6 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r6
+  read -32 r14 r4
+  load 0 r1
+  load32 -32768 r2
+  blts r6 r2 .L210
+  load 32767 r1
+  slt r1 r6 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L210:
+  bne r1 r0 .L212
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.91 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.92 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.118 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  jump .L213
+.L212:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.117 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L213:
+  add r1 8 r2
+  add r2 0 r3
+  load 96 r2
+  write 0 r3 r2
+  add r1 4 r2
+  add r1 8 r3
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  add r1 4 r3
+  load 0 r2
+  write 0 r3 r2
+  read 0 r1 r2
+  load32 -1073741824 r3
+  and r2 r3 r3
+  load 55 r2
+  or r2 r3 r2
+  write 0 r1 r2
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 4 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixmem
+  read -24 r14 r1
+  jump .L241
+.L214:
+  or r0 r1 r2
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r3
+  or r0 r4 r1
+  shiftr r3 3 r4
+  add r2 8 r2
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r5
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump emitdbgloc
+  jump .L272
+.L215:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -12 r14 r6
+  read -24 r14 r1
+  load 4 r3
+  beq r2 r3 .L217
+  load 530 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.119 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r6
+  read -24 r14 r1
+.L217:
+  add r1 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r3
+  addr2reg rname r2
+  add r2 r3 r2
+  read 0 r2 r7
+  write -4 r14 r7
+  add r1 8 r1
+  add r1 0 r1
+  or r0 r6 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r6
+  read -4 r14 r7
+  read -32 r14 r4
+  load 0 r1
+  load32 -32768 r2
+  blts r6 r2 .L219
+  load32 32768 r1
+  slt r6 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L219:
+  bne r1 r0 .L221
+  load 32 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 28 r2
+  write 0 r2 r7
+  add r1 24 r1
+  write 0 r1 r7
+  addr2reg .Lstring.121 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -32 r1
+  sub r13 r1 r13
+  jump .L272
+.L221:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.120 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L272
+.L222:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r2
+  read -32 r14 r4
+  read -24 r14 r1
+  bne r2 r0 .L224
+  load 574 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.111 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r4
+  read -24 r14 r1
+.L224:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.125 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -24 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 4 r1
+  load 0 r2
+  write -36 r14 r2
+  read -36 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -32 r14 r4
+  read -24 r14 r1
+  bne r2 r0 .L272
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.126 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L272
+.L226:
+  load 59 r5
+  sub r3 r5 r3
+  load 11 r5
+  bge r3 r5 .L229
+  shiftl r3 2 r5
+  addr2reg .Ljt227 r3
+  add r3 r5 r3
+  read 0 r3 r3
+  jumpr 0 r3
+.L228:
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 0 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixaddr
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 0 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixmem
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  or r0 r4 r7
+  or r0 r1 r5
+  addr2reg .Lstring.109 r4
+  savpc r15
+  add r15 12 r15
+  jump emitf
+  jump .L272
+.L229:
+  or r0 r2 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r4
+  add r14 -44 r6
+  add r14 -40 r5
+  savpc r15
+  add r15 12 r15
+  jump iscmp
+  or r0 r1 r2
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  bne r2 r0 .L260
+  read 0 r1 r2
+  shiftl r2 2 r3
+  shiftr r3 2 r3
+  load 59 r5
+  sub r3 r5 r3
+  load 6 r5
+  ble r3 r5 .L233
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 53 r3
+  sub r2 r3 r2
+  load 5 r3
+  bgt r2 r3 .L234
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 4 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixaddr
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 4 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixmem
+  read -24 r14 r1
+  jump .L234
+.L233:
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 0 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixaddr
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 0 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixmem
+  read -24 r14 r1
+.L234:
+  add r1 8 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  load 1 r3
+  bne r2 r3 .L241
+  add r6 8 r2
+  read 0 r2 r2
+  add r1 8 r3
+  add r3 4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  shiftl r3 5 r3
+  add r2 r3 r2
+  read 0 r2 r3
+  load 1 r5
+  bne r3 r5 .L241
+  add r2 16 r3
+  read 0 r3 r5
+  load 1 r3
+  load32 -32768 r6
+  blts r5 r6 .L238
+  load 32767 r3
+  slt r3 r5 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L238:
+  beq r3 r0 .L241
+  or r0 r4 r1
+  or r0 r2 r4
+  or r0 r1 r6
+  load 12 r5
+  savpc r15
+  add r15 12 r15
+  jump loadcon
+  read -24 r14 r1
+  add r1 8 r2
+  add r2 4 r3
+  load 96 r2
+  write 0 r3 r2
+.L241:
+  load 0 r2
+  or r0 r1 r4
+  or r0 r2 r1
+.L243:
+  write -8 r14 r1
+  shiftl r1 3 r3
+  addr2reg omap r2
+  add r2 r3 r2
+  readh 0 r2 r2
+  load 143 r3
+  bne r2 r3 .L246
+  read 0 r4 r1
+  shiftl r1 2 r2
+  shiftr r2 2 r2
+  load 24 r3
+  mults r2 r3 r3
+  addr2reg optab r2
+  add r2 r3 r2
+  read 0 r2 r6
+  shiftr r1 30 r2
+  addr2reg .Lstring.108 r1
+  add r1 r2 r1
+  readb 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.107 r5
+  addr2reg .Lstring.67 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -8 r14 r1
+  read -24 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L246:
+  shiftl r1 3 r3
+  addr2reg omap r2
+  add r2 r3 r2
+  readh 0 r2 r3
+  read 0 r4 r2
+  shiftl r2 2 r5
+  shiftr r5 2 r5
+  bne r3 r5 .L257
+  shiftl r1 3 r5
+  addr2reg omap r3
+  add r3 r5 r3
+  add r3 2 r3
+  readh 0 r3 r5
+  shiftr r2 30 r6
+  load 1 r3
+  beq r5 r6 .L249
+  shiftl r1 3 r5
+  addr2reg omap r3
+  add r3 r5 r3
+  add r3 2 r3
+  readh 0 r3 r3
+  xor r3 -2 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+  jump .L250
+.L249:
+  or r0 r3 r5
+.L250:
+  load 1 r3
+  bne r5 r0 .L255
+  shiftl r1 3 r5
+  addr2reg omap r3
+  add r3 r5 r3
+  add r3 2 r3
+  readh 0 r3 r5
+  load 0 r3
+  load32 -1 r6
+  beq r5 r6 .L253
+  or r0 r3 r2
+  jump .L254
+.L253:
+  shiftr r2 30 r2
+  shiftrs r2 1 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L254:
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L256
+.L255:
+  or r0 r3 r2
+.L256:
+  bne r2 r0 .L258
+.L257:
+  add r1 1 r1
+  jump .L243
+.L258:
+  or r0 r1 r2
+  read -12 r14 r6
+  or r0 r4 r1
+  read -32 r14 r4
+  shiftl r2 3 r3
+  addr2reg omap r2
+  add r2 r3 r2
+  add r2 4 r3
+  or r0 r4 r2
+  read 0 r3 r4
+  or r0 r2 r7
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump emitf
+  jump .L272
+.L260:
+  or r0 r4 r2
+  read -44 r14 r4
+  or r0 r2 r7
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump emitcmp
+  jump .L272
+.L261:
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 0 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixaddr
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  add r1 8 r1
+  or r0 r4 r2
+  add r1 0 r4
+  or r0 r6 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fixmem
+  read -32 r14 r4
+  read -12 r14 r6
+  read -24 r14 r1
+  or r0 r4 r7
+  or r0 r1 r5
+  addr2reg .Lstring.110 r4
+  savpc r15
+  add r15 12 r15
+  jump emitf
+  jump .L272
+.L262:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r2
+  read -32 r14 r4
+  read -24 r14 r1
+  bne r2 r0 .L264
+  load 453 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.111 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r4
+  read -24 r14 r1
+.L264:
+  add r1 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r3
+  addr2reg rname r2
+  add r2 r3 r2
+  read 0 r2 r6
+  write -16 r14 r6
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r2
+  or r0 r6 r1
+  read 0 r2 r6
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r7
+  addr2reg .Lstring.112 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r6
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r6 r7
+  addr2reg .Lstring.113 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L272
+.L265:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r2
+  read -32 r14 r4
+  read -24 r14 r1
+  bne r2 r0 .L267
+  load 459 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.111 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r4
+  read -24 r14 r1
+.L267:
+  add r1 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r3
+  addr2reg rname r2
+  add r2 r3 r2
+  read 0 r2 r6
+  write -20 r14 r6
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r2
+  or r0 r6 r1
+  read 0 r2 r6
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r7
+  addr2reg .Lstring.114 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -20 r14 r6
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r6 r7
+  addr2reg .Lstring.115 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L272
+.L268:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r2
+  read -32 r14 r4
+  read -24 r14 r1
+  bne r2 r0 .L270
+  load 467 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.111 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r4
+  read -24 r14 r1
+.L270:
+  add r1 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r3
+  addr2reg rname r2
+  add r2 r3 r2
+  read 0 r2 r6
+  write -28 r14 r6
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r2
+  or r0 r6 r1
+  read 0 r2 r6
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r7
+  addr2reg .Lstring.114 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r6
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r6 r7
+  addr2reg .Lstring.116 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L272
+.L271:
+  addr2reg jtlbl r12
+  read 0 r12 r6
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.127 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+.L272:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt185:
+  .int .L186
+  .int .L214
+  .int .L272
+  .int .L215
+  .int .L229
+  .int .L229
+  .int .L229
+  .int .L229
+  .int .L222
+
+.rdata
+.balign 4
+.Ljt227:
+  .int .L228
+  .int .L229
+  .int .L261
+  .int .L229
+  .int .L229
+  .int .L229
+  .int .L229
+  .int .L262
+  .int .L229
+  .int .L265
+  .int .L268
+
+/* end function emitins */
+
+.data
+.balign 1
+.Lstring.129:
+	.ascii "isreg(b->jmp.arg)\000"
+/* end data */
+
+
+.text
+; function jmparg
+jmparg:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r6
+  write -8 r14 r5
+  write -16 r14 r4
+  add r4 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -8 r14 r5
+  read -16 r14 r4
+  load 4 r2
+  bne r1 r2 .L282
+  add r4 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r6
+  read -12 r14 r4
+  load 0 r1
+  load32 -32768 r2
+  blts r6 r2 .L278
+  load 32767 r1
+  slt r1 r6 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L278:
+  bne r1 r0 .L280
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.91 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.92 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.118 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L281
+.L280:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.117 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+.L281:
+  addr2reg .Lstring.51 r1
+  jump .L285
+.L282:
+  add r4 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  read -16 r14 r4
+  bne r1 r0 .L284
+  load 595 r6
+  addr2reg .Lstring.67 r5
+  addr2reg .Lstring.129 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r4
+.L284:
+  add r4 12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r1
+.L285:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function jmparg */
+
+
+.text
+; function brcmp
+brcmp:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  or r0 r5 r6
+  write -12 r14 r4
+  add r4 12 r1
+  readh 0 r1 r2
+  load 1 r1
+  load 12 r3
+  bne r2 r3 .L290
+  add r4 8 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L290:
+  bne r1 r0 .L295
+  add r4 4 r1
+  read 0 r1 r1
+  add r4 8 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+  write -16 r14 r1
+  read 0 r1 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r4
+  add r14 -20 r5
+  savpc r15
+  add r15 12 r15
+  jump iscmp
+  or r0 r1 r3
+  read -16 r14 r1
+  read -12 r14 r4
+  load 1 r2
+  beq r3 r0 .L293
+  add r1 4 r1
+  add r4 12 r2
+  add r2 4 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -16 r14 r1
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L293:
+  beq r2 r0 .L296
+  load 0 r1
+  jump .L296
+.L295:
+  load 0 r1
+.L296:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function brcmp */
+
+
+.text
+; function blksz
+blksz:
+  add r4 8 r1
+  read 0 r1 r1
+  add r1 1 r1
+  addr2reg fr+16 r12
+  read 0 r12 r3
+  load 2 r2
+  add r2 r3 r2
+  addr2reg fr r12
+  read 0 r12 r3
+  xor r4 r3 r3
+  sltu r3 1 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  load 40 r2
+  mults r1 r2 r1
+  jumpr 0 r15
+
+/* end function blksz */
+
+.data
+.balign 1
+.Lstring.133:
+	.ascii "  %s %s %s .L%d\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.134:
+	.ascii "  %s %s %s 8\012  jump .L%d\012\000"
+/* end data */
+
+
+.text
+; function emitbr
+emitbr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 60 r13
+  write -52 r14 r8
+  read 20 r14 r1
+  write -32 r14 r1
+  read 16 r14 r2
+  write -36 r14 r2
+  read 12 r14 r8
+  write -20 r14 r8
+  read 8 r14 r3
+  write -48 r14 r3
+  write -40 r14 r6
+  write -44 r14 r5
+  or r0 r4 r5
+  or r0 r7 r4
+  write -16 r14 r5
+  shiftl r3 2 r1
+  add r8 r1 r1
+  read 0 r1 r2
+  add r4 48 r1
+  read 0 r1 r1
+  shiftl r1 2 r6
+  add r8 r6 r6
+  read 0 r6 r6
+  bgts r2 r6 .L305
+  shiftl r1 2 r1
+  add r8 r1 r1
+  read 0 r1 r1
+  write -12 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump blksz
+  or r0 r1 r2
+  read -12 r14 r1
+  read -20 r14 r8
+  read -48 r14 r3
+  read -44 r14 r7
+  read -16 r14 r5
+  add r1 r2 r4
+  write -24 r14 r4
+  read -36 r14 r2
+  read -40 r14 r1
+  shiftl r3 2 r4
+  add r8 r4 r6
+  read -24 r14 r4
+  read 0 r6 r6
+  sub r4 r6 r4
+  jump .L307
+.L305:
+  or r0 r1 r4
+  shiftl r3 2 r1
+  add r8 r1 r1
+  read 0 r1 r1
+  write -28 r14 r1
+  read -44 r14 r7
+  read -36 r14 r2
+  read -40 r14 r1
+  shiftl r4 2 r4
+  add r8 r4 r6
+  read -28 r14 r4
+  read 0 r6 r6
+  sub r4 r6 r4
+.L307:
+  load 32767 r6
+  slt r6 r4 r6
+  xor r6 1 r6
+  read -32 r14 r4
+  bne r6 r0 .L309
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump cmpneg
+  or r0 r1 r5
+  read -32 r14 r4
+  read -36 r14 r2
+  read -48 r14 r3
+  read -40 r14 r1
+  read -44 r14 r7
+  shiftl r5 2 r6
+  addr2reg brname r5
+  add r5 r6 r5
+  read 0 r5 r6
+  add r2 r3 r3
+  load 32 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 28 r5
+  write 0 r5 r3
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.134 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -32 r1
+  sub r13 r1 r13
+  jump .L310
+.L309:
+  shiftl r5 2 r6
+  addr2reg brname r5
+  add r5 r6 r5
+  read 0 r5 r6
+  add r2 r3 r3
+  load 32 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 28 r5
+  write 0 r5 r3
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.133 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -32 r1
+  sub r13 r1 r13
+.L310:
+  read -52 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitbr */
+
+
+.text
+; function isclob
+isclob:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  load 0 r1
+  beq r2 r0 .L315
+  or r0 r1 r2
+  jump .L316
+.L315:
+  read -4 r14 r1
+  shiftr r1 3 r1
+  slt r1 8 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L316:
+  load 0 r1
+  beq r2 r0 .L318
+  read -4 r14 r1
+  shiftr r1 3 r2
+  load 11 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L318:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function isclob */
+
+
+.text
+; function needframe
+needframe:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r4 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -16 r14 r4
+  load 1 r1
+  load 4 r3
+  beq r2 r3 .L323
+  add r4 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isclob
+  read -16 r14 r4
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L323:
+  bne r1 r0 .L345
+  add r4 4 r1
+  read 0 r1 r1
+.L325:
+  write -8 r14 r1
+  add r4 4 r2
+  read 0 r2 r2
+  add r4 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r2
+  bge r1 r2 .L344
+  read 0 r1 r2
+  shiftl r2 2 r3
+  shiftr r3 2 r4
+  load 1 r3
+  load 124 r5
+  beq r4 r5 .L328
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  xor r2 96 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L329
+.L328:
+  or r0 r3 r2
+.L329:
+  bne r2 r0 .L343
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -8 r14 r1
+  load 1 r2
+  load 4 r4
+  beq r3 r4 .L332
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isclob
+  or r0 r1 r2
+  read -8 r14 r1
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L332:
+  bne r2 r0 .L342
+  load 0 r2
+.L334:
+  write -12 r14 r2
+  load 2 r3
+  bges r2 r3 .L340
+  add r1 8 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r4
+  read -12 r14 r2
+  read -8 r14 r1
+  load 1 r3
+  load 4 r5
+  beq r4 r5 .L337
+  add r1 8 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isclob
+  or r0 r1 r3
+  read -12 r14 r2
+  read -8 r14 r1
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L337:
+  bne r3 r0 .L339
+  add r2 1 r2
+  jump .L334
+.L339:
+  load 1 r1
+  jump .L346
+.L340:
+  read -16 r14 r4
+  add r1 16 r1
+  jump .L325
+.L342:
+  load 1 r1
+  jump .L346
+.L343:
+  load 1 r1
+  jump .L346
+.L344:
+  load 0 r1
+  jump .L346
+.L345:
+  load 1 r1
+.L346:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function needframe */
+
+
+.text
+; function reach
+reach:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r6
+  write -4 r14 r5
+  write -12 r14 r4
+  load 1 r1
+  beq r4 r0 .L351
+  xor r4 r5 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L352
+.L351:
+  or r0 r1 r2
+.L352:
+  load 1 r1
+  bne r2 r0 .L354
+  add r4 48 r1
+  read 0 r1 r1
+  add r6 r1 r1
+  readb 0 r1 r1
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L354:
+  bne r1 r0 .L359
+  add r4 48 r1
+  read 0 r1 r1
+  add r6 r1 r2
+  load 1 r1
+  writeb 0 r2 r1
+  add r4 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump reach
+  read -8 r14 r6
+  read -4 r14 r5
+  read -12 r14 r4
+  add r4 24 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump reach
+  read -8 r14 r6
+  read -4 r14 r5
+  read -12 r14 r4
+  load 0 r1
+.L356:
+  write -16 r14 r1
+  add r4 32 r2
+  read 0 r2 r2
+  bge r1 r2 .L359
+  or r0 r1 r2
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump reach
+  read -16 r14 r1
+  read -8 r14 r6
+  read -4 r14 r5
+  read -12 r14 r4
+  add r1 1 r1
+  jump .L356
+.L359:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function reach */
+
+
+.text
+; function frameplan
+frameplan:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -32 r14 r4
+  add r4 28 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -32 r14 r4
+  addr2reg fr+4 r12
+  write 0 r12 r1
+  load 1 r1
+  addr2reg fr+8 r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg fr+12 r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump filldom
+  read -32 r14 r4
+  read 0 r4 r5
+  load 0 r1
+  or r0 r1 r2
+  or r0 r5 r1
+.L364:
+  write -28 r14 r1
+  write -20 r14 r2
+  beq r1 r0 .L381
+  or r0 r2 r3
+  add r1 4 r2
+  read 0 r2 r2
+.L367:
+  add r1 4 r5
+  read 0 r5 r5
+  add r1 8 r6
+  read 0 r6 r6
+  shiftl r6 4 r6
+  add r5 r6 r5
+  bge r2 r5 .L371
+  read 0 r2 r5
+  shiftl r5 2 r5
+  shiftr r5 2 r5
+  load 124 r6
+  bne r5 r6 .L370
+  load 0 r5
+  addr2reg fr+8 r12
+  write 0 r12 r5
+.L370:
+  add r2 16 r2
+  jump .L367
+.L371:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump needframe
+  or r0 r1 r3
+  read -28 r14 r1
+  or r0 r1 r2
+  read -20 r14 r1
+  beq r3 r0 .L379
+  or r0 r1 r3
+  beq r1 r0 .L374
+  or r0 r3 r1
+  jump .L375
+.L374:
+  or r0 r2 r1
+.L375:
+  write -24 r14 r1
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump dom
+  or r0 r1 r3
+  read -24 r14 r1
+  or r0 r1 r2
+  read -28 r14 r1
+  bne r3 r0 .L378
+  add r2 56 r2
+  read 0 r2 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L375
+.L378:
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L379:
+  add r2 44 r2
+  read 0 r2 r2
+  read -32 r14 r4
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L364
+.L381:
+  or r0 r2 r5
+  addr2reg hwstack r12
+  read 0 r12 r2
+  load 0 r1
+  beq r2 r0 .L384
+  addr2reg fr+8 r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L384:
+  addr2reg fr+16 r12
+  write 0 r12 r1
+  load 0 r2
+  addr2reg fr+20 r12
+  write 0 r12 r2
+  beq r1 r0 .L398
+  addr2reg b32p3_rclob r3
+  load 0 r2
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L387:
+  read 0 r3 r7
+  load 0 r5
+  bges r7 r0 .L389
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L391
+.L389:
+  or r0 r1 r2
+  slt r1 3 r1
+  xor r1 0 r1
+  sltu r0 r1 r5
+  or r0 r2 r1
+.L391:
+  beq r5 r0 .L397
+  add r4 44 r5
+  read 0 r5 r5
+  load 1 r6
+  shiftl r6 r7 r6
+  and r5 r6 r5
+  bne r5 r0 .L394
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L396
+.L394:
+  add r1 1 r1
+  addr2reg fr+20 r12
+  write 0 r12 r1
+  or r0 r1 r2
+.L396:
+  add r3 4 r3
+  jump .L387
+.L397:
+  read -20 r14 r5
+.L398:
+  addr2reg fr r12
+  write 0 r12 r5
+  add r4 52 r1
+  readb 0 r1 r1
+  bne r1 r0 .L400
+  or r0 r5 r1
+  jump .L401
+.L400:
+  read 0 r4 r1
+  addr2reg fr r12
+  write 0 r12 r1
+.L401:
+  beq r1 r0 .L424
+  read 0 r4 r2
+  beq r1 r2 .L420
+  add r5 20 r1
+  read 0 r1 r4
+  addr2reg fr+4 r12
+  read 0 r12 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump reach
+  read -20 r14 r5
+  add r5 24 r1
+  read 0 r1 r4
+  addr2reg fr+4 r12
+  read 0 r12 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump reach
+  read -20 r14 r5
+  load 0 r1
+  or r0 r1 r2
+  or r0 r5 r1
+.L405:
+  write -16 r14 r2
+  add r1 32 r3
+  read 0 r3 r3
+  bge r2 r3 .L409
+  or r0 r1 r3
+  add r1 28 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  addr2reg fr+4 r12
+  read 0 r12 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump reach
+  read -16 r14 r1
+  read -20 r14 r3
+  add r1 1 r1
+  or r0 r1 r2
+  or r0 r3 r1
+  jump .L405
+.L409:
+  or r0 r1 r5
+  read -32 r14 r4
+  addr2reg fr+4 r12
+  read 0 r12 r1
+  add r5 48 r2
+  read 0 r2 r2
+  add r1 r2 r3
+  readb 0 r3 r3
+  bne r3 r0 .L420
+  add r1 r2 r2
+  load 1 r1
+  writeb 0 r2 r1
+  add r4 28 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r2
+  read -20 r14 r5
+  read -32 r14 r4
+  write -12 r14 r2
+  read 0 r4 r4
+  or r0 r2 r6
+  savpc r15
+  add r15 12 r15
+  jump reach
+  read -12 r14 r2
+  read -32 r14 r4
+  read 0 r4 r1
+.L412:
+  beq r1 r0 .L424
+  add r1 48 r3
+  read 0 r3 r5
+  add r2 r5 r3
+  readb 0 r3 r6
+  load 0 r3
+  beq r6 r0 .L415
+  addr2reg fr+4 r12
+  read 0 r12 r3
+  add r3 r5 r3
+  readb 0 r3 r3
+  and r3 0xFF r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L415:
+  beq r3 r0 .L419
+  add r1 12 r3
+  readh 0 r3 r5
+  load 1 r3
+  load 10 r6
+  bne r5 r6 .L418
+  add r1 8 r3
+  read 0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L418:
+  bne r3 r0 .L420
+.L419:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L412
+.L420:
+  read 0 r4 r1
+  addr2reg fr r12
+  write 0 r12 r1
+  load 0 r1
+.L421:
+  add r4 28 r2
+  read 0 r2 r2
+  bge r1 r2 .L424
+  addr2reg fr+4 r12
+  read 0 r12 r2
+  add r2 r1 r3
+  load 1 r2
+  writeb 0 r3 r2
+  add r1 1 r1
+  jump .L421
+.L424:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function frameplan */
+
+
+.text
+; function fretblk
+fretblk:
+  load 0 r1
+  bne r5 r0 .L429
+  or r0 r1 r2
+  jump .L430
+.L429:
+  add r5 12 r1
+  readh 0 r1 r1
+  xor r1 10 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L430:
+  load 0 r1
+  bne r2 r0 .L432
+  or r0 r1 r2
+  jump .L433
+.L432:
+  addr2reg fr+4 r12
+  read 0 r12 r1
+  add r5 48 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  readb 0 r1 r1
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L433:
+  load 0 r1
+  beq r2 r0 .L435
+  addr2reg fr+4 r12
+  read 0 r12 r1
+  add r4 48 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  readb 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L435:
+  jumpr 0 r15
+
+/* end function fretblk */
+
+.data
+.balign 1
+.Lstring.141:
+	.ascii "  load32 0x1F000004 r12\012  read 0 r12 r12\012  push r14\012  sub r12 %d r12\012  blts r12 r0 16\012  savpc r12\012  add r12 12 r12\012  jump __hws_spill\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.142:
+	.ascii "  push %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.143:
+	.ascii "  add r15 %d r15\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.144:
+	.ascii "  push r15\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.145:
+	.ascii "  write 0 r13 r14\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.146:
+	.ascii "  write 4 r13 r15\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.147:
+	.ascii "  or r0 r13 r14\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.148:
+	.ascii "  write 8 r14 r4\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.149:
+	.ascii "  write 12 r14 r5\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.150:
+	.ascii "  write 16 r14 r6\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.151:
+	.ascii "  write 20 r14 r7\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.152:
+	.ascii "  sub r13 %d r13\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.153:
+	.ascii "  write -%d r14 %s\012\000"
+/* end data */
+
+
+.text
+; function emitpro
+emitpro:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 60 r13
+  write -52 r14 r8
+  write -48 r14 r4
+  or r0 r5 r4
+  write -40 r14 r4
+  addr2reg fr+16 r12
+  read 0 r12 r1
+  bne r1 r0 .L441
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.145 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -40 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg fr+8 r12
+  read 0 r12 r1
+  bne r1 r0 .L452
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.146 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -40 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L452
+.L441:
+  load 24 r1
+  sub r13 r1 r13
+  load 37 r6
+  addr2reg .Lstring.141 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -40 r14 r4
+  or r0 r4 r1
+  read -48 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  load 0 r3
+  addr2reg b32p3_rclob r2
+  or r0 r1 r5
+  or r0 r3 r1
+.L443:
+  write -44 r14 r1
+  write -36 r14 r2
+  addr2reg fr+20 r12
+  read 0 r12 r3
+  bges r1 r3 .L448
+  add r4 44 r3
+  read 0 r3 r6
+  read 0 r2 r3
+  load 1 r7
+  shiftl r7 r3 r7
+  and r6 r7 r6
+  beq r6 r0 .L447
+  or r0 r3 r1
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.142 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -44 r14 r1
+  read -36 r14 r2
+  read -40 r14 r5
+  read -48 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  add r1 1 r1
+.L447:
+  add r2 4 r2
+  jump .L443
+.L448:
+  or r0 r3 r6
+  or r0 r5 r4
+  beq r6 r0 .L451
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.143 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -40 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L451:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.144 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -40 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L452:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.147 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -40 r14 r4
+  or r0 r4 r1
+  read -48 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  add r4 52 r2
+  readb 0 r2 r2
+  beq r2 r0 .L455
+  or r0 r1 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.148 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -40 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.149 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -40 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.150 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -40 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.151 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -40 r14 r4
+  or r0 r4 r1
+  read -48 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L455:
+  add r4 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  addr2reg b32p3_rclob r3
+  or r0 r1 r5
+  or r0 r2 r1
+  or r0 r3 r2
+.L457:
+  read 0 r2 r7
+  blts r7 r0 .L461
+  add r4 44 r3
+  read 0 r3 r3
+  load 1 r6
+  shiftl r6 r7 r6
+  and r3 r6 r3
+  beq r3 r0 .L460
+  add r1 4 r1
+.L460:
+  add r2 4 r2
+  jump .L457
+.L461:
+  or r0 r1 r2
+  or r0 r5 r1
+  add r2 3 r2
+  load32 -4 r3
+  and r2 r3 r2
+  add r2 8 r6
+  bles r6 r0 .L465
+  or r0 r1 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.152 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -48 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L465:
+  load 4 r3
+  load 0 r2
+  addr2reg b32p3_rclob r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+.L467:
+  write -32 r14 r2
+  write -28 r14 r3
+  or r0 r1 r6
+  read 0 r3 r1
+  blts r1 r0 .L474
+  add r4 44 r3
+  read 0 r3 r3
+  load 1 r5
+  shiftl r5 r1 r5
+  and r3 r5 r8
+  write -12 r14 r8
+  read -28 r14 r3
+  read -40 r14 r5
+  load 0 r7
+  write -16 r14 r7
+  read -12 r14 r8
+  read -16 r14 r7
+  beq r8 r0 .L470
+  add r6 1 r7
+  write -20 r14 r7
+  addr2reg fr+20 r12
+  read 0 r12 r7
+  slt r6 r7 r7
+  read -20 r14 r6
+  xor r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L470:
+  write -24 r14 r6
+  bne r7 r0 .L472
+  or r0 r6 r1
+  jump .L473
+.L472:
+  add r4 48 r3
+  read 0 r3 r3
+  addr2reg fr+20 r12
+  read 0 r12 r4
+  add r3 r4 r3
+  shiftl r3 2 r3
+  add r2 r3 r6
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.153 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -24 r14 r1
+  read -32 r14 r2
+  read -28 r14 r3
+  read -40 r14 r5
+  read -48 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+  add r2 4 r2
+.L473:
+  add r3 4 r3
+  jump .L467
+.L474:
+  read -52 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitpro */
+
+.data
+.balign 1
+.Lstring.155:
+	.ascii "  read -%d r14 %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.156:
+	.ascii "  or r0 r14 r13\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.157:
+	.ascii "  pop r15\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.158:
+	.ascii "  pop %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.159:
+	.ascii "  pop r14\012  jumpr %d r15\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.160:
+	.ascii "  read 4 r14 r15\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.161:
+	.ascii "  read 0 r14 r14\012  jumpr 0 r15\012\000"
+/* end data */
+
+
+.text
+; function emitepi
+emitepi:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 60 r13
+  write -52 r14 r8
+  write -32 r14 r5
+  write -44 r14 r4
+  load 4 r3
+  load 0 r2
+  addr2reg b32p3_rclob r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+.L479:
+  write -48 r14 r2
+  write -8 r14 r1
+  write -40 r14 r3
+  or r0 r1 r6
+  read 0 r3 r1
+  blts r1 r0 .L486
+  add r4 44 r3
+  read 0 r3 r3
+  load 1 r5
+  shiftl r5 r1 r5
+  and r3 r5 r8
+  write -20 r14 r8
+  read -40 r14 r3
+  read -32 r14 r5
+  load 0 r7
+  write -24 r14 r7
+  read -20 r14 r8
+  read -24 r14 r7
+  beq r8 r0 .L482
+  add r6 1 r7
+  write -28 r14 r7
+  addr2reg fr+20 r12
+  read 0 r12 r7
+  slt r6 r7 r7
+  read -28 r14 r6
+  xor r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L482:
+  write -36 r14 r6
+  bne r7 r0 .L484
+  or r0 r6 r1
+  jump .L485
+.L484:
+  add r4 48 r3
+  read 0 r3 r3
+  addr2reg fr+20 r12
+  read 0 r12 r4
+  add r3 r4 r3
+  shiftl r3 2 r3
+  add r2 r3 r6
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.155 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -36 r14 r1
+  read -48 r14 r2
+  read -40 r14 r3
+  read -32 r14 r5
+  read -44 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+  add r2 4 r2
+.L485:
+  add r3 4 r3
+  jump .L479
+.L486:
+  read -32 r14 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.156 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg fr+16 r12
+  read 0 r12 r1
+  bne r1 r0 .L491
+  addr2reg fr+8 r12
+  read 0 r12 r1
+  bne r1 r0 .L490
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.160 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L490:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.161 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L501
+.L491:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.157 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -8 r14 r1
+  read -32 r14 r4
+  or r0 r4 r2
+  read -44 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  addr2reg b32p3_rclob+16 r3
+  or r0 r2 r5
+  or r0 r3 r2
+.L493:
+  or r0 r2 r3
+  load 4 r2
+  sub r3 r2 r2
+  write -16 r14 r2
+  addr2reg b32p3_rclob r6
+  ble r3 r6 .L499
+  add r4 44 r3
+  read 0 r3 r6
+  or r0 r1 r3
+  read 0 r2 r1
+  load 1 r7
+  shiftl r7 r1 r7
+  and r6 r7 r7
+  load 0 r6
+  beq r7 r0 .L496
+  load 1 r6
+  sub r3 r6 r3
+  addr2reg fr+20 r12
+  read 0 r12 r6
+  slt r3 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L496:
+  write -12 r14 r3
+  bne r6 r0 .L498
+  or r0 r3 r1
+  jump .L493
+.L498:
+  shiftl r1 2 r2
+  addr2reg rname r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.158 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r1
+  read -16 r14 r2
+  read -32 r14 r5
+  read -44 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  jump .L493
+.L499:
+  or r0 r5 r4
+  addr2reg fr+20 r12
+  read 0 r12 r1
+  sub r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.159 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+.L501:
+  read -52 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitepi */
+
+.data
+.balign 4
+.Lid0.163:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.164:
+	.ascii "\012.text\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.165:
+	.ascii "; function %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.166:
+	.ascii ".global %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.167:
+	.ascii "%s:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.168:
+	.ascii ".L%d:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.169:
+	.ascii "  halt\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.170:
+	.ascii "  jumpr 0 %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.171:
+	.ascii "  jumpr 0 r15\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.172:
+	.ascii "  jump .L%d\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.173:
+	.ascii ".L%d:\012  jumpr 0 r15\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.174:
+	.ascii "\012.rdata\012.balign 4\012.Ljt%d:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.175:
+	.ascii "  .int .L%d\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.176:
+	.ascii "\012\000"
+/* end data */
+
+
+.text
+; function b32p3_emitfn
+.global b32p3_emitfn
+b32p3_emitfn:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 92 r13
+  write -76 r14 r4
+  or r0 r5 r4
+  write -80 r14 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.164 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -80 r14 r4
+  read -76 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  add r2 54 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.165 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -80 r14 r4
+  read -76 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  add r2 136 r1
+  readb 0 r1 r1
+  beq r1 r0 .L506
+  add r2 54 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.166 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -80 r14 r4
+  read -76 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L506:
+  add r2 54 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.167 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -76 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump frameplan
+  read -80 r14 r4
+  read -76 r14 r2
+  addr2reg fr r12
+  read 0 r12 r1
+  read 0 r2 r3
+  bne r1 r3 .L508
+  or r0 r4 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump emitpro
+  read -76 r14 r2
+.L508:
+  add r2 28 r1
+  read 0 r1 r1
+  add r1 1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r3
+  read -76 r14 r2
+  write -64 r14 r3
+  read 0 r2 r1
+  load 0 r2
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L510:
+  write -68 r14 r2
+  write -72 r14 r3
+  beq r3 r0 .L513
+  add r3 48 r4
+  read 0 r4 r4
+  shiftl r4 2 r4
+  add r1 r4 r1
+  write 0 r1 r2
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump blksz
+  or r0 r1 r4
+  read -68 r14 r2
+  read -72 r14 r3
+  read -64 r14 r1
+  add r2 r4 r2
+  add r3 44 r3
+  read 0 r3 r3
+  jump .L510
+.L513:
+  or r0 r1 r3
+  or r0 r2 r1
+  read -76 r14 r2
+  add r2 28 r4
+  read 0 r4 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  add r2 28 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r3
+  read -80 r14 r4
+  read -76 r14 r2
+  write -60 r14 r3
+  read 0 r2 r1
+  or r0 r4 r5
+  or r0 r2 r4
+.L516:
+  beq r1 r0 .L522
+  load 0 r2
+.L518:
+  add r1 32 r6
+  read 0 r6 r6
+  bge r2 r6 .L521
+  add r1 28 r6
+  read 0 r6 r6
+  shiftl r2 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  add r3 r6 r7
+  load 1 r6
+  writeb 0 r7 r6
+  add r2 1 r2
+  jump .L518
+.L521:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L516
+.L522:
+  or r0 r4 r2
+  or r0 r5 r4
+  read 0 r2 r1
+  load 0 r5
+  or r0 r5 r6
+  or r0 r4 r5
+  or r0 r2 r4
+  or r0 r1 r2
+.L525:
+  write -56 r14 r2
+  beq r2 r0 .L595
+  load 1 r1
+  bne r6 r0 .L528
+  add r2 80 r1
+  read 0 r1 r6
+  load 1 r1
+  sltu r1 r6 r1
+  xor r1 0 r1
+  or r0 r3 r7
+  sltu r0 r1 r3
+  jump .L529
+.L528:
+  or r0 r3 r7
+  or r0 r1 r3
+.L529:
+  load 1 r1
+  bne r3 r0 .L531
+  add r2 48 r1
+  read 0 r1 r1
+  add r7 r1 r1
+  readb 0 r1 r1
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L531:
+  beq r1 r0 .L533
+  addr2reg .Lid0.163 r12
+  read 0 r12 r1
+  add r2 48 r2
+  read 0 r2 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.168 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -56 r14 r2
+  read -80 r14 r5
+  read -76 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L533:
+  addr2reg fr r12
+  read 0 r12 r3
+  load 0 r1
+  bne r2 r3 .L535
+  read 0 r4 r1
+  xor r2 r1 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L535:
+  beq r1 r0 .L537
+  savpc r15
+  add r15 12 r15
+  jump emitpro
+  read -56 r14 r2
+.L537:
+  addr2reg .Lid0.163 r12
+  read 0 r12 r1
+  add r2 48 r3
+  read 0 r3 r3
+  add r1 r3 r1
+  addr2reg jtlbl r12
+  write 0 r12 r1
+  add r14 -84 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump brcmp
+  or r0 r1 r3
+  read -56 r14 r2
+  read -80 r14 r5
+  read -76 r14 r4
+  write -48 r14 r3
+  add r2 4 r1
+  read 0 r1 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L539:
+  write -52 r14 r2
+  add r1 4 r6
+  read 0 r6 r6
+  add r1 8 r7
+  read 0 r7 r7
+  shiftl r7 4 r7
+  add r6 r7 r6
+  beq r2 r6 .L543
+  beq r2 r3 .L542
+  or r0 r5 r6
+  or r0 r4 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump emitins
+  read -52 r14 r2
+  read -56 r14 r1
+  read -48 r14 r3
+  read -80 r14 r5
+  read -76 r14 r4
+.L542:
+  add r2 16 r2
+  jump .L539
+.L543:
+  or r0 r1 r2
+  add r2 12 r1
+  readh 0 r1 r6
+  load 12 r1
+  xor r6 r1 r1
+  sltu r1 1 r1
+  write -24 r14 r1
+  read -60 r14 r7
+  read -64 r14 r1
+  read -24 r14 r12
+  bne r12 r0 .L568
+  or r0 r7 r3
+  load 12 r7
+  blt r6 r7 .L557
+  load 32 r7
+  beq r6 r7 .L556
+  load 32 r7
+  blt r6 r7 .L551
+  load 1 r6
+  jump .L594
+.L551:
+  load 31 r7
+  beq r6 r7 .L555
+  load 31 r7
+  blt r6 r7 .L554
+  load 1 r6
+  jump .L594
+.L554:
+  load 1 r6
+  jump .L594
+.L555:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.169 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -56 r14 r2
+  read -60 r14 r3
+  read -64 r14 r1
+  read -80 r14 r5
+  read -76 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+  load 1 r6
+  jump .L594
+.L556:
+  or r0 r5 r6
+  or r0 r4 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump jmparg
+  or r0 r1 r6
+  read -80 r14 r5
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.170 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -56 r14 r2
+  read -60 r14 r3
+  read -64 r14 r1
+  read -80 r14 r5
+  read -76 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+  load 1 r6
+  jump .L594
+.L557:
+  load 11 r7
+  beq r6 r7 .L588
+  load 11 r7
+  blt r6 r7 .L560
+  load 1 r6
+  jump .L594
+.L560:
+  load 10 r7
+  beq r6 r7 .L564
+  load 10 r7
+  blt r6 r7 .L563
+  load 1 r6
+  jump .L594
+.L563:
+  load 1 r6
+  jump .L594
+.L564:
+  addr2reg fr+4 r12
+  read 0 r12 r1
+  add r2 48 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  readb 0 r1 r1
+  bne r1 r0 .L566
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.171 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -56 r14 r2
+  read -60 r14 r3
+  read -64 r14 r1
+  read -80 r14 r5
+  read -76 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+  jump .L567
+.L566:
+  savpc r15
+  add r15 12 r15
+  jump emitepi
+  read -56 r14 r2
+  read -60 r14 r3
+  read -64 r14 r1
+  read -80 r14 r5
+  read -76 r14 r4
+.L567:
+  load 1 r6
+  jump .L594
+.L568:
+  bne r3 r0 .L571
+  or r0 r5 r6
+  or r0 r4 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump jmparg
+  or r0 r1 r5
+  load 1 r1
+  write -84 r14 r1
+  addr2reg .Lstring.97 r1
+  write -32 r14 r5
+  write -36 r14 r1
+  jump .L573
+.L571:
+  add r3 8 r1
+  add r1 0 r1
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump brarg
+  write -28 r14 r1
+  read -48 r14 r3
+  read -76 r14 r4
+  add r3 8 r1
+  add r1 4 r1
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump brarg
+  or r0 r1 r6
+  read -28 r14 r5
+  write -32 r14 r5
+  write -36 r14 r6
+.L573:
+  read -84 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump cmpneg
+  read -56 r14 r2
+  write -84 r14 r1
+  add r2 44 r1
+  read 0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump fretblk
+  read -56 r14 r2
+  bne r1 r0 .L575
+  add r2 44 r1
+  read 0 r1 r5
+  jump .L577
+.L575:
+  load 0 r1
+  or r0 r1 r5
+.L577:
+  add r2 24 r1
+  read 0 r1 r3
+  load 1 r1
+  beq r5 r3 .L582
+  add r2 20 r1
+  read 0 r1 r1
+  load 0 r4
+  bne r5 r1 .L580
+  or r0 r4 r1
+  jump .L581
+.L580:
+  add r1 116 r1
+  read 0 r1 r4
+  add r3 116 r1
+  read 0 r1 r1
+  slt r1 r4 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L581:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L582:
+  beq r1 r0 .L584
+  add r2 20 r1
+  read 0 r1 r1
+  add r2 20 r4
+  write 0 r4 r3
+  add r2 24 r2
+  write 0 r2 r1
+  read -84 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump cmpneg
+  read -56 r14 r2
+  write -84 r14 r1
+.L584:
+  add r2 24 r1
+  read 0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump fretblk
+  or r0 r1 r3
+  read -32 r14 r5
+  read -36 r14 r6
+  read -56 r14 r2
+  read -80 r14 r4
+  read -76 r14 r1
+  bne r3 r0 .L586
+  add r2 24 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r1
+  jump .L587
+.L586:
+  load 1 r3
+  addr2reg fr+12 r12
+  write 0 r12 r3
+  add r1 28 r1
+  read 0 r1 r1
+.L587:
+  read -84 r14 r3
+  write -44 r14 r3
+  addr2reg .Lid0.163 r12
+  read 0 r12 r3
+  write -40 r14 r3
+  load 24 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 20 r7
+  write 0 r7 r4
+  read -40 r14 r4
+  add r3 16 r7
+  write 0 r7 r4
+  read -64 r14 r4
+  add r3 12 r7
+  write 0 r7 r4
+  read -44 r14 r4
+  add r3 8 r3
+  write 0 r3 r1
+  or r0 r2 r7
+  savpc r15
+  add r15 12 r15
+  jump emitbr
+  read -56 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L588:
+  add r2 20 r1
+  read 0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump fretblk
+  or r0 r1 r6
+  read -56 r14 r2
+  read -60 r14 r3
+  read -64 r14 r1
+  read -80 r14 r5
+  read -76 r14 r4
+  bne r6 r0 .L593
+  add r2 20 r6
+  read 0 r6 r6
+  add r2 44 r7
+  read 0 r7 r7
+  bne r6 r7 .L591
+  load 0 r6
+  jump .L594
+.L591:
+  or r0 r6 r2
+  addr2reg .Lid0.163 r12
+  read 0 r12 r1
+  add r2 48 r2
+  read 0 r2 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.172 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -56 r14 r2
+  read -60 r14 r3
+  read -64 r14 r1
+  read -80 r14 r5
+  read -76 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+  load 1 r6
+  jump .L594
+.L593:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.171 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -56 r14 r2
+  read -60 r14 r3
+  read -64 r14 r1
+  read -80 r14 r5
+  read -76 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+  load 1 r6
+.L594:
+  add r2 44 r2
+  read 0 r2 r2
+  jump .L525
+.L595:
+  or r0 r4 r2
+  or r0 r5 r4
+  addr2reg fr+12 r12
+  read 0 r12 r1
+  beq r1 r0 .L598
+  addr2reg .Lid0.163 r12
+  read 0 r12 r1
+  add r2 28 r2
+  read 0 r2 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.173 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -80 r14 r4
+  read -76 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L598:
+  read 0 r2 r1
+  or r0 r4 r5
+.L600:
+  write -16 r14 r1
+  beq r1 r0 .L607
+  add r1 12 r2
+  readh 0 r2 r2
+  load 32 r3
+  bne r2 r3 .L606
+  or r0 r1 r2
+  addr2reg .Lid0.163 r12
+  read 0 r12 r1
+  add r2 48 r2
+  read 0 r2 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.174 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r1
+  read -80 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+  load 0 r2
+.L603:
+  write -20 r14 r2
+  add r1 40 r3
+  read 0 r3 r3
+  bge r2 r3 .L606
+  or r0 r1 r3
+  addr2reg .Lid0.163 r12
+  read 0 r12 r1
+  or r0 r2 r4
+  add r3 28 r2
+  read 0 r2 r2
+  add r3 36 r3
+  read 0 r3 r3
+  shiftl r4 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 48 r2
+  read 0 r2 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.175 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -20 r14 r2
+  read -16 r14 r1
+  read -80 r14 r5
+  load32 -24 r3
+  sub r13 r3 r13
+  add r2 1 r2
+  jump .L603
+.L606:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L600
+.L607:
+  or r0 r5 r4
+  read -76 r14 r2
+  addr2reg .Lid0.163 r12
+  read 0 r12 r1
+  add r2 28 r2
+  read 0 r2 r2
+  add r2 1 r2
+  add r1 r2 r1
+  addr2reg .Lid0.163 r12
+  write 0 r12 r1
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.176 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function b32p3_emitfn */
+
+
+.text
+; function b32p3_emitfin
+.global b32p3_emitfin
+b32p3_emitfin:
+  jumpr 0 r15
+
+/* end function b32p3_emitfin */
+
+.data
+.balign 4
+jtlbl:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+fr:
+	.fill 24,1,0
+/* end data */
+
@@ -0,0 +1,2071 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+.data
+.balign 4
+.Lz.8:
+	.fill 204,1,0
+/* end data */
+
+
+.text
+; function newblk
+.global newblk
+newblk:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 204 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  addr2reg .Lz.8 r12
+  read 0 r12 r2
+  write 0 r1 r2
+  add r1 4 r2
+  addr2reg .Lz.8+4 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+8 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+12 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+16 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+20 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+24 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+28 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+32 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+36 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+40 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+44 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+48 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+52 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+56 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+60 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+64 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+68 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+72 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+76 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+80 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+84 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+88 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+92 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+96 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+100 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+104 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+108 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+112 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+116 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+120 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+124 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+128 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+132 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+136 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+140 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+144 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+148 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+152 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+156 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+160 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+164 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+168 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+172 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+176 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+180 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+184 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+188 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+192 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r2
+  addr2reg .Lz.8+196 r12
+  read 0 r12 r3
+  write 0 r2 r3
+  add r2 4 r3
+  addr2reg .Lz.8+200 r12
+  read 0 r12 r2
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function newblk */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "a+1<p->narg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "BuildTools/QBE/cfg.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "a+1<bd->npred\000"
+/* end data */
+
+
+.text
+; function edgedel
+.global edgedel
+edgedel:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -20 r14 r4
+  read 0 r5 r1
+  write -32 r14 r1
+  add r4 20 r2
+  read 0 r2 r2
+  add r4 24 r3
+  read 0 r3 r3
+  xor r2 r3 r2
+  sltu r2 1 r3
+  load 1 r2
+  add r2 r3 r3
+  load 0 r2
+  write 0 r5 r2
+  load 1 r2
+  beq r1 r0 .L23
+  load 1 r2
+  slt r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L23:
+  bne r2 r0 .L41
+  read 0 r1 r1
+.L25:
+  write -24 r14 r1
+  beq r1 r0 .L33
+  load 0 r2
+.L27:
+  write -28 r14 r2
+  add r1 8 r3
+  read 0 r3 r3
+  shiftl r2 2 r5
+  add r3 r5 r5
+  read 0 r5 r5
+  beq r5 r4 .L31
+  add r2 1 r3
+  add r1 12 r5
+  read 0 r5 r5
+  blt r3 r5 .L30
+  load 29 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r2
+  read -24 r14 r1
+  read -20 r14 r4
+.L30:
+  add r2 1 r2
+  jump .L27
+.L31:
+  add r1 12 r4
+  read 0 r4 r1
+  load 1 r5
+  sub r1 r5 r1
+  write 0 r4 r1
+  shiftl r2 2 r4
+  add r3 r4 r4
+  add r2 1 r5
+  shiftl r5 2 r5
+  add r3 r5 r5
+  sub r1 r2 r1
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memmove
+  read -28 r14 r2
+  read -24 r14 r1
+  add r1 4 r3
+  read 0 r3 r3
+  shiftl r2 2 r4
+  add r3 r4 r4
+  add r2 1 r5
+  shiftl r5 2 r5
+  add r3 r5 r5
+  add r1 12 r1
+  read 0 r1 r1
+  sub r1 r2 r1
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memmove
+  read -24 r14 r1
+  read -20 r14 r4
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L25
+.L33:
+  read -32 r14 r1
+  add r1 80 r2
+  read 0 r2 r2
+  beq r2 r0 .L41
+  load 0 r2
+.L36:
+  write -16 r14 r2
+  add r1 76 r3
+  read 0 r3 r3
+  shiftl r2 2 r5
+  add r3 r5 r5
+  read 0 r5 r5
+  beq r5 r4 .L40
+  add r2 1 r3
+  add r1 80 r5
+  read 0 r5 r5
+  blt r3 r5 .L39
+  load 38 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r2
+  read -32 r14 r1
+  read -20 r14 r4
+.L39:
+  add r2 1 r2
+  jump .L36
+.L40:
+  add r1 80 r4
+  read 0 r4 r1
+  load 1 r5
+  sub r1 r5 r1
+  write 0 r4 r1
+  shiftl r2 2 r4
+  add r3 r4 r4
+  add r2 1 r5
+  shiftl r5 2 r5
+  add r3 r5 r5
+  sub r1 r2 r1
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memmove
+.L41:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function edgedel */
+
+
+.text
+; function jtabdel
+.global jtabdel
+jtabdel:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r5
+  write -12 r14 r4
+  load 0 r1
+.L45:
+  write -16 r14 r1
+  add r4 32 r2
+  read 0 r2 r2
+  bge r1 r2 .L50
+  or r0 r1 r2
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  read 0 r3 r3
+  bne r3 r5 .L48
+  or r0 r2 r1
+  jump .L49
+.L48:
+  shiftl r2 2 r2
+  add r1 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump edgedel
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+.L49:
+  add r1 1 r1
+  jump .L45
+.L50:
+  add r4 32 r2
+  load 0 r1
+  write 0 r2 r1
+  add r4 40 r2
+  load 0 r1
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function jtabdel */
+
+
+.text
+; function succlist
+.global succlist
+succlist:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r4 32 r1
+  read 0 r1 r2
+  load 3 r1
+  add r1 r2 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -16 r14 r4
+  write -12 r14 r1
+  add r4 20 r2
+  read 0 r2 r2
+  load 0 r3
+  bne r2 r0 .L56
+  or r0 r3 r5
+  jump .L58
+.L56:
+  add r1 0 r3
+  write 0 r3 r2
+  load 1 r2
+  or r0 r2 r5
+.L58:
+  add r4 24 r3
+  or r0 r4 r2
+  read 0 r3 r4
+  load 0 r3
+  beq r4 r0 .L60
+  add r2 20 r3
+  read 0 r3 r3
+  xor r4 r3 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L60:
+  bne r3 r0 .L62
+  or r0 r5 r4
+  jump .L64
+.L62:
+  add r5 1 r3
+  shiftl r5 2 r5
+  add r1 r5 r5
+  write 0 r5 r4
+  or r0 r3 r4
+.L64:
+  write -8 r14 r4
+  or r0 r1 r3
+  add r2 32 r1
+  read 0 r1 r1
+  bne r1 r0 .L66
+  or r0 r3 r1
+  or r0 r4 r12
+  or r0 r2 r4
+  or r0 r12 r2
+  jump .L67
+.L66:
+  shiftl r4 2 r4
+  add r3 r4 r4
+  add r2 28 r2
+  read 0 r2 r5
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -8 r14 r2
+  read -12 r14 r1
+  read -16 r14 r4
+.L67:
+  add r4 32 r3
+  read 0 r3 r3
+  add r2 r3 r2
+  shiftl r2 2 r2
+  add r1 r2 r3
+  load 0 r2
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function succlist */
+
+
+.text
+; function addpred
+addpred:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r5
+  write -12 r14 r4
+  add r5 76 r1
+  read 0 r1 r1
+  bne r1 r0 .L73
+  add r5 80 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -16 r14 r5
+  read -12 r14 r4
+  add r5 76 r2
+  write 0 r2 r1
+  add r5 52 r3
+  load 0 r2
+  write 0 r3 r2
+.L73:
+  add r5 52 r5
+  read 0 r5 r2
+  add r2 1 r3
+  write 0 r5 r3
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r4
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function addpred */
+
+
+.text
+; function fillpreds
+.global fillpreds
+fillpreds:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  read 0 r4 r1
+.L78:
+  beq r1 r0 .L81
+  add r1 80 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 76 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L78
+.L81:
+  read 0 r4 r1
+.L82:
+  beq r1 r0 .L94
+  add r1 20 r2
+  read 0 r2 r2
+  beq r2 r0 .L85
+  add r2 80 r3
+  read 0 r3 r2
+  add r2 1 r2
+  write 0 r3 r2
+.L85:
+  add r1 24 r2
+  read 0 r2 r2
+  load 0 r3
+  beq r2 r0 .L87
+  add r1 20 r3
+  read 0 r3 r3
+  xor r2 r3 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L87:
+  beq r3 r0 .L89
+  add r2 80 r3
+  read 0 r3 r2
+  add r2 1 r2
+  write 0 r3 r2
+.L89:
+  load 0 r2
+.L90:
+  add r1 32 r3
+  read 0 r3 r3
+  bge r2 r3 .L93
+  add r1 28 r3
+  read 0 r3 r3
+  shiftl r2 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  add r3 80 r5
+  read 0 r5 r3
+  add r3 1 r3
+  write 0 r5 r3
+  add r2 1 r2
+  jump .L90
+.L93:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L82
+.L94:
+  read 0 r4 r1
+.L95:
+  write -16 r14 r1
+  beq r1 r0 .L107
+  add r1 20 r2
+  read 0 r2 r5
+  beq r5 r0 .L98
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump addpred
+  read -16 r14 r1
+.L98:
+  add r1 24 r2
+  read 0 r2 r5
+  load 0 r2
+  beq r5 r0 .L100
+  add r1 20 r2
+  read 0 r2 r2
+  xor r5 r2 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L100:
+  beq r2 r0 .L102
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump addpred
+  read -16 r14 r1
+.L102:
+  load 0 r2
+.L103:
+  write -12 r14 r2
+  add r1 32 r3
+  read 0 r3 r3
+  bge r2 r3 .L106
+  or r0 r2 r3
+  add r1 28 r2
+  read 0 r2 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump addpred
+  read -12 r14 r2
+  read -16 r14 r1
+  add r2 1 r2
+  jump .L103
+.L106:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L95
+.L107:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function fillpreds */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "x != -1u\000"
+/* end data */
+
+
+.text
+; function rporec
+rporec:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  or r0 r5 r1
+  write -20 r14 r4
+  load 1 r2
+  beq r4 r0 .L112
+  add r4 48 r2
+  read 0 r2 r2
+  load32 -1 r3
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L112:
+  bne r2 r0 .L130
+  add r4 48 r3
+  load 1 r2
+  write 0 r3 r2
+  add r4 20 r2
+  read 0 r2 r2
+  add r4 24 r3
+  read 0 r3 r3
+  load 0 r5
+  bne r2 r0 .L115
+  or r0 r5 r6
+  jump .L116
+.L115:
+  xor r3 0 r5
+  sltu r0 r5 r6
+.L116:
+  load 0 r5
+  beq r6 r0 .L118
+  add r2 116 r5
+  read 0 r5 r6
+  add r3 116 r5
+  read 0 r5 r5
+  slt r5 r6 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L118:
+  bne r5 r0 .L120
+  write -28 r14 r2
+  write -32 r14 r3
+  jump .L121
+.L120:
+  write -28 r14 r3
+  write -32 r14 r2
+.L121:
+  add r4 32 r2
+  read 0 r2 r2
+  or r0 r1 r5
+  or r0 r2 r1
+.L123:
+  write -24 r14 r1
+  ble r1 r0 .L126
+  or r0 r1 r2
+  add r4 28 r1
+  read 0 r1 r1
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rporec
+  or r0 r1 r5
+  read -24 r14 r1
+  read -20 r14 r4
+  load 1 r2
+  sub r1 r2 r1
+  jump .L123
+.L126:
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rporec
+  or r0 r1 r5
+  read -32 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rporec
+  read -20 r14 r4
+  write -16 r14 r1
+  add r4 48 r2
+  write 0 r2 r1
+  load32 -1 r2
+  bne r1 r2 .L129
+  load 136 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.18 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+.L129:
+  load 1 r2
+  sub r1 r2 r1
+.L130:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rporec */
+
+
+.text
+; function fillrpo
+.global fillrpo
+fillrpo:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r4
+  read 0 r4 r1
+.L134:
+  beq r1 r0 .L137
+  add r1 48 r3
+  load32 -1 r2
+  write 0 r3 r2
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L134
+.L137:
+  or r0 r4 r1
+  read 0 r4 r4
+  add r1 28 r1
+  read 0 r1 r1
+  load 1 r2
+  sub r1 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump rporec
+  or r0 r1 r2
+  read -8 r14 r4
+  load 1 r1
+  add r1 r2 r2
+  write -4 r14 r2
+  or r0 r2 r1
+  add r4 28 r2
+  read 0 r2 r3
+  sub r3 r1 r1
+  write 0 r2 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -4 r14 r2
+  read -8 r14 r4
+  add r4 40 r3
+  write 0 r3 r1
+  or r0 r4 r1
+.L139:
+  write -12 r14 r1
+  read 0 r1 r3
+  write -16 r14 r3
+  beq r3 r0 .L143
+  add r3 48 r1
+  read 0 r1 r5
+  load32 -1 r1
+  beq r5 r1 .L142
+  add r3 48 r1
+  sub r5 r2 r5
+  write 0 r1 r5
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r5 2 r5
+  add r1 r5 r1
+  write 0 r1 r3
+  add r3 44 r1
+  jump .L139
+.L142:
+  add r3 20 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump edgedel
+  read -16 r14 r3
+  add r3 24 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump edgedel
+  read -16 r14 r3
+  load 0 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump jtabdel
+  read -12 r14 r4
+  read -16 r14 r3
+  read -4 r14 r2
+  or r0 r4 r1
+  read -8 r14 r4
+  add r3 44 r3
+  read 0 r3 r3
+  write 0 r1 r3
+  jump .L139
+.L143:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function fillrpo */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "b1\000"
+/* end data */
+
+
+.text
+; function inter
+inter:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r5 r1
+  or r0 r4 r2
+  beq r2 r0 .L158
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L148:
+  beq r1 r2 .L158
+  add r1 48 r3
+  read 0 r3 r3
+  add r2 48 r4
+  read 0 r4 r4
+  blt r3 r4 .L151
+  or r0 r2 r5
+  jump .L152
+.L151:
+  or r0 r1 r5
+  or r0 r2 r1
+.L152:
+  write -12 r14 r5
+.L153:
+  add r1 48 r2
+  read 0 r2 r2
+  add r5 48 r3
+  read 0 r3 r3
+  ble r2 r3 .L157
+  add r1 56 r2
+  or r0 r5 r1
+  read 0 r2 r5
+  write -16 r14 r5
+  bne r5 r0 .L156
+  load 186 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.21 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r5
+  or r0 r5 r1
+  read -16 r14 r5
+.L156:
+  or r0 r1 r12
+  or r0 r5 r1
+  or r0 r12 r5
+  jump .L153
+.L157:
+  or r0 r5 r2
+  jump .L148
+.L158:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function inter */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "d != b\000"
+/* end data */
+
+
+.text
+; function filldom
+.global filldom
+filldom:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -16 r14 r4
+  read 0 r4 r1
+.L162:
+  bne r1 r0 .L190
+.L163:
+  load 0 r2
+  load 1 r1
+  write -28 r14 r2
+  or r0 r1 r2
+.L165:
+  write -32 r14 r2
+  add r4 28 r1
+  read 0 r1 r1
+  bge r2 r1 .L180
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  write -20 r14 r5
+  load 0 r2
+  load 0 r1
+  or r0 r1 r3
+  or r0 r5 r1
+.L168:
+  write -24 r14 r3
+  add r1 80 r5
+  read 0 r5 r5
+  bge r3 r5 .L175
+  add r1 76 r5
+  read 0 r5 r5
+  shiftl r3 2 r6
+  add r5 r6 r6
+  read 0 r6 r6
+  add r6 56 r6
+  read 0 r6 r7
+  load 1 r6
+  bne r7 r0 .L171
+  shiftl r3 2 r6
+  add r5 r6 r6
+  read 0 r6 r6
+  read 0 r4 r7
+  xor r6 r7 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L171:
+  beq r6 r0 .L174
+  or r0 r5 r1
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump inter
+  or r0 r1 r2
+  read -24 r14 r3
+  read -20 r14 r1
+  read -16 r14 r4
+.L174:
+  add r3 1 r3
+  jump .L168
+.L175:
+  or r0 r2 r3
+  read -32 r14 r2
+  or r0 r1 r5
+  read -28 r14 r1
+  add r5 56 r6
+  read 0 r6 r6
+  beq r3 r6 .L178
+  add r1 1 r1
+  add r5 56 r5
+  write 0 r5 r3
+.L178:
+  add r2 1 r2
+  write -28 r14 r1
+  jump .L165
+.L180:
+  read -28 r14 r1
+  bne r1 r0 .L163
+  read 0 r4 r1
+.L183:
+  write -12 r14 r1
+  beq r1 r0 .L189
+  add r1 56 r2
+  read 0 r2 r2
+  write -8 r14 r2
+  beq r2 r0 .L188
+  bne r2 r1 .L187
+  load 221 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.23 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r1
+  read -8 r14 r2
+.L187:
+  add r2 60 r3
+  read 0 r3 r3
+  add r1 64 r4
+  write 0 r4 r3
+  add r2 60 r2
+  write 0 r2 r1
+.L188:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L183
+.L189:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L190:
+  add r1 56 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 60 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 64 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L162
+
+/* end function filldom */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "b1 && b2\000"
+/* end data */
+
+
+.text
+; function sdom
+.global sdom
+sdom:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  load 0 r1
+  beq r4 r0 .L196
+  xor r5 0 r1
+  sltu r0 r1 r1
+.L196:
+  bne r1 r0 .L198
+  load 230 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.25 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r5
+  read -16 r14 r4
+.L198:
+  beq r4 r5 .L202
+.L199:
+  add r5 48 r1
+  read 0 r1 r1
+  add r4 48 r2
+  read 0 r2 r2
+  ble r1 r2 .L201
+  add r5 56 r1
+  read 0 r1 r5
+  jump .L199
+.L201:
+  xor r4 r5 r1
+  sltu r1 1 r1
+  jump .L203
+.L202:
+  load 0 r1
+.L203:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function sdom */
+
+
+.text
+; function dom
+.global dom
+dom:
+  load 1 r1
+  beq r4 r5 .L209
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  savpc r15
+  add r15 12 r15
+  jump sdom
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L208:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L209:
+  jumpr 0 r15
+
+/* end function dom */
+
+
+.text
+; function addfron
+addfron:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  load 0 r1
+.L212:
+  add r4 72 r2
+  read 0 r2 r2
+  bge r1 r2 .L215
+  add r4 68 r2
+  read 0 r2 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  beq r2 r5 .L219
+  add r1 1 r1
+  jump .L212
+.L215:
+  beq r2 r0 .L217
+  or r0 r4 r1
+  add r4 68 r4
+  add r1 72 r1
+  add r2 1 r5
+  write 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -12 r14 r5
+  read -16 r14 r4
+  jump .L218
+.L217:
+  add r4 72 r1
+  add r2 1 r4
+  write 0 r1 r4
+  load 1 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -12 r14 r5
+  read -16 r14 r4
+  add r4 68 r2
+  write 0 r2 r1
+.L218:
+  add r4 68 r1
+  read 0 r1 r1
+  add r4 72 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+.L219:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function addfron */
+
+
+.text
+; function fillfron
+.global fillfron
+fillfron:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  read 0 r4 r1
+.L223:
+  beq r1 r0 .L226
+  add r1 72 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L223
+.L226:
+  read 0 r4 r2
+.L227:
+  write -32 r14 r2
+  beq r2 r0 .L251
+  add r2 20 r1
+  read 0 r1 r1
+  beq r1 r0 .L235
+  or r0 r2 r1
+.L230:
+  write -28 r14 r2
+  add r1 20 r1
+  read 0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump sdom
+  or r0 r1 r3
+  read -28 r14 r2
+  read -32 r14 r1
+  bne r3 r0 .L234
+  add r1 20 r1
+  read 0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump addfron
+  read -28 r14 r2
+  or r0 r2 r1
+  read -32 r14 r2
+  add r1 56 r1
+  read 0 r1 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L230
+.L234:
+  or r0 r1 r2
+.L235:
+  add r2 24 r1
+  read 0 r1 r1
+  beq r1 r0 .L241
+  or r0 r2 r1
+.L237:
+  write -24 r14 r2
+  add r1 24 r1
+  read 0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump sdom
+  or r0 r1 r3
+  read -24 r14 r2
+  read -32 r14 r1
+  bne r3 r0 .L240
+  add r1 24 r1
+  read 0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump addfron
+  read -24 r14 r2
+  read -32 r14 r1
+  add r2 56 r2
+  read 0 r2 r2
+  jump .L237
+.L240:
+  or r0 r1 r2
+.L241:
+  or r0 r2 r1
+  load 0 r2
+.L242:
+  write -16 r14 r2
+  add r1 32 r3
+  read 0 r3 r3
+  bge r2 r3 .L250
+  or r0 r2 r3
+  or r0 r1 r2
+.L244:
+  write -20 r14 r1
+  add r2 28 r2
+  read 0 r2 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sdom
+  or r0 r1 r4
+  read -20 r14 r1
+  read -16 r14 r2
+  or r0 r2 r3
+  read -32 r14 r2
+  bne r4 r0 .L248
+  add r2 28 r2
+  read 0 r2 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump addfron
+  read -20 r14 r1
+  read -16 r14 r2
+  or r0 r1 r3
+  read -32 r14 r1
+  add r3 56 r3
+  read 0 r3 r3
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L244
+.L248:
+  or r0 r2 r1
+  or r0 r3 r2
+  or r0 r2 r3
+  add r2 1 r2
+  jump .L242
+.L250:
+  add r1 44 r1
+  read 0 r1 r2
+  jump .L227
+.L251:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function fillfron */
+
+
+.text
+; function loopmark
+loopmark:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -4 r14 r6
+  write -12 r14 r5
+  write -8 r14 r4
+  add r5 48 r1
+  read 0 r1 r3
+  add r4 48 r1
+  read 0 r1 r1
+  load 1 r2
+  blt r3 r1 .L256
+  add r5 52 r2
+  read 0 r2 r2
+  xor r2 r1 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L256:
+  bne r2 r0 .L261
+  add r5 52 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r6
+  read -4 r14 r6
+  read -12 r14 r5
+  read -8 r14 r4
+  load 0 r1
+.L258:
+  write -16 r14 r1
+  add r5 80 r2
+  read 0 r2 r2
+  bge r1 r2 .L261
+  or r0 r1 r2
+  add r5 76 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump loopmark
+  read -16 r14 r1
+  read -4 r14 r6
+  read -12 r14 r5
+  read -8 r14 r4
+  add r1 1 r1
+  jump .L258
+.L261:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function loopmark */
+
+
+.text
+; function loopiter
+.global loopiter
+loopiter:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -16 r14 r5
+  write -32 r14 r4
+  read 0 r4 r1
+.L265:
+  beq r1 r0 .L268
+  add r1 52 r3
+  load32 -1 r2
+  write 0 r3 r2
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L265
+.L268:
+  load 0 r1
+  or r0 r1 r3
+.L270:
+  write -20 r14 r3
+  add r4 28 r1
+  read 0 r1 r1
+  bge r3 r1 .L279
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -24 r14 r1
+  load 0 r2
+.L272:
+  write -28 r14 r2
+  or r0 r3 r4
+  add r1 80 r3
+  read 0 r3 r3
+  bge r2 r3 .L277
+  or r0 r2 r3
+  add r1 76 r2
+  read 0 r2 r2
+  shiftl r3 2 r6
+  add r2 r6 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  bge r6 r4 .L275
+  or r0 r3 r2
+  or r0 r4 r3
+  jump .L276
+.L275:
+  shiftl r3 2 r3
+  add r2 r3 r3
+  or r0 r5 r2
+  read 0 r3 r5
+  or r0 r2 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump loopmark
+  read -28 r14 r2
+  read -20 r14 r3
+  read -24 r14 r1
+  read -16 r14 r5
+.L276:
+  add r2 1 r2
+  jump .L272
+.L277:
+  or r0 r4 r3
+  read -32 r14 r4
+  add r3 1 r3
+  jump .L270
+.L279:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function loopiter */
+
+
+.text
+; function multloop
+.global multloop
+multloop:
+  add r5 116 r2
+  read 0 r2 r1
+  load 10 r3
+  mults r1 r3 r1
+  write 0 r2 r1
+  jumpr 0 r15
+
+/* end function multloop */
+
+
+.text
+; function fillloop
+.global fillloop
+fillloop:
+  read 0 r4 r1
+.L287:
+  beq r1 r0 .L290
+  add r1 116 r3
+  load 1 r2
+  write 0 r3 r2
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L287
+.L290:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg multloop r5
+  savpc r15
+  add r15 12 r15
+  jump loopiter
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function fillloop */
+
+
+.text
+; function uffind
+uffind:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+  read 0 r4 r1
+  add r1 48 r1
+  read 0 r1 r1
+  shiftl r1 2 r1
+  add r5 r1 r1
+  write -16 r14 r1
+  read 0 r1 r2
+  beq r2 r0 .L296
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump uffind
+  read -16 r14 r1
+  read -12 r14 r4
+  read 0 r1 r1
+  write 0 r4 r1
+.L296:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function uffind */
+
+
+.text
+; function jtabuniq
+jtabuniq:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -4 r14 r4
+  add r4 32 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -8 r14 r1
+  read -4 r14 r4
+  load 0 r2
+  load 0 r1
+  or r0 r2 r3
+  or r0 r1 r2
+.L301:
+  add r4 32 r1
+  read 0 r1 r1
+  bge r3 r1 .L313
+  load 0 r1
+.L303:
+  bge r1 r2 .L307
+  add r4 28 r5
+  read 0 r5 r6
+  shiftl r1 2 r5
+  add r6 r5 r5
+  read 0 r5 r5
+  shiftl r3 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  beq r5 r6 .L306
+  add r1 1 r1
+  jump .L303
+.L306:
+  or r0 r1 r5
+  read -8 r14 r1
+  jump .L308
+.L307:
+  or r0 r1 r5
+  read -8 r14 r1
+.L308:
+  or r0 r2 r7
+  beq r5 r2 .L310
+  or r0 r7 r2
+  jump .L311
+.L310:
+  add r4 28 r1
+  read 0 r1 r2
+  shiftl r3 2 r1
+  add r2 r1 r1
+  read 0 r1 r6
+  write -12 r14 r6
+  read -8 r14 r1
+  add r7 1 r6
+  write -16 r14 r6
+  read -12 r14 r6
+  shiftl r7 2 r7
+  add r2 r7 r7
+  read -16 r14 r2
+  write 0 r7 r6
+.L311:
+  shiftl r3 2 r6
+  add r1 r6 r6
+  write 0 r6 r5
+  add r3 1 r3
+  jump .L301
+.L313:
+  read -8 r14 r1
+  add r4 32 r3
+  write 0 r3 r2
+  load 0 r2
+.L315:
+  add r4 40 r3
+  read 0 r3 r3
+  bge r2 r3 .L318
+  add r4 36 r3
+  read 0 r3 r5
+  shiftl r2 2 r3
+  add r5 r3 r3
+  read 0 r3 r3
+  shiftl r3 2 r3
+  add r1 r3 r3
+  read 0 r3 r3
+  shiftl r2 2 r6
+  add r5 r6 r5
+  write 0 r5 r3
+  add r2 1 r2
+  jump .L315
+.L318:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function jtabuniq */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "!b->phi\000"
+/* end data */
+
+
+.text
+; function simpljmp
+.global simpljmp
+simpljmp:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -32 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump newblk
+  or r0 r1 r2
+  read -32 r14 r1
+  write -20 r14 r2
+  add r1 28 r5
+  read 0 r5 r3
+  add r3 1 r4
+  write 0 r5 r4
+  add r2 48 r4
+  write 0 r4 r3
+  add r2 12 r3
+  load 10 r2
+  writeh 0 r3 r2
+  add r1 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r4
+  read -20 r14 r2
+  read -32 r14 r1
+  write -28 r14 r4
+  read 0 r1 r1
+  or r0 r4 r3
+.L323:
+  write -24 r14 r1
+  beq r1 r0 .L333
+  read 0 r1 r4
+  beq r4 r0 .L326
+  load 373 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.36 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -24 r14 r1
+  read -28 r14 r3
+  read -20 r14 r2
+.L326:
+  add r1 12 r4
+  readh 0 r4 r4
+  load 10 r5
+  bne r4 r5 .L328
+  add r1 12 r5
+  load 11 r4
+  writeh 0 r5 r4
+  add r1 20 r4
+  write 0 r4 r2
+  load 11 r4
+.L328:
+  add r1 8 r5
+  read 0 r5 r5
+  bne r5 r0 .L332
+  shiftl r4 16 r4
+  shiftrs r4 16 r4
+  load 11 r5
+  bne r4 r5 .L332
+  add r1 20 r4
+  or r0 r3 r5
+  savpc r15
+  add r15 12 r15
+  jump uffind
+  read -24 r14 r1
+  read -28 r14 r3
+  read -20 r14 r2
+  add r1 20 r4
+  read 0 r4 r4
+  beq r4 r1 .L332
+  add r1 48 r5
+  read 0 r5 r5
+  shiftl r5 2 r5
+  add r3 r5 r5
+  write 0 r5 r4
+.L332:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L323
+.L333:
+  or r0 r3 r4
+  read -32 r14 r1
+  or r0 r4 r3
+  or r0 r1 r4
+.L335:
+  read 0 r4 r1
+  write -12 r14 r1
+  beq r1 r0 .L352
+  add r1 20 r2
+  read 0 r2 r2
+  beq r2 r0 .L338
+  add r1 20 r4
+  or r0 r3 r5
+  savpc r15
+  add r15 12 r15
+  jump uffind
+  read -12 r14 r1
+  read -28 r14 r3
+.L338:
+  add r1 24 r2
+  read 0 r2 r2
+  beq r2 r0 .L340
+  add r1 24 r4
+  or r0 r3 r5
+  savpc r15
+  add r15 12 r15
+  jump uffind
+  read -12 r14 r1
+  read -28 r14 r3
+.L340:
+  add r1 20 r2
+  read 0 r2 r2
+  load 0 r4
+  bne r2 r0 .L342
+  or r0 r4 r2
+  jump .L343
+.L342:
+  add r1 24 r4
+  read 0 r4 r4
+  xor r2 r4 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L343:
+  beq r2 r0 .L345
+  add r1 12 r4
+  load 11 r2
+  writeh 0 r4 r2
+  add r1 24 r4
+  load 0 r2
+  write 0 r4 r2
+.L345:
+  add r1 32 r2
+  read 0 r2 r2
+  beq r2 r0 .L351
+  load 0 r2
+.L347:
+  write -16 r14 r2
+  add r1 32 r4
+  read 0 r4 r4
+  bge r2 r4 .L350
+  add r1 28 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r4
+  or r0 r3 r5
+  savpc r15
+  add r15 12 r15
+  jump uffind
+  read -16 r14 r2
+  read -12 r14 r1
+  read -28 r14 r3
+  add r2 1 r2
+  jump .L347
+.L350:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump jtabuniq
+  read -12 r14 r1
+  read -28 r14 r3
+.L351:
+  add r1 44 r4
+  jump .L335
+.L352:
+  or r0 r4 r1
+  or r0 r3 r4
+  read -20 r14 r2
+  write 0 r1 r2
+  savpc r15
+  add r15 12 r15
+  jump free
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function simpljmp */
+
@@ -0,0 +1,1297 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii ".text\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii ".data\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii ".abort \042unreachable\042\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii ".section .tdata,\042awT\042\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii ".section .tbss,\042awT\042\000"
+/* end data */
+
+.data
+.balign 4
+.Lsec.8:
+	.int .Lstring.9+0
+	.int .Lstring.10+0
+	.int .Lstring.10+0
+	.int .Lstring.11+0
+	.int .Lstring.12+0
+	.int .Lstring.13+0
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "__DATA\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "__thread_data,thread_local_regular\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "$tlv$init\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii ".section __DATA,__thread_vars,thread_local_variables\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "%s%s:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "\011.quad __tlv_bootstrap\012\011.quad 0\012\011.quad %s%s%s\012\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii ".section %s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii ",%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii ".balign %d\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii ".globl %s%s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "%s%s%s:\012\000"
+/* end data */
+
+
+.text
+; function emitlnk
+.global emitlnk
+emitlnk:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  or r0 r7 r12
+  or r0 r4 r7
+  or r0 r12 r4
+  write -32 r14 r4
+  write -12 r14 r6
+  write -16 r14 r5
+  write -28 r14 r7
+  readb 0 r7 r1
+  load 34 r2
+  beq r1 r2 .L20
+  addr2reg T+100 r1
+  write -24 r14 r1
+  jump .L22
+.L20:
+  addr2reg .Lstring.14 r1
+  write -24 r14 r1
+.L22:
+  addr2reg T+16 r12
+  readb 0 r12 r2
+  load 0 r1
+  bne r2 r0 .L24
+  or r0 r1 r2
+  jump .L25
+.L24:
+  add r5 1 r1
+  readb 0 r1 r1
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L25:
+  addr2reg .Lstring.14 r1
+  bne r2 r0 .L27
+  write -20 r14 r1
+  jump .L29
+.L27:
+  add r5 4 r2
+  addr2reg .Lstring.15 r1
+  write 0 r2 r1
+  add r5 8 r2
+  addr2reg .Lstring.16 r1
+  write 0 r2 r1
+  or r0 r4 r5
+  addr2reg .Lstring.18 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -24 r14 r6
+  read -32 r14 r4
+  read -28 r14 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.19 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -24 r14 r6
+  read -32 r14 r4
+  read -28 r14 r7
+  load32 -24 r1
+  sub r13 r1 r13
+  load 28 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 24 r2
+  addr2reg .Lstring.17 r1
+  write 0 r2 r1
+  addr2reg .Lstring.20 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  read -12 r14 r6
+  read -16 r14 r5
+  load32 -28 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.17 r1
+  write -20 r14 r1
+.L29:
+  add r5 4 r2
+  or r0 r6 r1
+  read 0 r2 r6
+  bne r6 r0 .L32
+  or r0 r1 r6
+  add r5 1 r1
+  readb 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg .Lsec.8 r1
+  add r1 r2 r1
+  shiftl r6 2 r2
+  add r1 r2 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -32 r14 r4
+  jump .L34
+.L32:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.21 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  read -16 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  add r5 8 r1
+  read 0 r1 r6
+  beq r6 r0 .L34
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.22 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L34:
+  or r0 r4 r5
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  read -20 r14 r1
+  read -24 r14 r6
+  read -32 r14 r4
+  read -16 r14 r5
+  read -28 r14 r7
+  add r5 3 r2
+  readb 0 r2 r2
+  beq r2 r0 .L37
+  or r0 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.23 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -20 r14 r1
+  read -24 r14 r6
+  read -32 r14 r4
+  read -16 r14 r5
+  read -28 r14 r7
+  load32 -24 r2
+  sub r13 r2 r13
+.L37:
+  readb 0 r5 r2
+  beq r2 r0 .L39
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.24 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -20 r14 r1
+  read -24 r14 r6
+  read -32 r14 r4
+  read -28 r14 r7
+  load32 -24 r2
+  sub r13 r2 r13
+.L39:
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.25 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -28 r1
+  sub r13 r1 r13
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitlnk */
+
+
+.text
+; function emitfnlnk
+.global emitfnlnk
+emitfnlnk:
+  or r0 r6 r7
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump emitlnk
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitfnlnk */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "\011.byte\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "\011.short\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "\011.int\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "\011.quad\000"
+/* end data */
+
+.data
+.balign 4
+.Ldtoa.28:
+	.fill 8,1,0
+	.int .Lstring.29+0
+	.int .Lstring.30+0
+	.int .Lstring.31+0
+	.int .Lstring.32+0
+/* end data */
+
+.data
+.balign 4
+.Lzero.33:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "\011.fill %lld,1,0\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "strings only supported for 'b' currently\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "\011.ascii %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "%s %s%s%+lld\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "%s %lld\012\000"
+/* end data */
+
+
+.text
+; function emitdat
+.global emitdat
+emitdat:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r2
+  or r0 r5 r4
+  write -16 r14 r4
+  write -12 r14 r2
+  read 0 r2 r1
+  load 1 r3
+  beq r1 r3 .L72
+  load 1 r3
+  blt r1 r3 .L55
+  load 6 r3
+  beq r1 r3 .L52
+  load 6 r3
+  sltu r1 r3 r1
+  jump .L57
+.L52:
+  addr2reg .Lzero.33 r12
+  read 0 r12 r1
+  load32 -1 r3
+  bne r1 r3 .L54
+  add r2 16 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.34 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L74
+.L54:
+  add r2 16 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  addr2reg .Lzero.33 r12
+  write 0 r12 r1
+  jump .L74
+.L55:
+  beq r1 r0 .L71
+  sltu r1 r0 r1
+.L57:
+  addr2reg .Lzero.33 r12
+  read 0 r12 r1
+  load32 -1 r3
+  beq r1 r3 .L61
+  add r2 4 r3
+  or r0 r4 r1
+  read 0 r3 r4
+  add r2 8 r2
+  read 0 r2 r5
+  or r0 r1 r7
+  load 1 r6
+  savpc r15
+  add r15 12 r15
+  jump emitlnk
+  read -16 r14 r4
+  read -12 r14 r2
+  addr2reg .Lzero.33 r12
+  read 0 r12 r6
+  bles r6 r0 .L60
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.34 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r4
+  read -12 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L60:
+  load32 -1 r1
+  addr2reg .Lzero.33 r12
+  write 0 r12 r1
+.L61:
+  add r2 25 r1
+  readb 0 r1 r1
+  bne r1 r0 .L68
+  add r2 24 r1
+  readb 0 r1 r1
+  bne r1 r0 .L64
+  read 0 r2 r1
+  shiftl r1 2 r3
+  addr2reg .Ldtoa.28 r1
+  add r1 r3 r1
+  read 0 r1 r6
+  add r2 16 r1
+  read 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.38 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L74
+.L64:
+  add r2 16 r1
+  read 0 r1 r1
+  readb 0 r1 r3
+  load 34 r5
+  beq r3 r5 .L66
+  addr2reg T+100 r3
+  jump .L67
+.L66:
+  addr2reg .Lstring.14 r3
+.L67:
+  or r0 r3 r7
+  read 0 r2 r3
+  shiftl r3 2 r5
+  addr2reg .Ldtoa.28 r3
+  add r3 r5 r3
+  read 0 r3 r6
+  add r2 16 r2
+  add r2 4 r2
+  read 0 r2 r3
+  load 32 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 28 r5
+  write 0 r5 r3
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.37 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -32 r1
+  sub r13 r1 r13
+  jump .L74
+.L68:
+  read 0 r2 r1
+  load 2 r3
+  beq r1 r3 .L70
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.35 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -16 r14 r4
+  read -12 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L70:
+  add r2 16 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.36 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L74
+.L71:
+  load 0 r1
+  addr2reg .Lzero.33 r12
+  write 0 r12 r1
+  jump .L74
+.L72:
+  addr2reg .Lzero.33 r12
+  read 0 r12 r1
+  load32 -1 r3
+  beq r1 r3 .L74
+  add r2 4 r3
+  or r0 r4 r1
+  read 0 r3 r4
+  add r2 8 r2
+  read 0 r2 r5
+  or r0 r1 r7
+  load 2 r6
+  savpc r15
+  add r15 12 r15
+  jump emitlnk
+  read -16 r14 r4
+  addr2reg .Lzero.33 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.34 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+.L74:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitdat */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "size == 4 || size == 8 || size == 16\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.41:
+	.ascii "BuildTools/QBE/emit.c\000"
+/* end data */
+
+
+.text
+; function stashbits
+.global stashbits
+stashbits:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  or r0 r4 r1
+  write -28 r14 r5
+  write -20 r14 r1
+  load 1 r2
+  load 4 r3
+  beq r5 r3 .L79
+  xor r5 8 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L80
+.L79:
+  or r0 r2 r3
+.L80:
+  load 1 r2
+  bne r3 r0 .L82
+  xor r5 16 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L82:
+  bne r2 r0 .L84
+  load 131 r6
+  addr2reg .Lstring.41 r5
+  addr2reg .Lstring.40 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r5
+  read -20 r14 r1
+.L84:
+  addr2reg stash r3
+  load 0 r2
+  or r0 r1 r4
+  or r0 r3 r1
+.L86:
+  write -16 r14 r1
+  write -24 r14 r2
+  read 0 r1 r1
+  write -32 r14 r1
+  beq r1 r0 .L91
+  add r1 16 r3
+  read 0 r3 r3
+  bgts r5 r3 .L89
+  or r0 r5 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  or r0 r1 r3
+  read -24 r14 r2
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  beq r3 r0 .L90
+.L89:
+  add r1 20 r1
+  add r2 1 r2
+  jump .L86
+.L90:
+  or r0 r2 r1
+  jump .L92
+.L91:
+  load 24 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r3
+  read -28 r14 r5
+  or r0 r5 r1
+  read -20 r14 r5
+  write -12 r14 r3
+  or r0 r1 r6
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -16 r14 r2
+  read -24 r14 r1
+  read -12 r14 r3
+  read -28 r14 r5
+  add r3 16 r4
+  write 0 r4 r5
+  add r3 20 r5
+  load 0 r4
+  write 0 r5 r4
+  write 0 r2 r3
+.L92:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function stashbits */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "/* floating point constants */\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.44:
+	.ascii ".section %s\012.p2align %d\012%sfp%d:\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.45:
+	.ascii "\012\011.int %d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.46:
+	.ascii "\012\012\000"
+/* end data */
+
+
+.text
+; function emitfin
+emitfin:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -24 r14 r5
+  write -12 r14 r4
+  addr2reg stash r12
+  read 0 r12 r1
+  beq r1 r0 .L113
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.43 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -24 r14 r5
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 4 r1
+  or r0 r1 r2
+.L98:
+  write -32 r14 r2
+  load 2 r1
+  bges r2 r1 .L101
+.L99:
+  addr2reg stash r12
+  read 0 r12 r4
+  beq r4 r0 .L113
+  add r4 20 r1
+  read 0 r1 r1
+  addr2reg stash r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump free
+  jump .L99
+.L101:
+  addr2reg stash r12
+  read 0 r12 r1
+  load 0 r3
+.L102:
+  write -16 r14 r1
+  write -28 r14 r3
+  beq r1 r0 .L112
+  add r1 16 r6
+  read 0 r6 r6
+  load 1 r7
+  shiftl r7 r2 r7
+  bne r6 r7 .L111
+  load 2 r1
+  sub r2 r1 r1
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r6
+  load 32 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 28 r5
+  write 0 r5 r3
+  add r1 24 r3
+  addr2reg T+96 r1
+  write 0 r3 r1
+  or r0 r2 r7
+  addr2reg .Lstring.44 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r1
+  read -12 r14 r4
+  load32 -32 r2
+  sub r13 r2 r13
+  or r0 r1 r2
+.L106:
+  write -20 r14 r1
+  add r2 16 r3
+  read 0 r3 r3
+  add r2 r3 r2
+  bge r1 r2 .L110
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.45 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -20 r14 r1
+  or r0 r1 r2
+  read -16 r14 r1
+  read -12 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  add r2 4 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L106
+.L110:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.46 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r1
+  read -28 r14 r3
+  read -32 r14 r2
+  read -24 r14 r5
+  read -12 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+.L111:
+  add r1 20 r1
+  read 0 r1 r1
+  add r3 1 r3
+  jump .L102
+.L112:
+  load 1 r1
+  sub r2 r1 r2
+  jump .L98
+.L113:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitfin */
+
+.data
+.balign 1
+.Lstring.49:
+	.ascii ".rodata\000"
+/* end data */
+
+.data
+.balign 4
+.Lsec.48:
+	.int .Lstring.49+0
+	.int .Lstring.49+0
+	.int .Lstring.49+0
+/* end data */
+
+.data
+.balign 1
+.Lstring.50:
+	.ascii ".section .note.GNU-stack,\042\042,@progbits\012\000"
+/* end data */
+
+
+.text
+; function elf_emitfin
+.global elf_emitfin
+elf_emitfin:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  addr2reg .Lsec.48 r5
+  savpc r15
+  add r15 12 r15
+  jump emitfin
+  read -16 r14 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.50 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function elf_emitfin */
+
+.data
+.balign 1
+.Lstring.52:
+	.ascii ".type %s, @function\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.53:
+	.ascii ".size %s, .-%s\012\000"
+/* end data */
+
+
+.text
+; function elf_emitfnfin
+.global elf_emitfnfin
+elf_emitfnfin:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r6
+  or r0 r5 r4
+  write -12 r14 r4
+  write -16 r14 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.52 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r4
+  read -16 r14 r6
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r6 r7
+  addr2reg .Lstring.53 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function elf_emitfnfin */
+
+.data
+.balign 1
+.Lstring.56:
+	.ascii "__TEXT,__literal4,4byte_literals\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.57:
+	.ascii "__TEXT,__literal8,8byte_literals\000"
+/* end data */
+
+.data
+.balign 4
+.Lsec.55:
+	.int .Lstring.56+0
+	.int .Lstring.57+0
+	.int .Lstring.11+0
+/* end data */
+
+
+.text
+; function macho_emitfin
+.global macho_emitfin
+macho_emitfin:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lsec.55 r5
+  savpc r15
+  add r15 12 r15
+  jump emitfin
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function macho_emitfin */
+
+.data
+.balign 1
+.Lstring.59:
+	.ascii ".file %u %s\012\000"
+/* end data */
+
+
+.text
+; function emitdbgfile
+.global emitdbgfile
+emitdbgfile:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r5
+  or r0 r4 r7
+  write -12 r14 r7
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump intern
+  or r0 r1 r2
+  read -8 r14 r4
+  read -12 r14 r7
+  write -16 r14 r2
+  load 0 r1
+  or r0 r4 r5
+  or r0 r7 r4
+.L130:
+  addr2reg nfile r12
+  read 0 r12 r3
+  bge r1 r3 .L134
+  addr2reg file r12
+  read 0 r12 r3
+  shiftl r1 2 r6
+  add r3 r6 r3
+  read 0 r3 r3
+  beq r3 r2 .L133
+  add r1 1 r1
+  jump .L130
+.L133:
+  add r1 1 r1
+  addr2reg curfile r12
+  write 0 r12 r1
+  jump .L137
+.L134:
+  addr2reg file r12
+  read 0 r12 r1
+  bne r1 r0 .L136
+  load 0 r6
+  load 4 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  addr2reg file r12
+  write 0 r12 r1
+.L136:
+  addr2reg nfile r12
+  read 0 r12 r1
+  add r1 1 r5
+  addr2reg nfile r12
+  write 0 r12 r5
+  addr2reg file r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -16 r14 r2
+  read -8 r14 r4
+  read -12 r14 r7
+  addr2reg file r12
+  read 0 r12 r1
+  addr2reg nfile r12
+  read 0 r12 r3
+  load 1 r5
+  sub r3 r5 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  write 0 r1 r2
+  addr2reg nfile r12
+  read 0 r12 r6
+  addr2reg curfile r12
+  write 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.59 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+.L137:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitdbgfile */
+
+.data
+.balign 1
+.Lstring.61:
+	.ascii "\011.loc %u %u %u\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.62:
+	.ascii "\011.loc %u %u\012\000"
+/* end data */
+
+
+.text
+; function emitdbgloc
+.global emitdbgloc
+emitdbgloc:
+  or r0 r4 r7
+  or r0 r6 r4
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  bne r5 r0 .L142
+  addr2reg curfile r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.62 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L143
+.L142:
+  addr2reg curfile r12
+  read 0 r12 r6
+  load 28 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 24 r1
+  write 0 r1 r5
+  addr2reg .Lstring.61 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -28 r1
+  sub r13 r1 r13
+.L143:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitdbgloc */
+
+.data
+.balign 4
+stash:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+file:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+nfile:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+curfile:
+	.fill 4,1,0
+/* end data */
+
@@ -0,0 +1,1172 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+
+.text
+; function liveon
+.global liveon
+liveon:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -32 r14 r5
+  write -28 r14 r6
+  write -24 r14 r4
+  add r6 84 r5
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -28 r14 r6
+  read 0 r6 r1
+.L18:
+  write -20 r14 r1
+  beq r1 r0 .L22
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -20 r14 r1
+  read -24 r14 r4
+  bne r2 r0 .L21
+  read 0 r1 r1
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+  read -20 r14 r1
+  read -24 r14 r4
+.L21:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L18
+.L22:
+  read -28 r14 r6
+  read -32 r14 r5
+  read -24 r14 r4
+  read 0 r6 r1
+.L24:
+  write -12 r14 r1
+  beq r1 r0 .L32
+  load 0 r2
+.L26:
+  write -16 r14 r2
+  add r1 12 r3
+  read 0 r3 r3
+  bge r2 r3 .L31
+  add r1 8 r3
+  read 0 r3 r3
+  shiftl r2 2 r6
+  add r3 r6 r3
+  read 0 r3 r3
+  bne r3 r5 .L30
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -16 r14 r2
+  read -12 r14 r1
+  read -32 r14 r5
+  read -24 r14 r4
+  bne r3 r0 .L30
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -16 r14 r2
+  read -12 r14 r1
+  read -32 r14 r5
+  add r5 100 r4
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -16 r14 r2
+  read -12 r14 r1
+  read -32 r14 r5
+  read -24 r14 r4
+.L30:
+  add r2 1 r2
+  jump .L26
+.L31:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L24
+.L32:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function liveon */
+
+
+.text
+; function bset
+bset:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  write -16 r14 r7
+  write -20 r14 r6
+  write -32 r14 r5
+  add r14 -36 r1
+  write 0 r1 r4
+  read -36 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -32 r14 r5
+  bne r1 r0 .L42
+  add r5 100 r4
+  read -36 r14 r1
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -16 r14 r7
+  read -20 r14 r6
+  read -32 r14 r5
+  add r5 84 r1
+  write -24 r14 r1
+  read -36 r14 r2
+  shiftr r2 3 r2
+  write -28 r14 r2
+  read 0 r1 r3
+  shiftl r3 5 r3
+  blt r2 r3 .L39
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r2
+  read -24 r14 r1
+  read -16 r14 r7
+  read -20 r14 r6
+  read -32 r14 r5
+.L39:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r2 5 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  and r2 31 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  bne r1 r0 .L42
+  read -36 r14 r1
+  shiftr r1 3 r1
+  load 160 r2
+  mults r1 r2 r1
+  add r7 r1 r1
+  add r1 108 r1
+  readh 0 r1 r1
+  shiftrs r1 1 r1
+  shiftl r1 2 r1
+  add r6 r1 r2
+  read 0 r2 r1
+  add r1 1 r1
+  write 0 r2 r1
+  add r5 84 r4
+  read -36 r14 r1
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump bsset
+.L42:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bset */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "(int)bscount(b->in) == T.nrglob && b->in->t[0] == T.rglob\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "BuildTools/QBE/live.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "rtype(i->to) == RTmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "\012> Liveness analysis:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "\011%-10sin:   \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "\011          out:  \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "\011          gen:  \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "\011          live: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "%d %d\012\000"
+/* end data */
+
+
+.text
+; function filllive
+.global filllive
+filllive:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 128 r13
+  write -80 r14 r4
+  add r4 16 r1
+  read 0 r1 r5
+  add r14 -100 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -80 r14 r4
+  add r4 16 r1
+  read 0 r1 r5
+  add r14 -92 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -80 r14 r4
+  read 0 r4 r1
+.L46:
+  or r0 r1 r2
+  write -76 r14 r2
+  beq r2 r0 .L49
+  or r0 r4 r1
+  add r2 84 r4
+  add r1 16 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -76 r14 r2
+  read -80 r14 r4
+  or r0 r4 r1
+  add r2 92 r4
+  add r1 16 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -76 r14 r2
+  read -80 r14 r4
+  or r0 r4 r1
+  add r2 100 r4
+  add r1 16 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -76 r14 r1
+  read -80 r14 r4
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L46
+.L49:
+  load 1 r1
+.L50:
+  add r4 28 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r3
+  write -68 r14 r1
+.L52:
+  write -72 r14 r3
+  blts r3 r0 .L128
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -64 r14 r1
+  add r1 92 r5
+  add r14 -100 r4
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -64 r14 r1
+  add r1 20 r2
+  read 0 r2 r6
+  beq r6 r0 .L55
+  or r0 r1 r5
+  add r14 -92 r4
+  savpc r15
+  add r15 12 r15
+  jump liveon
+  read -64 r14 r1
+  add r1 92 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump bsunion
+  read -64 r14 r1
+.L55:
+  add r1 24 r2
+  read 0 r2 r6
+  beq r6 r0 .L57
+  or r0 r1 r5
+  add r14 -92 r4
+  savpc r15
+  add r15 12 r15
+  jump liveon
+  read -64 r14 r1
+  add r1 92 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump bsunion
+  read -64 r14 r1
+.L57:
+  load 0 r2
+.L58:
+  write -60 r14 r2
+  add r1 32 r3
+  read 0 r3 r3
+  bges r2 r3 .L61
+  or r0 r2 r3
+  add r1 28 r2
+  read 0 r2 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r6
+  or r0 r1 r5
+  add r14 -92 r4
+  savpc r15
+  add r15 12 r15
+  jump liveon
+  read -64 r14 r1
+  add r1 92 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump bsunion
+  read -60 r14 r2
+  read -64 r14 r1
+  add r2 1 r2
+  jump .L58
+.L61:
+  add r1 92 r4
+  add r14 -100 r5
+  savpc r15
+  add r15 12 r15
+  jump bsequal
+  or r0 r1 r2
+  read -68 r14 r1
+  xor r2 0 r2
+  sltu r2 1 r2
+  or r1 r2 r1
+  write -56 r14 r1
+  load 8 r6
+  load 0 r5
+  add r14 -108 r4
+  savpc r15
+  add r15 12 r15
+  jump memset
+  read -64 r14 r1
+  add r1 92 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r2 0 r3
+  read 0 r3 r2
+  addr2reg T+40 r12
+  read 0 r12 r4
+  or r2 r4 r2
+  write 0 r3 r2
+  add r1 84 r4
+  add r1 92 r5
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -64 r14 r1
+  load 0 r2
+  write -120 r14 r2
+.L62:
+  add r1 84 r4
+  add r14 -120 r5
+  savpc r15
+  add r15 12 r15
+  jump bsiter
+  or r0 r1 r2
+  read -64 r14 r1
+  read -80 r14 r4
+  beq r2 r0 .L65
+  add r4 4 r2
+  read 0 r2 r2
+  read -120 r14 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r2 r3 r2
+  add r2 108 r2
+  readh 0 r2 r2
+  shiftrs r2 1 r2
+  shiftl r2 2 r3
+  add r14 -108 r2
+  add r2 r3 r3
+  read 0 r3 r2
+  add r2 1 r2
+  write 0 r3 r2
+  read -120 r14 r2
+  add r2 1 r2
+  write -120 r14 r2
+  jump .L62
+.L65:
+  add r1 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -64 r14 r1
+  read -80 r14 r4
+  load 5 r3
+  beq r2 r3 .L67
+  or r0 r1 r2
+  add r1 12 r1
+  add r1 4 r1
+  add r4 4 r3
+  read 0 r3 r7
+  add r14 -108 r6
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump bset
+  read -72 r14 r3
+  read -64 r14 r1
+  read -80 r14 r4
+  jump .L72
+.L67:
+  add r1 84 r4
+  savpc r15
+  add r15 12 r15
+  jump bscount
+  or r0 r1 r3
+  read -64 r14 r1
+  addr2reg T+44 r12
+  read 0 r12 r4
+  load 0 r2
+  bne r3 r4 .L69
+  add r1 88 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  addr2reg T+40 r12
+  read 0 r12 r3
+  xor r2 r3 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L69:
+  bne r2 r0 .L71
+  load 80 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -64 r14 r1
+.L71:
+  add r1 84 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r2 0 r5
+  write -16 r14 r5
+  read 0 r5 r2
+  write -12 r14 r2
+  add r1 12 r1
+  add r1 4 r2
+  addr2reg T+60 r12
+  read 0 r12 r1
+  add r14 -108 r5
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  or r0 r1 r6
+  read -72 r14 r3
+  read -12 r14 r2
+  read -16 r14 r5
+  read -64 r14 r1
+  read -80 r14 r4
+  or r2 r6 r2
+  write 0 r5 r2
+.L72:
+  load 0 r2
+.L73:
+  load 2 r5
+  bges r2 r5 .L76
+  shiftl r2 2 r6
+  add r14 -108 r5
+  add r5 r6 r5
+  read 0 r5 r5
+  add r1 108 r6
+  shiftl r2 2 r7
+  add r6 r7 r6
+  write 0 r6 r5
+  add r2 1 r2
+  jump .L73
+.L76:
+  add r1 4 r2
+  read 0 r2 r2
+  add r1 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r2
+.L77:
+  add r1 4 r3
+  read 0 r3 r3
+  beq r2 r3 .L125
+  load 16 r3
+  sub r2 r3 r2
+  write -52 r14 r2
+  read 0 r2 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r4
+  load 0 r3
+  load 124 r5
+  bne r4 r5 .L80
+  add r2 8 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -52 r14 r2
+  read -64 r14 r1
+  xor r3 5 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L80:
+  beq r3 r0 .L95
+  add r1 84 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r3
+  write -24 r14 r3
+  read 0 r3 r1
+  write -20 r14 r1
+  add r2 8 r1
+  add r1 4 r2
+  addr2reg T+60 r12
+  read 0 r12 r1
+  add r14 -116 r5
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  or r0 r1 r5
+  read -20 r14 r2
+  read -24 r14 r3
+  read -64 r14 r1
+  read -80 r14 r4
+  xor r5 -1 r5
+  and r2 r5 r2
+  write 0 r3 r2
+  load 0 r2
+.L82:
+  load 2 r3
+  bges r2 r3 .L86
+  shiftl r2 2 r5
+  add r14 -108 r3
+  add r3 r5 r5
+  read 0 r5 r3
+  shiftl r2 2 r7
+  add r14 -116 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  sub r3 r6 r3
+  write 0 r5 r3
+  shiftl r2 2 r5
+  add r14 -108 r3
+  add r3 r5 r5
+  read 0 r5 r3
+  shiftl r2 2 r7
+  addr2reg T+52 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  add r3 r6 r3
+  write 0 r5 r3
+  shiftl r2 2 r5
+  add r14 -108 r3
+  add r3 r5 r3
+  read 0 r3 r3
+  add r1 108 r5
+  shiftl r2 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  bles r3 r5 .L85
+  shiftl r2 2 r5
+  add r14 -108 r3
+  add r3 r5 r3
+  read 0 r3 r3
+  add r1 108 r5
+  shiftl r2 2 r6
+  add r5 r6 r5
+  write 0 r5 r3
+.L85:
+  add r2 1 r2
+  jump .L82
+.L86:
+  read -52 r14 r2
+  add r1 84 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r3
+  write -32 r14 r3
+  read 0 r3 r1
+  write -28 r14 r1
+  add r2 8 r1
+  add r1 4 r2
+  addr2reg T+64 r12
+  read 0 r12 r1
+  add r14 -116 r5
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  or r0 r1 r5
+  read -28 r14 r2
+  read -32 r14 r3
+  read -64 r14 r1
+  read -80 r14 r4
+  or r2 r5 r2
+  write 0 r3 r2
+  load 0 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L89:
+  load 2 r3
+  bges r1 r3 .L94
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  shiftl r2 2 r5
+  add r14 -108 r3
+  add r3 r5 r5
+  read 0 r5 r3
+  shiftl r2 2 r7
+  addr2reg T+52 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  sub r3 r6 r3
+  write 0 r5 r3
+  shiftl r2 2 r5
+  add r14 -108 r3
+  add r3 r5 r5
+  read 0 r5 r3
+  shiftl r2 2 r7
+  add r14 -116 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  add r3 r6 r3
+  write 0 r5 r3
+  add r2 1 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L89
+.L94:
+  read -52 r14 r2
+.L95:
+  add r2 4 r1
+  load 0 r2
+  write -84 r14 r2
+  read -84 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -52 r14 r2
+  bne r1 r0 .L105
+  add r2 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -52 r14 r2
+  read -64 r14 r1
+  read -80 r14 r4
+  beq r3 r0 .L98
+  load 107 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -52 r14 r2
+  read -64 r14 r1
+  read -80 r14 r4
+.L98:
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r3
+  write -40 r14 r3
+  write -120 r14 r3
+  add r1 84 r2
+  write -36 r14 r2
+  read 0 r2 r5
+  shiftl r5 5 r5
+  blt r3 r5 .L101
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -36 r14 r2
+  read -40 r14 r3
+  read -64 r14 r1
+  read -80 r14 r4
+.L101:
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r3 5 r5
+  shiftl r5 2 r5
+  add r2 r5 r2
+  read 0 r2 r2
+  and r3 31 r5
+  load 1 r3
+  shiftl r3 r5 r3
+  and r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  beq r2 r0 .L104
+  add r4 4 r2
+  read 0 r2 r2
+  read -120 r14 r3
+  load 160 r4
+  mults r3 r4 r3
+  add r2 r3 r2
+  add r2 108 r2
+  readh 0 r2 r2
+  shiftrs r2 1 r2
+  shiftl r2 2 r3
+  add r14 -108 r2
+  add r2 r3 r3
+  read 0 r3 r2
+  load 1 r4
+  sub r2 r4 r2
+  write 0 r3 r2
+.L104:
+  add r1 100 r4
+  read -120 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -64 r14 r1
+  add r1 84 r4
+  read -120 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+  read -52 r14 r2
+.L105:
+  load 0 r1
+  or r0 r1 r3
+.L107:
+  write -48 r14 r3
+  or r0 r2 r1
+  load 2 r2
+  bges r3 r2 .L117
+  or r0 r1 r2
+  add r2 8 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r5
+  read -48 r14 r3
+  read -52 r14 r2
+  or r0 r2 r1
+  read -64 r14 r2
+  read -80 r14 r4
+  load 6 r6
+  beq r5 r6 .L114
+  load 6 r6
+  sltu r5 r6 r5
+  add r1 8 r1
+  shiftl r3 2 r3
+  add r1 r3 r1
+  add r4 4 r3
+  read 0 r3 r7
+  add r14 -108 r6
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump bset
+  read -48 r14 r3
+  or r0 r3 r5
+  read -52 r14 r3
+  read -64 r14 r1
+  read -80 r14 r4
+  or r0 r3 r2
+  or r0 r5 r3
+  jump .L116
+.L114:
+  or r0 r3 r5
+  or r0 r1 r3
+  or r0 r2 r1
+  or r0 r1 r2
+  add r4 12 r1
+  read 0 r1 r1
+  add r3 8 r3
+  shiftl r5 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  load 48 r5
+  mults r3 r5 r3
+  add r1 r3 r1
+  write -44 r14 r1
+  add r1 32 r1
+  add r4 4 r3
+  read 0 r3 r7
+  add r14 -108 r6
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump bset
+  read -44 r14 r1
+  read -64 r14 r2
+  read -80 r14 r4
+  add r1 36 r1
+  add r4 4 r3
+  read 0 r3 r7
+  add r14 -108 r6
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump bset
+  read -48 r14 r3
+  read -52 r14 r2
+  read -64 r14 r1
+  read -80 r14 r4
+.L116:
+  add r3 1 r3
+  jump .L107
+.L117:
+  or r0 r1 r2
+  read -64 r14 r1
+  read -80 r14 r4
+  load 0 r3
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L120:
+  load 2 r5
+  bges r3 r5 .L124
+  shiftl r3 2 r6
+  add r14 -108 r5
+  add r5 r6 r5
+  read 0 r5 r5
+  add r2 108 r6
+  shiftl r3 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  bles r5 r6 .L123
+  shiftl r3 2 r6
+  add r14 -108 r5
+  add r5 r6 r5
+  read 0 r5 r5
+  add r2 108 r6
+  shiftl r3 2 r7
+  add r6 r7 r6
+  write 0 r6 r5
+.L123:
+  add r3 1 r3
+  jump .L120
+.L124:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L77
+.L125:
+  read -72 r14 r3
+  read -56 r14 r1
+  read -80 r14 r4
+  load 1 r2
+  sub r3 r2 r3
+  write -68 r14 r1
+  jump .L52
+.L128:
+  read -68 r14 r1
+  beq r1 r0 .L131
+  load 0 r1
+  jump .L50
+.L131:
+  addr2reg debug+76 r12
+  readb 0 r12 r1
+  beq r1 r0 .L136
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.13 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -80 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  read 0 r4 r1
+.L133:
+  write -8 r14 r1
+  beq r1 r0 .L136
+  add r1 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.14 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -8 r14 r1
+  read -80 r14 r4
+  or r0 r1 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r4 r1
+  add r2 84 r4
+  add r1 4 r1
+  read 0 r1 r5
+  addr2reg __stderr_file r6
+  savpc r15
+  add r15 12 r15
+  jump dumpts
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.15 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -8 r14 r1
+  read -80 r14 r4
+  or r0 r1 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r4 r1
+  add r2 92 r4
+  add r1 4 r1
+  read 0 r1 r5
+  addr2reg __stderr_file r6
+  savpc r15
+  add r15 12 r15
+  jump dumpts
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.16 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -8 r14 r1
+  read -80 r14 r4
+  or r0 r1 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r4 r1
+  add r2 100 r4
+  add r1 4 r1
+  read 0 r1 r5
+  addr2reg __stderr_file r6
+  savpc r15
+  add r15 12 r15
+  jump dumpts
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.17 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -8 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 108 r2
+  add r2 0 r2
+  read 0 r2 r6
+  add r1 108 r1
+  add r1 4 r1
+  read 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.18 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -8 r14 r1
+  read -80 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L133
+.L136:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function filllive */
+
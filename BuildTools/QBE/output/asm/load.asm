@@ -0,0 +1,2938 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "BuildTools/QBE/load.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "unreachable\000"
+/* end data */
+
+
+.text
+; function loadsz
+.global loadsz
+loadsz:
+  read 0 r4 r1
+  shiftl r1 2 r2
+  shiftr r2 2 r2
+  load 59 r3
+  sub r2 r3 r2
+  load 7 r3
+  blt r2 r3 .L20
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L27
+.L20:
+  shiftl r2 2 r3
+  addr2reg .Ljt20 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L21:
+  load 1 r1
+  jumpr 0 r15
+.L22:
+  load 2 r1
+  jumpr 0 r15
+.L23:
+  load 4 r1
+  jumpr 0 r15
+.L24:
+  shiftr r1 30 r1
+  and r1 1 r1
+  bne r1 r0 .L26
+  load 4 r1
+  jumpr 0 r15
+.L26:
+  load 8 r1
+  jumpr 0 r15
+.L27:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt20:
+  .int .L21
+  .int .L21
+  .int .L22
+  .int .L22
+  .int .L23
+  .int .L23
+  .int .L24
+
+/* end function loadsz */
+
+
+.text
+; function storesz
+.global storesz
+storesz:
+  read 0 r4 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 53 r2
+  sub r1 r2 r1
+  load 6 r2
+  blt r1 r2 .L33
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L38
+.L33:
+  shiftl r1 2 r2
+  addr2reg .Ljt33 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L34:
+  load 1 r1
+  jumpr 0 r15
+.L35:
+  load 2 r1
+  jumpr 0 r15
+.L36:
+  load 4 r1
+  jumpr 0 r15
+.L37:
+  load 8 r1
+  jumpr 0 r15
+.L38:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt33:
+  .int .L34
+  .int .L35
+  .int .L36
+  .int .L37
+  .int .L36
+  .int .L37
+
+/* end function storesz */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "ld\000"
+/* end data */
+
+
+.text
+; function iins
+iins:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  read 8 r14 r3
+  write -4 r14 r3
+  or r0 r7 r1
+  add r14 -20 r2
+  write 0 r2 r1
+  or r0 r6 r1
+  add r14 -24 r2
+  write 0 r2 r1
+  write -8 r14 r5
+  write -12 r14 r4
+  addr2reg nlog r12
+  read 0 r12 r1
+  add r1 1 r5
+  addr2reg nlog r12
+  write 0 r12 r5
+  addr2reg ilog r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -4 r14 r3
+  read -8 r14 r2
+  read -12 r14 r5
+  addr2reg ilog r12
+  read 0 r12 r1
+  addr2reg nlog r12
+  read 0 r12 r4
+  load 1 r6
+  sub r4 r6 r4
+  load 28 r6
+  mults r4 r6 r4
+  add r1 r4 r1
+  write -16 r14 r1
+  read 0 r1 r4
+  and r4 -2 r6
+  load 0 r4
+  or r4 r6 r4
+  write 0 r1 r4
+  addr2reg inum r12
+  read 0 r12 r4
+  add r4 1 r6
+  addr2reg inum r12
+  write 0 r12 r6
+  shiftl r4 1 r4
+  load32 -2 r6
+  and r4 r6 r4
+  read 0 r1 r6
+  load 1 r7
+  and r6 r7 r6
+  or r4 r6 r4
+  write 0 r1 r4
+  add r3 8 r4
+  read 0 r4 r4
+  add r4 48 r4
+  read 0 r4 r4
+  add r1 4 r6
+  write 0 r6 r4
+  add r3 4 r3
+  read 0 r3 r3
+  add r1 8 r4
+  write 0 r4 r3
+  load32 1073741823 r3
+  and r2 r3 r2
+  or r2 0 r3
+  shiftl r5 30 r2
+  load32 -1073741824 r4
+  and r2 r4 r2
+  load32 1073741823 r4
+  and r3 r4 r3
+  or r2 r3 r4
+  read -24 r14 r3
+  or r0 r1 r2
+  read -20 r14 r1
+  add r2 12 r2
+  write 0 r2 r4
+  add r2 4 r2
+  load 0 r4
+  write 0 r2 r4
+  add r2 4 r2
+  write 0 r2 r3
+  add r2 4 r2
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r6
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  or r0 r1 r2
+  read -16 r14 r1
+  write -28 r14 r2
+  add r1 12 r1
+  add r1 4 r2
+  read -28 r14 r1
+  write 0 r2 r1
+  read -28 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function iins */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "rtype(*r) == RTmp\000"
+/* end data */
+
+
+.text
+; function cast
+cast:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 48 r13
+  write -8 r14 r6
+  write -12 r14 r5
+  write -16 r14 r4
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r4
+  load 1 r2
+  beq r1 r2 .L66
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -8 r14 r6
+  read -12 r14 r5
+  read -16 r14 r4
+  beq r1 r0 .L48
+  load 91 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.14 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -8 r14 r6
+  read -12 r14 r5
+  read -16 r14 r4
+.L48:
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  read 0 r4 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r1
+  write -4 r14 r1
+  load 1 r2
+  beq r1 r5 .L52
+  load 0 r2
+  bne r5 r0 .L51
+  xor r1 1 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L51:
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L52:
+  bne r2 r0 .L66
+  and r1 1 r2
+  and r5 1 r3
+  blts r2 r3 .L62
+  load 0 r2
+  load 3 r3
+  bne r1 r3 .L56
+  xor r5 1 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L56:
+  beq r2 r0 .L58
+  load 0 r1
+  write -20 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -20 r14 r7
+  read 0 r4 r6
+  load 82 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump iins
+  or r0 r1 r2
+  read -4 r14 r1
+  read -8 r14 r6
+  read -12 r14 r5
+  read -16 r14 r4
+  write -28 r14 r2
+  load32 -12 r2
+  sub r13 r2 r13
+  read -28 r14 r2
+  write 0 r4 r2
+.L58:
+  or r0 r1 r2
+  load 1 r1
+  load 3 r3
+  bne r2 r3 .L60
+  xor r5 0 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L60:
+  beq r1 r0 .L66
+  load 0 r1
+  write -20 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -20 r14 r7
+  read 0 r4 r6
+  or r0 r5 r1
+  load 82 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump iins
+  read -16 r14 r4
+  write -24 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -24 r14 r1
+  write 0 r4 r1
+  jump .L66
+.L62:
+  load 2 r2
+  bne r1 r2 .L64
+  load 0 r1
+  write -20 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -20 r14 r7
+  read 0 r4 r6
+  load 82 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump iins
+  read -8 r14 r6
+  read -16 r14 r4
+  write -40 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -40 r14 r1
+  write 0 r4 r1
+.L64:
+  load 0 r1
+  write -20 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -20 r14 r7
+  read 0 r4 r6
+  load 71 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump iins
+  read -8 r14 r6
+  read -12 r14 r5
+  read -16 r14 r4
+  write -36 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -36 r14 r1
+  write 0 r4 r1
+  load 3 r1
+  bne r5 r1 .L66
+  load 0 r1
+  write -20 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -20 r14 r7
+  read 0 r4 r6
+  load 82 r5
+  load 3 r4
+  savpc r15
+  add r15 12 r15
+  jump iins
+  read -16 r14 r4
+  write -32 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -32 r14 r1
+  write 0 r4 r1
+.L66:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function cast */
+
+
+.text
+; function loadref
+loadref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 140 r13
+  write -32 r14 r6
+  or r0 r5 r2
+  write -24 r14 r2
+  load 0 r1
+  write -100 r14 r1
+  add r14 -100 r1
+  add r1 4 r3
+  load 60 r1
+  write 0 r3 r1
+  add r14 -100 r1
+  add r1 8 r3
+  load 62 r1
+  write 0 r3 r1
+  add r14 -100 r1
+  add r1 12 r3
+  load 0 r1
+  write 0 r3 r1
+  add r14 -100 r1
+  add r1 16 r3
+  load 64 r1
+  write 0 r3 r1
+  add r14 -100 r1
+  add r1 20 r3
+  load 0 r1
+  write 0 r3 r1
+  add r14 -100 r1
+  add r1 24 r3
+  load 0 r1
+  write 0 r3 r1
+  add r14 -100 r1
+  add r1 28 r3
+  load 0 r1
+  write 0 r3 r1
+  add r14 -100 r1
+  add r1 32 r3
+  load 65 r1
+  write 0 r3 r1
+  add r4 8 r1
+  readh 0 r1 r1
+  shiftl r1 2 r5
+  add r14 -100 r3
+  add r3 r5 r3
+  read 0 r3 r5
+  write -16 r14 r5
+  shiftl r1 3 r3
+  load 1 r5
+  sub r3 r5 r5
+  load 1 r3
+  shiftl r3 r5 r3
+  shiftl r3 1 r3
+  load 1 r5
+  sub r3 r5 r3
+  xor r2 r3 r2
+  sltu r2 1 r2
+  write -20 r14 r2
+  bne r2 r0 .L74
+  load 4 r2
+  bgts r1 r2 .L72
+  load 0 r1
+  jump .L73
+.L72:
+  load 1 r1
+.L73:
+  write -28 r14 r1
+  jump .L76
+.L74:
+  add r4 10 r1
+  readh 0 r1 r1
+  write -28 r14 r1
+.L76:
+  read 0 r4 r1
+  write -108 r14 r1
+  read -108 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -28 r14 r4
+  read -16 r14 r5
+  read -32 r14 r6
+  bne r1 r0 .L85
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  read -108 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 128 r2
+  write -12 r14 r2
+  read 0 r2 r1
+  load 1 r3
+  sub r1 r3 r1
+  load 6 r3
+  bge r1 r3 .L81
+  shiftl r1 2 r3
+  addr2reg .Ljt79 r1
+  add r1 r3 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L80:
+  load 32 r6
+  load 0 r5
+  add r14 -64 r4
+  savpc r15
+  add r15 12 r15
+  jump memset
+  read -12 r14 r2
+  load 2 r1
+  write -64 r14 r1
+  add r2 12 r1
+  add r14 -64 r3
+  add r3 4 r3
+  read 0 r1 r4
+  write 0 r3 r4
+  add r1 4 r1
+  add r3 4 r3
+  read 0 r1 r1
+  write 0 r3 r1
+  add r2 8 r1
+  read 0 r1 r1
+  add r14 -64 r2
+  add r2 16 r2
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r5
+  add r14 -64 r4
+  savpc r15
+  add r15 12 r15
+  jump newcon
+  read -28 r14 r4
+  read -16 r14 r5
+  read -32 r14 r6
+  write -124 r14 r1
+  read -124 r14 r1
+  write -108 r14 r1
+  jump .L85
+.L81:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -28 r14 r4
+  read -12 r14 r2
+  read -16 r14 r5
+  read -32 r14 r6
+  load32 -24 r1
+  sub r13 r1 r13
+.L82:
+  add r2 4 r1
+  read 0 r1 r1
+  shiftl r1 3 r1
+  load32 -8 r3
+  and r1 r3 r1
+  or r1 0 r1
+  write -108 r14 r1
+  add r2 8 r1
+  read 0 r1 r1
+  beq r1 r0 .L85
+  or r0 r1 r4
+  addr2reg curf r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  read -32 r14 r6
+  write -128 r14 r1
+  read -128 r14 r1
+  write -104 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -104 r14 r7
+  read -108 r14 r6
+  load 1 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump iins
+  read -28 r14 r4
+  read -16 r14 r5
+  read -32 r14 r6
+  write -132 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -132 r14 r1
+  write -108 r14 r1
+.L85:
+  load 0 r1
+  write -104 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -104 r14 r7
+  read -108 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump iins
+  or r0 r1 r2
+  read -28 r14 r4
+  read -20 r14 r1
+  read -32 r14 r6
+  write -120 r14 r2
+  load32 -12 r2
+  sub r13 r2 r13
+  read -120 r14 r2
+  write -108 r14 r2
+  bne r1 r0 .L87
+  or r0 r4 r5
+  add r14 -108 r4
+  savpc r15
+  add r15 12 r15
+  jump cast
+  read -24 r14 r4
+  addr2reg curf r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  read -28 r14 r4
+  read -32 r14 r6
+  write -112 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -112 r14 r7
+  read -108 r14 r6
+  load 11 r5
+  savpc r15
+  add r15 12 r15
+  jump iins
+  write -116 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -116 r14 r1
+  write -108 r14 r1
+.L87:
+  read -108 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt79:
+  .int .L82
+  .int .L80
+  .int .L82
+  .int .L80
+  .int .L81
+  .int .L82
+
+/* end function loadref */
+
+
+.text
+; function killsl
+killsl:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  write -12 r14 r5
+  add r14 -24 r1
+  write 0 r1 r4
+  read 0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -12 r14 r5
+  bne r1 r0 .L98
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  read 0 r5 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 128 r1
+  write -16 r14 r1
+  read 0 r1 r2
+  load 1 r3
+  sub r2 r3 r2
+  load 6 r3
+  bge r2 r3 .L96
+  shiftl r2 2 r3
+  addr2reg .Ljt94 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L95:
+  load 0 r1
+  jump .L99
+.L96:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L97:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -20 r14 r1
+  read -24 r14 r5
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  jump .L99
+.L98:
+  load 0 r1
+.L99:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt94:
+  .int .L97
+  .int .L95
+  .int .L97
+  .int .L95
+  .int .L96
+  .int .L97
+
+/* end function killsl */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "dom(b, il->blk)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "rtype(i->arg[0]) == RInt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "i > b->ins\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "i->op == Oblit0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "off < sz\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "sz <= 8\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "bp->loop >= il->blk->loop\000"
+/* end data */
+
+
+.text
+; function def
+def:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 372 r13
+  write -364 r14 r8
+  read 8 r14 r2
+  write -176 r14 r2
+  write -12 r14 r7
+  write -144 r14 r5
+  write -160 r14 r4
+  write -152 r14 r6
+  add r2 8 r1
+  read 0 r1 r5
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump dom
+  or r0 r1 r2
+  read -12 r14 r7
+  read -152 r14 r6
+  read -160 r14 r1
+  bne r2 r0 .L104
+  load 217 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r7
+  read -152 r14 r6
+  read -160 r14 r1
+.L104:
+  addr2reg nlog r12
+  read 0 r12 r4
+  write -168 r14 r4
+  addr2reg curf r12
+  read 0 r12 r2
+  add r2 16 r2
+  read 0 r2 r3
+  write -164 r14 r3
+  bne r7 r0 .L107
+  add r6 4 r2
+  read 0 r2 r2
+  add r6 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r7
+.L107:
+  add r1 8 r2
+  readh 0 r2 r2
+  load 4 r3
+  bgts r2 r3 .L110
+  load 0 r3
+  write -172 r14 r3
+  jump .L112
+.L110:
+  load 1 r3
+  write -172 r14 r3
+.L112:
+  shiftl r2 3 r2
+  load 1 r3
+  sub r2 r3 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  shiftl r2 1 r2
+  load 1 r3
+  sub r2 r3 r4
+  write -148 r14 r4
+  or r0 r6 r3
+  or r0 r7 r2
+.L114:
+  add r3 4 r3
+  read 0 r3 r3
+  ble r2 r3 .L200
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  load 16 r3
+  sub r1 r3 r1
+  write -56 r14 r1
+  add r1 4 r1
+  add r14 -344 r5
+  add r2 0 r3
+  read 0 r3 r3
+  add r14 -344 r4
+  add r4 0 r4
+  write 0 r4 r3
+  add r2 4 r3
+  read 0 r3 r3
+  add r14 -344 r4
+  add r4 4 r4
+  write 0 r4 r3
+  add r2 8 r2
+  read 0 r2 r2
+  add r14 -344 r3
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump killsl
+  or r0 r1 r6
+  read -56 r14 r2
+  read -148 r14 r4
+  read -152 r14 r3
+  read -160 r14 r1
+  load 1 r5
+  bne r6 r0 .L120
+  read 0 r2 r5
+  shiftl r5 2 r5
+  shiftr r5 2 r6
+  load 0 r5
+  load 124 r7
+  bne r6 r7 .L119
+  addr2reg curf r12
+  read 0 r12 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump escapes
+  or r0 r1 r5
+  read -56 r14 r2
+  read -148 r14 r4
+  read -152 r14 r3
+  read -160 r14 r1
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L119:
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L120:
+  bne r5 r0 .L199
+  read 0 r2 r5
+  shiftl r5 2 r6
+  shiftr r6 2 r6
+  load 59 r7
+  sub r6 r7 r7
+  load 6 r6
+  sltu r6 r7 r6
+  xor r6 1 r7
+  write -60 r14 r7
+  bne r7 r0 .L133
+  shiftl r5 2 r6
+  shiftr r6 2 r6
+  load 53 r7
+  sub r6 r7 r6
+  load 5 r7
+  sltu r7 r6 r6
+  xor r6 1 r6
+  read -144 r14 r8
+  bne r6 r0 .L131
+  shiftl r5 2 r5
+  shiftr r5 2 r5
+  load 93 r6
+  bne r5 r6 .L114
+  add r2 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -56 r14 r2
+  load 2 r3
+  beq r1 r3 .L126
+  load 249 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -56 r14 r2
+.L126:
+  add r2 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump abs
+  or r0 r1 r5
+  read -56 r14 r2
+  read -152 r14 r3
+  read -160 r14 r1
+  write -48 r14 r5
+  add r3 4 r3
+  read 0 r3 r3
+  bgt r2 r3 .L128
+  load 251 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.21 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -48 r14 r5
+  read -56 r14 r2
+  read -160 r14 r1
+.L128:
+  load 16 r3
+  sub r2 r3 r2
+  write -52 r14 r2
+  read 0 r2 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 92 r4
+  beq r3 r4 .L130
+  load 253 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.22 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -52 r14 r2
+  read -48 r14 r5
+  read -160 r14 r1
+.L130:
+  add r2 8 r3
+  add r3 4 r3
+  read 0 r3 r3
+  write -196 r14 r3
+  jump .L132
+.L131:
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump storesz
+  or r0 r1 r5
+  read -56 r14 r2
+  read -160 r14 r1
+  add r2 8 r3
+  add r3 4 r3
+  read 0 r3 r3
+  write -196 r14 r3
+  add r2 8 r3
+  add r3 0 r3
+  read 0 r3 r3
+  write -200 r14 r3
+.L132:
+  write -156 r14 r2
+  jump .L135
+.L133:
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump loadsz
+  or r0 r1 r5
+  read -56 r14 r2
+  read -160 r14 r1
+  add r2 8 r3
+  add r3 0 r3
+  read 0 r3 r3
+  write -196 r14 r3
+  add r2 4 r3
+  read 0 r3 r3
+  write -200 r14 r3
+  write -156 r14 r2
+.L135:
+  write -84 r14 r5
+  add r1 4 r3
+  or r0 r5 r2
+  read 0 r3 r5
+  add r1 8 r3
+  readh 0 r3 r6
+  addr2reg curf r12
+  read 0 r12 r4
+  load 20 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 16 r7
+  write 0 r7 r4
+  add r3 12 r7
+  add r14 -204 r4
+  write 0 r7 r4
+  add r3 8 r3
+  write 0 r3 r2
+  read -196 r14 r7
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump alias
+  read -156 r14 r2
+  read -84 r14 r5
+  read -152 r14 r3
+  or r0 r1 r6
+  read -160 r14 r1
+  load32 -20 r4
+  sub r13 r4 r13
+  load 1 r4
+  xor r6 r4 r4
+  sltu r4 1 r4
+  write -64 r14 r4
+  read -60 r14 r7
+  read -148 r14 r4
+  read -64 r14 r12
+  bne r12 r0 .L196
+  load 1 r4
+  sltu r6 r4 r4
+  write -68 r14 r4
+  read -148 r14 r4
+  read -144 r14 r8
+  read -68 r14 r12
+  bne r12 r0 .L191
+  load 2 r7
+  beq r6 r7 .L141
+  or r0 r6 r1
+  or r0 r1 r5
+  load 2 r1
+  sltu r5 r1 r1
+  jump .L195
+.L141:
+  read 0 r2 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 92 r7
+  bne r6 r7 .L156
+  read 0 r1 r4
+  write -216 r14 r4
+  add r1 4 r6
+  add r14 -216 r4
+  add r4 4 r4
+  read 0 r6 r7
+  write 0 r4 r7
+  add r6 4 r6
+  add r4 4 r4
+  read 0 r6 r7
+  write -80 r14 r7
+  write 0 r4 r7
+  add r2 8 r4
+  add r4 0 r4
+  read 0 r4 r4
+  write -216 r14 r4
+  read -204 r14 r6
+  write -72 r14 r6
+  bges r6 r0 .L145
+  add r14 -216 r4
+  add r4 4 r6
+  load 0 r4
+  write 0 r6 r4
+  add r14 -216 r4
+  add r4 8 r4
+  write -76 r14 r4
+  read -72 r14 r6
+  read -148 r14 r4
+  shiftl r7 16 r7
+  shiftrs r7 16 r7
+  add r7 r6 r6
+  read -76 r14 r7
+  writeh 0 r7 r6
+  write -88 r14 r6
+  jump .L151
+.L145:
+  or r0 r7 r4
+  blts r6 r5 .L148
+  load 263 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.23 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -156 r14 r2
+  read -84 r14 r5
+  or r0 r5 r6
+  read -80 r14 r5
+  read -152 r14 r3
+  read -160 r14 r1
+  jump .L149
+.L148:
+  or r0 r5 r6
+  or r0 r4 r5
+.L149:
+  read -204 r14 r7
+  add r14 -216 r4
+  add r4 4 r4
+  write 0 r4 r7
+  read -148 r14 r4
+  sub r6 r7 r6
+  load 0 r7
+  write -204 r14 r7
+  write -88 r14 r5
+  or r0 r6 r5
+.L151:
+  or r0 r5 r6
+  read -88 r14 r5
+  shiftl r5 16 r5
+  shiftrs r5 16 r5
+  bgts r6 r5 .L153
+  or r0 r6 r5
+.L153:
+  write -92 r14 r5
+  load 8 r6
+  bles r5 r6 .L155
+  load 273 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.24 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -92 r14 r5
+  read -156 r14 r2
+  read -148 r14 r4
+  read -152 r14 r3
+  read -160 r14 r1
+.L155:
+  add r14 -216 r6
+  add r6 8 r6
+  writeh 0 r6 r5
+.L156:
+  write -112 r14 r5
+  read -204 r14 r6
+  blts r6 r0 .L159
+  shiftl r5 3 r5
+  load 1 r7
+  sub r5 r7 r7
+  load 1 r5
+  shiftl r5 r7 r5
+  shiftl r5 1 r5
+  load 1 r7
+  sub r5 r7 r5
+  read -144 r14 r8
+  shiftl r6 3 r6
+  shiftr r5 r6 r5
+  and r5 r4 r5
+  load 15 r6
+  write -108 r14 r6
+  jump .L161
+.L159:
+  sub r0 r6 r6
+  write -204 r14 r6
+  shiftl r5 3 r5
+  load 1 r7
+  sub r5 r7 r7
+  load 1 r5
+  shiftl r5 r7 r5
+  shiftl r5 1 r5
+  load 1 r7
+  sub r5 r7 r5
+  read -144 r14 r8
+  shiftl r6 3 r6
+  shiftl r5 r6 r5
+  and r5 r4 r5
+  load 16 r6
+  write -108 r14 r6
+.L161:
+  write -136 r14 r5
+  and r5 r8 r5
+  beq r5 r0 .L114
+  read -112 r14 r5
+  or r0 r2 r7
+  or r0 r3 r6
+  or r0 r1 r2
+  read -176 r14 r1
+  read 0 r7 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 92 r4
+  xor r3 r4 r4
+  sltu r4 1 r4
+  read -136 r14 r3
+  beq r4 r0 .L165
+  shiftl r5 3 r2
+  load 1 r3
+  sub r2 r3 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  shiftl r2 1 r2
+  load 1 r3
+  sub r2 r3 r5
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -332 r4
+  add r14 -216 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -332 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -216 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -332 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -216 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -332 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump def
+  write -320 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -320 r14 r1
+  write -200 r14 r1
+  load 0 r1
+  write -180 r14 r1
+  read -180 r14 r5
+  read -200 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  write -96 r14 r1
+  read -136 r14 r3
+  read -112 r14 r5
+  read -156 r14 r7
+  read -176 r14 r6
+  or r0 r6 r1
+  read -152 r14 r6
+  read -144 r14 r4
+  read -160 r14 r2
+  read -96 r14 r12
+  bne r12 r0 .L190
+.L165:
+  read -204 r14 r4
+  write -100 r14 r4
+  read -144 r14 r4
+  read -100 r14 r12
+  bne r12 r0 .L167
+  or r0 r2 r1
+  jump .L175
+.L167:
+  read -108 r14 r5
+  read -172 r14 r4
+  or r0 r1 r6
+  read -100 r14 r1
+  load 0 r3
+  load 15 r7
+  beq r5 r7 .L170
+  or r0 r3 r1
+  jump .L171
+.L170:
+  add r2 8 r2
+  readh 0 r2 r2
+  add r1 r2 r2
+  load 4 r1
+  slt r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L171:
+  beq r1 r0 .L174
+  load 1 r1
+  or r0 r1 r4
+.L174:
+  write -104 r14 r4
+  or r0 r6 r2
+  or r0 r4 r5
+  add r14 -200 r4
+  savpc r15
+  add r15 12 r15
+  jump cast
+  read -204 r14 r1
+  shiftl r1 3 r4
+  addr2reg curf r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  read -104 r14 r4
+  read -108 r14 r5
+  read -176 r14 r2
+  write -312 r14 r1
+  read -312 r14 r1
+  write -196 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r2
+  read -196 r14 r7
+  read -200 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump iins
+  or r0 r1 r2
+  read -136 r14 r3
+  read -112 r14 r5
+  read -156 r14 r7
+  read -152 r14 r6
+  read -144 r14 r4
+  read -160 r14 r1
+  write -316 r14 r2
+  load32 -12 r2
+  sub r13 r2 r13
+  read -316 r14 r2
+  write -200 r14 r2
+.L175:
+  and r3 r4 r2
+  load 1 r4
+  write -120 r14 r4
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  write -116 r14 r2
+  read -176 r14 r2
+  read -144 r14 r4
+  read -116 r14 r12
+  bne r12 r0 .L178
+  read -204 r14 r4
+  add r4 r5 r4
+  add r1 8 r5
+  readh 0 r5 r5
+  slt r4 r5 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+  write -124 r14 r4
+  read -172 r14 r4
+  read -144 r14 r5
+  read -124 r14 r12
+  write -128 r14 r12
+  jump .L179
+.L178:
+  or r0 r4 r5
+  read -172 r14 r4
+  read -120 r14 r12
+  write -128 r14 r12
+.L179:
+  read -128 r14 r12
+  beq r12 r0 .L183
+  or r0 r2 r6
+  and r3 r5 r1
+  write -132 r14 r1
+  or r0 r4 r5
+  add r14 -200 r4
+  savpc r15
+  add r15 12 r15
+  jump cast
+  read -132 r14 r4
+  addr2reg curf r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  read -172 r14 r4
+  read -176 r14 r6
+  write -304 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -304 r14 r7
+  read -200 r14 r6
+  load 11 r5
+  savpc r15
+  add r15 12 r15
+  jump iins
+  or r0 r1 r4
+  read -136 r14 r3
+  read -156 r14 r7
+  read -176 r14 r6
+  or r0 r6 r2
+  read -152 r14 r6
+  read -144 r14 r5
+  read -160 r14 r1
+  write -308 r14 r4
+  load32 -12 r4
+  sub r13 r4 r13
+  read -308 r14 r4
+  write -200 r14 r4
+.L183:
+  xor r3 -1 r4
+  and r5 r4 r4
+  xor r4 r0 r4
+  sltu r0 r4 r4
+  write -140 r14 r4
+  read -148 r14 r4
+  read -144 r14 r5
+  read -140 r14 r12
+  bne r12 r0 .L185
+  or r0 r2 r6
+  jump .L187
+.L185:
+  xor r3 -1 r3
+  and r5 r3 r5
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r14 -300 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -300 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -300 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -300 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump def
+  write -288 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -288 r14 r1
+  write -196 r14 r1
+  load 0 r1
+  write -180 r14 r1
+  read -180 r14 r5
+  read -196 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r7
+  read -172 r14 r4
+  read -164 r14 r3
+  read -168 r14 r2
+  read -176 r14 r6
+  read -144 r14 r5
+  read -160 r14 r1
+  bne r7 r0 .L262
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -196 r14 r7
+  read -200 r14 r6
+  load 12 r5
+  savpc r15
+  add r15 12 r15
+  jump iins
+  or r0 r1 r2
+  read -148 r14 r4
+  read -176 r14 r6
+  read -144 r14 r5
+  read -160 r14 r1
+  write -284 r14 r2
+  load32 -12 r2
+  sub r13 r2 r13
+  read -284 r14 r2
+  write -200 r14 r2
+.L187:
+  bne r5 r4 .L189
+  add r1 10 r1
+  readh 0 r1 r5
+  add r14 -200 r4
+  savpc r15
+  add r15 12 r15
+  jump cast
+.L189:
+  read -200 r14 r1
+  jump .L265
+.L190:
+  read -164 r14 r3
+  or r0 r1 r6
+  or r0 r4 r5
+  or r0 r2 r1
+  read -168 r14 r2
+  jump .L262
+.L191:
+  or r0 r6 r5
+  beq r5 r0 .L114
+  or r0 r5 r1
+  sltu r1 r0 r1
+.L195:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -156 r14 r2
+  read -148 r14 r4
+  read -152 r14 r3
+  read -144 r14 r8
+  read -160 r14 r1
+  load32 -24 r5
+  sub r13 r5 r13
+  jump .L114
+.L196:
+  or r0 r7 r5
+  read -144 r14 r8
+  bne r5 r0 .L114
+  read -164 r14 r3
+  read -168 r14 r2
+  read -176 r14 r6
+  or r0 r8 r5
+  jump .L262
+.L199:
+  read -164 r14 r3
+  read -168 r14 r2
+  read -176 r14 r6
+  read -144 r14 r5
+  jump .L262
+.L200:
+  read -152 r14 r6
+  addr2reg ilog r12
+  read 0 r12 r3
+  or r0 r6 r2
+.L203:
+  write -44 r14 r3
+  addr2reg ilog r12
+  read 0 r12 r4
+  addr2reg nlog r12
+  read 0 r12 r5
+  load 28 r6
+  mults r5 r6 r5
+  add r4 r5 r4
+  bge r3 r4 .L218
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  read 0 r1 r4
+  shiftl r4 31 r4
+  shiftr r4 31 r5
+  load 0 r4
+  beq r5 r0 .L207
+  add r1 4 r4
+  read 0 r4 r4
+  add r3 48 r5
+  read 0 r5 r5
+  xor r4 r5 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L207:
+  beq r4 r0 .L211
+  add r1 12 r1
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -44 r14 r1
+  read -152 r14 r3
+  read -160 r14 r2
+  beq r4 r0 .L211
+  add r1 12 r4
+  add r4 4 r4
+  read 0 r4 r4
+  add r2 4 r5
+  read 0 r5 r5
+  bne r4 r5 .L211
+  add r1 12 r4
+  add r4 8 r4
+  readh 0 r4 r4
+  add r2 8 r5
+  readh 0 r5 r5
+  beq r4 r5 .L213
+.L211:
+  add r1 28 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+  jump .L203
+.L213:
+  or r0 r1 r3
+  read -172 r14 r4
+  read -176 r14 r6
+  read -144 r14 r5
+  or r0 r2 r1
+  read -148 r14 r2
+  add r3 12 r3
+  add r3 12 r3
+  read 0 r3 r3
+  read 0 r3 r3
+  write -200 r14 r3
+  bne r5 r2 .L216
+  or r0 r1 r2
+  add r1 10 r1
+  readh 0 r1 r5
+  add r14 -200 r4
+  savpc r15
+  add r15 12 r15
+  jump cast
+  jump .L217
+.L216:
+  or r0 r6 r1
+  or r0 r4 r5
+  add r14 -200 r4
+  savpc r15
+  add r15 12 r15
+  jump cast
+  read -144 r14 r5
+  or r0 r5 r4
+  addr2reg curf r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  or r0 r1 r2
+  read -172 r14 r4
+  read -176 r14 r1
+  write -276 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  read -276 r14 r7
+  read -200 r14 r6
+  load 11 r5
+  savpc r15
+  add r15 12 r15
+  jump iins
+  write -280 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -280 r14 r1
+  write -200 r14 r1
+.L217:
+  read -200 r14 r1
+  jump .L265
+.L218:
+  or r0 r2 r6
+  read 0 r6 r2
+.L220:
+  write -40 r14 r2
+  beq r2 r0 .L226
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  add r14 -272 r5
+  add r2 0 r3
+  read 0 r3 r3
+  add r14 -272 r4
+  add r4 0 r4
+  write 0 r4 r3
+  add r2 4 r3
+  read 0 r3 r3
+  add r14 -272 r4
+  add r4 4 r4
+  write 0 r4 r3
+  add r2 8 r2
+  read 0 r2 r2
+  add r14 -272 r3
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump killsl
+  or r0 r1 r3
+  read -40 r14 r1
+  read -160 r14 r2
+  bne r3 r0 .L225
+  add r1 20 r1
+  read 0 r1 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L220
+.L225:
+  read -164 r14 r3
+  read -176 r14 r6
+  read -144 r14 r5
+  or r0 r2 r1
+  read -168 r14 r2
+  jump .L262
+.L226:
+  read -168 r14 r4
+  read -176 r14 r2
+  read -152 r14 r6
+  read -144 r14 r5
+  add r6 80 r3
+  read 0 r3 r3
+  xor r3 r0 r7
+  sltu r7 1 r7
+  write -16 r14 r7
+  read -164 r14 r7
+  read -16 r14 r12
+  bne r12 r0 .L261
+  load 1 r4
+  beq r3 r4 .L252
+  add r1 10 r1
+  readh 0 r1 r5
+  addr2reg curf r12
+  read 0 r12 r6
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  write -244 r14 r1
+  read -244 r14 r1
+  write -200 r14 r1
+  load 24 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -32 r14 r1
+  addr2reg nlog r12
+  read 0 r12 r1
+  add r1 1 r5
+  addr2reg nlog r12
+  write 0 r12 r5
+  addr2reg ilog r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -32 r14 r5
+  read -152 r14 r6
+  read -160 r14 r1
+  addr2reg ilog r12
+  read 0 r12 r2
+  addr2reg nlog r12
+  read 0 r12 r3
+  load 1 r4
+  sub r3 r4 r3
+  load 28 r4
+  mults r3 r4 r3
+  add r2 r3 r3
+  read 0 r3 r2
+  and r2 -2 r4
+  load 1 r2
+  or r2 r4 r2
+  write 0 r3 r2
+  add r6 48 r2
+  read 0 r2 r2
+  add r3 4 r4
+  write 0 r4 r2
+  or r0 r6 r2
+  add r3 12 r6
+  read 0 r1 r4
+  write 0 r6 r4
+  add r1 4 r4
+  add r6 4 r6
+  read 0 r4 r7
+  write 0 r6 r7
+  add r4 4 r4
+  add r6 4 r6
+  read 0 r4 r4
+  write 0 r6 r4
+  add r3 12 r3
+  add r3 12 r3
+  write 0 r3 r5
+  read -200 r14 r3
+  write 0 r5 r3
+  add r1 10 r1
+  readh 0 r1 r1
+  add r5 16 r3
+  write 0 r3 r1
+  add r2 80 r1
+  read 0 r1 r4
+  add r5 12 r1
+  write 0 r1 r4
+  load 1 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -32 r14 r5
+  add r5 4 r2
+  write 0 r2 r1
+  add r5 12 r1
+  read 0 r1 r4
+  load 1 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r3
+  read -32 r14 r5
+  read -148 r14 r4
+  read -176 r14 r6
+  read -152 r14 r2
+  read -160 r14 r1
+  add r5 8 r5
+  write 0 r5 r3
+  load 0 r3
+  or r0 r6 r12
+  or r0 r3 r6
+  or r0 r12 r3
+.L231:
+  write -20 r14 r6
+  add r2 80 r5
+  read 0 r5 r5
+  bge r6 r5 .L248
+  add r2 76 r2
+  read 0 r2 r2
+  shiftl r6 2 r5
+  add r2 r5 r2
+  read 0 r2 r5
+  write -24 r14 r5
+  add r5 24 r2
+  read 0 r2 r6
+  load 0 r2
+  beq r6 r0 .L234
+  or r0 r2 r6
+  jump .L235
+.L234:
+  add r5 32 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r6
+.L235:
+  load 0 r2
+  bne r6 r0 .L237
+  or r0 r2 r6
+  jump .L238
+.L237:
+  read 0 r3 r2
+  xor r2 2 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r6
+.L238:
+  load 0 r2
+  beq r6 r0 .L240
+  add r5 116 r2
+  read 0 r2 r2
+  add r3 8 r3
+  read 0 r3 r3
+  add r3 116 r3
+  read 0 r3 r3
+  slt r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L240:
+  bne r2 r0 .L242
+  load 2 r2
+  write -192 r14 r2
+  jump .L243
+.L242:
+  load 1 r2
+  write -192 r14 r2
+.L243:
+  add r14 -192 r2
+  add r2 8 r2
+  write 0 r2 r5
+  add r5 8 r2
+  read 0 r2 r2
+  add r14 -192 r3
+  add r3 4 r3
+  write 0 r3 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r3
+  add r14 -192 r2
+  write 0 r3 r2
+  load 0 r7
+  or r0 r5 r6
+  or r0 r4 r5
+  add r14 -240 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -240 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -240 r3
+  add r3 4 r3
+  write 0 r3 r2
+  or r0 r1 r2
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -240 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump def
+  write -228 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -228 r14 r4
+  write -28 r14 r4
+  write -196 r14 r4
+  load 0 r1
+  write -180 r14 r1
+  read -180 r14 r5
+  read -196 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r7
+  read -20 r14 r6
+  read -24 r14 r5
+  read -32 r14 r4
+  read -176 r14 r1
+  read -152 r14 r3
+  read -160 r14 r2
+  bne r7 r0 .L247
+  add r4 4 r4
+  read 0 r4 r4
+  shiftl r6 2 r7
+  add r4 r7 r7
+  read -28 r14 r4
+  write 0 r7 r4
+  read -32 r14 r4
+  add r4 8 r4
+  read 0 r4 r4
+  shiftl r6 2 r7
+  add r4 r7 r7
+  read -148 r14 r4
+  write 0 r7 r5
+  read -32 r14 r5
+  add r6 1 r6
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+  or r0 r1 r12
+  or r0 r3 r1
+  or r0 r12 r3
+  jump .L231
+.L247:
+  read -164 r14 r3
+  or r0 r1 r6
+  read -144 r14 r5
+  or r0 r2 r1
+  read -168 r14 r2
+  jump .L262
+.L248:
+  or r0 r4 r2
+  read -172 r14 r4
+  or r0 r3 r6
+  read -144 r14 r5
+  beq r5 r2 .L251
+  or r0 r4 r5
+  add r14 -200 r4
+  savpc r15
+  add r15 12 r15
+  jump cast
+  read -144 r14 r5
+  or r0 r5 r1
+  addr2reg curf r12
+  read 0 r12 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  read -172 r14 r4
+  read -176 r14 r6
+  write -220 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -220 r14 r7
+  read -200 r14 r6
+  load 11 r5
+  savpc r15
+  add r15 12 r15
+  jump iins
+  write -224 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -224 r14 r1
+  write -200 r14 r1
+.L251:
+  read -200 r14 r1
+  jump .L265
+.L252:
+  or r0 r2 r12
+  or r0 r6 r2
+  or r0 r12 r6
+  add r2 76 r2
+  read 0 r2 r2
+  add r2 0 r3
+  or r0 r6 r2
+  read 0 r3 r6
+  write -36 r14 r6
+  add r6 116 r3
+  read 0 r3 r3
+  add r2 8 r4
+  read 0 r4 r4
+  add r4 116 r4
+  read 0 r4 r4
+  bges r3 r4 .L255
+  load 345 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.25 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -36 r14 r6
+  read -176 r14 r2
+  read -144 r14 r5
+  read -160 r14 r1
+.L255:
+  read 0 r2 r3
+  write -192 r14 r3
+  add r2 4 r2
+  add r14 -192 r3
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  add r6 24 r2
+  read 0 r2 r3
+  load 1 r2
+  bne r3 r0 .L257
+  add r6 32 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L257:
+  beq r2 r0 .L259
+  load 2 r2
+  write -192 r14 r2
+.L259:
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r3
+  add r14 -192 r2
+  write 0 r3 r2
+  load 0 r7
+  add r14 -260 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -260 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -260 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -260 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump def
+  write -248 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -248 r14 r1
+  write -196 r14 r1
+  load 0 r1
+  write -180 r14 r1
+  read -180 r14 r5
+  read -196 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -164 r14 r3
+  read -168 r14 r2
+  read -176 r14 r6
+  read -144 r14 r5
+  read -160 r14 r1
+  bne r4 r0 .L262
+  read -196 r14 r1
+  jump .L265
+.L261:
+  or r0 r7 r3
+  or r0 r2 r6
+  or r0 r4 r2
+.L262:
+  addr2reg curf r12
+  read 0 r12 r4
+  add r4 16 r4
+  write 0 r4 r3
+  addr2reg nlog r12
+  write 0 r12 r2
+  read 0 r6 r2
+  load 1 r3
+  bne r2 r3 .L264
+  add r14 -360 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -360 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -360 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -360 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump loadref
+  write -348 r14 r1
+  read -348 r14 r1
+  jump .L265
+.L264:
+  load 0 r1
+  write -216 r14 r1
+  read -216 r14 r1
+.L265:
+  read -364 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function def */
+
+
+.text
+; function icmp
+icmp:
+  add r4 4 r1
+  read 0 r1 r1
+  add r5 4 r2
+  read 0 r2 r2
+  sub r1 r2 r1
+  bne r1 r0 .L280
+  read 0 r4 r1
+  shiftl r1 31 r2
+  shiftr r2 31 r3
+  load 0 r2
+  beq r3 r0 .L271
+  read 0 r5 r2
+  shiftl r2 31 r2
+  shiftr r2 31 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L271:
+  bne r2 r0 .L279
+  shiftl r1 31 r2
+  shiftr r2 31 r2
+  bne r2 r0 .L278
+  read 0 r5 r2
+  shiftl r2 31 r3
+  shiftr r3 31 r3
+  bne r3 r0 .L277
+  add r4 8 r3
+  read 0 r3 r3
+  add r5 8 r4
+  read 0 r4 r4
+  sub r3 r4 r3
+  bne r3 r0 .L276
+  shiftr r1 1 r1
+  shiftr r2 1 r2
+  sub r1 r2 r1
+  jump .L280
+.L276:
+  or r0 r3 r1
+  jump .L280
+.L277:
+  load 1 r1
+  jump .L280
+.L278:
+  load32 -1 r1
+  jump .L280
+.L279:
+  load 0 r1
+.L280:
+  jumpr 0 r15
+
+/* end function icmp */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "\012> After loadref elimination:\012\000"
+/* end data */
+
+
+.text
+; function loadopt
+.global loadopt
+loadopt:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 116 r13
+  write -64 r14 r4
+  addr2reg curf r12
+  write 0 r12 r4
+  load 0 r6
+  load 28 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -64 r14 r4
+  addr2reg ilog r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg nlog r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg inum r12
+  write 0 r12 r1
+  read 0 r4 r1
+.L284:
+  write -56 r14 r1
+  beq r1 r0 .L291
+  add r1 4 r2
+  read 0 r2 r2
+.L286:
+  write -60 r14 r2
+  add r1 4 r3
+  read 0 r3 r3
+  add r1 8 r4
+  read 0 r4 r4
+  shiftl r4 4 r4
+  add r3 r4 r3
+  bge r2 r3 .L290
+  read 0 r2 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 59 r4
+  sub r3 r4 r4
+  load 6 r3
+  sltu r3 r4 r3
+  xor r3 1 r3
+  beq r3 r0 .L289
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump loadsz
+  or r0 r1 r3
+  read -60 r14 r2
+  read -56 r14 r1
+  add r2 8 r4
+  add r4 0 r4
+  read 0 r4 r5
+  read 0 r2 r4
+  shiftr r4 30 r4
+  write -88 r14 r5
+  add r14 -88 r5
+  add r5 4 r5
+  load 0 r6
+  write 0 r5 r6
+  add r5 4 r5
+  shiftl r4 16 r4
+  load32 65535 r6
+  and r3 r6 r6
+  or r4 r6 r4
+  write 0 r5 r4
+  add r1 4 r4
+  read 0 r4 r4
+  sub r2 r4 r4
+  shiftrs r4 31 r5
+  shiftr r5 28 r5
+  add r4 r5 r4
+  shiftrs r4 4 r5
+  load 0 r4
+  write -76 r14 r4
+  add r14 -76 r4
+  add r4 4 r4
+  write 0 r4 r5
+  add r4 4 r4
+  write 0 r4 r1
+  shiftl r3 3 r3
+  load 1 r4
+  sub r3 r4 r4
+  load 1 r3
+  shiftl r3 r4 r3
+  shiftl r3 1 r3
+  load 1 r4
+  sub r3 r4 r5
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r4
+  add r14 -76 r3
+  write 0 r4 r3
+  or r0 r2 r7
+  or r0 r1 r6
+  add r14 -108 r4
+  add r14 -88 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -108 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -88 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -108 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -88 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -108 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump def
+  or r0 r1 r3
+  read -60 r14 r2
+  read -56 r14 r1
+  write -96 r14 r3
+  load32 -12 r3
+  sub r13 r3 r13
+  add r2 8 r3
+  add r3 4 r4
+  read -96 r14 r3
+  write 0 r4 r3
+.L289:
+  add r2 16 r2
+  jump .L286
+.L290:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L284
+.L291:
+  addr2reg ilog r12
+  read 0 r12 r4
+  addr2reg nlog r12
+  read 0 r12 r5
+  addr2reg icmp r7
+  load 28 r6
+  savpc r15
+  add r15 12 r15
+  jump qsort
+  addr2reg nlog r12
+  read 0 r12 r1
+  add r1 1 r5
+  addr2reg ilog r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -64 r14 r4
+  add r4 28 r1
+  read 0 r1 r1
+  addr2reg ilog r12
+  read 0 r12 r2
+  addr2reg nlog r12
+  read 0 r12 r3
+  load 28 r4
+  mults r3 r4 r3
+  add r2 r3 r2
+  add r2 4 r2
+  write 0 r2 r1
+  load 0 r6
+  load 16 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -64 r14 r4
+  write -92 r14 r1
+  addr2reg ilog r12
+  read 0 r12 r3
+  load 0 r1
+  or r0 r1 r2
+.L293:
+  write -52 r14 r2
+  add r4 28 r1
+  read 0 r1 r1
+  bge r2 r1 .L325
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r2 2 r5
+  add r1 r5 r1
+  read 0 r1 r1
+  write -48 r14 r1
+.L295:
+  add r3 4 r5
+  read 0 r5 r6
+  load 0 r5
+  bne r6 r2 .L297
+  read 0 r3 r5
+  shiftl r5 31 r5
+  shiftr r5 31 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L297:
+  beq r5 r0 .L300
+  read 0 r1 r5
+  add r3 12 r6
+  add r6 12 r6
+  read 0 r6 r6
+  add r6 20 r6
+  write 0 r6 r5
+  add r3 12 r5
+  add r5 12 r5
+  read 0 r5 r5
+  write 0 r1 r5
+  add r3 28 r3
+  jump .L295
+.L300:
+  load 0 r5
+  load 0 r4
+.L301:
+  write -12 r14 r4
+  write -28 r14 r3
+  add r3 4 r6
+  read 0 r6 r7
+  or r0 r2 r6
+  load 0 r2
+  bne r7 r6 .L304
+  add r3 8 r2
+  read 0 r2 r2
+  xor r2 r5 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L304:
+  bne r2 r0 .L322
+  add r1 8 r2
+  read 0 r2 r2
+  beq r5 r2 .L319
+  add r1 4 r1
+  read 0 r1 r1
+  or r0 r5 r2
+  add r5 1 r5
+  write -24 r14 r5
+  shiftl r2 4 r2
+  add r1 r2 r6
+  write -20 r14 r6
+  read 0 r6 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 59 r2
+  sub r1 r2 r2
+  load 0 r1
+  load 6 r7
+  bgt r2 r7 .L308
+  add r6 8 r1
+  add r1 4 r1
+  load 0 r2
+  write -88 r14 r2
+  read -88 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -12 r14 r4
+  read -28 r14 r3
+  read -20 r14 r6
+  read -24 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L308:
+  beq r1 r0 .L318
+  read 0 r6 r1
+  shiftl r1 2 r2
+  shiftr r2 2 r5
+  or r0 r1 r2
+  load 66 r1
+  add r1 r5 r1
+  load 59 r5
+  sub r1 r5 r1
+  write -16 r14 r1
+  shiftl r2 2 r5
+  shiftr r5 2 r5
+  load 59 r7
+  sub r5 r7 r5
+  load 7 r7
+  blt r5 r7 .L312
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -12 r14 r4
+  read -28 r14 r3
+  read -16 r14 r1
+  read -20 r14 r6
+  read -24 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+  jump .L313
+.L312:
+  shiftl r5 2 r7
+  addr2reg .Ljt312 r5
+  add r5 r7 r7
+  read -24 r14 r5
+  read 0 r7 r7
+  jumpr 0 r7
+.L313:
+  load32 1073741823 r2
+  and r1 r2 r1
+  read 0 r6 r2
+  load32 -1073741824 r7
+  and r2 r7 r2
+  or r1 r2 r1
+  write 0 r6 r1
+  jump .L317
+.L314:
+  shiftr r2 30 r5
+  load 1 r7
+  xor r5 r7 r7
+  sltu r7 1 r7
+  read -24 r14 r5
+  beq r7 r0 .L316
+  read -24 r14 r5
+  load32 1073741823 r7
+  and r1 r7 r1
+  load32 -1073741824 r7
+  and r2 r7 r2
+  or r1 r2 r1
+  write 0 r6 r1
+  jump .L317
+.L316:
+  or r0 r2 r1
+  load32 -1073741824 r2
+  and r1 r2 r2
+  load 88 r1
+  or r1 r2 r1
+  write 0 r6 r1
+.L317:
+  add r6 8 r1
+  add r1 4 r1
+  add r6 8 r2
+  add r2 0 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  add r6 8 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+.L318:
+  write -40 r14 r6
+  write -32 r14 r5
+  write -36 r14 r3
+  jump .L324
+.L319:
+  or r0 r4 r6
+  add r1 8 r2
+  write 0 r2 r6
+  add r1 4 r4
+  read -92 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump idup
+  read -28 r14 r3
+  read -52 r14 r2
+  read -64 r14 r4
+  add r2 1 r2
+  jump .L293
+.L322:
+  or r0 r3 r1
+  add r3 28 r3
+  add r1 12 r6
+  write -40 r14 r6
+  write -32 r14 r5
+  write -36 r14 r3
+.L324:
+  add r4 1 r4
+  write -44 r14 r4
+  or r0 r4 r5
+  add r14 -92 r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -40 r14 r6
+  read -32 r14 r5
+  read -36 r14 r3
+  read -44 r14 r4
+  read -48 r14 r1
+  read -92 r14 r2
+  load 1 r7
+  sub r4 r7 r7
+  shiftl r7 4 r7
+  add r2 r7 r2
+  read 0 r6 r7
+  write 0 r2 r7
+  add r6 4 r6
+  add r2 4 r2
+  read 0 r6 r7
+  write 0 r2 r7
+  add r6 4 r6
+  add r2 4 r7
+  read 0 r6 r2
+  write 0 r7 r2
+  read -52 r14 r2
+  add r6 4 r6
+  add r7 4 r7
+  read 0 r6 r6
+  write 0 r7 r6
+  jump .L301
+.L325:
+  read -92 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  addr2reg ilog r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  addr2reg debug+77 r12
+  readb 0 r12 r1
+  beq r1 r0 .L327
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.28 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -64 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+.L327:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt312:
+  .int .L313
+  .int .L313
+  .int .L313
+  .int .L313
+  .int .L314
+  .int .L314
+  .int .L316
+
+/* end function loadopt */
+
+.data
+.balign 4
+curf:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+inum:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+ilog:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+nlog:
+	.fill 4,1,0
+/* end data */
+
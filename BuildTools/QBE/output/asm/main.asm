@@ -0,0 +1,1583 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+.data
+.balign 1
+.globl debug
+debug:
+	.fill 65,1,0
+	.byte 0
+	.fill 1,1,0
+	.byte 0
+	.fill 2,1,0
+	.byte 0
+	.fill 2,1,0
+	.byte 0
+	.fill 2,1,0
+	.byte 0
+	.byte 0
+	.byte 0
+	.byte 0
+	.byte 0
+	.fill 1,1,0
+	.byte 0
+	.byte 0
+	.fill 7,1,0
+/* end data */
+
+.data
+.balign 4
+tlist:
+	.int T_b32p3+0
+	.int 0
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "/* end data */\012\012\000"
+/* end data */
+
+
+.text
+; function data
+data:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  read 0 r4 r1
+  load 0 r2
+  bne r1 r0 .L19
+  or r0 r2 r3
+  jump .L20
+.L19:
+  xor r1 1 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L20:
+  load 0 r2
+  beq r3 r0 .L22
+  xor r1 6 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L22:
+  load 0 r1
+  bne r2 r0 .L24
+  or r0 r1 r2
+  jump .L25
+.L24:
+  add r4 25 r1
+  readb 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L25:
+  load 0 r1
+  beq r2 r0 .L27
+  add r4 24 r1
+  readb 0 r1 r1
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L27:
+  beq r1 r0 .L29
+  add r4 16 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump inlref
+  read -16 r14 r4
+.L29:
+  addr2reg dbg r12
+  read 0 r12 r1
+  bne r1 r0 .L32
+  addr2reg outf r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump emitdat
+  read -16 r14 r4
+  read 0 r4 r1
+  load 1 r2
+  bne r1 r2 .L32
+  addr2reg outf r12
+  read 0 r12 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  savpc r15
+  add r15 12 r15
+  jump freeall
+.L32:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "**** Function %s ****\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "\012> After parsing:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "fn->rpo[0] == fn->start\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "BuildTools/QBE/main.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "/* end function %s */\012\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "\012\000"
+/* end data */
+
+
+.text
+; function compile
+compile:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  addr2reg dbg r12
+  read 0 r12 r1
+  beq r1 r0 .L37
+  add r4 54 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L37:
+  addr2reg debug+80 r12
+  readb 0 r12 r1
+  beq r1 r0 .L39
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.11 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+  read -16 r14 r4
+.L39:
+  savpc r15
+  add r15 12 r15
+  jump fillrpo
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillpreds
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump promote
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump ssa
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump ssacheck
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillalias
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump loadopt
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillalias
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump coalesce
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump ssacheck
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump copy
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fold
+  read -16 r14 r4
+  addr2reg olevel r12
+  read 0 r12 r2
+  load 0 r1
+  beq r2 r0 .L41
+  load 1 r1
+  slt r1 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump loopopt
+  read -16 r14 r4
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L41:
+  beq r1 r0 .L43
+  savpc r15
+  add r15 12 r15
+  jump ssacheck
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump copy
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fold
+  read -16 r14 r4
+.L43:
+  savpc r15
+  add r15 12 r15
+  jump profile
+  read -16 r14 r4
+  beq r1 r0 .L45
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -16 r14 r4
+.L45:
+  addr2reg T+76 r12
+  read 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump simpl
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillpreds
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -16 r14 r4
+  addr2reg T+80 r12
+  read 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillrpo
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filllive
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillloop
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillcost
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump spill
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rega
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillrpo
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump simpljmp
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillpreds
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillrpo
+  read -16 r14 r4
+  add r4 40 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  read 0 r4 r2
+  beq r1 r2 .L47
+  load 104 r6
+  addr2reg .Lstring.13 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r4
+.L47:
+  load 0 r1
+.L48:
+  add r4 28 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r2
+  beq r1 r2 .L51
+  add r4 40 r2
+  read 0 r2 r3
+  add r1 1 r2
+  shiftl r2 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  shiftl r1 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  add r3 44 r3
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L48
+.L51:
+  or r0 r1 r2
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 44 r2
+  load 0 r1
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump layout
+  read -16 r14 r4
+  addr2reg olevel r12
+  read 0 r12 r2
+  load 0 r1
+  beq r2 r0 .L55
+  addr2reg T+84 r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L55:
+  beq r1 r0 .L57
+  addr2reg T+84 r12
+  read 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -16 r14 r4
+.L57:
+  addr2reg dbg r12
+  read 0 r12 r1
+  beq r1 r0 .L59
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.15 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L60
+.L59:
+  addr2reg outf r12
+  read 0 r12 r5
+  addr2reg T+88 r12
+  read 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -16 r14 r4
+  or r0 r4 r1
+  addr2reg outf r12
+  read 0 r12 r4
+  add r1 54 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.14 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg outf r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump profdat
+.L60:
+  savpc r15
+  add r15 12 r15
+  jump freeall
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function compile */
+
+
+.text
+; function func
+func:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  addr2reg T+72 r12
+  read 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump inlfn
+  read -16 r14 r4
+  bne r1 r0 .L66
+  savpc r15
+  add r15 12 r15
+  jump compile
+  jump .L67
+.L66:
+  savpc r15
+  add r15 12 r15
+  jump freeall
+.L67:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function func */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "hd:o:t:O:p:PH\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "-\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "w\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "cannot open '%s'\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "?\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "unknown target '%s'\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "%s [OPTIONS] {file.ssa, -}\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "\011%-11s prints this help\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "-h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "\011%-11s output to file\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "-o file\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "\011%-11s generate for a target among:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "-t <target>\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "\011%-11s \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "%s%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii " (default)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii ", \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "\011%-11s dump debug information\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "-d <flags>\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.39:
+	.ascii "\011%-11s 1: loop optimizations and scheduling, 2: also unroll\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "-O <level>\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.41:
+	.ascii "\011%-11s count block runs for a profile\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "-P\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "\011%-11s lay out blocks by a profile\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.44:
+	.ascii "-p <file>\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.45:
+	.ascii "\011%-11s save registers on the hardware stack\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.46:
+	.ascii "-H\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.47:
+	.ascii "r\000"
+/* end data */
+
+
+.text
+; function main
+.global main
+main:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  savpc r15
+  add r15 12 r15
+  jump sys_argc
+  write -40 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump sys_argv
+  write -44 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump utilinit
+  savpc r15
+  add r15 12 r15
+  jump parseinit
+  read -44 r14 r1
+  read -40 r14 r3
+  addr2reg T_b32p3 r12
+  read 0 r12 r2
+  addr2reg T r12
+  write 0 r12 r2
+  addr2reg T_b32p3+4 r12
+  read 0 r12 r2
+  addr2reg T+4 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+8 r12
+  read 0 r12 r2
+  addr2reg T+8 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+12 r12
+  read 0 r12 r2
+  addr2reg T+12 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+16 r12
+  read 0 r12 r2
+  addr2reg T+16 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+20 r12
+  read 0 r12 r2
+  addr2reg T+20 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+24 r12
+  read 0 r12 r2
+  addr2reg T+24 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+28 r12
+  read 0 r12 r2
+  addr2reg T+28 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+32 r12
+  read 0 r12 r2
+  addr2reg T+32 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+36 r12
+  read 0 r12 r2
+  addr2reg T+36 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+40 r12
+  read 0 r12 r2
+  addr2reg T+40 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+44 r12
+  read 0 r12 r2
+  addr2reg T+44 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+48 r12
+  read 0 r12 r2
+  addr2reg T+48 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+52 r12
+  read 0 r12 r2
+  addr2reg T+52 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+56 r12
+  read 0 r12 r2
+  addr2reg T+56 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+60 r12
+  read 0 r12 r2
+  addr2reg T+60 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+64 r12
+  read 0 r12 r2
+  addr2reg T+64 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+68 r12
+  read 0 r12 r2
+  addr2reg T+68 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+72 r12
+  read 0 r12 r2
+  addr2reg T+72 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+76 r12
+  read 0 r12 r2
+  addr2reg T+76 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+80 r12
+  read 0 r12 r2
+  addr2reg T+80 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+84 r12
+  read 0 r12 r2
+  addr2reg T+84 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+88 r12
+  read 0 r12 r2
+  addr2reg T+88 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+92 r12
+  read 0 r12 r2
+  addr2reg T+92 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+96 r12
+  read 0 r12 r2
+  addr2reg T+96 r12
+  write 0 r12 r2
+  addr2reg T_b32p3+100 r12
+  read 0 r12 r2
+  addr2reg T+100 r12
+  write 0 r12 r2
+  addr2reg __stdout_file r2
+  addr2reg outf r12
+  write 0 r12 r2
+.L71:
+  addr2reg .Lstring.19 r6
+  or r0 r1 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump getopt
+  or r0 r1 r2
+  read -44 r14 r1
+  read -40 r14 r3
+  write -48 r14 r2
+  load32 -1 r4
+  bne r2 r4 .L85
+.L72:
+  addr2reg optind r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  write -20 r14 r5
+  load 1 r1
+  beq r5 r0 .L74
+  or r0 r5 r1
+  addr2reg .Lstring.20 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -20 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L74:
+  bne r1 r0 .L77
+  or r0 r5 r1
+  addr2reg .Lstring.47 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fopen
+  or r0 r1 r4
+  read -20 r14 r5
+  write -16 r14 r4
+  bne r4 r0 .L79
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r6
+  addr2reg .Lstring.22 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  read -16 r14 r4
+  read -20 r14 r5
+  jump .L79
+.L77:
+  addr2reg __stdin_file r2
+  addr2reg .Lstring.20 r1
+  or r0 r2 r4
+  or r0 r1 r5
+.L79:
+  write -24 r14 r4
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  addr2reg func r1
+  write 0 r2 r1
+  addr2reg data r7
+  addr2reg dbgfile r6
+  savpc r15
+  add r15 12 r15
+  jump parse
+  load32 -12 r1
+  sub r13 r1 r13
+  addr2reg compile r4
+  savpc r15
+  add r15 12 r15
+  jump inlflush
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fclose
+  read -44 r14 r1
+  read -40 r14 r2
+  or r0 r2 r3
+  addr2reg optind r12
+  read 0 r12 r2
+  add r2 1 r2
+  addr2reg optind r12
+  write 0 r12 r2
+  blts r2 r3 .L72
+  addr2reg dbg r12
+  read 0 r12 r1
+  bne r1 r0 .L83
+  addr2reg outf r12
+  read 0 r12 r4
+  addr2reg T+92 r12
+  read 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+.L83:
+  load 0 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L85:
+  load 104 r4
+  beq r2 r4 .L129
+  load 104 r4
+  blt r2 r4 .L110
+  load 112 r3
+  beq r2 r3 .L108
+  load 112 r3
+  blt r2 r3 .L102
+  load 116 r3
+  beq r2 r3 .L91
+  load 116 r3
+  sltu r2 r3 r3
+  jump .L129
+.L91:
+  addr2reg optarg r12
+  read 0 r12 r4
+  addr2reg .Lstring.23 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  bne r1 r0 .L93
+  addr2reg T r4
+  savpc r15
+  add r15 12 r15
+  jump puts
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+.L93:
+  addr2reg tlist r1
+.L94:
+  write -28 r14 r1
+  read 0 r1 r2
+  bne r2 r0 .L97
+  addr2reg optarg r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.24 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  read -28 r14 r1
+.L97:
+  addr2reg optarg r12
+  read 0 r12 r4
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -28 r14 r1
+  beq r2 r0 .L99
+  add r1 4 r1
+  jump .L94
+.L99:
+  or r0 r1 r2
+  read -44 r14 r1
+  read -40 r14 r3
+  read 0 r2 r2
+  read 0 r2 r4
+  addr2reg T r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+4 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+8 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+12 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+16 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+20 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+24 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+28 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+32 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+36 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+40 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+44 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+48 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+52 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+56 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+60 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+64 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+68 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+72 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+76 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+80 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+84 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+88 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+92 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r4
+  addr2reg T+96 r12
+  write 0 r12 r4
+  add r2 4 r2
+  read 0 r2 r2
+  addr2reg T+100 r12
+  write 0 r12 r2
+  or r0 r3 r2
+  jump .L141
+.L102:
+  load 111 r3
+  beq r2 r3 .L104
+  load 111 r3
+  sltu r2 r3 r3
+  jump .L129
+.L104:
+  addr2reg optarg r12
+  read 0 r12 r4
+  addr2reg .Lstring.20 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -44 r14 r1
+  read -40 r14 r3
+  beq r2 r0 .L107
+  addr2reg optarg r12
+  read 0 r12 r4
+  addr2reg .Lstring.21 r5
+  savpc r15
+  add r15 12 r15
+  jump fopen
+  or r0 r1 r2
+  read -44 r14 r1
+  read -40 r14 r3
+  addr2reg outf r12
+  write 0 r12 r2
+  bne r2 r0 .L107
+  addr2reg optarg r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.22 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  read -44 r14 r1
+  read -40 r14 r3
+.L107:
+  or r0 r3 r2
+  jump .L141
+.L108:
+  addr2reg optarg r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump profread
+  read -44 r14 r1
+  read -40 r14 r3
+  or r0 r3 r2
+  jump .L141
+.L110:
+  load 80 r4
+  beq r2 r4 .L127
+  load 80 r4
+  blt r2 r4 .L120
+  load 100 r3
+  bne r2 r3 .L119
+.L113:
+  addr2reg optarg r12
+  read 0 r12 r1
+  readb 0 r1 r2
+  beq r2 r0 .L117
+  readb 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isalpha
+  beq r1 r0 .L116
+  addr2reg optarg r12
+  read 0 r12 r1
+  readb 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump toupper
+  or r0 r1 r2
+  addr2reg debug r1
+  add r1 r2 r2
+  load 1 r1
+  writeb 0 r2 r1
+  load 1 r1
+  addr2reg dbg r12
+  write 0 r12 r1
+.L116:
+  addr2reg optarg r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg optarg r12
+  write 0 r12 r1
+  jump .L113
+.L117:
+  read -44 r14 r1
+  read -40 r14 r3
+  or r0 r3 r2
+  jump .L141
+.L119:
+  load 100 r3
+  sltu r2 r3 r3
+  jump .L129
+.L120:
+  load 79 r4
+  beq r2 r4 .L126
+  load 79 r4
+  bge r2 r4 .L129
+  load 72 r4
+  beq r2 r4 .L124
+  load 72 r3
+  sltu r2 r3 r3
+  jump .L129
+.L124:
+  or r0 r3 r2
+  load 1 r3
+  addr2reg hwstack r12
+  write 0 r12 r3
+  jump .L141
+.L126:
+  addr2reg optarg r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump atoi
+  or r0 r1 r3
+  read -44 r14 r1
+  read -40 r14 r2
+  addr2reg olevel r12
+  write 0 r12 r3
+  jump .L141
+.L127:
+  or r0 r3 r2
+  load 1 r3
+  addr2reg profgen r12
+  write 0 r12 r3
+  jump .L141
+.L129:
+  load 104 r3
+  bne r2 r3 .L131
+  addr2reg __stdout_file r2
+  jump .L132
+.L131:
+  addr2reg __stderr_file r2
+.L132:
+  or r0 r2 r4
+  write -32 r14 r4
+  add r1 0 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.25 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.27 r6
+  addr2reg .Lstring.26 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.29 r6
+  addr2reg .Lstring.28 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.31 r6
+  addr2reg .Lstring.30 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.33 r6
+  addr2reg .Lstring.32 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg tlist r2
+  addr2reg .Lstring.33 r1
+  or r0 r1 r6
+  or r0 r4 r1
+.L134:
+  write -36 r14 r2
+  read 0 r2 r7
+  beq r7 r0 .L139
+  load 24 r2
+  sub r13 r2 r13
+  addr2reg .Lstring.34 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -36 r14 r2
+  read -32 r14 r1
+  load32 -24 r3
+  sub r13 r3 r13
+  read 0 r2 r3
+  addr2reg T_b32p3 r4
+  bne r3 r4 .L137
+  or r0 r1 r5
+  addr2reg .Lstring.35 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -36 r14 r2
+  read -32 r14 r1
+.L137:
+  add r2 4 r2
+  addr2reg .Lstring.36 r3
+  or r0 r3 r6
+  jump .L134
+.L139:
+  or r0 r1 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.15 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.38 r6
+  addr2reg .Lstring.37 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.40 r6
+  addr2reg .Lstring.39 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.42 r6
+  addr2reg .Lstring.41 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.44 r6
+  addr2reg .Lstring.43 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.46 r6
+  addr2reg .Lstring.45 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -48 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  xor r1 104 r1
+  sltu r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  read -44 r14 r1
+  read -40 r14 r2
+.L141:
+  or r0 r2 r3
+  jump .L71
+
+/* end function main */
+
+.data
+.balign 4
+.globl T
+T:
+	.fill 104,1,0
+/* end data */
+
+.data
+.balign 4
+.globl hwstack
+hwstack:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+outf:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+dbg:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+olevel:
+	.fill 4,1,0
+/* end data */
+
+
+.text
+; function dbgfile
+dbgfile:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg outf r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump emitdbgfile
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function dbgfile */
+
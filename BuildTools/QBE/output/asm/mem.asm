@@ -0,0 +1,2973 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "rtype(i->to) == RTmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "BuildTools/QBE/mem.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "slot %%%s is read but never stored to\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "\012> After slot promotion:\012\000"
+/* end data */
+
+
+.text
+; function promote
+.global promote
+promote:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  write -48 r14 r4
+  read 0 r4 r1
+  write -44 r14 r1
+  add r1 4 r2
+  read 0 r2 r2
+  or r0 r4 r6
+  or r0 r2 r4
+.L19:
+  write -28 r14 r4
+  add r1 4 r2
+  read 0 r2 r2
+  add r1 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r2
+  bge r4 r2 .L79
+  read 0 r4 r2
+  shiftl r2 2 r3
+  shiftr r3 2 r7
+  load 1 r3
+  load 83 r5
+  bgts r5 r7 .L22
+  shiftl r2 2 r2
+  shiftr r2 2 r3
+  load 85 r2
+  slt r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L23
+.L22:
+  or r0 r3 r2
+.L23:
+  bne r2 r0 .L78
+  add r4 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -28 r14 r4
+  read -44 r14 r1
+  read -48 r14 r6
+  beq r2 r0 .L26
+  load 23 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r4
+  read -44 r14 r1
+  read -48 r14 r6
+.L26:
+  or r0 r1 r2
+  add r6 4 r1
+  read 0 r1 r1
+  add r4 4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r1 r3 r1
+  write -32 r14 r1
+  add r1 88 r3
+  read 0 r3 r3
+  load 1 r5
+  bne r3 r5 .L77
+  add r1 84 r2
+  read 0 r2 r5
+  load32 -1 r3
+  load32 -1 r2
+  write -40 r14 r2
+.L29:
+  write -36 r14 r5
+  write -20 r14 r3
+  or r0 r1 r2
+  add r1 84 r1
+  read 0 r1 r1
+  add r2 92 r2
+  read 0 r2 r2
+  load 12 r6
+  mults r2 r6 r2
+  add r1 r2 r1
+  bge r5 r1 .L55
+  read 0 r5 r1
+  load 2 r2
+  bne r1 r2 .L54
+  add r5 8 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  write -24 r14 r4
+  read 0 r4 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 59 r5
+  sub r2 r5 r2
+  load 6 r5
+  bgt r2 r5 .L35
+  load 1 r2
+  load32 -1 r5
+  beq r3 r5 .L34
+  savpc r15
+  add r15 12 r15
+  jump loadsz
+  or r0 r1 r2
+  read -20 r14 r3
+  read -28 r14 r4
+  or r0 r4 r1
+  read -24 r14 r4
+  xor r3 r2 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L34:
+  bne r2 r0 .L51
+.L35:
+  read 0 r4 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 53 r3
+  sub r2 r3 r2
+  load 5 r3
+  bgt r2 r3 .L50
+  add r1 4 r1
+  add r4 8 r2
+  add r2 4 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r6
+  read -20 r14 r3
+  read -40 r14 r2
+  read -28 r14 r4
+  or r0 r4 r1
+  read -24 r14 r4
+  load 0 r5
+  bne r6 r0 .L38
+  or r0 r5 r1
+  jump .L39
+.L38:
+  add r1 4 r1
+  add r4 8 r2
+  add r2 0 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -20 r14 r3
+  read -40 r14 r2
+  read -24 r14 r4
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L39:
+  beq r1 r0 .L49
+  load 1 r1
+  load32 -1 r5
+  beq r3 r5 .L42
+  savpc r15
+  add r15 12 r15
+  jump storesz
+  read -20 r14 r3
+  read -40 r14 r2
+  read -24 r14 r4
+  xor r3 r1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L42:
+  beq r1 r0 .L48
+  load 1 r1
+  load32 -1 r3
+  beq r2 r3 .L45
+  read 0 r4 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 24 r3
+  mults r1 r3 r3
+  addr2reg optab r1
+  add r1 r3 r1
+  add r1 4 r1
+  add r1 0 r1
+  add r1 0 r1
+  readh 0 r1 r1
+  xor r2 r1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L45:
+  beq r1 r0 .L47
+  or r0 r4 r2
+  savpc r15
+  add r15 12 r15
+  jump storesz
+  or r0 r1 r3
+  read -36 r14 r5
+  read -28 r14 r4
+  read -24 r14 r2
+  read -32 r14 r1
+  read 0 r2 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 24 r6
+  mults r2 r6 r6
+  addr2reg optab r2
+  add r2 r6 r2
+  add r2 4 r2
+  add r2 0 r2
+  add r2 0 r2
+  readh 0 r2 r2
+  jump .L52
+.L47:
+  read -28 r14 r4
+  read -44 r14 r1
+  read -48 r14 r6
+  jump .L78
+.L48:
+  read -28 r14 r4
+  read -44 r14 r1
+  read -48 r14 r6
+  jump .L78
+.L49:
+  read -28 r14 r4
+  read -44 r14 r1
+  read -48 r14 r6
+  jump .L78
+.L50:
+  or r0 r1 r4
+  read -44 r14 r1
+  read -48 r14 r6
+  jump .L78
+.L51:
+  savpc r15
+  add r15 12 r15
+  jump loadsz
+  or r0 r1 r3
+  read -36 r14 r5
+  read -40 r14 r2
+  read -28 r14 r4
+  read -32 r14 r1
+.L52:
+  add r5 12 r5
+  write -40 r14 r2
+  jump .L29
+.L54:
+  read -44 r14 r1
+  read -48 r14 r6
+  jump .L78
+.L55:
+  read -40 r14 r2
+  read -32 r14 r1
+  load 90 r3
+  write 0 r4 r3
+  add r4 4 r3
+  load 0 r4
+  write 0 r3 r4
+  add r3 4 r3
+  load 0 r4
+  write 0 r3 r4
+  add r3 4 r4
+  load 0 r3
+  write 0 r4 r3
+  add r1 88 r4
+  read 0 r4 r3
+  load 1 r5
+  sub r3 r5 r3
+  write 0 r4 r3
+  add r1 84 r3
+  read 0 r3 r3
+  add r1 92 r4
+  read 0 r4 r4
+  load 12 r5
+  mults r4 r5 r4
+  add r3 r4 r5
+  write -16 r14 r5
+.L57:
+  write -4 r14 r3
+  beq r3 r5 .L76
+  add r3 8 r4
+  read 0 r4 r5
+  write -8 r14 r5
+  read 0 r5 r4
+  shiftl r4 2 r6
+  shiftr r6 2 r6
+  load 53 r7
+  sub r6 r7 r6
+  load 5 r7
+  sltu r7 r6 r7
+  xor r7 1 r7
+  read -48 r14 r6
+  bne r7 r0 .L74
+  or r0 r6 r4
+  load32 -1 r6
+  bne r2 r6 .L62
+  add r4 4 r1
+  read 0 r1 r1
+  add r5 8 r2
+  add r2 0 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -4 r14 r3
+  read -40 r14 r2
+  read -8 r14 r5
+  read -32 r14 r1
+  load32 -24 r4
+  sub r13 r4 r13
+.L62:
+  read 0 r5 r4
+  shiftl r4 2 r6
+  shiftr r6 2 r6
+  load 64 r7
+  beq r6 r7 .L69
+  load 64 r7
+  blt r6 r7 .L67
+  load 65 r7
+  beq r6 r7 .L70
+  load 65 r7
+  sltu r6 r7 r6
+  jump .L73
+.L67:
+  load 63 r7
+  beq r6 r7 .L69
+  load 63 r7
+  sltu r6 r7 r6
+  jump .L73
+.L69:
+  load 1 r6
+  beq r2 r6 .L73
+.L70:
+  shiftrs r2 1 r6
+  shiftr r4 30 r7
+  shiftrs r7 1 r7
+  xor r6 r7 r7
+  sltu r0 r7 r7
+  or r0 r4 r6
+  read -48 r14 r4
+  bne r7 r0 .L72
+  load32 -1073741824 r7
+  and r6 r7 r7
+  load 88 r6
+  or r6 r7 r7
+  or r0 r5 r6
+  read -16 r14 r5
+  write 0 r6 r7
+  jump .L75
+.L72:
+  load32 -1073741824 r7
+  and r6 r7 r7
+  load 82 r6
+  or r6 r7 r7
+  or r0 r5 r6
+  read -16 r14 r5
+  write 0 r6 r7
+  jump .L75
+.L73:
+  shiftl r4 2 r6
+  shiftr r6 2 r6
+  load 59 r7
+  sub r6 r7 r7
+  load 66 r6
+  add r6 r7 r6
+  write -12 r14 r6
+  read -12 r14 r6
+  load32 1073741823 r7
+  and r6 r7 r6
+  load32 -1073741824 r7
+  and r4 r7 r7
+  read -48 r14 r4
+  or r6 r7 r7
+  or r0 r5 r6
+  read -16 r14 r5
+  write 0 r6 r7
+  jump .L75
+.L74:
+  shiftl r2 30 r6
+  load32 -1073741824 r7
+  and r6 r7 r6
+  load32 1073741823 r7
+  and r4 r7 r7
+  read -48 r14 r4
+  or r6 r7 r6
+  write 0 r5 r6
+  load32 -1073741824 r7
+  and r6 r7 r7
+  load 88 r6
+  or r6 r7 r6
+  write 0 r5 r6
+  add r5 8 r6
+  add r6 4 r6
+  add r5 4 r7
+  read 0 r6 r6
+  write 0 r7 r6
+  add r5 8 r5
+  add r5 4 r6
+  load 0 r5
+  write 0 r6 r5
+  add r1 92 r7
+  read 0 r7 r5
+  load 1 r6
+  sub r5 r6 r6
+  read -16 r14 r5
+  write 0 r7 r6
+  add r1 88 r7
+  read 0 r7 r6
+  add r6 1 r6
+  write 0 r7 r6
+.L75:
+  add r3 12 r3
+  jump .L57
+.L76:
+  read -28 r14 r4
+  read -44 r14 r1
+  read -48 r14 r6
+  jump .L78
+.L77:
+  or r0 r2 r1
+.L78:
+  add r4 16 r4
+  jump .L19
+.L79:
+  addr2reg debug+77 r12
+  readb 0 r12 r1
+  beq r1 r0 .L81
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.11 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -48 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+.L81:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function promote */
+
+
+.text
+; function rin
+rin:
+  read 0 r4 r2
+  load 0 r1
+  bgts r2 r5 .L86
+  add r4 4 r1
+  read 0 r1 r1
+  slt r5 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L86:
+  jumpr 0 r15
+
+/* end function rin */
+
+
+.text
+; function rovlap
+rovlap:
+  add r4 4 r1
+  read 0 r1 r2
+  load 0 r1
+  bne r2 r0 .L91
+  or r0 r1 r3
+  jump .L92
+.L91:
+  add r5 4 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r3
+.L92:
+  load 0 r1
+  bne r3 r0 .L94
+  or r0 r1 r3
+  jump .L95
+.L94:
+  read 0 r4 r1
+  add r5 4 r3
+  read 0 r3 r3
+  slt r1 r3 r1
+  xor r1 0 r1
+  sltu r0 r1 r3
+.L95:
+  load 0 r1
+  beq r3 r0 .L97
+  read 0 r5 r1
+  slt r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L97:
+  jumpr 0 r15
+
+/* end function rovlap */
+
+
+.text
+; function radd
+radd:
+  add r4 4 r1
+  read 0 r1 r1
+  beq r1 r0 .L105
+  read 0 r4 r2
+  blts r5 r2 .L104
+  blts r5 r1 .L106
+  add r5 1 r1
+  add r4 4 r2
+  write 0 r2 r1
+  jump .L106
+.L104:
+  write 0 r4 r5
+  jump .L106
+.L105:
+  add r5 1 r1
+  write 0 r4 r5
+  add r4 4 r2
+  write 0 r2 r1
+.L106:
+  jumpr 0 r15
+
+/* end function radd */
+
+
+.text
+; function slot
+slot:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 52 r13
+  read 8 r14 r1
+  write -4 r14 r1
+  or r0 r7 r3
+  or r0 r6 r1
+  write -16 r14 r3
+  add r14 -44 r2
+  write 0 r2 r1
+  write -8 r14 r5
+  write -12 r14 r4
+  or r0 r3 r6
+  read -44 r14 r5
+  add r14 -40 r4
+  savpc r15
+  add r15 12 r15
+  jump getalias
+  read -4 r14 r1
+  read -16 r14 r3
+  read -8 r14 r5
+  read -12 r14 r2
+  read -40 r14 r4
+  load 1 r6
+  bne r4 r6 .L113
+  add r3 4 r3
+  read 0 r3 r3
+  add r14 -40 r4
+  add r4 4 r4
+  read 0 r4 r4
+  load 160 r6
+  mults r4 r6 r4
+  add r3 r4 r3
+  add r3 156 r4
+  read 0 r4 r4
+  blts r4 r0 .L112
+  add r14 -40 r4
+  add r4 8 r4
+  read 0 r4 r4
+  write 0 r5 r4
+  add r3 156 r3
+  read 0 r3 r3
+  load 36 r4
+  mults r3 r4 r3
+  add r1 r3 r1
+  write 0 r2 r1
+  load 1 r1
+  jump .L114
+.L112:
+  load 0 r1
+  jump .L114
+.L113:
+  load 0 r1
+.L114:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function slot */
+
+
+.text
+; function loadref
+loadref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  read 8 r14 r1
+  write -12 r14 r6
+  write -16 r14 r5
+  or r0 r4 r2
+  add r14 -28 r3
+  write 0 r3 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  read -28 r14 r6
+  add r14 -24 r5
+  add r14 -20 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  read -12 r14 r5
+  read -16 r14 r3
+  load32 -12 r2
+  sub r13 r2 r13
+  beq r1 r0 .L120
+  read -20 r14 r1
+  add r1 12 r2
+  read 0 r2 r1
+  read -24 r14 r4
+  shiftl r3 r4 r3
+  or r1 r3 r1
+  write 0 r2 r1
+  read -20 r14 r3
+  add r3 12 r2
+  read 0 r2 r1
+  add r3 8 r3
+  read 0 r3 r3
+  and r1 r3 r1
+  write 0 r2 r1
+  read -20 r14 r1
+  add r1 12 r2
+  read 0 r2 r2
+  beq r2 r0 .L120
+  add r1 16 r4
+  savpc r15
+  add r15 12 r15
+  jump radd
+.L120:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function loadref */
+
+
+.text
+; function store
+store:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  read 12 r14 r1
+  read 8 r14 r2
+  write -8 r14 r7
+  or r0 r2 r7
+  write -12 r14 r6
+  write -16 r14 r5
+  or r0 r4 r2
+  add r14 -28 r3
+  write 0 r3 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  read -28 r14 r6
+  add r14 -24 r5
+  add r14 -20 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  read -12 r14 r5
+  load32 -12 r2
+  sub r13 r2 r13
+  beq r1 r0 .L127
+  read -20 r14 r1
+  add r1 12 r2
+  read 0 r2 r2
+  bne r2 r0 .L126
+  add r1 28 r4
+  add r1 32 r1
+  read 0 r1 r2
+  add r2 1 r5
+  write 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -8 r14 r1
+  read -12 r14 r5
+  read -20 r14 r3
+  add r3 28 r2
+  read 0 r2 r2
+  add r3 32 r3
+  read 0 r3 r3
+  load 1 r4
+  sub r3 r4 r3
+  shiftl r3 3 r3
+  add r2 r3 r2
+  write 0 r2 r5
+  read -20 r14 r3
+  add r3 28 r2
+  read 0 r2 r2
+  add r3 32 r3
+  read 0 r3 r3
+  load 1 r4
+  sub r3 r4 r3
+  shiftl r3 3 r3
+  add r2 r3 r2
+  add r2 4 r2
+  write 0 r2 r1
+  jump .L127
+.L126:
+  add r1 16 r4
+  savpc r15
+  add r15 12 r15
+  jump radd
+  read -16 r14 r3
+  read -20 r14 r1
+  add r1 12 r2
+  read 0 r2 r1
+  read -24 r14 r4
+  shiftl r3 r4 r3
+  xor r3 -1 r3
+  and r1 r3 r1
+  write 0 r2 r1
+.L127:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function store */
+
+
+.text
+; function scmp
+scmp:
+  add r4 4 r1
+  read 0 r1 r2
+  add r5 4 r1
+  read 0 r1 r1
+  bne r2 r1 .L132
+  add r4 16 r1
+  read 0 r1 r1
+  add r5 16 r2
+  read 0 r2 r2
+  sub r1 r2 r1
+  jump .L133
+.L132:
+  sub r1 r2 r1
+.L133:
+  jumpr 0 r15
+
+/* end function scmp */
+
+
+.text
+; function maxrpo
+maxrpo:
+  add r4 116 r1
+  read 0 r1 r2
+  add r5 48 r1
+  read 0 r1 r1
+  bges r2 r1 .L138
+  add r4 116 r2
+  write 0 r2 r1
+.L138:
+  jumpr 0 r15
+
+/* end function maxrpo */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "(i+1)->op == Oblit1\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "rtype((i+1)->arg[0]) == RInt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "b->loop > n\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "\012> Slot coalescing:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "\011kill [\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii " %%%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii " ]\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "t->ndef == 1 && t->def\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "isret(b->jmp.type)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "u->type == UIns\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "i->op == Oargc\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "t->bid == ts->bid\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "sz >= 0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "\011fuse (% 3db) [\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "[%d,%d)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "{}\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "\011sums %u/%u/%u (killed/fused/total)\012\012\000"
+/* end data */
+
+
+.text
+; function coalesce
+.global coalesce
+coalesce:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 336 r13
+  write -240 r14 r4
+  load 0 r6
+  load 36 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -240 r14 r4
+  write -264 r14 r1
+  load 32 r2
+  load 0 r1
+  or r0 r1 r6
+  or r0 r2 r1
+.L143:
+  write -236 r14 r1
+  write -220 r14 r6
+  add r4 16 r2
+  read 0 r2 r2
+  bges r1 r2 .L154
+  or r0 r1 r2
+  add r4 4 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r2 r3 r3
+  add r1 r3 r1
+  write -228 r14 r1
+  add r1 156 r5
+  load32 -1 r3
+  write 0 r5 r3
+  add r1 128 r3
+  read 0 r3 r3
+  load 1 r5
+  beq r3 r5 .L146
+  or r0 r2 r1
+  jump .L153
+.L146:
+  add r1 148 r3
+  read 0 r3 r3
+  add r1 128 r5
+  beq r3 r5 .L148
+  or r0 r2 r1
+  jump .L153
+.L148:
+  add r1 96 r3
+  read 0 r3 r3
+  read 0 r4 r5
+  add r5 48 r5
+  read 0 r5 r5
+  beq r3 r5 .L150
+  or r0 r2 r1
+  jump .L153
+.L150:
+  add r1 128 r3
+  add r3 12 r3
+  read 0 r3 r3
+  load32 -1 r5
+  bne r3 r5 .L152
+  or r0 r2 r1
+  jump .L153
+.L152:
+  add r1 156 r1
+  write 0 r1 r6
+  add r6 1 r6
+  write -232 r14 r6
+  or r0 r6 r5
+  add r14 -264 r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -236 r14 r1
+  read -232 r14 r6
+  or r0 r1 r2
+  read -228 r14 r1
+  read -264 r14 r3
+  load 1 r4
+  sub r6 r4 r4
+  load 36 r5
+  mults r4 r5 r4
+  add r3 r4 r3
+  write -272 r14 r3
+  write 0 r3 r2
+  add r1 128 r2
+  add r2 12 r2
+  read 0 r2 r2
+  read -272 r14 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 128 r1
+  add r1 12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  read -272 r14 r2
+  add r2 8 r2
+  write 0 r2 r1
+  read -272 r14 r1
+  add r1 24 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r6
+  load 8 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r2
+  read -236 r14 r1
+  read -232 r14 r6
+  read -240 r14 r4
+  read -272 r14 r3
+  add r3 28 r3
+  write 0 r3 r2
+  read -272 r14 r2
+  add r2 32 r3
+  load 0 r2
+  write 0 r3 r2
+.L153:
+  add r1 1 r1
+  jump .L143
+.L154:
+  read 0 r4 r1
+.L155:
+  beq r1 r0 .L158
+  add r1 116 r3
+  load32 -1 r2
+  write 0 r3 r2
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L155
+.L158:
+  addr2reg maxrpo r5
+  savpc r15
+  add r15 12 r15
+  jump loopiter
+  load 0 r6
+  load 4 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -240 r14 r4
+  write -260 r14 r1
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r1 3 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  write -200 r14 r1
+  read -240 r14 r4
+  add r4 28 r1
+  read 0 r1 r1
+  load 1 r2
+  sub r1 r2 r2
+  load32 2147483646 r3
+  load 0 r1
+  write -124 r14 r3
+  write -212 r14 r1
+.L160:
+  write -204 r14 r2
+  blts r2 r0 .L216
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -224 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump succlist
+  write -216 r14 r1
+  read -204 r14 r2
+  read -124 r14 r1
+  read -220 r14 r6
+  read -200 r14 r3
+  or r0 r1 r4
+  load 1 r1
+  sub r4 r1 r1
+  write -196 r14 r1
+  shiftl r2 3 r5
+  add r3 r5 r5
+  add r5 4 r5
+  write 0 r5 r4
+  read -264 r14 r5
+  write -272 r14 r5
+  or r0 r1 r4
+.L163:
+  or r0 r6 r1
+  read -264 r14 r6
+  load 36 r7
+  mults r1 r7 r7
+  read -216 r14 r1
+  add r6 r7 r7
+  bge r5 r7 .L174
+  add r5 12 r6
+  load 0 r5
+  write 0 r6 r5
+.L165:
+  write -208 r14 r1
+  or r0 r2 r5
+  read 0 r1 r2
+  beq r2 r0 .L172
+  add r2 48 r2
+  read 0 r2 r2
+  load 0 r6
+  bgts r2 r5 .L168
+  or r0 r5 r2
+  or r0 r6 r5
+  jump .L169
+.L168:
+  read -272 r14 r1
+  add r1 16 r1
+  shiftl r2 3 r2
+  add r3 r2 r2
+  read 0 r2 r5
+  add r14 -328 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -328 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -328 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump rin
+  or r0 r1 r5
+  read -208 r14 r1
+  read -204 r14 r2
+  read -196 r14 r4
+  read -200 r14 r3
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L169:
+  beq r5 r0 .L171
+  read -272 r14 r2
+  add r2 8 r1
+  read 0 r1 r1
+  add r2 12 r2
+  write 0 r2 r1
+  read -272 r14 r2
+  or r0 r4 r1
+  add r2 16 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump radd
+  read -208 r14 r1
+  read -204 r14 r2
+  read -196 r14 r4
+  read -200 r14 r3
+.L171:
+  add r1 4 r1
+  jump .L165
+.L172:
+  or r0 r5 r2
+  read -220 r14 r6
+  read -216 r14 r1
+  read -272 r14 r5
+  add r5 36 r5
+  write -272 r14 r5
+  jump .L163
+.L174:
+  read -212 r14 r5
+  or r0 r4 r2
+  read -224 r14 r1
+  read -240 r14 r4
+  add r1 12 r3
+  readh 0 r3 r3
+  load 9 r7
+  bne r3 r7 .L177
+  add r1 12 r1
+  add r1 4 r1
+  load 1 r3
+  sub r2 r3 r2
+  write -128 r14 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r6
+  or r0 r4 r7
+  or r0 r2 r6
+  load32 -1 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump loadref
+  read -212 r14 r5
+  read -128 r14 r1
+  or r0 r1 r2
+  read -224 r14 r1
+  read -240 r14 r4
+  load32 -12 r3
+  sub r13 r3 r13
+.L177:
+  or r0 r2 r3
+  add r1 4 r2
+  read 0 r2 r2
+  add r1 8 r6
+  read 0 r6 r6
+  shiftl r6 4 r6
+  add r2 r6 r2
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  write -180 r14 r5
+.L179:
+  write -136 r14 r4
+  add r1 4 r5
+  read 0 r5 r5
+  beq r2 r5 .L199
+  or r0 r1 r6
+  load 16 r1
+  sub r2 r1 r2
+  write -192 r14 r2
+  add r2 8 r1
+  write -176 r14 r1
+  read 0 r2 r5
+  shiftl r5 2 r5
+  shiftr r5 2 r5
+  load 121 r7
+  xor r5 r7 r7
+  sltu r7 1 r7
+  read -180 r14 r5
+  bne r7 r0 .L183
+  or r0 r6 r1
+  jump .L184
+.L183:
+  add r1 4 r1
+  load 1 r2
+  sub r4 r2 r4
+  write -140 r14 r4
+  read -264 r14 r2
+  load 12 r5
+  sub r13 r5 r13
+  or r0 r13 r5
+  add r5 8 r5
+  write 0 r5 r2
+  or r0 r3 r7
+  or r0 r4 r6
+  load32 -1 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump loadref
+  read -180 r14 r5
+  read -140 r14 r4
+  read -192 r14 r2
+  read -224 r14 r3
+  or r0 r3 r1
+  read -240 r14 r3
+  load32 -12 r6
+  sub r13 r6 r13
+.L184:
+  write -144 r14 r4
+  read 0 r2 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 59 r7
+  sub r6 r7 r6
+  load 6 r7
+  bgt r6 r7 .L186
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump loadsz
+  or r0 r1 r5
+  read -144 r14 r4
+  read -176 r14 r1
+  read -240 r14 r3
+  load 1 r2
+  shiftl r2 r5 r2
+  load 1 r5
+  sub r2 r5 r5
+  add r1 0 r1
+  load 1 r2
+  sub r4 r2 r4
+  write -148 r14 r4
+  read -264 r14 r2
+  load 12 r6
+  sub r13 r6 r13
+  or r0 r13 r6
+  add r6 8 r6
+  write 0 r6 r2
+  or r0 r3 r7
+  or r0 r4 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump loadref
+  read -180 r14 r5
+  read -148 r14 r4
+  read -192 r14 r2
+  read -224 r14 r3
+  or r0 r3 r1
+  read -240 r14 r3
+  load32 -12 r6
+  sub r13 r6 r13
+.L186:
+  write -152 r14 r4
+  read 0 r2 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 53 r7
+  sub r6 r7 r6
+  load 5 r7
+  bgt r6 r7 .L188
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump storesz
+  or r0 r1 r6
+  read -152 r14 r4
+  read -176 r14 r1
+  read -192 r14 r2
+  read -240 r14 r3
+  load 1 r5
+  shiftl r5 r6 r5
+  load 1 r6
+  sub r5 r6 r5
+  add r1 4 r1
+  write -156 r14 r1
+  load 1 r1
+  sub r4 r1 r1
+  write -160 r14 r1
+  read -264 r14 r1
+  load 16 r6
+  sub r13 r6 r13
+  or r0 r13 r6
+  add r6 12 r7
+  write 0 r7 r1
+  read -156 r14 r1
+  add r6 8 r6
+  write 0 r6 r3
+  or r0 r2 r7
+  or r0 r4 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump store
+  read -180 r14 r5
+  read -160 r14 r4
+  read -192 r14 r2
+  read -224 r14 r3
+  or r0 r3 r1
+  read -240 r14 r3
+  load32 -16 r6
+  sub r13 r6 r13
+.L188:
+  write -164 r14 r4
+  read 0 r2 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 92 r7
+  beq r6 r7 .L190
+  or r0 r3 r12
+  or r0 r4 r3
+  or r0 r12 r4
+  or r0 r1 r12
+  or r0 r3 r1
+  or r0 r12 r3
+  jump .L198
+.L190:
+  add r2 16 r1
+  read 0 r1 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 93 r3
+  beq r1 r3 .L192
+  load 283 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.21 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -192 r14 r2
+.L192:
+  add r2 16 r1
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -192 r14 r2
+  load 2 r3
+  beq r1 r3 .L194
+  load 284 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.22 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -192 r14 r2
+.L194:
+  add r2 16 r1
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump abs
+  or r0 r1 r6
+  read -164 r14 r4
+  read -176 r14 r1
+  read -192 r14 r2
+  read -240 r14 r3
+  load 32 r5
+  bges r6 r5 .L196
+  load 1 r5
+  shiftl r5 r6 r5
+  load 1 r6
+  sub r5 r6 r5
+  jump .L197
+.L196:
+  load32 -1 r5
+.L197:
+  write -172 r14 r5
+  add r1 4 r1
+  write -168 r14 r1
+  load 1 r1
+  sub r4 r1 r1
+  write -184 r14 r1
+  read -264 r14 r1
+  load 16 r6
+  sub r13 r6 r13
+  or r0 r13 r6
+  add r6 12 r7
+  write 0 r7 r1
+  read -168 r14 r1
+  add r6 8 r6
+  write 0 r6 r3
+  or r0 r2 r7
+  or r0 r4 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump store
+  read -184 r14 r4
+  read -172 r14 r5
+  read -176 r14 r1
+  read -240 r14 r2
+  load32 -16 r3
+  sub r13 r3 r13
+  add r1 0 r1
+  read -264 r14 r3
+  load 12 r6
+  sub r13 r6 r13
+  or r0 r13 r6
+  add r6 8 r6
+  write 0 r6 r3
+  or r0 r2 r7
+  or r0 r4 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump loadref
+  read -180 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  add r5 1 r5
+  write -188 r14 r5
+  add r14 -260 r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -188 r14 r5
+  read -184 r14 r4
+  read -192 r14 r2
+  read -224 r14 r3
+  or r0 r4 r1
+  read -240 r14 r4
+  read -260 r14 r6
+  load 1 r7
+  sub r5 r7 r7
+  shiftl r7 2 r7
+  add r6 r7 r6
+  write 0 r6 r2
+.L198:
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  write -180 r14 r5
+  jump .L179
+.L199:
+  read -204 r14 r2
+  read -220 r14 r6
+  read -200 r14 r3
+  read -264 r14 r5
+  write -272 r14 r5
+.L201:
+  read -264 r14 r7
+  write -132 r14 r7
+  load 36 r7
+  mults r6 r7 r7
+  read -132 r14 r6
+  add r6 r7 r7
+  read -220 r14 r6
+  bge r5 r7 .L212
+  add r5 12 r7
+  read 0 r7 r7
+  bne r7 r0 .L204
+  or r0 r6 r12
+  or r0 r1 r6
+  or r0 r12 r1
+  jump .L210
+.L204:
+  or r0 r4 r1
+  add r5 16 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump radd
+  read -136 r14 r4
+  read -204 r14 r2
+  read -220 r14 r6
+  read -224 r14 r3
+  or r0 r3 r1
+  read -200 r14 r3
+  add r1 116 r5
+  read 0 r5 r5
+  load32 -1 r7
+  bne r5 r7 .L206
+  or r0 r6 r12
+  or r0 r1 r6
+  or r0 r12 r1
+  jump .L210
+.L206:
+  or r0 r5 r4
+  bgts r4 r2 .L209
+  load 297 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.23 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -224 r14 r3
+  or r0 r3 r1
+  read -200 r14 r3
+.L209:
+  read -272 r14 r2
+  add r2 16 r4
+  add r1 116 r1
+  read 0 r1 r1
+  shiftl r1 3 r1
+  add r3 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  load 1 r2
+  sub r1 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump radd
+  read -136 r14 r4
+  read -204 r14 r2
+  read -220 r14 r1
+  read -224 r14 r3
+  or r0 r3 r6
+  read -200 r14 r3
+.L210:
+  read -272 r14 r5
+  add r5 36 r5
+  write -272 r14 r5
+  or r0 r1 r12
+  or r0 r6 r1
+  or r0 r12 r6
+  jump .L201
+.L212:
+  or r0 r4 r1
+  read -180 r14 r5
+  read -240 r14 r4
+  shiftl r2 3 r7
+  add r3 r7 r7
+  write 0 r7 r1
+  load 1 r7
+  sub r2 r7 r2
+  write -124 r14 r1
+  write -212 r14 r5
+  jump .L160
+.L216:
+  read -200 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -220 r14 r6
+  read -264 r14 r1
+  write -272 r14 r1
+.L218:
+  read -264 r14 r2
+  load 36 r3
+  mults r6 r3 r3
+  add r2 r3 r2
+  bge r1 r2 .L228
+  load 0 r1
+.L220:
+  write -120 r14 r1
+  read -272 r14 r2
+  add r2 32 r3
+  read 0 r3 r3
+  bges r1 r3 .L226
+  or r0 r1 r3
+  add r2 16 r1
+  add r2 28 r2
+  read 0 r2 r2
+  shiftl r3 3 r3
+  add r2 r3 r2
+  read 0 r2 r5
+  add r14 -320 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -320 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -320 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump rin
+  or r0 r1 r2
+  read -120 r14 r1
+  bne r2 r0 .L225
+  read -272 r14 r2
+  add r2 28 r2
+  read 0 r2 r2
+  shiftl r1 3 r3
+  add r2 r3 r2
+  add r2 4 r2
+  read 0 r2 r2
+  read 0 r2 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 92 r4
+  bne r3 r4 .L224
+  add r2 16 r3
+  load 90 r4
+  write 0 r3 r4
+  add r3 4 r3
+  load 0 r4
+  write 0 r3 r4
+  add r3 4 r3
+  load 0 r4
+  write 0 r3 r4
+  add r3 4 r4
+  load 0 r3
+  write 0 r4 r3
+.L224:
+  load 90 r3
+  write 0 r2 r3
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+.L225:
+  add r1 1 r1
+  jump .L220
+.L226:
+  read -220 r14 r6
+  add r2 36 r1
+  write -272 r14 r1
+  jump .L218
+.L228:
+  load 0 r6
+  load 4 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -220 r14 r6
+  write -248 r14 r1
+  read -264 r14 r2
+  write -268 r14 r2
+  write -272 r14 r2
+  load 0 r4
+  load 0 r3
+  load 0 r1
+  or r0 r4 r12
+  or r0 r1 r4
+  or r0 r12 r1
+  or r0 r3 r12
+  or r0 r4 r3
+  or r0 r12 r4
+.L230:
+  write -104 r14 r1
+  write -96 r14 r4
+  write -112 r14 r3
+  read -264 r14 r5
+  load 36 r7
+  mults r6 r7 r7
+  add r5 r7 r7
+  bge r2 r7 .L235
+  add r2 4 r5
+  read 0 r5 r5
+  add r4 r5 r4
+  write -108 r14 r4
+  add r2 16 r5
+  add r5 4 r5
+  read 0 r5 r5
+  beq r5 r0 .L233
+  read -268 r14 r5
+  add r5 36 r7
+  write -268 r14 r7
+  read 0 r2 r7
+  write 0 r5 r7
+  add r2 4 r2
+  add r5 4 r5
+  read 0 r2 r7
+  write 0 r5 r7
+  add r2 4 r2
+  add r5 4 r5
+  read 0 r2 r7
+  write 0 r5 r7
+  add r2 4 r2
+  add r5 4 r5
+  read 0 r2 r7
+  write 0 r5 r7
+  add r2 4 r2
+  add r5 4 r5
+  read 0 r2 r7
+  write 0 r5 r7
+  add r2 4 r2
+  add r5 4 r5
+  read 0 r2 r7
+  write 0 r5 r7
+  add r2 4 r2
+  add r5 4 r5
+  read 0 r2 r7
+  write 0 r5 r7
+  add r2 4 r2
+  add r5 4 r5
+  read 0 r2 r7
+  write 0 r5 r7
+  add r2 4 r2
+  add r5 4 r5
+  read 0 r2 r2
+  write 0 r5 r2
+  jump .L234
+.L233:
+  add r2 28 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  read -104 r14 r1
+  add r1 1 r1
+  write -116 r14 r1
+  or r0 r1 r5
+  add r14 -248 r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -112 r14 r3
+  read -220 r14 r6
+  read -116 r14 r1
+  read -108 r14 r4
+  read -272 r14 r2
+  read 0 r2 r2
+  read -248 r14 r5
+  load 1 r7
+  sub r1 r7 r7
+  shiftl r7 2 r7
+  add r5 r7 r5
+  write 0 r5 r2
+  read -272 r14 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r3 r2 r3
+.L234:
+  read -272 r14 r2
+  add r2 36 r2
+  write -272 r14 r2
+  jump .L230
+.L235:
+  read -240 r14 r4
+  read -268 r14 r2
+  sub r2 r5 r3
+  load32 954437177 r2
+  mulshi r3 r2 r2
+  shiftrs r2 3 r2
+  shiftr r3 31 r3
+  add r2 r3 r2
+  write -100 r14 r2
+  addr2reg debug+77 r12
+  readb 0 r12 r2
+  beq r2 r0 .L243
+  addr2reg __stderr_file r5
+  addr2reg .Lstring.24 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -104 r14 r1
+  read -240 r14 r4
+  beq r1 r0 .L243
+  addr2reg __stderr_file r5
+  addr2reg .Lstring.25 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -104 r14 r1
+  read -240 r14 r4
+  load 0 r2
+.L239:
+  write -92 r14 r2
+  bges r2 r1 .L242
+  add r4 4 r1
+  read 0 r1 r1
+  or r0 r2 r3
+  read -248 r14 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.26 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -92 r14 r2
+  read -104 r14 r1
+  read -240 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  add r2 1 r2
+  jump .L239
+.L242:
+  addr2reg __stderr_file r5
+  addr2reg .Lstring.27 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -104 r14 r1
+  read -240 r14 r4
+.L243:
+  or r0 r1 r2
+  load 1 r1
+  sub r2 r1 r1
+  write -64 r14 r1
+  beq r2 r0 .L274
+  add r4 4 r2
+  read 0 r2 r2
+  read -248 r14 r3
+  shiftl r1 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r2 r3 r2
+  write -76 r14 r2
+  add r2 88 r3
+  read 0 r3 r5
+  load 0 r3
+  load 1 r6
+  bne r5 r6 .L246
+  add r2 80 r3
+  read 0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L246:
+  bne r3 r0 .L248
+  load 343 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.28 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -76 r14 r2
+  read -64 r14 r1
+  read -240 r14 r4
+.L248:
+  add r2 80 r3
+  read 0 r3 r3
+  read 0 r3 r5
+  shiftl r5 2 r6
+  shiftr r6 2 r6
+  load 59 r7
+  sub r6 r7 r6
+  load 6 r7
+  ble r6 r7 .L272
+  load 90 r5
+  write 0 r3 r5
+  add r3 4 r3
+  load 0 r5
+  write 0 r3 r5
+  add r3 4 r3
+  load 0 r5
+  write 0 r3 r5
+  add r3 4 r5
+  load 0 r3
+  write 0 r5 r3
+  add r2 84 r3
+  read 0 r3 r3
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+.L251:
+  write -88 r14 r4
+  write -84 r14 r1
+  add r2 84 r5
+  read 0 r5 r5
+  add r2 92 r6
+  read 0 r6 r6
+  load 12 r7
+  mults r6 r7 r6
+  add r5 r6 r5
+  bge r4 r5 .L271
+  read 0 r4 r5
+  load 3 r6
+  beq r5 r6 .L267
+  or r0 r5 r1
+  load 2 r2
+  beq r1 r2 .L256
+  load 359 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.30 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -88 r14 r4
+.L256:
+  add r4 8 r1
+  read 0 r1 r5
+  write -72 r14 r5
+  add r5 4 r1
+  load 0 r2
+  write -244 r14 r2
+  read -244 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -88 r14 r4
+  read -84 r14 r1
+  read -72 r14 r5
+  read -240 r14 r3
+  beq r2 r0 .L264
+  read 0 r5 r6
+  shiftl r6 2 r2
+  shiftr r2 2 r2
+  load 116 r7
+  sub r2 r7 r2
+  load 7 r7
+  sltu r7 r2 r7
+  xor r7 1 r7
+  read -76 r14 r2
+  bne r7 r0 .L261
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 92 r7
+  bne r6 r7 .L260
+  add r5 16 r6
+  load 90 r7
+  write 0 r6 r7
+  add r6 4 r6
+  load 0 r7
+  write 0 r6 r7
+  add r6 4 r6
+  load 0 r7
+  write 0 r6 r7
+  add r6 4 r7
+  load 0 r6
+  write 0 r7 r6
+.L260:
+  load 90 r6
+  write 0 r5 r6
+  add r5 4 r5
+  load 0 r6
+  write 0 r5 r6
+  add r5 4 r5
+  load 0 r6
+  write 0 r5 r6
+  add r5 4 r6
+  load 0 r5
+  write 0 r6 r5
+  jump .L270
+.L261:
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 121 r7
+  beq r6 r7 .L263
+  load 366 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.31 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -88 r14 r4
+  read -84 r14 r1
+  read -72 r14 r5
+  read -76 r14 r2
+  read -240 r14 r3
+.L263:
+  add r5 8 r5
+  add r5 4 r6
+  load 9 r5
+  write 0 r6 r5
+  jump .L270
+.L264:
+  add r5 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -84 r14 r1
+  beq r2 r0 .L266
+  load 362 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -84 r14 r1
+.L266:
+  add r1 1 r1
+  write -68 r14 r1
+  or r0 r1 r5
+  add r14 -248 r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -88 r14 r4
+  read -68 r14 r1
+  read -72 r14 r5
+  read -76 r14 r2
+  read -240 r14 r3
+  add r5 4 r5
+  read 0 r5 r5
+  shiftr r5 3 r5
+  read -248 r14 r6
+  load 1 r7
+  sub r1 r7 r7
+  shiftl r7 2 r7
+  add r6 r7 r6
+  write 0 r6 r5
+  jump .L270
+.L267:
+  add r3 40 r5
+  read 0 r5 r5
+  add r4 4 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  write -80 r14 r5
+  add r5 12 r6
+  readh 0 r6 r6
+  load 1 r7
+  sub r6 r7 r6
+  load 9 r7
+  ble r6 r7 .L269
+  load 354 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.29 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -88 r14 r4
+  read -84 r14 r1
+  read -80 r14 r5
+  read -76 r14 r2
+  read -240 r14 r3
+.L269:
+  add r5 12 r7
+  load 10 r6
+  writeh 0 r7 r6
+  add r5 12 r5
+  add r5 4 r6
+  load 0 r5
+  write 0 r6 r5
+.L270:
+  add r4 12 r4
+  jump .L251
+.L271:
+  or r0 r3 r4
+  jump .L243
+.L272:
+  or r0 r3 r2
+  or r0 r5 r3
+  load32 -1073741824 r5
+  and r3 r5 r5
+  load 88 r3
+  or r3 r5 r3
+  write 0 r2 r3
+  add r2 8 r2
+  add r2 0 r3
+  load 1 r2
+  write 0 r3 r2
+  jump .L243
+.L274:
+  read -248 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  read -100 r14 r1
+  read -264 r14 r4
+  addr2reg scmp r7
+  load 36 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump qsort
+  read -100 r14 r1
+  load 0 r3
+  load 0 r2
+.L275:
+  write -56 r14 r3
+  write -48 r14 r2
+  bges r3 r1 .L294
+  read -264 r14 r4
+  load 36 r5
+  mults r3 r5 r5
+  add r4 r5 r4
+  write -268 r14 r4
+  add r4 24 r5
+  read 0 r5 r5
+  bne r5 r0 .L293
+  add r4 24 r5
+  write 0 r5 r4
+  read -268 r14 r4
+  add r4 16 r5
+  read 0 r5 r6
+  write -280 r14 r6
+  add r5 4 r5
+  add r14 -280 r6
+  add r6 4 r6
+  read 0 r5 r5
+  write 0 r6 r5
+  add r4 36 r4
+  write -272 r14 r4
+  or r0 r1 r12
+  or r0 r4 r1
+  or r0 r12 r4
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L279:
+  write -60 r14 r2
+  read -264 r14 r5
+  load 36 r6
+  mults r4 r6 r6
+  add r5 r6 r5
+  bge r3 r5 .L292
+  add r3 24 r5
+  read 0 r5 r6
+  load 1 r5
+  bne r6 r0 .L282
+  add r3 16 r5
+  add r5 4 r5
+  read 0 r5 r5
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L282:
+  bne r5 r0 .L291
+  add r3 16 r1
+  add r14 -304 r5
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -304 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -304 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -312 r4
+  add r14 -280 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -312 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -280 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -312 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump rovlap
+  or r0 r1 r2
+  read -56 r14 r1
+  beq r2 r0 .L290
+.L284:
+  write -52 r14 r1
+  or r0 r1 r3
+  read -264 r14 r1
+  load 36 r2
+  mults r3 r2 r2
+  add r1 r2 r4
+  read -272 r14 r2
+  bge r4 r2 .L290
+  load 36 r4
+  mults r3 r4 r4
+  add r1 r4 r4
+  add r4 24 r4
+  read 0 r4 r4
+  read -268 r14 r5
+  beq r4 r5 .L287
+  or r0 r3 r1
+  jump .L288
+.L287:
+  load 36 r4
+  mults r3 r4 r3
+  add r1 r3 r1
+  add r1 16 r1
+  add r2 16 r2
+  add r14 -288 r5
+  add r2 0 r3
+  read 0 r3 r3
+  add r14 -288 r4
+  add r4 0 r4
+  write 0 r4 r3
+  add r2 4 r2
+  read 0 r2 r2
+  add r14 -288 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r14 -296 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -296 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -296 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump rovlap
+  or r0 r1 r2
+  read -52 r14 r1
+  bne r2 r0 .L289
+.L288:
+  add r1 1 r1
+  jump .L284
+.L289:
+  read -60 r14 r2
+  read -56 r14 r1
+  read -100 r14 r4
+  jump .L291
+.L290:
+  read -272 r14 r1
+  add r1 16 r1
+  read 0 r1 r5
+  add r14 -280 r4
+  savpc r15
+  add r15 12 r15
+  jump radd
+  read -272 r14 r1
+  add r1 16 r1
+  add r1 4 r1
+  read 0 r1 r1
+  load 1 r2
+  sub r1 r2 r5
+  add r14 -280 r4
+  savpc r15
+  add r15 12 r15
+  jump radd
+  read -60 r14 r2
+  read -56 r14 r1
+  read -100 r14 r4
+  read -268 r14 r3
+  read -272 r14 r5
+  add r5 24 r5
+  write 0 r5 r3
+  read -272 r14 r3
+  add r3 4 r3
+  read 0 r3 r3
+  add r2 r3 r2
+.L291:
+  read -272 r14 r3
+  add r3 36 r3
+  write -272 r14 r3
+  jump .L279
+.L292:
+  or r0 r1 r3
+  or r0 r4 r1
+.L293:
+  add r3 1 r3
+  jump .L275
+.L294:
+  read -240 r14 r4
+  read -264 r14 r2
+  write -272 r14 r2
+.L296:
+  read -264 r14 r5
+  or r0 r2 r3
+  load 36 r2
+  mults r1 r2 r2
+  add r5 r2 r2
+  bge r3 r2 .L325
+  or r0 r1 r2
+  add r4 4 r1
+  read 0 r1 r1
+  read 0 r3 r6
+  load 160 r7
+  mults r6 r7 r6
+  add r1 r6 r1
+  write -40 r14 r1
+  sub r3 r5 r5
+  load32 954437177 r3
+  mulshi r5 r3 r3
+  shiftrs r3 3 r3
+  shiftr r5 31 r5
+  add r3 r5 r3
+  add r1 156 r5
+  write 0 r5 r3
+  add r1 88 r3
+  read 0 r3 r5
+  load 0 r3
+  load 1 r6
+  bne r5 r6 .L299
+  add r1 80 r3
+  read 0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L299:
+  bne r3 r0 .L301
+  load 413 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.28 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -40 r14 r1
+  read -100 r14 r2
+  read -240 r14 r4
+.L301:
+  read -272 r14 r5
+  add r5 24 r3
+  read 0 r3 r3
+  beq r3 r5 .L323
+  add r1 80 r2
+  read 0 r2 r2
+  load 90 r3
+  write 0 r2 r3
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+  add r4 4 r2
+  read 0 r2 r2
+  read -272 r14 r3
+  add r3 24 r3
+  read 0 r3 r3
+  read 0 r3 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r2 r3 r3
+  write -28 r14 r3
+  add r1 96 r2
+  read 0 r2 r2
+  add r3 96 r5
+  read 0 r5 r5
+  beq r2 r5 .L304
+  load 418 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.32 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r3
+  read -40 r14 r1
+  read -240 r14 r4
+.L304:
+  add r1 80 r2
+  read 0 r2 r5
+  add r3 80 r2
+  read 0 r2 r2
+  bge r5 r2 .L306
+  read 0 r2 r6
+  write 0 r5 r6
+  add r2 4 r2
+  add r5 4 r5
+  read 0 r2 r6
+  write 0 r5 r6
+  add r2 4 r2
+  add r5 4 r5
+  read 0 r2 r6
+  write 0 r5 r6
+  add r2 4 r2
+  add r5 4 r5
+  read 0 r2 r2
+  write 0 r5 r2
+  add r3 80 r2
+  read 0 r2 r2
+  load 90 r5
+  write 0 r2 r5
+  add r2 4 r2
+  load 0 r5
+  write 0 r2 r5
+  add r2 4 r2
+  load 0 r5
+  write 0 r2 r5
+  add r2 4 r5
+  load 0 r2
+  write 0 r5 r2
+  add r1 80 r2
+  read 0 r2 r2
+  add r3 80 r3
+  write 0 r3 r2
+.L306:
+  add r1 84 r2
+  read 0 r2 r2
+.L307:
+  write -44 r14 r2
+  add r1 84 r3
+  read 0 r3 r3
+  add r1 92 r5
+  read 0 r5 r5
+  load 12 r6
+  mults r5 r6 r5
+  add r3 r5 r3
+  bge r2 r3 .L322
+  read 0 r2 r3
+  load 3 r5
+  beq r3 r5 .L319
+  or r0 r3 r1
+  load 2 r3
+  beq r1 r3 .L312
+  load 434 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.30 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -44 r14 r2
+.L312:
+  add r2 8 r1
+  read 0 r1 r1
+  add r1 8 r1
+  write -32 r14 r1
+  load 0 r2
+.L313:
+  write -36 r14 r2
+  load 2 r3
+  bges r2 r3 .L317
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read -272 r14 r2
+  read 0 r2 r2
+  shiftl r2 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -244 r14 r2
+  read -244 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -36 r14 r2
+  read -32 r14 r1
+  beq r3 r0 .L316
+  read -272 r14 r3
+  add r3 24 r3
+  read 0 r3 r3
+  read 0 r3 r3
+  shiftl r3 3 r3
+  load32 -8 r4
+  and r3 r4 r3
+  or r3 0 r3
+  shiftl r2 2 r4
+  add r1 r4 r4
+  write 0 r4 r3
+.L316:
+  add r2 1 r2
+  jump .L313
+.L317:
+  read -44 r14 r2
+  read -40 r14 r1
+  read -240 r14 r4
+  or r0 r4 r3
+  jump .L320
+.L319:
+  add r4 40 r3
+  read 0 r3 r3
+  add r2 4 r5
+  read 0 r5 r5
+  shiftl r5 2 r5
+  add r3 r5 r3
+  read 0 r3 r5
+  or r0 r4 r3
+  read -272 r14 r4
+  add r4 24 r4
+  read 0 r4 r4
+  read 0 r4 r4
+  shiftl r4 3 r4
+  load32 -8 r6
+  and r4 r6 r4
+  or r4 0 r4
+  add r5 12 r5
+  add r5 4 r5
+  write 0 r5 r4
+.L320:
+  add r2 12 r2
+  or r0 r3 r4
+  jump .L307
+.L322:
+  read -100 r14 r1
+  jump .L324
+.L323:
+  or r0 r2 r1
+.L324:
+  read -272 r14 r2
+  add r2 36 r2
+  write -272 r14 r2
+  jump .L296
+.L325:
+  read -212 r14 r5
+  load 0 r1
+.L327:
+  write -20 r14 r1
+  bges r1 r5 .L338
+  read -260 r14 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r3
+  write -24 r14 r3
+  read 0 r3 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 92 r6
+  bne r2 r6 .L337
+  add r3 8 r1
+  add r1 0 r1
+  read -264 r14 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r4 r7
+  read 0 r1 r6
+  add r14 -256 r5
+  add r14 -272 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r2
+  read -20 r14 r1
+  read -212 r14 r5
+  read -24 r14 r3
+  read -240 r14 r4
+  load32 -12 r6
+  sub r13 r6 r13
+  beq r2 r0 .L337
+  add r3 8 r1
+  add r1 4 r1
+  read -264 r14 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r4 r7
+  read 0 r1 r6
+  add r14 -252 r5
+  add r14 -268 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r2
+  read -20 r14 r1
+  read -212 r14 r5
+  read -24 r14 r3
+  read -240 r14 r4
+  load32 -12 r6
+  sub r13 r6 r13
+  beq r2 r0 .L337
+  read -272 r14 r2
+  add r2 24 r2
+  read 0 r2 r6
+  read -268 r14 r2
+  add r2 24 r2
+  read 0 r2 r7
+  load 0 r2
+  bne r6 r7 .L333
+  read -256 r14 r2
+  read -252 r14 r6
+  slt r2 r6 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L333:
+  beq r2 r0 .L337
+  add r3 16 r1
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  or r0 r1 r2
+  read -20 r14 r1
+  read -212 r14 r5
+  read -24 r14 r3
+  read -240 r14 r4
+  write -16 r14 r2
+  bges r2 r0 .L336
+  load 450 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.33 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -20 r14 r1
+  read -212 r14 r5
+  read -16 r14 r2
+  read -24 r14 r3
+  read -240 r14 r4
+.L336:
+  sub r0 r2 r2
+  load32 536870911 r6
+  and r2 r6 r2
+  shiftl r2 3 r2
+  load32 -8 r6
+  and r2 r6 r2
+  or r2 2 r2
+  add r3 16 r3
+  add r3 8 r3
+  add r3 0 r3
+  write 0 r3 r2
+.L337:
+  add r1 1 r1
+  jump .L327
+.L338:
+  read -260 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  read -124 r14 r2
+  read -100 r14 r1
+  read -240 r14 r4
+  addr2reg debug+77 r12
+  readb 0 r12 r3
+  beq r3 r0 .L353
+  read -264 r14 r3
+  write -268 r14 r3
+.L340:
+  read -264 r14 r5
+  load 36 r6
+  mults r1 r6 r6
+  add r5 r6 r5
+  bge r3 r5 .L351
+  add r3 24 r5
+  read 0 r5 r5
+  bne r5 r3 .L350
+  add r3 4 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.34 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -124 r14 r1
+  or r0 r1 r2
+  read -100 r14 r1
+  read -240 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  read -268 r14 r3
+  write -272 r14 r3
+.L343:
+  read -264 r14 r5
+  load 36 r6
+  mults r1 r6 r6
+  add r5 r6 r5
+  bge r3 r5 .L349
+  add r3 24 r5
+  read 0 r5 r5
+  read -268 r14 r6
+  bne r5 r6 .L348
+  add r4 4 r1
+  read 0 r1 r1
+  read 0 r3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.26 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -124 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  read -272 r14 r1
+  add r1 16 r2
+  add r2 4 r2
+  read 0 r2 r2
+  bne r2 r0 .L347
+  addr2reg __stderr_file r5
+  addr2reg .Lstring.36 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -124 r14 r4
+  read -100 r14 r1
+  or r0 r4 r2
+  read -240 r14 r4
+  jump .L348
+.L347:
+  add r1 16 r2
+  read 0 r2 r2
+  sub r2 r4 r6
+  add r1 16 r1
+  add r1 4 r1
+  read 0 r1 r1
+  sub r1 r4 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.35 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -124 r14 r4
+  read -100 r14 r1
+  or r0 r4 r2
+  read -240 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+.L348:
+  read -272 r14 r3
+  add r3 36 r3
+  write -272 r14 r3
+  jump .L343
+.L349:
+  addr2reg __stderr_file r5
+  addr2reg .Lstring.27 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -124 r14 r1
+  or r0 r1 r2
+  read -100 r14 r1
+  read -240 r14 r4
+.L350:
+  read -268 r14 r3
+  add r3 36 r3
+  write -268 r14 r3
+  jump .L340
+.L351:
+  read -48 r14 r7
+  read -96 r14 r4
+  read -112 r14 r6
+  load 28 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 24 r1
+  write 0 r1 r4
+  addr2reg .Lstring.37 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -240 r14 r4
+  load32 -28 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+  read -100 r14 r1
+.L353:
+  read -264 r14 r2
+  write -272 r14 r2
+.L354:
+  or r0 r1 r3
+  read -264 r14 r1
+  load 36 r4
+  mults r3 r4 r3
+  add r1 r3 r3
+  bge r2 r3 .L357
+  add r2 28 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  read -100 r14 r1
+  read -272 r14 r2
+  add r2 36 r2
+  write -272 r14 r2
+  jump .L354
+.L357:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function coalesce */
+
@@ -0,0 +1,11451 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "add\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "sub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "neg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "div\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "rem\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "udiv\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "urem\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "mul\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "multfp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "divfp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "and\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "or\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "xor\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "sar\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "shr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "shl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "ceqw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "cnew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "csgew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "csgtw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "cslew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "csltw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "cugew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "cugtw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "culew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "cultw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "ceql\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "cnel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "csgel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "csgtl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "cslel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "csltl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.39:
+	.ascii "cugel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "cugtl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.41:
+	.ascii "culel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "cultl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "ceqs\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.44:
+	.ascii "cges\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.45:
+	.ascii "cgts\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.46:
+	.ascii "cles\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.47:
+	.ascii "clts\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.48:
+	.ascii "cnes\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.49:
+	.ascii "cos\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.50:
+	.ascii "cuos\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.51:
+	.ascii "ceqd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.52:
+	.ascii "cged\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.53:
+	.ascii "cgtd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.54:
+	.ascii "cled\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.55:
+	.ascii "cltd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.56:
+	.ascii "cned\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.57:
+	.ascii "cod\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.58:
+	.ascii "cuod\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.59:
+	.ascii "storeb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.60:
+	.ascii "storeh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.61:
+	.ascii "storew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.62:
+	.ascii "storel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.63:
+	.ascii "stores\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.64:
+	.ascii "stored\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.65:
+	.ascii "loadsb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.66:
+	.ascii "loadub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.67:
+	.ascii "loadsh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.68:
+	.ascii "loaduh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.69:
+	.ascii "loadsw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.70:
+	.ascii "loaduw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.71:
+	.ascii "load\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.72:
+	.ascii "extsb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.73:
+	.ascii "extub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.74:
+	.ascii "extsh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.75:
+	.ascii "extuh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.76:
+	.ascii "extsw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.77:
+	.ascii "extuw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.78:
+	.ascii "exts\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.79:
+	.ascii "truncd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.80:
+	.ascii "stosi\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.81:
+	.ascii "stoui\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.82:
+	.ascii "dtosi\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.83:
+	.ascii "dtoui\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.84:
+	.ascii "swtof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.85:
+	.ascii "uwtof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.86:
+	.ascii "sltof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.87:
+	.ascii "ultof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.88:
+	.ascii "cast\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.89:
+	.ascii "alloc4\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.90:
+	.ascii "alloc8\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.91:
+	.ascii "alloc16\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.92:
+	.ascii "vaarg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.93:
+	.ascii "vastart\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.94:
+	.ascii "copy\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.95:
+	.ascii "dbgloc\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.96:
+	.ascii "nop\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.97:
+	.ascii "addr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.98:
+	.ascii "blit0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.99:
+	.ascii "blit1\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.100:
+	.ascii "swap\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.101:
+	.ascii "sign\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.102:
+	.ascii "salloc\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.103:
+	.ascii "xidiv\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.104:
+	.ascii "xdiv\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.105:
+	.ascii "xcmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.106:
+	.ascii "xtest\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.107:
+	.ascii "acmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.108:
+	.ascii "acmn\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.109:
+	.ascii "afcmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.110:
+	.ascii "reqz\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.111:
+	.ascii "rnez\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.112:
+	.ascii "mulhs\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.113:
+	.ascii "mulhu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.114:
+	.ascii "jtaddr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.115:
+	.ascii "par\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.116:
+	.ascii "parsb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.117:
+	.ascii "parub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.118:
+	.ascii "parsh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.119:
+	.ascii "paruh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.120:
+	.ascii "parc\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.121:
+	.ascii "pare\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.122:
+	.ascii "arg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.123:
+	.ascii "argsb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.124:
+	.ascii "argub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.125:
+	.ascii "argsh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.126:
+	.ascii "arguh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.127:
+	.ascii "argc\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.128:
+	.ascii "arge\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.129:
+	.ascii "argv\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.130:
+	.ascii "call\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.131:
+	.ascii "flagieq\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.132:
+	.ascii "flagine\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.133:
+	.ascii "flagisge\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.134:
+	.ascii "flagisgt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.135:
+	.ascii "flagisle\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.136:
+	.ascii "flagislt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.137:
+	.ascii "flagiuge\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.138:
+	.ascii "flagiugt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.139:
+	.ascii "flagiule\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.140:
+	.ascii "flagiult\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.141:
+	.ascii "flagfeq\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.142:
+	.ascii "flagfge\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.143:
+	.ascii "flagfgt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.144:
+	.ascii "flagfle\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.145:
+	.ascii "flagflt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.146:
+	.ascii "flagfne\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.147:
+	.ascii "flagfo\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.148:
+	.ascii "flagfuo\000"
+/* end data */
+
+.data
+.balign 4
+.globl optab
+optab:
+	.fill 24,1,0
+	.int .Lstring.7+0
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.int 1
+	.int .Lstring.8+0
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.int 1
+	.int .Lstring.9+0
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 1
+	.int .Lstring.10+0
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.int 1
+	.int .Lstring.11+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.12+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.13+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.14+0
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.int 1
+	.int .Lstring.15+0
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.16+0
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.17+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.18+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.19+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.20+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.21+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.22+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.23+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.24+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.25+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.26+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.27+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.28+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.29+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.30+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.31+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.32+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.33+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.34+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.35+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.36+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.37+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.38+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.39+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.40+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.41+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.42+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.43+0
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.44+0
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.45+0
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.46+0
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.47+0
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.48+0
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.49+0
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.50+0
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.51+0
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.52+0
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.53+0
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.54+0
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.55+0
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.56+0
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.57+0
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.58+0
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.59+0
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.60+0
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.61+0
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.62+0
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.63+0
+	.short 2
+	.short -2
+	.short -2
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.64+0
+	.short 3
+	.short -2
+	.short -2
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.65+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.66+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.67+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.68+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.69+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.70+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.71+0
+	.short 1
+	.short 1
+	.short 1
+	.short 1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.72+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.73+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.74+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.75+0
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.76+0
+	.short -2
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.77+0
+	.short -2
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.78+0
+	.short -2
+	.short -2
+	.short -2
+	.short 2
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.int 1
+	.int .Lstring.79+0
+	.short -2
+	.short -2
+	.short 3
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.int 1
+	.int .Lstring.80+0
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.81+0
+	.short 2
+	.short 2
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.82+0
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.83+0
+	.short 3
+	.short 3
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 1
+	.int .Lstring.84+0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.int 1
+	.int .Lstring.85+0
+	.short -2
+	.short -2
+	.short 0
+	.short 0
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.int 1
+	.int .Lstring.86+0
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.int 1
+	.int .Lstring.87+0
+	.short -2
+	.short -2
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.int 1
+	.int .Lstring.88+0
+	.short 2
+	.short 3
+	.short 0
+	.short 1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 1
+	.int .Lstring.89+0
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.90+0
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.91+0
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.92+0
+	.short 1
+	.short 1
+	.short 1
+	.short 1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.93+0
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.94+0
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.95+0
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.96+0
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.97+0
+	.short 1
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.98+0
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.99+0
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.100+0
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.int 0
+	.int .Lstring.101+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.102+0
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.103+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.104+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.105+0
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.int 0
+	.int .Lstring.106+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.107+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.108+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.109+0
+	.short -2
+	.short -2
+	.short 2
+	.short 3
+	.short -2
+	.short -2
+	.short 2
+	.short 3
+	.int 0
+	.int .Lstring.110+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.111+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.112+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.113+0
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.short 0
+	.short 1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.114+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.115+0
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.116+0
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.117+0
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.118+0
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.119+0
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.120+0
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.121+0
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.122+0
+	.short 0
+	.short 1
+	.short 2
+	.short 3
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.123+0
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.124+0
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.125+0
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.126+0
+	.short 0
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.127+0
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.128+0
+	.short -2
+	.short 1
+	.short -2
+	.short -2
+	.short -2
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.129+0
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.130+0
+	.short 1
+	.short 1
+	.short 1
+	.short 1
+	.short -1
+	.short -1
+	.short -1
+	.short -1
+	.int 0
+	.int .Lstring.131+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.132+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.133+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.134+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.135+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.136+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.137+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.138+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.139+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.140+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.141+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.142+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.143+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.144+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.145+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.146+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.147+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+	.int .Lstring.148+0
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.short -1
+	.short -1
+	.short -2
+	.short -2
+	.int 0
+/* end data */
+
+.data
+.balign 1
+.Lstring.149:
+	.ascii "loadw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.150:
+	.ascii "loadl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.151:
+	.ascii "loads\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.152:
+	.ascii "loadd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.153:
+	.ascii "alloc1\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.154:
+	.ascii "alloc2\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.155:
+	.ascii "blit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.156:
+	.ascii "env\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.157:
+	.ascii "phi\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.158:
+	.ascii "jmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.159:
+	.ascii "jnz\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.160:
+	.ascii "jtab\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.161:
+	.ascii "ret\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.162:
+	.ascii "hlt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.163:
+	.ascii "export\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.164:
+	.ascii "thread\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.165:
+	.ascii "inline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.166:
+	.ascii "noinline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.167:
+	.ascii "alwaysinline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.168:
+	.ascii "function\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.169:
+	.ascii "type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.170:
+	.ascii "data\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.171:
+	.ascii "section\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.172:
+	.ascii "align\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.173:
+	.ascii "dbgfile\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.174:
+	.ascii "l\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.175:
+	.ascii "w\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.176:
+	.ascii "sh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.177:
+	.ascii "uh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.178:
+	.ascii "h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.179:
+	.ascii "sb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.180:
+	.ascii "ub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.181:
+	.ascii "b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.182:
+	.ascii "d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.183:
+	.ascii "s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.184:
+	.ascii "z\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.185:
+	.ascii "...\000"
+/* end data */
+
+.data
+.balign 4
+kwmap:
+	.fill 360,1,0
+	.int .Lstring.149+0
+	.int .Lstring.150+0
+	.int .Lstring.151+0
+	.int .Lstring.152+0
+	.int .Lstring.153+0
+	.int .Lstring.154+0
+	.int .Lstring.155+0
+	.int .Lstring.130+0
+	.int .Lstring.156+0
+	.int .Lstring.157+0
+	.int .Lstring.158+0
+	.int .Lstring.159+0
+	.int .Lstring.160+0
+	.int .Lstring.161+0
+	.int .Lstring.162+0
+	.int .Lstring.163+0
+	.int .Lstring.164+0
+	.int .Lstring.165+0
+	.int .Lstring.166+0
+	.int .Lstring.167+0
+	.int .Lstring.168+0
+	.int .Lstring.169+0
+	.int .Lstring.170+0
+	.int .Lstring.171+0
+	.int .Lstring.172+0
+	.int .Lstring.173+0
+	.int .Lstring.174+0
+	.int .Lstring.175+0
+	.int .Lstring.176+0
+	.int .Lstring.177+0
+	.int .Lstring.178+0
+	.int .Lstring.179+0
+	.int .Lstring.180+0
+	.int .Lstring.181+0
+	.int .Lstring.182+0
+	.int .Lstring.183+0
+	.int .Lstring.184+0
+	.fill 64,1,0
+	.int .Lstring.185+0
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.187:
+	.ascii "BuildTools/QBE/parse.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.188:
+	.ascii "out of memory (tmph)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.189:
+	.ascii "out of memory (blkh)\000"
+/* end data */
+
+
+.text
+; function parseinit
+.global parseinit
+parseinit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 4 r5
+  load 16384 r4
+  savpc r15
+  add r15 12 r15
+  jump calloc
+  addr2reg tmph r12
+  write 0 r12 r1
+  bne r1 r0 .L19
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.188 r5
+  addr2reg .Lstring.187 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+.L19:
+  load 4 r5
+  load 8192 r4
+  savpc r15
+  add r15 12 r15
+  jump calloc
+  addr2reg blkh r12
+  write 0 r12 r1
+  bne r1 r0 .L21
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.189 r5
+  addr2reg .Lstring.187 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+.L21:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parseinit */
+
+.data
+.balign 1
+.Lstring.191:
+	.ascii "qbe:%s:%d: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.192:
+	.ascii "\012\000"
+/* end data */
+
+
+.text
+; function err
+.global err
+err:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  write 8 r14 r4
+  write 12 r14 r5
+  write 16 r14 r6
+  write 20 r14 r7
+  sub r13 28 r13
+  write -16 r14 r4
+  add r14 12 r1
+  write -20 r14 r1
+  addr2reg inpath r12
+  read 0 r12 r6
+  addr2reg lnum r12
+  read 0 r12 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.191 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  read -20 r14 r6
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump vfprintf
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.192 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function err */
+
+.data
+.balign 4
+.Ldone.194:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.195:
+	.ascii "lexh[h] == Txxx\000"
+/* end data */
+
+
+.text
+; function lexinit
+lexinit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  addr2reg .Ldone.194 r12
+  read 0 r12 r1
+  bne r1 r0 .L42
+  load 0 r1
+.L30:
+  load 90 r2
+  bges r1 r2 .L34
+  load 24 r2
+  mults r1 r2 r3
+  addr2reg optab r2
+  add r2 r3 r2
+  read 0 r2 r2
+  beq r2 r0 .L33
+  load 24 r2
+  mults r1 r2 r3
+  addr2reg optab r2
+  add r2 r3 r2
+  read 0 r2 r2
+  shiftl r1 2 r4
+  addr2reg kwmap r3
+  add r3 r4 r3
+  write 0 r3 r2
+.L33:
+  add r1 1 r1
+  jump .L30
+.L34:
+  load 0 r1
+.L35:
+  write -16 r14 r1
+  load 145 r2
+  bges r1 r2 .L41
+  shiftl r1 2 r3
+  addr2reg kwmap r2
+  add r2 r3 r2
+  read 0 r2 r2
+  beq r2 r0 .L40
+  shiftl r1 2 r2
+  addr2reg kwmap r1
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump hash
+  or r0 r1 r2
+  read -16 r14 r1
+  load32 1511660 r3
+  mults r2 r3 r2
+  shiftr r2 22 r3
+  write -12 r14 r3
+  addr2reg lexh r2
+  add r2 r3 r2
+  readbu 0 r2 r2
+  beq r2 r0 .L39
+  load 210 r6
+  addr2reg .Lstring.187 r5
+  addr2reg .Lstring.195 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+  read -12 r14 r3
+.L39:
+  addr2reg lexh r2
+  add r2 r3 r2
+  writeb 0 r2 r1
+.L40:
+  add r1 1 r1
+  jump .L35
+.L41:
+  load 1 r1
+  addr2reg .Ldone.194 r12
+  write 0 r12 r1
+.L42:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function lexinit */
+
+
+.text
+; function getint
+getint:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  addr2reg inf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  or r0 r1 r4
+  xor r4 45 r1
+  sltu r1 1 r1
+  write -12 r14 r1
+  or r0 r1 r2
+  load 1 r1
+  bne r2 r0 .L47
+  xor r4 43 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L47:
+  beq r1 r0 .L49
+  addr2reg inf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  or r0 r1 r4
+.L49:
+  load 0 r1
+  or r0 r4 r2
+.L51:
+  load 10 r3
+  mults r1 r3 r1
+  load 48 r3
+  sub r2 r3 r2
+  add r1 r2 r2
+  write -16 r14 r2
+  addr2reg inf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  read -16 r14 r2
+  load 0 r3
+  load 48 r4
+  bgts r4 r1 .L54
+  load 57 r3
+  slt r3 r1 r3
+  xor r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L54:
+  beq r3 r0 .L56
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L51
+.L56:
+  or r0 r1 r4
+  addr2reg inf r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump ungetc
+  read -16 r14 r1
+  or r0 r1 r2
+  read -12 r14 r1
+  bne r1 r0 .L59
+  or r0 r2 r1
+  jump .L60
+.L59:
+  xor r2 -1 r2
+  load 1 r1
+  add r1 r2 r1
+.L60:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function getint */
+
+.data
+.balign 1
+.Ltok.198:
+	.fill 80,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.199:
+	.ascii "unterminated string\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.200:
+	.ascii "invalid character %c (%d)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.201:
+	.ascii "identifier too long\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.202:
+	.ascii "unknown keyword %s\000"
+/* end data */
+
+
+.text
+; function lex
+lex:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 72 r13
+.L63:
+  addr2reg inf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  write -16 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isblank
+  or r0 r1 r2
+  read -16 r14 r1
+  bne r2 r0 .L63
+  or r0 r1 r4
+  addr2reg tokval r12
+  writeb 0 r12 r4
+  load 115 r1
+  beq r4 r1 .L106
+  load 115 r1
+  blt r4 r1 .L78
+  load 125 r1
+  beq r4 r1 .L77
+  load 125 r1
+  blt r4 r1 .L74
+  load32 -1 r1
+  beq r4 r1 .L73
+  load32 -1 r1
+  sltu r4 r1 r1
+  jump .L106
+.L73:
+  load 144 r1
+  jump .L162
+.L74:
+  load 123 r1
+  beq r4 r1 .L76
+  load 123 r1
+  sltu r4 r1 r1
+  jump .L106
+.L76:
+  load 140 r1
+  jump .L162
+.L77:
+  load 141 r1
+  jump .L162
+.L78:
+  load 35 r1
+  blt r4 r1 .L103
+  load 35 r1
+  sub r4 r1 r1
+  load 30 r2
+  blt r1 r2 .L82
+  load 100 r1
+  beq r4 r1 .L106
+  load 100 r1
+  sltu r4 r1 r1
+  jump .L106
+.L82:
+  shiftl r1 2 r2
+  addr2reg .Ljt82 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L83:
+  addr2reg inf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  load 0 r2
+  load 10 r3
+  bne r1 r3 .L85
+  or r0 r2 r1
+  jump .L86
+.L85:
+  load32 -1 r2
+  xor r1 r2 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L86:
+  bne r1 r0 .L83
+  jump .L105
+.L87:
+  addr2reg inf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  or r0 r1 r4
+  load 34 r1
+  beq r4 r1 .L90
+  load 132 r1
+  write -40 r14 r1
+  jump .L115
+.L90:
+  load 132 r1
+  write -48 r14 r4
+  write -64 r14 r1
+  jump .L147
+.L92:
+  addr2reg inf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  or r0 r1 r4
+  load 130 r1
+  write -40 r14 r1
+  jump .L115
+.L94:
+  load 138 r1
+  jump .L162
+.L95:
+  load 139 r1
+  jump .L162
+.L96:
+  load 135 r1
+  jump .L162
+.L97:
+  load 137 r1
+  jump .L162
+.L98:
+  addr2reg inf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  or r0 r1 r4
+  load 133 r1
+  write -40 r14 r1
+  jump .L115
+.L100:
+  load 136 r1
+  jump .L162
+.L101:
+  addr2reg inf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  or r0 r1 r4
+  load 131 r1
+  write -40 r14 r1
+  jump .L115
+.L103:
+  load 10 r1
+  beq r4 r1 .L105
+  load 10 r1
+  sltu r4 r1 r1
+  jump .L106
+.L105:
+  addr2reg lnum r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg lnum r12
+  write 0 r12 r1
+  load 142 r1
+  jump .L162
+.L106:
+  savpc r15
+  add r15 12 r15
+  jump isdigit
+  or r0 r1 r2
+  read -16 r14 r4
+  load 1 r1
+  bne r2 r0 .L108
+  xor r4 45 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L109
+.L108:
+  or r0 r1 r2
+.L109:
+  load 1 r1
+  bne r2 r0 .L111
+  xor r4 43 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L111:
+  bne r1 r0 .L161
+  load 34 r1
+  beq r4 r1 .L145
+  load 0 r1
+  write -40 r14 r1
+.L115:
+  write -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump isalpha
+  or r0 r1 r2
+  read -20 r14 r4
+  load 0 r1
+  beq r2 r0 .L117
+  or r0 r1 r2
+  jump .L118
+.L117:
+  xor r4 46 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L118:
+  load 0 r1
+  beq r2 r0 .L120
+  xor r4 95 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L120:
+  beq r1 r0 .L122
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r4 r6
+  or r0 r4 r5
+  addr2reg .Lstring.200 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -20 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L122:
+  load 0 r1
+  or r0 r1 r2
+  or r0 r4 r1
+.L124:
+  write -24 r14 r1
+  write -28 r14 r2
+  load 79 r3
+  blts r2 r3 .L126
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.201 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -24 r14 r1
+  read -28 r14 r2
+  load32 -24 r3
+  sub r13 r3 r13
+.L126:
+  add r2 1 r3
+  write -32 r14 r3
+  addr2reg .Ltok.198 r3
+  add r3 r2 r2
+  writeb 0 r2 r1
+  addr2reg inf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  write -36 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isalpha
+  or r0 r1 r4
+  read -36 r14 r1
+  read -32 r14 r2
+  load 1 r3
+  bne r4 r0 .L129
+  xor r1 36 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+  jump .L130
+.L129:
+  or r0 r3 r4
+.L130:
+  load 1 r3
+  bne r4 r0 .L132
+  xor r1 46 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+  jump .L133
+.L132:
+  or r0 r3 r4
+.L133:
+  load 1 r3
+  bne r4 r0 .L135
+  xor r1 95 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+  jump .L136
+.L135:
+  or r0 r3 r4
+.L136:
+  load 1 r3
+  bne r4 r0 .L138
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isdigit
+  or r0 r1 r3
+  read -36 r14 r1
+  read -32 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L138:
+  bne r3 r0 .L124
+  or r0 r1 r4
+  or r0 r2 r3
+  addr2reg .Ltok.198 r1
+  add r1 r3 r2
+  load 0 r1
+  writeb 0 r2 r1
+  addr2reg inf r12
+  read 0 r12 r5
+  or r0 r4 r1
+  savpc r15
+  add r15 12 r15
+  jump ungetc
+  read -40 r14 r1
+  addr2reg .Ltok.198 r2
+  addr2reg tokval+24 r12
+  write 0 r12 r2
+  bne r1 r0 .L162
+  addr2reg .Ltok.198 r4
+  savpc r15
+  add r15 12 r15
+  jump hash
+  load32 1511660 r2
+  mults r1 r2 r1
+  shiftr r1 22 r2
+  addr2reg lexh r1
+  add r1 r2 r1
+  readbu 0 r1 r1
+  write -44 r14 r1
+  load 1 r2
+  beq r1 r0 .L143
+  shiftl r1 2 r2
+  addr2reg kwmap r1
+  add r1 r2 r1
+  read 0 r1 r4
+  addr2reg .Ltok.198 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -44 r14 r1
+  xor r2 0 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L143:
+  beq r2 r0 .L162
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Ltok.198 r5
+  addr2reg .Lstring.202 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L162
+.L145:
+  load 134 r1
+  write -48 r14 r4
+  write -64 r14 r1
+.L147:
+  load 1 r6
+  load 1 r5
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -48 r14 r4
+  addr2reg tokval+24 r12
+  write 0 r12 r1
+  add r1 0 r1
+  writeb 0 r1 r4
+  load 1 r2
+  load 0 r1
+  write -56 r14 r2
+  write -52 r14 r1
+.L149:
+  addr2reg inf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  or r0 r1 r4
+  read -56 r14 r2
+  write -60 r14 r4
+  load32 -1 r1
+  bne r4 r1 .L151
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.199 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -56 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L151:
+  add r2 2 r5
+  addr2reg tokval+24 r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -56 r14 r2
+  read -52 r14 r1
+  read -60 r14 r4
+  addr2reg tokval+24 r12
+  read 0 r12 r3
+  add r3 r2 r3
+  writeb 0 r3 r4
+  load 0 r3
+  load 34 r5
+  bne r4 r5 .L153
+  xor r1 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L153:
+  bne r3 r0 .L159
+  load 0 r3
+  load 92 r5
+  beq r4 r5 .L156
+  or r0 r3 r1
+  jump .L157
+.L156:
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L157:
+  add r2 1 r2
+  write -56 r14 r2
+  write -52 r14 r1
+  jump .L149
+.L159:
+  or r0 r2 r3
+  read -64 r14 r1
+  addr2reg tokval+24 r12
+  read 0 r12 r2
+  add r3 1 r3
+  add r2 r3 r3
+  load 0 r2
+  writeb 0 r3 r2
+  jump .L162
+.L161:
+  addr2reg inf r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump ungetc
+  savpc r15
+  add r15 12 r15
+  jump getint
+  addr2reg tokval+20 r12
+  write 0 r12 r1
+  load 127 r1
+.L162:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt82:
+  .int .L83
+  .int .L87
+  .int .L92
+  .int .L106
+  .int .L106
+  .int .L94
+  .int .L95
+  .int .L106
+  .int .L96
+  .int .L97
+  .int .L106
+  .int .L106
+  .int .L106
+  .int .L106
+  .int .L106
+  .int .L106
+  .int .L106
+  .int .L106
+  .int .L106
+  .int .L106
+  .int .L106
+  .int .L106
+  .int .L106
+  .int .L98
+  .int .L106
+  .int .L106
+  .int .L100
+  .int .L106
+  .int .L106
+  .int .L101
+
+/* end function lex */
+
+
+.text
+; function nextnl
+nextnl:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+.L165:
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L167
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L167:
+  load 0 r2
+  addr2reg thead r12
+  write 0 r12 r2
+  load 142 r2
+  beq r1 r2 .L165
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function nextnl */
+
+.data
+.balign 1
+.Lstring.208:
+	.ascii "label\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.209:
+	.ascii "=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.210:
+	.ascii ",\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.211:
+	.ascii "(\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.212:
+	.ascii ")\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.213:
+	.ascii "{\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.214:
+	.ascii "}\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.215:
+	.ascii "newline\000"
+/* end data */
+
+.data
+.balign 4
+.Lttoa.207:
+	.fill 524,1,0
+	.int .Lstring.208+0
+	.fill 16,1,0
+	.int .Lstring.209+0
+	.int .Lstring.210+0
+	.int .Lstring.211+0
+	.int .Lstring.212+0
+	.int .Lstring.213+0
+	.int .Lstring.214+0
+	.int .Lstring.215+0
+	.fill 4,1,0
+	.int 0
+/* end data */
+
+.data
+.balign 1
+.Lstring.216:
+	.ascii "??\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.217:
+	.ascii "%s expected, got %s instead\000"
+/* end data */
+
+
+.text
+; function expect
+expect:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 152 r13
+  write -16 r14 r4
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L174
+  savpc r15
+  add r15 12 r15
+  jump lex
+  read -16 r14 r4
+  addr2reg thead r12
+  write 0 r12 r1
+.L174:
+  load 0 r2
+  addr2reg thead r12
+  write 0 r12 r2
+  beq r4 r1 .L185
+  shiftl r4 2 r3
+  addr2reg .Lttoa.207 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  bne r2 r0 .L179
+  addr2reg .Lstring.216 r2
+  or r0 r2 r6
+  jump .L180
+.L179:
+  shiftl r4 2 r3
+  addr2reg .Lttoa.207 r2
+  add r2 r3 r2
+  read 0 r2 r6
+.L180:
+  shiftl r1 2 r3
+  addr2reg .Lttoa.207 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  bne r2 r0 .L183
+  addr2reg .Lstring.216 r1
+  or r0 r1 r7
+  jump .L184
+.L183:
+  shiftl r1 2 r2
+  addr2reg .Lttoa.207 r1
+  add r1 r2 r1
+  read 0 r1 r7
+.L184:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.217 r5
+  add r14 -144 r4
+  savpc r15
+  add r15 12 r15
+  jump sprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  add r14 -144 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L185:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function expect */
+
+
+.text
+; function tmpref
+tmpref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 48 r13
+  or r0 r4 r5
+  write -24 r14 r5
+  addr2reg tmph r12
+  read 0 r12 r1
+  write -12 r14 r1
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump hash
+  or r0 r1 r2
+  read -12 r14 r1
+  read -24 r14 r5
+  and r2 16383 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  write -32 r14 r2
+  read 0 r2 r1
+  write -16 r14 r1
+  beq r1 r0 .L197
+  or r0 r1 r2
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -16 r14 r1
+  read -24 r14 r5
+  beq r2 r0 .L198
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 16 r1
+  read 0 r1 r1
+  load 1 r2
+  sub r1 r2 r1
+  or r0 r5 r4
+.L192:
+  write -28 r14 r1
+  load 32 r2
+  blts r1 r2 .L196
+  addr2reg curf r12
+  read 0 r12 r2
+  add r2 4 r2
+  read 0 r2 r2
+  load 160 r3
+  mults r1 r3 r3
+  or r0 r4 r1
+  add r2 r3 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -28 r14 r1
+  read -24 r14 r4
+  beq r2 r0 .L195
+  load 1 r2
+  sub r1 r2 r1
+  jump .L192
+.L195:
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -36 r14 r1
+  read -36 r14 r1
+  jump .L199
+.L196:
+  read -32 r14 r2
+.L197:
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 16 r1
+  read 0 r1 r1
+  write -20 r14 r1
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r6
+  load32 -1 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  or r0 r1 r2
+  read -20 r14 r1
+  read -24 r14 r5
+  write -40 r14 r2
+  or r0 r1 r2
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  read -20 r14 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -36 r14 r1
+  read -36 r14 r1
+  jump .L199
+.L198:
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -36 r14 r1
+  read -36 r14 r1
+.L199:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function tmpref */
+
+.data
+.balign 1
+.Lstring.220:
+	.ascii "float constants not supported on 32-bit target\000"
+/* end data */
+
+
+.text
+; function parseref
+parseref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 52 r13
+  load 32 r6
+  load 0 r5
+  add r14 -32 r4
+  savpc r15
+  add r15 12 r15
+  jump memset
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L205
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L205:
+  load 0 r2
+  addr2reg thead r12
+  write 0 r12 r2
+  load 127 r2
+  blt r1 r2 .L213
+  load 127 r2
+  sub r1 r2 r1
+  load 6 r2
+  bge r1 r2 .L215
+  shiftl r1 2 r2
+  addr2reg .Ljt208 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L209:
+  load 1 r1
+  write -32 r14 r1
+  addr2reg tokval+20 r12
+  read 0 r12 r1
+  add r14 -32 r2
+  add r2 16 r2
+  write 0 r2 r1
+  jump .L218
+.L210:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.220 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L211:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.220 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L216
+.L212:
+  addr2reg tokval+24 r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump tmpref
+  write -44 r14 r1
+  read -44 r14 r1
+  jump .L219
+.L213:
+  load 106 r2
+  beq r1 r2 .L216
+  load 106 r2
+  sltu r1 r2 r1
+.L215:
+  load 0 r1
+  write -36 r14 r1
+  read -36 r14 r1
+  jump .L219
+.L216:
+  add r14 -32 r1
+  add r1 4 r2
+  load 1 r1
+  write 0 r2 r1
+  load 132 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+.L217:
+  load 2 r1
+  write -32 r14 r1
+  addr2reg tokval+24 r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump intern
+  add r14 -32 r2
+  add r2 4 r2
+  add r2 4 r2
+  write 0 r2 r1
+.L218:
+  addr2reg curf r12
+  read 0 r12 r5
+  add r14 -32 r4
+  savpc r15
+  add r15 12 r15
+  jump newcon
+  write -40 r14 r1
+  read -40 r14 r1
+.L219:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt208:
+  .int .L209
+  .int .L210
+  .int .L211
+  .int .L212
+  .int .L215
+  .int .L217
+
+/* end function parseref */
+
+.data
+.balign 1
+.Lstring.222:
+	.ascii "undefined type :%s\000"
+/* end data */
+
+
+.text
+; function findtyp
+findtyp:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r1
+  or r0 r1 r4
+.L223:
+  load 1 r1
+  sub r4 r1 r4
+  write -16 r14 r4
+  blts r4 r0 .L226
+  or r0 r4 r2
+  addr2reg tokval+24 r12
+  read 0 r12 r4
+  addr2reg typ r12
+  read 0 r12 r1
+  load 100 r3
+  mults r2 r3 r2
+  add r1 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -16 r14 r4
+  bne r1 r0 .L223
+  or r0 r4 r1
+  jump .L227
+.L226:
+  addr2reg tokval+24 r12
+  read 0 r12 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.222 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L227:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function findtyp */
+
+.data
+.balign 1
+.Lstring.224:
+	.ascii "invalid class specifier\000"
+/* end data */
+
+
+.text
+; function parsecls
+parsecls:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L232
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L232:
+  load 0 r2
+  addr2reg thead r12
+  write 0 r12 r2
+  load 116 r2
+  sub r1 r2 r1
+  load 18 r2
+  bge r1 r2 .L239
+  shiftl r1 2 r2
+  addr2reg .Ljt234 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L235:
+  load 1 r1
+  jump .L245
+.L236:
+  load 0 r1
+  jump .L245
+.L237:
+  load 6 r1
+  jump .L245
+.L238:
+  load 7 r1
+  jump .L245
+.L239:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.224 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L244
+.L240:
+  load 4 r1
+  jump .L245
+.L241:
+  load 5 r1
+  jump .L245
+.L242:
+  load 3 r1
+  jump .L245
+.L243:
+  load 2 r1
+  jump .L245
+.L244:
+  addr2reg ntyp r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump findtyp
+  read -16 r14 r4
+  write 0 r4 r1
+  load 8 r1
+.L245:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt234:
+  .int .L235
+  .int .L236
+  .int .L237
+  .int .L238
+  .int .L239
+  .int .L240
+  .int .L241
+  .int .L239
+  .int .L242
+  .int .L243
+  .int .L239
+  .int .L239
+  .int .L239
+  .int .L239
+  .int .L239
+  .int .L239
+  .int .L239
+  .int .L244
+
+/* end function parsecls */
+
+.data
+.balign 1
+.Lstring.226:
+	.ascii "too many instructions\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.227:
+	.ascii "no parameters allowed after '...'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.228:
+	.ascii "only one '...' allowed\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.229:
+	.ascii "only one environment allowed\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.230:
+	.ascii "invalid argument\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.231:
+	.ascii "invalid function parameter\000"
+/* end data */
+
+
+.text
+; function parserefl
+parserefl:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 76 r13
+  write -68 r14 r8
+  write -44 r14 r4
+  load 138 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -44 r14 r4
+  load 0 r2
+  load 0 r1
+.L249:
+  write -32 r14 r2
+  write -20 r14 r1
+  addr2reg thead r12
+  read 0 r12 r3
+  bne r3 r0 .L252
+  savpc r15
+  add r15 12 r15
+  jump lex
+  or r0 r1 r3
+  read -32 r14 r2
+  read -20 r14 r1
+  read -44 r14 r4
+  addr2reg thead r12
+  write 0 r12 r3
+.L252:
+  load 139 r5
+  beq r3 r5 .L313
+  addr2reg curi r12
+  read 0 r12 r3
+  addr2reg insb r12
+  read 0 r12 r5
+  sub r3 r5 r3
+  shiftrs r3 31 r5
+  shiftr r5 28 r5
+  add r3 r5 r3
+  shiftrs r3 4 r3
+  load32 262144 r5
+  blts r3 r5 .L255
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.226 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -32 r14 r2
+  read -20 r14 r1
+  read -44 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+.L255:
+  load 0 r3
+  bne r4 r0 .L257
+  xor r1 0 r3
+  sltu r0 r3 r3
+.L257:
+  beq r3 r0 .L259
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.227 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -32 r14 r2
+  read -20 r14 r1
+  read -44 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+.L259:
+  or r0 r1 r3
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L261
+  savpc r15
+  add r15 12 r15
+  jump lex
+  read -32 r14 r2
+  read -20 r14 r3
+  read -44 r14 r4
+  addr2reg thead r12
+  write 0 r12 r1
+.L261:
+  or r0 r4 r5
+  load 143 r4
+  beq r1 r4 .L297
+  load 143 r3
+  bge r1 r3 .L265
+  load 98 r3
+  beq r1 r3 .L267
+  load 98 r2
+  sltu r1 r2 r1
+.L265:
+  add r14 -60 r4
+  savpc r15
+  add r15 12 r15
+  jump parsecls
+  or r0 r1 r3
+  read -32 r14 r2
+  load 0 r1
+  write -24 r14 r3
+  write -12 r14 r1
+  write -16 r14 r2
+  jump .L274
+.L267:
+  beq r2 r0 .L269
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.229 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L269:
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L271
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L271:
+  load 0 r1
+  addr2reg thead r12
+  write 0 r12 r1
+  load 1 r3
+  load 1 r2
+  load 1 r1
+  write -24 r14 r3
+  write -12 r14 r2
+  write -16 r14 r1
+.L274:
+  savpc r15
+  add r15 12 r15
+  jump parseref
+  write -64 r14 r1
+  read -64 r14 r4
+  write -28 r14 r4
+  write -56 r14 r4
+  load 0 r1
+  write -52 r14 r1
+  read -52 r14 r5
+  read -56 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r7
+  read -24 r14 r3
+  read -12 r14 r6
+  read -16 r14 r2
+  read -20 r14 r1
+  read -28 r14 r4
+  read -44 r14 r5
+  beq r7 r0 .L276
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.230 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -24 r14 r3
+  read -12 r14 r6
+  read -16 r14 r2
+  read -20 r14 r1
+  read -28 r14 r4
+  read -44 r14 r5
+  load32 -24 r7
+  sub r13 r7 r13
+.L276:
+  load 0 r7
+  write -8 r14 r7
+  xor r5 r0 r8
+  sltu r8 1 r8
+  read -8 r14 r7
+  beq r8 r0 .L278
+  read -56 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r7
+  read -24 r14 r3
+  read -12 r14 r6
+  read -16 r14 r2
+  read -20 r14 r1
+  read -28 r14 r4
+  read -44 r14 r5
+  xor r7 0 r7
+  sltu r0 r7 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L278:
+  beq r7 r0 .L280
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.231 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -24 r14 r3
+  read -12 r14 r6
+  read -16 r14 r2
+  read -20 r14 r1
+  read -28 r14 r4
+  read -44 r14 r5
+  load32 -24 r7
+  sub r13 r7 r13
+.L280:
+  bne r6 r0 .L292
+  load 8 r6
+  beq r3 r6 .L289
+  load 4 r6
+  bges r3 r6 .L286
+  bne r5 r0 .L285
+  shiftl r3 30 r3
+  load32 -1073741824 r5
+  and r3 r5 r3
+  or r3 109 r5
+  addr2reg curi r12
+  read 0 r12 r3
+  write 0 r3 r5
+  add r3 4 r3
+  write 0 r3 r4
+  add r3 4 r3
+  load 0 r4
+  write 0 r3 r4
+  add r3 4 r4
+  load 0 r3
+  write 0 r4 r3
+  jump .L295
+.L285:
+  shiftl r3 30 r3
+  load32 -1073741824 r5
+  and r3 r5 r3
+  or r3 116 r5
+  addr2reg curi r12
+  read 0 r12 r3
+  write 0 r3 r5
+  add r3 4 r3
+  load 0 r5
+  write 0 r3 r5
+  add r3 4 r3
+  write 0 r3 r4
+  add r3 4 r4
+  load 0 r3
+  write 0 r4 r3
+  jump .L295
+.L286:
+  bne r5 r0 .L288
+  load 4 r5
+  sub r3 r5 r5
+  load 110 r3
+  add r3 r5 r3
+  load32 1073741823 r5
+  and r3 r5 r3
+  or r3 0 r3
+  load32 1073741823 r5
+  and r3 r5 r5
+  load 0 r3
+  or r3 r5 r5
+  addr2reg curi r12
+  read 0 r12 r3
+  write 0 r3 r5
+  add r3 4 r3
+  write 0 r3 r4
+  add r3 4 r3
+  load 0 r4
+  write 0 r3 r4
+  add r3 4 r4
+  load 0 r3
+  write 0 r4 r3
+  jump .L295
+.L288:
+  load 4 r5
+  sub r3 r5 r5
+  load 117 r3
+  add r3 r5 r3
+  load32 1073741823 r5
+  and r3 r5 r3
+  or r3 0 r3
+  load32 1073741823 r5
+  and r3 r5 r5
+  load 0 r3
+  or r3 r5 r5
+  addr2reg curi r12
+  read 0 r12 r3
+  write 0 r3 r5
+  add r3 4 r3
+  load 0 r5
+  write 0 r3 r5
+  add r3 4 r3
+  write 0 r3 r4
+  add r3 4 r4
+  load 0 r3
+  write 0 r4 r3
+  jump .L295
+.L289:
+  bne r5 r0 .L291
+  read -60 r14 r3
+  shiftl r3 3 r3
+  load32 -8 r5
+  and r3 r5 r3
+  or r0 r4 r5
+  or r3 3 r4
+  addr2reg curi r12
+  read 0 r12 r3
+  load32 1073741938 r6
+  write 0 r3 r6
+  add r3 4 r3
+  write 0 r3 r5
+  add r3 4 r3
+  write 0 r3 r4
+  add r3 4 r4
+  load 0 r3
+  write 0 r4 r3
+  jump .L295
+.L291:
+  read -60 r14 r3
+  shiftl r3 3 r3
+  load32 -8 r5
+  and r3 r5 r3
+  or r3 3 r5
+  addr2reg curi r12
+  read 0 r12 r3
+  load32 1073741945 r6
+  write 0 r3 r6
+  add r3 4 r3
+  load 0 r6
+  write 0 r3 r6
+  add r3 4 r3
+  write 0 r3 r5
+  add r3 4 r3
+  write 0 r3 r4
+  jump .L295
+.L292:
+  bne r5 r0 .L294
+  shiftl r3 30 r3
+  load32 -1073741824 r5
+  and r3 r5 r3
+  or r3 115 r5
+  addr2reg curi r12
+  read 0 r12 r3
+  write 0 r3 r5
+  add r3 4 r3
+  write 0 r3 r4
+  add r3 4 r3
+  load 0 r4
+  write 0 r3 r4
+  add r3 4 r4
+  load 0 r3
+  write 0 r4 r3
+  jump .L295
+.L294:
+  shiftl r3 30 r3
+  load32 -1073741824 r5
+  and r3 r5 r3
+  or r3 122 r5
+  addr2reg curi r12
+  read 0 r12 r3
+  write 0 r3 r5
+  add r3 4 r3
+  load 0 r5
+  write 0 r3 r5
+  add r3 4 r3
+  write 0 r3 r4
+  add r3 4 r4
+  load 0 r3
+  write 0 r4 r3
+.L295:
+  addr2reg curi r12
+  read 0 r12 r3
+  add r3 16 r3
+  addr2reg curi r12
+  write 0 r12 r3
+  write -36 r14 r2
+  write -40 r14 r1
+  jump .L307
+.L297:
+  or r0 r3 r1
+  or r0 r5 r4
+  beq r1 r0 .L300
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.228 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -32 r14 r2
+  read -44 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L300:
+  beq r4 r0 .L302
+  addr2reg curi r12
+  read 0 r12 r1
+  load 123 r3
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r3
+  load 0 r1
+  write 0 r3 r1
+  addr2reg curi r12
+  read 0 r12 r1
+  add r1 16 r1
+  addr2reg curi r12
+  write 0 r12 r1
+.L302:
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L304
+  savpc r15
+  add r15 12 r15
+  jump lex
+  read -32 r14 r2
+  addr2reg thead r12
+  write 0 r12 r1
+.L304:
+  load 0 r1
+  addr2reg thead r12
+  write 0 r12 r1
+  load 1 r1
+  write -36 r14 r2
+  write -40 r14 r1
+.L307:
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L309
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L309:
+  load 139 r2
+  beq r1 r2 .L311
+  load 137 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -36 r14 r2
+  read -40 r14 r1
+  read -44 r14 r4
+  jump .L249
+.L311:
+  read -40 r14 r1
+  write -48 r14 r1
+  jump .L314
+.L313:
+  write -48 r14 r1
+.L314:
+  load 139 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -48 r14 r1
+  read -68 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parserefl */
+
+
+.text
+; function findblk
+findblk:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r5
+  write -8 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump hash
+  read -8 r14 r5
+  and r1 8191 r3
+  write -16 r14 r3
+  addr2reg blkh r12
+  read 0 r12 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  or r0 r5 r4
+.L320:
+  or r0 r1 r2
+  write -12 r14 r2
+  beq r2 r0 .L323
+  or r0 r4 r1
+  add r2 124 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -12 r14 r1
+  read -8 r14 r4
+  beq r2 r0 .L324
+  add r1 64 r1
+  read 0 r1 r1
+  jump .L320
+.L323:
+  savpc r15
+  add r15 12 r15
+  jump newblk
+  read -8 r14 r5
+  write -4 r14 r1
+  addr2reg nblk r12
+  read 0 r12 r2
+  add r2 1 r3
+  addr2reg nblk r12
+  write 0 r12 r3
+  add r1 48 r3
+  write 0 r3 r2
+  add r1 124 r4
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  read -4 r14 r1
+  read -16 r14 r3
+  addr2reg blkh r12
+  read 0 r12 r2
+  shiftl r3 2 r4
+  add r2 r4 r2
+  read 0 r2 r2
+  add r1 64 r4
+  write 0 r4 r2
+  addr2reg blkh r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+.L324:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function findblk */
+
+
+.text
+; function closeblk
+closeblk:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg curi r12
+  read 0 r12 r1
+  addr2reg insb r12
+  read 0 r12 r2
+  sub r1 r2 r1
+  shiftrs r1 31 r2
+  shiftr r2 28 r2
+  add r1 r2 r1
+  shiftrs r1 4 r1
+  addr2reg curb r12
+  read 0 r12 r2
+  add r2 8 r2
+  write 0 r2 r1
+  addr2reg curb r12
+  read 0 r12 r1
+  add r1 4 r4
+  addr2reg insb r12
+  read 0 r12 r5
+  add r1 8 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump idup
+  addr2reg curb r12
+  read 0 r12 r1
+  add r1 44 r1
+  addr2reg blink r12
+  write 0 r12 r1
+  addr2reg insb r12
+  read 0 r12 r1
+  addr2reg curi r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function closeblk */
+
+.data
+.balign 1
+.Lstring.235:
+	.ascii "invalid jump to the start block\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.236:
+	.ascii "jtab needs at least one target\000"
+/* end data */
+
+
+.text
+; function parsejtab
+parsejtab:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+  load 1 r6
+  load 4 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -12 r14 r4
+  add r4 28 r2
+  write 0 r2 r1
+  load 1 r6
+  load 4 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -12 r14 r4
+  add r4 36 r2
+  write 0 r2 r1
+.L332:
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L334
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L334:
+  load 137 r2
+  bne r1 r2 .L347
+  bne r1 r0 .L337
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L337:
+  load 0 r1
+  addr2reg thead r12
+  write 0 r12 r1
+  load 131 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg tokval+24 r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump findblk
+  or r0 r1 r2
+  read -12 r14 r4
+  write -8 r14 r2
+  addr2reg curf r12
+  read 0 r12 r1
+  read 0 r1 r1
+  bne r2 r1 .L340
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.235 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -8 r14 r2
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L340:
+  load 0 r1
+.L341:
+  write -16 r14 r1
+  add r4 32 r3
+  read 0 r3 r3
+  bge r1 r3 .L344
+  add r4 28 r5
+  read 0 r5 r5
+  shiftl r1 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  beq r5 r2 .L344
+  add r1 1 r1
+  jump .L341
+.L344:
+  bne r1 r3 .L346
+  or r0 r4 r1
+  add r4 28 r4
+  add r1 32 r1
+  add r3 1 r5
+  write 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -16 r14 r1
+  read -8 r14 r2
+  read -12 r14 r4
+  or r0 r1 r3
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r3 2 r3
+  add r1 r3 r1
+  write 0 r1 r2
+.L346:
+  or r0 r4 r1
+  add r4 36 r4
+  add r1 40 r1
+  read 0 r1 r2
+  add r2 1 r5
+  write 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -16 r14 r1
+  read -12 r14 r4
+  add r4 36 r2
+  read 0 r2 r2
+  add r4 40 r3
+  read 0 r3 r3
+  load 1 r5
+  sub r3 r5 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  jump .L332
+.L347:
+  read -12 r14 r4
+  add r4 40 r1
+  read 0 r1 r1
+  bne r1 r0 .L350
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.236 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L350:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parsejtab */
+
+.data
+.balign 1
+.Lstring.238:
+	.ascii "label or } expected\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.239:
+	.ascii "label, instruction or jump expected\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.240:
+	.ascii "multiple definitions of block @%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.241:
+	.ascii "invalid return value\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.242:
+	.ascii "invalid argument for jnz jump\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.243:
+	.ascii "invalid argument for jtab jump\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.244:
+	.ascii "line number too big\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.245:
+	.ascii "column number too big\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.246:
+	.ascii "cannot use vastart in non-variadic function\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.247:
+	.ascii "size class must be w, l, s, or d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.248:
+	.ascii "too many arguments\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.249:
+	.ascii "invalid instruction argument\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.250:
+	.ascii ", or end of line expected\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.251:
+	.ascii "unexpected phi instruction\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.252:
+	.ascii "blit size must be constant\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.253:
+	.ascii "invalid blit size\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.254:
+	.ascii "invalid instruction\000"
+/* end data */
+
+
+.text
+; function parseline
+parseline:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 644 r13
+  write -48 r14 r4
+  load 0 r1
+  write -612 r14 r1
+  add r14 -612 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 12 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 16 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 20 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 24 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 28 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 32 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 36 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 40 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 44 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 48 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 52 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 56 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 60 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 64 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 68 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 72 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 76 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 80 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 84 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 88 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 92 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 96 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 100 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 104 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 108 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 112 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 116 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 120 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 124 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 128 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 132 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 136 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 140 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 144 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 148 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 152 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 156 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 160 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 164 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 168 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 172 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 176 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 180 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 184 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 188 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 192 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 196 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 200 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 204 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 208 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 212 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 216 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 220 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 224 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 228 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 232 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 236 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 240 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 244 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 248 r2
+  load 0 r1
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  or r0 r1 r3
+  read -48 r14 r4
+  write -12 r14 r3
+  load 0 r1
+  load 1 r2
+  beq r4 r2 .L355
+  or r0 r1 r2
+  jump .L356
+.L355:
+  xor r3 131 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L356:
+  load 0 r1
+  beq r2 r0 .L358
+  xor r3 141 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L358:
+  beq r1 r0 .L360
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.238 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -12 r14 r3
+  read -48 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L360:
+  load 131 r1
+  bne r3 r1 8
+  jump .L501
+  load 131 r1
+  blt r3 r1 .L364
+  load 141 r1
+  beq r3 r1 .L370
+  load 141 r1
+  sltu r3 r1 r1
+  jump .L368
+.L364:
+  load 130 r1
+  beq r3 r1 .L419
+  load 130 r1
+  bge r3 r1 .L368
+  load 87 r1
+  sub r3 r1 r1
+  load 18 r2
+  bge r1 r2 .L368
+  shiftl r1 2 r2
+  addr2reg .Ljt367 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L368:
+  load 53 r1
+  sub r3 r1 r1
+  load 5 r2
+  ble r1 r2 .L371
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.239 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L370:
+  load 4 r1
+  jump .L509
+.L371:
+  load 0 r1
+  write -108 r14 r1
+  load 0 r2
+  load 0 r1
+  jump .L423
+.L372:
+  load 0 r1
+  write -108 r14 r1
+  load 127 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -12 r14 r3
+  addr2reg tokval+20 r12
+  read 0 r12 r1
+  load32 536870911 r2
+  and r1 r2 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 2 r1
+  add r14 -612 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  addr2reg tokval+20 r12
+  read 0 r12 r2
+  beq r1 r2 .L374
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.244 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -12 r14 r3
+  load32 -24 r1
+  sub r13 r1 r13
+.L374:
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L376
+  savpc r15
+  add r15 12 r15
+  jump lex
+  read -12 r14 r3
+  addr2reg thead r12
+  write 0 r12 r1
+.L376:
+  load 137 r2
+  beq r1 r2 .L378
+  add r14 -612 r1
+  add r1 4 r2
+  load 2 r1
+  write 0 r2 r1
+  jump .L383
+.L378:
+  bne r1 r0 .L380
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L380:
+  load 0 r1
+  addr2reg thead r12
+  write 0 r12 r1
+  load 127 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -12 r14 r3
+  addr2reg tokval+20 r12
+  read 0 r12 r1
+  load32 536870911 r2
+  and r1 r2 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 2 r1
+  add r14 -612 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  addr2reg tokval+20 r12
+  read 0 r12 r2
+  beq r1 r2 .L383
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.245 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -12 r14 r3
+  load32 -24 r1
+  sub r13 r1 r13
+.L383:
+  load 0 r2
+  load 0 r1
+  jump .L498
+.L384:
+  addr2reg curb r12
+  read 0 r12 r1
+  add r1 12 r2
+  load 11 r1
+  writeh 0 r2 r1
+  jump .L388
+.L385:
+  addr2reg curb r12
+  read 0 r12 r1
+  add r1 12 r2
+  load 12 r1
+  writeh 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump parseref
+  write -628 r14 r1
+  read -628 r14 r1
+  write -16 r14 r1
+  write -108 r14 r1
+  load 0 r1
+  write -100 r14 r1
+  read -100 r14 r5
+  read -108 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -16 r14 r1
+  beq r2 r0 .L387
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.242 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L387:
+  addr2reg curb r12
+  read 0 r12 r2
+  add r2 12 r2
+  add r2 4 r2
+  write 0 r2 r1
+  load 137 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+.L388:
+  load 131 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg tokval+24 r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump findblk
+  addr2reg curb r12
+  read 0 r12 r2
+  add r2 20 r2
+  write 0 r2 r1
+  addr2reg curb r12
+  read 0 r12 r1
+  add r1 12 r1
+  readh 0 r1 r1
+  load 11 r2
+  beq r1 r2 .L400
+  load 137 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  load 131 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg tokval+24 r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump findblk
+  addr2reg curb r12
+  read 0 r12 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L392
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L392:
+  load 137 r2
+  bne r1 r2 .L400
+  bne r1 r0 .L395
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L395:
+  load 0 r1
+  addr2reg thead r12
+  write 0 r12 r1
+  load 127 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg tokval+20 r12
+  read 0 r12 r1
+  bne r1 r0 .L398
+  load 2 r1
+  jump .L399
+.L398:
+  load 1 r1
+.L399:
+  addr2reg curb r12
+  read 0 r12 r2
+  add r2 12 r2
+  add r2 2 r2
+  writeh 0 r2 r1
+.L400:
+  addr2reg curb r12
+  read 0 r12 r1
+  add r1 20 r2
+  read 0 r2 r4
+  addr2reg curf r12
+  read 0 r12 r2
+  read 0 r2 r5
+  load 1 r3
+  beq r4 r5 .L402
+  add r1 24 r1
+  read 0 r1 r1
+  read 0 r2 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L403
+.L402:
+  or r0 r3 r1
+.L403:
+  beq r1 r0 .L418
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.235 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L418
+.L405:
+  addr2reg curb r12
+  read 0 r12 r1
+  add r1 12 r2
+  load 32 r1
+  writeh 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump parseref
+  write -624 r14 r1
+  read -624 r14 r1
+  write -20 r14 r1
+  write -108 r14 r1
+  load 0 r1
+  write -100 r14 r1
+  read -100 r14 r5
+  read -108 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -20 r14 r1
+  beq r2 r0 .L407
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.243 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -20 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L407:
+  addr2reg curb r12
+  read 0 r12 r2
+  add r2 12 r2
+  add r2 4 r2
+  write 0 r2 r1
+  addr2reg curb r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump parsejtab
+  jump .L418
+.L408:
+  addr2reg rcls r12
+  read 0 r12 r2
+  load 1 r1
+  add r1 r2 r1
+  addr2reg curb r12
+  read 0 r12 r2
+  add r2 12 r2
+  writeh 0 r2 r1
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L411
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L411:
+  load 142 r2
+  beq r1 r2 .L416
+  addr2reg rcls r12
+  read 0 r12 r1
+  load 9 r2
+  beq r1 r2 .L418
+  savpc r15
+  add r15 12 r15
+  jump parseref
+  write -632 r14 r1
+  read -632 r14 r1
+  write -24 r14 r1
+  write -108 r14 r1
+  load 0 r1
+  write -100 r14 r1
+  read -100 r14 r5
+  read -108 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -24 r14 r1
+  beq r2 r0 .L415
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.241 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -24 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L415:
+  addr2reg curb r12
+  read 0 r12 r2
+  add r2 12 r2
+  add r2 4 r2
+  write 0 r2 r1
+  jump .L418
+.L416:
+  addr2reg curb r12
+  read 0 r12 r1
+  add r1 12 r2
+  load 10 r1
+  writeh 0 r2 r1
+  jump .L418
+.L417:
+  addr2reg curb r12
+  read 0 r12 r1
+  add r1 12 r2
+  load 31 r1
+  writeh 0 r2 r1
+.L418:
+  load 142 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  savpc r15
+  add r15 12 r15
+  jump closeblk
+  load 1 r1
+  jump .L509
+.L419:
+  addr2reg tokval+24 r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump tmpref
+  write -636 r14 r1
+  read -636 r14 r1
+  write -32 r14 r1
+  write -108 r14 r1
+  load 136 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  add r14 -104 r4
+  savpc r15
+  add r15 12 r15
+  jump parsecls
+  or r0 r1 r2
+  read -32 r14 r1
+  read -48 r14 r4
+  write -28 r14 r2
+  addr2reg thead r12
+  read 0 r12 r3
+  bne r3 r0 .L422
+  savpc r15
+  add r15 12 r15
+  jump lex
+  or r0 r1 r3
+  read -28 r14 r2
+  read -32 r14 r1
+  read -48 r14 r4
+  addr2reg thead r12
+  write 0 r12 r3
+.L422:
+  load 0 r5
+  addr2reg thead r12
+  write 0 r12 r5
+.L423:
+  write -80 r14 r2
+  write -76 r14 r1
+  load 97 r5
+  beq r3 r5 .L493
+  load 90 r5
+  bne r3 r5 .L426
+  load 63 r3
+.L426:
+  load 0 r5
+  load 91 r6
+  blts r3 r6 .L428
+  load 93 r5
+  slt r5 r3 r5
+  xor r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L428:
+  beq r5 r0 .L430
+  load 65 r3
+.L430:
+  load 1 r5
+  load 94 r6
+  beq r3 r6 .L432
+  xor r3 95 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L432:
+  beq r5 r0 .L434
+  load 83 r3
+.L434:
+  write -52 r14 r3
+  load 0 r5
+  load 87 r6
+  bne r3 r6 .L436
+  addr2reg curf r12
+  read 0 r12 r5
+  add r5 52 r5
+  readb 0 r5 r5
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L436:
+  beq r5 r0 .L438
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.246 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -76 r14 r1
+  read -52 r14 r3
+  read -80 r14 r2
+  read -48 r14 r4
+  load32 -24 r5
+  sub r13 r5 r13
+.L438:
+  load 4 r5
+  blts r2 r5 .L440
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.247 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -76 r14 r1
+  read -52 r14 r3
+  read -80 r14 r2
+  read -48 r14 r4
+  load32 -24 r5
+  sub r13 r5 r13
+.L440:
+  or r0 r2 r5
+  addr2reg thead r12
+  read 0 r12 r2
+  bne r2 r0 .L442
+  savpc r15
+  add r15 12 r15
+  jump lex
+  or r0 r1 r5
+  read -76 r14 r1
+  read -52 r14 r3
+  or r0 r5 r2
+  read -80 r14 r5
+  read -48 r14 r4
+  addr2reg thead r12
+  write 0 r12 r2
+.L442:
+  or r0 r4 r6
+  load 0 r4
+  load 142 r7
+  bne r2 r7 .L444
+  write -68 r14 r4
+  or r0 r5 r12
+  or r0 r1 r5
+  or r0 r12 r1
+  or r0 r2 r12
+  or r0 r5 r2
+  or r0 r12 r5
+  jump .L465
+.L444:
+  load 0 r2
+  write -44 r14 r1
+.L446:
+  write -36 r14 r2
+  load 63 r1
+  bne r2 r1 .L449
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.248 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -52 r14 r3
+  load32 -24 r1
+  sub r13 r1 r13
+.L449:
+  load 99 r1
+  bne r3 r1 .L451
+  load 131 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg tokval+24 r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump findblk
+  read -36 r14 r2
+  shiftl r2 2 r3
+  add r14 -360 r2
+  add r2 r3 r2
+  write 0 r2 r1
+.L451:
+  savpc r15
+  add r15 12 r15
+  jump parseref
+  read -36 r14 r2
+  write -616 r14 r1
+  shiftl r2 2 r3
+  add r14 -612 r1
+  add r1 r3 r3
+  read -616 r14 r1
+  write 0 r3 r1
+  shiftl r2 2 r2
+  add r14 -612 r1
+  add r1 r2 r1
+  load 0 r2
+  write -100 r14 r2
+  read -100 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -44 r14 r1
+  read -36 r14 r2
+  read -52 r14 r3
+  beq r4 r0 .L453
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.249 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -44 r14 r1
+  read -36 r14 r2
+  read -52 r14 r3
+  load32 -24 r4
+  sub r13 r4 r13
+.L453:
+  add r2 1 r2
+  write -40 r14 r2
+  addr2reg thead r12
+  read 0 r12 r4
+  bne r4 r0 .L456
+  savpc r15
+  add r15 12 r15
+  jump lex
+  or r0 r1 r4
+  read -44 r14 r1
+  read -52 r14 r3
+  read -40 r14 r2
+  addr2reg thead r12
+  write 0 r12 r4
+.L456:
+  load 142 r5
+  beq r4 r5 .L463
+  load 137 r5
+  beq r4 r5 .L459
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.250 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -44 r14 r1
+  read -52 r14 r3
+  read -40 r14 r2
+  load32 -24 r4
+  sub r13 r4 r13
+.L459:
+  addr2reg thead r12
+  read 0 r12 r4
+  bne r4 r0 .L461
+  savpc r15
+  add r15 12 r15
+  jump lex
+  or r0 r1 r4
+  read -44 r14 r1
+  read -52 r14 r3
+  read -40 r14 r2
+  addr2reg thead r12
+  write 0 r12 r4
+.L461:
+  load 0 r4
+  addr2reg thead r12
+  write 0 r12 r4
+  write -44 r14 r1
+  jump .L446
+.L463:
+  read -80 r14 r5
+  read -48 r14 r6
+  write -68 r14 r2
+  or r0 r1 r2
+  or r0 r5 r1
+  or r0 r4 r5
+.L465:
+  or r0 r6 r4
+  write -64 r14 r2
+  bne r5 r0 .L468
+  savpc r15
+  add r15 12 r15
+  jump lex
+  or r0 r1 r5
+  read -64 r14 r1
+  read -52 r14 r3
+  or r0 r1 r2
+  read -80 r14 r1
+  read -48 r14 r4
+  addr2reg thead r12
+  write 0 r12 r5
+.L468:
+  load 0 r5
+  addr2reg thead r12
+  write 0 r12 r5
+  load 99 r5
+  beq r3 r5 .L488
+  load 99 r4
+  bge r3 r4 .L473
+  load 96 r4
+  beq r3 r4 .L476
+  load 96 r4
+  sltu r3 r4 r4
+.L473:
+  load 90 r4
+  blts r3 r4 .L475
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.254 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -64 r14 r1
+  read -52 r14 r3
+  or r0 r1 r2
+  read -80 r14 r1
+  load32 -24 r4
+  sub r13 r4 r13
+.L475:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L498
+.L476:
+  addr2reg curi r12
+  read 0 r12 r1
+  addr2reg insb r12
+  read 0 r12 r2
+  sub r1 r2 r1
+  shiftrs r1 31 r2
+  shiftr r2 28 r2
+  add r1 r2 r1
+  shiftrs r1 4 r1
+  load32 262143 r2
+  blts r1 r2 .L478
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.226 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L478:
+  addr2reg curi r12
+  read 0 r12 r4
+  load 32 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  addr2reg curi r12
+  read 0 r12 r2
+  read 0 r2 r1
+  load32 -1073741824 r3
+  and r1 r3 r3
+  load 92 r1
+  or r1 r3 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 0 r1
+  addr2reg curi r12
+  read 0 r12 r2
+  add r2 8 r2
+  add r2 0 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 4 r1
+  addr2reg curi r12
+  read 0 r12 r2
+  add r2 8 r2
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  addr2reg curi r12
+  read 0 r12 r1
+  add r1 16 r1
+  addr2reg curi r12
+  write 0 r12 r1
+  add r14 -612 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  load 1 r2
+  beq r1 r2 .L480
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.252 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L480:
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -612 r2
+  add r2 8 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r3
+  write -56 r14 r3
+  add r3 16 r1
+  read 0 r1 r1
+  load32 536870911 r2
+  and r1 r2 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 2 r1
+  write -60 r14 r1
+  write -108 r14 r1
+  read 0 r3 r3
+  load 1 r2
+  load 1 r4
+  bne r3 r4 .L482
+  read -108 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  or r0 r1 r2
+  read -60 r14 r1
+  slt r2 r0 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L483
+.L482:
+  or r0 r2 r3
+.L483:
+  load 1 r2
+  bne r3 r0 .L485
+  read -108 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  or r0 r1 r2
+  read -60 r14 r1
+  read -56 r14 r3
+  add r3 16 r3
+  read 0 r3 r3
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L485:
+  beq r2 r0 .L487
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.253 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -60 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L487:
+  addr2reg curi r12
+  read 0 r12 r3
+  read 0 r3 r2
+  load32 -1073741824 r4
+  and r2 r4 r4
+  load 93 r2
+  or r2 r4 r2
+  write 0 r3 r2
+  addr2reg curi r12
+  read 0 r12 r2
+  add r2 8 r2
+  add r2 0 r2
+  write 0 r2 r1
+  addr2reg curi r12
+  read 0 r12 r1
+  add r1 16 r1
+  addr2reg curi r12
+  write 0 r12 r1
+  load 3 r1
+  jump .L509
+.L488:
+  load 1 r1
+  load 2 r2
+  bne r4 r2 .L490
+  addr2reg curb r12
+  read 0 r12 r1
+  addr2reg curf r12
+  read 0 r12 r2
+  read 0 r2 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L490:
+  beq r1 r0 .L492
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.251 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L492:
+  load 24 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r3
+  read -64 r14 r1
+  read -68 r14 r2
+  or r0 r1 r4
+  read -80 r14 r1
+  write -72 r14 r3
+  write 0 r3 r4
+  add r3 16 r3
+  write 0 r3 r1
+  load 1 r6
+  load 4 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r4
+  read -68 r14 r2
+  read -72 r14 r1
+  add r1 4 r1
+  write 0 r1 r4
+  shiftl r2 2 r6
+  add r14 -612 r5
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -68 r14 r2
+  load 1 r6
+  load 4 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r4
+  read -68 r14 r2
+  read -72 r14 r1
+  add r1 8 r1
+  write 0 r1 r4
+  shiftl r2 2 r6
+  add r14 -360 r5
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -68 r14 r2
+  read -72 r14 r1
+  add r1 12 r3
+  write 0 r3 r2
+  addr2reg plink r12
+  read 0 r12 r2
+  write 0 r2 r1
+  add r1 20 r1
+  addr2reg plink r12
+  write 0 r12 r1
+  load 2 r1
+  jump .L509
+.L493:
+  savpc r15
+  add r15 12 r15
+  jump parseref
+  write -620 r14 r1
+  add r14 -612 r1
+  add r1 0 r2
+  read -620 r14 r1
+  write 0 r2 r1
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump parserefl
+  load 142 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -76 r14 r1
+  read -80 r14 r2
+  load 8 r3
+  bne r2 r3 .L495
+  read -104 r14 r2
+  shiftl r2 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 3 r2
+  add r14 -612 r3
+  add r3 4 r3
+  write 0 r3 r2
+  load 1 r2
+.L495:
+  load 4 r3
+  blts r2 r3 .L497
+  load 0 r2
+.L497:
+  load 124 r3
+.L498:
+  write -92 r14 r3
+  write -88 r14 r2
+  write -84 r14 r1
+  addr2reg curi r12
+  read 0 r12 r4
+  addr2reg insb r12
+  read 0 r12 r5
+  sub r4 r5 r4
+  shiftrs r4 31 r5
+  shiftr r5 28 r5
+  add r4 r5 r4
+  shiftrs r4 4 r4
+  load32 262144 r5
+  blts r4 r5 .L500
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.226 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -84 r14 r1
+  read -92 r14 r3
+  read -88 r14 r2
+  load32 -24 r4
+  sub r13 r4 r13
+.L500:
+  addr2reg curi r12
+  read 0 r12 r4
+  load32 1073741823 r5
+  and r3 r5 r3
+  read 0 r4 r5
+  load32 -1073741824 r6
+  and r5 r6 r5
+  or r3 r5 r3
+  write 0 r4 r3
+  addr2reg curi r12
+  read 0 r12 r3
+  shiftl r2 30 r2
+  load32 -1073741824 r4
+  and r2 r4 r2
+  read 0 r3 r4
+  load32 1073741823 r5
+  and r4 r5 r4
+  or r2 r4 r2
+  write 0 r3 r2
+  addr2reg curi r12
+  read 0 r12 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 0 r1
+  addr2reg curi r12
+  read 0 r12 r2
+  add r2 8 r2
+  add r2 0 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  add r14 -612 r1
+  add r1 4 r1
+  addr2reg curi r12
+  read 0 r12 r2
+  add r2 8 r2
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  addr2reg curi r12
+  read 0 r12 r1
+  add r1 16 r1
+  addr2reg curi r12
+  write 0 r12 r1
+  load 3 r1
+  jump .L509
+.L501:
+  addr2reg tokval+24 r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump findblk
+  write -96 r14 r1
+  addr2reg curb r12
+  read 0 r12 r2
+  load 0 r3
+  bne r2 r0 .L503
+  or r0 r3 r2
+  jump .L504
+.L503:
+  add r2 12 r2
+  readh 0 r2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L504:
+  beq r2 r0 .L506
+  savpc r15
+  add r15 12 r15
+  jump closeblk
+  read -96 r14 r1
+  addr2reg curb r12
+  read 0 r12 r2
+  add r2 12 r3
+  load 11 r2
+  writeh 0 r3 r2
+  addr2reg curb r12
+  read 0 r12 r2
+  add r2 20 r2
+  write 0 r2 r1
+.L506:
+  add r1 12 r2
+  readh 0 r2 r2
+  beq r2 r0 .L508
+  add r1 124 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.240 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -96 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L508:
+  addr2reg blink r12
+  read 0 r12 r2
+  write 0 r2 r1
+  addr2reg curb r12
+  write 0 r12 r1
+  addr2reg plink r12
+  write 0 r12 r1
+  load 142 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  load 2 r1
+.L509:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt367:
+  .int .L371
+  .int .L368
+  .int .L372
+  .int .L368
+  .int .L368
+  .int .L368
+  .int .L368
+  .int .L368
+  .int .L368
+  .int .L371
+  .int .L371
+  .int .L368
+  .int .L368
+  .int .L384
+  .int .L385
+  .int .L405
+  .int .L408
+  .int .L417
+
+/* end function parseline */
+
+
+.text
+; function usecheck
+usecheck:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r6
+  write -16 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -12 r14 r6
+  read -16 r14 r5
+  load 1 r1
+  bne r2 r0 .L514
+  add r6 4 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r1
+  xor r1 r5 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L515
+.L514:
+  or r0 r1 r2
+.L515:
+  load 1 r1
+  bne r2 r0 .L519
+  add r6 4 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r2
+  load 0 r1
+  load 1 r3
+  bne r2 r3 .L518
+  xor r5 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L518:
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L520
+.L519:
+  or r0 r1 r2
+.L520:
+  load 1 r1
+  bne r2 r0 .L527
+  addr2reg T+36 r12
+  read 0 r12 r2
+  load 0 r1
+  beq r2 r0 .L523
+  or r0 r1 r2
+  jump .L524
+.L523:
+  add r6 4 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L524:
+  load 0 r1
+  beq r2 r0 .L526
+  xor r5 1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L526:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L527:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function usecheck */
+
+.data
+.balign 1
+.Lstring.257:
+	.ascii "temporary %%%s is assigned with multiple types\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.258:
+	.ascii "multiple entries for @%s in phi %%%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.259:
+	.ascii "invalid type for operand %%%s in phi %%%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.260:
+	.ascii "predecessors not matched in phi %%%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.261:
+	.ascii "invalid instruction type in %s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.262:
+	.ascii "second\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.263:
+	.ascii "first\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.264:
+	.ascii "no %s operand expected in %s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.265:
+	.ascii "missing %s operand in %s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.266:
+	.ascii "invalid type for %s operand %%%s in %s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.267:
+	.ascii "invalid type for jump argument %%%s in block @%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.268:
+	.ascii "block @%s is used undefined\000"
+/* end data */
+
+
+.text
+; function typecheck
+typecheck:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 108 r13
+  write -80 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillpreds
+  read -80 r14 r4
+  add r4 28 r1
+  read 0 r1 r5
+  add r14 -96 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -80 r14 r4
+  add r4 28 r1
+  read 0 r1 r5
+  add r14 -88 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -80 r14 r4
+  read 0 r4 r1
+.L531:
+  write -72 r14 r1
+  beq r1 r0 .L544
+  read 0 r1 r2
+.L533:
+  beq r2 r0 .L536
+  add r2 16 r3
+  read 0 r3 r3
+  add r4 4 r5
+  read 0 r5 r5
+  read 0 r2 r6
+  shiftr r6 3 r6
+  load 160 r7
+  mults r6 r7 r6
+  add r5 r6 r5
+  add r5 108 r5
+  writeh 0 r5 r3
+  add r2 20 r2
+  read 0 r2 r2
+  jump .L533
+.L536:
+  add r1 4 r2
+  read 0 r2 r2
+.L537:
+  write -76 r14 r2
+  or r0 r1 r3
+  add r1 4 r1
+  read 0 r1 r1
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r1 r3 r1
+  bge r2 r1 .L542
+  add r2 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -76 r14 r2
+  read -72 r14 r1
+  read -80 r14 r4
+  bne r3 r0 .L541
+  add r4 4 r1
+  read 0 r1 r1
+  add r2 4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  load 160 r4
+  mults r3 r4 r3
+  add r1 r3 r5
+  write -68 r14 r5
+  add r5 108 r4
+  read 0 r2 r1
+  shiftr r1 30 r5
+  savpc r15
+  add r15 12 r15
+  jump clsmerge
+  or r0 r1 r3
+  read -76 r14 r2
+  read -72 r14 r1
+  read -68 r14 r5
+  read -80 r14 r4
+  beq r3 r0 .L541
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.257 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -76 r14 r2
+  read -72 r14 r1
+  read -80 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+.L541:
+  add r2 16 r2
+  jump .L537
+.L542:
+  read -72 r14 r1
+  read -80 r14 r4
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L531
+.L544:
+  read 0 r4 r1
+.L545:
+  write -64 r14 r1
+  beq r1 r0 .L642
+  add r14 -96 r4
+  savpc r15
+  add r15 12 r15
+  jump bszero
+  read -64 r14 r1
+  load 0 r2
+.L547:
+  write -60 r14 r2
+  add r1 80 r3
+  read 0 r3 r3
+  bge r2 r3 .L550
+  add r1 76 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r5
+  add r14 -96 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -60 r14 r2
+  read -64 r14 r1
+  add r2 1 r2
+  jump .L547
+.L550:
+  read 0 r1 r1
+.L551:
+  write -52 r14 r1
+  beq r1 r0 .L569
+  add r14 -88 r4
+  savpc r15
+  add r15 12 r15
+  jump bszero
+  read -52 r14 r1
+  read -80 r14 r4
+  add r4 4 r2
+  read 0 r2 r2
+  read 0 r1 r3
+  shiftr r3 3 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r2 r3 r5
+  write -48 r14 r5
+  load 0 r2
+  or r0 r2 r3
+  or r0 r5 r2
+.L554:
+  write -56 r14 r3
+  add r1 12 r5
+  read 0 r5 r5
+  bge r3 r5 .L566
+  add r2 108 r5
+  readh 0 r5 r5
+  write -44 r14 r5
+  add r1 8 r5
+  read 0 r5 r5
+  shiftl r3 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  add r5 48 r5
+  read 0 r5 r6
+  write -36 r14 r6
+  read -88 r14 r5
+  shiftl r5 5 r5
+  blt r6 r5 .L558
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -56 r14 r3
+  read -52 r14 r1
+  read -36 r14 r6
+  read -48 r14 r2
+  read -80 r14 r4
+.L558:
+  add r14 -88 r5
+  add r5 4 r5
+  read 0 r5 r5
+  shiftr r6 5 r7
+  shiftl r7 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  write -40 r14 r5
+  read -44 r14 r5
+  and r6 31 r7
+  load 1 r6
+  shiftl r6 r7 r7
+  read -40 r14 r6
+  and r6 r7 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+  beq r6 r0 .L561
+  add r1 8 r1
+  read 0 r1 r1
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  add r1 124 r5
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r2 r6
+  addr2reg .Lstring.258 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -56 r14 r3
+  read -52 r14 r1
+  read -44 r14 r5
+  read -80 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L561:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  or r0 r4 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump usecheck
+  or r0 r1 r5
+  read -56 r14 r4
+  read -52 r14 r1
+  read -48 r14 r2
+  or r0 r1 r3
+  read -80 r14 r1
+  beq r5 r0 .L563
+  or r0 r3 r1
+  or r0 r4 r3
+  jump .L564
+.L563:
+  add r1 4 r1
+  read 0 r1 r1
+  add r3 4 r3
+  read 0 r3 r3
+  shiftl r4 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  load 160 r4
+  mults r3 r4 r3
+  add r1 r3 r5
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r2 r6
+  addr2reg .Lstring.259 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -56 r14 r3
+  read -52 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L564:
+  add r1 8 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r5
+  add r14 -88 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -56 r14 r3
+  read -52 r14 r1
+  read -48 r14 r2
+  read -80 r14 r4
+  add r3 1 r3
+  jump .L554
+.L566:
+  add r14 -88 r5
+  add r14 -96 r4
+  savpc r15
+  add r15 12 r15
+  jump bsequal
+  or r0 r1 r2
+  read -52 r14 r1
+  read -48 r14 r5
+  read -80 r14 r4
+  bne r2 r0 .L568
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.260 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -52 r14 r1
+  read -80 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L568:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L551
+.L569:
+  read -64 r14 r1
+  read -80 r14 r4
+  add r1 4 r2
+  read 0 r2 r2
+.L571:
+  write -28 r14 r2
+  or r0 r1 r3
+  add r1 4 r1
+  read 0 r1 r1
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r1 r3 r1
+  bge r2 r1 .L607
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L574:
+  write -32 r14 r2
+  or r0 r4 r3
+  load 2 r4
+  bge r2 r4 .L605
+  or r0 r1 r4
+  read 0 r1 r1
+  shiftl r1 2 r5
+  shiftr r5 2 r5
+  load 24 r6
+  mults r5 r6 r6
+  addr2reg optab r5
+  add r5 r6 r5
+  add r5 4 r5
+  shiftl r2 3 r6
+  add r5 r6 r5
+  shiftr r1 30 r6
+  shiftl r6 1 r6
+  add r5 r6 r5
+  readh 0 r5 r5
+  add r4 8 r4
+  shiftl r2 2 r6
+  add r4 r6 r4
+  read 0 r4 r4
+  write -100 r14 r4
+  add r3 4 r3
+  read 0 r3 r3
+  shiftr r4 3 r4
+  load 160 r6
+  mults r4 r6 r4
+  add r3 r4 r6
+  write -24 r14 r6
+  load 0 r3
+  load32 -2 r4
+  beq r5 r4 .L577
+  or r0 r3 r4
+  jump .L578
+.L577:
+  addr2reg T+36 r12
+  read 0 r12 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L578:
+  load 0 r3
+  beq r4 r0 .L580
+  shiftr r1 30 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L580:
+  beq r3 r0 .L582
+  shiftl r1 2 r3
+  shiftr r3 2 r3
+  load 24 r4
+  mults r3 r4 r4
+  or r0 r2 r3
+  addr2reg optab r2
+  add r2 r4 r2
+  add r2 4 r2
+  shiftl r3 3 r3
+  add r2 r3 r2
+  add r2 2 r2
+  readh 0 r2 r5
+.L582:
+  write -20 r14 r5
+  load32 -2 r2
+  bne r5 r2 .L584
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 24 r2
+  mults r1 r2 r2
+  addr2reg optab r1
+  add r1 r2 r1
+  read 0 r1 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.261 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L584:
+  read -100 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -32 r14 r2
+  read -28 r14 r1
+  read -80 r14 r4
+  load 3 r5
+  beq r3 r5 .L604
+  read -100 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r4
+  read -20 r14 r5
+  read -32 r14 r2
+  read -28 r14 r1
+  load 0 r3
+  load32 -1 r6
+  beq r4 r6 .L587
+  xor r5 -1 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L587:
+  beq r3 r0 .L592
+  load 1 r3
+  beq r2 r3 .L590
+  addr2reg .Lstring.263 r2
+  jump .L591
+.L590:
+  addr2reg .Lstring.262 r2
+.L591:
+  or r0 r2 r5
+  read 0 r1 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 24 r2
+  mults r1 r2 r2
+  addr2reg optab r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.264 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L592:
+  read -100 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r6
+  read -20 r14 r5
+  read -32 r14 r2
+  read -28 r14 r1
+  read -80 r14 r4
+  load 0 r3
+  load32 -1 r7
+  bne r6 r7 .L594
+  xor r5 -1 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L594:
+  beq r3 r0 .L599
+  load 1 r3
+  beq r2 r3 .L597
+  addr2reg .Lstring.263 r2
+  jump .L598
+.L597:
+  addr2reg .Lstring.262 r2
+.L598:
+  or r0 r2 r5
+  read 0 r1 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 24 r2
+  mults r1 r2 r2
+  addr2reg optab r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.265 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -20 r14 r5
+  read -80 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L599:
+  or r0 r4 r6
+  read -100 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump usecheck
+  or r0 r1 r3
+  read -32 r14 r2
+  read -28 r14 r1
+  read -24 r14 r6
+  read -80 r14 r4
+  bne r3 r0 .L604
+  load 1 r3
+  beq r2 r3 .L602
+  addr2reg .Lstring.263 r2
+  jump .L603
+.L602:
+  addr2reg .Lstring.262 r2
+.L603:
+  or r0 r2 r5
+  read 0 r1 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 24 r2
+  mults r1 r2 r2
+  addr2reg optab r1
+  add r1 r2 r1
+  read 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.266 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -32 r14 r2
+  read -28 r14 r1
+  read -80 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+.L604:
+  add r2 1 r2
+  jump .L574
+.L605:
+  or r0 r1 r2
+  read -64 r14 r1
+  or r0 r3 r4
+  add r2 16 r2
+  jump .L571
+.L607:
+  read -64 r14 r1
+  add r1 12 r2
+  add r2 4 r2
+  read 0 r2 r3
+  write -12 r14 r3
+  write -100 r14 r3
+  add r1 12 r2
+  readh 0 r2 r2
+  load 1 r5
+  sub r2 r5 r5
+  load 9 r6
+  bgt r5 r6 .L618
+  load 9 r3
+  beq r2 r3 .L615
+  load 5 r3
+  bges r2 r3 .L613
+  or r0 r2 r1
+  load 1 r2
+  sub r1 r2 r5
+  jump .L617
+.L613:
+  load 0 r1
+  or r0 r1 r5
+  jump .L617
+.L615:
+  load 1 r1
+  or r0 r1 r5
+.L617:
+  or r0 r4 r6
+  read -100 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump usecheck
+  or r0 r1 r2
+  read -64 r14 r1
+  read -12 r14 r3
+  read -80 r14 r4
+  beq r2 r0 .L623
+.L618:
+  add r1 12 r2
+  readh 0 r2 r2
+  load 1 r5
+  load 12 r6
+  beq r2 r6 .L620
+  xor r2 32 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r5
+.L620:
+  load 0 r2
+  beq r5 r0 .L622
+  or r0 r4 r6
+  load 0 r5
+  read -100 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump usecheck
+  or r0 r1 r2
+  read -64 r14 r1
+  read -12 r14 r3
+  read -80 r14 r4
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L622:
+  beq r2 r0 .L624
+.L623:
+  add r4 4 r2
+  read 0 r2 r2
+  shiftr r3 3 r3
+  load 160 r4
+  mults r3 r4 r3
+  add r2 r3 r5
+  add r1 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.267 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -64 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L624:
+  add r1 20 r2
+  read 0 r2 r2
+  load 0 r3
+  beq r2 r0 .L626
+  add r2 12 r3
+  readh 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L626:
+  beq r3 r0 .L629
+  or r0 r2 r1
+  add r1 124 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.268 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -64 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L629:
+  add r1 24 r2
+  read 0 r2 r2
+  load 0 r3
+  beq r2 r0 .L631
+  add r2 12 r3
+  readh 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L631:
+  beq r3 r0 .L634
+  or r0 r2 r1
+  add r1 124 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.268 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -64 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L634:
+  load 0 r2
+.L635:
+  write -16 r14 r2
+  add r1 32 r3
+  read 0 r3 r3
+  bge r2 r3 .L640
+  add r1 28 r3
+  read 0 r3 r3
+  shiftl r2 2 r4
+  add r3 r4 r4
+  read 0 r4 r4
+  add r4 12 r4
+  readh 0 r4 r4
+  bne r4 r0 .L639
+  or r0 r3 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 124 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.268 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -16 r14 r2
+  read -64 r14 r1
+  load32 -24 r3
+  sub r13 r3 r13
+.L639:
+  add r2 1 r2
+  jump .L635
+.L640:
+  read -80 r14 r4
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L545
+.L642:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function typecheck */
+
+.data
+.balign 1
+.Lstring.270:
+	.ascii "function name expected\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.271:
+	.ascii "function body must start with {\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.272:
+	.ascii "empty function\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.273:
+	.ascii "last block misses jump\000"
+/* end data */
+
+
+.text
+; function parsefn
+parsefn:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  write -16 r14 r4
+  load 0 r1
+  addr2reg curb r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg nblk r12
+  write 0 r12 r1
+  addr2reg insb r12
+  read 0 r12 r1
+  addr2reg curi r12
+  write 0 r12 r1
+  load 148 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  addr2reg curf r12
+  write 0 r12 r1
+  add r1 16 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 20 r2
+  load 2 r1
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 16 r1
+  read 0 r1 r4
+  load 1 r6
+  load 160 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  addr2reg curf r12
+  read 0 r12 r2
+  add r2 4 r2
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 20 r1
+  read 0 r1 r4
+  load 1 r6
+  load 32 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  addr2reg curf r12
+  read 0 r12 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 0 r1
+.L646:
+  write -12 r14 r1
+  load 32 r2
+  bges r1 r2 .L654
+  addr2reg T+28 r12
+  read 0 r12 r2
+  load 0 r3
+  bles r2 r1 .L649
+  or r0 r3 r1
+  jump .L650
+.L649:
+  addr2reg T+32 r12
+  read 0 r12 r3
+  add r2 r3 r2
+  slt r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L650:
+  bne r1 r0 .L652
+  addr2reg curf r12
+  read 0 r12 r6
+  load 1 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  or r0 r1 r2
+  read -12 r14 r1
+  write -20 r14 r2
+  jump .L653
+.L652:
+  addr2reg curf r12
+  read 0 r12 r6
+  load 3 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  or r0 r1 r2
+  read -12 r14 r1
+  write -24 r14 r2
+.L653:
+  add r1 1 r1
+  jump .L646
+.L654:
+  read -16 r14 r4
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 0 r2
+  load 1 r1
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 0 r1
+  add r1 16 r2
+  load32 -559030611 r1
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 32 r2
+  load 1 r1
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 136 r2
+  read 0 r4 r1
+  write 0 r2 r1
+  add r4 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r1
+  addr2reg blink r12
+  write 0 r12 r1
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 32 r2
+  load32 -1 r1
+  write 0 r2 r1
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L658
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L658:
+  load 132 r2
+  bne r1 r2 .L660
+  load 9 r1
+  addr2reg rcls r12
+  write 0 r12 r1
+  jump .L661
+.L660:
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 32 r4
+  savpc r15
+  add r15 12 r15
+  jump parsecls
+  addr2reg rcls r12
+  write 0 r12 r1
+.L661:
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L663
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L663:
+  load 0 r2
+  addr2reg thead r12
+  write 0 r12 r2
+  load 132 r2
+  beq r1 r2 .L666
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.270 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L666:
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 54 r4
+  addr2reg tokval+24 r12
+  read 0 r12 r5
+  load 79 r6
+  savpc r15
+  add r15 12 r15
+  jump strncpy
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump parserefl
+  addr2reg curf r12
+  read 0 r12 r2
+  add r2 52 r2
+  writeb 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  load 140 r2
+  beq r1 r2 .L668
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.271 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L668:
+  load 1 r1
+.L669:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parseline
+  load 4 r2
+  bne r1 r2 .L669
+  addr2reg curb r12
+  read 0 r12 r1
+  bne r1 r0 .L673
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.272 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L673:
+  addr2reg curb r12
+  read 0 r12 r1
+  add r1 12 r1
+  readh 0 r1 r1
+  bne r1 r0 .L675
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.273 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L675:
+  load 1 r6
+  load 48 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  addr2reg curf r12
+  read 0 r12 r2
+  add r2 12 r2
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 24 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg nblk r12
+  read 0 r12 r1
+  addr2reg curf r12
+  read 0 r12 r2
+  add r2 28 r2
+  write 0 r2 r1
+  addr2reg curf r12
+  read 0 r12 r1
+  add r1 40 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r1
+.L677:
+  load 8192 r2
+  bges r1 r2 .L680
+  addr2reg blkh r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L677
+.L680:
+  addr2reg tmph r12
+  read 0 r12 r4
+  load32 65536 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  addr2reg curf r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump typecheck
+  addr2reg curf r12
+  read 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parsefn */
+
+.data
+.balign 1
+.Lstring.275:
+	.ascii "invalid type member specifier\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.276:
+	.ascii ", or } expected\000"
+/* end data */
+
+
+.text
+; function parsefields
+parsefields:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 136 r13
+  write -116 r14 r5
+  write -112 r14 r4
+  add r5 84 r1
+  read 0 r1 r1
+  load 0 r3
+  load 0 r2
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+.L686:
+  write -36 r14 r2
+  write -32 r14 r1
+  write -68 r14 r3
+  load 141 r5
+  beq r6 r5 .L730
+  load 116 r5
+  sub r6 r5 r5
+  load 18 r6
+  bge r5 r6 .L693
+  shiftl r5 2 r6
+  addr2reg .Ljt688 r5
+  add r5 r6 r5
+  read 0 r5 r5
+  jumpr 0 r5
+.L689:
+  load 0 r5
+  write -4 r14 r5
+  load 3 r7
+  load 4 r6
+  load 8 r5
+  read -4 r14 r12
+  write -72 r14 r12
+  write -80 r14 r6
+  write -76 r14 r5
+  or r0 r1 r5
+  or r0 r7 r1
+  jump .L704
+.L691:
+  load 0 r5
+  write -8 r14 r5
+  load 2 r7
+  load 3 r6
+  load 4 r5
+  read -8 r14 r12
+  write -72 r14 r12
+  write -80 r14 r6
+  write -76 r14 r5
+  or r0 r1 r5
+  or r0 r7 r1
+  jump .L704
+.L693:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.275 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -36 r14 r2
+  read -32 r14 r1
+  read -68 r14 r3
+  read -112 r14 r4
+  load32 -24 r5
+  sub r13 r5 r13
+  jump .L698
+.L694:
+  load 0 r5
+  write -12 r14 r5
+  load 1 r7
+  load 2 r6
+  load 2 r5
+  read -12 r14 r12
+  write -72 r14 r12
+  write -80 r14 r6
+  write -76 r14 r5
+  or r0 r1 r5
+  or r0 r7 r1
+  jump .L704
+.L696:
+  load 0 r5
+  write -16 r14 r5
+  load 0 r7
+  load 1 r6
+  load 1 r5
+  read -16 r14 r12
+  write -72 r14 r12
+  write -80 r14 r6
+  write -76 r14 r5
+  or r0 r1 r5
+  or r0 r7 r1
+  jump .L704
+.L698:
+  load 0 r5
+  write -20 r14 r5
+  load 3 r7
+  load 6 r6
+  load 8 r5
+  read -20 r14 r12
+  write -72 r14 r12
+  write -80 r14 r6
+  write -76 r14 r5
+  or r0 r1 r5
+  or r0 r7 r1
+  jump .L704
+.L700:
+  load 0 r5
+  write -24 r14 r5
+  load 2 r7
+  load 5 r6
+  load 4 r5
+  read -24 r14 r12
+  write -72 r14 r12
+  write -80 r14 r6
+  write -76 r14 r5
+  or r0 r1 r5
+  or r0 r7 r1
+  jump .L704
+.L702:
+  addr2reg typ r12
+  read 0 r12 r5
+  write -28 r14 r5
+  addr2reg ntyp r12
+  read 0 r12 r1
+  load 1 r2
+  sub r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump findtyp
+  or r0 r1 r6
+  read -36 r14 r2
+  read -32 r14 r1
+  read -68 r14 r3
+  read -28 r14 r5
+  read -112 r14 r4
+  load 100 r7
+  mults r6 r7 r6
+  add r5 r6 r6
+  add r6 88 r5
+  read 0 r5 r5
+  write -40 r14 r5
+  add r6 84 r5
+  read 0 r5 r5
+  write -44 r14 r5
+  read -40 r14 r5
+  or r0 r5 r7
+  load 8 r5
+  write -48 r14 r5
+  or r0 r1 r5
+  read -44 r14 r1
+  write -72 r14 r6
+  read -48 r14 r12
+  write -80 r14 r12
+  write -76 r14 r7
+.L704:
+  bgts r1 r5 .L706
+  write -128 r14 r5
+  jump .L707
+.L706:
+  write -128 r14 r1
+.L707:
+  load 1 r5
+  shiftl r5 r1 r1
+  load 1 r5
+  sub r1 r5 r5
+  or r0 r3 r1
+  add r3 r5 r3
+  xor r5 -1 r5
+  and r3 r5 r3
+  sub r3 r1 r1
+  write -64 r14 r1
+  bne r1 r0 .L709
+  write -88 r14 r2
+  jump .L712
+.L709:
+  load 32 r3
+  bges r2 r3 .L711
+  shiftl r2 3 r3
+  add r4 r3 r5
+  load 7 r3
+  write 0 r5 r3
+  shiftl r2 3 r3
+  add r4 r3 r3
+  add r3 4 r3
+  write 0 r3 r1
+  add r2 1 r2
+.L711:
+  write -88 r14 r2
+.L712:
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  or r0 r1 r6
+  read -72 r14 r5
+  read -80 r14 r3
+  or r0 r6 r7
+  read -76 r14 r6
+  read -68 r14 r1
+  read -112 r14 r4
+  write -52 r14 r7
+  load 127 r2
+  xor r7 r2 r7
+  sltu r7 1 r7
+  read -64 r14 r2
+  bne r7 r0 .L715
+  load 1 r7
+  write -56 r14 r7
+  read -52 r14 r7
+  write -124 r14 r7
+  read -56 r14 r7
+  jump .L717
+.L715:
+  addr2reg tokval+20 r12
+  read 0 r12 r7
+  write -60 r14 r7
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  write -84 r14 r1
+  read -72 r14 r5
+  read -80 r14 r3
+  read -76 r14 r6
+  read -68 r14 r1
+  read -60 r14 r7
+  read -64 r14 r2
+  read -112 r14 r4
+  read -84 r14 r12
+  write -124 r14 r12
+.L717:
+  write -92 r14 r7
+  mults r7 r6 r7
+  add r2 r7 r2
+  add r1 r2 r1
+  write -120 r14 r1
+  read -92 r14 r1
+  read -88 r14 r2
+  load 8 r7
+  beq r3 r7 .L719
+  or r0 r6 r5
+  jump .L720
+.L719:
+  addr2reg typ r12
+  read 0 r12 r6
+  sub r5 r6 r6
+  load32 1374389535 r5
+  mulshi r6 r5 r5
+  shiftrs r5 5 r5
+  shiftr r6 31 r6
+  add r5 r6 r5
+.L720:
+  write -96 r14 r2
+  load 0 r6
+  bles r1 r0 .L722
+  slt r2 32 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L722:
+  beq r6 r0 .L725
+  shiftl r2 3 r6
+  add r4 r6 r6
+  write 0 r6 r3
+  shiftl r2 3 r6
+  add r4 r6 r6
+  add r6 4 r6
+  write 0 r6 r5
+  load 1 r6
+  sub r1 r6 r1
+  add r2 1 r2
+  jump .L720
+.L725:
+  read -124 r14 r6
+  load 137 r1
+  bne r6 r1 .L728
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  or r0 r1 r6
+  read -96 r14 r2
+  read -128 r14 r1
+  read -120 r14 r3
+  read -112 r14 r4
+  jump .L686
+.L728:
+  read -96 r14 r2
+  read -124 r14 r6
+  read -128 r14 r1
+  read -120 r14 r3
+  read -116 r14 r5
+  read -112 r14 r4
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  jump .L731
+.L730:
+  read -116 r14 r5
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+.L731:
+  write -100 r14 r3
+  write -104 r14 r1
+  write -108 r14 r2
+  load 141 r7
+  beq r6 r7 .L733
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.276 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -100 r14 r3
+  read -104 r14 r1
+  read -108 r14 r2
+  read -116 r14 r5
+  read -112 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+.L733:
+  shiftl r3 3 r3
+  add r4 r3 r4
+  load 0 r3
+  write 0 r4 r3
+  load 1 r3
+  shiftl r3 r1 r3
+  or r0 r2 r4
+  add r5 88 r2
+  read 0 r2 r2
+  blt r4 r2 .L735
+  or r0 r4 r2
+.L735:
+  add r2 r3 r2
+  load 1 r4
+  sub r2 r4 r2
+  sub r0 r3 r3
+  and r2 r3 r2
+  add r5 88 r3
+  write 0 r3 r2
+  add r5 84 r2
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt688:
+  .int .L689
+  .int .L691
+  .int .L693
+  .int .L693
+  .int .L694
+  .int .L693
+  .int .L693
+  .int .L696
+  .int .L698
+  .int .L700
+  .int .L693
+  .int .L693
+  .int .L693
+  .int .L693
+  .int .L693
+  .int .L693
+  .int .L693
+  .int .L702
+
+/* end function parsefields */
+
+.data
+.balign 1
+.Lstring.278:
+	.ascii "type name and then = expected\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.279:
+	.ascii "alignment expected\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.280:
+	.ascii "type body must start with {\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.281:
+	.ascii "dark types need alignment\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.282:
+	.ascii "} expected\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.283:
+	.ascii "invalid union member\000"
+/* end data */
+
+
+.text
+; function parsetyp
+parsetyp:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  addr2reg ntyp r12
+  read 0 r12 r1
+  add r1 1 r5
+  addr2reg typ r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  addr2reg typ r12
+  read 0 r12 r1
+  addr2reg ntyp r12
+  read 0 r12 r2
+  add r2 1 r3
+  addr2reg ntyp r12
+  write 0 r12 r3
+  load 100 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  write -32 r14 r1
+  add r1 80 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r1 81 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r1 84 r3
+  load32 -1 r2
+  write 0 r3 r2
+  add r1 88 r2
+  load 0 r1
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  or r0 r1 r3
+  read -32 r14 r1
+  load 1 r2
+  load 133 r4
+  bne r3 r4 .L741
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  or r0 r1 r2
+  read -32 r14 r1
+  xor r2 136 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L741:
+  beq r2 r0 .L743
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.278 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -32 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L743:
+  addr2reg tokval+24 r12
+  read 0 r12 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  load 114 r2
+  bne r1 r2 .L750
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  or r0 r1 r2
+  read -32 r14 r1
+  load 127 r3
+  beq r2 r3 .L746
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.279 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -32 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L746:
+  load 0 r2
+.L747:
+  addr2reg tokval+20 r12
+  read 0 r12 r3
+  shiftr r3 31 r4
+  add r3 r4 r3
+  shiftrs r3 1 r3
+  addr2reg tokval+20 r12
+  write 0 r12 r3
+  beq r3 r0 .L749
+  add r2 1 r2
+  jump .L747
+.L749:
+  add r1 84 r1
+  write 0 r1 r2
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+.L750:
+  load 140 r2
+  beq r1 r2 .L752
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.280 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L752:
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  or r0 r1 r2
+  read -32 r14 r1
+  write -16 r14 r2
+  load 127 r3
+  beq r2 r3 .L762
+  load 0 r6
+  load 264 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r3
+  read -16 r14 r2
+  read -32 r14 r1
+  add r1 96 r4
+  write 0 r4 r3
+  load 140 r4
+  beq r2 r4 .L755
+  add r3 0 r4
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump parsefields
+  read -32 r14 r1
+  load 1 r2
+  jump .L761
+.L755:
+  add r1 81 r4
+  load 1 r3
+  writeb 0 r4 r3
+  load 0 r3
+.L756:
+  write -20 r14 r3
+  load 140 r4
+  beq r2 r4 .L758
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.283 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -20 r14 r3
+  read -32 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L758:
+  add r1 96 r4
+  add r3 1 r5
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -20 r14 r3
+  read -32 r14 r1
+  add r1 96 r1
+  read 0 r1 r1
+  add r3 1 r2
+  write -28 r14 r2
+  load 264 r2
+  mults r3 r2 r2
+  add r1 r2 r4
+  write -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  or r0 r1 r6
+  read -24 r14 r4
+  read -32 r14 r1
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump parsefields
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  or r0 r1 r2
+  read -28 r14 r3
+  read -32 r14 r1
+  load 141 r4
+  bne r2 r4 .L756
+  or r0 r3 r2
+.L761:
+  or r0 r2 r3
+  add r1 92 r1
+  write 0 r1 r3
+  jump .L766
+.L762:
+  add r1 80 r3
+  load 1 r2
+  writeb 0 r3 r2
+  addr2reg tokval+20 r12
+  read 0 r12 r2
+  add r1 88 r3
+  write 0 r3 r2
+  add r1 84 r1
+  read 0 r1 r1
+  load32 -1 r2
+  bne r1 r2 .L764
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.281 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L764:
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  load 141 r2
+  beq r1 r2 .L766
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.282 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L766:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parsetyp */
+
+.data
+.balign 1
+.Lstring.285:
+	.ascii "invalid token after offset in ref\000"
+/* end data */
+
+
+.text
+; function parsedatref
+parsedatref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r4 24 r2
+  load 1 r1
+  writeb 0 r2 r1
+  addr2reg tokval+24 r12
+  read 0 r12 r1
+  add r4 16 r2
+  write 0 r2 r1
+  add r4 16 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L772
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L772:
+  load 135 r2
+  bne r1 r2 .L781
+  bne r1 r0 .L775
+  savpc r15
+  add r15 12 r15
+  jump lex
+  addr2reg thead r12
+  write 0 r12 r1
+.L775:
+  load 0 r1
+  addr2reg thead r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump lex
+  read -16 r14 r4
+  addr2reg thead r12
+  write 0 r12 r1
+  load 0 r2
+  addr2reg thead r12
+  write 0 r12 r2
+  load 127 r2
+  beq r1 r2 .L780
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.285 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L780:
+  addr2reg tokval+20 r12
+  read 0 r12 r1
+  add r4 16 r2
+  add r2 4 r2
+  write 0 r2 r1
+.L781:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parsedatref */
+
+.data
+.balign 1
+.Lstring.288:
+	.ascii "data name, then = expected\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.289:
+	.ascii "expected data contents in { .. }\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.290:
+	.ascii "invalid size specifier %c in data\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.291:
+	.ascii "float data not supported on 32-bit target\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.292:
+	.ascii "constant literal expected\000"
+/* end data */
+
+
+.text
+; function parsedat
+parsedat:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 136 r13
+  write -4 r14 r5
+  write -16 r14 r4
+  load 0 r1
+  writeb -128 r14 r1
+  add r14 -128 r1
+  add r1 1 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 2 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 3 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 4 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 5 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 6 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 7 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 8 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 9 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 10 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 11 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 12 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 13 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 14 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 15 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 16 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 17 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 18 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 19 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 20 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 21 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 22 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 23 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 24 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 25 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 26 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 27 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 28 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 29 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 30 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 31 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 32 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 33 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 34 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 35 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 36 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 37 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 38 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 39 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 40 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 41 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 42 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 43 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 44 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 45 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 46 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 47 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 48 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 49 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 50 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 51 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 52 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 53 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 54 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 55 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 56 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 57 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 58 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 59 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 60 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 61 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 62 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 63 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 64 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 65 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 66 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 67 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 68 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 69 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 70 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 71 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 72 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 73 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 74 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 75 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 76 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 77 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 78 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -128 r1
+  add r1 79 r2
+  load 0 r1
+  writeb 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  or r0 r1 r2
+  load 1 r1
+  load 132 r3
+  bne r2 r3 .L786
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  xor r1 136 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L786:
+  beq r1 r0 .L788
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.288 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L788:
+  addr2reg tokval+24 r12
+  read 0 r12 r5
+  load 79 r6
+  add r14 -128 r4
+  savpc r15
+  add r15 12 r15
+  jump strncpy
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  read -4 r14 r5
+  or r0 r1 r2
+  read -16 r14 r1
+  add r5 3 r4
+  load 8 r3
+  writeb 0 r4 r3
+  load 114 r3
+  beq r2 r3 .L790
+  write -8 r14 r2
+  jump .L794
+.L790:
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  read -4 r14 r5
+  load 127 r2
+  beq r1 r2 .L792
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.279 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -4 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L792:
+  addr2reg tokval+20 r12
+  read 0 r12 r1
+  add r5 3 r2
+  writeb 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  read -4 r14 r5
+  or r0 r1 r2
+  read -16 r14 r1
+  write -8 r14 r2
+.L794:
+  load 0 r2
+  write -48 r14 r2
+  add r14 -48 r2
+  add r2 4 r3
+  add r14 -128 r2
+  write 0 r3 r2
+  add r14 -48 r2
+  add r2 8 r2
+  write 0 r2 r5
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -8 r14 r1
+  load 140 r2
+  beq r1 r2 .L796
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.289 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L796:
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  load 141 r2
+  beq r1 r2 .L840
+  load 141 r2
+  bge r1 r2 .L839
+  load 116 r2
+  sub r1 r2 r1
+  load 11 r2
+  bge r1 r2 .L839
+  shiftl r1 2 r2
+  addr2reg .Ljt800 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L801:
+  load 5 r1
+  write -48 r14 r1
+  jump .L808
+.L802:
+  load 4 r1
+  write -48 r14 r1
+  jump .L808
+.L803:
+  load 3 r1
+  write -48 r14 r1
+  jump .L808
+.L804:
+  load 2 r1
+  write -48 r14 r1
+  jump .L808
+.L805:
+  load 5 r1
+  write -48 r14 r1
+  jump .L808
+.L806:
+  load 4 r1
+  write -48 r14 r1
+  jump .L808
+.L807:
+  load 6 r1
+  write -48 r14 r1
+.L808:
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  write -12 r14 r1
+.L810:
+  add r14 -48 r1
+  add r1 25 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -48 r1
+  add r1 24 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -48 r1
+  add r1 16 r4
+  load 8 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  read -12 r14 r1
+  read -16 r14 r4
+  load 128 r2
+  beq r1 r2 .L820
+  load 129 r2
+  beq r1 r2 .L819
+  load 127 r2
+  beq r1 r2 .L818
+  load 132 r2
+  beq r1 r2 .L817
+  load 134 r2
+  beq r1 r2 .L816
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.292 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L821
+.L816:
+  add r14 -48 r1
+  add r1 25 r2
+  load 1 r1
+  writeb 0 r2 r1
+  addr2reg tokval+24 r12
+  read 0 r12 r1
+  add r14 -48 r2
+  add r2 16 r2
+  write 0 r2 r1
+  jump .L821
+.L817:
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump parsedatref
+  read -16 r14 r4
+  jump .L821
+.L818:
+  addr2reg tokval+20 r12
+  read 0 r12 r1
+  add r14 -48 r2
+  add r2 16 r2
+  write 0 r2 r1
+  jump .L821
+.L819:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.291 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L821
+.L820:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.291 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L821:
+  or r0 r4 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  read -16 r14 r4
+  load 1 r2
+  load 127 r3
+  beq r1 r3 .L824
+  xor r1 128 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L825
+.L824:
+  or r0 r2 r3
+.L825:
+  load 1 r2
+  bne r3 r0 .L827
+  xor r1 129 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L828
+.L827:
+  or r0 r2 r3
+.L828:
+  load 1 r2
+  bne r3 r0 .L830
+  xor r1 134 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L831
+.L830:
+  or r0 r2 r3
+.L831:
+  load 1 r2
+  bne r3 r0 .L833
+  xor r1 132 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L833:
+  beq r2 r0 .L835
+  write -12 r14 r1
+  jump .L810
+.L835:
+  load 141 r2
+  beq r1 r2 .L838
+  load 137 r2
+  beq r1 r2 .L796
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.276 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L796
+.L838:
+  or r0 r4 r1
+  jump .L841
+.L839:
+  addr2reg tokval r12
+  readb 0 r12 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.290 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  jump .L841
+.L840:
+  read -16 r14 r1
+.L841:
+  load 1 r2
+  write -48 r14 r2
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt800:
+  .int .L801
+  .int .L802
+  .int .L839
+  .int .L839
+  .int .L803
+  .int .L839
+  .int .L839
+  .int .L804
+  .int .L805
+  .int .L806
+  .int .L807
+
+/* end function parsedat */
+
+.data
+.balign 1
+.Lstring.294:
+	.ascii "only one section allowed\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.295:
+	.ascii "section \042name\042 expected\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.296:
+	.ascii "only data may have thread linkage\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.297:
+	.ascii "only functions can be inlined\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.298:
+	.ascii "only data and function have linkage\000"
+/* end data */
+
+
+.text
+; function parselnk
+parselnk:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  load 0 r1
+  write -8 r14 r1
+.L847:
+  savpc r15
+  add r15 12 r15
+  jump nextnl
+  read -16 r14 r4
+  write -12 r14 r1
+  load 105 r2
+  sub r1 r2 r1
+  load 9 r2
+  bge r1 r2 .L873
+  shiftl r1 2 r2
+  addr2reg .Ljt849 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L850:
+  load 1 r1
+  writeb 0 r4 r1
+  jump .L871
+.L851:
+  add r4 1 r2
+  load 1 r1
+  writeb 0 r2 r1
+  jump .L871
+.L852:
+  add r4 2 r2
+  load 1 r1
+  writeb 0 r2 r1
+  jump .L871
+.L853:
+  add r4 2 r2
+  load32 -1 r1
+  writeb 0 r2 r1
+  jump .L871
+.L854:
+  add r4 2 r2
+  load 2 r1
+  writeb 0 r2 r1
+  jump .L871
+.L855:
+  read -12 r14 r1
+  read -8 r14 r3
+  jump .L874
+.L856:
+  add r4 4 r1
+  read 0 r1 r1
+  beq r1 r0 .L858
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.294 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L858:
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L860
+  savpc r15
+  add r15 12 r15
+  jump lex
+  read -16 r14 r4
+  addr2reg thead r12
+  write 0 r12 r1
+.L860:
+  load 0 r2
+  addr2reg thead r12
+  write 0 r12 r2
+  load 134 r2
+  beq r1 r2 .L863
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.295 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L863:
+  addr2reg tokval+24 r12
+  read 0 r12 r1
+  add r4 4 r2
+  write 0 r2 r1
+  addr2reg thead r12
+  read 0 r12 r1
+  bne r1 r0 .L866
+  savpc r15
+  add r15 12 r15
+  jump lex
+  read -16 r14 r4
+  addr2reg thead r12
+  write 0 r12 r1
+.L866:
+  load 134 r2
+  bne r1 r2 .L871
+  bne r1 r0 .L869
+  savpc r15
+  add r15 12 r15
+  jump lex
+  read -16 r14 r4
+  addr2reg thead r12
+  write 0 r12 r1
+.L869:
+  load 0 r1
+  addr2reg thead r12
+  write 0 r12 r1
+  addr2reg tokval+24 r12
+  read 0 r12 r1
+  add r4 8 r2
+  write 0 r2 r1
+.L871:
+  load 1 r1
+  write -8 r14 r1
+  jump .L847
+.L873:
+  read -12 r14 r1
+  read -8 r14 r3
+.L874:
+  load 0 r2
+  load 110 r5
+  bne r1 r5 .L876
+  add r4 1 r2
+  readb 0 r2 r2
+  and r2 0xFF r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L876:
+  beq r2 r0 .L878
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.296 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -12 r14 r1
+  read -8 r14 r3
+  read -16 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L878:
+  load 0 r2
+  load 110 r5
+  beq r1 r5 .L880
+  add r4 2 r2
+  readb 0 r2 r2
+  and r2 0xFF r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L880:
+  beq r2 r0 .L882
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.297 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -12 r14 r1
+  read -8 r14 r3
+  load32 -24 r2
+  sub r13 r2 r13
+.L882:
+  load 0 r2
+  bne r3 r0 .L884
+  or r0 r2 r3
+  jump .L885
+.L884:
+  xor r1 112 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L885:
+  load 0 r2
+  beq r3 r0 .L887
+  xor r1 110 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L887:
+  beq r2 r0 .L889
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.298 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -12 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L889:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt849:
+  .int .L850
+  .int .L851
+  .int .L852
+  .int .L853
+  .int .L854
+  .int .L855
+  .int .L855
+  .int .L855
+  .int .L856
+
+/* end function parselnk */
+
+.data
+.balign 1
+.Lstring.300:
+	.ascii "top-level definition expected\000"
+/* end data */
+
+
+.text
+; function parse
+.global parse
+parse:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 52 r13
+  read 8 r14 r3
+  write -20 r14 r3
+  write -24 r14 r7
+  write -28 r14 r6
+  write -12 r14 r5
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump lexinit
+  read -12 r14 r1
+  read -16 r14 r2
+  addr2reg inf r12
+  write 0 r12 r2
+  addr2reg inpath r12
+  write 0 r12 r1
+  load 1 r1
+  addr2reg lnum r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg thead r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg ntyp r12
+  write 0 r12 r1
+  load 0 r6
+  load 100 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  addr2reg typ r12
+  write 0 r12 r1
+.L893:
+  load 0 r1
+  write -44 r14 r1
+  add r14 -44 r1
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -44 r4
+  savpc r15
+  add r15 12 r15
+  jump parselnk
+  read -24 r14 r2
+  load 144 r3
+  beq r1 r3 .L903
+  load 144 r3
+  bge r1 r3 .L901
+  load 110 r3
+  sub r1 r3 r1
+  load 6 r3
+  bge r1 r3 .L901
+  shiftl r1 2 r3
+  addr2reg .Ljt897 r1
+  add r1 r3 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L898:
+  add r14 -44 r4
+  savpc r15
+  add r15 12 r15
+  jump parsefn
+  or r0 r1 r4
+  read -20 r14 r3
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r3
+  read -20 r14 r3
+  read -24 r14 r2
+  read -28 r14 r1
+  jump .L893
+.L899:
+  savpc r15
+  add r15 12 r15
+  jump parsetyp
+  read -20 r14 r3
+  read -24 r14 r2
+  read -28 r14 r1
+  jump .L893
+.L900:
+  add r14 -44 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump parsedat
+  read -20 r14 r3
+  read -24 r14 r2
+  read -28 r14 r1
+  jump .L893
+.L901:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.300 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+.L902:
+  load 134 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -28 r14 r1
+  addr2reg tokval+24 r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -20 r14 r3
+  read -24 r14 r2
+  read -28 r14 r1
+  jump .L893
+.L903:
+  load 0 r1
+.L904:
+  write -32 r14 r1
+  addr2reg ntyp r12
+  read 0 r12 r2
+  bge r1 r2 .L909
+  or r0 r1 r2
+  addr2reg typ r12
+  read 0 r12 r1
+  load 100 r3
+  mults r2 r3 r3
+  add r1 r3 r3
+  add r3 92 r3
+  read 0 r3 r3
+  bne r3 r0 .L907
+  or r0 r2 r1
+  jump .L908
+.L907:
+  load 100 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 96 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  read -32 r14 r1
+.L908:
+  add r1 1 r1
+  jump .L904
+.L909:
+  addr2reg typ r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt897:
+  .int .L898
+  .int .L899
+  .int .L900
+  .int .L901
+  .int .L901
+  .int .L902
+
+/* end function parse */
+
+.data
+.balign 1
+.Lstring.302:
+	.ascii "thread \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.303:
+	.ascii "$%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.304:
+	.ascii "%+lli\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.305:
+	.ascii "s_<float>\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.306:
+	.ascii "d_<double>\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.307:
+	.ascii "%lli\000"
+/* end data */
+
+
+.text
+; function printcon
+printcon:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r1
+  or r0 r5 r4
+  write -12 r14 r4
+  write -16 r14 r1
+  read 0 r1 r2
+  load 1 r3
+  beq r2 r3 .L926
+  load 1 r3
+  blt r2 r3 .L923
+  load 2 r3
+  beq r2 r3 .L919
+  or r0 r2 r1
+  load 2 r2
+  sltu r1 r2 r1
+  jump .L931
+.L919:
+  add r1 4 r2
+  read 0 r2 r2
+  load 1 r3
+  bne r2 r3 .L921
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.302 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L921:
+  add r1 4 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump str
+  or r0 r1 r6
+  read -12 r14 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.303 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r4
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 16 r2
+  read 0 r2 r6
+  beq r6 r0 .L931
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.304 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L931
+.L923:
+  or r0 r2 r1
+  beq r1 r0 .L931
+  sltu r1 r0 r1
+  jump .L931
+.L926:
+  add r1 24 r2
+  readb 0 r2 r2
+  load 1 r3
+  beq r2 r3 .L930
+  load 2 r3
+  beq r2 r3 .L929
+  add r1 16 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.307 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L931
+.L929:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.306 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L931
+.L930:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.305 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+.L931:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function printcon */
+
+.data
+.balign 1
+.Lstring.309:
+	.ascii "R%d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.310:
+	.ascii "%%%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.311:
+	.ascii "UNDEF\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.312:
+	.ascii "S%d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.313:
+	.ascii "%04x\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.314:
+	.ascii ":%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.315:
+	.ascii " + \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.316:
+	.ascii "%d * \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.317:
+	.ascii "%d\000"
+/* end data */
+
+
+.text
+; function printref
+.global printref
+printref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 48 r13
+  write -32 r14 r6
+  write -24 r14 r5
+  add r14 -40 r1
+  write 0 r1 r4
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -32 r14 r5
+  read -24 r14 r1
+  load 7 r3
+  bge r2 r3 .L965
+  shiftl r2 2 r3
+  addr2reg .Ljt936 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L937:
+  read -40 r14 r2
+  shiftr r2 3 r3
+  load 32 r4
+  blts r3 r4 .L939
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.310 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L965
+.L939:
+  or r0 r2 r1
+  shiftr r1 3 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.309 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L965
+.L941:
+  load 1 r1
+  write -36 r14 r1
+  read -36 r14 r5
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -32 r14 r5
+  read -24 r14 r2
+  bne r1 r0 .L943
+  add r2 8 r1
+  read 0 r1 r1
+  read -40 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump printcon
+  jump .L965
+.L943:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.311 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L965
+.L944:
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  or r0 r1 r6
+  read -32 r14 r5
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.317 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L965
+.L945:
+  addr2reg typ r12
+  read 0 r12 r1
+  read -40 r14 r2
+  shiftr r2 3 r2
+  load 100 r3
+  mults r2 r3 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.314 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L965
+.L946:
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  or r0 r1 r6
+  read -32 r14 r5
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.312 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L965
+.L947:
+  read -40 r14 r1
+  shiftr r1 3 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.313 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L965
+.L948:
+  or r0 r1 r2
+  add r2 12 r1
+  read 0 r1 r1
+  read -40 r14 r2
+  shiftr r2 3 r2
+  load 48 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  write -28 r14 r1
+  load 91 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  read -28 r14 r1
+  read -32 r14 r5
+  read 0 r1 r3
+  load 0 r2
+  bne r3 r0 .L951
+  write -16 r14 r2
+  jump .L953
+.L951:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printcon
+  read -28 r14 r1
+  load 1 r2
+  write -16 r14 r2
+.L953:
+  add r1 32 r1
+  load 0 r2
+  write -36 r14 r2
+  read -36 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -16 r14 r2
+  read -28 r14 r1
+  read -32 r14 r5
+  or r0 r2 r3
+  read -24 r14 r2
+  beq r4 r0 .L955
+  write -20 r14 r3
+  jump .L960
+.L955:
+  bne r3 r0 .L957
+  or r0 r5 r12
+  or r0 r2 r5
+  or r0 r12 r2
+  jump .L958
+.L957:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.315 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r1
+  read -32 r14 r5
+  or r0 r5 r2
+  read -24 r14 r5
+  load32 -24 r3
+  sub r13 r3 r13
+.L958:
+  add r1 32 r1
+  or r0 r2 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -28 r14 r1
+  load 1 r2
+  write -20 r14 r2
+.L960:
+  add r1 36 r1
+  load 0 r2
+  write -36 r14 r2
+  read -36 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -20 r14 r2
+  read -28 r14 r1
+  read -32 r14 r5
+  bne r3 r0 .L964
+  beq r2 r0 .L963
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.315 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r1
+  read -32 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+.L963:
+  add r1 40 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.316 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r1
+  read -32 r14 r5
+  or r0 r5 r2
+  read -24 r14 r5
+  load32 -24 r3
+  sub r13 r3 r13
+  add r1 36 r1
+  or r0 r2 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -32 r14 r5
+.L964:
+  load 93 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+.L965:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt936:
+  .int .L937
+  .int .L941
+  .int .L944
+  .int .L945
+  .int .L946
+  .int .L947
+  .int .L948
+
+/* end function printref */
+
+.data
+.balign 1
+.Lktoc.319:
+	.ascii "wlsd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.321:
+	.ascii "retw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.322:
+	.ascii "retl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.323:
+	.ascii "rets\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.324:
+	.ascii "retd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.325:
+	.ascii "retsb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.326:
+	.ascii "retub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.327:
+	.ascii "retsh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.328:
+	.ascii "retuh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.329:
+	.ascii "retc\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.330:
+	.ascii "ret0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.331:
+	.ascii "jfieq\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.332:
+	.ascii "jfine\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.333:
+	.ascii "jfisge\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.334:
+	.ascii "jfisgt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.335:
+	.ascii "jfisle\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.336:
+	.ascii "jfislt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.337:
+	.ascii "jfiuge\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.338:
+	.ascii "jfiugt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.339:
+	.ascii "jfiule\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.340:
+	.ascii "jfiult\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.341:
+	.ascii "jffeq\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.342:
+	.ascii "jffge\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.343:
+	.ascii "jffgt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.344:
+	.ascii "jffle\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.345:
+	.ascii "jfflt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.346:
+	.ascii "jffne\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.347:
+	.ascii "jffo\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.348:
+	.ascii "jffuo\000"
+/* end data */
+
+.data
+.balign 4
+.Ljtoa.320:
+	.fill 4,1,0
+	.int .Lstring.321+0
+	.int .Lstring.322+0
+	.int .Lstring.323+0
+	.int .Lstring.324+0
+	.int .Lstring.325+0
+	.int .Lstring.326+0
+	.int .Lstring.327+0
+	.int .Lstring.328+0
+	.int .Lstring.329+0
+	.int .Lstring.330+0
+	.int .Lstring.158+0
+	.int .Lstring.159+0
+	.int .Lstring.331+0
+	.int .Lstring.332+0
+	.int .Lstring.333+0
+	.int .Lstring.334+0
+	.int .Lstring.335+0
+	.int .Lstring.336+0
+	.int .Lstring.337+0
+	.int .Lstring.338+0
+	.int .Lstring.339+0
+	.int .Lstring.340+0
+	.int .Lstring.341+0
+	.int .Lstring.342+0
+	.int .Lstring.343+0
+	.int .Lstring.344+0
+	.int .Lstring.345+0
+	.int .Lstring.346+0
+	.int .Lstring.347+0
+	.int .Lstring.348+0
+	.int .Lstring.162+0
+	.int .Lstring.160+0
+/* end data */
+
+.data
+.balign 1
+.Lstring.349:
+	.ascii "function $%s() {\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.350:
+	.ascii "@%s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.351:
+	.ascii "\011\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.352:
+	.ascii " =%c phi \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.353:
+	.ascii "p->narg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.354:
+	.ascii "@%s \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.355:
+	.ascii ", \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.356:
+	.ascii " =%c \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.357:
+	.ascii "optab[i->op].name\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.358:
+	.ascii "%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.359:
+	.ascii " \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.360:
+	.ascii "\011%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.361:
+	.ascii ", :%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.362:
+	.ascii "\011hlt\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.363:
+	.ascii "\011jmp @%s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.364:
+	.ascii "\011jtab \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.365:
+	.ascii ", @%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.366:
+	.ascii "\011%s \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.367:
+	.ascii "b->s1 && b->s2\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.368:
+	.ascii "@%s, @%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.369:
+	.ascii ", %d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.370:
+	.ascii "}\012\000"
+/* end data */
+
+
+.text
+; function printfn
+.global printfn
+printfn:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  or r0 r4 r1
+  or r0 r5 r4
+  write -28 r14 r4
+  write -20 r14 r1
+  add r1 54 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.349 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r4
+  read -20 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  read 0 r1 r1
+  or r0 r4 r5
+.L970:
+  write -32 r14 r1
+  beq r1 r0 .L1031
+  add r1 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.350 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+  read 0 r1 r1
+.L972:
+  write -24 r14 r1
+  beq r1 r0 .L982
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.351 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -24 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  or r0 r5 r6
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -24 r14 r1
+  read -28 r14 r5
+  add r1 16 r1
+  read 0 r1 r2
+  addr2reg .Lktoc.319 r1
+  add r1 r2 r1
+  readb 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.352 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -24 r14 r1
+  read -28 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 12 r2
+  read 0 r2 r2
+  bne r2 r0 .L975
+  load 1434 r6
+  addr2reg .Lstring.187 r5
+  addr2reg .Lstring.353 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -24 r14 r1
+  read -28 r14 r5
+.L975:
+  load 0 r2
+.L976:
+  write -16 r14 r2
+  add r1 8 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.354 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r2
+  read -24 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  or r0 r5 r6
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -16 r14 r2
+  read -24 r14 r1
+  read -28 r14 r5
+  add r1 12 r1
+  read 0 r1 r1
+  load 1 r3
+  sub r1 r3 r1
+  beq r2 r1 .L980
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.355 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r2
+  read -24 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  add r2 1 r2
+  jump .L976
+.L980:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.192 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -24 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L972
+.L982:
+  read -32 r14 r1
+  add r1 4 r2
+  read 0 r2 r2
+.L984:
+  write -12 r14 r2
+  or r0 r1 r3
+  add r1 4 r1
+  read 0 r1 r1
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r1 r3 r1
+  bge r2 r1 .L1000
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.351 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  add r2 4 r1
+  load 0 r2
+  write -36 r14 r2
+  read -36 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -12 r14 r2
+  read -28 r14 r5
+  read -20 r14 r4
+  bne r1 r0 .L987
+  add r2 4 r1
+  or r0 r5 r6
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -12 r14 r2
+  read -28 r14 r5
+  read 0 r2 r1
+  shiftr r1 30 r2
+  addr2reg .Lktoc.319 r1
+  add r1 r2 r1
+  readb 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.356 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r2
+  read -28 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L987:
+  read 0 r2 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 24 r3
+  mults r1 r3 r3
+  addr2reg optab r1
+  add r1 r3 r1
+  read 0 r1 r1
+  bne r1 r0 .L989
+  load 1451 r6
+  addr2reg .Lstring.187 r5
+  addr2reg .Lstring.357 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r2
+  read -28 r14 r5
+.L989:
+  read 0 r2 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 24 r2
+  mults r1 r2 r2
+  addr2reg optab r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.358 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  add r2 4 r1
+  load 0 r2
+  write -36 r14 r2
+  read -36 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -12 r14 r2
+  read -28 r14 r5
+  beq r1 r0 .L994
+  read 0 r2 r1
+  shiftl r1 2 r3
+  shiftr r3 2 r3
+  load 94 r4
+  sub r3 r4 r3
+  load 23 r4
+  bge r3 r4 .L994
+  shiftl r3 2 r4
+  addr2reg .Ljt992 r3
+  add r3 r4 r3
+  read 0 r3 r3
+  jumpr 0 r3
+.L993:
+  shiftr r1 30 r2
+  addr2reg .Lktoc.319 r1
+  add r1 r2 r1
+  readb 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  read -12 r14 r2
+.L994:
+  add r2 8 r1
+  add r1 0 r1
+  load 0 r2
+  write -36 r14 r2
+  read -36 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -12 r14 r2
+  read -28 r14 r5
+  bne r1 r0 .L996
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.359 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r2
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  add r2 8 r1
+  add r1 0 r1
+  or r0 r5 r6
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -12 r14 r2
+.L996:
+  add r2 8 r1
+  add r1 4 r1
+  load 0 r2
+  write -36 r14 r2
+  read -36 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -28 r14 r5
+  bne r1 r0 .L998
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.355 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r2
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  add r2 8 r1
+  add r1 4 r1
+  or r0 r5 r6
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -28 r14 r5
+.L998:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.192 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r2
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  add r2 16 r2
+  jump .L984
+.L1000:
+  read -32 r14 r1
+  read -20 r14 r4
+  add r1 12 r2
+  readh 0 r2 r2
+  load 1 r3
+  sub r2 r3 r3
+  load 32 r6
+  bge r3 r6 .L1014
+  shiftl r3 2 r6
+  addr2reg .Ljt1003 r3
+  add r3 r6 r3
+  read 0 r3 r3
+  jumpr 0 r3
+.L1004:
+  or r0 r2 r1
+  shiftl r1 2 r2
+  addr2reg .Ljtoa.320 r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.360 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 12 r2
+  readh 0 r2 r3
+  load 1 r2
+  load 10 r6
+  bne r3 r6 .L1006
+  add r1 12 r1
+  add r1 4 r1
+  load 0 r2
+  write -36 r14 r2
+  read -36 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1006:
+  beq r2 r0 .L1008
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.359 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 12 r1
+  add r1 4 r1
+  or r0 r5 r6
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+.L1008:
+  add r1 12 r1
+  readh 0 r1 r1
+  load 9 r2
+  bne r1 r2 .L1010
+  addr2reg typ r12
+  read 0 r12 r1
+  add r4 32 r2
+  read 0 r2 r2
+  load 100 r3
+  mults r2 r3 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.361 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L1010:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.192 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  jump .L1030
+.L1011:
+  add r1 20 r2
+  read 0 r2 r2
+  add r1 44 r3
+  read 0 r3 r3
+  beq r2 r3 .L1030
+  or r0 r2 r1
+  add r1 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.363 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  jump .L1030
+.L1014:
+  or r0 r2 r1
+  shiftl r1 2 r2
+  addr2reg .Ljtoa.320 r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.366 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 12 r2
+  readh 0 r2 r2
+  load 12 r3
+  bne r2 r3 .L1016
+  add r1 12 r1
+  add r1 4 r1
+  or r0 r5 r6
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -28 r14 r5
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.355 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+.L1016:
+  add r1 20 r2
+  read 0 r2 r3
+  load 0 r2
+  beq r3 r0 .L1018
+  add r1 24 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1018:
+  bne r2 r0 .L1020
+  load 1516 r6
+  addr2reg .Lstring.187 r5
+  addr2reg .Lstring.367 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r1
+  read -28 r14 r5
+.L1020:
+  add r1 20 r2
+  read 0 r2 r2
+  add r2 124 r6
+  add r1 24 r1
+  read 0 r1 r1
+  add r1 124 r7
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.368 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 12 r2
+  add r2 2 r2
+  readh 0 r2 r2
+  beq r2 r0 .L1023
+  or r0 r2 r1
+  xor r1 1 r1
+  sltu r1 1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.369 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L1023:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.192 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  jump .L1030
+.L1024:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.362 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  jump .L1030
+.L1025:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.364 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 12 r1
+  add r1 4 r1
+  or r0 r5 r6
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -32 r14 r1
+  read -28 r14 r5
+  load 0 r2
+.L1026:
+  write -8 r14 r2
+  or r0 r2 r3
+  add r1 40 r2
+  read 0 r2 r2
+  bge r3 r2 .L1029
+  or r0 r1 r2
+  add r1 28 r1
+  read 0 r1 r1
+  add r2 36 r2
+  read 0 r2 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.365 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -8 r14 r2
+  read -32 r14 r1
+  read -28 r14 r5
+  load32 -24 r3
+  sub r13 r3 r13
+  add r2 1 r2
+  jump .L1026
+.L1029:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r1
+  addr2reg .Lstring.192 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L1030:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L970
+.L1031:
+  or r0 r5 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.370 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt992:
+  .int .L993
+  .int .L994
+  .int .L994
+  .int .L993
+  .int .L993
+  .int .L993
+  .int .L993
+  .int .L993
+  .int .L993
+  .int .L993
+  .int .L994
+  .int .L994
+  .int .L994
+  .int .L994
+  .int .L994
+  .int .L994
+  .int .L994
+  .int .L994
+  .int .L994
+  .int .L994
+  .int .L994
+  .int .L994
+  .int .L993
+
+.rdata
+.balign 4
+.Ljt1003:
+  .int .L1004
+  .int .L1004
+  .int .L1004
+  .int .L1004
+  .int .L1004
+  .int .L1004
+  .int .L1004
+  .int .L1004
+  .int .L1004
+  .int .L1004
+  .int .L1011
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1014
+  .int .L1024
+  .int .L1025
+
+/* end function printfn */
+
+.data
+.balign 1
+lexh:
+	.fill 1024,1,0
+/* end data */
+
+.data
+.balign 4
+inf:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+inpath:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+thead:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 8
+tokval:
+	.fill 32,1,0
+/* end data */
+
+.data
+.balign 4
+lnum:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+curf:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+tmph:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+plink:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+curb:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+blink:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+blkh:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+nblk:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+rcls:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+ntyp:
+	.fill 4,1,0
+/* end data */
+
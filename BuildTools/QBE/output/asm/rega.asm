@@ -0,0 +1,5336 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+
+.text
+; function hint
+hint:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  addr2reg tmp r12
+  read 0 r12 r1
+  write -16 r14 r1
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump phicls
+  or r0 r1 r2
+  read -16 r14 r1
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 112 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function hint */
+
+
+.text
+; function sethint
+sethint:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r5
+  write -16 r14 r4
+  addr2reg tmp r12
+  read 0 r12 r1
+  write -12 r14 r1
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump phicls
+  or r0 r1 r2
+  read -12 r14 r1
+  read -8 r14 r5
+  read -16 r14 r4
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r2
+  add r2 112 r1
+  read 0 r1 r3
+  load 1 r1
+  load32 -1 r6
+  beq r3 r6 .L23
+  add r2 112 r1
+  add r1 4 r1
+  read 0 r1 r3
+  addr2reg loop r12
+  read 0 r12 r1
+  slt r1 r3 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L23:
+  beq r1 r0 .L25
+  add r2 112 r1
+  write 0 r1 r5
+  addr2reg loop r12
+  read 0 r12 r1
+  add r2 112 r2
+  add r2 4 r2
+  write 0 r2 r1
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r2
+  mults r4 r2 r2
+  add r1 r2 r1
+  add r1 156 r2
+  load32 -1 r1
+  write 0 r2 r1
+.L25:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function sethint */
+
+
+.text
+; function rcopy
+rcopy:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  load 128 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -12 r14 r5
+  read -16 r14 r4
+  add r4 128 r4
+  add r5 128 r5
+  load 128 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -12 r14 r5
+  read -16 r14 r4
+  add r4 256 r4
+  add r5 256 r5
+  load 128 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -12 r14 r5
+  read -16 r14 r4
+  add r4 384 r4
+  add r5 384 r5
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -12 r14 r5
+  read -16 r14 r4
+  add r5 392 r1
+  read 0 r1 r1
+  add r4 392 r2
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rcopy */
+
+
+.text
+; function rfind
+rfind:
+  load 0 r1
+.L33:
+  add r4 392 r2
+  read 0 r2 r2
+  bges r1 r2 .L38
+  shiftl r1 2 r2
+  add r4 r2 r2
+  read 0 r2 r2
+  beq r2 r5 .L36
+  add r1 1 r1
+  jump .L33
+.L36:
+  or r0 r1 r2
+  add r4 128 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  jump .L39
+.L38:
+  load32 -1 r1
+.L39:
+  jumpr 0 r15
+
+/* end function rfind */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "should have spilled\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "s != -1 && \042should have spilled\042\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "BuildTools/QBE/rega.c\000"
+/* end data */
+
+
+.text
+; function rref
+rref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump rfind
+  read -12 r14 r5
+  load32 -1 r2
+  beq r1 r2 .L44
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -20 r14 r1
+  read -20 r14 r1
+  jump .L49
+.L44:
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r2
+  mults r5 r2 r2
+  add r1 r2 r1
+  add r1 104 r1
+  read 0 r1 r1
+  write -16 r14 r1
+  load 0 r2
+  load32 -1 r3
+  beq r1 r3 .L46
+  addr2reg .Lstring.13 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L46:
+  bne r2 r0 .L48
+  load 89 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.14 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+.L48:
+  load32 536870911 r2
+  and r1 r2 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 4 r1
+  write -20 r14 r1
+  read -20 r14 r1
+.L49:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rref */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "invalid temporary\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "(t >= Tmp0 || t == r) && \042invalid temporary\042\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "invalid register\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "((T.gpr0 <= r && r < T.gpr0 + T.ngpr) || (T.fpr0 <= r && r < T.fpr0 + T.nfpr) || (BIT(r) & T.rglob)) && \042invalid register\042\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "temporary has mapping\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "!bshas(m->b, t) && \042temporary has mapping\042\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "register already allocated\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "!bshas(m->b, r) && \042register already allocated\042\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "too many mappings\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "m->n <= T.ngpr+T.nfpr+(int)__builtin_popcountl(T.rglob) && \042too many mappings\042\000"
+/* end data */
+
+
+.text
+; function radd
+radd:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -28 r14 r6
+  write -20 r14 r5
+  write -24 r14 r4
+  load 1 r1
+  load 32 r2
+  bges r5 r2 .L54
+  xor r5 r6 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L55
+.L54:
+  or r0 r1 r2
+.L55:
+  load 0 r1
+  beq r2 r0 .L57
+  addr2reg .Lstring.17 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L57:
+  bne r1 r0 .L59
+  load 98 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.18 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r6
+  read -20 r14 r5
+  read -24 r14 r4
+.L59:
+  addr2reg T+20 r12
+  read 0 r12 r1
+  load 0 r2
+  bgts r1 r6 .L61
+  addr2reg T+24 r12
+  read 0 r12 r2
+  add r1 r2 r1
+  slt r6 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L61:
+  load 1 r1
+  bne r2 r0 .L66
+  addr2reg T+28 r12
+  read 0 r12 r1
+  load 0 r2
+  bles r1 r6 .L64
+  or r0 r2 r1
+  jump .L65
+.L64:
+  addr2reg T+32 r12
+  read 0 r12 r2
+  add r1 r2 r1
+  slt r6 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L65:
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L67
+.L66:
+  or r0 r1 r2
+.L67:
+  load 1 r1
+  bne r2 r0 .L69
+  load 1 r1
+  shiftl r1 r6 r1
+  addr2reg T+40 r12
+  read 0 r12 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L70
+.L69:
+  or r0 r1 r2
+.L70:
+  load 0 r1
+  beq r2 r0 .L72
+  addr2reg .Lstring.19 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L72:
+  bne r1 r0 .L74
+  load 99 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r6
+  read -20 r14 r5
+  read -24 r14 r4
+.L74:
+  add r4 384 r1
+  write -12 r14 r1
+  read 0 r1 r2
+  shiftl r2 5 r2
+  blt r5 r2 .L77
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r1
+  read -28 r14 r6
+  read -20 r14 r5
+  read -24 r14 r4
+.L77:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r5 5 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  and r5 31 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  load 0 r1
+  bne r2 r0 .L80
+  addr2reg .Lstring.21 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L80:
+  bne r1 r0 .L82
+  load 103 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.22 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r6
+  read -20 r14 r5
+  read -24 r14 r4
+.L82:
+  add r4 384 r1
+  write -16 r14 r1
+  read 0 r1 r2
+  shiftl r2 5 r2
+  blt r6 r2 .L85
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+  read -28 r14 r6
+  read -20 r14 r5
+  read -24 r14 r4
+.L85:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r6 5 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  and r6 31 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  load 0 r1
+  bne r2 r0 .L88
+  addr2reg .Lstring.23 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L88:
+  bne r1 r0 .L90
+  load 104 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.24 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r6
+  read -20 r14 r5
+  read -24 r14 r4
+.L90:
+  add r4 392 r1
+  read 0 r1 r3
+  addr2reg T+24 r12
+  read 0 r12 r1
+  addr2reg T+32 r12
+  read 0 r12 r2
+  add r1 r2 r2
+  write -32 r14 r2
+  addr2reg T+40 r12
+  read 0 r12 r2
+  load 0 r1
+.L92:
+  beq r2 r0 .L95
+  add r1 1 r1
+  load 1 r7
+  sub r2 r7 r7
+  and r2 r7 r2
+  jump .L92
+.L95:
+  read -32 r14 r2
+  add r2 r1 r2
+  load 0 r1
+  bgts r3 r2 .L98
+  addr2reg .Lstring.25 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L98:
+  bne r1 r0 .L100
+  load 105 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.26 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -20 r14 r5
+  read -24 r14 r4
+.L100:
+  add r4 384 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -28 r14 r6
+  read -24 r14 r4
+  add r4 384 r4
+  or r0 r6 r5
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -28 r14 r6
+  read -20 r14 r5
+  read -24 r14 r4
+  add r4 392 r1
+  read 0 r1 r1
+  shiftl r1 2 r1
+  add r4 r1 r1
+  write 0 r1 r5
+  add r4 128 r1
+  add r4 392 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r6
+  add r4 392 r2
+  read 0 r2 r1
+  add r1 1 r1
+  write 0 r2 r1
+  addr2reg regu r12
+  read 0 r12 r1
+  load 1 r2
+  shiftl r2 r6 r2
+  or r1 r2 r1
+  addr2reg regu r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function radd */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "bshas(m->b, t)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "r != -1\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "no more regs\000"
+/* end data */
+
+
+.text
+; function ralloctry
+ralloctry:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 76 r13
+  write -20 r14 r6
+  write -64 r14 r5
+  write -52 r14 r4
+  load 32 r1
+  blts r5 r1 .L153
+  add r4 384 r1
+  write -8 r14 r1
+  read 0 r1 r2
+  shiftl r2 5 r2
+  blt r5 r2 .L108
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -8 r14 r1
+  read -20 r14 r6
+  read -64 r14 r5
+  read -52 r14 r4
+.L108:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r5 5 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  and r5 31 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  bne r1 r0 .L150
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r2
+  mults r5 r2 r2
+  add r1 r2 r1
+  add r1 156 r1
+  read 0 r1 r2
+  write -16 r14 r2
+  load 1 r1
+  load32 -1 r3
+  beq r2 r3 .L116
+  add r4 384 r1
+  write -12 r14 r1
+  read 0 r1 r3
+  shiftl r3 5 r3
+  blt r2 r3 .L114
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r1
+  read -16 r14 r2
+  read -20 r14 r6
+  read -64 r14 r5
+  read -52 r14 r4
+.L114:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r2 5 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  and r2 31 r7
+  load 1 r3
+  shiftl r3 r7 r3
+  and r1 r3 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L116:
+  beq r1 r0 .L118
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump hint
+  read -20 r14 r6
+  read -64 r14 r5
+  read -52 r14 r4
+  read 0 r1 r2
+.L118:
+  write -28 r14 r2
+  load 1 r1
+  load32 -1 r3
+  beq r2 r3 .L124
+  add r4 384 r1
+  write -24 r14 r1
+  read 0 r1 r3
+  shiftl r3 5 r3
+  blt r2 r3 .L122
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r2
+  read -24 r14 r1
+  read -20 r14 r6
+  read -64 r14 r5
+  read -52 r14 r4
+.L122:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r2 5 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  and r2 31 r7
+  load 1 r3
+  shiftl r3 r7 r3
+  and r1 r3 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L124:
+  beq r1 r0 .L144
+  bne r6 r0 .L149
+  addr2reg tmp r12
+  read 0 r12 r2
+  write -32 r14 r2
+  or r0 r5 r1
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump phicls
+  or r0 r1 r2
+  read -32 r14 r1
+  read -64 r14 r5
+  read -52 r14 r4
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 112 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r4 384 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r2 0 r2
+  read 0 r2 r2
+  or r1 r2 r3
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r2
+  mults r5 r2 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r1
+  shiftrs r1 1 r1
+  beq r1 r0 .L128
+  addr2reg T+28 r12
+  read 0 r12 r2
+  addr2reg T+32 r12
+  read 0 r12 r1
+  add r2 r1 r1
+  jump .L129
+.L128:
+  addr2reg T+20 r12
+  read 0 r12 r2
+  addr2reg T+24 r12
+  read 0 r12 r1
+  add r2 r1 r1
+.L129:
+  or r0 r2 r6
+  write -36 r14 r1
+  or r0 r6 r2
+.L131:
+  bges r2 r1 .L134
+  load 1 r7
+  shiftl r7 r2 r7
+  and r3 r7 r7
+  beq r7 r0 .L144
+  add r2 1 r2
+  jump .L131
+.L134:
+  or r0 r6 r2
+.L135:
+  write -44 r14 r2
+  bges r2 r1 .L143
+  add r4 384 r3
+  write -40 r14 r3
+  read 0 r3 r5
+  shiftl r5 5 r5
+  blt r2 r5 .L139
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -44 r14 r2
+  read -36 r14 r1
+  read -40 r14 r3
+  read -52 r14 r4
+.L139:
+  add r3 4 r3
+  read 0 r3 r3
+  shiftr r2 5 r5
+  shiftl r5 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  and r2 31 r6
+  load 1 r5
+  shiftl r5 r6 r5
+  and r3 r5 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  beq r3 r0 .L142
+  add r2 1 r2
+  jump .L135
+.L142:
+  read -64 r14 r5
+  jump .L144
+.L143:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.30 r5
+  addr2reg .Lstring.15 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -44 r14 r2
+  read -64 r14 r5
+  read -52 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L144:
+  write -48 r14 r2
+  or r0 r2 r6
+  savpc r15
+  add r15 12 r15
+  jump radd
+  read -48 r14 r2
+  read -64 r14 r5
+  or r0 r5 r1
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sethint
+  read -48 r14 r2
+  read -64 r14 r5
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r3
+  mults r5 r3 r3
+  add r1 r3 r1
+  add r1 156 r1
+  write 0 r1 r2
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump hint
+  read -48 r14 r2
+  read -64 r14 r5
+  read -52 r14 r4
+  read 0 r1 r3
+  load 0 r1
+  load32 -1 r6
+  beq r3 r6 .L146
+  xor r3 r2 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L146:
+  beq r1 r0 .L148
+  add r4 256 r1
+  shiftl r3 2 r3
+  add r1 r3 r1
+  write 0 r1 r5
+.L148:
+  shiftl r2 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -68 r14 r1
+  read -68 r14 r1
+  jump .L160
+.L149:
+  load 0 r1
+  write -68 r14 r1
+  read -68 r14 r1
+  jump .L160
+.L150:
+  savpc r15
+  add r15 12 r15
+  jump rfind
+  write -56 r14 r1
+  load32 -1 r2
+  bne r1 r2 .L152
+  load 126 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.29 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -56 r14 r1
+.L152:
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -68 r14 r1
+  read -68 r14 r1
+  jump .L160
+.L153:
+  add r4 384 r1
+  write -60 r14 r1
+  read 0 r1 r2
+  shiftl r2 5 r2
+  blt r5 r2 .L156
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -60 r14 r1
+  read -64 r14 r5
+.L156:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r5 5 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  and r5 31 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  bne r1 r0 .L159
+  load 121 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.28 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -64 r14 r5
+.L159:
+  shiftl r5 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -68 r14 r1
+  read -68 r14 r1
+.L160:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ralloctry */
+
+
+.text
+; function ralloc
+ralloc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 12 r13
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump ralloctry
+  write -4 r14 r1
+  read -4 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ralloc */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "t >= Tmp0 || !(BIT(t) & T.rglob)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "i+1 < m->n\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "t >= Tmp0 || t == r\000"
+/* end data */
+
+
+.text
+; function rfree
+rfree:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  or r0 r4 r2
+  write -24 r14 r5
+  write -28 r14 r2
+  load 1 r1
+  load 32 r3
+  bges r5 r3 .L169
+  load 1 r1
+  shiftl r1 r5 r1
+  addr2reg T+40 r12
+  read 0 r12 r3
+  and r1 r3 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L169:
+  bne r1 r0 .L171
+  load 173 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.33 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -24 r14 r5
+  read -28 r14 r2
+.L171:
+  add r2 384 r1
+  write -16 r14 r1
+  read 0 r1 r3
+  shiftl r3 5 r3
+  blt r5 r3 .L174
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+  read -24 r14 r5
+  read -28 r14 r2
+.L174:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r5 5 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  and r5 31 r4
+  load 1 r3
+  shiftl r3 r4 r3
+  and r1 r3 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  beq r1 r0 .L187
+  load 0 r1
+  or r0 r2 r4
+.L178:
+  write -32 r14 r1
+  shiftl r1 2 r2
+  add r4 r2 r2
+  read 0 r2 r2
+  beq r2 r5 .L182
+  add r1 1 r2
+  add r4 392 r3
+  read 0 r3 r3
+  blts r2 r3 .L181
+  load 177 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.34 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r1
+  read -24 r14 r5
+  read -28 r14 r4
+.L181:
+  add r1 1 r1
+  jump .L178
+.L182:
+  or r0 r4 r2
+  or r0 r1 r3
+  add r2 128 r1
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  write -20 r14 r1
+  add r2 384 r4
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+  read -20 r14 r1
+  read -28 r14 r2
+  add r2 384 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+  read -32 r14 r1
+  read -28 r14 r2
+  add r2 392 r4
+  or r0 r2 r3
+  read 0 r4 r2
+  load 1 r5
+  sub r2 r5 r2
+  write 0 r4 r2
+  shiftl r1 2 r4
+  add r3 r4 r4
+  add r1 1 r5
+  shiftl r5 2 r5
+  add r3 r5 r5
+  sub r2 r1 r1
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memmove
+  read -32 r14 r1
+  read -28 r14 r2
+  add r2 128 r3
+  shiftl r1 2 r4
+  add r3 r4 r4
+  add r2 128 r3
+  add r1 1 r5
+  shiftl r5 2 r5
+  add r3 r5 r5
+  add r2 392 r2
+  read 0 r2 r2
+  sub r2 r1 r1
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memmove
+  read -20 r14 r1
+  read -24 r14 r5
+  load 1 r2
+  load 32 r3
+  bges r5 r3 .L185
+  xor r5 r1 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L185:
+  bne r2 r0 .L188
+  load 184 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.35 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -20 r14 r1
+  jump .L188
+.L187:
+  load32 -1 r1
+.L188:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rfree */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii " (%s, R%d)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "\012\000"
+/* end data */
+
+
+.text
+; function mdump
+mdump:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+  load 0 r1
+.L192:
+  write -16 r14 r1
+  add r4 392 r2
+  read 0 r2 r2
+  bges r1 r2 .L196
+  shiftl r1 2 r2
+  add r4 r2 r2
+  read 0 r2 r2
+  load 32 r3
+  blts r2 r3 .L195
+  addr2reg tmp r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r2 r3 r6
+  or r0 r1 r2
+  add r4 128 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.37 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r1
+  read -12 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L195:
+  add r1 1 r1
+  jump .L192
+.L196:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.38 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mdump */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "cannot have more moves than registers\000"
+/* end data */
+
+
+.text
+; function pmadd
+pmadd:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  write -16 r14 r6
+  add r14 -20 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -24 r2
+  write 0 r2 r1
+  addr2reg npm r12
+  read 0 r12 r1
+  load 32 r2
+  bne r1 r2 .L202
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.40 r5
+  addr2reg .Lstring.15 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -16 r14 r6
+  load32 -24 r1
+  sub r13 r1 r13
+.L202:
+  addr2reg npm r12
+  read 0 r12 r1
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg pm r1
+  add r1 r2 r2
+  read -24 r14 r1
+  write 0 r2 r1
+  addr2reg npm r12
+  read 0 r12 r1
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg pm r1
+  add r1 r2 r1
+  add r1 4 r2
+  read -20 r14 r1
+  write 0 r2 r1
+  addr2reg npm r12
+  read 0 r12 r1
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg pm r1
+  add r1 r2 r1
+  add r1 8 r1
+  write 0 r1 r6
+  addr2reg npm r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg npm r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pmadd */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "KBASE(pm[i].cls) == KBASE(*k)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "unreachable\000"
+/* end data */
+
+
+.text
+; function pmrec
+pmrec:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  write -16 r14 r6
+  write -24 r14 r4
+  write -28 r14 r5
+  load 12 r1
+  mults r5 r1 r2
+  addr2reg pm r1
+  add r1 r2 r1
+  load 12 r2
+  mults r5 r2 r3
+  addr2reg pm r2
+  add r2 r3 r2
+  add r2 4 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -16 r14 r6
+  read -28 r14 r5
+  read -24 r14 r4
+  bne r1 r0 .L234
+  load 12 r1
+  mults r5 r1 r2
+  addr2reg pm r1
+  add r1 r2 r1
+  add r1 8 r1
+  read 0 r1 r1
+  shiftrs r1 1 r1
+  read 0 r6 r2
+  shiftrs r2 1 r2
+  beq r1 r2 .L209
+  load 226 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.42 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r6
+  read -28 r14 r5
+.L209:
+  read 0 r6 r1
+  load 12 r2
+  mults r5 r2 r3
+  addr2reg pm r2
+  add r2 r3 r2
+  add r2 8 r2
+  read 0 r2 r2
+  or r1 r2 r1
+  write 0 r6 r1
+  load 0 r1
+.L210:
+  write -32 r14 r1
+  addr2reg npm r12
+  read 0 r12 r2
+  bges r1 r2 .L214
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg pm r1
+  add r1 r2 r1
+  add r1 4 r1
+  load 12 r2
+  mults r5 r2 r3
+  addr2reg pm r2
+  add r2 r3 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -32 r14 r1
+  read -28 r14 r5
+  bne r2 r0 .L213
+  add r1 1 r1
+  jump .L210
+.L213:
+  read -16 r14 r6
+  read -24 r14 r4
+  jump .L215
+.L214:
+  read -16 r14 r6
+  read -24 r14 r4
+.L215:
+  addr2reg npm r12
+  read 0 r12 r2
+  beq r1 r2 .L217
+  shiftl r1 2 r2
+  add r4 r2 r2
+  read 0 r2 r2
+  jump .L218
+.L217:
+  load 2 r2
+.L218:
+  load 1 r3
+  beq r2 r3 .L232
+  load 1 r3
+  blt r2 r3 .L223
+  or r0 r2 r1
+  load 2 r2
+  beq r1 r2 .L229
+  or r0 r1 r2
+  load 2 r1
+  sltu r2 r1 r1
+  jump .L226
+.L223:
+  beq r2 r0 .L227
+  or r0 r2 r1
+  sltu r1 r0 r1
+.L226:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.43 r5
+  addr2reg .Lstring.15 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -28 r14 r5
+  read -24 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load32 -559030611 r1
+  jump .L233
+.L227:
+  shiftl r5 2 r2
+  add r4 r2 r3
+  load 1 r2
+  write 0 r3 r2
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump pmrec
+  read -16 r14 r6
+  read -28 r14 r5
+  read -24 r14 r4
+  write -20 r14 r1
+  beq r1 r5 .L231
+  load32 -1 r2
+  bne r1 r2 .L230
+.L229:
+  load 12 r1
+  mults r5 r1 r2
+  addr2reg pm r1
+  add r1 r2 r1
+  add r1 8 r1
+  or r0 r5 r2
+  read 0 r1 r5
+  load 12 r1
+  mults r2 r1 r3
+  addr2reg pm r1
+  add r1 r3 r1
+  add r1 4 r1
+  load 12 r3
+  mults r2 r3 r3
+  addr2reg pm r2
+  add r2 r3 r2
+  load 0 r3
+  write -36 r14 r3
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r4
+  read -36 r14 r3
+  add r4 8 r4
+  write 0 r4 r3
+  read 0 r2 r7
+  read 0 r1 r6
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -28 r14 r5
+  read -24 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  load32 -1 r1
+  jump .L233
+.L230:
+  or r0 r5 r2
+  read 0 r6 r5
+  load 0 r1
+  write -36 r14 r1
+  load 12 r1
+  mults r2 r1 r3
+  addr2reg pm r1
+  add r1 r3 r1
+  load 12 r3
+  mults r2 r3 r3
+  addr2reg pm r2
+  add r2 r3 r2
+  add r2 4 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  read 0 r2 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -36 r14 r6
+  load 94 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -20 r14 r1
+  read -28 r14 r5
+  read -24 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L233
+.L231:
+  load32 -1 r1
+  jump .L233
+.L232:
+  or r0 r5 r2
+  read 0 r6 r5
+  load 0 r1
+  write -36 r14 r1
+  load 12 r1
+  mults r2 r1 r3
+  addr2reg pm r1
+  add r1 r3 r1
+  load 12 r3
+  mults r2 r3 r3
+  addr2reg pm r2
+  add r2 r3 r2
+  add r2 4 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  read 0 r2 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -36 r14 r6
+  load 94 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -32 r14 r1
+  read -28 r14 r5
+  read -24 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+.L233:
+  shiftl r5 2 r2
+  add r4 r2 r3
+  load 2 r2
+  write 0 r3 r2
+  jump .L235
+.L234:
+  shiftl r5 2 r1
+  add r4 r1 r2
+  load 2 r1
+  write 0 r2 r1
+  load32 -1 r1
+.L235:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pmrec */
+
+.data
+.balign 1
+.Lstring.45:
+	.ascii "!npm || status[npm-1] == ToMove\000"
+/* end data */
+
+
+.text
+; function pmgen
+pmgen:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  addr2reg npm r12
+  read 0 r12 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -12 r14 r1
+  addr2reg npm r12
+  read 0 r12 r2
+  load 1 r3
+  beq r2 r0 .L240
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L241
+.L240:
+  or r0 r3 r2
+.L241:
+  bne r2 r0 .L243
+  load 267 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.45 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r1
+.L243:
+  load 0 r2
+.L244:
+  write -16 r14 r2
+  addr2reg npm r12
+  read 0 r12 r3
+  bges r2 r3 .L248
+  shiftl r2 2 r3
+  add r1 r3 r3
+  read 0 r3 r3
+  bne r3 r0 .L247
+  load 12 r3
+  mults r2 r3 r4
+  addr2reg pm r3
+  add r3 r4 r3
+  add r3 8 r3
+  read 0 r3 r3
+  write -20 r14 r3
+  add r14 -20 r6
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump pmrec
+  read -16 r14 r2
+  read -12 r14 r1
+.L247:
+  add r2 1 r2
+  jump .L244
+.L248:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pmgen */
+
+.data
+.balign 1
+.Lstring.47:
+	.ascii "r1 != r\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.48:
+	.ascii "n+1 < m->n\000"
+/* end data */
+
+
+.text
+; function move
+move:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 52 r13
+  write -28 r14 r6
+  add r14 -40 r1
+  write 0 r1 r5
+  write -24 r14 r4
+  load 0 r1
+  write -36 r14 r1
+  read -36 r14 r5
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -28 r14 r4
+  read -24 r14 r5
+  bne r1 r0 .L253
+  read -40 r14 r1
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump rfree
+  read -28 r14 r4
+  read -24 r14 r5
+  jump .L254
+.L253:
+  load32 -1 r1
+.L254:
+  write -16 r14 r1
+  add r4 384 r2
+  write -12 r14 r2
+  read 0 r2 r3
+  shiftl r3 5 r3
+  blt r5 r3 .L257
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r2
+  read -16 r14 r1
+  read -28 r14 r4
+  read -24 r14 r5
+.L257:
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r5 5 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  and r5 31 r6
+  load 1 r3
+  shiftl r3 r6 r3
+  and r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  beq r2 r0 .L269
+  bne r1 r5 .L261
+  load 281 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.47 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r4
+  read -24 r14 r5
+.L261:
+  load 0 r1
+  or r0 r4 r6
+  or r0 r5 r2
+.L263:
+  write -32 r14 r1
+  add r6 128 r3
+  shiftl r1 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  beq r3 r2 .L267
+  add r1 1 r3
+  add r6 392 r4
+  read 0 r4 r4
+  blts r3 r4 .L266
+  load 283 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.48 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r1
+  read -28 r14 r6
+  read -24 r14 r2
+.L266:
+  add r1 1 r1
+  jump .L263
+.L267:
+  or r0 r6 r4
+  shiftl r1 2 r1
+  add r4 r1 r1
+  read 0 r1 r5
+  write -20 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump rfree
+  read -28 r14 r4
+  read -24 r14 r5
+  add r4 384 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -20 r14 r5
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump ralloc
+  read -28 r14 r4
+  read -24 r14 r5
+  write -44 r14 r1
+  add r4 384 r4
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+.L269:
+  load 0 r1
+  write -36 r14 r1
+  read -36 r14 r5
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -28 r14 r4
+  read -24 r14 r5
+  bne r1 r0 .L271
+  read -40 r14 r1
+  or r0 r5 r2
+  shiftr r1 3 r5
+  jump .L273
+.L271:
+  or r0 r5 r2
+  or r0 r2 r5
+.L273:
+  or r0 r2 r6
+  savpc r15
+  add r15 12 r15
+  jump radd
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function move */
+
+
+.text
+; function regcpy
+regcpy:
+  read 0 r4 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r2
+  load 0 r1
+  load 88 r3
+  bne r2 r3 .L280
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  add r4 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L279:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L280:
+  jumpr 0 r15
+
+/* end function regcpy */
+
+.data
+.balign 1
+.Lstring.51:
+	.ascii "m0.n <= m->n\000"
+/* end data */
+
+
+.text
+; function dopm
+dopm:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 460 r13
+  write -4 r14 r4
+  write -40 r14 r6
+  read 0 r6 r1
+  write -452 r14 r1
+  add r6 4 r1
+  add r14 -452 r2
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  add r14 -452 r1
+  add r1 384 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r5 16 r2
+  write -44 r14 r2
+  or r0 r2 r1
+.L284:
+  load 16 r2
+  sub r1 r2 r1
+  write -48 r14 r1
+  add r1 8 r2
+  add r2 0 r2
+  read 0 r2 r2
+  shiftr r2 3 r4
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump move
+  read -48 r14 r1
+  read -40 r14 r6
+  read -4 r14 r4
+  add r4 4 r2
+  read 0 r2 r3
+  load 0 r2
+  beq r1 r3 .L287
+  load 16 r2
+  sub r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump regcpy
+  or r0 r1 r2
+  read -48 r14 r1
+  read -40 r14 r6
+  read -4 r14 r4
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L287:
+  bne r2 r0 .L284
+  add r14 -452 r2
+  add r2 392 r2
+  read 0 r2 r2
+  add r6 392 r3
+  read 0 r3 r3
+  bles r2 r3 .L290
+  load 315 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.51 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -48 r14 r1
+  read -40 r14 r6
+  read -4 r14 r4
+.L290:
+  add r4 4 r2
+  read 0 r2 r3
+  load 0 r2
+  beq r1 r3 .L292
+  load 16 r2
+  sub r1 r2 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  xor r2 124 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L292:
+  beq r2 r0 .L300
+  load 16 r2
+  sub r1 r2 r1
+  add r1 8 r1
+  add r1 4 r2
+  addr2reg T+60 r12
+  read 0 r12 r1
+  load 0 r5
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -40 r14 r6
+  addr2reg T+40 r12
+  read 0 r12 r2
+  or r1 r2 r3
+  write -32 r14 r3
+  load 0 r1
+.L294:
+  write -36 r14 r1
+  or r0 r1 r2
+  addr2reg T+48 r12
+  read 0 r12 r1
+  shiftl r2 2 r4
+  add r1 r4 r4
+  read 0 r4 r4
+  blts r4 r0 .L300
+  shiftl r2 2 r4
+  add r1 r4 r4
+  read 0 r4 r5
+  load 1 r4
+  shiftl r4 r5 r4
+  and r4 r3 r4
+  beq r4 r0 .L297
+  or r0 r2 r1
+  or r0 r3 r2
+  jump .L298
+.L297:
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  load 0 r1
+  write -56 r14 r1
+  read -56 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump move
+  read -36 r14 r1
+  read -32 r14 r2
+  read -40 r14 r6
+.L298:
+  add r1 1 r1
+  or r0 r2 r3
+  jump .L294
+.L300:
+  load 0 r1
+  addr2reg npm r12
+  write 0 r12 r1
+  load 0 r1
+.L301:
+  write -28 r14 r1
+  add r6 392 r2
+  read 0 r2 r2
+  bges r1 r2 .L309
+  shiftl r1 2 r2
+  add r6 r2 r2
+  read 0 r2 r2
+  write -24 r14 r2
+  addr2reg tmp r12
+  read 0 r12 r3
+  load 160 r4
+  mults r2 r4 r4
+  add r3 r4 r3
+  add r3 104 r3
+  read 0 r3 r4
+  write -20 r14 r4
+  or r0 r1 r3
+  add r6 128 r1
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r3
+  write -16 r14 r3
+  or r0 r2 r5
+  add r14 -452 r4
+  savpc r15
+  add r15 12 r15
+  jump rfind
+  or r0 r1 r5
+  read -28 r14 r1
+  read -16 r14 r3
+  read -20 r14 r4
+  read -24 r14 r2
+  read -40 r14 r6
+  load32 -1 r7
+  bne r5 r7 .L306
+  load32 -1 r5
+  beq r4 r5 .L308
+  or r0 r4 r1
+  shiftl r3 3 r3
+  load32 -8 r4
+  and r3 r4 r3
+  or r3 0 r3
+  write -56 r14 r3
+  load32 536870911 r3
+  and r1 r3 r1
+  shiftl r1 3 r1
+  load32 -8 r3
+  and r1 r3 r1
+  or r1 4 r1
+  write -52 r14 r1
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r6
+  read -52 r14 r5
+  read -56 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump pmadd
+  read -28 r14 r1
+  read -40 r14 r6
+  jump .L308
+.L306:
+  or r0 r5 r1
+  shiftl r3 3 r3
+  load32 -8 r4
+  and r3 r4 r3
+  or r3 0 r3
+  write -56 r14 r3
+  shiftl r1 3 r1
+  load32 -8 r3
+  and r1 r3 r1
+  or r1 0 r1
+  write -52 r14 r1
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r6
+  read -52 r14 r5
+  read -56 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump pmadd
+  read -28 r14 r1
+  read -40 r14 r6
+.L308:
+  add r1 1 r1
+  jump .L301
+.L309:
+  read -48 r14 r1
+  read -44 r14 r2
+.L310:
+  write -12 r14 r1
+  bge r1 r2 .L316
+  add r1 4 r1
+  load 0 r2
+  write -56 r14 r2
+  read -56 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -12 r14 r1
+  read -40 r14 r6
+  bne r2 r0 .L313
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump rfree
+  read -12 r14 r1
+  read -40 r14 r6
+.L313:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  write -8 r14 r5
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump rfind
+  or r0 r1 r3
+  read -12 r14 r1
+  read -8 r14 r5
+  read -44 r14 r2
+  read -40 r14 r6
+  load32 -1 r4
+  bne r3 r4 .L315
+  or r0 r6 r1
+  or r0 r5 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump radd
+  read -12 r14 r1
+  read -44 r14 r2
+  read -40 r14 r6
+.L315:
+  add r1 16 r1
+  jump .L310
+.L316:
+  savpc r15
+  add r15 12 r15
+  jump pmgen
+  read -48 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function dopm */
+
+
+.text
+; function prio1
+prio1:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftr r1 3 r4
+  savpc r15
+  add r15 12 r15
+  jump hint
+  read 0 r1 r1
+  load32 -1 r2
+  xor r1 r2 r1
+  sltu r0 r1 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function prio1 */
+
+
+.text
+; function insert
+insert:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -8 r14 r4
+  shiftl r6 2 r1
+  add r5 r1 r1
+  write 0 r1 r4
+.L325:
+  load 1 r1
+  or r0 r6 r2
+  sub r6 r1 r6
+  write -16 r14 r6
+  load 0 r1
+  bles r2 r0 .L327
+  shiftl r6 2 r1
+  add r5 r1 r1
+  read 0 r1 r1
+  read 0 r1 r5
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump prio1
+  read -16 r14 r6
+  read -12 r14 r5
+  read -8 r14 r4
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L327:
+  beq r1 r0 .L329
+  shiftl r6 2 r1
+  add r5 r1 r1
+  read 0 r1 r1
+  add r6 1 r2
+  shiftl r2 2 r2
+  add r5 r2 r2
+  write 0 r2 r1
+  shiftl r6 2 r1
+  add r5 r1 r1
+  write 0 r1 r4
+  jump .L325
+.L329:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function insert */
+
+.data
+.balign 1
+.Lstring.55:
+	.ascii "rtype(i->to) == RTmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.56:
+	.ascii "!isreg(i->to)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.57:
+	.ascii "bshas(cur->b, rf)\000"
+/* end data */
+
+
+.text
+; function doblk
+doblk:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 180 r13
+  write -172 r14 r8
+  write -88 r14 r5
+  or r0 r4 r1
+  write -96 r14 r1
+  add r1 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -88 r14 r4
+  read -96 r14 r1
+  bne r2 r0 .L334
+  add r1 12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump ralloc
+  or r0 r1 r2
+  read -96 r14 r1
+  write -168 r14 r2
+  add r1 12 r2
+  add r2 4 r3
+  read -168 r14 r2
+  write 0 r3 r2
+.L334:
+  addr2reg insb r12
+  read 0 r12 r2
+  load32 4194304 r3
+  add r2 r3 r2
+  addr2reg curi r12
+  write 0 r12 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r1 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r2
+  load32 -559030611 r4
+  load32 -559030611 r3
+  write -100 r14 r4
+  write -104 r14 r3
+.L336:
+  add r1 4 r1
+  read 0 r1 r1
+  beq r2 r1 .L434
+  load 16 r1
+  sub r2 r1 r2
+  write -108 r14 r2
+  add r14 -164 r4
+  add r2 0 r1
+  read 0 r1 r1
+  add r14 -164 r3
+  add r3 0 r3
+  write 0 r3 r1
+  add r2 4 r1
+  read 0 r1 r1
+  add r14 -164 r3
+  add r3 4 r3
+  write 0 r3 r1
+  add r2 8 r1
+  read 0 r1 r1
+  or r0 r2 r3
+  add r14 -164 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r3 12 r1
+  read 0 r1 r1
+  add r14 -164 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump emiti
+  addr2reg curi r12
+  read 0 r12 r2
+  write -112 r14 r2
+  read 0 r2 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 124 r3
+  beq r1 r3 .L366
+  load 124 r3
+  bge r1 r3 .L346
+  load 88 r3
+  beq r1 r3 .L342
+  load 88 r3
+  sltu r1 r3 r1
+  jump .L346
+.L342:
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump regcpy
+  or r0 r1 r4
+  read -112 r14 r2
+  read -108 r14 r3
+  read -88 r14 r5
+  read -96 r14 r1
+  bne r4 r0 .L363
+  add r2 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  read -112 r14 r2
+  beq r1 r0 .L346
+  add r2 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -112 r14 r2
+  bne r1 r0 .L346
+  add r2 8 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 3 r4
+  add r2 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump sethint
+  read -112 r14 r2
+.L346:
+  add r2 4 r1
+  load 0 r2
+  write -124 r14 r2
+  read -124 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -112 r14 r2
+  load32 -1 r1
+  beq r3 r0 .L348
+  or r0 r2 r6
+  or r0 r1 r3
+  jump .L355
+.L348:
+  add r2 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -112 r14 r2
+  read -88 r14 r5
+  beq r1 r0 .L350
+  load 402 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.55 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -112 r14 r2
+  read -88 r14 r5
+.L350:
+  add r2 4 r1
+  read 0 r1 r3
+  or r0 r5 r1
+  shiftr r3 3 r5
+  load 0 r3
+  load 32 r4
+  bges r5 r4 .L352
+  load 1 r3
+  shiftl r3 r5 r3
+  addr2reg T+40 r12
+  read 0 r12 r4
+  and r3 r4 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L352:
+  bne r3 r0 .L360
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rfree
+  or r0 r1 r3
+  read -112 r14 r2
+  load32 -1 r1
+  beq r3 r1 .L356
+  shiftl r3 3 r1
+  load32 -8 r4
+  and r1 r4 r1
+  or r1 0 r1
+  or r0 r2 r6
+  add r2 4 r2
+  write 0 r2 r1
+.L355:
+  or r0 r6 r2
+  write -80 r14 r3
+  jump .L376
+.L356:
+  or r0 r2 r6
+  add r6 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r6
+  read -100 r14 r3
+  read -104 r14 r4
+  read -108 r14 r2
+  read -88 r14 r5
+  read -96 r14 r1
+  beq r6 r0 .L359
+  load 408 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.56 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -100 r14 r3
+  read -104 r14 r4
+  read -108 r14 r2
+  read -88 r14 r5
+  read -96 r14 r1
+.L359:
+  addr2reg curi r12
+  read 0 r12 r6
+  add r6 16 r6
+  addr2reg curi r12
+  write 0 r12 r6
+  jump .L433
+.L360:
+  or r0 r2 r6
+  load32 -1 r1
+  or r0 r6 r2
+  write -80 r14 r1
+  jump .L376
+.L363:
+  or r0 r3 r2
+  or r0 r2 r7
+  addr2reg curi r12
+  read 0 r12 r2
+  add r2 16 r2
+  addr2reg curi r12
+  write 0 r12 r2
+  or r0 r5 r6
+  or r0 r7 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump dopm
+  or r0 r1 r2
+  read -100 r14 r3
+  read -104 r14 r4
+  read -112 r14 r6
+  read -88 r14 r5
+  read -96 r14 r1
+  addr2reg stmov r12
+  read 0 r12 r7
+  write -8 r14 r7
+  add r6 16 r6
+  addr2reg curi r12
+  read 0 r12 r7
+  sub r6 r7 r6
+  shiftrs r6 31 r7
+  shiftr r7 28 r7
+  add r6 r7 r7
+  or r0 r3 r6
+  read -8 r14 r3
+  shiftrs r7 4 r7
+  add r3 r7 r3
+  addr2reg stmov r12
+  write 0 r12 r3
+  or r0 r6 r3
+  jump .L433
+.L366:
+  add r2 8 r1
+  add r1 4 r2
+  addr2reg T+64 r12
+  read 0 r12 r1
+  load 0 r5
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -88 r14 r5
+  addr2reg T+40 r12
+  read 0 r12 r2
+  or r1 r2 r3
+  write -84 r14 r3
+  load 0 r1
+.L367:
+  write -92 r14 r1
+  or r0 r1 r2
+  addr2reg T+48 r12
+  read 0 r12 r1
+  shiftl r2 2 r4
+  add r1 r4 r4
+  read 0 r4 r4
+  blts r4 r0 .L373
+  shiftl r2 2 r4
+  add r1 r4 r4
+  read 0 r4 r6
+  load 1 r4
+  shiftl r4 r6 r4
+  and r4 r3 r4
+  beq r4 r0 .L370
+  or r0 r2 r1
+  or r0 r3 r2
+  jump .L371
+.L370:
+  shiftl r2 2 r2
+  add r1 r2 r2
+  or r0 r5 r1
+  read 0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rfree
+  read -92 r14 r1
+  read -84 r14 r2
+  read -88 r14 r5
+.L371:
+  add r1 1 r1
+  or r0 r2 r3
+  jump .L367
+.L373:
+  read -112 r14 r2
+  load32 -1 r1
+  write -80 r14 r1
+.L376:
+  load 0 r3
+  load 0 r1
+  write -56 r14 r1
+.L378:
+  write -76 r14 r3
+  load 2 r1
+  bges r3 r1 .L394
+  add r2 8 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r4
+  read -76 r14 r3
+  read -56 r14 r1
+  read -112 r14 r2
+  load 6 r5
+  beq r4 r5 .L385
+  load 6 r5
+  bge r4 r5 .L392
+  beq r4 r0 .L384
+  sltu r4 r0 r4
+  jump .L392
+.L384:
+  add r2 8 r2
+  shiftl r3 2 r3
+  add r2 r3 r4
+  add r1 1 r2
+  write -52 r14 r2
+  or r0 r1 r6
+  add r14 -140 r5
+  savpc r15
+  add r15 12 r15
+  jump insert
+  read -76 r14 r3
+  read -52 r14 r1
+  read -112 r14 r2
+  jump .L392
+.L385:
+  addr2reg mem r12
+  read 0 r12 r1
+  or r0 r2 r4
+  add r2 8 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  load 48 r3
+  mults r2 r3 r2
+  add r1 r2 r2
+  write -68 r14 r2
+  add r2 32 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -56 r14 r1
+  read -68 r14 r2
+  beq r3 r0 .L387
+  write -64 r14 r1
+  jump .L389
+.L387:
+  add r2 32 r4
+  add r1 1 r2
+  write -60 r14 r2
+  or r0 r1 r6
+  add r14 -140 r5
+  savpc r15
+  add r15 12 r15
+  jump insert
+  read -60 r14 r1
+  read -68 r14 r2
+  write -64 r14 r1
+.L389:
+  add r2 36 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r5
+  read -64 r14 r1
+  read -76 r14 r3
+  read -68 r14 r2
+  read -112 r14 r4
+  beq r5 r0 .L391
+  or r0 r4 r2
+  jump .L392
+.L391:
+  add r2 36 r4
+  add r1 1 r2
+  write -72 r14 r2
+  or r0 r1 r6
+  add r14 -140 r5
+  savpc r15
+  add r15 12 r15
+  jump insert
+  read -76 r14 r3
+  read -72 r14 r1
+  read -112 r14 r2
+.L392:
+  add r3 1 r3
+  write -56 r14 r1
+  jump .L378
+.L394:
+  read -56 r14 r1
+  read -88 r14 r5
+  load 0 r2
+.L396:
+  write -48 r14 r2
+  bges r2 r1 .L399
+  shiftl r2 2 r2
+  add r14 -140 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  read 0 r1 r2
+  or r0 r5 r1
+  shiftr r2 3 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump ralloc
+  or r0 r1 r3
+  read -48 r14 r2
+  read -56 r14 r1
+  read -88 r14 r5
+  write -148 r14 r3
+  shiftl r2 2 r4
+  add r14 -140 r3
+  add r3 r4 r3
+  read 0 r3 r4
+  read -148 r14 r3
+  write 0 r4 r3
+  add r2 1 r2
+  jump .L396
+.L399:
+  read -80 r14 r3
+  read -112 r14 r2
+  read -108 r14 r7
+  read 0 r2 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 0 r4
+  write -16 r14 r4
+  load 88 r4
+  xor r1 r4 r1
+  sltu r1 1 r1
+  write -12 r14 r1
+  read -100 r14 r6
+  read -104 r14 r4
+  read -96 r14 r1
+  read -12 r14 r12
+  bne r12 r0 .L402
+  or r0 r7 r2
+  read -16 r14 r7
+  jump .L403
+.L402:
+  add r2 4 r1
+  add r2 8 r2
+  add r2 0 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r7
+  read -80 r14 r3
+  read -100 r14 r6
+  read -104 r14 r4
+  read -108 r14 r2
+  read -88 r14 r5
+  read -96 r14 r1
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L403:
+  beq r7 r0 .L405
+  addr2reg curi r12
+  read 0 r12 r7
+  add r7 16 r7
+  addr2reg curi r12
+  write 0 r12 r7
+.L405:
+  load 0 r7
+  write -20 r14 r7
+  load32 -1 r7
+  xor r3 r7 r8
+  sltu r0 r8 r8
+  read -20 r14 r7
+  bne r8 r0 .L407
+  or r0 r3 r12
+  or r0 r6 r3
+  or r0 r12 r6
+  jump .L408
+.L407:
+  or r0 r3 r6
+  add r5 256 r3
+  shiftl r6 2 r7
+  add r3 r7 r3
+  read 0 r3 r3
+  xor r3 0 r7
+  sltu r0 r7 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L408:
+  write -44 r14 r3
+  beq r7 r0 .L433
+  add r5 384 r1
+  write -24 r14 r1
+  read 0 r1 r7
+  shiftl r7 5 r7
+  blt r6 r7 .L412
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -44 r14 r3
+  read -80 r14 r6
+  read -104 r14 r4
+  read -24 r14 r1
+  read -108 r14 r2
+  read -88 r14 r5
+.L412:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r6 5 r7
+  shiftl r7 2 r7
+  add r1 r7 r1
+  read 0 r1 r1
+  write -28 r14 r1
+  read -96 r14 r1
+  and r6 31 r7
+  load 1 r6
+  shiftl r6 r7 r7
+  read -28 r14 r6
+  and r6 r7 r6
+  xor r6 0 r6
+  sltu r0 r6 r7
+  load 0 r6
+  beq r7 r0 .L415
+  or r0 r6 r7
+  jump .L416
+.L415:
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump hint
+  or r0 r1 r7
+  read -44 r14 r3
+  read -80 r14 r6
+  read -104 r14 r4
+  read -108 r14 r2
+  read -88 r14 r5
+  read -96 r14 r1
+  read 0 r7 r7
+  xor r7 r6 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r7
+.L416:
+  load 0 r6
+  beq r7 r0 .L418
+  or r0 r5 r1
+  or r0 r3 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rfree
+  or r0 r1 r4
+  read -44 r14 r3
+  read -108 r14 r2
+  read -88 r14 r5
+  read -96 r14 r1
+  load32 -1 r6
+  xor r4 r6 r6
+  sltu r0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L418:
+  write -36 r14 r4
+  beq r6 r0 .L433
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r2
+  mults r3 r2 r2
+  add r1 r2 r1
+  add r1 156 r2
+  load32 -1 r1
+  write 0 r2 r1
+  or r0 r5 r1
+  or r0 r3 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump ralloc
+  or r0 r1 r2
+  read -36 r14 r4
+  read -44 r14 r3
+  or r0 r3 r1
+  read -80 r14 r3
+  read -88 r14 r5
+  write -144 r14 r2
+  add r5 384 r2
+  write -32 r14 r2
+  read 0 r2 r5
+  shiftl r5 5 r5
+  blt r3 r5 .L422
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -36 r14 r4
+  read -44 r14 r3
+  or r0 r3 r1
+  read -80 r14 r3
+  read -32 r14 r2
+.L422:
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r3 5 r5
+  shiftl r5 2 r5
+  add r2 r5 r2
+  read 0 r2 r2
+  and r3 31 r6
+  load 1 r5
+  shiftl r5 r6 r5
+  and r2 r5 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  bne r2 r0 .L425
+  load 441 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.57 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -36 r14 r4
+  read -44 r14 r3
+  or r0 r3 r2
+  read -80 r14 r3
+  jump .L426
+.L425:
+  or r0 r1 r2
+.L426:
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r5
+  mults r2 r5 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r5
+  shiftl r4 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -124 r14 r1
+  shiftl r3 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -120 r14 r1
+  load 0 r1
+  write -116 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -116 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -120 r14 r7
+  read -124 r14 r6
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -36 r14 r4
+  read -56 r14 r1
+  read -80 r14 r3
+  read -88 r14 r5
+  load32 -12 r2
+  sub r13 r2 r13
+  addr2reg stmov r12
+  read 0 r12 r2
+  add r2 1 r2
+  addr2reg stmov r12
+  write 0 r12 r2
+  add r5 256 r2
+  shiftl r3 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  load 0 r2
+  or r0 r2 r3
+.L428:
+  write -40 r14 r3
+  bges r3 r1 .L432
+  shiftl r3 2 r2
+  add r14 -140 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  shiftl r4 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -124 r14 r2
+  read -124 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r5
+  read -40 r14 r3
+  read -36 r14 r4
+  read -56 r14 r1
+  read -80 r14 r2
+  beq r5 r0 .L431
+  shiftl r2 3 r5
+  load32 -8 r6
+  and r5 r6 r5
+  or r5 0 r5
+  shiftl r3 2 r7
+  add r14 -140 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  write 0 r6 r5
+.L431:
+  add r3 1 r3
+  jump .L428
+.L432:
+  read -44 r14 r3
+  read -108 r14 r2
+  read -88 r14 r5
+  read -96 r14 r1
+.L433:
+  write -100 r14 r3
+  write -104 r14 r4
+  jump .L336
+.L434:
+  read -96 r14 r1
+  addr2reg insb r12
+  read 0 r12 r2
+  load32 4194304 r3
+  add r2 r3 r2
+  addr2reg curi r12
+  read 0 r12 r3
+  sub r2 r3 r2
+  shiftrs r2 31 r3
+  shiftr r3 28 r3
+  add r2 r3 r2
+  shiftrs r2 4 r6
+  add r1 8 r2
+  write 0 r2 r6
+  add r1 4 r4
+  addr2reg curi r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump idup
+  read -172 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function doblk */
+
+
+.text
+; function carve
+carve:
+  read 0 r4 r3
+  read 0 r5 r4
+  add r3 116 r1
+  read 0 r1 r1
+  add r4 116 r2
+  read 0 r2 r2
+  beq r1 r2 .L443
+  bgts r1 r2 .L442
+  load 1 r1
+  jump .L446
+.L442:
+  load32 -1 r1
+  jump .L446
+.L443:
+  add r3 48 r1
+  read 0 r1 r1
+  add r4 48 r2
+  read 0 r2 r2
+  bgt r1 r2 .L445
+  sltu r1 r2 r1
+  jump .L446
+.L445:
+  load32 -1 r1
+.L446:
+  jumpr 0 r15
+
+/* end function carve */
+
+
+.text
+; function prio2
+prio2:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r2
+  mults r4 r2 r2
+  add r1 r2 r2
+  add r2 156 r2
+  read 0 r2 r2
+  load 160 r3
+  mults r5 r3 r3
+  add r1 r3 r3
+  add r3 156 r3
+  read 0 r3 r3
+  xor r2 r3 r2
+  blts r2 r0 .L455
+  savpc r15
+  add r15 12 r15
+  jump hint
+  read -12 r14 r5
+  read 0 r1 r1
+  write -8 r14 r1
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump hint
+  or r0 r1 r2
+  read -8 r14 r1
+  read -12 r14 r5
+  read -16 r14 r4
+  read 0 r2 r2
+  xor r1 r2 r1
+  blts r1 r0 .L452
+  addr2reg tmp r12
+  read 0 r12 r2
+  load 160 r1
+  mults r4 r1 r1
+  add r2 r1 r1
+  add r1 100 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r5 r3 r3
+  add r2 r3 r2
+  add r2 100 r2
+  read 0 r2 r2
+  sub r1 r2 r1
+  jump .L458
+.L452:
+  savpc r15
+  add r15 12 r15
+  jump hint
+  read 0 r1 r1
+  load32 -1 r2
+  bne r1 r2 .L454
+  load32 -1 r1
+  jump .L458
+.L454:
+  load 1 r1
+  jump .L458
+.L455:
+  load 160 r2
+  mults r4 r2 r2
+  add r1 r2 r1
+  add r1 156 r1
+  read 0 r1 r1
+  load32 -1 r2
+  bne r1 r2 .L457
+  load32 -1 r1
+  jump .L458
+.L457:
+  load 1 r1
+.L458:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function prio2 */
+
+.data
+.balign 1
+.Lstring.61:
+	.ascii "x != 0 || t < Tmp0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.62:
+	.ascii "\012> Register mappings:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.63:
+	.ascii "\011%-10s beg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.64:
+	.ascii "\011           end\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.65:
+	.ascii "rtype(dst)==RSlot || rtype(dst)==RTmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.66:
+	.ascii "u+1 < p->narg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.67:
+	.ascii "%s_%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.68:
+	.ascii "\012> Register allocation statistics:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.69:
+	.ascii "\011new moves:  %d\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.70:
+	.ascii "\011new blocks: %d\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.71:
+	.ascii "\012> After register allocation:\012\000"
+/* end data */
+
+
+.text
+; function rega
+.global rega
+rega:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 1160 r13
+  write -1148 r14 r8
+  write -1152 r14 r9
+  write -164 r14 r4
+  load 0 r1
+  addr2reg stmov r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg stblk r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg regu r12
+  write 0 r12 r1
+  add r4 4 r1
+  read 0 r1 r1
+  addr2reg tmp r12
+  write 0 r12 r1
+  add r4 12 r1
+  read 0 r1 r1
+  addr2reg mem r12
+  write 0 r12 r1
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -176 r14 r1
+  read -164 r14 r4
+  add r4 28 r1
+  read 0 r1 r1
+  load 396 r2
+  mults r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -172 r14 r1
+  read -164 r14 r4
+  add r4 28 r1
+  read 0 r1 r1
+  load 396 r2
+  mults r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -168 r14 r1
+  read -172 r14 r1
+  read -164 r14 r4
+  load 0 r2
+.L462:
+  write -160 r14 r2
+  add r4 28 r3
+  read 0 r3 r3
+  bge r2 r3 .L465
+  load 396 r3
+  mults r2 r3 r2
+  add r1 r2 r2
+  or r0 r4 r1
+  add r2 384 r4
+  add r1 16 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -160 r14 r2
+  read -168 r14 r5
+  read -164 r14 r4
+  load 396 r1
+  mults r2 r1 r1
+  add r5 r1 r2
+  or r0 r4 r1
+  add r2 384 r4
+  add r1 16 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -160 r14 r2
+  read -168 r14 r5
+  read -172 r14 r1
+  read -164 r14 r4
+  add r2 1 r2
+  jump .L462
+.L465:
+  add r14 -988 r2
+  or r0 r4 r1
+  add r2 384 r4
+  add r1 16 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -164 r14 r4
+  add r14 -592 r2
+  or r0 r4 r1
+  add r2 384 r4
+  add r1 16 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -168 r14 r5
+  read -172 r14 r1
+  read -164 r14 r4
+  load32 2147483647 r2
+  addr2reg loop r12
+  write 0 r12 r2
+  load 0 r2
+  write -1124 r14 r2
+  load 0 r2
+.L466:
+  add r4 16 r3
+  read 0 r3 r3
+  bges r2 r3 .L473
+  load 32 r3
+  blts r2 r3 .L469
+  or r0 r2 r6
+  load32 -1 r2
+  jump .L471
+.L469:
+  or r0 r2 r6
+  or r0 r6 r2
+.L471:
+  addr2reg tmp r12
+  read 0 r12 r3
+  load 160 r7
+  mults r6 r7 r6
+  add r3 r6 r3
+  add r3 112 r3
+  write 0 r3 r2
+  addr2reg loop r12
+  read 0 r12 r2
+  addr2reg tmp r12
+  read 0 r12 r3
+  read -1124 r14 r6
+  load 160 r7
+  mults r6 r7 r6
+  add r3 r6 r3
+  add r3 112 r3
+  add r3 4 r3
+  write 0 r3 r2
+  addr2reg tmp r12
+  read 0 r12 r2
+  read -1124 r14 r3
+  load 160 r6
+  mults r3 r6 r3
+  add r2 r3 r2
+  add r2 156 r3
+  load32 -1 r2
+  write 0 r3 r2
+  read -1124 r14 r2
+  add r2 1 r2
+  write -1124 r14 r2
+  jump .L466
+.L473:
+  read -176 r14 r8
+  read 0 r4 r3
+  or r0 r8 r2
+.L476:
+  beq r3 r0 .L479
+  or r0 r2 r9
+  add r2 4 r2
+  write 0 r9 r3
+  add r3 44 r3
+  read 0 r3 r3
+  jump .L476
+.L479:
+  add r4 28 r1
+  read 0 r1 r5
+  addr2reg carve r7
+  load 4 r6
+  or r0 r8 r4
+  savpc r15
+  add r15 12 r15
+  jump qsort
+  read -164 r14 r4
+  read 0 r4 r1
+  write -16 r14 r1
+  add r1 4 r2
+  read 0 r2 r2
+.L480:
+  write -20 r14 r2
+  or r0 r1 r3
+  add r1 4 r1
+  read 0 r1 r1
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r1 r3 r1
+  bge r2 r1 .L489
+  read 0 r2 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r3
+  load 1 r1
+  load 88 r4
+  bne r3 r4 .L483
+  add r2 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  read -20 r14 r2
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L483:
+  bne r1 r0 .L488
+  add r2 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -20 r14 r2
+  beq r1 r0 .L486
+  load 528 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.55 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -20 r14 r2
+.L486:
+  add r2 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r4
+  add r2 8 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump sethint
+  read -20 r14 r2
+  read -16 r14 r1
+  add r2 16 r2
+  jump .L480
+.L488:
+  read -176 r14 r8
+  read -164 r14 r4
+  jump .L490
+.L489:
+  read -176 r14 r8
+  read -164 r14 r4
+.L490:
+  or r0 r8 r2
+.L491:
+  write -148 r14 r2
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r1
+  add r8 r1 r1
+  bge r2 r1 .L529
+  read 0 r2 r2
+  write -156 r14 r2
+  add r2 48 r1
+  read 0 r1 r1
+  write -144 r14 r1
+  add r2 116 r1
+  read 0 r1 r1
+  addr2reg loop r12
+  write 0 r12 r1
+  add r14 -988 r1
+  add r1 392 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -988 r1
+  add r1 384 r4
+  savpc r15
+  add r15 12 r15
+  jump bszero
+  add r14 -988 r1
+  add r1 256 r4
+  load 128 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  read -156 r14 r2
+  load 32 r1
+  write -1124 r14 r1
+  load 0 r1
+  write -136 r14 r1
+.L494:
+  add r2 92 r4
+  add r14 -1124 r5
+  savpc r15
+  add r15 12 r15
+  jump bsiter
+  or r0 r1 r2
+  read -136 r14 r1
+  beq r2 r0 .L503
+  add r1 1 r2
+  write -152 r14 r2
+  read -1124 r14 r2
+  shiftl r1 2 r4
+  add r14 -1116 r3
+  add r3 r4 r3
+  write 0 r3 r2
+.L496:
+  or r0 r1 r3
+  load 1 r1
+  sub r3 r1 r1
+  write -140 r14 r1
+  load 0 r2
+  bles r3 r0 .L498
+  read -1124 r14 r4
+  shiftl r1 2 r2
+  add r14 -1116 r1
+  add r1 r2 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump prio2
+  or r0 r1 r3
+  read -140 r14 r1
+  load 0 r2
+  slt r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L498:
+  beq r2 r0 .L500
+  shiftl r1 2 r3
+  add r14 -1116 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  add r1 1 r3
+  shiftl r3 2 r4
+  add r14 -1116 r3
+  add r3 r4 r3
+  write 0 r3 r2
+  read -1124 r14 r2
+  shiftl r1 2 r4
+  add r14 -1116 r3
+  add r3 r4 r3
+  write 0 r3 r2
+  jump .L496
+.L500:
+  read -152 r14 r1
+  read -156 r14 r2
+  read -1124 r14 r3
+  add r3 1 r3
+  write -1124 r14 r3
+  write -136 r14 r1
+  jump .L494
+.L503:
+  read -156 r14 r2
+  load 0 r1
+  write -1120 r14 r1
+.L505:
+  add r2 92 r4
+  add r14 -1120 r5
+  savpc r15
+  add r15 12 r15
+  jump bsiter
+  or r0 r1 r2
+  load 0 r1
+  beq r2 r0 .L507
+  read -1120 r14 r1
+  slt r1 32 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L507:
+  beq r1 r0 .L510
+  read -1120 r14 r5
+  or r0 r5 r6
+  add r14 -988 r4
+  savpc r15
+  add r15 12 r15
+  jump radd
+  read -156 r14 r2
+  read -1120 r14 r1
+  add r1 1 r1
+  write -1120 r14 r1
+  jump .L505
+.L510:
+  read -136 r14 r1
+  load 0 r2
+.L512:
+  write -132 r14 r2
+  bges r2 r1 .L515
+  shiftl r2 2 r2
+  add r14 -1116 r1
+  add r1 r2 r1
+  read 0 r1 r5
+  load 1 r6
+  add r14 -988 r4
+  savpc r15
+  add r15 12 r15
+  jump ralloctry
+  or r0 r1 r3
+  read -132 r14 r2
+  read -136 r14 r1
+  write -1144 r14 r3
+  add r2 1 r2
+  jump .L512
+.L515:
+  read -136 r14 r1
+  load 0 r2
+.L517:
+  write -128 r14 r2
+  bges r2 r1 .L520
+  shiftl r2 2 r2
+  add r14 -1116 r1
+  add r1 r2 r1
+  read 0 r1 r5
+  add r14 -988 r4
+  savpc r15
+  add r15 12 r15
+  jump ralloc
+  or r0 r1 r3
+  read -128 r14 r2
+  read -136 r14 r1
+  write -1140 r14 r3
+  add r2 1 r2
+  jump .L517
+.L520:
+  read -144 r14 r2
+  read -172 r14 r1
+  load 396 r3
+  mults r2 r3 r2
+  add r1 r2 r4
+  add r14 -988 r5
+  savpc r15
+  add r15 12 r15
+  jump rcopy
+  read -156 r14 r2
+  add r14 -988 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump doblk
+  read -156 r14 r2
+  add r2 84 r4
+  add r14 -988 r1
+  add r1 384 r5
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -156 r14 r2
+  read 0 r2 r1
+.L522:
+  write -124 r14 r1
+  beq r1 r0 .L526
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -124 r14 r1
+  read -156 r14 r2
+  bne r3 r0 .L525
+  add r2 84 r4
+  read 0 r1 r1
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+  read -124 r14 r1
+  read -156 r14 r2
+.L525:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L522
+.L526:
+  read -144 r14 r1
+  read -168 r14 r5
+  load 396 r2
+  mults r1 r2 r1
+  add r5 r1 r4
+  add r14 -988 r5
+  savpc r15
+  add r15 12 r15
+  jump rcopy
+  read -148 r14 r2
+  read -168 r14 r5
+  read -172 r14 r1
+  read -176 r14 r8
+  read -164 r14 r4
+  add r2 4 r2
+  jump .L491
+.L529:
+  read -168 r14 r5
+  read -172 r14 r1
+  read -164 r14 r4
+  read 0 r4 r4
+.L531:
+  write -120 r14 r4
+  beq r4 r0 .L595
+  add r4 80 r2
+  read 0 r2 r2
+  load 1 r3
+  ble r2 r3 .L594
+  add r4 48 r1
+  read 0 r1 r1
+  load 396 r2
+  mults r1 r2 r1
+  add r5 r1 r3
+  write -116 r14 r3
+  load 128 r6
+  load 0 r5
+  add r14 -1116 r4
+  savpc r15
+  add r15 12 r15
+  jump memset
+  read -120 r14 r4
+  read 0 r4 r2
+.L534:
+  write -108 r14 r2
+  beq r2 r0 .L555
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r5
+  read -108 r14 r2
+  read -116 r14 r3
+  read -172 r14 r1
+  load 1 r4
+  bne r5 r0 .L537
+  read 0 r2 r1
+  shiftr r1 3 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump rfind
+  or r0 r1 r4
+  read -108 r14 r2
+  read -116 r14 r3
+  read -172 r14 r1
+  write -1120 r14 r4
+  load32 -1 r5
+  xor r4 r5 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L537:
+  bne r4 r0 .L554
+  load 0 r1
+  or r0 r1 r3
+.L540:
+  write -112 r14 r3
+  add r2 12 r1
+  read 0 r1 r1
+  bge r3 r1 .L551
+  add r2 8 r1
+  read 0 r1 r1
+  shiftl r3 2 r4
+  add r1 r4 r1
+  read 0 r1 r5
+  write -100 r14 r5
+  add r2 4 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -104 r14 r1
+  write -196 r14 r1
+  read -196 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r6
+  read -112 r14 r3
+  read -108 r14 r2
+  read -104 r14 r1
+  read -100 r14 r5
+  or r0 r2 r4
+  read -172 r14 r2
+  bne r6 r0 .L549
+  or r0 r5 r3
+  add r3 48 r3
+  read 0 r3 r3
+  load 396 r4
+  mults r3 r4 r3
+  add r2 r3 r4
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump rfind
+  or r0 r1 r4
+  read -112 r14 r3
+  read -108 r14 r2
+  read -172 r14 r1
+  load32 -1 r5
+  beq r4 r5 .L550
+  read -1120 r14 r5
+  shiftl r5 2 r7
+  add r14 -1116 r6
+  add r6 r7 r6
+  read 0 r6 r7
+  load 1 r6
+  beq r7 r0 .L546
+  shiftl r5 2 r7
+  add r14 -1116 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  xor r6 r4 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L546:
+  bne r6 r0 .L548
+  load32 -1 r4
+.L548:
+  shiftl r5 2 r6
+  add r14 -1116 r5
+  add r5 r6 r5
+  write 0 r5 r4
+  jump .L550
+.L549:
+  or r0 r2 r1
+  or r0 r4 r2
+.L550:
+  add r3 1 r3
+  jump .L540
+.L551:
+  read -116 r14 r3
+  read -172 r14 r1
+  read -1120 r14 r4
+  shiftl r4 2 r6
+  add r14 -1116 r5
+  add r5 r6 r5
+  read 0 r5 r5
+  bne r5 r0 .L554
+  shiftl r4 2 r5
+  add r14 -1116 r4
+  add r4 r5 r5
+  load32 -1 r4
+  write 0 r5 r4
+.L554:
+  add r2 20 r2
+  read 0 r2 r2
+  jump .L534
+.L555:
+  read -120 r14 r4
+  read -116 r14 r3
+  read -172 r14 r1
+  load 0 r2
+.L557:
+  write -96 r14 r2
+  add r3 392 r5
+  read 0 r5 r5
+  bges r2 r5 .L576
+  shiftl r2 2 r5
+  add r3 r5 r5
+  read 0 r5 r5
+  write -1124 r14 r5
+  add r3 128 r6
+  shiftl r2 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  write -1120 r14 r6
+  shiftl r6 2 r7
+  add r14 -1116 r6
+  add r6 r7 r6
+  read 0 r6 r7
+  load 1 r6
+  bne r7 r0 .L560
+  slt r5 32 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+  jump .L561
+.L560:
+  or r0 r6 r5
+.L561:
+  bne r5 r0 .L575
+  add r4 76 r2
+  read 0 r2 r3
+.L563:
+  write -92 r14 r3
+  add r4 76 r2
+  read 0 r2 r2
+  add r4 80 r4
+  read 0 r4 r4
+  shiftl r4 2 r4
+  add r2 r4 r2
+  bge r3 r2 .L572
+  or r0 r1 r2
+  read 0 r3 r1
+  add r1 48 r1
+  read 0 r1 r1
+  load 396 r3
+  mults r1 r3 r1
+  add r2 r1 r4
+  read -1124 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump rfind
+  or r0 r1 r4
+  read -92 r14 r3
+  read -120 r14 r1
+  read -172 r14 r2
+  load32 -1 r5
+  beq r4 r5 .L570
+  read -1120 r14 r5
+  shiftl r5 2 r7
+  add r14 -1116 r6
+  add r6 r7 r6
+  read 0 r6 r7
+  load 1 r6
+  beq r7 r0 .L567
+  shiftl r5 2 r7
+  add r14 -1116 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  xor r6 r4 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L567:
+  bne r6 r0 .L569
+  load32 -1 r4
+.L569:
+  shiftl r5 2 r6
+  add r14 -1116 r5
+  add r5 r6 r5
+  write 0 r5 r4
+.L570:
+  add r3 4 r3
+  or r0 r1 r4
+  or r0 r2 r1
+  jump .L563
+.L572:
+  read -96 r14 r2
+  read -120 r14 r4
+  read -116 r14 r3
+  read -1120 r14 r5
+  shiftl r5 2 r7
+  add r14 -1116 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  bne r6 r0 .L575
+  shiftl r5 2 r6
+  add r14 -1116 r5
+  add r5 r6 r6
+  load32 -1 r5
+  write 0 r6 r5
+.L575:
+  add r2 1 r2
+  jump .L557
+.L576:
+  load 0 r1
+  addr2reg npm r12
+  write 0 r12 r1
+  load 0 r1
+.L577:
+  write -88 r14 r1
+  add r3 392 r2
+  read 0 r2 r2
+  bges r1 r2 .L592
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  write -1124 r14 r2
+  add r3 128 r4
+  shiftl r1 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  write -1120 r14 r4
+  shiftl r4 2 r5
+  add r14 -1116 r4
+  add r4 r5 r4
+  read 0 r4 r5
+  write -84 r14 r5
+  load 1 r4
+  bne r5 r0 .L580
+  slt r2 32 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L581
+.L580:
+  or r0 r4 r2
+.L581:
+  bne r2 r0 .L583
+  load 617 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.61 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -88 r14 r1
+  read -84 r14 r5
+  read -116 r14 r3
+.L583:
+  load 0 r2
+  bles r5 r0 .L589
+  add r3 384 r2
+  write -80 r14 r2
+  read 0 r2 r4
+  shiftl r4 5 r4
+  blt r5 r4 .L587
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -88 r14 r1
+  read -80 r14 r2
+  read -84 r14 r5
+  read -116 r14 r3
+.L587:
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r5 5 r4
+  shiftl r4 2 r4
+  add r2 r4 r2
+  read 0 r2 r2
+  and r5 31 r6
+  load 1 r4
+  shiftl r4 r6 r4
+  and r2 r4 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L589:
+  beq r2 r0 .L591
+  shiftl r5 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -188 r14 r1
+  read -1120 r14 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -184 r14 r1
+  addr2reg tmp r12
+  read 0 r12 r1
+  read -1124 r14 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r6
+  read -184 r14 r5
+  read -188 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump pmadd
+  read -88 r14 r1
+  read -84 r14 r5
+  read -116 r14 r3
+  or r0 r1 r2
+  add r3 128 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  add r3 384 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -88 r14 r1
+  read -116 r14 r3
+.L591:
+  add r1 1 r1
+  jump .L577
+.L592:
+  addr2reg insb r12
+  read 0 r12 r1
+  load32 4194304 r2
+  add r1 r2 r1
+  addr2reg curi r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump pmgen
+  read -120 r14 r4
+  read -168 r14 r5
+  read -172 r14 r1
+  addr2reg insb r12
+  read 0 r12 r2
+  load32 4194304 r3
+  add r2 r3 r2
+  addr2reg curi r12
+  read 0 r12 r3
+  sub r2 r3 r2
+  shiftrs r2 31 r3
+  shiftr r3 28 r3
+  add r2 r3 r2
+  shiftrs r2 4 r2
+  write -72 r14 r2
+  beq r2 r0 .L594
+  addr2reg stmov r12
+  read 0 r12 r1
+  add r1 r2 r1
+  addr2reg stmov r12
+  write 0 r12 r1
+  or r0 r2 r1
+  add r4 8 r2
+  read 0 r2 r3
+  add r3 r1 r1
+  write 0 r2 r1
+  shiftl r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r2
+  read -72 r14 r1
+  write -76 r14 r2
+  addr2reg curi r12
+  read 0 r12 r5
+  or r0 r1 r6
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  or r0 r1 r4
+  read -120 r14 r1
+  read -72 r14 r2
+  add r1 4 r3
+  read 0 r3 r5
+  add r1 8 r1
+  read 0 r1 r1
+  sub r1 r2 r6
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  read -120 r14 r4
+  read -76 r14 r2
+  read -168 r14 r5
+  read -172 r14 r1
+  add r4 4 r3
+  write 0 r3 r2
+.L594:
+  add r4 44 r2
+  read 0 r2 r4
+  jump .L531
+.L595:
+  read -164 r14 r4
+  addr2reg debug+82 r12
+  readb 0 r12 r1
+  beq r1 r0 .L603
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.62 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -164 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  or r0 r1 r2
+.L599:
+  write -68 r14 r2
+  add r4 28 r1
+  read 0 r1 r1
+  bge r2 r1 .L602
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.63 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -68 r14 r2
+  read -168 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  load 396 r1
+  mults r2 r1 r1
+  add r5 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mdump
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.64 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -68 r14 r2
+  read -172 r14 r1
+  load32 -24 r3
+  sub r13 r3 r13
+  load 396 r3
+  mults r2 r3 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump mdump
+  read -68 r14 r2
+  read -168 r14 r5
+  read -172 r14 r1
+  read -164 r14 r4
+  add r2 1 r2
+  jump .L599
+.L602:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.38 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -164 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L603:
+  read 0 r4 r3
+  load 0 r1
+  write -64 r14 r1
+.L605:
+  write -40 r14 r3
+  add r3 32 r1
+  read 0 r1 r2
+  load 3 r1
+  add r1 r2 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r5
+  read -40 r14 r3
+  read -172 r14 r1
+  add r3 20 r2
+  read 0 r2 r4
+  load 0 r2
+  beq r4 r0 .L608
+  add r3 20 r2
+  add r5 0 r4
+  write 0 r4 r2
+  load 1 r2
+.L608:
+  add r3 24 r4
+  read 0 r4 r4
+  beq r4 r0 .L610
+  add r3 24 r4
+  or r0 r2 r6
+  add r2 1 r2
+  shiftl r6 2 r6
+  add r5 r6 r6
+  write 0 r6 r4
+.L610:
+  load 0 r4
+.L611:
+  add r3 32 r6
+  read 0 r6 r6
+  bges r4 r6 .L614
+  add r3 28 r6
+  read 0 r6 r6
+  shiftl r4 2 r7
+  add r6 r7 r6
+  or r0 r2 r7
+  add r2 1 r2
+  shiftl r7 2 r7
+  add r5 r7 r7
+  write 0 r7 r6
+  add r4 1 r4
+  jump .L611
+.L614:
+  read -64 r14 r6
+  load 0 r1
+  write -180 r14 r1
+  shiftl r2 2 r1
+  add r5 r1 r2
+  add r14 -180 r1
+  write 0 r2 r1
+  write -56 r14 r6
+.L617:
+  write -60 r14 r5
+  read 0 r5 r1
+  read 0 r1 r4
+  write -52 r14 r4
+  beq r4 r0 .L647
+  load 0 r1
+  addr2reg npm r12
+  write 0 r12 r1
+  read 0 r4 r2
+.L619:
+  write -44 r14 r2
+  beq r2 r0 .L638
+  read 0 r2 r1
+  write -32 r14 r1
+  write -192 r14 r1
+  read -192 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  load 1 r1
+  load 4 r3
+  beq r2 r3 .L622
+  read -192 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L622:
+  bne r1 r0 .L624
+  load 664 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.65 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+.L624:
+  read -192 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r6
+  read -44 r14 r2
+  read -40 r14 r3
+  read -32 r14 r1
+  read -52 r14 r4
+  read -168 r14 r5
+  bne r6 r0 .L628
+  add r4 48 r2
+  read 0 r2 r2
+  load 396 r3
+  mults r2 r3 r2
+  add r5 r2 r4
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump rfind
+  read -44 r14 r2
+  read -40 r14 r3
+  read -52 r14 r4
+  read -168 r14 r5
+  or r0 r1 r6
+  read -172 r14 r1
+  write -1120 r14 r6
+  load32 -1 r7
+  beq r6 r7 .L637
+  or r0 r6 r1
+  shiftl r1 3 r1
+  load32 -8 r4
+  and r1 r4 r1
+  or r1 0 r1
+  write -192 r14 r1
+.L628:
+  or r0 r2 r1
+  load 0 r2
+.L629:
+  write -48 r14 r2
+  add r1 8 r4
+  read 0 r4 r4
+  shiftl r2 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  beq r4 r3 .L633
+  add r2 1 r4
+  add r1 12 r5
+  read 0 r5 r5
+  blt r4 r5 .L632
+  load 672 r6
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.66 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -48 r14 r2
+  read -44 r14 r1
+  read -40 r14 r3
+.L632:
+  add r2 1 r2
+  jump .L629
+.L633:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -36 r14 r1
+  write -196 r14 r1
+  read -196 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r5
+  read -44 r14 r2
+  read -40 r14 r3
+  read -36 r14 r1
+  or r0 r1 r4
+  read -172 r14 r1
+  bne r5 r0 .L636
+  or r0 r1 r2
+  or r0 r4 r1
+  add r3 48 r3
+  read 0 r3 r3
+  load 396 r4
+  mults r3 r4 r3
+  add r2 r3 r4
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump rref
+  read -44 r14 r2
+  write -1136 r14 r1
+  read -1136 r14 r1
+  write -196 r14 r1
+.L636:
+  add r2 16 r1
+  read 0 r1 r6
+  read -192 r14 r5
+  read -196 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump pmadd
+  read -44 r14 r2
+  read -40 r14 r3
+  read -52 r14 r4
+  read -168 r14 r5
+  read -172 r14 r1
+.L637:
+  add r2 20 r2
+  read 0 r2 r2
+  jump .L619
+.L638:
+  read -52 r14 r4
+  load 32 r1
+  write -1124 r14 r1
+.L640:
+  add r4 84 r4
+  add r14 -1124 r5
+  savpc r15
+  add r15 12 r15
+  jump bsiter
+  or r0 r1 r2
+  read -40 r14 r3
+  read -172 r14 r1
+  beq r2 r0 .L643
+  add r3 48 r2
+  read 0 r2 r2
+  load 396 r3
+  mults r2 r3 r2
+  add r1 r2 r4
+  read -1124 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump rref
+  read -52 r14 r4
+  read -168 r14 r5
+  write -1128 r14 r1
+  read -1128 r14 r1
+  write -196 r14 r1
+  add r4 48 r1
+  read 0 r1 r1
+  load 396 r2
+  mults r1 r2 r1
+  add r5 r1 r4
+  read -1124 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump rref
+  write -1132 r14 r1
+  read -1132 r14 r1
+  write -192 r14 r1
+  addr2reg tmp r12
+  read 0 r12 r1
+  read -1124 r14 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r6
+  read -192 r14 r5
+  read -196 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump pmadd
+  read -40 r14 r3
+  read -52 r14 r4
+  read -168 r14 r5
+  read -172 r14 r1
+  read -1124 r14 r2
+  add r2 1 r2
+  write -1124 r14 r2
+  jump .L640
+.L643:
+  addr2reg insb r12
+  read 0 r12 r1
+  load32 4194304 r2
+  add r1 r2 r1
+  addr2reg curi r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump pmgen
+  read -60 r14 r5
+  read -56 r14 r6
+  read -40 r14 r3
+  or r0 r5 r2
+  read -168 r14 r5
+  read -172 r14 r1
+  addr2reg curi r12
+  read 0 r12 r4
+  write -24 r14 r4
+  addr2reg insb r12
+  read 0 r12 r4
+  load32 4194304 r7
+  add r4 r7 r7
+  read -24 r14 r4
+  xor r4 r7 r7
+  sltu r7 1 r7
+  read -164 r14 r4
+  bne r7 r0 .L645
+  savpc r15
+  add r15 12 r15
+  jump newblk
+  or r0 r1 r6
+  read -56 r14 r2
+  read -40 r14 r3
+  read -52 r14 r4
+  read -164 r14 r1
+  write -28 r14 r6
+  add r3 116 r5
+  read 0 r5 r5
+  add r4 116 r7
+  read 0 r7 r7
+  add r5 r7 r5
+  shiftr r5 31 r7
+  add r5 r7 r5
+  shiftrs r5 1 r5
+  add r6 116 r7
+  write 0 r7 r5
+  add r6 44 r5
+  write 0 r5 r2
+  add r1 28 r2
+  read 0 r2 r1
+  add r1 1 r1
+  write 0 r2 r1
+  or r0 r4 r1
+  add r6 124 r4
+  add r3 124 r6
+  add r1 124 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.67 r5
+  savpc r15
+  add r15 12 r15
+  jump strf
+  read -28 r14 r6
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg insb r12
+  read 0 r12 r1
+  load32 4194304 r2
+  add r1 r2 r1
+  addr2reg curi r12
+  read 0 r12 r2
+  sub r1 r2 r1
+  shiftrs r1 31 r2
+  shiftr r2 28 r2
+  add r1 r2 r1
+  shiftrs r1 4 r2
+  add r6 8 r1
+  write 0 r1 r2
+  addr2reg stmov r12
+  read 0 r12 r1
+  add r1 r2 r1
+  addr2reg stmov r12
+  write 0 r12 r1
+  addr2reg stblk r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg stblk r12
+  write 0 r12 r1
+  add r6 4 r4
+  addr2reg curi r12
+  read 0 r12 r5
+  add r6 8 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump idup
+  read -40 r14 r3
+  read -28 r14 r6
+  read -52 r14 r4
+  read -168 r14 r5
+  read -172 r14 r1
+  add r6 12 r7
+  load 11 r2
+  writeh 0 r7 r2
+  read -60 r14 r2
+  add r6 20 r7
+  write 0 r7 r4
+  read -164 r14 r4
+  read 0 r2 r7
+  write 0 r7 r6
+.L645:
+  add r2 4 r2
+  or r0 r2 r5
+  write -56 r14 r6
+  jump .L617
+.L647:
+  read -56 r14 r6
+  read -40 r14 r3
+  read -168 r14 r5
+  read -172 r14 r1
+  read -164 r14 r4
+  add r3 44 r2
+  read 0 r2 r2
+  beq r2 r0 .L651
+  or r0 r2 r3
+  write -64 r14 r6
+  jump .L605
+.L651:
+  add r3 44 r1
+  write 0 r1 r6
+  read 0 r4 r1
+.L653:
+  beq r1 r0 .L656
+  load 0 r2
+  write 0 r1 r2
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L653
+.L656:
+  addr2reg regu r12
+  read 0 r12 r1
+  add r4 44 r2
+  write 0 r2 r1
+  addr2reg debug+82 r12
+  readb 0 r12 r1
+  beq r1 r0 .L658
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.68 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg stmov r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.69 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg stblk r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.70 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.71 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -164 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+.L658:
+  read -1148 r14 r8
+  read -1152 r14 r9
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rega */
+
+.data
+.balign 4
+regu:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+tmp:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+mem:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+pm:
+	.fill 384,1,0
+/* end data */
+
+.data
+.balign 4
+npm:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+loop:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+stmov:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+stblk:
+	.fill 4,1,0
+/* end data */
+
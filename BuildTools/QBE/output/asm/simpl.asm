@@ -0,0 +1,617 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "blt\000"
+/* end data */
+
+
+.text
+; function blit
+blit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 140 r13
+  write -132 r14 r8
+  write -20 r14 r6
+  write -28 r14 r4
+  or r0 r5 r4
+  load 56 r1
+  write -112 r14 r1
+  add r14 -112 r1
+  add r1 4 r2
+  load 65 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 8 r2
+  load 1 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 12 r2
+  load 8 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 16 r2
+  load 55 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 20 r2
+  load 65 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 24 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 28 r2
+  load 4 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 32 r2
+  load 54 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 36 r2
+  load 62 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 40 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 44 r2
+  load 2 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 48 r2
+  load 53 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 52 r2
+  load 60 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 56 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -112 r1
+  add r1 60 r2
+  load 1 r1
+  write 0 r2 r1
+  addr2reg T+36 r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  write -32 r14 r1
+  slt r4 r0 r1
+  xor r1 1 r3
+  write -4 r14 r3
+  savpc r15
+  add r15 12 r15
+  jump abs
+  or r0 r1 r2
+  read -4 r14 r3
+  read -32 r14 r1
+  read -20 r14 r6
+  bne r3 r0 .L19
+  load 0 r4
+  jump .L20
+.L19:
+  or r0 r2 r4
+.L20:
+  add r14 -112 r5
+  or r0 r5 r7
+  or r0 r4 r5
+.L22:
+  write -16 r14 r7
+  beq r2 r0 .L39
+  or r0 r1 r4
+  add r7 12 r1
+  read 0 r1 r1
+  write -24 r14 r1
+.L24:
+  write -12 r14 r2
+  blts r2 r1 .L37
+  load 0 r2
+  beq r4 r0 .L27
+  xor r1 8 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L27:
+  bne r2 r0 .L36
+  bne r3 r0 .L30
+  load 0 r1
+.L30:
+  sub r5 r1 r8
+  write -8 r14 r8
+  addr2reg T+36 r12
+  read 0 r12 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -20 r14 r6
+  write -116 r14 r1
+  read -116 r14 r1
+  write -48 r14 r1
+  addr2reg T+36 r12
+  read 0 r12 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -8 r14 r8
+  read -20 r14 r6
+  write -120 r14 r1
+  read -120 r14 r1
+  write -44 r14 r1
+  or r0 r6 r5
+  or r0 r8 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  read -16 r14 r2
+  write -124 r14 r1
+  read -124 r14 r1
+  write -40 r14 r1
+  read 0 r2 r4
+  load 0 r1
+  write -36 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -44 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -48 r14 r7
+  read -36 r14 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -28 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  addr2reg T+36 r12
+  read 0 r12 r5
+  add r4 4 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -40 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -44 r14 r6
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -20 r14 r6
+  load32 -12 r1
+  sub r13 r1 r13
+  addr2reg T+36 r12
+  read 0 r12 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -16 r14 r2
+  write -128 r14 r1
+  read -128 r14 r1
+  write -44 r14 r1
+  add r2 4 r1
+  read 0 r1 r4
+  add r2 8 r1
+  read 0 r1 r5
+  load 0 r1
+  write -36 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -36 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -48 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -28 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  addr2reg T+36 r12
+  read 0 r12 r5
+  add r4 0 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -40 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -44 r14 r6
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -12 r14 r5
+  read -16 r14 r2
+  read -8 r14 r8
+  read -24 r14 r1
+  read -4 r14 r3
+  read -20 r14 r6
+  load32 -12 r4
+  sub r13 r4 r13
+  bne r3 r0 .L32
+  or r0 r1 r4
+  jump .L33
+.L32:
+  load 0 r4
+.L33:
+  or r0 r5 r7
+  add r8 r4 r5
+  read -28 r14 r4
+  sub r7 r1 r7
+  read -32 r14 r4
+  or r0 r7 r2
+  jump .L24
+.L36:
+  read -12 r14 r2
+  read -16 r14 r7
+  read -32 r14 r1
+  read -28 r14 r4
+  jump .L38
+.L37:
+  read -12 r14 r2
+  read -16 r14 r7
+  or r0 r4 r1
+  read -28 r14 r4
+.L38:
+  add r7 16 r7
+  jump .L22
+.L39:
+  read -132 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function blit */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "i > b->ins\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "BuildTools/QBE/simpl.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "(i-1)->op == Oblit0\000"
+/* end data */
+
+
+.text
+; function ins
+ins:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  write -24 r14 r7
+  write -12 r14 r6
+  write -16 r14 r5
+  write -28 r14 r4
+  read 0 r4 r1
+  write -32 r14 r1
+  read 0 r1 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 93 r3
+  beq r2 r3 .L47
+  load 93 r3
+  sltu r2 r3 r2
+  read 0 r5 r2
+  beq r2 r0 .L54
+  add r14 -48 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -48 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -48 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r2
+  read 0 r2 r2
+  add r14 -48 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r1
+  add r14 -48 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump emiti
+  jump .L54
+.L47:
+  add r6 4 r2
+  read 0 r2 r2
+  bgt r1 r2 .L49
+  load 53 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r1
+  read -12 r14 r6
+  read -16 r14 r5
+.L49:
+  load 16 r2
+  sub r1 r2 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 92 r3
+  beq r2 r3 .L51
+  load 54 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r1
+  read -12 r14 r6
+  read -16 r14 r5
+.L51:
+  read 0 r5 r2
+  bne r2 r0 .L53
+  addr2reg insb r12
+  read 0 r12 r2
+  load32 4194304 r3
+  add r2 r3 r2
+  addr2reg curi r12
+  write 0 r12 r2
+  add r6 4 r3
+  read 0 r3 r3
+  add r6 8 r4
+  read 0 r4 r4
+  shiftl r4 4 r4
+  add r3 r4 r3
+  add r1 16 r4
+  sub r3 r4 r3
+  shiftrs r3 31 r4
+  shiftr r4 28 r4
+  add r3 r4 r3
+  shiftrs r3 4 r6
+  shiftl r6 4 r3
+  sub r2 r3 r4
+  addr2reg curi r12
+  write 0 r12 r4
+  add r1 16 r5
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  read -32 r14 r1
+  read -16 r14 r5
+  load 1 r2
+  write 0 r5 r2
+.L53:
+  load 16 r2
+  sub r1 r2 r2
+  add r2 8 r4
+  write -20 r14 r4
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  or r0 r1 r5
+  read -20 r14 r4
+  read -24 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump blit
+  read -32 r14 r1
+  read -28 r14 r4
+  load 16 r2
+  sub r1 r2 r1
+  write 0 r4 r1
+.L54:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ins */
+
+
+.text
+; function simpl
+.global simpl
+simpl:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  write -12 r14 r4
+  read 0 r4 r1
+.L58:
+  write -16 r14 r1
+  beq r1 r0 .L65
+  load 0 r2
+  write -20 r14 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r1 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r2
+  write -24 r14 r2
+.L60:
+  read -24 r14 r2
+  add r1 4 r3
+  read 0 r3 r3
+  beq r2 r3 .L62
+  load 16 r3
+  sub r2 r3 r2
+  write -24 r14 r2
+  or r0 r4 r7
+  or r0 r1 r6
+  add r14 -20 r5
+  add r14 -24 r4
+  savpc r15
+  add r15 12 r15
+  jump ins
+  read -16 r14 r1
+  read -12 r14 r4
+  jump .L60
+.L62:
+  read -20 r14 r2
+  beq r2 r0 .L64
+  addr2reg insb r12
+  read 0 r12 r2
+  load32 4194304 r3
+  add r2 r3 r2
+  addr2reg curi r12
+  read 0 r12 r3
+  sub r2 r3 r2
+  shiftrs r2 31 r3
+  shiftr r3 28 r3
+  add r2 r3 r2
+  shiftrs r2 4 r6
+  add r1 8 r2
+  write 0 r2 r6
+  add r1 4 r4
+  addr2reg curi r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump idup
+  read -16 r14 r1
+  read -12 r14 r4
+.L64:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L58
+.L65:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function simpl */
+
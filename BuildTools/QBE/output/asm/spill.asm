@@ -0,0 +1,3293 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+
+.text
+; function aggreg
+aggreg:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  add r4 100 r4
+  add r5 100 r5
+  savpc r15
+  add r15 12 r15
+  jump bsunion
+  read -12 r14 r5
+  read -16 r14 r4
+  load 0 r1
+.L18:
+  load 2 r2
+  bges r1 r2 .L22
+  add r5 108 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r4 108 r3
+  shiftl r1 2 r6
+  add r3 r6 r3
+  read 0 r3 r3
+  bles r2 r3 .L21
+  add r5 108 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r4 108 r3
+  shiftl r1 2 r6
+  add r3 r6 r3
+  write 0 r3 r2
+.L21:
+  add r1 1 r1
+  jump .L18
+.L22:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function aggreg */
+
+
+.text
+; function tmpuse
+tmpuse:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r7
+  write -12 r14 r6
+  write -4 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r7
+  read -12 r14 r6
+  load 6 r2
+  beq r1 r2 .L30
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -16 r14 r7
+  read -12 r14 r6
+  read -4 r14 r5
+  load 0 r1
+  bne r2 r0 .L28
+  read -20 r14 r1
+  shiftr r1 3 r1
+  slt r1 32 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L28:
+  beq r1 r0 .L31
+  add r7 4 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 92 r3
+  read 0 r3 r2
+  add r2 r5 r2
+  write 0 r3 r2
+  add r1 88 r3
+  read 0 r3 r2
+  xor r5 0 r4
+  sltu r4 1 r4
+  add r2 r4 r2
+  write 0 r3 r2
+  add r1 100 r2
+  read 0 r2 r1
+  add r1 r6 r1
+  write 0 r2 r1
+  jump .L31
+.L30:
+  add r7 12 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  load 48 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  write -8 r14 r1
+  add r1 32 r1
+  load 1 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmpuse
+  read -8 r14 r1
+  read -16 r14 r7
+  read -12 r14 r6
+  add r1 36 r1
+  load 1 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmpuse
+.L31:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function tmpuse */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "\012> Loop information:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "\011%-10s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii " (% 3d \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "% 3d) \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "\012> Spill costs:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "\011%-10s %d\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "\012\000"
+/* end data */
+
+
+.text
+; function fillcost
+.global fillcost
+fillcost:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  write -48 r14 r4
+  addr2reg aggreg r5
+  savpc r15
+  add r15 12 r15
+  jump loopiter
+  read -48 r14 r4
+  addr2reg debug+83 r12
+  readb 0 r12 r1
+  beq r1 r0 .L44
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -48 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  read 0 r4 r1
+.L36:
+  write -44 r14 r1
+  beq r1 r0 .L44
+  load 0 r2
+.L38:
+  add r1 80 r3
+  read 0 r3 r3
+  bge r2 r3 .L41
+  add r1 48 r5
+  read 0 r5 r5
+  add r1 76 r6
+  read 0 r6 r6
+  shiftl r2 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  ble r5 r6 .L41
+  add r2 1 r2
+  jump .L38
+.L41:
+  beq r2 r3 .L43
+  add r1 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.11 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -44 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 108 r1
+  add r1 0 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.12 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -44 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 108 r1
+  add r1 4 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.13 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -44 r14 r1
+  read -48 r14 r4
+  or r0 r1 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r4 r1
+  add r2 100 r4
+  add r1 4 r1
+  read 0 r1 r5
+  addr2reg __stderr_file r6
+  savpc r15
+  add r15 12 r15
+  jump dumpts
+  read -44 r14 r1
+  read -48 r14 r4
+.L43:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L36
+.L44:
+  add r4 4 r1
+  read 0 r1 r1
+.L45:
+  add r4 4 r2
+  read 0 r2 r2
+  sub r1 r2 r5
+  load32 1717986919 r3
+  mulshi r5 r3 r3
+  shiftrs r3 6 r3
+  shiftr r5 31 r5
+  add r3 r5 r3
+  add r4 16 r5
+  read 0 r5 r5
+  bges r3 r5 .L51
+  sub r1 r2 r3
+  load32 1717986919 r2
+  mulshi r3 r2 r2
+  shiftrs r2 6 r2
+  shiftr r3 31 r3
+  add r2 r3 r2
+  load 32 r3
+  blts r2 r3 .L48
+  load 0 r2
+  jump .L49
+.L48:
+  load32 -1 r2
+.L49:
+  add r1 100 r3
+  write 0 r3 r2
+  add r1 92 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 88 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 160 r1
+  jump .L45
+.L51:
+  read 0 r4 r2
+.L52:
+  write -40 r14 r2
+  beq r2 r0 .L69
+  read 0 r2 r1
+.L54:
+  write -32 r14 r1
+  beq r1 r0 .L60
+  add r4 4 r2
+  read 0 r2 r2
+  read 0 r1 r3
+  shiftr r3 3 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r2 r3 r3
+  write -28 r14 r3
+  or r0 r4 r7
+  load 0 r6
+  load 0 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmpuse
+  read -32 r14 r1
+  read -28 r14 r3
+  read -48 r14 r4
+  load 0 r2
+.L56:
+  write -36 r14 r2
+  add r1 12 r5
+  read 0 r5 r5
+  bge r2 r5 .L59
+  add r1 8 r5
+  read 0 r5 r5
+  shiftl r2 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  add r5 116 r5
+  read 0 r5 r6
+  add r3 100 r5
+  read 0 r5 r3
+  add r3 r6 r3
+  write 0 r5 r3
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  or r0 r4 r7
+  load 1 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmpuse
+  read -36 r14 r2
+  read -32 r14 r1
+  read -28 r14 r3
+  read -48 r14 r4
+  add r2 1 r2
+  jump .L56
+.L59:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L54
+.L60:
+  read -40 r14 r2
+  add r2 116 r1
+  read 0 r1 r6
+  write -20 r14 r6
+  add r2 4 r1
+  read 0 r1 r3
+  or r0 r6 r1
+.L63:
+  write -24 r14 r3
+  or r0 r2 r5
+  add r2 4 r2
+  read 0 r2 r2
+  add r5 8 r5
+  read 0 r5 r5
+  shiftl r5 4 r5
+  add r2 r5 r2
+  bge r3 r2 .L66
+  or r0 r1 r2
+  add r3 4 r1
+  or r0 r4 r7
+  or r0 r2 r6
+  load 0 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmpuse
+  read -24 r14 r3
+  read -20 r14 r1
+  read -48 r14 r4
+  or r0 r1 r2
+  add r3 8 r1
+  add r1 0 r1
+  or r0 r4 r7
+  or r0 r2 r6
+  load 1 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmpuse
+  read -24 r14 r3
+  read -20 r14 r1
+  read -48 r14 r4
+  or r0 r1 r2
+  add r3 8 r1
+  add r1 4 r1
+  or r0 r4 r7
+  or r0 r2 r6
+  load 1 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmpuse
+  read -24 r14 r3
+  read -40 r14 r2
+  read -20 r14 r1
+  read -48 r14 r4
+  add r3 16 r3
+  jump .L63
+.L66:
+  read -40 r14 r2
+  or r0 r1 r6
+  add r2 12 r1
+  add r1 4 r1
+  or r0 r4 r7
+  load 1 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmpuse
+  read -40 r14 r2
+  read -48 r14 r4
+  add r2 44 r1
+  read 0 r1 r2
+  jump .L52
+.L69:
+  addr2reg debug+83 r12
+  readb 0 r12 r1
+  beq r1 r0 .L75
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.14 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -48 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 32 r1
+.L71:
+  write -16 r14 r1
+  add r4 16 r2
+  read 0 r2 r2
+  bges r1 r2 .L74
+  or r0 r1 r2
+  add r4 4 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r2 r3 r3
+  add r1 r3 r6
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 100 r1
+  read 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.15 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r1
+  read -48 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 1 r1
+  jump .L71
+.L74:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.16 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+.L75:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function fillcost */
+
+
+.text
+; function tcmp0
+tcmp0:
+  addr2reg tmp r12
+  read 0 r12 r2
+  read 0 r4 r1
+  load 160 r3
+  mults r1 r3 r1
+  add r2 r1 r1
+  add r1 100 r1
+  read 0 r1 r1
+  read 0 r5 r3
+  load 160 r4
+  mults r3 r4 r3
+  add r2 r3 r2
+  add r2 100 r2
+  read 0 r2 r2
+  blt r2 r1 .L80
+  sltu r1 r2 r1
+  jump .L81
+.L80:
+  load32 -1 r1
+.L81:
+  jumpr 0 r15
+
+/* end function tcmp0 */
+
+
+.text
+; function tcmp1
+tcmp1:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -24 r14 r5
+  write -28 r14 r4
+  addr2reg fst r12
+  read 0 r12 r1
+  write -8 r14 r1
+  read 0 r5 r2
+  write -12 r14 r2
+  read 0 r1 r3
+  shiftl r3 5 r3
+  blt r2 r3 .L87
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r2
+  read -8 r14 r1
+  read -24 r14 r5
+  read -28 r14 r4
+.L87:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r2 5 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  and r2 31 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  write -16 r14 r1
+  addr2reg fst r12
+  read 0 r12 r2
+  write -20 r14 r2
+  read 0 r4 r3
+  write -32 r14 r3
+  read 0 r2 r6
+  shiftl r6 5 r6
+  blt r3 r6 .L91
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+  read -32 r14 r3
+  read -20 r14 r2
+  read -24 r14 r5
+  read -28 r14 r4
+.L91:
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r3 5 r6
+  shiftl r6 2 r6
+  add r2 r6 r2
+  read 0 r2 r2
+  and r3 31 r6
+  load 1 r3
+  shiftl r3 r6 r3
+  and r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  sub r1 r2 r1
+  bne r1 r0 .L94
+  savpc r15
+  add r15 12 r15
+  jump tcmp0
+.L94:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function tcmp1 */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "cannot spill register\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "t >= Tmp0 && \042cannot spill register\042\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "BuildTools/QBE/spill.c\000"
+/* end data */
+
+
+.text
+; function slot
+slot:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r4
+  load 0 r1
+  load 32 r2
+  blts r4 r2 .L99
+  addr2reg .Lstring.20 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L99:
+  bne r1 r0 .L101
+  load 129 r6
+  addr2reg .Lstring.22 r5
+  addr2reg .Lstring.21 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r4
+.L101:
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r2
+  mults r4 r2 r2
+  add r1 r2 r2
+  add r2 104 r2
+  read 0 r2 r2
+  load32 -1 r3
+  beq r2 r3 .L103
+  or r0 r2 r1
+  jump .L111
+.L103:
+  load 160 r2
+  mults r4 r2 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r1
+  and r1 1 r1
+  bne r1 r0 .L107
+  addr2reg slot4 r12
+  read 0 r12 r1
+  addr2reg slot8 r12
+  read 0 r12 r2
+  beq r1 r2 .L106
+  addr2reg slot4 r12
+  write 0 r12 r2
+  jump .L110
+.L106:
+  add r2 2 r2
+  addr2reg slot8 r12
+  write 0 r12 r2
+  addr2reg slot4 r12
+  read 0 r12 r2
+  add r2 1 r2
+  addr2reg slot4 r12
+  write 0 r12 r2
+  jump .L110
+.L107:
+  addr2reg slot8 r12
+  read 0 r12 r1
+  addr2reg slot4 r12
+  read 0 r12 r2
+  bne r2 r1 .L109
+  add r2 2 r2
+  addr2reg slot4 r12
+  write 0 r12 r2
+.L109:
+  addr2reg slot8 r12
+  read 0 r12 r2
+  add r2 2 r2
+  addr2reg slot8 r12
+  write 0 r12 r2
+.L110:
+  addr2reg locs r12
+  read 0 r12 r2
+  add r1 r2 r1
+  addr2reg tmp r12
+  read 0 r12 r2
+  load 160 r3
+  mults r4 r3 r3
+  add r2 r3 r2
+  add r2 104 r2
+  write 0 r2 r1
+.L111:
+  load32 536870911 r2
+  and r1 r2 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 4 r1
+  write -20 r14 r1
+  read -20 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function slot */
+
+.data
+.balign 4
+.Ltarr.24:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+.Lmaxt.25:
+	.fill 4,1,0
+/* end data */
+
+
+.text
+; function limit
+limit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 48 r13
+  write -24 r14 r6
+  write -28 r14 r5
+  write -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump bscount
+  or r0 r1 r2
+  read -28 r14 r5
+  read -20 r14 r4
+  write -32 r14 r2
+  bles r2 r5 .L149
+  addr2reg .Lmaxt.25 r12
+  read 0 r12 r1
+  bles r2 r1 .L118
+  addr2reg .Ltarr.24 r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -32 r14 r2
+  shiftl r2 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  read -32 r14 r2
+  read -20 r14 r4
+  addr2reg .Ltarr.24 r12
+  write 0 r12 r1
+  addr2reg .Lmaxt.25 r12
+  write 0 r12 r2
+.L118:
+  load 0 r1
+  write -36 r14 r1
+  load 0 r1
+  write -16 r14 r1
+.L120:
+  add r14 -36 r5
+  savpc r15
+  add r15 12 r15
+  jump bsiter
+  read -20 r14 r4
+  beq r1 r0 .L124
+  read -36 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+  read -16 r14 r1
+  read -20 r14 r4
+  read -36 r14 r2
+  addr2reg .Ltarr.24 r12
+  read 0 r12 r3
+  or r0 r1 r5
+  add r1 1 r1
+  shiftl r5 2 r5
+  add r3 r5 r3
+  write 0 r3 r2
+  read -36 r14 r2
+  add r2 1 r2
+  write -36 r14 r2
+  write -16 r14 r1
+  jump .L120
+.L124:
+  read -32 r14 r2
+  read -24 r14 r6
+  read -28 r14 r5
+  load 1 r1
+  bles r2 r1 .L129
+  beq r6 r0 .L128
+  addr2reg fst r12
+  write 0 r12 r6
+  addr2reg .Ltarr.24 r12
+  read 0 r12 r4
+  addr2reg tcmp1 r7
+  load 4 r6
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump qsort
+  read -32 r14 r2
+  read -28 r14 r5
+  read -20 r14 r4
+  jump .L129
+.L128:
+  addr2reg .Ltarr.24 r12
+  read 0 r12 r4
+  addr2reg tcmp0 r7
+  load 4 r6
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump qsort
+  read -32 r14 r2
+  read -28 r14 r5
+  read -20 r14 r4
+.L129:
+  or r0 r5 r1
+  load 0 r5
+  load 0 r3
+  or r0 r5 r12
+  or r0 r3 r5
+  or r0 r12 r3
+.L131:
+  load 0 r6
+  bges r3 r2 .L133
+  addr2reg .Ltarr.24 r12
+  read 0 r12 r6
+  shiftl r3 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  slt r6 32 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L133:
+  beq r6 r0 .L136
+  add r5 1 r5
+  add r3 1 r3
+  jump .L131
+.L136:
+  blts r1 r5 .L138
+  or r0 r1 r5
+.L138:
+  write -8 r14 r5
+  load 0 r1
+.L139:
+  write -12 r14 r1
+  load 0 r3
+  blts r1 r5 .L141
+  or r0 r3 r2
+  jump .L142
+.L141:
+  slt r1 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L142:
+  beq r2 r0 .L145
+  or r0 r1 r2
+  addr2reg .Ltarr.24 r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -12 r14 r1
+  read -8 r14 r5
+  read -32 r14 r2
+  read -20 r14 r4
+  add r1 1 r1
+  jump .L139
+.L145:
+  read -32 r14 r2
+.L146:
+  write -4 r14 r1
+  bges r1 r2 .L149
+  or r0 r1 r2
+  addr2reg .Ltarr.24 r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r3
+  read -4 r14 r1
+  read -32 r14 r2
+  write -40 r14 r3
+  add r1 1 r1
+  jump .L146
+.L149:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function limit */
+
+
+.text
+; function limit2
+limit2:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  write -12 r14 r7
+  write -8 r14 r6
+  write -4 r14 r5
+  write -16 r14 r4
+  addr2reg ntmp r12
+  read 0 r12 r5
+  add r14 -24 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -16 r14 r4
+  or r0 r4 r5
+  add r14 -24 r4
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -16 r14 r4
+  addr2reg mask r5
+  savpc r15
+  add r15 12 r15
+  jump bsinter
+  addr2reg mask+8 r5
+  add r14 -24 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinter
+  read -12 r14 r6
+  read -4 r14 r5
+  read -16 r14 r4
+  addr2reg T+24 r12
+  read 0 r12 r1
+  sub r1 r5 r5
+  savpc r15
+  add r15 12 r15
+  jump limit
+  read -12 r14 r6
+  read -8 r14 r1
+  addr2reg T+32 r12
+  read 0 r12 r2
+  sub r2 r1 r5
+  add r14 -24 r4
+  savpc r15
+  add r15 12 r15
+  jump limit
+  read -16 r14 r4
+  add r14 -24 r5
+  savpc r15
+  add r15 12 r15
+  jump bsunion
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function limit2 */
+
+
+.text
+; function sethint
+sethint:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -8 r14 r5
+  write -12 r14 r4
+  load 32 r1
+  write -20 r14 r1
+.L157:
+  add r14 -20 r5
+  savpc r15
+  add r15 12 r15
+  jump bsiter
+  beq r1 r0 .L160
+  addr2reg tmp r12
+  read 0 r12 r1
+  write -16 r14 r1
+  read -20 r14 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump phicls
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 112 r1
+  add r1 8 r2
+  read 0 r2 r1
+  or r1 r5 r1
+  write 0 r2 r1
+  read -20 r14 r1
+  add r1 1 r1
+  write -20 r14 r1
+  jump .L157
+.L160:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function sethint */
+
+
+.text
+; function reloads
+reloads:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -16 r14 r5
+  write -12 r14 r4
+  load 32 r1
+  write -28 r14 r1
+.L164:
+  add r14 -28 r5
+  savpc r15
+  add r15 12 r15
+  jump bsiter
+  read -16 r14 r5
+  read -12 r14 r4
+  beq r1 r0 .L172
+  read -28 r14 r2
+  write -4 r14 r2
+  read 0 r5 r1
+  shiftl r1 5 r1
+  blt r2 r1 .L168
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -4 r14 r2
+  read -16 r14 r5
+  read -12 r14 r4
+.L168:
+  add r5 4 r1
+  read 0 r1 r1
+  shiftr r2 5 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  and r2 31 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  bne r1 r0 .L171
+  addr2reg tmp r12
+  read 0 r12 r1
+  read -28 r14 r4
+  load 160 r2
+  mults r4 r2 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r5
+  write -8 r14 r5
+  shiftl r4 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -24 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump slot
+  read -8 r14 r5
+  write -32 r14 r1
+  load 0 r1
+  write -20 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -20 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -32 r14 r7
+  read -24 r14 r6
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r5
+  read -12 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+.L171:
+  read -28 r14 r1
+  add r1 1 r1
+  write -28 r14 r1
+  jump .L164
+.L172:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function reloads */
+
+
+.text
+; function store
+store:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 20 r13
+  add r14 -12 r1
+  write 0 r1 r4
+  load32 -1 r1
+  beq r5 r1 .L177
+  addr2reg tmp r12
+  read 0 r12 r1
+  read -12 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r2
+  load 55 r1
+  add r1 r2 r4
+  load 0 r1
+  write -8 r14 r1
+  load32 536870911 r1
+  and r5 r1 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 4 r1
+  write -4 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -4 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -12 r14 r7
+  read -8 r14 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump emit
+  load32 -12 r1
+  sub r13 r1 r13
+.L177:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function store */
+
+
+.text
+; function regcpy
+regcpy:
+  read 0 r4 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r2
+  load 0 r1
+  load 88 r3
+  bne r2 r3 .L183
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  add r4 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L182:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L183:
+  jumpr 0 r15
+
+/* end function regcpy */
+
+
+.text
+; function dopm
+dopm:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 84 r13
+  write -36 r14 r6
+  write -4 r14 r5
+  write -12 r14 r4
+  addr2reg ntmp r12
+  read 0 r12 r5
+  add r14 -60 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -4 r14 r5
+  add r5 16 r2
+  write -40 r14 r2
+  or r0 r2 r1
+.L187:
+  load 16 r2
+  sub r1 r2 r1
+  write -48 r14 r1
+  add r1 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r3
+  write -8 r14 r3
+  add r1 4 r1
+  load 0 r2
+  write -52 r14 r2
+  read -52 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -8 r14 r3
+  read -48 r14 r1
+  read -36 r14 r6
+  bne r2 r0 .L193
+  read 0 r6 r2
+  shiftl r2 5 r2
+  blt r3 r2 .L190
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -8 r14 r3
+  read -48 r14 r1
+  read -36 r14 r6
+.L190:
+  add r6 4 r2
+  read 0 r2 r2
+  shiftr r3 5 r4
+  shiftl r4 2 r4
+  add r2 r4 r2
+  read 0 r2 r2
+  and r3 31 r5
+  load 1 r4
+  shiftl r4 r5 r4
+  and r2 r4 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  beq r2 r0 .L193
+  or r0 r3 r5
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+  read -8 r14 r3
+  read -48 r14 r1
+  add r1 4 r1
+  addr2reg tmp r12
+  read 0 r12 r2
+  load 160 r4
+  mults r3 r4 r3
+  add r2 r3 r2
+  add r2 104 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump store
+  read -48 r14 r1
+  read -36 r14 r6
+.L193:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -48 r14 r1
+  read -36 r14 r6
+  read -12 r14 r4
+  add r4 4 r2
+  read 0 r2 r3
+  load 0 r2
+  beq r1 r3 .L196
+  load 16 r2
+  sub r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump regcpy
+  or r0 r1 r2
+  read -48 r14 r1
+  read -36 r14 r6
+  read -12 r14 r4
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L196:
+  bne r2 r0 .L187
+  or r0 r6 r5
+  add r14 -60 r4
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -48 r14 r1
+  read -36 r14 r5
+  read -12 r14 r4
+  add r4 4 r2
+  read 0 r2 r3
+  load 0 r2
+  beq r1 r3 .L200
+  load 16 r2
+  sub r1 r2 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  xor r2 124 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L200:
+  bne r2 r0 .L203
+  load 0 r7
+  load 0 r6
+  or r0 r5 r1
+  load 0 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump limit2
+  read -36 r14 r5
+  add r5 4 r1
+  read 0 r1 r1
+  add r1 0 r1
+  read 0 r1 r1
+  or r0 r5 r12
+  or r0 r1 r5
+  or r0 r12 r1
+  jump .L211
+.L203:
+  add r5 4 r2
+  read 0 r2 r2
+  add r2 0 r2
+  write -20 r14 r2
+  read 0 r2 r2
+  write -16 r14 r2
+  load 16 r2
+  sub r1 r2 r1
+  add r1 8 r1
+  add r1 4 r2
+  addr2reg T+60 r12
+  read 0 r12 r1
+  load 0 r5
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  or r0 r1 r3
+  read -16 r14 r1
+  read -20 r14 r2
+  read -36 r14 r5
+  xor r3 -1 r3
+  and r1 r3 r1
+  write 0 r2 r1
+  or r0 r5 r1
+  addr2reg T+52 r12
+  read 0 r12 r5
+  addr2reg T+56 r12
+  read 0 r12 r6
+  load 0 r7
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump limit2
+  read -48 r14 r1
+  read -40 r14 r2
+  read -36 r14 r5
+  load 0 r4
+  load 0 r3
+  or r0 r5 r6
+  or r0 r2 r5
+  or r0 r3 r2
+  or r0 r4 r3
+.L205:
+  write -32 r14 r2
+  addr2reg T+48 r12
+  read 0 r12 r4
+  shiftl r3 2 r7
+  add r4 r7 r7
+  read 0 r7 r7
+  blts r7 r0 .L208
+  shiftl r3 2 r7
+  add r4 r7 r4
+  read 0 r4 r7
+  load 1 r4
+  shiftl r4 r7 r4
+  or r2 r4 r2
+  add r3 1 r3
+  jump .L205
+.L208:
+  or r0 r6 r5
+  add r5 4 r2
+  read 0 r2 r2
+  add r2 0 r4
+  write -28 r14 r4
+  read 0 r4 r3
+  write -24 r14 r3
+  load 16 r2
+  sub r1 r2 r1
+  add r1 8 r1
+  add r1 4 r2
+  addr2reg T+64 r12
+  read 0 r12 r1
+  load 0 r5
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  or r0 r1 r5
+  read -32 r14 r2
+  read -24 r14 r3
+  read -28 r14 r4
+  read -36 r14 r1
+  or r3 r5 r3
+  write 0 r4 r3
+  or r0 r2 r5
+.L211:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sethint
+  read -36 r14 r5
+  add r14 -60 r4
+  savpc r15
+  add r15 12 r15
+  jump reloads
+  read -40 r14 r5
+  or r0 r5 r1
+.L213:
+  load 16 r2
+  sub r1 r2 r1
+  write -44 r14 r1
+  add r14 -76 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -76 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -76 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r2
+  read 0 r2 r2
+  add r14 -76 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r1
+  add r14 -76 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump emiti
+  read -44 r14 r1
+  or r0 r1 r2
+  read -48 r14 r1
+  beq r2 r1 .L216
+  or r0 r2 r1
+  jump .L213
+.L216:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function dopm */
+
+
+.text
+; function merge
+merge:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  or r0 r5 r1
+  or r0 r6 r5
+  write -12 r14 r5
+  write -16 r14 r4
+  add r1 116 r1
+  read 0 r1 r1
+  add r7 116 r2
+  read 0 r2 r2
+  bles r1 r2 .L226
+  load 0 r1
+  write -20 r14 r1
+  or r0 r5 r6
+.L222:
+  add r14 -20 r5
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump bsiter
+  read -12 r14 r6
+  read -16 r14 r4
+  beq r1 r0 .L227
+  addr2reg tmp r12
+  read 0 r12 r1
+  read -20 r14 r5
+  load 160 r2
+  mults r5 r2 r2
+  add r1 r2 r1
+  add r1 104 r1
+  read 0 r1 r1
+  load32 -1 r2
+  bne r1 r2 .L225
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -12 r14 r6
+  read -16 r14 r4
+.L225:
+  read -20 r14 r1
+  add r1 1 r1
+  write -20 r14 r1
+  jump .L222
+.L226:
+  savpc r15
+  add r15 12 r15
+  jump bsunion
+.L227:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function merge */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "KBASE(tmp[t].cls) == 0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "rtype(i->to) == RTmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "dead reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "t >= Tmp0 && \042dead reg\042\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "v->t[0] == (T.rglob | fn->reg)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.39:
+	.ascii "v->t[0] == T.rglob\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "rtype(p->to) == RTmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.41:
+	.ascii "\012> Block information:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "\011%-10s (% 5d) \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "\012> After spilling:\012\000"
+/* end data */
+
+
+.text
+; function spill
+.global spill
+spill:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 208 r13
+  write -128 r14 r4
+  add r4 4 r1
+  read 0 r1 r1
+  addr2reg tmp r12
+  write 0 r12 r1
+  add r4 16 r1
+  read 0 r1 r5
+  addr2reg ntmp r12
+  write 0 r12 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  addr2reg ntmp r12
+  read 0 r12 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  addr2reg ntmp r12
+  read 0 r12 r5
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  addr2reg ntmp r12
+  read 0 r12 r5
+  addr2reg mask r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  addr2reg ntmp r12
+  read 0 r12 r5
+  addr2reg mask+8 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -128 r14 r4
+  add r4 48 r1
+  read 0 r1 r1
+  addr2reg locs r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg slot4 r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg slot8 r12
+  write 0 r12 r1
+  load 0 r1
+  write -168 r14 r1
+  load 0 r1
+.L231:
+  addr2reg ntmp r12
+  read 0 r12 r2
+  bges r1 r2 .L240
+  addr2reg T+28 r12
+  read 0 r12 r2
+  load 0 r3
+  blts r1 r2 .L234
+  addr2reg T+32 r12
+  read 0 r12 r3
+  add r2 r3 r2
+  slt r1 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L234:
+  load 0 r2
+  beq r3 r0 .L236
+  load 1 r2
+.L236:
+  load 32 r3
+  blts r1 r3 .L238
+  addr2reg tmp r12
+  read 0 r12 r2
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r2
+  add r2 108 r2
+  readh 0 r2 r2
+  shiftrs r2 1 r2
+.L238:
+  shiftl r2 3 r3
+  addr2reg mask r2
+  add r2 r3 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -168 r14 r1
+  add r1 1 r1
+  write -168 r14 r1
+  jump .L231
+.L240:
+  read -128 r14 r4
+  add r4 40 r1
+  read 0 r1 r1
+  add r4 28 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+.L242:
+  add r4 40 r2
+  read 0 r2 r2
+  bne r1 r2 8
+  jump .L411
+  load 4 r2
+  sub r1 r2 r1
+  write -116 r14 r1
+  read 0 r1 r1
+  write -112 r14 r1
+  load 0 r2
+  addr2reg curi r12
+  write 0 r12 r2
+  add r1 20 r2
+  read 0 r2 r2
+  write -120 r14 r2
+  or r0 r2 r3
+  add r1 24 r2
+  read 0 r2 r2
+  write -124 r14 r2
+  load 0 r5
+  bne r3 r0 .L245
+  or r0 r5 r6
+  jump .L246
+.L245:
+  add r3 48 r5
+  read 0 r5 r6
+  add r1 48 r5
+  read 0 r5 r5
+  sltu r5 r6 r5
+  xor r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r6
+.L246:
+  load 0 r5
+  bne r6 r0 .L248
+  or r0 r5 r3
+.L248:
+  load 0 r5
+  beq r2 r0 .L250
+  add r2 48 r5
+  read 0 r5 r6
+  add r1 48 r5
+  read 0 r5 r5
+  sltu r5 r6 r5
+  xor r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L250:
+  bne r5 r0 .L252
+  or r0 r3 r2
+  jump .L256
+.L252:
+  load 1 r5
+  beq r3 r0 .L254
+  add r2 48 r5
+  read 0 r5 r5
+  add r3 48 r6
+  read 0 r6 r6
+  sltu r5 r6 r5
+  xor r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L254:
+  bne r5 r0 .L256
+  or r0 r3 r2
+.L256:
+  load 0 r3
+.L257:
+  write -108 r14 r2
+  add r1 32 r5
+  read 0 r5 r5
+  bge r3 r5 .L266
+  or r0 r2 r5
+  add r1 28 r2
+  read 0 r2 r2
+  shiftl r3 2 r6
+  add r2 r6 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  add r1 48 r7
+  read 0 r7 r7
+  ble r6 r7 .L260
+  or r0 r5 r2
+  jump .L265
+.L260:
+  load 1 r6
+  beq r5 r0 .L262
+  shiftl r3 2 r6
+  add r2 r6 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  add r5 48 r7
+  read 0 r7 r7
+  sltu r6 r7 r6
+  xor r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L262:
+  bne r6 r0 .L264
+  or r0 r5 r2
+  jump .L265
+.L264:
+  shiftl r3 2 r5
+  add r2 r5 r2
+  read 0 r2 r2
+.L265:
+  add r3 1 r3
+  jump .L257
+.L266:
+  or r0 r2 r3
+  read -120 r14 r2
+  bne r3 r0 .L282
+  bne r2 r0 .L279
+  bne r5 r0 .L272
+  add r1 92 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -112 r14 r1
+  add r1 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -112 r14 r1
+  load 5 r3
+  bne r2 r3 .L296
+  add r14 -148 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r2 0 r3
+  write -20 r14 r3
+  read 0 r3 r2
+  write -16 r14 r2
+  add r1 12 r1
+  add r1 4 r2
+  addr2reg T+60 r12
+  read 0 r12 r1
+  load 0 r5
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  or r0 r1 r4
+  read -16 r14 r2
+  read -20 r14 r3
+  read -112 r14 r1
+  or r2 r4 r2
+  write 0 r3 r2
+  jump .L296
+.L272:
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bszero
+  read -112 r14 r1
+  load 0 r2
+.L273:
+  write -24 r14 r2
+  add r1 32 r3
+  read 0 r3 r3
+  bge r2 r3 .L278
+  or r0 r2 r3
+  add r1 28 r2
+  read 0 r2 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r6
+  or r0 r1 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump liveon
+  read -24 r14 r2
+  read -112 r14 r1
+  or r0 r2 r3
+  add r1 28 r2
+  read 0 r2 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r7
+  add r14 -156 r6
+  or r0 r1 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump merge
+  read -24 r14 r2
+  beq r2 r0 .L276
+  add r14 -156 r5
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinter
+  read -24 r14 r2
+  read -112 r14 r1
+  jump .L277
+.L276:
+  add r14 -156 r5
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -24 r14 r2
+  read -112 r14 r1
+.L277:
+  add r2 1 r2
+  jump .L273
+.L278:
+  add r14 -140 r7
+  load 0 r6
+  load 0 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump limit2
+  read -112 r14 r1
+  jump .L296
+.L279:
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bszero
+  read -120 r14 r2
+  read -112 r14 r1
+  or r0 r2 r6
+  or r0 r1 r5
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump liveon
+  read -120 r14 r2
+  read -112 r14 r1
+  or r0 r2 r7
+  add r14 -140 r6
+  or r0 r1 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump merge
+  read -124 r14 r2
+  read -112 r14 r1
+  beq r2 r0 .L281
+  or r0 r2 r6
+  or r0 r1 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump liveon
+  read -124 r14 r2
+  read -112 r14 r1
+  or r0 r2 r7
+  add r14 -156 r6
+  or r0 r1 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump merge
+  add r14 -156 r5
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinter
+.L281:
+  add r14 -140 r7
+  load 0 r6
+  load 0 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump limit2
+  read -112 r14 r1
+  jump .L296
+.L282:
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bszero
+  read -108 r14 r2
+  read -112 r14 r1
+  add r2 100 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r2 0 r3
+  read 0 r3 r2
+  addr2reg T+40 r12
+  read 0 r12 r4
+  or r2 r4 r2
+  write 0 r3 r2
+  load 0 r2
+  or r0 r2 r4
+.L284:
+  write -104 r14 r4
+  load 2 r2
+  bges r4 r2 .L296
+  beq r4 r0 .L288
+  addr2reg T+32 r12
+  read 0 r12 r2
+  write -100 r14 r2
+  jump .L290
+.L288:
+  addr2reg T+24 r12
+  read 0 r12 r2
+  write -100 r14 r2
+.L290:
+  add r1 92 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -104 r14 r4
+  shiftl r4 3 r2
+  addr2reg mask r1
+  add r1 r2 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinter
+  add r14 -156 r5
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -108 r14 r2
+  add r2 100 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinter
+  read -108 r14 r2
+  add r2 100 r5
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bsdiff
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump bscount
+  or r0 r1 r2
+  read -100 r14 r1
+  blt r2 r1 .L292
+  load 0 r6
+  or r0 r1 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump limit
+  jump .L293
+.L292:
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bscount
+  or r0 r1 r3
+  read -104 r14 r4
+  read -108 r14 r2
+  read -100 r14 r1
+  add r2 108 r2
+  shiftl r4 2 r4
+  add r2 r4 r2
+  read 0 r2 r2
+  sub r2 r3 r2
+  sub r1 r2 r5
+  load 0 r6
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump limit
+  add r14 -140 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump bsunion
+.L293:
+  add r14 -156 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bsunion
+  read -104 r14 r3
+  read -108 r14 r2
+  read -112 r14 r1
+  add r3 1 r3
+  or r0 r3 r4
+  jump .L284
+.L296:
+  load 32 r2
+  write -168 r14 r2
+.L297:
+  add r1 92 r4
+  add r14 -168 r5
+  savpc r15
+  add r15 12 r15
+  jump bsiter
+  or r0 r1 r2
+  read -112 r14 r1
+  beq r2 r0 .L305
+  read -168 r14 r3
+  write -96 r14 r3
+  read -148 r14 r2
+  shiftl r2 5 r2
+  blt r3 r2 .L301
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -96 r14 r3
+  read -112 r14 r1
+.L301:
+  add r14 -148 r2
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r3 5 r4
+  shiftl r4 2 r4
+  add r2 r4 r2
+  read 0 r2 r2
+  and r3 31 r4
+  load 1 r3
+  shiftl r3 r4 r3
+  and r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  bne r2 r0 .L304
+  read -168 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r2
+  read -112 r14 r1
+  write -200 r14 r2
+.L304:
+  read -168 r14 r2
+  add r2 1 r2
+  write -168 r14 r2
+  jump .L297
+.L305:
+  add r1 92 r4
+  add r14 -148 r5
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -112 r14 r1
+  addr2reg insb r12
+  read 0 r12 r2
+  load32 4194304 r3
+  add r2 r3 r2
+  addr2reg curi r12
+  write 0 r12 r2
+  add r1 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -112 r14 r1
+  bne r2 r0 .L321
+  add r1 12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r2
+  write -168 r14 r2
+  addr2reg tmp r12
+  read 0 r12 r1
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r1
+  shiftrs r1 1 r1
+  beq r1 r0 .L308
+  load 442 r6
+  addr2reg .Lstring.22 r5
+  addr2reg .Lstring.34 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+.L308:
+  read -168 r14 r2
+  write -28 r14 r2
+  read -148 r14 r1
+  shiftl r1 5 r1
+  blt r2 r1 .L311
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r2
+.L311:
+  add r14 -148 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r2 5 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  and r2 31 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  add r14 -164 r2
+  add r2 0 r2
+  write 0 r2 r1
+  read -168 r14 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  add r14 -148 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  load 0 r7
+  load 0 r6
+  load 0 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump limit2
+  read -168 r14 r2
+  write -32 r14 r2
+  read -148 r14 r1
+  shiftl r1 5 r1
+  blt r2 r1 .L315
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r2
+.L315:
+  add r14 -148 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r2 5 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  and r2 31 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  bne r1 r0 .L320
+  add r14 -164 r1
+  add r1 0 r1
+  read 0 r1 r1
+  bne r1 r0 .L319
+  read -168 r14 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+.L319:
+  read -168 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r2
+  read -112 r14 r1
+  write -196 r14 r2
+  add r1 12 r1
+  add r1 4 r2
+  read -196 r14 r1
+  write 0 r2 r1
+.L320:
+  add r14 -148 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump reloads
+  read -112 r14 r1
+.L321:
+  add r1 4 r2
+  read 0 r2 r2
+  add r1 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r2
+.L322:
+  add r1 4 r1
+  read 0 r1 r1
+  beq r2 r1 .L386
+  load 16 r1
+  sub r2 r1 r2
+  write -92 r14 r2
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump regcpy
+  or r0 r1 r3
+  read -92 r14 r2
+  read -112 r14 r1
+  bne r3 r0 .L385
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bszero
+  read -92 r14 r2
+  add r2 4 r1
+  load 0 r2
+  write -132 r14 r2
+  read -132 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -92 r14 r2
+  bne r1 r0 .L338
+  add r2 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -92 r14 r2
+  beq r1 r0 .L327
+  load 462 r6
+  addr2reg .Lstring.22 r5
+  addr2reg .Lstring.35 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -92 r14 r2
+.L327:
+  add r2 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r2
+  write -52 r14 r2
+  write -168 r14 r2
+  read -148 r14 r1
+  shiftl r1 5 r1
+  blt r2 r1 .L330
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -52 r14 r2
+.L330:
+  add r14 -148 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r2 5 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  and r2 31 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  bne r1 r0 .L337
+  read -168 r14 r2
+  load 0 r1
+  load 32 r3
+  blts r2 r3 .L334
+  addr2reg .Lstring.36 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L334:
+  bne r1 r0 .L336
+  load 469 r6
+  addr2reg .Lstring.22 r5
+  addr2reg .Lstring.37 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+.L336:
+  read -168 r14 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -168 r14 r5
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -92 r14 r2
+  jump .L338
+.L337:
+  read -168 r14 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+  read -92 r14 r2
+.L338:
+  read 0 r2 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r4
+  addr2reg T+68 r12
+  read 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -92 r14 r2
+  load 0 r3
+  write -84 r14 r1
+  or r0 r2 r1
+.L340:
+  write -88 r14 r3
+  load 2 r2
+  bge r3 r2 .L345
+  add r1 8 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r4
+  read -84 r14 r2
+  read -88 r14 r3
+  read -92 r14 r1
+  load 6 r5
+  bne r4 r5 .L343
+  load 1 r4
+  sub r2 r4 r2
+.L343:
+  add r3 1 r3
+  write -84 r14 r2
+  jump .L340
+.L345:
+  or r0 r1 r2
+  read -84 r14 r1
+  load 0 r3
+  write -76 r14 r1
+  or r0 r2 r1
+.L348:
+  write -80 r14 r3
+  load 2 r2
+  bge r3 r2 .L367
+  add r1 8 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r5
+  read -76 r14 r2
+  read -80 r14 r3
+  read -92 r14 r1
+  read -128 r14 r4
+  load 6 r6
+  beq r5 r6 .L360
+  load 6 r6
+  bge r5 r6 .L365
+  beq r5 r0 .L354
+  sltu r5 r0 r5
+  jump .L365
+.L354:
+  add r1 8 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  shiftr r1 3 r2
+  write -64 r14 r2
+  write -168 r14 r2
+  read -148 r14 r1
+  shiftl r1 5 r1
+  blt r2 r1 .L357
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -80 r14 r3
+  read -64 r14 r2
+.L357:
+  add r14 -148 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r2 5 r4
+  shiftl r4 2 r4
+  add r1 r4 r1
+  read 0 r1 r1
+  and r2 31 r4
+  load 1 r2
+  shiftl r2 r4 r2
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  shiftl r3 2 r3
+  add r14 -164 r2
+  add r2 r3 r2
+  write 0 r2 r1
+  read -168 r14 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -76 r14 r2
+  read -80 r14 r3
+  read -92 r14 r1
+  read -128 r14 r4
+  or r0 r2 r5
+  load 1 r2
+  sub r5 r2 r2
+  write -68 r14 r2
+  bgts r5 r0 .L365
+  read -168 r14 r5
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -80 r14 r3
+  read -68 r14 r2
+  read -92 r14 r1
+  read -128 r14 r4
+  jump .L365
+.L360:
+  add r1 8 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  shiftr r1 3 r2
+  write -168 r14 r2
+  add r4 12 r1
+  read 0 r1 r1
+  load 48 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  write -72 r14 r1
+  add r1 32 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -72 r14 r1
+  bne r2 r0 .L362
+  add r1 32 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -72 r14 r1
+  add r1 32 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -72 r14 r1
+.L362:
+  add r1 36 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r6
+  read -76 r14 r2
+  read -80 r14 r3
+  read -72 r14 r1
+  or r0 r1 r5
+  read -92 r14 r1
+  read -128 r14 r4
+  bne r6 r0 .L365
+  or r0 r5 r1
+  add r1 36 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -72 r14 r1
+  add r1 36 r1
+  read 0 r1 r1
+  shiftr r1 3 r5
+  add r14 -140 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -76 r14 r2
+  read -80 r14 r3
+  read -92 r14 r1
+  read -128 r14 r4
+.L365:
+  add r3 1 r3
+  write -76 r14 r2
+  jump .L348
+.L367:
+  add r14 -148 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  add r14 -140 r7
+  load 0 r6
+  load 0 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump limit2
+  read -92 r14 r2
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L369:
+  write -60 r14 r2
+  load 2 r3
+  bge r2 r3 .L380
+  add r1 8 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -60 r14 r2
+  read -92 r14 r1
+  bne r3 r0 .L379
+  add r1 8 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  shiftr r3 3 r4
+  write -56 r14 r4
+  write -168 r14 r4
+  read -148 r14 r3
+  shiftl r3 5 r3
+  blt r4 r3 .L374
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -60 r14 r2
+  read -56 r14 r4
+  read -92 r14 r1
+.L374:
+  add r14 -148 r3
+  add r3 4 r3
+  read 0 r3 r3
+  shiftr r4 5 r5
+  shiftl r5 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  and r4 31 r5
+  load 1 r4
+  shiftl r4 r5 r4
+  and r3 r4 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  bne r3 r0 .L379
+  shiftl r2 2 r2
+  add r14 -164 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  bne r1 r0 .L378
+  read -168 r14 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+.L378:
+  read -168 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r3
+  read -60 r14 r2
+  read -92 r14 r1
+  write -192 r14 r3
+  add r1 8 r3
+  shiftl r2 2 r4
+  add r3 r4 r4
+  read -192 r14 r3
+  write 0 r4 r3
+.L379:
+  add r2 1 r2
+  jump .L369
+.L380:
+  add r14 -148 r5
+  add r14 -156 r4
+  savpc r15
+  add r15 12 r15
+  jump reloads
+  read -92 r14 r2
+  add r2 4 r1
+  load 0 r2
+  write -132 r14 r2
+  read -132 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -92 r14 r2
+  bne r1 r0 .L383
+  add r2 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r3
+  write -168 r14 r3
+  add r2 4 r1
+  addr2reg tmp r12
+  read 0 r12 r2
+  load 160 r4
+  mults r3 r4 r3
+  add r2 r3 r2
+  add r2 104 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump store
+  read -92 r14 r2
+  read -168 r14 r5
+  load 32 r1
+  blts r5 r1 .L383
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+  read -92 r14 r2
+.L383:
+  add r14 -188 r4
+  add r2 0 r1
+  read 0 r1 r1
+  add r14 -188 r3
+  add r3 0 r3
+  write 0 r3 r1
+  add r2 4 r1
+  read 0 r1 r1
+  add r14 -188 r3
+  add r3 4 r3
+  write 0 r3 r1
+  add r2 8 r1
+  read 0 r1 r1
+  add r14 -188 r3
+  add r3 8 r3
+  write 0 r3 r1
+  add r2 12 r1
+  read 0 r1 r1
+  add r14 -188 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump emiti
+  read -92 r14 r2
+  read -112 r14 r1
+  read -128 r14 r4
+  add r14 -148 r3
+  add r3 4 r3
+  read 0 r3 r3
+  add r3 0 r3
+  read 0 r3 r5
+  beq r5 r0 .L322
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump sethint
+  read -92 r14 r2
+  read -112 r14 r1
+  read -128 r14 r4
+  jump .L322
+.L385:
+  add r14 -148 r6
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump dopm
+  or r0 r1 r2
+  read -112 r14 r1
+  read -128 r14 r4
+  jump .L322
+.L386:
+  read -112 r14 r1
+  read -128 r14 r4
+  read 0 r4 r2
+  beq r1 r2 .L390
+  add r14 -148 r2
+  add r2 4 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  addr2reg T+40 r12
+  read 0 r12 r3
+  beq r2 r3 .L392
+  load 531 r6
+  addr2reg .Lstring.22 r5
+  addr2reg .Lstring.39 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -112 r14 r1
+  jump .L392
+.L390:
+  add r14 -148 r2
+  add r2 4 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  addr2reg T+40 r12
+  read 0 r12 r3
+  add r4 44 r4
+  read 0 r4 r4
+  or r3 r4 r3
+  beq r2 r3 .L392
+  load 529 r6
+  addr2reg .Lstring.22 r5
+  addr2reg .Lstring.38 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -112 r14 r1
+.L392:
+  read 0 r1 r2
+.L393:
+  write -48 r14 r2
+  beq r2 r0 .L409
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -48 r14 r2
+  read -112 r14 r1
+  beq r3 r0 .L396
+  load 534 r6
+  addr2reg .Lstring.22 r5
+  addr2reg .Lstring.40 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -48 r14 r2
+  read -112 r14 r1
+.L396:
+  read 0 r2 r3
+  shiftr r3 3 r4
+  write -36 r14 r4
+  write -168 r14 r4
+  read -148 r14 r3
+  shiftl r3 5 r3
+  blt r4 r3 .L399
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -48 r14 r2
+  read -36 r14 r4
+  read -112 r14 r1
+.L399:
+  add r14 -148 r3
+  add r3 4 r3
+  read 0 r3 r3
+  shiftr r4 5 r5
+  shiftl r5 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  and r4 31 r5
+  load 1 r4
+  shiftl r4 r5 r4
+  and r3 r4 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  bne r3 r0 .L407
+  add r1 84 r3
+  write -40 r14 r3
+  read -168 r14 r4
+  write -44 r14 r4
+  read 0 r3 r5
+  shiftl r5 5 r5
+  blt r4 r5 .L404
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -48 r14 r2
+  read -44 r14 r4
+  read -40 r14 r3
+  read -112 r14 r1
+.L404:
+  add r3 4 r3
+  read 0 r3 r3
+  shiftr r4 5 r5
+  shiftl r5 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  and r4 31 r5
+  load 1 r4
+  shiftl r4 r5 r4
+  and r3 r4 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  beq r3 r0 .L408
+  read 0 r2 r1
+  shiftr r1 3 r4
+  savpc r15
+  add r15 12 r15
+  jump slot
+  or r0 r1 r3
+  read -48 r14 r2
+  read -112 r14 r1
+  write -172 r14 r3
+  read -172 r14 r3
+  write 0 r2 r3
+  jump .L408
+.L407:
+  read -168 r14 r5
+  add r14 -148 r4
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+  read -48 r14 r2
+  addr2reg tmp r12
+  read 0 r12 r1
+  read -168 r14 r3
+  load 160 r4
+  mults r3 r4 r3
+  add r1 r3 r1
+  add r1 104 r1
+  read 0 r1 r5
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump store
+  read -48 r14 r2
+  read -112 r14 r1
+.L408:
+  add r2 20 r2
+  read 0 r2 r2
+  jump .L393
+.L409:
+  read -112 r14 r1
+  add r1 84 r4
+  add r14 -148 r5
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -112 r14 r1
+  addr2reg insb r12
+  read 0 r12 r2
+  load32 4194304 r3
+  add r2 r3 r2
+  addr2reg curi r12
+  read 0 r12 r3
+  sub r2 r3 r2
+  shiftrs r2 31 r3
+  shiftr r3 28 r3
+  add r2 r3 r2
+  shiftrs r2 4 r6
+  add r1 8 r2
+  write 0 r2 r6
+  add r1 4 r4
+  addr2reg curi r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump idup
+  read -116 r14 r1
+  read -128 r14 r4
+  jump .L242
+.L411:
+  addr2reg slot8 r12
+  read 0 r12 r1
+  and r1 3 r2
+  add r1 r2 r3
+  addr2reg slot8 r12
+  write 0 r12 r3
+  add r4 48 r2
+  read 0 r2 r1
+  add r1 r3 r1
+  write 0 r2 r1
+  addr2reg debug+83 r12
+  readb 0 r12 r1
+  beq r1 r0 .L417
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.41 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -128 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  read 0 r4 r1
+.L413:
+  write -12 r14 r1
+  beq r1 r0 .L416
+  add r1 124 r6
+  add r1 116 r1
+  read 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.42 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r1
+  read -128 r14 r4
+  or r0 r1 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r4 r1
+  add r2 92 r4
+  add r1 4 r1
+  read 0 r1 r5
+  addr2reg __stderr_file r6
+  savpc r15
+  add r15 12 r15
+  jump dumpts
+  read -12 r14 r1
+  read -128 r14 r4
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L413
+.L416:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.43 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -128 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+.L417:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function spill */
+
+.data
+.balign 4
+fst:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+tmp:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+ntmp:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+locs:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+slot4:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+slot8:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+mask:
+	.fill 16,1,0
+/* end data */
+
@@ -0,0 +1,2448 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "BuildTools/QBE/ssa.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "unreachable\000"
+/* end data */
+
+
+.text
+; function adduse
+adduse:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  write 8 r14 r4
+  write 12 r14 r5
+  write 16 r14 r6
+  write 20 r14 r7
+  sub r13 28 r13
+  write -4 r14 r6
+  write -16 r14 r5
+  write -12 r14 r4
+  add r4 84 r1
+  read 0 r1 r1
+  beq r1 r0 .L28
+  add r14 20 r1
+  write -20 r14 r1
+  add r4 92 r1
+  read 0 r1 r2
+  write -8 r14 r2
+  or r0 r4 r1
+  add r4 84 r4
+  add r1 92 r1
+  add r2 1 r5
+  write 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -8 r14 r2
+  read -4 r14 r6
+  read -16 r14 r5
+  read -12 r14 r4
+  add r4 84 r1
+  read 0 r1 r1
+  load 12 r3
+  mults r2 r3 r2
+  add r1 r2 r2
+  write 0 r2 r5
+  add r6 48 r1
+  read 0 r1 r1
+  add r2 4 r3
+  write 0 r3 r1
+  load 2 r1
+  beq r5 r1 .L27
+  load 2 r1
+  blt r5 r1 .L23
+  load 3 r1
+  beq r5 r1 .L28
+  load 3 r1
+  sltu r5 r1 r1
+  jump .L25
+.L23:
+  load 1 r1
+  beq r5 r1 .L26
+  load 1 r1
+  sltu r5 r1 r1
+.L25:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L28
+.L26:
+  read -20 r14 r3
+  read 0 r3 r1
+  add r3 4 r3
+  write -20 r14 r3
+  add r2 8 r2
+  write 0 r2 r1
+  jump .L28
+.L27:
+  read -20 r14 r3
+  read 0 r3 r1
+  add r3 4 r3
+  write -20 r14 r3
+  add r2 8 r2
+  write 0 r2 r1
+.L28:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function adduse */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "rtype(p->to) == RTmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "rtype(i->to) == RTmp\000"
+/* end data */
+
+
+.text
+; function filluse
+.global filluse
+filluse:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 64 r13
+  write -56 r14 r8
+  or r0 r4 r7
+  write -44 r14 r7
+  add r7 4 r1
+  read 0 r1 r2
+  write -48 r14 r2
+  load 32 r1
+.L32:
+  write -40 r14 r1
+  add r7 16 r3
+  read 0 r3 r3
+  bges r1 r3 .L36
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r3
+  add r3 80 r4
+  load 0 r3
+  write 0 r4 r3
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r3
+  add r3 96 r4
+  load32 -1 r3
+  write 0 r4 r3
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r3
+  add r3 88 r4
+  load 0 r3
+  write 0 r4 r3
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r3
+  add r3 92 r4
+  load 0 r3
+  write 0 r4 r3
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r3
+  add r3 108 r4
+  load 0 r3
+  writeh 0 r4 r3
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r3
+  add r3 124 r4
+  load 0 r3
+  write 0 r4 r3
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r3
+  add r3 152 r4
+  load 0 r3
+  write 0 r4 r3
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r3
+  add r3 84 r3
+  read 0 r3 r3
+  bne r3 r0 .L35
+  load 1 r6
+  load 12 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r3
+  read -40 r14 r1
+  read -48 r14 r2
+  read -44 r14 r7
+  load 160 r4
+  mults r1 r4 r4
+  add r2 r4 r4
+  add r4 84 r4
+  write 0 r4 r3
+.L35:
+  add r1 1 r1
+  jump .L32
+.L36:
+  read 0 r7 r3
+.L37:
+  write -28 r14 r3
+  beq r3 r0 .L86
+  read 0 r3 r1
+.L39:
+  write -32 r14 r1
+  beq r1 r0 .L53
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r4
+  read -32 r14 r1
+  read -28 r14 r3
+  read -48 r14 r2
+  read -44 r14 r7
+  beq r4 r0 .L42
+  load 62 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.11 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r1
+  read -28 r14 r3
+  read -48 r14 r2
+  read -44 r14 r7
+.L42:
+  read 0 r1 r4
+  shiftr r4 3 r4
+  add r3 48 r3
+  read 0 r3 r3
+  load 160 r5
+  mults r4 r5 r5
+  add r2 r5 r5
+  add r5 96 r5
+  write 0 r5 r3
+  load 160 r3
+  mults r4 r3 r3
+  add r2 r3 r3
+  add r3 88 r5
+  read 0 r5 r3
+  add r3 1 r3
+  write 0 r5 r3
+  add r1 16 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r4 r3 r3
+  add r2 r3 r2
+  add r2 108 r2
+  writeh 0 r2 r1
+  add r7 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump phicls
+  write -24 r14 r1
+  read -32 r14 r1
+  load 0 r2
+  or r0 r2 r6
+.L44:
+  write -36 r14 r6
+  add r1 12 r2
+  read 0 r2 r2
+  bge r6 r2 .L51
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r6 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r4
+  read -36 r14 r6
+  read -32 r14 r1
+  read -28 r14 r3
+  read -24 r14 r5
+  read -48 r14 r2
+  read -44 r14 r7
+  beq r4 r0 .L47
+  or r0 r7 r4
+  jump .L50
+.L47:
+  add r1 4 r4
+  read 0 r4 r4
+  shiftl r6 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  shiftr r4 3 r4
+  write -20 r14 r4
+  load 160 r5
+  mults r4 r5 r4
+  add r2 r4 r4
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r7
+  or r0 r3 r6
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump adduse
+  read -20 r14 r4
+  read -44 r14 r7
+  load32 -24 r1
+  sub r13 r1 r13
+  add r7 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump phicls
+  or r0 r1 r4
+  read -36 r14 r6
+  read -32 r14 r1
+  read -28 r14 r3
+  read -24 r14 r5
+  read -48 r14 r2
+  xor r4 r5 r8
+  sltu r0 r8 r8
+  read -44 r14 r7
+  bne r8 r0 .L49
+  or r0 r7 r4
+  jump .L50
+.L49:
+  load 160 r7
+  mults r4 r7 r7
+  read -44 r14 r4
+  add r2 r7 r7
+  add r7 124 r7
+  write 0 r7 r5
+.L50:
+  add r6 1 r6
+  jump .L44
+.L51:
+  read -28 r14 r3
+  read -48 r14 r2
+  read -44 r14 r7
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L39
+.L53:
+  read -28 r14 r3
+  add r3 4 r1
+  read 0 r1 r1
+.L55:
+  write -12 r14 r1
+  add r3 4 r2
+  read 0 r2 r2
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r2
+  bge r1 r2 .L82
+  add r1 4 r1
+  load 0 r2
+  write -52 r14 r2
+  read -52 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -12 r14 r1
+  bne r2 r0 .L74
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r4
+  read -12 r14 r1
+  read -28 r14 r3
+  read -48 r14 r2
+  beq r4 r0 .L59
+  load 79 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r1
+  read -28 r14 r3
+  read -48 r14 r2
+.L59:
+  read 0 r1 r4
+  shiftl r4 2 r5
+  shiftr r5 2 r5
+  load 110 r6
+  sub r5 r6 r6
+  load 0 r5
+  load 3 r7
+  bgt r6 r7 .L61
+  shiftl r4 2 r5
+  shiftr r5 2 r5
+  load 110 r6
+  sub r5 r6 r6
+  load 1 r5
+  add r5 r6 r5
+.L61:
+  shiftl r4 2 r6
+  shiftr r6 2 r6
+  load 59 r7
+  sub r6 r7 r6
+  load 0 r7
+  write -8 r14 r7
+  load 6 r7
+  sltu r7 r6 r7
+  xor r7 1 r7
+  read -8 r14 r6
+  beq r7 r0 .L63
+  shiftl r4 2 r6
+  shiftr r6 2 r6
+  xor r6 65 r6
+  sltu r0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L63:
+  beq r6 r0 .L65
+  shiftl r4 2 r5
+  shiftr r5 2 r5
+  load 59 r6
+  sub r5 r6 r6
+  load 1 r5
+  add r5 r6 r5
+.L65:
+  shiftl r4 2 r6
+  shiftr r6 2 r6
+  load 66 r7
+  sub r6 r7 r6
+  load 5 r7
+  bgt r6 r7 .L67
+  shiftl r4 2 r5
+  shiftr r5 2 r5
+  load 66 r6
+  sub r5 r6 r6
+  load 1 r5
+  add r5 r6 r5
+.L67:
+  load 1 r6
+  load 5 r7
+  beq r5 r7 .L69
+  xor r5 6 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L69:
+  beq r6 r0 .L73
+  shiftr r4 30 r4
+  bne r4 r0 .L73
+  load 0 r4
+  or r0 r4 r5
+.L73:
+  add r1 4 r4
+  read 0 r4 r4
+  shiftr r4 3 r4
+  load 160 r6
+  mults r4 r6 r6
+  add r2 r6 r6
+  add r6 152 r6
+  write 0 r6 r5
+  load 160 r5
+  mults r4 r5 r5
+  add r2 r5 r5
+  add r5 80 r5
+  write 0 r5 r1
+  add r3 48 r3
+  read 0 r3 r3
+  load 160 r5
+  mults r4 r5 r5
+  add r2 r5 r5
+  add r5 96 r5
+  write 0 r5 r3
+  load 160 r3
+  mults r4 r3 r3
+  add r2 r3 r3
+  add r3 88 r5
+  read 0 r5 r3
+  add r3 1 r3
+  write 0 r5 r3
+  or r0 r2 r3
+  read 0 r1 r2
+  shiftr r2 30 r2
+  load 160 r5
+  mults r4 r5 r4
+  add r3 r4 r3
+  add r3 108 r3
+  writeh 0 r3 r2
+.L74:
+  load 0 r2
+  or r0 r2 r4
+.L76:
+  write -16 r14 r4
+  load 2 r2
+  bges r4 r2 .L80
+  add r1 8 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r5
+  read -16 r14 r4
+  read -12 r14 r1
+  read -28 r14 r3
+  read -48 r14 r2
+  bne r5 r0 .L79
+  or r0 r4 r5
+  add r1 8 r4
+  shiftl r5 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  shiftr r4 3 r4
+  load 160 r5
+  mults r4 r5 r4
+  add r2 r4 r4
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r7
+  or r0 r3 r6
+  load 2 r5
+  savpc r15
+  add r15 12 r15
+  jump adduse
+  read -16 r14 r4
+  read -12 r14 r1
+  read -28 r14 r3
+  read -48 r14 r2
+  load32 -24 r5
+  sub r13 r5 r13
+.L79:
+  add r4 1 r4
+  jump .L76
+.L80:
+  read -28 r14 r3
+  read -48 r14 r2
+  add r1 16 r1
+  jump .L55
+.L82:
+  read -28 r14 r3
+  add r3 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -28 r14 r3
+  read -48 r14 r2
+  read -44 r14 r7
+  bne r1 r0 .L85
+  add r3 12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  load 160 r4
+  mults r1 r4 r1
+  add r2 r1 r4
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r3 r6
+  load 3 r5
+  savpc r15
+  add r15 12 r15
+  jump adduse
+  read -28 r14 r3
+  read -48 r14 r2
+  read -44 r14 r7
+  load32 -24 r1
+  sub r13 r1 r13
+.L85:
+  add r3 44 r1
+  read 0 r1 r3
+  jump .L37
+.L86:
+  read -56 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function filluse */
+
+
+.text
+; function refindex
+refindex:
+  or r0 r5 r6
+  or r0 r4 r2
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 12 r13
+  add r6 4 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r2 r3 r3
+  add r1 r3 r4
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r1
+  readh 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  write -4 r14 r1
+  read -4 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function refindex */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "invalid input\000"
+/* end data */
+
+
+.text
+; function phiins
+phiins:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 136 r13
+  write -68 r14 r4
+  add r4 28 r1
+  read 0 r1 r5
+  add r14 -124 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -68 r14 r4
+  add r4 28 r1
+  read 0 r1 r5
+  add r14 -116 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -68 r14 r4
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r4
+  or r0 r4 r1
+  read -68 r14 r4
+  write -96 r14 r1
+  add r4 28 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  write -92 r14 r2
+  add r4 16 r1
+  read 0 r1 r3
+  write -88 r14 r3
+  load 32 r1
+.L94:
+  write -84 r14 r1
+  bges r1 r3 .L169
+  add r4 4 r5
+  read 0 r5 r5
+  load 160 r6
+  mults r1 r6 r6
+  add r5 r6 r5
+  add r5 156 r6
+  load 0 r5
+  write 0 r6 r5
+  add r4 4 r5
+  read 0 r5 r5
+  load 160 r6
+  mults r1 r6 r6
+  add r5 r6 r6
+  add r6 124 r6
+  read 0 r6 r6
+  bne r6 r0 .L168
+  or r0 r5 r2
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r3
+  add r3 88 r3
+  read 0 r3 r3
+  load 1 r5
+  bne r3 r5 .L106
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r3
+  add r3 96 r3
+  read 0 r3 r6
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r3
+  add r3 84 r3
+  read 0 r3 r5
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r2
+  add r2 92 r2
+  read 0 r2 r2
+  load 1 r3
+.L99:
+  or r0 r2 r7
+  load 1 r2
+  sub r7 r2 r2
+  beq r7 r0 .L102
+  add r5 4 r7
+  read 0 r7 r7
+  xor r7 r6 r7
+  sltu r7 1 r7
+  and r3 r7 r3
+  add r5 12 r5
+  jump .L99
+.L102:
+  or r0 r3 r7
+  read -88 r14 r3
+  read -92 r14 r2
+  load 1 r5
+  bne r7 r0 .L105
+  read 0 r4 r5
+  add r5 48 r5
+  read 0 r5 r5
+  xor r6 r5 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L105:
+  bne r5 r0 .L168
+.L106:
+  add r14 -124 r4
+  savpc r15
+  add r15 12 r15
+  jump bszero
+  read -92 r14 r2
+  read -68 r14 r4
+  load32 -1 r1
+  writeh -104 r14 r1
+  read 0 r4 r1
+  or r0 r2 r3
+  or r0 r1 r2
+.L108:
+  write -76 r14 r2
+  write -4 r14 r3
+  beq r2 r0 .L142
+  add r2 52 r4
+  load 0 r1
+  write 0 r4 r1
+  load 0 r1
+  write -108 r14 r1
+  add r2 4 r1
+  read 0 r1 r6
+  load 0 r1
+  write -72 r14 r3
+  write -64 r14 r1
+.L111:
+  write -80 r14 r6
+  add r2 4 r1
+  read 0 r1 r1
+  add r2 8 r2
+  read 0 r2 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+  bge r6 r1 .L136
+  load 0 r1
+  write -100 r14 r1
+  read -100 r14 r5
+  read -108 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -80 r14 r6
+  read -84 r14 r1
+  bne r2 r0 .L117
+  or r0 r1 r2
+  add r6 8 r1
+  add r1 0 r1
+  shiftl r2 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -100 r14 r2
+  read -100 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -64 r14 r5
+  read -80 r14 r6
+  read -84 r14 r1
+  beq r2 r0 .L115
+  add r6 8 r2
+  add r2 0 r2
+  write 0 r2 r5
+.L115:
+  or r0 r1 r2
+  add r6 8 r1
+  add r1 4 r1
+  shiftl r2 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -100 r14 r2
+  read -100 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -64 r14 r5
+  read -80 r14 r6
+  read -84 r14 r1
+  beq r2 r0 .L117
+  add r6 8 r2
+  add r2 4 r2
+  write 0 r2 r5
+.L117:
+  or r0 r1 r2
+  add r6 4 r1
+  shiftl r2 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -100 r14 r2
+  read -100 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r7
+  read -64 r14 r5
+  read -72 r14 r3
+  read -80 r14 r6
+  read -76 r14 r2
+  read -84 r14 r1
+  read -68 r14 r4
+  beq r7 r0 .L134
+  add r2 92 r4
+  write -52 r14 r4
+  read 0 r4 r5
+  shiftl r5 5 r5
+  blt r1 r5 .L121
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -72 r14 r3
+  read -80 r14 r6
+  read -76 r14 r2
+  read -84 r14 r1
+  read -52 r14 r4
+.L121:
+  add r4 4 r4
+  read 0 r4 r4
+  shiftr r1 5 r5
+  shiftl r5 2 r5
+  add r4 r5 r4
+  read 0 r4 r5
+  and r1 31 r7
+  load 1 r4
+  shiftl r4 r7 r7
+  read -68 r14 r4
+  and r5 r7 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+  beq r5 r0 .L133
+  add r2 48 r1
+  read 0 r1 r4
+  write -56 r14 r4
+  read -124 r14 r1
+  shiftl r1 5 r1
+  blt r4 r1 .L126
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -72 r14 r3
+  read -80 r14 r6
+  read -76 r14 r2
+  read -56 r14 r4
+.L126:
+  add r14 -124 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r4 5 r5
+  shiftl r5 2 r5
+  add r1 r5 r1
+  read 0 r1 r1
+  and r4 31 r5
+  load 1 r4
+  shiftl r4 r5 r4
+  and r1 r4 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  beq r1 r0 .L129
+  write -60 r14 r3
+  jump .L131
+.L129:
+  add r2 48 r1
+  read 0 r1 r5
+  add r14 -124 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -72 r14 r3
+  read -80 r14 r6
+  read -76 r14 r2
+  load 4 r1
+  sub r3 r1 r3
+  write 0 r3 r2
+  write -60 r14 r3
+.L131:
+  read 0 r6 r1
+  shiftr r1 30 r5
+  add r14 -104 r4
+  savpc r15
+  add r15 12 r15
+  jump clsmerge
+  or r0 r1 r7
+  read -64 r14 r5
+  read -60 r14 r3
+  read -80 r14 r6
+  read -76 r14 r2
+  read -84 r14 r1
+  read -68 r14 r4
+  beq r7 r0 .L134
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -64 r14 r5
+  read -60 r14 r3
+  read -80 r14 r6
+  read -76 r14 r2
+  read -84 r14 r1
+  read -68 r14 r4
+  load32 -24 r7
+  sub r13 r7 r13
+  jump .L134
+.L133:
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump refindex
+  or r0 r1 r5
+  read -72 r14 r3
+  read -80 r14 r6
+  read -76 r14 r2
+  read -84 r14 r1
+  read -68 r14 r4
+  write -128 r14 r5
+  read -128 r14 r5
+  write -108 r14 r5
+  add r6 4 r7
+  write 0 r7 r5
+.L134:
+  add r6 16 r6
+  write -72 r14 r3
+  write -64 r14 r5
+  jump .L111
+.L136:
+  load 0 r1
+  write -100 r14 r1
+  read -100 r14 r5
+  read -108 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r7
+  read -64 r14 r5
+  read -72 r14 r3
+  read -76 r14 r2
+  or r0 r2 r1
+  read -84 r14 r2
+  read -68 r14 r4
+  load 0 r6
+  beq r7 r0 .L138
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L139
+.L138:
+  add r1 12 r1
+  add r1 4 r1
+  shiftl r2 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -100 r14 r2
+  read -100 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r6
+  read -64 r14 r5
+  read -72 r14 r3
+  read -76 r14 r2
+  read -84 r14 r1
+  read -68 r14 r4
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L139:
+  beq r6 r0 .L141
+  add r2 12 r6
+  add r6 4 r6
+  write 0 r6 r5
+.L141:
+  add r2 44 r2
+  read 0 r2 r2
+  jump .L108
+.L142:
+  add r14 -124 r5
+  add r14 -116 r4
+  savpc r15
+  add r15 12 r15
+  jump bscopy
+  read -4 r14 r2
+  read -84 r14 r1
+  or r0 r2 r3
+  read -92 r14 r2
+  read -68 r14 r4
+.L143:
+  beq r3 r2 .L167
+  add r4 4 r2
+  read 0 r2 r2
+  load 160 r4
+  mults r1 r4 r4
+  add r2 r4 r2
+  add r2 156 r2
+  write 0 r2 r1
+  add r3 4 r1
+  write -8 r14 r1
+  read 0 r3 r1
+  write -36 r14 r1
+  add r1 48 r1
+  read 0 r1 r5
+  add r14 -124 r4
+  savpc r15
+  add r15 12 r15
+  jump bsclr
+  read -84 r14 r1
+  or r0 r1 r2
+  read -36 r14 r1
+  read -8 r14 r3
+  load 0 r4
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L146:
+  write -44 r14 r3
+  write -40 r14 r4
+  add r2 72 r5
+  read 0 r5 r5
+  bge r4 r5 .L165
+  add r2 68 r2
+  read 0 r2 r2
+  shiftl r4 2 r5
+  add r2 r5 r2
+  read 0 r2 r5
+  write -48 r14 r5
+  add r5 52 r7
+  read 0 r7 r6
+  add r6 1 r2
+  write 0 r7 r2
+  read -36 r14 r2
+  bne r6 r0 .L164
+  add r5 84 r5
+  write -12 r14 r5
+  read 0 r5 r6
+  shiftl r6 5 r6
+  blt r1 r6 .L151
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -44 r14 r3
+  read -40 r14 r4
+  read -84 r14 r1
+  read -12 r14 r5
+  read -36 r14 r2
+.L151:
+  add r5 4 r5
+  read 0 r5 r5
+  shiftr r1 5 r6
+  shiftl r6 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  and r1 31 r7
+  load 1 r6
+  shiftl r6 r7 r6
+  and r5 r6 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+  beq r5 r0 .L164
+  load 24 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r2
+  read -84 r14 r1
+  read -48 r14 r5
+  write -16 r14 r2
+  readh -104 r14 r3
+  add r2 16 r4
+  write 0 r4 r3
+  shiftl r1 3 r1
+  load32 -8 r3
+  and r1 r3 r1
+  or r1 0 r1
+  write 0 r2 r1
+  read 0 r5 r1
+  add r2 20 r2
+  write 0 r2 r1
+  load 1 r6
+  load 4 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -16 r14 r2
+  add r2 4 r2
+  write 0 r2 r1
+  load 1 r6
+  load 4 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r6
+  read -44 r14 r3
+  read -40 r14 r4
+  read -84 r14 r1
+  read -16 r14 r2
+  read -48 r14 r5
+  add r2 8 r7
+  write 0 r7 r6
+  write 0 r5 r2
+  add r5 48 r2
+  read 0 r2 r6
+  write -20 r14 r6
+  read -116 r14 r2
+  shiftl r2 5 r2
+  blt r6 r2 .L156
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -44 r14 r3
+  read -40 r14 r4
+  read -84 r14 r1
+  read -20 r14 r6
+  read -48 r14 r5
+.L156:
+  add r14 -116 r2
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r6 5 r7
+  shiftl r7 2 r7
+  add r2 r7 r2
+  read 0 r2 r2
+  write -24 r14 r2
+  read -36 r14 r2
+  and r6 31 r7
+  load 1 r6
+  shiftl r6 r7 r7
+  read -24 r14 r6
+  and r6 r7 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+  bne r6 r0 .L164
+  add r5 48 r2
+  read 0 r2 r6
+  write -28 r14 r6
+  read -124 r14 r2
+  shiftl r2 5 r2
+  blt r6 r2 .L161
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -44 r14 r3
+  read -40 r14 r4
+  read -84 r14 r1
+  read -28 r14 r6
+  read -48 r14 r5
+.L161:
+  add r14 -124 r2
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r6 5 r7
+  shiftl r7 2 r7
+  add r2 r7 r2
+  read 0 r2 r2
+  write -32 r14 r2
+  read -36 r14 r2
+  and r6 31 r7
+  load 1 r6
+  shiftl r6 r7 r7
+  read -32 r14 r6
+  and r6 r7 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+  bne r6 r0 .L164
+  add r5 48 r1
+  read 0 r1 r5
+  add r14 -124 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -44 r14 r3
+  read -40 r14 r4
+  read -84 r14 r1
+  read -48 r14 r5
+  read -36 r14 r2
+  load 4 r6
+  sub r3 r6 r3
+  write 0 r3 r5
+.L164:
+  add r4 1 r4
+  jump .L146
+.L165:
+  or r0 r1 r2
+  read -92 r14 r1
+  read -68 r14 r4
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L143
+.L167:
+  read -88 r14 r3
+  read -92 r14 r2
+.L168:
+  add r1 1 r1
+  jump .L94
+.L169:
+  read -96 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function phiins */
+
+
+.text
+; function nnew
+nnew:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r6
+  write -16 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  addr2reg namel r12
+  read 0 r12 r1
+  bne r1 r0 .L176
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  read -12 r14 r6
+  read -16 r14 r5
+  jump .L177
+.L176:
+  add r1 8 r2
+  read 0 r2 r2
+  addr2reg namel r12
+  write 0 r12 r2
+.L177:
+  read -20 r14 r2
+  write 0 r1 r2
+  add r1 4 r2
+  write 0 r2 r5
+  add r1 8 r2
+  write 0 r2 r6
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function nnew */
+
+
+.text
+; function rendef
+rendef:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 48 r13
+  write -16 r14 r7
+  write -20 r14 r6
+  write -12 r14 r5
+  write -28 r14 r4
+  read 0 r4 r1
+  shiftr r1 3 r3
+  write -32 r14 r3
+  load 0 r1
+  write -36 r14 r1
+  read -36 r14 r5
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -32 r14 r3
+  read -16 r14 r7
+  load 1 r1
+  bne r2 r0 .L183
+  add r7 4 r1
+  read 0 r1 r1
+  load 160 r2
+  mults r3 r2 r2
+  add r1 r2 r1
+  add r1 156 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L183:
+  bne r1 r0 .L185
+  or r0 r7 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump refindex
+  read -32 r14 r3
+  read -16 r14 r7
+  read -20 r14 r6
+  read -12 r14 r5
+  write -40 r14 r1
+  read -40 r14 r1
+  write -24 r14 r1
+  write -36 r14 r1
+  or r0 r1 r2
+  add r7 4 r1
+  read 0 r1 r1
+  shiftr r2 3 r2
+  load 160 r4
+  mults r2 r4 r2
+  add r1 r2 r1
+  add r1 156 r1
+  write 0 r1 r3
+  shiftl r3 2 r1
+  add r6 r1 r1
+  read 0 r1 r6
+  read -36 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump nnew
+  or r0 r1 r2
+  read -24 r14 r1
+  read -32 r14 r3
+  read -20 r14 r6
+  read -28 r14 r4
+  shiftl r3 2 r3
+  add r6 r3 r3
+  write 0 r3 r2
+  write 0 r4 r1
+.L185:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rendef */
+
+
+.text
+; function getstk
+getstk:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r6
+  write -4 r14 r5
+  write -16 r14 r4
+  shiftl r4 2 r1
+  add r6 r1 r1
+  read 0 r1 r1
+.L189:
+  write -8 r14 r1
+  load 0 r2
+  beq r1 r0 .L191
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump dom
+  or r0 r1 r2
+  read -8 r14 r1
+  read -4 r14 r5
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L191:
+  beq r2 r0 .L194
+  or r0 r1 r2
+  add r1 8 r1
+  read 0 r1 r1
+  addr2reg namel r12
+  read 0 r12 r3
+  add r2 8 r4
+  write 0 r4 r3
+  addr2reg namel r12
+  write 0 r12 r2
+  jump .L189
+.L194:
+  read -12 r14 r6
+  read -16 r14 r4
+  shiftl r4 2 r2
+  add r6 r2 r2
+  write 0 r2 r1
+  beq r1 r0 .L197
+  read 0 r1 r1
+  jump .L198
+.L197:
+  load 1 r1
+  write -20 r14 r1
+  read -20 r14 r1
+.L198:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function getstk */
+
+
+.text
+; function renblk
+renblk:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 84 r13
+  write -56 r14 r6
+  write -60 r14 r5
+  write -64 r14 r4
+  read 0 r4 r1
+.L202:
+  write -52 r14 r1
+  beq r1 r0 .L205
+  or r0 r6 r7
+  or r0 r5 r6
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rendef
+  read -52 r14 r1
+  read -56 r14 r6
+  read -60 r14 r5
+  read -64 r14 r4
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L202
+.L205:
+  add r4 4 r1
+  read 0 r1 r1
+.L206:
+  write -44 r14 r1
+  add r4 4 r2
+  read 0 r2 r2
+  add r4 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r2
+  bge r1 r2 .L219
+  or r0 r1 r2
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L209:
+  write -48 r14 r2
+  load 2 r3
+  bges r2 r3 .L216
+  add r1 8 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  shiftr r3 3 r4
+  write -40 r14 r4
+  add r1 8 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r7
+  read -48 r14 r2
+  read -44 r14 r1
+  read -40 r14 r4
+  read -56 r14 r6
+  read -60 r14 r5
+  or r0 r1 r3
+  read -64 r14 r1
+  beq r7 r0 .L212
+  or r0 r1 r4
+  or r0 r3 r1
+  jump .L215
+.L212:
+  add r6 4 r6
+  read 0 r6 r6
+  load 160 r7
+  mults r4 r7 r7
+  add r6 r7 r7
+  read -56 r14 r6
+  add r7 156 r7
+  read 0 r7 r7
+  bne r7 r0 .L214
+  or r0 r1 r4
+  or r0 r3 r1
+  jump .L215
+.L214:
+  or r0 r5 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump getstk
+  or r0 r1 r3
+  read -48 r14 r2
+  read -44 r14 r1
+  read -56 r14 r6
+  read -60 r14 r5
+  read -64 r14 r4
+  write -76 r14 r3
+  add r1 8 r3
+  shiftl r2 2 r7
+  add r3 r7 r7
+  read -76 r14 r3
+  write 0 r7 r3
+.L215:
+  add r2 1 r2
+  jump .L209
+.L216:
+  or r0 r1 r2
+  read -56 r14 r6
+  read -60 r14 r5
+  read -64 r14 r4
+  or r0 r4 r1
+  add r2 4 r4
+  or r0 r6 r7
+  or r0 r5 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump rendef
+  read -44 r14 r1
+  read -56 r14 r6
+  read -60 r14 r5
+  read -64 r14 r4
+  add r1 16 r1
+  jump .L206
+.L219:
+  read -64 r14 r4
+  add r4 12 r1
+  add r1 4 r1
+  read 0 r1 r2
+  or r0 r4 r1
+  shiftr r2 3 r4
+  write -16 r14 r4
+  add r1 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -16 r14 r4
+  read -56 r14 r6
+  read -60 r14 r5
+  read -64 r14 r1
+  beq r2 r0 .L222
+  or r0 r1 r4
+  jump .L225
+.L222:
+  add r6 4 r2
+  read 0 r2 r2
+  load 160 r3
+  mults r4 r3 r3
+  add r2 r3 r2
+  add r2 156 r2
+  read 0 r2 r2
+  bne r2 r0 .L224
+  or r0 r1 r4
+  jump .L225
+.L224:
+  or r0 r5 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump getstk
+  read -64 r14 r4
+  write -72 r14 r1
+  add r4 12 r1
+  add r1 4 r2
+  read -72 r14 r1
+  write 0 r2 r1
+.L225:
+  savpc r15
+  add r15 12 r15
+  jump succlist
+  read -56 r14 r6
+  read -60 r14 r5
+  read -64 r14 r4
+.L226:
+  write -36 r14 r1
+  read 0 r1 r1
+  beq r1 r0 .L235
+  read 0 r1 r2
+.L228:
+  write -32 r14 r2
+  beq r2 r0 .L233
+  read 0 r2 r1
+  shiftr r1 3 r3
+  add r6 4 r1
+  read 0 r1 r1
+  load 160 r7
+  mults r3 r7 r3
+  add r1 r3 r1
+  add r1 156 r3
+  or r0 r4 r1
+  read 0 r3 r4
+  write -24 r14 r4
+  beq r4 r0 .L231
+  add r2 12 r1
+  read 0 r1 r4
+  write -28 r14 r4
+  add r4 1 r5
+  write 0 r1 r5
+  add r2 4 r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -32 r14 r2
+  add r2 8 r4
+  add r2 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -24 r14 r4
+  read -60 r14 r5
+  read -64 r14 r1
+  or r0 r5 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump getstk
+  or r0 r1 r3
+  read -32 r14 r2
+  read -28 r14 r4
+  read -56 r14 r6
+  read -60 r14 r5
+  read -64 r14 r1
+  write -68 r14 r3
+  add r2 4 r3
+  read 0 r3 r3
+  shiftl r4 2 r7
+  add r3 r7 r7
+  read -68 r14 r3
+  write 0 r7 r3
+  add r2 8 r3
+  read 0 r3 r3
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+.L231:
+  add r2 20 r2
+  read 0 r2 r2
+  or r0 r1 r4
+  jump .L228
+.L233:
+  read -36 r14 r1
+  add r1 4 r1
+  jump .L226
+.L235:
+  add r4 60 r1
+  read 0 r1 r1
+.L236:
+  write -20 r14 r1
+  beq r1 r0 .L239
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump renblk
+  read -20 r14 r1
+  read -56 r14 r6
+  read -60 r14 r5
+  add r1 64 r1
+  read 0 r1 r1
+  jump .L236
+.L239:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function renblk */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "\012> Dominators:\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "%10s:\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii " %s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "\012> After SSA construction:\012\000"
+/* end data */
+
+
+.text
+; function ssa
+.global ssa
+ssa:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -28 r14 r4
+  add r4 16 r1
+  read 0 r1 r1
+  write -24 r14 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  write -32 r14 r1
+  read -28 r14 r4
+  addr2reg debug+76 r12
+  readb 0 r12 r3
+  write -20 r14 r3
+  load 0 r1
+  addr2reg debug+76 r12
+  writeb 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump filldom
+  read -28 r14 r4
+  addr2reg debug+78 r12
+  readb 0 r12 r1
+  beq r1 r0 .L253
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.22 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  read 0 r4 r1
+.L244:
+  write -16 r14 r1
+  beq r1 r0 .L252
+  add r1 60 r2
+  read 0 r2 r2
+  beq r2 r0 .L251
+  add r1 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.23 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 60 r1
+  read 0 r1 r1
+.L247:
+  write -12 r14 r1
+  beq r1 r0 .L250
+  add r1 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.24 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 64 r1
+  read 0 r1 r1
+  jump .L247
+.L250:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.25 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L251:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L244
+.L252:
+  read -28 r14 r4
+.L253:
+  savpc r15
+  add r15 12 r15
+  jump fillfron
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filllive
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump phiins
+  read -32 r14 r1
+  read -28 r14 r4
+  or r0 r4 r2
+  read 0 r4 r4
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump renblk
+  read -20 r14 r3
+  read -32 r14 r4
+  read -24 r14 r1
+  read -28 r14 r2
+  or r0 r4 r12
+  or r0 r2 r4
+  or r0 r12 r2
+.L255:
+  or r0 r1 r5
+  load 1 r1
+  sub r5 r1 r1
+  beq r5 r0 .L259
+.L256:
+  shiftl r1 2 r5
+  add r2 r5 r5
+  read 0 r5 r5
+  beq r5 r0 .L255
+  add r5 8 r6
+  read 0 r6 r6
+  shiftl r1 2 r7
+  add r2 r7 r7
+  write 0 r7 r6
+  addr2reg namel r12
+  read 0 r12 r6
+  add r5 8 r7
+  write 0 r7 r6
+  addr2reg namel r12
+  write 0 r12 r5
+  jump .L256
+.L259:
+  or r0 r2 r4
+  addr2reg debug+76 r12
+  writeb 0 r12 r3
+  savpc r15
+  add r15 12 r15
+  jump free
+  addr2reg debug+78 r12
+  readb 0 r12 r1
+  beq r1 r0 .L262
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.26 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+.L262:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ssa */
+
+
+.text
+; function phicheck
+phicheck:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  add r14 -20 r1
+  write 0 r1 r6
+  write -8 r14 r5
+  or r0 r4 r1
+  write -12 r14 r1
+  load 0 r2
+  or r0 r2 r3
+.L267:
+  write -16 r14 r3
+  add r1 12 r2
+  read 0 r2 r2
+  bge r3 r2 .L274
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read -20 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -16 r14 r3
+  read -8 r14 r2
+  read -12 r14 r1
+  beq r4 r0 .L272
+  add r1 8 r4
+  read 0 r4 r4
+  shiftl r3 2 r5
+  add r4 r5 r4
+  read 0 r4 r5
+  load 0 r4
+  beq r5 r2 .L271
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump sdom
+  or r0 r1 r4
+  read -16 r14 r3
+  read -8 r14 r2
+  read -12 r14 r1
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L271:
+  bne r4 r0 .L273
+.L272:
+  add r3 1 r3
+  jump .L267
+.L273:
+  load 1 r1
+  jump .L275
+.L274:
+  load 0 r1
+.L275:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function phicheck */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "ssa temporary %%%s defined more than once\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "%%%s violates ssa invariant\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "ssa temporary %%%s is used undefined in @%s\000"
+/* end data */
+
+
+.text
+; function ssacheck
+.global ssacheck
+ssacheck:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 64 r13
+  write -56 r14 r8
+  write -48 r14 r4
+  add r4 4 r1
+  read 0 r1 r1
+  add r1 5120 r6
+  or r0 r6 r2
+.L280:
+  write -44 r14 r2
+  add r4 4 r1
+  read 0 r1 r1
+  sub r2 r1 r3
+  load32 1717986919 r1
+  mulshi r3 r1 r1
+  shiftrs r1 6 r1
+  shiftr r3 31 r3
+  add r1 r3 r1
+  add r4 16 r3
+  read 0 r3 r3
+  bges r1 r3 .L288
+  add r2 88 r1
+  read 0 r1 r1
+  load 1 r3
+  ble r1 r3 .L283
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r2 r5
+  addr2reg .Lstring.29 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -44 r14 r2
+  read -48 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L283:
+  add r2 92 r1
+  read 0 r1 r3
+  load 0 r1
+  ble r3 r0 .L285
+  add r2 88 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L285:
+  bne r1 r0 .L287
+  add r2 160 r2
+  jump .L280
+.L287:
+  add r4 40 r1
+  read 0 r1 r1
+  add r2 84 r3
+  read 0 r3 r3
+  add r3 0 r3
+  add r3 4 r3
+  read 0 r3 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r5
+  jump .L320
+.L288:
+  read 0 r4 r1
+.L289:
+  write -36 r14 r1
+  beq r1 r0 .L327
+  read 0 r1 r2
+.L291:
+  write -40 r14 r2
+  beq r2 r0 .L304
+  read 0 r2 r3
+  write -52 r14 r3
+  add r4 4 r2
+  read 0 r2 r2
+  shiftr r3 3 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r2 r3 r2
+  write -24 r14 r2
+  add r2 84 r3
+  read 0 r3 r3
+.L293:
+  write -32 r14 r3
+  add r2 84 r5
+  read 0 r5 r5
+  add r2 92 r6
+  read 0 r6 r6
+  load 12 r7
+  mults r6 r7 r6
+  add r5 r6 r5
+  bge r3 r5 .L302
+  add r4 40 r5
+  read 0 r5 r5
+  add r3 4 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  write -28 r14 r5
+  read 0 r3 r6
+  load 1 r7
+  beq r6 r7 .L300
+  load 0 r6
+  bne r5 r1 .L297
+  or r0 r6 r5
+  jump .L298
+.L297:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sdom
+  or r0 r1 r5
+  read -32 r14 r3
+  read -36 r14 r1
+  read -24 r14 r2
+  read -48 r14 r4
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L298:
+  beq r5 r0 .L301
+  read -28 r14 r5
+  jump .L320
+.L300:
+  add r3 8 r2
+  read 0 r2 r4
+  read -52 r14 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump phicheck
+  or r0 r1 r6
+  read -32 r14 r3
+  read -36 r14 r1
+  read -28 r14 r5
+  read -24 r14 r2
+  read -48 r14 r4
+  bne r6 r0 .L320
+.L301:
+  add r3 12 r3
+  jump .L293
+.L302:
+  read -40 r14 r2
+  add r2 20 r2
+  read 0 r2 r2
+  jump .L291
+.L304:
+  add r1 4 r2
+  read 0 r2 r5
+.L305:
+  write -8 r14 r5
+  or r0 r1 r2
+  add r1 4 r1
+  read 0 r1 r1
+  add r2 8 r2
+  read 0 r2 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+  bge r5 r1 .L325
+  add r5 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -8 r14 r5
+  read -36 r14 r1
+  read -48 r14 r4
+  bne r2 r0 .L324
+  add r5 4 r2
+  read 0 r2 r3
+  write -52 r14 r3
+  add r4 4 r2
+  read 0 r2 r2
+  shiftr r3 3 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r2 r3 r2
+  write -12 r14 r2
+  add r2 84 r3
+  read 0 r3 r3
+.L308:
+  write -20 r14 r3
+  add r2 84 r5
+  read 0 r5 r5
+  add r2 92 r6
+  read 0 r6 r6
+  load 12 r7
+  mults r6 r7 r6
+  add r5 r6 r5
+  bge r3 r5 .L323
+  add r4 40 r5
+  read 0 r5 r5
+  add r3 4 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  write -16 r14 r5
+  read 0 r3 r6
+  load 1 r7
+  beq r6 r7 .L317
+  xor r5 r1 r8
+  sltu r8 1 r8
+  read -8 r14 r7
+  bne r8 r0 .L313
+  or r0 r5 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sdom
+  or r0 r1 r6
+  read -20 r14 r3
+  read -8 r14 r5
+  read -36 r14 r1
+  read -12 r14 r2
+  read -48 r14 r4
+  bne r6 r0 .L318
+  read -16 r14 r5
+  jump .L320
+.L313:
+  or r0 r7 r5
+  load 2 r7
+  bne r6 r7 .L318
+  add r3 8 r6
+  read 0 r6 r6
+  bgt r6 r5 .L318
+  read -16 r14 r5
+  jump .L320
+.L317:
+  add r3 8 r2
+  read 0 r2 r4
+  read -52 r14 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump phicheck
+  or r0 r1 r7
+  read -20 r14 r3
+  read -8 r14 r5
+  read -36 r14 r1
+  read -16 r14 r6
+  read -12 r14 r2
+  read -48 r14 r4
+  bne r7 r0 .L319
+.L318:
+  add r3 12 r3
+  jump .L308
+.L319:
+  or r0 r6 r5
+.L320:
+  or r0 r2 r6
+  add r6 156 r1
+  read 0 r1 r1
+  bne r1 r0 .L322
+  or r0 r6 r1
+  add r5 124 r6
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r5
+  addr2reg .Lstring.31 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L327
+.L322:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.30 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L327
+.L323:
+  read -8 r14 r5
+.L324:
+  or r0 r5 r7
+  add r5 16 r5
+  jump .L305
+.L325:
+  read -36 r14 r1
+  read -48 r14 r4
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L289
+.L327:
+  read -56 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ssacheck */
+
+.data
+.balign 4
+namel:
+	.fill 4,1,0
+/* end data */
+
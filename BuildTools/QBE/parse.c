@@ -44,10 +44,14 @@ enum Token {
 	Tphi,
 	Tjmp,
 	Tjnz,
+	Tjtab,
 	Tret,
 	Thlt,
 	Texport,
 	Tthread,
+	Tinline,
+	Tnoinline,
+	Talwaysinline,
 	Tfunc,
 	Ttype,
 	Tdata,
@@ -102,10 +106,14 @@ static char *kwmap[Ntok] = {
 	[Tphi] = "phi",
 	[Tjmp] = "jmp",
 	[Tjnz] = "jnz",
+	[Tjtab] = "jtab",
 	[Tret] = "ret",
 	[Thlt] = "hlt",
 	[Texport] = "export",
 	[Tthread] = "thread",
+	[Tinline] = "inline",
+	[Tnoinline] = "noinline",
+	[Talwaysinline] = "alwaysinline",
 	[Tfunc] = "function",
 	[Ttype] = "type",
 	[Tdata] = "data",
@@ -601,6 +609,35 @@ closeblk()
 	curi = insb;
 }
 
+/* ", @b0, @b1, ..." after a jtab argument */
+static void
+parsejtab(Blk *b)
+{
+	Blk *s;
+	uint n;
+
+	b->jtab = vnew(0, sizeof b->jtab[0], PFn);
+	b->jidx = vnew(0, sizeof b->jidx[0], PFn);
+	while (peek() == Tcomma) {
+		next();
+		expect(Tlbl);
+		s = findblk(tokval.str);
+		if (s == curf->start)
+			err("invalid jump to the start block");
+		for (n=0; n<b->njtab; n++)
+			if (b->jtab[n] == s)
+				break;
+		if (n == b->njtab) {
+			vgrow(&b->jtab, ++b->njtab);
+			b->jtab[n] = s;
+		}
+		vgrow(&b->jidx, ++b->njidx);
+		b->jidx[b->njidx-1] = n;
+	}
+	if (b->njidx == 0)
+		err("jtab needs at least one target");
+}
+
 static PState
 parseline(PState ps)
 {
@@ -678,10 +715,24 @@ parseline(PState ps)
 			expect(Tcomma);
 			expect(Tlbl);
 			curb->s2 = findblk(tokval.str);
+			if (peek() == Tcomma) {
+				/* expected value of the argument */
+				next();
+				expect(Tint);
+				curb->jmp.hint = tokval.num ? 1 : 2;
+			}
 		}
 		if (curb->s1 == curf->start || curb->s2 == curf->start)
 			err("invalid jump to the start block");
 		goto Close;
+	case Tjtab:
+		curb->jmp.type = Jjtab;
+		r = parseref();
+		if (req(r, R))
+			err("invalid argument for jtab jump");
+		curb->jmp.arg = r;
+		parsejtab(curb);
+		goto Close;
 	case Thlt:
 		curb->jmp.type = Jhlt;
 	Close:
@@ -891,7 +942,8 @@ typecheck(Fn *fn)
 			if (!usecheck(r, k, fn))
 				goto JErr;
 		}
-		if (b->jmp.type == Jjnz && !usecheck(r, Kw, fn))
+		if ((b->jmp.type == Jjnz || b->jmp.type == Jjtab)
+		&& !usecheck(r, Kw, fn))
 		JErr:
 			err("invalid type for jump argument %%%s in block @%s",
 				fn->tmp[r.val].name, b->name);
@@ -899,6 +951,10 @@ typecheck(Fn *fn)
 			err("block @%s is used undefined", b->s1->name);
 		if (b->s2 && b->s2->jmp.type == Jxxx)
 			err("block @%s is used undefined", b->s2->name);
+		for (n=0; n<b->njtab; n++)
+			if (b->jtab[n]->jmp.type == Jxxx)
+				err("block @%s is used undefined",
+					b->jtab[n]->name);
 	}
 }
 
@@ -1194,6 +1250,15 @@ parselnk(Lnk *lnk)
 		case Tthread:
 			lnk->thread = 1;
 			break;
+		case Tinline:
+			lnk->inl = 1;
+			break;
+		case Tnoinline:
+			lnk->inl = -1;
+			break;
+		case Talwaysinline:
+			lnk->inl = 2;
+			break;
 		case Tsection:
 			if (lnk->sec)
 				err("only one section allowed");
@@ -1208,6 +1273,8 @@ parselnk(Lnk *lnk)
 		default:
 			if (t == Tfunc && lnk->thread)
 				err("only data may have thread linkage");
+			if (t != Tfunc && lnk->inl)
+				err("only functions can be inlined");
 			if (haslnk && t != Tdata && t != Tfunc)
 				err("only data and function have linkage");
 			return t;
@@ -1433,6 +1500,13 @@ printfn(Fn *fn, FILE *f)
 			if (b->s1 != b->link)
 				fprintf(f, "\tjmp @%s\n", b->s1->name);
 			break;
+		case Jjtab:
+			fprintf(f, "\tjtab ");
+			printref(b->jmp.arg, fn, f);
+			for (n=0; n<b->njidx; n++)
+				fprintf(f, ", @%s", b->jtab[b->jidx[n]]->name);
+			fprintf(f, "\n");
+			break;
 		default:
 			fprintf(f, "\t%s ", jtoa[b->jmp.type]);
 			if (b->jmp.type == Jjnz) {
@@ -1440,7 +1514,10 @@ printfn(Fn *fn, FILE *f)
 				fprintf(f, ", ");
 			}
 			assert(b->s1 && b->s2);
-			fprintf(f, "@%s, @%s\n", b->s1->name, b->s2->name);
+			fprintf(f, "@%s, @%s", b->s1->name, b->s2->name);
+			if (b->jmp.hint)
+				fprintf(f, ", %d", b->jmp.hint == 1);
+			fprintf(f, "\n");
 			break;
 		}
 	}
@@ -0,0 +1,375 @@
+#include "all.h"
+
+/*
+ * Profile-guided block layout.
+ *
+ * With -P, each block counts its runs in the record
+ * $__prof_<fn>, which the userlib runtime (prof.c) links
+ * into a list on the first call of the function and writes
+ * out when main returns, as "function block count" lines.
+ * With -p file, the counts are read back and attached to
+ * the blocks of the same name.  Both happen right after the
+ * loop optimizations, so a profile only fits code built at
+ * the same -O level.  Blocks created later get the weight
+ * of the edges that enter them.
+ *
+ * The layout then chains blocks along their heaviest edges,
+ * so the hot successor of a branch falls through, and moves
+ * chains that run much less often than the entry to the end
+ * of the function.  Without a profile, the hints left by
+ * __builtin_expect (jnz %c, @a, @b, 0) weigh the branches.
+ * Functions with neither keep the rpo layout.
+ */
+
+enum {
+	PHash   = 1024,
+	Unit    = 1 << 16, /* entry weight without a profile */
+	HintDiv = 32,      /* share of the unlikely side of a jnz */
+	ColdDiv = 16,      /* chains this much colder than the entry go last */
+};
+
+typedef struct PEnt PEnt;
+typedef struct Edge Edge;
+
+struct PEnt {
+	char *fn;
+	char *blk;
+	uint64_t n;
+	PEnt *link;
+};
+
+struct Edge {
+	Blk *b, *s;
+	uint64_t w;
+	int next;    /* s follows b in rpo */
+};
+
+int profgen;
+
+static PEnt *ptab[PHash];
+static int nprof;
+static char **pname; /* block names at the time of profile() */
+static uint npname;
+static uint64_t *wt;
+
+static uint
+phash(char *fn, char *blk)
+{
+	return (hash(fn) * 31 + hash(blk)) & (PHash-1);
+}
+
+static int
+word(FILE *f, char *buf)
+{
+	int c, n;
+
+	do
+		c = fgetc(f);
+	while (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+	for (n=0; c != EOF && c != ' ' && c != '\t'
+	&& c != '\n' && c != '\r'; c=fgetc(f)) {
+		if (n == NString-1)
+			die("profile: name too long");
+		buf[n++] = c;
+	}
+	buf[n] = 0;
+	return n;
+}
+
+void
+profread(char *file)
+{
+	FILE *f;
+	PEnt *e;
+	char fn[NString], blk[NString], num[NString];
+	uint h;
+
+	f = fopen(file, "r");
+	if (!f)
+		die("cannot open profile '%s'", file);
+	while (word(f, fn)) {
+		if (!word(f, blk) || !word(f, num))
+			die("profile '%s': truncated line", file);
+		h = phash(fn, blk);
+		for (e=ptab[h]; e; e=e->link)
+			if (strcmp(e->fn, fn) == 0 && strcmp(e->blk, blk) == 0)
+				break;
+		if (!e) {
+			e = emalloc(sizeof *e);
+			e->fn = emalloc(strlen(fn) + 1);
+			strcpy(e->fn, fn);
+			e->blk = emalloc(strlen(blk) + 1);
+			strcpy(e->blk, blk);
+			e->link = ptab[h];
+			ptab[h] = e;
+		}
+		/* runs appended to one file add up */
+		e->n += strtoull(num, 0, 10);
+	}
+	fclose(f);
+	nprof = 1;
+}
+
+static Ref
+symref(char *pfx, char *name, int64_t off, Fn *fn)
+{
+	Con c;
+	char buf[NString];
+
+	if (strlen(pfx) + strlen(name) >= NString)
+		die("profile: symbol too long for %s", name);
+	strcpy(buf, pfx);
+	strcat(buf, name);
+	c = (Con){.type = CAddr};
+	c.sym.id = intern(buf);
+	c.bits.i = off;
+	return newcon(&c, fn);
+}
+
+/* count the runs of every block */
+static void
+instrument(Fn *fn)
+{
+	Blk *b;
+	Ins *i0, *i;
+	Ref a, t0, t1;
+	uint n, k, m;
+
+	npname = 0;
+	for (b=fn->start; b; b=b->link)
+		npname++;
+	pname = alloc(npname * sizeof pname[0]);
+	for (n=0, b=fn->start; b; b=b->link, n++) {
+		pname[n] = b->name;
+		for (k=0; k<b->nins && ispar(b->ins[k].op); k++)
+			;
+		m = 0;
+		if (b == fn->start)
+			m += 2;
+		if (isret(b->jmp.type) && strcmp(fn->name, "main") == 0)
+			m += 1;
+		i0 = alloc((b->nins + m + 3) * sizeof i0[0]);
+		icpy(i0, b->ins, k);
+		i = &i0[k];
+		if (b == fn->start) {
+			*i++ = (Ins){Oarg, Kw, R, {symref("__prof_", fn->name, 0, fn)}};
+			*i++ = (Ins){Ocall, Kw, R, {symref("__prof", "enter", 0, fn)}};
+		}
+		a = symref("__prof_", fn->name, 12 + 4*n, fn);
+		t0 = newtmp("prof", Kw, fn);
+		t1 = newtmp("prof", Kw, fn);
+		*i++ = (Ins){Oloadsw, Kw, t0, {a}};
+		*i++ = (Ins){Oadd, Kw, t1, {t0, getcon(1, fn)}};
+		*i++ = (Ins){Ostorew, Kw, R, {t1, a}};
+		i = icpy(i, &b->ins[k], b->nins - k);
+		if (isret(b->jmp.type) && strcmp(fn->name, "main") == 0)
+			*i++ = (Ins){Ocall, Kw, R, {symref("__prof", "exit", 0, fn)}};
+		b->ins = i0;
+		b->nins = i - i0;
+	}
+}
+
+/* with -P, instrument fn; with -p, attach the counts of
+ * its blocks; returns 1 if fn changed
+ */
+int
+profile(Fn *fn)
+{
+	Blk *b;
+	PEnt *e;
+
+	if (profgen) {
+		instrument(fn);
+		return 1;
+	}
+	if (!nprof)
+		return 0;
+	for (b=fn->start; b; b=b->link)
+		for (e=ptab[phash(fn->name, b->name)]; e; e=e->link)
+			if (strcmp(e->fn, fn->name) == 0
+			&& strcmp(e->blk, b->name) == 0) {
+				b->cnt = 1 + e->n;
+				break;
+			}
+	return 0;
+}
+
+/* the record counting the blocks of fn, after the function */
+void
+profdat(Fn *fn, FILE *f)
+{
+	Lnk lnk;
+	Dat d;
+	char name[NString], names[NString], q[NString+2];
+	uint n;
+
+	if (!profgen)
+		return;
+	lnk = (Lnk){.align = 4};
+	strf(name, "__prof_%s", fn->name);
+	strf(names, "__profn_%s", fn->name);
+	d = (Dat){.type = DStart, .name = name, .lnk = &lnk};
+	emitdat(&d, f);
+	d.type = DW;
+	d.u.num = 0;
+	emitdat(&d, f);
+	d.isref = 1;
+	d.u.ref.name = names;
+	d.u.ref.off = 0;
+	emitdat(&d, f);
+	d.isref = 0;
+	d.u.num = npname;
+	emitdat(&d, f);
+	d.type = DZ;
+	d.u.num = 4 * npname;
+	emitdat(&d, f);
+	d.type = DEnd;
+	emitdat(&d, f);
+
+	/* "fn\0block\0block\0..." */
+	d = (Dat){.type = DStart, .name = names, .lnk = &lnk};
+	emitdat(&d, f);
+	for (n=0; n<=npname; n++) {
+		d.type = DB;
+		d.isstr = 1;
+		strf(q, "\"%s\"", n ? pname[n-1] : fn->name);
+		d.u.str = q;
+		emitdat(&d, f);
+		d.isstr = 0;
+		d.u.num = 0;
+		emitdat(&d, f);
+	}
+	d.type = DEnd;
+	emitdat(&d, f);
+}
+
+/* weight of the edge from b to s */
+static uint64_t
+edgew(Blk *b, Blk *s)
+{
+	uint64_t w;
+
+	w = wt[b->id];
+	switch (b->jmp.type) {
+	case Jjnz:
+		if (b->s1 == b->s2)
+			break;
+		if (b->jmp.hint == 0)
+			w /= 2;
+		else if ((b->jmp.hint == 1) == (s == b->s1))
+			w -= w / HintDiv;
+		else
+			w /= HintDiv;
+		break;
+	case Jjtab:
+		w /= b->njtab;
+		break;
+	}
+	return w;
+}
+
+static int
+edgecmp(const void *a, const void *b)
+{
+	const Edge *ea, *eb;
+
+	ea = a;
+	eb = b;
+	if (ea->w != eb->w)
+		return ea->w < eb->w ? 1 : -1;
+	if (ea->next != eb->next)
+		return eb->next - ea->next;
+	if (ea->b->id != eb->b->id)
+		return ea->b->id < eb->b->id ? -1 : 1;
+	return ea->s->id < eb->s->id ? -1 : ea->s->id > eb->s->id;
+}
+
+/* requires rpo and preds, reorders the link chain */
+void
+layout(Fn *fn)
+{
+	Blk *b, *s, **ps, **blk, **nxt, **head, **p;
+	Edge *e;
+	uint n, k, ne, nb;
+	uint64_t w, *cw, cold;
+	int info;
+
+	info = 0;
+	for (b=fn->start; b; b=b->link)
+		if (b->cnt || (b->jmp.type == Jjnz && b->jmp.hint))
+			info = 1;
+	if (!info)
+		return;
+
+	/* block weights, forward edges only */
+	wt = alloc(fn->nblk * sizeof wt[0]);
+	for (n=0; n<fn->nblk; n++) {
+		b = fn->rpo[n];
+		if (b->cnt)
+			wt[n] = b->cnt - 1;
+		else if (n == 0)
+			wt[n] = Unit;
+		else {
+			w = 0;
+			for (k=0; k<b->npred; k++)
+				if (b->pred[k]->id < n)
+					w += edgew(b->pred[k], b);
+			wt[n] = w;
+		}
+	}
+
+	/* chain blocks along the heaviest edges */
+	ne = 0;
+	for (b=fn->start; b; b=b->link)
+		for (ps=succlist(b); *ps; ps++)
+			ne++;
+	e = alloc((ne + 1) * sizeof e[0]);
+	ne = 0;
+	for (b=fn->start; b; b=b->link)
+		for (ps=succlist(b); (s=*ps); ps++) {
+			if (s == fn->start || s == b)
+				continue;
+			w = edgew(b, s);
+			if (w > wt[s->id])
+				w = wt[s->id];
+			e[ne++] = (Edge){b, s, w, s->id == b->id+1};
+		}
+	qsort(e, ne, sizeof e[0], edgecmp);
+	nxt = alloc(fn->nblk * sizeof nxt[0]);
+	head = alloc(fn->nblk * sizeof head[0]);
+	for (n=0; n<fn->nblk; n++)
+		head[n] = fn->rpo[n];
+	for (k=0; k<ne; k++) {
+		b = e[k].b;
+		s = e[k].s;
+		if (head[b->id] == head[s->id] || nxt[b->id]
+		|| head[s->id] != s)
+			continue;
+		nxt[b->id] = s;
+		for (; s; s=nxt[s->id])
+			head[s->id] = head[b->id];
+	}
+
+	/* entry chain first, then hot chains, then cold ones,
+	 * each in rpo order of their first block
+	 */
+	cw = alloc(fn->nblk * sizeof cw[0]);
+	for (n=0; n<fn->nblk; n++)
+		if (cw[head[n]->id] < wt[n])
+			cw[head[n]->id] = wt[n];
+	cold = wt[0] / ColdDiv;
+	blk = alloc(fn->nblk * sizeof blk[0]);
+	nb = 0;
+	for (k=0; k<2; k++)
+		for (n=0; n<fn->nblk; n++) {
+			b = fn->rpo[n];
+			if (head[n] != b || (cw[n] < cold) != k)
+				continue;
+			for (s=b; s; s=nxt[s->id])
+				blk[nb++] = s;
+		}
+	assert(nb == fn->nblk && blk[0] == fn->start);
+	for (p=blk; p<&blk[fn->nblk-1]; p++)
+		(*p)->link = p[1];
+	(*p)->link = 0;
+}
@@ -648,7 +648,15 @@ rega(Fn *fn)
 	/* 4. emit remaining copies in new blocks */
 	blist = 0;
 	for (b=fn->start;; b=b->link) {
-		ps = (Blk**[3]){&b->s1, &b->s2, (Blk*[1]){0}};
+		ps = alloc((3 + b->njtab) * sizeof ps[0]);
+		n = 0;
+		if (b->s1)
+			ps[n++] = &b->s1;
+		if (b->s2)
+			ps[n++] = &b->s2;
+		for (j=0; j<(int)b->njtab; j++)
+			ps[n++] = &b->jtab[j];
+		ps[n] = (Blk*[1]){0};
 		for (; (s=**ps); ps++) {
 			npm = 0;
 			for (p=s->phi; p; p=p->link) {
@@ -377,6 +377,10 @@ spill(Fn *fn)
 		if (s2 && s2->id <= b->id)
 		if (!hd || s2->id >= hd->id)
 			hd = s2;
+		for (n=0; n<b->njtab; n++)
+			if (b->jtab[n]->id <= b->id)
+			if (!hd || b->jtab[n]->id >= hd->id)
+				hd = b->jtab[n];
 		if (hd) {
 			/* back-edge */
 			bszero(v);
@@ -409,6 +413,18 @@ spill(Fn *fn)
 				bsinter(w, u);
 			}
 			limit2(v, 0, 0, w);
+		} else if (b->njtab) {
+			/* as above, over all the targets */
+			bszero(v);
+			for (n=0; n<b->njtab; n++) {
+				liveon(u, b, b->jtab[n]);
+				merge(v, b, u, b->jtab[n]);
+				if (n == 0)
+					bscopy(w, u);
+				else
+					bsinter(w, u);
+			}
+			limit2(v, 0, 0, w);
 		} else {
 			bscopy(v, b->out);
 			if (rtype(b->jmp.arg) == RCall)
@@ -69,6 +69,10 @@ parseattr(struct attr *a, enum attrkind allowed, enum attrprefix prefix)
 			kind = ATTRDESTRUCTOR;
 		} else if (strcmp(name, "packed") == 0) {
 			kind = ATTRPACKED;
+		} else if (strcmp(name, "noinline") == 0) {
+			kind = ATTRNOINLINE;
+		} else if (strcmp(name, "always_inline") == 0) {
+			kind = ATTRALWAYSINLINE;
 		}
 		break;
 	}
@@ -292,6 +292,8 @@ struct decl {
 			/* the function might have an "inline definition" (C11 6.7.4p7) */
 			bool inlinedefn;
 			bool isnoreturn;
+			/* -1 for noinline, 1 for inline, 2 for always_inline */
+			int inlinehint;
 		} func;
 		unsigned long long enumconst;
 		enum builtinkind builtin;
@@ -391,6 +393,8 @@ struct expr {
 		} assign;
 		struct {
 			enum builtinkind kind;
+			/* BUILTINEXPECT: 1 if nonzero is expected, 2 if zero, or 0 */
+			int expect;
 		} builtin;
 		struct {
 			struct type *type;
@@ -488,6 +492,8 @@ enum attrkind {
 	ATTRCONSTRUCTOR = 1<<1,
 	ATTRDESTRUCTOR  = 1<<2,
 	ATTRPACKED      = 1<<3,
+	ATTRNOINLINE    = 1<<4,
+	ATTRALWAYSINLINE = 1<<5,
 };
 
 struct attr {
@@ -51,6 +51,10 @@ enum funcspec {
 
 	FUNCINLINE   = 1<<1,
 	FUNCNORETURN = 1<<2,
+
+	/* from attributes */
+	FUNCNOINLINE     = 1<<3,
+	FUNCALWAYSINLINE = 1<<4,
 };
 
 struct structbuilder {
@@ -336,6 +340,7 @@ declspecs(struct scope *s, enum storageclass *sc, enum funcspec *fs, int *align)
 	int ntypes = 0;
 	unsigned long long i;
 	struct expr *typeofexpr = NULL;
+	struct attr a;
 
 	t = NULL;
 	if (sc)
@@ -464,7 +469,12 @@ declspecs(struct scope *s, enum storageclass *sc, enum funcspec *fs, int *align)
 			break;
 
 		case T__ATTRIBUTE__:
-			gnuattr(NULL, 0);
+			a.kind = 0;
+			gnuattr(&a, fs ? ATTRNOINLINE|ATTRALWAYSINLINE : 0);
+			if (a.kind & ATTRNOINLINE)
+				*fs |= FUNCNOINLINE;
+			if (a.kind & ATTRALWAYSINLINE)
+				*fs |= FUNCALWAYSINLINE;
 			break;
 
 		default:
@@ -1096,6 +1106,12 @@ decl(struct scope *s, struct func *f)
 			d->value = mkglobal(d);
 			d->u.func.inlinedefn = d->linkage == LINKEXTERN && fs & FUNCINLINE && !(sc & SCEXTERN) && (!prior || prior->u.func.inlinedefn);
 			d->u.func.isnoreturn = fs & FUNCNORETURN;
+			if (fs & FUNCNOINLINE)
+				d->u.func.inlinehint = -1;
+			else if (fs & FUNCALWAYSINLINE)
+				d->u.func.inlinehint = 2;
+			else if (fs & FUNCINLINE && !d->u.func.inlinehint)
+				d->u.func.inlinehint = 1;
 			if (tok.kind == TLBRACE) {
 				if (!allowfunc)
 					error(&tok.loc, "function definition not allowed");
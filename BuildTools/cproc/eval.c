@@ -226,6 +226,14 @@ eval(struct expr *expr)
 			binary(expr, expr->op, l, r);
 		}
 		break;
+	case EXPRBUILTIN:
+		/* __builtin_expect(c, v) is just c */
+		if (expr->u.builtin.kind == BUILTINEXPECT) {
+			l = eval(expr->base);
+			if (l->kind == EXPRCONST)
+				return l;
+		}
+		break;
 	}
 
 	return expr;
@@ -803,11 +803,16 @@ builtinfunc(struct scope *s, enum builtinkind kind)
 		e = mkconstexpr(&typeint, eval(condexpr(s))->kind == EXPRCONST);
 		break;
 	case BUILTINEXPECT:
-		/* just a no-op for now */
-		/* TODO: check that the expression and the expected value have type 'long' */
-		e = assignexpr(s);
+		e = exprassign(assignexpr(s), &typelong);
+		e = mkexpr(EXPRBUILTIN, &typelong, e);
+		e->u.builtin.kind = BUILTINEXPECT;
 		expect(TCOMMA, "after expression");
-		delexpr(assignexpr(s));
+		toeval = eval(exprassign(assignexpr(s), &typelong));
+		/* a hint for the branch on the value; none unless constant */
+		e->u.builtin.expect = 0;
+		if (toeval->kind == EXPRCONST)
+			e->u.builtin.expect = toeval->u.constant.u ? 1 : 2;
+		delexpr(toeval);
 		break;
 	case BUILTININFF:
 #ifdef __B32P3__
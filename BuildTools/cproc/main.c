@@ -15,7 +15,8 @@ usage(void)
 	exit(2);
 }
 
-#ifdef __B32P3__
+/* the cc driver calls main with its own arguments */
+#if defined(__B32P3__) && !defined(CC_DRIVER)
 int
 main(void)
 {
@@ -0,0 +1,1048 @@
+
+.text
+; function cast
+cast:
+  add r4 8 r1
+  read 0 r1 r3
+  add r3 12 r1
+  read 0 r1 r2
+  add r3 4 r1
+  read 0 r1 r1
+  and r1 32 r1
+  bne r1 r0 .L5
+  add r3 4 r1
+  read 0 r1 r1
+  and r1 2 r1
+  beq r1 r0 .L5
+  add r4 32 r5
+  read 0 r5 r1
+  shiftl r2 3 r7
+  load 32 r6
+  sub r6 r7 r7
+  load32 -1 r6
+  shiftr r6 r7 r6
+  and r1 r6 r1
+  write 0 r5 r1
+  add r3 40 r3
+  readbu 0 r3 r3
+  beq r3 r0 .L5
+  shiftl r2 3 r2
+  load 1 r3
+  sub r2 r3 r3
+  load 1 r2
+  shiftl r2 r3 r2
+  xor r1 r2 r1
+  sub r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+.L5:
+  jumpr 0 r15
+
+/* end function cast */
+
+.data
+.balign 1
+.Lstring.3:
+	.ascii "internal error; unknown unary expression\000"
+/* end data */
+
+
+.text
+; function unary
+unary:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  load 1 r1
+  write 0 r4 r1
+  add r6 8 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 32 r1
+  beq r1 r0 .L10
+  or r5 256 r5
+.L10:
+  load 333 r1
+  beq r5 r1 .L16
+  load 333 r1
+  bge r5 r1 .L14
+  load 77 r1
+  beq r5 r1 .L15
+  load 77 r1
+  sltu r5 r1 r1
+.L14:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.3 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L17
+.L15:
+  add r6 32 r1
+  read 0 r1 r1
+  sub r0 r1 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L17
+.L16:
+  add r6 32 r1
+  read 0 r1 r1
+  sub r0 r1 r1
+  add r4 32 r2
+  write 0 r2 r1
+.L17:
+  savpc r15
+  add r15 12 r15
+  jump cast
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function unary */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "internal error; unknown binary expression\000"
+/* end data */
+
+
+.text
+; function binary
+binary:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  load 1 r1
+  write 0 r4 r1
+  add r6 8 r1
+  read 0 r1 r1
+  add r1 4 r2
+  read 0 r2 r2
+  and r2 32 r2
+  bne r2 r0 .L27
+  add r1 4 r2
+  read 0 r2 r2
+  and r2 2 r3
+  load 0 r2
+  bne r3 r0 .L24
+  or r0 r2 r1
+  jump .L25
+.L24:
+  add r1 40 r1
+  readbu 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L25:
+  beq r1 r0 .L28
+  or r5 512 r5
+  jump .L28
+.L27:
+  or r5 256 r5
+.L28:
+  load 331 r1
+  blt r5 r1 .L50
+  load 331 r1
+  sub r5 r1 r1
+  load 15 r2
+  blt r1 r2 .L39
+  load 586 r1
+  sub r5 r1 r1
+  load 18 r2
+  bge r1 r2 .L56
+  shiftl r1 2 r2
+  addr2reg .Ljt31 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L32:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  divs r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L33:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  mods r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L34:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  and r2 63 r2
+  shiftrs r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L35:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  slt r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L36:
+  add r6 32 r1
+  read 0 r1 r2
+  add r7 32 r1
+  read 0 r1 r1
+  slt r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L37:
+  add r6 32 r1
+  read 0 r1 r2
+  add r7 32 r1
+  read 0 r1 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L38:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  slt r1 r2 r1
+  xor r1 1 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L39:
+  shiftl r1 2 r2
+  addr2reg .Ljt39 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L40:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  mults r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L41:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L42:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  sub r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L43:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  divu r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L44:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  sltu r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L45:
+  add r6 32 r1
+  read 0 r1 r2
+  add r7 32 r1
+  read 0 r1 r1
+  sltu r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L46:
+  add r6 32 r1
+  read 0 r1 r2
+  add r7 32 r1
+  read 0 r1 r1
+  sltu r1 r2 r1
+  xor r1 1 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L47:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  sltu r1 r2 r1
+  xor r1 1 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L48:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L49:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  xor r1 r2 r1
+  sltu r0 r1 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L50:
+  load 74 r1
+  sub r5 r1 r1
+  load 18 r2
+  bge r1 r2 .L56
+  shiftl r1 2 r2
+  addr2reg .Ljt51 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L52:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  and r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L53:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  mults r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L54:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L55:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  sub r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L56:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L69
+.L57:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  divu r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L58:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  modu r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L59:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  and r2 63 r2
+  shiftl r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L60:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  and r2 63 r2
+  shiftr r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L61:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  sltu r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L62:
+  add r6 32 r1
+  read 0 r1 r2
+  add r7 32 r1
+  read 0 r1 r1
+  sltu r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L63:
+  add r6 32 r1
+  read 0 r1 r2
+  add r7 32 r1
+  read 0 r1 r1
+  sltu r1 r2 r1
+  xor r1 1 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L64:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  sltu r1 r2 r1
+  xor r1 1 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L65:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L66:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  xor r1 r2 r1
+  sltu r0 r1 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L67:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  xor r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+  jump .L69
+.L68:
+  add r6 32 r1
+  read 0 r1 r1
+  add r7 32 r2
+  read 0 r2 r2
+  or r1 r2 r1
+  add r4 32 r2
+  write 0 r2 r1
+.L69:
+  savpc r15
+  add r15 12 r15
+  jump cast
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt31:
+  .int .L52
+  .int .L53
+  .int .L54
+  .int .L55
+  .int .L56
+  .int .L56
+  .int .L32
+  .int .L33
+  .int .L59
+  .int .L34
+  .int .L35
+  .int .L36
+  .int .L37
+  .int .L38
+  .int .L65
+  .int .L66
+  .int .L67
+  .int .L68
+
+.rdata
+.balign 4
+.Ljt39:
+  .int .L40
+  .int .L41
+  .int .L42
+  .int .L56
+  .int .L56
+  .int .L43
+  .int .L56
+  .int .L56
+  .int .L56
+  .int .L44
+  .int .L45
+  .int .L46
+  .int .L47
+  .int .L48
+  .int .L49
+
+.rdata
+.balign 4
+.Ljt51:
+  .int .L52
+  .int .L53
+  .int .L54
+  .int .L55
+  .int .L56
+  .int .L56
+  .int .L57
+  .int .L58
+  .int .L59
+  .int .L60
+  .int .L61
+  .int .L62
+  .int .L63
+  .int .L64
+  .int .L65
+  .int .L66
+  .int .L67
+  .int .L68
+
+/* end function binary */
+
+
+.text
+; function eval
+.global eval
+eval:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  or r0 r4 r1
+  write -32 r14 r1
+  add r1 8 r2
+  read 0 r2 r3
+  write -16 r14 r3
+  read 0 r1 r2
+  load 14 r3
+  bge r2 r3 .L166
+  shiftl r2 2 r3
+  addr2reg .Ljt75 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L76:
+  add r1 32 r2
+  read 0 r2 r2
+  add r2 4 r3
+  read 0 r3 r3
+  load 3 r4
+  bne r3 r4 .L166
+  load 1 r3
+  write 0 r1 r3
+  add r2 36 r2
+  read 0 r2 r2
+  add r1 32 r3
+  write 0 r3 r2
+  jump .L166
+.L78:
+  add r1 32 r2
+  read 0 r2 r2
+  write -8 r14 r2
+  add r2 36 r3
+  add r3 4 r3
+  read 0 r3 r3
+  bne r3 r0 .L166
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump mkglobal
+  or r0 r1 r3
+  read -8 r14 r2
+  read -32 r14 r1
+  add r2 20 r4
+  write 0 r4 r3
+  add r1 32 r1
+  add r1 4 r1
+  read 0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdata
+  read -8 r14 r2
+  read -32 r14 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 32 r3
+  write 0 r3 r2
+  jump .L166
+.L80:
+  add r1 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  or r0 r1 r3
+  read -32 r14 r1
+  write -12 r14 r3
+  add r1 16 r2
+  read 0 r2 r5
+  load 75 r2
+  beq r5 r2 .L166
+  load 75 r2
+  bge r5 r2 .L85
+  load 74 r2
+  beq r5 r2 .L87
+  load 74 r2
+  sltu r5 r2 r2
+.L85:
+  read 0 r3 r2
+  load 1 r4
+  bne r2 r4 .L166
+  or r0 r3 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump unary
+  read -32 r14 r1
+  jump .L166
+.L87:
+  read 0 r3 r2
+  load 7 r4
+  beq r2 r4 .L94
+  load 7 r4
+  bge r2 r4 .L166
+  load 2 r4
+  beq r2 r4 .L92
+  load 2 r3
+  sltu r2 r3 r2
+  jump .L166
+.L92:
+  or r0 r3 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump stringdecl
+  or r0 r1 r3
+  read -12 r14 r1
+  or r0 r1 r2
+  read -32 r14 r1
+  add r2 32 r4
+  write 0 r4 r3
+  load 0 r3
+  write 0 r2 r3
+  add r1 20 r3
+  write 0 r3 r2
+  jump .L166
+.L94:
+  or r0 r3 r2
+  add r2 16 r3
+  read 0 r3 r3
+  load 75 r4
+  bne r3 r4 .L166
+  or r0 r2 r1
+  add r1 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  jump .L166
+.L98:
+  add r1 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  read -16 r14 r3
+  or r0 r1 r2
+  read -32 r14 r1
+  read 0 r2 r4
+  load 1 r5
+  beq r4 r5 .L108
+  add r2 8 r4
+  read 0 r4 r4
+  read 0 r4 r4
+  load 12 r5
+  bne r4 r5 .L166
+  read 0 r3 r5
+  load 1 r4
+  load 12 r6
+  beq r5 r6 .L105
+  add r3 4 r4
+  read 0 r4 r4
+  and r4 2 r5
+  load 0 r4
+  bne r5 r0 .L103
+  or r0 r4 r3
+  jump .L104
+.L103:
+  add r3 12 r3
+  read 0 r3 r3
+  addr2reg typelong+12 r12
+  read 0 r12 r4
+  xor r3 r4 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L104:
+  xor r3 0 r3
+  sltu r0 r3 r3
+  jump .L106
+.L105:
+  or r0 r4 r3
+.L106:
+  beq r3 r0 .L166
+  or r0 r2 r1
+  jump .L166
+.L108:
+  load 1 r4
+  write 0 r1 r4
+  add r2 8 r4
+  read 0 r4 r4
+  add r4 4 r5
+  read 0 r5 r5
+  and r5 2 r6
+  load 0 r5
+  beq r6 r0 .L110
+  add r3 4 r5
+  read 0 r5 r5
+  and r5 32 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L110:
+  bne r5 r0 .L117
+  add r4 4 r4
+  read 0 r4 r4
+  and r4 32 r5
+  load 0 r4
+  bne r5 r0 .L113
+  or r0 r4 r3
+  jump .L114
+.L113:
+  add r3 4 r3
+  read 0 r3 r3
+  and r3 2 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L114:
+  bne r3 r0 .L116
+  add r2 32 r2
+  add r1 32 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  jump .L121
+.L116:
+  add r2 32 r2
+  read 0 r2 r2
+  add r1 32 r3
+  write 0 r3 r2
+  jump .L121
+.L117:
+  or r0 r4 r3
+  add r3 40 r3
+  readbu 0 r3 r3
+  bne r3 r0 .L120
+  add r2 32 r2
+  read 0 r2 r2
+  add r1 32 r3
+  write 0 r3 r2
+  jump .L121
+.L120:
+  add r2 32 r2
+  read 0 r2 r2
+  add r1 32 r3
+  write 0 r3 r2
+.L121:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump cast
+  read -32 r14 r1
+  jump .L166
+.L122:
+  add r1 32 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  write -20 r14 r1
+  read -32 r14 r1
+  add r1 32 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  read -20 r14 r3
+  or r0 r1 r2
+  read -32 r14 r1
+  add r1 32 r4
+  write 0 r4 r3
+  add r1 32 r4
+  add r4 4 r4
+  write 0 r4 r2
+  add r1 16 r4
+  read 0 r4 r5
+  load 92 r4
+  beq r5 r4 .L159
+  load 92 r4
+  blt r5 r4 .L132
+  load 93 r4
+  beq r5 r4 .L127
+  load 93 r4
+  sltu r5 r4 r4
+  jump .L136
+.L127:
+  read 0 r3 r4
+  load 1 r5
+  bne r4 r5 .L166
+  or r0 r2 r1
+  or r0 r1 r2
+  add r3 32 r1
+  read 0 r1 r1
+  bne r1 r0 .L131
+  or r0 r2 r1
+  jump .L166
+.L131:
+  or r0 r3 r1
+  jump .L166
+.L132:
+  load 77 r4
+  beq r5 r4 .L143
+  load 77 r4
+  bge r5 r4 .L136
+  load 76 r4
+  beq r5 r4 .L140
+  load 76 r4
+  sltu r5 r4 r4
+.L136:
+  read 0 r3 r6
+  load 1 r4
+  load 1 r7
+  bne r6 r7 .L138
+  read 0 r2 r4
+  xor r4 1 r4
+  sltu r0 r4 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L138:
+  bne r4 r0 .L166
+  or r0 r2 r7
+  or r0 r3 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump binary
+  read -32 r14 r1
+  jump .L166
+.L140:
+  read 0 r2 r4
+  load 9 r6
+  beq r4 r6 .L142
+  or r0 r3 r4
+  or r0 r2 r3
+  jump .L144
+.L142:
+  or r0 r2 r4
+  jump .L144
+.L143:
+  or r0 r3 r4
+  or r0 r2 r3
+.L144:
+  write -28 r14 r4
+  read 0 r3 r6
+  load 1 r7
+  bne r6 r7 .L166
+  read 0 r4 r6
+  load 1 r7
+  beq r6 r7 .L157
+  load 0 r7
+  write -24 r14 r7
+  load 9 r7
+  xor r6 r7 r7
+  sltu r7 1 r7
+  read -24 r14 r6
+  bne r7 r0 .L148
+  or r0 r6 r7
+  jump .L149
+.L148:
+  add r4 8 r6
+  read 0 r6 r6
+  read 0 r6 r6
+  xor r6 12 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r7
+.L149:
+  load 0 r6
+  bne r7 r0 .L151
+  or r0 r6 r7
+  jump .L152
+.L151:
+  add r4 16 r6
+  read 0 r6 r6
+  xor r6 76 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r7
+.L152:
+  load 0 r6
+  beq r7 r0 .L154
+  add r4 32 r6
+  add r6 4 r6
+  read 0 r6 r6
+  read 0 r6 r6
+  xor r6 1 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L154:
+  beq r6 r0 .L166
+  or r0 r4 r1
+  add r1 32 r1
+  add r1 4 r1
+  read 0 r1 r6
+  or r0 r3 r7
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump binary
+  read -28 r14 r1
+  or r0 r1 r2
+  read -32 r14 r1
+  add r1 16 r4
+  load 76 r3
+  write 0 r4 r3
+  add r2 32 r2
+  read 0 r2 r2
+  add r1 32 r3
+  write 0 r3 r2
+  jump .L166
+.L157:
+  or r0 r4 r2
+  or r0 r3 r7
+  or r0 r2 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump binary
+  read -32 r14 r1
+  jump .L166
+.L159:
+  read 0 r3 r4
+  load 1 r5
+  bne r4 r5 .L166
+  or r0 r3 r1
+  add r1 32 r3
+  read 0 r3 r3
+  beq r3 r0 .L166
+  or r0 r2 r1
+  jump .L166
+.L163:
+  add r1 32 r2
+  read 0 r2 r2
+  load 2 r3
+  bne r2 r3 .L166
+  add r1 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  or r0 r1 r2
+  read -32 r14 r1
+  read 0 r2 r3
+  load 1 r4
+  bne r3 r4 .L166
+  or r0 r2 r1
+.L166:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt75:
+  .int .L76
+  .int .L166
+  .int .L166
+  .int .L166
+  .int .L166
+  .int .L166
+  .int .L78
+  .int .L80
+  .int .L98
+  .int .L122
+  .int .L166
+  .int .L166
+  .int .L166
+  .int .L163
+
+/* end function eval */
+
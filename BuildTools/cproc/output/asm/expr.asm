@@ -0,0 +1,7346 @@
+
+.text
+; function mkexpr
+mkexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r6
+  write -12 r14 r5
+  write -16 r14 r4
+  load 40 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -8 r14 r6
+  read -12 r14 r5
+  read -16 r14 r4
+  add r1 12 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 8 r2
+  write 0 r2 r5
+  add r1 4 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r1 5 r3
+  load 0 r2
+  writeb 0 r3 r2
+  write 0 r1 r4
+  add r1 20 r2
+  write 0 r2 r6
+  add r1 24 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 28 r3
+  load 0 r2
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkexpr */
+
+
+.text
+; function delexpr
+.global delexpr
+delexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  read 0 r4 r1
+  load 3 r2
+  sub r1 r2 r1
+  load 10 r2
+  bge r1 r2 .L18
+  shiftl r1 2 r2
+  addr2reg .Ljt7 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L8:
+  add r4 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -16 r14 r4
+.L9:
+  add r4 32 r1
+  or r0 r4 r2
+  read 0 r1 r4
+  beq r4 r0 .L11
+  add r4 24 r1
+  read 0 r1 r1
+  add r2 32 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -16 r14 r4
+  jump .L9
+.L11:
+  or r0 r2 r4
+  jump .L18
+.L12:
+  add r4 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -16 r14 r4
+  jump .L18
+.L13:
+  add r4 32 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -16 r14 r4
+  add r4 32 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -16 r14 r4
+  jump .L18
+.L14:
+  add r4 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -16 r14 r4
+  add r4 32 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -16 r14 r4
+  add r4 32 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -16 r14 r4
+  jump .L18
+.L15:
+  add r4 20 r1
+  or r0 r4 r2
+  read 0 r1 r4
+  beq r4 r0 .L17
+  add r4 24 r1
+  read 0 r1 r1
+  add r2 20 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -16 r14 r4
+  jump .L15
+.L17:
+  or r0 r2 r4
+.L18:
+  savpc r15
+  add r15 12 r15
+  jump free
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt7:
+  .int .L8
+  .int .L12
+  .int .L12
+  .int .L18
+  .int .L12
+  .int .L12
+  .int .L13
+  .int .L14
+  .int .L18
+  .int .L15
+
+/* end function delexpr */
+
+
+.text
+; function decay
+decay:
+  or r0 r4 r1
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  add r1 8 r2
+  read 0 r2 r2
+  write -12 r14 r2
+  add r1 12 r3
+  read 0 r3 r3
+  write -8 r14 r3
+  read 0 r2 r2
+  load 14 r3
+  beq r2 r3 .L28
+  load 14 r3
+  bge r2 r3 .L29
+  load 13 r3
+  beq r2 r3 .L27
+  load 13 r3
+  sltu r2 r3 r2
+  jump .L29
+.L27:
+  or r0 r1 r5
+  load 74 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  write -16 r14 r1
+  read -8 r14 r2
+  read -12 r14 r1
+  add r1 20 r3
+  read 0 r3 r4
+  add r1 32 r1
+  read 0 r1 r1
+  or r1 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump mkpointertype
+  or r0 r1 r2
+  read -16 r14 r1
+  add r1 8 r3
+  write 0 r3 r2
+  add r1 5 r3
+  load 1 r2
+  writeb 0 r3 r2
+  jump .L29
+.L28:
+  or r0 r1 r5
+  load 74 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  add r1 5 r3
+  load 1 r2
+  writeb 0 r3 r2
+.L29:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function decay */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "'&' operand is not an lvalue or function designator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "cannot take address of bit-field\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "cannot dereference non-pointer\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "internal error: unknown unary operator %d\000"
+/* end data */
+
+
+.text
+; function mkunaryexpr
+mkunaryexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r1
+  write -16 r14 r5
+  write -12 r14 r1
+  load 75 r2
+  beq r1 r2 .L52
+  load 75 r2
+  bge r1 r2 .L36
+  load 74 r2
+  beq r1 r2 .L37
+  load 74 r2
+  sltu r1 r2 r2
+.L36:
+  or r0 r1 r2
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r2 r5
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L60
+.L37:
+  add r5 5 r1
+  readbu 0 r1 r1
+  beq r1 r0 .L39
+  add r5 20 r1
+  read 0 r1 r1
+  write -4 r14 r1
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -4 r14 r5
+.L39:
+  or r0 r5 r1
+  write -8 r14 r1
+  add r1 4 r2
+  readbu 0 r2 r3
+  load 0 r2
+  beq r3 r0 .L41
+  or r0 r2 r3
+  jump .L42
+.L41:
+  add r1 8 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  xor r2 14 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L42:
+  load 0 r2
+  bne r3 r0 .L44
+  or r0 r2 r3
+  jump .L45
+.L44:
+  add r1 8 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  xor r2 15 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L45:
+  load 0 r2
+  beq r3 r0 .L47
+  add r1 8 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  xor r2 16 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L47:
+  beq r2 r0 .L49
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.6 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L49:
+  read 0 r1 r2
+  load 4 r3
+  bne r2 r3 .L51
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.7 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L51:
+  add r1 8 r2
+  read 0 r2 r4
+  add r1 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump mkpointertype
+  or r0 r1 r5
+  read -8 r14 r1
+  or r0 r1 r6
+  load 7 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -12 r14 r2
+  add r1 16 r3
+  write 0 r3 r2
+  jump .L60
+.L52:
+  add r5 8 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  load 12 r2
+  beq r1 r2 .L54
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.8 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L54:
+  read 0 r5 r2
+  load 0 r1
+  load 7 r3
+  bne r2 r3 .L56
+  add r5 16 r1
+  read 0 r1 r1
+  xor r1 74 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L56:
+  bne r1 r0 .L58
+  add r5 8 r1
+  read 0 r1 r1
+  add r1 20 r2
+  or r0 r5 r1
+  read 0 r2 r5
+  or r0 r1 r6
+  load 7 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r4
+  read -16 r14 r5
+  read -12 r14 r1
+  add r5 8 r2
+  read 0 r2 r2
+  add r2 32 r2
+  read 0 r2 r2
+  add r4 12 r3
+  write 0 r3 r2
+  add r4 4 r3
+  load 1 r2
+  writeb 0 r3 r2
+  add r4 16 r2
+  write 0 r2 r1
+  jump .L59
+.L58:
+  add r5 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r1
+  add r5 20 r2
+  read 0 r2 r4
+  add r4 8 r2
+  write 0 r2 r1
+.L59:
+  savpc r15
+  add r15 12 r15
+  jump decay
+.L60:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkunaryexpr */
+
+
+.text
+; function bitfieldwidth
+bitfieldwidth:
+  read 0 r4 r1
+  load 4 r2
+  bne r1 r2 .L65
+  add r4 8 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r1
+  shiftl r1 3 r1
+  add r4 32 r2
+  readh 0 r2 r2
+  sub r1 r2 r1
+  add r4 32 r2
+  add r2 2 r2
+  readh 0 r2 r2
+  sub r1 r2 r1
+  jump .L66
+.L65:
+  load32 -1 r1
+.L66:
+  jumpr 0 r15
+
+/* end function bitfieldwidth */
+
+
+.text
+; function exprconvert
+exprconvert:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r1
+  write -12 r14 r5
+  write -16 r14 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  or r0 r1 r2
+  read -12 r14 r5
+  read -16 r14 r1
+  and r2 0xFF r2
+  bne r2 r0 .L71
+  or r0 r1 r6
+  load 8 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+.L71:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function exprconvert */
+
+
+.text
+; function nullpointer
+nullpointer:
+  read 0 r4 r1
+  load 1 r2
+  bne r1 r2 .L86
+  add r4 8 r1
+  read 0 r1 r1
+  read 0 r1 r2
+  load 17 r3
+  beq r2 r3 .L85
+  add r1 4 r2
+  read 0 r2 r2
+  and r2 2 r3
+  load 0 r2
+  beq r3 r0 .L78
+  or r0 r2 r1
+  jump .L82
+.L78:
+  read 0 r1 r3
+  load 1 r2
+  load 12 r5
+  bne r3 r5 .L80
+  add r1 20 r1
+  read 0 r1 r1
+  addr2reg typevoid r2
+  xor r1 r2 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L81
+.L80:
+  or r0 r2 r1
+.L81:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L82:
+  bne r1 r0 .L84
+  add r4 32 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L87
+.L84:
+  load 0 r1
+  jump .L87
+.L85:
+  load 1 r1
+  jump .L87
+.L86:
+  load 0 r1
+.L87:
+  jumpr 0 r15
+
+/* end function nullpointer */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "assignment to bool must be from arithmetic, pointer, or nullptr_t type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "assignment to pointer must be from pointer or null pointer constant\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "base types of pointer assignment must be compatible or void\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "assignment to pointer discards qualifiers\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "assignment to nullptr_t must be from null pointer constant or expression with type nullptr_t\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "assignment to %s type must be from compatible type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "t->prop & PROPARITH\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "BuildTools/cproc/expr.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "assignment to arithmetic type must be from arithmetic type\000"
+/* end data */
+
+
+.text
+; function exprassign
+.global exprassign
+exprassign:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r5
+  write -12 r14 r4
+  add r4 8 r1
+  read 0 r1 r1
+  write -8 r14 r1
+  read 0 r5 r2
+  load 12 r3
+  blt r2 r3 .L114
+  load 12 r3
+  sub r2 r3 r2
+  load 6 r3
+  bge r2 r3 .L116
+  shiftl r2 2 r3
+  addr2reg .Ljt93 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L94:
+  savpc r15
+  add r15 12 r15
+  jump nullpointer
+  or r0 r1 r2
+  read -8 r14 r1
+  read -16 r14 r5
+  read -12 r14 r4
+  and r2 0xFF r2
+  bne r2 r0 .L128
+  read 0 r1 r2
+  load 12 r3
+  beq r2 r3 .L97
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.15 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r1
+  read -16 r14 r5
+  read -12 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L97:
+  add r5 20 r2
+  read 0 r2 r2
+  load 0 r3
+  addr2reg typevoid r6
+  bne r2 r6 .L99
+  or r0 r3 r6
+  jump .L100
+.L99:
+  add r1 20 r3
+  read 0 r3 r3
+  addr2reg typevoid r6
+  xor r3 r6 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r6
+.L100:
+  load 0 r3
+  bne r6 r0 .L102
+  or r0 r3 r2
+  jump .L104
+.L102:
+  or r0 r2 r4
+  add r1 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  or r0 r1 r2
+  read -8 r14 r1
+  read -16 r14 r5
+  read -12 r14 r4
+  and r2 0xFF r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L104:
+  beq r2 r0 .L106
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.16 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r1
+  read -16 r14 r5
+  read -12 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L106:
+  or r0 r1 r2
+  add r1 32 r1
+  read 0 r1 r2
+  add r5 32 r1
+  read 0 r1 r1
+  and r2 r1 r1
+  beq r1 r2 .L128
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.17 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r5
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L128
+.L108:
+  or r0 r1 r2
+  jump .L110
+.L109:
+  or r0 r1 r2
+.L110:
+  or r0 r5 r1
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  read -16 r14 r5
+  read -12 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L128
+  read 0 r5 r1
+  shiftl r1 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.19 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r5
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L128
+.L112:
+  savpc r15
+  add r15 12 r15
+  jump nullpointer
+  read -16 r14 r5
+  read -12 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L128
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.18 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r5
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L128
+.L114:
+  load 2 r3
+  beq r2 r3 .L120
+  load 2 r3
+  sltu r2 r3 r2
+.L116:
+  add r5 4 r2
+  read 0 r2 r2
+  and r2 8 r2
+  bne r2 r0 .L118
+  load 224 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -8 r14 r1
+  read -16 r14 r5
+  read -12 r14 r4
+.L118:
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 8 r1
+  bne r1 r0 .L128
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.22 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r5
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L128
+.L120:
+  add r1 4 r2
+  read 0 r2 r2
+  and r2 8 r3
+  load 0 r2
+  beq r3 r0 .L122
+  or r0 r2 r3
+  jump .L123
+.L122:
+  read 0 r1 r2
+  xor r2 12 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L123:
+  load 0 r2
+  bne r3 r0 .L125
+  or r0 r2 r1
+  jump .L126
+.L125:
+  read 0 r1 r1
+  xor r1 17 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L126:
+  beq r1 r0 .L128
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.14 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r5
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L128:
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt93:
+  .int .L94
+  .int .L116
+  .int .L116
+  .int .L108
+  .int .L109
+  .int .L112
+
+/* end function exprassign */
+
+
+.text
+; function exprpromote
+.global exprpromote
+exprpromote:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r4 8 r1
+  read 0 r1 r1
+  write -12 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump bitfieldwidth
+  or r0 r1 r5
+  read -12 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump typepromote
+  or r0 r1 r5
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function exprpromote */
+
+
+.text
+; function commonreal
+commonreal:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -32 r14 r5
+  write -24 r14 r4
+  read 0 r4 r4
+  add r4 8 r1
+  read 0 r1 r1
+  write -20 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump bitfieldwidth
+  write -16 r14 r1
+  read -32 r14 r5
+  read 0 r5 r4
+  add r4 8 r1
+  read 0 r1 r6
+  write -12 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump bitfieldwidth
+  or r0 r1 r7
+  read -12 r14 r6
+  read -16 r14 r5
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump typecommonreal
+  read -24 r14 r4
+  write -28 r14 r1
+  read 0 r4 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  or r0 r1 r2
+  read -28 r14 r1
+  read -32 r14 r5
+  read -24 r14 r4
+  write 0 r4 r2
+  read 0 r5 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  or r0 r1 r2
+  read -28 r14 r1
+  read -32 r14 r5
+  write 0 r5 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function commonreal */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "left operand of '%s' operator must be scalar\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "right operand of '%s' operator must be scalar\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "invalid operands to '%s' operator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "pointer operands to '%s' operator are to incompatible types\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "pointer operands to '%s' operator must be to compatible object types\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "invalid operands to '+' operator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "pointer operand to '+' must be to complete object type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "invalid operands to '-' operator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "pointer operand to '-' must be to complete object type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "pointer operands to '-' are to incompatible types\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "operands to '%%' operator must be integer\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "operands to '%s' operator must be arithmetic\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "operands to '%s' operator must be integer\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.39:
+	.ascii "internal error: unknown binary operator %d\000"
+/* end data */
+
+
+.text
+; function mkbinaryexpr
+mkbinaryexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 80 r13
+  or r0 r6 r2
+  write -60 r14 r5
+  write -56 r14 r4
+  write -72 r14 r2
+  write -68 r14 r7
+  add r2 8 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r3
+  write -12 r14 r3
+  add r7 8 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  write -52 r14 r1
+  load 74 r3
+  sub r5 r3 r3
+  load 20 r6
+  bge r3 r6 .L203
+  shiftl r3 2 r6
+  addr2reg .Ljt142 r3
+  add r3 r6 r6
+  read -12 r14 r3
+  read 0 r6 r6
+  jumpr 0 r6
+.L143:
+  add r14 -68 r5
+  add r14 -72 r4
+  savpc r15
+  add r15 12 r15
+  jump commonreal
+  or r0 r1 r5
+  or r0 r5 r1
+  read -60 r14 r5
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L145:
+  and r3 8 r3
+  load 1 r2
+  beq r3 r0 .L147
+  and r1 8 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L148
+.L147:
+  or r0 r2 r1
+.L148:
+  beq r1 r0 .L150
+  shiftl r5 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.37 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L150:
+  add r14 -68 r5
+  add r14 -72 r4
+  savpc r15
+  add r15 12 r15
+  jump commonreal
+  or r0 r1 r5
+  or r0 r5 r1
+  read -60 r14 r5
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L152:
+  and r3 8 r6
+  load 0 r5
+  beq r6 r0 .L154
+  and r1 8 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L154:
+  bne r5 r0 .L173
+  add r7 8 r5
+  read 0 r5 r5
+  read 0 r5 r5
+  load 12 r6
+  beq r5 r6 .L157
+  or r0 r2 r7
+  jump .L159
+.L157:
+  write -72 r14 r7
+  write -68 r14 r2
+  or r0 r3 r1
+.L159:
+  add r7 8 r2
+  read 0 r2 r2
+  read 0 r2 r3
+  load 1 r2
+  load 12 r5
+  bne r3 r5 .L161
+  and r1 2 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L162
+.L161:
+  or r0 r2 r1
+.L162:
+  beq r1 r0 .L164
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.31 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -56 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L164:
+  read -72 r14 r1
+  add r1 8 r1
+  read 0 r1 r5
+  write -24 r14 r5
+  add r5 20 r1
+  read 0 r1 r1
+  add r1 36 r2
+  readbu 0 r2 r3
+  load 1 r2
+  bne r3 r0 .L166
+  read 0 r1 r1
+  xor r1 14 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L167
+.L166:
+  or r0 r2 r1
+.L167:
+  beq r1 r0 .L169
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.32 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L169:
+  read -68 r14 r4
+  addr2reg typeulong r5
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  write -16 r14 r1
+  read -24 r14 r5
+  add r5 20 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r1
+  write -20 r14 r1
+  load 0 r6
+  addr2reg typeulong r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r7
+  read -16 r14 r6
+  read -20 r14 r1
+  read -56 r14 r4
+  add r7 32 r2
+  write 0 r2 r1
+  load 75 r5
+  savpc r15
+  add r15 12 r15
+  jump mkbinaryexpr
+  or r0 r1 r2
+  read -24 r14 r5
+  or r0 r5 r1
+  read -60 r14 r5
+  write -68 r14 r2
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L173:
+  add r14 -68 r5
+  add r14 -72 r4
+  savpc r15
+  add r15 12 r15
+  jump commonreal
+  or r0 r1 r5
+  or r0 r5 r1
+  read -60 r14 r5
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L175:
+  and r3 8 r5
+  load 0 r3
+  beq r5 r0 .L177
+  and r1 8 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L177:
+  bne r3 r0 .L201
+  add r2 8 r2
+  read 0 r2 r2
+  read 0 r2 r3
+  load 1 r2
+  load 12 r5
+  bne r3 r5 .L182
+  and r1 2 r3
+  load 0 r2
+  bne r3 r0 .L181
+  add r7 8 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  xor r2 12 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L181:
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L182:
+  beq r2 r0 .L184
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.33 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -52 r14 r1
+  read -56 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L184:
+  read -72 r14 r2
+  add r2 8 r3
+  read 0 r3 r3
+  add r3 20 r3
+  read 0 r3 r3
+  add r3 36 r3
+  readbu 0 r3 r5
+  load 1 r3
+  bne r5 r0 .L186
+  add r2 8 r2
+  read 0 r2 r2
+  add r2 20 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  xor r2 14 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L187
+.L186:
+  or r0 r3 r2
+.L187:
+  beq r2 r0 .L189
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.34 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -52 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L189:
+  and r1 2 r1
+  bne r1 r0 .L196
+  read -72 r14 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r4
+  read -68 r14 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  and r1 0xFF r1
+  bne r1 r0 .L192
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.35 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L192:
+  read -72 r14 r4
+  addr2reg typelong r5
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  write -28 r14 r1
+  read -68 r14 r4
+  addr2reg typelong r5
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  or r0 r1 r7
+  read -28 r14 r6
+  read -56 r14 r4
+  load 77 r5
+  savpc r15
+  add r15 12 r15
+  jump mkbinaryexpr
+  write -36 r14 r1
+  read -72 r14 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r3
+  write -32 r14 r3
+  load 0 r6
+  addr2reg typelong r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r2
+  read -32 r14 r3
+  read -36 r14 r1
+  add r2 32 r4
+  write 0 r4 r3
+  write -68 r14 r2
+  write -72 r14 r1
+  load 80 r2
+  addr2reg typelong r1
+  or r0 r1 r5
+  or r0 r2 r1
+  jump .L200
+.L196:
+  read -72 r14 r1
+  add r1 8 r1
+  read 0 r1 r5
+  write -48 r14 r5
+  read -68 r14 r4
+  addr2reg typeulong r5
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  write -40 r14 r1
+  read -48 r14 r5
+  add r5 20 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r1
+  write -44 r14 r1
+  load 0 r6
+  addr2reg typeulong r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r7
+  read -40 r14 r6
+  read -44 r14 r1
+  read -56 r14 r4
+  add r7 32 r2
+  write 0 r2 r1
+  load 75 r5
+  savpc r15
+  add r15 12 r15
+  jump mkbinaryexpr
+  or r0 r1 r2
+  read -48 r14 r5
+  or r0 r5 r1
+  read -60 r14 r5
+  write -68 r14 r2
+  or r0 r5 r12
+  or r0 r1 r5
+  or r0 r12 r1
+.L200:
+  write -64 r14 r1
+  jump .L277
+.L201:
+  add r14 -68 r5
+  add r14 -72 r4
+  savpc r15
+  add r15 12 r15
+  jump commonreal
+  or r0 r1 r5
+  or r0 r5 r1
+  read -60 r14 r5
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L203:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.39 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -60 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L205:
+  and r3 2 r3
+  load 1 r2
+  beq r3 r0 .L207
+  and r1 2 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L208
+.L207:
+  or r0 r2 r1
+.L208:
+  beq r1 r0 .L210
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.36 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L210:
+  add r14 -68 r5
+  add r14 -72 r4
+  savpc r15
+  add r15 12 r15
+  jump commonreal
+  or r0 r1 r5
+  or r0 r5 r1
+  read -60 r14 r5
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L212:
+  and r3 2 r3
+  load 1 r2
+  beq r3 r0 .L214
+  or r0 r1 r2
+  and r1 2 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L215
+.L214:
+  or r0 r2 r1
+.L215:
+  beq r1 r0 .L217
+  shiftl r5 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.38 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L217:
+  read -72 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump exprpromote
+  write -72 r14 r1
+  read -68 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump exprpromote
+  read -60 r14 r5
+  write -68 r14 r1
+  read -72 r14 r1
+  add r1 8 r1
+  read 0 r1 r1
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L219:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L223
+.L220:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L223
+.L221:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L223
+.L222:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L223:
+  and r3 4 r6
+  load 0 r3
+  bne r6 r0 .L225
+  or r0 r3 r2
+  jump .L226
+.L225:
+  and r2 4 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L226:
+  bne r2 r0 .L235
+  add r1 8 r2
+  read 0 r2 r2
+  read 0 r2 r3
+  load 0 r2
+  load 12 r6
+  bne r3 r6 .L229
+  add r7 8 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  xor r2 12 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L229:
+  bne r2 r0 .L231
+  shiftl r5 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.28 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -60 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L236
+.L231:
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r4
+  add r7 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  read -60 r14 r5
+  read -56 r14 r4
+  and r1 0xFF r2
+  load 1 r1
+  beq r2 r0 .L233
+  read -72 r14 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  xor r1 14 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L233:
+  beq r1 r0 .L236
+  shiftl r5 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.30 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -60 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L236
+.L235:
+  add r14 -68 r5
+  add r14 -72 r4
+  savpc r15
+  add r15 12 r15
+  jump commonreal
+  read -60 r14 r5
+.L236:
+  addr2reg typeint r1
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L238:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L240
+.L239:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L240:
+  and r3 8 r6
+  load 0 r3
+  bne r6 r0 .L242
+  or r0 r3 r2
+  jump .L243
+.L242:
+  and r2 8 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L243:
+  bne r2 r0 .L267
+  add r1 8 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  load 12 r3
+  bne r2 r3 .L246
+  or r0 r1 r7
+  jump .L247
+.L246:
+  write -72 r14 r7
+  write -68 r14 r1
+.L247:
+  add r7 8 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  load 12 r2
+  beq r1 r2 .L249
+  shiftl r5 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.28 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L249:
+  read -68 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump nullpointer
+  and r1 0xFF r1
+  bne r1 r0 .L265
+  read -72 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump nullpointer
+  read -60 r14 r5
+  read -56 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L263
+  read -68 r14 r1
+  add r1 8 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  load 12 r2
+  beq r1 r2 .L253
+  shiftl r5 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.28 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L253:
+  read -72 r14 r1
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 20 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  load 1 r3
+  bne r2 r3 .L255
+  or r0 r1 r2
+  read -68 r14 r1
+  write -72 r14 r1
+  write -68 r14 r2
+.L255:
+  read -68 r14 r4
+  add r4 8 r2
+  read 0 r2 r2
+  add r2 20 r2
+  read 0 r2 r2
+  read 0 r2 r3
+  load 0 r2
+  load 1 r5
+  bne r3 r5 .L257
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 20 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  xor r2 14 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L257:
+  bne r2 r0 .L260
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 20 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  read -60 r14 r5
+  read -56 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L261
+  shiftl r5 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.29 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -60 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L261
+.L260:
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  read -60 r14 r5
+  write -68 r14 r1
+.L261:
+  addr2reg typeint r1
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L263:
+  read -72 r14 r4
+  read -68 r14 r1
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  read -60 r14 r5
+  write -72 r14 r1
+  addr2reg typeint r1
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L265:
+  read -68 r14 r4
+  read -72 r14 r1
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  read -60 r14 r5
+  write -68 r14 r1
+  addr2reg typeint r1
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L267:
+  add r14 -68 r5
+  add r14 -72 r4
+  savpc r15
+  add r15 12 r15
+  jump commonreal
+  read -60 r14 r5
+  addr2reg typeint r1
+  write -64 r14 r5
+  or r0 r1 r5
+  jump .L277
+.L269:
+  or r0 r3 r2
+  jump .L271
+.L270:
+  or r0 r3 r2
+.L271:
+  and r2 16 r2
+  bne r2 r0 .L273
+  shiftl r5 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.26 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -52 r14 r1
+  read -60 r14 r5
+  read -56 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L273:
+  and r1 16 r1
+  bne r1 r0 .L275
+  shiftl r5 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.27 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -60 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L275:
+  addr2reg typeint r1
+  write -64 r14 r5
+  or r0 r1 r5
+.L277:
+  load 0 r6
+  load 9 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -64 r14 r5
+  add r1 16 r2
+  write 0 r2 r5
+  read -72 r14 r2
+  add r1 32 r3
+  write 0 r3 r2
+  read -68 r14 r2
+  add r1 32 r3
+  add r3 4 r3
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt142:
+  .int .L143
+  .int .L145
+  .int .L152
+  .int .L175
+  .int .L203
+  .int .L203
+  .int .L145
+  .int .L205
+  .int .L212
+  .int .L212
+  .int .L219
+  .int .L220
+  .int .L221
+  .int .L222
+  .int .L238
+  .int .L239
+  .int .L143
+  .int .L143
+  .int .L269
+  .int .L270
+
+/* end function mkbinaryexpr */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "u\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.44:
+	.ascii "l\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.45:
+	.ascii "ul\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.46:
+	.ascii "lu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.47:
+	.ascii "ll\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.48:
+	.ascii "ull\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.49:
+	.ascii "llu\000"
+/* end data */
+
+.data
+.balign 4
+.Llimits.41:
+	.int typeint+0
+	.int .Lstring.42+0
+	.int 0
+	.int typeuint+0
+	.int .Lstring.43+0
+	.int 0
+	.int typelong+0
+	.int .Lstring.44+0
+	.int 0
+	.int typeulong+0
+	.int .Lstring.45+0
+	.int .Lstring.46+0
+	.int typellong+0
+	.int .Lstring.47+0
+	.int 0
+	.int typeullong+0
+	.int .Lstring.48+0
+	.int .Lstring.49+0
+/* end data */
+
+.data
+.balign 1
+.Lstring.50:
+	.ascii "invalid integer constant suffix '%s'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.51:
+	.ascii "no suitable type for constant '%s'\000"
+/* end data */
+
+
+.text
+; function inttype
+inttype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -28 r14 r5
+  write -32 r14 r4
+  write -24 r14 r6
+  load 0 r1
+.L282:
+  write -20 r14 r1
+  add r6 r1 r2
+  readb 0 r2 r2
+  beq r2 r0 .L285
+  add r6 r1 r1
+  readb 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tolower
+  or r0 r1 r2
+  read -20 r14 r1
+  read -24 r14 r6
+  add r6 r1 r3
+  writeb 0 r3 r2
+  add r1 1 r1
+  jump .L282
+.L285:
+  load 0 r1
+.L286:
+  write -4 r14 r1
+  load 6 r2
+  bge r1 r2 .L294
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg .Llimits.41 r1
+  add r1 r2 r1
+  add r1 4 r1
+  read 0 r1 r5
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -4 r14 r1
+  read -24 r14 r6
+  beq r2 r0 .L293
+  load 12 r2
+  mults r1 r2 r3
+  addr2reg .Llimits.41 r2
+  add r2 r3 r2
+  add r2 8 r2
+  read 0 r2 r3
+  load 0 r2
+  beq r3 r0 .L290
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg .Llimits.41 r1
+  add r1 r2 r1
+  add r1 8 r1
+  read 0 r1 r5
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -4 r14 r1
+  read -24 r14 r6
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L290:
+  bne r2 r0 .L292
+  add r1 1 r1
+  jump .L286
+.L292:
+  read -28 r14 r5
+  read -32 r14 r4
+  jump .L295
+.L293:
+  read -28 r14 r5
+  read -32 r14 r4
+  jump .L295
+.L294:
+  read -28 r14 r5
+  read -32 r14 r4
+.L295:
+  load 6 r2
+  bne r1 r2 .L297
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.50 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -4 r14 r1
+  read -28 r14 r5
+  read -32 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L297:
+  and r1 1 r3
+  load 1 r2
+  bne r3 r0 .L299
+  and r5 0xFF r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L299:
+  bne r2 r0 .L302
+  load 1 r2
+  write -8 r14 r2
+  jump .L304
+.L302:
+  load 2 r2
+  write -8 r14 r2
+.L304:
+  write -16 r14 r1
+  load 6 r2
+  bge r1 r2 .L308
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg .Llimits.41 r1
+  add r1 r2 r1
+  read 0 r1 r3
+  write -12 r14 r3
+  load 0 r6
+  or r0 r4 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump typehasint
+  or r0 r1 r5
+  read -16 r14 r1
+  read -12 r14 r3
+  read -8 r14 r2
+  read -32 r14 r4
+  and r5 0xFF r5
+  bne r5 r0 .L307
+  add r1 r2 r1
+  jump .L304
+.L307:
+  or r0 r3 r1
+  jump .L309
+.L308:
+  addr2reg tok+20 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.51 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+.L309:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function inttype */
+
+.data
+.balign 1
+.Lstring.54:
+	.ascii "isxdigit(*s)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.55:
+	.ascii "isodigit(*s)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.56:
+	.ascii "%s contains invalid UTF-8\000"
+/* end data */
+
+
+.text
+; function decodechar
+decodechar:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 60 r13
+  read 8 r14 r1
+  write -8 r14 r1
+  write -12 r14 r7
+  write -48 r14 r6
+  or r0 r5 r3
+  write -44 r14 r3
+  write -36 r14 r4
+  readbu 0 r4 r1
+  load 92 r2
+  beq r1 r2 .L317
+  load 4 r6
+  or r0 r4 r5
+  add r14 -52 r4
+  savpc r15
+  add r15 12 r15
+  jump utf8dec
+  read -8 r14 r4
+  read -12 r14 r6
+  read -44 r14 r3
+  or r0 r4 r2
+  read -36 r14 r4
+  write -16 r14 r1
+  load32 -1 r5
+  bne r1 r5 .L316
+  or r0 r2 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.56 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r1
+  read -44 r14 r3
+  read -36 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L316:
+  add r4 r1 r1
+  jump .L364
+.L317:
+  add r4 1 r1
+  write -40 r14 r1
+  readbu 0 r1 r2
+  load 63 r5
+  beq r2 r5 .L363
+  load 63 r5
+  blt r2 r5 .L343
+  load 110 r5
+  blt r2 r5 .L338
+  load 110 r5
+  sub r2 r5 r5
+  load 11 r6
+  bge r5 r6 .L347
+  shiftl r5 2 r6
+  addr2reg .Ljt322 r5
+  add r5 r6 r5
+  read 0 r5 r5
+  jumpr 0 r5
+.L323:
+  load 10 r2
+  write -52 r14 r2
+  add r1 1 r1
+  jump .L364
+.L324:
+  load 13 r2
+  write -52 r14 r2
+  add r1 1 r1
+  jump .L364
+.L325:
+  load 9 r2
+  write -52 r14 r2
+  add r1 1 r1
+  jump .L364
+.L326:
+  load 11 r2
+  write -52 r14 r2
+  add r1 1 r1
+  jump .L364
+.L327:
+  add r1 1 r1
+  write -20 r14 r1
+  readbu 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isxdigit
+  or r0 r1 r2
+  read -20 r14 r1
+  bne r2 r0 .L329
+  load 451 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.54 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -20 r14 r1
+.L329:
+  load 0 r2
+  write -52 r14 r2
+.L330:
+  write -28 r14 r1
+  read -52 r14 r2
+  shiftl r2 4 r2
+  write -24 r14 r2
+  readbu 0 r1 r4
+  load 57 r3
+  bgts r4 r3 .L332
+  load 48 r3
+  sub r4 r3 r3
+  jump .L333
+.L332:
+  savpc r15
+  add r15 12 r15
+  jump tolower
+  or r0 r1 r4
+  read -24 r14 r2
+  read -28 r14 r1
+  load 10 r3
+  add r3 r4 r3
+  load 97 r4
+  sub r3 r4 r3
+.L333:
+  add r2 r3 r2
+  write -52 r14 r2
+  add r1 1 r1
+  write -32 r14 r1
+  readbu 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isxdigit
+  or r0 r1 r2
+  read -32 r14 r1
+  bne r2 r0 .L330
+  read -48 r14 r5
+  read -44 r14 r3
+  read -36 r14 r4
+  beq r5 r0 .L364
+  load 1 r2
+  writeb 0 r5 r2
+  jump .L364
+.L338:
+  load 92 r5
+  sub r2 r5 r5
+  load 11 r6
+  bge r5 r6 .L347
+  shiftl r5 2 r6
+  addr2reg .Ljt339 r5
+  add r5 r6 r5
+  read 0 r5 r5
+  jumpr 0 r5
+.L340:
+  load 7 r2
+  write -52 r14 r2
+  add r1 1 r1
+  jump .L364
+.L341:
+  load 8 r2
+  write -52 r14 r2
+  add r1 1 r1
+  jump .L364
+.L342:
+  load 12 r2
+  write -52 r14 r2
+  add r1 1 r1
+  jump .L364
+.L343:
+  load 39 r5
+  beq r2 r5 .L363
+  load 39 r5
+  bge r2 r5 .L347
+  load 34 r5
+  beq r2 r5 .L363
+  load 34 r3
+  sltu r2 r3 r3
+.L347:
+  load 0 r3
+  load 48 r5
+  bles r5 r2 .L349
+  or r0 r3 r2
+  jump .L350
+.L349:
+  load 56 r3
+  slt r3 r2 r2
+  xor r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L350:
+  bne r2 r0 .L352
+  load 459 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.55 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -40 r14 r1
+  read -36 r14 r4
+.L352:
+  load 0 r2
+  write -52 r14 r2
+  load 0 r3
+  load 0 r2
+.L353:
+  shiftl r2 3 r2
+  or r0 r1 r5
+  add r1 1 r1
+  readbu 0 r5 r5
+  load 48 r6
+  sub r5 r6 r5
+  add r2 r5 r2
+  write -52 r14 r2
+  add r3 1 r3
+  load 0 r5
+  load 3 r6
+  bges r3 r6 .L359
+  readbu 0 r1 r6
+  load 0 r5
+  load 48 r7
+  bgts r7 r6 .L358
+  load 56 r5
+  slt r5 r6 r5
+  xor r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L358:
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L359:
+  bne r5 r0 .L353
+  read -48 r14 r5
+  read -44 r14 r3
+  beq r5 r0 .L364
+  load 1 r2
+  writeb 0 r5 r2
+  jump .L364
+.L363:
+  write -52 r14 r2
+  add r1 1 r1
+.L364:
+  read -52 r14 r2
+  write 0 r3 r2
+  sub r1 r4 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt322:
+  .int .L323
+  .int .L347
+  .int .L347
+  .int .L347
+  .int .L324
+  .int .L347
+  .int .L325
+  .int .L347
+  .int .L326
+  .int .L347
+  .int .L327
+
+.rdata
+.balign 4
+.Ljt339:
+  .int .L363
+  .int .L347
+  .int .L347
+  .int .L347
+  .int .L347
+  .int .L340
+  .int .L341
+  .int .L347
+  .int .L347
+  .int .L347
+  .int .L342
+
+/* end function decodechar */
+
+.data
+.balign 4
+.Lparts.61:
+	.fill 12,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.62:
+	.ascii "tok.kind == TSTRINGLIT\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.63:
+	.ascii "0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.64:
+	.ascii "adjacent string literals have differing prefixes\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.65:
+	.ascii "string literal\000"
+/* end data */
+
+
+.text
+; function stringconcat
+.global stringconcat
+stringconcat:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 96 r13
+  write -36 r14 r5
+  write -68 r14 r4
+  addr2reg tok r12
+  read 0 r12 r1
+  load 7 r2
+  beq r1 r2 .L370
+  load 519 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.62 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+.L370:
+  load 0 r1
+  addr2reg .Lparts.61+4 r12
+  write 0 r12 r1
+  load 0 r3
+  load32 -559030611 r2
+  load 0 r1
+  write -4 r14 r2
+  write -20 r14 r1
+  or r0 r3 r1
+.L372:
+  write -12 r14 r1
+  addr2reg tok+20 r12
+  read 0 r12 r4
+  write -8 r14 r4
+  or r0 r1 r2
+  readb 0 r4 r1
+  load 85 r3
+  beq r1 r3 .L390
+  load 85 r3
+  blt r1 r3 .L380
+  load 117 r3
+  beq r1 r3 .L377
+  load 117 r2
+  sltu r1 r2 r1
+  jump .L384
+.L377:
+  or r0 r2 r1
+  or r0 r1 r2
+  add r4 1 r1
+  readb 0 r1 r1
+  load 56 r3
+  bne r1 r3 .L389
+  add r4 1 r4
+  jump .L389
+.L380:
+  load 76 r3
+  beq r1 r3 .L389
+  load 76 r3
+  bge r1 r3 .L384
+  load 34 r3
+  beq r1 r3 .L386
+  load 34 r2
+  sltu r1 r2 r1
+.L384:
+  load 530 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.63 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r1
+  read -4 r14 r2
+  read -8 r14 r4
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  write -16 r14 r4
+  jump .L393
+.L386:
+  or r0 r2 r1
+  load 0 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  write -16 r14 r4
+  jump .L393
+.L389:
+  or r0 r2 r1
+  jump .L391
+.L390:
+  or r0 r2 r1
+.L391:
+  or r0 r1 r2
+  readb 0 r4 r1
+  add r4 1 r4
+  write -16 r14 r4
+.L393:
+  write -32 r14 r1
+  load 0 r3
+  bne r2 r1 .L395
+  or r0 r3 r4
+  jump .L396
+.L395:
+  xor r2 0 r3
+  sltu r0 r3 r4
+.L396:
+  load 0 r3
+  beq r4 r0 .L398
+  xor r1 0 r3
+  sltu r0 r3 r3
+.L398:
+  beq r3 r0 .L400
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.64 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -32 r14 r1
+  read -12 r14 r2
+  load32 -24 r3
+  sub r13 r3 r13
+.L400:
+  bne r1 r0 .L402
+  write -28 r14 r2
+  jump .L403
+.L402:
+  write -28 r14 r1
+.L403:
+  load 16 r5
+  addr2reg .Lparts.61 r4
+  savpc r15
+  add r15 12 r15
+  jump arrayadd
+  or r0 r1 r2
+  read -16 r14 r4
+  addr2reg tok+8 r12
+  read 0 r12 r1
+  write 0 r2 r1
+  add r2 4 r1
+  addr2reg tok+12 r12
+  read 0 r12 r3
+  write 0 r1 r3
+  add r1 4 r3
+  addr2reg tok+16 r12
+  read 0 r12 r1
+  write 0 r3 r1
+  add r4 1 r1
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  read -20 r14 r3
+  load 2 r2
+  sub r1 r2 r1
+  add r3 r1 r3
+  write -24 r14 r3
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -28 r14 r1
+  or r0 r1 r2
+  read -32 r14 r1
+  read -24 r14 r3
+  addr2reg tok r12
+  read 0 r12 r4
+  load 7 r5
+  bne r4 r5 .L406
+  write -4 r14 r1
+  or r0 r2 r1
+  write -20 r14 r3
+  jump .L372
+.L406:
+  or r0 r2 r1
+  read -36 r14 r5
+  and r5 0xFF r2
+  beq r2 r0 .L409
+  load 56 r1
+.L409:
+  add r3 1 r5
+  write -40 r14 r5
+  load 76 r2
+  beq r1 r2 .L425
+  load 76 r2
+  blt r1 r2 .L418
+  load 117 r2
+  beq r1 r2 .L417
+  load 117 r2
+  bge r1 r2 .L422
+  load 85 r2
+  beq r1 r2 .L416
+  load 85 r2
+  sltu r1 r2 r1
+  jump .L422
+.L416:
+  addr2reg typeuint r1
+  jump .L426
+.L417:
+  addr2reg typeushort r1
+  jump .L426
+.L418:
+  load 56 r2
+  beq r1 r2 .L424
+  load 56 r2
+  bge r1 r2 .L422
+  beq r1 r0 .L423
+  sltu r1 r0 r1
+.L422:
+  load 551 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.63 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -40 r14 r5
+  load32 -559030611 r1
+  jump .L426
+.L423:
+  addr2reg typechar r1
+  jump .L426
+.L424:
+  addr2reg typeuchar r1
+  jump .L426
+.L425:
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 8 r1
+  read 0 r1 r1
+.L426:
+  write -80 r14 r1
+  add r1 12 r1
+  read 0 r1 r1
+  load 2 r2
+  beq r1 r2 .L439
+  load 2 r2
+  blt r1 r2 .L433
+  load 4 r2
+  beq r1 r2 .L431
+  load 4 r2
+  sltu r1 r2 r1
+  jump .L435
+.L431:
+  addr2reg encodechar32 r2
+  load 4 r1
+  write -52 r14 r2
+  jump .L441
+.L433:
+  load 1 r2
+  beq r1 r2 .L437
+  load 1 r2
+  sltu r1 r2 r1
+.L435:
+  load 567 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.63 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -40 r14 r5
+  load32 -559030611 r2
+  load32 -559030611 r1
+  write -52 r14 r2
+  jump .L441
+.L437:
+  addr2reg encodechar8 r2
+  load 1 r1
+  write -52 r14 r2
+  jump .L441
+.L439:
+  addr2reg encodechar16 r2
+  load 2 r1
+  write -52 r14 r2
+.L441:
+  or r0 r1 r3
+  write -76 r14 r3
+  or r0 r3 r6
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump xreallocarray
+  or r0 r1 r2
+  read -68 r14 r4
+  write -72 r14 r2
+  add r4 4 r1
+  write 0 r1 r2
+  addr2reg .Lparts.61 r12
+  read 0 r12 r3
+.L442:
+  write -56 r14 r3
+  write -44 r14 r2
+  addr2reg .Lparts.61 r12
+  read 0 r12 r1
+  addr2reg .Lparts.61+4 r12
+  read 0 r12 r4
+  add r1 r4 r1
+  beq r3 r1 .L450
+  add r3 12 r1
+  read 0 r1 r1
+  write -64 r14 r2
+.L445:
+  write -48 r14 r1
+  readb 0 r1 r2
+  load 34 r4
+  beq r2 r4 .L448
+  load 0 r2
+  writeb -84 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r3
+  addr2reg .Lstring.65 r7
+  add r14 -84 r6
+  add r14 -88 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump decodechar
+  or r0 r1 r3
+  read -48 r14 r1
+  read -64 r14 r2
+  read -52 r14 r7
+  load32 -12 r4
+  sub r13 r4 r13
+  add r1 r3 r1
+  write -60 r14 r1
+  read -88 r14 r5
+  readbu -84 r14 r6
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r7
+  or r0 r1 r4
+  read -64 r14 r2
+  read -56 r14 r3
+  read -52 r14 r7
+  read -60 r14 r1
+  add r2 r4 r2
+  write -64 r14 r2
+  jump .L445
+.L448:
+  read -64 r14 r2
+  read -52 r14 r7
+  add r3 16 r3
+  jump .L442
+.L450:
+  read -52 r14 r7
+  load 0 r6
+  load 0 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r7
+  or r0 r1 r5
+  read -44 r14 r2
+  read -76 r14 r3
+  read -80 r14 r1
+  or r0 r2 r7
+  read -72 r14 r2
+  read -68 r14 r4
+  add r7 r5 r5
+  sub r5 r2 r2
+  divu r2 r3 r2
+  write 0 r4 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function stringconcat */
+
+.data
+.balign 1
+.Lstring.67:
+	.ascii "after '_Generic'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.68:
+	.ascii "after generic selector expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.69:
+	.ascii "multiple default expressions in generic association list\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.70:
+	.ascii "after 'default'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.71:
+	.ascii "expected typename for generic association\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.72:
+	.ascii "generic association must have object type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.73:
+	.ascii "generic association must have complete type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.74:
+	.ascii "generic association has variably modified type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.75:
+	.ascii "after type name\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.76:
+	.ascii "generic selector matches multiple associations\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.77:
+	.ascii "after generic assocation list\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.78:
+	.ascii "generic selector matches no associations and no default was specified\000"
+/* end data */
+
+
+.text
+; function generic
+generic:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 60 r13
+  write -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump next
+  addr2reg .Lstring.67 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  write -16 r14 r1
+  addr2reg .Lstring.68 r5
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -16 r14 r4
+  add r4 8 r1
+  read 0 r1 r3
+  write -36 r14 r3
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  load 0 r2
+  load 0 r1
+  write -32 r14 r2
+  write -28 r14 r1
+.L457:
+  load 18 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -28 r14 r3
+  read -40 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L475
+  load 0 r1
+  write -52 r14 r1
+  load 0 r6
+  add r14 -52 r5
+  savpc r15
+  add r15 12 r15
+  jump typename
+  or r0 r1 r4
+  write -20 r14 r4
+  bne r4 r0 .L460
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.71 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -20 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L460:
+  read 0 r4 r1
+  load 14 r2
+  bne r1 r2 .L462
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.72 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -20 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L462:
+  add r4 36 r1
+  readbu 0 r1 r1
+  beq r1 r0 .L464
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.73 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -20 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L464:
+  add r4 4 r1
+  read 0 r1 r1
+  and r1 64 r1
+  beq r1 r0 .L466
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.74 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L466:
+  addr2reg .Lstring.75 r5
+  load 95 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  write -24 r14 r1
+  read -20 r14 r4
+  read -36 r14 r3
+  or r0 r3 r5
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  or r0 r1 r4
+  read -32 r14 r1
+  read -28 r14 r3
+  read -24 r14 r2
+  and r4 0xFF r5
+  load 0 r4
+  beq r5 r0 .L468
+  read -52 r14 r4
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L468:
+  bne r4 r0 .L471
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -32 r14 r1
+  or r0 r1 r3
+  read -28 r14 r1
+  or r0 r3 r2
+  jump .L474
+.L471:
+  or r0 r1 r12
+  or r0 r3 r1
+  or r0 r12 r3
+  beq r3 r0 .L474
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.76 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -28 r14 r1
+  read -24 r14 r2
+  load32 -24 r3
+  sub r13 r3 r13
+.L474:
+  write -44 r14 r2
+  write -48 r14 r1
+  jump .L480
+.L475:
+  or r0 r3 r1
+  beq r1 r0 .L478
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.69 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L478:
+  addr2reg .Lstring.70 r5
+  load 95 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r2
+  read -32 r14 r1
+  write -44 r14 r1
+  write -48 r14 r2
+.L480:
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r5
+  read -44 r14 r1
+  or r0 r1 r2
+  read -48 r14 r1
+  read -36 r14 r3
+  read -40 r14 r4
+  and r5 0xFF r5
+  beq r5 r0 .L482
+  write -32 r14 r2
+  write -28 r14 r1
+  jump .L457
+.L482:
+  addr2reg .Lstring.77 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -44 r14 r1
+  or r0 r1 r2
+  read -48 r14 r1
+  beq r2 r0 .L486
+  bne r1 r0 .L485
+  or r0 r2 r1
+  jump .L488
+.L485:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -44 r14 r1
+  jump .L488
+.L486:
+  bne r1 r0 .L488
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.78 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -48 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L488:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function generic */
+
+.data
+.balign 1
+.Lstring.80:
+	.ascii "undeclared identifier: %s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.81:
+	.ascii "*src == '\134''\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.82:
+	.ascii "character constant\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.83:
+	.ascii "character constant contains more than one character: %c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.84:
+	.ascii ".pP\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.85:
+	.ascii ".eE\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.86:
+	.ascii "floating point constants not supported on this target\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.87:
+	.ascii "invalid integer constant '%s'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.88:
+	.ascii "after expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.89:
+	.ascii "expected primary expression\000"
+/* end data */
+
+
+.text
+; function primaryexpr
+primaryexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 80 r13
+  write -4 r14 r4
+  addr2reg tok r12
+  read 0 r12 r1
+  load 44 r2
+  beq r1 r2 .L562
+  load 44 r2
+  blt r1 r2 .L500
+  load 66 r2
+  beq r1 r2 .L499
+  load 66 r2
+  bge r1 r2 .L506
+  load 59 r2
+  beq r1 r2 .L498
+  load 59 r2
+  sltu r1 r2 r1
+  jump .L506
+.L498:
+  savpc r15
+  add r15 12 r15
+  jump generic
+  jump .L563
+.L499:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -4 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump expr
+  write -8 r14 r1
+  addr2reg .Lstring.88 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -8 r14 r1
+  jump .L563
+.L500:
+  load 24 r2
+  beq r1 r2 .L562
+  load 24 r2
+  blt r1 r2 .L505
+  load 32 r2
+  beq r1 r2 .L504
+  load 32 r2
+  sltu r1 r2 r1
+  jump .L506
+.L504:
+  load 0 r6
+  addr2reg typenullptr r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  write -12 r14 r1
+  add r1 32 r2
+  load 0 r1
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -12 r14 r1
+  jump .L563
+.L505:
+  load 4 r2
+  sub r1 r2 r1
+  load 4 r2
+  blt r1 r2 .L507
+.L506:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.89 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L563
+.L507:
+  shiftl r1 2 r2
+  addr2reg .Ljt507 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L508:
+  addr2reg tok+20 r12
+  read 0 r12 r5
+  load 1 r6
+  savpc r15
+  add r15 12 r15
+  jump scopegetdecl
+  or r0 r1 r2
+  write -16 r14 r2
+  bne r2 r0 .L510
+  addr2reg tok+20 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.80 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L510:
+  add r2 12 r1
+  read 0 r1 r5
+  load 0 r6
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -16 r14 r2
+  add r2 16 r3
+  read 0 r3 r3
+  add r1 12 r4
+  write 0 r4 r3
+  add r2 4 r3
+  read 0 r3 r3
+  xor r3 1 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  add r1 4 r4
+  writeb 0 r4 r3
+  add r1 32 r3
+  write 0 r3 r2
+  add r2 4 r2
+  read 0 r2 r2
+  load 4 r3
+  bne r2 r3 .L512
+  write -20 r14 r1
+  jump .L514
+.L512:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump decay
+  write -20 r14 r1
+.L514:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -20 r14 r1
+  jump .L563
+.L515:
+  load 0 r6
+  load 0 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  write -32 r14 r1
+  addr2reg tok+20 r12
+  read 0 r12 r1
+  add r1 0 r2
+  readb 0 r2 r2
+  load 48 r3
+  beq r2 r3 .L517
+  load 10 r1
+  jump .L525
+.L517:
+  add r1 1 r1
+  readb 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tolower
+  load 120 r2
+  beq r1 r2 .L524
+  load 120 r2
+  bge r1 r2 .L522
+  load 98 r2
+  beq r1 r2 .L523
+  load 98 r2
+  sltu r1 r2 r1
+.L522:
+  load 8 r1
+  jump .L525
+.L523:
+  load 2 r1
+  jump .L525
+.L524:
+  load 16 r1
+.L525:
+  write -28 r14 r1
+  addr2reg tok+20 r12
+  read 0 r12 r4
+  load 16 r2
+  beq r1 r2 .L527
+  addr2reg .Lstring.85 r1
+  jump .L528
+.L527:
+  addr2reg .Lstring.84 r1
+.L528:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strpbrk
+  or r0 r1 r2
+  read -28 r14 r1
+  bne r2 r0 .L534
+  addr2reg tok+20 r12
+  read 0 r12 r4
+  load 2 r2
+  bne r1 r2 .L531
+  add r4 2 r4
+.L531:
+  write -24 r14 r4
+  or r0 r1 r6
+  add r14 -72 r5
+  savpc r15
+  add r15 12 r15
+  jump strtoull
+  or r0 r1 r3
+  read -24 r14 r4
+  read -28 r14 r1
+  read -32 r14 r2
+  add r2 32 r5
+  write 0 r5 r3
+  read -72 r14 r3
+  bne r3 r4 .L533
+  addr2reg tok+20 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.87 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -28 r14 r1
+  read -32 r14 r2
+  load32 -24 r3
+  sub r13 r3 r13
+.L533:
+  add r2 32 r2
+  read 0 r2 r4
+  xor r1 10 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r5
+  read -72 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump inttype
+  read -32 r14 r2
+  add r2 8 r2
+  write 0 r2 r1
+  jump .L535
+.L534:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.86 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L535:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -32 r14 r1
+  jump .L563
+.L536:
+  addr2reg tok+20 r12
+  read 0 r12 r1
+  readb 0 r1 r2
+  load 85 r3
+  beq r2 r3 .L552
+  load 85 r3
+  blt r2 r3 .L546
+  load 117 r3
+  beq r2 r3 .L541
+  load 117 r3
+  sltu r2 r3 r2
+  jump .L548
+.L541:
+  add r1 1 r1
+  readb 0 r1 r2
+  load 56 r3
+  beq r2 r3 .L543
+  addr2reg typeushort r2
+  jump .L544
+.L543:
+  add r1 1 r1
+  addr2reg typeuchar r2
+.L544:
+  or r0 r2 r5
+  write -44 r14 r5
+  jump .L554
+.L546:
+  load 76 r3
+  beq r2 r3 .L550
+  load 76 r3
+  sltu r2 r3 r2
+.L548:
+  addr2reg typeint r2
+  write -44 r14 r2
+  jump .L554
+.L550:
+  add r1 1 r1
+  addr2reg targ r12
+  read 0 r12 r2
+  add r2 8 r2
+  read 0 r2 r5
+  write -44 r14 r5
+  jump .L554
+.L552:
+  add r1 1 r1
+  addr2reg typeuint r2
+  write -44 r14 r2
+.L554:
+  write -36 r14 r1
+  readb 0 r1 r2
+  load 39 r3
+  beq r2 r3 .L556
+  load 676 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.81 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -36 r14 r1
+.L556:
+  add r1 1 r1
+  write -40 r14 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r3
+  addr2reg tok+8 r2
+  write 0 r3 r2
+  addr2reg .Lstring.82 r7
+  load 0 r6
+  add r14 -68 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump decodechar
+  or r0 r1 r2
+  read -44 r14 r5
+  read -40 r14 r1
+  load32 -12 r3
+  sub r13 r3 r13
+  add r1 r2 r1
+  write -52 r14 r1
+  read -68 r14 r2
+  write -48 r14 r2
+  load 0 r6
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -48 r14 r2
+  or r0 r1 r3
+  read -52 r14 r1
+  write -56 r14 r3
+  add r3 32 r3
+  write 0 r3 r2
+  readb 0 r1 r6
+  load 39 r1
+  beq r6 r1 .L560
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.83 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L560:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -56 r14 r1
+  jump .L563
+.L561:
+  load 0 r6
+  load 0 r5
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r4
+  write -60 r14 r4
+  or r0 r4 r1
+  add r4 32 r4
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump stringconcat
+  or r0 r1 r4
+  read -60 r14 r1
+  add r1 32 r1
+  read 0 r1 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump mkarraytype
+  read -60 r14 r4
+  add r4 8 r2
+  write 0 r2 r1
+  add r4 4 r2
+  load 1 r1
+  writeb 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump decay
+  jump .L563
+.L562:
+  load 0 r6
+  addr2reg typebool r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  write -64 r14 r1
+  or r0 r1 r2
+  addr2reg tok r12
+  read 0 r12 r1
+  xor r1 44 r1
+  sltu r1 1 r1
+  add r2 32 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -64 r14 r1
+.L563:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt507:
+  .int .L508
+  .int .L515
+  .int .L536
+  .int .L561
+
+/* end function primaryexpr */
+
+.data
+.balign 1
+.Lstring.91:
+	.ascii "index designator is only valid for array types\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.92:
+	.ascii "for index designator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.93:
+	.ascii "member designator only valid for struct/union types\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.94:
+	.ascii "for member designator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.95:
+	.ascii "union\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.96:
+	.ascii "struct\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.97:
+	.ascii "%s has no member named '%s'\000"
+/* end data */
+
+
+.text
+; function designator
+designator:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -32 r14 r6
+  write -24 r14 r4
+.L566:
+  write -16 r14 r5
+  addr2reg tok r12
+  read 0 r12 r1
+  load 70 r2
+  beq r1 r2 .L576
+  load 70 r2
+  bge r1 r2 .L575
+  load 64 r2
+  bne r1 r2 .L574
+  read 0 r5 r1
+  load 13 r2
+  beq r1 r2 .L573
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.91 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L573:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -24 r14 r4
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump intconstexpr
+  write -12 r14 r1
+  addr2reg .Lstring.92 r5
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -16 r14 r5
+  read -12 r14 r2
+  read -32 r14 r6
+  read -24 r14 r4
+  add r5 20 r1
+  read 0 r1 r5
+  read 0 r6 r1
+  add r5 12 r3
+  read 0 r3 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  write 0 r6 r1
+  jump .L566
+.L574:
+  load 64 r2
+  sltu r1 r2 r1
+.L575:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L576:
+  read 0 r5 r1
+  load 0 r2
+  load 15 r3
+  bne r1 r3 .L578
+  or r0 r2 r1
+  jump .L579
+.L578:
+  xor r1 16 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L579:
+  beq r1 r0 .L581
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.93 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L581:
+  savpc r15
+  add r15 12 r15
+  jump next
+  addr2reg .Lstring.94 r5
+  load 4 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  or r0 r1 r4
+  read -16 r14 r5
+  read -32 r14 r6
+  write -20 r14 r4
+  or r0 r5 r1
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typemember
+  read -16 r14 r5
+  read -20 r14 r4
+  write -28 r14 r1
+  bne r1 r0 .L586
+  read 0 r5 r1
+  load 16 r2
+  beq r1 r2 .L584
+  addr2reg .Lstring.96 r1
+  jump .L585
+.L584:
+  addr2reg .Lstring.95 r1
+.L585:
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r4 r7
+  addr2reg .Lstring.97 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -20 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L586:
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -28 r14 r1
+  read -32 r14 r6
+  read -24 r14 r4
+  add r1 4 r1
+  read 0 r1 r5
+  jump .L566
+
+/* end function designator */
+
+.data
+.balign 1
+.Lstring.99:
+	.ascii "floating point not supported on this target\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.100:
+	.ascii "after ','\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.101:
+	.ascii "type is not a struct/union type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.102:
+	.ascii "struct/union has no member named '%s'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.103:
+	.ascii "va_arg argument must have type va_list\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.104:
+	.ascii "after va_list\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.105:
+	.ascii "va_copy destination must have type va_list\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.106:
+	.ascii "after target va_list\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.107:
+	.ascii "va_copy source must have type va_list\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.108:
+	.ascii "va_end argument must have type va_list\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.109:
+	.ascii "va_start argument must have type va_list\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.110:
+	.ascii "after first argument\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.111:
+	.ascii "internal error; unknown builtin\000"
+/* end data */
+
+
+.text
+; function builtinfunc
+builtinfunc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 96 r13
+  write -80 r14 r5
+  write -72 r14 r4
+  load 19 r1
+  bge r5 r1 .L634
+  shiftl r5 2 r2
+  addr2reg .Ljt590 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L591:
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r4
+  addr2reg typeulong r5
+  savpc r15
+  add r15 12 r15
+  jump exprassign
+  write -12 r14 r1
+  load 0 r5
+  addr2reg typevoid r4
+  savpc r15
+  add r15 12 r15
+  jump mkpointertype
+  or r0 r1 r5
+  read -12 r14 r6
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  add r1 32 r3
+  load 0 r2
+  write 0 r3 r2
+  jump .L644
+.L592:
+  savpc r15
+  add r15 12 r15
+  jump condexpr
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  read 0 r1 r1
+  xor r1 1 r1
+  sltu r1 1 r2
+  write -16 r14 r2
+  load 0 r6
+  addr2reg typeint r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -16 r14 r2
+  add r1 32 r3
+  write 0 r3 r2
+  jump .L644
+.L594:
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r4
+  addr2reg typelong r5
+  savpc r15
+  add r15 12 r15
+  jump exprassign
+  or r0 r1 r6
+  addr2reg typelong r5
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  write -20 r14 r1
+  add r1 32 r2
+  load 2 r1
+  write 0 r2 r1
+  addr2reg .Lstring.88 r5
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -72 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r4
+  addr2reg typelong r5
+  savpc r15
+  add r15 12 r15
+  jump exprassign
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  or r0 r1 r2
+  read -20 r14 r1
+  write -88 r14 r2
+  add r1 32 r2
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+  read -88 r14 r2
+  read 0 r2 r3
+  load 1 r4
+  bne r3 r4 .L600
+  add r2 32 r2
+  read 0 r2 r2
+  bne r2 r0 .L598
+  load 2 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L599
+.L598:
+  or r0 r1 r2
+  load 1 r1
+.L599:
+  add r2 32 r2
+  add r2 4 r2
+  write 0 r2 r1
+.L600:
+  read -88 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -20 r14 r1
+  jump .L644
+.L601:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.99 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  load32 -559030611 r1
+  jump .L644
+.L602:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.99 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  load32 -559030611 r1
+  jump .L644
+.L603:
+  load 0 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump typename
+  write -24 r14 r1
+  addr2reg .Lstring.75 r5
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg .Lstring.100 r5
+  load 4 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  or r0 r1 r4
+  read -24 r14 r1
+  write -36 r14 r4
+  read 0 r1 r2
+  load 0 r3
+  load 15 r5
+  bne r2 r5 .L605
+  or r0 r3 r2
+  jump .L606
+.L605:
+  xor r2 16 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L606:
+  bne r2 r0 .L608
+  or r0 r4 r12
+  or r0 r1 r4
+  or r0 r12 r1
+  jump .L609
+.L608:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.101 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -36 r14 r4
+  or r0 r4 r1
+  read -24 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L609:
+  load 0 r2
+  write -84 r14 r2
+  add r14 -84 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typemember
+  read -36 r14 r4
+  or r0 r4 r2
+  read -72 r14 r4
+  write -28 r14 r1
+  bne r1 r0 .L612
+  or r0 r2 r4
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r4 r6
+  addr2reg .Lstring.102 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -28 r14 r1
+  read -72 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L612:
+  add r1 4 r1
+  read 0 r1 r5
+  add r14 -84 r6
+  savpc r15
+  add r15 12 r15
+  jump designator
+  read -84 r14 r1
+  write -32 r14 r1
+  load 0 r6
+  addr2reg typeulong r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r2
+  read -32 r14 r1
+  read -36 r14 r4
+  write -40 r14 r2
+  add r2 32 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -40 r14 r1
+  jump .L644
+.L615:
+  load 0 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump typename
+  write -44 r14 r1
+  addr2reg .Lstring.75 r5
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -72 r14 r4
+  load 0 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump typename
+  or r0 r1 r5
+  read -44 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  and r1 0xFF r2
+  write -48 r14 r2
+  load 0 r6
+  addr2reg typeint r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -48 r14 r2
+  add r1 32 r3
+  write 0 r3 r2
+  jump .L644
+.L617:
+  load 0 r6
+  addr2reg typevoid r5
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  add r1 32 r3
+  load 7 r2
+  write 0 r3 r2
+  jump .L644
+.L618:
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r6
+  load 0 r5
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  write -52 r14 r1
+  add r1 32 r3
+  load 8 r2
+  write 0 r3 r2
+  add r1 20 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r4
+  addr2reg typeadjvalist r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump typesame
+  or r0 r1 r2
+  read -52 r14 r1
+  and r2 0xFF r2
+  bne r2 r0 .L620
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.103 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -52 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L620:
+  addr2reg typeadjvalist r12
+  read 0 r12 r2
+  addr2reg targ r12
+  read 0 r12 r3
+  add r3 4 r3
+  read 0 r3 r3
+  bne r2 r3 .L622
+  or r0 r1 r2
+  add r1 20 r1
+  read 0 r1 r5
+  load 74 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  read -52 r14 r2
+  add r2 20 r2
+  write 0 r2 r1
+.L622:
+  addr2reg .Lstring.104 r5
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -52 r14 r1
+  read -72 r14 r4
+  add r1 12 r5
+  add r14 -88 r6
+  savpc r15
+  add r15 12 r15
+  jump typename
+  or r0 r1 r2
+  read -52 r14 r1
+  add r1 8 r3
+  write 0 r3 r2
+  read -88 r14 r2
+  add r1 28 r3
+  write 0 r3 r2
+  jump .L644
+.L623:
+  load 0 r6
+  addr2reg typevoid r5
+  load 11 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  write -56 r14 r1
+  read -72 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  read -56 r14 r2
+  add r2 32 r2
+  write 0 r2 r1
+  add r1 8 r1
+  read 0 r1 r4
+  addr2reg typeadjvalist r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump typesame
+  or r0 r1 r2
+  read -56 r14 r1
+  and r2 0xFF r2
+  bne r2 r0 .L625
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.105 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -56 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L625:
+  addr2reg typeadjvalist r12
+  read 0 r12 r2
+  addr2reg targ r12
+  read 0 r12 r3
+  add r3 4 r3
+  read 0 r3 r3
+  beq r2 r3 .L627
+  or r0 r1 r2
+  add r1 32 r1
+  read 0 r1 r5
+  load 75 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  read -56 r14 r2
+  add r2 32 r2
+  write 0 r2 r1
+.L627:
+  addr2reg .Lstring.106 r5
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -72 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  read -56 r14 r2
+  add r2 32 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r1 8 r1
+  read 0 r1 r4
+  addr2reg typeadjvalist r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump typesame
+  or r0 r1 r2
+  read -56 r14 r1
+  and r2 0xFF r2
+  bne r2 r0 .L629
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.107 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -56 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L629:
+  addr2reg typeadjvalist r12
+  read 0 r12 r2
+  addr2reg targ r12
+  read 0 r12 r3
+  add r3 4 r3
+  read 0 r3 r3
+  beq r2 r3 .L644
+  add r1 32 r1
+  add r1 4 r1
+  read 0 r1 r5
+  load 75 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  or r0 r1 r2
+  read -56 r14 r1
+  add r1 32 r3
+  add r3 4 r3
+  write 0 r3 r2
+  jump .L644
+.L631:
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r6
+  write -60 r14 r6
+  add r6 8 r1
+  read 0 r1 r4
+  addr2reg typeadjvalist r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump typesame
+  read -60 r14 r6
+  and r1 0xFF r1
+  bne r1 r0 .L633
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.108 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -60 r14 r6
+  load32 -24 r1
+  sub r13 r1 r13
+.L633:
+  addr2reg typevoid r5
+  load 8 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  jump .L644
+.L634:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.111 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L644
+.L635:
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r6
+  addr2reg typevoid r5
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  write -64 r14 r1
+  add r1 32 r3
+  load 12 r2
+  write 0 r3 r2
+  add r1 20 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r4
+  addr2reg typeadjvalist r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump typesame
+  or r0 r1 r2
+  read -64 r14 r1
+  and r2 0xFF r2
+  bne r2 r0 .L637
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.109 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -64 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L637:
+  addr2reg typeadjvalist r12
+  read 0 r12 r2
+  addr2reg targ r12
+  read 0 r12 r3
+  add r3 4 r3
+  read 0 r3 r3
+  bne r2 r3 .L639
+  or r0 r1 r2
+  add r1 20 r1
+  read 0 r1 r5
+  load 74 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  read -64 r14 r2
+  add r2 20 r2
+  write 0 r2 r1
+.L639:
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r2
+  read -64 r14 r1
+  read -72 r14 r4
+  and r2 0xFF r2
+  beq r2 r0 .L644
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -64 r14 r1
+  jump .L644
+.L641:
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  write -68 r14 r1
+  addr2reg .Lstring.110 r5
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -72 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  read -68 r14 r6
+  add r6 24 r2
+  write 0 r2 r1
+  addr2reg typeint r5
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -80 r14 r5
+  add r1 32 r2
+  write 0 r2 r5
+  jump .L644
+.L642:
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  write -76 r14 r1
+  addr2reg .Lstring.110 r5
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -72 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  read -76 r14 r6
+  add r6 24 r2
+  write 0 r2 r1
+  addr2reg typevoid r5
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -80 r14 r5
+  add r1 32 r2
+  write 0 r2 r5
+  jump .L644
+.L643:
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r6
+  addr2reg typeint r5
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -80 r14 r5
+  add r1 32 r2
+  write 0 r2 r5
+.L644:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt590:
+  .int .L591
+  .int .L592
+  .int .L594
+  .int .L601
+  .int .L602
+  .int .L603
+  .int .L615
+  .int .L617
+  .int .L618
+  .int .L623
+  .int .L631
+  .int .L634
+  .int .L635
+  .int .L641
+  .int .L641
+  .int .L642
+  .int .L642
+  .int .L643
+  .int .L643
+
+/* end function builtinfunc */
+
+.data
+.balign 1
+.Lstring.113:
+	.ascii "operand of '%s' operator must be an lvalue\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.114:
+	.ascii "operand of '%s' operator is const qualified\000"
+/* end data */
+
+
+.text
+; function mkincdecexpr
+mkincdecexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r6
+  or r0 r5 r6
+  write -8 r14 r6
+  write -16 r14 r4
+  add r6 4 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L649
+  shiftl r4 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.113 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r6
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L649:
+  add r6 12 r1
+  read 0 r1 r1
+  and r1 2 r1
+  beq r1 r0 .L651
+  shiftl r4 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.114 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r6
+  load32 -24 r1
+  sub r13 r1 r13
+.L651:
+  add r6 8 r1
+  read 0 r1 r5
+  load 5 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -12 r14 r6
+  read -16 r14 r4
+  add r1 16 r2
+  write 0 r2 r4
+  and r6 0xFF r2
+  add r1 32 r3
+  writeb 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkincdecexpr */
+
+.data
+.balign 1
+.Lstring.116:
+	.ascii "either array or index must be pointer type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.117:
+	.ascii "array is pointer to incomplete type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.118:
+	.ascii "index is not an integer type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.119:
+	.ascii "after array index\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.120:
+	.ascii "after builtin parameters\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.121:
+	.ascii "called object is not a function\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.122:
+	.ascii "or ')' after function call argument\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.123:
+	.ascii "too many arguments for function call\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.124:
+	.ascii "not enough arguments for function call\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.125:
+	.ascii "'%s' operator must be applied to pointer to struct/union\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.126:
+	.ascii "expected identifier after '%s' operator\000"
+/* end data */
+
+
+.text
+; function postfixexpr
+postfixexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 108 r13
+  or r0 r5 r1
+  write -96 r14 r4
+  bne r1 r0 .L657
+  savpc r15
+  add r15 12 r15
+  jump primaryexpr
+.L657:
+  or r0 r1 r5
+.L658:
+  write -24 r14 r5
+  addr2reg tok r12
+  read 0 r12 r4
+  load 64 r1
+  sub r4 r1 r1
+  load 10 r2
+  bge r1 r2 .L731
+  shiftl r1 2 r2
+  addr2reg .Ljt661 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L662:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -96 r14 r4
+  or r0 r4 r1
+  savpc r15
+  add r15 12 r15
+  jump expr
+  or r0 r1 r5
+  or r0 r5 r1
+  read -24 r14 r5
+  write -8 r14 r1
+  add r5 8 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  load 12 r3
+  beq r2 r3 .L666
+  add r1 8 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  load 12 r3
+  beq r2 r3 .L665
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.116 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -24 r14 r5
+  read -8 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L665:
+  or r0 r1 r12
+  or r0 r5 r1
+  or r0 r12 r5
+.L666:
+  write -12 r14 r5
+  write -16 r14 r1
+  add r5 8 r2
+  read 0 r2 r2
+  add r2 20 r2
+  read 0 r2 r2
+  add r2 36 r2
+  readbu 0 r2 r2
+  beq r2 r0 .L668
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.117 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -12 r14 r5
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L668:
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 4 r2
+  read 0 r2 r2
+  and r2 2 r2
+  bne r2 r0 .L670
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.118 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -12 r14 r5
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L670:
+  or r0 r1 r7
+  or r0 r5 r6
+  load 76 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump mkbinaryexpr
+  or r0 r1 r5
+  load 75 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  write -20 r14 r1
+  addr2reg .Lstring.119 r5
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -20 r14 r5
+  read -96 r14 r1
+  or r0 r1 r4
+  jump .L658
+.L672:
+  or r0 r5 r1
+  jump .L732
+.L673:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -24 r14 r5
+  read -96 r14 r1
+  read 0 r5 r3
+  load 0 r2
+  bne r3 r0 .L675
+  add r5 32 r2
+  read 0 r2 r2
+  add r2 4 r2
+  read 0 r2 r2
+  xor r2 4 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L675:
+  bne r2 r0 .L704
+  add r5 8 r1
+  read 0 r1 r1
+  read 0 r1 r3
+  load 1 r2
+  load 12 r4
+  bne r3 r4 .L678
+  add r1 20 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  xor r1 14 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L679
+.L678:
+  or r0 r2 r1
+.L679:
+  beq r1 r0 .L681
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.121 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -24 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L681:
+  add r5 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r3
+  write -32 r14 r3
+  add r3 20 r2
+  or r0 r5 r1
+  read 0 r2 r5
+  or r0 r1 r6
+  load 3 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r4
+  read -32 r14 r3
+  read -96 r14 r1
+  write -36 r14 r4
+  add r4 32 r5
+  load 0 r2
+  write 0 r5 r2
+  add r4 32 r2
+  add r2 4 r5
+  load 0 r2
+  write 0 r5 r2
+  add r3 40 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r4 32 r5
+  write -40 r14 r5
+  or r0 r4 r12
+  or r0 r2 r4
+  or r0 r12 r2
+  or r0 r1 r12
+  or r0 r4 r1
+  or r0 r12 r4
+.L683:
+  write -44 r14 r1
+  addr2reg tok r12
+  read 0 r12 r5
+  load 67 r6
+  beq r5 r6 .L698
+  add r2 32 r2
+  read 0 r2 r2
+  beq r2 r0 .L686
+  addr2reg .Lstring.122 r5
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -44 r14 r1
+  read -32 r14 r3
+  read -96 r14 r4
+.L686:
+  or r0 r1 r2
+  load 0 r1
+  bne r2 r0 .L688
+  add r3 40 r1
+  readbu 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L688:
+  beq r1 r0 .L690
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.123 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -96 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L690:
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r4
+  read -40 r14 r6
+  read -44 r14 r1
+  read -32 r14 r3
+  write 0 r6 r4
+  add r3 40 r2
+  readbu 0 r2 r3
+  load 0 r2
+  beq r3 r0 .L692
+  xor r1 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L692:
+  bne r2 r0 .L694
+  add r1 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump exprassign
+  or r0 r1 r5
+  read -40 r14 r6
+  read -44 r14 r1
+  read -36 r14 r2
+  read -32 r14 r3
+  read -96 r14 r4
+  write 0 r6 r5
+  jump .L695
+.L694:
+  savpc r15
+  add r15 12 r15
+  jump exprpromote
+  or r0 r1 r5
+  read -40 r14 r6
+  read -44 r14 r1
+  read -36 r14 r2
+  read -32 r14 r3
+  read -96 r14 r4
+  write 0 r6 r5
+.L695:
+  add r5 24 r5
+  add r2 32 r6
+  add r6 4 r7
+  read 0 r7 r6
+  add r6 1 r6
+  write 0 r7 r6
+  beq r1 r0 .L697
+  add r1 32 r1
+  read 0 r1 r1
+.L697:
+  write -40 r14 r5
+  jump .L683
+.L698:
+  or r0 r2 r4
+  or r0 r1 r2
+  load 0 r1
+  beq r2 r0 .L701
+  add r3 40 r1
+  readbu 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L701:
+  beq r1 r0 .L703
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.124 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -36 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L703:
+  savpc r15
+  add r15 12 r15
+  jump decay
+  write -28 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -28 r14 r5
+  read -96 r14 r4
+  jump .L658
+.L704:
+  or r0 r1 r4
+  add r5 32 r1
+  read 0 r1 r1
+  add r1 36 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump builtinfunc
+  write -48 r14 r1
+  addr2reg .Lstring.120 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -48 r14 r5
+  read -96 r14 r4
+  jump .L658
+.L706:
+  load 74 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  or r0 r1 r5
+.L707:
+  write -60 r14 r5
+  addr2reg tok r12
+  read 0 r12 r2
+  write -56 r14 r2
+  add r5 8 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  load 12 r3
+  beq r1 r3 .L709
+  shiftl r2 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.125 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -60 r14 r5
+  read -56 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L709:
+  add r5 8 r1
+  read 0 r1 r1
+  add r1 20 r3
+  read 0 r3 r4
+  write -52 r14 r4
+  add r1 32 r1
+  read 0 r1 r1
+  write -72 r14 r1
+  read 0 r4 r1
+  load 0 r3
+  load 15 r4
+  bne r1 r4 .L711
+  or r0 r3 r1
+  jump .L712
+.L711:
+  xor r1 16 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L712:
+  beq r1 r0 .L714
+  shiftl r2 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.125 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L714:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -60 r14 r5
+  read -52 r14 r4
+  read -56 r14 r2
+  addr2reg tok r12
+  read 0 r12 r1
+  load 4 r3
+  beq r1 r3 .L716
+  shiftl r2 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.126 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -60 r14 r5
+  read -52 r14 r4
+  read -56 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L716:
+  load 1 r1
+  load 71 r3
+  beq r2 r3 .L718
+  add r5 20 r1
+  read 0 r1 r1
+  add r1 4 r1
+  readbu 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L718:
+  xor r1 0 r1
+  sltu r0 r1 r2
+  write -80 r14 r2
+  load 0 r1
+  write -100 r14 r1
+  addr2reg tok+20 r12
+  read 0 r12 r5
+  add r14 -100 r6
+  savpc r15
+  add r15 12 r15
+  jump typemember
+  read -60 r14 r5
+  write -84 r14 r1
+  bne r1 r0 .L720
+  addr2reg tok+20 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.102 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -60 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L720:
+  or r0 r5 r1
+  addr2reg typeulong r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  write -64 r14 r1
+  read -100 r14 r1
+  write -68 r14 r1
+  load 0 r6
+  addr2reg typeulong r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r7
+  read -64 r14 r6
+  read -68 r14 r1
+  add r7 32 r2
+  write 0 r2 r1
+  load 76 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump mkbinaryexpr
+  write -76 r14 r1
+  read -84 r14 r1
+  or r0 r1 r2
+  read -72 r14 r1
+  add r2 4 r3
+  read 0 r3 r4
+  add r2 8 r2
+  read 0 r2 r2
+  or r1 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump mkpointertype
+  read -76 r14 r5
+  add r5 8 r2
+  write 0 r2 r1
+  load 75 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  or r0 r1 r5
+  read -84 r14 r1
+  read -80 r14 r2
+  and r2 0xFF r2
+  add r5 4 r3
+  writeb 0 r3 r2
+  add r1 16 r2
+  readh 0 r2 r3
+  load 1 r2
+  bne r3 r0 .L724
+  add r1 16 r1
+  add r1 2 r1
+  readh 0 r1 r1
+  shiftl r1 16 r1
+  shiftr r1 16 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L725
+.L724:
+  or r0 r2 r1
+.L725:
+  bne r1 r0 .L727
+  write -88 r14 r5
+  jump .L729
+.L727:
+  add r5 8 r2
+  or r0 r5 r1
+  read 0 r2 r5
+  or r0 r1 r6
+  load 4 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r5
+  read -84 r14 r1
+  read -80 r14 r2
+  and r2 0xFF r2
+  add r5 4 r3
+  writeb 0 r3 r2
+  add r1 16 r1
+  add r5 32 r2
+  readhu 0 r1 r3
+  writeh 0 r2 r3
+  add r1 2 r1
+  add r2 2 r2
+  readhu 0 r1 r1
+  writeh 0 r2 r1
+  write -88 r14 r5
+.L729:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -88 r14 r5
+  read -96 r14 r4
+  jump .L658
+.L730:
+  load 1 r6
+  savpc r15
+  add r15 12 r15
+  jump mkincdecexpr
+  write -92 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -92 r14 r5
+  read -96 r14 r4
+  jump .L658
+.L731:
+  or r0 r5 r1
+.L732:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt661:
+  .int .L662
+  .int .L672
+  .int .L673
+  .int .L672
+  .int .L672
+  .int .L672
+  .int .L706
+  .int .L707
+  .int .L730
+  .int .L730
+
+/* end function postfixexpr */
+
+.data
+.balign 1
+.Lstring.128:
+	.ascii "operand of unary '+' operator must have arithmetic type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.129:
+	.ascii "operand of unary '-' operator must have arithmetic type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.130:
+	.ascii "operand of '~' operator must have integer type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.131:
+	.ascii "operator '!' must have scalar operand\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.132:
+	.ascii "expected ')' after 'alignof'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.133:
+	.ascii "%s operator applied to bitfield expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.134:
+	.ascii "%s operator applied to incomplete type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.135:
+	.ascii "%s operator applied to function type\000"
+/* end data */
+
+
+.text
+; function unaryexpr
+unaryexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 72 r13
+  write -40 r14 r4
+  addr2reg tok r12
+  read 0 r12 r1
+  write -56 r14 r1
+  load 38 r2
+  beq r1 r2 .L763
+  load 38 r2
+  blt r1 r2 .L760
+  or r0 r1 r2
+  load 72 r1
+  sub r2 r1 r1
+  load 8 r2
+  bge r1 r2 .L762
+  shiftl r1 2 r2
+  addr2reg .Ljt739 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L740:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump unaryexpr
+  or r0 r1 r5
+  read -56 r14 r2
+  load 0 r6
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump mkincdecexpr
+  jump .L802
+.L741:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump castexpr
+  or r0 r1 r5
+  read -56 r14 r2
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  jump .L802
+.L742:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump castexpr
+  write -16 r14 r1
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 4 r2
+  read 0 r2 r2
+  and r2 8 r2
+  bne r2 r0 .L744
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.128 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L744:
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 4 r2
+  read 0 r2 r2
+  and r2 2 r2
+  beq r2 r0 .L802
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump exprpromote
+  jump .L802
+.L746:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump castexpr
+  or r0 r1 r6
+  write -20 r14 r6
+  add r6 8 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 8 r1
+  bne r1 r0 .L748
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.129 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -20 r14 r6
+  load32 -24 r1
+  sub r13 r1 r13
+.L748:
+  add r6 8 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 2 r1
+  beq r1 r0 .L750
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump exprpromote
+  or r0 r1 r6
+.L750:
+  add r6 8 r1
+  read 0 r1 r5
+  load 7 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -56 r14 r2
+  add r1 16 r3
+  write 0 r3 r2
+  jump .L802
+.L751:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump castexpr
+  or r0 r1 r4
+  write -24 r14 r4
+  add r4 8 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 2 r1
+  bne r1 r0 .L753
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.130 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -24 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L753:
+  savpc r15
+  add r15 12 r15
+  jump exprpromote
+  or r0 r1 r6
+  write -28 r14 r6
+  add r6 8 r1
+  read 0 r1 r5
+  load 0 r6
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r7
+  read -28 r14 r6
+  add r7 32 r2
+  load32 -1 r1
+  write 0 r2 r1
+  load 90 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump mkbinaryexpr
+  jump .L802
+.L756:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump castexpr
+  or r0 r1 r6
+  write -32 r14 r6
+  add r6 8 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 16 r1
+  bne r1 r0 .L758
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.131 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L758:
+  load 0 r6
+  addr2reg typeint r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r7
+  read -32 r14 r6
+  add r7 32 r2
+  load 0 r1
+  write 0 r2 r1
+  load 88 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump mkbinaryexpr
+  jump .L802
+.L760:
+  load 9 r2
+  beq r1 r2 .L763
+  load 9 r2
+  sltu r1 r2 r1
+.L762:
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump postfixexpr
+  jump .L802
+.L763:
+  savpc r15
+  add r15 12 r15
+  jump next
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r2
+  read -56 r14 r1
+  read -40 r14 r4
+  and r2 0xFF r2
+  bne r2 r0 .L768
+  load 38 r2
+  beq r1 r2 .L766
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.132 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L802
+.L766:
+  savpc r15
+  add r15 12 r15
+  jump unaryexpr
+  or r0 r1 r6
+  read -56 r14 r1
+  load 0 r2
+  jump .L777
+.L768:
+  load 0 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump typename
+  or r0 r1 r2
+  read -40 r14 r4
+  write -44 r14 r2
+  bne r2 r0 .L771
+  savpc r15
+  add r15 12 r15
+  jump expr
+  write -36 r14 r1
+  addr2reg .Lstring.88 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -36 r14 r6
+  read -44 r14 r2
+  read -56 r14 r1
+  read -40 r14 r4
+  load 38 r3
+  bne r1 r3 .L777
+  or r0 r6 r5
+  savpc r15
+  add r15 12 r15
+  jump postfixexpr
+  or r0 r1 r6
+  read -44 r14 r2
+  read -56 r14 r1
+  jump .L777
+.L771:
+  addr2reg .Lstring.75 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -44 r14 r2
+  read -56 r14 r1
+  read -40 r14 r4
+  load 0 r3
+  load 38 r5
+  bne r1 r5 .L773
+  addr2reg tok r12
+  read 0 r12 r3
+  xor r3 68 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L773:
+  beq r3 r0 .L775
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump parseinit
+  read -44 r14 r2
+  read -56 r14 r1
+.L775:
+  load 0 r3
+  or r0 r3 r6
+.L777:
+  bne r2 r0 .L783
+  add r6 5 r2
+  readbu 0 r2 r2
+  beq r2 r0 .L780
+  add r6 20 r2
+  read 0 r2 r6
+.L780:
+  write -48 r14 r6
+  read 0 r6 r2
+  load 4 r3
+  bne r2 r3 .L782
+  shiftl r1 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.133 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -48 r14 r6
+  read -56 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L782:
+  add r6 8 r2
+  read 0 r2 r2
+.L783:
+  write -52 r14 r6
+  write -64 r14 r2
+  add r2 36 r3
+  readbu 0 r3 r3
+  beq r3 r0 .L785
+  shiftl r1 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.134 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -52 r14 r6
+  read -64 r14 r2
+  read -56 r14 r1
+  load32 -24 r3
+  sub r13 r3 r13
+.L785:
+  read 0 r2 r3
+  load 14 r4
+  bne r3 r4 .L787
+  shiftl r1 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.135 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -52 r14 r6
+  read -64 r14 r2
+  read -56 r14 r1
+  load32 -24 r3
+  sub r13 r3 r13
+.L787:
+  read 0 r2 r4
+  load 0 r3
+  load 13 r5
+  beq r4 r5 .L789
+  or r0 r3 r4
+  jump .L790
+.L789:
+  add r2 12 r3
+  read 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L790:
+  load 0 r3
+  beq r4 r0 .L792
+  xor r1 38 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L792:
+  bne r3 r0 .L799
+  load 38 r3
+  beq r1 r3 .L796
+  add r2 8 r1
+  read 0 r1 r2
+  write -60 r14 r2
+  jump .L798
+.L796:
+  add r2 12 r1
+  read 0 r1 r2
+  write -60 r14 r2
+.L798:
+  load 0 r6
+  addr2reg typeulong r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -60 r14 r2
+  add r1 32 r3
+  write 0 r3 r2
+  jump .L802
+.L799:
+  addr2reg typeulong r5
+  load 15 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -64 r14 r2
+  bne r1 r0 .L801
+  add r1 20 r2
+  read 0 r2 r2
+  add r2 8 r2
+  read 0 r2 r2
+.L801:
+  add r1 32 r3
+  write 0 r3 r2
+.L802:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt739:
+  .int .L740
+  .int .L740
+  .int .L741
+  .int .L741
+  .int .L742
+  .int .L746
+  .int .L751
+  .int .L756
+
+/* end function unaryexpr */
+
+.data
+.balign 1
+.Lstring.137:
+	.ascii "after expression to match '('\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.138:
+	.ascii "cast type must be scalar\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.139:
+	.ascii "cast operand must have scalar type\000"
+/* end data */
+
+
+.text
+; function castexpr
+castexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 52 r13
+  write -20 r14 r4
+  load 0 r2
+  add r14 -40 r1
+  write -24 r14 r2
+  write -32 r14 r1
+.L807:
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -20 r14 r4
+  and r1 0xFF r1
+  beq r1 r0 .L823
+  load 0 r1
+  write -44 r14 r1
+  add r14 -36 r6
+  add r14 -44 r5
+  savpc r15
+  add r15 12 r15
+  jump typename
+  write -8 r14 r1
+  beq r1 r0 .L821
+  addr2reg .Lstring.75 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -8 r14 r1
+  addr2reg tok r12
+  read 0 r12 r2
+  load 68 r3
+  beq r2 r3 .L816
+  load 0 r2
+  addr2reg typevoid r3
+  beq r1 r3 .L812
+  add r1 4 r2
+  read 0 r2 r2
+  and r2 16 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L812:
+  beq r2 r0 .L814
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.138 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L814:
+  load 0 r6
+  or r0 r1 r5
+  load 8 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r2
+  read -32 r14 r3
+  read -8 r14 r1
+  read -20 r14 r4
+  read -36 r14 r5
+  add r2 28 r6
+  write 0 r6 r5
+  write 0 r3 r2
+  add r2 20 r2
+  write -24 r14 r1
+  write -32 r14 r2
+  jump .L807
+.L816:
+  or r0 r1 r2
+  load 0 r6
+  or r0 r2 r5
+  load 6 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r4
+  read -8 r14 r2
+  write -12 r14 r4
+  read -36 r14 r1
+  add r4 28 r3
+  write 0 r3 r1
+  read -44 r14 r1
+  add r4 12 r3
+  write 0 r3 r1
+  add r4 4 r3
+  load 1 r1
+  writeb 0 r3 r1
+  read -44 r14 r7
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r3
+  or r0 r2 r1
+  load 0 r2
+  write 0 r3 r2
+  or r0 r1 r6
+  load 1 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump mkdecl
+  or r0 r1 r2
+  read -12 r14 r4
+  read -8 r14 r1
+  or r0 r4 r3
+  read -20 r14 r4
+  load32 -12 r5
+  sub r13 r5 r13
+  addr2reg filescope r5
+  beq r4 r5 .L819
+  load 2 r5
+  jump .L820
+.L819:
+  load 0 r5
+.L820:
+  add r2 36 r6
+  add r6 4 r6
+  write 0 r6 r5
+  add r3 32 r3
+  write 0 r3 r2
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump parseinit
+  read -12 r14 r4
+  add r4 32 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump decay
+  or r0 r1 r5
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump postfixexpr
+  read -24 r14 r2
+  read -32 r14 r3
+  jump .L824
+.L821:
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump expr
+  write -16 r14 r1
+  addr2reg .Lstring.137 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -16 r14 r5
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump postfixexpr
+  read -24 r14 r2
+  read -32 r14 r3
+  jump .L824
+.L823:
+  savpc r15
+  add r15 12 r15
+  jump unaryexpr
+  read -24 r14 r2
+  read -32 r14 r3
+.L824:
+  write -28 r14 r1
+  load 0 r4
+  beq r2 r0 .L826
+  addr2reg typevoid r4
+  xor r2 r4 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r4
+.L826:
+  load 0 r2
+  beq r4 r0 .L828
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 4 r2
+  read 0 r2 r2
+  and r2 16 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L828:
+  beq r2 r0 .L830
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.139 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -28 r14 r1
+  read -32 r14 r3
+  load32 -24 r2
+  sub r13 r2 r13
+.L830:
+  write 0 r3 r1
+  read -40 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function castexpr */
+
+
+.text
+; function binaryexpr
+binaryexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 52 r13
+  or r0 r5 r1
+  write -24 r14 r6
+  write -16 r14 r4
+  bne r1 r0 .L836
+  savpc r15
+  add r15 12 r15
+  jump castexpr
+  read -24 r14 r6
+.L836:
+  write -28 r14 r1
+.L837:
+  addr2reg tok r12
+  read 0 r12 r5
+  write -32 r14 r5
+  load 74 r1
+  sub r5 r1 r1
+  load 20 r2
+  bge r1 r2 .L843
+  shiftl r1 2 r2
+  addr2reg .Ljt839 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L840:
+  load 4 r1
+  jump .L851
+.L841:
+  load 9 r1
+  jump .L851
+.L842:
+  load 8 r1
+  jump .L851
+.L843:
+  load32 -1 r1
+  jump .L851
+.L844:
+  load 7 r1
+  jump .L851
+.L845:
+  load 6 r1
+  jump .L851
+.L846:
+  load 5 r1
+  jump .L851
+.L847:
+  load 3 r1
+  jump .L851
+.L848:
+  load 2 r1
+  jump .L851
+.L849:
+  load 1 r1
+  jump .L851
+.L850:
+  load 0 r1
+.L851:
+  write -20 r14 r1
+  blts r1 r6 .L873
+  addr2reg tok+8 r12
+  read 0 r12 r1
+  write -44 r14 r1
+  add r14 -44 r1
+  add r1 4 r1
+  addr2reg tok+12 r12
+  read 0 r12 r2
+  write 0 r1 r2
+  add r1 4 r2
+  addr2reg tok+16 r12
+  read 0 r12 r1
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump castexpr
+  or r0 r1 r7
+  read -20 r14 r1
+  read -16 r14 r4
+  or r0 r7 r2
+.L854:
+  addr2reg tok r12
+  read 0 r12 r3
+  load 74 r5
+  sub r3 r5 r3
+  load 20 r5
+  bge r3 r5 .L860
+  shiftl r3 2 r5
+  addr2reg .Ljt856 r3
+  add r3 r5 r3
+  read 0 r3 r3
+  jumpr 0 r3
+.L857:
+  load 4 r3
+  jump .L868
+.L858:
+  load 9 r3
+  jump .L868
+.L859:
+  load 8 r3
+  jump .L868
+.L860:
+  load32 -1 r3
+  jump .L868
+.L861:
+  load 7 r3
+  jump .L868
+.L862:
+  load 6 r3
+  jump .L868
+.L863:
+  load 5 r3
+  jump .L868
+.L864:
+  load 3 r3
+  jump .L868
+.L865:
+  load 2 r3
+  jump .L868
+.L866:
+  load 1 r3
+  jump .L868
+.L867:
+  load 0 r3
+.L868:
+  or r0 r3 r6
+  bles r6 r1 .L870
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump binaryexpr
+  or r0 r1 r2
+  read -20 r14 r1
+  read -16 r14 r4
+  jump .L854
+.L870:
+  or r0 r2 r7
+  read -28 r14 r1
+  read -32 r14 r5
+  or r0 r1 r6
+  add r14 -44 r4
+  savpc r15
+  add r15 12 r15
+  jump mkbinaryexpr
+  or r0 r1 r5
+  read -24 r14 r6
+  read -16 r14 r4
+  write -28 r14 r5
+  jump .L837
+.L873:
+  read -28 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt839:
+  .int .L840
+  .int .L841
+  .int .L842
+  .int .L842
+  .int .L843
+  .int .L843
+  .int .L841
+  .int .L841
+  .int .L844
+  .int .L844
+  .int .L845
+  .int .L845
+  .int .L845
+  .int .L845
+  .int .L846
+  .int .L846
+  .int .L847
+  .int .L848
+  .int .L849
+  .int .L850
+
+.rdata
+.balign 4
+.Ljt856:
+  .int .L857
+  .int .L858
+  .int .L859
+  .int .L859
+  .int .L860
+  .int .L860
+  .int .L858
+  .int .L858
+  .int .L861
+  .int .L861
+  .int .L862
+  .int .L862
+  .int .L862
+  .int .L862
+  .int .L863
+  .int .L863
+  .int .L864
+  .int .L865
+  .int .L866
+  .int .L867
+
+/* end function binaryexpr */
+
+.data
+.balign 1
+.Lstring.143:
+	.ascii "in conditional expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.144:
+	.ascii "operands of conditional operator must have compatible types\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.145:
+	.ascii "invalid operands to conditional operator\000"
+/* end data */
+
+
+.text
+; function condexpr
+.global condexpr
+condexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 48 r13
+  write -4 r14 r4
+  load 0 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump binaryexpr
+  write -28 r14 r1
+  load 94 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r2
+  read -28 r14 r1
+  read -4 r14 r4
+  and r2 0xFF r2
+  beq r2 r0 .L922
+  savpc r15
+  add r15 12 r15
+  jump expr
+  write -40 r14 r1
+  addr2reg .Lstring.143 r5
+  load 95 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -4 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump condexpr
+  or r0 r1 r2
+  read -28 r14 r1
+  write -36 r14 r2
+  read -40 r14 r4
+  add r4 8 r3
+  read 0 r3 r5
+  write -12 r14 r5
+  add r2 8 r2
+  or r0 r5 r3
+  read 0 r2 r5
+  write -8 r14 r5
+  beq r3 r5 .L912
+  add r3 4 r2
+  read 0 r2 r2
+  and r2 8 r6
+  load 0 r2
+  beq r6 r0 .L881
+  add r5 4 r2
+  read 0 r2 r2
+  and r2 8 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L881:
+  bne r2 r0 .L910
+  load 0 r2
+  addr2reg typevoid r6
+  bne r3 r6 .L884
+  addr2reg typevoid r2
+  xor r5 r2 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L884:
+  bne r2 r0 .L908
+  savpc r15
+  add r15 12 r15
+  jump eval
+  write -40 r14 r1
+  read -36 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  write -36 r14 r1
+  read -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump nullpointer
+  or r0 r1 r2
+  read -8 r14 r5
+  read -28 r14 r1
+  and r2 0xFF r3
+  load 0 r2
+  bne r3 r0 .L887
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L888
+.L887:
+  or r0 r1 r2
+  read 0 r5 r1
+  xor r1 12 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L888:
+  bne r1 r0 .L907
+  read -36 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump nullpointer
+  or r0 r1 r3
+  read -8 r14 r5
+  or r0 r5 r1
+  read -12 r14 r5
+  read -28 r14 r2
+  and r3 0xFF r4
+  load 0 r3
+  beq r4 r0 .L891
+  read 0 r5 r3
+  xor r3 12 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L891:
+  bne r3 r0 .L906
+  read 0 r5 r3
+  load 0 r2
+  load 12 r4
+  bne r3 r4 .L894
+  read 0 r1 r2
+  xor r2 12 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L894:
+  bne r2 r0 .L896
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.145 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L922
+.L896:
+  add r5 32 r2
+  read 0 r2 r3
+  add r1 32 r2
+  read 0 r2 r4
+  or r0 r5 r2
+  or r3 r4 r5
+  write -24 r14 r5
+  add r2 20 r2
+  read 0 r2 r4
+  write -20 r14 r4
+  add r1 20 r2
+  or r0 r5 r1
+  read 0 r2 r5
+  write -16 r14 r5
+  load 1 r2
+  addr2reg typevoid r3
+  beq r4 r3 .L898
+  addr2reg typevoid r2
+  xor r5 r2 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L898:
+  bne r2 r0 .L902
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  read -16 r14 r5
+  read -20 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L901
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.144 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L922
+.L901:
+  savpc r15
+  add r15 12 r15
+  jump typecomposite
+  or r0 r1 r4
+  read -24 r14 r5
+  jump .L905
+.L902:
+  or r0 r1 r5
+  addr2reg typevoid r1
+  or r0 r1 r4
+.L905:
+  savpc r15
+  add r15 12 r15
+  jump mkpointertype
+  or r0 r1 r5
+  read -28 r14 r1
+  jump .L911
+.L906:
+  or r0 r2 r1
+  jump .L911
+.L907:
+  or r0 r2 r1
+  jump .L911
+.L908:
+  addr2reg typevoid r2
+  or r0 r2 r5
+  jump .L911
+.L910:
+  add r14 -36 r5
+  add r14 -40 r4
+  savpc r15
+  add r15 12 r15
+  jump commonreal
+  or r0 r1 r5
+  read -28 r14 r1
+.L911:
+  write -32 r14 r5
+  jump .L914
+.L912:
+  or r0 r3 r5
+  write -32 r14 r5
+.L914:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  read -32 r14 r5
+  read 0 r1 r3
+  load 0 r2
+  load 1 r4
+  bne r3 r4 .L916
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 4 r2
+  read 0 r2 r2
+  and r2 2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L916:
+  bne r2 r0 .L918
+  or r0 r1 r6
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -40 r14 r2
+  add r1 32 r3
+  write 0 r3 r2
+  read -36 r14 r2
+  add r1 32 r3
+  add r3 4 r3
+  write 0 r3 r2
+  jump .L922
+.L918:
+  add r1 32 r1
+  read 0 r1 r1
+  bne r1 r0 .L920
+  read -36 r14 r4
+  jump .L921
+.L920:
+  read -40 r14 r4
+.L921:
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+.L922:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function condexpr */
+
+.data
+.balign 1
+.Lstring.147:
+	.ascii "not an integer constant expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.148:
+	.ascii "integer constant expression cannot be negative\000"
+/* end data */
+
+
+.text
+; function intconstexpr
+.global intconstexpr
+intconstexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump condexpr
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  read -12 r14 r5
+  write -16 r14 r1
+  read 0 r1 r3
+  load 1 r2
+  load 1 r4
+  bne r3 r4 .L927
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 4 r2
+  read 0 r2 r2
+  and r2 2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L927:
+  beq r2 r0 .L929
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.147 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r1
+  read -12 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+.L929:
+  and r5 0xFF r3
+  load 0 r2
+  beq r3 r0 .L931
+  or r0 r2 r3
+  jump .L932
+.L931:
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 40 r2
+  readbu 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L932:
+  load 0 r2
+  beq r3 r0 .L934
+  add r1 32 r2
+  read 0 r2 r2
+  shiftr r2 63 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L934:
+  beq r2 r0 .L936
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.148 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L936:
+  add r1 32 r1
+  read 0 r1 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function intconstexpr */
+
+
+.text
+; function mkassignexpr
+mkassignexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r5
+  or r0 r4 r1
+  write -12 r14 r1
+  add r1 8 r1
+  read 0 r1 r5
+  load 0 r6
+  load 11 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  read -8 r14 r4
+  or r0 r1 r2
+  read -12 r14 r1
+  write -16 r14 r2
+  add r2 32 r2
+  write 0 r2 r1
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump exprconvert
+  or r0 r1 r2
+  read -16 r14 r1
+  add r1 32 r3
+  add r3 4 r3
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkassignexpr */
+
+.data
+.balign 1
+.Lstring.151:
+	.ascii "left side of assignment expression is not an lvalue\000"
+/* end data */
+
+
+.text
+; function assignexpr
+.global assignexpr
+assignexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump condexpr
+  write -20 r14 r1
+  read 0 r1 r2
+  load 1 r3
+  load 9 r4
+  beq r2 r4 .L946
+  xor r2 12 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+  jump .L947
+.L946:
+  or r0 r3 r4
+.L947:
+  load 1 r3
+  bne r4 r0 .L949
+  xor r2 8 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L950
+.L949:
+  or r0 r3 r2
+.L950:
+  bne r2 r0 .L990
+  addr2reg tok r12
+  read 0 r12 r2
+  load 99 r3
+  sub r2 r3 r2
+  load 11 r3
+  bge r2 r3 .L990
+  shiftl r2 2 r3
+  addr2reg .Ljt953 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L954:
+  load 0 r2
+  write -40 r14 r2
+  jump .L976
+.L956:
+  load 75 r2
+  write -40 r14 r2
+  jump .L976
+.L958:
+  load 80 r2
+  write -40 r14 r2
+  jump .L976
+.L960:
+  load 81 r2
+  write -40 r14 r2
+  jump .L976
+.L962:
+  load 76 r2
+  write -40 r14 r2
+  jump .L976
+.L964:
+  load 77 r2
+  write -40 r14 r2
+  jump .L976
+.L966:
+  load 82 r2
+  write -40 r14 r2
+  jump .L976
+.L968:
+  load 83 r2
+  write -40 r14 r2
+  jump .L976
+.L970:
+  load 74 r2
+  write -40 r14 r2
+  jump .L976
+.L972:
+  load 90 r2
+  write -40 r14 r2
+  jump .L976
+.L974:
+  load 91 r2
+  write -40 r14 r2
+.L976:
+  add r1 4 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L978
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.151 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L978:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r5
+  or r0 r5 r2
+  read -40 r14 r5
+  read -20 r14 r1
+  write -32 r14 r2
+  beq r5 r0 .L988
+  read 0 r1 r2
+  load 4 r3
+  beq r2 r3 .L982
+  load 0 r2
+  write -36 r14 r2
+  jump .L984
+.L982:
+  add r1 20 r2
+  read 0 r2 r2
+  write -36 r14 r1
+  or r0 r2 r1
+.L984:
+  write -24 r14 r1
+  add r1 8 r2
+  read 0 r2 r4
+  add r1 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump mkpointertype
+  or r0 r1 r5
+  load 0 r6
+  load 14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  or r0 r1 r5
+  read -24 r14 r1
+  write -28 r14 r5
+  add r5 4 r3
+  load 1 r2
+  writeb 0 r3 r2
+  add r5 32 r3
+  load 0 r2
+  write 0 r3 r2
+  or r0 r1 r5
+  load 74 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  or r0 r1 r5
+  read -28 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkassignexpr
+  write -44 r14 r1
+  read -28 r14 r5
+  load 75 r4
+  savpc r15
+  add r15 12 r15
+  jump mkunaryexpr
+  or r0 r1 r3
+  read -36 r14 r1
+  read -40 r14 r5
+  read -32 r14 r2
+  bne r1 r0 .L986
+  or r0 r3 r1
+  jump .L987
+.L986:
+  add r1 20 r4
+  write 0 r4 r3
+.L987:
+  write -48 r14 r1
+  or r0 r2 r7
+  or r0 r1 r6
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump mkbinaryexpr
+  or r0 r1 r5
+  read -48 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkassignexpr
+  or r0 r1 r2
+  read -48 r14 r1
+  read -44 r14 r6
+  add r6 24 r3
+  write 0 r3 r2
+  add r1 8 r1
+  read 0 r1 r5
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+  jump .L990
+.L988:
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkassignexpr
+.L990:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt953:
+  .int .L954
+  .int .L956
+  .int .L958
+  .int .L960
+  .int .L962
+  .int .L964
+  .int .L966
+  .int .L968
+  .int .L970
+  .int .L972
+  .int .L974
+
+/* end function assignexpr */
+
+
+.text
+; function expr
+.global expr
+expr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r4
+  add r14 -20 r1
+  write -8 r14 r1
+.L995:
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  read -8 r14 r2
+  write 0 r2 r1
+  add r1 24 r2
+  write -16 r14 r2
+  addr2reg tok r12
+  read 0 r12 r2
+  load 110 r3
+  bne r2 r3 .L998
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -16 r14 r1
+  read -12 r14 r4
+  write -8 r14 r1
+  jump .L995
+.L998:
+  or r0 r1 r2
+  read -20 r14 r1
+  add r1 24 r3
+  read 0 r3 r3
+  beq r3 r0 .L1001
+  add r2 8 r2
+  read 0 r2 r5
+  or r0 r1 r6
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump mkexpr
+.L1001:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function expr */
+
+
+.text
+; function encodechar32
+encodechar32:
+  write 0 r4 r5
+  load 4 r1
+  jumpr 0 r15
+
+/* end function encodechar32 */
+
+
+.text
+; function encodechar16
+encodechar16:
+  and r6 0xFF r1
+  beq r1 r0 .L1010
+  writeh 0 r4 r5
+  load 2 r1
+  jumpr 0 r15
+.L1010:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  savpc r15
+  add r15 12 r15
+  jump utf16enc
+  shiftl r1 1 r1
+.L1011:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function encodechar16 */
+
+
+.text
+; function encodechar8
+encodechar8:
+  and r6 0xFF r1
+  beq r1 r0 .L1016
+  writeb 0 r4 r5
+  load 1 r1
+  jumpr 0 r15
+.L1016:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  savpc r15
+  add r15 12 r15
+  jump utf8enc
+.L1017:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function encodechar8 */
+
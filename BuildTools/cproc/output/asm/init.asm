@@ -0,0 +1,1373 @@
+
+.text
+; function mkinit
+.global mkinit
+mkinit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -8 r14 r7
+  add r14 -20 r1
+  write 0 r1 r6
+  write -12 r14 r5
+  write -16 r14 r4
+  load 20 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -8 r14 r7
+  read -12 r14 r2
+  read -16 r14 r3
+  write 0 r1 r3
+  add r1 4 r3
+  write 0 r3 r2
+  add r1 8 r2
+  write 0 r2 r7
+  add r1 12 r3
+  readhu -20 r14 r2
+  writeh 0 r3 r2
+  add r14 -20 r2
+  add r2 2 r2
+  add r3 2 r3
+  readhu 0 r2 r2
+  writeh 0 r3 r2
+  add r1 16 r3
+  load 0 r2
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkinit */
+
+
+.text
+; function initadd
+initadd:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 40 r13
+  write -32 r14 r4
+  add r4 524 r1
+  read 0 r1 r1
+.L6:
+  write -28 r14 r1
+  read 0 r1 r1
+  beq r1 r0 .L19
+  add r1 4 r2
+  read 0 r2 r4
+  shiftl r4 3 r2
+  add r1 12 r3
+  add r3 2 r3
+  readh 0 r3 r6
+  write -12 r14 r6
+  sub r2 r6 r2
+  read 0 r5 r3
+  shiftl r3 3 r3
+  add r5 12 r6
+  readh 0 r6 r6
+  add r3 r6 r3
+  ble r2 r3 .L18
+  add r5 4 r2
+  read 0 r2 r2
+  shiftl r2 3 r6
+  add r5 12 r3
+  add r3 2 r3
+  readh 0 r3 r3
+  sub r6 r3 r6
+  write -8 r14 r6
+  read 0 r1 r6
+  shiftl r6 3 r6
+  add r1 12 r7
+  readh 0 r7 r7
+  add r6 r7 r7
+  read -8 r14 r6
+  sltu r7 r6 r7
+  xor r7 1 r7
+  read -12 r14 r6
+  bne r7 r0 .L16
+  shiftl r4 3 r4
+  write -16 r14 r4
+  read -16 r14 r4
+  sub r4 r6 r4
+  shiftl r2 3 r6
+  write -20 r14 r6
+  read -20 r14 r6
+  sub r6 r3 r6
+  bgt r4 r6 .L18
+.L10:
+  add r1 16 r1
+  read 0 r1 r1
+  load 0 r4
+  beq r1 r0 .L13
+  add r1 4 r4
+  read 0 r4 r4
+  shiftl r4 3 r4
+  add r1 12 r6
+  add r6 2 r6
+  readh 0 r6 r6
+  sub r4 r6 r6
+  shiftl r2 3 r4
+  write -24 r14 r4
+  read -24 r14 r4
+  sub r4 r3 r4
+  sltu r4 r6 r4
+  xor r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L13:
+  bne r4 r0 .L10
+  read -28 r14 r2
+  read -32 r14 r4
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L20
+.L16:
+  read -28 r14 r2
+  read -32 r14 r4
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L20
+.L18:
+  add r1 16 r1
+  jump .L6
+.L19:
+  read -32 r14 r4
+  or r0 r1 r2
+  read -28 r14 r1
+.L20:
+  add r5 16 r3
+  write 0 r3 r2
+  write 0 r1 r5
+  add r5 16 r1
+  add r4 524 r2
+  write 0 r2 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function initadd */
+
+.data
+.balign 1
+.Lstring.4:
+	.ascii "internal error: too many designators\000"
+/* end data */
+
+
+.text
+; function subobj
+subobj:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  add r4 516 r1
+  read 0 r1 r2
+  read 0 r2 r1
+  add r6 r1 r1
+  write -8 r14 r1
+  add r4 516 r3
+  add r2 16 r2
+  write 0 r3 r2
+  add r4 512 r3
+  bne r2 r3 .L26
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.4 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -8 r14 r1
+  read -12 r14 r5
+  read -16 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L26:
+  add r4 516 r2
+  read 0 r2 r2
+  add r2 4 r2
+  write 0 r2 r5
+  add r4 516 r2
+  read 0 r2 r2
+  write 0 r2 r1
+  add r4 516 r1
+  read 0 r1 r1
+  add r1 12 r2
+  load 0 r1
+  writeb 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function subobj */
+
+
+.text
+; function findmember
+findmember:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r5
+  write -12 r14 r4
+  add r4 516 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 40 r1
+  add r1 4 r1
+  read 0 r1 r1
+.L31:
+  write -16 r14 r1
+  beq r1 r0 .L40
+  read 0 r1 r2
+  bne r2 r0 .L36
+  add r1 4 r2
+  read 0 r2 r5
+  add r1 12 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump subobj
+  read -8 r14 r5
+  read -12 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump findmember
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+  and r2 0xFF r2
+  bne r2 r0 .L35
+  add r4 516 r3
+  read 0 r3 r2
+  load 16 r6
+  sub r2 r6 r2
+  write 0 r3 r2
+  jump .L38
+.L35:
+  load 1 r1
+  jump .L41
+.L36:
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+  beq r2 r0 .L39
+.L38:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L31
+.L39:
+  add r4 516 r2
+  read 0 r2 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r1 4 r2
+  read 0 r2 r5
+  add r1 12 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump subobj
+  load 1 r1
+  jump .L41
+.L40:
+  load 0 r1
+.L41:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function findmember */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "index designator is only valid for array types\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "index designator is larger than array length\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "for index designator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "member designator only valid for struct/union types\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "for member designator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "union\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "struct\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "%s has no member named '%s'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "after designator\000"
+/* end data */
+
+
+.text
+; function designator
+designator:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+  write -16 r14 r5
+  add r5 520 r1
+  add r5 524 r2
+  write 0 r2 r1
+  add r5 512 r1
+  read 0 r1 r1
+  add r5 516 r2
+  write 0 r2 r1
+.L45:
+  add r5 516 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  write -4 r14 r1
+  addr2reg tok r12
+  read 0 r12 r2
+  load 70 r3
+  beq r2 r3 .L59
+  load 70 r3
+  bge r2 r3 .L57
+  load 64 r3
+  bne r2 r3 .L56
+  read 0 r1 r1
+  load 13 r2
+  beq r1 r2 .L51
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.7 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L51:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -12 r14 r4
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump intconstexpr
+  or r0 r1 r2
+  read -4 r14 r1
+  read -16 r14 r5
+  add r1 20 r3
+  read 0 r3 r3
+  add r3 12 r3
+  read 0 r3 r3
+  mults r2 r3 r2
+  add r5 516 r3
+  read 0 r3 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r5 516 r2
+  read 0 r2 r2
+  add r2 8 r2
+  read 0 r2 r2
+  add r1 12 r3
+  read 0 r3 r3
+  blt r2 r3 .L55
+  add r1 36 r2
+  readbu 0 r2 r2
+  bne r2 r0 .L54
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.8 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -4 r14 r1
+  read -16 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+.L54:
+  or r0 r1 r2
+  add r5 516 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r2 20 r3
+  read 0 r3 r3
+  add r3 12 r3
+  read 0 r3 r3
+  add r1 r3 r1
+  add r2 12 r2
+  write 0 r2 r1
+.L55:
+  addr2reg .Lstring.9 r5
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -4 r14 r1
+  read -16 r14 r5
+  add r1 20 r2
+  or r0 r5 r1
+  read 0 r2 r5
+  add r1 516 r2
+  read 0 r2 r2
+  add r2 8 r2
+  read 0 r2 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump subobj
+  read -16 r14 r5
+  read -12 r14 r4
+  jump .L45
+.L56:
+  load 64 r1
+  sltu r2 r1 r1
+.L57:
+  addr2reg .Lstring.15 r5
+  load 99 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L59:
+  read 0 r1 r1
+  load 0 r2
+  load 15 r3
+  bne r1 r3 .L61
+  or r0 r2 r1
+  jump .L62
+.L61:
+  xor r1 16 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L62:
+  beq r1 r0 .L64
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L64:
+  savpc r15
+  add r15 12 r15
+  jump next
+  addr2reg .Lstring.11 r5
+  load 4 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  or r0 r1 r4
+  read -16 r14 r5
+  write -8 r14 r4
+  or r0 r5 r1
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump findmember
+  or r0 r1 r2
+  read -8 r14 r4
+  read -4 r14 r1
+  and r2 0xFF r2
+  bne r2 r0 .L69
+  read 0 r1 r1
+  load 16 r2
+  beq r1 r2 .L67
+  addr2reg .Lstring.13 r1
+  jump .L68
+.L67:
+  addr2reg .Lstring.12 r1
+.L68:
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r4 r7
+  addr2reg .Lstring.14 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L69:
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r5
+  read -12 r14 r4
+  jump .L45
+
+/* end function designator */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "internal error: init cursor has unexpected type\000"
+/* end data */
+
+
+.text
+; function focus
+focus:
+  add r4 516 r1
+  read 0 r1 r2
+  add r2 4 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 15 r3
+  beq r1 r3 .L82
+  load 15 r3
+  blt r1 r3 .L77
+  load 16 r3
+  beq r1 r3 .L82
+  load 16 r2
+  sltu r1 r2 r1
+  jump .L79
+.L77:
+  load 13 r3
+  beq r1 r3 .L80
+  load 13 r2
+  sltu r1 r2 r1
+.L79:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.17 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L84
+.L80:
+  add r2 4 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r5
+  add r2 8 r2
+  load 0 r1
+  write 0 r2 r1
+  add r4 516 r1
+  read 0 r1 r2
+  add r2 4 r1
+  read 0 r1 r1
+  add r1 36 r1
+  readbu 0 r1 r1
+  beq r1 r0 .L83
+  add r5 12 r1
+  read 0 r1 r1
+  add r2 4 r2
+  read 0 r2 r2
+  add r2 12 r2
+  write 0 r2 r1
+  jump .L83
+.L82:
+  add r2 4 r1
+  read 0 r1 r1
+  add r1 40 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r2 8 r2
+  write 0 r2 r1
+  add r4 516 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r5
+.L83:
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump subobj
+.L84:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function focus */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "too many initializers for type\000"
+/* end data */
+
+
+.text
+; function advance
+advance:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+.L87:
+  add r4 516 r2
+  read 0 r2 r1
+  load 16 r3
+  sub r1 r3 r1
+  write 0 r2 r1
+  add r1 4 r2
+  read 0 r2 r2
+  read 0 r2 r3
+  load 15 r5
+  beq r3 r5 .L98
+  load 15 r5
+  bge r3 r5 .L99
+  load 13 r5
+  beq r3 r5 .L93
+  or r0 r3 r2
+  load 13 r3
+  sltu r2 r3 r2
+  jump .L99
+.L93:
+  add r1 8 r3
+  read 0 r3 r1
+  add r2 20 r5
+  read 0 r5 r5
+  add r5 12 r5
+  read 0 r5 r5
+  add r1 r5 r1
+  write 0 r3 r1
+  add r4 516 r1
+  read 0 r1 r1
+  add r1 8 r3
+  read 0 r3 r5
+  add r2 12 r3
+  read 0 r3 r3
+  bne r5 r3 .L97
+  add r2 36 r5
+  readbu 0 r5 r5
+  beq r5 r0 .L99
+  or r0 r3 r1
+  add r2 12 r3
+  add r2 20 r5
+  read 0 r5 r5
+  add r5 12 r5
+  read 0 r5 r5
+  add r1 r5 r1
+  write 0 r3 r1
+.L97:
+  add r2 20 r1
+  read 0 r1 r5
+  add r4 516 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump subobj
+  jump .L102
+.L98:
+  or r0 r1 r2
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r1
+  add r2 8 r2
+  write 0 r2 r1
+  add r4 516 r1
+  read 0 r1 r1
+  add r1 8 r2
+  read 0 r2 r2
+  bne r2 r0 .L101
+.L99:
+  add r4 512 r2
+  read 0 r2 r2
+  bne r1 r2 .L87
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.19 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L87
+.L101:
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 4 r2
+  read 0 r2 r5
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump subobj
+.L102:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function advance */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "initializer specified for incomplete type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "initializer specified for variable length array type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "array of unknown size has empty initializer\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "nested braces around scalar initializer\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "p.cur->type->kind == TYPEARRAY\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "BuildTools/cproc/init.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "cannot initialize array with string literal of different width\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "t->prop & PROPSCALAR\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "expected ',' or '}' after initializer\000"
+/* end data */
+
+
+.text
+; function parseinit
+.global parseinit
+parseinit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 572 r13
+  write -16 r14 r5
+  write -32 r14 r4
+  add r14 -564 r1
+  add r1 512 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -564 r1
+  add r1 516 r2
+  add r14 -564 r1
+  write 0 r2 r1
+  load 0 r1
+  write -564 r14 r1
+  add r14 -564 r1
+  add r1 516 r1
+  read 0 r1 r1
+  add r1 4 r1
+  write 0 r1 r5
+  add r14 -564 r1
+  add r1 516 r1
+  read 0 r1 r1
+  add r1 12 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -564 r1
+  add r1 520 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -564 r1
+  add r1 520 r1
+  add r14 -564 r2
+  add r2 524 r2
+  write 0 r2 r1
+  add r5 36 r1
+  readbu 0 r1 r2
+  load 0 r1
+  beq r2 r0 .L107
+  read 0 r5 r1
+  xor r1 13 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L107:
+  beq r1 r0 .L109
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.21 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r5
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L109:
+  read 0 r5 r2
+  load 0 r1
+  load 13 r3
+  bne r2 r3 .L111
+  add r5 20 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L111:
+  beq r1 r0 .L113
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.22 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L113:
+  add r14 -564 r1
+  add r1 512 r1
+  read 0 r1 r1
+  beq r1 r0 .L126
+  addr2reg tok r12
+  read 0 r12 r2
+  load 1 r3
+  load 64 r5
+  beq r2 r5 .L116
+  xor r2 70 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L117
+.L116:
+  or r0 r3 r2
+.L117:
+  bne r2 r0 .L125
+  add r14 -564 r2
+  add r2 516 r2
+  read 0 r2 r2
+  bne r2 r1 .L124
+  add r1 4 r2
+  read 0 r2 r2
+  read 0 r2 r3
+  load 1 r2
+  load 15 r4
+  beq r3 r4 .L121
+  add r1 4 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  xor r1 16 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L122
+.L121:
+  or r0 r2 r1
+.L122:
+  beq r1 r0 .L126
+  add r14 -564 r4
+  savpc r15
+  add r15 12 r15
+  jump focus
+  jump .L126
+.L124:
+  add r14 -564 r4
+  savpc r15
+  add r15 12 r15
+  jump advance
+  jump .L126
+.L125:
+  add r14 -564 r5
+  savpc r15
+  add r15 12 r15
+  jump designator
+.L126:
+  load 68 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -32 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L165
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  write -28 r14 r1
+.L128:
+  add r14 -564 r2
+  add r2 516 r2
+  read 0 r2 r2
+  add r2 4 r2
+  read 0 r2 r5
+  write -24 r14 r5
+  read 0 r5 r2
+  load 15 r3
+  beq r2 r3 .L153
+  load 15 r3
+  blt r2 r3 .L133
+  load 16 r3
+  beq r2 r3 .L153
+  load 16 r3
+  sltu r2 r3 r2
+  jump .L150
+.L133:
+  load 13 r3
+  bne r2 r3 .L149
+  add r1 5 r2
+  readbu 0 r2 r3
+  load 1 r2
+  beq r3 r0 .L136
+  add r1 20 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  xor r1 2 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L136:
+  load 1 r1
+  bne r2 r0 .L138
+  add r5 20 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 2 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L138:
+  bne r1 r0 .L154
+  read -24 r14 r5
+  read -28 r14 r1
+  add r5 20 r2
+  read 0 r2 r4
+  add r1 20 r1
+  read 0 r1 r7
+  write -20 r14 r7
+  add r4 4 r1
+  read 0 r1 r1
+  and r1 1 r2
+  load 0 r1
+  bne r2 r0 .L142
+  or r0 r1 r2
+  jump .L143
+.L142:
+  add r7 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L143:
+  load 0 r1
+  bne r2 r0 .L145
+  add r7 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  read -20 r14 r7
+  read -24 r14 r5
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L145:
+  beq r1 r0 .L147
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.27 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -20 r14 r7
+  read -24 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L147:
+  add r5 36 r1
+  readbu 0 r1 r1
+  beq r1 r0 .L157
+  add r7 8 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r1
+  add r5 12 r2
+  write 0 r2 r1
+  jump .L157
+.L149:
+  load 13 r3
+  sltu r2 r3 r2
+.L150:
+  add r5 4 r2
+  read 0 r2 r2
+  and r2 16 r2
+  bne r2 r0 .L152
+  load 258 r6
+  addr2reg .Lstring.26 r5
+  addr2reg .Lstring.28 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -24 r14 r5
+  read -28 r14 r1
+.L152:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump exprassign
+  or r0 r1 r7
+  jump .L157
+.L153:
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  and r1 0xFF r1
+  bne r1 r0 .L155
+.L154:
+  add r14 -564 r4
+  savpc r15
+  add r15 12 r15
+  jump focus
+  read -28 r14 r1
+  jump .L128
+.L155:
+  read -28 r14 r1
+  or r0 r1 r7
+.L157:
+  add r14 -564 r1
+  add r1 516 r1
+  read 0 r1 r2
+  load 0 r1
+  add r14 -564 r3
+  ble r2 r3 .L161
+  load32 -16 r1
+  add r2 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  read 0 r1 r3
+  load 1 r1
+  load 15 r4
+  beq r3 r4 .L160
+  load32 -16 r1
+  add r2 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  xor r1 16 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L160:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L161:
+  bne r1 r0 .L163
+  load 0 r1
+  writeh -36 r14 r1
+  add r14 -36 r1
+  add r1 2 r3
+  load 0 r1
+  writeh 0 r3 r1
+  jump .L164
+.L163:
+  load32 -16 r1
+  add r2 r1 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 16 r1
+  readhu 0 r1 r3
+  writeh -36 r14 r3
+  add r1 2 r1
+  add r14 -36 r3
+  add r3 2 r3
+  readhu 0 r1 r1
+  writeh 0 r3 r1
+.L164:
+  read 0 r2 r4
+  read 0 r2 r1
+  add r2 4 r2
+  read 0 r2 r2
+  add r2 12 r2
+  read 0 r2 r2
+  add r1 r2 r5
+  read -36 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump mkinit
+  or r0 r1 r5
+  add r14 -564 r4
+  savpc r15
+  add r15 12 r15
+  jump initadd
+  jump .L188
+.L165:
+  load 69 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -32 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L173
+  add r14 -564 r1
+  add r1 512 r1
+  read 0 r1 r1
+  add r14 -564 r2
+  add r2 516 r2
+  read 0 r2 r2
+  bne r1 r2 .L172
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 16 r1
+  beq r1 r0 .L169
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.24 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L169:
+  add r14 -564 r1
+  add r1 512 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  load 13 r2
+  beq r1 r2 .L171
+  load 231 r6
+  addr2reg .Lstring.26 r5
+  addr2reg .Lstring.25 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+.L171:
+  add r14 -564 r4
+  savpc r15
+  add r15 12 r15
+  jump focus
+  read -32 r14 r4
+.L172:
+  add r14 -564 r1
+  add r1 516 r1
+  read 0 r1 r1
+  add r14 -564 r2
+  add r2 512 r2
+  write 0 r2 r1
+  add r1 12 r2
+  load 1 r1
+  writeb 0 r2 r1
+  jump .L113
+.L173:
+  add r14 -564 r1
+  add r1 516 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 36 r1
+  readbu 0 r1 r1
+  beq r1 r0 .L175
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.23 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L175:
+  add r14 -564 r1
+  add r1 512 r1
+  read 0 r1 r1
+  beq r1 r0 .L191
+  addr2reg tok r12
+  read 0 r12 r1
+  load 110 r2
+  beq r1 r2 .L179
+  load 69 r2
+  beq r1 r2 .L180
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.29 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L180
+.L179:
+  savpc r15
+  add r15 12 r15
+  jump next
+  addr2reg tok r12
+  read 0 r12 r1
+  load 69 r2
+  bne r1 r2 .L190
+.L180:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -32 r14 r4
+  add r14 -564 r1
+  add r1 512 r1
+  read 0 r1 r1
+  add r14 -564 r2
+  add r2 516 r2
+  write 0 r2 r1
+.L181:
+  add r14 -564 r2
+  beq r1 r2 .L183
+  load 16 r2
+  sub r1 r2 r1
+  jump .L184
+.L183:
+  load 0 r1
+.L184:
+  add r14 -564 r2
+  add r2 512 r2
+  write 0 r2 r1
+  load 0 r2
+  beq r1 r0 .L187
+  add r1 12 r2
+  readbu 0 r2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L187:
+  bne r2 r0 .L181
+.L188:
+  add r14 -564 r1
+  add r1 516 r1
+  read 0 r1 r1
+  add r1 4 r2
+  read 0 r2 r2
+  add r2 36 r2
+  readbu 0 r2 r2
+  beq r2 r0 .L175
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 36 r2
+  load 0 r1
+  writeb 0 r2 r1
+  jump .L175
+.L190:
+  read -32 r14 r4
+  jump .L113
+.L191:
+  add r14 -564 r1
+  add r1 520 r1
+  read 0 r1 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parseinit */
+
@@ -0,0 +1,495 @@
+.data
+.balign 1
+.Lstring.2:
+	.ascii "usage: %s [input]\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.4:
+	.ascii "cproc-qbe\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "w\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "open %s:\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "<stdin>\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "unexpected ';' at top-level\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "expected declaration or function definition\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "write failed\000"
+/* end data */
+
+
+.text
+; function main
+.global main
+main:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 92 r13
+  write -84 r14 r8
+  savpc r15
+  add r15 12 r15
+  jump sys_argc
+  write -16 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump sys_argv
+  or r0 r1 r2
+  write -20 r14 r2
+  add r2 0 r1
+  read 0 r1 r4
+  addr2reg .Lstring.4 r5
+  savpc r15
+  add r15 12 r15
+  jump progname
+  read -20 r14 r2
+  read -16 r14 r3
+  addr2reg argv0 r12
+  write 0 r12 r1
+  load 0 r5
+  load 0 r4
+  load 0 r1
+  write -80 r14 r5
+  or r0 r4 r8
+.L3:
+  write -64 r14 r8
+  bles r3 r0 .L6
+  add r2 4 r2
+  load 1 r4
+  sub r3 r4 r3
+.L6:
+  load 1 r4
+  beq r3 r0 .L8
+  read 0 r2 r4
+  add r4 0 r4
+  readb 0 r4 r4
+  xor r4 45 r4
+  sltu r0 r4 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L8:
+  bne r4 r0 .L59
+  read 0 r2 r4
+  add r4 1 r5
+  readb 0 r5 r5
+  load 0 r6
+  write -24 r14 r6
+  load 45 r6
+  xor r5 r6 r7
+  sltu r7 1 r7
+  read -80 r14 r5
+  read -24 r14 r6
+  beq r7 r0 .L11
+  add r4 2 r6
+  readb 0 r6 r6
+  xor r6 0 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L11:
+  bne r6 r0 .L57
+  add r4 1 r4
+  load 0 r6
+  write -40 r14 r8
+  or r0 r1 r8
+.L14:
+  write -44 r14 r5
+  write -48 r14 r8
+  write -52 r14 r3
+  write -60 r14 r2
+  write -56 r14 r4
+  write -36 r14 r6
+  shiftl r6 24 r6
+  shiftrs r6 24 r6
+  load 0 r1
+  bne r6 r0 .L16
+  readb 0 r4 r1
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L16:
+  beq r1 r0 .L55
+  readb 0 r4 r1
+  load 111 r6
+  beq r1 r6 .L41
+  load 111 r5
+  sltu r1 r5 r5
+  write -28 r14 r5
+  read -44 r14 r5
+  read -40 r14 r7
+  read -28 r14 r12
+  bne r12 r0 .L32
+  load 116 r6
+  beq r1 r6 .L22
+  or r0 r1 r5
+  load 116 r1
+  sltu r5 r1 r1
+  jump .L36
+.L22:
+  add r4 1 r1
+  readb 0 r1 r1
+  bne r1 r0 .L28
+  add r2 4 r1
+  read 0 r1 r1
+  bne r1 r0 .L26
+  addr2reg argv0 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.2 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  savpc r15
+  add r15 12 r15
+  jump abort
+  read -44 r14 r5
+  read -40 r14 r4
+  read -52 r14 r3
+  read -60 r14 r2
+  or r0 r4 r7
+  read -56 r14 r4
+  load 0 r1
+  jump .L27
+.L26:
+  load 1 r6
+  sub r3 r6 r3
+  add r2 4 r2
+.L27:
+  or r0 r1 r12
+  or r0 r4 r1
+  or r0 r12 r4
+  jump .L30
+.L28:
+  or r0 r4 r1
+  add r4 1 r4
+  or r0 r4 r1
+.L30:
+  load 1 r6
+  or r0 r1 r8
+  or r0 r6 r1
+  jump .L53
+.L32:
+  or r0 r1 r5
+  or r0 r4 r1
+  or r0 r8 r4
+  load 69 r6
+  xor r5 r6 r6
+  sltu r6 1 r6
+  write -32 r14 r6
+  read -40 r14 r7
+  read -36 r14 r6
+  read -32 r14 r12
+  bne r12 r0 .L38
+  or r0 r5 r1
+  load 69 r2
+  sltu r1 r2 r1
+.L36:
+  addr2reg argv0 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.2 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  read -44 r14 r5
+  read -40 r14 r4
+  or r0 r4 r7
+  read -48 r14 r4
+  read -52 r14 r3
+  read -60 r14 r2
+  read -56 r14 r1
+  read -36 r14 r6
+  or r0 r1 r8
+  or r0 r6 r1
+  jump .L53
+.L38:
+  or r0 r6 r5
+  load 1 r6
+  or r0 r1 r8
+  or r0 r5 r1
+  or r0 r6 r5
+  jump .L53
+.L41:
+  or r0 r4 r1
+  or r0 r8 r4
+  add r1 1 r6
+  readb 0 r6 r6
+  bne r6 r0 .L49
+  add r2 4 r6
+  read 0 r6 r7
+  bne r7 r0 .L47
+  addr2reg argv0 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.2 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  savpc r15
+  add r15 12 r15
+  jump abort
+  read -44 r14 r5
+  read -48 r14 r4
+  read -52 r14 r3
+  read -60 r14 r2
+  read -56 r14 r1
+  load 0 r6
+  or r0 r6 r7
+  jump .L48
+.L47:
+  load 1 r6
+  sub r3 r6 r3
+  add r2 4 r2
+.L48:
+  or r0 r7 r12
+  or r0 r1 r7
+  or r0 r12 r1
+  jump .L51
+.L49:
+  add r1 1 r1
+  or r0 r1 r7
+.L51:
+  load 1 r6
+  or r0 r7 r8
+  or r0 r1 r7
+  or r0 r6 r1
+.L53:
+  add r8 1 r8
+  write -40 r14 r7
+  or r0 r4 r12
+  or r0 r8 r4
+  or r0 r12 r8
+  or r0 r1 r6
+  jump .L14
+.L55:
+  read -40 r14 r7
+  write -80 r14 r5
+  or r0 r8 r1
+  or r0 r7 r8
+  jump .L3
+.L57:
+  add r2 4 r2
+  load 1 r4
+  sub r3 r4 r3
+  write -68 r14 r3
+  write -72 r14 r2
+  jump .L60
+.L59:
+  write -68 r14 r3
+  write -72 r14 r2
+.L60:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump targinit
+  read -68 r14 r3
+  read -72 r14 r2
+  read -64 r14 r5
+  load 0 r1
+  beq r5 r0 .L62
+  addr2reg __stdout_file r6
+  or r0 r5 r1
+  addr2reg .Lstring.5 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump freopen
+  read -68 r14 r3
+  read -72 r14 r2
+  read -64 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L62:
+  beq r1 r0 .L64
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -68 r14 r3
+  read -72 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L64:
+  beq r3 r0 .L68
+.L65:
+  or r0 r3 r1
+  load 1 r3
+  sub r1 r3 r3
+  write -76 r14 r3
+  beq r1 r0 .L67
+  shiftl r3 2 r1
+  add r2 r1 r1
+  read 0 r1 r4
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump scanfrom
+  read -72 r14 r2
+  read -76 r14 r3
+  jump .L65
+.L67:
+  savpc r15
+  add r15 12 r15
+  jump scanopen
+  jump .L69
+.L68:
+  addr2reg __stdin_file r5
+  addr2reg .Lstring.7 r4
+  savpc r15
+  add r15 12 r15
+  jump scanfrom
+.L69:
+  savpc r15
+  add r15 12 r15
+  jump ppinit
+  read -80 r14 r5
+  and r5 0xFF r1
+  bne r1 r0 .L77
+  savpc r15
+  add r15 12 r15
+  jump scopeinit
+.L71:
+  addr2reg tok r12
+  read 0 r12 r1
+  load 1 r2
+  beq r1 r2 .L76
+  load 0 r5
+  addr2reg filescope r4
+  savpc r15
+  add r15 12 r15
+  jump decl
+  and r1 0xFF r1
+  bne r1 r0 .L71
+  addr2reg tok r12
+  read 0 r12 r1
+  load 97 r2
+  bne r1 r2 .L75
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.8 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L75:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L71
+.L76:
+  savpc r15
+  add r15 12 r15
+  jump emittentativedefns
+  jump .L80
+.L77:
+  addr2reg ppflags r12
+  read 0 r12 r1
+  or r1 1 r1
+  addr2reg ppflags r12
+  write 0 r12 r1
+.L78:
+  addr2reg tok r12
+  read 0 r12 r1
+  load 1 r2
+  beq r1 r2 .L80
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokenprint
+  savpc r15
+  add r15 12 r15
+  jump next
+  jump .L78
+.L80:
+  addr2reg __stdout_file r4
+  savpc r15
+  add r15 12 r15
+  jump fflush
+  addr2reg __stdout_file r4
+  savpc r15
+  add r15 12 r15
+  jump ferror
+  beq r1 r0 .L82
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+.L82:
+  load 0 r1
+  read -84 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function main */
+
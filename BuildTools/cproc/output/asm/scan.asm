@@ -0,0 +1,1759 @@
+
+.text
+; function bufadd
+bufadd:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  add r4 4 r1
+  read 0 r1 r2
+  add r4 8 r1
+  read 0 r1 r1
+  blt r2 r1 .L7
+  bne r1 r0 .L5
+  load 256 r1
+  or r0 r1 r5
+  jump .L6
+.L5:
+  shiftl r1 1 r5
+.L6:
+  add r4 8 r1
+  write 0 r1 r5
+  read 0 r4 r4
+  load 1 r6
+  savpc r15
+  add r15 12 r15
+  jump xreallocarray
+  read -12 r14 r5
+  read -16 r14 r4
+  write 0 r4 r1
+.L7:
+  read 0 r4 r1
+  add r4 4 r4
+  read 0 r4 r2
+  add r2 1 r3
+  write 0 r4 r3
+  add r1 r2 r1
+  writeb 0 r1 r5
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bufadd */
+
+
+.text
+; function bufget
+bufget:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump bufadd
+  read -16 r14 r4
+  add r4 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -16 r14 r4
+  write -12 r14 r1
+  read 0 r4 r5
+  add r4 4 r2
+  read 0 r2 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -12 r14 r1
+  read -16 r14 r4
+  add r4 4 r3
+  load 0 r2
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bufget */
+
+
+.text
+; function nextchar
+nextchar:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r4 4 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L17
+  or r0 r4 r1
+  jump .L18
+.L17:
+  or r0 r4 r1
+  add r4 24 r4
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump bufadd
+  read -16 r14 r1
+.L18:
+  or r0 r1 r4
+.L19:
+  add r4 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  read -16 r14 r4
+  write 0 r4 r1
+  load 10 r2
+  beq r1 r2 .L25
+  add r4 12 r2
+  add r2 8 r3
+  read 0 r3 r2
+  add r2 1 r2
+  write 0 r3 r2
+  load 92 r2
+  bne r1 r2 .L26
+  add r4 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  read -16 r14 r4
+  load 10 r2
+  bne r1 r2 .L23
+  add r4 12 r1
+  add r1 4 r2
+  read 0 r2 r1
+  add r1 1 r1
+  write 0 r2 r1
+  add r4 12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  jump .L19
+.L23:
+  or r0 r1 r12
+  or r0 r4 r1
+  or r0 r12 r4
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump ungetc
+  jump .L26
+.L25:
+  add r4 12 r1
+  add r1 4 r2
+  read 0 r2 r1
+  add r1 1 r1
+  write 0 r2 r1
+  add r4 12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+.L26:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function nextchar */
+
+
+.text
+; function op3
+op3:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -28 r14 r7
+  write -32 r14 r6
+  write -20 r14 r5
+  write -24 r14 r4
+  read 0 r4 r3
+  write -16 r14 r3
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r3
+  read -20 r14 r1
+  read -24 r14 r4
+  read 0 r4 r2
+  load 61 r5
+  beq r2 r5 .L32
+  bne r2 r3 .L33
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -28 r14 r1
+  jump .L33
+.L32:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r1
+.L33:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function op3 */
+
+
+.text
+; function op4
+op4:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  read 8 r14 r1
+  write -28 r14 r1
+  write -20 r14 r7
+  write -32 r14 r6
+  write -16 r14 r5
+  write -24 r14 r4
+  read 0 r4 r3
+  write -12 r14 r3
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -12 r14 r3
+  read -16 r14 r1
+  read -24 r14 r4
+  read 0 r4 r2
+  load 61 r5
+  beq r2 r5 .L40
+  bne r2 r3 .L41
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -20 r14 r1
+  read -24 r14 r4
+  read 0 r4 r2
+  load 61 r3
+  bne r2 r3 .L41
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -28 r14 r1
+  jump .L41
+.L40:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r1
+.L41:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function op4 */
+
+
+.text
+; function ident
+ident:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r4 4 r2
+  load 1 r1
+  writeb 0 r2 r1
+.L45:
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump isalnum
+  or r0 r1 r2
+  read -16 r14 r4
+  load 1 r1
+  bne r2 r0 .L47
+  read 0 r4 r1
+  xor r1 95 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L47:
+  beq r1 r0 .L49
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+  jump .L45
+.L49:
+  load 4 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ident */
+
+
+.text
+; function number
+number:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r4 4 r2
+  load 1 r1
+  writeb 0 r2 r1
+  load 0 r1
+  write -12 r14 r1
+.L55:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -12 r14 r1
+  read -16 r14 r4
+  or r0 r4 r2
+  read 0 r4 r4
+  load 80 r3
+  beq r4 r3 .L80
+  load 80 r3
+  blt r4 r3 .L64
+  load 101 r1
+  beq r4 r1 .L80
+  load 101 r1
+  blt r4 r1 .L62
+  load 112 r1
+  beq r4 r1 .L80
+  load 112 r1
+  sltu r4 r1 r1
+  jump .L72
+.L62:
+  load 95 r1
+  beq r4 r1 .L79
+  load 95 r1
+  sltu r4 r1 r1
+  jump .L72
+.L64:
+  load 46 r3
+  beq r4 r3 .L79
+  load 46 r3
+  blt r4 r3 .L68
+  load 69 r1
+  beq r4 r1 .L80
+  load 69 r1
+  sltu r4 r1 r1
+  jump .L72
+.L68:
+  load 45 r3
+  beq r4 r3 .L75
+  load 45 r3
+  bge r4 r3 .L72
+  load 43 r3
+  beq r4 r3 .L74
+  load 43 r1
+  sltu r4 r1 r1
+.L72:
+  savpc r15
+  add r15 12 r15
+  jump isalnum
+  read -16 r14 r4
+  beq r1 r0 .L77
+  load 0 r1
+  jump .L81
+.L74:
+  or r0 r2 r4
+  jump .L76
+.L75:
+  or r0 r2 r4
+.L76:
+  and r1 0xFF r2
+  bne r2 r0 .L81
+.L77:
+  load 5 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L79:
+  or r0 r2 r4
+  load 0 r1
+  jump .L81
+.L80:
+  or r0 r2 r4
+  load 1 r1
+.L81:
+  write -12 r14 r1
+  jump .L55
+
+/* end function number */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "invalid hexadecimal escape sequence\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "'\042?\134abfnrtv\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "invalid escape sequence\000"
+/* end data */
+
+
+.text
+; function escape
+escape:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+  read 0 r4 r5
+  load 120 r1
+  beq r5 r1 .L97
+  load 48 r1
+  sub r5 r1 r1
+  sltu r1 8 r1
+  bne r1 r0 .L90
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump strchr
+  read -16 r14 r4
+  bne r1 r0 .L89
+  add r4 12 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.13 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L101
+.L89:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  jump .L101
+.L90:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+  read 0 r4 r1
+  load 48 r2
+  sub r1 r2 r1
+  sltu r1 8 r1
+  beq r1 r0 .L101
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+  read 0 r4 r1
+  load 48 r2
+  sub r1 r2 r1
+  sltu r1 8 r1
+  beq r1 r0 .L101
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  jump .L101
+.L97:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump isxdigit
+  read -16 r14 r4
+  bne r1 r0 .L99
+  add r4 12 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.11 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L99:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump isxdigit
+  read -16 r14 r4
+  bne r1 r0 .L99
+.L101:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function escape */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "newline in character constant\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "EOF in character constant\000"
+/* end data */
+
+
+.text
+; function charconst
+charconst:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r4 4 r2
+  load 1 r1
+  writeb 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+.L105:
+  read 0 r4 r1
+  load 92 r2
+  beq r1 r2 .L119
+  load 92 r2
+  blt r1 r2 .L110
+  load32 -1 r2
+  beq r1 r2 .L115
+  load32 -1 r2
+  sltu r1 r2 r1
+  jump .L116
+.L110:
+  load 39 r2
+  beq r1 r2 .L117
+  load 39 r2
+  bge r1 r2 .L116
+  load 10 r2
+  beq r1 r2 .L114
+  load 10 r2
+  sltu r1 r2 r1
+  jump .L116
+.L114:
+  add r4 12 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.15 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L115:
+  add r4 12 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.16 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L116:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+  jump .L105
+.L117:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 6 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L119:
+  savpc r15
+  add r15 12 r15
+  jump escape
+  read -16 r14 r4
+  jump .L105
+
+/* end function charconst */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "newline in string literal\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "EOF in string literal\000"
+/* end data */
+
+
+.text
+; function stringlit
+stringlit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r4 4 r2
+  load 1 r1
+  writeb 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+.L123:
+  read 0 r4 r1
+  load 92 r2
+  beq r1 r2 .L137
+  load 92 r2
+  blt r1 r2 .L128
+  load32 -1 r2
+  beq r1 r2 .L133
+  load32 -1 r2
+  sltu r1 r2 r1
+  jump .L134
+.L128:
+  load 34 r2
+  beq r1 r2 .L135
+  load 34 r2
+  bge r1 r2 .L134
+  load 10 r2
+  beq r1 r2 .L132
+  load 10 r2
+  sltu r1 r2 r1
+  jump .L134
+.L132:
+  add r4 12 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.18 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L133:
+  add r4 12 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.19 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L134:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+  jump .L123
+.L135:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 7 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L137:
+  savpc r15
+  add r15 12 r15
+  jump escape
+  read -16 r14 r4
+  jump .L123
+
+/* end function stringlit */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "EOF in comment\000"
+/* end data */
+
+
+.text
+; function comment
+comment:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  read 0 r4 r1
+  load 47 r2
+  bne r1 r2 .L147
+.L142:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+  read 0 r4 r1
+  load 0 r2
+  load 10 r3
+  bne r1 r3 .L145
+  or r0 r2 r1
+  jump .L146
+.L145:
+  load32 -1 r2
+  xor r1 r2 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L146:
+  bne r1 r0 .L142
+  jump .L158
+.L147:
+  load 47 r2
+  bge r1 r2 .L150
+  load 42 r2
+  beq r1 r2 .L151
+  load 42 r2
+  sltu r1 r2 r1
+.L150:
+  load 0 r1
+  jump .L159
+.L151:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+.L152:
+  read 0 r4 r2
+  write -12 r14 r2
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -12 r14 r2
+  read -16 r14 r4
+  read 0 r4 r1
+  load32 -1 r3
+  bne r1 r3 .L154
+  add r4 12 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.21 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -12 r14 r2
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L154:
+  load 1 r1
+  load 42 r3
+  bne r2 r3 .L156
+  read 0 r4 r1
+  xor r1 47 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L156:
+  bne r1 r0 .L152
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r4
+.L158:
+  add r4 5 r2
+  load 1 r1
+  writeb 0 r2 r1
+  load 1 r1
+.L159:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function comment */
+
+
+.text
+; function scankind
+scankind:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -24 r14 r5
+  write -32 r14 r4
+.L162:
+  add r4 12 r1
+  read 0 r1 r2
+  write 0 r5 r2
+  add r1 4 r1
+  add r5 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  read 0 r4 r1
+  load 117 r2
+  bge r1 r2 .L222
+  load 9 r2
+  sub r1 r2 r2
+  load 86 r3
+  bge r2 r3 .L221
+  shiftl r2 2 r3
+  addr2reg .Ljt165 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L166:
+  add r4 5 r2
+  load 1 r1
+  writeb 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -24 r14 r5
+  read -32 r14 r4
+  jump .L162
+.L167:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 2 r1
+  jump .L253
+.L168:
+  or r0 r1 r4
+  jump .L242
+.L169:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r4
+  read 0 r4 r1
+  load 61 r2
+  bne r1 r2 .L171
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 89 r1
+  jump .L253
+.L171:
+  load 79 r1
+  jump .L253
+.L172:
+  savpc r15
+  add r15 12 r15
+  jump stringlit
+  jump .L253
+.L173:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r4
+  read 0 r4 r1
+  load 35 r2
+  bne r1 r2 .L175
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 112 r1
+  jump .L253
+.L175:
+  load 111 r1
+  jump .L253
+.L176:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r4
+  read 0 r4 r1
+  load 61 r2
+  bne r1 r2 .L178
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 102 r1
+  jump .L253
+.L178:
+  load 81 r1
+  jump .L253
+.L179:
+  load 92 r7
+  load 107 r6
+  load 74 r5
+  savpc r15
+  add r15 12 r15
+  jump op3
+  jump .L253
+.L180:
+  savpc r15
+  add r15 12 r15
+  jump charconst
+  jump .L253
+.L181:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 66 r1
+  jump .L253
+.L182:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 67 r1
+  jump .L253
+.L183:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r4
+  read 0 r4 r1
+  load 61 r2
+  bne r1 r2 .L185
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 100 r1
+  jump .L253
+.L185:
+  load 75 r1
+  jump .L253
+.L186:
+  load 72 r7
+  load 103 r6
+  load 76 r5
+  savpc r15
+  add r15 12 r15
+  jump op3
+  jump .L253
+.L187:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 110 r1
+  jump .L253
+.L188:
+  load 73 r7
+  load 104 r6
+  load 77 r5
+  savpc r15
+  add r15 12 r15
+  jump op3
+  read -32 r14 r4
+  load 1 r2
+  load 77 r3
+  bne r1 r3 .L190
+  read 0 r4 r2
+  xor r2 62 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L190:
+  bne r2 r0 .L253
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 71 r1
+  jump .L253
+.L192:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r4
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump isdigit
+  read -32 r14 r4
+  bne r1 r0 .L199
+  read 0 r4 r1
+  load 46 r2
+  bne r1 r2 .L198
+  add r4 12 r1
+  read 0 r1 r5
+  write -20 r14 r5
+  add r1 4 r1
+  read 0 r1 r3
+  write -16 r14 r3
+  add r1 4 r1
+  read 0 r1 r1
+  write -12 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r4
+  read 0 r4 r1
+  load 46 r2
+  bne r1 r2 .L196
+  or r0 r4 r1
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 98 r1
+  jump .L253
+.L196:
+  or r0 r1 r12
+  or r0 r4 r1
+  or r0 r12 r4
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump ungetc
+  read -12 r14 r1
+  read -16 r14 r3
+  read -20 r14 r5
+  read -32 r14 r4
+  add r4 12 r2
+  write 0 r2 r5
+  add r2 4 r2
+  write 0 r2 r3
+  add r2 4 r2
+  write 0 r2 r1
+  load 46 r1
+  write 0 r4 r1
+  load 70 r1
+  jump .L253
+.L198:
+  load 70 r1
+  jump .L253
+.L199:
+  add r4 24 r4
+  load 46 r5
+  savpc r15
+  add r15 12 r15
+  jump bufadd
+  read -32 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump number
+  jump .L253
+.L200:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -24 r14 r5
+  read -32 r14 r4
+  read 0 r4 r1
+  load 61 r2
+  bne r1 r2 .L202
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -24 r14 r5
+  read -32 r14 r4
+  load 101 r1
+  jump .L203
+.L202:
+  load 80 r1
+.L203:
+  write -28 r14 r1
+  load 0 r2
+  load 80 r3
+  bne r1 r3 .L205
+  savpc r15
+  add r15 12 r15
+  jump comment
+  or r0 r1 r2
+  read -28 r14 r1
+  read -24 r14 r5
+  read -32 r14 r4
+  and r2 0xFF r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L205:
+  bne r2 r0 .L162
+  jump .L253
+.L206:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r4
+  read 0 r4 r1
+  load 58 r2
+  bne r1 r2 .L208
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 96 r1
+  jump .L253
+.L208:
+  load 95 r1
+  jump .L253
+.L209:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 97 r1
+  jump .L253
+.L210:
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 105 r1
+  write 0 r2 r1
+  load 82 r7
+  load 86 r6
+  load 84 r5
+  savpc r15
+  add r15 12 r15
+  jump op4
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L253
+.L211:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r4
+  read 0 r4 r1
+  load 61 r2
+  bne r1 r2 .L213
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 88 r1
+  jump .L253
+.L213:
+  load 99 r1
+  jump .L253
+.L214:
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 106 r1
+  write 0 r2 r1
+  load 83 r7
+  load 87 r6
+  load 85 r5
+  savpc r15
+  add r15 12 r15
+  jump op4
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L253
+.L215:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 94 r1
+  jump .L253
+.L216:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 64 r1
+  jump .L253
+.L217:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 65 r1
+  jump .L253
+.L218:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r4
+  read 0 r4 r1
+  load 61 r2
+  bne r1 r2 .L220
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 108 r1
+  jump .L253
+.L220:
+  load 90 r1
+  jump .L253
+.L221:
+  or r0 r1 r4
+  jump .L242
+.L222:
+  load 117 r2
+  sub r1 r2 r2
+  load 10 r3
+  blt r2 r3 .L228
+  load32 -1 r2
+  beq r1 r2 .L227
+  load32 -1 r2
+  blt r1 r2 .L226
+  or r0 r1 r4
+  jump .L242
+.L226:
+  or r0 r1 r4
+  jump .L242
+.L227:
+  load 1 r1
+  jump .L253
+.L228:
+  shiftl r2 2 r3
+  addr2reg .Ljt228 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L229:
+  add r4 4 r2
+  load 1 r1
+  writeb 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r4
+  add r4 24 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readbu 0 r1 r2
+  load 0 r1
+  load 117 r3
+  bne r2 r3 .L231
+  read 0 r4 r1
+  xor r1 56 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L231:
+  beq r1 r0 .L233
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -32 r14 r4
+.L233:
+  read 0 r4 r1
+  load 39 r2
+  beq r1 r2 .L240
+  load 39 r2
+  bge r1 r2 .L238
+  load 34 r2
+  beq r1 r2 .L239
+  load 34 r2
+  sltu r1 r2 r1
+.L238:
+  savpc r15
+  add r15 12 r15
+  jump ident
+  jump .L253
+.L239:
+  savpc r15
+  add r15 12 r15
+  jump stringlit
+  jump .L253
+.L240:
+  savpc r15
+  add r15 12 r15
+  jump charconst
+  jump .L253
+.L241:
+  or r0 r1 r4
+.L242:
+  savpc r15
+  add r15 12 r15
+  jump isdigit
+  read -32 r14 r4
+  bne r1 r0 .L248
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump isalpha
+  or r0 r1 r2
+  read -32 r14 r4
+  load 1 r1
+  bne r2 r0 .L245
+  read 0 r4 r1
+  xor r1 95 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L245:
+  bne r1 r0 .L247
+  add r4 4 r2
+  load 1 r1
+  writeb 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 3 r1
+  jump .L253
+.L247:
+  savpc r15
+  add r15 12 r15
+  jump ident
+  jump .L253
+.L248:
+  savpc r15
+  add r15 12 r15
+  jump number
+  jump .L253
+.L249:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 68 r1
+  jump .L253
+.L250:
+  load 93 r7
+  load 109 r6
+  load 91 r5
+  savpc r15
+  add r15 12 r15
+  jump op3
+  jump .L253
+.L251:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 69 r1
+  jump .L253
+.L252:
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  load 78 r1
+.L253:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt165:
+  .int .L166
+  .int .L167
+  .int .L166
+  .int .L166
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L166
+  .int .L169
+  .int .L172
+  .int .L173
+  .int .L168
+  .int .L176
+  .int .L179
+  .int .L180
+  .int .L181
+  .int .L182
+  .int .L183
+  .int .L186
+  .int .L187
+  .int .L188
+  .int .L192
+  .int .L200
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L206
+  .int .L209
+  .int .L210
+  .int .L211
+  .int .L214
+  .int .L215
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L229
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L229
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L168
+  .int .L216
+  .int .L168
+  .int .L217
+  .int .L218
+
+.rdata
+.balign 4
+.Ljt228:
+  .int .L229
+  .int .L241
+  .int .L241
+  .int .L241
+  .int .L241
+  .int .L241
+  .int .L249
+  .int .L250
+  .int .L251
+  .int .L252
+
+/* end function scankind */
+
+
+.text
+; function scanfrom
+.global scanfrom
+scanfrom:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -8 r14 r4
+  load 40 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -12 r14 r5
+  read -8 r14 r4
+  write -16 r14 r1
+  add r1 8 r2
+  write 0 r2 r5
+  add r1 24 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 24 r2
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 24 r2
+  add r2 8 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 4 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r1 12 r2
+  write 0 r2 r4
+  add r1 12 r2
+  add r2 4 r3
+  load 1 r2
+  write 0 r3 r2
+  add r1 12 r2
+  add r2 8 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg scanner r12
+  read 0 r12 r2
+  add r1 36 r3
+  write 0 r3 r2
+  beq r5 r0 .L258
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+  read -16 r14 r1
+.L258:
+  addr2reg scanner r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function scanfrom */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "r\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "open %s:\000"
+/* end data */
+
+
+.text
+; function scanopen
+.global scanopen
+scanopen:
+  addr2reg scanner r12
+  read 0 r12 r1
+  add r1 8 r2
+  read 0 r2 r2
+  bne r2 r0 .L267
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  add r1 12 r1
+  read 0 r1 r4
+  addr2reg .Lstring.25 r5
+  savpc r15
+  add r15 12 r15
+  jump fopen
+  addr2reg scanner r12
+  read 0 r12 r2
+  add r2 8 r2
+  write 0 r2 r1
+  addr2reg scanner r12
+  read 0 r12 r1
+  add r1 8 r2
+  read 0 r2 r2
+  bne r2 r0 .L265
+  add r1 12 r1
+  read 0 r1 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.26 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+.L265:
+  addr2reg scanner r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump nextchar
+.L266:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L267:
+  jumpr 0 r15
+
+/* end function scanopen */
+
+
+.text
+; function scansetloc
+.global scansetloc
+scansetloc:
+  addr2reg scanner r12
+  read 0 r12 r1
+  add r1 12 r2
+  read 0 r4 r1
+  write 0 r2 r1
+  add r4 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  jumpr 0 r15
+
+/* end function scansetloc */
+
+
+.text
+; function scanclose
+scanclose:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg scanner r12
+  read 0 r12 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fclose
+  addr2reg scanner r12
+  read 0 r12 r1
+  add r1 24 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  addr2reg scanner r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function scanclose */
+
+
+.text
+; function scan
+.global scan
+scan:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  addr2reg scanner r12
+  read 0 r12 r1
+  add r1 5 r2
+  load 0 r1
+  writeb 0 r2 r1
+.L278:
+  or r0 r4 r1
+  addr2reg scanner r12
+  read 0 r12 r4
+  add r1 8 r5
+  savpc r15
+  add r15 12 r15
+  jump scankind
+  or r0 r1 r2
+  read -16 r14 r4
+  write 0 r4 r2
+  load 1 r1
+  load 1 r3
+  bne r2 r3 .L280
+  addr2reg scanner r12
+  read 0 r12 r1
+  add r1 36 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L280:
+  bne r1 r0 .L282
+  savpc r15
+  add r15 12 r15
+  jump scanclose
+  addr2reg scanner r12
+  read 0 r12 r1
+  add r1 36 r1
+  read 0 r1 r1
+  addr2reg scanner r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump scanopen
+  read -16 r14 r4
+  jump .L278
+.L282:
+  read -16 r14 r4
+  addr2reg scanner r12
+  read 0 r12 r1
+  add r1 4 r2
+  readbu 0 r2 r2
+  bne r2 r0 .L285
+  add r4 20 r2
+  load 0 r1
+  write 0 r2 r1
+  jump .L286
+.L285:
+  add r1 24 r4
+  savpc r15
+  add r15 12 r15
+  jump bufget
+  read -16 r14 r4
+  add r4 20 r2
+  write 0 r2 r1
+  addr2reg scanner r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  writeb 0 r2 r1
+.L286:
+  addr2reg scanner r12
+  read 0 r12 r1
+  add r1 5 r1
+  readbu 0 r1 r1
+  add r4 5 r2
+  writeb 0 r2 r1
+  add r4 4 r2
+  load 0 r1
+  writeb 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function scan */
+
+.data
+.balign 4
+scanner:
+	.fill 4,1,0
+/* end data */
+
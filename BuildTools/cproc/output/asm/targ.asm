@@ -0,0 +1,261 @@
+.data
+.balign 1
+.Lstring.1:
+	.ascii "x86_64-sysv\000"
+/* end data */
+
+.data
+.balign 4
+.L.3:
+	.int 15
+	.fill 4,1,0
+	.int 8
+	.int 24
+	.fill 36,1,0
+/* end data */
+
+.data
+.balign 4
+.L.2:
+	.int 13
+	.fill 4,1,0
+	.int 8
+	.int 24
+	.fill 4,1,0
+	.int .L.3+0
+	.fill 28,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.4:
+	.ascii "aarch64\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "va_list\000"
+/* end data */
+
+.data
+.balign 4
+.L.5:
+	.int 15
+	.fill 4,1,0
+	.int 8
+	.int 32
+	.fill 24,1,0
+	.int .Lstring.6+0
+	.fill 8,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "riscv64\000"
+/* end data */
+
+.data
+.balign 4
+.L.8:
+	.int 12
+	.int 16
+	.int 8
+	.int 8
+	.fill 4,1,0
+	.int typevoid+0
+	.fill 28,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "b32p3\000"
+/* end data */
+
+.data
+.balign 4
+.L.10:
+	.int 12
+	.int 16
+	.int 4
+	.int 4
+	.fill 4,1,0
+	.int typevoid+0
+	.fill 28,1,0
+/* end data */
+
+.data
+.balign 4
+alltargs:
+	.int .Lstring.1+0
+	.int .L.2+0
+	.int typeint+0
+	.int 1
+	.int 8
+	.int 8
+	.int .Lstring.4+0
+	.int .L.5+0
+	.int typeuint+0
+	.fill 4,1,0
+	.int 8
+	.int 8
+	.int .Lstring.7+0
+	.int .L.8+0
+	.int typeint+0
+	.fill 4,1,0
+	.int 8
+	.int 8
+	.int .Lstring.9+0
+	.int .L.10+0
+	.int typeint+0
+	.int 1
+	.int 4
+	.int 4
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "unknown target '%s'\000"
+/* end data */
+
+
+.text
+; function targinit
+.global targinit
+targinit:
+  or r0 r4 r5
+  bne r5 r0 .L4
+  addr2reg .Lstring.9 r1
+  or r0 r1 r5
+.L4:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r5
+  load 0 r1
+  or r0 r5 r4
+.L6:
+  write -16 r14 r1
+  load 0 r2
+  load 4 r3
+  bge r1 r3 .L8
+  addr2reg targ r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L8:
+  beq r2 r0 .L12
+  load 24 r2
+  mults r1 r2 r2
+  addr2reg alltargs r1
+  add r1 r2 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -16 r14 r1
+  read -12 r14 r4
+  bne r2 r0 .L11
+  load 24 r2
+  mults r1 r2 r3
+  addr2reg alltargs r2
+  add r2 r3 r2
+  addr2reg targ r12
+  write 0 r12 r2
+.L11:
+  add r1 1 r1
+  jump .L6
+.L12:
+  or r0 r4 r5
+  addr2reg targ r12
+  read 0 r12 r1
+  bne r1 r0 .L15
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+.L15:
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 16 r1
+  read 0 r1 r1
+  load 4 r2
+  bne r1 r2 .L17
+  load 4 r1
+  addr2reg typelong+12 r12
+  write 0 r12 r1
+  load 4 r1
+  addr2reg typelong+8 r12
+  write 0 r12 r1
+  load 4 r1
+  addr2reg typeulong+12 r12
+  write 0 r12 r1
+  load 4 r1
+  addr2reg typeulong+8 r12
+  write 0 r12 r1
+  load 4 r1
+  addr2reg typellong+12 r12
+  write 0 r12 r1
+  load 4 r1
+  addr2reg typellong+8 r12
+  write 0 r12 r1
+  load 4 r1
+  addr2reg typeullong+12 r12
+  write 0 r12 r1
+  load 4 r1
+  addr2reg typeullong+8 r12
+  write 0 r12 r1
+  load 4 r1
+  addr2reg typenullptr+12 r12
+  write 0 r12 r1
+  load 4 r1
+  addr2reg typenullptr+8 r12
+  write 0 r12 r1
+.L17:
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 12 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  addr2reg typechar+40 r12
+  writeb 0 r12 r1
+  load 0 r1
+  write -20 r14 r1
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -20 r5
+  savpc r15
+  add r15 12 r15
+  jump typeadjust
+  addr2reg typeadjvalist r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function targinit */
+
+.data
+.balign 4
+.globl targ
+targ:
+	.fill 4,1,0
+/* end data */
+
@@ -0,0 +1,1211 @@
+.data
+.balign 4
+.globl typevoid
+typevoid:
+	.int 1
+	.fill 32,1,0
+	.byte 1
+	.fill 15,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typebool
+typebool:
+	.int 2
+	.int 30
+	.int 1
+	.int 1
+	.fill 24,1,0
+	.byte 0
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typechar
+typechar:
+	.int 3
+	.int 31
+	.int 1
+	.int 1
+	.fill 24,1,0
+	.byte 1
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typeschar
+typeschar:
+	.int 3
+	.int 31
+	.int 1
+	.int 1
+	.fill 24,1,0
+	.byte 1
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typeuchar
+typeuchar:
+	.int 3
+	.int 31
+	.int 1
+	.int 1
+	.fill 24,1,0
+	.byte 0
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typeshort
+typeshort:
+	.int 4
+	.int 30
+	.int 2
+	.int 2
+	.fill 24,1,0
+	.byte 1
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typeushort
+typeushort:
+	.int 4
+	.int 30
+	.int 2
+	.int 2
+	.fill 24,1,0
+	.byte 0
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typeint
+typeint:
+	.int 5
+	.int 30
+	.int 4
+	.int 4
+	.fill 24,1,0
+	.byte 1
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typeuint
+typeuint:
+	.int 5
+	.int 30
+	.int 4
+	.int 4
+	.fill 24,1,0
+	.byte 0
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typelong
+typelong:
+	.int 7
+	.int 30
+	.int 8
+	.int 8
+	.fill 24,1,0
+	.byte 1
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typeulong
+typeulong:
+	.int 7
+	.int 30
+	.int 8
+	.int 8
+	.fill 24,1,0
+	.byte 0
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typellong
+typellong:
+	.int 8
+	.int 30
+	.int 8
+	.int 8
+	.fill 24,1,0
+	.byte 1
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typeullong
+typeullong:
+	.int 8
+	.int 30
+	.int 8
+	.int 8
+	.fill 24,1,0
+	.byte 0
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typefloat
+typefloat:
+	.int 9
+	.int 60
+	.int 4
+	.int 4
+	.fill 36,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typedouble
+typedouble:
+	.int 10
+	.int 60
+	.int 8
+	.int 8
+	.fill 36,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typeldouble
+typeldouble:
+	.int 11
+	.int 60
+	.int 16
+	.int 16
+	.fill 36,1,0
+/* end data */
+
+.data
+.balign 4
+.globl typenullptr
+typenullptr:
+	.int 17
+	.int 16
+	.int 8
+	.int 8
+	.fill 36,1,0
+/* end data */
+
+
+.text
+; function mktype
+.global mktype
+mktype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  load 52 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -12 r14 r5
+  read -16 r14 r4
+  write 0 r1 r4
+  add r1 4 r2
+  write 0 r2 r5
+  add r1 16 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 36 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r1 37 r3
+  load 0 r2
+  writeb 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mktype */
+
+
+.text
+; function mkpointertype
+.global mkpointertype
+mkpointertype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  load 16 r5
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump mktype
+  read -12 r14 r5
+  read -16 r14 r4
+  add r1 20 r2
+  write 0 r2 r4
+  add r1 32 r2
+  write 0 r2 r5
+  addr2reg targ r12
+  read 0 r12 r2
+  add r2 16 r2
+  read 0 r2 r2
+  add r1 12 r3
+  write 0 r3 r2
+  addr2reg targ r12
+  read 0 r12 r2
+  add r2 16 r2
+  read 0 r2 r2
+  add r1 8 r3
+  write 0 r3 r2
+  beq r4 r0 .L7
+  add r1 4 r3
+  read 0 r3 r2
+  add r4 4 r4
+  read 0 r4 r4
+  and r4 64 r4
+  or r2 r4 r2
+  write 0 r3 r2
+.L7:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkpointertype */
+
+
+.text
+; function mkarraytype
+.global mkarraytype
+mkarraytype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r6
+  write -8 r14 r5
+  write -16 r14 r4
+  load 0 r5
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump mktype
+  read -12 r14 r6
+  read -8 r14 r5
+  read -16 r14 r4
+  add r1 20 r2
+  write 0 r2 r4
+  add r1 32 r2
+  write 0 r2 r5
+  add r1 40 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 40 r2
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+  xor r6 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  add r1 36 r3
+  writeb 0 r3 r2
+  beq r4 r0 .L12
+  add r4 8 r2
+  read 0 r2 r2
+  add r1 8 r3
+  write 0 r3 r2
+  add r4 12 r2
+  read 0 r2 r2
+  mults r2 r6 r2
+  add r1 12 r3
+  write 0 r3 r2
+.L12:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkarraytype */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "t->prop & PROPINT\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/cproc/type.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "internal error; unhandled integer type\000"
+/* end data */
+
+
+.text
+; function typerank
+typerank:
+  read 0 r4 r1
+  load 6 r2
+  bne r1 r2 .L17
+  add r4 20 r1
+  read 0 r1 r4
+.L17:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r4 4 r1
+  read 0 r1 r1
+  and r1 2 r1
+  bne r1 r0 .L19
+  load 100 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r4
+.L19:
+  read 0 r4 r1
+  load 2 r2
+  sub r1 r2 r1
+  load 7 r2
+  bge r1 r2 .L26
+  shiftl r1 2 r2
+  addr2reg .Ljt21 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L22:
+  load 1 r1
+  jump .L29
+.L23:
+  load 2 r1
+  jump .L29
+.L24:
+  load 3 r1
+  jump .L29
+.L25:
+  load 4 r1
+  jump .L29
+.L26:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.7 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L29
+.L27:
+  load 5 r1
+  jump .L29
+.L28:
+  load 6 r1
+.L29:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt21:
+  .int .L22
+  .int .L23
+  .int .L24
+  .int .L25
+  .int .L26
+  .int .L27
+  .int .L28
+
+/* end function typerank */
+
+
+.text
+; function typecompatible
+.global typecompatible
+typecompatible:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  beq r4 r5 .L84
+  read 0 r4 r3
+  read 0 r5 r2
+  bne r3 r2 .L76
+  load 13 r1
+  beq r3 r1 .L56
+  load 13 r1
+  blt r3 r1 .L53
+  load 14 r1
+  beq r3 r1 .L38
+  load 14 r1
+  sltu r3 r1 r1
+  jump .L55
+.L38:
+  add r4 40 r1
+  readbu 0 r1 r1
+  add r5 40 r2
+  readbu 0 r2 r2
+  bne r1 r2 .L52
+  add r4 40 r1
+  add r1 4 r1
+  read 0 r1 r3
+  add r5 40 r1
+  add r1 4 r1
+  read 0 r1 r2
+  or r0 r3 r1
+.L41:
+  write -4 r14 r1
+  write -8 r14 r2
+  load 0 r3
+  beq r1 r0 .L43
+  xor r2 0 r3
+  sltu r0 r3 r3
+.L43:
+  beq r3 r0 .L47
+  add r1 12 r1
+  read 0 r1 r4
+  add r2 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  or r0 r1 r3
+  read -4 r14 r1
+  read -8 r14 r2
+  and r3 0xFF r3
+  beq r3 r0 .L46
+  add r1 32 r1
+  read 0 r1 r1
+  add r2 32 r2
+  read 0 r2 r2
+  jump .L41
+.L46:
+  load 0 r1
+  jump .L85
+.L47:
+  or r0 r1 r3
+  read -12 r14 r5
+  read -16 r14 r4
+  load 1 r1
+  bne r3 r0 .L50
+  xor r2 0 r1
+  sltu r0 r1 r1
+.L50:
+  beq r1 r0 .L73
+  load 0 r1
+  jump .L85
+.L52:
+  load 0 r1
+  jump .L85
+.L53:
+  load 12 r1
+  beq r3 r1 .L73
+  load 12 r1
+  sltu r3 r1 r1
+.L55:
+  load 0 r1
+  jump .L85
+.L56:
+  add r4 36 r1
+  readbu 0 r1 r2
+  load 1 r1
+  bne r2 r0 .L58
+  add r5 36 r1
+  readbu 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L58:
+  bne r1 r0 .L73
+  add r4 40 r1
+  read 0 r1 r1
+  add r5 40 r2
+  read 0 r2 r2
+  load 0 r3
+  bne r1 r0 .L61
+  or r0 r3 r6
+  jump .L62
+.L61:
+  xor r2 0 r3
+  sltu r0 r3 r6
+.L62:
+  load 0 r3
+  bne r6 r0 .L64
+  or r0 r3 r6
+  jump .L65
+.L64:
+  read 0 r1 r3
+  xor r3 1 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r6
+.L65:
+  load 0 r3
+  bne r6 r0 .L67
+  or r0 r3 r6
+  jump .L68
+.L67:
+  read 0 r2 r3
+  xor r3 1 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r6
+.L68:
+  load 0 r3
+  bne r6 r0 .L70
+  or r0 r3 r1
+  jump .L71
+.L70:
+  add r1 32 r1
+  read 0 r1 r1
+  add r2 32 r2
+  read 0 r2 r2
+  xor r1 r2 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L71:
+  beq r1 r0 .L73
+  load 0 r1
+  jump .L85
+.L73:
+  add r4 32 r1
+  read 0 r1 r2
+  add r5 32 r1
+  read 0 r1 r3
+  load 0 r1
+  bne r2 r3 .L75
+  add r4 20 r1
+  read 0 r1 r4
+  add r5 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L75:
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L85
+.L76:
+  load 0 r1
+  load 6 r6
+  beq r3 r6 .L78
+  or r0 r1 r3
+  jump .L79
+.L78:
+  add r4 20 r1
+  read 0 r1 r1
+  xor r5 r1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r3
+.L79:
+  load 1 r1
+  bne r3 r0 .L83
+  load 0 r1
+  load 6 r3
+  bne r2 r3 .L82
+  add r5 20 r1
+  read 0 r1 r1
+  xor r4 r1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L82:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L83:
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L85
+.L84:
+  load 1 r1
+.L85:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function typecompatible */
+
+
+.text
+; function typesame
+.global typesame
+typesame:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function typesame */
+
+
+.text
+; function typecomposite
+.global typecomposite
+typecomposite:
+  or r0 r4 r1
+  jumpr 0 r15
+
+/* end function typecomposite */
+
+
+.text
+; function typepromote
+.global typepromote
+typepromote:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  addr2reg typefloat r1
+  beq r4 r1 .L107
+  add r4 4 r1
+  read 0 r1 r1
+  and r1 2 r2
+  load 0 r1
+  beq r2 r0 .L100
+  savpc r15
+  add r15 12 r15
+  jump typerank
+  write -8 r14 r1
+  addr2reg typeint r4
+  savpc r15
+  add r15 12 r15
+  jump typerank
+  or r0 r1 r3
+  read -8 r14 r2
+  read -12 r14 r5
+  read -16 r14 r4
+  load 1 r1
+  bles r2 r3 .L99
+  addr2reg typeint+12 r12
+  read 0 r12 r1
+  shiftl r1 3 r1
+  sltu r1 r5 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L99:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L100:
+  bne r1 r0 .L102
+  or r0 r4 r1
+  jump .L108
+.L102:
+  load32 -1 r1
+  bne r5 r1 .L104
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r1 3 r5
+.L104:
+  add r4 40 r1
+  readbu 0 r1 r1
+  sub r5 r1 r1
+  addr2reg typeint+12 r12
+  read 0 r12 r2
+  shiftl r2 3 r2
+  blt r1 r2 .L106
+  addr2reg typeuint r1
+  jump .L108
+.L106:
+  addr2reg typeint r1
+  jump .L108
+.L107:
+  addr2reg typedouble r1
+.L108:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function typepromote */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "t1->prop & PROPREAL && t2->prop & PROPREAL\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "internal error; could not find common real type\000"
+/* end data */
+
+
+.text
+; function typecommonreal
+.global typecommonreal
+typecommonreal:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  write -20 r14 r7
+  or r0 r6 r1
+  write -24 r14 r1
+  write -12 r14 r5
+  write -16 r14 r4
+  add r4 4 r2
+  read 0 r2 r2
+  and r2 4 r3
+  load 0 r2
+  beq r3 r0 .L113
+  add r1 4 r2
+  read 0 r2 r2
+  and r2 4 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L113:
+  bne r2 r0 .L115
+  load 190 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.13 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -24 r14 r4
+  read -12 r14 r5
+  or r0 r4 r1
+  read -16 r14 r4
+.L115:
+  load 1 r2
+  addr2reg typeldouble r3
+  beq r4 r3 .L117
+  addr2reg typeldouble r2
+  xor r1 r2 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L117:
+  bne r2 r0 .L142
+  load 1 r2
+  addr2reg typedouble r3
+  beq r4 r3 .L120
+  addr2reg typedouble r2
+  xor r1 r2 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L120:
+  bne r2 r0 .L141
+  load 1 r2
+  addr2reg typefloat r3
+  beq r4 r3 .L123
+  addr2reg typefloat r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L124
+.L123:
+  or r0 r2 r1
+.L124:
+  bne r1 r0 .L140
+  savpc r15
+  add r15 12 r15
+  jump typepromote
+  write -48 r14 r1
+  read -20 r14 r5
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump typepromote
+  or r0 r1 r2
+  read -48 r14 r1
+  write -44 r14 r2
+  beq r1 r2 .L143
+  add r1 40 r3
+  readbu 0 r3 r3
+  add r2 40 r4
+  readbu 0 r4 r4
+  beq r3 r4 .L138
+  bne r3 r0 .L129
+  write -36 r14 r2
+  jump .L130
+.L129:
+  write -36 r14 r1
+  or r0 r2 r1
+.L130:
+  write -32 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typerank
+  write -28 r14 r1
+  read -36 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typerank
+  or r0 r1 r4
+  read -32 r14 r1
+  or r0 r1 r2
+  read -36 r14 r1
+  read -28 r14 r3
+  bges r3 r4 .L137
+  add r2 12 r2
+  read 0 r2 r2
+  add r1 12 r3
+  read 0 r3 r3
+  blt r2 r3 .L143
+  addr2reg typelong r2
+  beq r1 r2 .L136
+  addr2reg typellong r2
+  beq r1 r2 .L135
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.14 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L143
+.L135:
+  addr2reg typeullong r1
+  jump .L143
+.L136:
+  addr2reg typeulong r1
+  jump .L143
+.L137:
+  or r0 r2 r1
+  jump .L143
+.L138:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typerank
+  write -40 r14 r1
+  read -44 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typerank
+  or r0 r1 r4
+  read -40 r14 r3
+  read -44 r14 r1
+  or r0 r1 r2
+  read -48 r14 r1
+  bgts r3 r4 .L143
+  or r0 r2 r1
+  jump .L143
+.L140:
+  addr2reg typefloat r1
+  jump .L143
+.L141:
+  addr2reg typedouble r1
+  jump .L143
+.L142:
+  addr2reg typeldouble r1
+.L143:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function typecommonreal */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "*tq == QUALNONE\000"
+/* end data */
+
+
+.text
+; function typeadjust
+.global typeadjust
+typeadjust:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r1
+  write -12 r14 r5
+  write -16 r14 r1
+  read 0 r1 r2
+  load 14 r3
+  beq r2 r3 .L152
+  load 14 r3
+  bge r2 r3 .L155
+  load 13 r3
+  beq r2 r3 .L151
+  load 13 r3
+  sltu r2 r3 r2
+  jump .L155
+.L151:
+  add r1 40 r2
+  add r2 4 r2
+  read 0 r2 r2
+  write -8 r14 r2
+  add r1 20 r2
+  read 0 r2 r4
+  or r0 r1 r2
+  read 0 r5 r1
+  add r2 32 r2
+  read 0 r2 r2
+  or r1 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump mkpointertype
+  read -8 r14 r2
+  read -12 r14 r5
+  write 0 r5 r2
+  jump .L155
+.L152:
+  read 0 r5 r2
+  beq r2 r0 .L154
+  load 233 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.16 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+.L154:
+  load 0 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkpointertype
+.L155:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function typeadjust */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "t->kind == TYPESTRUCT || t->kind == TYPEUNION\000"
+/* end data */
+
+
+.text
+; function typemember
+.global typemember
+typemember:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r6
+  write -12 r14 r5
+  write -4 r14 r4
+  read 0 r4 r1
+  load 1 r2
+  load 15 r3
+  beq r1 r3 .L160
+  xor r1 16 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L161
+.L160:
+  or r0 r2 r1
+.L161:
+  bne r1 r0 .L163
+  load 246 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.18 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -8 r14 r6
+  read -12 r14 r5
+  read -4 r14 r4
+.L163:
+  add r4 40 r1
+  add r1 4 r1
+  read 0 r1 r1
+.L164:
+  write -16 r14 r1
+  beq r1 r0 .L172
+  read 0 r1 r4
+  bne r4 r0 .L169
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typemember
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r6
+  read -12 r14 r5
+  beq r2 r0 .L170
+  or r0 r1 r3
+  or r0 r2 r1
+  read 0 r6 r2
+  add r3 12 r3
+  read 0 r3 r3
+  add r2 r3 r2
+  write 0 r6 r2
+  jump .L173
+.L169:
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r6
+  read -12 r14 r5
+  beq r2 r0 .L171
+.L170:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L164
+.L171:
+  read 0 r6 r2
+  add r1 12 r3
+  read 0 r3 r3
+  add r2 r3 r2
+  write 0 r6 r2
+  jump .L173
+.L172:
+  load 0 r1
+.L173:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function typemember */
+
+
+.text
+; function typehasint
+.global typehasint
+typehasint:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r6
+  write -12 r14 r5
+  write -16 r14 r4
+  add r4 4 r1
+  read 0 r1 r1
+  and r1 2 r1
+  bne r1 r0 .L178
+  load 267 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -8 r14 r6
+  read -12 r14 r5
+  read -16 r14 r4
+.L178:
+  and r6 0xFF r2
+  load 0 r1
+  beq r2 r0 .L180
+  load32 -2147483648 r1
+  sltu r5 r1 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L180:
+  bne r1 r0 .L182
+  add r4 12 r1
+  read 0 r1 r2
+  load 4 r1
+  sub r1 r2 r1
+  shiftl r1 3 r1
+  add r4 40 r2
+  readbu 0 r2 r2
+  add r1 r2 r2
+  load32 -1 r1
+  shiftr r1 r2 r1
+  sltu r1 r5 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L185
+.L182:
+  add r4 40 r1
+  readbu 0 r1 r2
+  load 0 r1
+  beq r2 r0 .L184
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r1 3 r1
+  load 1 r2
+  sub r1 r2 r2
+  load32 -1 r1
+  shiftl r1 r2 r1
+  sltu r5 r1 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L184:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L185:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function typehasint */
+
+.data
+.balign 4
+.globl typeadjvalist
+typeadjvalist:
+	.fill 4,1,0
+/* end data */
+
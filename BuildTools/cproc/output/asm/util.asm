@@ -0,0 +1,522 @@
+.data
+.balign 1
+.Lstring.2:
+	.ascii "%s: \000"
+/* end data */
+
+
+.text
+; function vwarn
+vwarn:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  addr2reg argv0 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.2 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r6
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r4 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump vfprintf
+  read -16 r14 r4
+  add r4 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  beq r2 r0 .L3
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  read -16 r14 r4
+  load 1 r2
+  sub r1 r2 r1
+  add r4 r1 r1
+  readb 0 r1 r1
+  xor r1 58 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L3:
+  bne r1 r0 .L5
+  addr2reg __stderr_file r5
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  jump .L6
+.L5:
+  addr2reg __stderr_file r5
+  load 32 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump perror
+.L6:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function vwarn */
+
+
+.text
+; function warn
+.global warn
+warn:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  write 8 r14 r4
+  write 12 r14 r5
+  write 16 r14 r6
+  write 20 r14 r7
+  sub r13 12 r13
+  add r14 12 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump vwarn
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function warn */
+
+
+.text
+; function fatal
+.global fatal
+fatal:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  write 8 r14 r4
+  write 12 r14 r5
+  write 16 r14 r6
+  write 20 r14 r7
+  sub r13 12 r13
+  add r14 12 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump vwarn
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function fatal */
+
+
+.text
+; function reallocarray
+.global reallocarray
+reallocarray:
+  load 0 r1
+  ble r5 r0 .L19
+  load32 -1 r1
+  divu r1 r5 r1
+  sltu r1 r6 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L19:
+  bne r1 r0 .L21
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  mults r5 r6 r5
+  savpc r15
+  add r15 12 r15
+  jump realloc
+  jump .L22
+.L21:
+  load 12 r1
+  addr2reg errno r12
+  write 0 r12 r1
+  load 0 r1
+  jumpr 0 r15
+.L22:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function reallocarray */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "reallocarray:\000"
+/* end data */
+
+
+.text
+; function xreallocarray
+.global xreallocarray
+xreallocarray:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r6
+  write -12 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump reallocarray
+  read -8 r14 r6
+  read -12 r14 r5
+  write -16 r14 r1
+  load 0 r2
+  beq r1 r0 .L27
+  or r0 r2 r3
+  jump .L28
+.L27:
+  xor r5 0 r2
+  sltu r0 r2 r3
+.L28:
+  load 0 r2
+  beq r3 r0 .L30
+  xor r6 0 r2
+  sltu r0 r2 r2
+.L30:
+  beq r2 r0 .L32
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.7 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L32:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function xreallocarray */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "malloc:\000"
+/* end data */
+
+
+.text
+; function xmalloc
+.global xmalloc
+xmalloc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  read -12 r14 r4
+  write -16 r14 r1
+  load 0 r2
+  bne r1 r0 .L37
+  xor r4 0 r2
+  sltu r0 r2 r2
+.L37:
+  beq r2 r0 .L39
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L39:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function xmalloc */
+
+
+.text
+; function progname
+.global progname
+progname:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r5 r2
+  or r0 r4 r1
+  write -16 r14 r1
+  beq r1 r0 .L46
+  load 47 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strrchr
+  or r0 r1 r2
+  read -16 r14 r1
+  beq r2 r0 .L47
+  or r0 r2 r1
+  add r1 1 r1
+  jump .L47
+.L46:
+  or r0 r2 r1
+.L47:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function progname */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "realloc\000"
+/* end data */
+
+
+.text
+; function arrayadd
+.global arrayadd
+arrayadd:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  add r4 8 r1
+  read 0 r1 r1
+  add r4 4 r2
+  read 0 r2 r2
+  sub r1 r2 r3
+  bge r3 r5 .L59
+.L51:
+  bne r1 r0 .L53
+  load 256 r1
+  jump .L54
+.L53:
+  shiftl r1 1 r1
+.L54:
+  add r4 8 r3
+  write 0 r3 r1
+  sub r1 r2 r3
+  blt r3 r5 .L51
+  or r0 r1 r5
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump realloc
+  read -12 r14 r5
+  read -16 r14 r4
+  write 0 r4 r1
+  bne r1 r0 .L59
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -12 r14 r5
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L59:
+  read 0 r4 r1
+  add r4 4 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  add r4 4 r3
+  add r2 r5 r2
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function arrayadd */
+
+
+.text
+; function arrayaddptr
+.global arrayaddptr
+arrayaddptr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r5
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump arrayadd
+  read -16 r14 r5
+  write 0 r1 r5
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function arrayaddptr */
+
+
+.text
+; function arrayaddbuf
+.global arrayaddbuf
+arrayaddbuf:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r6
+  or r0 r6 r5
+  savpc r15
+  add r15 12 r15
+  jump arrayadd
+  or r0 r1 r4
+  read -16 r14 r6
+  read -12 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function arrayaddbuf */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "n <= a->len\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "BuildTools/cproc/util.c\000"
+/* end data */
+
+
+.text
+; function arraylast
+.global arraylast
+arraylast:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  add r4 4 r1
+  read 0 r1 r1
+  beq r1 r0 .L75
+  ble r5 r1 .L74
+  load 125 r6
+  addr2reg .Lstring.17 r5
+  addr2reg .Lstring.16 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r5
+  read -16 r14 r4
+.L74:
+  read 0 r4 r1
+  add r4 4 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  sub r1 r5 r1
+  jump .L76
+.L75:
+  load 0 r1
+.L76:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function arraylast */
+
+
+.text
+; function listinsert
+.global listinsert
+listinsert:
+  add r4 4 r1
+  read 0 r1 r1
+  add r5 4 r2
+  write 0 r2 r1
+  write 0 r5 r4
+  add r4 4 r1
+  read 0 r1 r1
+  write 0 r1 r5
+  add r4 4 r1
+  write 0 r1 r5
+  jumpr 0 r15
+
+/* end function listinsert */
+
+
+.text
+; function listremove
+.global listremove
+listremove:
+  read 0 r4 r1
+  add r4 4 r2
+  read 0 r2 r2
+  write 0 r2 r1
+  add r4 4 r1
+  read 0 r1 r1
+  read 0 r4 r2
+  add r2 4 r2
+  write 0 r2 r1
+  load 0 r1
+  write 0 r4 r1
+  add r4 4 r2
+  load 0 r1
+  write 0 r2 r1
+  jumpr 0 r15
+
+/* end function listremove */
+
+.data
+.balign 4
+.globl argv0
+argv0:
+	.fill 4,1,0
+/* end data */
+
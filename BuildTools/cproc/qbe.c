@@ -67,9 +67,13 @@ struct jump {
 		JUMP_JNZ,
 		JUMP_RET,
 		JUMP_HLT,
+		JUMP_JTAB,
 	} kind;
 	struct value *arg;
 	struct block *blk[2];
+	struct block **tab;  /* JUMP_JTAB targets, one per index */
+	size_t ntab;
+	int hint;  /* JUMP_JNZ: 1 if blk[0] is likely, 2 if blk[1] is */
 };
 
 struct block {
@@ -99,6 +103,9 @@ struct func {
 	struct block *start, *end;
 	struct map gotos;
 	unsigned lastid;
+	/* last value of __builtin_expect and its hint */
+	struct value *expectv;
+	int expect;
 };
 
 #define ptrclass (targ->ptrsize == 4 ? 'w' : 'l')
@@ -128,6 +135,7 @@ mkblock(char *name)
 	b->label.id = ++id;
 	b->insts = (struct array){0};
 	b->jump.kind = JUMP_NONE;
+	b->jump.hint = 0;
 	b->phi.res.kind = VALUE_NONE;
 	b->next = NULL;
 
@@ -530,6 +538,8 @@ mkfunc(struct decl *decl, char *name, struct type *t, struct scope *s)
 	f->type = t;
 	f->start = f->end = mkblock("start");
 	f->lastid = 0;
+	f->expectv = NULL;
+	f->expect = 0;
 	mapinit(&f->gotos, 8);
 	emittype(t->base);
 
@@ -571,6 +581,8 @@ delfunc(struct func *f)
 		arrayforeach (&b->insts, inst)
 			free(*inst);
 		free(b->insts.val);
+		if (b->jump.kind == JUMP_JTAB)
+			free(b->jump.tab);
 		free(b);
 	}
 	mapfree(&f->gotos, free);
@@ -608,6 +620,8 @@ funcjnz(struct func *f, struct value *v, struct type *t, struct block *l1, struc
 
 	if (b->jump.kind)
 		return;
+	if (v == f->expectv)
+		b->jump.hint = f->expect;
 	if (t) {
 		assert(t->prop & PROPSCALAR);
 		/*
@@ -983,6 +997,13 @@ funcexpr(struct func *f, struct expr *e)
 			return funcinst(f, ILOADUB, 'w', l, NULL);
 		case BUILTINUNREACHABLE:
 			return NULL;
+		case BUILTINEXPECT:
+			l = funcexpr(f, e->base);
+			if (e->u.builtin.expect) {
+				f->expectv = l;
+				f->expect = e->u.builtin.expect;
+			}
+			return l;
 		default:
 			fatal("internal error: unimplemented builtin");
 		}
@@ -1074,37 +1095,141 @@ funcinit(struct func *func, struct decl *d, struct init *init, bool hasinit)
 	zero(func, d->value, d->type->align, max, d->type->size);
 }
 
+/*
+Dense runs of cases are dispatched through a jump table: at least
+JTABMIN cases whose key range is no more than JTABSPAN times the number
+of cases. Everything else is found with a binary search.
+*/
+enum {
+	JTABMIN = 4,
+	JTABSPAN = 3,
+};
+
+struct caserun {
+	struct switchcase **c;
+	size_t n;  /* more than one case: dispatched with a jump table */
+};
+
+static void
+caselist(struct switchcase *c, struct array *a)
+{
+	if (!c)
+		return;
+	caselist(c->node.child[0], a);
+	arrayaddptr(a, c);
+	caselist(c->node.child[1], a);
+}
+
+/* split the sorted cases into jump table runs and single cases */
+static void
+caseruns(int class, struct switchcase **c, size_t n, struct array *runs)
+{
+	struct caserun *r;
+	unsigned long long lo, key, prev;
+	size_t i, j, end;
+
+	for (i = 0; i < n; i = end) {
+		end = i + 1;
+		if (class == 'w') {
+			lo = prev = c[i]->node.key & 0xffffffff;
+			for (j = i + 1; j < n; ++j) {
+				key = c[j]->node.key & 0xffffffff;
+				if (key <= prev)
+					break;
+				prev = key;
+				if (j + 1 - i >= JTABMIN && key - lo < (j + 1 - i) * JTABSPAN)
+					end = j + 1;
+			}
+		}
+		r = arrayadd(runs, sizeof(*r));
+		r->c = &c[i];
+		r->n = end - i;
+	}
+}
+
 static void
-casesearch(struct func *f, int class, struct value *v, struct switchcase *c, struct block *defaultlabel)
+funcjtab(struct func *f, struct value *v, struct caserun *r, struct block *defaultlabel)
 {
-	struct value *res, *key;
+	struct block *b = f->end, **tab;
+	unsigned long long lo;
+	size_t i, n;
+
+	lo = r->c[0]->node.key & 0xffffffff;
+	n = (r->c[r->n - 1]->node.key & 0xffffffff) - lo + 1;
+	tab = xreallocarray(NULL, n, sizeof(*tab));
+	for (i = 0; i < n; ++i)
+		tab[i] = defaultlabel;
+	for (i = 0; i < r->n; ++i)
+		tab[(r->c[i]->node.key & 0xffffffff) - lo] = r->c[i]->body;
+	b->jump.kind = JUMP_JTAB;
+	b->jump.arg = v;
+	b->jump.tab = tab;
+	b->jump.ntab = n;
+}
+
+static void
+casesearch(struct func *f, int class, struct value *v, struct caserun *r, size_t n, struct block *defaultlabel)
+{
+	struct value *res, *key, *idx, *len;
 	struct block *label[3];
+	struct caserun *m;
 
-	if (!c) {
+	if (n == 0) {
 		funcjmp(f, defaultlabel);
 		return;
 	}
-	label[0] = mkblock("switch_ne");
+	m = &r[n / 2];
+	label[0] = mkblock(m->n > 1 ? "switch_ge" : "switch_ne");
 	label[1] = mkblock("switch_lt");
 	label[2] = mkblock("switch_gt");
 
-	/* XXX: linear search if c->node.height < 4 */
-	key = mkintconst(c->node.key);
+	key = mkintconst(m->c[0]->node.key);
+	if (m->n > 1) {
+		/*
+		With no cases below the table, smaller values wrap around
+		in the subtraction and fail the bounds check.
+		*/
+		if (m > r) {
+			res = funcinst(f, ICULTW, 'w', v, key);
+			funcjnz(f, res, NULL, label[1], label[0]);
+			funclabel(f, label[1]);
+			casesearch(f, class, v, r, m - r, defaultlabel);
+			funclabel(f, label[0]);
+		}
+		idx = funcinst(f, ISUB, 'w', v, key);
+		len = mkintconst((m->c[m->n - 1]->node.key - m->c[0]->node.key + 1) & 0xffffffff);
+		res = funcinst(f, ICULTW, 'w', idx, len);
+		label[1] = mkblock("switch_tab");
+		funcjnz(f, res, NULL, label[1], label[2]);
+		funclabel(f, label[1]);
+		funcjtab(f, idx, m, defaultlabel);
+		funclabel(f, label[2]);
+		casesearch(f, class, v, m + 1, n - (m - r) - 1, defaultlabel);
+		return;
+	}
 	res = funcinst(f, class == 'w' ? ICEQW : ICEQL, 'w', v, key);
-	funcjnz(f, res, NULL, c->body, label[0]);
+	funcjnz(f, res, NULL, m->c[0]->body, label[0]);
 	funclabel(f, label[0]);
 	res = funcinst(f, class == 'w' ? ICULTW : ICULTL, 'w', v, key);
 	funcjnz(f, res, NULL, label[1], label[2]);
 	funclabel(f, label[1]);
-	casesearch(f, class, v, c->node.child[0], defaultlabel);
+	casesearch(f, class, v, r, m - r, defaultlabel);
 	funclabel(f, label[2]);
-	casesearch(f, class, v, c->node.child[1], defaultlabel);
+	casesearch(f, class, v, m + 1, n - (m - r) - 1, defaultlabel);
 }
 
 void
 funcswitch(struct func *f, struct value *v, struct switchcases *c, struct block *defaultlabel)
 {
-	casesearch(f, qbetype(c->type).base, v, c->root, defaultlabel);
+	struct array cases = {0}, runs = {0};
+	int class;
+
+	class = qbetype(c->type).base;
+	caselist(c->root, &cases);
+	caseruns(class, cases.val, cases.len / sizeof(struct switchcase *), &runs);
+	casesearch(f, class, v, runs.val, runs.len / sizeof(struct caserun), defaultlabel);
+	free(cases.val);
+	free(runs.val);
 }
 
 /* emit */
@@ -1285,6 +1410,8 @@ emitinst(struct inst **instp, struct inst **instend)
 static void
 emitjump(struct jump *j)
 {
+	size_t i;
+
 	switch (j->kind) {
 	case JUMP_NONE:
 		break;
@@ -1308,11 +1435,22 @@ emitjump(struct jump *j)
 		emitname(&j->blk[0]->label);
 		fputs(", ", stdout);
 		emitname(&j->blk[1]->label);
+		if (j->hint)
+			printf(", %d", j->hint == 1);
 		putchar('\n');
 		break;
 	case JUMP_HLT:
 		fputs("\thlt\n", stdout);
 		break;
+	case JUMP_JTAB:
+		fputs("\tjtab ", stdout);
+		emitvalue(j->arg);
+		for (i = 0; i < j->ntab; ++i) {
+			fputs(", ", stdout);
+			emitname(&j->tab[i]->label);
+		}
+		putchar('\n');
+		break;
 	default:
 		assert(0);
 	}
@@ -1335,6 +1473,11 @@ emitfunc(struct func *f, bool global)
 	}
 	if (global)
 		puts("export");
+	switch (f->decl->u.func.inlinehint) {
+	case -1: puts("noinline");     break;
+	case 1:  puts("inline");       break;
+	case 2:  puts("alwaysinline"); break;
+	}
 	fputs("function ", stdout);
 	if (f->type->base != &typevoid) {
 		emitclass(qbetype(f->type->base).base, f->type->base->value);
@@ -0,0 +1,1178 @@
+/*
+ * bdos.c — Host implementation of the BDOS v4 syscall interface.
+ *
+ * userBDOS programs call the kernel by jumping to byte address 12 with
+ * the syscall number in r4, arguments in r5..r7 and the return address in
+ * r15 (userlib syscall_asm.asm). In BDOS mode emu_run() hands those jumps
+ * to bdos_syscall(), which does what Software/C/kernel/src/syscall.c does
+ * and returns the pc to continue at.
+ *
+ * Processes are loaded, relocated and laid out in the 0x200000..0x2000000
+ * pool exactly as proc_spawn() does, so a program sees the same addresses,
+ * stack and heap as on the FPGC. Scheduling is cooperative: the running
+ * process only changes at waitpid, yield, sleep and exit. The BRFS
+ * namespace is a host directory (-root); /dev/tty is the host terminal.
+ */
+
+#include "emu.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Software/C/kernel/include: proc.h, mem.h, vfs.h */
+#define MAX_PROCS        16
+#define MAX_FDS          16
+#define MAX_ARGV         32
+#define PROC_CWD_LEN     128
+#define MAX_OPEN_FILES   64
+#define PROC_POOL_START  0x200000u
+#define PROC_POOL_END    0x2000000u
+#define PROC_MEM_MIN     0x10000u
+#define PROC_STACK_SIZE  0x40000u
+#define PROC_GROW_CHUNK  0x100000u
+
+/* Kernel memory the emulator uses for argv arrays and the first argv */
+#define ARGV_TABLE_BASE  0x100000u
+#define ARGV_STRINGS     (ARGV_TABLE_BASE + MAX_PROCS * MAX_ARGV * 4)
+#define ARGV_STRINGS_END PROC_POOL_START
+
+/* Syscall numbers (userlib syscall.h) */
+#define SYS_EXIT            1
+#define SYS_YIELD           2
+#define SYS_SPAWN           3
+#define SYS_WAITPID         4
+#define SYS_GETPID          5
+#define SYS_KILL            6
+#define SYS_OPEN            10
+#define SYS_CLOSE           11
+#define SYS_READ            12
+#define SYS_WRITE           13
+#define SYS_LSEEK           14
+#define SYS_DUP2            15
+#define SYS_UNLINK          20
+#define SYS_MKDIR           21
+#define SYS_READDIR         22
+#define SYS_STAT            24
+#define SYS_SYNC            25
+#define SYS_CHDIR           30
+#define SYS_GETCWD          31
+#define SYS_ARGC            32
+#define SYS_ARGV            33
+#define SYS_SBRK            34
+#define SYS_SLEEP           40
+#define SYS_GET_KEY_STATE   41
+#define SYS_GET_TIME_US     42
+#define SYS_NET_PACKET_COUNT 52
+#define SYS_IOCTL           61
+
+/* sys_open() flags */
+#define BDOS_O_WRONLY   0x02
+#define BDOS_O_APPEND   0x04
+#define BDOS_O_CREAT    0x08
+#define BDOS_O_TRUNC    0x10
+#define BDOS_O_RAW      0x20
+
+/* /dev/tty raw key events */
+#define KEY_UP          0x101
+#define KEY_DOWN        0x102
+#define KEY_LEFT        0x103
+#define KEY_RIGHT       0x104
+#define KEY_INSERT      0x105
+#define KEY_DELETE      0x106
+#define KEY_HOME        0x107
+#define KEY_END         0x108
+#define KEY_PAGEUP      0x109
+#define KEY_PAGEDOWN    0x10A
+#define KEY_CTRL_D      4
+
+#define TTY_IOCTL_GET_UART_MIRROR 1
+#define TTY_IOCTL_SET_UART_MIRROR 2
+
+#define BRFS_FLAG_DIRECTORY 0x01
+#define BRFS_DIR_ENTRY_WORDS 8
+
+enum { PROC_FREE, PROC_READY, PROC_BLOCKED_WAIT, PROC_BLOCKED_SLEEP,
+       PROC_ZOMBIE };
+
+enum { FILE_TTY, FILE_NULL, FILE_ZERO, FILE_RANDOM, FILE_HOST };
+
+struct proc
+{
+    int state;
+    int ppid;
+    int exit_code;
+    int wait_pid;
+    uint64_t wake_at;
+    uint32_t mem_base, mem_size;
+    uint32_t heap_base, heap_break;
+    uint32_t argc;
+    int fds[MAX_FDS];
+    char cwd[PROC_CWD_LEN];
+    cpu_t cpu;
+};
+
+struct open_file
+{
+    int refcount;
+    int kind;
+    int flags;
+    int host_fd;
+};
+
+struct bdos
+{
+    char root[1024];
+    int realtime;
+    struct proc procs[MAX_PROCS];
+    int cur;
+    int switch_pending;
+    int exit_code;
+    struct open_file files[MAX_OPEN_FILES];
+    uint32_t random_state;
+    int uart_mirror;
+    int raw_opens;
+    int tty_is_term;
+    struct termios saved_termios;
+};
+
+/* ---- Guest memory ---- */
+
+static uint8_t *
+guest(emu_t *m, uint32_t addr, uint32_t len)
+{
+    if (addr >= SDRAM_SIZE || len > SDRAM_SIZE - addr)
+        return NULL;
+    return m->sdram + addr;
+}
+
+static int
+guest_string(emu_t *m, uint32_t addr, char *out, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i + 1 < size; i++)
+    {
+        if (addr + i >= SDRAM_SIZE)
+            return -1;
+        out[i] = m->sdram[addr + i];
+        if (!out[i])
+            return 0;
+    }
+    out[i] = '\0';
+    return 0;
+}
+
+/* ---- Host terminal ---- */
+
+static struct termios *restore_termios;
+
+static void
+tty_restore(void)
+{
+    if (restore_termios)
+        tcsetattr(STDIN_FILENO, TCSANOW, restore_termios);
+}
+
+static void
+tty_set_raw(struct bdos *b, int raw)
+{
+    struct termios t;
+
+    if (!b->tty_is_term)
+        return;
+    t = b->saved_termios;
+    if (raw)
+    {
+        t.c_lflag &= ~(ICANON | ECHO | ISIG);
+        t.c_cc[VMIN] = 1;
+        t.c_cc[VTIME] = 0;
+    }
+    tcsetattr(STDIN_FILENO, TCSANOW, &t);
+}
+
+static int
+stdin_ready(int timeout_ms)
+{
+    struct pollfd p = { STDIN_FILENO, POLLIN, 0 };
+
+    return poll(&p, 1, timeout_ms) > 0;
+}
+
+static int
+stdin_byte(void)
+{
+    unsigned char c;
+
+    return read(STDIN_FILENO, &c, 1) == 1 ? c : -1;
+}
+
+/* One raw key event from the host terminal, -1 if none is waiting */
+static int
+tty_key(emu_t *m, struct bdos *b)
+{
+    int c, c2, c3;
+
+    if (m->stdin_eof)
+        return KEY_CTRL_D;
+    if (!stdin_ready(b->tty_is_term ? 10 : 0))
+        return -1;
+    c = stdin_byte();
+    if (c < 0)
+    {
+        m->stdin_eof = 1;
+        return KEY_CTRL_D;
+    }
+    if (c != 0x1B || !stdin_ready(5))
+        return c;
+    if ((c2 = stdin_byte()) != '[' || !stdin_ready(5))
+        return c2 < 0 ? 0x1B : c2;
+    c3 = stdin_byte();
+    switch (c3)
+    {
+    case 'A': return KEY_UP;
+    case 'B': return KEY_DOWN;
+    case 'C': return KEY_RIGHT;
+    case 'D': return KEY_LEFT;
+    case 'H': return KEY_HOME;
+    case 'F': return KEY_END;
+    default:
+        if (c3 >= '1' && c3 <= '6' && stdin_byte() == '~')
+        {
+            static const int tilde_keys[] = { KEY_HOME, KEY_INSERT, KEY_DELETE,
+                                              KEY_END, KEY_PAGEUP,
+                                              KEY_PAGEDOWN };
+            return tilde_keys[c3 - '1'];
+        }
+        return -1;
+    }
+}
+
+/* ---- Open files ---- */
+
+static int
+file_alloc(struct bdos *b, int kind, int flags, int host_fd)
+{
+    int i;
+
+    for (i = 0; i < MAX_OPEN_FILES; i++)
+    {
+        if (b->files[i].refcount == 0)
+        {
+            b->files[i].refcount = 1;
+            b->files[i].kind = kind;
+            b->files[i].flags = flags;
+            b->files[i].host_fd = host_fd;
+            if (kind == FILE_TTY && (flags & BDOS_O_RAW) && b->raw_opens++ == 0)
+                tty_set_raw(b, 1);
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void
+file_release(struct bdos *b, int gfd)
+{
+    struct open_file *f = &b->files[gfd];
+
+    if (--f->refcount > 0)
+        return;
+    if (f->kind == FILE_HOST)
+        close(f->host_fd);
+    if (f->kind == FILE_TTY && (f->flags & BDOS_O_RAW) && --b->raw_opens == 0)
+        tty_set_raw(b, 0);
+}
+
+static struct open_file *
+fd_file(struct bdos *b, int fd)
+{
+    struct proc *p = &b->procs[b->cur];
+
+    if (fd < 0 || fd >= MAX_FDS || p->fds[fd] < 0)
+        return NULL;
+    return &b->files[p->fds[fd]];
+}
+
+static void
+fds_close_all(struct bdos *b, struct proc *p)
+{
+    int i;
+
+    for (i = 0; i < MAX_FDS; i++)
+    {
+        if (p->fds[i] >= 0)
+            file_release(b, p->fds[i]);
+        p->fds[i] = -1;
+    }
+}
+
+/* ---- Paths ---- */
+
+/* syscall.c resolve_user_path(): relative paths start at the cwd */
+static void
+resolve_user_path(struct bdos *b, char *out, size_t size, const char *path)
+{
+    const char *cwd = b->procs[b->cur].cwd;
+    size_t len;
+
+    if (path[0] == '/' || !cwd[0])
+    {
+        snprintf(out, size, "%s", path);
+        return;
+    }
+    len = strlen(cwd);
+    snprintf(out, size, "%s%s%s", cwd,
+             len > 1 || cwd[0] != '/' ? (cwd[len - 1] == '/' ? "" : "/") : "",
+             path);
+}
+
+/* fs_for_path(): BRFS path to host path under the root */
+static void
+host_path(struct bdos *b, char *out, size_t size, const char *path)
+{
+    snprintf(out, size, "%s/%s", b->root, path[0] == '/' ? path + 1 : path);
+}
+
+static int
+dev_kind(const char *path)
+{
+    if (!strcmp(path, "/dev/tty") || !strcmp(path, "/dev/uart"))
+        return FILE_TTY;
+    if (!strcmp(path, "/dev/null"))
+        return FILE_NULL;
+    if (!strcmp(path, "/dev/zero"))
+        return FILE_ZERO;
+    if (!strcmp(path, "/dev/random"))
+        return FILE_RANDOM;
+    return -1;
+}
+
+/* ---- Memory pool (mem.c, first fit with in-place growth) ---- */
+
+static uint32_t
+pool_next_used(struct bdos *b, uint32_t addr, int skip)
+{
+    uint32_t next = PROC_POOL_END;
+    int i;
+
+    for (i = 1; i < MAX_PROCS; i++)
+    {
+        struct proc *p = &b->procs[i];
+
+        if (i != skip && p->mem_size && p->mem_base >= addr && p->mem_base < next)
+            next = p->mem_base;
+    }
+    return next;
+}
+
+static uint32_t
+pool_alloc(struct bdos *b, uint32_t size)
+{
+    uint32_t addr = PROC_POOL_START;
+    int i, moved;
+
+    do
+    {
+        moved = 0;
+        for (i = 1; i < MAX_PROCS; i++)
+        {
+            struct proc *p = &b->procs[i];
+
+            if (p->mem_size && addr < p->mem_base + p->mem_size &&
+                p->mem_base < addr + size)
+            {
+                addr = p->mem_base + p->mem_size;
+                moved = 1;
+            }
+        }
+    } while (moved);
+    return addr + size <= PROC_POOL_END ? addr : 0;
+}
+
+/* ---- Processes ---- */
+
+static void
+apply_relocations(emu_t *m, uint32_t base, uint32_t file_size)
+{
+    uint32_t prog_words = sdram_word(m, base + 8);
+    uint32_t count, i;
+
+    if (file_size <= prog_words * 4)
+        return;
+    count = sdram_word(m, base + prog_words * 4);
+    for (i = 0; i < count; i++)
+    {
+        uint32_t entry = sdram_word(m, base + (prog_words + 1 + i) * 4);
+        uint32_t at = base + ((entry >> 8) & ~3u);
+        uint32_t w = sdram_word(m, at), w2, addr;
+
+        switch (entry & 0xFF)
+        {
+        case 0:
+            sdram_set_word(m, at, w + base);
+            break;
+        case 1:
+            w2 = sdram_word(m, at + 4);
+            addr = ((((w2 >> 8) & 0xFFFF) << 16) | ((w >> 8) & 0xFFFF)) + base;
+            sdram_set_word(m, at, (w & 0xFF0000FF) | ((addr & 0xFFFF) << 8));
+            sdram_set_word(m, at + 4, (w2 & 0xFF0000FF) | ((addr >> 16) << 8));
+            break;
+        case 2:
+            addr = ((w >> 1) & 0x7FFFFFF) + base;
+            sdram_set_word(m, at, (w & 0xF0000001) | ((addr & 0x7FFFFFF) << 1));
+            break;
+        }
+    }
+}
+
+/* proc_spawn(): argv points at argc guest pointers, copied as they are */
+static int
+proc_spawn(emu_t *m, struct bdos *b, const char *file, int argc,
+           uint32_t argv, int parent)
+{
+    struct proc *p;
+    struct stat st;
+    uint32_t base, size, table;
+    FILE *f;
+    int pid, i;
+
+    for (pid = 1; pid < MAX_PROCS && b->procs[pid].state != PROC_FREE; pid++)
+        ;
+    if (pid == MAX_PROCS)
+        return -1;
+    if (stat(file, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+        st.st_size > (off_t)(PROC_POOL_END - PROC_POOL_START))
+        return -1;
+
+    size = ((uint32_t)st.st_size + PROC_STACK_SIZE + 31) & ~31u;
+    if (size < PROC_MEM_MIN)
+        size = PROC_MEM_MIN;
+    base = pool_alloc(b, size);
+    if (!base)
+        return -1;
+    f = fopen(file, "rb");
+    if (!f)
+        return -1;
+    if (fread(m->sdram + base, 1, st.st_size, f) != (size_t)st.st_size)
+    {
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+    apply_relocations(m, base, st.st_size);
+
+    p = &b->procs[pid];
+    memset(p, 0, sizeof(*p));
+    p->state = PROC_READY;
+    p->ppid = parent;
+    p->wait_pid = -1;
+    p->mem_base = base;
+    p->mem_size = size;
+    p->heap_base = (base + st.st_size + PROC_STACK_SIZE + 3) & ~3u;
+    p->heap_break = p->heap_base;
+    p->cpu.pc = base;
+    p->cpu.r[13] = base + st.st_size + PROC_STACK_SIZE - 8;
+    p->cpu.r[15] = base;
+
+    if (argc > MAX_ARGV)
+        argc = MAX_ARGV;
+    p->argc = argc < 0 ? 0 : argc;
+    table = ARGV_TABLE_BASE + pid * MAX_ARGV * 4;
+    for (i = 0; i < MAX_ARGV; i++)
+        sdram_set_word(m, table + i * 4,
+                       i < argc && argv ? sdram_word(m, argv + i * 4) : 0);
+
+    for (i = 0; i < MAX_FDS; i++)
+        p->fds[i] = -1;
+    if (parent)
+    {
+        struct proc *pp = &b->procs[parent];
+
+        for (i = 0; i < 3; i++)
+            if ((p->fds[i] = pp->fds[i]) >= 0)
+                b->files[p->fds[i]].refcount++;
+        memcpy(p->cwd, pp->cwd, sizeof(p->cwd));
+    }
+    else
+    {
+        int tty = file_alloc(b, FILE_TTY, 3, -1);
+
+        for (i = 0; i < 3; i++)
+            p->fds[i] = tty;
+        b->files[tty].refcount = 3;
+        strcpy(p->cwd, "/");
+    }
+    return pid;
+}
+
+static void
+proc_free_memory(struct proc *p)
+{
+    p->mem_base = 0;
+    p->mem_size = 0;
+}
+
+static void
+proc_exit(struct bdos *b, int pid, int code)
+{
+    struct proc *p = &b->procs[pid];
+    struct proc *parent = &b->procs[p->ppid];
+
+    fds_close_all(b, p);
+    proc_free_memory(p);
+    p->exit_code = code;
+    p->state = PROC_ZOMBIE;
+    if (pid == 1)
+        b->exit_code = code;
+    if (p->ppid && parent->state == PROC_BLOCKED_WAIT &&
+        (parent->wait_pid == pid || parent->wait_pid == -1))
+    {
+        parent->cpu.r[1] = code;
+        parent->state = PROC_READY;
+        p->state = PROC_FREE;
+    }
+    b->switch_pending = 1;
+}
+
+static int
+proc_waitpid(struct bdos *b, int pid)
+{
+    struct proc *p = &b->procs[b->cur];
+    int i;
+
+    if (pid >= 0)
+    {
+        if (pid >= MAX_PROCS || b->procs[pid].state == PROC_FREE)
+            return -1;
+        if (b->procs[pid].state == PROC_ZOMBIE)
+        {
+            b->procs[pid].state = PROC_FREE;
+            return b->procs[pid].exit_code;
+        }
+    }
+    else
+    {
+        for (i = 1; i < MAX_PROCS; i++)
+        {
+            if (b->procs[i].ppid == b->cur && b->procs[i].state == PROC_ZOMBIE)
+            {
+                b->procs[i].state = PROC_FREE;
+                return b->procs[i].exit_code;
+            }
+        }
+    }
+    p->state = PROC_BLOCKED_WAIT;
+    p->wait_pid = pid;
+    b->switch_pending = 1;
+    return 0;
+}
+
+/*
+ * Pick the next process after a block, yield or exit. Sleeping processes
+ * wake when the cycle counter reaches their wake time; when only sleepers
+ * are left, time skips ahead (or passes on the host with -realtime).
+ * Returns 0 when no process can run any more.
+ */
+static int
+schedule(emu_t *m, struct bdos *b)
+{
+    for (;;)
+    {
+        uint64_t wake = UINT64_MAX;
+        int i, pid;
+
+        for (i = 1; i <= MAX_PROCS; i++)
+        {
+            pid = (b->cur + i - 1) % (MAX_PROCS - 1) + 1;
+            if (b->procs[pid].state == PROC_BLOCKED_SLEEP)
+            {
+                if (m->cycles >= b->procs[pid].wake_at)
+                    b->procs[pid].state = PROC_READY;
+                else if (b->procs[pid].wake_at < wake)
+                    wake = b->procs[pid].wake_at;
+            }
+        }
+        for (i = 1; i <= MAX_PROCS; i++)
+        {
+            pid = (b->cur + i - 1) % (MAX_PROCS - 1) + 1;
+            if (b->procs[pid].state == PROC_READY)
+            {
+                b->cur = pid;
+                return 1;
+            }
+        }
+        if (wake == UINT64_MAX)
+            return 0;
+        if (b->realtime)
+        {
+            uint64_t us = (wake - m->cycles) / (CLOCK_HZ / 1000000);
+            struct timespec ts = { (time_t)(us / 1000000),
+                                   (long)(us % 1000000) * 1000 };
+
+            fflush(stdout);
+            nanosleep(&ts, NULL);
+        }
+        m->cycles = wake;
+    }
+}
+
+/* ---- Syscalls ---- */
+
+static int
+sys_open(emu_t *m, struct bdos *b, uint32_t upath, int flags)
+{
+    struct proc *p = &b->procs[b->cur];
+    char path[256], resolved[256], host[2048];
+    int kind, gfd, fd, hfd, oflags;
+
+    if (guest_string(m, upath, path, sizeof(path)) < 0)
+        return -1;
+    resolve_user_path(b, resolved, sizeof(resolved), path);
+
+    for (fd = 0; fd < MAX_FDS && p->fds[fd] >= 0; fd++)
+        ;
+    if (fd == MAX_FDS)
+        return -1;
+
+    kind = dev_kind(resolved);
+    hfd = -1;
+    if (kind < 0)
+    {
+        struct stat st;
+
+        if (!strncmp(resolved, "/dev/", 5) || !strncmp(resolved, "/proc/", 6))
+            return -1;
+        host_path(b, host, sizeof(host), resolved);
+        oflags = O_RDWR | ((flags & BDOS_O_CREAT) ? O_CREAT : 0);
+        hfd = open(host, oflags, 0644);
+        if (hfd < 0 && errno != ENOENT && !(flags & BDOS_O_WRONLY))
+            hfd = open(host, O_RDONLY);
+        if (hfd < 0)
+            return -1;
+        if (fstat(hfd, &st) < 0 || !S_ISREG(st.st_mode))
+        {
+            close(hfd);
+            return -1;
+        }
+        if (flags & BDOS_O_TRUNC)
+            (void)!ftruncate(hfd, 0);
+        if (flags & BDOS_O_APPEND)
+            lseek(hfd, 0, SEEK_END);
+        kind = FILE_HOST;
+    }
+    gfd = file_alloc(b, kind, flags, hfd);
+    if (gfd < 0)
+    {
+        if (hfd >= 0)
+            close(hfd);
+        return -1;
+    }
+    p->fds[fd] = gfd;
+    return fd;
+}
+
+static int
+tty_read(emu_t *m, struct bdos *b, struct open_file *f, uint8_t *buf, int count)
+{
+    ssize_t n;
+    int copied = 0;
+
+    if (f->flags & BDOS_O_RAW)
+    {
+        while (copied + 4 <= count)
+        {
+            int key = tty_key(m, b);
+
+            if (key < 0)
+                break;
+            buf[copied] = key;
+            buf[copied + 1] = key >> 8;
+            buf[copied + 2] = 0;
+            buf[copied + 3] = 0;
+            copied += 4;
+            if (!stdin_ready(0))
+                break;
+        }
+        return copied;
+    }
+
+    /* Cooked: a line from the host terminal, 0 at end of input */
+    if (m->stdin_eof)
+        return 0;
+    fflush(stdout);
+    if (b->raw_opens)
+        tty_set_raw(b, 0);
+    n = read(STDIN_FILENO, buf, count);
+    if (b->raw_opens)
+        tty_set_raw(b, 1);
+    if (n <= 0)
+    {
+        m->stdin_eof = 1;
+        return 0;
+    }
+    return (int)n;
+}
+
+static int
+sys_read(emu_t *m, struct bdos *b, int fd, uint32_t ubuf, int count)
+{
+    struct open_file *f = fd_file(b, fd);
+    uint8_t *buf;
+    ssize_t n;
+    int i;
+
+    if (!f)
+        return -1;
+    if (count <= 0)
+        return 0;
+    buf = guest(m, ubuf, count);
+    if (!buf)
+        return -1;
+    switch (f->kind)
+    {
+    case FILE_TTY:
+        return tty_read(m, b, f, buf, count);
+    case FILE_NULL:
+        return 0;
+    case FILE_ZERO:
+        memset(buf, 0, count);
+        return count;
+    case FILE_RANDOM:
+        for (i = 0; i < count; i++)
+        {
+            b->random_state ^= b->random_state << 13;
+            b->random_state ^= b->random_state >> 17;
+            b->random_state ^= b->random_state << 5;
+            buf[i] = b->random_state;
+        }
+        return count;
+    default:
+        n = read(f->host_fd, buf, count);
+        return n < 0 ? -1 : (int)n;
+    }
+}
+
+static int
+sys_write(emu_t *m, struct bdos *b, int fd, uint32_t ubuf, int count)
+{
+    struct open_file *f = fd_file(b, fd);
+    uint8_t *buf;
+    ssize_t n;
+
+    if (!f)
+        return -1;
+    if (count <= 0)
+        return 0;
+    buf = guest(m, ubuf, count);
+    if (!buf)
+        return -1;
+    switch (f->kind)
+    {
+    case FILE_TTY:
+        fwrite(buf, 1, count, stdout);
+        fflush(stdout);
+        return count;
+    case FILE_HOST:
+        n = write(f->host_fd, buf, count);
+        return n < 0 ? -1 : (int)n;
+    default:
+        return count;
+    }
+}
+
+static void
+put_dir_entry(emu_t *m, uint32_t addr, const char *name, int is_dir,
+              uint32_t size)
+{
+    uint32_t w[BRFS_DIR_ENTRY_WORDS] = { 0 };
+    int i;
+
+    /* brfs_compress_string(): 4 chars per word, first char in the MSB */
+    for (i = 0; i < 16 && name[i]; i++)
+        w[i / 4] |= (uint32_t)(uint8_t)name[i] << (24 - (i & 3) * 8);
+    w[5] = is_dir ? BRFS_FLAG_DIRECTORY : 0;
+    w[7] = size;
+    for (i = 0; i < BRFS_DIR_ENTRY_WORDS; i++)
+        sdram_set_word(m, addr + i * 4, w[i]);
+}
+
+static int
+name_cmp(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static int
+sys_readdir(emu_t *m, struct bdos *b, uint32_t upath, uint32_t ubuf, int max)
+{
+    static const char *const dev_names[] = { "tty", "null", "zero", "random",
+                                             "uart" };
+    char path[256], resolved[256], host[2048], file[4096];
+    char **names = NULL;
+    size_t n = 0, cap = 0, i;
+    struct dirent *de;
+    DIR *dir;
+    int count = 0;
+
+    if (guest_string(m, upath, path, sizeof(path)) < 0 || max < 0 ||
+        !guest(m, ubuf, (uint32_t)max * BRFS_DIR_ENTRY_WORDS * 4))
+        return -1;
+    resolve_user_path(b, resolved, sizeof(resolved), path);
+
+    if (!strcmp(resolved, "/dev") || !strcmp(resolved, "/dev/"))
+    {
+        for (i = 0; i < sizeof(dev_names) / sizeof(dev_names[0]) &&
+                    count < max; i++)
+            put_dir_entry(m, ubuf + count++ * 32, dev_names[i], 0, 0);
+        return count;
+    }
+
+    host_path(b, host, sizeof(host), resolved);
+    dir = opendir(host);
+    if (!dir)
+        return -1;
+    while ((de = readdir(dir)) != NULL)
+    {
+        if (!strcmp(de->d_name, ".") || !strcmp(de->d_name, ".."))
+            continue;
+        if (n == cap)
+        {
+            cap = cap ? cap * 2 : 32;
+            names = realloc(names, cap * sizeof(*names));
+        }
+        names[n++] = strdup(de->d_name);
+    }
+    closedir(dir);
+    qsort(names, n, sizeof(*names), name_cmp);
+
+    if (count < max)
+        put_dir_entry(m, ubuf + count++ * 32, ".", 1, 0);
+    if (count < max)
+        put_dir_entry(m, ubuf + count++ * 32, "..", 1, 0);
+    for (i = 0; i < n; i++)
+    {
+        struct stat st;
+
+        snprintf(file, sizeof(file), "%s/%s", host, names[i]);
+        if (count < max && stat(file, &st) == 0)
+            put_dir_entry(m, ubuf + count++ * 32, names[i], S_ISDIR(st.st_mode),
+                          S_ISDIR(st.st_mode) ? 0 : (uint32_t)st.st_size);
+        free(names[i]);
+    }
+    free(names);
+
+    /* vfs_readdir(): synthetic mount points in the root */
+    if (!strcmp(resolved, "/"))
+    {
+        if (count < max)
+            put_dir_entry(m, ubuf + count++ * 32, "dev", 1, 0);
+        if (count < max)
+            put_dir_entry(m, ubuf + count++ * 32, "proc", 1, 0);
+    }
+    return count;
+}
+
+static int
+path_syscall(emu_t *m, struct bdos *b, int num, uint32_t upath)
+{
+    char path[256], resolved[256], host[2048];
+    struct stat st;
+
+    if (guest_string(m, upath, path, sizeof(path)) < 0)
+        return -1;
+    resolve_user_path(b, resolved, sizeof(resolved), path);
+    if (num == SYS_STAT &&
+        (!strncmp(resolved, "/dev/", 5) || !strncmp(resolved, "/proc/", 6)))
+        return 0;
+    host_path(b, host, sizeof(host), resolved);
+    switch (num)
+    {
+    case SYS_UNLINK:
+        return remove(host) == 0 ? 0 : -1;
+    case SYS_MKDIR:
+        return mkdir(host, 0755) == 0 ? 0 : -1;
+    default:
+        return stat(host, &st) == 0 ? 0 : -1;
+    }
+}
+
+static int
+sys_sbrk(struct bdos *b, int32_t incr)
+{
+    struct proc *p = &b->procs[b->cur];
+    uint32_t old_break = p->heap_break;
+    uint32_t new_break = old_break + (uint32_t)incr;
+    uint32_t limit = p->mem_base + p->mem_size;
+
+    if (new_break < p->heap_base)
+        return -1;
+    if (new_break > limit)
+    {
+        uint32_t need = new_break - limit;
+        uint32_t avail = pool_next_used(b, limit, b->cur) - limit;
+
+        if (need < PROC_GROW_CHUNK)
+            need = PROC_GROW_CHUNK;
+        need = (need + 31) & ~31u;
+        if (avail == 0)
+            return -1;
+        p->mem_size += need < avail ? need : avail;
+        if (new_break > p->mem_base + p->mem_size)
+            return -1;
+    }
+    p->heap_break = new_break;
+    return (int)old_break;
+}
+
+static int
+dispatch(emu_t *m, struct bdos *b, int num, uint32_t a1, uint32_t a2,
+         uint32_t a3)
+{
+    struct proc *p = &b->procs[b->cur];
+    struct open_file *f;
+    char path[256], host[2048];
+    int i;
+
+    switch (num)
+    {
+    case SYS_EXIT:
+        proc_exit(b, b->cur, (int)a1);
+        return 0;
+
+    case SYS_YIELD:
+        b->switch_pending = 1;
+        return 0;
+
+    case SYS_SPAWN:
+        if (guest_string(m, a1, path, sizeof(path)) < 0)
+            return -1;
+        host_path(b, host, sizeof(host), path);
+        return proc_spawn(m, b, host, (int)a2, a3, b->cur);
+
+    case SYS_WAITPID:
+        return proc_waitpid(b, (int)a1);
+
+    case SYS_GETPID:
+        return b->cur;
+
+    case SYS_KILL:
+        if ((int)a1 <= 0 || (int)a1 >= MAX_PROCS ||
+            b->procs[a1].state == PROC_FREE)
+            return -1;
+        fds_close_all(b, &b->procs[a1]);
+        proc_free_memory(&b->procs[a1]);
+        b->procs[a1].state = PROC_FREE;
+        if (a1 == 1)
+            b->exit_code = 1;
+        if (a1 == (uint32_t)b->cur)
+            b->switch_pending = 1;
+        return 0;
+
+    case SYS_OPEN:
+        return sys_open(m, b, a1, (int)a2);
+
+    case SYS_CLOSE:
+        if (!fd_file(b, (int)a1))
+            return -1;
+        file_release(b, p->fds[a1]);
+        p->fds[a1] = -1;
+        return 0;
+
+    case SYS_READ:
+        return sys_read(m, b, (int)a1, a2, (int)a3);
+
+    case SYS_WRITE:
+        return sys_write(m, b, (int)a1, a2, (int)a3);
+
+    case SYS_LSEEK:
+        f = fd_file(b, (int)a1);
+        if (!f || f->kind != FILE_HOST || a3 > 2)
+            return -1;
+        return (int)lseek(f->host_fd, (int32_t)a2,
+                          a3 == 0 ? SEEK_SET : a3 == 1 ? SEEK_CUR : SEEK_END);
+
+    case SYS_DUP2:
+        if (!fd_file(b, (int)a1) || (int)a2 < 0 || (int)a2 >= MAX_FDS)
+            return -1;
+        if (p->fds[a2] >= 0)
+            file_release(b, p->fds[a2]);
+        p->fds[a2] = p->fds[a1];
+        b->files[p->fds[a2]].refcount++;
+        return (int)a2;
+
+    case SYS_UNLINK:
+    case SYS_MKDIR:
+    case SYS_STAT:
+        return path_syscall(m, b, num, a1);
+
+    case SYS_READDIR:
+        return sys_readdir(m, b, a1, a2, (int)a3);
+
+    case SYS_SYNC:
+        return 0;
+
+    case SYS_CHDIR:
+        for (i = 0; i < PROC_CWD_LEN - 1 && a1 + i < SDRAM_SIZE &&
+                    m->sdram[a1 + i]; i++)
+            p->cwd[i] = m->sdram[a1 + i];
+        p->cwd[i] = '\0';
+        return 0;
+
+    case SYS_GETCWD:
+        for (i = 0; i < (int)a2 - 1 && p->cwd[i]; i++)
+            m->sdram[(a1 + i) & SDRAM_MASK] = p->cwd[i];
+        m->sdram[(a1 + i) & SDRAM_MASK] = '\0';
+        return (int)a1;
+
+    case SYS_ARGC:
+        return (int)p->argc;
+
+    case SYS_ARGV:
+        return (int)(ARGV_TABLE_BASE + b->cur * MAX_ARGV * 4);
+
+    case SYS_SBRK:
+        return sys_sbrk(b, (int32_t)a1);
+
+    case SYS_SLEEP:
+        if (b->realtime)
+        {
+            struct timespec ts = { a1 / 1000, (long)(a1 % 1000) * 1000000 };
+
+            fflush(stdout);
+            nanosleep(&ts, NULL);
+        }
+        p->wake_at = m->cycles + (uint64_t)a1 * (CLOCK_HZ / 1000);
+        p->state = PROC_BLOCKED_SLEEP;
+        b->switch_pending = 1;
+        return 0;
+
+    case SYS_GET_KEY_STATE:
+        return 0;
+
+    case SYS_GET_TIME_US:
+        return (int)(m->cycles / (CLOCK_HZ / 1000000));
+
+    case SYS_NET_PACKET_COUNT:
+        return 0;
+
+    case SYS_IOCTL:
+        f = fd_file(b, (int)a1);
+        if (!f || f->kind != FILE_TTY)
+            return -1;
+        if (a2 == TTY_IOCTL_GET_UART_MIRROR)
+            return b->uart_mirror;
+        if (a2 == TTY_IOCTL_SET_UART_MIRROR)
+        {
+            b->uart_mirror = a3 != 0;
+            return 0;
+        }
+        return -1;
+
+    default:
+        /* Networking, pipes, DMA service, rename, truncate, format */
+        return -1;
+    }
+}
+
+uint32_t
+bdos_syscall(emu_t *m, uint32_t pc)
+{
+    struct bdos *b = m->bdos;
+    struct proc *p = &b->procs[b->cur];
+    uint32_t *r = m->cpu.r;
+    int result;
+
+    (void)pc;
+    result = dispatch(m, b, (int)r[4], r[5], r[6], r[7]);
+    r[1] = (uint32_t)result;
+    m->cpu.pc = r[15];
+    if (!b->switch_pending)
+        return m->cpu.pc;
+
+    b->switch_pending = 0;
+    if (p->state != PROC_FREE && p->state != PROC_ZOMBIE)
+        p->cpu = m->cpu;
+    if (b->procs[1].state == PROC_FREE || b->procs[1].state == PROC_ZOMBIE ||
+        !schedule(m, b))
+    {
+        m->exited = 1;
+        return m->cpu.pc;
+    }
+    m->cpu = b->procs[b->cur].cpu;
+    return m->cpu.pc;
+}
+
+/* ---- Setup ---- */
+
+int
+bdos_init(emu_t *m, const char *root, int realtime)
+{
+    struct bdos *b = calloc(1, sizeof(*b));
+
+    if (!b)
+        return -1;
+    snprintf(b->root, sizeof(b->root), "%s", root);
+    b->realtime = realtime;
+    b->random_state = 0x2545F491;
+    b->tty_is_term = isatty(STDIN_FILENO) &&
+                     tcgetattr(STDIN_FILENO, &b->saved_termios) == 0;
+    if (b->tty_is_term)
+    {
+        restore_termios = &b->saved_termios;
+        atexit(tty_restore);
+    }
+    m->bdos = b;
+    return 0;
+}
+
+/* Start image as pid 1 with argv[] copied into kernel memory */
+int
+bdos_start(emu_t *m, const char *image, int argc, char **argv)
+{
+    struct bdos *b = m->bdos;
+    uint32_t table = ARGV_STRINGS, str;
+    int i, pid;
+
+    if (argc > MAX_ARGV)
+        argc = MAX_ARGV;
+    str = table + MAX_ARGV * 4;
+    for (i = 0; i < argc; i++)
+    {
+        size_t len = strlen(argv[i]) + 1;
+
+        if (str + len > ARGV_STRINGS_END)
+            return -1;
+        memcpy(m->sdram + str, argv[i], len);
+        sdram_set_word(m, table + i * 4, str);
+        str += len;
+    }
+
+    b->cur = 0;
+    pid = proc_spawn(m, b, image, argc, table, 0);
+    if (pid < 0)
+        return -1;
+    b->cur = pid;
+    m->cpu = b->procs[pid].cpu;
+    return 0;
+}
+
+int
+bdos_exit_code(emu_t *m)
+{
+    return m->bdos->exit_code;
+}
+
+void
+bdos_free(emu_t *m)
+{
+    free(m->bdos);
+    m->bdos = NULL;
+}
@@ -0,0 +1,550 @@
+/*
+ * bus.c — Memory map and peripherals.
+ *
+ * Address decoding follows MemoryStage.v and the I/O registers follow
+ * MemoryUnit.v. Devices that need the outside world are reduced to what
+ * a program can observe without them: the SPI ports have nothing
+ * attached (every transfer clocks in 0xFF), GPIO reads 0, and the DMA
+ * engine finishes a transfer within the write that starts it. Timers,
+ * the frame interrupt and UART RX are events on the cycle counter;
+ * emu_run() calls bus_service() when the counter passes m->deadline.
+ */
+
+#include "emu.h"
+
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* MemoryUnit.v register offsets from IO_BASE */
+#define IO_UART_TX      0x00
+#define IO_UART_RX      0x04
+#define IO_TIMER1_VALUE 0x08
+#define IO_TIMER3_START 0x1C
+#define IO_SPI0_DATA    0x20
+#define IO_SPI5_CS      0x58
+#define IO_GPIO_MODE    0x5C
+#define IO_GPIO_STATE   0x60
+#define IO_BOOT_MODE    0x64
+#define IO_MICROS       0x68
+#define IO_LED_USER     0x6C
+#define IO_DMA_SRC      0x70
+#define IO_DMA_DESC_CUR 0x8C
+
+/* DMA_CTRL / descriptor fields (DMAengine.v) */
+#define DMA_MODE_MEM2MEM   0
+#define DMA_MODE_MEM2SPI   1
+#define DMA_MODE_SPI2MEM   2
+#define DMA_MODE_MEM2VRAM  3
+#define DMA_MODE_QSPI      6
+#define DMA_CTRL_IRQ_EN    (1u << 4)
+#define DMA_CTRL_CHAIN     (1u << 8)
+#define DMA_CTRL_START     (1u << 31)
+#define DMA_DESC_IRQ       (1u << 4)
+#define DMA_DESC_2D        (1u << 8)
+
+#define CYCLES_PER_MS      (CLOCK_HZ / 1000)
+#define CYCLES_PER_FRAME   (CLOCK_HZ / 60)
+#define UART_POLL_CYCLES   10000
+
+/*
+ * SPI register layout: each port has DATA and CS, ports 2..4 add NINT.
+ * Index = port * 3 + (0 data, 1 cs, 2 nint) for the offsets 0x20..0x58.
+ */
+static const signed char spi_reg[] = {
+    0, 1,       /* SPI0 0x20 0x24 */
+    3, 4,       /* SPI1 0x28 0x2C */
+    6, 7, 8,    /* SPI2 0x30 0x34 0x38 */
+    9, 10, 11,  /* SPI3 0x3C 0x40 0x44 */
+    12, 13, 14, /* SPI4 0x48 0x4C 0x50 */
+    15, 16,     /* SPI5 0x54 0x58 */
+};
+
+int
+emu_init(emu_t *m)
+{
+    int i;
+
+    memset(m, 0, sizeof(*m));
+    m->sdram = calloc(1, SDRAM_SIZE);
+    if (!m->sdram)
+        return -1;
+    m->cpu.pc = ROM_BASE;
+    for (i = 0; i < 6; i++)
+        m->spi_cs[i] = 1;
+    m->next_frame = CYCLES_PER_FRAME;
+    m->next_uart_poll = UART_POLL_CYCLES;
+    return 0;
+}
+
+void
+emu_free(emu_t *m)
+{
+    free(m->sdram);
+    m->sdram = NULL;
+}
+
+static uint8_t *
+sdram_byte(emu_t *m, uint32_t addr)
+{
+    return m->sdram + (addr & SDRAM_MASK);
+}
+
+/* ---- Interrupt sources ---- */
+
+static int
+frame_irq_enabled(const emu_t *m)
+{
+    return !m->tb && !m->bdos;
+}
+
+static int
+uart_poll_enabled(const emu_t *m)
+{
+    return m->uart_in && !m->stdin_eof;
+}
+
+void
+bus_schedule(emu_t *m)
+{
+    uint64_t next = m->limit ? m->limit : UINT64_MAX;
+    int i;
+
+    for (i = 0; i < 3; i++)
+        if (m->timers[i].fire_at && m->timers[i].fire_at < next)
+            next = m->timers[i].fire_at;
+    if (frame_irq_enabled(m) && m->next_frame < next)
+        next = m->next_frame;
+    if (uart_poll_enabled(m) && m->next_uart_poll < next)
+        next = m->next_uart_poll;
+    m->deadline = next;
+}
+
+static void
+uart_poll(emu_t *m)
+{
+    struct pollfd p = { STDIN_FILENO, POLLIN, 0 };
+    unsigned char c;
+    ssize_t n;
+
+    fflush(stdout);
+    if (poll(&p, 1, 0) <= 0)
+        return;
+    n = read(STDIN_FILENO, &c, 1);
+    if (n <= 0)
+    {
+        m->stdin_eof = 1;
+        return;
+    }
+    m->uart_rx = c;
+    m->irq_pending |= 1u << IRQ_UART_RX;
+}
+
+void
+bus_service(emu_t *m)
+{
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        if (m->timers[i].fire_at && m->cycles >= m->timers[i].fire_at)
+        {
+            m->timers[i].fire_at = 0;
+            m->irq_pending |= 1u << (IRQ_TIMER1 + i);
+        }
+    }
+    if (frame_irq_enabled(m) && m->cycles >= m->next_frame)
+    {
+        m->next_frame += CYCLES_PER_FRAME;
+        m->irq_pending |= 1u << IRQ_FRAME;
+    }
+    if (uart_poll_enabled(m) && m->cycles >= m->next_uart_poll)
+    {
+        m->next_uart_poll = m->cycles + UART_POLL_CYCLES;
+        uart_poll(m);
+    }
+    bus_schedule(m);
+}
+
+/*
+ * Halt with -idle: skip the cycles until the next event that may raise an
+ * interrupt. Returns 0 when nothing can wake the CPU.
+ */
+int
+bus_wait_irq(emu_t *m)
+{
+    uint64_t next = UINT64_MAX;
+    int i;
+
+    if (m->int_disabled)
+        return 0;
+    for (i = 0; i < 3; i++)
+        if (m->timers[i].fire_at && m->timers[i].fire_at < next)
+            next = m->timers[i].fire_at;
+    if (frame_irq_enabled(m) && m->next_frame < next)
+        next = m->next_frame;
+    if (uart_poll_enabled(m))
+    {
+        /* Wait for input in real time instead of spinning */
+        struct pollfd p = { STDIN_FILENO, POLLIN, 0 };
+
+        fflush(stdout);
+        poll(&p, 1, 1);
+        if (m->next_uart_poll < next)
+            next = m->next_uart_poll;
+    }
+    if (next == UINT64_MAX)
+        return 0;
+    if (m->limit && next > m->limit)
+        next = m->limit;
+    if (next > m->cycles)
+        m->cycles = next;
+    return 1;
+}
+
+/* ---- DMA ---- */
+
+static void
+dma_copy(emu_t *m, uint32_t mode, uint32_t src, uint32_t dst, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        uint8_t b;
+
+        if (mode == DMA_MODE_SPI2MEM || mode == DMA_MODE_QSPI)
+            b = 0xFF;
+        else
+            b = *sdram_byte(m, src + i);
+
+        if (mode == DMA_MODE_MEM2MEM || mode == DMA_MODE_SPI2MEM ||
+            mode == DMA_MODE_QSPI)
+            *sdram_byte(m, dst + i) = b;
+        else if (mode == DMA_MODE_MEM2VRAM)
+            m->vrampx[(dst + i) & (VRAMPX_BYTES - 1)] = b;
+    }
+}
+
+/* ST_DISPATCH checks for one segment (a transfer, descriptor or 2D row) */
+static int
+dma_segment_ok(const emu_dma_t *d, uint32_t mode, uint32_t spi_id)
+{
+    int spi_ok = spi_id == 0 || spi_id == 1 || spi_id == 4 || spi_id == 5;
+
+    if (d->count == 0)
+        return 0;
+    switch (mode)
+    {
+    case DMA_MODE_MEM2MEM:
+        return 1;
+    case DMA_MODE_MEM2SPI:
+    case DMA_MODE_SPI2MEM:
+        return spi_ok;
+    case DMA_MODE_QSPI:
+        return spi_id == 1;
+    case DMA_MODE_MEM2VRAM:
+        return d->dst >= VRAMPX_BASE &&
+               (uint64_t)d->dst + d->count <= VRAMPX_BASE + VRAMPX_BYTES;
+    default:
+        return 0;
+    }
+}
+
+/* One transfer or descriptor; rows > 1 for 2D. Returns 0 on error. */
+static int
+dma_run_segments(emu_t *m, uint32_t mode, uint32_t spi_id, uint32_t rows,
+                 uint32_t strides)
+{
+    emu_dma_t *d = &m->dma;
+
+    for (;;)
+    {
+        if (!dma_segment_ok(d, mode, spi_id))
+            return 0;
+        dma_copy(m, mode, d->src, d->dst, d->count);
+        if (--rows == 0)
+            return 1;
+        d->src += strides & 0xFFFF;
+        d->dst += strides >> 16;
+    }
+}
+
+static void
+dma_start(emu_t *m)
+{
+    emu_dma_t *d = &m->dma;
+    int ok;
+
+    d->ctrl &= ~DMA_CTRL_START;
+    d->done = d->error = d->desc_irq = 0;
+
+    if (!(d->ctrl & DMA_CTRL_CHAIN))
+        ok = dma_run_segments(m, d->ctrl & 15, (d->ctrl >> 5) & 7, 1, 0);
+    else
+    {
+        uint32_t desc = d->desc;
+
+        ok = 1;
+        for (;;)
+        {
+            uint32_t w[8], ctrl, rows;
+            int i;
+
+            d->desc_cur = desc;
+            if (desc & 31)
+            {
+                ok = 0;
+                break;
+            }
+            for (i = 0; i < 8; i++)
+                w[i] = sdram_word(m, desc + i * 4);
+            d->src = w[0];
+            d->dst = w[1];
+            d->count = w[2];
+            d->qspi_addr = w[5];
+            ctrl = w[3];
+            rows = 1;
+            if (ctrl & DMA_DESC_2D)
+            {
+                rows = w[6] & 0xFFFF;
+                if (rows == 0 || ((ctrl & 15) != DMA_MODE_MEM2MEM &&
+                                  (ctrl & 15) != DMA_MODE_MEM2VRAM))
+                {
+                    ok = 0;
+                    break;
+                }
+            }
+            if (!dma_run_segments(m, ctrl & 15, (ctrl >> 5) & 7, rows, w[7]))
+            {
+                ok = 0;
+                break;
+            }
+            if (ctrl & DMA_DESC_IRQ)
+            {
+                d->desc_irq = 1;
+                m->irq_pending |= 1u << IRQ_DMA;
+            }
+            if (w[4] == 0)
+                break;
+            desc = w[4];
+        }
+    }
+
+    if (ok)
+        d->done = 1;
+    else
+        d->error = 1;
+    if (d->ctrl & DMA_CTRL_IRQ_EN)
+        m->irq_pending |= 1u << IRQ_DMA;
+}
+
+static uint32_t
+dma_reg_read(emu_t *m, uint32_t reg)
+{
+    emu_dma_t *d = &m->dma;
+    uint32_t v;
+
+    switch (reg)
+    {
+    case 0: return d->src;
+    case 1: return d->dst;
+    case 2: return d->count;
+    case 3: return d->ctrl;
+    case 4:
+        v = (d->desc_irq << 3) | (d->error << 2) | (d->done << 1);
+        d->done = d->error = d->desc_irq = 0;
+        return v;
+    case 5: return d->qspi_addr;
+    case 6: return d->desc;
+    default: return d->desc_cur;
+    }
+}
+
+static void
+dma_reg_write(emu_t *m, uint32_t reg, uint32_t data)
+{
+    emu_dma_t *d = &m->dma;
+
+    switch (reg)
+    {
+    case 0: d->src = data; break;
+    case 1: d->dst = data; break;
+    case 2: d->count = data; break;
+    case 3:
+        d->ctrl = data;
+        if (data & DMA_CTRL_START)
+            dma_start(m);
+        break;
+    case 5: d->qspi_addr = data; break;
+    case 6: d->desc = data; break;
+    default: break;
+    }
+}
+
+/* ---- MemoryUnit I/O registers ---- */
+
+static uint32_t
+io_access(emu_t *m, uint32_t addr, int we, uint32_t data)
+{
+    uint32_t off = addr - IO_BASE;
+    int i;
+
+    if (off == IO_UART_TX)
+    {
+        if (!we)
+            return 0;
+        if (m->tb)
+            printf("%llu UART TX: %02x\n",
+                   (unsigned long long)m->cycles * 10000, data & 0xFF);
+        else
+        {
+            putchar(data & 0xFF);
+            if ((data & 0xFF) == '\n')
+                fflush(stdout);
+        }
+        return 0;
+    }
+    if (off == IO_UART_RX)
+        return m->uart_rx;
+    if (off >= IO_TIMER1_VALUE && off <= IO_TIMER3_START && !(off & 3))
+    {
+        emu_timer_t *t = &m->timers[(off - IO_TIMER1_VALUE) / 8];
+
+        if ((off & 4) == 0)
+            t->value = data;
+        else
+        {
+            t->fire_at = m->cycles + (uint64_t)t->value * CYCLES_PER_MS;
+            bus_schedule(m);
+        }
+        return 0;
+    }
+    if (off >= IO_SPI0_DATA && off <= IO_SPI5_CS && !(off & 3))
+    {
+        int reg = spi_reg[(off - IO_SPI0_DATA) / 4];
+        int port = reg / 3;
+
+        switch (reg % 3)
+        {
+        case 0:
+            return 0xFF;
+        case 1:
+            if (we)
+                m->spi_cs[port] = data & 1;
+            return m->spi_cs[port];
+        default:
+            return 1;
+        }
+    }
+    if (off == IO_GPIO_MODE || off == IO_GPIO_STATE || off == IO_LED_USER)
+        return 0;
+    if (off == IO_BOOT_MODE)
+        return m->boot_mode & 1;
+    if (off == IO_MICROS)
+        return (uint32_t)(m->cycles / (CLOCK_HZ / 1000000));
+    if (off >= IO_DMA_SRC && off <= IO_DMA_DESC_CUR && !(off & 3))
+    {
+        i = (off - IO_DMA_SRC) / 4;
+        if (we)
+        {
+            dma_reg_write(m, i, data);
+            return 0;
+        }
+        return dma_reg_read(m, i);
+    }
+    return 0;
+}
+
+/* ---- CPU side ---- */
+
+uint32_t
+bus_fetch(emu_t *m, uint32_t addr)
+{
+    if (addr >= ROM_BASE && addr < VRAM32_BASE)
+        return m->rom[(addr >> 2) & (ROM_WORDS - 1)];
+    if (!m->fault)
+    {
+        m->fault = "instruction fetch outside SDRAM and ROM";
+        m->fault_pc = addr;
+    }
+    return 0xFFFFFFFF; /* halt */
+}
+
+static uint32_t
+read_word(emu_t *m, uint32_t addr)
+{
+    if (addr < IO_BASE)
+        return sdram_word(m, addr);
+    if (addr < ROM_BASE)
+        return io_access(m, addr, 0, 0);
+    if (addr < VRAM32_BASE)
+        return m->rom[((addr - ROM_BASE) >> 2) & (ROM_WORDS - 1)];
+    if (addr < VRAM8_BASE)
+        return m->vram32[((addr - VRAM32_BASE) >> 2) & (VRAM32_WORDS - 1)];
+    if (addr < VRAMPX_BASE)
+        return m->vram8[((addr - VRAM8_BASE) >> 2) & (VRAM8_BYTES - 1)];
+    if (addr < VRAMPX_BASE + VRAMPX_BYTES)
+        return m->vrampx[addr - VRAMPX_BASE];
+    if (addr >= PALETTE_BASE && addr < PALETTE_BASE + PALETTE_WORDS * 4)
+        return 0;
+    if (addr == CPU_IO_PC_BACKUP)
+        return m->pc_backup;
+    if (addr == CPU_IO_HW_STACK_PTR)
+        return m->cpu.hw_sp;
+    return 0xDEADBEEF;
+}
+
+uint32_t
+bus_read(emu_t *m, uint32_t addr, int size, int sign_extend)
+{
+    uint32_t w = read_word(m, addr);
+
+    if (size == 1)
+    {
+        w = (w >> ((addr & 3) * 8)) & 0xFF;
+        return sign_extend ? (uint32_t)(int32_t)(int8_t)w : w;
+    }
+    if (size == 2)
+    {
+        w = (addr & 2) ? w >> 16 : w & 0xFFFF;
+        return sign_extend ? (uint32_t)(int32_t)(int16_t)w : w;
+    }
+    return w;
+}
+
+void
+bus_write(emu_t *m, uint32_t addr, uint32_t data, int size)
+{
+    if (addr < IO_BASE)
+    {
+        if (size == 1)
+            *sdram_byte(m, addr) = data;
+        else if (size == 2)
+        {
+            uint8_t *p = sdram_byte(m, addr & ~1u);
+
+            p[0] = data;
+            p[1] = data >> 8;
+        }
+        else
+            sdram_set_word(m, addr, data);
+    }
+    else if (addr < ROM_BASE)
+        io_access(m, addr, 1, data);
+    else if (addr < VRAM32_BASE)
+        ; /* ROM */
+    else if (addr < VRAM8_BASE)
+        m->vram32[((addr - VRAM32_BASE) >> 2) & (VRAM32_WORDS - 1)] = data;
+    else if (addr < VRAMPX_BASE)
+        m->vram8[((addr - VRAM8_BASE) >> 2) & (VRAM8_BYTES - 1)] = data;
+    else if (addr < VRAMPX_BASE + VRAMPX_BYTES)
+        m->vrampx[addr - VRAMPX_BASE] = data;
+    else if (addr >= PALETTE_BASE && addr < PALETTE_BASE + PALETTE_WORDS * 4)
+        m->palette[(addr - PALETTE_BASE) >> 2] = data & 0xFFFFFF;
+    else if (addr == CPU_IO_PC_BACKUP)
+        m->pc_backup = data;
+    else if (addr == CPU_IO_HW_STACK_PTR)
+        m->cpu.hw_sp = data & (HW_STACK_WORDS - 1);
+}
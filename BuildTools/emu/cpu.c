@@ -0,0 +1,364 @@
+/*
+ * cpu.c — B32P3 instruction execution.
+ *
+ * Decoding follows InstructionDecoder.v and ControlUnit.v, the ALU
+ * follows ALU.v and the multi-cycle operations follow MultiCycleALU.v and
+ * its IDivider/FPDivider, bit for bit (including divide by zero). As in
+ * B32P3.v, interrupts are only taken on a taken jump, branch or halt
+ * outside ROM: the jump is dropped, pc_backup gets its address and the
+ * CPU continues at INT_VECTOR with interrupts disabled until RETI.
+ */
+
+#include "emu.h"
+
+#include <stdio.h>
+
+static uint32_t
+alu(unsigned op, uint32_t a, uint32_t b)
+{
+    switch (op)
+    {
+    case 0x0: return a | b;
+    case 0x1: return a & b;
+    case 0x2: return a ^ b;
+    case 0x3: return a + b;
+    case 0x4: return a - b;
+    case 0x5: return a << (b & 31);
+    case 0x6: return a >> (b & 31);
+    case 0x7: return ~a;
+    case 0xA: return (int32_t)a < (int32_t)b;
+    case 0xB: return a < b;
+    case 0xC: return b;
+    case 0xD: return (b << 16) | (a & 0xFFFF);
+    case 0xE: return (uint32_t)((int32_t)a >> (b & 31));
+    default:  return 0;
+    }
+}
+
+/* FPDivider.v: Q16.16 restoring division on 31-bit magnitudes */
+static uint32_t
+fpdiv(uint32_t a, uint32_t b)
+{
+    uint32_t a_abs, b_abs, acc, q, trial;
+    int i;
+
+    if (b == 0)
+        return 0xFFFFFFFF;
+
+    a_abs = ((a >> 31) ? -a : a) & 0x7FFFFFFF;
+    b_abs = ((b >> 31) ? -b : b) & 0x7FFFFFFF;
+    acc = a_abs >> 30;
+    q = (a_abs << 1) & 0x7FFFFFFF;
+    for (i = 0; i < 31 + 16; i++)
+    {
+        trial = acc - b_abs;
+        if (!(trial & 0x80000000))
+            acc = (trial << 1) | (q >> 30);
+        else
+            acc = (acc << 1) | (q >> 30);
+        acc &= 0xFFFFFFFF;
+        q = ((q << 1) | !(trial & 0x80000000)) & 0x7FFFFFFF;
+    }
+    if (q != 0 && ((a ^ b) >> 31))
+        return 0x80000000 | (-q & 0x7FFFFFFF);
+    return q;
+}
+
+/* IDivider.v: restoring division on magnitudes */
+static uint32_t
+idiv(uint32_t a, uint32_t b, int is_signed, int want_remainder)
+{
+    int a_neg, b_neg;
+    uint32_t ua, ub, q, r;
+
+    if (b == 0)
+        return want_remainder ? a : 0xFFFFFFFF;
+
+    a_neg = is_signed && (a >> 31);
+    b_neg = is_signed && (b >> 31);
+    ua = a_neg ? -a : a;
+    ub = b_neg ? -b : b;
+    q = ua / ub;
+    r = ua % ub;
+    if (want_remainder)
+        return a_neg ? -r : r;
+    return (a_neg ^ b_neg) ? -q : q;
+}
+
+static uint32_t
+malu(unsigned op, uint32_t a, uint32_t b)
+{
+    switch (op)
+    {
+    case 0x0: /* MULTS */
+    case 0x1: /* MULTU */
+        return a * b;
+    case 0x2: /* MULTFP */
+        return (uint32_t)((uint64_t)((int64_t)(int32_t)a * (int32_t)b) >> 16);
+    case 0x3: return idiv(a, b, 1, 0);
+    case 0x4: return idiv(a, b, 0, 0);
+    case 0x5: return fpdiv(a, b);
+    case 0x6: return idiv(a, b, 1, 1);
+    case 0x7: return idiv(a, b, 0, 1);
+    case 0xE: /* MULSHI */
+        return (uint32_t)((uint64_t)((int64_t)(int32_t)a * (int32_t)b) >> 32);
+    case 0xF: /* MULTUHI */
+        return (uint32_t)(((uint64_t)a * b) >> 32);
+    default:
+        return 0;
+    }
+}
+
+__extension__ typedef __int128 int128_t;
+
+/* Mults64.v: signed 64x64 product, bits [95:32] */
+static uint64_t
+fmul(uint64_t a, uint64_t b)
+{
+    int128_t p = (int128_t)(int64_t)a * (int64_t)b;
+    return (uint64_t)(p >> 32);
+}
+
+static int
+branch_passed(unsigned op, int sig, uint32_t a, uint32_t b)
+{
+    int32_t sa = (int32_t)a, sb = (int32_t)b;
+
+    switch (op)
+    {
+    case 0: return a == b;
+    case 1: return sig ? sa > sb : a > b;
+    case 2: return sig ? sa >= sb : a >= b;
+    case 4: return a != b;
+    case 5: return sig ? sa < sb : a < b;
+    case 6: return sig ? sa <= sb : a <= b;
+    default: return 0;
+    }
+}
+
+void
+emu_trace_reg(emu_t *m, int reg, uint32_t value)
+{
+    (void)m;
+    printf("reg r%02d: %u\n", reg, value);
+}
+
+/*
+ * Slow path of a taken jump: device service, the cycle limit and
+ * interrupts. Returns a STOP_ reason, or -1 to carry on at *target.
+ */
+static int
+jump_slow(emu_t *m, uint32_t pc, uint32_t *target)
+{
+    int id;
+
+    if (m->cycles >= m->deadline)
+    {
+        if (m->limit && m->cycles >= m->limit)
+            return STOP_LIMIT;
+        bus_service(m);
+    }
+    if (m->irq_pending && !m->int_disabled && pc < ROM_BASE)
+    {
+        for (id = 0; !(m->irq_pending & (1u << id)); id++)
+            ;
+        m->irq_pending &= ~(1u << id);
+        m->int_id = id + 1;
+        m->int_disabled = 1;
+        m->pc_backup = pc;
+        *target = INT_VECTOR;
+    }
+    return -1;
+}
+
+#define SET_REG(d, v)                           \
+    do                                          \
+    {                                           \
+        uint32_t v_ = (v);                      \
+        if (d)                                  \
+        {                                       \
+            c->r[d] = v_;                       \
+            if (m->trace)                       \
+                emu_trace_reg(m, d, v_);        \
+        }                                       \
+    } while (0)
+
+int
+emu_run(emu_t *m)
+{
+    cpu_t *c = &m->cpu;
+    uint32_t pc = c->pc;
+
+    for (;;)
+    {
+        uint32_t ins, a, b, t, addr;
+        unsigned op, d;
+        int stop;
+
+        m->cycles++;
+        ins = pc < IO_BASE ? sdram_word(m, pc) : bus_fetch(m, pc);
+        if (m->timing)
+            timing_instr(m, pc, ins);
+        op = (ins >> 24) & 15;
+        d = ins & 15;
+
+        switch (ins >> 28)
+        {
+        case OP_ARITH:
+            SET_REG(d, alu(op, c->r[(ins >> 8) & 15], c->r[(ins >> 4) & 15]));
+            break;
+
+        case OP_ARITHC:
+            b = (op & 0xE) == 0xC ? (ins >> 8) & 0xFFFF : SEXT16(ins >> 8);
+            SET_REG(d, alu(op, c->r[(ins >> 4) & 15], b));
+            break;
+
+        case OP_ARITHM:
+        case OP_ARITHMC:
+            if ((ins >> 28) == OP_ARITHM)
+            {
+                a = (ins >> 8) & 15;
+                b = (ins >> 4) & 15;
+                t = c->r[b];
+            }
+            else
+            {
+                a = (ins >> 4) & 15;
+                b = 0;
+                t = (op & 0xE) == 0xC ? (ins >> 8) & 0xFFFF : SEXT16(ins >> 8);
+            }
+            switch (op)
+            {
+            case MALU_FMUL:
+                c->f[d & 7] = fmul(c->f[a & 7], c->f[b & 7]);
+                break;
+            case MALU_FADD:
+                c->f[d & 7] = c->f[a & 7] + c->f[b & 7];
+                break;
+            case MALU_FSUB:
+                c->f[d & 7] = c->f[a & 7] - c->f[b & 7];
+                break;
+            case MALU_FLD:
+                c->f[d & 7] = ((uint64_t)c->r[a] << 32) | t;
+                break;
+            case MALU_FSTHI:
+                SET_REG(d, (uint32_t)(c->f[a & 7] >> 32));
+                break;
+            case MALU_FSTLO:
+                SET_REG(d, (uint32_t)c->f[a & 7]);
+                break;
+            default:
+                SET_REG(d, malu(op, c->r[a], t));
+                break;
+            }
+            break;
+
+        case OP_RETI:
+            m->int_disabled = 0;
+            if (m->timing)
+                timing_jump(m, pc, m->pc_backup, 1);
+            pc = m->pc_backup;
+            continue;
+
+        case OP_SAVPC:
+            SET_REG(d, pc);
+            break;
+
+        case OP_BRANCH:
+            if (!branch_passed((ins >> 1) & 7, ins & 1,
+                               c->r[(ins >> 8) & 15], c->r[(ins >> 4) & 15]))
+                break;
+            t = pc + SEXT16(ins >> 12);
+            goto taken;
+
+        case OP_CCACHE:
+            break;
+
+        case OP_JUMPR:
+            t = c->r[(ins >> 4) & 15] + SEXT16(ins >> 12);
+            if (ins & 1)
+                t += pc;
+            goto taken;
+
+        case OP_JUMP:
+            t = (ins >> 1) & 0x7FFFFFF;
+            if (ins & 1)
+                t = pc + (uint32_t)((int32_t)(t << 5) >> 5);
+            goto taken;
+
+        case OP_POP:
+            c->hw_sp = (c->hw_sp - 1) & (HW_STACK_WORDS - 1);
+            SET_REG(d, c->hw_stack[c->hw_sp]);
+            break;
+
+        case OP_PUSH:
+            c->hw_stack[c->hw_sp] = c->r[(ins >> 4) & 15];
+            c->hw_sp = (c->hw_sp + 1) & (HW_STACK_WORDS - 1);
+            break;
+
+        case OP_INTID:
+            SET_REG(d, m->int_id);
+            break;
+
+        case OP_WRITE:
+            addr = c->r[(ins >> 8) & 15] + SEXT16(ins >> 12);
+            t = c->r[(ins >> 4) & 15];
+            if (addr < IO_BASE && (ins & 3) != 1 && (ins & 3) != 2)
+                sdram_set_word(m, addr, t);
+            else
+                bus_write(m, addr, t, ins & 3);
+            break;
+
+        case OP_READ:
+            addr = c->r[(ins >> 8) & 15] + SEXT16(ins >> 12);
+            if (addr < IO_BASE && !(ins & 0x30))
+                t = sdram_word(m, addr);
+            else
+                t = bus_read(m, addr, (ins >> 4) & 3, !(ins & 0x40));
+            SET_REG(d, t);
+            break;
+
+        case OP_HALT:
+            t = pc;
+            goto taken;
+        }
+        pc += 4;
+        continue;
+
+    taken:
+        if (m->cycles >= m->deadline || (m->irq_pending && !m->int_disabled))
+        {
+            stop = jump_slow(m, pc, &t);
+            if (stop >= 0)
+            {
+                m->cycles--;
+                c->pc = pc;
+                return stop;
+            }
+        }
+        if (t == pc && (ins >> 28) == OP_HALT)
+        {
+            if (m->fault)
+            {
+                c->pc = pc;
+                return STOP_FAULT;
+            }
+            if (m->idle && bus_wait_irq(m))
+                continue;
+            c->pc = pc;
+            return STOP_HALT;
+        }
+        if (t == BDOS_SYSCALL_ADDR && m->bdos)
+        {
+            t = bdos_syscall(m, pc);
+            if (m->fault || m->exited)
+            {
+                c->pc = t;
+                return m->fault ? STOP_FAULT : STOP_EXIT;
+            }
+        }
+        if (m->timing)
+            timing_jump(m, pc, t, 0);
+        pc = t;
+    }
+}
@@ -0,0 +1,208 @@
+/*
+ * emu.h — Functional B32P3 emulator.
+ *
+ * Runs FPGC memory images on the host: bare-metal programs and kernel
+ * images (loaded at address 0, as the jump-to-RAM bootloader does), ROM
+ * images, and userBDOS programs through a host BDOS syscall layer
+ * (bdos.c). Every instruction does what the Verilog CPU commits for it
+ * (Hardware/FPGA/Verilog/Modules/CPU), so a program's register writes
+ * and UART output match the cpu_tests_tb.v testbench. One instruction is
+ * one cycle of the 100 MHz clock, unless -timing adds the stalls of the
+ * pipeline, caches and SDRAM (timing.c).
+ */
+
+#ifndef EMU_H
+#define EMU_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "b32p3emu keeps memory in host byte order and needs a little-endian host"
+#endif
+
+/* ---- Memory map (Docs/docs/Hardware/Memory-Map.md) ---- */
+#define SDRAM_SIZE      0x4000000u      /* 64 MiB, mirrored up to IO_BASE */
+#define SDRAM_MASK      (SDRAM_SIZE - 1)
+#define IO_BASE         0x1C000000u
+#define ROM_BASE        0x1E000000u
+#define ROM_WORDS       1024
+#define VRAM32_BASE     0x1E400000u
+#define VRAM32_WORDS    2048
+#define VRAM8_BASE      0x1E800000u
+#define VRAM8_BYTES     16384
+#define VRAMPX_BASE     0x1EC00000u
+#define VRAMPX_BYTES    0x20000
+#define PALETTE_BASE    0x1EC80000u
+#define PALETTE_WORDS   256
+#define CPU_IO_PC_BACKUP    0x1F000000u
+#define CPU_IO_HW_STACK_PTR 0x1F000004u
+
+#define INT_VECTOR      4               /* interrupt entry (jump Int) */
+#define CLOCK_HZ        100000000u
+#define HW_STACK_WORDS  64
+
+/* Interrupt lines, bit i = interrupt id i + 1 (lower id wins) */
+#define IRQ_UART_RX     0
+#define IRQ_TIMER1      1
+#define IRQ_TIMER2      2
+#define IRQ_TIMER3      3
+#define IRQ_FRAME       4
+#define IRQ_ETH         5
+#define IRQ_DMA         6
+
+/* Reasons run() returns */
+#define STOP_HALT       0
+#define STOP_LIMIT      1
+#define STOP_EXIT       2               /* BDOS: last process exited */
+#define STOP_FAULT      3
+
+/* ---- Instruction set (InstructionDecoder.v) ---- */
+/* Instruction opcodes (instr[31:28]) */
+#define OP_ARITH   0x0
+#define OP_ARITHC  0x1
+#define OP_ARITHM  0x2
+#define OP_ARITHMC 0x3
+#define OP_RETI    0x4
+#define OP_SAVPC   0x5
+#define OP_BRANCH  0x6
+#define OP_CCACHE  0x7
+#define OP_JUMPR   0x8
+#define OP_JUMP    0x9
+#define OP_POP     0xA
+#define OP_PUSH    0xB
+#define OP_INTID   0xC
+#define OP_WRITE   0xD
+#define OP_READ    0xE
+#define OP_HALT    0xF
+
+/* Multi-cycle ALU opcodes (instr[27:24]) of the FP64 coprocessor */
+#define MALU_FMUL  0x8
+#define MALU_FADD  0x9
+#define MALU_FSUB  0xA
+#define MALU_FLD   0xB
+#define MALU_FSTHI 0xC
+#define MALU_FSTLO 0xD
+
+#define SEXT16(x) ((uint32_t)(int32_t)(int16_t)(uint16_t)(x))
+
+struct bdos;
+struct timing;
+
+typedef struct
+{
+    uint32_t r[16];
+    uint32_t pc;
+    uint64_t f[8];                      /* FP64 coprocessor registers */
+    uint32_t hw_stack[HW_STACK_WORDS];
+    uint32_t hw_sp;
+} cpu_t;
+
+typedef struct
+{
+    uint32_t value;
+    uint64_t fire_at;                   /* cycle of the interrupt, 0 = idle */
+} emu_timer_t;
+
+typedef struct
+{
+    uint32_t src, dst, count, ctrl, qspi_addr, desc, desc_cur;
+    int done, error, desc_irq;          /* sticky STATUS bits */
+} emu_dma_t;
+
+typedef struct
+{
+    cpu_t cpu;
+
+    uint8_t *sdram;
+    uint32_t rom[ROM_WORDS];
+    uint32_t vram32[VRAM32_WORDS];
+    uint8_t vram8[VRAM8_BYTES];
+    uint8_t vrampx[VRAMPX_BYTES];
+    uint32_t palette[PALETTE_WORDS];
+
+    /* Interrupt controller and CPU interrupt state */
+    uint32_t irq_pending;               /* edges not yet taken */
+    uint32_t int_id;
+    int int_disabled;
+    uint32_t pc_backup;
+
+    /* Peripherals */
+    emu_timer_t timers[3];
+    emu_dma_t dma;
+    uint32_t uart_rx;
+    uint32_t spi_cs[6];
+    uint32_t boot_mode;
+    uint64_t next_frame;
+    uint64_t next_uart_poll;
+
+    /* Time: one cycle per instruction, plus stalls with -timing */
+    uint64_t cycles;
+    uint64_t deadline;                  /* next cycle that needs service() */
+    uint64_t limit;                     /* stop here, 0 = no limit */
+
+    /* Options */
+    int tb;                             /* testbench: no interrupt sources,
+                                           UART TX as "UART TX: xx" lines */
+    int trace;                          /* print register writes */
+    int idle;                           /* halt waits for interrupts */
+    int uart_in;                        /* stdin feeds UART RX */
+    int stdin_eof;
+
+    struct timing *timing;              /* cycle-approximate model when set */
+    struct bdos *bdos;                  /* userBDOS mode when set */
+    int exited;                         /* BDOS: no process left to run */
+    const char *fault;
+    uint32_t fault_pc;
+} emu_t;
+
+/* ---- cpu.c ---- */
+int emu_run(emu_t *m);
+void emu_trace_reg(emu_t *m, int reg, uint32_t value);
+
+/* ---- bus.c ---- */
+int emu_init(emu_t *m);
+void emu_free(emu_t *m);
+uint32_t bus_fetch(emu_t *m, uint32_t addr);
+uint32_t bus_read(emu_t *m, uint32_t addr, int size, int sign_extend);
+void bus_write(emu_t *m, uint32_t addr, uint32_t data, int size);
+void bus_service(emu_t *m);
+void bus_schedule(emu_t *m);
+int bus_wait_irq(emu_t *m);
+
+static inline uint32_t
+sdram_word(const emu_t *m, uint32_t addr)
+{
+    return *(const uint32_t *)(m->sdram + (addr & SDRAM_MASK & ~3u));
+}
+
+static inline void
+sdram_set_word(emu_t *m, uint32_t addr, uint32_t value)
+{
+    *(uint32_t *)(m->sdram + (addr & SDRAM_MASK & ~3u)) = value;
+}
+
+/* ---- timing.c ---- */
+int timing_init(emu_t *m);
+void timing_free(emu_t *m);
+int timing_load_symbols(emu_t *m, const char *path, uint32_t base,
+                        uint32_t end);
+void timing_instr(emu_t *m, uint32_t pc, uint32_t ins);
+void timing_jump(emu_t *m, uint32_t pc, uint32_t target, int reti);
+void timing_finish(emu_t *m);
+uint64_t timing_instructions(const emu_t *m);
+void timing_tb_stalls(emu_t *m);
+void timing_report(emu_t *m, FILE *f);
+void timing_profile(emu_t *m, FILE *f);
+
+/* ---- bdos.c ---- */
+int bdos_init(emu_t *m, const char *root, int realtime);
+int bdos_start(emu_t *m, const char *image, int argc, char **argv);
+uint32_t bdos_syscall(emu_t *m, uint32_t pc);
+int bdos_exit_code(emu_t *m);
+void bdos_free(emu_t *m);
+
+/* userBDOS programs enter the kernel by jumping here (ASMPY -s vector) */
+#define BDOS_SYSCALL_ADDR 12u
+
+#endif /* EMU_H */
@@ -0,0 +1,265 @@
+/*
+ * main.c — b32p3emu command line.
+ *
+ * Usage: b32p3emu [options] [image [args...]]
+ *
+ *   image           memory image: .list (one 32-character binary word per
+ *                   line, as written by ASMPY) or raw little-endian words
+ *   -rom FILE       load FILE into ROM and start at 0x1E000000 (the image,
+ *                   if any, is still loaded at address 0)
+ *   -bdos           run image as a userBDOS program on the host BDOS
+ *                   syscall layer; args become its argv[1..]
+ *   -root DIR       BRFS root for -bdos (default .)
+ *   -realtime       -bdos: sys_sleep() waits on the host as well
+ *   -tb             testbench output: no interrupt sources and UART TX
+ *                   bytes as "<time> UART TX: xx" lines, as cpu_tests_tb.v
+ *   -trace          print every register write as "reg rNN: value"
+ *   -limit N        stop after N cycles (exit status 2)
+ *   -idle           a halt waits for the next interrupt instead of ending
+ *                   the run (kernel images)
+ *   -uart-in        feed stdin to UART RX
+ *   -boot-mode N    value of the boot mode register
+ *   -stats          print cycles and emulation speed to stderr
+ *   -timing         add the pipeline, cache and SDRAM stalls of the B32P3
+ *                   to the cycle count (timing.c); with -tb, also print
+ *                   the testbench's "Stalls:" line
+ *   -sym FILE       symbols for -profile, "address name" lines as written
+ *                   by asmpy --symbols (addresses relative to the image)
+ *   -profile        -timing, and print cycles, CPI, cache misses and stalls
+ *                   per function to stderr
+ *
+ * Exit status: 0 at halt, the program's exit code with -bdos, 1 on a
+ * fault or bad usage, 2 when -limit was reached.
+ */
+
+#include "emu.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+static void
+usage(void)
+{
+    fprintf(stderr,
+            "usage: b32p3emu [-rom file] [-bdos] [-root dir] [-realtime] [-tb]\n"
+            "                [-trace] [-limit cycles] [-idle] [-uart-in]\n"
+            "                [-boot-mode n] [-stats] [-timing] [-sym file]\n"
+            "                [-profile] [image [args...]]\n");
+    exit(1);
+}
+
+static int
+has_suffix(const char *s, const char *suffix)
+{
+    size_t n = strlen(s), k = strlen(suffix);
+
+    return n >= k && !strcmp(s + n - k, suffix);
+}
+
+/*
+ * Read an image into words[0..max). Returns the number of words, or -1.
+ */
+static long
+load_image(const char *path, uint32_t *words, long max)
+{
+    FILE *f = fopen(path, "rb");
+    long n = 0;
+
+    if (!f)
+    {
+        perror(path);
+        return -1;
+    }
+    if (has_suffix(path, ".list"))
+    {
+        char line[256];
+
+        while (fgets(line, sizeof(line), f))
+        {
+            uint32_t w = 0;
+            int i;
+
+            if (line[0] != '0' && line[0] != '1')
+                continue;
+            for (i = 0; i < 32 && (line[i] == '0' || line[i] == '1'); i++)
+                w = (w << 1) | (line[i] - '0');
+            if (i != 32 || n == max)
+            {
+                fprintf(stderr, "%s: bad line %ld\n", path, n + 1);
+                fclose(f);
+                return -1;
+            }
+            words[n++] = w;
+        }
+    }
+    else
+    {
+        uint8_t b[4];
+        size_t got;
+
+        while ((got = fread(b, 1, 4, f)) > 0)
+        {
+            if (n == max)
+            {
+                fprintf(stderr, "%s: image too large\n", path);
+                fclose(f);
+                return -1;
+            }
+            if (got < 4)
+                memset(b + got, 0, 4 - got);
+            words[n++] = b[0] | b[1] << 8 | b[2] << 16 | (uint32_t)b[3] << 24;
+        }
+    }
+    fclose(f);
+    return n;
+}
+
+static double
+now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int
+main(int argc, char **argv)
+{
+    static emu_t m;
+    const char *rom = NULL, *root = ".", *image = NULL, *sym = NULL;
+    int bdos = 0, realtime = 0, stats = 0, timing = 0, profile = 0;
+    int stop, status, i;
+    long words = 0;
+    uint32_t base = 0;
+    struct stat st;
+    double start;
+
+    if (emu_init(&m) < 0)
+    {
+        fprintf(stderr, "b32p3emu: out of memory\n");
+        return 1;
+    }
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++)
+    {
+        if (!strcmp(argv[i], "-rom") && i + 1 < argc)
+            rom = argv[++i];
+        else if (!strcmp(argv[i], "-bdos"))
+            bdos = 1;
+        else if (!strcmp(argv[i], "-root") && i + 1 < argc)
+            root = argv[++i];
+        else if (!strcmp(argv[i], "-realtime"))
+            realtime = 1;
+        else if (!strcmp(argv[i], "-tb"))
+            m.tb = 1;
+        else if (!strcmp(argv[i], "-trace"))
+            m.trace = 1;
+        else if (!strcmp(argv[i], "-limit") && i + 1 < argc)
+            m.limit = strtoull(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "-idle"))
+            m.idle = 1;
+        else if (!strcmp(argv[i], "-uart-in"))
+            m.uart_in = 1;
+        else if (!strcmp(argv[i], "-boot-mode") && i + 1 < argc)
+            m.boot_mode = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "-stats"))
+            stats = 1;
+        else if (!strcmp(argv[i], "-timing"))
+            timing = 1;
+        else if (!strcmp(argv[i], "-sym") && i + 1 < argc)
+            sym = argv[++i];
+        else if (!strcmp(argv[i], "-profile"))
+            timing = profile = 1;
+        else
+            usage();
+    }
+    if (i < argc)
+        image = argv[i++];
+    if (!image && (!rom || bdos))
+        usage();
+    if (timing && timing_init(&m) < 0)
+    {
+        fprintf(stderr, "b32p3emu: out of memory\n");
+        return 1;
+    }
+
+    if (rom && (words = load_image(rom, m.rom, ROM_WORDS)) < 0)
+        return 1;
+    if (rom)
+        base = ROM_BASE;
+    if (bdos)
+    {
+        if (bdos_init(&m, root, realtime) < 0 ||
+            bdos_start(&m, image, argc - i + 1, argv + i - 1) < 0)
+        {
+            fprintf(stderr, "b32p3emu: cannot start %s\n", image);
+            return 1;
+        }
+        base = m.cpu.pc;
+        if (stat(image, &st) == 0)
+            words = (long)(st.st_size + 3) / 4;
+    }
+    else if (image)
+    {
+        if ((words = load_image(image, (uint32_t *)m.sdram,
+                                SDRAM_SIZE / 4)) < 0)
+            return 1;
+        m.cpu.pc = rom ? ROM_BASE : 0;
+        base = 0;
+    }
+    if (sym && m.timing &&
+        timing_load_symbols(&m, sym, base, base + (uint32_t)words * 4) < 0)
+        return 1;
+    bus_schedule(&m);
+
+    start = now();
+    stop = emu_run(&m);
+    if (m.timing)
+    {
+        timing_finish(&m);
+        if (m.tb)
+            timing_tb_stalls(&m);
+    }
+    fflush(stdout);
+
+    switch (stop)
+    {
+    case STOP_LIMIT:
+        status = 2;
+        break;
+    case STOP_FAULT:
+        fprintf(stderr, "b32p3emu: %s at 0x%08x (pc 0x%08x)\n", m.fault,
+                m.fault_pc, m.cpu.pc);
+        status = 1;
+        break;
+    case STOP_EXIT:
+        status = bdos_exit_code(&m) & 0xFF;
+        break;
+    default:
+        status = 0;
+        break;
+    }
+
+    if (stats)
+    {
+        double secs = now() - start;
+
+        fprintf(stderr, "cycles: %llu\nhost time: %.3f s\nspeed: %.1f MIPS\n",
+                (unsigned long long)m.cycles, secs,
+                secs > 0 ? (m.timing ? timing_instructions(&m) : m.cycles) /
+                               secs / 1e6
+                         : 0.0);
+        if (m.timing)
+            timing_report(&m, stderr);
+    }
+    if (profile)
+        timing_profile(&m, stderr);
+    timing_free(&m);
+    if (m.bdos)
+        bdos_free(&m);
+    emu_free(&m);
+    return status;
+}
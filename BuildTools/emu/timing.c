@@ -0,0 +1,751 @@
+/*
+ * timing.c — Cycle-approximate B32P3 timing model (-timing).
+ *
+ * cpu.c charges one cycle per instruction. With -timing it also calls
+ * timing_instr() before every instruction and timing_jump() for every
+ * taken jump, and this file adds the stall cycles the Verilog CPU spends
+ * on them. The costs are read off the RTL:
+ *
+ * - PipelineController.v: the load-use and pop-use bubble, and the
+ *   cache-line hazard between back-to-back memory accesses. The hazard
+ *   compares bits [11:5] of the address in EX with bits [9:3] of the one
+ *   in MEM, and the model does the same.
+ * - B32P3.v, MultiCycleALU.v and MultiCycleAluOps/: how long EX stalls
+ *   for multiplies, divides and the FP64 operations.
+ * - InstructionFetch.v: the taken-jump penalty, one cycle shorter when the
+ *   L1I line read in the first redirect cycle already holds the target.
+ * - MemoryStage.v and CacheControllerSDRAM.v: the L1D wait cycle, the
+ *   direct-mapped write-back L1I and L1D (128 lines of 32 bytes), the L1I
+ *   next-line prefetch and the time the controller is busy.
+ * - SDRAMcontroller.v: burst read and write latency and auto refresh.
+ * - MemoryUnit.v and UARTtx.v: I/O register access and UART transmit.
+ *
+ * Stalls are added per instruction. Stalls that overlap in the hardware,
+ * such as an L1I miss while the backend drains, are counted for both, and
+ * DMA transfers do not compete for SDRAM.
+ */
+
+#include "emu.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Pipeline (PipelineController.v, InstructionFetch.v) */
+#define PIPELINE_FILL   3       /* cycles before the first instruction is in MEM */
+#define JUMP_PENALTY    4       /* taken jump whose target line is read first */
+#define JUMP_NEW_LINE   5       /* ... and one that needs a second L1I read */
+
+/* Multi-cycle ALU, cycles EX stalls for (MultiCycleALU.v and its units) */
+#define MALU_MULT       6       /* Mults/Multu: 2-cycle multiplier */
+#define MALU_FMUL_STALL 8       /* Mults64: 4-stage multiplier */
+#define MALU_DIV        39      /* IDivider: 32 iterations */
+#define MALU_DIVFP      54      /* FPDivider: 47 iterations */
+#define MALU_DIV_ZERO   5       /* either divider, divisor 0 */
+#define MALU_FADDSUB    1       /* fp_addsub operand capture */
+
+/* Memory stage (MemoryStage.v, MemoryUnit.v) */
+#define L1D_WAIT        1       /* every SDRAM access: DPRAM read latency */
+#define IO_STALL        3       /* MemoryUnit register access */
+#define UART_TX_STALL   1005    /* MemoryUnit waits for UARTtx: 10 bits */
+#define UART_TX_ADDR    IO_BASE
+
+/* Caches (CacheControllerSDRAM.v) */
+#define LINES           128
+#define LINE_SHIFT      5
+#define TAG_VALID       0x80000000u
+
+/* SDRAMcontroller.v, in cycles from BANK_ACTIVE */
+#define SDRAM_READ      13      /* until done, when it is idle again */
+#define SDRAM_WRITE     10      /* until done */
+#define SDRAM_WRITE_BUSY 14     /* until idle */
+#define SDRAM_REFRESH   7
+#define SDRAM_REFRESH_PERIOD 784
+#define SDRAM_INIT      91      /* sdram_startup_cycles in simulation */
+
+enum
+{
+    ST_LOAD_USE,
+    ST_POP_USE,
+    ST_CACHE_LINE,
+    ST_JUMP,
+    ST_L1I,
+    ST_L1D,
+    ST_MALU,
+    ST_IO,
+    ST_CCACHE,
+    ST_KINDS
+};
+
+static const char *const stall_names[ST_KINDS] = {
+    "load-use", "pop-use", "cache-line", "jump", "l1i", "l1d", "malu", "io",
+    "ccache",
+};
+
+typedef struct
+{
+    uint64_t instrs, cycles;
+    uint64_t stall[ST_KINDS];
+    uint64_t l1i_misses, l1d_misses;
+} tstats_t;
+
+typedef struct
+{
+    uint32_t addr;
+    char *name;
+    tstats_t s;
+} symbol_t;
+
+/* An instruction ahead of the current one in the pipeline */
+typedef struct
+{
+    int valid;                          /* 0 for a bubble */
+    int load;                           /* read or pop: no EX/MEM forwarding */
+    int dreg;                           /* written register, 0 if none */
+    int sdram;                          /* SDRAM read or write */
+    uint32_t addr;                      /* its address */
+} slot_t;
+
+struct timing
+{
+    /* Tags: line address | TAG_VALID, indexed by addr[11:5] */
+    uint32_t l1i[LINES];
+    uint32_t l1d[LINES];
+    uint8_t dirty[LINES];
+    uint32_t fetch_line;                /* line IF last looked up */
+
+    /* Cache controller and SDRAM: cycle from which each is idle */
+    uint64_t ctrl_free;
+    uint64_t sdram_free;
+    uint64_t refresh_due;
+    int prefetch;                       /* L1I next-line prefetch queued */
+    uint32_t prefetch_line;
+    uint64_t prefetch_at;               /* cycle the controller sees it */
+    uint32_t prefetched_line;           /* last line filled by a prefetch */
+    uint64_t prefetched_at;
+
+    /* The instructions in EX and MEM when the current one is in ID */
+    slot_t ex, mem;
+    uint64_t pending;                   /* MEM stall of the current instruction */
+
+    tstats_t total;
+    tstats_t *cur;                      /* function of the current pc */
+    uint32_t cur_lo, cur_hi;
+    symbol_t *syms;
+    int nsyms;
+    uint32_t sym_end;
+    tstats_t other;                     /* pcs outside the symbols */
+
+    uint64_t l1i_hits, l1i_prefetches, l1i_prefetch_hits;
+    uint64_t l1d_read_hits, l1d_read_misses;
+    uint64_t l1d_write_hits, l1d_write_misses, l1d_writebacks;
+    uint64_t bursts, refreshes, refresh_wait;
+};
+
+int
+timing_init(emu_t *m)
+{
+    struct timing *t = calloc(1, sizeof(*t));
+
+    if (!t)
+        return -1;
+    t->fetch_line = ~0u;
+    t->sdram_free = SDRAM_INIT;
+    t->refresh_due = SDRAM_REFRESH_PERIOD;
+    t->cur = &t->other;
+    m->timing = t;
+    m->cycles += PIPELINE_FILL;
+    return 0;
+}
+
+void
+timing_free(emu_t *m)
+{
+    struct timing *t = m->timing;
+    int i;
+
+    if (!t)
+        return;
+    for (i = 0; i < t->nsyms; i++)
+        free(t->syms[i].name);
+    free(t->syms);
+    free(t);
+    m->timing = NULL;
+}
+
+static int
+symbol_cmp(const void *a, const void *b)
+{
+    const symbol_t *x = a, *y = b;
+
+    return x->addr < y->addr ? -1 : x->addr > y->addr;
+}
+
+/*
+ * Read "address name" lines (asmpy --symbols) and attribute the code from
+ * base + address up to the next symbol to name. Code at or above end, or
+ * below the first symbol, is reported as "(other)".
+ */
+int
+timing_load_symbols(emu_t *m, const char *path, uint32_t base, uint32_t end)
+{
+    struct timing *t = m->timing;
+    FILE *f = fopen(path, "r");
+    char line[512], name[256];
+    unsigned long addr;
+    int cap = 0;
+
+    if (!f)
+    {
+        perror(path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f))
+    {
+        if (sscanf(line, "%lx %255s", &addr, name) != 2)
+            continue;
+        if (t->nsyms == cap)
+        {
+            symbol_t *grown;
+
+            cap = cap ? cap * 2 : 256;
+            grown = realloc(t->syms, cap * sizeof(*grown));
+            if (!grown)
+            {
+                fclose(f);
+                return -1;
+            }
+            t->syms = grown;
+        }
+        memset(&t->syms[t->nsyms], 0, sizeof(t->syms[0]));
+        t->syms[t->nsyms].addr = base + (uint32_t)addr;
+        t->syms[t->nsyms].name = strdup(name);
+        t->nsyms++;
+    }
+    fclose(f);
+    qsort(t->syms, t->nsyms, sizeof(t->syms[0]), symbol_cmp);
+    t->sym_end = end;
+    t->cur_lo = 1;
+    t->cur_hi = 0;
+    return 0;
+}
+
+/* Point t->cur at the statistics of the function holding pc */
+static void
+find_function(struct timing *t, uint32_t pc)
+{
+    int lo = 0, hi = t->nsyms - 1, mid;
+
+    if (!t->nsyms || pc < t->syms[0].addr || pc >= t->sym_end)
+    {
+        t->cur = &t->other;
+        t->cur_lo = pc;
+        t->cur_hi = pc + 1;
+        return;
+    }
+    while (lo < hi)
+    {
+        mid = (lo + hi + 1) / 2;
+        if (t->syms[mid].addr <= pc)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    t->cur = &t->syms[lo].s;
+    t->cur_lo = t->syms[lo].addr;
+    t->cur_hi = lo + 1 < t->nsyms ? t->syms[lo + 1].addr : t->sym_end;
+}
+
+/*
+ * Charge n stall cycles. MEM stage stalls are deferred to the next
+ * instruction, so the current one still runs at the cycle it reaches MEM
+ * (UART TX timestamps and timers see that cycle).
+ */
+static void
+stall(emu_t *m, struct timing *t, int kind, uint64_t n, int deferred)
+{
+    if (deferred)
+        t->pending += n;
+    else
+        m->cycles += n;
+    t->total.stall[kind] += n;
+    t->total.cycles += n;
+    t->cur->stall[kind] += n;
+    t->cur->cycles += n;
+}
+
+static uint64_t
+max64(uint64_t a, uint64_t b)
+{
+    return a > b ? a : b;
+}
+
+/*
+ * Start an SDRAM burst that reaches the controller at cycle at, after any
+ * refresh that falls due first. Returns the cycle of BANK_ACTIVE.
+ */
+static uint64_t
+sdram_burst(struct timing *t, uint64_t at, int write)
+{
+    uint64_t a = max64(at, t->sdram_free), r;
+
+    /* Refreshes while the controller was idle happened on time */
+    if (t->refresh_due >= t->sdram_free && a > t->refresh_due)
+        t->refresh_due += (a - t->refresh_due) / SDRAM_REFRESH_PERIOD *
+                          SDRAM_REFRESH_PERIOD;
+    while (t->refresh_due <= a)
+    {
+        r = max64(t->refresh_due, t->sdram_free);
+        if (r + SDRAM_REFRESH > a)
+        {
+            t->refresh_wait += r + SDRAM_REFRESH - a;
+            a = r + SDRAM_REFRESH;
+        }
+        t->refresh_due = r + SDRAM_REFRESH_PERIOD;
+        t->refreshes++;
+    }
+    t->sdram_free = a + (write ? SDRAM_WRITE_BUSY : SDRAM_READ);
+    t->bursts++;
+    return a;
+}
+
+/*
+ * Settle the queued L1I prefetch before the controller sees a request at
+ * cycle now. A request in the cycle the controller checks the prefetch
+ * target, or earlier, cancels it; otherwise it runs first.
+ */
+static void
+prefetch_settle(struct timing *t, uint64_t now, int request)
+{
+    uint32_t line, idx;
+    uint64_t a;
+
+    if (!t->prefetch || (!request && now <= t->prefetch_at + 1))
+        return;
+    t->prefetch = 0;
+    if (now <= t->prefetch_at + 1)
+        return;
+    line = t->prefetch_line;
+    idx = line & (LINES - 1);
+    if (t->l1i[idx] == (line | TAG_VALID))
+    {
+        t->ctrl_free = t->prefetch_at + 2;
+        return;
+    }
+    a = sdram_burst(t, t->prefetch_at + 2, 0);
+    t->l1i[idx] = line | TAG_VALID;
+    t->ctrl_free = a + SDRAM_READ + 2;
+    t->prefetched_line = line;
+    t->prefetched_at = t->ctrl_free;
+    t->l1i_prefetches++;
+}
+
+/* IF: look up the line of pc in L1I, returns the stall cycles */
+static uint64_t
+l1i_fetch(struct timing *t, uint32_t pc, uint64_t now)
+{
+    uint32_t line = (pc & SDRAM_MASK) >> LINE_SHIFT;
+    uint32_t idx = line & (LINES - 1);
+    uint64_t s, a;
+
+    prefetch_settle(t, now, 0);
+    if (t->l1i[idx] == (line | TAG_VALID))
+    {
+        t->l1i_hits++;
+        if (line == t->prefetched_line && t->prefetched_at >= now)
+        {
+            t->l1i_prefetch_hits++;
+            return t->prefetched_at + 1 - now;
+        }
+        return 0;
+    }
+
+    /* The controller sees the request in the first miss cycle */
+    prefetch_settle(t, now, 1);
+    if (t->l1i[idx] == (line | TAG_VALID))
+    {
+        t->l1i_hits++;
+        t->l1i_prefetch_hits++;
+        return max64(t->prefetched_at + 1, now) - now;
+    }
+    s = max64(now, t->ctrl_free);
+    a = sdram_burst(t, s + 1, 0);
+    t->l1i[idx] = line | TAG_VALID;
+    t->ctrl_free = a + SDRAM_READ + 2;
+    t->prefetch = 1;
+    t->prefetch_line = (line + 1) & (SDRAM_MASK >> LINE_SHIFT);
+    t->prefetch_at = t->ctrl_free;
+    t->cur->l1i_misses++;
+    t->total.l1i_misses++;
+    /* The line is in the DPRAM a cycle after the controller is done */
+    return a + SDRAM_READ + 3 - now;
+}
+
+/* MEM: an SDRAM read or write, returns the stall cycles */
+static uint64_t
+l1d_access(struct timing *t, uint32_t addr, int write, uint64_t now)
+{
+    uint32_t line = (addr & SDRAM_MASK) >> LINE_SHIFT;
+    uint32_t idx = line & (LINES - 1);
+    int hit = t->l1d[idx] == (line | TAG_VALID);
+    uint64_t s, a;
+
+    if (hit && !write)
+    {
+        t->l1d_read_hits++;
+        return L1D_WAIT;
+    }
+
+    /* Wait cycle, hit check, then the controller sees the request */
+    prefetch_settle(t, now + 2, 1);
+    s = max64(now + 2, t->ctrl_free);
+    if (hit)
+    {
+        /* WAIT_CACHE_READ, CHECK_CACHE, WRITE_TO_CACHE */
+        t->l1d_write_hits++;
+        t->dirty[idx] = 1;
+        t->ctrl_free = s + 4;
+        return s + 5 - now;
+    }
+
+    if (write)
+        t->l1d_write_misses++;
+    else
+        t->l1d_read_misses++;
+    t->cur->l1d_misses++;
+    t->total.l1d_misses++;
+    if ((t->l1d[idx] & TAG_VALID) && t->dirty[idx])
+    {
+        /* Read the victim from the DPRAM, write it back, then fetch */
+        a = sdram_burst(t, s + 3, 1);
+        a = sdram_burst(t, a + SDRAM_WRITE + 2, 0);
+        t->l1d_writebacks++;
+    }
+    else if (write)
+        a = sdram_burst(t, s + 3, 0);
+    else
+        a = sdram_burst(t, s + 1, 0);   /* clean line: fast path */
+    t->l1d[idx] = line | TAG_VALID;
+    t->dirty[idx] = write;
+    t->ctrl_free = a + SDRAM_READ + 2;
+    return a + SDRAM_READ + 3 - now;
+}
+
+/* MEM: ccache / ccached, returns the stall cycles */
+static uint64_t
+clear_caches(struct timing *t, int data_only, uint64_t now)
+{
+    uint64_t x, a;
+    int i;
+
+    prefetch_settle(t, now + 2, 1);
+    x = max64(now + 2, t->ctrl_free) + 1;
+    if (!data_only)
+    {
+        memset(t->l1i, 0, sizeof(t->l1i));
+        t->fetch_line = ~0u;
+        x += LINES;
+    }
+    for (i = 0; i < LINES; i++)
+    {
+        if ((t->l1d[i] & TAG_VALID) && t->dirty[i])
+        {
+            a = sdram_burst(t, x + 3, 1);
+            x = a + SDRAM_WRITE + 1;
+            t->l1d_writebacks++;
+        }
+        else
+            x++;
+    }
+    x += LINES;
+    memset(t->l1d, 0, sizeof(t->l1d));
+    memset(t->dirty, 0, sizeof(t->dirty));
+    t->ctrl_free = x + 2;
+    return x + 2 - now;
+}
+
+static uint64_t
+malu_stall(unsigned op, uint32_t b)
+{
+    switch (op)
+    {
+    case 0x0: case 0x1: case 0x2: case 0xE: case 0xF:
+        return MALU_MULT;
+    case 0x3: case 0x4: case 0x6: case 0x7:
+        return b ? MALU_DIV : MALU_DIV_ZERO;
+    case 0x5:
+        return b ? MALU_DIVFP : MALU_DIV_ZERO;
+    case MALU_FMUL:
+        return MALU_FMUL_STALL;
+    case MALU_FADD:
+    case MALU_FSUB:
+        return MALU_FADDSUB;
+    default:
+        return 0;
+    }
+}
+
+/* Destination register as ControlUnit.v's dreg_we sees it, or 0 */
+static int
+dest_reg(uint32_t ins)
+{
+    unsigned op = (ins >> 24) & 15;
+
+    switch (ins >> 28)
+    {
+    case OP_ARITHM:
+    case OP_ARITHMC:
+        /* FMUL, FADD, FSUB and FLD write the FP64 registers */
+        if (op >= MALU_FMUL && op <= MALU_FLD)
+            return 0;
+        return ins & 15;
+    case OP_ARITH:
+    case OP_ARITHC:
+    case OP_SAVPC:
+    case OP_POP:
+    case OP_INTID:
+    case OP_READ:
+        return ins & 15;
+    default:
+        return 0;
+    }
+}
+
+void
+timing_instr(emu_t *m, uint32_t pc, uint32_t ins)
+{
+    struct timing *t = m->timing;
+    unsigned opc = ins >> 28, areg, breg;
+    uint32_t addr = 0;
+    uint64_t n;
+    int mem_op = opc == OP_READ || opc == OP_WRITE;
+    int fwd;
+    slot_t self;
+
+    m->cycles += t->pending;
+    t->pending = 0;
+
+    if (pc < t->cur_lo || pc >= t->cur_hi)
+    {
+        if (t->nsyms)
+            find_function(t, pc);
+    }
+    t->total.instrs++;
+    t->total.cycles++;
+    t->cur->instrs++;
+    t->cur->cycles++;
+
+    /* IF */
+    if (pc < IO_BASE && (pc & SDRAM_MASK) >> LINE_SHIFT != t->fetch_line)
+    {
+        n = l1i_fetch(t, pc, m->cycles);
+        t->fetch_line = (pc & SDRAM_MASK) >> LINE_SHIFT;
+        if (n)
+            stall(m, t, ST_L1I, n, 0);
+    }
+
+    /* ID: InstructionDecoder.v reads these fields for every opcode */
+    if (opc == OP_ARITHC || opc == OP_ARITHMC)
+    {
+        areg = (ins >> 4) & 15;
+        breg = 0;
+    }
+    else
+    {
+        areg = (ins >> 8) & 15;
+        breg = (ins >> 4) & 15;
+    }
+    if (t->ex.valid && t->ex.load && t->ex.dreg &&
+        (t->ex.dreg == (int)areg || t->ex.dreg == (int)breg))
+    {
+        stall(m, t, (t->ex.load == OP_POP) ? ST_POP_USE : ST_LOAD_USE, 1, 0);
+        t->mem = t->ex;
+        t->ex.valid = 0;
+    }
+
+    /* EX: the instruction in MEM is t->ex, the one in WB t->mem */
+    if (mem_op)
+    {
+        uint32_t base = m->cpu.r[areg];
+
+        addr = base + SEXT16(ins >> 12);
+        fwd = (t->ex.valid && !t->ex.load && t->ex.dreg == (int)areg &&
+               areg) ||
+              (t->mem.valid && t->mem.dreg == (int)areg && areg);
+        if (t->ex.valid && t->ex.sdram && (fwd || base < IO_BASE) &&
+            (fwd || ((addr >> 5) & 127) != ((t->ex.addr >> 3) & 127)))
+        {
+            stall(m, t, ST_CACHE_LINE, 1, 0);
+            t->mem = t->ex;
+            t->ex.valid = 0;
+        }
+    }
+    if (opc == OP_ARITHM || opc == OP_ARITHMC)
+    {
+        unsigned op = (ins >> 24) & 15;
+        uint32_t b = opc == OP_ARITHM ? m->cpu.r[breg] : (ins >> 8) & 0xFFFF;
+
+        n = malu_stall(op, b);
+        if (n)
+            stall(m, t, ST_MALU, n, 0);
+    }
+
+    /* MEM */
+    if (mem_op && addr < IO_BASE)
+        stall(m, t, ST_L1D, l1d_access(t, addr, opc == OP_WRITE, m->cycles),
+              1);
+    else if (mem_op && addr < ROM_BASE)
+        stall(m, t, ST_IO,
+              opc == OP_WRITE && addr == UART_TX_ADDR ? UART_TX_STALL
+                                                       : IO_STALL,
+              1);
+    else if (opc == OP_CCACHE)
+        stall(m, t, ST_CCACHE, clear_caches(t, ins & 1, m->cycles), 1);
+
+    self.valid = 1;
+    self.load = opc == OP_READ || opc == OP_POP ? (int)opc : 0;
+    self.dreg = dest_reg(ins);
+    self.sdram = mem_op && addr < IO_BASE;
+    self.addr = addr;
+    t->mem = t->ex;
+    t->ex = self;
+}
+
+/*
+ * A taken jump, branch or halt resolves in MEM (RETI in EX) and flushes
+ * the younger instructions. In the first redirect cycle InstructionFetch.v
+ * compares the target with the L1I line read for the old pc, which is
+ * the line of the instruction IF was fetching.
+ */
+void
+timing_jump(emu_t *m, uint32_t pc, uint32_t target, int reti)
+{
+    struct timing *t = m->timing;
+    uint32_t seen = pc + (reti ? 12 : 16);
+    uint32_t line = (target & SDRAM_MASK) >> LINE_SHIFT;
+    int first = target >= ROM_BASE ||
+                ((((seen ^ target) >> LINE_SHIFT) & (LINES - 1)) == 0 &&
+                 t->l1i[line & (LINES - 1)] == (line | TAG_VALID));
+
+    stall(m, t, ST_JUMP, (first ? JUMP_PENALTY : JUMP_NEW_LINE) - reti, 0);
+    t->ex.valid = 0;
+    t->mem.valid = 0;
+}
+
+void
+timing_finish(emu_t *m)
+{
+    m->cycles += m->timing->pending;
+    m->timing->pending = 0;
+}
+
+uint64_t
+timing_instructions(const emu_t *m)
+{
+    return m->timing->total.instrs;
+}
+
+/* The stall counters cpu_tests_tb.v prints at the end of a run */
+void
+timing_tb_stalls(emu_t *m)
+{
+    const uint64_t *s = m->timing->total.stall;
+
+    printf("Stalls: load-use %llu, cache-line %llu, backend %llu\n",
+           (unsigned long long)(s[ST_LOAD_USE] + s[ST_POP_USE]),
+           (unsigned long long)s[ST_CACHE_LINE],
+           (unsigned long long)(s[ST_L1D] + s[ST_MALU] + s[ST_IO] +
+                                s[ST_CCACHE]));
+}
+
+static double
+percent(uint64_t part, uint64_t whole)
+{
+    return whole ? 100.0 * part / whole : 0.0;
+}
+
+void
+timing_report(emu_t *m, FILE *f)
+{
+    struct timing *t = m->timing;
+    int i;
+
+    fprintf(f, "instructions: %llu\nCPI: %.3f\nstall cycles:\n",
+            (unsigned long long)t->total.instrs,
+            t->total.instrs ? (double)m->cycles / t->total.instrs : 0.0);
+    for (i = 0; i < ST_KINDS; i++)
+        fprintf(f, "  %-11s %12llu  %5.1f%%\n", stall_names[i],
+                (unsigned long long)t->total.stall[i],
+                percent(t->total.stall[i], m->cycles));
+    fprintf(f,
+            "L1I: %llu hits, %llu misses, %llu prefetched lines (%llu used "
+            "while in flight)\n",
+            (unsigned long long)t->l1i_hits,
+            (unsigned long long)t->total.l1i_misses,
+            (unsigned long long)t->l1i_prefetches,
+            (unsigned long long)t->l1i_prefetch_hits);
+    fprintf(f,
+            "L1D: reads %llu hits, %llu misses; writes %llu hits, %llu "
+            "misses; %llu write-backs\n",
+            (unsigned long long)t->l1d_read_hits,
+            (unsigned long long)t->l1d_read_misses,
+            (unsigned long long)t->l1d_write_hits,
+            (unsigned long long)t->l1d_write_misses,
+            (unsigned long long)t->l1d_writebacks);
+    fprintf(f, "SDRAM: %llu bursts, %llu refreshes, %llu cycles waiting "
+               "for a refresh\n",
+            (unsigned long long)t->bursts, (unsigned long long)t->refreshes,
+            (unsigned long long)t->refresh_wait);
+}
+
+static int
+profile_cmp(const void *a, const void *b)
+{
+    const symbol_t *x = *(symbol_t *const *)a, *y = *(symbol_t *const *)b;
+
+    return x->s.cycles > y->s.cycles ? -1 : x->s.cycles < y->s.cycles;
+}
+
+static void
+profile_row(FILE *f, const char *name, const tstats_t *s, uint64_t total)
+{
+    int i;
+
+    fprintf(f, "%-24s %12llu %5.1f %11llu %6.2f %7llu %7llu",
+            name, (unsigned long long)s->cycles, percent(s->cycles, total),
+            (unsigned long long)s->instrs,
+            s->instrs ? (double)s->cycles / s->instrs : 0.0,
+            (unsigned long long)s->l1i_misses,
+            (unsigned long long)s->l1d_misses);
+    for (i = 0; i < ST_KINDS; i++)
+        fprintf(f, " %10llu", (unsigned long long)s->stall[i]);
+    fputc('\n', f);
+}
+
+/* Per-function cycles, CPI, misses and stall cycles, most cycles first */
+void
+timing_profile(emu_t *m, FILE *f)
+{
+    struct timing *t = m->timing;
+    symbol_t **order;
+    int i, n = 0;
+
+    fprintf(f, "%-24s %12s %5s %11s %6s %7s %7s", "function", "cycles", "%",
+            "instrs", "CPI", "l1i-miss", "l1d-miss");
+    for (i = 0; i < ST_KINDS; i++)
+        fprintf(f, " %10s", stall_names[i]);
+    fputc('\n', f);
+
+    order = malloc((t->nsyms + 1) * sizeof(*order));
+    if (!order)
+        return;
+    for (i = 0; i < t->nsyms; i++)
+        if (t->syms[i].s.instrs)
+            order[n++] = &t->syms[i];
+    qsort(order, n, sizeof(*order), profile_cmp);
+    for (i = 0; i < n; i++)
+        profile_row(f, order[i]->name, &order[i]->s, t->total.cycles);
+    if (t->other.instrs)
+        profile_row(f, "(other)", &t->other, t->total.cycles);
+    profile_row(f, "total", &t->total, t->total.cycles);
+    free(order);
+}
@@ -540,6 +540,7 @@ DPRAM #(
 wire [20:0]     sdc_addr;
 wire [255:0]    sdc_data;
 wire            sdc_we;
+wire [31:0]     sdc_mask;
 wire            sdc_start;
 wire            sdc_done;
 wire [255:0]    sdc_q;
@@ -551,6 +552,7 @@ SDRAMcontroller sdc (
     .cpu_addr(sdc_addr),
     .cpu_data(sdc_data),
     .cpu_we(sdc_we),
+    .cpu_mask(sdc_mask),
     .cpu_start(sdc_start),
     .cpu_done(sdc_done),
     .cpu_q(sdc_q),
@@ -645,6 +647,7 @@ wire [255:0]    cpu_sdc_q;
 wire [20:0]     dma_sd_addr;
 wire [255:0]    dma_sd_data;
 wire            dma_sd_we;
+wire [31:0]     dma_sd_mask;
 wire            dma_sd_start;
 wire            dma_sd_done;
 wire [255:0]    dma_sd_q;
@@ -702,6 +705,7 @@ SDRAMarbiter sdram_arb (
     .dma_addr(dma_sd_addr),
     .dma_data(dma_sd_data),
     .dma_we(dma_sd_we),
+    .dma_mask(dma_sd_mask),
     .dma_start(dma_sd_start),
     .dma_done(dma_sd_done),
     .dma_q(dma_sd_q),
@@ -710,6 +714,7 @@ SDRAMarbiter sdram_arb (
     .sdc_addr(sdc_addr),
     .sdc_data(sdc_data),
     .sdc_we(sdc_we),
+    .sdc_mask(sdc_mask),
     .sdc_start(sdc_start),
     .sdc_done(sdc_done),
     .sdc_q(sdc_q)
@@ -903,6 +908,7 @@ DMAengine dma_engine (
     .sd_addr(dma_sd_addr),
     .sd_data(dma_sd_data),
     .sd_we(dma_sd_we),
+    .sd_mask(dma_sd_mask),
     .sd_start(dma_sd_start),
     .sd_done(dma_sd_done),
     .sd_q(dma_sd_q),
@@ -1,17 +1,28 @@
 /*
  * DMAengine
  * ---------
- * Single-channel DMA controller for the FPGC. Phase 1 implements MEM2MEM
- * fully; the other modes from dma-implementation-plan.md (MEM2SPI, SPI2MEM,
- * MEM2VRAM, MEM2IO, IO2MEM) are accepted by the register interface but the
- * engine completes them immediately with error=1 set in DMA_STATUS.
- * They will be filled in later commits when the iop_X / vp_X peer ports get
- * wired into MemoryUnits IDLE-state arbiter.
+ * Single-channel DMA controller for the FPGC. Supported modes:
+ *   MEM2MEM       SDRAM to SDRAM.
+ *   MEM2SPI       SDRAM to SPI0/1/4/5 over the MemoryUnit DMA burst port.
+ *   SPI2MEM       SPI0/1/4/5 to SDRAM (dummy bursts, RX bytes stored).
+ *   MEM2VRAM      SDRAM to VRAMPX over the vp_* port.
+ *   SPI2MEM_QSPI  QSPI Fast Read from the SPI1 flash to SDRAM.
+ * MEM2IO and IO2MEM are accepted by the register interface but complete
+ * immediately with error=1 set in DMA_STATUS.
+ * A transfer is either programmed through the registers below or taken
+ * from a descriptor chain in SDRAM, where each descriptor may also be a
+ * 2D block of rows with their own source and destination strides.
  *
- * Restrictions for MEM2MEM in this commit:
- *   - DMA_SRC, DMA_DST, DMA_COUNT must all be 32-byte (cache-line) aligned.
- *     Unaligned values result in error=1 and an immediate completion.
- *   - DMA_COUNT must be > 0.
+ * Alignment:
+ *   - DMA_SRC, DMA_DST and DMA_COUNT are byte-granular in every mode;
+ *     DMA_COUNT must be > 0. Each SDRAM line is handled as a byte window
+ *     [off, off + n) of line_buf. A partial destination line is read back
+ *     first and merged (read-modify-write), because the SDRAM port has no
+ *     byte enables.
+ *   - MEM2MEM with SRC, DST and COUNT all 32-byte aligned keeps the
+ *     line-at-a-time fast path. Any other MEM2MEM goes through a byte
+ *     path (ST_U_*) that shifts between the source and destination line
+ *     offsets at one byte per cycle.
  *
  * Register interface (1-cycle write, combinatorial read):
  *
@@ -19,13 +30,42 @@
  *     0       DMA_SRC       (RW, 32-bit byte source address)
  *     1       DMA_DST       (RW, 32-bit byte destination address)
  *     2       DMA_COUNT     (RW, 32-bit byte count)
- *     3       DMA_CTRL      (RW; bit [31] is W1S "start", self-clears)
+ *     3       DMA_CTRL      (RW; [3:0] mode, [4] irq enable, [7:5] spi
+ *                           id, [8] chain; bit [31] is W1S "start",
+ *                           self-clears)
  *     4       DMA_STATUS    (R; reads return {..., err, done, busy};
  *                           reading the register clears the sticky done
  *                           and error bits.)
  *     5       DMA_QSPI_ADDR (RW, 24-bit byte address into the QSPI flash;
  *                           used as the start address for the QSPI Fast
  *                           Read issued by mode SPI2MEM_QSPI.)
+ *     6       DMA_DESC      (RW, SDRAM byte address of the first descriptor
+ *                           of a chain; 32-byte aligned.)
+ *     7       DMA_DESC_CUR  (R, address of the descriptor being executed,
+ *                           or the last one executed once the chain has
+ *                           finished or failed.)
+ *
+ * Descriptor chains (DMA_CTRL bit [8] CHAIN):
+ *   A START with CHAIN set ignores SRC/DST/COUNT/mode in the registers and
+ *   instead walks a linked list of descriptors in SDRAM, one cache line
+ *   each (word i of the line is at byte offset 4*i):
+ *
+ *     w0 src      w1 dst      w2 count (bytes per row)
+ *     w3 ctrl     [3:0] mode, [4] irq after this descriptor,
+ *                 [7:5] spi id, [8] 2D
+ *     w4 next     byte address of the next descriptor, 0 ends the list
+ *     w5 qspi_addr (SPI2MEM_QSPI only)
+ *     w6 rows     [15:0] row count (2D only)
+ *     w7 strides  [15:0] src stride, [31:16] dst stride in bytes (2D only)
+ *
+ *   Each descriptor (and each 2D row) is validated with exactly the same
+ *   rules as a register-programmed transfer; strides may be any byte
+ *   count. 2D is accepted for MEM2MEM and MEM2VRAM only.
+ *   While a descriptor executes, SRC/DST/COUNT/QSPI_ADDR read back its
+ *   values. DMA_CTRL.IRQ_EN raises the interrupt at the end of the list
+ *   (or on the first error, which stops the list); descriptor bit [4]
+ *   additionally raises it after that descriptor and sets the sticky
+ *   STATUS bit [3] (desc) while the engine stays busy.
  *
  * SDRAM master port mirrors the SDRAMcontrollers CPU-side protocol:
  * pulse sd_start with sd_addr (line address, 21 bits, byte_addr >> 5),
@@ -119,9 +159,11 @@ reg [31:0] dma_dst       = 32'd0;
 reg [31:0] dma_count     = 32'd0;
 reg [31:0] dma_ctrl      = 32'd0;
 reg [31:0] dma_qspi_addr = 32'd0;   // only [23:0] is meaningful
+reg [31:0] dma_desc      = 32'd0;   // chain head (DMA_DESC)
 
 reg        sticky_done  = 1'b0;
 reg        sticky_error = 1'b0;
+reg        sticky_desc  = 1'b0;
 reg        busy         = 1'b0;
 
 // ---- MEM2MEM transfer state ----
@@ -130,13 +172,24 @@ reg [31:0] dst_cur          = 32'd0;
 reg [31:0] bytes_remaining  = 32'd0;
 reg [255:0] line_buf        = 256'd0;
 
-// ---- SPI byte cursor (used by MEM2SPI / SPI2MEM / SPI2MEM_QSPI) ----
-// Counts bytes within the current 32-byte cache line, 0..31.
+// ---- Byte windows (unaligned / sub-line transfers) ----
+// line_n is the size of the current line window (1..32) and xfer_n the
+// bytes of it handled so far; spi_byte_idx is the position in line_buf.
+// Aligned transfers always see full 32-byte windows.
+reg [5:0]   line_n          = 6'd32;
+reg [5:0]   xfer_n          = 6'd0;
+// MEM2MEM byte path: the current source line, kept separately from the
+// destination line being assembled in line_buf.
+reg [255:0] src_line        = 256'd0;
+reg         src_line_valid  = 1'b0;
+
+// ---- Byte cursor within line_buf (MEM2SPI / SPI2MEM / QSPI / MEM2VRAM) ----
+// Position of the next byte within the current 32-byte cache line, 0..31.
 reg [5:0]  spi_byte_idx = 6'd0;  // 6 bits so we can hold 32 (== done) without wrap
 // Latched at start: which SPI bus is the target.
 reg [2:0]  spi_id_sel   = 3'd0;  // 0 = SPI0 (Flash), 1 = SPI1 (Flash 2 / BRFS), 4 = SPI4 (Eth), 5 = SPI5 (SD)
-// Per-burst cursor for SPI2MEM_QSPI: starts at dma_qspi_addr, advances by 32
-// after every committed cache line. Tracked separately from src_cur (SDRAM)
+// Per-burst cursor for SPI2MEM_QSPI: starts at dma_qspi_addr, advances by
+// the window size after every committed cache line. Tracked separately from src_cur (SDRAM)
 // because for QSPI the "source address" is a flash byte offset, not SDRAM.
 reg [23:0] qspi_addr_cur = 24'd0;
 
@@ -147,24 +200,54 @@ reg [23:0] qspi_addr_cur = 24'd0;
 // transfer and stays high until ST_DONE / ST_ERROR.
 reg        qspi_burst_open = 1'b0;
 
+// ---- Active transfer parameters ----
+// Latched from DMA_CTRL for a register-programmed transfer, or from w3 of
+// the current descriptor in chain mode. The state machine only looks at
+// these, never at DMA_CTRL directly, so the chain can change mode per
+// descriptor.
+reg [3:0]  xfer_mode    = 4'd0;
+reg [2:0]  xfer_spi_id  = 3'd0;
+reg        xfer_irq     = 1'b0;   // per-descriptor IRQ (chain only)
+
+// ---- Chain / 2D state ----
+reg        chain_active = 1'b0;
+reg [31:0] desc_cur     = 32'd0;  // DMA_DESC_CUR
+reg [31:0] desc_next    = 32'd0;
+reg [15:0] rows_left    = 16'd1;  // rows still to run, including this one
+reg [15:0] src_stride   = 16'd0;
+reg [15:0] dst_stride   = 16'd0;
+
 localparam
-    ST_IDLE          = 4'd0,
-    ST_RD_REQ        = 4'd1,   // MEM2MEM / MEM2SPI: SDRAM read request
-    ST_RD_WAIT       = 4'd2,
-    ST_WR_REQ        = 4'd3,   // MEM2MEM / SPI2MEM: SDRAM write request
-    ST_WR_WAIT       = 4'd4,
-    ST_DONE          = 4'd5,
-    ST_ERROR         = 4'd6,
-    ST_S2M_BURST     = 4'd7,   // SPI2MEM: kick off 32-byte SPI burst (dummy)
-    ST_S2M_BWAIT     = 4'd8,   // SPI2MEM: wait for burst done
-    ST_S2M_DRAIN     = 4'd9,   // SPI2MEM: drain 32 RX bytes into line_buf
-    ST_M2S_FILL      = 4'd10,  // MEM2SPI: push 32 line_buf bytes into TX FIFO
-    ST_M2S_BURST     = 4'd11,  // MEM2SPI: kick off 32-byte SPI burst
-    ST_M2S_BWAIT     = 4'd12,  // MEM2SPI: wait for burst done
-    ST_M2S_DRAIN     = 4'd13,  // MEM2SPI: drain 32 RX bytes (discarded)
-    ST_M2V_DRAIN     = 4'd14;  // MEM2VRAM: emit 32 bytes from line_buf to vp_*
-
-reg [3:0] state = ST_IDLE;
+    ST_IDLE          = 5'd0,
+    ST_RD_REQ        = 5'd1,   // MEM2MEM / MEM2SPI: SDRAM read request
+    ST_RD_WAIT       = 5'd2,
+    ST_WR_REQ        = 5'd3,   // MEM2MEM / SPI2MEM: SDRAM write request
+    ST_WR_WAIT       = 5'd4,
+    ST_DONE          = 5'd5,
+    ST_ERROR         = 5'd6,
+    ST_S2M_BURST     = 5'd7,   // SPI2MEM: kick off window-sized burst (dummy)
+    ST_S2M_BWAIT     = 5'd8,   // SPI2MEM: wait for burst done
+    ST_S2M_DRAIN     = 5'd9,   // SPI2MEM: drain the window into line_buf
+    ST_M2S_FILL      = 5'd10,  // MEM2SPI: push the window into the TX FIFO
+    ST_M2S_BURST     = 5'd11,  // MEM2SPI: kick off window-sized SPI burst
+    ST_M2S_BWAIT     = 5'd12,  // MEM2SPI: wait for burst done
+    ST_M2S_DRAIN     = 5'd13,  // MEM2SPI: drain RX bytes (discarded)
+    ST_M2V_DRAIN     = 5'd14,  // MEM2VRAM: emit the window from line_buf to vp_*
+    ST_DISPATCH      = 5'd15,  // validate SRC/DST/COUNT + xfer_* and start
+    ST_DESC_REQ      = 5'd16,  // chain: SDRAM read of the descriptor line
+    ST_DESC_WAIT     = 5'd17,  // chain: latch descriptor fields
+    ST_SEG_DONE      = 5'd18,  // one row finished: next row / descriptor / done
+    ST_S2M_LINE      = 5'd19,  // SPI2MEM: set up the next destination window
+    ST_RMW_REQ       = 5'd20,  // partial dst line: read it back before merging
+    ST_RMW_WAIT      = 5'd21,
+    ST_U_LINE        = 5'd22,  // MEM2MEM byte path: next destination window
+    ST_U_SRC_REQ     = 5'd23,  // MEM2MEM byte path: fetch next source line
+    ST_U_SRC_WAIT    = 5'd24,
+    ST_U_COPY        = 5'd25,  // MEM2MEM byte path: one byte per cycle
+    ST_U_WR_REQ      = 5'd26,  // MEM2MEM byte path: write the assembled line
+    ST_U_WR_WAIT     = 5'd27;
+
+reg [4:0] state = ST_IDLE;
 
 // ---- Combinatorial read mux ----
 always @(*)
@@ -174,8 +257,10 @@ begin
         3'd1:    reg_q = dma_dst;
         3'd2:    reg_q = dma_count;
         3'd3:    reg_q = dma_ctrl;
-        3'd4:    reg_q = {29'd0, sticky_error, sticky_done, busy};
+        3'd4:    reg_q = {28'd0, sticky_desc, sticky_error, sticky_done, busy};
         3'd5:    reg_q = dma_qspi_addr;
+        3'd6:    reg_q = dma_desc;
+        3'd7:    reg_q = desc_cur;
         default: reg_q = 32'd0;
     endcase
 end
@@ -185,57 +270,50 @@ wire        ctrl_start_bit  = dma_ctrl[31];
 wire [3:0]  ctrl_mode       = dma_ctrl[3:0];
 wire        ctrl_irq_en     = dma_ctrl[4];
 wire [2:0]  ctrl_spi_id     = dma_ctrl[7:5];
+wire        ctrl_chain      = dma_ctrl[8];
 
-// Aligned-to-32-bytes test (low 5 bits zero); applies to both SDRAM endpoints
-// in MEM2MEM and to the SDRAM endpoint in MEM2SPI / SPI2MEM.
+// MEM2MEM fast path: everything 32-byte aligned, so whole lines can be
+// copied without shifting. Other non-empty MEM2MEM transfers use the byte
+// path.
 wire mem2mem_args_aligned =
     (dma_src[4:0] == 5'd0) &&
     (dma_dst[4:0] == 5'd0) &&
     (dma_count[4:0] == 5'd0) &&
     (dma_count != 32'd0);
 
-// For MEM2SPI/SPI2MEM only the SDRAM-side address needs to be 32-byte aligned.
-// dma_src is the SDRAM read address for MEM2SPI; dma_dst is the SDRAM write
-// address for SPI2MEM. The SPI-side address (the other one) carries the
-// flash byte address and has no alignment constraint as far as the engine is
-// concerned -- software handles the flash command/address phase before
-// kicking off DMA.
-wire mem2spi_args_aligned =
-    (dma_src[4:0] == 5'd0) &&
-    (dma_count[4:0] == 5'd0) &&
-    (dma_count != 32'd0);
-
-wire spi2mem_args_aligned =
-    (dma_dst[4:0] == 5'd0) &&
-    (dma_count[4:0] == 5'd0) &&
-    (dma_count != 32'd0);
-
-// QSPI Fast Read: same alignment as plain SPI2MEM. Multi-line transfers
-// are now handled by issuing a single big QSPIflash burst per DMA call
-// and draining 32 bytes per SDRAM line. CS is held low for the whole
-// transfer (the engine doesn't toggle CS), and the W25Q is happy with
-// that as long as we don't try to issue a second opcode mid-transaction.
-wire qspi_args_aligned =
-    (dma_dst[4:0] == 5'd0) &&
-    (dma_count[4:0] == 5'd0) &&
-    (dma_count != 32'd0);
+// The SPI modes take any SDRAM address and count: the SPI side is a byte
+// stream and the SDRAM side is split into line windows. For QSPI Fast
+// Read a single big QSPIflash burst is still issued per DMA call (CS held
+// low for the whole transfer) and drained one window at a time.
+wire count_ok = (dma_count != 32'd0);
 
-// MEM2VRAM: SDRAM source line-aligned, byte count line-aligned, and the
-// destination must lie entirely within the VRAMPX byte range
-// (0x1EC00000 .. 0x1EC20000).
-wire mem2vram_args_aligned =
-    (dma_src[4:0]   == 5'd0)         &&
-    (dma_dst[4:0]   == 5'd0)         &&
-    (dma_count[4:0] == 5'd0)         &&
-    (dma_count      != 32'd0)        &&
+// MEM2VRAM: the destination must lie entirely within the VRAMPX byte
+// range (0x1EC00000 .. 0x1EC20000). VRAMPX is written a byte at a time,
+// so no alignment is needed on either side.
+wire mem2vram_args_ok =
+    count_ok                         &&
     (dma_dst        >= 32'h1EC00000) &&
     ((dma_dst + dma_count) <= 32'h1EC20000);
 
+// Size of the window starting at a cursor: the bytes left in its SDRAM
+// line, clipped to the bytes left in the transfer.
+wire [5:0]  src_room   = 6'd32 - {1'b0, src_cur[4:0]};
+wire [5:0]  dst_room   = 6'd32 - {1'b0, dst_cur[4:0]};
+wire [5:0]  src_line_n = (bytes_remaining < {26'd0, src_room}) ?
+                         bytes_remaining[5:0] : src_room;
+wire [5:0]  dst_line_n = (bytes_remaining < {26'd0, dst_room}) ?
+                         bytes_remaining[5:0] : dst_room;
+wire [31:0] dst_last   = dst_cur - 32'd1;  // last byte written (byte path)
+
 // SPI0 (Flash 1), SPI1 (Flash 2 / BRFS via QSPI), SPI4 (Ethernet) and SPI5
 // (SD card) are the four controllers wired through MemoryUnit's DMA burst
 // port. Reject other SPI ids cleanly.
-wire ctrl_spi_id_valid = (ctrl_spi_id == 3'd0) || (ctrl_spi_id == 3'd1) ||
-                         (ctrl_spi_id == 3'd4) || (ctrl_spi_id == 3'd5);
+wire xfer_spi_id_valid = (xfer_spi_id == 3'd0) || (xfer_spi_id == 3'd1) ||
+                         (xfer_spi_id == 3'd4) || (xfer_spi_id == 3'd5);
+
+// 2D descriptors are only meaningful when both endpoints are memory-like.
+wire desc_2d_mode_ok = (sd_q[99:96] == MODE_MEM2MEM) ||
+                       (sd_q[99:96] == MODE_MEM2VRAM);
 
 // Reading STATUS clears the sticky bits, but the MemoryUnit holds reg_addr=4
 // across an entire poll loop, so status_read sits high for many cycles in a
@@ -255,8 +333,19 @@ begin
         dma_count       <= 32'd0;
         dma_ctrl        <= 32'd0;
         dma_qspi_addr   <= 32'd0;
+        dma_desc        <= 32'd0;
         sticky_done     <= 1'b0;
         sticky_error    <= 1'b0;
+        sticky_desc     <= 1'b0;
+        xfer_mode       <= 4'd0;
+        xfer_spi_id     <= 3'd0;
+        xfer_irq        <= 1'b0;
+        chain_active    <= 1'b0;
+        desc_cur        <= 32'd0;
+        desc_next       <= 32'd0;
+        rows_left       <= 16'd1;
+        src_stride      <= 16'd0;
+        dst_stride      <= 16'd0;
         busy            <= 1'b0;
         sd_addr         <= 21'd0;
         sd_data         <= 256'd0;
@@ -267,6 +356,10 @@ begin
         dst_cur         <= 32'd0;
         bytes_remaining <= 32'd0;
         line_buf        <= 256'd0;
+        line_n          <= 6'd32;
+        xfer_n          <= 6'd0;
+        src_line        <= 256'd0;
+        src_line_valid  <= 1'b0;
         spi_byte_idx    <= 6'd0;
         spi_id_sel      <= 3'd0;
         status_read_d   <= 1'b0;
@@ -305,7 +398,8 @@ begin
                 3'd2: dma_count     <= reg_data;
                 3'd3: dma_ctrl      <= reg_data;
                 3'd5: dma_qspi_addr <= reg_data;
-                default: ; // STATUS is read-only
+                3'd6: dma_desc      <= reg_data;
+                default: ; // STATUS and DESC_CUR are read-only
             endcase
         end
 
@@ -315,6 +409,7 @@ begin
         begin
             sticky_done  <= 1'b0;
             sticky_error <= 1'b0;
+            sticky_desc  <= 1'b0;
         end
 
         // ---- State machine ----
@@ -331,103 +426,130 @@ begin
                     // outcome.
                     sticky_done  <= 1'b0;
                     sticky_error <= 1'b0;
+                    sticky_desc  <= 1'b0;
 
-                    if (ctrl_mode == MODE_MEM2MEM)
+                    if (ctrl_chain)
                     begin
-                        if (mem2mem_args_aligned)
-                        begin
-                            src_cur         <= dma_src;
-                            dst_cur         <= dma_dst;
-                            bytes_remaining <= dma_count;
-                            state           <= ST_RD_REQ;
-                        end
-                        else
-                        begin
-                            state <= ST_ERROR;
-                        end
+                        // Descriptor chain: fetch the head descriptor; it
+                        // supplies SRC/DST/COUNT and the mode.
+                        chain_active <= 1'b1;
+                        desc_cur     <= dma_desc;
+                        state        <= ST_DESC_REQ;
                     end
-                    else if (ctrl_mode == MODE_MEM2SPI)
+                    else
                     begin
-                        if (mem2spi_args_aligned && ctrl_spi_id_valid)
-                        begin
-                            src_cur         <= dma_src;
-                            bytes_remaining <= dma_count;
-                            spi_id_sel      <= ctrl_spi_id;
-                            // Read the first SDRAM line, then walk it out
-                            // byte-by-byte to the SPI TX register.
-                            state           <= ST_RD_REQ;
-                        end
-                        else
-                        begin
-                            state <= ST_ERROR;
-                        end
+                        chain_active <= 1'b0;
+                        xfer_mode    <= ctrl_mode;
+                        xfer_spi_id  <= ctrl_spi_id;
+                        xfer_irq     <= 1'b0;
+                        rows_left    <= 16'd1;
+                        state        <= ST_DISPATCH;
                     end
-                    else if (ctrl_mode == MODE_SPI2MEM)
+                end
+            end
+
+            // ---- Validate the active transfer and enter its first state ----
+            // Reached once per register-programmed transfer, once per
+            // descriptor, and once per 2D row, so every segment gets the
+            // same alignment / range checks.
+            ST_DISPATCH:
+            begin
+                if (xfer_mode == MODE_MEM2MEM)
+                begin
+                    if (mem2mem_args_aligned)
                     begin
-                        if (spi2mem_args_aligned && ctrl_spi_id_valid)
-                        begin
-                            dst_cur          <= dma_dst;
-                            bytes_remaining  <= dma_count;
-                            spi_id_sel       <= ctrl_spi_id;
-                            dma_burst_spi_id <= ctrl_spi_id;
-                            spi_byte_idx     <= 6'd0;
-                            line_buf         <= 256'd0;
-                            // Kick off a 32-byte SPI dummy burst; the
-                            // controller will accumulate 32 RX bytes
-                            // which we drain into line_buf, then commit
-                            // the line to SDRAM.
-                            state            <= ST_S2M_BURST;
-                        end
-                        else
-                        begin
-                            state <= ST_ERROR;
-                        end
+                        src_cur         <= dma_src;
+                        dst_cur         <= dma_dst;
+                        bytes_remaining <= dma_count;
+                        state           <= ST_RD_REQ;
                     end
-                    else if (ctrl_mode == MODE_SPI2MEM_QSPI)
+                    else if (count_ok)
                     begin
-                        // QSPI Fast Read is only wired through QSPIflash
-                        // on SPI1 (BRFS flash). Other SPI ids -> error.
-                        // Constrained to a single 32-byte line per call;
-                        // software loops with CS toggle for larger reads.
-                        if (qspi_args_aligned && (ctrl_spi_id == 3'd1))
-                        begin
-                            dst_cur          <= dma_dst;
-                            bytes_remaining  <= dma_count;
-                            spi_id_sel       <= 3'd1;
-                            dma_burst_spi_id <= 3'd1;
-                            spi_byte_idx     <= 6'd0;
-                            line_buf         <= 256'd0;
-                            qspi_addr_cur    <= dma_qspi_addr[23:0];
-                            qspi_burst_open  <= 1'b0;
-                            state            <= ST_S2M_BURST;
-                        end
-                        else
-                        begin
-                            state <= ST_ERROR;
-                        end
+                        src_cur         <= dma_src;
+                        dst_cur         <= dma_dst;
+                        bytes_remaining <= dma_count;
+                        src_line_valid  <= 1'b0;
+                        state           <= ST_U_LINE;
                     end
-                    else if (ctrl_mode == MODE_MEM2VRAM)
+                    else
                     begin
-                        if (mem2vram_args_aligned)
-                        begin
-                            src_cur         <= dma_src;
-                            dst_cur         <= dma_dst;
-                            bytes_remaining <= dma_count;
-                            // First step: read the SDRAM line, then drain
-                            // it into VRAMPX byte-by-byte.
-                            state           <= ST_RD_REQ;
-                        end
-                        else
-                        begin
-                            state <= ST_ERROR;
-                        end
+                        state <= ST_ERROR;
+                    end
+                end
+                else if (xfer_mode == MODE_MEM2SPI)
+                begin
+                    if (count_ok && xfer_spi_id_valid)
+                    begin
+                        src_cur         <= dma_src;
+                        bytes_remaining <= dma_count;
+                        spi_id_sel      <= xfer_spi_id;
+                        // Read the first SDRAM line, then walk it out
+                        // byte-by-byte to the SPI TX register.
+                        state           <= ST_RD_REQ;
                     end
                     else
                     begin
-                        // MEM2IO / IO2MEM not implemented yet.
                         state <= ST_ERROR;
                     end
                 end
+                else if (xfer_mode == MODE_SPI2MEM)
+                begin
+                    if (count_ok && xfer_spi_id_valid)
+                    begin
+                        dst_cur          <= dma_dst;
+                        bytes_remaining  <= dma_count;
+                        spi_id_sel       <= xfer_spi_id;
+                        dma_burst_spi_id <= xfer_spi_id;
+                        // Per destination window: a dummy SPI burst of
+                        // the window size, drained into line_buf, then
+                        // the line is committed to SDRAM.
+                        state            <= ST_S2M_LINE;
+                    end
+                    else
+                    begin
+                        state <= ST_ERROR;
+                    end
+                end
+                else if (xfer_mode == MODE_SPI2MEM_QSPI)
+                begin
+                    // QSPI Fast Read is only wired through QSPIflash
+                    // on SPI1 (BRFS flash). Other SPI ids -> error.
+                    if (count_ok && (xfer_spi_id == 3'd1))
+                    begin
+                        dst_cur          <= dma_dst;
+                        bytes_remaining  <= dma_count;
+                        spi_id_sel       <= 3'd1;
+                        dma_burst_spi_id <= 3'd1;
+                        qspi_addr_cur    <= dma_qspi_addr[23:0];
+                        qspi_burst_open  <= 1'b0;
+                        state            <= ST_S2M_LINE;
+                    end
+                    else
+                    begin
+                        state <= ST_ERROR;
+                    end
+                end
+                else if (xfer_mode == MODE_MEM2VRAM)
+                begin
+                    if (mem2vram_args_ok)
+                    begin
+                        src_cur         <= dma_src;
+                        dst_cur         <= dma_dst;
+                        bytes_remaining <= dma_count;
+                        // First step: read the SDRAM line, then drain
+                        // it into VRAMPX byte-by-byte.
+                        state           <= ST_RD_REQ;
+                    end
+                    else
+                    begin
+                        state <= ST_ERROR;
+                    end
+                end
+                else
+                begin
+                    // MEM2IO / IO2MEM not implemented yet.
+                    state <= ST_ERROR;
+                end
             end
 
             ST_RD_REQ:
@@ -448,20 +570,25 @@ begin
                 begin
                     sd_start <= 1'b0;
                     line_buf <= sd_q;
-                    if (ctrl_mode == MODE_MEM2MEM)
+                    if (xfer_mode == MODE_MEM2MEM)
                         state <= ST_WR_REQ;
-                    else if (ctrl_mode == MODE_MEM2VRAM)
+                    else if (xfer_mode == MODE_MEM2VRAM)
                     begin
-                        // Drain line_buf into VRAMPX one byte per cycle.
-                        spi_byte_idx <= 6'd0;
+                        // Drain the source window into VRAMPX one byte
+                        // per cycle.
+                        spi_byte_idx <= {1'b0, src_cur[4:0]};
+                        line_n       <= src_line_n;
+                        xfer_n       <= 6'd0;
                         state        <= ST_M2V_DRAIN;
                     end
                     else
                     begin
-                        // MEM2SPI: push the line into the SPI TX FIFO,
-                        // then trigger a 32-byte burst.
+                        // MEM2SPI: push the source window into the SPI
+                        // TX FIFO, then trigger a burst of that size.
                         dma_burst_spi_id <= spi_id_sel;
-                        spi_byte_idx     <= 6'd0;
+                        spi_byte_idx     <= {1'b0, src_cur[4:0]};
+                        line_n           <= src_line_n;
+                        xfer_n           <= 6'd0;
                         state            <= ST_M2S_FILL;
                     end
                 end
@@ -482,46 +609,77 @@ begin
                 if (sd_done)
                 begin
                     sd_start <= 1'b0;
-                    if (ctrl_mode == MODE_MEM2MEM)
+                    if (xfer_mode == MODE_MEM2MEM)
                     begin
                         src_cur         <= src_cur + 32'd32;
                         dst_cur         <= dst_cur + 32'd32;
                         bytes_remaining <= bytes_remaining - 32'd32;
                         if (bytes_remaining == 32'd32)
-                            state <= ST_DONE;
+                            state <= ST_SEG_DONE;
                         else
                             state <= ST_RD_REQ;
                     end
                     else
                     begin
-                        // SPI2MEM (and SPI2MEM_QSPI): this line is committed
-                        // to SDRAM, advance and either start the next line
-                        // or finish.
-                        dst_cur         <= dst_cur + 32'd32;
-                        bytes_remaining <= bytes_remaining - 32'd32;
-                        // QSPI: advance the per-burst flash address by 32
-                        // bytes. Harmless for plain SPI2MEM (qspi_addr_cur
-                        // isn't read by ST_S2M_BURST in that mode).
-                        qspi_addr_cur   <= qspi_addr_cur + 24'd32;
-                        if (bytes_remaining == 32'd32)
-                            state <= ST_DONE;
+                        // SPI2MEM (and SPI2MEM_QSPI): this window is
+                        // committed to SDRAM, advance and either start the
+                        // next line or finish.
+                        dst_cur         <= dst_cur + {26'd0, line_n};
+                        bytes_remaining <= bytes_remaining - {26'd0, line_n};
+                        // QSPI: advance the per-burst flash address too.
+                        // Harmless for plain SPI2MEM (qspi_addr_cur isn't
+                        // read by ST_S2M_BURST in that mode).
+                        qspi_addr_cur   <= qspi_addr_cur + {18'd0, line_n};
+                        if (bytes_remaining == {26'd0, line_n})
+                            state <= ST_SEG_DONE;
                         else
-                        begin
-                            spi_byte_idx <= 6'd0;
-                            line_buf     <= 256'd0;
-                            state        <= ST_S2M_BURST;
-                        end
+                            state <= ST_S2M_LINE;
                     end
                 end
             end
 
+            // ---- SPI2MEM: set up the window of the next destination line ----
+            ST_S2M_LINE:
+            begin
+                spi_byte_idx <= {1'b0, dst_cur[4:0]};
+                line_n       <= dst_line_n;
+                xfer_n       <= 6'd0;
+                if (dst_line_n != 6'd32)
+                    state <= ST_RMW_REQ;    // keep the bytes outside the window
+                else
+                    state <= ST_S2M_BURST;
+            end
+
+            // ---- Partial destination line: read it back, merge in place ----
+            ST_RMW_REQ:
+            begin
+                sd_addr  <= dst_cur[25:5];
+                sd_we    <= 1'b0;
+                sd_start <= 1'b1;
+                state    <= ST_RMW_WAIT;
+            end
+
+            ST_RMW_WAIT:
+            begin
+                sd_start <= 1'b1;
+                if (sd_done)
+                begin
+                    sd_start <= 1'b0;
+                    line_buf <= sd_q;
+                    if (xfer_mode == MODE_MEM2MEM)
+                        state <= src_line_valid ? ST_U_COPY : ST_U_SRC_REQ;
+                    else
+                        state <= ST_S2M_BURST;
+                end
+            end
+
             // ---- SPI2MEM burst: kick off, wait, drain RX into line_buf ----
             ST_S2M_BURST:
             begin
                 // Hold dma_burst_select high so SimpleSPI2's command-port
                 // mux routes our signals. Pulse start_burst for one cycle
-                // with dummy=1 so the controller sends 32 zero bytes and
-                // captures 32 RX bytes into its RX FIFO.
+                // with dummy=1 so the controller sends line_n zero bytes
+                // and captures line_n RX bytes into its RX FIFO.
                 //
                 // For MODE_SPI2MEM_QSPI we drive the QSPI Fast Read
                 // controls (cmd_qspi_read + cmd_qspi_addr) so QSPIflash
@@ -530,12 +688,11 @@ begin
                 // burst of the full transfer length so the W25Q stays
                 // in one CS-low transaction; subsequent cache lines in
                 // the same DMA call skip the kickoff and just drain
-                // another 32 bytes from the rolling FIFO. qspi_burst_open
+                // the next window from the rolling FIFO. qspi_burst_open
                 // tracks whether the kickoff has happened.
                 dma_burst_select <= 1'b1;
                 dma_burst_dummy  <= 1'b1;
-                spi_byte_idx     <= 6'd0;
-                if (ctrl_mode == MODE_SPI2MEM_QSPI)
+                if (xfer_mode == MODE_SPI2MEM_QSPI)
                 begin
                     if (!qspi_burst_open)
                     begin
@@ -547,15 +704,15 @@ begin
                         dma_burst_start     <= 1'b1;
                         qspi_burst_open     <= 1'b1;
                     end
-                    // Either way, go to BWAIT which for QSPI waits for a
-                    // full 32-byte line in the FIFO (dma_burst_rx_count
-                    // >= 32) before transitioning to DRAIN.
+                    // Either way, go to BWAIT which for QSPI waits for the
+                    // whole window in the FIFO (dma_burst_rx_count >=
+                    // line_n) before transitioning to DRAIN.
                 end
                 else
                 begin
-                    // Plain SPI2MEM: per-line 32-byte burst as before.
+                    // Plain SPI2MEM: one burst per destination window.
                     dma_burst_qspi_read <= 1'b0;
-                    dma_burst_len       <= 16'd32;
+                    dma_burst_len       <= {10'd0, line_n};
                     dma_burst_start     <= 1'b1;
                 end
                 state            <= ST_S2M_BWAIT;
@@ -564,14 +721,14 @@ begin
             ST_S2M_BWAIT:
             begin
                 dma_burst_select <= 1'b1;
-                if (ctrl_mode == MODE_SPI2MEM_QSPI)
+                if (xfer_mode == MODE_SPI2MEM_QSPI)
                 begin
-                    // Wait until at least one full 32-byte cache line is
-                    // sitting in the RX FIFO. The big burst keeps pushing
-                    // bytes in the background; the FIFO is sized to 32 so
-                    // it never overflows (drain rate 1 byte/cycle is ~8x
-                    // the 4-bit-per-SCK fill rate).
-                    if (dma_burst_rx_count >= 8'd32)
+                    // Wait until the whole window is sitting in the RX
+                    // FIFO. The big burst keeps pushing bytes in the
+                    // background; the FIFO is sized to 32 so it never
+                    // overflows (drain rate 1 byte/cycle is ~8x the
+                    // 4-bit-per-SCK fill rate).
+                    if (dma_burst_rx_count >= {2'd0, line_n})
                     begin
                         dma_burst_re_rx <= 1'b1;
                         state           <= ST_S2M_DRAIN;
@@ -579,7 +736,7 @@ begin
                 end
                 else if (dma_burst_done)
                 begin
-                    // Plain SPI2MEM: wait for the 32-byte burst to finish.
+                    // Plain SPI2MEM: wait for the burst to finish.
                     // Pre-assert re_rx so the controller pops byte 0 on
                     // the first DRAIN cycle (re_rx is an output reg with
                     // a one-cycle propagation delay; capturing rx_data
@@ -600,42 +757,8 @@ begin
                 if (!dma_burst_rx_empty)
                 begin
                     dma_burst_re_rx <= 1'b1;
-                    case (spi_byte_idx)
-                        6'd0:  line_buf[  7:  0] <= dma_burst_rx_data;
-                        6'd1:  line_buf[ 15:  8] <= dma_burst_rx_data;
-                        6'd2:  line_buf[ 23: 16] <= dma_burst_rx_data;
-                        6'd3:  line_buf[ 31: 24] <= dma_burst_rx_data;
-                        6'd4:  line_buf[ 39: 32] <= dma_burst_rx_data;
-                        6'd5:  line_buf[ 47: 40] <= dma_burst_rx_data;
-                        6'd6:  line_buf[ 55: 48] <= dma_burst_rx_data;
-                        6'd7:  line_buf[ 63: 56] <= dma_burst_rx_data;
-                        6'd8:  line_buf[ 71: 64] <= dma_burst_rx_data;
-                        6'd9:  line_buf[ 79: 72] <= dma_burst_rx_data;
-                        6'd10: line_buf[ 87: 80] <= dma_burst_rx_data;
-                        6'd11: line_buf[ 95: 88] <= dma_burst_rx_data;
-                        6'd12: line_buf[103: 96] <= dma_burst_rx_data;
-                        6'd13: line_buf[111:104] <= dma_burst_rx_data;
-                        6'd14: line_buf[119:112] <= dma_burst_rx_data;
-                        6'd15: line_buf[127:120] <= dma_burst_rx_data;
-                        6'd16: line_buf[135:128] <= dma_burst_rx_data;
-                        6'd17: line_buf[143:136] <= dma_burst_rx_data;
-                        6'd18: line_buf[151:144] <= dma_burst_rx_data;
-                        6'd19: line_buf[159:152] <= dma_burst_rx_data;
-                        6'd20: line_buf[167:160] <= dma_burst_rx_data;
-                        6'd21: line_buf[175:168] <= dma_burst_rx_data;
-                        6'd22: line_buf[183:176] <= dma_burst_rx_data;
-                        6'd23: line_buf[191:184] <= dma_burst_rx_data;
-                        6'd24: line_buf[199:192] <= dma_burst_rx_data;
-                        6'd25: line_buf[207:200] <= dma_burst_rx_data;
-                        6'd26: line_buf[215:208] <= dma_burst_rx_data;
-                        6'd27: line_buf[223:216] <= dma_burst_rx_data;
-                        6'd28: line_buf[231:224] <= dma_burst_rx_data;
-                        6'd29: line_buf[239:232] <= dma_burst_rx_data;
-                        6'd30: line_buf[247:240] <= dma_burst_rx_data;
-                        6'd31: line_buf[255:248] <= dma_burst_rx_data;
-                        default: ;
-                    endcase
-                    if (spi_byte_idx == 6'd31)
+                    line_buf[{spi_byte_idx[4:0], 3'b000} +: 8] <= dma_burst_rx_data;
+                    if (xfer_n == line_n - 6'd1)
                     begin
                         // Done draining; release the SPI controller and
                         // commit the line to SDRAM.
@@ -645,60 +768,29 @@ begin
                     else
                     begin
                         spi_byte_idx <= spi_byte_idx + 6'd1;
+                        xfer_n       <= xfer_n + 6'd1;
                     end
                 end
             end
 
-            // ---- MEM2SPI burst: fill TX FIFO, kick off, wait, drain RX ----
+            // ---- MEM2SPI burst: fill TX FIFO with the source window, kick
+            //      off, wait, drain RX ----
             ST_M2S_FILL:
             begin
                 dma_burst_select <= 1'b1;
                 if (!dma_burst_tx_full)
                 begin
                     dma_burst_we <= 1'b1;
-                    case (spi_byte_idx)
-                        6'd0:  dma_burst_data <= line_buf[  7:  0];
-                        6'd1:  dma_burst_data <= line_buf[ 15:  8];
-                        6'd2:  dma_burst_data <= line_buf[ 23: 16];
-                        6'd3:  dma_burst_data <= line_buf[ 31: 24];
-                        6'd4:  dma_burst_data <= line_buf[ 39: 32];
-                        6'd5:  dma_burst_data <= line_buf[ 47: 40];
-                        6'd6:  dma_burst_data <= line_buf[ 55: 48];
-                        6'd7:  dma_burst_data <= line_buf[ 63: 56];
-                        6'd8:  dma_burst_data <= line_buf[ 71: 64];
-                        6'd9:  dma_burst_data <= line_buf[ 79: 72];
-                        6'd10: dma_burst_data <= line_buf[ 87: 80];
-                        6'd11: dma_burst_data <= line_buf[ 95: 88];
-                        6'd12: dma_burst_data <= line_buf[103: 96];
-                        6'd13: dma_burst_data <= line_buf[111:104];
-                        6'd14: dma_burst_data <= line_buf[119:112];
-                        6'd15: dma_burst_data <= line_buf[127:120];
-                        6'd16: dma_burst_data <= line_buf[135:128];
-                        6'd17: dma_burst_data <= line_buf[143:136];
-                        6'd18: dma_burst_data <= line_buf[151:144];
-                        6'd19: dma_burst_data <= line_buf[159:152];
-                        6'd20: dma_burst_data <= line_buf[167:160];
-                        6'd21: dma_burst_data <= line_buf[175:168];
-                        6'd22: dma_burst_data <= line_buf[183:176];
-                        6'd23: dma_burst_data <= line_buf[191:184];
-                        6'd24: dma_burst_data <= line_buf[199:192];
-                        6'd25: dma_burst_data <= line_buf[207:200];
-                        6'd26: dma_burst_data <= line_buf[215:208];
-                        6'd27: dma_burst_data <= line_buf[223:216];
-                        6'd28: dma_burst_data <= line_buf[231:224];
-                        6'd29: dma_burst_data <= line_buf[239:232];
-                        6'd30: dma_burst_data <= line_buf[247:240];
-                        6'd31: dma_burst_data <= line_buf[255:248];
-                        default: ;
-                    endcase
-                    if (spi_byte_idx == 6'd31)
+                    dma_burst_data <= line_buf[{spi_byte_idx[4:0], 3'b000} +: 8];
+                    if (xfer_n == line_n - 6'd1)
                     begin
-                        spi_byte_idx <= 6'd0;
-                        state        <= ST_M2S_BURST;
+                        xfer_n <= 6'd0;
+                        state  <= ST_M2S_BURST;
                     end
                     else
                     begin
                         spi_byte_idx <= spi_byte_idx + 6'd1;
+                        xfer_n       <= xfer_n + 6'd1;
                     end
                 end
             end
@@ -707,7 +799,7 @@ begin
             begin
                 dma_burst_select <= 1'b1;
                 dma_burst_dummy  <= 1'b0;
-                dma_burst_len    <= 16'd32;
+                dma_burst_len    <= {10'd0, line_n};
                 dma_burst_start  <= 1'b1;
                 state            <= ST_M2S_BWAIT;
             end
@@ -719,39 +811,39 @@ begin
                 begin
                     // Pre-assert re_rx (same reasoning as ST_S2M_BWAIT).
                     dma_burst_re_rx <= 1'b1;
-                    spi_byte_idx    <= 6'd0;
+                    xfer_n          <= 6'd0;
                     state           <= ST_M2S_DRAIN;
                 end
             end
 
             ST_M2S_DRAIN:
             begin
-                // Drain the 32 RX bytes pushed by SimpleSPI2 during the
-                // write burst (we don't care about the values, but the
-                // FIFO has to be empty for the next burst).
+                // Drain the RX bytes pushed by SimpleSPI2 during the write
+                // burst (we don't care about the values, but the FIFO has
+                // to be empty for the next burst).
                 dma_burst_select <= 1'b1;
                 if (!dma_burst_rx_empty)
                 begin
                     dma_burst_re_rx <= 1'b1;
-                    if (spi_byte_idx == 6'd31)
+                    if (xfer_n == line_n - 6'd1)
                     begin
-                        // Done with this line.
+                        // Done with this window.
                         dma_burst_select <= 1'b0;
-                        src_cur         <= src_cur + 32'd32;
-                        bytes_remaining <= bytes_remaining - 32'd32;
-                        if (bytes_remaining == 32'd32)
-                            state <= ST_DONE;
+                        src_cur         <= src_cur + {26'd0, line_n};
+                        bytes_remaining <= bytes_remaining - {26'd0, line_n};
+                        if (bytes_remaining == {26'd0, line_n})
+                            state <= ST_SEG_DONE;
                         else
                             state <= ST_RD_REQ;
                     end
                     else
                     begin
-                        spi_byte_idx <= spi_byte_idx + 6'd1;
+                        xfer_n <= xfer_n + 6'd1;
                     end
                 end
             end
 
-            // ---- MEM2VRAM drain: emit 32 line_buf bytes to VRAMPX ----
+            // ---- MEM2VRAM drain: emit the source window to VRAMPX ----
             // vp_we / vp_addr / vp_data are combinational (see assigns at
             // the bottom of the module). This block only advances the
             // engine's bookkeeping when the FIFO actually accepts the
@@ -761,30 +853,193 @@ begin
                 if (!vp_full)
                 begin
                     dst_cur <= dst_cur + 32'd1;
-                    if (spi_byte_idx == 6'd31)
+                    if (xfer_n == line_n - 6'd1)
                     begin
-                        // Whole line emitted. Advance and either fetch
+                        // Whole window emitted. Advance and either fetch
                         // the next line or finish.
-                        src_cur         <= src_cur + 32'd32;
-                        bytes_remaining <= bytes_remaining - 32'd32;
-                        if (bytes_remaining == 32'd32)
-                            state <= ST_DONE;
+                        src_cur         <= src_cur + {26'd0, line_n};
+                        bytes_remaining <= bytes_remaining - {26'd0, line_n};
+                        if (bytes_remaining == {26'd0, line_n})
+                            state <= ST_SEG_DONE;
                         else
                             state <= ST_RD_REQ;
                     end
                     else
                     begin
                         spi_byte_idx <= spi_byte_idx + 6'd1;
+                        xfer_n       <= xfer_n + 6'd1;
                     end
                 end
             end
 
+            // ---- MEM2MEM byte path (any alignment / length) ----
+            // Assemble one destination window at a time in line_buf,
+            // copying byte by byte out of src_line and fetching a new
+            // source line whenever the source cursor crosses one.
+            ST_U_LINE:
+            begin
+                line_n <= dst_line_n;
+                xfer_n <= 6'd0;
+                if (dst_line_n != 6'd32)
+                    state <= ST_RMW_REQ;
+                else if (src_line_valid)
+                    state <= ST_U_COPY;
+                else
+                    state <= ST_U_SRC_REQ;
+            end
+
+            ST_U_SRC_REQ:
+            begin
+                sd_addr  <= src_cur[25:5];
+                sd_we    <= 1'b0;
+                sd_start <= 1'b1;
+                state    <= ST_U_SRC_WAIT;
+            end
+
+            ST_U_SRC_WAIT:
+            begin
+                sd_start <= 1'b1;
+                if (sd_done)
+                begin
+                    sd_start       <= 1'b0;
+                    src_line       <= sd_q;
+                    src_line_valid <= 1'b1;
+                    state          <= ST_U_COPY;
+                end
+            end
+
+            ST_U_COPY:
+            begin
+                line_buf[{dst_cur[4:0], 3'b000} +: 8] <=
+                    src_line[{src_cur[4:0], 3'b000} +: 8];
+                src_cur         <= src_cur + 32'd1;
+                dst_cur         <= dst_cur + 32'd1;
+                bytes_remaining <= bytes_remaining - 32'd1;
+                xfer_n          <= xfer_n + 6'd1;
+                if (src_cur[4:0] == 5'd31)
+                    src_line_valid <= 1'b0;
+                if (xfer_n == line_n - 6'd1)
+                    state <= ST_U_WR_REQ;
+                else if (src_cur[4:0] == 5'd31)
+                    state <= ST_U_SRC_REQ;
+            end
+
+            ST_U_WR_REQ:
+            begin
+                // dst_cur has already moved past the window.
+                sd_addr  <= dst_last[25:5];
+                sd_data  <= line_buf;
+                sd_we    <= 1'b1;
+                sd_start <= 1'b1;
+                state    <= ST_U_WR_WAIT;
+            end
+
+            ST_U_WR_WAIT:
+            begin
+                sd_start <= 1'b1;
+                if (sd_done)
+                begin
+                    sd_start <= 1'b0;
+                    if (bytes_remaining == 32'd0)
+                        state <= ST_SEG_DONE;
+                    else
+                        state <= ST_U_LINE;
+                end
+            end
+
+            // ---- Descriptor chain: fetch, latch, advance ----
+            ST_DESC_REQ:
+            begin
+                if (desc_cur[4:0] != 5'd0)
+                begin
+                    // Descriptors occupy exactly one cache line.
+                    state <= ST_ERROR;
+                end
+                else
+                begin
+                    sd_addr  <= desc_cur[25:5];
+                    sd_we    <= 1'b0;
+                    sd_start <= 1'b1;
+                    state    <= ST_DESC_WAIT;
+                end
+            end
+
+            ST_DESC_WAIT:
+            begin
+                sd_start <= 1'b1;
+                if (sd_done)
+                begin
+                    sd_start      <= 1'b0;
+                    // Load the descriptor into the architectural registers
+                    // so ST_DISPATCH validates it like a CPU-programmed
+                    // transfer (and software can see where a chain failed).
+                    dma_src       <= sd_q[31:0];
+                    dma_dst       <= sd_q[63:32];
+                    dma_count     <= sd_q[95:64];
+                    xfer_mode     <= sd_q[99:96];
+                    xfer_irq      <= sd_q[100];
+                    xfer_spi_id   <= sd_q[103:101];
+                    desc_next     <= sd_q[159:128];
+                    dma_qspi_addr <= sd_q[191:160];
+                    src_stride    <= sd_q[239:224];
+                    dst_stride    <= sd_q[255:240];
+                    if (sd_q[104])
+                    begin
+                        // 2D: rows x count bytes, each row validated on
+                        // its own in ST_DISPATCH.
+                        rows_left <= sd_q[207:192];
+                        if ((sd_q[207:192] == 16'd0) || !desc_2d_mode_ok)
+                            state <= ST_ERROR;
+                        else
+                            state <= ST_DISPATCH;
+                    end
+                    else
+                    begin
+                        rows_left <= 16'd1;
+                        state     <= ST_DISPATCH;
+                    end
+                end
+            end
+
+            ST_SEG_DONE:
+            begin
+                if (rows_left > 16'd1)
+                begin
+                    // Next row of a 2D descriptor.
+                    rows_left <= rows_left - 16'd1;
+                    dma_src   <= dma_src + {16'd0, src_stride};
+                    dma_dst   <= dma_dst + {16'd0, dst_stride};
+                    state     <= ST_DISPATCH;
+                end
+                else if (chain_active)
+                begin
+                    qspi_burst_open <= 1'b0;
+                    if (xfer_irq)
+                    begin
+                        irq         <= 1'b1;
+                        sticky_desc <= 1'b1;
+                    end
+                    if (desc_next == 32'd0)
+                        state <= ST_DONE;
+                    else
+                    begin
+                        desc_cur <= desc_next;
+                        state    <= ST_DESC_REQ;
+                    end
+                end
+                else
+                begin
+                    state <= ST_DONE;
+                end
+            end
+
             ST_DONE:
             begin
                 dma_burst_select <= 1'b0;
                 busy        <= 1'b0;
                 sticky_done <= 1'b1;
                 qspi_burst_open <= 1'b0;
+                chain_active <= 1'b0;
                 if (ctrl_irq_en)
                     irq <= 1'b1;
                 state <= ST_IDLE;
@@ -796,6 +1051,7 @@ begin
                 busy         <= 1'b0;
                 sticky_error <= 1'b1;
                 qspi_burst_open <= 1'b0;
+                chain_active <= 1'b0;
                 if (ctrl_irq_en)
                     irq <= 1'b1;
                 state <= ST_IDLE;
@@ -812,38 +1068,6 @@ end
 // cycle. (See the long comment on the vp_we port declaration.)
 assign vp_we   = (state == ST_M2V_DRAIN) && !vp_full;
 assign vp_addr = dst_cur[16:0];
-assign vp_data =
-    (spi_byte_idx == 6'd0)  ? line_buf[  7:  0] :
-    (spi_byte_idx == 6'd1)  ? line_buf[ 15:  8] :
-    (spi_byte_idx == 6'd2)  ? line_buf[ 23: 16] :
-    (spi_byte_idx == 6'd3)  ? line_buf[ 31: 24] :
-    (spi_byte_idx == 6'd4)  ? line_buf[ 39: 32] :
-    (spi_byte_idx == 6'd5)  ? line_buf[ 47: 40] :
-    (spi_byte_idx == 6'd6)  ? line_buf[ 55: 48] :
-    (spi_byte_idx == 6'd7)  ? line_buf[ 63: 56] :
-    (spi_byte_idx == 6'd8)  ? line_buf[ 71: 64] :
-    (spi_byte_idx == 6'd9)  ? line_buf[ 79: 72] :
-    (spi_byte_idx == 6'd10) ? line_buf[ 87: 80] :
-    (spi_byte_idx == 6'd11) ? line_buf[ 95: 88] :
-    (spi_byte_idx == 6'd12) ? line_buf[103: 96] :
-    (spi_byte_idx == 6'd13) ? line_buf[111:104] :
-    (spi_byte_idx == 6'd14) ? line_buf[119:112] :
-    (spi_byte_idx == 6'd15) ? line_buf[127:120] :
-    (spi_byte_idx == 6'd16) ? line_buf[135:128] :
-    (spi_byte_idx == 6'd17) ? line_buf[143:136] :
-    (spi_byte_idx == 6'd18) ? line_buf[151:144] :
-    (spi_byte_idx == 6'd19) ? line_buf[159:152] :
-    (spi_byte_idx == 6'd20) ? line_buf[167:160] :
-    (spi_byte_idx == 6'd21) ? line_buf[175:168] :
-    (spi_byte_idx == 6'd22) ? line_buf[183:176] :
-    (spi_byte_idx == 6'd23) ? line_buf[191:184] :
-    (spi_byte_idx == 6'd24) ? line_buf[199:192] :
-    (spi_byte_idx == 6'd25) ? line_buf[207:200] :
-    (spi_byte_idx == 6'd26) ? line_buf[215:208] :
-    (spi_byte_idx == 6'd27) ? line_buf[223:216] :
-    (spi_byte_idx == 6'd28) ? line_buf[231:224] :
-    (spi_byte_idx == 6'd29) ? line_buf[239:232] :
-    (spi_byte_idx == 6'd30) ? line_buf[247:240] :
-                              line_buf[255:248];
+assign vp_data = line_buf[{spi_byte_idx[4:0], 3'b000} +: 8];
 
 endmodule
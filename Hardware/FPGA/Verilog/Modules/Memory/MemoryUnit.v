@@ -515,9 +515,11 @@ localparam
     ADDR_DMA_SRC         = 32'h1C000070, // DMA source address (byte)
     ADDR_DMA_DST         = 32'h1C000074, // DMA destination address (byte)
     ADDR_DMA_COUNT       = 32'h1C000078, // DMA byte count
-    ADDR_DMA_CTRL        = 32'h1C00007C, // DMA control: [3:0] mode, [4] irq_en, [7:5] sub-target, [31] start
-    ADDR_DMA_STATUS      = 32'h1C000080, // DMA status: [0] busy, [1] done, [2] error (sticky, read-clear)
-    ADDR_DMA_QSPI_ADDR   = 32'h1C000084; // DMA QSPI Fast Read source address (24-bit byte offset into flash)
+    ADDR_DMA_CTRL        = 32'h1C00007C, // DMA control: [3:0] mode, [4] irq_en, [7:5] sub-target, [8] chain, [31] start
+    ADDR_DMA_STATUS      = 32'h1C000080, // DMA status: [0] busy, [1] done, [2] error, [3] desc (sticky, read-clear)
+    ADDR_DMA_QSPI_ADDR   = 32'h1C000084, // DMA QSPI Fast Read source address (24-bit byte offset into flash)
+    ADDR_DMA_DESC        = 32'h1C000088, // DMA descriptor chain head (SDRAM byte address, 32-byte aligned)
+    ADDR_DMA_DESC_CUR    = 32'h1C00008C; // DMA descriptor being executed (read-only)
 
 // ---- State encoding ----
 localparam
@@ -922,6 +924,20 @@ always @(posedge clk) begin
                         dma_reg_data <= data;
                         state        <= STATE_RETURN_DMA_REG;
                     end
+                    else if (addr == ADDR_DMA_DESC)
+                    begin
+                        dma_reg_addr <= 3'd6;
+                        dma_reg_we   <= we;
+                        dma_reg_data <= data;
+                        state        <= STATE_RETURN_DMA_REG;
+                    end
+                    else if (addr == ADDR_DMA_DESC_CUR)
+                    begin
+                        dma_reg_addr <= 3'd7;
+                        dma_reg_we   <= 1'b0; // read-only
+                        dma_reg_data <= 32'd0;
+                        state        <= STATE_RETURN_DMA_REG;
+                    end
                     else
                     begin
                         // Out of range or unhandled address
@@ -23,6 +23,9 @@
  *    fire-and-wait) and was added to fix a deadlock where the CPU cache
  *    controller's one-cycle `cpu_start` was silently dropped if it arrived
  *    while the DMA held the bus.
+ *  - The DMA port carries a per-byte write mask (`dma_mask`, bit i = byte i
+ *    of the line) so partial-line DMA writes leave the other bytes of the
+ *    line untouched in SDRAM. CPU (cache) writes always write the full line.
  */
 module SDRAMarbiter (
     input  wire         clk,
@@ -40,6 +43,7 @@ module SDRAMarbiter (
     input  wire [20:0]  dma_addr,
     input  wire [255:0] dma_data,
     input  wire         dma_we,
+    input  wire [31:0]  dma_mask,
     input  wire         dma_start,
     output wire         dma_done,
     output wire [255:0] dma_q,
@@ -48,6 +52,7 @@ module SDRAMarbiter (
     output wire [20:0]  sdc_addr,
     output wire [255:0] sdc_data,
     output wire         sdc_we,
+    output wire [31:0]  sdc_mask,
     output wire         sdc_start,
     input  wire         sdc_done,
     input  wire [255:0] sdc_q
@@ -68,6 +73,7 @@ reg          dma_pend_valid = 1'b0;
 reg [20:0]   dma_pend_addr  = 21'd0;
 reg [255:0]  dma_pend_data  = 256'd0;
 reg          dma_pend_we    = 1'b0;
+reg [31:0]   dma_pend_mask  = 32'd0;
 
 // Effective request signals: either a fresh pulse or a pending latched
 // request still waiting for grant.
@@ -85,6 +91,7 @@ wire         eff_cpu_we   = cpu_pend_valid ? cpu_pend_we   : cpu_we;
 wire [20:0]  eff_dma_addr = dma_pend_valid ? dma_pend_addr : dma_addr;
 wire [255:0] eff_dma_data = dma_pend_valid ? dma_pend_data : dma_data;
 wire         eff_dma_we   = dma_pend_valid ? dma_pend_we   : dma_we;
+wire [31:0]  eff_dma_mask = dma_pend_valid ? dma_pend_mask : dma_mask;
 
 always @(posedge clk)
 begin
@@ -137,6 +144,7 @@ begin
             dma_pend_addr  <= dma_addr;
             dma_pend_data  <= dma_data;
             dma_pend_we    <= dma_we;
+            dma_pend_mask  <= dma_mask;
         end
     end
 end
@@ -148,6 +156,7 @@ wire route_dma = busy ? owner : grant_dma;
 assign sdc_addr  = route_dma ? eff_dma_addr : eff_cpu_addr;
 assign sdc_data  = route_dma ? eff_dma_data : eff_cpu_data;
 assign sdc_we    = route_dma ? eff_dma_we   : eff_cpu_we;
+assign sdc_mask  = route_dma ? eff_dma_mask : 32'hFFFFFFFF;
 assign sdc_start = grant_cpu | grant_dma;
 
 assign cpu_done = busy && !owner && sdc_done;
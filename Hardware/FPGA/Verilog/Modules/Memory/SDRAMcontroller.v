@@ -4,6 +4,8 @@
  * Should run at 100MHz (with the SDRAM_CLK outside of this module at 180 degrees phase shifted)
  * Uses a 256 bit bus to the CPU/Cache controller
  * The address is given in 256 bit words, not in bytes
+ * Writes take a 32 bit byte enable (cpu_mask, bit i = byte i of the line, which
+ * is cpu_data[8*i+7:8*i]); cleared bits are held off with DQM during the burst
  *
  * Some calculations:
  * - SDRAMx2 size: 64MiB (16M x 32 x 4 banks) -> 16 MiWords -> 2 MiLines (256 bits per line)
@@ -18,6 +20,7 @@ module SDRAMcontroller (
     input wire  [20:0]  cpu_addr,
     input wire  [255:0] cpu_data,
     input wire          cpu_we,
+    input wire  [31:0]  cpu_mask,
     input wire          cpu_start,
     output reg          cpu_done = 1'b0,
     output reg  [255:0] cpu_q = 256'd0,
@@ -104,6 +107,7 @@ reg cpu_new_request = 1'b0;
 reg [20:0] cpu_addr_stored = 21'd0;
 reg [255:0] cpu_data_stored = 256'd0;
 reg cpu_we_stored = 1'b0;
+reg [31:0] cpu_mask_stored = 32'd0;
 
 always @(posedge clk)
 begin
@@ -130,6 +134,7 @@ begin
         cpu_addr_stored <= 21'd0;
         cpu_data_stored <= 256'd0;
         cpu_we_stored   <= 1'b0;
+        cpu_mask_stored <= 32'd0;
     end
     else
     begin
@@ -156,6 +161,7 @@ begin
             cpu_addr_stored <= cpu_addr;
             cpu_data_stored <= cpu_data;
             cpu_we_stored   <= cpu_we;
+            cpu_mask_stored <= cpu_mask;
         end
 
         case (state)
@@ -272,6 +278,7 @@ begin
                     begin
                         // First word in burst (start with highest word)
                         SDRAM_DATA  <= cpu_data_stored[255:224];
+                        SDRAM_DQM   <= ~cpu_mask_stored[31:28];
                         SDRAM_DQ_OE <= 1'b1;
                         SDRAM_CMD   <= CMD_WRITE;
                         SDRAM_A     <= {4'b0010, cpu_addr_stored[5:0], 3'd0}; // Column address with auto-precharge
@@ -281,42 +288,49 @@ begin
                     16'd1:
                     begin
                         SDRAM_DATA  <= cpu_data_stored[223:192];
+                        SDRAM_DQM   <= ~cpu_mask_stored[27:24];
                         SDRAM_DQ_OE <= 1'b1;
                         wait_counter <= wait_counter + 1'b1;
                     end
                     16'd2:
                     begin
                         SDRAM_DATA  <= cpu_data_stored[191:160];
+                        SDRAM_DQM   <= ~cpu_mask_stored[23:20];
                         SDRAM_DQ_OE <= 1'b1;
                         wait_counter <= wait_counter + 1'b1;
                     end
                     16'd3:
                     begin
                         SDRAM_DATA  <= cpu_data_stored[159:128];
+                        SDRAM_DQM   <= ~cpu_mask_stored[19:16];
                         SDRAM_DQ_OE <= 1'b1;
                         wait_counter <= wait_counter + 1'b1;
                     end
                     16'd4:
                     begin
                         SDRAM_DATA  <= cpu_data_stored[127:96];
+                        SDRAM_DQM   <= ~cpu_mask_stored[15:12];
                         SDRAM_DQ_OE <= 1'b1;
                         wait_counter <= wait_counter + 1'b1;
                     end
                     16'd5:
                     begin
                         SDRAM_DATA  <= cpu_data_stored[95:64];
+                        SDRAM_DQM   <= ~cpu_mask_stored[11:8];
                         SDRAM_DQ_OE <= 1'b1;
                         wait_counter <= wait_counter + 1'b1;
                     end
                     16'd6:
                     begin
                         SDRAM_DATA  <= cpu_data_stored[63:32];
+                        SDRAM_DQM   <= ~cpu_mask_stored[7:4];
                         SDRAM_DQ_OE <= 1'b1;
                         wait_counter <= wait_counter + 1'b1;
                     end
                     16'd7:
                     begin
                         SDRAM_DATA  <= cpu_data_stored[31:0];
+                        SDRAM_DQM   <= ~cpu_mask_stored[3:0];
                         SDRAM_DQ_OE <= 1'b1;
                         wait_counter <= wait_counter + 1'b1;
                         // We can already set cpu_done here for write requests
@@ -117,6 +117,7 @@ mt48lc16m16a2 #(
 wire [20:0]     sdc_addr;
 wire [255:0]    sdc_data;
 wire            sdc_we;
+wire [31:0]     sdc_mask;
 wire            sdc_start;
 wire            sdc_done;
 wire [255:0]    sdc_q;
@@ -128,6 +129,7 @@ SDRAMcontroller sdc (
     .cpu_addr(sdc_addr),
     .cpu_data(sdc_data),
     .cpu_we(sdc_we),
+    .cpu_mask(sdc_mask),
     .cpu_start(sdc_start),
     .cpu_done(sdc_done),
     .cpu_q(sdc_q),
@@ -437,6 +439,7 @@ wire [255:0]    cpu_sdc_q;
 wire [20:0]     dma_sd_addr;
 wire [255:0]    dma_sd_data;
 wire            dma_sd_we;
+wire [31:0]     dma_sd_mask;
 wire            dma_sd_start;
 wire            dma_sd_done;
 wire [255:0]    dma_sd_q;
@@ -491,6 +494,7 @@ SDRAMarbiter sdram_arb (
     .dma_addr(dma_sd_addr),
     .dma_data(dma_sd_data),
     .dma_we(dma_sd_we),
+    .dma_mask(dma_sd_mask),
     .dma_start(dma_sd_start),
     .dma_done(dma_sd_done),
     .dma_q(dma_sd_q),
@@ -498,6 +502,7 @@ SDRAMarbiter sdram_arb (
     .sdc_addr(sdc_addr),
     .sdc_data(sdc_data),
     .sdc_we(sdc_we),
+    .sdc_mask(sdc_mask),
     .sdc_start(sdc_start),
     .sdc_done(sdc_done),
     .sdc_q(sdc_q)
@@ -703,6 +708,7 @@ DMAengine dma_engine (
     .sd_addr(dma_sd_addr),
     .sd_data(dma_sd_data),
     .sd_we(dma_sd_we),
+    .sd_mask(dma_sd_mask),
     .sd_start(dma_sd_start),
     .sd_done(dma_sd_done),
     .sd_q(dma_sd_q),
@@ -813,15 +819,48 @@ B32P3 cpu (
     .interrupts({7'd0}) // We disable interrupts for the CPU tests, as otherwise they will mess up the tests run from RAM (until they have interrupt handling implemented)
 );
 
+// Optional waveform dump for cpu_tests.py/c_tests.py --trace: +trace
+// writes cpu_tests.vcd, or the file named by +dumpfile=. Verilator builds
+// without --trace define NO_WAVES.
+`ifndef NO_WAVES
+reg [8*512-1:0] dumpfile;
+initial begin
+    if ($test$plusargs("trace")) begin
+        if (!$value$plusargs("dumpfile=%s", dumpfile))
+            dumpfile = "cpu_tests.vcd";
+        $dumpfile(dumpfile);
+        $dumpvars(0, cpu_tb);
+    end
+end
+`endif
+
 // 100 MHz clock
 always begin
     #5 clk = ~clk;
 end
 
+// Stall accounting, reported at the end for Scripts/Tests/c_tests.py.
+// Each stalled cycle is counted once, under the stall that froze the
+// most stages.
+integer stall_use = 0;
+integer stall_line = 0;
+integer stall_backend = 0;
+always @(posedge clk) begin
+    if (cpu.pipeline_controller.backend_stall)
+        stall_backend = stall_backend + 1;
+    else if (cpu.pipeline_controller.cache_line_hazard)
+        stall_line = stall_line + 1;
+    else if (cpu.pipeline_controller.load_use_hazard ||
+             cpu.pipeline_controller.pop_use_hazard)
+        stall_use = stall_use + 1;
+end
+
 integer clk_counter = 0;
 always @(posedge clk) begin
     clk_counter = clk_counter + 1;
     if (clk_counter == 30000) begin
+        $display("Stalls: load-use %0d, cache-line %0d, backend %0d",
+                 stall_use, stall_line, stall_backend);
         $display("Simulation finished.");
         $finish;
     end
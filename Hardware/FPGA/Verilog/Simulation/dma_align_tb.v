@@ -0,0 +1,681 @@
+/*
+ * Randomized alignment / length sweep for the DMAengine.
+ * Designed to be used with the Icarus Verilog simulator
+ *
+ * The engine runs standalone against behavioural models:
+ *   - an SDRAM line store with random latency (sd_* port),
+ *   - a VRAMPX byte sink with a randomly asserted full flag (vp_* port),
+ *   - a SimpleSPI2-like burst port (dma_burst_*): 32-entry TX/RX FIFOs,
+ *     combinational rx_data, one byte every few cycles, done pulse.
+ *
+ * Each iteration picks a mode (MEM2MEM, MEM2VRAM, SPI2MEM, MEM2SPI), a
+ * random source/destination byte offset and a random length, runs the
+ * transfer, and compares the whole destination memory against a
+ * reference model, so bytes around a partial line must survive the
+ * read-modify-write. A quarter of the runs are fully aligned, which keeps
+ * the MEM2MEM line-at-a-time fast path covered.
+ *
+ * A second phase runs random descriptor chains of one to three
+ * descriptors. The last one is a 2D MEM2VRAM blit; the others are MEM2MEM
+ * or MEM2VRAM, 1D or 2D, with random row counts, strides and IRQ bits.
+ * The data, DMA_DESC_CUR, the status bits and the number of interrupts
+ * are checked. In a quarter of the chains the last row of the blit ends
+ * past VRAMPX, which must stop the chain with error set after the rows
+ * before it. Two directed cases check that a 2D descriptor with no rows,
+ * or with a mode other than MEM2MEM / MEM2VRAM, is rejected.
+ *
+ * Pass/fail is reported on stdout; the process exits via $finish either
+ * way. Run with: make sim-dma-align
+ */
+`timescale 1ns / 1ps
+
+`include "Hardware/FPGA/Verilog/Modules/IO/DMAengine.v"
+
+module dma_align_tb ();
+
+parameter ITERATIONS = 400;
+parameter CHAINS     = 100;
+parameter SEED       = 1;
+
+localparam LINES     = 1024;          // 32 KiB of modelled SDRAM
+localparam SRC_BASE  = 32'h0000;      // sources live in [0x0000, 0x3000)
+localparam DST_BASE  = 32'h4000;      // destinations in [0x4000, 0x7000)
+localparam MAX_LEN   = 300;
+localparam VRAM_BASE = 32'h1EC00000;
+localparam DESC_BASE = 32'h7000;      // descriptors in [0x7000, 0x8000)
+
+localparam MODE_MEM2MEM  = 4'd0;
+localparam MODE_MEM2SPI  = 4'd1;
+localparam MODE_SPI2MEM  = 4'd2;
+localparam MODE_MEM2VRAM = 4'd3;
+
+reg clk   = 1'b0;
+reg reset = 1'b1;
+
+always #5 clk = ~clk;
+
+integer seed = SEED;
+
+// ---- Register bus ----
+reg  [2:0]  reg_addr = 3'd0;
+reg         reg_we   = 1'b0;
+reg  [31:0] reg_data = 32'd0;
+wire [31:0] reg_q;
+
+// ---- SDRAM line model ----
+reg  [255:0] sdram   [0:LINES-1];
+reg  [255:0] ref_mem [0:LINES-1];
+
+wire [20:0]  sd_addr;
+wire [255:0] sd_data;
+wire         sd_we;
+wire         sd_start;
+reg          sd_done = 1'b0;
+reg  [255:0] sd_q    = 256'd0;
+
+reg          sd_busy  = 1'b0;
+reg  [3:0]   sd_lat   = 4'd0;
+reg  [20:0]  sd_addr_l = 21'd0;
+reg  [255:0] sd_data_l = 256'd0;
+reg          sd_we_l  = 1'b0;
+
+always @(posedge clk)
+begin
+    sd_done <= 1'b0;
+    // Like the SDRAMarbiter, take sd_start as a one-cycle request; a start
+    // while one is outstanding would be queued as a second request there.
+    if (sd_start && (sd_busy || sd_done))
+    begin
+        $display("FAIL: sd_start while a request is outstanding");
+        $finish;
+    end
+    if (!sd_busy)
+    begin
+        if (sd_start)
+        begin
+            sd_busy   <= 1'b1;
+            sd_lat    <= $random(seed) & 4'h7;
+            sd_addr_l <= sd_addr;
+            sd_data_l <= sd_data;
+            sd_we_l   <= sd_we;
+        end
+    end
+    else if (sd_lat != 4'd0)
+        sd_lat <= sd_lat - 4'd1;
+    else
+    begin
+        if (sd_we_l)
+            sdram[sd_addr_l] <= sd_data_l;
+        else
+            sd_q <= sdram[sd_addr_l];
+        sd_done <= 1'b1;
+        sd_busy <= 1'b0;
+    end
+end
+
+// ---- VRAMPX byte sink ----
+reg  [7:0]  vram     [0:131071];
+reg  [7:0]  ref_vram [0:131071];
+wire        vp_we;
+wire [16:0] vp_addr;
+wire [7:0]  vp_data;
+reg         vp_full = 1'b0;
+
+always @(posedge clk)
+begin
+    vp_full <= (($random(seed) & 3) == 0);
+    if (vp_we)
+        vram[vp_addr] <= vp_data;
+end
+
+// ---- SPI burst port (SimpleSPI2 FIFO semantics) ----
+wire [2:0]  dma_burst_spi_id;
+wire        dma_burst_select;
+wire        dma_burst_we;
+wire [7:0]  dma_burst_data;
+wire        dma_burst_start;
+wire [15:0] dma_burst_len;
+wire        dma_burst_dummy;
+wire        dma_burst_re_rx;
+wire        dma_burst_qspi_read;
+wire [23:0] dma_burst_qspi_addr;
+
+reg  [7:0]  tx_mem [0:31];
+reg  [7:0]  rx_mem [0:31];
+reg  [5:0]  tx_wr = 6'd0;
+reg  [5:0]  tx_rd = 6'd0;
+reg  [5:0]  rx_wr = 6'd0;
+reg  [5:0]  rx_rd = 6'd0;
+wire [5:0]  tx_count = tx_wr - tx_rd;
+wire [5:0]  rx_count = rx_wr - rx_rd;
+
+wire        dma_burst_tx_full  = (tx_count == 6'd32);
+wire        dma_burst_rx_empty = (rx_count == 6'd0);
+wire [7:0]  dma_burst_rx_data  = rx_mem[rx_rd[4:0]];
+wire [7:0]  dma_burst_rx_count = {2'd0, rx_count};
+reg         dma_burst_busy = 1'b0;
+reg         dma_burst_done = 1'b0;
+
+reg  [7:0]  spi_in  [0:MAX_LEN-1];    // bytes the "device" returns
+reg  [7:0]  spi_out [0:MAX_LEN-1];    // bytes the engine sent
+integer     spi_in_ptr  = 0;
+integer     spi_out_ptr = 0;
+reg  [15:0] burst_left  = 16'd0;
+reg         burst_dummy = 1'b0;
+reg  [1:0]  burst_tick  = 2'd0;
+
+always @(posedge clk)
+begin
+    dma_burst_done <= 1'b0;
+
+    if (dma_burst_select && dma_burst_we && !dma_burst_tx_full)
+    begin
+        tx_mem[tx_wr[4:0]] <= dma_burst_data;
+        tx_wr <= tx_wr + 6'd1;
+    end
+    if (dma_burst_select && dma_burst_re_rx && !dma_burst_rx_empty)
+        rx_rd <= rx_rd + 6'd1;
+
+    if (!dma_burst_busy)
+    begin
+        if (dma_burst_select && dma_burst_start)
+        begin
+            if (dma_burst_len == 16'd0 || dma_burst_len > 16'd32)
+            begin
+                $display("FAIL: burst length %0d", dma_burst_len);
+                $finish;
+            end
+            dma_burst_busy <= 1'b1;
+            burst_left     <= dma_burst_len;
+            burst_dummy    <= dma_burst_dummy;
+            burst_tick     <= 2'd0;
+        end
+    end
+    else
+    begin
+        burst_tick <= burst_tick + 2'd1;
+        if (burst_tick == 2'd3)
+        begin
+            // One byte shifted out and one shifted in.
+            if (burst_dummy)
+            begin
+                rx_mem[rx_wr[4:0]] <= spi_in[spi_in_ptr];
+                spi_in_ptr = spi_in_ptr + 1;
+            end
+            else
+            begin
+                spi_out[spi_out_ptr] = tx_mem[tx_rd[4:0]];
+                spi_out_ptr = spi_out_ptr + 1;
+                tx_rd <= tx_rd + 6'd1;
+                rx_mem[rx_wr[4:0]] <= 8'hFF;
+            end
+            rx_wr <= rx_wr + 6'd1;
+            burst_left <= burst_left - 16'd1;
+            if (burst_left == 16'd1)
+            begin
+                dma_burst_busy <= 1'b0;
+                dma_burst_done <= 1'b1;
+            end
+        end
+    end
+end
+
+wire irq;
+reg  irq_d     = 1'b0;
+integer irq_count = 0;
+
+// The InterruptController edge-detects, so count rising edges.
+always @(posedge clk)
+begin
+    irq_d <= irq;
+    if (irq && !irq_d)
+        irq_count = irq_count + 1;
+end
+
+wire iop_start, iop_we;
+wire [31:0] iop_addr;
+wire [31:0] iop_data;
+
+DMAengine dut (
+    .clk                 (clk),
+    .reset               (reset),
+    .reg_addr            (reg_addr),
+    .reg_we              (reg_we),
+    .reg_data            (reg_data),
+    .reg_q               (reg_q),
+    .sd_addr             (sd_addr),
+    .sd_data             (sd_data),
+    .sd_we               (sd_we),
+    .sd_start            (sd_start),
+    .sd_done             (sd_done),
+    .sd_q                (sd_q),
+    .iop_start           (iop_start),
+    .iop_we              (iop_we),
+    .iop_addr            (iop_addr),
+    .iop_data            (iop_data),
+    .iop_done            (1'b0),
+    .iop_q               (32'd0),
+    .dma_burst_spi_id    (dma_burst_spi_id),
+    .dma_burst_select    (dma_burst_select),
+    .dma_burst_we        (dma_burst_we),
+    .dma_burst_data      (dma_burst_data),
+    .dma_burst_start     (dma_burst_start),
+    .dma_burst_len       (dma_burst_len),
+    .dma_burst_dummy     (dma_burst_dummy),
+    .dma_burst_re_rx     (dma_burst_re_rx),
+    .dma_burst_qspi_read (dma_burst_qspi_read),
+    .dma_burst_qspi_addr (dma_burst_qspi_addr),
+    .dma_burst_tx_full   (dma_burst_tx_full),
+    .dma_burst_rx_empty  (dma_burst_rx_empty),
+    .dma_burst_rx_data   (dma_burst_rx_data),
+    .dma_burst_rx_count  (dma_burst_rx_count),
+    .dma_burst_busy      (dma_burst_busy),
+    .dma_burst_done      (dma_burst_done),
+    .vp_we               (vp_we),
+    .vp_addr             (vp_addr),
+    .vp_data             (vp_data),
+    .vp_full             (vp_full),
+    .irq                 (irq)
+);
+
+// ---- Helpers ----
+task reg_write;
+    input [2:0]  addr;
+    input [31:0] data;
+    begin
+        @(posedge clk);
+        reg_addr <= addr;
+        reg_data <= data;
+        reg_we   <= 1'b1;
+        @(posedge clk);
+        reg_we   <= 1'b0;
+        reg_addr <= 3'd0;
+    end
+endtask
+
+task set_byte;
+    input [31:0] addr;
+    input [7:0]  value;
+    begin
+        sdram[addr[14:5]][{addr[4:0], 3'b000} +: 8]   = value;
+        ref_mem[addr[14:5]][{addr[4:0], 3'b000} +: 8] = value;
+    end
+endtask
+
+task set_ref_byte;
+    input [31:0] addr;
+    input [7:0]  value;
+    begin
+        ref_mem[addr[14:5]][{addr[4:0], 3'b000} +: 8] = value;
+    end
+endtask
+
+function [7:0] get_byte;
+    input [31:0] addr;
+    begin
+        get_byte = sdram[addr[14:5]][{addr[4:0], 3'b000} +: 8];
+    end
+endfunction
+
+// Start a transfer and wait for it to finish; returns STATUS bits.
+reg [3:0] status;
+integer   timeout;
+task run_dma;
+    input [3:0]  mode;
+    input [31:0] src;
+    input [31:0] dst;
+    input [31:0] count;
+    begin
+        reg_write(3'd0, src);
+        reg_write(3'd1, dst);
+        reg_write(3'd2, count);
+        reg_write(3'd3, 32'h80000000 | {28'd0, mode});   // start, spi id 0
+        @(posedge clk);
+        @(posedge clk);
+        timeout = 0;
+        while (dut.busy && timeout < 200000)
+        begin
+            @(posedge clk);
+            timeout = timeout + 1;
+        end
+        status = {dut.sticky_desc, dut.sticky_error, dut.sticky_done, dut.busy};
+    end
+endtask
+
+// Start the chain at head and wait for it to finish.
+task run_chain;
+    input [31:0] head;
+    input        irq_en;
+    begin
+        reg_write(3'd6, head);
+        reg_write(3'd3, 32'h80000100 | {27'd0, irq_en, 4'd0});
+        @(posedge clk);
+        @(posedge clk);
+        timeout = 0;
+        while (dut.busy && timeout < 400000)
+        begin
+            @(posedge clk);
+            timeout = timeout + 1;
+        end
+        // Let a trailing interrupt pulse be counted.
+        repeat (2) @(posedge clk);
+        status = {dut.sticky_desc, dut.sticky_error, dut.sticky_done, dut.busy};
+    end
+endtask
+
+// Write one descriptor line (also into the reference, it is SDRAM data).
+task put_desc;
+    input [31:0] addr;
+    input [31:0] d_src;
+    input [31:0] d_dst;
+    input [31:0] d_count;
+    input [31:0] d_ctrl;
+    input [31:0] d_next;
+    input [15:0] d_rows;
+    input [15:0] d_sstride;
+    input [15:0] d_dstride;
+    begin
+        sdram[addr[14:5]] = {d_dstride, d_sstride, 16'd0, d_rows, 32'd0,
+                             d_next, d_ctrl, d_count, d_dst, d_src};
+        ref_mem[addr[14:5]] = sdram[addr[14:5]];
+    end
+endtask
+
+// ---- Sweep ----
+integer iter, i, errors, mode_sel;
+integer src_off, dst_off, len, vdst;
+reg [31:0] src, dst;
+reg [3:0]  mode;
+integer    runs [0:3];
+
+// Chain phase: per-descriptor parameters (up to three descriptors).
+integer    chain, chain_runs, ndesc, d, r, exp_irqs;
+reg        chain_irq, want_fail, exp_desc;
+reg [31:0] c_addr [0:2];
+reg [31:0] c_src  [0:2];
+reg [31:0] c_dst  [0:2];
+integer    c_len  [0:2];
+integer    c_rows [0:2];
+integer    c_good [0:2];
+reg [15:0] c_ss   [0:2];
+reg [15:0] c_ds   [0:2];
+reg        c_vram [0:2];
+reg        c_2d   [0:2];
+reg        c_irq  [0:2];
+
+initial
+begin
+    errors = 0;
+    chain_runs = 0;
+    for (i = 0; i < 4; i = i + 1)
+        runs[i] = 0;
+    for (i = 0; i < LINES; i = i + 1)
+    begin
+        sdram[i]   = {$random(seed), $random(seed), $random(seed), $random(seed),
+                      $random(seed), $random(seed), $random(seed), $random(seed)};
+        ref_mem[i] = sdram[i];
+    end
+    for (i = 0; i < 131072; i = i + 1)
+    begin
+        vram[i]     = 8'h00;
+        ref_vram[i] = 8'h00;
+    end
+
+    repeat (4) @(posedge clk);
+    reset = 1'b0;
+
+    // COUNT == 0 is the only argument error left for MEM2MEM.
+    run_dma(MODE_MEM2MEM, SRC_BASE + 3, DST_BASE + 5, 32'd0);
+    if (status != 4'b0100)
+    begin
+        $display("FAIL: count=0 status=%b", status);
+        errors = errors + 1;
+    end
+
+    for (iter = 0; iter < ITERATIONS && errors == 0; iter = iter + 1)
+    begin
+        mode_sel = {$random(seed)} % 4;
+        src_off  = {$random(seed)} % (32'h3000 - MAX_LEN);
+        dst_off  = {$random(seed)} % (32'h3000 - MAX_LEN);
+        len      = 1 + {$random(seed)} % MAX_LEN;
+        if (({$random(seed)} % 4) == 0)
+        begin
+            // Aligned run (MEM2MEM fast path, full windows elsewhere).
+            src_off = src_off & ~31;
+            dst_off = dst_off & ~31;
+            len     = (len + 31) & ~31;
+            if (len > MAX_LEN)
+                len = len - 32;
+        end
+
+        // Fresh source contents so stale data cannot pass the compare.
+        for (i = 0; i < len; i = i + 1)
+            set_byte(SRC_BASE + src_off + i, $random(seed));
+        for (i = 0; i < len; i = i + 1)
+            spi_in[i] = $random(seed);
+        spi_in_ptr  = 0;
+        spi_out_ptr = 0;
+
+        case (mode_sel)
+            0: begin
+                mode = MODE_MEM2MEM;
+                src  = SRC_BASE + src_off;
+                dst  = DST_BASE + dst_off;
+                for (i = 0; i < len; i = i + 1)
+                    set_ref_byte(dst + i, get_byte(src + i));
+            end
+            1: begin
+                mode = MODE_MEM2SPI;
+                src  = SRC_BASE + src_off;
+                dst  = 32'd0;
+            end
+            2: begin
+                mode = MODE_SPI2MEM;
+                src  = 32'd0;
+                dst  = DST_BASE + dst_off;
+                for (i = 0; i < len; i = i + 1)
+                    set_ref_byte(dst + i, spi_in[i]);
+            end
+            default: begin
+                mode = MODE_MEM2VRAM;
+                src  = SRC_BASE + src_off;
+                dst  = VRAM_BASE + ({$random(seed)} % (32'h20000 - len));
+                for (i = 0; i < len; i = i + 1)
+                    ref_vram[dst[16:0] + i] = get_byte(src + i);
+            end
+        endcase
+        runs[mode_sel] = runs[mode_sel] + 1;
+
+        run_dma(mode, src, dst, len);
+
+        if (status != 4'b0010)
+        begin
+            $display("FAIL: iter %0d mode %0d src 0x%h dst 0x%h len %0d: status=%b",
+                     iter, mode, src, dst, len, status);
+            errors = errors + 1;
+        end
+
+        for (i = 0; i < LINES; i = i + 1)
+            if (sdram[i] !== ref_mem[i])
+            begin
+                $display("FAIL: iter %0d mode %0d src 0x%h dst 0x%h len %0d: line 0x%h differs",
+                         iter, mode, src, dst, len, i << 5);
+                $display("  got 0x%h", sdram[i]);
+                $display("  exp 0x%h", ref_mem[i]);
+                errors = errors + 1;
+            end
+
+        if (mode == MODE_MEM2VRAM)
+        begin
+            // The window plus 32 bytes either side must match.
+            vdst = dst[16:0];
+            for (i = vdst - 32; i < vdst + len + 32; i = i + 1)
+                if (i >= 0 && i < 131072 && vram[i] !== ref_vram[i])
+                begin
+                    $display("FAIL: iter %0d MEM2VRAM dst 0x%h len %0d: vram 0x%h differs",
+                             iter, dst, len, i);
+                    errors = errors + 1;
+                end
+        end
+
+        if (mode == MODE_MEM2SPI)
+        begin
+            if (spi_out_ptr != len)
+            begin
+                $display("FAIL: iter %0d MEM2SPI src 0x%h len %0d: %0d bytes sent",
+                         iter, src, len, spi_out_ptr);
+                errors = errors + 1;
+            end
+            for (i = 0; i < len && i < spi_out_ptr; i = i + 1)
+                if (spi_out[i] !== get_byte(src + i))
+                begin
+                    $display("FAIL: iter %0d MEM2SPI src 0x%h len %0d: byte %0d differs",
+                             iter, src, len, i);
+                    errors = errors + 1;
+                end
+        end
+
+        if (mode == MODE_SPI2MEM && spi_in_ptr != len)
+        begin
+            $display("FAIL: iter %0d SPI2MEM dst 0x%h len %0d: %0d bytes read",
+                     iter, dst, len, spi_in_ptr);
+            errors = errors + 1;
+        end
+    end
+
+    // ---- Descriptor chains ----
+    for (chain = 0; chain < CHAINS && errors == 0; chain = chain + 1)
+    begin
+        ndesc     = 1 + {$random(seed)} % 3;
+        chain_irq = $random(seed) & 1;
+        want_fail = (({$random(seed)} % 4) == 0);
+
+        // Build the list; the last descriptor is always 2D MEM2VRAM.
+        for (d = 0; d < ndesc; d = d + 1)
+        begin
+            c_addr[d]  = DESC_BASE + 32 * (32 * d + {$random(seed)} % 32);
+            c_vram[d]  = (d == ndesc - 1) || ($random(seed) & 1);
+            c_2d[d]    = (d == ndesc - 1) || ($random(seed) & 1);
+            c_irq[d]   = $random(seed) & 1;
+            c_rows[d]  = c_2d[d] ? 1 + {$random(seed)} % 4 : 1;
+            c_len[d]   = 1 + {$random(seed)} % 64;
+            c_ss[d]    = c_len[d] + {$random(seed)} % 41;
+            c_ds[d]    = c_len[d] + {$random(seed)} % 41;
+            c_src[d]   = SRC_BASE + {$random(seed)} % (32'h3000 - 512);
+            c_good[d]  = c_rows[d];
+            if (c_vram[d])
+                c_dst[d] = VRAM_BASE + {$random(seed)} % (32'h20000 - 512);
+            else
+                c_dst[d] = DST_BASE + {$random(seed)} % (32'h3000 - 512);
+            if (d == ndesc - 1 && want_fail)
+            begin
+                // The last row ends one byte past VRAMPX.
+                c_good[d] = c_rows[d] - 1;
+                c_dst[d]  = VRAM_BASE + 32'h20000 + 1 - c_len[d] -
+                            c_ds[d] * (c_rows[d] - 1);
+            end
+            for (r = 0; r < c_rows[d]; r = r + 1)
+                for (i = 0; i < c_len[d]; i = i + 1)
+                    set_byte(c_src[d] + r * c_ss[d] + i, $random(seed));
+        end
+        for (d = 0; d < ndesc; d = d + 1)
+            put_desc(c_addr[d], c_src[d], c_dst[d], c_len[d],
+                     {23'd0, c_2d[d], 3'd0, c_irq[d],
+                      c_vram[d] ? MODE_MEM2VRAM : MODE_MEM2MEM},
+                     (d == ndesc - 1) ? 32'd0 : c_addr[d + 1],
+                     c_rows[d], c_ss[d], c_ds[d]);
+
+        // Reference, in list order: only the rows that pass validation.
+        // A descriptor raises its interrupt once all its rows are done.
+        exp_irqs = 0;
+        exp_desc = 1'b0;
+        for (d = 0; d < ndesc; d = d + 1)
+        begin
+            for (r = 0; r < c_good[d]; r = r + 1)
+                for (i = 0; i < c_len[d]; i = i + 1)
+                    if (c_vram[d])
+                        ref_vram[c_dst[d] - VRAM_BASE + r * c_ds[d] + i] =
+                            get_byte(c_src[d] + r * c_ss[d] + i);
+                    else
+                        set_ref_byte(c_dst[d] + r * c_ds[d] + i,
+                                     get_byte(c_src[d] + r * c_ss[d] + i));
+            if (c_irq[d] && c_good[d] == c_rows[d])
+            begin
+                exp_irqs = exp_irqs + 1;
+                exp_desc = 1'b1;
+            end
+        end
+        // The end-of-list interrupt directly follows the one of a last
+        // descriptor with its IRQ bit set, and the two merge into one.
+        if (chain_irq && !(c_irq[ndesc - 1] && !want_fail))
+            exp_irqs = exp_irqs + 1;
+
+        irq_count = 0;
+        run_chain(c_addr[0], chain_irq);
+        chain_runs = chain_runs + 1;
+
+        if (status != {exp_desc, want_fail, !want_fail, 1'b0} ||
+            dut.desc_cur != c_addr[ndesc - 1] || irq_count != exp_irqs)
+        begin
+            $display("FAIL: chain %0d (%0d descriptors): status=%b desc_cur 0x%h irqs %0d, expected status=%b desc_cur 0x%h irqs %0d",
+                     chain, ndesc, status, dut.desc_cur, irq_count,
+                     {exp_desc, want_fail, !want_fail, 1'b0},
+                     c_addr[ndesc - 1], exp_irqs);
+            errors = errors + 1;
+        end
+
+        for (i = 0; i < LINES; i = i + 1)
+            if (sdram[i] !== ref_mem[i])
+            begin
+                $display("FAIL: chain %0d: line 0x%h differs", chain, i << 5);
+                errors = errors + 1;
+            end
+
+        // Each VRAMPX row plus two bytes either side must match.
+        for (d = 0; d < ndesc; d = d + 1)
+            if (c_vram[d])
+                for (r = 0; r < c_rows[d]; r = r + 1)
+                    for (i = -2; i < c_len[d] + 2; i = i + 1)
+                    begin
+                        vdst = c_dst[d] - VRAM_BASE + r * c_ds[d] + i;
+                        if (vdst >= 0 && vdst < 131072 && vram[vdst] !== ref_vram[vdst])
+                        begin
+                            $display("FAIL: chain %0d descriptor %0d row %0d: vram 0x%h differs",
+                                     chain, d, r, vdst);
+                            errors = errors + 1;
+                        end
+                    end
+    end
+
+    // A 2D descriptor with no rows, or with a mode other than MEM2MEM /
+    // MEM2VRAM, is rejected before any data moves.
+    for (d = 0; d < 2 && errors == 0; d = d + 1)
+    begin
+        put_desc(DESC_BASE, SRC_BASE, DST_BASE, 32'd16,
+                 {23'd0, 1'b1, 4'd0, (d == 0) ? MODE_MEM2MEM : MODE_MEM2SPI},
+                 32'd0, (d == 0) ? 16'd0 : 16'd2, 16'd32, 16'd32);
+        run_chain(DESC_BASE, 1'b0);
+        if (status != 4'b0100 || dut.desc_cur != DESC_BASE)
+        begin
+            $display("FAIL: bad 2D descriptor %0d: status=%b desc_cur 0x%h",
+                     d, status, dut.desc_cur);
+            errors = errors + 1;
+        end
+        for (i = 0; i < LINES; i = i + 1)
+            if (sdram[i] !== ref_mem[i])
+            begin
+                $display("FAIL: bad 2D descriptor %0d: line 0x%h changed", d, i << 5);
+                errors = errors + 1;
+            end
+    end
+
+    $display("dma_align_tb: %0d iterations (mem2mem %0d, mem2spi %0d, spi2mem %0d, mem2vram %0d), %0d chains",
+             iter, runs[0], runs[1], runs[2], runs[3], chain_runs);
+    if (errors == 0)
+        $display("PASS");
+    else
+        $display("FAIL: %0d mismatches", errors);
+    $finish;
+end
+
+endmodule
@@ -89,6 +89,7 @@ SDRAMcontroller sdc (
     .cpu_addr(cpu_addr),
     .cpu_data(cpu_data),
     .cpu_we(cpu_we),
+    .cpu_mask(32'hFFFFFFFF),
     .cpu_start(cpu_start),
     .cpu_done(cpu_done),
     .cpu_q(cpu_q),
@@ -1,34 +1,42 @@
 #!/bin/sh
-# /bin/cc — compile a C file to a BDOS executable, on-device.
+# /bin/cc-pipe — compile a C file to a BDOS executable, on-device, running
+# each stage as its own program with its output in /tmp. /bin/cc runs the
+# same stages in one process without the /tmp files (Software/C/userBDOS/cc);
+# this script is for looking at what a stage produced.
 #
-# Usage:   cc <input.c> <output_name>
+# Usage:   cc-pipe <input.c> <output_name>
 # Result:  /bin/<output_name>  (relocatable userBDOS binary)
 #
 # Pipeline:
 #   cpp     : preprocess source (handles #include, #define, #ifdef)
 #   cproc   : C -> QBE IR (target b32p3)
 #   qbe     : QBE IR -> b32p3 assembly
-#   asm-link: assemble and link everything together
+#   asm-link: assemble the user program to an object (-p: peephole pass),
+#             then link it with crt0 and the library archives
 #
-# Libc + userlib are NOT recompiled per invocation. They live as cached
-# .asm files in /lib/asm-cache/ — run /bin/libc-build once (after first
-# sync, or after editing a /lib/src/*.c) to populate the cache. Hand-
-# written assembly (crt0, syscall stubs, fixed64 helpers) is in /lib/asm/.
+# Libc + userlib are NOT recompiled or reassembled per invocation. They live
+# as archives /lib/libc.a and /lib/libuser.a (objects of the libc, userlib
+# and hand-written assembly sources), of which the link only pulls the
+# members the program needs — run /bin/libc-build once (after first sync,
+# or after editing a /lib/src/*.c) to build them.
 #
 # BDOS v4: scripts abort automatically on any non-zero exit code.
 
-echo "cc: compiling $1 -> /bin/$2"
+echo "cc-pipe: compiling $1 -> /bin/$2"
 
-echo "[1/4] Preprocessing..."
+echo "[1/5] Preprocessing..."
 cpp -I /lib/include "$1" -o /tmp/c.i
 
-echo "[2/4] Compiling C to QBE IR..."
+echo "[2/5] Compiling C to QBE IR..."
 cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
 
-echo "[3/4] Optimizing to B32P3 assembly..."
+echo "[3/5] Optimizing to B32P3 assembly..."
 qbe < /tmp/c.qbe > /tmp/user.asm
 
-echo "[4/4] Linking..."
-asm-link -o /bin/$2 /lib/asm/crt0_ubdos.asm /lib/asm-cache/string.asm /lib/asm-cache/stdlib.asm /lib/asm-cache/malloc.asm /lib/asm-cache/ctype.asm /lib/asm-cache/stdio.asm /lib/asm/syscall_asm.asm /lib/asm-cache/syscall.asm /lib/asm-cache/io_stubs.asm /lib/asm-cache/time.asm /lib/asm-cache/fixedmath.asm /lib/asm/fixed64_asm.asm /lib/asm-cache/fixed64.asm /lib/asm-cache/plot.asm /lib/asm-cache/fnp.asm /lib/asm/dma_asm.asm /lib/asm-cache/dma.asm /tmp/user.asm
+echo "[4/5] Assembling..."
+asm-link -c -p -o /tmp/user.o /tmp/user.asm
 
-echo "cc: built /bin/$2"
+echo "[5/5] Linking..."
+asm-link -o /bin/$2 /lib/obj/crt0_ubdos.o /tmp/user.o /lib/libuser.a /lib/libc.a
+
+echo "cc-pipe: built /bin/$2"
@@ -17,6 +17,40 @@
 #
 #   # Raw C (no startup, e.g. for testing):
 #   ./compile_modern_c.sh program.c -o output.bin
+#
+#   # With QBE loop optimizations (-O1) and unrolling (-O2):
+#   ./compile_modern_c.sh program.c -O2 -o output.bin
+#
+#   # With the assembly peephole pass (same rules as on-device asm-link -p):
+#   ./compile_modern_c.sh program.c -p -o output.bin
+#
+#   # Profile-guided block layout: build with block counters, run the
+#   # program (it writes prof.txt when main returns; link the userlib
+#   # syscall sources for it), then rebuild with the profile at the same
+#   # -O level:
+#   ./compile_modern_c.sh crt0_ubdos.asm program.c -h -i -O1 --profile-generate -o prog.bin
+#   ./compile_modern_c.sh crt0_ubdos.asm program.c -h -i -O1 --profile-use prof.txt -o prog.bin
+#
+#   # Drop functions and data the program never references (multi-file
+#   # links; same rules as asm-link --gc-sections), with a report of what
+#   # was kept and why:
+#   ./compile_modern_c.sh crt0_ubdos.asm program.c -h -i --gc-sections --map prog.map -o prog.bin
+#
+#   # Write the address of every function and global for b32p3emu -sym
+#   # (per-function cycle profile with -profile):
+#   ./compile_modern_c.sh crt0_ubdos.asm program.c -h -i --symbols prog.sym -o prog.bin
+#
+#   # Save FP, RA and callee-saved registers on the hardware stack (QBE -H);
+#   # links the spill/fill runtime. All C files of the program must use it:
+#   ./compile_modern_c.sh crt0_baremetal.asm program.c -h --hwstack -o output.bin
+#
+# Compiled C files are cached by the hash of their preprocessed source, the
+# cproc and qbe binaries and the qbe flags, so rebuilding a program only runs
+# cproc and qbe for the files whose expanded source changed:
+#   CCCACHE_DIR      cache directory (default ~/.cache/fpgc-cccache)
+#   CCCACHE_MAXSIZE  size limit in MiB (default 256); oldest entries go first
+#   CCCACHE_DISABLE  set to 1 to bypass the cache (same as --no-cache)
+#   ./compile_modern_c.sh --cache-stats    # hits and misses so far
 
 set -e
 set -o pipefail   # propagate errors from `cpp | cproc | qbe` so a cproc
@@ -30,16 +64,35 @@ CPP="cpp"
 # Libc include path (relative to project root)
 LIBC_INCLUDE="Software/C/libc/include"
 
+# Block counting runtime for --profile-generate
+PROF_RUNTIME="Software/C/userlib/src/prof.c"
+PROF_INCLUDE="Software/C/userlib/include"
+
+# Hardware stack spill/fill runtime for --hwstack
+HWSTACK_RUNTIME="Software/ASM/crt0/hwstack.asm"
+
+# Compile cache
+CCCACHE_DIR="${CCCACHE_DIR:-$HOME/.cache/fpgc-cccache}"
+CCCACHE_MAXSIZE="${CCCACHE_MAXSIZE:-256}"
+CCCACHE_DISABLE="${CCCACHE_DISABLE:-0}"
+
 # Parse arguments
 HEADER_FLAG=""
 INDEPENDENT_FLAG=""
 SYSCALL_FLAG=""
+PEEPHOLE_FLAG=""
+GC_FLAG=""
+MAP_FILE=""
+SYMBOLS_FILE=""
 OUTPUT=""
 INPUT_FILES=()
 INCLUDE_DIRS=()
 CPP_DEFINES=()
 USE_LIBC=0
 OFFSET_ADDR=""
+QBE_FLAGS=()
+PROF_FLAGS=()
+HWSTACK_FLAGS=()
 
 while [[ $# -gt 0 ]]; do
     case "$1" in
@@ -55,6 +108,22 @@ while [[ $# -gt 0 ]]; do
             SYSCALL_FLAG="-s"
             shift
             ;;
+        -p|--peephole)
+            PEEPHOLE_FLAG="-p"
+            shift
+            ;;
+        --gc-sections)
+            GC_FLAG="--gc-sections"
+            shift
+            ;;
+        --map)
+            MAP_FILE="$2"
+            shift 2
+            ;;
+        --symbols)
+            SYMBOLS_FILE="$2"
+            shift 2
+            ;;
         -o|--output)
             OUTPUT="$2"
             shift 2
@@ -83,23 +152,64 @@ while [[ $# -gt 0 ]]; do
             CPP_DEFINES+=("$1")
             shift
             ;;
+        -O[0-9])
+            QBE_FLAGS=("$1")
+            shift
+            ;;
+        --profile-generate)
+            PROF_FLAGS=(-P)
+            shift
+            ;;
+        --profile-use)
+            PROF_FLAGS=(-p "$2")
+            shift 2
+            ;;
+        --hwstack)
+            HWSTACK_FLAGS=(-H)
+            shift
+            ;;
+        --no-cache)
+            CCCACHE_DISABLE=1
+            shift
+            ;;
+        --cache-stats)
+            if [ -f "$CCCACHE_DIR/stats" ]; then
+                read -r hits misses < "$CCCACHE_DIR/stats" || true
+            else
+                hits=0
+                misses=0
+            fi
+            echo "cccache: $CCCACHE_DIR"
+            echo "  hits:    $hits"
+            echo "  misses:  $misses"
+            echo "  entries: $(find "$CCCACHE_DIR" -name '*.asm' 2>/dev/null | wc -l)"
+            echo "  size:    $(du -sk "$CCCACHE_DIR" 2>/dev/null | cut -f1) KiB (limit $CCCACHE_MAXSIZE MiB)"
+            exit 0
+            ;;
         *.c|*.asm)
             INPUT_FILES+=("$1")
             shift
             ;;
         *)
             echo "Unknown argument: $1"
-            echo "Usage: $0 [crt0.asm] <source.c> [source2.c ...] [-o output.bin] [-h] [-i] [-s] [--libc] [-I dir]"
+            echo "Usage: $0 [crt0.asm] <source.c> [source2.c ...] [-o output.bin] [-h] [-i] [-s] [-p] [--gc-sections [--map file]] [--symbols file] [--libc] [-I dir] [-O level] [--profile-generate | --profile-use file] [--hwstack] [--no-cache] [--cache-stats]"
             exit 1
             ;;
     esac
 done
 
 if [ ${#INPUT_FILES[@]} -eq 0 ]; then
-    echo "Usage: $0 [crt0.asm] <source.c> [source2.c ...] [-o output.bin] [-h] [-i] [-s] [--libc] [-I dir]"
+    echo "Usage: $0 [crt0.asm] <source.c> [source2.c ...] [-o output.bin] [-h] [-i] [-s] [-p] [--gc-sections [--map file]] [--symbols file] [--libc] [-I dir] [-O level] [--profile-generate | --profile-use file] [--hwstack] [--no-cache] [--cache-stats]"
     exit 1
 fi
 
+if [ "${PROF_FLAGS[0]}" = "-P" ]; then
+    INPUT_FILES+=("$PROF_RUNTIME")
+fi
+if [ ${#HWSTACK_FLAGS[@]} -gt 0 ]; then
+    INPUT_FILES+=("$HWSTACK_RUNTIME")
+fi
+
 # Default output
 if [ -z "$OUTPUT" ]; then
     OUTPUT="Software/ASM/Output/code.bin"
@@ -132,10 +242,56 @@ for def in "${CPP_DEFINES[@]}"; do
     CPP_FLAGS="$CPP_FLAGS $def"
 done
 
+# Key of the toolchain and the profile it reads; the key of each file adds
+# the qbe flags and its preprocessed source
+CACHE_HITS=0
+CACHE_MISSES=0
+if [ "$CCCACHE_DISABLE" != 1 ]; then
+    mkdir -p "$CCCACHE_DIR"
+    CACHE_BASE=$( {
+        sha256sum "$CPROC" "$QBE" | cut -d' ' -f1
+        if [ "${PROF_FLAGS[0]}" = "-p" ]; then
+            cat "${PROF_FLAGS[1]}"
+        fi
+    } | sha256sum | cut -d' ' -f1 )
+fi
+
+# Compile the preprocessed source $1 to $2 with the qbe flags $3..., through
+# the cache
+compile_i() {
+    local i_file="$1" asm_file="$2" key entry
+    shift 2
+    if [ "$CCCACHE_DISABLE" = 1 ]; then
+        "$CPROC" -t b32p3 < "$i_file" | "$QBE" "$@" > "$asm_file"
+        return
+    fi
+    key=$( { echo "$CACHE_BASE $*"; cat "$i_file"; } | sha256sum | cut -d' ' -f1 )
+    entry="$CCCACHE_DIR/$key.asm"
+    if [ -f "$entry" ]; then
+        cp "$entry" "$asm_file"
+        touch "$entry"
+        CACHE_HITS=$((CACHE_HITS + 1))
+        return
+    fi
+    "$CPROC" -t b32p3 < "$i_file" | "$QBE" "$@" > "$asm_file"
+    # Write under a temporary name so a concurrent build never reads half
+    # an entry
+    cp "$asm_file" "$entry.$$"
+    mv "$entry.$$" "$entry"
+    CACHE_MISSES=$((CACHE_MISSES + 1))
+}
+
 ASM_FILES=()
 echo "=== Compiling sources ==="
 for input_file in "${INPUT_FILES[@]}"; do
     base=$(basename "${input_file%.*}")
+    # Same basename from two directories (e.g. userlib cluster.c and
+    # fpgc-frontend/cluster.c): keep both intermediates.
+    n=1
+    while [ -e "$TMPDIR/${base}.asm" ]; do
+        base="$(basename "${input_file%.*}")_$n"
+        n=$((n + 1))
+    done
     if [[ "$input_file" == *.asm ]]; then
         # Assembly file — copy directly to temp dir (preserves link order)
         asm_file="$TMPDIR/${base}.asm"
@@ -145,11 +301,48 @@ for input_file in "${INPUT_FILES[@]}"; do
         # C file — preprocess through cpp, then compile through cproc → QBE
         asm_file="$TMPDIR/${base}.asm"
         echo "  $input_file → $asm_file"
-        "$CPP" $CPP_FLAGS "$input_file" | "$CPROC" -t b32p3 | "$QBE" > "$asm_file"
+        i_file="$TMPDIR/${base}.i"
+        if [ "$input_file" = "$PROF_RUNTIME" ]; then
+            # The runtime itself must not count its blocks
+            "$CPP" $CPP_FLAGS -I"$PROF_INCLUDE" "$input_file" > "$i_file"
+            compile_i "$i_file" "$asm_file" "${QBE_FLAGS[@]}" "${HWSTACK_FLAGS[@]}"
+        else
+            "$CPP" $CPP_FLAGS "$input_file" > "$i_file"
+            compile_i "$i_file" "$asm_file" "${QBE_FLAGS[@]}" "${HWSTACK_FLAGS[@]}" "${PROF_FLAGS[@]}"
+        fi
     fi
     ASM_FILES+=("$asm_file")
 done
 
+if [ "$CCCACHE_DISABLE" != 1 ]; then
+    echo "cccache: $CACHE_HITS hits, $CACHE_MISSES misses"
+    # Parallel builds share the counters: hold the lock across the read and
+    # the write so no update is lost, and replace the file in one rename so
+    # --cache-stats never sees it half-written
+    (
+        flock 9
+        hits=0
+        misses=0
+        if [ -f "$CCCACHE_DIR/stats" ]; then
+            read -r hits misses < "$CCCACHE_DIR/stats" || true
+        fi
+        echo "$((${hits:-0} + CACHE_HITS)) $((${misses:-0} + CACHE_MISSES))" > "$CCCACHE_DIR/stats.$$"
+        mv -f "$CCCACHE_DIR/stats.$$" "$CCCACHE_DIR/stats"
+    ) 9> "$CCCACHE_DIR/stats.lock"
+
+    # Drop the least recently used entries while over the limit. Other
+    # builds may add or remove files meanwhile, so vanished files are fine
+    size_kb=$( { du -sk "$CCCACHE_DIR" 2>/dev/null || true; } | cut -f1)
+    if [ "${size_kb:-0}" -gt $((CCCACHE_MAXSIZE * 1024)) ]; then
+        { ls -tr "$CCCACHE_DIR"/*.asm 2>/dev/null || true; } | while read -r entry; do
+            [ "$size_kb" -le $((CCCACHE_MAXSIZE * 1024)) ] && break
+            entry_kb=$( { du -k "$entry" 2>/dev/null || true; } | cut -f1)
+            size_kb=$((size_kb - ${entry_kb:-0}))
+            rm -f "$entry"
+        done
+    fi
+fi
+
 echo "=== Assembling ==="
 LIST_OUTPUT="${OUTPUT%.bin}.list"
 mkdir -p "$(dirname "$OUTPUT")"
@@ -160,6 +353,8 @@ if [ ${#ASM_FILES[@]} -eq 1 ]; then
     [ -n "$HEADER_FLAG" ] && ASMPY_FLAGS="$ASMPY_FLAGS -h"
     [ -n "$INDEPENDENT_FLAG" ] && ASMPY_FLAGS="$ASMPY_FLAGS -i"
     [ -n "$SYSCALL_FLAG" ] && ASMPY_FLAGS="$ASMPY_FLAGS -s"
+    [ -n "$PEEPHOLE_FLAG" ] && ASMPY_FLAGS="$ASMPY_FLAGS -p"
+    [ -n "$SYMBOLS_FILE" ] && ASMPY_FLAGS="$ASMPY_FLAGS --symbols $SYMBOLS_FILE"
     asmpy "${ASM_FILES[0]}" "$LIST_OUTPUT" $ASMPY_FLAGS
 else
     # Multi-file: link then assemble
@@ -167,6 +362,10 @@ else
     [ -n "$HEADER_FLAG" ] && LINKER_FLAGS="$LINKER_FLAGS -H"
     [ -n "$INDEPENDENT_FLAG" ] && LINKER_FLAGS="$LINKER_FLAGS -i"
     [ -n "$SYSCALL_FLAG" ] && LINKER_FLAGS="$LINKER_FLAGS -s"
+    [ -n "$PEEPHOLE_FLAG" ] && LINKER_FLAGS="$LINKER_FLAGS -p"
+    [ -n "$GC_FLAG" ] && LINKER_FLAGS="$LINKER_FLAGS $GC_FLAG"
+    [ -n "$MAP_FILE" ] && LINKER_FLAGS="$LINKER_FLAGS --map $MAP_FILE"
+    [ -n "$SYMBOLS_FILE" ] && LINKER_FLAGS="$LINKER_FLAGS --symbols $SYMBOLS_FILE"
     [ -n "$OFFSET_ADDR" ] && LINKER_FLAGS="$LINKER_FLAGS -o $OFFSET_ADDR"
     python -m asmpy.linker "${ASM_FILES[@]}" "$LIST_OUTPUT" $LINKER_FLAGS
 fi
@@ -1,82 +1,73 @@
 #!/bin/sh
 # /bin/libc-build — compile every libc + userlib .c source in /lib/src/
-# to a cached .asm in /lib/asm-cache/. Run once (or after editing libc)
-# so subsequent `cc` invocations only have to compile the user source.
+# to an object in /lib/obj/, then bundle the objects into /lib/libc.a and
+# /lib/libuser.a. Run once (or after editing libc) so subsequent `cc`
+# invocations only have to compile the user source and link the archive
+# members it uses.
 #
-# Pipeline per file:
-#   cpp    : preprocess (handles #include via /lib/include)
-#   cproc  : C  -> QBE IR
-#   qbe    : QBE IR -> b32p3 assembly
+# Each file goes through `cc -c` (cpp, cproc, qbe, asm-link -c -p), which
+# keeps the object in the compile cache: after editing one source, only
+# that file is compiled again.
 #
 # BDOS v4: scripts abort automatically on any non-zero exit code.
 
-echo "libc-build: compiling 13 library sources..."
-
-mkdir -p /lib/asm-cache
-
-echo "[1/13] string.c"
-cpp -I /lib/include /lib/src/string.c    -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/string.asm
-
-echo "[2/13] stdlib.c"
-cpp -I /lib/include /lib/src/stdlib.c    -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/stdlib.asm
-
-echo "[3/13] malloc.c"
-cpp -I /lib/include /lib/src/malloc.c    -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/malloc.asm
-
-echo "[4/13] ctype.c"
-cpp -I /lib/include /lib/src/ctype.c     -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/ctype.asm
-
-echo "[5/13] stdio.c"
-cpp -I /lib/include /lib/src/stdio.c     -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/stdio.asm
-
-echo "[6/13] syscall.c"
-cpp -I /lib/include /lib/src/syscall.c   -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/syscall.asm
-
-echo "[7/13] io_stubs.c"
-cpp -I /lib/include /lib/src/io_stubs.c  -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/io_stubs.asm
-
-echo "[8/13] time.c"
-cpp -I /lib/include /lib/src/time.c      -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/time.asm
-
-echo "[9/13] fixedmath.c"
-cpp -I /lib/include /lib/src/fixedmath.c -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/fixedmath.asm
-
-echo "[10/13] fixed64.c"
-cpp -I /lib/include /lib/src/fixed64.c   -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/fixed64.asm
-
-echo "[11/13] plot.c"
-cpp -I /lib/include /lib/src/plot.c      -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/plot.asm
-
-echo "[12/13] fnp.c"
-cpp -I /lib/include /lib/src/fnp.c       -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/fnp.asm
-
-echo "[13/13] dma.c"
-cpp -I /lib/include /lib/src/dma.c       -o /tmp/c.i
-cproc -t b32p3 < /tmp/c.i > /tmp/c.qbe
-qbe < /tmp/c.qbe > /lib/asm-cache/dma.asm
-
-echo "libc-build: done (13/13 compiled to /lib/asm-cache/)"
+echo "libc-build: compiling 15 library sources..."
+
+mkdir -p /lib/obj
+
+echo "[1/15] string.c"
+cc -c /lib/src/string.c /lib/obj/string.o
+
+echo "[2/15] stdlib.c"
+cc -c /lib/src/stdlib.c /lib/obj/stdlib.o
+
+echo "[3/15] malloc.c"
+cc -c /lib/src/malloc.c /lib/obj/malloc.o
+
+echo "[4/15] ctype.c"
+cc -c /lib/src/ctype.c /lib/obj/ctype.o
+
+echo "[5/15] stdio.c"
+cc -c /lib/src/stdio.c /lib/obj/stdio.o
+
+echo "[6/15] syscall.c"
+cc -c /lib/src/syscall.c /lib/obj/syscall.o
+
+echo "[7/15] io_stubs.c"
+cc -c /lib/src/io_stubs.c /lib/obj/io_stubs.o
+
+echo "[8/15] time.c"
+cc -c /lib/src/time.c /lib/obj/time.o
+
+echo "[9/15] fixedmath.c"
+cc -c /lib/src/fixedmath.c /lib/obj/fixedmath.o
+
+echo "[10/15] fixed64.c"
+cc -c /lib/src/fixed64.c /lib/obj/fixed64.o
+
+echo "[11/15] plot.c"
+cc -c /lib/src/plot.c /lib/obj/plot.o
+
+echo "[12/15] fnp.c"
+cc -c /lib/src/fnp.c /lib/obj/fnp.o
+
+echo "[13/15] cluster.c"
+cc -c /lib/src/cluster.c /lib/obj/cluster.o
+
+echo "[14/15] dist.c"
+cc -c /lib/src/dist.c /lib/obj/dist.o
+
+echo "[15/15] dma.c"
+cc -c /lib/src/dma.c /lib/obj/dma.o
+
+echo "Assembling hand-written sources..."
+asm-link -c -p -o /lib/obj/crt0_ubdos.o  /lib/asm/crt0_ubdos.asm
+asm-link -c -p -o /lib/obj/syscall_asm.o /lib/asm/syscall_asm.asm
+asm-link -c -p -o /lib/obj/fixed64_asm.o /lib/asm/fixed64_asm.asm
+asm-link -c -p -o /lib/obj/dma_asm.o     /lib/asm/dma_asm.asm
+
+echo "Archiving /lib/libc.a and /lib/libuser.a..."
+asm-link -a -o /lib/libc.a /lib/obj/string.o /lib/obj/stdlib.o /lib/obj/malloc.o /lib/obj/ctype.o /lib/obj/stdio.o
+asm-link -a -o /lib/libuser.a /lib/obj/syscall_asm.o /lib/obj/syscall.o /lib/obj/io_stubs.o /lib/obj/time.o /lib/obj/fixedmath.o /lib/obj/fixed64_asm.o /lib/obj/fixed64.o /lib/obj/plot.o /lib/obj/fnp.o /lib/obj/cluster.o /lib/obj/dist.o /lib/obj/dma_asm.o /lib/obj/dma.o
+
+echo "libc-build: done (15/15 compiled, /lib/libc.a + /lib/libuser.a)"
@@ -4,11 +4,14 @@ fnp_tool.py — FPGC Network Protocol (FNP) PC-side tool.
 
 Supports file upload, remote keyboard input, and interactive keyboard
 streaming to an FPGC device over raw Ethernet frames using the FNP
-protocol (EtherType 0xB4B4).
+protocol (EtherType 0xB4B4). With --group, uploads are broadcast once to
+several boards and only the chunks each board reports missing are resent.
 
 Usage:
   python fnp_tool.py [<interface>] upload <local_file> <fpgc_path>
   python fnp_tool.py [<interface>] sync-files <local_dir>
+  python fnp_tool.py [<interface>] --group 1-5 upload <local_file> <fpgc_path>
+  python fnp_tool.py [<interface>] --group 1-5 sync-files <local_dir>
   python fnp_tool.py [<interface>] key <text>
   python fnp_tool.py [<interface>] keycode <hex_code>
   python fnp_tool.py [<interface>] keyboard
@@ -28,6 +31,7 @@ import fcntl
 import math
 import os
 import pathlib
+import random
 import select
 import socket
 import struct
@@ -50,6 +54,10 @@ FNP_TYPE_FILE_START = 0x10
 FNP_TYPE_FILE_DATA = 0x11
 FNP_TYPE_FILE_END = 0x12
 FNP_TYPE_FILE_ABORT = 0x13
+FNP_TYPE_GROUP_START = 0x14
+FNP_TYPE_GROUP_DATA = 0x15
+FNP_TYPE_GROUP_POLL = 0x16
+FNP_TYPE_GROUP_STATUS = 0x17
 FNP_TYPE_KEYCODE = 0x20
 FNP_TYPE_MKDIR = 0x21
 FNP_TYPE_SYNC = 0x22
@@ -69,8 +77,24 @@ MAX_RETRIES = 2  # 3 total attempts
 # Chunk size for FILE_DATA (1024 bytes = 256 words)
 FILE_CHUNK_SIZE = 1024
 
+# Group transfers: chunks go out in bursts so the ENC28J60 RX buffer
+# (about six full frames) and the 4-entry kernel ring can drain
+GROUP_CHUNK_SIZE = 1024
+GROUP_BURST = 4
+GROUP_BURST_GAP = 0.005  # 5ms
+GROUP_POLL_TIMEOUT = 0.2  # 200ms per status round
+GROUP_MAX_ROUNDS = 30
+GROUP_MAX_SILENT_ROUNDS = 3  # rounds without any status before giving up
+
+# GROUP_STATUS states
+GROUP_RECEIVING = 0
+GROUP_DONE = 1
+GROUP_FAILED = 2
+GROUP_UNKNOWN = 3
+
 # Default FPGC MAC
 FPGC_MAC = bytes([0x02, 0xB4, 0xB4, 0x00, 0x00, 0x01])
+BROADCAST_MAC = bytes([0xFF] * 6)
 
 # HID keycode mapping for keyboard streaming mode
 # Maps terminal escape sequences and characters to FPGC HID-style keycodes.
@@ -173,13 +197,54 @@ def get_mac(sock: socket.socket, iface: str) -> bytes:
     return info[18:24]
 
 
+def board_mac(board_id: int) -> bytes:
+    """MAC address of the FPGC with the given board id (last MAC byte)."""
+    return bytes([0x02, 0xB4, 0xB4, 0x00, 0x00, board_id])
+
+
+def parse_group(spec: str) -> list[int]:
+    """Parse a board id list like '1-5' or '1,3,4' (ids 1..32)."""
+    ids: list[int] = []
+    for part in spec.split(","):
+        if "-" in part:
+            lo, hi = part.split("-", 1)
+            ids.extend(range(int(lo, 0), int(hi, 0) + 1))
+        else:
+            ids.append(int(part, 0))
+    for board_id in ids:
+        if not 1 <= board_id <= 32:
+            raise ValueError(f"Board id out of range (1-32): {board_id}")
+    return sorted(set(ids))
+
+
 class FNPConnection:
-    """Manages an FNP connection to a single FPGC device."""
+    """
+    Manages an FNP connection to a single FPGC device, or to a group of
+    devices for the group_* methods.
 
-    def __init__(self, iface: str, fpgc_mac: bytes = FPGC_MAC):
+    `sock` and `src_mac` replace the raw socket on `iface`; the host
+    simulation uses this to run the tool against simulated boards.
+    """
+
+    def __init__(
+        self,
+        iface: str,
+        fpgc_mac: bytes = FPGC_MAC,
+        sock=None,
+        src_mac: bytes | None = None,
+    ):
         self.iface = iface
         self.fpgc_mac = fpgc_mac
         self.seq = 0
+        self.group_xfer = random.randrange(0x10000)
+        self.group_burst = GROUP_BURST
+        self.group_burst_gap = GROUP_BURST_GAP
+        self.group_stats: dict[str, int] = {}
+
+        if sock is not None:
+            self.sock = sock
+            self.src_mac = src_mac
+            return
 
         self.sock = socket.socket(
             socket.AF_PACKET, socket.SOCK_RAW, socket.htons(ETHERTYPE_FNP)
@@ -202,10 +267,13 @@ class FNPConnection:
         seq: int,
         flags: int,
         data: bytes,
+        dst_mac: bytes | None = None,
     ) -> bytes:
-        """Build a complete Ethernet + FNP frame."""
+        """Build a complete Ethernet + FNP frame (to fpgc_mac by default)."""
         # Ethernet header
-        eth_header = self.fpgc_mac + self.src_mac + struct.pack("!H", ETHERTYPE_FNP)
+        if dst_mac is None:
+            dst_mac = self.fpgc_mac
+        eth_header = dst_mac + self.src_mac + struct.pack("!H", ETHERTYPE_FNP)
 
         # FNP header: version(1) + type(1) + seq(2) + flags(1) + length(2)
         fnp_header = struct.pack("!BBHBH", FNP_VERSION, msg_type, seq, flags, len(data))
@@ -221,6 +289,16 @@ class FNPConnection:
         Receive and parse an FNP frame.
         Returns (msg_type, seq, flags, data) or None on timeout.
         """
+        result = self._recv_frame_from(timeout)
+        if result is None:
+            return None
+        return result[1:]
+
+    def _recv_frame_from(self, timeout: float) -> tuple | None:
+        """
+        Receive and parse an FNP frame.
+        Returns (src_mac, msg_type, seq, flags, data) or None on timeout.
+        """
         self.sock.settimeout(timeout)
         try:
             raw, _addr = self.sock.recvfrom(2048)
@@ -245,7 +323,7 @@ class FNPConnection:
         if len(data) < data_len:
             return None
 
-        return (msg_type, seq, flags, data[:data_len])
+        return (bytes(raw[6:12]), msg_type, seq, flags, data[:data_len])
 
     def _send_and_wait_ack(
         self,
@@ -488,6 +566,290 @@ class FNPConnection:
         print("\nSync complete!")
         return True
 
+    # ---- Group (broadcast) transfers ----
+
+    def _group_collect_acks(
+        self, seq: int, want: set[bytes], timeout: float
+    ) -> set[bytes]:
+        """Collect ACKs for `seq` from the MACs in `want`."""
+        got: set[bytes] = set()
+        deadline = time.time() + timeout
+        while got != want:
+            remaining = deadline - time.time()
+            if remaining <= 0:
+                break
+            result = self._recv_frame_from(remaining)
+            if result is None:
+                continue
+            src, r_type, _r_seq, _r_flags, r_data = result
+            if src not in want or r_type not in (FNP_TYPE_ACK, FNP_TYPE_NACK):
+                continue
+            if len(r_data) >= 2 and struct.unpack("!H", r_data[:2])[0] == seq:
+                got.add(src)
+        return got
+
+    def _group_send_and_wait_acks(
+        self, msg_type: int, data: bytes, members: list[int]
+    ) -> bool:
+        """
+        Broadcast one message and wait until every member has answered.
+        Only used for idempotent messages (MKDIR, SYNC): a retry is
+        broadcast again and boards that already answered simply repeat.
+        """
+        want = {board_mac(b) for b in members}
+        seq = self._next_seq()
+        frame = self._build_frame(
+            msg_type, seq, FNP_FLAG_REQUIRES_ACK, data, BROADCAST_MAC
+        )
+        got: set[bytes] = set()
+        for _attempt in range(MAX_RETRIES + 1):
+            self._send_raw(frame)
+            got |= self._group_collect_acks(seq, want - got, ACK_TIMEOUT)
+            if got == want:
+                return True
+        missing = sorted(m[5] for m in want - got)
+        print(f"  No answer from board(s) {missing}", file=sys.stderr)
+        return False
+
+    def _group_collect_status(
+        self, xfer: int, seqs: set[int], want: set[bytes], timeout: float
+    ) -> dict[bytes, tuple[int, int, list[tuple[int, int]]]]:
+        """
+        Collect GROUP_STATUS replies for `xfer` from the MACs in `want`.
+        Only answers to the frames in `seqs` count: late replies to an
+        earlier START or POLL would report stale progress.
+        Returns {mac: (state, chunks_received, [(first, count), ...])}.
+        """
+        replies: dict[bytes, tuple[int, int, list[tuple[int, int]]]] = {}
+        deadline = time.time() + timeout
+        while len(replies) < len(want):
+            remaining = deadline - time.time()
+            if remaining <= 0:
+                break
+            result = self._recv_frame_from(remaining)
+            if result is None:
+                continue
+            src, r_type, r_seq, _r_flags, r_data = result
+            if r_type != FNP_TYPE_GROUP_STATUS or src not in want:
+                continue
+            if r_seq not in seqs:
+                continue
+            if len(r_data) < 6:
+                continue
+            r_xfer, state, n_ranges, received = struct.unpack("!HBBH", r_data[:6])
+            if r_xfer != xfer:
+                continue
+            ranges = []
+            for i in range(n_ranges):
+                off = 6 + i * 4
+                if off + 4 > len(r_data):
+                    break
+                ranges.append(struct.unpack("!HH", r_data[off : off + 4]))
+            replies[src] = (state, received, ranges)
+        return replies
+
+    def _group_broadcast(self, msg_type: int, data: bytes) -> int:
+        """Broadcast one frame without waiting for an answer; returns its seq."""
+        seq = self._next_seq()
+        self._send_raw(self._build_frame(msg_type, seq, 0, data, BROADCAST_MAC))
+        return seq
+
+    def group_upload_file(
+        self, local_path: str, fpgc_path: str, members: list[int]
+    ) -> bool:
+        """
+        Upload a file to several FPGCs at once.
+
+        Every chunk is broadcast once; then each board is polled and
+        answers with the chunk ranges it is missing (a NACK). Only the
+        union of those ranges is broadcast again, until every board has
+        verified the checksum or stops answering.
+        """
+        with open(local_path, "rb") as f:
+            file_bytes = f.read()
+
+        file_size_bytes = len(file_bytes)
+        pad_len = (4 - (file_size_bytes % 4)) % 4
+        file_bytes += b"\x00" * pad_len
+        word_count = len(file_bytes) // 4
+        total_chunks = math.ceil(len(file_bytes) / GROUP_CHUNK_SIZE)
+
+        checksum = 0
+        for i in range(word_count):
+            word = struct.unpack("!I", file_bytes[i * 4 : i * 4 + 4])[0]
+            checksum = (checksum + word) & 0xFFFFFFFF
+
+        xfer = self.group_xfer
+        self.group_xfer = (self.group_xfer + 1) & 0xFFFF
+        mask = 0
+        for board_id in members:
+            mask |= 1 << (board_id - 1)
+        path_bytes = fpgc_path.encode("ascii")
+        start_data = struct.pack("!HIIH", xfer, mask, word_count, len(path_bytes))
+        start_data += path_bytes
+        poll_data = struct.pack("!HI", xfer, checksum)
+
+        print(
+            f"Group upload {local_path} ({file_size_bytes} bytes, "
+            f"{total_chunks} chunks) -> {fpgc_path} on boards {members}"
+        )
+
+        pending = {board_mac(b) for b in members}
+        failed: set[bytes] = set()
+        silent = dict.fromkeys(pending, 0)
+        stats = {"data_frames": 0, "rounds": 0, "start_frames": 0, "polls": 0}
+        self.group_stats = stats
+
+        def send_start() -> None:
+            want = set(pending)
+            seqs: set[int] = set()
+            for _attempt in range(MAX_RETRIES + 1):
+                seqs.add(self._group_broadcast(FNP_TYPE_GROUP_START, start_data))
+                stats["start_frames"] += 1
+                replies = self._group_collect_status(
+                    xfer, seqs, want, GROUP_POLL_TIMEOUT
+                )
+                for mac, (state, _received, _ranges) in replies.items():
+                    if state == GROUP_FAILED:
+                        print(
+                            f"  Board {mac[5]}: cannot create file", file=sys.stderr
+                        )
+                        pending.discard(mac)
+                        failed.add(mac)
+                want -= set(replies)
+                if not want:
+                    return
+            # Silent boards are picked up by the polls below
+
+        send_start()
+        resend = set(range(total_chunks))
+
+        for _round in range(GROUP_MAX_ROUNDS):
+            if not pending:
+                break
+            stats["rounds"] += 1
+
+            for n, chunk_idx in enumerate(sorted(resend)):
+                offset = chunk_idx * GROUP_CHUNK_SIZE
+                chunk = file_bytes[offset : offset + GROUP_CHUNK_SIZE]
+                self._group_broadcast(
+                    FNP_TYPE_GROUP_DATA, struct.pack("!HH", xfer, chunk_idx) + chunk
+                )
+                stats["data_frames"] += 1
+                if self.group_burst_gap > 0 and (n + 1) % self.group_burst == 0:
+                    time.sleep(self.group_burst_gap)
+
+            replies: dict[bytes, tuple[int, int, list[tuple[int, int]]]] = {}
+            seqs: set[int] = set()
+            for _attempt in range(MAX_RETRIES + 1):
+                seqs.add(self._group_broadcast(FNP_TYPE_GROUP_POLL, poll_data))
+                stats["polls"] += 1
+                replies.update(
+                    self._group_collect_status(
+                        xfer, seqs, pending - set(replies), GROUP_POLL_TIMEOUT
+                    )
+                )
+                if len(replies) == len(pending):
+                    break
+
+            for mac in pending - set(replies):
+                silent[mac] += 1
+                if silent[mac] >= GROUP_MAX_SILENT_ROUNDS:
+                    print(f"  Board {mac[5]}: no status, giving up", file=sys.stderr)
+                    pending.discard(mac)
+                    failed.add(mac)
+
+            resend = set()
+            restart = False
+            for mac, (state, _received, ranges) in replies.items():
+                silent[mac] = 0
+                if state == GROUP_DONE:
+                    pending.discard(mac)
+                elif state == GROUP_FAILED:
+                    print(f"  Board {mac[5]}: checksum mismatch", file=sys.stderr)
+                    pending.discard(mac)
+                    failed.add(mac)
+                elif state == GROUP_UNKNOWN:
+                    restart = True
+                    resend = set(range(total_chunks))
+                else:
+                    for first, count in ranges:
+                        resend.update(range(first, min(first + count, total_chunks)))
+
+            if pending:
+                print(
+                    f"  Round {stats['rounds']}: {len(pending)} board(s) "
+                    f"missing {len(resend)} chunk(s)"
+                )
+            if restart:
+                send_start()
+
+        for mac in pending:
+            print(
+                f"  Board {mac[5]}: incomplete after {GROUP_MAX_ROUNDS} rounds",
+                file=sys.stderr,
+            )
+        failed |= pending
+
+        print(
+            f"  {stats['data_frames']} data frames for {total_chunks} chunks "
+            f"x {len(members)} boards ({stats['rounds']} rounds)"
+        )
+        if failed:
+            print(
+                f"  Failed on board(s) {sorted(m[5] for m in failed)}",
+                file=sys.stderr,
+            )
+            return False
+        print("  Upload complete!")
+        return True
+
+    def group_sync_files(self, local_dir: str, members: list[int]) -> bool:
+        """sync_files() for a group of boards: MKDIR and files broadcast once."""
+        base = pathlib.Path(local_dir)
+        if not base.is_dir():
+            print(f"Error: not a directory: {local_dir}", file=sys.stderr)
+            return False
+
+        dirs: list[str] = []
+        files: list[tuple[pathlib.Path, str]] = []
+        for item in sorted(base.rglob("*")):
+            rel = item.relative_to(base)
+            fpgc_path = "/" + str(rel)
+            if item.is_dir():
+                dirs.append(fpgc_path)
+            elif item.is_file():
+                files.append((item, fpgc_path))
+
+        print(f"Syncing {local_dir} -> FPGC root on boards {members}")
+        print(f"  {len(dirs)} directories, {len(files)} files")
+        print()
+
+        if dirs:
+            print(f"[1/2] Creating {len(dirs)} directories...")
+            for d in dirs:
+                print(f"  mkdir {d}")
+                path_bytes = d.encode("ascii", errors="replace")
+                if not self._group_send_and_wait_acks(
+                    FNP_TYPE_MKDIR, path_bytes, members
+                ):
+                    print(f"  Warning: mkdir {d} may have failed", file=sys.stderr)
+        else:
+            print("[1/2] No directories to create.")
+
+        if files:
+            print(f"[2/2] Uploading {len(files)} files...")
+            for i, (local_path, fpgc_path) in enumerate(files, 1):
+                print(f"\n--- File {i}/{len(files)}: {fpgc_path} ---")
+                if not self.group_upload_file(str(local_path), fpgc_path, members):
+                    print(f"  Failed to upload {fpgc_path}", file=sys.stderr)
+                    return False
+        else:
+            print("[2/2] No files to upload.")
+
+        print("\nSync complete!")
+        return True
+
     def keyboard_stream(self) -> None:
         """
         Interactive keyboard streaming mode.
@@ -590,6 +952,8 @@ def print_usage():
     print()
     print("Options:")
     print("  --mac XX:XX:XX:XX:XX:XX   FPGC MAC address (default: 02:B4:B4:00:00:01)")
+    print("  --group IDS               upload/sync-files to several boards at once")
+    print("                            (IDS like 1-5 or 1,3; broadcast + NACK repair)")
     print()
     print("If <interface> is omitted, auto-detects a USB Ethernet adapter.")
     print()
@@ -598,6 +962,7 @@ def print_usage():
     print("  python fnp_tool.py keyboard")
     print("  python fnp_tool.py eth0 key 'hello world'")
     print("  python fnp_tool.py eth0 keycode 0x0041")
+    print("  python fnp_tool.py --group 1-5 sync-files Files/BRFS-init")
 
 
 def parse_mac(mac_str: str) -> bytes:
@@ -637,6 +1002,16 @@ def main():
         fpgc_mac = parse_mac(args[idx + 1])
         args = args[:idx] + args[idx + 2 :]
 
+    # Parse optional --group flag
+    group: list[int] | None = None
+    if "--group" in args:
+        idx = args.index("--group")
+        if idx + 1 >= len(args):
+            print("Error: --group requires a board id list", file=sys.stderr)
+            sys.exit(1)
+        group = parse_group(args[idx + 1])
+        args = args[:idx] + args[idx + 2 :]
+
     if len(args) < 1:
         print_usage()
         sys.exit(1)
@@ -677,7 +1052,10 @@ def main():
                 print(f"Error: file not found: {local_file}", file=sys.stderr)
                 sys.exit(1)
 
-            success = conn.upload_file(local_file, fpgc_path)
+            if group:
+                success = conn.group_upload_file(local_file, fpgc_path, group)
+            else:
+                success = conn.upload_file(local_file, fpgc_path)
             sys.exit(0 if success else 1)
 
         elif cmd == "sync-files":
@@ -697,7 +1075,10 @@ def main():
             if not os.path.isdir(local_dir):
                 print(f"Error: not a directory: {local_dir}", file=sys.stderr)
                 sys.exit(1)
-            success = conn.sync_files(local_dir, delay=delay)
+            if group:
+                success = conn.group_sync_files(local_dir, group)
+            else:
+                success = conn.sync_files(local_dir, delay=delay)
             sys.exit(0 if success else 1)
 
         elif cmd == "key":
@@ -42,6 +42,7 @@ echo "Step 2: Compiling flash_writer program..."
     Software/C/libfpgc/io/timer.c \
     Software/C/libfpgc/io/spi_flash.c \
     Software/C/libfpgc/io/dma.c \
+    Software/C/libfpgc/io/dma_queue.c \
     Software/C/libfpgc/io/dma_asm.asm \
     Software/C/bareMetal/flash_writer/flash_writer.c \
     --libc \
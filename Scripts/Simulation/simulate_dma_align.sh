@@ -0,0 +1,13 @@
+#!/bin/bash
+
+# Randomized alignment / length sweep of the DMAengine (no GUI).
+# Usage: simulate_dma_align.sh [iterations] [seed]
+
+ITERATIONS=${1:-400}
+SEED=${2:-1}
+
+iverilog -o Hardware/FPGA/Verilog/Simulation/Output/dma_align.out \
+    -P dma_align_tb.ITERATIONS=$ITERATIONS -P dma_align_tb.SEED=$SEED \
+    Hardware/FPGA/Verilog/Simulation/dma_align_tb.v &&\
+vvp Hardware/FPGA/Verilog/Simulation/Output/dma_align.out | tee Hardware/FPGA/Verilog/Simulation/Output/dma_align.log
+grep -q "^PASS" Hardware/FPGA/Verilog/Simulation/Output/dma_align.log
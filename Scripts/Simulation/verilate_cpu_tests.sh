@@ -0,0 +1,75 @@
+#!/bin/bash
+
+# Build cpu_tests_tb.v (B32P3, MemoryUnit, cache controller and the SDRAM
+# and flash models) with Verilator, for cpu_tests.py and c_tests.py
+# --sim verilator.
+#
+# Usage: verilate_cpu_tests.sh [--trace vcd|fst] [--jobs N]
+#
+# The model is built once and reused for every test. It reads its .list
+# files relative to the working directory, from
+# Hardware/FPGA/Verilog/Simulation/MemoryLists, like the Icarus build.
+# With --trace the model dumps waveforms when run with +trace
+# (+dumpfile=path, default cpu_tests.vcd); without it tracing is compiled
+# out. Needs Verilator 5 (--binary and --timing for the testbench's delays
+# and the SDRAM model).
+
+set -e
+
+TRACE=""
+JOBS="$(nproc 2>/dev/null || echo 4)"
+
+while [[ $# -gt 0 ]]; do
+    case $1 in
+        --trace)
+            TRACE="$2"
+            shift 2
+            ;;
+        --jobs|-j)
+            JOBS="$2"
+            shift 2
+            ;;
+        --help|-h)
+            echo "Usage: $0 [--trace vcd|fst] [--jobs N]"
+            exit 0
+            ;;
+        *)
+            echo "Unknown option: $1"
+            exit 1
+            ;;
+    esac
+done
+
+case "$TRACE" in
+    "")  TRACE_FLAGS="+define+NO_WAVES"; VARIANT="notrace" ;;
+    vcd) TRACE_FLAGS="--trace"; VARIANT="vcd" ;;
+    fst) TRACE_FLAGS="--trace-fst"; VARIANT="fst" ;;
+    *)
+        echo "Unknown trace format: $TRACE (vcd or fst)"
+        exit 1
+        ;;
+esac
+
+TESTBENCH="Hardware/FPGA/Verilog/Simulation/cpu_tests_tb.v"
+OUTPUT_DIR="Hardware/FPGA/Verilog/Simulation/Output/verilator/$VARIANT"
+
+if ! command -v verilator > /dev/null; then
+    echo "verilator not found"
+    exit 1
+fi
+
+mkdir -p "$OUTPUT_DIR"
+
+# The testbench `includes every module by its path from the project root.
+# Lint warnings are left to Quartus and Icarus; -Wno-fatal keeps the
+# behavioral SDRAM and flash models building.
+verilator --binary --timing \
+    --top-module cpu_tb \
+    -I. \
+    -O3 --x-assign fast --noassert \
+    -Wno-fatal -Wno-lint -Wno-style \
+    $TRACE_FLAGS \
+    -j "$JOBS" --build-jobs "$JOBS" \
+    --Mdir "$OUTPUT_DIR/obj" \
+    -o ../Vcpu_tests_tb \
+    "$TESTBENCH"
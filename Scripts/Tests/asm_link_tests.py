@@ -7,6 +7,13 @@ For each userBDOS program:
   3. Run asm-link host build to produce asmlink.bin.
   4. Assert byte equality.
 
+Each program is linked with and without the peephole pass (-p), and with
+--gc-sections.
+
+Linking objects assembled with -c must give the same bytes as linking the
+.asm files, and linking against an archive the same as linking just the
+members it pulls in.
+
 The host asm-link binary is built once per session via gcc -DASMLINK_HOST.
 """
 
@@ -40,6 +47,7 @@ USERLIB_SOURCES = [
     "Software/C/userlib/src/fixed64.c",
     "Software/C/userlib/src/plot.c",
     "Software/C/userlib/src/fnp.c",
+    "Software/C/userlib/src/cluster.c",
 ]
 
 PROGRAMS = [
@@ -114,6 +122,34 @@ def _compile_to_asm(c_or_asm_src: Path, out_dir: Path) -> Path:
     return asm_file
 
 
+def _program_sources(program: str) -> list[Path]:
+    """Return the userlib sources followed by the program's own sources."""
+    prog_c = REPO_ROOT / f"Software/C/userBDOS/{program}.c"
+    if not prog_c.is_file():
+        pytest.skip(f"missing {prog_c}")
+    sources = [REPO_ROOT / s for s in USERLIB_SOURCES]
+    sources.append(prog_c)
+    helper = REPO_ROOT / f"Software/C/userBDOS/{program}_asm.asm"
+    if helper.is_file():
+        sources.append(helper)
+    return sources
+
+
+def _run_asm_link(asm_link_bin: Path, *args) -> subprocess.CompletedProcess:
+    return subprocess.run(
+        [str(asm_link_bin), *map(str, args)],
+        check=True,
+        capture_output=True,
+        text=True,
+    )
+
+
+def _assemble(asm_link_bin: Path, asm_file: Path) -> Path:
+    obj = asm_file.with_suffix(".o")
+    _run_asm_link(asm_link_bin, "-c", "-p", "-o", obj, asm_file)
+    return obj
+
+
 def _list_to_bin(list_path: Path, bin_path: Path):
     """Convert ASMPY .list output (binary text per line, optional comment) to packed .bin."""
     out = bytearray()
@@ -132,16 +168,14 @@ def _list_to_bin(list_path: Path, bin_path: Path):
 
 @pytest.mark.skipif(not _have_tools(), reason="cproc/QBE not built")
 @pytest.mark.parametrize("program", PROGRAMS)
-def test_byte_for_byte_match(program, asm_link_bin, tmp_path):
+@pytest.mark.parametrize(
+    "peephole",
+    [[], ["-p"], ["-p", "--gc-sections"]],
+    ids=["plain", "peephole", "gc-sections"],
+)
+def test_byte_for_byte_match(program, peephole, asm_link_bin, tmp_path):
     # Resolve sources for this program
-    prog_c = REPO_ROOT / f"Software/C/userBDOS/{program}.c"
-    if not prog_c.is_file():
-        pytest.skip(f"missing {prog_c}")
-    sources = [REPO_ROOT / s for s in USERLIB_SOURCES]
-    sources.append(prog_c)
-    helper = REPO_ROOT / f"Software/C/userBDOS/{program}_asm.asm"
-    if helper.is_file():
-        sources.append(helper)
+    sources = _program_sources(program)
 
     # Step 1: compile all sources to .asm in tmp_path
     asm_files = []
@@ -160,6 +194,7 @@ def test_byte_for_byte_match(program, asm_link_bin, tmp_path):
             str(asmpy_list),
             "-H",
             "-i",
+            *peephole,
         ],
         check=True,
         capture_output=True,
@@ -169,7 +204,13 @@ def test_byte_for_byte_match(program, asm_link_bin, tmp_path):
     # Step 3: asm-link
     asmlink_bin = tmp_path / "asmlink.bin"
     subprocess.run(
-        [str(asm_link_bin), *map(str, asm_files), "-o", str(asmlink_bin)],
+        [
+            str(asm_link_bin),
+            *peephole,
+            *map(str, asm_files),
+            "-o",
+            str(asmlink_bin),
+        ],
         check=True,
         capture_output=True,
     )
@@ -185,3 +226,72 @@ def test_byte_for_byte_match(program, asm_link_bin, tmp_path):
             f"{program}: byte mismatch (asmpy={len(a)} bytes, "
             f"asmlink={len(b)} bytes, first diff at byte {first})"
         )
+
+
+@pytest.mark.skipif(not _have_tools(), reason="cproc/QBE not built")
+@pytest.mark.parametrize("program", ["sh", "mbrot"])
+def test_object_link_matches_text_link(program, asm_link_bin, tmp_path):
+    """Test that linking -c objects gives the bytes of linking the .asm files."""
+    # Arrange
+    asm_files = [_compile_to_asm(s, tmp_path) for s in _program_sources(program)]
+    objects = [_assemble(asm_link_bin, f) for f in asm_files]
+    text_bin = tmp_path / "text.bin"
+    obj_bin = tmp_path / "obj.bin"
+    _run_asm_link(asm_link_bin, "-p", "-o", text_bin, *asm_files)
+
+    # Act
+    _run_asm_link(asm_link_bin, "-o", obj_bin, *objects)
+
+    # Assert
+    assert obj_bin.read_bytes() == text_bin.read_bytes()
+
+
+@pytest.mark.skipif(not _have_tools(), reason="cproc/QBE not built")
+def test_archive_link_pulls_needed_members(asm_link_bin, tmp_path):
+    """Test that an archive link only adds the members the program uses."""
+    # Arrange
+    asm_files = [_compile_to_asm(s, tmp_path) for s in _program_sources("cat")]
+    objects = [_assemble(asm_link_bin, f) for f in asm_files]
+    crt0, lib, prog = objects[0], objects[1:-1], objects[-1]
+    archive = tmp_path / "lib.a"
+    _run_asm_link(asm_link_bin, "-a", "-o", archive, *lib)
+    full_bin = tmp_path / "full.bin"
+    _run_asm_link(asm_link_bin, "-o", full_bin, *objects)
+    arc_bin = tmp_path / "arc.bin"
+
+    # Act
+    result = _run_asm_link(asm_link_bin, "-v", "-o", arc_bin, crt0, prog, archive)
+
+    # Assert
+    pulled = [
+        tmp_path / line.split()[1]
+        for line in result.stderr.splitlines()
+        if line.strip().startswith("pulled ")
+    ]
+    assert 0 < len(pulled) < len(lib)
+    ref_bin = tmp_path / "ref.bin"
+    _run_asm_link(asm_link_bin, "-o", ref_bin, crt0, prog, *pulled)
+    assert arc_bin.read_bytes() == ref_bin.read_bytes()
+    assert len(arc_bin.read_bytes()) < len(full_bin.read_bytes())
+
+
+@pytest.mark.skipif(not _have_tools(), reason="cproc/QBE not built")
+def test_asm_input_links_with_objects(asm_link_bin, tmp_path):
+    """Test that one .asm input among objects links like its -c object."""
+    # Arrange
+    asm_files = [_compile_to_asm(s, tmp_path) for s in _program_sources("cat")]
+    objects = [_assemble(asm_link_bin, f) for f in asm_files]
+    obj_bin = tmp_path / "obj.bin"
+    _run_asm_link(asm_link_bin, "-o", obj_bin, *objects)
+    mixed_bin = tmp_path / "mixed.bin"
+    stdin_bin = tmp_path / "stdin.bin"
+
+    # Act
+    _run_asm_link(asm_link_bin, "-p", "-o", mixed_bin, *objects[:-1], asm_files[-1])
+    args = ["-p", "-o", stdin_bin, *objects[:-1], "-"]
+    with asm_files[-1].open("rb") as asm_in:
+        subprocess.run([str(asm_link_bin), *map(str, args)], stdin=asm_in, check=True)
+
+    # Assert
+    assert mixed_bin.read_bytes() == obj_bin.read_bytes()
+    assert stdin_bin.read_bytes() == obj_bin.read_bytes()
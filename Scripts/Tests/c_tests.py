@@ -11,6 +11,21 @@ This script automatically tests the modern C toolchain by:
 Usage:
     python3 Scripts/Tests/c_tests.py
     python3 Scripts/Tests/c_tests.py 01_return/return_constant.c
+    python3 Scripts/Tests/c_tests.py --opt 2
+    python3 Scripts/Tests/c_tests.py --compare 2
+    python3 Scripts/Tests/c_tests.py --emu
+    python3 Scripts/Tests/c_tests.py --sim verilator --shard 1/4
+
+    --opt passes -O<level> to QBE. --compare runs every test at -O0 and
+    at the given level and lists the cycles until the UART result and the
+    stall cycles of both. --emu runs the programs on the functional
+    emulator (BuildTools/emu) instead of the Verilog testbench, with its
+    timing model (-timing) estimating the cycle and stall counts.
+    --sim verilator runs the same testbench as Icarus, built once with
+    Verilator (Scripts/Simulation/verilate_cpu_tests.sh); Icarus stays the
+    reference. --shard K/N runs every N-th test starting at the K-th, to
+    split the suite over machines, and --trace vcd|fst dumps a waveform of
+    every test.
 
     Or via Makefile:
     make test-c
@@ -22,10 +37,13 @@ import sys
 import logging
 import re
 import shutil
+import time
 from concurrent.futures import ProcessPoolExecutor, as_completed
 from dataclasses import dataclass
 from typing import Optional
 
+import verilator_sim
+
 
 # Configure colored logging
 class ColoredFormatter(logging.Formatter):
@@ -70,9 +88,19 @@ class CTestConfig:
     CRT0_PATH: str = "Software/ASM/crt0/crt0_baremetal.asm"
     CONVERTER_SCRIPT: str = "Scripts/Simulation/convert_to_256_bit.py"
     ROM_OFFSET: str = "0x1E000000"
+    EMULATOR_PATH: str = "BuildTools/emu/output/b32p3emu"
 
     PARALLEL_TMP_DIR: str = "Tests/tmp"
 
+    # The testbench prints $time in ps (1ns / 1ps timescale), 10 ns clock
+    SIM_TIME_PER_CYCLE: int = 10000
+    # cpu_tests_tb.v ends the simulation after this many clock cycles
+    SIM_CYCLES: int = 30000
+
+
+# Stall cycle counters printed by the testbench at the end of a run
+STALL_KINDS = ("load-use", "cache-line", "backend")
+
 
 class CTestError(Exception):
     pass
@@ -101,30 +129,50 @@ class CTestRunner:
         self,
         config: CTestConfig = None,
         temp_dir: Optional[str] = None,
+        opt_level: int = 0,
+        emu: bool = False,
+        sim: str = "icarus",
+        trace: Optional[str] = None,
     ):
         self.config = config or CTestConfig()
         self.temp_dir = temp_dir
+        self.opt_level = opt_level
+        self.emu = emu
+        self.sim = sim
+        self.trace = trace
+        self.dumpfile: Optional[str] = None
 
         if temp_dir:
             self._setup_temp_paths()
 
     def _setup_temp_paths(self):
         self.config.TMP_DIRECTORY = self.temp_dir
-        self.config.ROM_LIST_PATH = os.path.join(self.temp_dir, "rom.list")
-        self.config.RAM_LIST_PATH = os.path.join(self.temp_dir, "ram.list")
-        self.config.SDRAM_INIT_LIST_PATH = os.path.join(self.temp_dir, "sdram.list")
+        # The Verilator model opens the lists relative to its working directory
+        list_dir = (
+            verilator_sim.memory_lists_dir(self.temp_dir)
+            if self.sim == "verilator"
+            else self.temp_dir
+        )
+        self.config.ROM_LIST_PATH = os.path.join(list_dir, "rom.list")
+        self.config.RAM_LIST_PATH = os.path.join(list_dir, "ram.list")
+        self.config.SDRAM_INIT_LIST_PATH = os.path.join(list_dir, "sdram.list")
         self.config.VERILOG_OUTPUT_PATH = os.path.join(self.temp_dir, "cpu.out")
         self.testbench_path = os.path.join(self.temp_dir, "cpu_tests_tb.v")
 
     def _prepare_temp_testbench(self):
-        with open(self.config.TESTBENCH_PATH, "r") as f:
-            content = f.read()
+        list_dir = os.path.dirname(self.config.ROM_LIST_PATH)
+        os.makedirs(list_dir, exist_ok=True)
+
+        # The Verilator model is built once and runs in the temp directory
+        if self.sim == "icarus":
+            with open(self.config.TESTBENCH_PATH, "r") as f:
+                content = f.read()
 
-        old_base = "Hardware/FPGA/Verilog/Simulation/MemoryLists"
-        content = content.replace(old_base, self.temp_dir)
+            old_base = "Hardware/FPGA/Verilog/Simulation/MemoryLists"
+            content = content.replace(old_base, self.temp_dir)
 
-        with open(self.testbench_path, "w") as f:
-            f.write(content)
+            with open(self.testbench_path, "w") as f:
+                f.write(content)
 
         static_files = [
             "vram32.list",
@@ -135,7 +183,7 @@ class CTestRunner:
         ]
         for filename in static_files:
             src = os.path.join(self.config.MEMORY_LISTS_DIR, filename)
-            dst = os.path.join(self.temp_dir, filename)
+            dst = os.path.join(list_dir, filename)
             if os.path.exists(src):
                 shutil.copy(src, dst)
 
@@ -174,7 +222,32 @@ class CTestRunner:
 
         raise ResultParsingError("No UART transmission found in simulation output")
 
+    def _parse_counts(self, result: str) -> dict[str, int]:
+        """Cycles until the first UART transmission and stall cycles."""
+        counts = {}
+        match = re.search(r"(\d+)\s+UART TX:", result)
+        if match:
+            counts["cycles"] = int(match.group(1)) // self.config.SIM_TIME_PER_CYCLE
+        match = re.search(
+            r"Stalls: load-use (\d+), cache-line (\d+), backend (\d+)", result
+        )
+        if match:
+            counts.update(zip(STALL_KINDS, map(int, match.groups())))
+        return counts
+
     def _run_simulation(self) -> str:
+        dump_args = verilator_sim.trace_args(self.sim, self.trace, self.dumpfile)
+
+        if self.sim == "verilator":
+            # Prebuilt model, run where its MemoryLists tree is
+            sim_cmd = f"{verilator_sim.model_path(self.trace)}{dump_args}"
+            exit_code, output = self._run_command(
+                sim_cmd, "Running Verilator model", cwd=self.temp_dir
+            )
+            if exit_code != 0:
+                raise SimulationError(f"Simulation failed: {output}")
+            return output
+
         testbench = self.testbench_path if self.temp_dir else self.config.TESTBENCH_PATH
 
         compile_cmd = f"iverilog -o {self.config.VERILOG_OUTPUT_PATH} {testbench}"
@@ -182,13 +255,25 @@ class CTestRunner:
         if exit_code != 0:
             raise SimulationError(f"Failed to compile testbench: {output}")
 
-        sim_cmd = f"vvp {self.config.VERILOG_OUTPUT_PATH}"
+        sim_cmd = f"vvp {self.config.VERILOG_OUTPUT_PATH}{dump_args}"
         exit_code, output = self._run_command(sim_cmd, "Running simulation")
         if exit_code != 0:
             raise SimulationError(f"Simulation failed: {output}")
 
         return output
 
+    def _run_emulator(self, list_path: str) -> str:
+        """Run the program on b32p3emu with testbench-style output."""
+        emu_cmd = (
+            f"{self.config.EMULATOR_PATH} -tb -timing "
+            f"-limit {self.config.SIM_CYCLES} {list_path}"
+        )
+        exit_code, output = self._run_command(emu_cmd, "Running emulator")
+        # Exit status 2: the cycle limit ended the run, as in the testbench
+        if exit_code not in (0, 2):
+            raise SimulationError(f"Emulation failed: {output}")
+        return output
+
     def _get_extra_sources(self, test_lines: list[str]) -> list[str]:
         """Parse // extra_sources=path1,path2 directive from test file."""
         pattern = re.compile(r"//\s*extra_sources\s*=\s*(.+)", re.IGNORECASE)
@@ -218,6 +303,8 @@ class CTestRunner:
         sources = f"{self.config.CRT0_PATH} {c_path}"
         if extra_sources:
             sources += " " + " ".join(extra_sources)
+        if self.opt_level:
+            compile_flags = f"{compile_flags} -O{self.opt_level}"
         compile_cmd = (
             f"{self.config.COMPILE_SCRIPT} "
             f"{sources} "
@@ -269,7 +356,8 @@ class CTestRunner:
                     ) from e
         raise CTestError("No expected value found in test file")
 
-    def run_single_test(self, test_file: str) -> None:
+    def run_single_test(self, test_file: str) -> dict[str, int]:
+        """Run one test and return its cycle and stall counts."""
         test_path = os.path.join(self.config.TESTS_DIRECTORY, test_file)
 
         # Read expected value
@@ -282,9 +370,11 @@ class CTestRunner:
         expected_value = self._get_expected_value(lines)
         extra_sources = self._get_extra_sources(lines)
         compile_flags = self._get_compile_flags(lines)
+        if self.trace:
+            self.dumpfile = verilator_sim.waves_path(test_file, self.trace)
 
         # Prepare temp testbench if in isolated mode
-        if self.temp_dir:
+        if self.temp_dir and not self.emu:
             self._prepare_temp_testbench()
 
         # Compile using modern C toolchain
@@ -292,11 +382,14 @@ class CTestRunner:
         list_path = os.path.join(self.config.TMP_DIRECTORY, f"{base_name}.list")
         self._compile_modern_c(test_path, list_path, extra_sources, compile_flags)
 
-        # Prepare simulation environment
-        self._prepare_simulation_environment(list_path)
+        if self.emu:
+            simulation_output = self._run_emulator(list_path)
+        else:
+            # Prepare simulation environment
+            self._prepare_simulation_environment(list_path)
 
-        # Run simulation
-        simulation_output = self._run_simulation()
+            # Run simulation
+            simulation_output = self._run_simulation()
 
         # Parse and check result
         resulting_value = self._parse_simulation_result(simulation_output)
@@ -304,6 +397,7 @@ class CTestRunner:
             raise CTestError(
                 f"Expected 0x{expected_value:02X}, got 0x{resulting_value:02X}"
             )
+        return self._parse_counts(simulation_output)
 
     def get_test_files(self) -> list[str]:
         try:
@@ -356,17 +450,19 @@ class CTestRunner:
         return passed_tests, failed_tests
 
 
-def _run_single_test_parallel(args: tuple) -> tuple[str, bool, str]:
-    test_file, temp_base_dir, test_index = args
+def _run_single_test_parallel(args: tuple) -> tuple[str, bool, str, dict[str, int]]:
+    test_file, temp_base_dir, test_index, opt_level, emu, sim, trace = args
     temp_dir = os.path.join(temp_base_dir, f"test_{test_index}")
     os.makedirs(temp_dir, exist_ok=True)
 
     try:
-        runner = CTestRunner(temp_dir=temp_dir)
-        runner.run_single_test(test_file)
-        return (test_file, True, "")
+        runner = CTestRunner(
+            temp_dir=temp_dir, opt_level=opt_level, emu=emu, sim=sim, trace=trace
+        )
+        counts = runner.run_single_test(test_file)
+        return (test_file, True, "", counts)
     except Exception as e:
-        return (test_file, False, str(e))
+        return (test_file, False, str(e), {})
     finally:
         try:
             shutil.rmtree(temp_dir)
@@ -438,12 +534,61 @@ def _display_results_grouped(
     print(f"{'=' * 60}\n")
 
 
+def _display_cycle_comparison(
+    base: dict[str, dict[str, int]], opt: dict[str, dict[str, int]], opt_level: int
+) -> None:
+    BOLD = "\033[1m"
+    RESET = "\033[0m"
+
+    tests = sorted(set(base) & set(opt))
+    if not tests:
+        print("No cycle counts to compare\n")
+        return
+
+    def row(name, b, o):
+        ratio = o["cycles"] / b["cycles"] if b["cycles"] else 1.0
+        stalls = " ".join(
+            f"{b.get(k, '-'):>6} {o.get(k, '-'):>6}" for k in STALL_KINDS
+        )
+        return f"{name:<40} {b['cycles']:>8} {o['cycles']:>8} {ratio:>6.3f} {stalls}"
+
+    opt_name = f"-O{opt_level}"
+    head = " ".join(f"{k:>13}" for k in STALL_KINDS)
+    print(f"{BOLD}{'test':<40} {'-O0':>8} {opt_name:>8} {'ratio':>6} {head}{RESET}")
+    for test in tests:
+        print(row(test, base[test], opt[test]))
+
+    def total(counts):
+        keys = ("cycles",) + STALL_KINDS
+        return {k: sum(counts[t].get(k, 0) for t in tests) for k in keys}
+
+    print(f"{BOLD}{row('total', total(base), total(opt))}{RESET}\n")
+
+
 class ParallelCTestRunner:
     DEFAULT_WORKERS = int(os.environ.get("FPGC_TEST_WORKERS", 4))
 
-    def __init__(self, max_workers: Optional[int] = None):
-        self.max_workers = max_workers or self.DEFAULT_WORKERS
+    def __init__(
+        self,
+        max_workers: Optional[int] = None,
+        opt_level: int = 0,
+        emu: bool = False,
+        sim: str = "icarus",
+        trace: Optional[str] = None,
+        shard: Optional[tuple[int, int]] = None,
+    ):
+        # Verilator and the emulator need little memory: one worker per core
+        default_workers = self.DEFAULT_WORKERS
+        if (emu or sim == "verilator") and "FPGC_TEST_WORKERS" not in os.environ:
+            default_workers = os.cpu_count() or default_workers
+        self.max_workers = max_workers or default_workers
+        self.opt_level = opt_level
+        self.emu = emu
+        self.sim = sim
+        self.trace = trace
+        self.shard = shard
         self.config = CTestConfig()
+        self.counts: dict[str, dict[str, int]] = {}
 
     def run_tests_parallel(self) -> tuple[list[str], list[tuple[str, str]]]:
         GREEN = "\033[92m"
@@ -452,17 +597,22 @@ class ParallelCTestRunner:
 
         print(
             f"Running modern C compiler tests in parallel "
-            f"({self.max_workers} workers)...\n"
+            f"({self.max_workers} workers, -O{self.opt_level}"
+            f", {'emulator' if self.emu else self.sim})...\n"
         )
+        start = time.monotonic()
 
         temp_base_dir = os.path.abspath(self.config.PARALLEL_TMP_DIR)
         os.makedirs(temp_base_dir, exist_ok=True)
 
         runner = CTestRunner()
-        tests = runner.get_test_files()
+        tests = verilator_sim.select_shard(runner.get_test_files(), self.shard)
         total = len(tests)
 
-        test_args = [(test, temp_base_dir, i) for i, test in enumerate(tests)]
+        test_args = [
+            (test, temp_base_dir, i, self.opt_level, self.emu, self.sim, self.trace)
+            for i, test in enumerate(tests)
+        ]
 
         passed_tests: list[str] = []
         failed_tests: list[tuple[str, str]] = []
@@ -476,12 +626,14 @@ class ParallelCTestRunner:
                 }
 
                 for future in as_completed(futures):
-                    test_file, passed, error_msg = future.result()
+                    test_file, passed, error_msg, counts = future.result()
                     completed += 1
 
                     if passed:
                         print(f"{GREEN}.{RESET}", end="", flush=True)
                         passed_tests.append(test_file)
+                        if "cycles" in counts:
+                            self.counts[test_file] = counts
                     else:
                         print(f"{RED}F{RESET}", end="", flush=True)
                         failed_tests.append((test_file, error_msg))
@@ -499,6 +651,13 @@ class ParallelCTestRunner:
             except Exception:
                 pass
 
+        verilator_sim.report_wall_time(
+            "C test",
+            "emulator" if self.emu else self.sim,
+            self.max_workers,
+            total,
+            start,
+        )
         return sorted(passed_tests), sorted(failed_tests)
 
 
@@ -512,24 +671,91 @@ def main() -> None:
         default=None,
         help="Number of parallel workers (default: 4)",
     )
+    parser.add_argument(
+        "--opt",
+        type=int,
+        default=0,
+        metavar="LEVEL",
+        help="QBE optimization level passed as -O<LEVEL> (default: 0)",
+    )
+    parser.add_argument(
+        "--compare",
+        type=int,
+        default=None,
+        metavar="LEVEL",
+        help="Run all tests at -O0 and at -O<LEVEL> and compare cycle counts",
+    )
+    parser.add_argument(
+        "--emu",
+        action="store_true",
+        help="Run on the functional emulator instead of the Verilog testbench",
+    )
+    parser.add_argument(
+        "--sim",
+        choices=verilator_sim.SIMULATORS + ("emu",),
+        default="icarus",
+        help="Simulator: icarus (reference, default), verilator or emu (as --emu)",
+    )
+    parser.add_argument(
+        "--trace",
+        choices=verilator_sim.TRACE_FORMATS,
+        default=None,
+        help="Dump a waveform of every test to "
+        "Hardware/FPGA/Verilog/Simulation/Output/waves",
+    )
+    parser.add_argument(
+        "--shard",
+        default=None,
+        metavar="K/N",
+        help="Run only the K-th of N interleaved slices of the tests",
+    )
     parser.add_argument(
         "test_file",
         nargs="?",
         help="Specific test file to run (e.g., 01_return/return_constant.c)",
     )
     args = parser.parse_args()
+    try:
+        shard = verilator_sim.parse_shard(args.shard)
+    except ValueError as e:
+        parser.error(str(e))
+    if args.sim == "emu":
+        args.emu = True
+        args.sim = "icarus"
+    if args.sim == "verilator" and not args.emu:
+        try:
+            verilator_sim.build(args.trace)
+        except RuntimeError as e:
+            logger.error(str(e))
+            sys.exit(1)
+    sim_args = {"emu": args.emu, "sim": args.sim, "trace": args.trace}
 
     if args.test_file:
-        runner = CTestRunner()
+        runner = CTestRunner(opt_level=args.opt, **sim_args)
         try:
             os.makedirs(runner.config.TMP_DIRECTORY, exist_ok=True)
-            runner.run_single_test(args.test_file)
-            logger.info(f"PASS: {args.test_file}")
+            counts = runner.run_single_test(args.test_file)
+            details = ", ".join(f"{n} {k}" for k, n in counts.items())
+            logger.info(f"PASS: {args.test_file} ({details})")
         except Exception as e:
             logger.error(f"FAIL: {args.test_file} -> {e}")
             sys.exit(1)
+    elif args.compare is not None:
+        results = []
+        for level in (0, args.compare):
+            runner = ParallelCTestRunner(
+                max_workers=args.workers, opt_level=level, shard=shard, **sim_args
+            )
+            passed, failed = runner.run_tests_parallel()
+            _display_results_grouped(passed, failed, len(passed) + len(failed))
+            results.append((runner.counts, failed))
+        _display_cycle_comparison(results[0][0], results[1][0], args.compare)
+        if results[0][1] or results[1][1]:
+            sys.exit(1)
     else:
-        runner = ParallelCTestRunner(max_workers=args.workers)
+        runner = ParallelCTestRunner(
+            max_workers=args.workers, opt_level=args.opt, shard=shard, **sim_args
+        )
         passed, failed = runner.run_tests_parallel()
         total = len(passed) + len(failed)
         _display_results_grouped(passed, failed, total)
@@ -0,0 +1,52 @@
+"""
+Host tests for the userlib cluster runtime.
+
+Builds Tests/host/cluster_sim.c with gcc against the real
+Software/C/userlib/src/cluster.c and fnp.c (the test provides a socket
+based syscall shim), then runs each scenario: the coordinator and every
+simulated worker FPGC are separate processes.
+"""
+
+import subprocess
+from pathlib import Path
+
+import pytest
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+TEST_SRC = REPO_ROOT / "Tests/host/cluster_sim.c"
+CLUSTER_SRC = REPO_ROOT / "Software/C/userlib/src/cluster.c"
+FNP_SRC = REPO_ROOT / "Software/C/userlib/src/fnp.c"
+INCLUDE = REPO_ROOT / "Software/C/userlib/include"
+
+SCENARIOS = ["basic", "straggler", "crash", "lossy", "late", "local"]
+
+
+@pytest.fixture(scope="session")
+def sim_binary(tmp_path_factory):
+    out = tmp_path_factory.mktemp("cluster") / "cluster_sim"
+    subprocess.run(
+        [
+            "gcc",
+            "-O0",
+            "-Wall",
+            "-Werror",
+            f"-I{INCLUDE}",
+            str(TEST_SRC),
+            str(CLUSTER_SRC),
+            str(FNP_SRC),
+            "-o",
+            str(out),
+        ],
+        check=True,
+    )
+    return out
+
+
+@pytest.mark.parametrize("scenario", SCENARIOS)
+def test_cluster_scenario(sim_binary, scenario):
+    result = subprocess.run(
+        [str(sim_binary), scenario], capture_output=True, text=True, timeout=120
+    )
+    assert result.returncode == 0, (
+        f"cluster scenario '{scenario}' failed:\nstdout:\n{result.stdout}\nstderr:\n{result.stderr}"
+    )
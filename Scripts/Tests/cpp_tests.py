@@ -7,11 +7,19 @@ For each userBDOS program:
   2. Compile each .c source via my-cpp  → cproc → QBE → .asm  (my-pipeline)
   3. Run asm-link on each set; byte-compare resulting binaries.
 
+Each doom source must give the same QBE output through either cpp, and a
+file of directive cases (#if, #elif, #undef, # and ##, calls over several
+lines) the same tokens.
+
 The host cpp binary is built once per session via gcc -DCPP_HOST.
+
+Run as a script, this measures preprocessing throughput on doom/*.c:
+    python Scripts/Tests/cpp_tests.py [--baseline REV] [--runs N]
 """
 
 import shutil
 import subprocess
+import time
 from pathlib import Path
 
 import pytest
@@ -24,6 +32,56 @@ ASM_LINK_SRC = REPO_ROOT / "Software/C/userBDOS/asm-link.c"
 CPP_SRC = REPO_ROOT / "Software/C/userBDOS/cpp.c"
 LIBC_INCLUDE = REPO_ROOT / "Software/C/libc/include"
 USERLIB_INCLUDE = REPO_ROOT / "Software/C/userlib/include"
+DOOM_DIR = REPO_ROOT / "Software/C/userBDOS/doom"
+DOOM_SOURCES = sorted(DOOM_DIR.glob("*.c"))
+DOOM_INCLUDES = [f"-I{LIBC_INCLUDE}", f"-I{USERLIB_INCLUDE}", f"-I{DOOM_DIR}"]
+
+DIRECTIVE_CASES = r"""
+#define STR(x) #x
+#define XSTR(x) STR(x)
+#define CAT(a, b) a ## b
+#define XCAT(a, b) CAT(a, b)
+#define N 4
+#define foo (foo + 1)
+#define F G
+#define G(x) (x * 2)
+#define OBJ pre ## fix
+#define EMPTY
+#if defined(N) && N * 2 == 8 && !defined EMPTYX
+int a = 1;
+#elif 1
+int a = 2;
+#else
+int a = 3;
+#endif
+#if 0
+#elif N > 3 ? 1 : 1 / 0
+int b = 1;
+#endif
+#if (1 << 4) == 0x10 && 'A' == 65 && -1 < 0 && 010 == 8 && 7 % 3 == 1
+int c;
+#endif
+#undef N
+#ifdef N
+int bad;
+#endif
+#define N 5
+char *s = STR(a "b\n" 'c'   d);
+char *t = XSTR(N);
+int CAT(x, N) = XCAT(y, N);
+int v = foo;
+int w = F(3);
+int OBJ;
+int m = G(1 +
+   2) + XCAT(
+   q, r);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+int le;
+#endif
+#if UNDEFINED_THING || EMPTY 0
+int z;
+#endif
+"""
 
 USERLIB_SOURCES = [
     "Software/ASM/crt0/crt0_ubdos.asm",
@@ -41,6 +99,7 @@ USERLIB_SOURCES = [
     "Software/C/userlib/src/fixed64.c",
     "Software/C/userlib/src/plot.c",
     "Software/C/userlib/src/fnp.c",
+    "Software/C/userlib/src/cluster.c",
 ]
 
 PROGRAMS = [
@@ -183,3 +242,127 @@ def test_my_cpp_matches_gcc_cpp(program, tools, tmp_path):
             f"{program}: byte mismatch (gcc-cpp={len(a)}, my-cpp={len(b)}, "
             f"first diff at byte {first})"
         )
+
+
+def _qbe_output(cpp_argv: list) -> bytes:
+    cpp = subprocess.run(cpp_argv, capture_output=True, check=True)
+    cproc = subprocess.run(
+        [str(CPROC), "-t", "b32p3"],
+        input=cpp.stdout,
+        capture_output=True,
+        check=True,
+    )
+    qbe = subprocess.run(
+        [str(QBE)],
+        input=cproc.stdout,
+        capture_output=True,
+        check=True,
+    )
+    return qbe.stdout
+
+
+@pytest.mark.skipif(not _have_tools(), reason="cproc/QBE not built")
+@pytest.mark.parametrize("src", DOOM_SOURCES, ids=lambda p: p.stem)
+def test_doom_matches_gcc_cpp(src, tools):
+    _, my_cpp = tools
+    gcc = _qbe_output(["cpp", "-nostdinc", "-P", *DOOM_INCLUDES, str(src)])
+    mine = _qbe_output([str(my_cpp), *DOOM_INCLUDES, str(src)])
+    assert mine == gcc
+
+
+def test_directives_match_gcc_cpp(tools, tmp_path):
+    _, my_cpp = tools
+    src = tmp_path / "cases.c"
+    src.write_text(DIRECTIVE_CASES)
+    gcc = subprocess.run(
+        ["cpp", "-P", str(src)], capture_output=True, text=True, check=True
+    )
+    mine = subprocess.run(
+        [str(my_cpp), str(src)], capture_output=True, text=True, check=True
+    )
+    assert mine.stdout.split() == gcc.stdout.split()
+
+
+def _build_cpp(src: Path, out: Path, opt: str = "-O0") -> None:
+    subprocess.run(
+        [
+            "gcc",
+            opt,
+            "-w",
+            "-DCPP_HOST",
+            "-o",
+            str(out),
+            str(src),
+        ],
+        check=True,
+    )
+
+
+def _bench(cpp_argv: list, runs: int) -> tuple[float, int]:
+    """Best time over runs to preprocess every doom source, output bytes."""
+    best = None
+    out_bytes = 0
+    for _ in range(runs):
+        out_bytes = 0
+        start = time.perf_counter()
+        for src in DOOM_SOURCES:
+            res = subprocess.run(
+                [*cpp_argv, *DOOM_INCLUDES, str(src)],
+                capture_output=True,
+            )
+            out_bytes += len(res.stdout)
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best, out_bytes
+
+
+def main():
+    import argparse
+    import tempfile
+
+    parser = argparse.ArgumentParser(
+        description="Preprocessing throughput of cpp.c on doom/*.c"
+    )
+    parser.add_argument(
+        "--baseline", help="also measure cpp.c as of this git revision"
+    )
+    parser.add_argument("--runs", type=int, default=3, help="best of N runs")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmp:
+        tmp = Path(tmp)
+        cpps = [("cpp.c", tmp / "cpp")]
+        _build_cpp(CPP_SRC, tmp / "cpp", "-O2")
+        if args.baseline:
+            old_src = tmp / "cpp_baseline.c"
+            old_src.write_bytes(
+                subprocess.run(
+                    [
+                        "git",
+                        "show",
+                        f"{args.baseline}:{CPP_SRC.relative_to(REPO_ROOT)}",
+                    ],
+                    cwd=REPO_ROOT,
+                    capture_output=True,
+                    check=True,
+                ).stdout
+            )
+            _build_cpp(old_src, tmp / "cpp_baseline", "-O2")
+            cpps.append((f"cpp.c@{args.baseline}", tmp / "cpp_baseline"))
+
+        print(f"{len(DOOM_SOURCES)} doom sources, best of {args.runs}")
+        for name, exe in cpps:
+            secs, out_bytes = _bench([str(exe)], args.runs)
+            print(
+                f"{name:24} {secs * 1000:8.1f} ms "
+                f"{out_bytes / secs / 1e6:7.2f} MB/s out"
+            )
+        secs, out_bytes = _bench(["cpp", "-nostdinc", "-P"], args.runs)
+        print(
+            f"{'gcc cpp':24} {secs * 1000:8.1f} ms "
+            f"{out_bytes / secs / 1e6:7.2f} MB/s out"
+        )
+
+
+if __name__ == "__main__":
+    main()
@@ -3,10 +3,13 @@ import subprocess
 import sys
 import logging
 import shutil
+import time
 from concurrent.futures import ProcessPoolExecutor, as_completed
 from dataclasses import dataclass
 from typing import Optional
 
+import verilator_sim
+
 
 # Configure colored logging
 class ColoredFormatter(logging.Formatter):
@@ -82,15 +85,26 @@ class ResultParsingError(CPUTestError):
 class CPUTestRunner:
     """Main class for running CPU tests with improved error handling and logging."""
 
-    def __init__(self, config: CPUTestConfig = None, temp_dir: Optional[str] = None):
+    def __init__(
+        self,
+        config: CPUTestConfig = None,
+        temp_dir: Optional[str] = None,
+        sim: str = "icarus",
+        trace: Optional[str] = None,
+    ):
         """Initialize the test runner with configuration.
 
         Args:
             config: Configuration for the test runner
             temp_dir: Optional temporary directory for isolated test execution
+            sim: Simulator, icarus or verilator (built beforehand)
+            trace: Waveform format to dump for each test, vcd or fst
         """
         self.config = config or CPUTestConfig()
         self.temp_dir = temp_dir
+        self.sim = sim
+        self.trace = trace
+        self.dumpfile: Optional[str] = None
 
         # If using temp_dir, override paths for isolation
         if temp_dir:
@@ -98,24 +112,35 @@ class CPUTestRunner:
 
     def _setup_temp_paths(self):
         """Set up paths for isolated execution in temp directory."""
-        self.config.ROM_LIST_PATH = os.path.join(self.temp_dir, "rom.list")
-        self.config.RAM_LIST_PATH = os.path.join(self.temp_dir, "ram.list")
-        self.config.SDRAM_INIT_LIST_PATH = os.path.join(self.temp_dir, "sdram.list")
+        # The Verilator model opens the lists relative to its working directory
+        list_dir = (
+            verilator_sim.memory_lists_dir(self.temp_dir)
+            if self.sim == "verilator"
+            else self.temp_dir
+        )
+        self.config.ROM_LIST_PATH = os.path.join(list_dir, "rom.list")
+        self.config.RAM_LIST_PATH = os.path.join(list_dir, "ram.list")
+        self.config.SDRAM_INIT_LIST_PATH = os.path.join(list_dir, "sdram.list")
         self.config.VERILOG_OUTPUT_PATH = os.path.join(self.temp_dir, "cpu.out")
         self.testbench_path = os.path.join(self.temp_dir, "cpu_tests_tb.v")
 
     def _prepare_temp_testbench(self):
         """Create a modified testbench with paths pointing to temp directory."""
-        with open(self.config.TESTBENCH_PATH, "r") as f:
-            content = f.read()
+        list_dir = os.path.dirname(self.config.ROM_LIST_PATH)
+        os.makedirs(list_dir, exist_ok=True)
+
+        # The Verilator model is built once and runs in the temp directory
+        if self.sim == "icarus":
+            with open(self.config.TESTBENCH_PATH, "r") as f:
+                content = f.read()
 
-        # Replace all MemoryLists paths with temp directory paths
-        # The testbench uses relative paths from project root
-        old_base = "Hardware/FPGA/Verilog/Simulation/MemoryLists"
-        content = content.replace(old_base, self.temp_dir)
+            # Replace all MemoryLists paths with temp directory paths
+            # The testbench uses relative paths from project root
+            old_base = "Hardware/FPGA/Verilog/Simulation/MemoryLists"
+            content = content.replace(old_base, self.temp_dir)
 
-        with open(self.testbench_path, "w") as f:
-            f.write(content)
+            with open(self.testbench_path, "w") as f:
+                f.write(content)
 
         # Copy static memory list files that don't change (vram, spiflash, sdram base)
         # Note: sdram.list is needed even for ROM tests because the testbench always
@@ -131,17 +156,20 @@ class CPUTestRunner:
         ]
         for filename in static_files:
             src = os.path.join(self.config.MEMORY_LISTS_DIR, filename)
-            dst = os.path.join(self.temp_dir, filename)
+            dst = os.path.join(list_dir, filename)
             if os.path.exists(src):
                 shutil.copy(src, dst)
 
-    def _run_command(self, command: str, description: str) -> tuple[int, str]:
+    def _run_command(
+        self, command: str, description: str, cwd: Optional[str] = None
+    ) -> tuple[int, str]:
         """
         Run a shell command and return the exit code and output.
 
         Args:
             command: The command to execute
             description: Description of what the command does for logging
+            cwd: Working directory (default: the current one)
 
         Returns:
             Tuple of (exit_code, output)
@@ -152,7 +180,12 @@ class CPUTestRunner:
         logger.debug(f"Running command: {command}")
         try:
             result = subprocess.run(
-                command, shell=True, capture_output=True, text=True, timeout=60
+                command,
+                shell=True,
+                capture_output=True,
+                text=True,
+                timeout=60,
+                cwd=cwd,
             )
             return result.returncode, result.stdout + result.stderr
         except subprocess.TimeoutExpired:
@@ -206,6 +239,18 @@ class CPUTestRunner:
         Raises:
             SimulationError: If simulation fails
         """
+        dump_args = verilator_sim.trace_args(self.sim, self.trace, self.dumpfile)
+
+        if self.sim == "verilator":
+            # Prebuilt model, run where its MemoryLists tree is
+            sim_cmd = f"{verilator_sim.model_path(self.trace)}{dump_args}"
+            exit_code, output = self._run_command(
+                sim_cmd, "Running Verilator model", cwd=self.temp_dir
+            )
+            if exit_code != 0:
+                raise SimulationError(f"Simulation failed: {output}")
+            return output
+
         # Use temp testbench if in temp directory mode
         testbench = self.testbench_path if self.temp_dir else self.config.TESTBENCH_PATH
 
@@ -217,7 +262,7 @@ class CPUTestRunner:
             raise SimulationError(f"Failed to compile testbench: {output}")
 
         # Run simulation
-        sim_cmd = f"vvp {self.config.VERILOG_OUTPUT_PATH}"
+        sim_cmd = f"vvp {self.config.VERILOG_OUTPUT_PATH}{dump_args}"
         exit_code, output = self._run_command(sim_cmd, "Running simulation")
 
         if exit_code != 0:
@@ -317,6 +362,11 @@ class CPUTestRunner:
             raise CPUTestError(f"Failed to read test file {test_path}: {e}")
 
         expected_value = self._get_expected_value(lines)
+        if self.trace:
+            suffix = "_ram" if use_ram else "_rom"
+            self.dumpfile = verilator_sim.waves_path(
+                os.path.splitext(test_file)[0] + suffix, self.trace
+            )
 
         # Prepare temp testbench if running in isolated mode
         if self.temp_dir:
@@ -437,19 +487,19 @@ def _run_single_test_parallel(args: tuple) -> tuple[str, bool, str]:
     Run a single test in isolation for parallel execution.
 
     Args:
-        args: Tuple of (test_file, use_ram, temp_base_dir, test_index)
+        args: Tuple of (test_file, use_ram, temp_base_dir, test_index, sim, trace)
 
     Returns:
         Tuple of (test_file, passed, error_message)
     """
-    test_file, use_ram, temp_base_dir, test_index = args
+    test_file, use_ram, temp_base_dir, test_index, sim, trace = args
 
     # Create a unique temp directory for this test
     temp_dir = os.path.join(temp_base_dir, f"test_{test_index}")
     os.makedirs(temp_dir, exist_ok=True)
 
     try:
-        runner = CPUTestRunner(temp_dir=temp_dir)
+        runner = CPUTestRunner(temp_dir=temp_dir, sim=sim, trace=trace)
         runner.run_single_test(test_file, use_ram=use_ram)
         return (test_file, True, "")
     except Exception as e:
@@ -659,16 +709,37 @@ class ParallelCPUTestRunner:
     # Can be overridden via FPGC_TEST_WORKERS environment variable
     DEFAULT_WORKERS = int(os.environ.get("FPGC_TEST_WORKERS", 4))
 
-    def __init__(self, max_workers: Optional[int] = None):
+    def __init__(
+        self,
+        max_workers: Optional[int] = None,
+        sim: str = "icarus",
+        trace: Optional[str] = None,
+        shard: Optional[tuple[int, int]] = None,
+    ):
         """
         Initialize parallel test runner.
 
         Args:
-            max_workers: Maximum number of parallel workers. Defaults to 4.
+            max_workers: Maximum number of parallel workers. Defaults to 4,
+                or one per core with Verilator.
+            sim: Simulator, icarus or verilator
+            trace: Waveform format to dump for each test, vcd or fst
+            shard: (K, N) to run only the K-th of N slices of the tests
         """
-        self.max_workers = max_workers or self.DEFAULT_WORKERS
+        default_workers = self.DEFAULT_WORKERS
+        if sim == "verilator" and "FPGC_TEST_WORKERS" not in os.environ:
+            default_workers = os.cpu_count() or default_workers
+        self.max_workers = max_workers or default_workers
+        self.sim = sim
+        self.trace = trace
+        self.shard = shard
         self.config = CPUTestConfig()
 
+    def _get_tests(self) -> list[str]:
+        """This shard's tests."""
+        tests = CPUTestRunner().get_test_files()
+        return verilator_sim.select_shard(tests, self.shard)
+
     def run_tests_parallel(
         self, use_ram: bool = False
     ) -> tuple[list[str], list[tuple[str, str]]]:
@@ -689,17 +760,20 @@ class ParallelCPUTestRunner:
         print(
             f"Running CPU tests from {memory_type} in parallel ({self.max_workers} workers)...\n"
         )
+        start = time.monotonic()
 
         # Create base temp directory
         temp_base_dir = os.path.abspath(self.config.PARALLEL_TMP_DIR)
         os.makedirs(temp_base_dir, exist_ok=True)
 
-        runner = CPUTestRunner()
-        tests = runner.get_test_files()
+        tests = self._get_tests()
         total = len(tests)
 
         # Prepare arguments for parallel execution
-        test_args = [(test, use_ram, temp_base_dir, i) for i, test in enumerate(tests)]
+        test_args = [
+            (test, use_ram, temp_base_dir, i, self.sim, self.trace)
+            for i, test in enumerate(tests)
+        ]
 
         passed_tests: list[str] = []
         failed_tests: list[tuple[str, str]] = []
@@ -740,6 +814,9 @@ class ParallelCPUTestRunner:
             except Exception:
                 pass
 
+        verilator_sim.report_wall_time(
+            "CPU test", self.sim, self.max_workers, total, start
+        )
         return sorted(passed_tests), sorted(failed_tests)
 
     def run_tests_combined(
@@ -759,20 +836,21 @@ class ParallelCPUTestRunner:
         print(
             f"Running CPU tests (ROM + RAM) in parallel ({self.max_workers} workers)...\n"
         )
+        start = time.monotonic()
 
         # Create base temp directory
         temp_base_dir = os.path.abspath(self.config.PARALLEL_TMP_DIR)
         os.makedirs(temp_base_dir, exist_ok=True)
 
-        runner = CPUTestRunner()
-        tests = runner.get_test_files()
+        tests = self._get_tests()
         total = len(tests) * 2  # ROM + RAM for each test
 
         # Prepare arguments for parallel execution - both ROM and RAM
         test_args = []
+        sim_args = (self.sim, self.trace)
         for i, test in enumerate(tests):
-            test_args.append((test, False, temp_base_dir, i * 2))  # ROM
-            test_args.append((test, True, temp_base_dir, i * 2 + 1))  # RAM
+            test_args.append((test, False, temp_base_dir, i * 2, *sim_args))  # ROM
+            test_args.append((test, True, temp_base_dir, i * 2 + 1, *sim_args))  # RAM
 
         rom_results: dict[str, tuple[bool, str]] = {}
         ram_results: dict[str, tuple[bool, str]] = {}
@@ -818,6 +896,9 @@ class ParallelCPUTestRunner:
             except Exception:
                 pass
 
+        verilator_sim.report_wall_time(
+            "CPU test", self.sim, self.max_workers, total, start
+        )
         return rom_results, ram_results
 
 
@@ -839,6 +920,25 @@ def main() -> None:
         default=None,
         help="Number of parallel workers (default: CPU count)",
     )
+    parser.add_argument(
+        "--sim",
+        choices=verilator_sim.SIMULATORS,
+        default="icarus",
+        help="Simulator: icarus (reference, default) or verilator",
+    )
+    parser.add_argument(
+        "--trace",
+        choices=verilator_sim.TRACE_FORMATS,
+        default=None,
+        help="Dump a waveform of every test to "
+        "Hardware/FPGA/Verilog/Simulation/Output/waves",
+    )
+    parser.add_argument(
+        "--shard",
+        default=None,
+        metavar="K/N",
+        help="Run only the K-th of N interleaved slices of the tests",
+    )
     parser.add_argument(
         "test_file",
         nargs="?",
@@ -847,6 +947,16 @@ def main() -> None:
     )
 
     args = parser.parse_args()
+    try:
+        shard = verilator_sim.parse_shard(args.shard)
+    except ValueError as e:
+        parser.error(str(e))
+    if args.sim == "verilator":
+        try:
+            verilator_sim.build(args.trace)
+        except RuntimeError as e:
+            logger.error(str(e))
+            sys.exit(1)
 
     # If neither --rom nor --ram is specified, use combined mode
     use_combined = args.combined or (not args.rom and not args.ram)
@@ -854,7 +964,7 @@ def main() -> None:
 
     if args.test_file:
         # Run a single test
-        runner = CPUTestRunner()
+        runner = CPUTestRunner(sim=args.sim, trace=args.trace)
         if use_combined:
             # Run both ROM and RAM for single test
             print(f"Running single CPU test: {args.test_file}")
@@ -887,14 +997,18 @@ def main() -> None:
                 sys.exit(1)
     elif use_combined:
         # Run all tests in parallel with combined ROM+RAM output (default)
-        runner = ParallelCPUTestRunner(max_workers=args.workers)
+        runner = ParallelCPUTestRunner(
+            max_workers=args.workers, sim=args.sim, trace=args.trace, shard=shard
+        )
         rom_results, ram_results = runner.run_tests_combined()
         failed_count = _display_results_combined(rom_results, ram_results)
         if failed_count > 0:
             sys.exit(1)
     else:
         # Run all tests in parallel (single memory type)
-        runner = ParallelCPUTestRunner(max_workers=args.workers)
+        runner = ParallelCPUTestRunner(
+            max_workers=args.workers, sim=args.sim, trace=args.trace, shard=shard
+        )
         memory_type = "RAM" if use_ram else "ROM"
         passed, failed = runner.run_tests_parallel(use_ram=use_ram)
         total = len(passed) + len(failed)
@@ -0,0 +1,90 @@
+"""
+Host tests for the userlib dist runtime (distributed compilation).
+
+Builds Tests/host/dist_sim.c with gcc against the real
+Software/C/userlib/src/dist.c and fnp.c (the test provides a socket based
+syscall shim), then runs each scenario: the coordinator and every
+simulated worker FPGC are separate processes. The tasks are userBDOS
+programs preprocessed by gcc's cpp; workers compile them with the host
+cproc and QBE, and the coordinator checks every result against a local
+compile.
+"""
+
+import subprocess
+from pathlib import Path
+
+import pytest
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+TEST_SRC = REPO_ROOT / "Tests/host/dist_sim.c"
+DIST_SRC = REPO_ROOT / "Software/C/userlib/src/dist.c"
+FNP_SRC = REPO_ROOT / "Software/C/userlib/src/fnp.c"
+LIBC_INCLUDE = REPO_ROOT / "Software/C/libc/include"
+INCLUDE = REPO_ROOT / "Software/C/userlib/include"
+CPROC = REPO_ROOT / "BuildTools/cproc/output/cproc-qbe"
+QBE = REPO_ROOT / "BuildTools/QBE/output/qbe"
+
+# Small to large: sh.c takes some 60 chunks each way
+PROGRAMS = ["cat", "wc", "grep", "snake", "ls", "tree", "2048", "sh"]
+
+SCENARIOS = ["basic", "straggler", "crash", "lossy", "late", "local", "error"]
+
+
+@pytest.fixture(scope="session")
+def sim_binary(tmp_path_factory):
+    out = tmp_path_factory.mktemp("dist") / "dist_sim"
+    subprocess.run(
+        [
+            "gcc",
+            "-O0",
+            "-Wall",
+            "-Werror",
+            f"-I{INCLUDE}",
+            str(TEST_SRC),
+            str(DIST_SRC),
+            str(FNP_SRC),
+            "-o",
+            str(out),
+        ],
+        check=True,
+    )
+    return out
+
+
+@pytest.fixture(scope="session")
+def sources(tmp_path_factory):
+    out_dir = tmp_path_factory.mktemp("dist_src")
+    files = []
+    for name in PROGRAMS:
+        out = out_dir / f"{name}.i"
+        subprocess.run(
+            [
+                "cpp",
+                "-P",
+                "-nostdinc",
+                f"-I{LIBC_INCLUDE}",
+                f"-I{INCLUDE}",
+                str(REPO_ROOT / f"Software/C/userBDOS/{name}.c"),
+                "-o",
+                str(out),
+            ],
+            check=True,
+        )
+        files.append(str(out))
+    return files
+
+
+@pytest.mark.skipif(
+    not (CPROC.exists() and QBE.exists()), reason="cproc/QBE not built"
+)
+@pytest.mark.parametrize("scenario", SCENARIOS)
+def test_dist_scenario(sim_binary, sources, scenario):
+    result = subprocess.run(
+        [str(sim_binary), scenario, str(CPROC), str(QBE), *sources],
+        capture_output=True,
+        text=True,
+        timeout=180,
+    )
+    assert result.returncode == 0, (
+        f"dist scenario '{scenario}' failed:\nstdout:\n{result.stdout}\nstderr:\n{result.stderr}"
+    )
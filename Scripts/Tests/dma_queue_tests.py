@@ -0,0 +1,45 @@
+"""
+Host tests for the libfpgc DMA request queue.
+
+Builds Tests/host/test_dma_queue.c with gcc against the real
+Software/C/libfpgc/io/dma_queue.c source (the test provides a fake
+DMAengine in place of dma.c), runs it, and reports failure on nonzero
+exit.
+"""
+
+import subprocess
+from pathlib import Path
+
+import pytest
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+TEST_SRC = REPO_ROOT / "Tests/host/test_dma_queue.c"
+QUEUE_SRC = REPO_ROOT / "Software/C/libfpgc/io/dma_queue.c"
+INCLUDE = REPO_ROOT / "Software/C/libfpgc/include"
+
+
+@pytest.fixture(scope="session")
+def test_binary(tmp_path_factory):
+    out = tmp_path_factory.mktemp("dma_queue") / "test_dma_queue"
+    subprocess.run(
+        [
+            "gcc",
+            "-O0",
+            "-Wall",
+            "-Werror",
+            f"-I{INCLUDE}",
+            str(TEST_SRC),
+            str(QUEUE_SRC),
+            "-o",
+            str(out),
+        ],
+        check=True,
+    )
+    return out
+
+
+def test_dma_queue_host(test_binary):
+    result = subprocess.run([str(test_binary)], capture_output=True, text=True)
+    assert result.returncode == 0, (
+        f"dma queue host tests failed:\nstdout:\n{result.stdout}\nstderr:\n{result.stderr}"
+    )
@@ -0,0 +1,351 @@
+"""
+Tests for b32p3emu, the functional B32P3 emulator (BuildTools/emu).
+
+1. Every Tests/CPU program runs from ROM and from RAM (behind the
+   sim_jump_to_ram bootloader, as in cpu_tests.py) and must leave its
+   expected value in r15.
+2. userBDOS programs from Files/BRFS-init/bin run on the host BDOS syscall
+   layer with Files/BRFS-init as the root directory.
+3. With Icarus Verilog installed, each CPU test must also write the same
+   registers in the same order on the emulator as on cpu_tests_tb.v.
+4. The timing model (-timing) charges the stalls read off the RTL for
+   small programs that each trigger one kind, and -profile attributes
+   them to the functions of an asmpy --symbols file. With Icarus Verilog
+   installed, its stall counters must stay within TB_STALL_TOLERANCE of
+   cpu_tests_tb.v's for every CPU test.
+
+The C test suite runs on the emulator with `make test-c SIM=emu`.
+"""
+
+import re
+import shutil
+import subprocess
+import sys
+from pathlib import Path
+
+import pytest
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+EMU_DIR = REPO_ROOT / "BuildTools/emu"
+EMU = EMU_DIR / "output/b32p3emu"
+CPU_TESTS_DIR = REPO_ROOT / "Tests/CPU"
+BOOTLOADER = REPO_ROOT / "Software/ASM/Simulation/sim_jump_to_ram.asm"
+BRFS_ROOT = REPO_ROOT / "Files/BRFS-init"
+ROM_OFFSET = "0x1E000000"
+SIM_CYCLES = 30000
+
+CPU_TESTS = sorted(
+    p.relative_to(CPU_TESTS_DIR).as_posix()
+    for p in CPU_TESTS_DIR.rglob("*.asm")
+    if "tmp" not in p.parts
+)
+
+# The testbench wires SPI flash and the W5500/CH376 models to the SPI
+# buses; the emulator has no devices behind them
+NO_SPI_DEVICES = "SPI devices are only modelled in the testbench"
+SKIP = {
+    "14_dma/qspi_read_aligned.asm": NO_SPI_DEVICES,
+    "14_dma/qspi_read_multi.asm": NO_SPI_DEVICES,
+    "14_dma/spi2mem_aligned.asm": NO_SPI_DEVICES,
+    "14_dma/spi5_burst.asm": NO_SPI_DEVICES,
+    "14_dma/spi_mmio_readback.asm": NO_SPI_DEVICES,
+}
+SKIP_RAM = {
+    # Stores over its own code: the hardware keeps running the stale
+    # instructions from L1I, the emulator has no caches
+    "10_sdram_cache/read_write_hazards.asm": "depends on stale L1I contents",
+}
+
+REG_WRITE = re.compile(r"reg r(\d+):\s*(-?\d+)")
+
+
+@pytest.fixture(scope="session")
+def emu():
+    subprocess.run(["make", "-s", "-C", str(EMU_DIR)], check=True)
+    return EMU
+
+
+def _asmpy(source, output, offset=None, symbols=None):
+    cmd = ["asmpy", str(source), str(output)]
+    if offset:
+        cmd += ["-o", offset]
+    if symbols:
+        cmd += ["--symbols", str(symbols)]
+    result = subprocess.run(cmd, capture_output=True, text=True)
+    assert result.returncode == 0, f"asmpy failed on {source}:\n{result.stderr}"
+
+
+def _expected(test):
+    for line in (CPU_TESTS_DIR / test).read_text().splitlines():
+        if "expected=" in line:
+            return int(line.split("expected=")[1].strip())
+    raise AssertionError(f"{test}: no expected= value")
+
+
+def _build(test, tmp_path, use_ram):
+    """Assemble a CPU test. Returns the emulator arguments that load it."""
+    rom = tmp_path / "rom.list"
+    if not use_ram:
+        _asmpy(CPU_TESTS_DIR / test, rom, ROM_OFFSET)
+        return ["-rom", str(rom)]
+    ram = tmp_path / "ram.list"
+    _asmpy(BOOTLOADER, rom)
+    _asmpy(CPU_TESTS_DIR / test, ram)
+    return ["-rom", str(rom), str(ram)]
+
+
+def _register_writes(output):
+    return [(int(r), int(v) & 0xFFFFFFFF) for r, v in REG_WRITE.findall(output)]
+
+
+def _run_emu(emu, args):
+    result = subprocess.run(
+        [str(emu), "-tb", "-trace", "-limit", str(SIM_CYCLES), *args],
+        capture_output=True,
+        text=True,
+        timeout=60,
+    )
+    # Exit status 2: the cycle limit ended the run, as in the testbench
+    assert result.returncode in (0, 2), f"b32p3emu failed:\n{result.stderr}"
+    return result.stdout
+
+
+@pytest.mark.parametrize("use_ram", [False, True], ids=["rom", "ram"])
+@pytest.mark.parametrize("test", CPU_TESTS)
+def test_cpu(emu, tmp_path, test, use_ram):
+    reason = SKIP.get(test) or (use_ram and SKIP_RAM.get(test))
+    if reason:
+        pytest.skip(reason)
+    writes = _register_writes(_run_emu(emu, _build(test, tmp_path, use_ram)))
+    r15 = [v for r, v in writes if r == 15]
+    assert r15, "r15 was never written"
+    assert r15[-1] == _expected(test) & 0xFFFFFFFF
+
+
+def _run_bdos(emu, program, *args, stdin=""):
+    program_path = BRFS_ROOT / "bin" / program
+    result = subprocess.run(
+        [str(emu), "-bdos", "-root", str(BRFS_ROOT), str(program_path), *args],
+        input=stdin,
+        capture_output=True,
+        text=True,
+        timeout=60,
+    )
+    assert result.returncode == 0, f"{program} failed:\n{result.stderr}"
+    return result.stdout
+
+
+def test_bdos_cat_stdin(emu):
+    assert _run_bdos(emu, "cat", stdin="hello\nworld\n") == "hello\nworld\n"
+
+
+def test_bdos_wc_file(emu, tmp_path):
+    text = "one two\nthree\n\nfour five six\n"
+    (tmp_path / "words.txt").write_text(text)
+    # -root / makes every host path a BRFS path
+    result = subprocess.run(
+        [
+            str(emu),
+            "-bdos",
+            "-root",
+            "/",
+            str(BRFS_ROOT / "bin/wc"),
+            str(tmp_path / "words.txt"),
+        ],
+        capture_output=True,
+        text=True,
+        timeout=60,
+    )
+    assert result.returncode == 0, result.stderr
+    assert result.stdout.split()[:3] == ["4", "6", str(len(text))]
+
+
+def test_bdos_ls_root(emu):
+    names = _run_bdos(emu, "ls", "/").split()
+    # BRFS-init directories plus the synthetic /dev and /proc
+    assert {"bin/", "dev/", "proc/"} <= set(names)
+
+
+@pytest.mark.skipif(
+    not (shutil.which("iverilog") and shutil.which("vvp")),
+    reason="Icarus Verilog not installed",
+)
+@pytest.mark.parametrize("test", CPU_TESTS)
+def test_cpu_differential(emu, tmp_path, test):
+    if test in SKIP:
+        pytest.skip(SKIP[test])
+    sys.path.insert(0, str(Path(__file__).parent))
+    from cpu_tests import CPUTestRunner
+
+    runner = CPUTestRunner(temp_dir=str(tmp_path))
+    runner._prepare_temp_testbench()
+    runner._assemble_code_to_rom(str(CPU_TESTS_DIR / test))
+    sim_writes = _register_writes(runner._run_simulation())
+    emu_writes = _register_writes(_run_emu(emu, ["-rom", runner.config.ROM_LIST_PATH]))
+    # The testbench stops after SIM_CYCLES clock cycles, stalls included,
+    # so it may see fewer writes than the emulator
+    assert sim_writes, "testbench wrote no registers"
+    assert emu_writes[: len(sim_writes)] == sim_writes
+
+
+# ---- Timing model ----
+
+STALL_LINE = re.compile(r"Stalls: load-use (\d+), cache-line (\d+), backend (\d+)")
+STAT_LINE = re.compile(r"^\s+([a-z0-9-]+)\s+(\d+)\s+[\d.]+%$", re.MULTILINE)
+CPI_BENCHMARK = REPO_ROOT / "Software/ASM/benchmark/cpi_benchmark.asm"
+# The model counts overlapping stalls separately and leaves out DMA, so
+# allow this much difference to the testbench: a fraction plus cycles
+TB_STALL_TOLERANCE = (0.10, 10)
+
+
+def _run_timing(emu, tmp_path, source, *extra):
+    """Run asm source from ROM with -timing. Returns (stdout, stall cycles)."""
+    asm = tmp_path / "prog.asm"
+    asm.write_text(source)
+    rom = tmp_path / "prog.list"
+    _asmpy(asm, rom, ROM_OFFSET)
+    result = subprocess.run(
+        [str(emu), "-tb", "-trace", "-timing", "-stats", *extra, "-rom", str(rom)],
+        capture_output=True,
+        text=True,
+        timeout=60,
+    )
+    assert result.returncode == 0, f"b32p3emu failed:\n{result.stderr}"
+    return result.stdout, {k: int(v) for k, v in STAT_LINE.findall(result.stderr)}
+
+
+def _stall_delta(emu, tmp_path, kind, with_stall, without):
+    """Stall cycles of one kind that with_stall adds over without."""
+    _, a = _run_timing(emu, tmp_path, f"Main:\n{with_stall}\nhalt\n")
+    _, b = _run_timing(emu, tmp_path, f"Main:\n{without}\nhalt\n")
+    return a[kind] - b[kind]
+
+
+def test_timing_load_use(emu, tmp_path):
+    prologue = "load32 0x1000 r1\nwrite 0 r1 r1\nnop\nnop\n"
+    delta = _stall_delta(
+        emu,
+        tmp_path,
+        "load-use",
+        prologue + "read 0 r1 r2\nadd r2 r2 r3",
+        prologue + "read 0 r1 r2\nadd r4 r4 r3",
+    )
+    assert delta == 1
+
+
+def test_timing_pop_use(emu, tmp_path):
+    delta = _stall_delta(
+        emu,
+        tmp_path,
+        "pop-use",
+        "load 5 r1\npush r1\npop r2\nadd r2 r2 r3",
+        "load 5 r1\npush r1\npop r2\nadd r4 r4 r3",
+    )
+    assert delta == 1
+
+
+@pytest.mark.parametrize(
+    "op, stall",
+    [
+        ("mults r1 r2 r3", 6),
+        ("divs r1 r2 r3", 39),
+        ("divs r1 r0 r3", 5),
+        ("divfp r1 r2 r3", 54),
+        ("fmul r1 r2 r3", 8),
+        ("fadd r1 r2 r3", 1),
+    ],
+)
+def test_timing_multicycle_alu(emu, tmp_path, op, stall):
+    _, stalls = _run_timing(emu, tmp_path, f"Main:\nload 7 r1\nload 2 r2\n{op}\nhalt\n")
+    assert stalls["malu"] == stall
+
+
+def test_timing_taken_jump(emu, tmp_path):
+    # ROM targets need no second L1I read: 4 cycles per taken jump
+    _, stalls = _run_timing(
+        emu, tmp_path, "Main:\njump A\nA:\njump B\nnop\nB:\nhalt\n"
+    )
+    assert stalls["jump"] == 8
+
+
+def test_timing_l1d_hits_and_misses(emu, tmp_path):
+    _, stalls = _run_timing(
+        emu,
+        tmp_path,
+        "Main:\nload32 0x1000 r1\nread 0 r1 r2\nnop\nnop\nread 4 r1 r3\n"
+        "nop\nnop\nwrite 8 r1 r3\nnop\nnop\nread 0x400 r1 r4\nhalt\n",
+    )
+    assert stalls["l1d"] > 0
+    # 0x1000 misses, 0x1004 and 0x1008 are in its line, 0x1400 is not
+    out = subprocess.run(
+        [str(emu), "-timing", "-stats", "-rom", str(tmp_path / "prog.list")],
+        capture_output=True,
+        text=True,
+        timeout=60,
+    ).stderr
+    assert "L1D: reads 1 hits, 2 misses; writes 1 hits, 0 misses" in out
+
+
+def test_timing_tb_stall_line(emu, tmp_path):
+    stdout, stalls = _run_timing(emu, tmp_path, CPI_BENCHMARK.read_text())
+    writes = _register_writes(stdout)
+    assert [v for r, v in writes if r == 15][-1] == 135
+    use, line, backend = map(int, STALL_LINE.search(stdout).groups())
+    assert use == stalls["load-use"] + stalls["pop-use"] == 2
+    assert line == stalls["cache-line"]
+    assert backend == stalls["l1d"] + stalls["malu"] + stalls["io"] + stalls["ccache"]
+
+
+def test_timing_profile(emu, tmp_path):
+    asm = tmp_path / "prog.asm"
+    asm.write_text(
+        "Main:\nload 20 r1\nLoop:\njump Work\nBack:\nsub r1 1 r1\n"
+        "bne r1 r0 Loop\nhalt\n"
+        "Work:\nload 7 r2\ndivs r2 r2 r3\njump Back\n"
+    )
+    rom = tmp_path / "prog.list"
+    sym = tmp_path / "prog.sym"
+    _asmpy(asm, rom, ROM_OFFSET, symbols=sym)
+    result = subprocess.run(
+        [str(emu), "-profile", "-sym", str(sym), "-rom", str(rom)],
+        capture_output=True,
+        text=True,
+        timeout=60,
+    )
+    assert result.returncode == 0, result.stderr
+    rows = {line.split()[0]: line.split() for line in result.stderr.splitlines()}
+    # Columns: cycles, %, instrs, CPI, misses, then one per stall kind
+    assert int(rows["Work"][3]) == 60
+    assert int(rows["Work"][1]) > int(rows["Loop"][1])
+    assert int(rows["total"][3]) == sum(
+        int(rows[name][3]) for name in ("Main", "Loop", "Back", "Work")
+    )
+
+
+@pytest.mark.skipif(
+    not (shutil.which("iverilog") and shutil.which("vvp")),
+    reason="Icarus Verilog not installed",
+)
+@pytest.mark.parametrize("test", CPU_TESTS)
+def test_timing_differential(emu, tmp_path, test):
+    if test in SKIP:
+        pytest.skip(SKIP[test])
+    sys.path.insert(0, str(Path(__file__).parent))
+    from cpu_tests import CPUTestRunner
+
+    runner = CPUTestRunner(temp_dir=str(tmp_path))
+    runner._prepare_temp_testbench()
+    runner._assemble_code_to_rom(str(CPU_TESTS_DIR / test))
+    sim = STALL_LINE.search(runner._run_simulation())
+    emu_out = _run_emu(emu, ["-timing", "-rom", runner.config.ROM_LIST_PATH])
+    model = STALL_LINE.search(emu_out)
+    assert sim and model
+    fraction, cycles = TB_STALL_TOLERANCE
+    for kind, want, got in zip(
+        ("load-use", "cache-line", "backend"),
+        map(int, sim.groups()),
+        map(int, model.groups()),
+    ):
+        assert abs(got - want) <= want * fraction + cycles, (
+            f"{kind}: testbench {want}, model {got}"
+        )
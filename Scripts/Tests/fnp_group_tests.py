@@ -0,0 +1,231 @@
+"""
+Multi-receiver host simulation of FNP group (broadcast) uploads.
+
+Each simulated board is a Tests/host/fnp_group_sim.c process running the
+kernel's fnp_group.c receiver; the sender is the real fnp_tool.py
+FNPConnection, given a socket that carries its frames over AF_UNIX
+datagrams (broadcast goes to every board). Boards drop frames at random
+or miss the start of a transfer, and the tests check that every member
+ends up with an exact copy while repair traffic stays well below one
+upload per board.
+"""
+
+import random
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+import pytest
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+SIM_SRC = REPO_ROOT / "Tests/host/fnp_group_sim.c"
+GROUP_SRC = REPO_ROOT / "Software/C/kernel/src/fnp_group.c"
+KERNEL_INCLUDE = REPO_ROOT / "Software/C/kernel/include"
+
+sys.path.insert(0, str(REPO_ROOT / "Scripts/Programmer/Network"))
+import fnp_tool  # noqa: E402
+
+HOST_MAC = bytes([0x02, 0x00, 0x00, 0x00, 0x00, 0xFE])
+
+
+@pytest.fixture(scope="session")
+def sim_binary(tmp_path_factory):
+    out = tmp_path_factory.mktemp("fnp_group") / "fnp_group_sim"
+    subprocess.run(
+        [
+            "gcc",
+            "-O0",
+            "-Wall",
+            "-Werror",
+            f"-I{KERNEL_INCLUDE}",
+            str(SIM_SRC),
+            str(GROUP_SRC),
+            "-o",
+            str(out),
+        ],
+        check=True,
+    )
+    return out
+
+
+class HubSocket:
+    """Socket stand-in for FNPConnection: frames go to board sockets."""
+
+    def __init__(self, sock_dir: Path, boards: list[int]):
+        self.dir = sock_dir
+        self.boards = boards
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM)
+        self.sock.bind(str(sock_dir / "host"))
+
+    def _sendto(self, frame: bytes, board_id: int):
+        try:
+            self.sock.sendto(frame, str(self.dir / f"n{board_id}"))
+        except (FileNotFoundError, ConnectionRefusedError):
+            pass  # board not running
+
+    def send(self, frame: bytes):
+        dst = frame[0:6]
+        if dst == fnp_tool.BROADCAST_MAC:
+            for board_id in self.boards:
+                self._sendto(frame, board_id)
+        else:
+            self._sendto(frame, dst[5])
+
+    def settimeout(self, timeout):
+        self.sock.settimeout(timeout)
+
+    def recvfrom(self, size):
+        return self.sock.recvfrom(size)
+
+    def close(self):
+        self.sock.close()
+
+
+class Rack:
+    """A set of simulated boards plus a sender connected to them."""
+
+    def __init__(self, sim_binary, sock_dir: Path, boards: dict[int, tuple]):
+        self.dir = sock_dir
+        self.procs = []
+        for board_id, (drop_pct, drop_first) in boards.items():
+            proc = subprocess.Popen(
+                [
+                    str(sim_binary),
+                    str(sock_dir),
+                    str(board_id),
+                    str(drop_pct),
+                    str(1000 + board_id),
+                    str(drop_first),
+                ],
+                stdout=subprocess.PIPE,
+                text=True,
+            )
+            assert proc.stdout.readline().strip() == "ready"
+            self.procs.append(proc)
+        self.hub = HubSocket(sock_dir, list(boards))
+        self.conn = fnp_tool.FNPConnection("sim", sock=self.hub, src_mac=HOST_MAC)
+        self.conn.group_burst_gap = 0
+
+    def board_file(self, board_id: int, fpgc_path: str) -> Path:
+        return self.dir / f"fs{board_id}" / fpgc_path.lstrip("/")
+
+    def close(self):
+        self.conn.close()
+        for proc in self.procs:
+            proc.terminate()
+            proc.wait()
+
+
+@pytest.fixture
+def rack(sim_binary):
+    # AF_UNIX paths are limited to ~108 bytes; keep the socket dir short.
+    sock_dir = Path(tempfile.mkdtemp(prefix="fnpg", dir="/tmp"))
+    racks = []
+
+    def make(boards):
+        r = Rack(sim_binary, sock_dir, boards)
+        racks.append(r)
+        return r
+
+    yield make
+    for r in racks:
+        r.close()
+    shutil.rmtree(sock_dir, ignore_errors=True)
+
+
+def _payload(tmp_path: Path, name: str, size: int, seed: int) -> Path:
+    rnd = random.Random(seed)
+    path = tmp_path / name
+    path.write_bytes(bytes(rnd.randrange(256) for _ in range(size)))
+    return path
+
+
+def _padded(path: Path) -> bytes:
+    data = path.read_bytes()
+    return data + b"\x00" * ((4 - len(data) % 4) % 4)
+
+
+def _chunks(path: Path) -> int:
+    return -(-len(_padded(path)) // fnp_tool.GROUP_CHUNK_SIZE)
+
+
+def test_lossless_single_pass(rack, tmp_path):
+    r = rack({b: (0, 0) for b in range(1, 6)})
+    src = _payload(tmp_path, "prog.bin", 50_001, 1)
+    assert r.conn.group_upload_file(str(src), "/prog", [1, 2, 3, 4, 5])
+    for b in range(1, 6):
+        assert r.board_file(b, "/prog").read_bytes() == _padded(src)
+    # Every chunk went on the wire exactly once for all five boards.
+    assert r.conn.group_stats["data_frames"] == _chunks(src)
+    assert r.conn.group_stats["rounds"] == 1
+
+
+def test_lossy_boards_repaired_with_nacks(rack, tmp_path):
+    r = rack({b: (10, 0) for b in range(1, 6)})
+    src = _payload(tmp_path, "big.bin", 120_000, 2)
+    assert r.conn.group_upload_file(str(src), "/big", [1, 2, 3, 4, 5])
+    for b in range(1, 6):
+        assert r.board_file(b, "/big").read_bytes() == _padded(src)
+    # Repairs only resend what some board is missing: far less than a
+    # separate upload per board.
+    assert r.conn.group_stats["data_frames"] < 2 * _chunks(src)
+    assert r.conn.group_stats["rounds"] > 1
+
+
+def test_one_bad_link(rack, tmp_path):
+    r = rack({1: (0, 0), 2: (0, 0), 3: (40, 0), 4: (0, 0)})
+    src = _payload(tmp_path, "x.bin", 30_000, 3)
+    assert r.conn.group_upload_file(str(src), "/x", [1, 2, 3, 4])
+    for b in (1, 2, 3, 4):
+        assert r.board_file(b, "/x").read_bytes() == _padded(src)
+
+
+def test_missed_start(rack, tmp_path):
+    # Board 2 misses GROUP_START and the first chunks: it reports the
+    # transfer as unknown on the first poll and gets a repeated START.
+    r = rack({1: (0, 0), 2: (0, 5), 3: (0, 0)})
+    src = _payload(tmp_path, "late.bin", 20_000, 4)
+    assert r.conn.group_upload_file(str(src), "/late", [1, 2, 3])
+    for b in (1, 2, 3):
+        assert r.board_file(b, "/late").read_bytes() == _padded(src)
+
+
+def test_member_mask(rack, tmp_path):
+    r = rack({b: (0, 0) for b in range(1, 6)})
+    src = _payload(tmp_path, "sub.bin", 5_000, 5)
+    assert r.conn.group_upload_file(str(src), "/sub", [1, 3, 5])
+    for b in (1, 3, 5):
+        assert r.board_file(b, "/sub").read_bytes() == _padded(src)
+    for b in (2, 4):
+        assert not r.board_file(b, "/sub").exists()
+
+
+def test_missing_board_reported(rack, tmp_path):
+    r = rack({1: (0, 0), 2: (0, 0)})
+    src = _payload(tmp_path, "m.bin", 4_000, 6)
+    # Board 3 is not running: the upload fails but the others complete.
+    assert not r.conn.group_upload_file(str(src), "/m", [1, 2, 3])
+    for b in (1, 2):
+        assert r.board_file(b, "/m").read_bytes() == _padded(src)
+
+
+def test_group_sync_files(rack, tmp_path):
+    tree = tmp_path / "tree"
+    (tree / "bin").mkdir(parents=True)
+    (tree / "data" / "sub").mkdir(parents=True)
+    files = {
+        "bin/a": _payload(tmp_path, "a", 9_000, 7),
+        "bin/b": _payload(tmp_path, "b", 3, 8),
+        "data/sub/c": _payload(tmp_path, "c", 2_048, 9),
+    }
+    for rel, src in files.items():
+        (tree / rel).write_bytes(src.read_bytes())
+
+    r = rack({1: (5, 0), 2: (5, 0), 3: (5, 0)})
+    assert r.conn.group_sync_files(str(tree), [1, 2, 3])
+    for b in (1, 2, 3):
+        for rel, src in files.items():
+            assert r.board_file(b, "/" + rel).read_bytes() == _padded(src)
@@ -0,0 +1,182 @@
+"""
+Constant multiplication/division lowering in the B32P3 QBE backend.
+
+QBE rewrites x / d, x % d and x * c by constants into multiply-high,
+shift and add sequences. For a range of constants this test compiles
+`w $f(w %x) { %r =w <op> %x, <c> }` with the host QBE, runs the
+straight-line result in a small B32P3 interpreter (argument in r4,
+result in r1) and compares it with C semantics for edge-case and random
+32-bit inputs.
+"""
+
+import random
+import subprocess
+from pathlib import Path
+
+import pytest
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+QBE = REPO_ROOT / "BuildTools/QBE/output/qbe"
+
+MASK = 0xFFFFFFFF
+
+DIVISORS = sorted(
+    set(range(2, 130))
+    | {d for k in range(2, 31) for d in ((1 << k) - 1, 1 << k, (1 << k) + 1)}
+    | {
+        1000, 1023, 3600, 10000, 65535, 65537, 86400, 1000000, 641,
+        6700417, 0x7FFFFFFF, 0x55555555, 0x33333333,
+    }
+)
+SIGNED = DIVISORS + [-d for d in DIVISORS] + [-1, 1, -(1 << 31)]
+UNSIGNED = DIVISORS + [1, 0x80000000, 0x80000001, 0xFFFFFFFE, 0xFFFFFFFF]
+
+EDGES = [
+    0, 1, 2, 3, 6, 7, 9, 10, 99, 100, 101, 0x7FFE, 0x7FFF, 0x8000,
+    0xFFFF, 0x10000, 0x7FFFFFFE, 0x7FFFFFFF, 0x80000000, 0x80000001,
+    0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFF9, 0xFFFFFF9C,
+]
+
+
+def s32(v):
+    v &= MASK
+    return v - (1 << 32) if v & 0x80000000 else v
+
+
+def c_div(a, b):
+    """C99 signed division: truncates toward zero."""
+    a, b = s32(a), s32(b)
+    q = abs(a) // abs(b)
+    return -q if (a < 0) != (b < 0) else q
+
+
+def reference(op, x, c):
+    if op == "mul":
+        return (x * c) & MASK
+    if op == "div":
+        return c_div(x, c) & MASK
+    if op == "rem":
+        return (s32(x) - c_div(x, c) * s32(c)) & MASK
+    if op == "udiv":
+        return (x & MASK) // (c & MASK)
+    if op == "urem":
+        return (x & MASK) % (c & MASK)
+    raise ValueError(op)
+
+
+def _compile(functions):
+    ssa = "".join(
+        f"export function w ${name}(w %x) {{\n@start\n"
+        f"\t%r =w {op} %x, {s32(c)}\n\tret %r\n}}\n"
+        for name, op, c in functions
+    )
+    out = subprocess.run(
+        [str(QBE)], input=ssa.encode(), capture_output=True, check=True
+    )
+    return out.stdout.decode()
+
+
+def _split(asm):
+    """Return {function name: [instruction tokens]}."""
+    funcs = {}
+    cur = None
+    for line in asm.splitlines():
+        line = line.split(";")[0].strip()
+        if not line or line.startswith((".", "/*")):
+            continue
+        if line.endswith(":"):
+            cur = funcs.setdefault(line[:-1], [])
+            continue
+        cur.append(line.split())
+    return funcs
+
+
+def _reg(regs, tok):
+    if tok.startswith("r") and tok[1:].isdigit():
+        return regs[int(tok[1:])]
+    return int(tok, 0) & MASK
+
+
+def run(code, x):
+    """Interpret straight-line B32P3 code with r4 = x, return r1."""
+    regs = [0] * 16
+    regs[4] = x & MASK
+    alu = {
+        "add": lambda a, b: a + b,
+        "sub": lambda a, b: a - b,
+        "and": lambda a, b: a & b,
+        "or": lambda a, b: a | b,
+        "xor": lambda a, b: a ^ b,
+        "shiftl": lambda a, b: a << (b & 31),
+        "shiftr": lambda a, b: a >> (b & 31),
+        "shiftrs": lambda a, b: s32(a) >> (b & 31),
+        "slt": lambda a, b: int(s32(a) < s32(b)),
+        "sltu": lambda a, b: int(a < b),
+        "mults": lambda a, b: s32(a) * s32(b),
+        "mulshi": lambda a, b: (s32(a) * s32(b)) >> 32,
+        "multuhi": lambda a, b: (a * b) >> 32,
+    }
+    for ins in code:
+        op = ins[0]
+        if op == "jumpr":
+            return regs[1]
+        if op in ("load", "load32"):
+            val, dst = int(ins[1], 0), ins[2]
+        elif op in alu:
+            val = alu[op](_reg(regs, ins[1]), _reg(regs, ins[2]))
+            dst = ins[3]
+        else:
+            pytest.fail(f"unexpected instruction {' '.join(ins)}")
+        if dst != "r0":
+            regs[int(dst[1:])] = val & MASK
+    pytest.fail("function did not return")
+
+
+def _inputs(c, rnd):
+    xs = set(EDGES)
+    for m in (c, -c):
+        for k in (-1, 0, 1):
+            xs.add((m * 3 + k) & MASK)
+            xs.add((m + k) & MASK)
+    xs.update(rnd.getrandbits(32) for _ in range(300))
+    return sorted(xs)
+
+
+def _check(op, consts):
+    functions = [(f"f{n}", op, c) for n, c in enumerate(consts)]
+    code = _split(_compile(functions))
+    rnd = random.Random(op)
+    for name, _, c in functions:
+        for x in _inputs(c, rnd):
+            got = run(code[name], x)
+            want = reference(op, x, c & MASK if op in ("udiv", "urem") else c)
+            assert got == want, (
+                f"{op} x={x:#x} c={s32(c)}: got {got:#x}, want {want:#x}"
+            )
+    return code
+
+
+pytestmark = pytest.mark.skipif(not QBE.is_file(), reason="QBE not built")
+
+
+@pytest.mark.parametrize("op", ["div", "rem"])
+def test_signed(op):
+    _check(op, SIGNED)
+
+
+@pytest.mark.parametrize("op", ["udiv", "urem"])
+def test_unsigned(op):
+    _check(op, UNSIGNED)
+
+
+def test_mul():
+    consts = sorted(set(SIGNED) | {0, 1, -2, -3, 0x7FFFFFFF})
+    _check("mul", consts)
+
+
+def test_no_divide_instructions():
+    code = _check("udiv", [3, 7, 10, 641, 1000])
+    code.update(_check("div", [3, -7, 10, 641, 1000]))
+    for body in code.values():
+        ops = {ins[0] for ins in body}
+        assert not ops & {"divs", "divu", "mods", "modu"}, body
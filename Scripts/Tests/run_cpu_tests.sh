@@ -10,6 +10,7 @@ source .venv/bin/activate
 WORKERS=""
 TEST_FILE=""
 MODE=""
+SIM_FLAGS=""
 
 while [[ $# -gt 0 ]]; do
     case $1 in
@@ -25,6 +26,10 @@ while [[ $# -gt 0 ]]; do
             MODE="--ram"
             shift
             ;;
+        --sim|--trace|--shard)
+            SIM_FLAGS="$SIM_FLAGS $1 $2"
+            shift 2
+            ;;
         *)
             TEST_FILE="$1"
             shift
@@ -36,9 +41,9 @@ done
 # Default is combined mode (both ROM and RAM with merged output)
 # Use --rom or --ram to run only one memory type
 if [ -n "$TEST_FILE" ]; then
-    python3 Scripts/Tests/cpu_tests.py $MODE $WORKERS "$TEST_FILE"
+    python3 Scripts/Tests/cpu_tests.py $MODE $WORKERS $SIM_FLAGS "$TEST_FILE"
 else
-    python3 Scripts/Tests/cpu_tests.py $MODE $WORKERS
+    python3 Scripts/Tests/cpu_tests.py $MODE $WORKERS $SIM_FLAGS
 fi
 
 # Deactivate virtual environment
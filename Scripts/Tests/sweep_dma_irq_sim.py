@@ -7,8 +7,17 @@ Strategy:
   - Re-run vvp with different +IRQ_PERIOD / +IRQ_FIRST values.
   - Flag any run whose output contains "[hang-detect]" or whose
     final r15 is not the expected iteration count.
+
+Programs are picked with IRQ_SWEEP_ASM / IRQ_SWEEP_EXPECTED, or by name
+with --preset (repeatable, or --preset all):
+  stress  spi2mem_irq_stress.asm  (SPI2MEM, polled completion)
+  heavy   spi2mem_irq_heavy.asm   (SPI2MEM, crt0-style ISR)
+  chain   chain_irq_stress.asm    (descriptor chain, IRQ completion; always
+                                   runs from RAM, since the CPU only takes
+                                   interrupts outside ROM)
 """
 
+import argparse
 import os
 import subprocess
 import sys
@@ -23,6 +32,11 @@ ASM = REPO / os.environ.get(
     "IRQ_SWEEP_ASM", "Tests/host/dma_irq_sim/spi2mem_irq_stress.asm"
 )
 EXPECTED = int(os.environ.get("IRQ_SWEEP_EXPECTED", "8"))
+PRESETS = {
+    "stress": ("Tests/host/dma_irq_sim/spi2mem_irq_stress.asm", 8, False),
+    "heavy": ("Tests/host/dma_irq_sim/spi2mem_irq_heavy.asm", 4, False),
+    "chain": ("Tests/host/dma_irq_sim/chain_irq_stress.asm", 8, True),
+}
 OUT = REPO / "tmp/cpu_irq_inject.out"
 USE_RAM = os.environ.get("IRQ_SWEEP_RAM", "0") == "1"
 BOOT = REPO / "Software/ASM/Simulation/sim_jump_to_ram.asm"
@@ -47,9 +61,12 @@ def run_one(args):
     return (p, f, wedge, r15, out)
 
 
-def main():
+def sweep(asm, expected, use_ram):
+    """Build `asm` into the testbench and run the full IRQ timing grid.
+    Returns the number of failing runs."""
+    print(f"=== {asm.relative_to(REPO)} (expected r15={expected}) ===")
     OUT.parent.mkdir(parents=True, exist_ok=True)
-    if USE_RAM:
+    if use_ram:
         # Build sim_jump_to_ram into ROM, test into RAM via SDRAM init
         r = subprocess.run(
             f"asmpy {BOOT} {ROM_LIST} -o 0x1E000000",
@@ -63,7 +80,7 @@ def main():
             sys.exit(1)
         ram_tmp = REPO / "tmp/test_ram.list"
         r = subprocess.run(
-            f"asmpy {ASM} {ram_tmp}",
+            f"asmpy {asm} {ram_tmp}",
             shell=True,
             cwd=str(REPO),
             capture_output=True,
@@ -84,7 +101,7 @@ def main():
             sys.exit(1)
     else:
         r = subprocess.run(
-            f"asmpy {ASM} {ROM_LIST}",
+            f"asmpy {asm} {ROM_LIST}",
             shell=True,
             cwd=str(REPO),
             capture_output=True,
@@ -158,7 +175,7 @@ def main():
             if wedge:
                 tag = "HANG"
                 hangs.append((p, f, out))
-            elif r15 != EXPECTED:
+            elif r15 != expected:
                 tag = f"BADRES r15={r15}"
                 bad_results.append((p, f, r15, out))
             print(
@@ -179,7 +196,36 @@ def main():
         print(f"PERIOD={p} FIRST={f} r15={r15}")
         print(out[-3000:])
 
-    sys.exit(0 if not (hangs or bad_results) else 2)
+    return len(hangs) + len(bad_results)
+
+
+def main():
+    ap = argparse.ArgumentParser(
+        description="Sweep IRQ injection timing over DMA test programs."
+    )
+    ap.add_argument(
+        "--preset",
+        action="append",
+        choices=sorted(PRESETS) + ["all"],
+        help="named program to sweep (default: IRQ_SWEEP_ASM)",
+    )
+    args = ap.parse_args()
+
+    if not args.preset:
+        jobs = [(ASM, EXPECTED, USE_RAM)]
+    else:
+        names = sorted(PRESETS) if "all" in args.preset else args.preset
+        jobs = [
+            (REPO / PRESETS[n][0], PRESETS[n][1], PRESETS[n][2] or USE_RAM)
+            for n in names
+        ]
+
+    failures = 0
+    for asm, expected, use_ram in jobs:
+        failures += sweep(asm, expected, use_ram)
+        print()
+
+    sys.exit(0 if failures == 0 else 2)
 
 
 if __name__ == "__main__":
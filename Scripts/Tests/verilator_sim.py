@@ -0,0 +1,104 @@
+"""
+Verilator build of cpu_tests_tb.v, shared by cpu_tests.py and c_tests.py.
+
+Icarus compiles the testbench again for every test, with the memory list
+paths rewritten to the test's directory. The Verilator model is built once
+by Scripts/Simulation/verilate_cpu_tests.sh and then reused: the testbench
+opens its .list files relative to the working directory, so each test runs
+the same binary from its own directory, with the lists in a
+Hardware/FPGA/Verilog/Simulation/MemoryLists tree below it.
+
+Waveforms: a model built with --trace vcd or fst dumps when run with
++trace, to the file given by +dumpfile=. Icarus does the same with
+`vvp out +trace` (and -fst for FST).
+"""
+
+import os
+import shutil
+import subprocess
+import time
+from typing import Optional
+
+SIMULATORS = ("icarus", "verilator")
+TRACE_FORMATS = ("vcd", "fst")
+
+MEMORY_LISTS_DIR = "Hardware/FPGA/Verilog/Simulation/MemoryLists"
+BUILD_SCRIPT = "Scripts/Simulation/verilate_cpu_tests.sh"
+OUTPUT_DIR = "Hardware/FPGA/Verilog/Simulation/Output/verilator"
+# Waveforms of test runs, one file per test
+WAVES_DIR = "Hardware/FPGA/Verilog/Simulation/Output/waves"
+
+
+def model_path(trace: Optional[str] = None) -> str:
+    """Path of the Verilator binary for a trace format (None: no tracing)."""
+    variant = trace or "notrace"
+    return os.path.abspath(os.path.join(OUTPUT_DIR, variant, "Vcpu_tests_tb"))
+
+
+def build(trace: Optional[str] = None) -> str:
+    """Build the model, or bring it up to date, and return its path.
+
+    Run this once before starting the workers. Raises RuntimeError when
+    Verilator is missing or the build fails.
+    """
+    if not shutil.which("verilator"):
+        raise RuntimeError(
+            "verilator not found (install Verilator 5, or use --sim icarus)"
+        )
+    cmd = ["bash", BUILD_SCRIPT]
+    if trace:
+        cmd += ["--trace", trace]
+    start = time.monotonic()
+    result = subprocess.run(cmd, capture_output=True, text=True)
+    if result.returncode != 0:
+        raise RuntimeError(f"Verilator build failed:\n{result.stdout}{result.stderr}")
+    print(f"Verilator model up to date ({time.monotonic() - start:.1f} s)")
+    return model_path(trace)
+
+
+def memory_lists_dir(run_dir: str) -> str:
+    """Where the model opens its .list files when run from run_dir."""
+    return os.path.join(run_dir, MEMORY_LISTS_DIR)
+
+
+def waves_path(name: str, trace: str) -> str:
+    """Waveform file for a test, e.g. 01_load/load.asm run from ROM."""
+    os.makedirs(WAVES_DIR, exist_ok=True)
+    base = os.path.splitext(name)[0].replace(os.sep, "_")
+    return os.path.abspath(os.path.join(WAVES_DIR, f"{base}.{trace}"))
+
+
+def trace_args(sim: str, trace: Optional[str], dumpfile: Optional[str]) -> str:
+    """Run-time arguments that make the testbench dump waveforms."""
+    if not trace:
+        return ""
+    fst = " -fst" if sim == "icarus" and trace == "fst" else ""
+    return f"{fst} +trace +dumpfile={dumpfile}"
+
+
+def parse_shard(value: Optional[str]) -> Optional[tuple[int, int]]:
+    """Parse --shard K/N (1 <= K <= N)."""
+    if not value:
+        return None
+    try:
+        k, n = (int(x) for x in value.split("/"))
+    except ValueError:
+        raise ValueError(f"--shard expects K/N, got {value}")
+    if not 1 <= k <= n:
+        raise ValueError(f"--shard {value}: need 1 <= K <= N")
+    return k, n
+
+
+def select_shard(tests: list[str], shard: Optional[tuple[int, int]]) -> list[str]:
+    """Every N-th test starting at the K-th, so shards get a similar mix."""
+    if not shard:
+        return tests
+    k, n = shard
+    return tests[k - 1 :: n]
+
+
+def report_wall_time(suite: str, sim: str, workers: int, count: int, start: float):
+    print(
+        f"Wall time: {time.monotonic() - start:.1f} s for {count} {suite} runs "
+        f"({sim}, {workers} workers)\n"
+    )
@@ -3,6 +3,7 @@
 ; Provides:
 ;   Main:  Stack/FP init → calls main() → sends return value over UART → halt
 ;   Int:   Saves all regs → calls interrupt() → restores regs → reti
+;   __hws_base, __hws_nspill: hardware stack state for QBE -H code
 ;
 ; The C program must define:
 ;   int main()          — program entry point
@@ -18,6 +19,10 @@
 Main:
     load32 0 r14                ; initialize frame pointer
     load32 0x1DFFFFC r13        ; initialize stack pointer (top of SDRAM)
+    load32 0x1F000004 r1
+    read 0 r1 r1                ; entries left by a loader are not ours
+    addr2reg __hws_base r2
+    write 0 r2 r1
     savpc r15                   ; set return address
     add r15 12 r15              ; point r15 past the jump
     jump main                   ; call C main()
@@ -43,6 +48,21 @@ Int:
     push r14
     push r15
 
+    ; Code built with QBE -H keeps its return addresses on the hardware
+    ; stack (see hwstack.asm).  interrupt() spills and fills only the
+    ; entries above the registers pushed here.
+    addr2reg __hws_base r1
+    read 0 r1 r2
+    push r2
+    addr2reg __hws_nspill r1
+    read 0 r1 r2
+    push r2
+    write 0 r1 r0
+    load32 0x1F000004 r2
+    read 0 r2 r2
+    addr2reg __hws_base r1
+    write 0 r1 r2
+
     load32 0x1FFFFFC r13        ; interrupt stack (DISTINCT from main stack at
                                 ; 0x1DFFFFC — using the same address makes the
                                 ; C interrupt() prologue write its caller-frame
@@ -58,6 +78,13 @@ Int:
     add r15 12 r15
     jump interrupt              ; call C interrupt()
 
+    pop r2
+    addr2reg __hws_nspill r1
+    write 0 r1 r2
+    pop r2
+    addr2reg __hws_base r1
+    write 0 r1 r2
+
     pop r15
     pop r14
     pop r13
@@ -76,3 +103,11 @@ Int:
 
     reti
     halt                        ; should not get here
+
+; Hardware stack state for code built with QBE -H (see hwstack.asm)
+.global __hws_base
+__hws_base:
+    .dw 0
+.global __hws_nspill
+__hws_nspill:
+    .dw 0
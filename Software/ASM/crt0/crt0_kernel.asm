@@ -146,8 +146,27 @@ Return_Syscall_blocked:
     ; Clear the blocked flag.
     addr2reg proc_was_blocked r11
     write 0 r11 r0                ; proc_was_blocked = 0
-    ; HW stack depth is still 13 (context_enter's saves; Syscall
-    ; entry's push/pop of r1 was balanced).
+
+    ; The HW stack holds only the user's entries (code built with
+    ; QBE -H keeps return addresses there; Syscall entry's push/pop
+    ; of r1 was balanced).  Move them to saved_hw_stack so the
+    ; kernel and other processes start from an empty HW stack.
+    addr2reg current_proc_regs_ptr r11
+    read 0 r11 r11                ; r11 = &saved_regs[0]
+    load32 0x1F000004 r1
+    read 0 r1 r1                  ; r1 = HW stack depth
+    write 68 r11 r1               ; saved_hw_sp
+    shiftl r1 2 r2
+    add r2 r11 r2
+    add r2 72 r2                  ; r2 = &saved_hw_stack[depth]
+Return_Syscall_save_hw:
+    beq r1 r0 Return_Syscall_saved_hw
+    pop r3
+    sub r2 4 r2
+    write 0 r2 r3
+    sub r1 1 r1
+    jump Return_Syscall_save_hw
+Return_Syscall_saved_hw:
     ; Jump to context_enter_return to restore kernel state.
     jump context_enter_return
 
@@ -195,20 +214,24 @@ kernel_loop_save_sp_bp:
 ; ============================================================
 .global context_enter
 context_enter:
-    ; Save kernel registers to HW stack (13 entries)
+    ; Save kernel registers to memory (13 words), not the HW stack:
+    ; the HW stack belongs to the user process while it runs
     push r1
-    push r2
-    push r3
-    push r4
-    push r5
-    push r6
-    push r7
-    push r8
-    push r9
-    push r10
-    push r11
-    push r12
-    push r15
+    addr2reg kernel_saved_regs r1
+    write 4 r1 r2
+    write 8 r1 r3
+    write 12 r1 r4
+    write 16 r1 r5
+    write 20 r1 r6
+    write 24 r1 r7
+    write 28 r1 r8
+    write 32 r1 r9
+    write 36 r1 r10
+    write 40 r1 r11
+    write 44 r1 r12
+    write 48 r1 r15
+    pop r2
+    write 0 r1 r2                ; kernel r1
 
     ; Save kernel SP/BP to globals
     addr2reg kernel_loop_sp r11
@@ -220,6 +243,17 @@ context_enter:
     addr2reg current_proc_regs_ptr r11
     read 0 r11 r11               ; r11 = &saved_regs[0]
 
+    ; Push back the HW stack entries saved when the process blocked
+    read 68 r11 r1               ; saved_hw_sp
+    add r11 72 r2                ; r2 = &saved_hw_stack[0]
+context_enter_hw:
+    beq r1 r0 context_enter_regs
+    read 0 r2 r3
+    push r3
+    add r2 4 r2
+    sub r1 1 r1
+    jump context_enter_hw
+context_enter_regs:
     ; Load r1-r10, r12-r15
     read 4 r11 r1
     read 8 r11 r2
@@ -259,38 +293,42 @@ context_enter_return:
     addr2reg kernel_loop_bp r11
     read 0 r11 r14
 
-    ; Restore kernel registers from HW stack (13 entries)
-    pop r15
-    pop r12
-    pop r11
-    pop r10
-    pop r9
-    pop r8
-    pop r7
-    pop r6
-    pop r5
-    pop r4
-    pop r3
-    pop r2
-    pop r1
+    ; Restore kernel registers from memory
+    addr2reg kernel_saved_regs r1
+    read 4 r1 r2
+    read 8 r1 r3
+    read 12 r1 r4
+    read 16 r1 r5
+    read 20 r1 r6
+    read 24 r1 r7
+    read 28 r1 r8
+    read 32 r1 r9
+    read 36 r1 r10
+    read 40 r1 r11
+    read 44 r1 r12
+    read 48 r1 r15
+    read 0 r1 r1
 
     ; Return to C caller (shell_execute)
     jumpr 0 r15
 
+; Kernel registers saved by context_enter: r1-r12, r15
+kernel_saved_regs:
+    .dw 0 0 0 0 0 0 0 0 0 0 0 0 0
+
 ; ============================================================
 ; syscall_exit_to_kernel()
 ;
 ; Called from EXIT syscall handler after proc_exit() cleanup.
-; Resets HW stack to context_enter depth (13 entries) and
-; jumps to context_enter_return to restore kernel state.
+; Drops the user's HW stack entries and jumps to
+; context_enter_return to restore kernel state.
 ; Does not return.
 ; ============================================================
 .global syscall_exit_to_kernel
 syscall_exit_to_kernel:
-    ; Reset HW stack pointer to context_enter depth (13 entries)
+    ; Empty the HW stack
     load32 0x1F000004 r1
-    load 13 r2
-    write 0 r1 r2
+    write 0 r1 r0
 
     ; Jump to context_enter_return
     jump context_enter_return
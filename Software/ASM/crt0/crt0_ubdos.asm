@@ -3,6 +3,7 @@
 ; Provides:
 ;   Main:  calls main() → SYS_EXIT with return value
 ;   Int:   reti stub (BDOS handles all interrupts)
+;   __hws_base, __hws_nspill: hardware stack state for QBE -H code
 ;
 ; The C program must define:
 ;   int main()  — program entry point
@@ -32,3 +33,13 @@ Main:
 Int:
     reti
     halt                        ; should not get here
+
+; Hardware stack state for code built with QBE -H (see hwstack.asm).
+; The kernel saves and restores the process's hardware stack, so it
+; starts out empty.
+.global __hws_base
+__hws_base:
+    .dw 0
+.global __hws_nspill
+__hws_nspill:
+    .dw 0
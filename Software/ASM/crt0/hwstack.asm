@@ -0,0 +1,147 @@
+; hwstack.asm — Hardware stack runtime for code compiled with QBE -H
+;
+; Provides:
+;   __hws_spill:  called by a -H prologue when the hardware stack is deep
+;   __hws_fill:   return address of a function whose caller's group was
+;                 spilled
+;
+; A -H function pushes one group when it is entered and pops it when it
+; returns: the old FP, up to three callee-saved registers, and RA with the
+; number of saved registers (k) in its low two bits.  The memory frame of
+; each such function keeps room for its own group:
+;   [FP+0]        old FP
+;   [FP+4]        RA | k
+;   [FP-4*i]      callee-saved register i (1..k)
+;
+; Spilling walks the groups from the top of the hardware stack down to
+; __hws_base and stores each into the frame of the function that pushed it.
+; The caller's FP in r14 belongs to the top group, and the old FP of each
+; group belongs to the group below.  The function being entered then
+; returns to __hws_fill, which pushes back the group of its caller only,
+; so deep recursion spills and fills one group per call once it is past
+; the threshold, instead of the whole stack.
+;
+; The startup code must define (see crt0_baremetal.asm, crt0_ubdos.asm):
+;   __hws_base    hardware stack entries that are not groups of this context
+;   __hws_nspill  groups stored in frames, 0 when all are on the stack
+
+.text
+
+; ============================================================
+; __hws_spill
+;
+; Entered with r12 = return address, when the prologue of the new
+; function has pushed the old FP (still in r14) of its group.  r13 is
+; still the caller's SP, so the words below it are free.  Preserves all
+; registers but r12, and points r15 at __hws_fill when there was anything
+; to spill.
+; ============================================================
+.global __hws_spill
+__hws_spill:
+    write -4 r13 r1
+    write -8 r13 r2
+    write -12 r13 r3
+    write -16 r13 r4
+    write -20 r13 r5
+    write -24 r13 r6
+    write -28 r13 r12
+    pop r1                      ; the old FP, pushed again at the end
+
+    load32 0x1F000004 r1
+    read 0 r1 r1                ; r1 = hardware stack depth
+    or r0 r14 r2                ; r2 = frame of the top group
+    load 0 r5                   ; r5 = groups spilled
+
+__hws_spill_group:
+    addr2reg __hws_base r6
+    read 0 r6 r6
+    beq r1 r6 __hws_spill_done
+    pop r3                      ; r3 = RA | k
+    and r3 3 r4                 ; r4 = k
+    sub r1 2 r1
+    sub r1 r4 r1                ; r1 = depth below this group
+    sub r3 r4 r6                ; r6 = RA
+    addr2reg __hws_fill r12
+    bne r6 r12 __hws_spill_ra
+    ; the group was filled back before: its RA is still in the frame
+    read 4 r2 r6
+    or r6 r4 r6
+    write 4 r2 r6
+    jump __hws_spill_regs
+__hws_spill_ra:
+    write 4 r2 r3
+__hws_spill_regs:
+    shiftl r4 2 r6
+    sub r2 r6 r6                ; r6 = slot of the last saved register
+__hws_spill_reg:
+    beq r6 r2 __hws_spill_fp
+    pop r4
+    write 0 r6 r4
+    add r6 4 r6
+    jump __hws_spill_reg
+__hws_spill_fp:
+    pop r4                      ; r4 = old FP, the frame of the next group
+    write 0 r2 r4
+    or r0 r4 r2
+    add r5 1 r5
+    jump __hws_spill_group
+
+__hws_spill_done:
+    beq r5 r0 __hws_spill_return
+    addr2reg __hws_nspill r6
+    read 0 r6 r1
+    add r1 r5 r1
+    write 0 r6 r1
+    write 4 r13 r15             ; real RA in the RA slot of the new frame
+    addr2reg __hws_fill r15     ; and return through the fill
+
+__hws_spill_return:
+    read -4 r13 r1
+    read -8 r13 r2
+    read -12 r13 r3
+    read -16 r13 r4
+    read -20 r13 r5
+    read -24 r13 r6
+    read -28 r13 r12
+    push r14
+    jumpr 0 r12
+
+; ============================================================
+; __hws_fill
+;
+; Reached from the epilogue of a function G whose caller F has its group
+; in its frame: r13 is the FP of G and r14 the FP of F.  Pushes the group
+; of F back and returns to F.  r1 holds the return value; r2-r7 and r12
+; are free, as after any call.
+; ============================================================
+.global __hws_fill
+__hws_fill:
+    read 4 r13 r15
+    shiftr r15 2 r15
+    shiftl r15 2 r15            ; r15 = return address into F
+    read 4 r14 r2               ; r2 = RA | k of F
+    read 0 r14 r4
+    push r4                     ; old FP
+    and r2 3 r3                 ; r3 = k
+    or r0 r14 r5
+__hws_fill_reg:
+    beq r3 r0 __hws_fill_ra
+    sub r5 4 r5
+    read 0 r5 r4
+    push r4                     ; callee-saved registers, in order
+    sub r3 1 r3
+    jump __hws_fill_reg
+__hws_fill_ra:
+    addr2reg __hws_nspill r3
+    read 0 r3 r4
+    sub r4 1 r4
+    write 0 r3 r4
+    beq r4 r0 __hws_fill_last
+    ; the group below F is in memory too: F returns here as well,
+    ; its real RA stays in its frame
+    and r2 3 r2
+    addr2reg __hws_fill r4
+    add r4 r2 r2
+__hws_fill_last:
+    push r2
+    jumpr 0 r15
@@ -0,0 +1,39 @@
+/*
+ * dma_svc.h — kernel DMA service.
+ *
+ * The request queue itself lives in libfpgc (dma_queue.c) and is used
+ * directly by kernel drivers. This module owns the IRQ 7 setup and the
+ * user-facing side: SYS_DMA_SUBMIT copies a user descriptor into one of
+ * a small pool of kernel-owned slots, and SYS_DMA_WAIT collects the
+ * result or blocks the process until the completion IRQ wakes it.
+ */
+#ifndef KERNEL_DMA_SVC_H
+#define KERNEL_DMA_SVC_H
+
+/* Outstanding user requests, system-wide. */
+#define DMA_SVC_SLOTS   8
+
+/* Layout of the descriptor passed to SYS_DMA_SUBMIT (4 words). */
+#define DMA_SVC_DESC_DST    0
+#define DMA_SVC_DESC_SRC    1
+#define DMA_SVC_DESC_COUNT  2
+#define DMA_SVC_DESC_MODE   3
+
+/* SYS_DMA_WAIT flags */
+#define DMA_SVC_NOBLOCK     1
+
+/* Initialise the queue in IRQ-driven mode. */
+void dma_svc_init(void);
+
+/* SYS_DMA_SUBMIT: returns a handle (>= 0) or -1. */
+int dma_svc_submit(const unsigned int *desc);
+
+/* SYS_DMA_WAIT: returns 0 (done), -1 (error/bad handle), or 1 if the
+ * request is still pending and DMA_SVC_NOBLOCK was given. Without
+ * NOBLOCK a pending request blocks the caller (proc_was_blocked). */
+int dma_svc_wait(int handle, int flags);
+
+/* Release the slots of an exiting process. */
+void dma_svc_proc_exit(int pid);
+
+#endif /* KERNEL_DMA_SVC_H */
@@ -5,7 +5,8 @@
  * Phase 2: extract to a standalone daemon (/bin/fnpd on SD card).
  *
  * Protocol: raw Ethernet (EtherType 0xB4B4), supports file upload
- * (FILE_START/DATA/END), remote keycodes, and text messages.
+ * (FILE_START/DATA/END), group upload to many boards at once
+ * (GROUP_*, see fnp_group.h), remote keycodes, and text messages.
  */
 #ifndef KERNEL_FNP_H
 #define KERNEL_FNP_H
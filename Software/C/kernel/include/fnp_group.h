@@ -0,0 +1,84 @@
+/*
+ * fnp_group.h — FNP group (one-to-many) file transfer, receiver side.
+ *
+ * A sender broadcasts GROUP_START/GROUP_DATA frames once for all boards
+ * of a group. Chunks may arrive in any order or not at all; on
+ * GROUP_POLL every member answers with a GROUP_STATUS listing the chunk
+ * ranges it is still missing (a NACK), and the sender rebroadcasts only
+ * the union of those ranges. Nothing is acknowledged per chunk.
+ *
+ * Payloads (big-endian, after the 7-byte FNP header):
+ *   GROUP_START  [xfer (2)] [members (4)] [size words (4)] [path len (2)] [path]
+ *   GROUP_DATA   [xfer (2)] [chunk (2)] [data, FNP_GROUP_CHUNK_SIZE bytes
+ *                except for the last chunk]
+ *   GROUP_POLL   [xfer (2)] [checksum (4)]
+ *   GROUP_STATUS [xfer (2)] [state (1)] [ranges (1)] [chunks received (2)]
+ *                [first (2), count (2)] x ranges
+ *
+ * `members` has bit (id - 1) set for every board id (last MAC byte,
+ * 1..32) that should take part; 0 addresses every board. The checksum
+ * is the same 32-bit sum of big-endian words as FILE_END.
+ *
+ * This module only tracks chunks and builds replies; file I/O goes
+ * through struct fnp_group_io so it has no kernel dependencies.
+ */
+#ifndef KERNEL_FNP_GROUP_H
+#define KERNEL_FNP_GROUP_H
+
+#define FNP_TYPE_GROUP_START  0x14
+#define FNP_TYPE_GROUP_DATA   0x15
+#define FNP_TYPE_GROUP_POLL   0x16
+#define FNP_TYPE_GROUP_STATUS 0x17
+
+#define FNP_GROUP_CHUNK_SIZE  1024
+#define FNP_GROUP_MAX_CHUNKS  1024      /* 1 MiB per file */
+#define FNP_GROUP_MAX_RANGES  32        /* NACK ranges per GROUP_STATUS */
+#define FNP_GROUP_STATUS_MAX  (6 + 4 * FNP_GROUP_MAX_RANGES)
+
+/* Receiver states, reported in GROUP_STATUS */
+#define FNP_GROUP_RECEIVING   0
+#define FNP_GROUP_DONE        1
+#define FNP_GROUP_FAILED      2
+#define FNP_GROUP_UNKNOWN     3         /* polled for a transfer we never saw */
+#define FNP_GROUP_IDLE        4         /* internal only */
+
+struct fnp_group_io {
+    /* Create `path` holding size_bytes bytes, so chunks can be written
+     * at any offset. Returns 0 or -1. */
+    int  (*open)(const char *path, unsigned int size_bytes, void *ctx);
+    int  (*write)(unsigned int offset, const char *data, int len, void *ctx);
+    /* ok = 0 after a failed checksum or a replaced transfer. */
+    void (*close)(int ok, void *ctx);
+    void *ctx;
+};
+
+struct fnp_group_rx {
+    int          state;
+    int          xfer;
+    unsigned int size_words;
+    int          chunks;
+    int          received;
+    unsigned int checksum;
+    unsigned int bitmap[FNP_GROUP_MAX_CHUNKS / 32];
+    char         path[128];
+    const struct fnp_group_io *io;
+};
+
+void fnp_group_rx_init(struct fnp_group_rx *rx, const struct fnp_group_io *io);
+
+/*
+ * Each handler takes an FNP payload and returns the length of the
+ * GROUP_STATUS payload written to `reply` (at least FNP_GROUP_STATUS_MAX
+ * bytes), or 0 if nothing should be sent. `board_id` is our last MAC
+ * byte, used against the START member mask.
+ */
+int fnp_group_rx_start(struct fnp_group_rx *rx, int board_id,
+                       const char *data, int len, char *reply);
+int fnp_group_rx_data(struct fnp_group_rx *rx, const char *data, int len);
+int fnp_group_rx_poll(struct fnp_group_rx *rx, const char *data, int len,
+                      char *reply);
+
+/* Build a GROUP_STATUS payload for the current transfer. */
+int fnp_group_rx_status(struct fnp_group_rx *rx, char *reply);
+
+#endif /* KERNEL_FNP_GROUP_H */
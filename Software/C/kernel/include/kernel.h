@@ -42,6 +42,8 @@
 #include "hid.h"
 #include "net.h"
 #include "fnp.h"
+#include "fnp_group.h"
+#include "dma_svc.h"
 
 /* Core kernel functions (main.c) */
 void kernel_panic(const char *msg);
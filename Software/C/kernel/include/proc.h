@@ -13,6 +13,7 @@
 #define MAX_ARGV          32     /* Must match shell's ARGV_MAX (cc.sh uses ~21) */
 #define PROC_NAME_LEN     32
 #define PROC_CWD_LEN      128
+#define PROC_HW_STACK     64     /* Entries of the CPU hardware stack */
 
 /* Process states */
 #define PROC_FREE       0    /* Slot is unused */
@@ -27,6 +28,7 @@
 #define BLOCK_WAITPID   2    /* Waiting for child exit */
 #define BLOCK_PIPE_READ 3    /* Pipe empty, waiting for writer */
 #define BLOCK_PIPE_WRITE 4   /* Pipe full, waiting for reader */
+#define BLOCK_DMA       5    /* SYS_DMA_WAIT on a queued transfer */
 
 struct proc {
     int            pid;
@@ -43,8 +45,8 @@ struct proc {
     /* Saved CPU context (filled by context switch) */
     unsigned int   saved_regs[16];   /* r0-r15 (r0 always 0) */
     unsigned int   saved_pc;
-    unsigned int   saved_hw_sp;
-    unsigned int   saved_hw_stack[256];
+    unsigned int   saved_hw_sp;      /* User HW stack while blocked */
+    unsigned int   saved_hw_stack[PROC_HW_STACK];
 
     /* File descriptors — indexes into global open file table */
     int            fds[MAX_FDS];
@@ -111,11 +113,13 @@ extern void context_switch(struct proc *from, struct proc *to);
 /* Enter a user process: saves kernel state, loads user state from
  * proc struct (via current_proc_regs_ptr), and jumps to user code.
  * saved_regs[15] is the jump target (entry point or resume address).
+ * The HW stack is the process's while it runs: the entries saved when
+ * it blocked are pushed back first.
  * Returns when the process exits or blocks. */
 extern void context_enter(void);
 
 /* Called from EXIT syscall handler after proc_exit() cleanup.
- * Resets HW stack and returns to context_enter caller. */
+ * Empties the HW stack and returns to context_enter caller. */
 extern void syscall_exit_to_kernel(void);
 
 /* Exit code from context_enter (legacy, kept for compat) */
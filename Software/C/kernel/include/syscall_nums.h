@@ -56,6 +56,10 @@
 #define SYS_PIPE            60
 #define SYS_IOCTL           61
 
+/* ---- DMA ---- */
+#define SYS_DMA_SUBMIT      70
+#define SYS_DMA_WAIT        71
+
 /* Syscall dispatch function (called from crt0 Syscall entry) */
 int syscall_dispatch(int num, int a1, int a2, int a3);
 
@@ -5,6 +5,8 @@
  *   /proc/uptime  — system uptime in seconds
  *   /proc/meminfo — memory usage summary
  *   /proc/ps      — process table dump
+ *   /proc/df      — filesystem usage
+ *   /proc/dma     — DMA queue statistics per transfer mode
  */
 #include "kernel.h"
 
@@ -13,6 +15,7 @@
 #define PROC_FILE_MEMINFO 1
 #define PROC_FILE_PS      2
 #define PROC_FILE_DF      3
+#define PROC_FILE_DMA     4
 
 /* ---- Integer formatting helpers ---- */
 
@@ -180,6 +183,46 @@ static int gen_df(char *buf, int bufsize)
     return len;
 }
 
+static int gen_dma(char *buf, int bufsize)
+{
+    const dma_queue_stats_t *st;
+    const char *mode_names[DMA_MODE_COUNT];
+    int len;
+    int m;
+
+    mode_names[0] = "mem2mem ";
+    mode_names[1] = "mem2spi ";
+    mode_names[2] = "spi2mem ";
+    mode_names[3] = "mem2vram";
+    mode_names[4] = "mem2io  ";
+    mode_names[5] = "io2mem  ";
+    mode_names[6] = "qspi    ";
+
+    st = dma_queue_get_stats();
+    len = 0;
+    len += proc_strcpy(buf + len, "Mode       Reqs     Bytes Err\n");
+
+    for (m = 0; m < DMA_MODE_COUNT && len < bufsize - 64; m++)
+    {
+        if (st->mode[m].requests == 0)
+            continue;
+        len += proc_strcpy(buf + len, mode_names[m]);
+        len += proc_itoa_rjust(buf + len, st->mode[m].requests, 7);
+        len += proc_itoa_rjust(buf + len, st->mode[m].bytes, 10);
+        len += proc_itoa_rjust(buf + len, st->mode[m].errors, 4);
+        buf[len++] = '\n';
+    }
+
+    len += proc_strcpy(buf + len, "irqs ");
+    len += proc_itoa(buf + len, st->irqs);
+    len += proc_strcpy(buf + len, " chained ");
+    len += proc_itoa(buf + len, st->chained);
+    len += proc_strcpy(buf + len, " maxq ");
+    len += proc_itoa(buf + len, st->max_depth);
+    buf[len++] = '\n';
+    return len;
+}
+
 /* ---- File operations ---- */
 
 static int proc_read(struct open_file *f, void *buf, int count)
@@ -206,6 +249,9 @@ static int proc_read(struct open_file *f, void *buf, int count)
     case PROC_FILE_DF:
         len = gen_df(content, 512);
         break;
+    case PROC_FILE_DMA:
+        len = gen_dma(content, 512);
+        break;
     default:
         return -1;
     }
@@ -279,6 +325,8 @@ static int proc_open(const char *path, int flags, struct open_file *f)
         f->private = (void *)PROC_FILE_PS;
     else if (proc_streq(name, "df"))
         f->private = (void *)PROC_FILE_DF;
+    else if (proc_streq(name, "dma"))
+        f->private = (void *)PROC_FILE_DMA;
     else
         return -1; /* unknown proc file */
 
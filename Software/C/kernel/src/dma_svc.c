@@ -0,0 +1,205 @@
+/*
+ * dma_svc.c — kernel DMA service (user side of the libfpgc DMA queue).
+ *
+ * User programs submit MEM2MEM / MEM2VRAM transfers with SYS_DMA_SUBMIT
+ * and collect them with SYS_DMA_WAIT. Each submission is copied into a
+ * kernel-owned slot so the queue never points into user memory that
+ * might disappear; a blocking wait parks the process in BLOCK_DMA and
+ * the completion callback (IRQ 7) makes it READY again with the result
+ * in r1, the same way sched_wake_sleepers() finishes a sleep.
+ */
+#include "kernel.h"
+
+struct dma_svc_slot {
+    dma_req_t req;
+    int       in_use;
+    int       owner;     /* pid, or -1 once the owner has exited */
+    int       waiter;    /* pid blocked in SYS_DMA_WAIT, or -1 */
+};
+
+static struct dma_svc_slot dma_svc_slots[DMA_SVC_SLOTS];
+
+static int dma_svc_result(struct dma_svc_slot *s)
+{
+    return (s->req.state == DMA_REQ_ERROR) ? -1 : 0;
+}
+
+static void dma_svc_free(struct dma_svc_slot *s)
+{
+    s->in_use = 0;
+    s->owner = -1;
+    s->waiter = -1;
+}
+
+/* Completion callback: runs from dma_isr() or a polling waiter. */
+static void dma_svc_done(dma_req_t *req)
+{
+    struct dma_svc_slot *s;
+    struct proc *p;
+
+    s = (struct dma_svc_slot *)req->ctx;
+
+    if (s->waiter >= 0)
+    {
+        p = proc_by_pid(s->waiter);
+        if (p && p->state == PROC_BLOCKED
+            && p->blocked_reason == BLOCK_DMA)
+        {
+            p->saved_regs[1] = (unsigned int)dma_svc_result(s);
+            p->state = PROC_READY;
+            p->blocked_reason = BLOCK_NONE;
+            sched_should_yield = 1;
+        }
+        dma_svc_free(s);
+        return;
+    }
+
+    /* Owner exited while the transfer was in flight. */
+    if (s->owner < 0)
+        dma_svc_free(s);
+}
+
+/* Does [addr, addr+len) lie inside the process's memory region? */
+static int dma_svc_in_proc(struct proc *p, unsigned int addr,
+                           unsigned int len)
+{
+    if (addr < p->mem_base)
+        return 0;
+    if (len > p->mem_size)
+        return 0;
+    return addr - p->mem_base <= p->mem_size - len;
+}
+
+void dma_svc_init(void)
+{
+    int i;
+
+    for (i = 0; i < DMA_SVC_SLOTS; i++)
+        dma_svc_free(&dma_svc_slots[i]);
+
+    dma_queue_init(1);
+}
+
+int dma_svc_submit(const unsigned int *desc)
+{
+    struct proc *p;
+    struct dma_svc_slot *s;
+    unsigned int dst;
+    unsigned int src;
+    unsigned int count;
+    unsigned int mode;
+    int i;
+
+    p = proc_current();
+    if (!p || p->pid == 0)
+        return -1;
+
+    dst   = desc[DMA_SVC_DESC_DST];
+    src   = desc[DMA_SVC_DESC_SRC];
+    count = desc[DMA_SVC_DESC_COUNT];
+    mode  = desc[DMA_SVC_DESC_MODE];
+
+    /* SPI modes need the kernel's chip-select discipline: not for users. */
+    if (mode != FPGC_DMA_MODE_MEM2MEM && mode != FPGC_DMA_MODE_MEM2VRAM)
+        return -1;
+    if (!dma_svc_in_proc(p, src, count))
+        return -1;
+    if (mode == FPGC_DMA_MODE_MEM2MEM && !dma_svc_in_proc(p, dst, count))
+        return -1;
+
+    for (i = 0; i < DMA_SVC_SLOTS; i++)
+    {
+        if (!dma_svc_slots[i].in_use)
+            break;
+    }
+    if (i == DMA_SVC_SLOTS)
+        return -1;
+
+    s = &dma_svc_slots[i];
+    s->in_use = 1;
+    s->owner = p->pid;
+    s->waiter = -1;
+
+    dma_req_init(&s->req, (dma_mode_t)mode, dst, src, count);
+    s->req.flags = DMA_REQ_FLUSH_BEFORE;
+    if (mode == FPGC_DMA_MODE_MEM2MEM)
+        s->req.flags |= DMA_REQ_FLUSH_AFTER;
+    s->req.done = dma_svc_done;
+    s->req.ctx = (void *)s;
+
+    if (dma_submit(&s->req) != 0)
+    {
+        dma_svc_free(s);
+        return -1;
+    }
+    return i;
+}
+
+int dma_svc_wait(int handle, int flags)
+{
+    struct proc *p;
+    struct dma_svc_slot *s;
+    int result;
+
+    p = proc_current();
+    if (!p || handle < 0 || handle >= DMA_SVC_SLOTS)
+        return -1;
+
+    s = &dma_svc_slots[handle];
+    if (!s->in_use || s->owner != p->pid || s->waiter >= 0)
+        return -1;
+
+    /* Hold the queue lock so the completion cannot slip in between the
+     * pending check and marking the process blocked. */
+    dma_queue_lock();
+
+    if (!dma_req_pending(&s->req))
+    {
+        result = dma_svc_result(s);
+        dma_svc_free(s);
+        dma_queue_unlock();
+        return result;
+    }
+
+    if (flags & DMA_SVC_NOBLOCK)
+    {
+        dma_queue_unlock();
+        return 1;
+    }
+
+    s->waiter = p->pid;
+    p->state = PROC_BLOCKED;
+    p->blocked_reason = BLOCK_DMA;
+    sched_should_yield = 1;
+    proc_was_blocked = 1;
+
+    dma_queue_unlock();
+    return 0; /* Real result is delivered in r1 by dma_svc_done() */
+}
+
+void dma_svc_proc_exit(int pid)
+{
+    int i;
+    struct dma_svc_slot *s;
+
+    dma_queue_lock();
+    for (i = 0; i < DMA_SVC_SLOTS; i++)
+    {
+        s = &dma_svc_slots[i];
+        if (!s->in_use || s->owner != pid)
+            continue;
+
+        /* The engine cannot be aborted: an in-flight transfer finishes
+         * into the freed region and its slot is reclaimed on completion. */
+        if (dma_req_pending(&s->req))
+        {
+            s->owner = -1;
+            s->waiter = -1;
+        }
+        else
+        {
+            dma_svc_free(s);
+        }
+    }
+    dma_queue_unlock();
+}
@@ -7,7 +7,8 @@
  * on the SD card so it survives SPI flash reformats.
  *
  * Protocol: raw Ethernet frames with EtherType 0xB4B4.
- * Supports FILE_START/DATA/END for uploading files, KEYCODE for
+ * Supports FILE_START/DATA/END for uploading files, GROUP_* for
+ * one-to-many uploads (chunk tracking in fnp_group.c), KEYCODE for
  * remote keyboard input, and MESSAGE for text display.
  */
 #include "kernel.h"
@@ -16,8 +17,7 @@
 
 static char fnp_rx[FNP_FRAME_MAX];
 static char fnp_tx[FNP_FRAME_MAX];
-static char fnp_peer_mac[6];    /* MAC of connected peer */
-static int  fnp_has_peer;       /* Have we seen a peer yet? */
+static char fnp_peer_mac[6];    /* Source MAC of the frame being handled */
 
 /* File transfer state */
 #define FNP_STATE_IDLE      0
@@ -29,6 +29,12 @@ static unsigned int fnp_transfer_checksum;
 static unsigned int fnp_transfer_size;     /* Expected size in words */
 static unsigned int fnp_transfer_received; /* Words received so far */
 
+/* Group (broadcast) transfer state */
+static struct fnp_group_rx fnp_group;
+static int  fnp_group_gfd;
+static char fnp_group_reply[FNP_GROUP_STATUS_MAX];
+static char fnp_group_zero[FNP_GROUP_CHUNK_SIZE];
+
 /* ---- Helpers ---- */
 
 static unsigned int fnp_read_u16(const char *buf, int offset)
@@ -276,6 +282,95 @@ static void fnp_handle_keycode(int seq, const char *data, int data_len, int flag
         fnp_send_ack(seq);
 }
 
+/* ---- Group transfer handlers ---- */
+
+/* Create the file at full size so chunks can be written in any order. */
+static int fnp_group_open(const char *path, unsigned int size_bytes, void *ctx)
+{
+    unsigned int done;
+    int n;
+
+    (void)ctx;
+    vfs_unlink(path);
+    fnp_group_gfd = vfs_open(path, O_WRONLY | O_CREAT);
+    if (fnp_group_gfd < 0)
+        return -1;
+
+    done = 0;
+    while (done < size_bytes)
+    {
+        n = (int)(size_bytes - done);
+        if (n > FNP_GROUP_CHUNK_SIZE)
+            n = FNP_GROUP_CHUNK_SIZE;
+        if (vfs_write(fnp_group_gfd, fnp_group_zero, n) != n)
+        {
+            vfs_close(fnp_group_gfd);
+            fnp_group_gfd = -1;
+            return -1;
+        }
+        done += (unsigned int)n;
+    }
+
+    term_puts("[FNP] group recv: ");
+    term_puts(path);
+    term_putchar('\n');
+    return 0;
+}
+
+static int fnp_group_write(unsigned int offset, const char *data, int len,
+                           void *ctx)
+{
+    (void)ctx;
+    if (vfs_lseek(fnp_group_gfd, (int)offset, SEEK_SET) != (int)offset)
+        return -1;
+    return vfs_write(fnp_group_gfd, data, len) == len ? 0 : -1;
+}
+
+static void fnp_group_close(int ok, void *ctx)
+{
+    (void)ctx;
+    if (fnp_group_gfd >= 0)
+    {
+        vfs_close(fnp_group_gfd);
+        fnp_group_gfd = -1;
+    }
+    if (ok)
+    {
+        term_puts("[FNP] group done (");
+        term_putint((int)fnp_group.size_words);
+        term_puts(" words)\n");
+    }
+    else
+    {
+        vfs_unlink(fnp_group.path);
+        term_puts("[FNP] group transfer failed\n");
+    }
+}
+
+static const struct fnp_group_io fnp_group_ops = {
+    fnp_group_open,
+    fnp_group_write,
+    fnp_group_close,
+    0
+};
+
+static void fnp_handle_group(int type, int seq, const char *data, int data_len)
+{
+    int len;
+
+    len = 0;
+    if (type == FNP_TYPE_GROUP_START)
+        len = fnp_group_rx_start(&fnp_group, net_mac[5], data, data_len,
+                                 fnp_group_reply);
+    else if (type == FNP_TYPE_GROUP_DATA)
+        fnp_group_rx_data(&fnp_group, data, data_len);
+    else
+        len = fnp_group_rx_poll(&fnp_group, data, data_len, fnp_group_reply);
+
+    if (len > 0)
+        fnp_send(FNP_TYPE_GROUP_STATUS, seq, fnp_group_reply, len);
+}
+
 /* ---- Public API ---- */
 
 /* ---- MKDIR handler ---- */
@@ -317,12 +412,15 @@ static void fnp_handle_sync(int seq)
 
 void fnp_init(void)
 {
-    fnp_has_peer = 0;
     fnp_state = FNP_STATE_IDLE;
     fnp_transfer_gfd = -1;
     fnp_transfer_checksum = 0;
     fnp_transfer_size = 0;
     fnp_transfer_received = 0;
+
+    fnp_group_gfd = -1;
+    memset(fnp_group_zero, 0, sizeof(fnp_group_zero));
+    fnp_group_rx_init(&fnp_group, &fnp_group_ops);
 }
 
 int fnp_poll(void)
@@ -345,13 +443,13 @@ int fnp_poll(void)
     ethertype = fnp_read_u16(fnp_rx, 12);
     if (ethertype != 0xB4B4) return 0;
 
-    /* Learn peer MAC from first FNP packet */
-    if (!fnp_has_peer)
+    /* Replies go back to whoever sent this frame. Group transfers are
+     * broadcast, so several boards answer the same sender, and more than
+     * one PC or FPGC may talk to us over time. */
     {
         int i;
         for (i = 0; i < 6; i++)
             fnp_peer_mac[i] = fnp_rx[6 + i]; /* Source MAC */
-        fnp_has_peer = 1;
     }
 
     /* Parse FNP header */
@@ -383,6 +481,12 @@ int fnp_poll(void)
         fnp_handle_file_abort(seq);
         break;
 
+    case FNP_TYPE_GROUP_START:
+    case FNP_TYPE_GROUP_DATA:
+    case FNP_TYPE_GROUP_POLL:
+        fnp_handle_group(type, seq, payload, payload_len);
+        break;
+
     case FNP_TYPE_KEYCODE:
         fnp_handle_keycode(seq, payload, payload_len, flags);
         break;
@@ -0,0 +1,229 @@
+/*
+ * fnp_group.c — FNP group file transfer receiver (see fnp_group.h).
+ *
+ * The file is created at its final size on GROUP_START so each chunk can
+ * be written in place whenever it arrives. A bitmap filters duplicates
+ * from rebroadcast rounds, and the checksum is summed once per chunk as
+ * it is written, so GROUP_POLL can verify and close the file without
+ * reading it back.
+ *
+ * Only fnp_group.h is included: the module is built into the kernel and,
+ * with a memory-backed struct fnp_group_io, into the host simulation.
+ */
+#include "fnp_group.h"
+
+static unsigned int fnp_group_u16(const char *buf, int offset)
+{
+    return ((unsigned int)(unsigned char)buf[offset] << 8)
+         | ((unsigned int)(unsigned char)buf[offset + 1]);
+}
+
+static unsigned int fnp_group_u32(const char *buf, int offset)
+{
+    return ((unsigned int)(unsigned char)buf[offset]     << 24)
+         | ((unsigned int)(unsigned char)buf[offset + 1] << 16)
+         | ((unsigned int)(unsigned char)buf[offset + 2] <<  8)
+         | ((unsigned int)(unsigned char)buf[offset + 3]);
+}
+
+static void fnp_group_put16(char *buf, int offset, unsigned int val)
+{
+    buf[offset]     = (char)((val >> 8) & 0xFF);
+    buf[offset + 1] = (char)(val & 0xFF);
+}
+
+static int fnp_group_have(struct fnp_group_rx *rx, int chunk)
+{
+    return (rx->bitmap[chunk >> 5] >> (chunk & 31)) & 1;
+}
+
+/* Drop the current transfer; a half-written file is closed as failed. */
+static void fnp_group_reset(struct fnp_group_rx *rx)
+{
+    int i;
+
+    if (rx->state == FNP_GROUP_RECEIVING)
+        rx->io->close(0, rx->io->ctx);
+    rx->state = FNP_GROUP_IDLE;
+    rx->xfer = -1;
+    rx->size_words = 0;
+    rx->chunks = 0;
+    rx->received = 0;
+    rx->checksum = 0;
+    for (i = 0; i < FNP_GROUP_MAX_CHUNKS / 32; i++)
+        rx->bitmap[i] = 0;
+}
+
+void fnp_group_rx_init(struct fnp_group_rx *rx, const struct fnp_group_io *io)
+{
+    rx->io = io;
+    rx->state = FNP_GROUP_IDLE;
+    fnp_group_reset(rx);
+}
+
+int fnp_group_rx_status(struct fnp_group_rx *rx, char *reply)
+{
+    int ranges;
+    int len;
+    int i;
+    int first;
+
+    fnp_group_put16(reply, 0, (unsigned int)rx->xfer);
+    reply[2] = (char)rx->state;
+    fnp_group_put16(reply, 4, (unsigned int)rx->received);
+    len = 6;
+    ranges = 0;
+
+    if (rx->state == FNP_GROUP_RECEIVING)
+    {
+        i = 0;
+        while (i < rx->chunks && ranges < FNP_GROUP_MAX_RANGES)
+        {
+            /* Skip whole words of received chunks */
+            if ((i & 31) == 0 && rx->bitmap[i >> 5] == 0xFFFFFFFFu)
+            {
+                i += 32;
+                continue;
+            }
+            if (fnp_group_have(rx, i))
+            {
+                i++;
+                continue;
+            }
+            first = i;
+            while (i < rx->chunks && !fnp_group_have(rx, i))
+                i++;
+            fnp_group_put16(reply, len, (unsigned int)first);
+            fnp_group_put16(reply, len + 2, (unsigned int)(i - first));
+            len += 4;
+            ranges++;
+        }
+    }
+
+    reply[3] = (char)ranges;
+    return len;
+}
+
+int fnp_group_rx_start(struct fnp_group_rx *rx, int board_id,
+                       const char *data, int len, char *reply)
+{
+    int xfer;
+    unsigned int members;
+    unsigned int size_words;
+    int path_len;
+    int chunks;
+    int i;
+
+    if (len < 12)
+        return 0;
+
+    xfer = (int)fnp_group_u16(data, 0);
+    members = fnp_group_u32(data, 2);
+    size_words = fnp_group_u32(data, 6);
+    path_len = (int)fnp_group_u16(data, 10);
+
+    if (members != 0 &&
+        (board_id < 1 || board_id > 32 ||
+         ((members >> (board_id - 1)) & 1) == 0))
+        return 0;
+
+    /* Repeated START (some member missed it): just report again. */
+    if (xfer == rx->xfer && rx->state != FNP_GROUP_IDLE)
+        return fnp_group_rx_status(rx, reply);
+
+    fnp_group_reset(rx);
+    rx->xfer = xfer;
+
+    chunks = (int)((size_words * 4 + FNP_GROUP_CHUNK_SIZE - 1)
+                   / FNP_GROUP_CHUNK_SIZE);
+    if (path_len <= 0 || path_len > 127 || 12 + path_len > len ||
+        chunks > FNP_GROUP_MAX_CHUNKS)
+    {
+        rx->state = FNP_GROUP_FAILED;
+        return fnp_group_rx_status(rx, reply);
+    }
+
+    for (i = 0; i < path_len; i++)
+        rx->path[i] = data[12 + i];
+    rx->path[i] = '\0';
+
+    if (rx->io->open(rx->path, size_words * 4, rx->io->ctx) < 0)
+    {
+        rx->state = FNP_GROUP_FAILED;
+        return fnp_group_rx_status(rx, reply);
+    }
+
+    rx->size_words = size_words;
+    rx->chunks = chunks;
+    rx->state = FNP_GROUP_RECEIVING;
+    return fnp_group_rx_status(rx, reply);
+}
+
+int fnp_group_rx_data(struct fnp_group_rx *rx, const char *data, int len)
+{
+    int chunk;
+    unsigned int offset;
+    int expect;
+    int i;
+
+    if (len < 4 || rx->state != FNP_GROUP_RECEIVING)
+        return 0;
+    if ((int)fnp_group_u16(data, 0) != rx->xfer)
+        return 0;
+
+    chunk = (int)fnp_group_u16(data, 2);
+    if (chunk >= rx->chunks || fnp_group_have(rx, chunk))
+        return 0;
+
+    offset = (unsigned int)chunk * FNP_GROUP_CHUNK_SIZE;
+    expect = (int)(rx->size_words * 4 - offset);
+    if (expect > FNP_GROUP_CHUNK_SIZE)
+        expect = FNP_GROUP_CHUNK_SIZE;
+    if (len - 4 != expect)
+        return 0;
+
+    if (rx->io->write(offset, data + 4, expect, rx->io->ctx) < 0)
+        return 0;
+
+    for (i = 0; i < expect; i += 4)
+        rx->checksum = rx->checksum + fnp_group_u32(data, 4 + i);
+    rx->bitmap[chunk >> 5] |= 1u << (chunk & 31);
+    rx->received++;
+    return 1;
+}
+
+int fnp_group_rx_poll(struct fnp_group_rx *rx, const char *data, int len,
+                      char *reply)
+{
+    int xfer;
+
+    if (len < 6)
+        return 0;
+
+    xfer = (int)fnp_group_u16(data, 0);
+    if (xfer != rx->xfer || rx->state == FNP_GROUP_IDLE)
+    {
+        /* Missed the START: tell the sender so it can repeat it. */
+        fnp_group_put16(reply, 0, (unsigned int)xfer);
+        reply[2] = (char)FNP_GROUP_UNKNOWN;
+        reply[3] = 0;
+        fnp_group_put16(reply, 4, 0);
+        return 6;
+    }
+
+    if (rx->state == FNP_GROUP_RECEIVING && rx->received == rx->chunks)
+    {
+        if (rx->checksum == fnp_group_u32(data, 2))
+        {
+            rx->io->close(1, rx->io->ctx);
+            rx->state = FNP_GROUP_DONE;
+        }
+        else
+        {
+            rx->io->close(0, rx->io->ctx);
+            rx->state = FNP_GROUP_FAILED;
+        }
+    }
+
+    return fnp_group_rx_status(rx, reply);
+}
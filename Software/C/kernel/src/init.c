@@ -1,7 +1,7 @@
 /*
  * init.c — BDOS v4 hardware initialization and boot sequence.
  *
- * Boot order: GPU → terminal → timers → UART → Ethernet → USB →
+ * Boot order: GPU → terminal → timers → DMA → UART → Ethernet → USB →
  *   memory allocator → process table → VFS + devices → filesystems
  */
 #include "kernel.h"
@@ -45,6 +45,10 @@ void kernel_init(void)
     timer_init();
     kernel_log("  timers ok\n");
 
+    /* DMA request queue (IRQ 7 driven) */
+    dma_svc_init();
+    kernel_log("  dma ok\n");
+
     /* UART */
     uart_init();
     kernel_log("  uart ok\n");
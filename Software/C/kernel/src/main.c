@@ -75,7 +75,7 @@ void interrupt(void)
         /* Timer 0: deferred ENC28J60 ISR retry OR scheduler tick */
         if (net_isr_deferred)
         {
-            if (enc28j60_spi_in_use)
+            if (enc28j60_spi_in_use || dma_queue_locked())
             {
                 timer_set(TIMER_0, 1);
                 timer_start(TIMER_0);
@@ -102,8 +102,9 @@ void interrupt(void)
         break;
 
     case FPGC_INTID_ETH:
-        /* ENC28J60 RX interrupt */
-        if (enc28j60_spi_in_use)
+        /* ENC28J60 RX interrupt. The drain submits DMA requests, so it
+         * must also wait while main code is editing the DMA queue. */
+        if (enc28j60_spi_in_use || dma_queue_locked())
         {
             net_isr_deferred = 1;
             timer_set(TIMER_0, 1);
@@ -116,7 +117,8 @@ void interrupt(void)
         break;
 
     case FPGC_INTID_DMA:
-        /* DMA complete — could signal waiting processes */
+        /* DMA complete: retire the transfer, start the next queued one */
+        dma_isr();
         break;
 
     default:
@@ -40,7 +40,7 @@ void proc_init(void)
             proc_table[i].fds[j] = -1;
         for (j = 0; j < 16; j++)
             proc_table[i].saved_regs[j] = 0;
-        for (j = 0; j < 256; j++)
+        for (j = 0; j < PROC_HW_STACK; j++)
             proc_table[i].saved_hw_stack[j] = 0;
         for (j = 0; j < 16; j++)
             proc_table[i].argv[j] = (char *)0;
@@ -267,7 +267,7 @@ int proc_spawn(const char *path, int argc, char **argv)
     /* Clear HW stack */
     {
         int j;
-        for (j = 0; j < 256; j++)
+        for (j = 0; j < PROC_HW_STACK; j++)
             p->saved_hw_stack[j] = 0;
     }
 
@@ -359,6 +359,9 @@ void proc_exit(int code)
         net_ringbuf_reset();
     }
 
+    /* Drop any outstanding DMA handles */
+    dma_svc_proc_exit(p->pid);
+
     /* Free memory */
     if (p->mem_base)
     {
@@ -93,6 +93,7 @@ int syscall_dispatch(int num, int a1, int a2, int a3)
                 kp->fds[ki] = -1;
             }
         }
+        dma_svc_proc_exit(kp->pid);
         if (kp->mem_base)
         {
             mem_free_region(kp->mem_base, kp->mem_size);
@@ -338,6 +339,14 @@ int syscall_dispatch(int num, int a1, int a2, int a3)
         return vfs_ioctl(gfd, a2, a3);
     }
 
+    /* ---- DMA (70-71) ---- */
+
+    case SYS_DMA_SUBMIT: /* 70 — dma_submit(desc): queue a transfer, returns handle */
+        return dma_svc_submit((const unsigned int *)a1);
+
+    case SYS_DMA_WAIT:   /* 71 — dma_wait(handle, flags): collect or block */
+        return dma_svc_wait(a1, a2);
+
     default:
         return -1;
     }
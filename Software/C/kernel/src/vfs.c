@@ -351,6 +351,7 @@ int vfs_readdir(const char *path, void *buf, int max)
         if (count < max) vfs_synth_file(&entries[count++], "meminfo");
         if (count < max) vfs_synth_file(&entries[count++], "ps");
         if (count < max) vfs_synth_file(&entries[count++], "df");
+        if (count < max) vfs_synth_file(&entries[count++], "dma");
         return count;
     }
 
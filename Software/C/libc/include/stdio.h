@@ -71,6 +71,14 @@ int   feof(FILE *stream);
 int   ferror(FILE *stream);
 void  clearerr(FILE *stream);
 
+/* Memory streams */
+FILE *fmemopen(void *buf, size_t size, const char *mode);
+FILE *open_memstream(char **bufp, size_t *sizep);
+
+/* Exchange the state of two streams, e.g. to point stdout at a memory
+ * stream and back (nonstandard). */
+void  __stdio_swap(FILE *a, FILE *b);
+
 /* Formatted input (basic) */
 int sscanf(const char *str, const char *format, ...);
 
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdarg.h>
 #include <string.h>
 #include <stdint.h>
@@ -370,8 +371,14 @@ sprintf(char *str, const char *fmt, ...)
 /* Internal FILE structure */
 struct __stdio_file {
     int fd;          /* underlying file descriptor (BDOS pre-opens 0/1/2) */
-    int flags;       /* SRD, SWR, SERR, SEOF */
+    int flags;       /* SRD, SWR, SERR, SEOF, SMEM, SOWN */
     int ungetc_buf;  /* ungetc buffer (-1 = empty) */
+    char *mem;       /* memory streams: buffer, mcap bytes */
+    size_t mpos;     /* read/write position */
+    size_t mlen;     /* bytes of data in mem */
+    size_t mcap;
+    char **mbufp;    /* open_memstream: where the buffer and size go */
+    size_t *msizep;
 };
 
 /* The kernel pre-opens fds 0/1/2 for every process. */
@@ -383,6 +390,8 @@ struct __stdio_file {
 #define STDIO_SWR  0x02
 #define STDIO_SERR 0x04
 #define STDIO_SEOF 0x08
+#define STDIO_SMEM 0x10  /* memory stream, fd unused */
+#define STDIO_SOWN 0x20  /* mem was allocated by fmemopen */
 
 /* Global FILE structs — accessed via macros in stdio.h.
  * NOT static, so the header's extern declarations work. */
@@ -397,6 +406,74 @@ extern int _open(const char *path, int flags);
 extern int _close(int fd);
 extern int _lseek(int fd, int offset, int whence);
 
+/*------------------------------------------------------------------------
+ * Memory streams: reads and writes go to stream->mem instead of a file.
+ * open_memstream grows its buffer and keeps it NUL terminated.
+ *----------------------------------------------------------------------*/
+static int
+mem_write(FILE *stream, const char *buf, int len)
+{
+    size_t need = stream->mpos + (size_t)len + 1;
+    size_t cap;
+    char *p;
+
+    if (need > stream->mcap) {
+        if (!stream->mbufp) {
+            /* fmemopen: the buffer has a fixed size */
+            if (stream->mpos >= stream->mcap)
+                return 0;
+            len = (int)(stream->mcap - stream->mpos);
+        } else {
+            cap = stream->mcap * 2;
+            if (cap < need)
+                cap = need;
+            p = (char *)realloc(stream->mem, cap);
+            if (!p)
+                return 0;
+            stream->mem = p;
+            stream->mcap = cap;
+        }
+    }
+    memcpy(stream->mem + stream->mpos, buf, (size_t)len);
+    stream->mpos += (size_t)len;
+    if (stream->mpos > stream->mlen)
+        stream->mlen = stream->mpos;
+    if (stream->mbufp) {
+        stream->mem[stream->mlen] = '\0';
+        *stream->mbufp = stream->mem;
+        *stream->msizep = stream->mpos;
+    }
+    return len;
+}
+
+static int
+mem_read(FILE *stream, char *buf, int len)
+{
+    size_t avail = stream->mlen - stream->mpos;
+
+    if ((size_t)len > avail)
+        len = (int)avail;
+    memcpy(buf, stream->mem + stream->mpos, (size_t)len);
+    stream->mpos += (size_t)len;
+    return len;
+}
+
+static int
+stream_write(FILE *stream, const char *buf, int len)
+{
+    if (stream->flags & STDIO_SMEM)
+        return mem_write(stream, buf, len);
+    return _write(stream->fd, buf, len);
+}
+
+static int
+stream_read(FILE *stream, char *buf, int len)
+{
+    if (stream->flags & STDIO_SMEM)
+        return mem_read(stream, buf, len);
+    return _read(stream->fd, buf, len);
+}
+
 /*------------------------------------------------------------------------
  * fputc / putchar
  *----------------------------------------------------------------------*/
@@ -404,7 +481,7 @@ int
 fputc(int c, FILE *stream)
 {
     char ch = (char)c;
-    if (_write(stream->fd, &ch, 1) != 1) {
+    if (stream_write(stream, &ch, 1) != 1) {
         stream->flags |= STDIO_SERR;
         return EOF;
     }
@@ -430,7 +507,7 @@ int
 fputs(const char *s, FILE *stream)
 {
     int len = (int)strlen(s);
-    if (_write(stream->fd, s, len) != len) {
+    if (stream_write(stream, s, len) != len) {
         stream->flags |= STDIO_SERR;
         return EOF;
     }
@@ -457,6 +534,13 @@ fgetc(FILE *stream)
         stream->ungetc_buf = -1;
         return ch;
     }
+    if (stream->flags & STDIO_SMEM) {
+        if (stream->mpos >= stream->mlen) {
+            stream->flags |= STDIO_SEOF;
+            return EOF;
+        }
+        return (unsigned char)stream->mem[stream->mpos++];
+    }
     if (_read(stream->fd, &c, 1) != 1) {
         stream->flags |= STDIO_SEOF;
         return EOF;
@@ -490,7 +574,7 @@ fread(void *ptr, size_t size, size_t nmemb, FILE *stream)
     int n;
     if (total == 0)
         return 0;
-    n = _read(stream->fd, (char *)ptr, (int)total);
+    n = stream_read(stream, (char *)ptr, (int)total);
     if (n <= 0) {
         stream->flags |= STDIO_SEOF;
         return 0;
@@ -505,7 +589,7 @@ fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream)
     int n;
     if (total == 0)
         return 0;
-    n = _write(stream->fd, (const char *)ptr, (int)total);
+    n = stream_write(stream, (const char *)ptr, (int)total);
     if (n <= 0) {
         stream->flags |= STDIO_SERR;
         return 0;
@@ -522,12 +606,31 @@ fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream)
 static struct __stdio_file file_pool[STDIO_MAX_FILES];
 static int file_pool_used[STDIO_MAX_FILES];
 
+/* Take a free pool slot, cleared, or NULL if all are in use. */
+static FILE *
+file_alloc(int fd, int flags)
+{
+    int i;
+
+    for (i = 0; i < STDIO_MAX_FILES; i++) {
+        if (!file_pool_used[i]) {
+            file_pool_used[i] = 1;
+            memset(&file_pool[i], 0, sizeof(file_pool[i]));
+            file_pool[i].fd = fd;
+            file_pool[i].flags = flags;
+            file_pool[i].ungetc_buf = -1;
+            return &file_pool[i];
+        }
+    }
+    return NULL;
+}
+
 FILE *
 fopen(const char *path, const char *mode)
 {
     int flags = 0;
     int fd;
-    int i;
+    FILE *f;
 
     if (mode[0] == 'r')      flags = STDIO_SRD;
     else if (mode[0] == 'w') flags = STDIO_SWR;
@@ -538,18 +641,77 @@ fopen(const char *path, const char *mode)
     if (fd < 0)
         return NULL;
 
-    /* Find a free pool slot */
-    for (i = 0; i < STDIO_MAX_FILES; i++) {
-        if (!file_pool_used[i]) {
-            file_pool_used[i] = 1;
-            file_pool[i].fd = fd;
-            file_pool[i].flags = flags;
-            file_pool[i].ungetc_buf = -1;
-            return &file_pool[i];
+    f = file_alloc(fd, flags);
+    if (!f)
+        _close(fd);
+    return f;
+}
+
+/* Stream over the size bytes of buf: mode "r" reads them, "w" writes
+ * from the start. A NULL buf gets a zeroed buffer of its own.
+ */
+FILE *
+fmemopen(void *buf, size_t size, const char *mode)
+{
+    int flags;
+    FILE *f;
+
+    if (mode[0] == 'r')      flags = STDIO_SRD;
+    else if (mode[0] == 'w') flags = STDIO_SWR;
+    else return NULL;
+
+    f = file_alloc(-1, flags | STDIO_SMEM);
+    if (!f)
+        return NULL;
+    if (!buf) {
+        buf = calloc(1, size ? size : 1);
+        if (!buf) {
+            fclose(f);
+            return NULL;
         }
+        f->flags |= STDIO_SOWN;
     }
-    _close(fd);
-    return NULL;
+    f->mem = (char *)buf;
+    f->mcap = size;
+    if (flags == STDIO_SRD)
+        f->mlen = size;
+    return f;
+}
+
+/* Write-only stream into a buffer that grows as needed. *bufp and *sizep
+ * always hold the buffer (NUL terminated) and the bytes written; the
+ * caller frees *bufp after fclose.
+ */
+FILE *
+open_memstream(char **bufp, size_t *sizep)
+{
+    FILE *f;
+
+    f = file_alloc(-1, STDIO_SWR | STDIO_SMEM);
+    if (!f)
+        return NULL;
+    f->mcap = 256;
+    f->mem = (char *)malloc(f->mcap);
+    if (!f->mem) {
+        fclose(f);
+        return NULL;
+    }
+    f->mem[0] = '\0';
+    f->mbufp = bufp;
+    f->msizep = sizep;
+    *bufp = f->mem;
+    *sizep = 0;
+    return f;
+}
+
+void
+__stdio_swap(FILE *a, FILE *b)
+{
+    struct __stdio_file t;
+
+    t = *a;
+    *a = *b;
+    *b = t;
 }
 
 int
@@ -562,7 +724,10 @@ fclose(FILE *stream)
         return EOF;
 
     /* Don't close the kernel-owned standard streams. */
-    if (stream != stdin && stream != stdout && stream != stderr)
+    if (stream->flags & STDIO_SMEM) {
+        if (stream->flags & STDIO_SOWN)
+            free(stream->mem);
+    } else if (stream != stdin && stream != stdout && stream != stderr)
         ret = _close(stream->fd);
 
     /* Return slot to pool */
@@ -614,12 +779,25 @@ fflush(FILE *stream)
 int
 fseek(FILE *stream, long offset, int whence)
 {
+    if (stream->flags & STDIO_SMEM) {
+        if (whence == SEEK_CUR)
+            offset += (long)stream->mpos;
+        else if (whence == SEEK_END)
+            offset += (long)stream->mlen;
+        if (offset < 0 || (size_t)offset > stream->mlen)
+            return -1;
+        stream->mpos = (size_t)offset;
+        stream->flags &= ~STDIO_SEOF;
+        return 0;
+    }
     return _lseek(stream->fd, (int)offset, whence);
 }
 
 long
 ftell(FILE *stream)
 {
+    if (stream->flags & STDIO_SMEM)
+        return (long)stream->mpos;
     return (long)_lseek(stream->fd, 0, SEEK_CUR);
 }
 
@@ -747,7 +925,8 @@ _closeall(void)
     /* Close any file pool entries */
     for (i = 0; i < STDIO_MAX_FILES; i++) {
         if (file_pool_used[i]) {
-            _close(file_pool[i].fd);
+            if (!(file_pool[i].flags & STDIO_SMEM))
+                _close(file_pool[i].fd);
             file_pool_used[i] = 0;
         }
     }
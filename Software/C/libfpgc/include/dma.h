@@ -7,8 +7,12 @@
  * Supports memory-to-memory copies, SPI<->memory bursts (SPI0, SPI1,
  * SPI4, SPI5), QSPI Fast Read from SPI1, and memory-to-VRAMPX blits.
  *
- * All transfers must be 32-byte (cache-line) aligned in both the
- * memory addresses they touch and the byte count.
+ * Addresses and byte counts are byte-granular in every mode (count must
+ * be > 0). MEM2MEM copies with src, dst and count all 32-byte aligned
+ * run a line per SDRAM access; anything else is shifted a byte per
+ * cycle. Partial destination lines are read-modify-written by the
+ * engine, so the CPU must not store to the first or last line of a
+ * destination buffer while a transfer into it is running.
  *
  * Coherency: dma_copy() and dma_blit_to_vram() flush/invalidate the
  * L1 data cache around the transfer with the `ccached` instruction,
@@ -31,8 +35,8 @@ typedef enum {
 /*
  * Synchronous memory-to-memory DMA copy.
  *
- *   src, dst, count must each be a multiple of 32. Returns 0 on success
- *   and -1 on engine error (alignment violation, unsupported mode, etc.).
+ *   Any src, dst and count > 0; line-aligned copies are fastest. Returns
+ *   0 on success and -1 on engine error (count == 0, unsupported mode).
  *
  * Wraps the transfer with cache_flush_data() before and after so the L1d
  * sees consistent data on either side.
@@ -49,9 +53,9 @@ void dma_start_mem2mem(unsigned int dst, unsigned int src, unsigned int count);
 /*
  * Synchronous SDRAM-to-VRAMPX blit.
  *
- *   src must be 32-byte aligned in SDRAM, dst must be 32-byte aligned and
- *   lie in the VRAMPX byte range (0x1EC00000 .. 0x1EC20000), and count
- *   must be a multiple of 32. Returns 0 on success and -1 on engine error.
+ *   src is any SDRAM byte address and [dst, dst + count) must lie in the
+ *   VRAMPX byte range (0x1EC00000 .. 0x1EC20000). Returns 0 on success
+ *   and -1 on engine error.
  *
  * Flushes the L1 data cache before the transfer so the engine reads the
  * latest source bytes; VRAMPX is write-only from the CPU side so no
@@ -69,12 +73,12 @@ void dma_start_mem2vram(unsigned int dst, unsigned int src, unsigned int count);
  * Asynchronous SPI<->memory burst on the given SPI controller (0 or 4).
  * The mode argument selects direction: DMA_SPI2MEM or DMA_MEM2SPI.
  *
- *   - For SPI2MEM, `dst` is the SDRAM destination (32-byte aligned) and
+ *   - For SPI2MEM, `dst` is the SDRAM destination (any address) and
  *     `src` is ignored. `count` bytes are read from the SPI peripheral
  *     into SDRAM. The caller is responsible for issuing the read command
  *     and 24-bit address before calling, and for holding CS low across
  *     the call.
- *   - For MEM2SPI, `src` is the SDRAM source (32-byte aligned) and `dst`
+ *   - For MEM2SPI, `src` is the SDRAM source (any address) and `dst`
  *     is ignored. `count` bytes are pushed out to the SPI peripheral.
  *     The caller is responsible for issuing the page-program command
  *     and address before calling, and for holding CS low across the call.
@@ -90,14 +94,25 @@ void dma_start_spi(dma_mode_t mode, int spi_id, unsigned int dst,
  * The DMA engine drives QSPIflash to issue opcode 0xEB + 24-bit
  * `qspi_addr` + M=0xA5 + 4 dummy SCK + read of `count` bytes (4 bits
  * per SCK). The caller is responsible for asserting CS low before this
- * call and CS high after `dma_busy()` returns 0. `dst` must be 32-byte
- * aligned in SDRAM and `count` must be a multiple of 32.
+ * call and CS high after `dma_busy()` returns 0. `dst` and `count` are
+ * byte-granular.
  *
  * No cache flushing is performed; callers should ccached as needed.
  */
 void dma_start_spi_qspi_read(int spi_id, unsigned int dst,
                              unsigned int qspi_addr, unsigned int count);
 
+/*
+ * Synchronous SPI burst through the request queue. `mem` is the SDRAM
+ * buffer (source for DMA_MEM2SPI, destination for DMA_SPI2MEM and
+ * DMA_SPI2MEM_QSPI); `qspi_addr` is only used by DMA_SPI2MEM_QSPI.
+ * The caller holds CS low across the call, exactly as for
+ * dma_start_spi(). Cache maintenance is done here. Returns 0 on
+ * success, -1 on engine error.
+ */
+int dma_spi_burst(dma_mode_t mode, int spi_id, unsigned int mem,
+                  unsigned int count, unsigned int qspi_addr);
+
 /* Returns non-zero while the engine is busy. */
 int dma_busy(void);
 
@@ -113,4 +128,183 @@ unsigned int dma_status(void);
  */
 void cache_flush_data(void);
 
+/*
+ * Raw start: program SRC/DST/COUNT (and QSPI_ADDR for SPI2MEM_QSPI)
+ * and write `ctrl` to DMA_CTRL. `ctrl` must already contain the mode,
+ * SPI id, IRQ_EN and START bits. With FPGC_DMA_CTRL_CHAIN set, `src`
+ * is the head descriptor instead and only DMA_DESC is programmed.
+ * Used by the request queue below.
+ */
+void dma_start_ctrl(unsigned int ctrl, unsigned int dst, unsigned int src,
+                    unsigned int count, unsigned int qspi_addr);
+
+/* ------------------------------------------------------------------ */
+/* Descriptor chains                                                   */
+/* ------------------------------------------------------------------ */
+
+/*
+ * With DMA_CTRL.CHAIN the engine fetches descriptors from SDRAM and runs
+ * them back-to-back without CPU involvement. A descriptor is exactly one
+ * cache line and must be 32-byte aligned; the engine reads it straight
+ * from SDRAM, so flush the L1 data cache after filling it in (requests
+ * with DMA_REQ_FLUSH_BEFORE do this). Each descriptor, and each row of a
+ * 2D descriptor, is checked like a single transfer; strides may be any
+ * byte count.
+ *
+ * 2D descriptors move `rows` rows of `count` bytes, advancing the source
+ * by src_stride and the destination by dst_stride (both < 65536) after
+ * each row. Only DMA_MEM2MEM and DMA_MEM2VRAM support 2D.
+ */
+
+#define DMA_DESC_IRQ    FPGC_DMA_DESC_IRQ   /* IRQ after this descriptor */
+#define DMA_DESC_2D     FPGC_DMA_DESC_2D
+
+typedef struct dma_desc dma_desc_t;
+
+struct dma_desc {
+    unsigned int src;
+    unsigned int dst;
+    unsigned int count;       /* bytes (per row for 2D) */
+    unsigned int ctrl;        /* mode | spi_id << 5 | DMA_DESC_* */
+    dma_desc_t  *next;        /* 0 ends the list */
+    unsigned int qspi_addr;   /* DMA_SPI2MEM_QSPI only */
+    unsigned int rows;        /* 2D only */
+    unsigned int stride;      /* 2D only: dst_stride << 16 | src_stride */
+};
+
+/* Fill in a 1D descriptor with no link and no IRQ. */
+void dma_desc_init(dma_desc_t *desc, dma_mode_t mode, unsigned int dst,
+                   unsigned int src, unsigned int count);
+
+/* Turn `desc` into a 2D descriptor of `rows` rows. */
+void dma_desc_set_2d(dma_desc_t *desc, unsigned int rows,
+                     unsigned int src_stride, unsigned int dst_stride);
+
+/*
+ * Synchronous 2D SDRAM-to-VRAMPX blit of `rows` rows of `width` bytes,
+ * through the request queue as a one-descriptor chain. Every row must
+ * satisfy the dma_blit_to_vram() range rule. Returns 0 or -1.
+ */
+int dma_blit_rect(unsigned int dst, unsigned int src, unsigned int width,
+                  unsigned int rows, unsigned int src_stride,
+                  unsigned int dst_stride);
+
+/* ------------------------------------------------------------------ */
+/* Request queue (dma_queue.c)                                         */
+/* ------------------------------------------------------------------ */
+
+/*
+ * The engine has a single channel. Every user inside the kernel (SD,
+ * SPI flash, ENC28J60, and user programs via SYS_DMA_SUBMIT) goes
+ * through one FIFO of caller-owned descriptors so transfers never
+ * clobber each other's registers. When the active transfer completes
+ * (IRQ 7 or a poll from dma_wait()), the next queued descriptor is
+ * started immediately, before the completion callback runs, so
+ * back-to-back requests keep the engine busy.
+ *
+ * Descriptors are owned by the caller and must stay valid until the
+ * request completes. No allocation is done by the queue.
+ */
+
+#define DMA_MODE_COUNT      7
+
+/* dma_req_t.state */
+#define DMA_REQ_IDLE        0
+#define DMA_REQ_QUEUED      1
+#define DMA_REQ_ACTIVE      2
+#define DMA_REQ_DONE        3
+#define DMA_REQ_ERROR       4
+
+/* dma_req_t.flags */
+#define DMA_REQ_FLUSH_BEFORE (1u << 0)  /* ccached before start (CPU wrote src) */
+#define DMA_REQ_FLUSH_AFTER  (1u << 1)  /* ccached after done (CPU reads dst)  */
+#define DMA_REQ_CHAIN        (1u << 2)  /* src is a dma_desc_t chain head     */
+
+typedef struct dma_req dma_req_t;
+
+/* Completion callback. Runs from IRQ 7 or from dma_wait(), so it must
+ * be short and must not submit or wait on other requests. */
+typedef void (*dma_done_fn)(dma_req_t *req);
+
+/*
+ * For DMA_REQ_CHAIN requests the engine takes everything from the
+ * descriptors; `mode` and `count` are only used for the statistics.
+ */
+struct dma_req {
+    unsigned int src;
+    unsigned int dst;
+    unsigned int count;       /* bytes, multiple of 32 */
+    dma_mode_t   mode;
+    int          spi_id;      /* SPI modes only */
+    unsigned int qspi_addr;   /* DMA_SPI2MEM_QSPI only */
+    unsigned int flags;       /* DMA_REQ_FLUSH_* */
+    dma_done_fn  done;        /* optional completion callback */
+    void        *ctx;         /* opaque pointer for the callback */
+    int          state;       /* DMA_REQ_* */
+    unsigned int status;      /* DMA_STATUS value seen at completion */
+    dma_req_t   *next;
+};
+
+typedef struct {
+    unsigned int requests;
+    unsigned int bytes;
+    unsigned int errors;
+} dma_mode_stats_t;
+
+typedef struct {
+    dma_mode_stats_t mode[DMA_MODE_COUNT];
+    unsigned int irqs;        /* IRQ 7 deliveries */
+    unsigned int chained;     /* transfers started directly from a completion */
+    unsigned int max_depth;   /* high-water mark of queued + active */
+} dma_queue_stats_t;
+
+/*
+ * Initialise the queue. With use_irq != 0 every transfer is started
+ * with DMA_CTRL.IRQ_EN so dma_isr() advances the queue; otherwise the
+ * queue only advances from dma_wait() / dma_queue_poll().
+ */
+void dma_queue_init(int use_irq);
+
+/* Fill in a descriptor with defaults (no SPI, no flags, no callback). */
+void dma_req_init(dma_req_t *req, dma_mode_t mode, unsigned int dst,
+                  unsigned int src, unsigned int count);
+
+/* Non-blocking submit. Returns 0, or -1 if `req` is already in flight. */
+int dma_submit(dma_req_t *req);
+
+/*
+ * Block until `req` completes. Polls the engine itself, so it is safe
+ * to call from interrupt context. Returns 0 on success, -1 on engine
+ * error or if `req` was never submitted.
+ */
+int dma_wait(dma_req_t *req);
+
+/* dma_submit() + dma_wait(). */
+int dma_submit_wait(dma_req_t *req);
+
+/* Non-zero while `req` is queued or active. */
+int dma_req_pending(const dma_req_t *req);
+
+/* IRQ 7 handler. Called from the kernel interrupt dispatcher. */
+void dma_isr(void);
+
+/* Retire the active transfer if the engine went idle (polling mode). */
+void dma_queue_poll(void);
+
+/* Number of requests queued or active. */
+int dma_queue_depth(void);
+
+/*
+ * Queue lock. While held, dma_isr() defers its work to the matching
+ * dma_queue_unlock(). Use it around check-then-act sequences on a
+ * request that a completion may race with. Interrupt handlers that
+ * submit requests must not run while dma_queue_locked() is set.
+ */
+void dma_queue_lock(void);
+void dma_queue_unlock(void);
+int  dma_queue_locked(void);
+
+/* Cumulative statistics (exported through /proc/dma). */
+const dma_queue_stats_t *dma_queue_get_stats(void);
+
 #endif /* FPGC_DMA_H */
@@ -1,6 +1,6 @@
 /*
  * FPGC hardware definitions — the single source of truth for:
- *   - MMIO register addresses (0x1C000000–0x1C000084)
+ *   - MMIO register addresses (0x1C000000–0x1C00008C)
  *   - DMA mode constants and status bits
  *   - SPI bus identifiers (0–5)
  *   - GPU VRAM addresses and screen constants
@@ -70,6 +70,8 @@
 #define FPGC_DMA_CTRL       0x1C00007C
 #define FPGC_DMA_STATUS     0x1C000080
 #define FPGC_DMA_QSPI_ADDR  0x1C000084
+#define FPGC_DMA_DESC       0x1C000088
+#define FPGC_DMA_DESC_CUR   0x1C00008C
 
 /* DMA_CTRL bit fields */
 #define FPGC_DMA_MODE_MEM2MEM   0
@@ -81,12 +83,18 @@
 #define FPGC_DMA_MODE_SPI2MEM_QSPI 6
 #define FPGC_DMA_CTRL_IRQ_EN    (1u << 4)
 #define FPGC_DMA_CTRL_SPI_SHIFT 5
+#define FPGC_DMA_CTRL_CHAIN     (1u << 8)
 #define FPGC_DMA_CTRL_START     (1u << 31)
 
+/* Descriptor ctrl word (w3) bit fields; mode and SPI id as in DMA_CTRL */
+#define FPGC_DMA_DESC_IRQ       (1u << 4)
+#define FPGC_DMA_DESC_2D        (1u << 8)
+
 /* DMA_STATUS bits (sticky bits cleared on read) */
 #define FPGC_DMA_STATUS_BUSY    (1u << 0)
 #define FPGC_DMA_STATUS_DONE    (1u << 1)
 #define FPGC_DMA_STATUS_ERROR   (1u << 2)
+#define FPGC_DMA_STATUS_DESC    (1u << 3)
 
 /* Interrupt system */
 #define FPGC_PC_BACKUP      0x1F000000
@@ -2,7 +2,8 @@
  * DMA engine driver
  *
  * Registers: FPGC_DMA_SRC (0x70), DST (0x74), COUNT (0x78),
- *            CTRL (0x7C), STATUS (0x80), QSPI_ADDR (0x84)
+ *            CTRL (0x7C), STATUS (0x80), QSPI_ADDR (0x84),
+ *            DESC (0x88), DESC_CUR (0x8C)
  * Interrupt: INTID_DMA (7) when IRQ_EN bit is set
  *
  * 7 transfer modes:
@@ -17,7 +18,13 @@
  *   dma_start_spi2mem(dst, spi, count)       -> void
  *   dma_start_mem2spi(spi, src, count)       -> void
  *   dma_start_spi2mem_qspi(dst, spi, count, flash_addr) -> void
- *   dma_transfer_blocking(...)               -> void
+ *   dma_start_ctrl(ctrl, dst, src, count, qspi_addr) -> void
+ *   dma_spi_burst(mode, spi, mem, count, qspi_addr)  -> int (0/-1)
+ *   dma_desc_init(desc, mode, dst, src, count)       -> void
+ *   dma_desc_set_2d(desc, rows, src_stride, dst_stride) -> void
+ *   dma_blit_rect(dst, src, width, rows, src_stride, dst_stride) -> int
+ *
+ * The request queue (dma_submit/dma_wait/dma_isr) lives in dma_queue.c.
  *
  * Count is in WORDS (4 bytes each). Addresses must be word-aligned.
  * Dependencies: fpgc.h
@@ -87,57 +94,114 @@ dma_start_spi_qspi_read(int spi_id, unsigned int dst,
     __builtin_store(FPGC_DMA_CTRL,      (int)ctrl);
 }
 
-int
-dma_copy(unsigned int dst, unsigned int src, unsigned int count)
+void
+dma_start_ctrl(unsigned int ctrl, unsigned int dst, unsigned int src,
+               unsigned int count, unsigned int qspi_addr)
 {
-    unsigned int status;
+    if (ctrl & FPGC_DMA_CTRL_CHAIN) {
+        /* SRC/DST/COUNT are loaded from the descriptors. */
+        __builtin_store(FPGC_DMA_DESC, (int)src);
+        __builtin_store(FPGC_DMA_CTRL, (int)ctrl);
+        return;
+    }
 
-    /* Push any dirty L1d lines back to SDRAM so the engine reads fresh data. */
-    cache_flush_data();
+    if ((ctrl & 0xFu) == (unsigned int)FPGC_DMA_MODE_SPI2MEM_QSPI)
+        __builtin_store(FPGC_DMA_QSPI_ADDR, (int)(qspi_addr & 0xFFFFFFu));
+    else
+        __builtin_store(FPGC_DMA_SRC, (int)src);
+    __builtin_store(FPGC_DMA_DST,   (int)dst);
+    __builtin_store(FPGC_DMA_COUNT, (int)count);
+    __builtin_store(FPGC_DMA_CTRL,  (int)ctrl);
+}
 
-    dma_start_mem2mem(dst, src, count);
+int
+dma_copy(unsigned int dst, unsigned int src, unsigned int count)
+{
+    dma_req_t req;
 
     /*
-     * Spin-read STATUS until the engine is no longer busy.
-     *
-     * We must NOT call dma_busy() followed by dma_status() separately:
-     * the Verilog status_read_pulse clears the sticky done/error bits on
-     * each read, so a dma_busy() read that sees busy=0 would clear the
-     * error flag before dma_status() can observe it. Instead, read STATUS
-     * in the loop and exit with the value that first shows busy=0.
+     * Flush dirty L1d lines so the engine reads fresh data, and
+     * invalidate afterwards so CPU reads see the new SDRAM contents.
+     * Completion (and the single STATUS read that clears the sticky
+     * error bit) is handled by the request queue.
      */
-    do {
-        status = dma_status();
-    } while (status & FPGC_DMA_STATUS_BUSY);
-
-    /* Invalidate L1d so subsequent CPU reads see the new SDRAM contents. */
-    cache_flush_data();
-
-    if (status & FPGC_DMA_STATUS_ERROR) {
-        return -1;
-    }
-    return 0;
+    dma_req_init(&req, DMA_MEM2MEM, dst, src, count);
+    req.flags = DMA_REQ_FLUSH_BEFORE | DMA_REQ_FLUSH_AFTER;
+    return dma_submit_wait(&req);
 }
 
 int
 dma_blit_to_vram(unsigned int dst, unsigned int src, unsigned int count)
 {
-    unsigned int status;
+    dma_req_t req;
 
-    /* Push any dirty L1d lines back to SDRAM so the engine reads fresh data. */
-    cache_flush_data();
+    /* No post-invalidate: VRAMPX is write-only from the CPU side. */
+    dma_req_init(&req, DMA_MEM2VRAM, dst, src, count);
+    req.flags = DMA_REQ_FLUSH_BEFORE;
+    return dma_submit_wait(&req);
+}
 
-    dma_start_mem2vram(dst, src, count);
+int
+dma_spi_burst(dma_mode_t mode, int spi_id, unsigned int mem,
+              unsigned int count, unsigned int qspi_addr)
+{
+    dma_req_t req;
+
+    if (mode == DMA_MEM2SPI)
+        dma_req_init(&req, mode, 0u, mem, count);
+    else
+        dma_req_init(&req, mode, mem, 0u, count);
+    req.spi_id = spi_id;
+    req.qspi_addr = qspi_addr;
+
+    /* CPU may have dirtied the source (MEM2SPI) or hold stale lines of
+     * the destination (SPI2MEM*): flush before, and invalidate after
+     * when the engine wrote SDRAM. */
+    req.flags = DMA_REQ_FLUSH_BEFORE;
+    if (mode != DMA_MEM2SPI)
+        req.flags |= DMA_REQ_FLUSH_AFTER;
+    return dma_submit_wait(&req);
+}
 
-    /* Same single-read loop as dma_copy to avoid losing the error flag. */
-    do {
-        status = dma_status();
-    } while (status & FPGC_DMA_STATUS_BUSY);
+void
+dma_desc_init(dma_desc_t *desc, dma_mode_t mode, unsigned int dst,
+              unsigned int src, unsigned int count)
+{
+    desc->src = src;
+    desc->dst = dst;
+    desc->count = count;
+    desc->ctrl = (unsigned int)mode & 0xFu;
+    desc->next = (dma_desc_t *)0;
+    desc->qspi_addr = 0;
+    desc->rows = 0;
+    desc->stride = 0;
+}
 
-    /* No post-invalidate: VRAMPX is write-only from the CPU side. */
+void
+dma_desc_set_2d(dma_desc_t *desc, unsigned int rows,
+                unsigned int src_stride, unsigned int dst_stride)
+{
+    desc->ctrl |= DMA_DESC_2D;
+    desc->rows = rows & 0xFFFFu;
+    desc->stride = ((dst_stride & 0xFFFFu) << 16) | (src_stride & 0xFFFFu);
+}
 
-    if (status & FPGC_DMA_STATUS_ERROR) {
-        return -1;
-    }
-    return 0;
+int
+dma_blit_rect(unsigned int dst, unsigned int src, unsigned int width,
+              unsigned int rows, unsigned int src_stride,
+              unsigned int dst_stride)
+{
+    unsigned int buf[16];
+    dma_desc_t *desc;
+    dma_req_t req;
+
+    /* The stack is not line aligned; carve an aligned line out of buf. */
+    desc = (dma_desc_t *)(((unsigned int)buf + 31u) & ~31u);
+    dma_desc_init(desc, DMA_MEM2VRAM, dst, src, width);
+    dma_desc_set_2d(desc, rows, src_stride, dst_stride);
+
+    /* FLUSH_BEFORE also pushes the descriptor itself out to SDRAM. */
+    dma_req_init(&req, DMA_MEM2VRAM, dst, (unsigned int)desc, width * rows);
+    req.flags = DMA_REQ_CHAIN | DMA_REQ_FLUSH_BEFORE;
+    return dma_submit_wait(&req);
 }
@@ -0,0 +1,275 @@
+/*
+ * DMA request queue
+ *
+ * Serialises every user of the single DMAengine channel through one
+ * FIFO of caller-owned descriptors (dma_req_t). The head of the list
+ * is the transfer currently running on the engine.
+ *
+ * Completion is detected in exactly one place, dmaq_service(), which
+ * reads DMA_STATUS once (the read clears the sticky done/error bits)
+ * and, if the engine is idle, retires the head and starts the next
+ * descriptor before running the completion callback. It is reached
+ * from IRQ 7 (dma_isr) and from polling waiters (dma_wait), so it is
+ * guarded by dmaq_lock: an IRQ that arrives while main code holds the
+ * lock only sets dmaq_isr_deferred, and the lock holder replays it in
+ * dma_queue_unlock(). This is the same defer-and-replay pattern the
+ * kernel uses for the ENC28J60 ISR.
+ *
+ * Public API (see dma.h):
+ *   dma_queue_init(use_irq)       dma_req_init(req, mode, dst, src, count)
+ *   dma_submit(req)               dma_wait(req)
+ *   dma_submit_wait(req)          dma_req_pending(req)
+ *   dma_isr()                     dma_queue_poll()
+ *   dma_queue_depth()             dma_queue_get_stats()
+ *   dma_queue_lock() / dma_queue_unlock() / dma_queue_locked()
+ *
+ * Dependencies: dma.h, fpgc.h
+ * Build: part of libfpgc (make compile-kernel)
+ */
+#include "dma.h"
+#include "fpgc.h"
+
+static dma_req_t *dmaq_head;
+static dma_req_t *dmaq_tail;
+static int dmaq_depth;
+static int dmaq_use_irq;
+static int dmaq_lock;
+static int dmaq_isr_deferred;
+static dma_queue_stats_t dmaq_stats;
+
+/* Program the engine for `req`. `flushed` is non-zero when the caller
+ * has just executed ccached, so a FLUSH_BEFORE can be skipped. */
+static void
+dmaq_start(dma_req_t *req, int flushed)
+{
+    unsigned int ctrl;
+
+    if ((req->flags & DMA_REQ_FLUSH_BEFORE) && !flushed)
+        cache_flush_data();
+
+    if (req->flags & DMA_REQ_CHAIN)
+        ctrl = FPGC_DMA_CTRL_START | FPGC_DMA_CTRL_CHAIN;
+    else
+        ctrl = FPGC_DMA_CTRL_START
+             | (((unsigned int)req->spi_id & 7u) << FPGC_DMA_CTRL_SPI_SHIFT)
+             | ((unsigned int)req->mode & 0xFu);
+    if (dmaq_use_irq)
+        ctrl |= FPGC_DMA_CTRL_IRQ_EN;
+
+    req->state = DMA_REQ_ACTIVE;
+    dma_start_ctrl(ctrl, req->dst, req->src, req->count, req->qspi_addr);
+}
+
+/* Retire the head if the engine is idle and start the next request.
+ * Must only run with dmaq_lock held or from dma_isr(). */
+static void
+dmaq_service(void)
+{
+    dma_req_t *req;
+    dma_req_t *next;
+    unsigned int status;
+    int flushed;
+    int m;
+
+    req = dmaq_head;
+    if (!req)
+        return;
+
+    status = dma_status();
+    if (status & FPGC_DMA_STATUS_BUSY)
+        return;
+
+    next = req->next;
+    dmaq_head = next;
+    if (!next)
+        dmaq_tail = (dma_req_t *)0;
+    dmaq_depth--;
+
+    flushed = 0;
+    if (req->flags & DMA_REQ_FLUSH_AFTER) {
+        cache_flush_data();
+        flushed = 1;
+    }
+
+    /* Keep the engine busy while the callback runs. */
+    if (next) {
+        dmaq_start(next, flushed);
+        dmaq_stats.chained++;
+    }
+
+    m = (int)req->mode;
+    if (m >= 0 && m < DMA_MODE_COUNT) {
+        dmaq_stats.mode[m].requests++;
+        dmaq_stats.mode[m].bytes += req->count;
+        if (status & FPGC_DMA_STATUS_ERROR)
+            dmaq_stats.mode[m].errors++;
+    }
+
+    req->status = status;
+    req->next = (dma_req_t *)0;
+    req->state = (status & FPGC_DMA_STATUS_ERROR) ? DMA_REQ_ERROR
+                                                  : DMA_REQ_DONE;
+    if (req->done)
+        req->done(req);
+}
+
+void
+dma_queue_lock(void)
+{
+    dmaq_lock = 1;
+}
+
+void
+dma_queue_unlock(void)
+{
+    dmaq_lock = 0;
+
+    /* Replay IRQs that arrived while we held the lock. */
+    while (dmaq_isr_deferred) {
+        dmaq_lock = 1;
+        dmaq_isr_deferred = 0;
+        dmaq_service();
+        dmaq_lock = 0;
+    }
+}
+
+int
+dma_queue_locked(void)
+{
+    return dmaq_lock;
+}
+
+void
+dma_queue_init(int use_irq)
+{
+    int i;
+
+    dmaq_head = (dma_req_t *)0;
+    dmaq_tail = (dma_req_t *)0;
+    dmaq_depth = 0;
+    dmaq_lock = 0;
+    dmaq_isr_deferred = 0;
+    dmaq_use_irq = use_irq;
+
+    for (i = 0; i < DMA_MODE_COUNT; i++) {
+        dmaq_stats.mode[i].requests = 0;
+        dmaq_stats.mode[i].bytes = 0;
+        dmaq_stats.mode[i].errors = 0;
+    }
+    dmaq_stats.irqs = 0;
+    dmaq_stats.chained = 0;
+    dmaq_stats.max_depth = 0;
+}
+
+void
+dma_req_init(dma_req_t *req, dma_mode_t mode, unsigned int dst,
+             unsigned int src, unsigned int count)
+{
+    req->src = src;
+    req->dst = dst;
+    req->count = count;
+    req->mode = mode;
+    req->spi_id = 0;
+    req->qspi_addr = 0;
+    req->flags = 0;
+    req->done = (dma_done_fn)0;
+    req->ctx = (void *)0;
+    req->state = DMA_REQ_IDLE;
+    req->status = 0;
+    req->next = (dma_req_t *)0;
+}
+
+int
+dma_req_pending(const dma_req_t *req)
+{
+    return req->state == DMA_REQ_QUEUED || req->state == DMA_REQ_ACTIVE;
+}
+
+int
+dma_submit(dma_req_t *req)
+{
+    if (dma_req_pending(req))
+        return -1;
+
+    dma_queue_lock();
+
+    req->next = (dma_req_t *)0;
+    req->status = 0;
+    req->state = DMA_REQ_QUEUED;
+
+    if (dmaq_tail)
+        dmaq_tail->next = req;
+    else
+        dmaq_head = req;
+    dmaq_tail = req;
+
+    dmaq_depth++;
+    if ((unsigned int)dmaq_depth > dmaq_stats.max_depth)
+        dmaq_stats.max_depth = (unsigned int)dmaq_depth;
+
+    /* Engine idle: this request becomes the active one right away. */
+    if (dmaq_head == req)
+        dmaq_start(req, 0);
+
+    dma_queue_unlock();
+    return 0;
+}
+
+int
+dma_wait(dma_req_t *req)
+{
+    if (req->state == DMA_REQ_IDLE)
+        return -1;
+
+    /*
+     * Poll rather than sleep on the IRQ: waiters include the ENC28J60
+     * receive path, which runs inside interrupt() where IRQ 7 cannot be
+     * delivered. The IRQ still advances the queue for async submitters.
+     */
+    while (dma_req_pending(req)) {
+        dma_queue_lock();
+        dmaq_service();
+        dma_queue_unlock();
+    }
+
+    return (req->state == DMA_REQ_ERROR) ? -1 : 0;
+}
+
+int
+dma_submit_wait(dma_req_t *req)
+{
+    if (dma_submit(req) != 0)
+        return -1;
+    return dma_wait(req);
+}
+
+void
+dma_isr(void)
+{
+    dmaq_stats.irqs++;
+    if (dmaq_lock) {
+        dmaq_isr_deferred = 1;
+        return;
+    }
+    dmaq_service();
+}
+
+void
+dma_queue_poll(void)
+{
+    dma_queue_lock();
+    dmaq_service();
+    dma_queue_unlock();
+}
+
+int
+dma_queue_depth(void)
+{
+    return dmaq_depth;
+}
+
+const dma_queue_stats_t *
+dma_queue_get_stats(void)
+{
+    return &dmaq_stats;
+}
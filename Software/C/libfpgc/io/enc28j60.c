@@ -120,42 +120,31 @@ static void enc28j60_write_phy(int address, int data)
 /* ---- Buffer Memory Read/Write ---- */
 
 /*
- * Bulk SPI4 buffer transfers use the DMAengine SPI<->mem burst path when
- * possible. The engine requires both the memory address and the byte count
- * to be 32-byte (cache-line) aligned, so we peel off an unaligned head
- * with the per-byte loop, DMA the largest 32-byte-aligned middle, and
- * peel off the tail with the per-byte loop. Buffers handed in by the
- * BDOS FNP layer are 32-byte aligned so the typical case is pure DMA.
+ * Bulk SPI4 buffer transfers use the DMAengine SPI<->mem burst path. The
+ * engine takes any address and length, so a whole packet is one burst.
+ * Short reads (the 6-byte receive status header) stay on the per-byte
+ * loop, where the DMA setup and cache flush would cost more than the
+ * transfer; they may also target the stack, which must not share a line
+ * with an in-flight DMA destination.
  */
+#define ENC28J60_DMA_MIN 32
 
 static void enc28j60_read_buffer(char *buf, int len)
 {
   int i;
-  unsigned int middle;
   spi_select(ENC28J60_SPI_ID);
   spi_transfer(ENC28J60_SPI_ID, ENC_OP_RBM);
-  i = 0;
-  while (i < len && (((unsigned int)(buf + i)) & 31u) != 0u)
+  if (len >= ENC28J60_DMA_MIN)
   {
-    buf[i] = spi_transfer(ENC28J60_SPI_ID, 0x00);
-    i = i + 1;
+    (void)dma_spi_burst(DMA_SPI2MEM, ENC28J60_SPI_ID,
+                        (unsigned int)buf, (unsigned int)len, 0u);
   }
-  middle = ((unsigned int)(len - i)) & ~31u;
-  if (middle > 0u)
-  {
-    cache_flush_data();
-    dma_start_spi(DMA_SPI2MEM, ENC28J60_SPI_ID,
-                  (unsigned int)(buf + i), 0u, middle);
-    while (dma_busy())
-      ;
-    (void)dma_status();
-    cache_flush_data();
-    i = i + (int)middle;
-  }
-  while (i < len)
+  else
   {
-    buf[i] = spi_transfer(ENC28J60_SPI_ID, 0x00);
-    i = i + 1;
+    for (i = 0; i < len; i++)
+    {
+      buf[i] = spi_transfer(ENC28J60_SPI_ID, 0x00);
+    }
   }
   spi_deselect(ENC28J60_SPI_ID);
 }
@@ -163,30 +152,19 @@ static void enc28j60_read_buffer(char *buf, int len)
 static void enc28j60_write_buffer(char *buf, int len)
 {
   int i;
-  unsigned int middle;
   spi_select(ENC28J60_SPI_ID);
   spi_transfer(ENC28J60_SPI_ID, ENC_OP_WBM);
-  i = 0;
-  while (i < len && (((unsigned int)(buf + i)) & 31u) != 0u)
+  if (len >= ENC28J60_DMA_MIN)
   {
-    spi_transfer(ENC28J60_SPI_ID, buf[i]);
-    i = i + 1;
+    (void)dma_spi_burst(DMA_MEM2SPI, ENC28J60_SPI_ID,
+                        (unsigned int)buf, (unsigned int)len, 0u);
   }
-  middle = ((unsigned int)(len - i)) & ~31u;
-  if (middle > 0u)
-  {
-    cache_flush_data();
-    dma_start_spi(DMA_MEM2SPI, ENC28J60_SPI_ID,
-                  0u, (unsigned int)(buf + i), middle);
-    while (dma_busy())
-      ;
-    (void)dma_status();
-    i = i + (int)middle;
-  }
-  while (i < len)
+  else
   {
-    spi_transfer(ENC28J60_SPI_ID, buf[i]);
-    i = i + 1;
+    for (i = 0; i < len; i++)
+    {
+      spi_transfer(ENC28J60_SPI_ID, buf[i]);
+    }
   }
   spi_deselect(ENC28J60_SPI_ID);
 }
@@ -44,10 +44,9 @@
 #define SPI_SD       FPGC_SPI_SD_CARD     /* spi id 5 */
 #define SD_DUMMY     0xFF
 
-/* DMA constraints (matches DMAengine.v: 32-byte / line alignment, dst in
- * SDRAM 0..0x04000000). 512 = SD block size is already line-aligned. */
-#define SD_DMA_OK(p) ( ((unsigned int)(p) % 32u == 0u) && \
-                       ((unsigned int)(p) < 0x04000000u) )
+/* DMA constraint (matches DMAengine.v): the buffer must be in SDRAM
+ * 0..0x04000000. Any byte alignment is accepted. */
+#define SD_DMA_OK(p) ( ((unsigned int)(p) + SD_BLOCK_SIZE <= 0x04000000u) )
 
 /* Commands */
 #define CMD0         0   /* GO_IDLE_STATE */
@@ -344,17 +343,12 @@ sd_read_block(unsigned int lba, void *buf)
         return SD_ERR_TIMEOUT;
     }
 
-    /* DMA fast path: 512 B aligned SDRAM buffer -- one SPI2MEM burst on
+    /* DMA fast path: SDRAM buffer -- one SPI2MEM burst on
      * SPI5 streams the whole payload in one shot. CPU still drives the
      * trailing 16-bit CRC bytes (the engine doesn't know about them). */
     if (SD_DMA_OK(p)) {
-        cache_flush_data();
-        dma_start_spi(DMA_SPI2MEM, SPI_SD, (unsigned int)p, 0u,
-                      (unsigned int)SD_BLOCK_SIZE);
-        while (dma_busy())
-            ;
-        (void)dma_status();
-        cache_flush_data();
+        (void)dma_spi_burst(DMA_SPI2MEM, SPI_SD, (unsigned int)p,
+                            (unsigned int)SD_BLOCK_SIZE, 0u);
     } else {
         for (i = 0; i < SD_BLOCK_SIZE; i++)
             p[i] = xfer(SD_DUMMY) & 0xFF;
@@ -405,14 +399,10 @@ sd_write_block(unsigned int lba, const void *buf)
     (void)xfer(SD_DUMMY);                          /* one byte gap */
     (void)xfer(DATA_TOKEN_READ_WRITE_SINGLE);      /* start token */
     if (SD_DMA_OK(p)) {
-        /* Push any dirty L1d lines back to SDRAM so the engine sees
-         * the latest payload bytes. */
-        cache_flush_data();
-        dma_start_spi(DMA_MEM2SPI, SPI_SD, 0u, (unsigned int)p,
-                      (unsigned int)SD_BLOCK_SIZE);
-        while (dma_busy())
-            ;
-        (void)dma_status();
+        /* dma_spi_burst pushes dirty L1d lines back to SDRAM first so
+         * the engine sees the latest payload bytes. */
+        (void)dma_spi_burst(DMA_MEM2SPI, SPI_SD, (unsigned int)p,
+                            (unsigned int)SD_BLOCK_SIZE, 0u);
     } else {
         for (i = 0; i < SD_BLOCK_SIZE; i++)
             (void)xfer(p[i]);
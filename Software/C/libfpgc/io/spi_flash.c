@@ -186,24 +186,18 @@ spi_flash_write_words(int spi_id, int address, unsigned int *data, int word_coun
     spi_transfer(spi_id, SPIFLASH_CMD_PAGE_PROGRAM);
     send_addr(spi_id, address);
     /*
-     * Fast path: when the source buffer and byte count are 32-byte aligned
-     * and the SPI controller supports DMA burst writes (SimpleSPI2 only:
-     * id 0 or 4), push the payload with the DMAengine in MEM2SPI mode.
+     * Fast path: when the SPI controller supports DMA burst writes
+     * (SimpleSPI2 only: id 0 or 4), push the payload with the DMAengine
+     * in MEM2SPI mode. Any buffer alignment works.
      * SPI1 (QSPIflash) is excluded: its 1-bit burst path hangs under DMA
      * MEM2SPI due to dma_select mux cycling between 32-byte chunks, and
      * page-program is bottlenecked by the flash's internal program cycle
      * (~1 ms) anyway, not bus bandwidth.
      */
     byte_count = (unsigned int)word_count * 4u;
-    if ((spi_id == 0 || spi_id == 4) &&
-        ((unsigned int)data % 32u == 0u) &&
-        (byte_count % 32u == 0u) &&
-        byte_count > 0u) {
-        cache_flush_data();
-        dma_start_spi(DMA_MEM2SPI, spi_id, 0u, (unsigned int)data, byte_count);
-        while (dma_busy())
-            ;
-        (void)dma_status();
+    if ((spi_id == 0 || spi_id == 4) && byte_count > 0u) {
+        (void)dma_spi_burst(DMA_MEM2SPI, spi_id, (unsigned int)data,
+                            byte_count, 0u);
     } else {
         for (i = 0; i < word_count; i++) {
             word = data[i];
@@ -232,20 +226,10 @@ spi_flash_read_words(int spi_id, int address, unsigned int *buffer, int word_cou
      * issues opcode 0xEB + addr + M + dummy + data internally, so
      * no 1-bit prologue is needed. Cache flush is amortised.
      */
-    if (spi_id == 1 &&
-        ((unsigned int)buffer % 32u == 0u) &&
-        (byte_count % 32u == 0u) &&
-        byte_count > 0u) {
+    if (spi_id == 1 && byte_count > 0u) {
         spi_select(spi_id);
-        cache_flush_data();
-        dma_start_spi_qspi_read(spi_id,
-                                (unsigned int)buffer,
-                                (unsigned int)address,
-                                byte_count);
-        while (dma_busy())
-            ;
-        (void)dma_status();
-        cache_flush_data();
+        (void)dma_spi_burst(DMA_SPI2MEM_QSPI, spi_id, (unsigned int)buffer,
+                            byte_count, (unsigned int)address);
         spi_deselect(spi_id);
         return;
     }
@@ -253,19 +237,12 @@ spi_flash_read_words(int spi_id, int address, unsigned int *buffer, int word_cou
     spi_transfer(spi_id, SPIFLASH_CMD_READ_DATA);
     send_addr(spi_id, address);
     /*
-     * Fast path: aligned destination buffer and byte count -- pull the
-     * payload via DMA SPI2MEM (available on SPI controllers 0, 1, and 4).
+     * Fast path: pull the payload via DMA SPI2MEM (SimpleSPI2 controllers
+     * 0 and 4).
      */
-    if ((spi_id == 0 || spi_id == 4) &&
-        ((unsigned int)buffer % 32u == 0u) &&
-        (byte_count % 32u == 0u) &&
-        byte_count > 0u) {
-        cache_flush_data();
-        dma_start_spi(DMA_SPI2MEM, spi_id, (unsigned int)buffer, 0u, byte_count);
-        while (dma_busy())
-            ;
-        (void)dma_status();
-        cache_flush_data();
+    if ((spi_id == 0 || spi_id == 4) && byte_count > 0u) {
+        (void)dma_spi_burst(DMA_SPI2MEM, spi_id, (unsigned int)buffer,
+                            byte_count, 0u);
     } else {
         for (i = 0; i < word_count; i++) {
             /* Little-endian on disk: LSB first. */
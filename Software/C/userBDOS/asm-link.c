@@ -16,6 +16,12 @@
 /*  - Supports the byte-addressable memory instructions:                    */
 /*       readb / readbu / readh / readhu / writeb / writeh                  */
 /*  - Writes raw 32-bit words directly (NOT the ASMPY .list text format).   */
+/*  - -p runs the same peephole rules as ASMPY --peephole.                  */
+/*  - --gc-sections drops sections not reachable from Main (--map: report) */
+/*  - -c assembles one file to a relocatable object (.o), -a bundles       */
+/*    objects into an archive (.a). Linking .o/.a inputs pulls only the     */
+/*    archive members that define a symbol still undefined; one .asm input  */
+/*    among them is assembled in memory first. "-" reads stdin.             */
 /*                                                                           */
 /*  Output binary layout (matches ASMPY --header --independent):            */
 /*       word 0 : jump Main      (relocatable, type 2)                      */
@@ -119,6 +125,12 @@ static int host_filesize_words(int fd)
   return (b + 3) / 4;
 }
 
+static int host_seek(int fd, int offset)
+{
+  if (fd < 0 || fd >= MAX_HOST_FDS || host_files[fd] == NULL) return -1;
+  return fseek(host_files[fd], offset, SEEK_SET) == 0 ? offset : -1;
+}
+
 static int host_read_words(int fd, void *buf, int count_words)
 {
   size_t got;
@@ -141,8 +153,10 @@ static int host_write_words(int fd, const void *buf, int count_words)
 #define IO_CLOSE(fd)          host_close(fd)
 #define IO_FILESIZE_BYTES(fd) host_filesize_bytes(fd)
 #define IO_FILESIZE_WORDS(fd) host_filesize_words(fd)
+#define IO_SEEK(fd, off)      host_seek(fd, off)
 #define IO_READ_WORDS(fd, b, n)  host_read_words(fd, b, n)
 #define IO_WRITE_WORDS(fd, b, n) host_write_words(fd, b, n)
+#define IO_WRITE_BYTES(fd, b, n) fwrite(b, 1, (size_t)(n), host_files[fd])
 #define IO_PRINT(s)           fputs(s, stderr)
 #define IO_HEAP_ALLOC(n)      malloc((size_t)(n))
 #define IO_ARGC()             host_argc
@@ -161,8 +175,10 @@ static char **host_argv;
  * keep speaking in 32-bit words. */
 #define IO_FILESIZE_BYTES(fd) asm_filesize(fd)
 #define IO_FILESIZE_WORDS(fd) ((asm_filesize(fd) + 3) / 4)
+#define IO_SEEK(fd, off)      sys_lseek(fd, off, 0 /* SEEK_SET */)
 #define IO_READ_WORDS(fd, b, n)  ((sys_read(fd, b, (n) * 4) + 3) / 4)
 #define IO_WRITE_WORDS(fd, b, n) (sys_write(fd, b, (n) * 4) / 4)
+#define IO_WRITE_BYTES(fd, b, n) sys_write(fd, b, n)
 #define IO_PRINT(s)           sys_putstr(s)
 #define IO_HEAP_ALLOC(n)      malloc(n)
 #define IO_ARGC()             sys_argc()
@@ -186,11 +202,23 @@ static char *sys_getcwd_static(void)
 
 #endif
 
+/* Create (or truncate) path and open it for writing. */
+static int open_output(const char *path)
+{
+#ifdef ASMLINK_HOST
+  IO_DELETE((char *)path);
+  IO_CREATE((char *)path);
+  return IO_OPEN((char *)path);
+#else
+  return IO_OPEN_WRITE((char *)path);
+#endif
+}
+
 /*===========================================================================*/
 /*  Limits and buffer sizes                                                  */
 /*===========================================================================*/
 
-#define MAX_FILES         32
+#define MAX_FILES         64
 #define MAX_LINE_LEN      512
 #define MAX_TOKENS        16
 #define MAX_PATH          256
@@ -206,7 +234,7 @@ static char *sys_getcwd_static(void)
  * BDOS budget (~7.3 MiB):
  *   26 arrays × 48K × 4  = 4.88 MiB   (line + out arrays)
  *   str_pool 512 KiB + byte_pool 256 KiB
- *   labels 8K × 68 = 544 KiB
+ *   labels 8K × 16 = 128 KiB, symbols 16K × 16 + defs 16K × 8 = 384 KiB
  *   output 1 MiB + relocs 32 KiB
  */
 #ifdef ASMLINK_HOST
@@ -221,7 +249,7 @@ static char *sys_getcwd_static(void)
   #define STR_POOL_BYTES    (512 * 1024)       /* 512 KiB interned strings */
   #define BYTE_POOL_BYTES   (256 * 1024)       /* 256 KiB ELF byte data */
   #define OUTPUT_WORDS      (256 * 1024)       /* 1 MiB output */
-  #define MAX_LABELS        8192               /* 544 KiB label storage */
+  #define MAX_LABELS        8192               /* 512 KiB with hash tables */
   #define MAX_RELOCS        8192               /* 32 KiB reloc entries */
 #endif
 #define LABEL_NAME_LEN    64
@@ -306,6 +334,50 @@ static char *sys_getcwd_static(void)
 #define SEC_BSS    3
 #define NUM_SECTIONS 4
 
+/* Object files (-c) and archives (-a), in 32-bit words.
+ *
+ * Object:
+ *   word 0      OBJ_MAGIC
+ *   word 1..4   words in each section (code, data, rdata, bss)
+ *   word 5      symbol count
+ *   word 6      relocation count
+ *   word 7      string table size in words
+ *   then        the section words in section order; the offsets below are
+ *               byte offsets from the first of them
+ *   then        symbols, 3 words each: name (string table offset),
+ *               (binding<<8)|section (OSEC_UNDEF if external), offset
+ *   then        relocations, 3 words each: (offset<<8)|OREL_*, symbol,
+ *               addend
+ *   then        the string table (NUL-terminated names)
+ *
+ * Archive:
+ *   word 0      ARC_MAGIC
+ *   word 1      member count
+ *   word 2      index entry count
+ *   word 3      string table size in words
+ *   then        members, 3 words each: byte offset of the object in the
+ *               archive, size in words, name (string table offset)
+ *   then        index, 2 words each: symbol name, member
+ *   then        the string table, then the member objects
+ */
+#define OBJ_MAGIC     0x4F323342u   /* "B32O" */
+#define ARC_MAGIC     0x41323342u   /* "B32A" */
+#define OBJ_HDR_WORDS 8
+#define ARC_HDR_WORDS 4
+
+/* Object relocation kinds: the field of the word that holds the address */
+#define OREL_WORD    0   /* whole word, RELOC_DATA_WORD at run time */
+#define OREL_LO      1   /* load, low half; RELOC_LOAD_PAIR at run time */
+#define OREL_HI      2   /* loadhi, high half */
+#define OREL_JUMP    3   /* jump, pc-relative */
+#define OREL_BRANCH  4   /* branch, pc-relative */
+
+/* Object symbol bindings */
+#define OSYM_LOCAL   0   /* .L label, private to its object */
+#define OSYM_PLAIN   1   /* visible to other objects unless several define it */
+#define OSYM_GLOBAL  2   /* named by .globl/.global */
+#define OSEC_UNDEF   0xFF
+
 /*===========================================================================*/
 /*  Line records                                                             */
 /*===========================================================================*/
@@ -358,9 +430,13 @@ static int   *line_addr;
  *   1 = header instruction (jump Main ought to be RELOC_JUMP rather than
  *       being rewritten to jumpo). Set by add_header().
  *   2 = "first half of an addr2reg pair" — emit RELOC_LOAD_PAIR for it.
+ *   4 = layout is relied upon; the peephole pass leaves it alone.
+ *   8 = removed by the peephole pass or by --gc-sections.
  */
 #define FLAG_HEADER     0x1
 #define FLAG_LOAD_PAIR  0x2
+#define FLAG_PINNED     0x4
+#define FLAG_DEAD       0x8
 static int   *line_flags;
 
 static int   line_count;
@@ -369,7 +445,7 @@ static int   line_count;
 /*  Label table                                                              */
 /*===========================================================================*/
 
-static char (*label_names)[LABEL_NAME_LEN];
+static char **label_names;  /* interned in str_pool */
 static int   *label_addr;   /* byte address */
 static int    label_count;
 
@@ -377,6 +453,36 @@ static int    label_count;
 /* For each label: which file_idx defined it, and whether it's marked global */
 static int   *label_file;
 static int   *label_global;
+static int   *label_sec;    /* SEC_*, or OSEC_UNDEF for externals (-c) */
+
+/*===========================================================================*/
+/*  Symbol table                                                             */
+/*===========================================================================*/
+
+/* Label, global and label reference names are interned in str_pool, with one
+ * slot per distinct name in an open-addressing hash table (linear probing).
+ * The slot keeps what the link passes need to know about the name, so every
+ * look-up is a hash and a few strcmp calls rather than a scan.
+ */
+#define SYM_SLOTS     (2 * MAX_LABELS)   /* power of two, at most half full */
+#define SYM_GLOBAL    0x1                /* named by .globl/.global */
+#define SYM_CONFLICT  0x2                /* non-global, defined in 2+ files */
+#define SYM_WANTED    0x4                /* referenced by a linked object */
+
+static char **sym_name;      /* interned name, NULL for a free slot */
+static int   *sym_label;     /* index into label_names[], or -1 */
+static int   *sym_def_file;  /* first file defining the label, or -1 */
+static int   *sym_flags;     /* SYM_* */
+static int    sym_count;
+
+/* Set of (name, file) label definitions, keyed by the interned name, so the
+ * conflict renaming can tell which files define a conflicting label.
+ */
+#define DEF_SLOTS     (2 * MAX_LABELS)
+
+static char **def_name;      /* interned name, NULL for a free slot */
+static int   *def_file;
+static int    def_count;
 
 /*===========================================================================*/
 /*  String + byte pools                                                      */
@@ -400,6 +506,12 @@ static int    output_count;
 static unsigned int *reloc_entries;  /* packed (offset<<8)|type */
 static int    reloc_count;
 
+/* -c: label references left for the object linker, three words each:
+ * (offset<<8)|OREL_*, label index, addend
+ */
+static unsigned int *obj_relocs;
+static int    obj_reloc_count;
+
 /*===========================================================================*/
 /*  Globals: input files                                                     */
 /*===========================================================================*/
@@ -412,6 +524,11 @@ static char *output_path;
 static int   verbose;
 static int   has_error;
 static int   dump_labels;
+static int   peephole;
+static int   assemble_only;   /* -c: write an object file */
+static int   make_archive;    /* -a: write an archive of object files */
+static int   gc_sections;     /* --gc-sections: drop unreferenced sections */
+static char *map_path;        /* --map: where to report what gc kept */
 
 /*===========================================================================*/
 /*  Utilities                                                                */
@@ -480,6 +597,78 @@ static char *pool_strdup(const char *s)
   return pool_strdup_n(s, (int)strlen(s));
 }
 
+/* FNV-1a over the n bytes of s. */
+static unsigned int sym_hash(const char *s, int n)
+{
+  unsigned int h = 2166136261u;
+  int i;
+  for (i = 0; i < n; i++) h = (h ^ (unsigned char)s[i]) * 16777619u;
+  return h;
+}
+
+/* Find the slot of the name s[0..n). If it is not in the table, add it when
+ * insert is set, else return -1.
+ */
+static int sym_find_n(const char *s, int n, int insert)
+{
+  unsigned int h = sym_hash(s, n) & (SYM_SLOTS - 1);
+  while (sym_name[h])
+  {
+    if (strncmp(sym_name[h], s, (size_t)n) == 0 && sym_name[h][n] == 0)
+      return (int)h;
+    h = (h + 1) & (SYM_SLOTS - 1);
+  }
+  if (!insert) return -1;
+  if (sym_count >= SYM_SLOTS / 2)
+  {
+    emsg("too many symbols");
+    return -1;
+  }
+  sym_name[h] = pool_strdup_n(s, n);
+  if (!sym_name[h]) return -1;
+  sym_label[h] = -1;
+  sym_def_file[h] = -1;
+  sym_flags[h] = 0;
+  sym_count++;
+  return (int)h;
+}
+
+static int sym_find(const char *s, int insert)
+{
+  return sym_find_n(s, (int)strlen(s), insert);
+}
+
+/* Intern a symbol name: equal names share one pool string. */
+static char *pool_intern(const char *s)
+{
+  int h = sym_find(s, 1);
+  return h < 0 ? NULL : sym_name[h];
+}
+
+/* Look up the definition of the interned name in file_idx. Returns 1 if it
+ * is there; if not, adds it when insert is set and returns 0.
+ */
+static int def_find(const char *name, int file_idx, int insert)
+{
+  unsigned int h = ((unsigned int)(name - str_pool) * 33u +
+                    (unsigned int)file_idx) & (DEF_SLOTS - 1);
+  while (def_name[h])
+  {
+    if (def_name[h] == name && def_file[h] == file_idx) return 1;
+    h = (h + 1) & (DEF_SLOTS - 1);
+  }
+  if (!insert) return 0;
+  if (def_count >= DEF_SLOTS / 2)
+  {
+    emsg("too many label defs");
+    return 0;
+  }
+  def_name[h] = (char *)name;
+  def_file[h] = file_idx;
+  def_count++;
+  return 0;
+}
+
 static int byte_pool_emit(unsigned char b)
 {
   if (byte_pool_pos >= byte_pool_size)
@@ -659,17 +848,14 @@ static char *lstrip(char *s)
 /* Locate a label in label_names[]. Returns index or -1. */
 static int find_label(const char *name)
 {
-  int i;
-  for (i = 0; i < label_count; i++)
-  {
-    if (strcmp(label_names[i], name) == 0) return i;
-  }
-  return -1;
+  int h = sym_find(name, 0);
+  return h < 0 ? -1 : sym_label[h];
 }
 
 static int add_label(const char *name, int file_idx)
 {
   int n;
+  int h;
   if (label_count >= MAX_LABELS)
   {
     emsg("too many labels");
@@ -681,19 +867,18 @@ static int add_label(const char *name, int file_idx)
     emsg2("label name too long: ", name);
     return -1;
   }
-  if (find_label(name) >= 0)
+  h = sym_find(name, 1);
+  if (h < 0) return -1;
+  if (sym_label[h] >= 0)
   {
     emsg2("duplicate label: ", name);
     return -1;
   }
-  {
-    int i;
-    for (i = 0; i < n; i++) label_names[label_count][i] = name[i];
-    label_names[label_count][n] = 0;
-  }
+  sym_label[h] = label_count;
+  label_names[label_count] = sym_name[h];
   label_addr[label_count] = -1;
   label_file[label_count] = file_idx;
-  label_global[label_count] = 0;
+  label_global[label_count] = (sym_flags[h] & SYM_GLOBAL) != 0;
   label_count++;
   return label_count - 1;
 }
@@ -708,6 +893,7 @@ static char *make_prefix(const char *path)
   char tmp[64];
   int i;
 
+  if (strcmp(path, "-") == 0) return pool_strdup("stdin");
   while (*p) { if (*p == '/') base = p + 1; p++; }
   dot = base;
   while (*dot && *dot != '.') dot++;
@@ -727,21 +913,50 @@ static char *make_prefix(const char *path)
 /*  File reading                                                             */
 /*===========================================================================*/
 
-/* Read the entire file at `path` into a freshly allocated buffer (heap) and
- * return it as a NUL-terminated string. The buffer is sized to byte length;
- * filesize is in words on BDOS, multiplied by 4. We trim trailing NULs so the
- * source text doesn't contain spurious bytes.
+/* Read all of stdin the way read_file_words reads a file. */
+static unsigned int *read_stdin_words(int *out_words)
+{
+  int cap = 4096;
+  int len = 0;
+  int got;
+  char *buf = (char *)IO_HEAP_ALLOC(cap + 4);
+
+  while (buf)
+  {
+    got = (int)fread(buf + len, 1, (size_t)(cap - len), stdin);
+    if (got <= 0) break;
+    len += got;
+    if (len == cap)
+    {
+      cap *= 2;
+      buf = (char *)realloc(buf, (size_t)cap + 4);
+    }
+  }
+  if (!buf)
+  {
+    emsg("out of memory reading stdin");
+    return NULL;
+  }
+  memset(buf + len, 0, (size_t)(cap + 4 - len));
+  *out_words = (len + 3) / 4;
+  return (unsigned int *)buf;
+}
+
+/* Read the entire file at `path` into a freshly allocated word buffer (heap)
+ * with one spare zero word at the end. Sets *out_words to the file size in
+ * words; filesize is in words on BDOS. The path "-" reads stdin.
  */
-static char *read_file(const char *path, int *out_bytes)
+static unsigned int *read_file_words(const char *path, int *out_words)
 {
   int fd;
   int size_w;
-  int size_b;
-  char *buf;
+  unsigned int *buf;
   int total;
   int chunk;
   int got;
+  int z;
 
+  if (strcmp(path, "-") == 0) return read_stdin_words(out_words);
   fd = IO_OPEN((char *)path);
   if (fd < 0)
   {
@@ -755,33 +970,43 @@ static char *read_file(const char *path, int *out_bytes)
     emsg2("invalid file: ", path);
     return NULL;
   }
-  size_b = size_w * 4;
 
-  buf = (char *)IO_HEAP_ALLOC(size_b + 4);
+  buf = (unsigned int *)IO_HEAP_ALLOC(size_w * 4 + 4);
   if (!buf)
   {
     IO_CLOSE(fd);
     emsg("out of memory reading file");
     return NULL;
   }
-  /* Zero the buffer so any over-allocation from word rounding is benign
-   * to the NUL-trim pass below. */
-  {
-    int z;
-    for (z = 0; z < size_b + 4; z++) buf[z] = 0;
-  }
+  /* Zero the buffer so a short read leaves no stale bytes. */
+  for (z = 0; z <= size_w; z++) buf[z] = 0;
 
   total = 0;
   while (total < size_w)
   {
     chunk = size_w - total;
     if (chunk > 256) chunk = 256;
-    got = IO_READ_WORDS(fd, (unsigned int *)(buf + total * 4), chunk);
+    got = IO_READ_WORDS(fd, &buf[total], chunk);
     if (got <= 0) break;
     total += got;
   }
   IO_CLOSE(fd);
 
+  *out_words = size_w;
+  return buf;
+}
+
+/* Read the entire text file at `path` and return it as a NUL-terminated
+ * string. We trim trailing NULs so the source text doesn't contain spurious
+ * bytes.
+ */
+static char *read_file(const char *path, int *out_bytes)
+{
+  int size_b;
+  char *buf = (char *)read_file_words(path, &size_b);
+  if (!buf) return NULL;
+  size_b *= 4;
+
   /* Trim trailing zero padding (BRFS pads files to whole words with NUL). */
   while (size_b > 0 && buf[size_b - 1] == 0) size_b--;
   buf[size_b] = 0;
@@ -877,18 +1102,27 @@ static int rewrite_local_labels(const char *in, char *out, int out_cap,
   return 1;
 }
 
-/* Rewrite a (mutable) line buffer: replace every whole-word occurrence of
- * `name` (one of the conflicting non-global labels) with `__<prefix>__<name>`.
- * We respect quoted strings.
+/* 1 if s[0..n) names a conflicting label that file_idx defines. */
+static int file_owns_conflict(int file_idx, const char *s, int n)
+{
+  int h = sym_find_n(s, n, 0);
+  if (h < 0 || !(sym_flags[h] & SYM_CONFLICT)) return 0;
+  return def_find(sym_name[h], file_idx, 0);
+}
+
+/* Rewrite a (mutable) line buffer: replace every whole-word occurrence of a
+ * conflicting non-global label that file_idx defines with
+ * `__<prefix>__<name>`. We respect quoted strings.
  *
- * Used in pass_resolve_conflicts(). Operates on a single label name only; for
- * efficiency we'd batch them, but simplicity wins.
+ * Used in pass_rewrite_conflicts(). Returns 1 if the line changed, 0 if not
+ * and -1 if the result does not fit in out.
  */
-static int rewrite_label_word(const char *in, char *out, int out_cap,
-                              const char *name, const char *prefix)
+static int rewrite_label_words(const char *in, char *out, int out_cap,
+                               int file_idx)
 {
-  int name_len = (int)strlen(name);
+  const char *prefix = file_prefix[file_idx];
   int prefix_len = (int)strlen(prefix);
+  int changed = 0;
   int i = 0;
   int o = 0;
   int in_quote = 0;
@@ -899,49 +1133,50 @@ static int rewrite_label_word(const char *in, char *out, int out_cap,
     if (c == '"')
     {
       if (i == 0 || in[i - 1] != '\\') in_quote = !in_quote;
-      if (o + 1 >= out_cap) return 0;
+      if (o + 1 >= out_cap) return -1;
       out[o++] = c;
       i++;
       continue;
     }
     if (in_quote)
     {
-      if (o + 1 >= out_cap) return 0;
+      if (o + 1 >= out_cap) return -1;
       out[o++] = c;
       i++;
       continue;
     }
 
-    /* Boundary check: previous char must NOT be id-cont, and the matched
-     * suffix must end at non-id-cont.
+    /* Whole words only: the previous char is not id-cont, and the word
+     * runs up to the next non-id-cont char.
      */
-    if ((i == 0 || !is_id_cont((unsigned char)in[i - 1]))
-        && strncmp(&in[i], name, (size_t)name_len) == 0
-        && !is_id_cont((unsigned char)in[i + name_len]))
+    if (is_id_cont((unsigned char)c)
+        && (i == 0 || !is_id_cont((unsigned char)in[i - 1])))
     {
-      if (o + 4 + prefix_len + name_len >= out_cap) return 0;
-      out[o++] = '_';
-      out[o++] = '_';
+      int j = i;
+      int k;
+      while (in[j] && is_id_cont((unsigned char)in[j])) j++;
+      if (file_owns_conflict(file_idx, &in[i], j - i))
       {
-        int k;
+        if (o + 4 + prefix_len >= out_cap) return -1;
+        out[o++] = '_';
+        out[o++] = '_';
         for (k = 0; k < prefix_len; k++) out[o++] = prefix[k];
+        out[o++] = '_';
+        out[o++] = '_';
+        changed = 1;
       }
-      out[o++] = '_';
-      out[o++] = '_';
-      {
-        int k;
-        for (k = 0; k < name_len; k++) out[o++] = name[k];
-      }
-      i += name_len;
+      if (o + (j - i) >= out_cap) return -1;
+      for (k = i; k < j; k++) out[o++] = in[k];
+      i = j;
       continue;
     }
 
-    if (o + 1 >= out_cap) return 0;
+    if (o + 1 >= out_cap) return -1;
     out[o++] = c;
     i++;
   }
   out[o] = 0;
-  return 1;
+  return changed;
 }
 
 /*===========================================================================*/
@@ -1105,7 +1340,7 @@ static void parse_one_line(char *line, int file_idx, int *cur_section)
       else                rest = lstrip(line + 7);
       idx = new_line(LK_GLOBAL);
       if (idx < 0) return;
-      line_text[idx] = pool_strdup(rest);
+      line_text[idx] = pool_intern(rest);
       line_section[idx] = *cur_section;
       line_file_idx[idx] = file_idx;
       return;
@@ -1251,7 +1486,7 @@ static void parse_one_line(char *line, int file_idx, int *cur_section)
         }
         idx = new_line(LK_INT_LABREF);
         if (idx < 0) return;
-        line_label[idx] = pool_strdup(namebuf);
+        line_label[idx] = pool_intern(namebuf);
         line_label_off[idx] = off;
         line_section[idx] = *cur_section;
         line_file_idx[idx] = file_idx;
@@ -1315,7 +1550,7 @@ static void parse_one_line(char *line, int file_idx, int *cur_section)
         else if (minus) { int x; *minus = 0; if (parse_number(minus + 1, &x)) off = -x; }
         idx = new_line(LK_DW_LABREF);
         if (idx < 0) return;
-        line_label[idx] = pool_strdup(rest);
+        line_label[idx] = pool_intern(rest);
         line_label_off[idx] = off;
         line_section[idx] = *cur_section;
         line_file_idx[idx] = file_idx;
@@ -1338,7 +1573,7 @@ static void parse_one_line(char *line, int file_idx, int *cur_section)
     namebuf[n] = 0;
     idx = new_line(LK_LABEL);
     if (idx < 0) return;
-    line_text[idx] = pool_strdup(namebuf);
+    line_text[idx] = pool_intern(namebuf);
     line_section[idx] = *cur_section;
     line_file_idx[idx] = file_idx;
     return;
@@ -1395,7 +1630,7 @@ static void parse_one_line(char *line, int file_idx, int *cur_section)
       namebuf[nl] = 0;
       idx = new_line(LK_ADDR2REG);
       if (idx < 0) return;
-      line_label[idx] = pool_strdup(namebuf);
+      line_label[idx] = pool_intern(namebuf);
       line_label_off[idx] = off;
       line_value[idx] = (unsigned int)reg;
       line_section[idx] = *cur_section;
@@ -1461,45 +1696,10 @@ static int parse_file(int file_idx)
 /*  conflicts in non-global labels, and rewrite them in their owning file.   */
 /*===========================================================================*/
 
-/* First sub-pass: walk LK_GLOBAL records and remember the names.
- * We can't add the labels to the table yet (we want to see all definitions
- * first), but we record one bit per name for later look-up.
- *
- * Strategy: for each LK_GLOBAL line, store the name in a side table; later,
- * when we add labels in pass_collect_label_defs(), we look it up to set
- * label_global[].
+/* First sub-pass: walk LK_GLOBAL records and flag the names in the symbol
+ * table. The labels themselves are added in pass_extract_labels(), which
+ * copies the flag into label_global[].
  */
-
-#define MAX_GLOBALS 4096
-static char *global_names[MAX_GLOBALS];
-static int   global_count;
-
-static int add_global_name(const char *name)
-{
-  int i;
-  for (i = 0; i < global_count; i++)
-  {
-    if (strcmp(global_names[i], name) == 0) return 0;
-  }
-  if (global_count >= MAX_GLOBALS)
-  {
-    emsg("too many global symbols");
-    return -1;
-  }
-  global_names[global_count++] = (char *)name;  /* already pool-interned */
-  return 0;
-}
-
-static int is_global_name(const char *name)
-{
-  int i;
-  for (i = 0; i < global_count; i++)
-  {
-    if (strcmp(global_names[i], name) == 0) return 1;
-  }
-  return 0;
-}
-
 static void pass_collect_globals(void)
 {
   int i;
@@ -1507,50 +1707,19 @@ static void pass_collect_globals(void)
   {
     if (line_kind[i] == LK_GLOBAL)
     {
-      add_global_name(line_text[i]);
+      int h = sym_find(line_text[i], 1);
+      if (h < 0) return;
+      sym_flags[h] |= SYM_GLOBAL;
     }
   }
 }
 
-/* For conflict detection: tally label definitions per name; if a non-global
- * label is defined in more than one file, rewrite it in each owning file
- * with that file's prefix.
- *
- * Implementation: bucket labels by name across all LK_LABEL lines. We use
- * the existing label table machinery as a side store: temporarily build a
- * "first definition file" map, then on second occurrence flag a conflict.
- *
- * For simplicity and correctness, we do this O(L * F) where L = number of
- * label defs and F = number of conflicting names; this is fine for our
- * scale.
+/* For conflict detection: record the first file defining each label name and
+ * every (name, file) definition; if a non-global label is defined in more
+ * than one file, rewrite it in each owning file with that file's prefix.
  */
 
-#define MAX_DEFNAMES (MAX_LABELS)
-static char *def_names[MAX_DEFNAMES];
-static int   def_files[MAX_DEFNAMES];
-static int   def_count;
-static char *conflict_names[MAX_DEFNAMES];
-static int   conflict_count;
-
-static int find_def(const char *name)
-{
-  int i;
-  for (i = 0; i < def_count; i++)
-  {
-    if (strcmp(def_names[i], name) == 0) return i;
-  }
-  return -1;
-}
-
-static int is_conflict(const char *name)
-{
-  int i;
-  for (i = 0; i < conflict_count; i++)
-  {
-    if (strcmp(conflict_names[i], name) == 0) return 1;
-  }
-  return 0;
-}
+static int conflict_count;
 
 static void pass_find_conflicts(void)
 {
@@ -1559,22 +1728,20 @@ static void pass_find_conflicts(void)
   {
     if (line_kind[i] != LK_LABEL) continue;
     {
-      char *name = line_text[i];
-      int   f    = line_file_idx[i];
-      int   d    = find_def(name);
-      if (d < 0)
+      int f = line_file_idx[i];
+      int h = sym_find(line_text[i], 1);
+      if (h < 0) return;
+      def_find(sym_name[h], f, 1);
+      if (has_error) return;
+      if (sym_def_file[h] < 0)
       {
-        if (def_count >= MAX_DEFNAMES) { emsg("too many label defs"); return; }
-        def_names[def_count] = name;
-        def_files[def_count] = f;
-        def_count++;
+        sym_def_file[h] = f;
       }
-      else if (def_files[d] != f)
+      else if (sym_def_file[h] != f
+               && !(sym_flags[h] & (SYM_GLOBAL | SYM_CONFLICT)))
       {
-        if (is_global_name(name)) continue;
-        if (is_conflict(name)) continue;
-        if (conflict_count >= MAX_DEFNAMES) { emsg("too many conflicts"); return; }
-        conflict_names[conflict_count++] = name;
+        sym_flags[h] |= SYM_CONFLICT;
+        conflict_count++;
       }
     }
   }
@@ -1585,257 +1752,718 @@ static void pass_find_conflicts(void)
  * `__<prefix>__<name>`. Also rewrite label refs in LK_DW_LABREF, LK_INT_LABREF,
  * LK_LABEL (definition itself), LK_ADDR2REG.
  *
- * We do this once per file (each file has a fixed set of conflicts to rewrite).
+ * A conflicting label may be defined in multiple files; each file gets its
+ * own prefix. One walk over the lines handles all conflicts.
  */
-static int file_owns_conflict(int file_idx, const char *name)
-{
-  int i;
-  for (i = 0; i < line_count; i++)
-  {
-    if (line_kind[i] == LK_LABEL && line_file_idx[i] == file_idx)
-    {
-      if (strcmp(line_text[i], name) == 0) return 1;
-    }
-  }
-  return 0;
-}
-
 static void pass_rewrite_conflicts(void)
 {
-  int ci;
+  int li;
+  char tmp[MAX_LINE_LEN];
   if (conflict_count == 0) return;
 
-  for (ci = 0; ci < conflict_count; ci++)
+  for (li = 0; li < line_count; li++)
   {
-    char *name = conflict_names[ci];
-    int   fi;
-    /* For each file that owns this label (i.e. defines it), rewrite all
-     * references in lines belonging to that file.
-     * Note: a conflicting label may be defined in multiple files; each file
-     * gets its own prefix.
-     */
-    for (fi = 0; fi < num_files; fi++)
+    int fi = line_file_idx[li];
+    int r;
+    switch (line_kind[li])
     {
-      int li;
-      char tmp[MAX_LINE_LEN];
-      if (!file_owns_conflict(fi, name)) continue;
-      for (li = 0; li < line_count; li++)
-      {
-        if (line_file_idx[li] != fi) continue;
-        switch (line_kind[li])
+      case LK_INSTR:
+      case LK_LABEL:
+        if (line_text[li] == NULL) break;
+        r = rewrite_label_words(line_text[li], tmp, sizeof(tmp), fi);
+        if (r < 0)
         {
-          case LK_INSTR:
-          case LK_LABEL:
-            if (line_text[li] == NULL) break;
-            if (rewrite_label_word(line_text[li], tmp, sizeof(tmp), name,
-                                   file_prefix[fi]))
-            {
-              line_text[li] = pool_strdup(tmp);
-            }
-            break;
-          case LK_DW_LABREF:
-          case LK_INT_LABREF:
-          case LK_ADDR2REG:
-            if (line_label[li] && strcmp(line_label[li], name) == 0)
-            {
-              char nm[LABEL_NAME_LEN];
-              snprintf(nm, sizeof(nm), "__%s__%s", file_prefix[fi], name);
-              line_label[li] = pool_strdup(nm);
-            }
-            break;
-          default:
-            break;
+          emsg2("line too long after renaming: ", line_text[li]);
+          return;
         }
-      }
+        if (r == 0) break;
+        if (line_kind[li] == LK_LABEL) line_text[li] = pool_intern(tmp);
+        else                           line_text[li] = pool_strdup(tmp);
+        break;
+      case LK_DW_LABREF:
+      case LK_INT_LABREF:
+      case LK_ADDR2REG:
+        if (line_label[li]
+            && file_owns_conflict(fi, line_label[li],
+                                  (int)strlen(line_label[li])))
+        {
+          snprintf(tmp, sizeof(tmp), "__%s__%s", file_prefix[fi],
+                   line_label[li]);
+          line_label[li] = pool_intern(tmp);
+        }
+        break;
+      default:
+        break;
     }
   }
 }
 
 /*===========================================================================*/
-/*  Pass 3: prepend header (jump Main, nop, .dw 0)                           */
+/*  Pass 2a: drop unreferenced sections (--gc-sections)                      */
+/*  Every section directive starts a new section, and QBE emits one before  */
+/*  each function and data object. Sections that cannot be reached from     */
+/*  Main through label references are removed before anything is laid out.  */
+/*  ASMPY applies the same rules (asmpy/linker.py, gc_sections), so host    */
+/*  and on-device builds stay byte-for-byte identical.                      */
 /*===========================================================================*/
 
-static void prepend_header(void)
+/* Why a section is kept (gc_why[]): the section referencing it, or one of */
+#define GC_DROPPED  (-1)
+#define GC_ROOT     (-2)   /* defines Main */
+#define GC_FALL     (-3)   /* the code before it in its file runs into it */
+
+static int *gc_first;      /* first line of each section, plus line_count */
+static int *gc_why;
+static int *gc_queue;
+static int *gc_sym;        /* section defining each symbol slot, or -1 */
+static int  gc_count;
+
+/* Drop the lines flagged FLAG_DEAD, in place. */
+static void remove_dead_lines(void)
 {
-  /* We need to insert 3 lines at index 0. Easiest: shift existing lines right
-   * by 3 and fill 0..2 with header records. This is O(N); N is small enough.
-   */
   int i;
-  if (line_count + 3 > MAX_LINES) { emsg("too many lines for header"); return; }
-  for (i = line_count - 1; i >= 0; i--)
+  int k = 0;
+  for (i = 0; i < line_count; i++)
   {
-    line_kind[i + 3]      = line_kind[i];
-    line_text[i + 3]      = line_text[i];
-    line_section[i + 3]   = line_section[i];
-    line_file_idx[i + 3]  = line_file_idx[i];
-    line_value[i + 3]     = line_value[i];
-    line_label[i + 3]     = line_label[i];
-    line_label_off[i + 3] = line_label_off[i];
-    line_byte_off[i + 3]  = line_byte_off[i];
-    line_byte_len[i + 3]  = line_byte_len[i];
-    line_align[i + 3]     = line_align[i];
-    line_dir_sec[i + 3]   = line_dir_sec[i];
-    line_addr[i + 3]      = line_addr[i];
-    line_flags[i + 3]     = line_flags[i];
+    if (line_flags[i] & FLAG_DEAD) continue;
+    line_kind[k]      = line_kind[i];
+    line_text[k]      = line_text[i];
+    line_section[k]   = line_section[i];
+    line_file_idx[k]  = line_file_idx[i];
+    line_value[k]     = line_value[i];
+    line_label[k]     = line_label[i];
+    line_label_off[k] = line_label_off[i];
+    line_byte_off[k]  = line_byte_off[i];
+    line_byte_len[k]  = line_byte_len[i];
+    line_align[k]     = line_align[i];
+    line_dir_sec[k]   = line_dir_sec[i];
+    line_addr[k]      = line_addr[i];
+    line_flags[k]     = line_flags[i] & ~FLAG_PINNED;
+    k++;
   }
-  line_count += 3;
-
-  /* word 0: jump Main — kept absolute and relocated as RELOC_JUMP */
-  line_kind[0]      = LK_INSTR;
-  line_text[0]      = pool_strdup("jump Main");
-  line_section[0]   = SEC_CODE;
-  line_file_idx[0]  = 0;
-  line_value[0]     = 0;
-  line_label[0]     = NULL;
-  line_label_off[0] = 0;
-  line_byte_off[0]  = 0;
-  line_byte_len[0]  = 0;
-  line_align[0]     = 0;
-  line_dir_sec[0]   = SEC_CODE;
-  line_addr[0]      = 0;
-  line_flags[0]     = FLAG_HEADER;
-
-  /* word 1: nop (we always emit nop here for userBDOS — the BDOS loader does
-   * not call user-program interrupt handlers; mirrors ASMPY independent=True)
-   */
-  line_kind[1]      = LK_INSTR;
-  line_text[1]      = pool_strdup("nop");
-  line_section[1]   = SEC_CODE;
-  line_file_idx[1]  = 0;
-  line_value[1]     = 0;
-  line_label[1]     = NULL;
-  line_label_off[1] = 0;
-  line_byte_off[1]  = 0;
-  line_byte_len[1]  = 0;
-  line_align[1]     = 0;
-  line_dir_sec[1]   = SEC_CODE;
-  line_addr[1]      = 0;
-  line_flags[1]     = 0;
+  line_count = k;
+}
 
-  /* word 2: .dw 0 — patched to program_size after layout */
-  line_kind[2]      = LK_DW_NUM;
-  line_text[2]      = NULL;
-  line_section[2]   = SEC_CODE;
-  line_file_idx[2]  = 0;
-  line_value[2]     = 0;
-  line_label[2]     = NULL;
-  line_label_off[2] = 0;
-  line_byte_off[2]  = 0;
-  line_byte_len[2]  = 0;
-  line_align[2]     = 0;
-  line_dir_sec[2]   = SEC_CODE;
-  line_addr[2]      = 0;
-  line_flags[2]     = 0;
+/* Keep section c, reached for reason why. */
+static void gc_mark(int c, int why, int *tail)
+{
+  if (c < 0 || gc_why[c] != GC_DROPPED) return;
+  gc_why[c] = why;
+  gc_queue[(*tail)++] = c;
 }
 
-/*===========================================================================*/
-/*  Pass 4: expand pseudo-instructions (load32, addr2reg)                    */
-/*===========================================================================*/
+/* Keep the section defining the name s[0..n), if any. */
+static void gc_mark_name(const char *s, int n, int why, int *tail)
+{
+  int h = sym_find_n(s, n, 0);
+  if (h >= 0) gc_mark(gc_sym[h], why, tail);
+}
 
-/* Expand a single addr2reg/load32 record into 1-2 records by inserting at the
- * given index. We do this by shifting the rest of the array; for clarity over
- * speed.
+/* 1 if the code of section c can run past its end: its last instruction is
+ * not a jump, a return or halt.
  */
-static int insert_blank(int idx)
+static int gc_falls_through(int c)
 {
   int i;
-  if (line_count >= MAX_LINES) { emsg("line array full"); return -1; }
-  for (i = line_count - 1; i >= idx; i--)
-  {
-    line_kind[i + 1]      = line_kind[i];
-    line_text[i + 1]      = line_text[i];
-    line_section[i + 1]   = line_section[i];
-    line_file_idx[i + 1]  = line_file_idx[i];
-    line_value[i + 1]     = line_value[i];
-    line_label[i + 1]     = line_label[i];
-    line_label_off[i + 1] = line_label_off[i];
-    line_byte_off[i + 1]  = line_byte_off[i];
-    line_byte_len[i + 1]  = line_byte_len[i];
-    line_align[i + 1]     = line_align[i];
-    line_dir_sec[i + 1]   = line_dir_sec[i];
-    line_addr[i + 1]      = line_addr[i];
-    line_flags[i + 1]     = line_flags[i];
-  }
-  line_count++;
-  /* Zero new slot */
-  line_kind[idx]      = 0;
-  line_text[idx]      = NULL;
-  line_section[idx]   = SEC_CODE;
-  line_file_idx[idx]  = 0;
-  line_value[idx]     = 0;
-  line_label[idx]     = NULL;
-  line_label_off[idx] = 0;
-  line_byte_off[idx]  = 0;
-  line_byte_len[idx]  = 0;
-  line_align[idx]     = 0;
-  line_dir_sec[idx]   = SEC_CODE;
-  line_addr[idx]      = 0;
-  line_flags[idx]     = 0;
-  return 0;
+  for (i = gc_first[c + 1] - 1; i >= gc_first[c]; i--)
+  {
+    const char *t = line_text[i];
+    int n = 0;
+    if (line_kind[i] == LK_LOAD32 || line_kind[i] == LK_ADDR2REG) return 1;
+    if (line_kind[i] != LK_INSTR) continue;
+    while (t[n] && t[n] != ' ' && t[n] != '\t') n++;
+    if ((n == 4 && strncmp(t, "jump", 4) == 0) ||
+        (n == 5 && strncmp(t, "jumpo", 5) == 0) ||
+        (n == 5 && strncmp(t, "jumpr", 5) == 0) ||
+        (n == 6 && strncmp(t, "jumpro", 6) == 0) ||
+        (n == 4 && strncmp(t, "halt", 4) == 0) ||
+        (n == 4 && strncmp(t, "reti", 4) == 0))
+      return 0;
+    return 1;
+  }
+  return 1;
 }
 
-static void pass_expand_pseudo(void)
+/* Name of section c for the map: its first label. */
+static const char *gc_name(int c)
 {
   int i;
-  for (i = 0; i < line_count; i++)
+  for (i = gc_first[c]; i < gc_first[c + 1]; i++)
+    if (line_kind[i] == LK_LABEL) return line_text[i];
+  return "-";
+}
+
+/* Write the map: one line per section, kept or dropped, and for a kept
+ * section what keeps it.
+ */
+static void gc_write_map(const char *path, int kept)
+{
+  int fd = open_output(path);
+  char buf[2 * LABEL_NAME_LEN + 96];
+  int c;
+  if (fd < 0) { emsg2("cannot open map: ", path); return; }
+  snprintf(buf, sizeof(buf), "; gc-sections: kept %d of %d sections\n",
+           kept, gc_count);
+  IO_WRITE_BYTES(fd, buf, (int)strlen(buf));
+  for (c = 0; c < gc_count; c++)
   {
-    if (line_kind[i] == LK_LOAD32)
-    {
-      unsigned int v = line_value[i];
-      int reg = line_label_off[i];
-      int high = (int)((v >> 16) & 0xFFFF);
-      int low  = (int)(v & 0xFFFF);
-      char buf[64];
-      int sec = line_section[i];
-      int fi  = line_file_idx[i];
+    int w = gc_why[c];
+    const char *file = file_prefix[line_file_idx[gc_first[c]]];
+    const char *why = "fallthrough";
+    if (w == GC_ROOT)  why = "root";
+    else if (w >= 0)   why = gc_name(w);
+    if (w == GC_DROPPED)
+      snprintf(buf, sizeof(buf), "dropped  %-32s %s\n", gc_name(c), file);
+    else
+      snprintf(buf, sizeof(buf), "kept     %-32s %-16s %s\n", gc_name(c),
+               file, why);
+    IO_WRITE_BYTES(fd, buf, (int)strlen(buf));
+  }
+  IO_CLOSE(fd);
+}
 
-      /* Replace this LK_LOAD32 with `load LOW reg` */
-      line_kind[i] = LK_INSTR;
-      snprintf(buf, sizeof(buf), "load %d r%d", low, reg);
-      line_text[i] = pool_strdup(buf);
+static void pass_gc_sections(const char *map_path)
+{
+  int i;
+  int c;
+  int head = 0;
+  int tail = 0;
+  int kept = 0;
+
+  gc_first = (int *)IO_HEAP_ALLOC(sizeof(int) * (line_count + 2));
+  gc_why   = (int *)IO_HEAP_ALLOC(sizeof(int) * (line_count + 1));
+  gc_queue = (int *)IO_HEAP_ALLOC(sizeof(int) * (line_count + 1));
+  gc_sym   = (int *)IO_HEAP_ALLOC(sizeof(int) * SYM_SLOTS);
+  if (!gc_first || !gc_why || !gc_queue || !gc_sym)
+  {
+    emsg("OOM in gc-sections");
+    return;
+  }
+  for (i = 0; i < SYM_SLOTS; i++) gc_sym[i] = -1;
 
-      if (high != 0)
+  /* Split into sections at each directive and at each new file */
+  gc_count = 0;
+  for (i = 0; i < line_count; i++)
+  {
+    if (i == 0 || line_kind[i] == LK_DIR
+        || line_file_idx[i] != line_file_idx[i - 1])
+    {
+      gc_first[gc_count] = i;
+      gc_why[gc_count] = GC_DROPPED;
+      gc_count++;
+    }
+    if (line_kind[i] == LK_LABEL)
+    {
+      int h = sym_find(line_text[i], 0);
+      if (h >= 0) gc_sym[h] = gc_count - 1;
+    }
+  }
+  gc_first[gc_count] = line_count;
+
+  gc_mark_name("Main", 4, GC_ROOT, &tail);
+  while (head < tail)
+  {
+    c = gc_queue[head++];
+    for (i = gc_first[c]; i < gc_first[c + 1]; i++)
+    {
+      const char *t = line_text[i];
+      switch (line_kind[i])
       {
-        if (insert_blank(i + 1) < 0) return;
-        line_kind[i + 1]     = LK_INSTR;
-        snprintf(buf, sizeof(buf), "loadhi %d r%d", high, reg);
-        line_text[i + 1]     = pool_strdup(buf);
-        line_section[i + 1]  = sec;
-        line_file_idx[i + 1] = fi;
+        case LK_INSTR:
+          /* every word of the line that names a label */
+          while (*t)
+          {
+            int n = 0;
+            while (t[n] && is_id_cont((unsigned char)t[n])) n++;
+            if (n == 0) { t++; continue; }
+            if (is_id_start((unsigned char)t[0]))
+              gc_mark_name(t, n, c, &tail);
+            t += n;
+          }
+          break;
+        case LK_DW_LABREF:
+        case LK_INT_LABREF:
+        case LK_ADDR2REG:
+          gc_mark_name(line_label[i], (int)strlen(line_label[i]), c, &tail);
+          break;
+        default:
+          break;
       }
     }
-    else if (line_kind[i] == LK_ADDR2REG)
+    if (line_section[gc_first[c]] == SEC_CODE && gc_falls_through(c))
     {
-      char *label_name = line_label[i];
-      int   off  = line_label_off[i];
-      int   reg  = (int)line_value[i];
-      int   sec  = line_section[i];
-      int   fi   = line_file_idx[i];
+      int f = line_file_idx[gc_first[c]];
+      int k;
+      for (k = c + 1; k < gc_count && line_file_idx[gc_first[k]] == f; k++)
+      {
+        if (line_section[gc_first[k]] != SEC_CODE) continue;
+        gc_mark(k, GC_FALL, &tail);
+        break;
+      }
+    }
+  }
+
+  /* .globl lines are only metadata and always stay */
+  for (c = 0; c < gc_count; c++)
+  {
+    if (gc_why[c] != GC_DROPPED) { kept++; continue; }
+    for (i = gc_first[c]; i < gc_first[c + 1]; i++)
+      if (line_kind[i] != LK_GLOBAL) line_flags[i] |= FLAG_DEAD;
+  }
+  vmsg("gc-sections: kept "); vmsg_int(kept); vmsg(" of ");
+  vmsg_int(gc_count); vmsg(" sections\n");
+  if (map_path) gc_write_map(map_path, kept);
+  remove_dead_lines();
+
+  free(gc_first);
+  free(gc_why);
+  free(gc_queue);
+  free(gc_sym);
+}
+
+/*===========================================================================*/
+/*  Pass 2b: peephole optimizer (-p)                                         */
+/*  Rewrites short instruction sequences from a rule table shared with      */
+/*  ASMPY (asmpy/peephole.py, PEEPHOLE_RULES), so host and on-device builds */
+/*  stay byte-for-byte identical. Keep both tables in sync.                 */
+/*===========================================================================*/
+
+/* Rule syntax (see peephole.py):
+ *   - lines separated by ';' match consecutive input lines token by token
+ *   - %x binds a register, #x a number, @x a label; different register
+ *     variables bind different registers, never one spelled out in the rule
+ *   - label lines ('@x:') may only end a pattern; they are matched but kept
+ *   - the replacement overwrites the first matched lines, the rest are removed
+ */
+struct peep_rule
+{
+  const char *name;
+  const char *pattern;
+  const char *replacement;
+};
+
+static const struct peep_rule peep_rules[] = {
+  { "self-copy",  "or r0 %a %a", "" },
+  { "add-zero",   "add %a 0 %a", "" },
+  { "xor-zero",   "xor %a 0 %a", "" },
+  { "jump-next",  "jump @l ; @l:", "" },
+  { "store-load", "write #n r14 %a ; read #n r14 %a", "write #n r14 %a" },
+  { "store-copy", "write #n r14 %a ; read #n r14 %b",
+                  "write #n r14 %a ; or r0 %a %b" },
+  { "swap-same",  "or r0 %a %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+                  "or r0 %a %b ; or r0 %a r12" },
+  { "swap-same",  "or r0 %b %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+                  "or r0 %b %a ; or r0 %b r12" },
+  { "swap-load",  "load #k %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+                  "or r0 %a r12 ; or r0 %a %b ; load #k %a" },
+  { "swap-copy",  "or r0 %c %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+                  "or r0 %a r12 ; or r0 %a %b ; or r0 %c %a" },
+  { "swap-add",   "add %c #k %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+                  "or r0 %a r12 ; or r0 %a %b ; add %c #k %a" },
+  { "swap-read",  "read #n %c %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+                  "or r0 %a r12 ; or r0 %a %b ; read #n %c %a" },
+  { "swap-load",  "load #k %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+                  "load #k r12 ; or r0 %b %a ; or r0 r12 %b" },
+  { "swap-copy",  "or r0 %c %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+                  "or r0 %c r12 ; or r0 %b %a ; or r0 r12 %b" },
+  { "swap-add",   "add %c #k %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+                  "add %c #k r12 ; or r0 %b %a ; or r0 r12 %b" },
+  { "swap-read",  "read #n %c %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b",
+                  "read #n %c r12 ; or r0 %b %a ; or r0 r12 %b" }
+};
+
+#define PEEP_NUM_RULES ((int)(sizeof(peep_rules) / sizeof(peep_rules[0])))
+#define PEEP_MAX_LINES 5     /* lines in the longest pattern */
+#define PEEP_MAX_TOKS  4     /* tokens in a pattern line */
+#define PEEP_MAX_VARS  8
+
+/* Rules split into lines and tokens (token strings live in str_pool) */
+static char *peep_pat[PEEP_NUM_RULES][PEEP_MAX_LINES][PEEP_MAX_TOKS];
+static int   peep_pat_ntok[PEEP_NUM_RULES][PEEP_MAX_LINES];
+static int   peep_pat_lines[PEEP_NUM_RULES];
+static int   peep_consumed[PEEP_NUM_RULES];   /* lines before trailing labels */
+static char *peep_rep[PEEP_NUM_RULES][PEEP_MAX_LINES][PEEP_MAX_TOKS];
+static int   peep_rep_ntok[PEEP_NUM_RULES][PEEP_MAX_LINES];
+static int   peep_rep_lines[PEEP_NUM_RULES];
+static int   peep_hits[PEEP_NUM_RULES];
+
+/* Tokens of recently inspected lines, slot = line index % PEEP_MAX_LINES */
+static char  peep_buf[PEEP_MAX_LINES][MAX_LINE_LEN];
+static char *peep_toks[PEEP_MAX_LINES][MAX_TOKENS];
+static int   peep_ntok[PEEP_MAX_LINES];
+static int   peep_slot_line[PEEP_MAX_LINES];
+
+/* Variable bindings of the match in progress */
+static char  peep_var[PEEP_MAX_VARS][2];
+static char  peep_val[PEEP_MAX_VARS][LABEL_NAME_LEN];
+static int   peep_nvars;
+
+static int peep_is_reg(const char *s)
+{
+  if (s[0] != 'r' || s[1] < '0' || s[1] > '9') return 0;
+  if (s[2] == 0) return 1;
+  return s[2] >= '0' && s[2] <= '9' && s[3] == 0;
+}
+
+static int peep_is_num(const char *s)
+{
+  if (s[0] == '-') s++;
+  return s[0] >= '0' && s[0] <= '9';
+}
 
-      line_kind[i]       = LK_LOAD_LABEL;
-      line_label[i]      = label_name;
-      line_label_off[i]  = off;
-      line_value[i]      = (unsigned int)reg;
-      line_text[i]       = NULL;
-      line_flags[i]     |= FLAG_LOAD_PAIR;
+static int peep_is_label(const char *s)
+{
+  return ((s[0] >= 'a' && s[0] <= 'z') || (s[0] >= 'A' && s[0] <= 'Z') ||
+          s[0] == '_' || s[0] == '.') && !peep_is_reg(s);
+}
+
+/* Split "a b ; c d" into lines of tokens. Returns the number of lines. */
+static int peep_split(const char *s, char *toks[][PEEP_MAX_TOKS], int *ntok)
+{
+  char *p = pool_strdup(s);
+  int n = 0;
+  if (!p) return 0;
+  while (p)
+  {
+    char *semi = strchr(p, ';');
+    if (semi) *semi = 0;
+    if (n >= PEEP_MAX_LINES) { emsg2("peephole rule too long: ", s); return n; }
+    ntok[n] = tokenize(p, toks[n], PEEP_MAX_TOKS);
+    if (ntok[n] > 0) n++;
+    p = semi ? semi + 1 : NULL;
+  }
+  return n;
+}
+
+static void peep_init(void)
+{
+  int r;
+  for (r = 0; r < PEEP_NUM_RULES; r++)
+  {
+    int n;
+    peep_pat_lines[r] = peep_split(peep_rules[r].pattern, peep_pat[r],
+                                   peep_pat_ntok[r]);
+    peep_rep_lines[r] = peep_split(peep_rules[r].replacement, peep_rep[r],
+                                   peep_rep_ntok[r]);
+    n = peep_pat_lines[r];
+    while (n > 0 && peep_pat[r][n - 1][0][strlen(peep_pat[r][n - 1][0]) - 1] == ':')
+      n--;
+    peep_consumed[r] = n;
+    if (peep_rep_lines[r] > n) emsg2("peephole rule grows code: ", peep_rules[r].name);
+    peep_hits[r] = 0;
+  }
+  for (r = 0; r < PEEP_MAX_LINES; r++) peep_slot_line[r] = -1;
+}
 
-      if (insert_blank(i + 1) < 0) return;
-      line_kind[i + 1]      = LK_LOADHI_LABEL;
-      line_label[i + 1]     = label_name;
-      line_label_off[i + 1] = off;
-      line_value[i + 1]     = (unsigned int)reg;
-      line_section[i + 1]   = sec;
-      line_file_idx[i + 1]  = fi;
-      i++;  /* skip the loadhi */
+/* Tokens of instruction line li, or -1 if it is not an instruction. */
+static int peep_tokens(int li, char ***toks)
+{
+  int slot = li % PEEP_MAX_LINES;
+  if (peep_slot_line[slot] != li)
+  {
+    peep_slot_line[slot] = li;
+    peep_ntok[slot] = -1;
+    if (line_kind[li] == LK_INSTR && line_text[li])
+    {
+      int k = 0;
+      while (line_text[li][k] && k < MAX_LINE_LEN - 1)
+      {
+        peep_buf[slot][k] = line_text[li][k];
+        k++;
+      }
+      peep_buf[slot][k] = 0;
+      peep_ntok[slot] = tokenize(peep_buf[slot], peep_toks[slot], MAX_TOKENS);
     }
   }
+  *toks = peep_toks[slot];
+  return peep_ntok[slot];
+}
+
+static const char *peep_lookup(const char *var)
+{
+  int v;
+  for (v = 0; v < peep_nvars; v++)
+    if (peep_var[v][0] == var[0] && peep_var[v][1] == var[1]) return peep_val[v];
+  return NULL;
+}
+
+static int peep_bind(int r, const char *pt, const char *tok)
+{
+  const char *bound;
+  int v;
+  int l;
+  int t;
+  if (pt[0] != '%' && pt[0] != '#' && pt[0] != '@') return strcmp(pt, tok) == 0;
+  bound = peep_lookup(pt);
+  if (bound) return strcmp(bound, tok) == 0;
+  if (pt[0] == '%')
+  {
+    if (!peep_is_reg(tok)) return 0;
+    for (l = 0; l < peep_pat_lines[r]; l++)
+      for (t = 0; t < peep_pat_ntok[r][l]; t++)
+        if (strcmp(peep_pat[r][l][t], tok) == 0) return 0;
+    for (v = 0; v < peep_nvars; v++)
+      if (peep_var[v][0] == '%' && strcmp(peep_val[v], tok) == 0) return 0;
+  }
+  else if (pt[0] == '#')
+  {
+    if (!peep_is_num(tok)) return 0;
+  }
+  else if (!peep_is_label(tok))
+  {
+    return 0;
+  }
+  if (peep_nvars >= PEEP_MAX_VARS || (int)strlen(tok) >= LABEL_NAME_LEN) return 0;
+  peep_var[peep_nvars][0] = pt[0];
+  peep_var[peep_nvars][1] = pt[1];
+  strcpy(peep_val[peep_nvars], tok);
+  peep_nvars++;
+  return 1;
+}
+
+static int peep_match(int r, const int *window, int nwin)
+{
+  int l;
+  int t;
+  peep_nvars = 0;
+  if (nwin < peep_pat_lines[r]) return 0;
+  for (l = 0; l < peep_pat_lines[r]; l++)
+  {
+    int li = window[l];
+    char **toks;
+    int nt;
+    const char *pt = peep_pat[r][l][0];
+    if (pt[strlen(pt) - 1] == ':')
+    {
+      /* label line '@x:' */
+      char var[LABEL_NAME_LEN];
+      int n = (int)strlen(pt) - 1;
+      if (line_kind[li] != LK_LABEL || n >= LABEL_NAME_LEN) return 0;
+      memcpy(var, pt, (size_t)n);
+      var[n] = 0;
+      if (!peep_bind(r, var, line_text[li])) return 0;
+      continue;
+    }
+    nt = peep_tokens(li, &toks);
+    if (nt != peep_pat_ntok[r][l]) return 0;
+    for (t = 0; t < nt; t++)
+      if (!peep_bind(r, peep_pat[r][l][t], toks[t])) return 0;
+  }
+  return 1;
+}
+
+/* Mark code whose layout is relied upon: a savpc up to the next jump (the
+ * return address is a fixed offset from it), and the span of a branch or
+ * jumpo with a numeric offset.
+ */
+static void peep_pin(void)
+{
+  int i;
+  int j;
+  for (i = 0; i < line_count; i++)
+  {
+    char **toks;
+    int nt = peep_tokens(i, &toks);
+    int off;
+    int remaining;
+    int step;
+    const char *m;
+    if (nt <= 0) continue;
+    m = toks[0];
+    if (strcmp(m, "savpc") == 0)
+    {
+      line_flags[i] |= FLAG_PINNED;
+      for (j = i + 1; j < line_count && line_kind[j] != LK_LABEL; j++)
+      {
+        char **jt;
+        line_flags[j] |= FLAG_PINNED;
+        if (peep_tokens(j, &jt) > 0 &&
+            (strcmp(jt[0], "jump") == 0 || strcmp(jt[0], "jumpo") == 0 ||
+             strcmp(jt[0], "jumpr") == 0 || strcmp(jt[0], "jumpro") == 0))
+          break;
+      }
+      continue;
+    }
+    if (!(m[0] == 'b' || strcmp(m, "jumpo") == 0)) continue;
+    if (m[0] == 'b' &&
+        strcmp(m, "beq") != 0 && strcmp(m, "bne") != 0 &&
+        strcmp(m, "bgt") != 0 && strcmp(m, "bge") != 0 &&
+        strcmp(m, "blt") != 0 && strcmp(m, "ble") != 0 &&
+        strcmp(m, "bgts") != 0 && strcmp(m, "bges") != 0 &&
+        strcmp(m, "blts") != 0 && strcmp(m, "bles") != 0) continue;
+    if (!peep_is_num(toks[nt - 1]) || !parse_number(toks[nt - 1], &off)) continue;
+    line_flags[i] |= FLAG_PINNED;
+    remaining = (off < 0 ? -off : off) / 4;
+    step = off > 0 ? 1 : -1;
+    for (j = i + step; remaining > 0 && j >= 0 && j < line_count; j += step)
+    {
+      line_flags[j] |= FLAG_PINNED;
+      switch (line_kind[j])
+      {
+        case LK_INSTR: case LK_LOAD32: case LK_ADDR2REG: case LK_DW_NUM:
+        case LK_DW_LABREF: case LK_BYTES: case LK_INT_LABREF:
+          remaining--;
+          break;
+        default:
+          break;
+      }
+    }
+  }
+}
+
+static void peep_apply(int r, const int *window)
+{
+  int l;
+  int t;
+  char buf[MAX_LINE_LEN];
+  for (l = 0; l < peep_rep_lines[r]; l++)
+  {
+    int o = 0;
+    for (t = 0; t < peep_rep_ntok[r][l]; t++)
+    {
+      const char *tok = peep_rep[r][l][t];
+      const char *val = (tok[0] == '%' || tok[0] == '#' || tok[0] == '@')
+                        ? peep_lookup(tok) : NULL;
+      o += snprintf(buf + o, sizeof(buf) - (size_t)o, "%s%s",
+                    t ? " " : "", val ? val : tok);
+    }
+    line_text[window[l]] = pool_strdup(buf);
+    peep_slot_line[window[l] % PEEP_MAX_LINES] = -1;
+  }
+  for (; l < peep_consumed[r]; l++) line_flags[window[l]] |= FLAG_DEAD;
+}
+
+static void pass_peephole(void)
+{
+  int i;
+  int r;
+  int k;
+  peep_init();
+  if (has_error) return;
+  peep_pin();
+
+  for (i = 0; i < line_count; i++)
+  {
+    int window[PEEP_MAX_LINES];
+    int nwin = 0;
+    int j;
+    if (line_flags[i] & FLAG_DEAD) continue;
+    for (j = i; j < line_count && nwin < PEEP_MAX_LINES; j++)
+      if (!(line_flags[j] & FLAG_DEAD)) window[nwin++] = j;
+    for (r = 0; r < PEEP_NUM_RULES; r++)
+    {
+      int pinned = 0;
+      if (!peep_match(r, window, nwin)) continue;
+      for (k = 0; k < peep_consumed[r]; k++)
+        if (line_flags[window[k]] & FLAG_PINNED) pinned = 1;
+      if (pinned) continue;
+      peep_apply(r, window);
+      peep_hits[r]++;
+      break;
+    }
+    if (has_error) return;
+  }
+
+  /* Close the gaps left by removed lines, in place */
+  remove_dead_lines();
+
+  /* Hit counts per rule name, in table order */
+  vmsg("Peephole:");
+  for (r = 0; r < PEEP_NUM_RULES; r++)
+  {
+    int n = 0;
+    for (k = 0; k < r; k++)
+      if (strcmp(peep_rules[k].name, peep_rules[r].name) == 0) break;
+    if (k < r) continue;
+    for (k = r; k < PEEP_NUM_RULES; k++)
+      if (strcmp(peep_rules[k].name, peep_rules[r].name) == 0) n += peep_hits[k];
+    vmsg(r ? ", " : " ");
+    vmsg(peep_rules[r].name);
+    vmsg(" ");
+    vmsg_int(n);
+  }
+  vmsg("\n");
 }
 
 /*===========================================================================*/
-/*  Pass 5: pack ELF byte streams into .dw words                             */
-/*  Consecutive LK_BYTES lines (same section) accumulate into one byte run;  */
-/*  it is flushed as packed LK_DW_NUM lines on any boundary (label,          */
-/*  directive, instruction, alignment, LK_INT_LABREF, LK_DW_*, etc.)         */
+/*  Pass 3: prepend header (jump Main, nop, .dw 0)                           */
+/*===========================================================================*/
+
+static void prepend_header(void)
+{
+  /* We need to insert 3 lines at index 0. Easiest: shift existing lines right
+   * by 3 and fill 0..2 with header records. This is O(N); N is small enough.
+   */
+  int i;
+  if (line_count + 3 > MAX_LINES) { emsg("too many lines for header"); return; }
+  for (i = line_count - 1; i >= 0; i--)
+  {
+    line_kind[i + 3]      = line_kind[i];
+    line_text[i + 3]      = line_text[i];
+    line_section[i + 3]   = line_section[i];
+    line_file_idx[i + 3]  = line_file_idx[i];
+    line_value[i + 3]     = line_value[i];
+    line_label[i + 3]     = line_label[i];
+    line_label_off[i + 3] = line_label_off[i];
+    line_byte_off[i + 3]  = line_byte_off[i];
+    line_byte_len[i + 3]  = line_byte_len[i];
+    line_align[i + 3]     = line_align[i];
+    line_dir_sec[i + 3]   = line_dir_sec[i];
+    line_addr[i + 3]      = line_addr[i];
+    line_flags[i + 3]     = line_flags[i];
+  }
+  line_count += 3;
+
+  /* word 0: jump Main — kept absolute and relocated as RELOC_JUMP */
+  line_kind[0]      = LK_INSTR;
+  line_text[0]      = pool_strdup("jump Main");
+  line_section[0]   = SEC_CODE;
+  line_file_idx[0]  = 0;
+  line_value[0]     = 0;
+  line_label[0]     = NULL;
+  line_label_off[0] = 0;
+  line_byte_off[0]  = 0;
+  line_byte_len[0]  = 0;
+  line_align[0]     = 0;
+  line_dir_sec[0]   = SEC_CODE;
+  line_addr[0]      = 0;
+  line_flags[0]     = FLAG_HEADER;
+
+  /* word 1: nop (we always emit nop here for userBDOS — the BDOS loader does
+   * not call user-program interrupt handlers; mirrors ASMPY independent=True)
+   */
+  line_kind[1]      = LK_INSTR;
+  line_text[1]      = pool_strdup("nop");
+  line_section[1]   = SEC_CODE;
+  line_file_idx[1]  = 0;
+  line_value[1]     = 0;
+  line_label[1]     = NULL;
+  line_label_off[1] = 0;
+  line_byte_off[1]  = 0;
+  line_byte_len[1]  = 0;
+  line_align[1]     = 0;
+  line_dir_sec[1]   = SEC_CODE;
+  line_addr[1]      = 0;
+  line_flags[1]     = 0;
+
+  /* word 2: .dw 0 — patched to program_size after layout */
+  line_kind[2]      = LK_DW_NUM;
+  line_text[2]      = NULL;
+  line_section[2]   = SEC_CODE;
+  line_file_idx[2]  = 0;
+  line_value[2]     = 0;
+  line_label[2]     = NULL;
+  line_label_off[2] = 0;
+  line_byte_off[2]  = 0;
+  line_byte_len[2]  = 0;
+  line_align[2]     = 0;
+  line_dir_sec[2]   = SEC_CODE;
+  line_addr[2]      = 0;
+  line_flags[2]     = 0;
+}
+
+/*===========================================================================*/
+/*  Output line arrays                                                       */
 /*===========================================================================*/
 
 /* Build a brand-new line array, walking the existing one. We use a two-list
@@ -1894,47 +2522,6 @@ static void out_emit_dw(unsigned int v, int section, int file_idx)
   out_count++;
 }
 
-/* Flush a pending byte buffer as packed words. The buffer is described by
- * a starting offset (within byte_pool) and a length; we copy in order.
- * Note: bytes from possibly multiple LK_BYTES lines are NOT contiguous in
- * byte_pool, so we accumulate into a temporary.
- */
-static unsigned char pack_tmp[BYTE_POOL_BYTES];
-static int           pack_len;
-static int           pack_section;
-static int           pack_file_idx;
-
-static void pack_flush(void)
-{
-  int i;
-  if (pack_len == 0) return;
-  while (pack_len % 4 != 0) pack_tmp[pack_len++] = 0;
-  for (i = 0; i < pack_len; i += 4)
-  {
-    unsigned int w = (unsigned int)pack_tmp[i]
-                   | ((unsigned int)pack_tmp[i + 1] << 8)
-                   | ((unsigned int)pack_tmp[i + 2] << 16)
-                   | ((unsigned int)pack_tmp[i + 3] << 24);
-    out_emit_dw(w, pack_section, pack_file_idx);
-  }
-  pack_len = 0;
-}
-
-static void pack_append(int byte_off, int byte_len, int section, int file_idx)
-{
-  int k;
-  if (pack_len == 0)
-  {
-    pack_section = section;
-    pack_file_idx = file_idx;
-  }
-  for (k = 0; k < byte_len; k++)
-  {
-    if (pack_len >= (int)sizeof(pack_tmp)) { emsg("pack buffer overflow"); return; }
-    pack_tmp[pack_len++] = byte_pool[byte_off + k];
-  }
-}
-
 static int alloc_out_arrays(void)
 {
   out_kind      = (int *)IO_HEAP_ALLOC(sizeof(int) * MAX_LINES);
@@ -1958,29 +2545,136 @@ static int alloc_out_arrays(void)
     emsg("OOM allocating output line arrays");
     return -1;
   }
-  return 0;
+  return 0;
+}
+
+static void swap_out_to_in(void)
+{
+  int *t_int;
+  char **t_pp;
+  unsigned int *t_uint;
+
+  t_int = line_kind;      line_kind = out_kind;           out_kind = t_int;
+  t_pp  = line_text;      line_text = out_text;           out_text = t_pp;
+  t_int = line_section;   line_section = out_section;     out_section = t_int;
+  t_int = line_file_idx;  line_file_idx = out_file_idx;   out_file_idx = t_int;
+  t_uint = line_value;    line_value = out_value;         out_value = t_uint;
+  t_pp  = line_label;     line_label = out_label;         out_label = t_pp;
+  t_int = line_label_off; line_label_off = out_label_off; out_label_off = t_int;
+  t_int = line_byte_off;  line_byte_off = out_byte_off;   out_byte_off = t_int;
+  t_int = line_byte_len;  line_byte_len = out_byte_len;   out_byte_len = t_int;
+  t_int = line_align;     line_align = out_align;         out_align = t_int;
+  t_int = line_dir_sec;   line_dir_sec = out_dir_sec;     out_dir_sec = t_int;
+  t_int = line_addr;      line_addr = out_addr;           out_addr = t_int;
+  t_int = line_flags;     line_flags = out_flags;         out_flags = t_int;
+  line_count = out_count;
+}
+
+/*===========================================================================*/
+/*  Pass 4: expand pseudo-instructions (load32, addr2reg)                    */
+/*===========================================================================*/
+
+/* Expand each addr2reg/load32 record into 1-2 records, copying the lines to
+ * the out arrays in one walk.
+ */
+static void pass_expand_pseudo(void)
+{
+  int i;
+  char buf[64];
+  out_count = 0;
+  for (i = 0; i < line_count; i++)
+  {
+    if (out_count + 2 > MAX_LINES) { emsg("line array full"); return; }
+    out_clone_from(i);
+    if (line_kind[i] == LK_LOAD32)
+    {
+      unsigned int v = line_value[i];
+      int reg = line_label_off[i];
+      int high = (int)((v >> 16) & 0xFFFF);
+      int low  = (int)(v & 0xFFFF);
+      int o = out_count - 1;
+
+      /* Replace this LK_LOAD32 with `load LOW reg` */
+      out_kind[o] = LK_INSTR;
+      snprintf(buf, sizeof(buf), "load %d r%d", low, reg);
+      out_text[o] = pool_strdup(buf);
+
+      if (high != 0)
+      {
+        out_clone_from(i);
+        o++;
+        out_kind[o] = LK_INSTR;
+        snprintf(buf, sizeof(buf), "loadhi %d r%d", high, reg);
+        out_text[o] = pool_strdup(buf);
+        out_value[o] = 0;
+        out_label_off[o] = 0;
+        out_flags[o] = 0;
+      }
+    }
+    else if (line_kind[i] == LK_ADDR2REG)
+    {
+      int o = out_count - 1;
+
+      out_kind[o]   = LK_LOAD_LABEL;
+      out_text[o]   = NULL;
+      out_flags[o] |= FLAG_LOAD_PAIR;
+
+      out_clone_from(i);
+      o++;
+      out_kind[o]  = LK_LOADHI_LABEL;
+      out_text[o]  = NULL;
+      out_flags[o] = 0;
+    }
+  }
+  swap_out_to_in();
+}
+
+/*===========================================================================*/
+/*  Pass 5: pack ELF byte streams into .dw words                             */
+/*  Consecutive LK_BYTES lines (same section) accumulate into one byte run;  */
+/*  it is flushed as packed LK_DW_NUM lines on any boundary (label,          */
+/*  directive, instruction, alignment, LK_INT_LABREF, LK_DW_*, etc.)         */
+/*===========================================================================*/
+
+/* Flush a pending byte buffer as packed words. The buffer is described by
+ * a starting offset (within byte_pool) and a length; we copy in order.
+ * Note: bytes from possibly multiple LK_BYTES lines are NOT contiguous in
+ * byte_pool, so we accumulate into a temporary.
+ */
+static unsigned char pack_tmp[BYTE_POOL_BYTES];
+static int           pack_len;
+static int           pack_section;
+static int           pack_file_idx;
+
+static void pack_flush(void)
+{
+  int i;
+  if (pack_len == 0) return;
+  while (pack_len % 4 != 0) pack_tmp[pack_len++] = 0;
+  for (i = 0; i < pack_len; i += 4)
+  {
+    unsigned int w = (unsigned int)pack_tmp[i]
+                   | ((unsigned int)pack_tmp[i + 1] << 8)
+                   | ((unsigned int)pack_tmp[i + 2] << 16)
+                   | ((unsigned int)pack_tmp[i + 3] << 24);
+    out_emit_dw(w, pack_section, pack_file_idx);
+  }
+  pack_len = 0;
 }
 
-static void swap_out_to_in(void)
+static void pack_append(int byte_off, int byte_len, int section, int file_idx)
 {
-  int *t_int;
-  char **t_pp;
-  unsigned int *t_uint;
-
-  t_int = line_kind;      line_kind = out_kind;           out_kind = t_int;
-  t_pp  = line_text;      line_text = out_text;           out_text = t_pp;
-  t_int = line_section;   line_section = out_section;     out_section = t_int;
-  t_int = line_file_idx;  line_file_idx = out_file_idx;   out_file_idx = t_int;
-  t_uint = line_value;    line_value = out_value;         out_value = t_uint;
-  t_pp  = line_label;     line_label = out_label;         out_label = t_pp;
-  t_int = line_label_off; line_label_off = out_label_off; out_label_off = t_int;
-  t_int = line_byte_off;  line_byte_off = out_byte_off;   out_byte_off = t_int;
-  t_int = line_byte_len;  line_byte_len = out_byte_len;   out_byte_len = t_int;
-  t_int = line_align;     line_align = out_align;         out_align = t_int;
-  t_int = line_dir_sec;   line_dir_sec = out_dir_sec;     out_dir_sec = t_int;
-  t_int = line_addr;      line_addr = out_addr;           out_addr = t_int;
-  t_int = line_flags;     line_flags = out_flags;         out_flags = t_int;
-  line_count = out_count;
+  int k;
+  if (pack_len == 0)
+  {
+    pack_section = section;
+    pack_file_idx = file_idx;
+  }
+  for (k = 0; k < byte_len; k++)
+  {
+    if (pack_len >= (int)sizeof(pack_tmp)) { emsg("pack buffer overflow"); return; }
+    pack_tmp[pack_len++] = byte_pool[byte_off + k];
+  }
 }
 
 static void pass_pack_elf(void)
@@ -2040,10 +2734,11 @@ static void pass_remove_meta_and_sort(void)
  * Each line is one word (4 bytes). We track the running byte address. When we
  * encounter a LK_BALIGN, we need to advance to a multiple of `n`. Since each
  * "real" line emits 4 bytes, alignment to 1, 2, or 4 is automatic. Higher
- * alignments would require padding by emitting extra words. We assert n <= 4
- * for now (QBE only emits .balign 1 and .balign 4).
+ * alignments (QBE emits .balign 8 for 64-bit data) are not needed by B32P3,
+ * which has no wider accesses, and ASMPY drops them too; we do the same so
+ * both produce identical binaries.
  *
- * For convenience we just drop LK_BALIGN lines after verification.
+ * For convenience we just drop LK_BALIGN lines.
  */
 static void pass_handle_balign(void)
 {
@@ -2051,16 +2746,7 @@ static void pass_handle_balign(void)
   out_count = 0;
   for (i = 0; i < line_count; i++)
   {
-    if (line_kind[i] == LK_BALIGN)
-    {
-      int n = line_align[i];
-      if (n > 4)
-      {
-        emsg(".balign > 4 not supported by asm-link");
-        return;
-      }
-      continue;
-    }
+    if (line_kind[i] == LK_BALIGN) continue;
     out_clone_from(i);
   }
   swap_out_to_in();
@@ -2087,7 +2773,7 @@ static void pass_extract_labels(void)
       idx = add_label(line_text[i], line_file_idx[i]);
       if (idx < 0) return;
       label_addr[idx] = byte_addr;
-      if (is_global_name(line_text[i])) label_global[idx] = 1;
+      label_sec[idx] = line_section[i];
       continue;  /* drop label line */
     }
     out_clone_from(i);
@@ -2110,6 +2796,48 @@ static int find_label_or_err(const char *name)
   return idx;
 }
 
+/* Resolve a reference of kind OREL_* from the word at byte_addr (in section
+ * sec) to name + addend, into *addr. Returns -1 if the symbol is undefined.
+ *
+ * With -c, only pc-relative references to a label in the same section of
+ * this file are resolved; the others become object relocations, and
+ * undefined names become external symbols. *addr is then a placeholder that
+ * encodes as a zero field, and the object linker fills the field in.
+ */
+static int label_ref(const char *name, int kind, int addend, int byte_addr,
+                     int sec, int *addr)
+{
+  int idx;
+  if (!assemble_only)
+  {
+    idx = find_label_or_err(name);
+    if (idx < 0) return -1;
+    *addr = label_addr[idx] + addend;
+    return 0;
+  }
+  idx = find_label(name);
+  if (idx >= 0 && label_sec[idx] == sec
+      && (kind == OREL_JUMP || kind == OREL_BRANCH))
+  {
+    *addr = label_addr[idx] + addend;
+    return 0;
+  }
+  if (idx < 0)
+  {
+    idx = add_label(name, 0);
+    if (idx < 0) return -1;
+    label_sec[idx] = OSEC_UNDEF;
+  }
+  if (obj_reloc_count >= MAX_RELOCS) { emsg("too many relocations"); return -1; }
+  obj_relocs[obj_reloc_count * 3 + 0] =
+    ((unsigned int)byte_addr << 8) | (unsigned int)kind;
+  obj_relocs[obj_reloc_count * 3 + 1] = (unsigned int)idx;
+  obj_relocs[obj_reloc_count * 3 + 2] = (unsigned int)addend;
+  obj_reloc_count++;
+  *addr = (kind == OREL_JUMP || kind == OREL_BRANCH) ? byte_addr : 0;
+  return 0;
+}
+
 /* Add a relocation entry for byte_offset in the output, of given type. */
 static void add_reloc(int byte_offset, int type)
 {
@@ -2121,15 +2849,15 @@ static void add_reloc(int byte_offset, int type)
 /* Encode load (or loadhi) of label-low/label-high. Called for both
  * LK_LOAD_LABEL and LK_LOADHI_LABEL.
  */
-static unsigned int encode_load_label(int li, int high_half)
+static unsigned int encode_load_label(int li, int high_half, int byte_addr)
 {
   int reg = (int)line_value[li];
-  int lab_idx = find_label_or_err(line_label[li]);
   int target;
   unsigned int hi;
   unsigned int op;
-  if (lab_idx < 0) return 0;
-  target = label_addr[lab_idx] + line_label_off[li];
+  if (label_ref(line_label[li], high_half ? OREL_HI : OREL_LO,
+                line_label_off[li], byte_addr, line_section[li], &target) < 0)
+    return 0;
   if (high_half) hi = (unsigned int)((target >> 16) & 0xFFFF);
   else           hi = (unsigned int)(target & 0xFFFF);
   op = high_half ? ARITH_LOADHI : ARITH_LOAD;
@@ -2250,11 +2978,9 @@ static unsigned int encode_instr(int li, int byte_addr)
       return (OP_JUMP << 28) | (((unsigned)val & 0x7FFFFFFu) << 1);
     }
     /* label */
-    {
-      int lab_idx = find_label_or_err(toks[1]);
-      if (lab_idx < 0) return 0;
-      target = label_addr[lab_idx];
-    }
+    if (label_ref(toks[1], OREL_JUMP, 0, byte_addr, line_section[li],
+                  &target) < 0)
+      return 0;
     if (is_header)
     {
       /* Keep absolute, mark relocatable */
@@ -2321,9 +3047,11 @@ static unsigned int encode_instr(int li, int byte_addr)
       }
       else
       {
-        int lab_idx = find_label_or_err(toks[3]);
-        if (lab_idx < 0) return 0;
-        rel = label_addr[lab_idx] - byte_addr;
+        int target;
+        if (label_ref(toks[3], OREL_BRANCH, 0, byte_addr, line_section[li],
+                      &target) < 0)
+          return 0;
+        rel = target - byte_addr;
       }
       return (OP_BRANCH << 28) | (((unsigned)rel & 0xFFFFu) << 12) |
              (((unsigned)reg_a & 0xFu) << 8) | (((unsigned)reg_b & 0xFu) << 4) |
@@ -2386,9 +3114,10 @@ static unsigned int encode_instr(int li, int byte_addr)
     else
     {
       /* label argument — record reloc as load+loadhi pair */
-      int lab_idx = find_label_or_err(toks[1]);
-      if (lab_idx < 0) return 0;
-      val = label_addr[lab_idx] & 0xFFFF;
+      if (label_ref(toks[1], OREL_LO, 0, byte_addr, line_section[li],
+                    &val) < 0)
+        return 0;
+      val &= 0xFFFF;
       add_reloc(byte_addr, RELOC_LOAD_PAIR);
     }
     return (OP_ARITHC << 28) | (ARITH_LOAD << 24) |
@@ -2408,9 +3137,10 @@ static unsigned int encode_instr(int li, int byte_addr)
     }
     else
     {
-      int lab_idx = find_label_or_err(toks[1]);
-      if (lab_idx < 0) return 0;
-      val = (label_addr[lab_idx] >> 16) & 0xFFFF;
+      if (label_ref(toks[1], OREL_HI, 0, byte_addr, line_section[li],
+                    &val) < 0)
+        return 0;
+      val = (val >> 16) & 0xFFFF;
       /* No reloc here; the paired load already recorded RELOC_LOAD_PAIR. */
     }
     return (OP_ARITHC << 28) | (ARITH_LOADHI << 24) |
@@ -2437,197 +3167,769 @@ static unsigned int encode_instr(int li, int byte_addr)
   else if (strcmp(m, "mulshi")  == 0) arith = ARITHM_MULSHI;
   else if (strcmp(m, "multuhi") == 0) arith = ARITHM_MULTUHI;
 
-  if (arith >= 0)
+  if (arith >= 0)
+  {
+    if (nt != 4) { emsg2("multi-cycle arith needs 3 args: ", line_text[li]); return 0; }
+    reg_a = parse_register(toks[1]);
+    reg_d = parse_register(toks[3]);
+    if (reg_a < 0 || reg_d < 0) { emsg("mc-arith bad reg"); return 0; }
+    reg_b = parse_register(toks[2]);
+    if (reg_b >= 0)
+    {
+      return (OP_ARITHMC << 28) | ((unsigned)(arith & 0xF) << 24) |
+             (((unsigned)reg_a & 0xFu) << 8) | (((unsigned)reg_b & 0xFu) << 4) |
+             ((unsigned)reg_d & 0xFu);
+    }
+    if (!parse_number(toks[2], &val)) { emsg2("mc-arith bad imm: ", line_text[li]); return 0; }
+    return (OP_ARITHM << 28) | ((unsigned)(arith & 0xF) << 24) |
+           (((unsigned)val & 0xFFFFu) << 8) | (((unsigned)reg_a & 0xFu) << 4) |
+           ((unsigned)reg_d & 0xFu);
+  }
+
+  emsg2("unknown instruction: ", line_text[li]);
+  return 0;
+}
+
+/*===========================================================================*/
+/*  Pass 9: encode all lines                                                 */
+/*===========================================================================*/
+
+static void pass_encode(void)
+{
+  int i;
+  int byte_addr;
+
+  output_count = 0;
+  reloc_count = 0;
+  byte_addr = 0;
+
+  for (i = 0; i < line_count; i++)
+  {
+    unsigned int w = 0;
+    switch (line_kind[i])
+    {
+      case LK_INSTR:
+        w = encode_instr(i, byte_addr);
+        break;
+
+      case LK_DW_NUM:
+        w = line_value[i];
+        break;
+
+      case LK_DW_LABREF:
+      case LK_INT_LABREF:
+      {
+        int target;
+        if (label_ref(line_label[i], OREL_WORD, line_label_off[i], byte_addr,
+                      line_section[i], &target) < 0)
+        {
+          has_error = 1; w = 0; break;
+        }
+        w = (unsigned int)target;
+        add_reloc(byte_addr, RELOC_DATA_WORD);
+        break;
+      }
+
+      case LK_LOAD_LABEL:
+        w = encode_load_label(i, 0, byte_addr);
+        if (line_flags[i] & FLAG_LOAD_PAIR)
+          add_reloc(byte_addr, RELOC_LOAD_PAIR);
+        break;
+
+      case LK_LOADHI_LABEL:
+        w = encode_load_label(i, 1, byte_addr);
+        break;
+
+      default:
+        emsg("internal: unhandled line kind in encode pass");
+        return;
+    }
+    if (output_count >= OUTPUT_WORDS) { emsg("output too large"); return; }
+    output_words[output_count++] = w;
+    byte_addr += 4;
+    if (has_error) return;
+  }
+
+  /* Patch header word 2 with program size in words. */
+  if (!assemble_only && output_count >= 3)
+  {
+    output_words[2] = (unsigned int)output_count;
+  }
+}
+
+/*===========================================================================*/
+/*  Pass 10: append relocation table                                         */
+/*===========================================================================*/
+
+/* pass_encode() resolves every label as it emits each word and adds the
+ * relocations in address order, so the table is already sorted by
+ * byte_offset.
+ */
+static void pass_append_reloc(void)
+{
+  int i;
+  if (reloc_count == 0) return;
+  if (output_count + 1 + reloc_count > OUTPUT_WORDS)
+  {
+    emsg("output too large for reloc table");
+    return;
+  }
+  output_words[output_count++] = (unsigned int)reloc_count;
+  for (i = 0; i < reloc_count; i++)
+  {
+    output_words[output_count++] = reloc_entries[i];
+  }
+}
+
+/*===========================================================================*/
+/*  Output                                                                   */
+/*===========================================================================*/
+
+static int write_words(const char *path, unsigned int *words, int count)
+{
+  int fd;
+  int total = 0;
+  int rem = 0;
+  int chunk = 0;
+  int wrote = 0;
+  int i;
+
+  fd = open_output(path);
+  if (fd < 0) { emsg2("cannot open output: ", path); return -1; }
+
+#ifdef ASMLINK_HOST
+  /* On host: emit little-endian words, the same bytes as the on-device
+   * build and the perl pack("V") step of compile_modern_c.sh. */
+  {
+    unsigned char *buf = (unsigned char *)malloc((size_t)count * 4);
+    for (i = 0; i < count; i++)
+    {
+      unsigned int v = words[i];
+      buf[i * 4 + 0] = (unsigned char)(v & 0xFF);
+      buf[i * 4 + 1] = (unsigned char)((v >> 8) & 0xFF);
+      buf[i * 4 + 2] = (unsigned char)((v >> 16) & 0xFF);
+      buf[i * 4 + 3] = (unsigned char)((v >> 24) & 0xFF);
+    }
+    fwrite(buf, 1, (size_t)count * 4, host_files[fd]);
+    free(buf);
+    IO_CLOSE(fd);
+    (void)total; (void)rem; (void)chunk; (void)wrote;
+    return count;
+  }
+#else
+  /* On BDOS: write words via the byte-mode wrapper. The CPU is little-endian
+   * so writing output_words directly puts bytes on disk in LE-word order,
+   * which is what the slot loader expects when it reads them back. */
+  total = 0;
+  rem = count;
+  while (rem > 0)
+  {
+    chunk = rem;
+    if (chunk > 256) chunk = 256;
+    wrote = IO_WRITE_WORDS(fd, &words[total], chunk);
+    if (wrote <= 0) { emsg("write failed"); IO_CLOSE(fd); return -1; }
+    total += wrote;
+    rem -= wrote;
+  }
+  IO_CLOSE(fd);
+  return total;
+#endif
+}
+
+static int write_output(const char *path)
+{
+  return write_words(path, output_words, output_count);
+}
+
+/*===========================================================================*/
+/*  Object files and archives                                                */
+/*  -c writes the encoded words of one file with its symbols and the label  */
+/*  references left open; -a bundles objects into an archive with a symbol */
+/*  index. Linking objects only places their sections and patches those     */
+/*  references, and pulls from archives just the members that define a     */
+/*  symbol still undefined.                                                 */
+/*===========================================================================*/
+
+#define MAX_OBJS      128
+#define MAX_ARCHIVES  8
+
+struct link_obj
+{
+  const char   *name;                  /* file or archive member */
+  unsigned int *words;                 /* section words, in section order */
+  unsigned int *syms;
+  unsigned int *relocs;
+  char         *strtab;
+  int           nsyms;
+  int           nrelocs;
+  int           sec_off[NUM_SECTIONS]; /* byte offset of each section */
+  int           sec_words[NUM_SECTIONS];
+  int           place[NUM_SECTIONS];   /* byte address in the output */
+};
+
+struct link_arc
+{
+  const char   *path;
+  int           fd;
+  unsigned int *members;               /* member table, index, strtab */
+  unsigned int *index;
+  char         *strtab;
+  int           nmembers;
+  int           nindex;
+  char         *loaded;                /* per member */
+};
+
+static struct link_obj link_objs[MAX_OBJS];
+static int             link_obj_count;
+static struct link_arc link_arcs[MAX_ARCHIVES];
+static int             link_arc_count;
+
+/* Section layout of the encoded file: count the words of each section. */
+static void obj_section_words(int *sec_words)
+{
+  int i;
+  for (i = 0; i < NUM_SECTIONS; i++) sec_words[i] = 0;
+  for (i = 0; i < line_count; i++) sec_words[line_section[i]]++;
+}
+
+/* Build the object image of output_words, the label table and obj_relocs;
+ * sets *nwords to its size.
+ */
+static unsigned int *build_object(int *nwords)
+{
+  unsigned int *obj;
+  unsigned int *p;
+  char *str;
+  int sec_words[NUM_SECTIONS];
+  int str_bytes = 0;
+  int str_words;
+  int total;
+  int i;
+  int pos;
+
+  obj_section_words(sec_words);
+  for (i = 0; i < label_count; i++)
+    str_bytes += (int)strlen(label_names[i]) + 1;
+  str_words = (str_bytes + 3) / 4;
+  total = OBJ_HDR_WORDS + output_count + label_count * 3 +
+          obj_reloc_count * 3 + str_words;
+  obj = (unsigned int *)IO_HEAP_ALLOC(sizeof(unsigned int) * total);
+  if (!obj) { emsg("OOM writing object"); return NULL; }
+
+  obj[0] = OBJ_MAGIC;
+  for (i = 0; i < NUM_SECTIONS; i++) obj[1 + i] = (unsigned int)sec_words[i];
+  obj[5] = (unsigned int)label_count;
+  obj[6] = (unsigned int)obj_reloc_count;
+  obj[7] = (unsigned int)str_words;
+  p = obj + OBJ_HDR_WORDS;
+  for (i = 0; i < output_count; i++) *p++ = output_words[i];
+
+  str = (char *)(p + label_count * 3 + obj_reloc_count * 3);
+  for (i = 0; i < str_words; i++) ((unsigned int *)str)[i] = 0;
+  pos = 0;
+  for (i = 0; i < label_count; i++)
+  {
+    const char *nm = label_names[i];
+    int bind;
+    if (label_global[i])                   bind = OSYM_GLOBAL;
+    else if (nm[0] == '.' && nm[1] == 'L') bind = OSYM_LOCAL;
+    else                                   bind = OSYM_PLAIN;
+    *p++ = (unsigned int)pos;
+    *p++ = ((unsigned int)bind << 8) | ((unsigned int)label_sec[i] & 0xFFu);
+    *p++ = label_sec[i] == OSEC_UNDEF ? 0u : (unsigned int)label_addr[i];
+    strcpy(&str[pos], nm);
+    pos += (int)strlen(nm) + 1;
+  }
+  for (i = 0; i < obj_reloc_count * 3; i++) *p++ = obj_relocs[i];
+
+  *nwords = total;
+  return obj;
+}
+
+/* -c: write the object image to path. */
+static int write_object(const char *path)
+{
+  int nwords;
+  unsigned int *obj = build_object(&nwords);
+  if (!obj) return -1;
+  return write_words(path, obj, nwords);
+}
+
+/* Check an object image and set up o. Returns -1 if it is malformed. */
+static int obj_open(struct link_obj *o, const char *name, unsigned int *img,
+                    int nwords)
+{
+  int i;
+  int off = 0;
+  int body = 0;
+  int str_words;
+
+  o->name = name;
+  if (nwords < OBJ_HDR_WORDS || img[0] != OBJ_MAGIC)
+  {
+    emsg2("not an object file: ", name);
+    return -1;
+  }
+  for (i = 0; i < NUM_SECTIONS; i++)
+  {
+    o->sec_words[i] = (int)img[1 + i];
+    o->sec_off[i] = off;
+    off += o->sec_words[i] * 4;
+    body += o->sec_words[i];
+  }
+  o->nsyms = (int)img[5];
+  o->nrelocs = (int)img[6];
+  str_words = (int)img[7];
+  if (OBJ_HDR_WORDS + body + o->nsyms * 3 + o->nrelocs * 3 + str_words > nwords)
+  {
+    emsg2("truncated object file: ", name);
+    return -1;
+  }
+  o->words = img + OBJ_HDR_WORDS;
+  o->syms = o->words + body;
+  o->relocs = o->syms + o->nsyms * 3;
+  o->strtab = (char *)(o->relocs + o->nrelocs * 3);
+  return 0;
+}
+
+/* Add an object to the link and enter its symbols in the symbol table:
+ * sym_def_file/sym_label hold the defining object and its symbol index,
+ * SYM_WANTED marks names that some object references.
+ */
+static int link_add_object(const char *name, unsigned int *img, int nwords)
+{
+  struct link_obj *o;
+  int i;
+
+  if (link_obj_count >= MAX_OBJS) { emsg("too many objects"); return -1; }
+  o = &link_objs[link_obj_count];
+  if (obj_open(o, name, img, nwords) < 0) return -1;
+
+  for (i = 0; i < o->nsyms; i++)
   {
-    if (nt != 4) { emsg2("multi-cycle arith needs 3 args: ", line_text[li]); return 0; }
-    reg_a = parse_register(toks[1]);
-    reg_d = parse_register(toks[3]);
-    if (reg_a < 0 || reg_d < 0) { emsg("mc-arith bad reg"); return 0; }
-    reg_b = parse_register(toks[2]);
-    if (reg_b >= 0)
+    char *nm = o->strtab + o->syms[i * 3];
+    int bind = (int)(o->syms[i * 3 + 1] >> 8);
+    int sec = (int)(o->syms[i * 3 + 1] & 0xFFu);
+    int h;
+    if (bind == OSYM_LOCAL) continue;
+    h = sym_find(nm, 1);
+    if (h < 0) return -1;
+    if (sec == OSEC_UNDEF)
     {
-      return (OP_ARITHMC << 28) | ((unsigned)(arith & 0xF) << 24) |
-             (((unsigned)reg_a & 0xFu) << 8) | (((unsigned)reg_b & 0xFu) << 4) |
-             ((unsigned)reg_d & 0xFu);
+      sym_flags[h] |= SYM_WANTED;
+      continue;
     }
-    if (!parse_number(toks[2], &val)) { emsg2("mc-arith bad imm: ", line_text[li]); return 0; }
-    return (OP_ARITHM << 28) | ((unsigned)(arith & 0xF) << 24) |
-           (((unsigned)val & 0xFFFFu) << 8) | (((unsigned)reg_a & 0xFu) << 4) |
-           ((unsigned)reg_d & 0xFu);
+    if (sym_def_file[h] < 0)
+    {
+      sym_def_file[h] = link_obj_count;
+      sym_label[h] = i;
+    }
+    else if (bind == OSYM_GLOBAL || (sym_flags[h] & SYM_GLOBAL))
+    {
+      emsg2("duplicate label: ", nm);
+      return -1;
+    }
+    else
+    {
+      /* Same as a conflict between .asm files: each definer keeps its own
+       * (already resolved to the defining object), nobody else sees one. */
+      sym_flags[h] |= SYM_CONFLICT;
+    }
+    if (bind == OSYM_GLOBAL) sym_flags[h] |= SYM_GLOBAL;
   }
-
-  emsg2("unknown instruction: ", line_text[li]);
+  link_obj_count++;
   return 0;
 }
 
-/*===========================================================================*/
-/*  Pass 9: encode all lines                                                 */
-/*===========================================================================*/
+/* Read n words at byte offset off of fd into buf. */
+static int read_words_at(int fd, int off, unsigned int *buf, int n)
+{
+  int total = 0;
+  int chunk;
+  int got;
+  if (IO_SEEK(fd, off) < 0) return -1;
+  while (total < n)
+  {
+    chunk = n - total;
+    if (chunk > 256) chunk = 256;
+    got = IO_READ_WORDS(fd, &buf[total], chunk);
+    if (got <= 0) return -1;
+    total += got;
+  }
+  return 0;
+}
 
-static void pass_encode(void)
+/* Open an archive and read its member table, index and string table. */
+static int link_add_archive(const char *path)
 {
+  struct link_arc *a;
+  unsigned int hdr[ARC_HDR_WORDS];
+  int nwords;
   int i;
-  int byte_addr;
 
-  output_count = 0;
-  reloc_count = 0;
-  byte_addr = 0;
+  if (link_arc_count >= MAX_ARCHIVES) { emsg("too many archives"); return -1; }
+  a = &link_arcs[link_arc_count];
+  a->path = path;
+  a->fd = IO_OPEN((char *)path);
+  if (a->fd < 0) { emsg2("cannot open file: ", path); return -1; }
+  if (read_words_at(a->fd, 0, hdr, ARC_HDR_WORDS) < 0 || hdr[0] != ARC_MAGIC)
+  {
+    emsg2("not an archive: ", path);
+    return -1;
+  }
+  a->nmembers = (int)hdr[1];
+  a->nindex = (int)hdr[2];
+  nwords = a->nmembers * 3 + a->nindex * 2 + (int)hdr[3];
+  a->members = (unsigned int *)IO_HEAP_ALLOC(sizeof(unsigned int) * (nwords + 1));
+  a->loaded = (char *)IO_HEAP_ALLOC(a->nmembers + 1);
+  if (!a->members || !a->loaded) { emsg("OOM reading archive"); return -1; }
+  if (read_words_at(a->fd, ARC_HDR_WORDS * 4, a->members, nwords) < 0)
+  {
+    emsg2("truncated archive: ", path);
+    return -1;
+  }
+  a->index = a->members + a->nmembers * 3;
+  a->strtab = (char *)(a->index + a->nindex * 2);
+  for (i = 0; i < a->nmembers; i++) a->loaded[i] = 0;
+  link_arc_count++;
+  return 0;
+}
 
-  for (i = 0; i < line_count; i++)
+/* Link archive members that define a wanted, still undefined symbol, until
+ * none is left; members may need symbols from earlier archives too.
+ */
+static int link_pull_members(void)
+{
+  int pulled = 1;
+  while (pulled)
   {
-    unsigned int w = 0;
-    switch (line_kind[i])
+    int ai;
+    pulled = 0;
+    for (ai = 0; ai < link_arc_count; ai++)
     {
-      case LK_INSTR:
-        w = encode_instr(i, byte_addr);
-        break;
-
-      case LK_DW_NUM:
-        w = line_value[i];
-        break;
-
-      case LK_DW_LABREF:
-      case LK_INT_LABREF:
+      struct link_arc *a = &link_arcs[ai];
+      int e;
+      for (e = 0; e < a->nindex; e++)
       {
-        int lab_idx = find_label_or_err(line_label[i]);
-        if (lab_idx < 0) { has_error = 1; w = 0; break; }
-        w = (unsigned int)(label_addr[lab_idx] + line_label_off[i]);
-        add_reloc(byte_addr, RELOC_DATA_WORD);
-        break;
+        int m = (int)a->index[e * 2 + 1];
+        int h;
+        unsigned int *img;
+        int size;
+        if (a->loaded[m]) continue;
+        h = sym_find(a->strtab + a->index[e * 2], 0);
+        if (h < 0 || !(sym_flags[h] & SYM_WANTED) || sym_def_file[h] >= 0)
+          continue;
+        size = (int)a->members[m * 3 + 1];
+        img = (unsigned int *)IO_HEAP_ALLOC(sizeof(unsigned int) * (size + 1));
+        if (!img) { emsg("OOM reading archive member"); return -1; }
+        if (read_words_at(a->fd, (int)a->members[m * 3], img, size) < 0)
+        {
+          emsg2("truncated archive: ", a->path);
+          return -1;
+        }
+        a->loaded[m] = 1;
+        vmsg("  pulled "); vmsg(a->strtab + a->members[m * 3 + 2]);
+        vmsg(" from "); vmsg(a->path); vmsg("\n");
+        if (link_add_object(a->strtab + a->members[m * 3 + 2], img, size) < 0)
+          return -1;
+        pulled = 1;
       }
-
-      case LK_LOAD_LABEL:
-        w = encode_load_label(i, 0);
-        if (line_flags[i] & FLAG_LOAD_PAIR)
-          add_reloc(byte_addr, RELOC_LOAD_PAIR);
-        break;
-
-      case LK_LOADHI_LABEL:
-        w = encode_load_label(i, 1);
-        break;
-
-      default:
-        emsg("internal: unhandled line kind in encode pass");
-        return;
     }
-    if (output_count >= OUTPUT_WORDS) { emsg("output too large"); return; }
-    output_words[output_count++] = w;
-    byte_addr += 4;
-    if (has_error) return;
   }
+  for (pulled = 0; pulled < link_arc_count; pulled++)
+    IO_CLOSE(link_arcs[pulled].fd);
+  return 0;
+}
 
-  /* Patch header word 2 with program size in words. */
-  if (output_count >= 3)
+/* Final address of symbol si of object o, following externals to their
+ * definition.
+ */
+static int link_sym_addr(struct link_obj *o, int si, int *addr)
+{
+  char *nm = o->strtab + o->syms[si * 3];
+  int sec = (int)(o->syms[si * 3 + 1] & 0xFFu);
+  if (sec == OSEC_UNDEF)
   {
-    output_words[2] = (unsigned int)output_count;
+    int h = sym_find(nm, 0);
+    if (h < 0 || sym_def_file[h] < 0 || (sym_flags[h] & SYM_CONFLICT))
+    {
+      emsg2("undefined symbol: ", nm);
+      return -1;
+    }
+    o = &link_objs[sym_def_file[h]];
+    si = sym_label[h];
+    sec = (int)(o->syms[si * 3 + 1] & 0xFFu);
+  }
+  if (sec >= NUM_SECTIONS)
+  {
+    emsg2("bad symbol section: ", nm);
+    return -1;
   }
+  *addr = o->place[sec] + (int)o->syms[si * 3 + 2] - o->sec_off[sec];
+  return 0;
 }
 
-/*===========================================================================*/
-/*  Pass 10: append relocation table                                         */
-/*===========================================================================*/
+/* Write the address target into the field of *w that reloc kind names, for
+ * the word at byte address pc.
+ */
+static void link_patch(unsigned int *w, int kind, int target, int pc)
+{
+  unsigned int v = (unsigned int)target;
+  unsigned int rel = (unsigned int)(target - pc);
+  switch (kind)
+  {
+    case OREL_WORD:
+      *w = v;
+      add_reloc(pc, RELOC_DATA_WORD);
+      break;
+    case OREL_LO:
+      *w = (*w & ~(0xFFFFu << 8)) | ((v & 0xFFFFu) << 8);
+      add_reloc(pc, RELOC_LOAD_PAIR);
+      break;
+    case OREL_HI:
+      *w = (*w & ~(0xFFFFu << 8)) | (((v >> 16) & 0xFFFFu) << 8);
+      break;
+    case OREL_JUMP:
+      *w = (*w & ~(0x7FFFFFFu << 1)) | ((rel & 0x7FFFFFFu) << 1);
+      break;
+    case OREL_BRANCH:
+      *w = (*w & ~(0xFFFFu << 12)) | ((rel & 0xFFFFu) << 12);
+      break;
+    default:
+      emsg("bad object relocation");
+      break;
+  }
+}
 
-/* Sort reloc entries by byte_offset (ascending). Used to make output
- * deterministic. Selection sort is fine for the typical sizes (<= 16K).
+/* Lay out the linked objects section by section, in the same order as a
+ * link of their .asm files, and patch the references between them.
  */
-static void sort_relocs(void)
+static void link_objects(void)
 {
-  int i, j, min_idx;
-  unsigned int tmp;
-  for (i = 0; i < reloc_count - 1; i++)
+  int addr = 12;   /* after the header */
+  int sec;
+  int k;
+  int main_addr;
+  int h;
+
+  for (sec = 0; sec < NUM_SECTIONS; sec++)
+  {
+    for (k = 0; k < link_obj_count; k++)
+    {
+      link_objs[k].place[sec] = addr;
+      addr += link_objs[k].sec_words[sec] * 4;
+    }
+  }
+  if (addr / 4 > OUTPUT_WORDS) { emsg("output too large"); return; }
+
+  /* Header: jump Main, nop, program size */
+  h = sym_find("Main", 0);
+  if (h < 0 || sym_def_file[h] < 0)
+  {
+    emsg2("undefined symbol: ", "Main");
+    return;
+  }
+  if (link_sym_addr(&link_objs[sym_def_file[h]], sym_label[h], &main_addr) < 0)
+    return;
+  output_count = 0;
+  reloc_count = 0;
+  add_reloc(0, RELOC_JUMP);
+  output_words[output_count++] =
+    (OP_JUMP << 28) | (((unsigned)main_addr & 0x7FFFFFFu) << 1);
+  output_words[output_count++] = 0u;
+  output_words[output_count++] = (unsigned int)(addr / 4);
+
+  for (sec = 0; sec < NUM_SECTIONS; sec++)
   {
-    min_idx = i;
-    for (j = i + 1; j < reloc_count; j++)
+    for (k = 0; k < link_obj_count; k++)
     {
-      if (reloc_entries[j] < reloc_entries[min_idx]) min_idx = j;
+      struct link_obj *o = &link_objs[k];
+      int first = output_count;
+      int lo = o->sec_off[sec];
+      int hi = lo + o->sec_words[sec] * 4;
+      int r;
+      int i;
+      for (i = 0; i < o->sec_words[sec]; i++)
+        output_words[output_count++] = o->words[lo / 4 + i];
+      for (r = 0; r < o->nrelocs; r++)
+      {
+        int off = (int)(o->relocs[r * 3] >> 8);
+        int target;
+        if (off < lo || off >= hi) continue;
+        if (link_sym_addr(o, (int)o->relocs[r * 3 + 1], &target) < 0) return;
+        target += (int)o->relocs[r * 3 + 2];
+        link_patch(&output_words[first + (off - lo) / 4],
+                   (int)(o->relocs[r * 3] & 0xFFu), target,
+                   o->place[sec] + off - lo);
+      }
     }
-    if (min_idx != i)
+  }
+
+  if (dump_labels)
+  {
+    char buf[128];
+    int si;
+    for (k = 0; k < link_obj_count; k++)
     {
-      tmp = reloc_entries[i];
-      reloc_entries[i] = reloc_entries[min_idx];
-      reloc_entries[min_idx] = tmp;
+      struct link_obj *o = &link_objs[k];
+      for (si = 0; si < o->nsyms; si++)
+      {
+        int a;
+        if ((o->syms[si * 3 + 1] & 0xFFu) == OSEC_UNDEF) continue;
+        link_sym_addr(o, si, &a);
+        snprintf(buf, sizeof(buf), "LBL %08x %s\n", (unsigned)a,
+                 o->strtab + o->syms[si * 3]);
+        IO_PRINT(buf);
+      }
     }
   }
 }
 
-static void pass_append_reloc(void)
+/* 1 if path ends in suffix */
+static int has_suffix(const char *path, const char *suffix)
+{
+  int n = (int)strlen(path);
+  int m = (int)strlen(suffix);
+  return n >= m && strcmp(path + n - m, suffix) == 0;
+}
+
+/* Link the .o and .a inputs into output_words. asm_img is the object image
+ * of the one .asm input, or NULL if there is none.
+ */
+static int link_from_objects(unsigned int *asm_img, int asm_words)
 {
   int i;
-  if (reloc_count == 0) return;
-  sort_relocs();
-  if (output_count + 1 + reloc_count > OUTPUT_WORDS)
+  int h;
+
+  /* Start the symbol table over: the names of the assembled file are in
+   * its image now. */
+  if (asm_img)
   {
-    emsg("output too large for reloc table");
-    return;
+    memset(sym_name, 0, sizeof(char *) * SYM_SLOTS);
+    sym_count = 0;
   }
-  output_words[output_count++] = (unsigned int)reloc_count;
-  for (i = 0; i < reloc_count; i++)
+
+  /* The header jumps to Main */
+  h = sym_find("Main", 1);
+  if (h < 0) return -1;
+  sym_flags[h] |= SYM_WANTED;
+
+  for (i = 0; i < num_files; i++)
   {
-    output_words[output_count++] = reloc_entries[i];
+    if (has_suffix(file_paths[i], ".a"))
+    {
+      if (link_add_archive(file_paths[i]) < 0) return -1;
+    }
+    else if (has_suffix(file_paths[i], ".o"))
+    {
+      int nwords;
+      unsigned int *img = read_file_words(file_paths[i], &nwords);
+      if (!img) return -1;
+      if (link_add_object(file_paths[i], img, nwords) < 0) return -1;
+    }
+    else if (asm_img)
+    {
+      if (link_add_object(file_paths[i], asm_img, asm_words) < 0) return -1;
+    }
+    else
+    {
+      emsg2("assemble with -c before linking with objects: ", file_paths[i]);
+      return -1;
+    }
   }
+  if (link_pull_members() < 0) return -1;
+  vmsg("Linking "); vmsg_int(link_obj_count); vmsg(" objects\n");
+  link_objects();
+  if (has_error) return -1;
+  pass_append_reloc();
+  return has_error ? -1 : 0;
 }
 
-/*===========================================================================*/
-/*  Output                                                                   */
-/*===========================================================================*/
-
-static int write_output(const char *path)
+/* -a: write the .o inputs as an archive, indexing every symbol that other
+ * objects can link against.
+ */
+static int write_archive(const char *path)
 {
-  int fd;
-  int total = 0;
-  int rem = 0;
-  int chunk = 0;
-  int wrote = 0;
+  unsigned int *img[MAX_FILES];
+  int size[MAX_FILES];
+  struct link_obj o;
+  unsigned int *arc;
+  unsigned int *p;
+  char *str;
+  int nindex = 0;
+  int str_bytes = 0;
+  int str_words;
+  int total;
+  int off;
+  int pos;
   int i;
+  int si;
 
-#ifdef ASMLINK_HOST
-  IO_DELETE((char *)path);
-  IO_CREATE((char *)path);
-  fd = IO_OPEN((char *)path);
-#else
-  fd = IO_OPEN_WRITE((char *)path);
-#endif
-  if (fd < 0) { emsg2("cannot open output: ", path); return -1; }
-
-#ifdef ASMLINK_HOST
-  /* On host: emit big-endian byte stream for the legacy .bin format.
-   * NOTE: the current build pipeline (compile_modern_c.sh) uses
-   * perl pack("V") which outputs little-endian. This host mode
-   * is only used for standalone testing. */
+  for (i = 0; i < num_files; i++)
   {
-    unsigned char *buf = (unsigned char *)malloc((size_t)output_count * 4);
-    for (i = 0; i < output_count; i++)
+    int nwords;
+    img[i] = read_file_words(file_paths[i], &nwords);
+    if (!img[i]) return -1;
+    if (obj_open(&o, file_paths[i], img[i], nwords) < 0) return -1;
+    /* the object's own size: the file may carry zero padding */
+    size[i] = (int)((char *)o.strtab - (char *)img[i]) / 4 + (int)img[i][7];
+    str_bytes += (int)strlen(file_prefix[i]) + 3;
+    for (si = 0; si < o.nsyms; si++)
     {
-      unsigned int v = output_words[i];
-      buf[i * 4 + 0] = (unsigned char)((v >> 24) & 0xFF);
-      buf[i * 4 + 1] = (unsigned char)((v >> 16) & 0xFF);
-      buf[i * 4 + 2] = (unsigned char)((v >> 8) & 0xFF);
-      buf[i * 4 + 3] = (unsigned char)(v & 0xFF);
+      unsigned int info = o.syms[si * 3 + 1];
+      if ((info & 0xFFu) == OSEC_UNDEF || (info >> 8) == OSYM_LOCAL) continue;
+      nindex++;
+      str_bytes += (int)strlen(o.strtab + o.syms[si * 3]) + 1;
     }
-    fwrite(buf, 1, (size_t)output_count * 4, host_files[fd]);
-    free(buf);
-    IO_CLOSE(fd);
-    (void)total; (void)rem; (void)chunk; (void)wrote;
-    return output_count;
   }
-#else
-  /* On BDOS: write words via the byte-mode wrapper. The CPU is little-endian
-   * so writing output_words directly puts bytes on disk in LE-word order,
-   * which is what the slot loader expects when it reads them back. */
-  total = 0;
-  rem = output_count;
-  while (rem > 0)
+  str_words = (str_bytes + 3) / 4;
+  total = ARC_HDR_WORDS + num_files * 3 + nindex * 2 + str_words;
+  for (i = 0; i < num_files; i++) total += size[i];
+  arc = (unsigned int *)IO_HEAP_ALLOC(sizeof(unsigned int) * total);
+  if (!arc) { emsg("OOM writing archive"); return -1; }
+
+  arc[0] = ARC_MAGIC;
+  arc[1] = (unsigned int)num_files;
+  arc[2] = (unsigned int)nindex;
+  arc[3] = (unsigned int)str_words;
+  str = (char *)(arc + ARC_HDR_WORDS + num_files * 3 + nindex * 2);
+  for (i = 0; i < str_words; i++) ((unsigned int *)str)[i] = 0;
+
+  /* member table and member names */
+  p = arc + ARC_HDR_WORDS;
+  off = (ARC_HDR_WORDS + num_files * 3 + nindex * 2 + str_words) * 4;
+  pos = 0;
+  for (i = 0; i < num_files; i++)
   {
-    chunk = rem;
-    if (chunk > 256) chunk = 256;
-    wrote = IO_WRITE_WORDS(fd, &output_words[total], chunk);
-    if (wrote <= 0) { emsg("write failed"); IO_CLOSE(fd); return -1; }
-    total += wrote;
-    rem -= wrote;
+    *p++ = (unsigned int)off;
+    *p++ = (unsigned int)size[i];
+    *p++ = (unsigned int)pos;
+    strcpy(&str[pos], file_prefix[i]);
+    strcat(&str[pos], ".o");
+    pos += (int)strlen(&str[pos]) + 1;
+    memcpy((char *)arc + off, img[i], (size_t)size[i] * 4);
+    off += size[i] * 4;
   }
-  IO_CLOSE(fd);
-  return total;
-#endif
+
+  /* symbol index */
+  for (i = 0; i < num_files; i++)
+  {
+    obj_open(&o, file_paths[i], img[i], size[i]);
+    for (si = 0; si < o.nsyms; si++)
+    {
+      unsigned int info = o.syms[si * 3 + 1];
+      const char *nm = o.strtab + o.syms[si * 3];
+      if ((info & 0xFFu) == OSEC_UNDEF || (info >> 8) == OSYM_LOCAL) continue;
+      *p++ = (unsigned int)pos;
+      *p++ = (unsigned int)i;
+      strcpy(&str[pos], nm);
+      pos += (int)strlen(nm) + 1;
+    }
+  }
+  vmsg("Archived "); vmsg_int(num_files); vmsg(" objects, ");
+  vmsg_int(nindex); vmsg(" symbols\n");
+
+  return write_words(path, arc, total);
 }
 
 /*===========================================================================*/
@@ -2658,20 +3960,34 @@ static int allocate_buffers(void)
   line_addr      = (int *)IO_HEAP_ALLOC(sizeof(int) * MAX_LINES);
   line_flags     = (int *)IO_HEAP_ALLOC(sizeof(int) * MAX_LINES);
 
-  label_names    = (char (*)[LABEL_NAME_LEN])IO_HEAP_ALLOC(MAX_LABELS * LABEL_NAME_LEN);
+  label_names    = (char **)IO_HEAP_ALLOC(sizeof(char *) * MAX_LABELS);
   label_addr     = (int *)IO_HEAP_ALLOC(sizeof(int) * MAX_LABELS);
   label_file     = (int *)IO_HEAP_ALLOC(sizeof(int) * MAX_LABELS);
   label_global   = (int *)IO_HEAP_ALLOC(sizeof(int) * MAX_LABELS);
+  label_sec      = (int *)IO_HEAP_ALLOC(sizeof(int) * MAX_LABELS);
+
+  sym_name       = (char **)IO_HEAP_ALLOC(sizeof(char *) * SYM_SLOTS);
+  sym_label      = (int *)IO_HEAP_ALLOC(sizeof(int) * SYM_SLOTS);
+  sym_def_file   = (int *)IO_HEAP_ALLOC(sizeof(int) * SYM_SLOTS);
+  sym_flags      = (int *)IO_HEAP_ALLOC(sizeof(int) * SYM_SLOTS);
+  def_name       = (char **)IO_HEAP_ALLOC(sizeof(char *) * DEF_SLOTS);
+  def_file       = (int *)IO_HEAP_ALLOC(sizeof(int) * DEF_SLOTS);
 
   output_words   = (unsigned int *)IO_HEAP_ALLOC(sizeof(unsigned int) * OUTPUT_WORDS);
   reloc_entries  = (unsigned int *)IO_HEAP_ALLOC(sizeof(unsigned int) * MAX_RELOCS);
+  obj_relocs     = (unsigned int *)IO_HEAP_ALLOC(sizeof(unsigned int) * MAX_RELOCS * 3);
 
   if (!str_pool || !byte_pool || !line_kind || !line_text ||
-      !label_names || !label_addr || !output_words || !reloc_entries)
+      !label_names || !label_addr || !output_words || !reloc_entries ||
+      !obj_relocs || !label_sec ||
+      !sym_name || !sym_label || !sym_def_file || !sym_flags ||
+      !def_name || !def_file)
   {
     emsg("OOM allocating buffers");
     return -1;
   }
+  memset(sym_name, 0, sizeof(char *) * SYM_SLOTS);
+  memset(def_name, 0, sizeof(char *) * DEF_SLOTS);
 
   if (alloc_out_arrays() < 0) return -1;
 
@@ -2684,7 +4000,11 @@ static int allocate_buffers(void)
 
 static void usage(void)
 {
-  IO_PRINT("Usage: asm-link [-v] [-o output.bin] input1.asm [input2.asm ...]\n");
+  IO_PRINT("Usage: asm-link [-v] [-p] [--gc-sections [--map file]] -o output.bin\n");
+  IO_PRINT("                input1.asm [input2.asm ...]\n");
+  IO_PRINT("       asm-link [-v] [-p] -c -o output.o input.asm\n");
+  IO_PRINT("       asm-link -a -o output.a input1.o [input2.o ...]\n");
+  IO_PRINT("       asm-link [-v] [-p] -o output.bin input1.o [input.asm] [lib.a ...]\n");
 }
 
 #ifdef ASMLINK_HOST
@@ -2692,6 +4012,10 @@ int main(int argc, char **argv)
 {
   host_argc = argc;
   host_argv = argv;
+#elif defined(CC_DRIVER)
+/* the cc driver calls main with its own arguments */
+int main(int argc, char **argv)
+{
 #else
 int main(void)
 {
@@ -2700,10 +4024,17 @@ int main(void)
 #endif
   int i;
   int rc;
+  int with_objects = 0;   /* linking .o/.a inputs */
+  int asm_idx = -1;       /* the .asm input among them */
 
   num_files = 0;
   output_path = NULL;
   verbose = 0;
+  peephole = 0;
+  assemble_only = 0;
+  make_archive = 0;
+  gc_sections = 0;
+  map_path = NULL;
   has_error = 0;
 
   if (argc < 2) { usage(); return 1; }
@@ -2727,6 +4058,27 @@ int main(void)
     {
       dump_labels = 1;
     }
+    else if (strcmp(argv[i], "-p") == 0)
+    {
+      peephole = 1;
+    }
+    else if (strcmp(argv[i], "-c") == 0)
+    {
+      assemble_only = 1;
+    }
+    else if (strcmp(argv[i], "-a") == 0)
+    {
+      make_archive = 1;
+    }
+    else if (strcmp(argv[i], "--gc-sections") == 0)
+    {
+      gc_sections = 1;
+    }
+    else if (strcmp(argv[i], "--map") == 0)
+    {
+      if (i + 1 >= argc) { usage(); return 1; }
+      map_path = argv[++i];
+    }
     else if (strcmp(argv[i], "-h") == 0 ||
              strcmp(argv[i], "--help") == 0)
     {
@@ -2744,11 +4096,52 @@ int main(void)
 
   if (num_files == 0) { usage(); return 1; }
   if (!output_path)   { usage(); return 1; }
+  if (assemble_only && (num_files != 1 || make_archive))
+  {
+    emsg("-c takes exactly one input file");
+    return 1;
+  }
+
+  if (make_archive)
+  {
+    if (write_archive(output_path) < 0 || has_error) goto done;
+    return 0;
+  }
+  if (!assemble_only)
+  {
+    int nasm = 0;
+    for (i = 0; i < num_files; i++)
+    {
+      if (has_suffix(file_paths[i], ".o") || has_suffix(file_paths[i], ".a"))
+        with_objects = 1;
+      else
+      {
+        asm_idx = i;
+        nasm++;
+      }
+    }
+    if (with_objects && nasm > 1)
+    {
+      emsg("objects link with at most one .asm input");
+      return 1;
+    }
+    if (with_objects && nasm == 0)
+    {
+      if (link_from_objects(NULL, 0) < 0) goto done;
+      if (write_output(output_path) < 0) goto done;
+      vmsg("Wrote "); vmsg_int(output_count); vmsg(" words to ");
+      vmsg(output_path); vmsg("\n");
+      return 0;
+    }
+    /* Assemble the .asm input as with -c, then link its image */
+    if (with_objects) assemble_only = 1;
+  }
 
   /* Pipeline */
   vmsg("Reading "); vmsg_int(num_files); vmsg(" input files\n");
   for (i = 0; i < num_files; i++)
   {
+    if (with_objects && i != asm_idx) continue;
     if (parse_file(i) < 0 || has_error) goto done;
   }
   vmsg("Parsed "); vmsg_int(line_count); vmsg(" lines\n");
@@ -2763,8 +4156,28 @@ int main(void)
   pass_rewrite_conflicts();
   if (has_error) goto done;
 
-  prepend_header();
-  if (has_error) goto done;
+  if (gc_sections)
+  {
+    if (assemble_only)
+    {
+      emsg("--gc-sections needs every input as .asm, without -c");
+      goto done;
+    }
+    pass_gc_sections(map_path);
+    if (has_error) goto done;
+  }
+
+  if (peephole)
+  {
+    pass_peephole();
+    if (has_error) goto done;
+  }
+
+  if (!assemble_only)
+  {
+    prepend_header();
+    if (has_error) goto done;
+  }
 
   pass_expand_pseudo();
   if (has_error) goto done;
@@ -2801,6 +4214,25 @@ int main(void)
   vmsg("Encoded "); vmsg_int(output_count); vmsg(" words, ");
   vmsg_int(reloc_count); vmsg(" relocations\n");
 
+  if (with_objects)
+  {
+    int nwords;
+    unsigned int *img = build_object(&nwords);
+    if (!img || link_from_objects(img, nwords) < 0) goto done;
+    if (write_output(output_path) < 0) goto done;
+    vmsg("Wrote "); vmsg_int(output_count); vmsg(" words to ");
+    vmsg(output_path); vmsg("\n");
+    return 0;
+  }
+
+  if (assemble_only)
+  {
+    if (write_object(output_path) < 0) goto done;
+    vmsg("Wrote object with "); vmsg_int(label_count); vmsg(" symbols, ");
+    vmsg_int(obj_reloc_count); vmsg(" references\n");
+    return 0;
+  }
+
   pass_append_reloc();
   if (has_error) goto done;
 
@@ -0,0 +1,861 @@
+/*
+ * cc — compile C files to a BDOS executable in one process.
+ *
+ * Usage: cc [-time] [-nocache] [-dist] <input.c>... <output_name>
+ *        cc [-time] [-nocache] [-dist] -c <input.c> <output.o>
+ *        cc -serve
+ *        cc -stats
+ * Result: /bin/<output_name>, or with -c the object <output.o>
+ *
+ * Runs the same stages as the cc-pipe script, but as functions of this
+ * program instead of separate processes: cpp, cproc, qbe and asm-link are
+ * linked in with their main renamed (see selfhost-cc in the Makefile).
+ * The preprocessed source, the QBE IR and the assembly stay in memory:
+ * each stage reads its input from a memory stream swapped in for stdin
+ * and writes to one swapped in for stdout. asm-link assembles the program
+ * to an object and links it with crt0 and the library archives that
+ * libc-build made.
+ *
+ * The object is kept in a compile cache under /sdcard/.cccache, keyed on
+ * the preprocessed source, so compiling an unchanged program again only
+ * runs cpp and the link. -nocache skips the cache, -stats prints its hit
+ * and miss counts.
+ *
+ * cpp, cproc and qbe keep global state and exit on errors, so they run
+ * once per process: with several inputs, each one is preprocessed by a
+ * `cc -E` child and compiled to assembly by a `cc -S` child. With -dist
+ * those compiles go to the FPGCs running `cc -serve` on the network (see
+ * dist.h); preprocessing, the cache and the link stay on this FPGC, which
+ * compiles by itself when no worker answers.
+ *
+ * -time prints how long each stage took.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <syscall.h>
+#include <time.h>
+#include <dist.h>
+
+int cpp_main(int argc, char **argv);
+int cproc_main(int argc, char **argv);
+int qbe_main(int argc, char **argv);
+int asm_link_main(int argc, char **argv);
+
+#define OUT_PATH_LEN 128
+#define CC_PATH      "/bin/cc"
+#define CC_MAX_INPUTS 32
+
+/* Checksum of the cproc, QBE and asm-link sources cc was built from, set
+ * by the Makefile: a new toolchain does not reuse old cache entries. */
+#ifndef CC_TOOLCHAIN_ID
+#define CC_TOOLCHAIN_ID 0u
+#endif
+
+/* The cache index lists the entries from least to most recently used with
+ * their size in bytes, after a line with the hit and miss counts. The
+ * oldest entries are removed when the total passes CACHE_MAX_BYTES. */
+#define CACHE_DIR         "/sdcard/.cccache"
+#define CACHE_INDEX       CACHE_DIR "/index"
+#define CACHE_MAX_BYTES   (2 * 1024 * 1024)
+#define CACHE_MAX_ENTRIES 256
+#define CACHE_KEY_LEN     16
+#define CACHE_PATH_LEN    48
+
+/* Arguments of the stages after cpp; part of the key. */
+#define CACHE_FLAGS       "cproc -t b32p3|qbe|asm-link -c -p"
+
+typedef struct {
+    char key[CACHE_KEY_LEN + 1];
+    int size;
+} CacheEntry;
+
+static CacheEntry cache_ent[CACHE_MAX_ENTRIES];
+static int cache_count;
+static unsigned int cache_hits;
+static unsigned int cache_misses;
+
+/* Distributed compiles: workers only serve a cc built from the same
+ * toolchain, whose objects may go into the cache. */
+#define CC_DIST_APP     ((CC_TOOLCHAIN_ID ^ (CC_TOOLCHAIN_ID >> 16)) & 0xFFFF)
+#define CC_DIST_WAIT_MS 300
+
+/* Files of compile_task; fds 1 and 2 are saved above the shell's. */
+#define TASK_IN     "/tmp/ccd.i"
+#define TASK_ASM    "/tmp/ccd.s"
+#define TASK_ERR    "/tmp/ccd.err"
+#define SAVE_FD_OUT 12
+#define SAVE_FD_ERR 13
+
+typedef struct {
+    char *input;
+    char *c_i;                  /* preprocessed source */
+    size_t c_i_len;
+    char key[CACHE_KEY_LEN + 1];
+    char obj[OUT_PATH_LEN];     /* object to link */
+    int cached;
+    int task;                   /* dist task, -1 none */
+} Unit;
+
+static Unit units[CC_MAX_INPUTS];
+
+static int show_time;
+static int use_cache = 1;
+
+static int usage(void)
+{
+    fprintf(stderr, "usage: cc [-time] [-nocache] [-dist] <input.c>... <name>\n"
+                    "       cc [-time] [-nocache] [-dist] -c <input.c> <output.o>\n"
+                    "       cc -serve\n"
+                    "       cc -stats\n");
+    return 1;
+}
+
+/* Run stage fn with argv. If in is set, stdin reads in[0..in_len); if out
+ * is set, stdout goes to a new buffer returned in *out and *out_len.
+ */
+static int run_stage(const char *name, int (*fn)(int, char **),
+                     int argc, char **argv, char *in, size_t in_len,
+                     char **out, size_t *out_len)
+{
+    FILE *fin = NULL;
+    FILE *fout = NULL;
+    unsigned int t;
+    int rc;
+
+    if (in)
+    {
+        fin = fmemopen(in, in_len, "r");
+        if (!fin)
+        {
+            fprintf(stderr, "cc: out of memory\n");
+            return 1;
+        }
+        __stdio_swap(stdin, fin);
+    }
+    if (out)
+    {
+        fout = open_memstream(out, out_len);
+        if (!fout)
+        {
+            fprintf(stderr, "cc: out of memory\n");
+            return 1;
+        }
+        __stdio_swap(stdout, fout);
+    }
+
+    t = get_micros();
+    rc = fn(argc, argv);
+    t = get_micros() - t;
+
+    if (fout)
+    {
+        __stdio_swap(stdout, fout);
+        fclose(fout);
+    }
+    if (fin)
+    {
+        __stdio_swap(stdin, fin);
+        fclose(fin);
+    }
+    if (show_time)
+        fprintf(stderr, "cc: %-8s %6u ms\n", name, t / 1000);
+    if (rc)
+        fprintf(stderr, "cc: %s failed\n", name);
+    return rc;
+}
+
+/* ---- Compile cache ---- */
+
+/* FNV-1a and djb2 side by side, for a 64-bit key from 32-bit math. */
+static void hash_bytes(const char *p, size_t n, unsigned int *h)
+{
+    unsigned int a = h[0];
+    unsigned int b = h[1];
+
+    while (n--)
+    {
+        unsigned int c = (unsigned char)*p++;
+        a = (a ^ c) * 16777619u;
+        b = (b << 5) + b + c;
+    }
+    h[0] = a;
+    h[1] = b;
+}
+
+static void cache_key(const char *src, size_t len, char *key)
+{
+    unsigned int h[2];
+    char id[12];
+
+    h[0] = 2166136261u;
+    h[1] = 5381;
+    snprintf(id, sizeof(id), "%08x", (unsigned int)CC_TOOLCHAIN_ID);
+    hash_bytes(id, strlen(id), h);
+    hash_bytes(CACHE_FLAGS, strlen(CACHE_FLAGS), h);
+    hash_bytes(src, len, h);
+    snprintf(key, CACHE_KEY_LEN + 1, "%08x%08x", h[0], h[1]);
+}
+
+static void cache_path(const char *key, char *path)
+{
+    snprintf(path, CACHE_PATH_LEN, "%s/%s.o", CACHE_DIR, key);
+}
+
+static int file_size(const char *path)
+{
+    int fd = sys_open(path, O_RDONLY);
+    int size;
+
+    if (fd < 0)
+        return -1;
+    size = sys_lseek(fd, 0, SEEK_END);
+    sys_close(fd);
+    return size;
+}
+
+/* Read the index, creating the cache directory and an empty index the
+ * first time. Returns 0 when there is no cache (no SD card). */
+static int cache_open(void)
+{
+    char *buf;
+    char *p;
+    int fd;
+    int size;
+    int n;
+
+    sys_mkdir(CACHE_DIR);
+    fd = sys_open(CACHE_INDEX, O_RDWR | O_CREAT);
+    if (fd < 0)
+        return 0;
+    size = sys_lseek(fd, 0, SEEK_END);
+    sys_lseek(fd, 0, SEEK_SET);
+    buf = malloc(size + 1);
+    if (!buf)
+    {
+        sys_close(fd);
+        return 0;
+    }
+    n = size > 0 ? sys_read(fd, buf, size) : 0;
+    sys_close(fd);
+    buf[n > 0 ? n : 0] = '\0';
+
+    p = buf;
+    cache_hits = (unsigned int)strtoul(p, &p, 10);
+    cache_misses = (unsigned int)strtoul(p, &p, 10);
+    while (cache_count < CACHE_MAX_ENTRIES)
+    {
+        CacheEntry *e = &cache_ent[cache_count];
+
+        while (*p == ' ' || *p == '\n')
+            p++;
+        if (strlen(p) < CACHE_KEY_LEN)
+            break;
+        memcpy(e->key, p, CACHE_KEY_LEN);
+        e->key[CACHE_KEY_LEN] = '\0';
+        e->size = (int)strtol(p + CACHE_KEY_LEN, &p, 10);
+        cache_count++;
+    }
+    free(buf);
+    return 1;
+}
+
+static void cache_save(void)
+{
+    char line[40];
+    int fd;
+    int i;
+
+    fd = sys_open(CACHE_INDEX, O_WRONLY | O_CREAT | O_TRUNC);
+    if (fd < 0)
+        return;
+    snprintf(line, sizeof(line), "%u %u\n", cache_hits, cache_misses);
+    sys_write(fd, line, strlen(line));
+    for (i = 0; i < cache_count; i++)
+    {
+        snprintf(line, sizeof(line), "%s %d\n",
+                 cache_ent[i].key, cache_ent[i].size);
+        sys_write(fd, line, strlen(line));
+    }
+    sys_close(fd);
+}
+
+static int cache_find(const char *key)
+{
+    int i;
+
+    for (i = 0; i < cache_count; i++)
+        if (strcmp(cache_ent[i].key, key) == 0)
+            return i;
+    return -1;
+}
+
+/* Drop entry i from the index; with unlink_it, its object too. */
+static void cache_drop(int i, int unlink_it)
+{
+    if (unlink_it)
+    {
+        char path[CACHE_PATH_LEN];
+
+        cache_path(cache_ent[i].key, path);
+        sys_unlink(path);
+    }
+    memmove(&cache_ent[i], &cache_ent[i + 1],
+            (cache_count - i - 1) * sizeof(cache_ent[0]));
+    cache_count--;
+}
+
+/* Make key the most recently used entry, evicting the least recently used
+ * ones while the cache is too large. */
+static void cache_use(const char *key, int size)
+{
+    int total = size;
+    int i;
+
+    i = cache_find(key);
+    if (i >= 0)
+        cache_drop(i, 0);
+    if (cache_count == CACHE_MAX_ENTRIES)
+        cache_drop(0, 1);
+    for (i = 0; i < cache_count; i++)
+        total += cache_ent[i].size;
+    while (cache_count > 0 && total > CACHE_MAX_BYTES)
+    {
+        total -= cache_ent[0].size;
+        cache_drop(0, 1);
+    }
+    strcpy(cache_ent[cache_count].key, key);
+    cache_ent[cache_count].size = size;
+    cache_count++;
+}
+
+static int copy_file(const char *from, const char *to)
+{
+    char buf[512];
+    int in;
+    int out;
+    int n;
+
+    in = sys_open(from, O_RDONLY);
+    if (in < 0)
+        return -1;
+    out = sys_open(to, O_WRONLY | O_CREAT | O_TRUNC);
+    if (out < 0)
+    {
+        sys_close(in);
+        return -1;
+    }
+    while ((n = sys_read(in, buf, sizeof(buf))) > 0)
+        sys_write(out, buf, n);
+    sys_close(in);
+    sys_close(out);
+    return 0;
+}
+
+static int cache_stats(void)
+{
+    int total = 0;
+    int i;
+
+    if (!cache_open())
+    {
+        fprintf(stderr, "cc: no compile cache (%s)\n", CACHE_DIR);
+        return 1;
+    }
+    for (i = 0; i < cache_count; i++)
+        total += cache_ent[i].size;
+    printf("cc: cache %u hits, %u misses\n", cache_hits, cache_misses);
+    printf("cc: %d objects, %d of %d bytes in %s\n",
+           cache_count, total, CACHE_MAX_BYTES, CACHE_DIR);
+    return 0;
+}
+
+
+/* ---- Several inputs and distributed compiles ---- */
+
+/* Read a whole file into a malloc'd buffer; NULL if it cannot be read. */
+static char *read_file(const char *path, size_t *len)
+{
+    char *buf;
+    int fd;
+    int size;
+    int n;
+
+    fd = sys_open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    size = sys_lseek(fd, 0, SEEK_END);
+    sys_lseek(fd, 0, SEEK_SET);
+    buf = malloc(size > 0 ? size : 1);
+    if (!buf)
+    {
+        sys_close(fd);
+        return NULL;
+    }
+    n = size > 0 ? sys_read(fd, buf, size) : 0;
+    sys_close(fd);
+    *len = n > 0 ? n : 0;
+    return buf;
+}
+
+static int write_file(const char *path, const char *buf, size_t len)
+{
+    int fd = sys_open(path, O_WRONLY | O_CREAT | O_TRUNC);
+
+    if (fd < 0)
+        return -1;
+    if (len > 0)
+        sys_write(fd, buf, len);
+    sys_close(fd);
+    return 0;
+}
+
+/* Run cc with args in a child process, with its stdout and stderr going
+ * to out_path when that is set. Returns the exit code. */
+static int run_child(int argc, const char **args, const char *out_path)
+{
+    int fd = -1;
+    int pid;
+    int rc;
+
+    if (out_path)
+    {
+        fd = sys_open(out_path, O_WRONLY | O_CREAT | O_TRUNC);
+        if (fd < 0)
+            return -1;
+        sys_dup2(1, SAVE_FD_OUT);
+        sys_dup2(2, SAVE_FD_ERR);
+        sys_dup2(fd, 1);
+        sys_dup2(fd, 2);
+    }
+    pid = sys_spawn(CC_PATH, argc, args);
+    rc = pid < 0 ? -1 : sys_waitpid(pid);
+    if (out_path)
+    {
+        sys_dup2(SAVE_FD_OUT, 1);
+        sys_dup2(SAVE_FD_ERR, 2);
+        sys_close(SAVE_FD_OUT);
+        sys_close(SAVE_FD_ERR);
+        sys_close(fd);
+    }
+    return rc;
+}
+
+/* dist task: the assembly of one preprocessed source, by a `cc -S` child
+ * so a compile error cannot end the calling process. On failure the output
+ * is the error messages instead. Runs on `cc -serve` workers and, without
+ * workers, on the compiling FPGC itself. */
+static int compile_task(const char *in, int in_len, char **out, int *out_len,
+                        void *ctx)
+{
+    const char *args[] = { CC_PATH, "-S", TASK_IN, TASK_ASM, NULL };
+    size_t len = 0;
+    int rc;
+
+    (void)ctx;
+    if (write_file(TASK_IN, in, in_len) < 0)
+        return -1;
+    rc = run_child(4, args, TASK_ERR);
+    *out = read_file(rc == 0 ? TASK_ASM : TASK_ERR, &len);
+    *out_len = *out ? (int)len : 0;
+    return rc;
+}
+
+/* cc -S: compile preprocessed source to assembly (for compile_task). */
+static int compile_preprocessed(const char *input, const char *output)
+{
+    char *c_i;
+    char *c_qbe;
+    char *user_asm;
+    size_t c_i_len;
+    size_t c_qbe_len;
+    size_t user_asm_len;
+
+    c_i = read_file(input, &c_i_len);
+    if (!c_i)
+    {
+        fprintf(stderr, "cc: cannot read %s\n", input);
+        return 1;
+    }
+    {
+        char *args[] = { "cproc", "-t", "b32p3", NULL };
+        if (run_stage("cproc", cproc_main, 3, args, c_i, c_i_len,
+                      &c_qbe, &c_qbe_len))
+            return 1;
+    }
+    {
+        char *args[] = { "qbe", NULL };
+        if (run_stage("qbe", qbe_main, 1, args, c_qbe, c_qbe_len,
+                      &user_asm, &user_asm_len))
+            return 1;
+    }
+    if (write_file(output, user_asm, user_asm_len) < 0)
+    {
+        fprintf(stderr, "cc: cannot write %s\n", output);
+        return 1;
+    }
+    return 0;
+}
+
+/* cc -serve: compile for `cc -dist` on other FPGCs until Escape. */
+static int serve(void)
+{
+    int n;
+
+    printf("cc: compile worker %04x, Escape to stop\n", CC_DIST_APP);
+    n = dist_worker_run(CC_DIST_APP, compile_task, NULL);
+    printf("cc: compile worker done, %d files\n", n);
+    return 0;
+}
+
+/* Assemble the result of a compile task to u->obj. */
+static int unit_finish(Unit *u, int status, char *out, int out_len)
+{
+    int rc;
+
+    if (status)
+    {
+        if (out_len > 0)
+            fwrite(out, 1, out_len, stderr);
+        fprintf(stderr, "cc: %s failed\n", u->input);
+        free(out);
+        return 1;
+    }
+    {
+        char *args[] = { "asm-link", "-c", "-p", "-o", u->obj, "-", NULL };
+        rc = run_stage("asm-link", asm_link_main, 6, args, out, out_len,
+                       NULL, NULL);
+    }
+    free(out);
+    if (rc == 0 && use_cache)
+        cache_use(u->key, file_size(u->obj));
+    return rc;
+}
+
+/* Compile every input to an object, then link them. cpp runs in a `cc -E`
+ * child per input; the sources the cache does not have are compiled by
+ * compile_task, spread over `cc -serve` workers with -dist. */
+static int build_units(int num_units, const char *out_path, int compile_only,
+                       int distribute)
+{
+    static dist_coord_t coord;
+    unsigned int t;
+    int failed = 0;
+    int pending = 0;
+    int i;
+
+    for (i = 0; i < num_units; i++)
+    {
+        Unit *u = &units[i];
+        char tmp_i[CACHE_PATH_LEN];
+        const char *args[] = { CC_PATH, "-E", u->input, tmp_i, NULL };
+
+        snprintf(tmp_i, sizeof(tmp_i), "/tmp/cc%d.i", i);
+        if (run_child(4, args, NULL) != 0)
+            return 1;
+        u->c_i = read_file(tmp_i, &u->c_i_len);
+        sys_unlink(tmp_i);
+        if (!u->c_i)
+        {
+            fprintf(stderr, "cc: cannot read %s\n", tmp_i);
+            return 1;
+        }
+        u->task = -1;
+        u->cached = 0;
+        if (use_cache)
+        {
+            cache_key(u->c_i, u->c_i_len, u->key);
+            cache_path(u->key, u->obj);
+            u->cached = cache_find(u->key) >= 0 && file_size(u->obj) > 0;
+            printf("cc: %s cache %s %s\n", u->input,
+                   u->cached ? "hit" : "miss", u->key);
+        }
+        else if (compile_only)
+            strcpy(u->obj, out_path);
+        else
+            snprintf(u->obj, sizeof(u->obj), "/tmp/cc%d.o", i);
+        if (u->cached)
+        {
+            cache_hits++;
+            cache_use(u->key, file_size(u->obj));
+        }
+        else
+        {
+            if (use_cache)
+                cache_misses++;
+            pending++;
+        }
+    }
+
+    t = get_micros();
+    if (distribute && pending > 0)
+    {
+        int workers;
+
+        dist_coord_init(&coord, CC_DIST_APP);
+        dist_coord_set_local(&coord, compile_task, NULL);
+        workers = dist_coord_discover(&coord, CC_DIST_WAIT_MS);
+        printf("cc: %d files to compile, %d workers\n", pending, workers);
+        for (i = 0; i < num_units; i++)
+            if (!units[i].cached)
+                units[i].task = dist_coord_add(&coord, units[i].c_i,
+                                               units[i].c_i_len);
+        dist_coord_run(&coord, 0);
+        for (i = 0; i < num_units; i++)
+        {
+            Unit *u = &units[i];
+            dist_task_t *task;
+
+            if (u->task < 0)
+                continue;
+            task = &coord.tasks[u->task];
+            failed |= unit_finish(u, task->status, task->out, task->out_len);
+            task->out = NULL;
+        }
+        printf("cc: dist %d remote, %d local, %d backups, %d requeued\n",
+               coord.stats.tasks - coord.stats.local_tasks,
+               coord.stats.local_tasks, coord.stats.backups,
+               coord.stats.requeued);
+    }
+    else
+    {
+        for (i = 0; i < num_units; i++)
+        {
+            Unit *u = &units[i];
+            char *out;
+            int out_len;
+            int status;
+
+            if (u->cached)
+                continue;
+            status = compile_task(u->c_i, u->c_i_len, &out, &out_len, NULL);
+            failed |= unit_finish(u, status, out, out_len);
+        }
+    }
+    if (show_time && pending > 0)
+        fprintf(stderr, "cc: compile  %6u ms\n", (get_micros() - t) / 1000);
+    for (i = 0; i < num_units; i++)
+        free(units[i].c_i);
+    if (use_cache)
+        cache_save();
+    if (failed)
+        return 1;
+
+    if (compile_only)
+    {
+        if (use_cache && copy_file(units[0].obj, out_path) < 0)
+        {
+            fprintf(stderr, "cc: cannot write %s\n", out_path);
+            return 1;
+        }
+        return 0;
+    }
+    {
+        char *args[CC_MAX_INPUTS + 9];
+        int n = 0;
+
+        args[n++] = "asm-link";
+        args[n++] = "-p";
+        args[n++] = "-o";
+        args[n++] = (char *)out_path;
+        args[n++] = "/lib/obj/crt0_ubdos.o";
+        for (i = 0; i < num_units; i++)
+            args[n++] = units[i].obj;
+        args[n++] = "/lib/libuser.a";
+        args[n++] = "/lib/libc.a";
+        args[n] = NULL;
+        if (run_stage("asm-link", asm_link_main, n, args,
+                      NULL, 0, NULL, NULL))
+            return 1;
+    }
+    if (!use_cache)
+        for (i = 0; i < num_units; i++)
+            sys_unlink(units[i].obj);
+    return 0;
+}
+
+/* Compile one input in this process, its text passed between the stages
+ * in memory. */
+static int build_one(char *input, const char *out_path, int compile_only)
+{
+    char key[CACHE_KEY_LEN + 1];
+    char obj_path[CACHE_PATH_LEN];
+    char *c_i;
+    char *c_qbe;
+    char *user_asm;
+    size_t c_i_len;
+    size_t c_qbe_len;
+    size_t user_asm_len;
+    int cached = 0;
+
+    {
+        char *args[] = { "cpp", "-I", "/lib/include", input, NULL };
+        if (run_stage("cpp", cpp_main, 4, args, NULL, 0, &c_i, &c_i_len))
+            return 1;
+    }
+
+    if (use_cache)
+    {
+        cache_key(c_i, c_i_len, key);
+        cache_path(key, obj_path);
+        cached = cache_find(key) >= 0 && file_size(obj_path) > 0;
+        printf("cc: cache %s %s\n", cached ? "hit" : "miss", key);
+    }
+
+    if (!cached)
+    {
+        {
+            char *args[] = { "cproc", "-t", "b32p3", NULL };
+            if (run_stage("cproc", cproc_main, 3, args, c_i, c_i_len,
+                          &c_qbe, &c_qbe_len))
+                return 1;
+        }
+        {
+            char *args[] = { "qbe", NULL };
+            if (run_stage("qbe", qbe_main, 1, args, c_qbe, c_qbe_len,
+                          &user_asm, &user_asm_len))
+                return 1;
+            free(c_qbe);
+        }
+        if (use_cache || compile_only)
+        {
+            char *args[] = { "asm-link", "-c", "-p", "-o",
+                             use_cache ? obj_path : (char *)out_path, "-",
+                             NULL };
+            if (run_stage("asm-link", asm_link_main, 6, args,
+                          user_asm, user_asm_len, NULL, NULL))
+                return 1;
+            free(user_asm);
+        }
+    }
+    free(c_i);
+
+    if (use_cache)
+    {
+        if (cached)
+            cache_hits++;
+        else
+            cache_misses++;
+        cache_use(key, file_size(obj_path));
+        cache_save();
+    }
+
+    if (compile_only)
+    {
+        if (use_cache && copy_file(obj_path, out_path) < 0)
+        {
+            fprintf(stderr, "cc: cannot write %s\n", out_path);
+            return 1;
+        }
+    }
+    else if (use_cache)
+    {
+        char *args[] = { "asm-link", "-p", "-o", (char *)out_path,
+                         "/lib/obj/crt0_ubdos.o", obj_path,
+                         "/lib/libuser.a", "/lib/libc.a", NULL };
+        if (run_stage("asm-link", asm_link_main, 8, args,
+                      NULL, 0, NULL, NULL))
+            return 1;
+    }
+    else
+    {
+        char *args[] = { "asm-link", "-p", "-o", (char *)out_path,
+                         "/lib/obj/crt0_ubdos.o", "-",
+                         "/lib/libuser.a", "/lib/libc.a", NULL };
+        if (run_stage("asm-link", asm_link_main, 8, args,
+                      user_asm, user_asm_len, NULL, NULL))
+            return 1;
+        free(user_asm);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    char *args[CC_MAX_INPUTS + 1];
+    char out_path[OUT_PATH_LEN];
+    char *name;
+    unsigned int t;
+    int num_args = 0;
+    int compile_only = 0;
+    int distribute = 0;
+    int mode = 0;
+    int rc;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-time") == 0)
+            show_time = 1;
+        else if (strcmp(argv[i], "-nocache") == 0)
+            use_cache = 0;
+        else if (strcmp(argv[i], "-stats") == 0)
+            return cache_stats();
+        else if (strcmp(argv[i], "-serve") == 0)
+            return serve();
+        else if (strcmp(argv[i], "-dist") == 0)
+            distribute = 1;
+        else if (strcmp(argv[i], "-c") == 0)
+            compile_only = 1;
+        else if (strcmp(argv[i], "-E") == 0 || strcmp(argv[i], "-S") == 0)
+            mode = argv[i][1];
+        else if (num_args < CC_MAX_INPUTS + 1)
+            args[num_args++] = argv[i];
+        else
+        {
+            fprintf(stderr, "cc: more than %d inputs\n", CC_MAX_INPUTS);
+            return 1;
+        }
+    }
+    if (mode && num_args != 2)
+        return usage();
+    if (mode == 'E')
+    {
+        char *cpp_args[] = { "cpp", "-I", "/lib/include", args[0],
+                             "-o", args[1], NULL };
+        return run_stage("cpp", cpp_main, 6, cpp_args, NULL, 0, NULL, NULL);
+    }
+    if (mode == 'S')
+        return compile_preprocessed(args[0], args[1]);
+    if (num_args < 2 || (compile_only && num_args != 2))
+        return usage();
+
+    name = args[num_args - 1];
+    if (strlen(name) + 6 > OUT_PATH_LEN)
+    {
+        fprintf(stderr, "cc: output name too long\n");
+        return 1;
+    }
+    if (compile_only)
+        strcpy(out_path, name);
+    else
+    {
+        strcpy(out_path, "/bin/");
+        strcat(out_path, name);
+    }
+
+    if (num_args == 2)
+        printf("cc: compiling %s -> %s\n", args[0], out_path);
+    else
+        printf("cc: compiling %d files -> %s\n", num_args - 1, out_path);
+    t = get_micros();
+    if (use_cache && !cache_open())
+        use_cache = 0;
+
+    if (num_args == 2 && !distribute)
+        rc = build_one(args[0], out_path, compile_only);
+    else
+    {
+        for (i = 0; i < num_args - 1; i++)
+            units[i].input = args[i];
+        rc = build_units(num_args - 1, out_path, compile_only, distribute);
+    }
+    if (rc)
+        return 1;
+
+    if (show_time)
+        fprintf(stderr, "cc: total    %6u ms\n", (get_micros() - t) / 1000);
+    printf("cc: built %s\n", out_path);
+    return 0;
+}
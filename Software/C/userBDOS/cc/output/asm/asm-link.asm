@@ -0,0 +1,20426 @@
+.data
+.balign 1
+.Lstring.5:
+	.ascii "asm-link error: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "\012\000"
+/* end data */
+
+
+.text
+; function emsg2
+emsg2:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r5
+  write -12 r14 r4
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -12 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emsg2 */
+
+
+.text
+; function vmsg_int
+vmsg_int:
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L20
+  load 0 r1
+  bges r4 r0 .L8
+  sub r0 r4 r4
+  load 1 r1
+.L8:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  or r0 r1 r2
+  load 0 r1
+  bne r4 r0 .L10
+  add r14 -16 r1
+  add r1 0 r3
+  load 48 r1
+  writeb 0 r3 r1
+  load 1 r1
+.L10:
+  bles r4 r0 .L12
+  load32 1717986919 r3
+  mulshi r4 r3 r3
+  shiftrs r3 2 r3
+  shiftr r4 31 r5
+  add r3 r5 r3
+  load 10 r5
+  mults r3 r5 r3
+  sub r4 r3 r5
+  load 48 r3
+  add r3 r5 r3
+  or r0 r1 r5
+  add r1 1 r1
+  add r14 -16 r6
+  add r6 r5 r5
+  writeb 0 r5 r3
+  load32 1717986919 r3
+  mulshi r4 r3 r3
+  shiftrs r3 2 r3
+  shiftr r4 31 r4
+  add r3 r4 r4
+  jump .L10
+.L12:
+  beq r2 r0 .L14
+  or r0 r1 r2
+  add r1 1 r1
+  add r14 -16 r3
+  add r3 r2 r3
+  load 45 r2
+  writeb 0 r3 r2
+.L14:
+  load 0 r2
+.L15:
+  bges r2 r1 .L18
+  load 1 r3
+  sub r1 r3 r3
+  sub r3 r2 r4
+  add r14 -16 r3
+  add r3 r4 r3
+  readb 0 r3 r3
+  add r14 -32 r4
+  add r4 r2 r4
+  writeb 0 r4 r3
+  add r2 1 r2
+  jump .L15
+.L18:
+  add r14 -32 r2
+  add r2 r1 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -32 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L19:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L20:
+  jumpr 0 r15
+
+/* end function vmsg_int */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "string pool exhausted\000"
+/* end data */
+
+
+.text
+; function pool_strdup_n
+pool_strdup_n:
+  addr2reg str_pool_pos r12
+  read 0 r12 r2
+  add r2 r5 r1
+  add r1 1 r1
+  addr2reg str_pool_size r12
+  read 0 r12 r3
+  bgts r1 r3 .L30
+  addr2reg str_pool r12
+  read 0 r12 r1
+  add r1 r2 r1
+  load 0 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L25:
+  bges r1 r5 .L28
+  add r4 r1 r3
+  readb 0 r3 r3
+  add r2 r1 r6
+  writeb 0 r6 r3
+  add r1 1 r1
+  jump .L25
+.L28:
+  or r0 r2 r1
+  add r1 r5 r3
+  load 0 r2
+  writeb 0 r3 r2
+  addr2reg str_pool_pos r12
+  read 0 r12 r2
+  add r5 1 r3
+  add r2 r3 r2
+  addr2reg str_pool_pos r12
+  write 0 r12 r2
+  jumpr 0 r15
+.L30:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.11 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+.L32:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pool_strdup_n */
+
+
+.text
+; function sym_hash
+sym_hash:
+  load32 -2128831035 r2
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L37:
+  bges r2 r5 .L40
+  add r4 r2 r3
+  readb 0 r3 r3
+  and r3 0xFF r3
+  xor r1 r3 r1
+  load32 16777619 r3
+  mults r1 r3 r1
+  add r2 1 r2
+  jump .L37
+.L40:
+  jumpr 0 r15
+
+/* end function sym_hash */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "too many symbols\000"
+/* end data */
+
+
+.text
+; function sym_find_n
+sym_find_n:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r6
+  write -8 r14 r5
+  write -4 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump sym_hash
+  read -8 r14 r5
+  read -4 r14 r4
+  and r1 16383 r1
+.L44:
+  write -12 r14 r1
+  or r0 r1 r2
+  addr2reg sym_name r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  read 0 r3 r3
+  beq r3 r0 .L49
+  shiftl r2 2 r2
+  add r1 r2 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  or r0 r5 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r3
+  read -12 r14 r1
+  read -8 r14 r5
+  read -4 r14 r4
+  load 0 r2
+  bne r3 r0 .L47
+  addr2reg sym_name r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 r5 r2
+  readb 0 r2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L47:
+  bne r2 r0 .L58
+  add r1 1 r1
+  and r1 16383 r1
+  jump .L44
+.L49:
+  read -16 r14 r6
+  beq r6 r0 .L57
+  addr2reg sym_count r12
+  read 0 r12 r1
+  load 8192 r2
+  bges r1 r2 .L55
+  savpc r15
+  add r15 12 r15
+  jump pool_strdup_n
+  or r0 r1 r2
+  read -12 r14 r1
+  addr2reg sym_name r12
+  read 0 r12 r3
+  shiftl r1 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg sym_name r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  beq r2 r0 .L54
+  addr2reg sym_label r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load32 -1 r2
+  write 0 r3 r2
+  addr2reg sym_def_file r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load32 -1 r2
+  write 0 r3 r2
+  addr2reg sym_flags r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg sym_count r12
+  read 0 r12 r2
+  add r2 1 r2
+  addr2reg sym_count r12
+  write 0 r12 r2
+  jump .L58
+.L54:
+  load32 -1 r1
+  jump .L58
+.L55:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.15 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+  jump .L58
+.L57:
+  load32 -1 r1
+.L58:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function sym_find_n */
+
+
+.text
+; function pool_intern
+pool_intern:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -16 r14 r4
+  load 1 r6
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r2
+  blts r2 r0 .L64
+  addr2reg sym_name r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  jump .L65
+.L64:
+  load 0 r1
+.L65:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pool_intern */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "too many label defs\000"
+/* end data */
+
+
+.text
+; function def_find
+def_find:
+  addr2reg str_pool r12
+  read 0 r12 r1
+  sub r4 r1 r2
+  shiftl r2 5 r1
+  add r1 r2 r1
+  add r1 r5 r1
+  and r1 16383 r2
+  or r0 r2 r1
+.L70:
+  addr2reg def_name r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  read 0 r3 r3
+  beq r3 r0 .L76
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r3
+  load 0 r2
+  bne r3 r4 .L73
+  addr2reg def_file r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  xor r2 r5 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L73:
+  bne r2 r0 .L75
+  add r1 1 r1
+  and r1 16383 r1
+  jump .L70
+.L75:
+  load 1 r1
+  jumpr 0 r15
+.L76:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  beq r6 r0 .L82
+  addr2reg def_count r12
+  read 0 r12 r3
+  load 8192 r6
+  bges r3 r6 .L80
+  shiftl r2 2 r3
+  add r1 r3 r1
+  write 0 r1 r4
+  addr2reg def_file r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  addr2reg def_count r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg def_count r12
+  write 0 r12 r1
+  load 0 r1
+  jumpr 0 r15
+.L80:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L83
+.L82:
+  load 0 r1
+  jumpr 0 r15
+.L83:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function def_find */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "byte pool exhausted\000"
+/* end data */
+
+
+.text
+; function byte_pool_emit
+byte_pool_emit:
+  addr2reg byte_pool_pos r12
+  read 0 r12 r3
+  addr2reg byte_pool_size r12
+  read 0 r12 r1
+  bges r3 r1 .L88
+  and r4 0xFF r1
+  addr2reg byte_pool r12
+  read 0 r12 r2
+  add r3 1 r4
+  addr2reg byte_pool_pos r12
+  write 0 r12 r4
+  add r2 r3 r2
+  writeb 0 r2 r1
+  load 0 r1
+  jumpr 0 r15
+.L88:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.21 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+.L90:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function byte_pool_emit */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "too many lines\000"
+/* end data */
+
+
+.text
+; function new_line
+new_line:
+  addr2reg line_count r12
+  read 0 r12 r1
+  load32 49152 r2
+  bges r1 r2 .L95
+  add r1 1 r2
+  addr2reg line_count r12
+  write 0 r12 r2
+  addr2reg line_kind r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  write 0 r2 r4
+  addr2reg line_text r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg line_section r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg line_file_idx r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg line_value r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg line_label r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg line_label_off r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg line_byte_off r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg line_byte_len r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg line_align r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg line_dir_sec r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg line_addr r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg line_flags r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  jumpr 0 r15
+.L95:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.23 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+.L97:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function new_line */
+
+
+.text
+; function is_id_start
+is_id_start:
+  load 1 r1
+  load 95 r2
+  beq r4 r2 .L102
+  xor r4 46 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L103
+.L102:
+  or r0 r1 r2
+.L103:
+  load 1 r1
+  bne r2 r0 .L107
+  load 0 r1
+  load 97 r2
+  blts r4 r2 .L106
+  load 122 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L106:
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L108
+.L107:
+  or r0 r1 r2
+.L108:
+  load 1 r1
+  bne r2 r0 .L112
+  load 0 r1
+  load 65 r2
+  blts r4 r2 .L111
+  load 90 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L111:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L112:
+  jumpr 0 r15
+
+/* end function is_id_start */
+
+
+.text
+; function is_id_cont
+is_id_cont:
+  load 1 r1
+  load 95 r2
+  beq r4 r2 .L117
+  xor r4 46 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L118
+.L117:
+  or r0 r1 r2
+.L118:
+  load 1 r1
+  bne r2 r0 .L122
+  load 0 r1
+  load 97 r2
+  blts r4 r2 .L121
+  load 122 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L121:
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L123
+.L122:
+  or r0 r1 r2
+.L123:
+  load 1 r1
+  bne r2 r0 .L127
+  load 0 r1
+  load 65 r2
+  blts r4 r2 .L126
+  load 90 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L126:
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L128
+.L127:
+  or r0 r1 r2
+.L128:
+  load 1 r1
+  bne r2 r0 .L132
+  load 0 r1
+  load 48 r2
+  blts r4 r2 .L131
+  load 57 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L131:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L132:
+  jumpr 0 r15
+
+/* end function is_id_cont */
+
+
+.text
+; function parse_register
+parse_register:
+  add r4 0 r1
+  readb 0 r1 r1
+  load 114 r2
+  bne r1 r2 .L152
+  add r4 1 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 48 r3
+  blts r2 r3 .L138
+  add r4 1 r1
+  readb 0 r1 r2
+  load 57 r1
+  slt r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L138:
+  bne r1 r0 .L151
+  add r4 2 r1
+  readb 0 r1 r1
+  beq r1 r0 .L150
+  add r4 2 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 48 r3
+  bges r2 r3 .L142
+  or r0 r1 r2
+  jump .L143
+.L142:
+  add r4 2 r1
+  readb 0 r1 r2
+  load 57 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L143:
+  load 0 r1
+  beq r2 r0 .L145
+  add r4 3 r1
+  readb 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L145:
+  beq r1 r0 .L149
+  add r4 1 r1
+  readb 0 r1 r1
+  load 48 r2
+  sub r1 r2 r1
+  load 10 r2
+  mults r1 r2 r1
+  add r4 2 r2
+  readb 0 r2 r2
+  load 48 r3
+  sub r2 r3 r2
+  add r1 r2 r1
+  load 0 r2
+  blts r1 r0 .L148
+  load 15 r2
+  slt r2 r1 r2
+  xor r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L148:
+  bne r2 r0 .L153
+.L149:
+  load32 -1 r1
+  jump .L153
+.L150:
+  add r4 1 r1
+  readb 0 r1 r1
+  load 48 r2
+  sub r1 r2 r1
+  jump .L153
+.L151:
+  load32 -1 r1
+  jump .L153
+.L152:
+  load32 -1 r1
+.L153:
+  jumpr 0 r15
+
+/* end function parse_register */
+
+
+.text
+; function parse_number
+parse_number:
+  add r4 0 r1
+  readb 0 r1 r1
+  load 45 r2
+  beq r1 r2 .L161
+  add r4 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 43 r3
+  bne r2 r3 .L159
+  load 1 r1
+.L159:
+  or r0 r1 r2
+  load 0 r1
+  or r0 r1 r3
+  jump .L163
+.L161:
+  load 1 r2
+  load 1 r1
+  or r0 r2 r3
+  or r0 r1 r2
+.L163:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r3
+  add r4 r2 r1
+  readb 0 r1 r1
+  beq r1 r0 .L214
+  add r4 r2 r1
+  readb 0 r1 r6
+  load 0 r1
+  load 48 r7
+  bne r6 r7 .L168
+  add r2 1 r1
+  add r4 r1 r1
+  readb 0 r1 r6
+  load 1 r1
+  load 120 r7
+  beq r6 r7 .L167
+  add r2 1 r1
+  add r4 r1 r1
+  readb 0 r1 r1
+  xor r1 88 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L167:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L168:
+  bne r1 r0 .L191
+  add r4 r2 r1
+  readb 0 r1 r6
+  load 0 r1
+  load 48 r7
+  bne r6 r7 .L173
+  add r2 1 r1
+  add r4 r1 r1
+  readb 0 r1 r6
+  load 1 r1
+  load 98 r7
+  beq r6 r7 .L172
+  add r2 1 r1
+  add r4 r1 r1
+  readb 0 r1 r1
+  xor r1 66 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L172:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L173:
+  bne r1 r0 .L182
+  load 0 r1
+.L175:
+  add r4 r2 r3
+  readb 0 r3 r3
+  beq r3 r0 .L181
+  add r4 r2 r3
+  readb 0 r3 r6
+  load 1 r3
+  load 48 r7
+  blts r6 r7 .L178
+  add r4 r2 r3
+  readb 0 r3 r6
+  load 57 r3
+  slt r3 r6 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L178:
+  bne r3 r0 .L180
+  load 10 r3
+  mults r1 r3 r1
+  add r4 r2 r3
+  readb 0 r3 r3
+  load 48 r6
+  sub r3 r6 r3
+  add r1 r3 r1
+  add r2 1 r2
+  jump .L175
+.L180:
+  load 0 r1
+  jump .L215
+.L181:
+  read -16 r14 r3
+  jump .L209
+.L182:
+  add r2 2 r2
+  add r4 r2 r1
+  readb 0 r1 r1
+  beq r1 r0 .L190
+  load 0 r1
+.L184:
+  add r4 r2 r6
+  readb 0 r6 r6
+  beq r6 r0 .L209
+  shiftl r1 1 r1
+  add r4 r2 r6
+  readb 0 r6 r6
+  load 49 r7
+  beq r6 r7 .L188
+  add r4 r2 r6
+  readb 0 r6 r6
+  load 48 r7
+  beq r6 r7 .L189
+  load 0 r1
+  jump .L215
+.L188:
+  or r1 1 r1
+.L189:
+  add r2 1 r2
+  jump .L184
+.L190:
+  load 0 r1
+  jump .L215
+.L191:
+  add r2 2 r2
+  add r4 r2 r1
+  readb 0 r1 r1
+  beq r1 r0 .L213
+  load 0 r1
+.L193:
+  add r4 r2 r3
+  readb 0 r3 r3
+  beq r3 r0 .L208
+  shiftl r1 4 r1
+  add r4 r2 r3
+  readb 0 r3 r6
+  load 0 r3
+  load 48 r7
+  blts r6 r7 .L196
+  add r4 r2 r3
+  readb 0 r3 r6
+  load 57 r3
+  slt r3 r6 r3
+  xor r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L196:
+  bne r3 r0 .L206
+  add r4 r2 r3
+  readb 0 r3 r6
+  load 0 r3
+  load 97 r7
+  blts r6 r7 .L199
+  add r4 r2 r3
+  readb 0 r3 r6
+  load 102 r3
+  slt r3 r6 r3
+  xor r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L199:
+  bne r3 r0 .L205
+  add r4 r2 r3
+  readb 0 r3 r6
+  load 0 r3
+  load 65 r7
+  blts r6 r7 .L202
+  add r4 r2 r3
+  readb 0 r3 r6
+  load 70 r3
+  slt r3 r6 r3
+  xor r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L202:
+  beq r3 r0 .L204
+  add r4 r2 r3
+  readb 0 r3 r3
+  load 65 r6
+  sub r3 r6 r3
+  add r3 10 r3
+  or r1 r3 r1
+  jump .L207
+.L204:
+  load 0 r1
+  jump .L215
+.L205:
+  add r4 r2 r3
+  readb 0 r3 r3
+  load 97 r6
+  sub r3 r6 r3
+  add r3 10 r3
+  or r1 r3 r1
+  jump .L207
+.L206:
+  add r4 r2 r3
+  readb 0 r3 r3
+  load 48 r6
+  sub r3 r6 r3
+  or r1 r3 r1
+.L207:
+  add r2 1 r2
+  jump .L193
+.L208:
+  read -16 r14 r3
+.L209:
+  bne r3 r0 .L211
+  write 0 r5 r1
+  jump .L212
+.L211:
+  sub r0 r1 r1
+  write 0 r5 r1
+.L212:
+  load 1 r1
+  jump .L215
+.L213:
+  load 0 r1
+  jump .L215
+.L214:
+  load 0 r1
+.L215:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parse_number */
+
+
+.text
+; function tokenize
+tokenize:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 28 r13
+  write -20 r14 r8
+  write -16 r14 r6
+  load 0 r2
+  load 0 r1
+.L219:
+  readb 0 r4 r3
+  beq r3 r0 .L231
+  load 1 r7
+  load 32 r6
+  xor r3 r6 r8
+  sltu r8 1 r8
+  read -16 r14 r6
+  bne r8 r0 .L222
+  xor r3 9 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  jump .L223
+.L222:
+  or r0 r7 r3
+.L223:
+  bne r3 r0 .L228
+  bne r1 r0 .L230
+  bges r2 r6 .L227
+  or r0 r2 r1
+  add r2 1 r2
+  shiftl r1 2 r1
+  add r5 r1 r1
+  write 0 r1 r4
+  load 1 r1
+  jump .L230
+.L227:
+  or r0 r2 r1
+  jump .L232
+.L228:
+  beq r1 r0 .L230
+  load 0 r1
+  writeb 0 r4 r1
+  load 0 r1
+.L230:
+  add r4 1 r4
+  jump .L219
+.L231:
+  or r0 r2 r1
+.L232:
+  read -20 r14 r8
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function tokenize */
+
+
+.text
+; function tokenize_csv
+tokenize_csv:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 28 r13
+  write -20 r14 r8
+  write -16 r14 r6
+  load 0 r2
+  load 0 r1
+.L236:
+  readb 0 r4 r3
+  beq r3 r0 .L251
+  load 1 r6
+  load 32 r7
+  beq r3 r7 .L239
+  xor r3 9 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r8
+  jump .L240
+.L239:
+  or r0 r6 r8
+.L240:
+  load 1 r7
+  read -16 r14 r6
+  bne r8 r0 .L242
+  xor r3 44 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  jump .L243
+.L242:
+  or r0 r7 r3
+.L243:
+  bne r3 r0 .L248
+  bne r1 r0 .L250
+  bges r2 r6 .L247
+  or r0 r2 r1
+  add r2 1 r2
+  shiftl r1 2 r1
+  add r5 r1 r1
+  write 0 r1 r4
+  load 1 r1
+  jump .L250
+.L247:
+  or r0 r2 r1
+  jump .L252
+.L248:
+  beq r1 r0 .L250
+  load 0 r1
+  writeb 0 r4 r1
+  load 0 r1
+.L250:
+  add r4 1 r4
+  jump .L236
+.L251:
+  or r0 r2 r1
+.L252:
+  read -20 r14 r8
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function tokenize_csv */
+
+
+.text
+; function lstrip
+lstrip:
+  or r0 r4 r1
+  or r0 r1 r4
+.L256:
+  readb 0 r4 r1
+  load 1 r2
+  load 32 r3
+  beq r1 r3 .L258
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L259
+.L258:
+  or r0 r2 r1
+.L259:
+  beq r1 r0 .L261
+  add r4 1 r4
+  jump .L256
+.L261:
+  or r0 r4 r1
+  jumpr 0 r15
+
+/* end function lstrip */
+
+
+.text
+; function find_label
+find_label:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -16 r14 r4
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r2
+  blts r2 r0 .L268
+  addr2reg sym_label r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  jump .L269
+.L268:
+  load32 -1 r1
+.L269:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function find_label */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "too many labels\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "label name too long: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "duplicate label: \000"
+/* end data */
+
+
+.text
+; function add_label
+add_label:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  or r0 r4 r1
+  write -16 r14 r1
+  addr2reg label_count r12
+  read 0 r12 r2
+  load 8192 r3
+  bges r2 r3 .L283
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r2
+  read -16 r14 r1
+  load 64 r3
+  bges r2 r3 .L281
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -16 r14 r1
+  load 1 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r2
+  read -12 r14 r5
+  or r0 r5 r1
+  read -16 r14 r5
+  blts r2 r0 .L280
+  addr2reg sym_label r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r4
+  read 0 r4 r4
+  bges r4 r0 .L279
+  or r0 r1 r5
+  addr2reg label_count r12
+  read 0 r12 r1
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg sym_name r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  addr2reg label_names r12
+  read 0 r12 r3
+  addr2reg label_count r12
+  read 0 r12 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg label_addr r12
+  read 0 r12 r1
+  addr2reg label_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r1 r3 r3
+  load32 -1 r1
+  write 0 r3 r1
+  addr2reg label_file r12
+  read 0 r12 r1
+  addr2reg label_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  write 0 r1 r5
+  addr2reg sym_flags r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  and r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  addr2reg label_global r12
+  read 0 r12 r2
+  addr2reg label_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg label_count r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg label_count r12
+  write 0 r12 r1
+  load 1 r2
+  sub r1 r2 r1
+  jump .L285
+.L279:
+  addr2reg .Lstring.35 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+  jump .L285
+.L280:
+  load32 -1 r1
+  jump .L285
+.L281:
+  or r0 r1 r5
+  addr2reg .Lstring.34 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+  jump .L285
+.L283:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.33 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+.L285:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function add_label */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "-\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "stdin\000"
+/* end data */
+
+
+.text
+; function make_prefix
+make_prefix:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 88 r13
+  or r0 r4 r1
+  write -16 r14 r1
+  addr2reg .Lstring.37 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -16 r14 r1
+  beq r2 r0 .L319
+  or r0 r1 r4
+.L290:
+  readb 0 r4 r2
+  beq r2 r0 .L296
+  load 47 r3
+  beq r2 r3 .L293
+  or r0 r4 r12
+  or r0 r1 r4
+  or r0 r12 r1
+  jump .L294
+.L293:
+  or r0 r4 r1
+  add r4 1 r4
+.L294:
+  add r1 1 r1
+  or r0 r1 r12
+  or r0 r4 r1
+  or r0 r12 r4
+  jump .L290
+.L296:
+  or r0 r1 r4
+.L297:
+  readb 0 r1 r2
+  load 0 r3
+  bne r2 r0 .L299
+  or r0 r3 r2
+  jump .L300
+.L299:
+  xor r2 46 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L300:
+  beq r2 r0 .L304
+  or r0 r1 r12
+  or r0 r4 r1
+  or r0 r12 r4
+  add r4 1 r4
+  or r0 r1 r12
+  or r0 r4 r1
+  or r0 r12 r4
+  jump .L297
+.L304:
+  or r0 r1 r2
+  or r0 r4 r1
+  sub r2 r1 r3
+  load 64 r2
+  blts r3 r2 .L308
+  load 63 r2
+  or r0 r2 r3
+.L308:
+  load 0 r2
+.L309:
+  or r0 r1 r4
+  bges r2 r3 .L317
+  add r4 r2 r1
+  readb 0 r1 r1
+  load 1 r5
+  load 45 r6
+  beq r1 r6 .L312
+  xor r1 46 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L312:
+  bne r5 r0 .L314
+  or r0 r4 r12
+  or r0 r1 r4
+  or r0 r12 r1
+  jump .L315
+.L314:
+  or r0 r4 r1
+  load 95 r4
+.L315:
+  shiftl r4 24 r4
+  shiftrs r4 24 r4
+  add r14 -80 r5
+  add r5 r2 r5
+  writeb 0 r5 r4
+  add r2 1 r2
+  jump .L309
+.L317:
+  add r14 -80 r1
+  add r1 r3 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -80 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  add r14 -80 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strdup_n
+  jump .L320
+.L319:
+  addr2reg .Lstring.38 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  addr2reg .Lstring.38 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strdup_n
+.L320:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function make_prefix */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "out of memory reading stdin\000"
+/* end data */
+
+
+.text
+; function read_stdin_words
+read_stdin_words:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -24 r14 r4
+  load 4100 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  load 4096 r3
+  load 0 r2
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L325:
+  write -12 r14 r3
+  write -28 r14 r1
+  write -32 r14 r2
+  beq r2 r0 .L330
+  add r2 r1 r4
+  sub r3 r1 r6
+  addr2reg __stdin_file r7
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump fread
+  or r0 r1 r4
+  read -12 r14 r3
+  read -28 r14 r1
+  read -32 r14 r2
+  bles r4 r0 .L329
+  add r1 r4 r1
+  write -20 r14 r1
+  bne r1 r3 .L325
+  shiftl r3 1 r3
+  write -16 r14 r3
+  add r3 4 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump realloc
+  or r0 r1 r2
+  read -16 r14 r3
+  read -20 r14 r1
+  jump .L325
+.L329:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L331
+.L330:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L331:
+  beq r1 r0 .L333
+  add r1 r2 r4
+  add r3 4 r1
+  sub r1 r2 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  read -28 r14 r2
+  read -32 r14 r1
+  read -24 r14 r4
+  add r2 3 r2
+  shiftrs r2 31 r3
+  shiftr r3 30 r3
+  add r2 r3 r2
+  shiftrs r2 2 r2
+  write 0 r4 r2
+  jump .L335
+.L333:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.40 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+.L335:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function read_stdin_words */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "cannot open file: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "invalid file: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.44:
+	.ascii "out of memory reading file\000"
+/* end data */
+
+
+.text
+; function read_file_words
+read_file_words:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -20 r14 r5
+  or r0 r4 r5
+  write -32 r14 r5
+  or r0 r5 r1
+  addr2reg .Lstring.37 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -20 r14 r3
+  read -32 r14 r5
+  beq r1 r0 .L362
+  or r0 r5 r1
+  load 1 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_open
+  or r0 r1 r4
+  read -32 r14 r5
+  write -12 r14 r4
+  blts r4 r0 .L361
+  load 2 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump sys_lseek
+  write -8 r14 r1
+  read -12 r14 r4
+  load 0 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump sys_lseek
+  read -8 r14 r1
+  read -12 r14 r4
+  add r1 3 r1
+  shiftrs r1 31 r2
+  shiftr r2 30 r2
+  add r1 r2 r1
+  shiftrs r1 2 r2
+  write -28 r14 r2
+  blts r2 r0 .L360
+  shiftl r2 2 r1
+  add r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  read -28 r14 r2
+  read -12 r14 r4
+  read -20 r14 r3
+  write -24 r14 r1
+  beq r1 r0 .L357
+  load 0 r5
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  or r0 r3 r12
+  or r0 r5 r3
+  or r0 r12 r5
+.L345:
+  bgts r3 r1 .L348
+  shiftl r3 2 r6
+  add r2 r6 r7
+  load 0 r6
+  write 0 r7 r6
+  add r3 1 r3
+  jump .L345
+.L348:
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  load 0 r3
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L351:
+  write -16 r14 r3
+  bges r3 r1 .L356
+  sub r1 r3 r1
+  load 256 r5
+  bles r1 r5 .L354
+  load 256 r1
+.L354:
+  shiftl r3 2 r3
+  add r2 r3 r5
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump sys_read
+  or r0 r1 r5
+  read -16 r14 r3
+  read -24 r14 r2
+  read -28 r14 r1
+  read -12 r14 r4
+  add r5 3 r5
+  shiftrs r5 31 r6
+  shiftr r6 30 r6
+  add r5 r6 r5
+  shiftrs r5 2 r5
+  bles r5 r0 .L356
+  add r3 r5 r3
+  jump .L351
+.L356:
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  read -24 r14 r1
+  read -28 r14 r2
+  read -20 r14 r4
+  write 0 r4 r2
+  jump .L364
+.L357:
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.44 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L364
+.L360:
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  read -32 r14 r5
+  addr2reg .Lstring.43 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load 0 r1
+  jump .L364
+.L361:
+  addr2reg .Lstring.42 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load 0 r1
+  jump .L364
+.L362:
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump read_stdin_words
+.L364:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function read_file_words */
+
+
+.text
+; function read_file
+read_file:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r5
+  add r14 -20 r5
+  savpc r15
+  add r15 12 r15
+  jump read_file_words
+  read -16 r14 r5
+  beq r1 r0 .L377
+  read -20 r14 r2
+  shiftl r2 2 r2
+  write -20 r14 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L370:
+  load 0 r3
+  bles r1 r0 .L372
+  load 1 r3
+  sub r1 r3 r3
+  add r2 r3 r3
+  readb 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L372:
+  beq r3 r0 .L374
+  load 1 r3
+  sub r1 r3 r1
+  write -20 r14 r1
+  jump .L370
+.L374:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  add r1 r2 r3
+  load 0 r2
+  writeb 0 r3 r2
+  beq r5 r0 .L378
+  read -20 r14 r2
+  write 0 r5 r2
+  jump .L378
+.L377:
+  load 0 r1
+.L378:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function read_file */
+
+
+.text
+; function is_local_label_token
+is_local_label_token:
+  load 2 r1
+  blts r5 r1 .L387
+  add r4 0 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 46 r3
+  bne r2 r3 .L384
+  add r4 1 r1
+  readb 0 r1 r1
+  xor r1 76 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L384:
+  bne r1 r0 .L386
+  load 1 r1
+  jump .L388
+.L386:
+  load 0 r1
+  jump .L388
+.L387:
+  load 0 r1
+.L388:
+  jumpr 0 r15
+
+/* end function is_local_label_token */
+
+
+.text
+; function rewrite_local_labels
+rewrite_local_labels:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 124 r13
+  write -116 r14 r8
+  write -100 r14 r6
+  write -60 r14 r5
+  write -40 r14 r4
+  or r0 r7 r4
+  write -92 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  write -48 r14 r1
+  read -60 r14 r5
+  read -40 r14 r4
+  load 0 r3
+  load 0 r2
+  load 0 r1
+  write -80 r14 r1
+  or r0 r3 r1
+.L393:
+  write -24 r14 r1
+  write -56 r14 r2
+  add r4 r1 r3
+  readb 0 r3 r3
+  beq r3 r0 .L446
+  add r4 r1 r3
+  readb 0 r3 r6
+  write -96 r14 r6
+  load 34 r3
+  xor r6 r3 r3
+  sltu r3 1 r3
+  write -4 r14 r3
+  read -80 r14 r8
+  read -48 r14 r3
+  read -4 r14 r12
+  bne r12 r0 .L433
+  read -100 r14 r7
+  bne r8 r0 .L428
+  load 0 r7
+  write -8 r14 r7
+  load 46 r7
+  xor r6 r7 r8
+  sltu r8 1 r8
+  read -100 r14 r6
+  read -8 r14 r7
+  bne r8 r0 .L398
+  write -12 r14 r7
+  jump .L400
+.L398:
+  add r1 1 r7
+  add r4 r7 r7
+  readb 0 r7 r7
+  xor r7 76 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r8
+  write -12 r14 r8
+.L400:
+  load 0 r7
+  write -16 r14 r7
+  read -12 r14 r8
+  read -16 r14 r7
+  beq r8 r0 .L404
+  load 1 r7
+  write -20 r14 r7
+  xor r1 r0 r8
+  sltu r8 1 r8
+  read -20 r14 r7
+  bne r8 r0 .L403
+  load 1 r2
+  sub r1 r2 r1
+  add r4 r1 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  or r0 r1 r7
+  read -24 r14 r1
+  read -56 r14 r2
+  read -48 r14 r3
+  read -100 r14 r6
+  read -60 r14 r5
+  read -40 r14 r4
+  xor r7 0 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L403:
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L404:
+  bne r7 r0 .L409
+  add r2 1 r7
+  slt r7 r6 r6
+  xor r6 1 r6
+  read -92 r14 r7
+  bne r6 r0 .L408
+  add r2 1 r6
+  write -28 r14 r6
+  or r0 r2 r6
+  read -96 r14 r2
+  add r5 r6 r6
+  writeb 0 r6 r2
+  or r0 r1 r2
+  read -80 r14 r1
+  add r2 1 r2
+  write -32 r14 r2
+  read -28 r14 r2
+  or r0 r1 r6
+  read -100 r14 r1
+  read -32 r14 r1
+  write -80 r14 r6
+  jump .L393
+.L408:
+  load 0 r1
+  jump .L447
+.L409:
+  add r1 2 r1
+  write -52 r14 r1
+.L410:
+  write -44 r14 r1
+  add r4 r1 r2
+  readb 0 r2 r3
+  load 0 r2
+  beq r3 r0 .L412
+  add r4 r1 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  or r0 r1 r2
+  read -44 r14 r1
+  read -40 r14 r4
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L412:
+  beq r2 r0 .L414
+  add r1 1 r1
+  jump .L410
+.L414:
+  or r0 r1 r4
+  read -56 r14 r2
+  read -52 r14 r1
+  read -48 r14 r3
+  read -92 r14 r7
+  read -100 r14 r6
+  read -60 r14 r5
+  sub r4 r1 r1
+  write -36 r14 r1
+  add r2 3 r4
+  add r4 r3 r4
+  add r4 1 r4
+  add r4 r1 r1
+  bges r1 r6 .L427
+  add r2 1 r1
+  add r5 r2 r4
+  load 46 r2
+  writeb 0 r4 r2
+  add r1 1 r2
+  add r5 r1 r4
+  load 76 r1
+  writeb 0 r4 r1
+  add r2 1 r1
+  add r5 r2 r4
+  load 95 r2
+  writeb 0 r4 r2
+  load 0 r2
+.L417:
+  bges r2 r3 .L420
+  add r7 r2 r4
+  readb 0 r4 r4
+  or r0 r1 r6
+  add r1 1 r1
+  add r5 r6 r6
+  writeb 0 r6 r4
+  add r2 1 r2
+  jump .L417
+.L420:
+  or r0 r1 r3
+  read -36 r14 r6
+  read -52 r14 r1
+  read -40 r14 r4
+  add r3 1 r2
+  add r5 r3 r7
+  load 95 r3
+  writeb 0 r7 r3
+  load 0 r3
+.L422:
+  bges r3 r6 .L425
+  add r1 r3 r6
+  add r4 r6 r6
+  readb 0 r6 r6
+  or r0 r2 r7
+  add r2 1 r2
+  add r5 r7 r7
+  writeb 0 r7 r6
+  read -36 r14 r6
+  add r3 1 r3
+  jump .L422
+.L425:
+  read -44 r14 r1
+  read -80 r14 r6
+  read -48 r14 r3
+  read -92 r14 r7
+  write -80 r14 r6
+  jump .L393
+.L427:
+  load 0 r1
+  jump .L447
+.L428:
+  or r0 r7 r6
+  add r2 1 r7
+  slt r7 r6 r6
+  xor r6 1 r6
+  read -92 r14 r7
+  bne r6 r0 .L432
+  add r2 1 r6
+  write -64 r14 r6
+  or r0 r2 r6
+  read -96 r14 r2
+  add r5 r6 r6
+  writeb 0 r6 r2
+  or r0 r1 r2
+  read -80 r14 r1
+  add r2 1 r2
+  write -68 r14 r2
+  read -64 r14 r2
+  read -100 r14 r6
+  write -80 r14 r1
+  read -68 r14 r1
+  jump .L393
+.L432:
+  load 0 r1
+  jump .L447
+.L433:
+  or r0 r8 r7
+  load 1 r6
+  write -76 r14 r6
+  xor r1 r0 r6
+  sltu r6 1 r6
+  write -72 r14 r6
+  read -100 r14 r6
+  read -72 r14 r12
+  bne r12 r0 .L437
+  load 1 r6
+  sub r1 r6 r6
+  add r4 r6 r6
+  readb 0 r6 r6
+  xor r6 92 r6
+  sltu r0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+  write -84 r14 r6
+  read -80 r14 r7
+  read -100 r14 r6
+  read -84 r14 r12
+  write -88 r14 r12
+  jump .L438
+.L437:
+  read -76 r14 r12
+  write -88 r14 r12
+.L438:
+  read -88 r14 r12
+  bne r12 r0 .L440
+  write -108 r14 r7
+  jump .L442
+.L440:
+  xor r7 0 r7
+  sltu r7 1 r7
+  write -108 r14 r7
+.L442:
+  add r2 1 r7
+  slt r7 r6 r6
+  xor r6 1 r6
+  read -92 r14 r7
+  bne r6 r0 .L445
+  add r2 1 r6
+  write -104 r14 r6
+  or r0 r2 r6
+  read -96 r14 r2
+  add r5 r6 r6
+  writeb 0 r6 r2
+  read -100 r14 r6
+  add r1 1 r1
+  write -112 r14 r1
+  read -108 r14 r1
+  read -104 r14 r2
+  write -80 r14 r1
+  read -112 r14 r1
+  jump .L393
+.L445:
+  load 0 r1
+  jump .L447
+.L446:
+  add r5 r2 r2
+  load 0 r1
+  writeb 0 r2 r1
+  load 1 r1
+.L447:
+  read -116 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rewrite_local_labels */
+
+
+.text
+; function file_owns_conflict
+file_owns_conflict:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  or r0 r5 r4
+  or r0 r6 r5
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r2
+  read -16 r14 r5
+  load 1 r1
+  blts r2 r0 .L452
+  addr2reg sym_flags r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  and r1 2 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L452:
+  bne r1 r0 .L454
+  addr2reg sym_name r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump def_find
+  jump .L455
+.L454:
+  load 0 r1
+.L455:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function file_owns_conflict */
+
+
+.text
+; function rewrite_label_words
+rewrite_label_words:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 140 r13
+  write -132 r14 r8
+  write -116 r14 r6
+  write -68 r14 r5
+  write -48 r14 r4
+  or r0 r7 r4
+  write -120 r14 r4
+  shiftl r4 2 r2
+  addr2reg file_prefix r1
+  add r1 r2 r1
+  read 0 r1 r4
+  write -100 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  write -56 r14 r1
+  read -68 r14 r5
+  read -48 r14 r4
+  load 0 r6
+  load 0 r3
+  load 0 r2
+  load 0 r1
+  write -108 r14 r6
+  or r0 r3 r6
+  or r0 r2 r7
+  write -88 r14 r1
+.L460:
+  write -64 r14 r6
+  write -60 r14 r7
+  add r4 r6 r1
+  readb 0 r1 r1
+  beq r1 r0 .L517
+  add r4 r6 r1
+  readb 0 r1 r2
+  write -104 r14 r2
+  load 34 r1
+  xor r2 r1 r1
+  sltu r1 1 r1
+  write -8 r14 r1
+  read -88 r14 r8
+  read -56 r14 r3
+  read -8 r14 r12
+  bne r12 r0 .L504
+  read -116 r14 r1
+  bne r8 r0 .L500
+  and r2 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  write -12 r14 r1
+  read -64 r14 r6
+  read -60 r14 r7
+  read -56 r14 r3
+  read -116 r14 r1
+  read -68 r14 r5
+  read -48 r14 r4
+  load 0 r2
+  write -16 r14 r2
+  read -12 r14 r8
+  read -16 r14 r2
+  beq r8 r0 .L467
+  load 1 r2
+  write -20 r14 r2
+  xor r6 r0 r8
+  sltu r8 1 r8
+  read -20 r14 r2
+  bne r8 r0 .L466
+  load 1 r1
+  sub r6 r1 r1
+  add r4 r1 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  or r0 r1 r2
+  read -64 r14 r6
+  read -60 r14 r7
+  read -56 r14 r3
+  read -116 r14 r1
+  read -68 r14 r5
+  read -48 r14 r4
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L466:
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L467:
+  bne r2 r0 .L472
+  add r7 1 r2
+  slt r2 r1 r2
+  xor r2 1 r2
+  read -100 r14 r1
+  bne r2 r0 .L471
+  add r7 1 r2
+  write -28 r14 r2
+  read -104 r14 r2
+  add r5 r7 r7
+  writeb 0 r7 r2
+  read -88 r14 r7
+  add r6 1 r6
+  write -24 r14 r6
+  or r0 r4 r2
+  read -108 r14 r4
+  read -116 r14 r6
+  write -108 r14 r4
+  or r0 r2 r4
+  read -24 r14 r6
+  write -88 r14 r7
+  read -28 r14 r7
+  jump .L460
+.L471:
+  load32 -1 r1
+  jump .L519
+.L472:
+  or r0 r4 r2
+  or r0 r2 r4
+  or r0 r6 r1
+.L474:
+  write -52 r14 r1
+  add r4 r1 r2
+  readb 0 r2 r3
+  load 0 r2
+  beq r3 r0 .L476
+  add r4 r1 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  or r0 r1 r2
+  read -52 r14 r1
+  read -48 r14 r4
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L476:
+  beq r2 r0 .L478
+  add r1 1 r1
+  jump .L474
+.L478:
+  read -64 r14 r6
+  or r0 r4 r2
+  read -120 r14 r4
+  add r2 r6 r5
+  sub r1 r6 r6
+  savpc r15
+  add r15 12 r15
+  jump file_owns_conflict
+  write -32 r14 r1
+  read -52 r14 r1
+  read -64 r14 r6
+  read -60 r14 r7
+  read -56 r14 r3
+  read -116 r14 r2
+  read -68 r14 r5
+  read -48 r14 r4
+  read -32 r14 r12
+  bne r12 r0 .L481
+  read -108 r14 r12
+  write -44 r14 r12
+  jump .L491
+.L481:
+  read -100 r14 r1
+  add r7 4 r4
+  add r4 r3 r4
+  bges r4 r2 .L499
+  add r7 1 r4
+  add r5 r7 r6
+  load 95 r2
+  writeb 0 r6 r2
+  or r0 r3 r2
+  add r4 1 r3
+  add r5 r4 r6
+  load 95 r4
+  writeb 0 r6 r4
+  or r0 r1 r6
+  load 0 r1
+  or r0 r6 r4
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+.L485:
+  bges r2 r3 .L488
+  add r4 r2 r6
+  readb 0 r6 r6
+  or r0 r1 r7
+  add r1 1 r1
+  add r5 r7 r7
+  writeb 0 r7 r6
+  add r2 1 r2
+  jump .L485
+.L488:
+  or r0 r1 r3
+  read -52 r14 r1
+  read -64 r14 r6
+  read -116 r14 r2
+  read -48 r14 r4
+  add r3 1 r7
+  write -36 r14 r7
+  add r5 r3 r7
+  load 95 r3
+  writeb 0 r7 r3
+  read -36 r14 r3
+  add r3 1 r7
+  write -40 r14 r7
+  add r5 r3 r7
+  load 95 r3
+  writeb 0 r7 r3
+  read -40 r14 r7
+  load 1 r3
+  write -44 r14 r3
+.L491:
+  sub r1 r6 r3
+  add r7 r3 r3
+  bges r3 r2 .L498
+  or r0 r7 r3
+  or r0 r6 r2
+.L493:
+  bges r2 r1 .L496
+  add r4 r2 r6
+  readb 0 r6 r6
+  or r0 r3 r7
+  add r3 1 r3
+  add r5 r7 r7
+  writeb 0 r7 r6
+  add r2 1 r2
+  jump .L493
+.L496:
+  read -88 r14 r7
+  read -56 r14 r2
+  read -100 r14 r6
+  read -44 r14 r12
+  write -108 r14 r12
+  or r0 r1 r6
+  write -88 r14 r7
+  or r0 r3 r7
+  jump .L460
+.L498:
+  load32 -1 r1
+  jump .L519
+.L499:
+  load32 -1 r1
+  jump .L519
+.L500:
+  add r7 1 r2
+  slt r2 r1 r2
+  xor r2 1 r2
+  read -100 r14 r1
+  bne r2 r0 .L503
+  add r7 1 r2
+  write -76 r14 r2
+  read -104 r14 r2
+  add r5 r7 r7
+  writeb 0 r7 r2
+  read -88 r14 r7
+  add r6 1 r6
+  write -72 r14 r6
+  or r0 r7 r2
+  read -108 r14 r7
+  read -116 r14 r6
+  write -108 r14 r7
+  read -72 r14 r6
+  read -76 r14 r7
+  write -88 r14 r2
+  jump .L460
+.L503:
+  load32 -1 r1
+  jump .L519
+.L504:
+  or r0 r8 r2
+  load 1 r1
+  write -84 r14 r1
+  xor r6 r0 r1
+  sltu r1 1 r1
+  write -80 r14 r1
+  read -116 r14 r1
+  read -80 r14 r12
+  bne r12 r0 .L508
+  load 1 r1
+  sub r6 r1 r1
+  add r4 r1 r1
+  readb 0 r1 r1
+  xor r1 92 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  write -92 r14 r1
+  read -88 r14 r2
+  read -116 r14 r1
+  read -92 r14 r12
+  write -96 r14 r12
+  jump .L509
+.L508:
+  read -84 r14 r12
+  write -96 r14 r12
+.L509:
+  read -96 r14 r12
+  bne r12 r0 .L511
+  write -112 r14 r2
+  jump .L513
+.L511:
+  xor r2 0 r2
+  sltu r2 1 r2
+  write -112 r14 r2
+.L513:
+  add r7 1 r2
+  slt r2 r1 r2
+  xor r2 1 r2
+  read -100 r14 r1
+  bne r2 r0 .L516
+  add r7 1 r2
+  write -128 r14 r2
+  read -104 r14 r2
+  add r5 r7 r7
+  writeb 0 r7 r2
+  read -108 r14 r2
+  add r6 1 r6
+  write -124 r14 r6
+  read -112 r14 r7
+  read -116 r14 r6
+  write -108 r14 r2
+  read -124 r14 r6
+  write -88 r14 r7
+  read -128 r14 r7
+  jump .L460
+.L516:
+  load32 -1 r1
+  jump .L519
+.L517:
+  read -108 r14 r1
+  add r5 r7 r3
+  load 0 r2
+  writeb 0 r3 r2
+.L519:
+  read -132 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rewrite_label_words */
+
+
+.text
+; function clean_line
+clean_line:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 44 r13
+  write -36 r14 r8
+  write -32 r14 r6
+  write -24 r14 r5
+  load 0 r3
+  load 0 r2
+  load 0 r1
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L524:
+  add r4 r1 r6
+  readb 0 r6 r8
+  load 0 r7
+  read -32 r14 r6
+  bne r8 r0 .L526
+  or r0 r7 r6
+  jump .L527
+.L526:
+  add r2 1 r7
+  slt r7 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L527:
+  beq r6 r0 .L555
+  add r4 r1 r6
+  readb 0 r6 r6
+  load 34 r7
+  beq r6 r7 .L550
+  load 0 r7
+  write -8 r14 r7
+  xor r3 r0 r8
+  sltu r8 1 r8
+  read -8 r14 r7
+  beq r8 r0 .L531
+  xor r6 59 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L531:
+  bne r7 r0 .L549
+  load 0 r7
+  write -12 r14 r7
+  xor r3 r0 r8
+  sltu r8 1 r8
+  read -12 r14 r7
+  bne r8 r0 .L534
+  write -16 r14 r7
+  jump .L536
+.L534:
+  xor r6 47 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r8
+  write -16 r14 r8
+.L536:
+  load 0 r7
+  write -20 r14 r7
+  read -16 r14 r8
+  read -20 r14 r7
+  beq r8 r0 .L538
+  add r1 1 r7
+  add r4 r7 r7
+  readb 0 r7 r7
+  xor r7 42 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L538:
+  bne r7 r0 .L540
+  or r0 r2 r7
+  add r2 1 r2
+  add r5 r7 r7
+  writeb 0 r7 r6
+  read -32 r14 r6
+  add r1 1 r1
+  jump .L524
+.L540:
+  add r1 2 r1
+.L541:
+  add r4 r1 r5
+  readb 0 r5 r5
+  beq r5 r0 .L548
+  add r4 r1 r5
+  readb 0 r5 r6
+  load 0 r5
+  load 42 r7
+  bne r6 r7 .L544
+  add r1 1 r5
+  add r4 r5 r5
+  readb 0 r5 r5
+  xor r5 47 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L544:
+  bne r5 r0 .L546
+  add r1 1 r1
+  jump .L541
+.L546:
+  read -32 r14 r6
+  read -24 r14 r5
+  add r1 2 r1
+  jump .L524
+.L548:
+  read -32 r14 r6
+  read -24 r14 r5
+  jump .L524
+.L549:
+  or r0 r2 r1
+  jump .L556
+.L550:
+  load 1 r7
+  write -28 r14 r7
+  xor r1 r0 r8
+  sltu r8 1 r8
+  read -28 r14 r7
+  bne r8 r0 .L552
+  load 1 r7
+  sub r1 r7 r7
+  add r4 r7 r7
+  readb 0 r7 r7
+  xor r7 92 r7
+  sltu r0 r7 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L552:
+  beq r7 r0 .L554
+  xor r3 0 r3
+  sltu r3 1 r3
+.L554:
+  or r0 r2 r7
+  add r2 1 r2
+  add r5 r7 r7
+  writeb 0 r7 r6
+  read -32 r14 r6
+  add r1 1 r1
+  jump .L524
+.L555:
+  or r0 r2 r1
+.L556:
+  add r5 r1 r3
+  or r0 r1 r2
+  load 0 r1
+  writeb 0 r3 r1
+  or r0 r5 r1
+.L558:
+  readb 0 r1 r3
+  load 1 r4
+  load 32 r6
+  beq r3 r6 .L560
+  xor r3 9 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  jump .L561
+.L560:
+  or r0 r4 r3
+.L561:
+  beq r3 r0 .L563
+  add r1 1 r1
+  jump .L558
+.L563:
+  beq r1 r5 .L569
+  load 0 r2
+.L565:
+  add r1 r2 r3
+  readb 0 r3 r3
+  beq r3 r0 .L567
+  add r1 r2 r3
+  readb 0 r3 r3
+  add r5 r2 r4
+  writeb 0 r4 r3
+  add r2 1 r2
+  jump .L565
+.L567:
+  or r0 r2 r1
+  add r5 r1 r3
+  or r0 r1 r2
+  load 0 r1
+  writeb 0 r3 r1
+.L569:
+  or r0 r2 r1
+  or r0 r1 r2
+.L571:
+  load 0 r1
+  bles r2 r0 .L578
+  load 1 r1
+  sub r2 r1 r1
+  add r5 r1 r1
+  readb 0 r1 r3
+  load 1 r1
+  load 32 r4
+  beq r3 r4 .L574
+  load 1 r1
+  sub r2 r1 r1
+  add r5 r1 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r3
+  jump .L575
+.L574:
+  or r0 r1 r3
+.L575:
+  load 1 r1
+  bne r3 r0 .L577
+  load 1 r1
+  sub r2 r1 r1
+  add r5 r1 r1
+  readb 0 r1 r1
+  xor r1 13 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L577:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L578:
+  beq r1 r0 .L580
+  load 1 r1
+  sub r2 r1 r2
+  jump .L571
+.L580:
+  or r0 r2 r1
+  add r5 r1 r3
+  load 0 r2
+  writeb 0 r3 r2
+  read -36 r14 r8
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function clean_line */
+
+.data
+.balign 1
+.Lstring.52:
+	.ascii ".text\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.53:
+	.ascii ".code\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.54:
+	.ascii ".data\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.55:
+	.ascii ".rdata\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.56:
+	.ascii ".bss\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.57:
+	.ascii ".balign\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.58:
+	.ascii ".balign needs number: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.59:
+	.ascii ".globl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.60:
+	.ascii ".global\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.61:
+	.ascii ".ascii\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.62:
+	.ascii "missing quote in .ascii: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.63:
+	.ascii ".byte\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.64:
+	.ascii ".byte needs number: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.65:
+	.ascii ".short\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.66:
+	.ascii ".short needs number: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.67:
+	.ascii ".int\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.68:
+	.ascii ".int needs number: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.69:
+	.ascii ".int label too long: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.70:
+	.ascii ".fill\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.71:
+	.ascii "bad .fill: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.72:
+	.ascii ".dw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.73:
+	.ascii ".dw needs number: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.74:
+	.ascii "load32\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.75:
+	.ascii "bad load32 value: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.76:
+	.ascii "bad load32 register: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.77:
+	.ascii "addr2reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.78:
+	.ascii "bad addr2reg register: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.79:
+	.ascii "addr2reg label too long: \000"
+/* end data */
+
+
+.text
+; function parse_one_line
+parse_one_line:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 988 r13
+  write -124 r14 r6
+  write -128 r14 r5
+  or r0 r4 r5
+  write -120 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r2
+  read -124 r14 r6
+  read -128 r14 r5
+  or r0 r5 r1
+  read -120 r14 r5
+  write -12 r14 r2
+  bne r2 r0 8
+  jump .L881
+  add r5 0 r3
+  readb 0 r3 r3
+  load 35 r4
+  bne r3 r4 8
+  jump .L881
+  add r5 0 r3
+  readb 0 r3 r3
+  load 46 r4
+  beq r3 r4 .L589
+  or r0 r1 r12
+  or r0 r5 r1
+  or r0 r12 r5
+  jump .L676
+.L589:
+  load 5 r6
+  or r0 r5 r1
+  addr2reg .Lstring.52 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -124 r14 r6
+  read -120 r14 r5
+  load 0 r1
+  bne r2 r0 .L596
+  add r5 5 r1
+  readb 0 r1 r2
+  load 1 r1
+  beq r2 r0 .L592
+  add r5 5 r1
+  readb 0 r1 r1
+  xor r1 32 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L593
+.L592:
+  or r0 r1 r2
+.L593:
+  load 1 r1
+  bne r2 r0 .L595
+  add r5 5 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L595:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L596:
+  beq r1 r0 8
+  jump .L879
+  load 5 r6
+  or r0 r5 r1
+  addr2reg .Lstring.53 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -124 r14 r6
+  read -120 r14 r5
+  load 0 r1
+  bne r2 r0 .L604
+  add r5 5 r1
+  readb 0 r1 r2
+  load 1 r1
+  beq r2 r0 .L600
+  add r5 5 r1
+  readb 0 r1 r1
+  xor r1 32 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L601
+.L600:
+  or r0 r1 r2
+.L601:
+  load 1 r1
+  bne r2 r0 .L603
+  add r5 5 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L603:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L604:
+  beq r1 r0 8
+  jump .L877
+  load 5 r6
+  or r0 r5 r1
+  addr2reg .Lstring.54 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -124 r14 r6
+  read -120 r14 r5
+  load 0 r1
+  bne r2 r0 .L612
+  add r5 5 r1
+  readb 0 r1 r2
+  load 1 r1
+  beq r2 r0 .L608
+  add r5 5 r1
+  readb 0 r1 r1
+  xor r1 32 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L609
+.L608:
+  or r0 r1 r2
+.L609:
+  load 1 r1
+  bne r2 r0 .L611
+  add r5 5 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L611:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L612:
+  beq r1 r0 8
+  jump .L875
+  load 6 r6
+  or r0 r5 r1
+  addr2reg .Lstring.55 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -124 r14 r6
+  read -120 r14 r5
+  load 0 r1
+  bne r2 r0 .L620
+  add r5 6 r1
+  readb 0 r1 r2
+  load 1 r1
+  beq r2 r0 .L616
+  add r5 6 r1
+  readb 0 r1 r1
+  xor r1 32 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L617
+.L616:
+  or r0 r1 r2
+.L617:
+  load 1 r1
+  bne r2 r0 .L619
+  add r5 6 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L619:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L620:
+  beq r1 r0 8
+  jump .L873
+  load 4 r6
+  or r0 r5 r1
+  addr2reg .Lstring.56 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -124 r14 r6
+  read -120 r14 r5
+  load 0 r1
+  bne r2 r0 .L628
+  add r5 4 r1
+  readb 0 r1 r2
+  load 1 r1
+  beq r2 r0 .L624
+  add r5 4 r1
+  readb 0 r1 r1
+  xor r1 32 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L625
+.L624:
+  or r0 r1 r2
+.L625:
+  load 1 r1
+  bne r2 r0 .L627
+  add r5 4 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L627:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L628:
+  beq r1 r0 8
+  jump .L871
+  load 7 r6
+  or r0 r5 r1
+  addr2reg .Lstring.57 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -120 r14 r5
+  load 0 r1
+  bne r2 r0 .L633
+  add r5 7 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 32 r3
+  beq r2 r3 .L632
+  add r5 7 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L632:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L633:
+  beq r1 r0 8
+  jump .L867
+  load 6 r6
+  or r0 r5 r1
+  addr2reg .Lstring.59 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -120 r14 r5
+  load 0 r1
+  beq r2 r0 .L636
+  or r0 r1 r2
+  jump .L639
+.L636:
+  add r5 6 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 32 r3
+  beq r2 r3 .L638
+  add r5 6 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L638:
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L639:
+  load 1 r1
+  bne r2 r0 .L645
+  load 7 r6
+  or r0 r5 r1
+  addr2reg .Lstring.60 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -120 r14 r5
+  load 0 r1
+  bne r2 r0 .L644
+  add r5 7 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 32 r3
+  beq r2 r3 .L643
+  add r5 7 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L643:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L644:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L645:
+  beq r1 r0 8
+  jump .L860
+  load 6 r6
+  or r0 r5 r1
+  addr2reg .Lstring.61 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r3
+  read -124 r14 r6
+  read -128 r14 r5
+  or r0 r5 r1
+  read -120 r14 r5
+  load 0 r2
+  bne r3 r0 .L650
+  add r5 6 r2
+  readb 0 r2 r3
+  load 1 r2
+  load 32 r4
+  beq r3 r4 .L649
+  add r5 6 r2
+  readb 0 r2 r2
+  xor r2 9 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L649:
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L650:
+  beq r2 r0 8
+  jump .L809
+  load 5 r6
+  or r0 r5 r1
+  addr2reg .Lstring.63 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -120 r14 r5
+  load 0 r1
+  bne r2 r0 .L655
+  add r5 5 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 32 r3
+  beq r2 r3 .L654
+  add r5 5 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L654:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L655:
+  beq r1 r0 8
+  jump .L804
+  load 6 r6
+  or r0 r5 r1
+  addr2reg .Lstring.65 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -120 r14 r5
+  load 0 r1
+  bne r2 r0 .L660
+  add r5 6 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 32 r3
+  beq r2 r3 .L659
+  add r5 6 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L659:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L660:
+  beq r1 r0 8
+  jump .L798
+  load 4 r6
+  or r0 r5 r1
+  addr2reg .Lstring.67 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -120 r14 r5
+  load 0 r1
+  bne r2 r0 .L665
+  add r5 4 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 32 r3
+  beq r2 r3 .L664
+  add r5 4 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L664:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L665:
+  bne r1 r0 .L765
+  load 5 r6
+  or r0 r5 r1
+  addr2reg .Lstring.70 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r2
+  read -120 r14 r5
+  load 0 r1
+  bne r2 r0 .L670
+  add r5 5 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 32 r3
+  beq r2 r3 .L669
+  add r5 5 r1
+  readb 0 r1 r1
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L669:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L670:
+  bne r1 r0 .L751
+  load 3 r6
+  or r0 r5 r1
+  addr2reg .Lstring.72 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r4
+  read -12 r14 r2
+  read -124 r14 r6
+  read -128 r14 r5
+  read -120 r14 r1
+  load 0 r3
+  bne r4 r0 .L675
+  add r1 3 r3
+  readb 0 r3 r4
+  load 1 r3
+  load 32 r7
+  beq r4 r7 .L674
+  add r1 3 r3
+  readb 0 r3 r3
+  xor r3 9 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L674:
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L675:
+  bne r3 r0 .L730
+.L676:
+  load 0 r3
+  load 1 r4
+  bles r2 r4 .L678
+  load 1 r3
+  sub r2 r3 r3
+  add r1 r3 r3
+  readb 0 r3 r3
+  xor r3 58 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L678:
+  bne r3 r0 .L720
+  load 0 r2
+  or r0 r1 r4
+  or r0 r2 r1
+.L681:
+  add r4 r1 r2
+  readb 0 r2 r3
+  load 0 r2
+  beq r3 r0 .L683
+  slt r1 511 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L683:
+  beq r2 r0 .L685
+  add r4 r1 r2
+  readb 0 r2 r2
+  add r14 -780 r3
+  add r3 r1 r3
+  writeb 0 r3 r2
+  add r1 1 r1
+  jump .L681
+.L685:
+  add r14 -780 r2
+  add r2 r1 r2
+  load 0 r1
+  writeb 0 r2 r1
+  load 16 r6
+  add r14 -268 r5
+  add r14 -780 r4
+  savpc r15
+  add r15 12 r15
+  jump tokenize
+  or r0 r1 r2
+  write -16 r14 r2
+  bne r2 r0 8
+  jump .L881
+  load 0 r1
+  load 3 r3
+  bne r2 r3 .L688
+  add r14 -268 r1
+  add r1 0 r1
+  read 0 r1 r4
+  addr2reg .Lstring.74 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -16 r14 r2
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L688:
+  bne r1 r0 .L714
+  load 0 r1
+  load 3 r3
+  bne r2 r3 .L691
+  add r14 -268 r1
+  add r1 0 r1
+  read 0 r1 r4
+  addr2reg .Lstring.77 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L691:
+  bne r1 r0 .L695
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -120 r14 r1
+  write -20 r14 r2
+  bges r2 r0 8
+  jump .L881
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -120 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strdup_n
+  read -20 r14 r2
+  read -124 r14 r6
+  read -128 r14 r5
+  addr2reg line_text r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L695:
+  add r14 -268 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  write -36 r14 r1
+  load 0 r1
+  write -136 r14 r1
+  add r14 -268 r1
+  add r1 4 r1
+  read 0 r1 r5
+  write -28 r14 r5
+  or r0 r5 r1
+  load 43 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strchr
+  write -24 r14 r1
+  read -28 r14 r5
+  or r0 r5 r1
+  load 45 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strchr
+  or r0 r1 r2
+  read -24 r14 r1
+  read -28 r14 r5
+  read -36 r14 r4
+  or r0 r5 r3
+  read -120 r14 r5
+  blts r4 r0 .L713
+  or r0 r3 r5
+  bne r1 r0 .L702
+  or r0 r2 r1
+  beq r1 r0 .L703
+  load 0 r2
+  writeb 0 r1 r2
+  add r1 1 r4
+  add r14 -132 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -28 r14 r5
+  beq r1 r0 .L703
+  read -132 r14 r1
+  sub r0 r1 r1
+  write -136 r14 r1
+  jump .L703
+.L702:
+  load 0 r2
+  writeb 0 r1 r2
+  add r1 1 r4
+  add r14 -136 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -28 r14 r5
+.L703:
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r3
+  read -28 r14 r5
+  read -124 r14 r6
+  or r0 r5 r1
+  read -128 r14 r5
+  load 64 r2
+  bges r3 r2 .L711
+  load 0 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L706:
+  bges r1 r3 .L709
+  add r2 r1 r4
+  readb 0 r4 r4
+  add r14 -200 r7
+  add r7 r1 r7
+  writeb 0 r7 r4
+  add r1 1 r1
+  jump .L706
+.L709:
+  add r14 -200 r1
+  add r1 r3 r2
+  load 0 r1
+  writeb 0 r2 r1
+  load 11 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  write -32 r14 r2
+  bges r2 r0 8
+  jump .L881
+  add r14 -200 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_intern
+  or r0 r1 r3
+  read -32 r14 r2
+  read -36 r14 r1
+  read -124 r14 r6
+  read -128 r14 r5
+  addr2reg line_label r12
+  read 0 r12 r4
+  shiftl r2 2 r7
+  add r4 r7 r4
+  write 0 r4 r3
+  read -136 r14 r3
+  addr2reg line_label_off r12
+  read 0 r12 r4
+  shiftl r2 2 r7
+  add r4 r7 r4
+  write 0 r4 r3
+  addr2reg line_value r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L711:
+  or r0 r1 r5
+  addr2reg .Lstring.79 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L713:
+  addr2reg .Lstring.78 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L714:
+  load 0 r1
+  write -204 r14 r1
+  add r14 -268 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -204 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -120 r14 r5
+  beq r1 r0 .L719
+  add r14 -268 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  read -120 r14 r5
+  write -40 r14 r1
+  blts r1 r0 .L718
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r3
+  read -40 r14 r1
+  read -124 r14 r6
+  read -128 r14 r5
+  bges r3 r0 8
+  jump .L881
+  read -204 r14 r2
+  addr2reg line_value r12
+  read 0 r12 r4
+  shiftl r3 2 r7
+  add r4 r7 r4
+  write 0 r4 r2
+  addr2reg line_label_off r12
+  read 0 r12 r2
+  shiftl r3 2 r4
+  add r2 r4 r2
+  write 0 r2 r1
+  read 0 r6 r2
+  addr2reg line_section r12
+  read 0 r12 r4
+  or r0 r5 r1
+  shiftl r3 2 r5
+  add r4 r5 r4
+  write 0 r4 r2
+  addr2reg line_file_idx r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  jump .L881
+.L718:
+  addr2reg .Lstring.76 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L719:
+  addr2reg .Lstring.75 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L720:
+  or r0 r5 r12
+  or r0 r1 r5
+  or r0 r12 r1
+  load 1 r3
+  sub r2 r3 r2
+  load 64 r3
+  bges r2 r3 .L729
+  load 0 r3
+  or r0 r5 r4
+  or r0 r1 r5
+  or r0 r3 r1
+.L724:
+  bges r1 r2 .L727
+  add r4 r1 r3
+  readb 0 r3 r3
+  add r14 -844 r7
+  add r7 r1 r7
+  writeb 0 r7 r3
+  add r1 1 r1
+  jump .L724
+.L727:
+  add r14 -844 r1
+  add r1 r2 r2
+  load 0 r1
+  writeb 0 r2 r1
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  write -44 r14 r2
+  bges r2 r0 8
+  jump .L881
+  add r14 -844 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_intern
+  read -44 r14 r2
+  read -124 r14 r6
+  read -128 r14 r5
+  addr2reg line_text r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L729:
+  addr2reg .Lstring.34 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L730:
+  or r0 r1 r5
+  load 0 r1
+  write -856 r14 r1
+  add r5 3 r4
+  savpc r15
+  add r15 12 r15
+  jump lstrip
+  or r0 r1 r4
+  write -52 r14 r4
+  add r4 0 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 45 r3
+  beq r2 r3 .L733
+  add r4 0 r1
+  readb 0 r1 r1
+  xor r1 43 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L734
+.L733:
+  or r0 r1 r2
+.L734:
+  load 1 r1
+  bne r2 r0 .L738
+  add r4 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 48 r3
+  blts r2 r3 .L737
+  add r4 0 r1
+  readb 0 r1 r2
+  load 57 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L737:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L738:
+  bne r1 r0 .L747
+  load 0 r1
+  write -852 r14 r1
+  load 43 r5
+  savpc r15
+  add r15 12 r15
+  jump strchr
+  write -48 r14 r1
+  read -52 r14 r4
+  load 45 r5
+  savpc r15
+  add r15 12 r15
+  jump strchr
+  or r0 r1 r2
+  read -48 r14 r1
+  bne r1 r0 .L744
+  or r0 r2 r1
+  beq r1 r0 .L745
+  load 0 r2
+  writeb 0 r1 r2
+  add r1 1 r4
+  add r14 -848 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  beq r1 r0 .L745
+  read -848 r14 r1
+  sub r0 r1 r1
+  write -852 r14 r1
+  jump .L745
+.L744:
+  load 0 r2
+  writeb 0 r1 r2
+  add r1 1 r4
+  add r14 -852 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+.L745:
+  load 4 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -52 r14 r4
+  write -56 r14 r2
+  bges r2 r0 8
+  jump .L881
+  savpc r15
+  add r15 12 r15
+  jump pool_intern
+  read -56 r14 r2
+  read -124 r14 r6
+  read -128 r14 r5
+  addr2reg line_label r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read -852 r14 r1
+  addr2reg line_label_off r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L747:
+  add r14 -856 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -120 r14 r5
+  beq r1 r0 .L750
+  load 3 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -124 r14 r6
+  read -128 r14 r5
+  blts r2 r0 .L881
+  read -856 r14 r1
+  addr2reg line_value r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L750:
+  addr2reg .Lstring.73 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L751:
+  add r5 5 r4
+  savpc r15
+  add r15 12 r15
+  jump lstrip
+  or r0 r1 r4
+  load 6 r6
+  add r14 -892 r5
+  savpc r15
+  add r15 12 r15
+  jump tokenize_csv
+  read -120 r14 r5
+  load 1 r2
+  beq r1 r2 .L757
+  load 2 r2
+  beq r1 r2 .L756
+  load 3 r2
+  beq r1 r2 .L755
+  addr2reg .Lstring.71 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L755:
+  add r14 -892 r1
+  add r1 0 r1
+  read 0 r1 r4
+  add r14 -868 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  add r14 -892 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -864 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  add r14 -892 r1
+  add r1 8 r1
+  read 0 r1 r4
+  add r14 -860 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  jump .L758
+.L756:
+  add r14 -892 r1
+  add r1 0 r1
+  read 0 r1 r4
+  add r14 -868 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  add r14 -892 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -864 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  load 0 r1
+  write -860 r14 r1
+  jump .L758
+.L757:
+  add r14 -892 r1
+  add r1 0 r1
+  read 0 r1 r4
+  add r14 -868 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  load 1 r1
+  write -864 r14 r1
+  load 0 r1
+  write -860 r14 r1
+.L758:
+  addr2reg byte_pool_pos r12
+  read 0 r12 r3
+  write -68 r14 r3
+  read -868 r14 r1
+  read -864 r14 r2
+  mults r1 r2 r1
+  write -60 r14 r1
+  load 0 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L760:
+  write -64 r14 r1
+  bges r1 r2 .L763
+  read -860 r14 r1
+  and r1 255 r4
+  savpc r15
+  add r15 12 r15
+  jump byte_pool_emit
+  or r0 r1 r3
+  read -64 r14 r1
+  read -60 r14 r2
+  blts r3 r0 .L881
+  add r1 1 r1
+  jump .L760
+.L763:
+  load 5 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -60 r14 r1
+  read -68 r14 r3
+  read -124 r14 r6
+  read -128 r14 r5
+  blts r2 r0 .L881
+  addr2reg line_byte_off r12
+  read 0 r12 r4
+  shiftl r2 2 r7
+  add r4 r7 r4
+  write 0 r4 r3
+  addr2reg line_byte_len r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L765:
+  add r5 4 r4
+  savpc r15
+  add r15 12 r15
+  jump lstrip
+  or r0 r1 r4
+  write -76 r14 r4
+  add r4 0 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 45 r3
+  beq r2 r3 .L767
+  add r4 0 r1
+  readb 0 r1 r1
+  xor r1 43 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L768
+.L767:
+  or r0 r1 r2
+.L768:
+  load 1 r1
+  bne r2 r0 .L772
+  add r4 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 48 r3
+  blts r2 r3 .L771
+  add r4 0 r1
+  readb 0 r1 r2
+  load 57 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L771:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L772:
+  bne r1 r0 .L790
+  load 0 r1
+  write -964 r14 r1
+  load 43 r5
+  savpc r15
+  add r15 12 r15
+  jump strchr
+  write -72 r14 r1
+  read -76 r14 r4
+  load 45 r5
+  savpc r15
+  add r15 12 r15
+  jump strchr
+  or r0 r1 r2
+  read -72 r14 r1
+  read -76 r14 r4
+  bne r1 r0 .L779
+  or r0 r2 r1
+  beq r1 r0 .L781
+  load 0 r2
+  write -896 r14 r2
+  load 0 r2
+  writeb 0 r1 r2
+  add r1 1 r4
+  add r14 -896 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -76 r14 r4
+  bne r1 r0 .L778
+  load 0 r1
+  write -896 r14 r1
+.L778:
+  read -896 r14 r1
+  sub r0 r1 r1
+  write -964 r14 r1
+  jump .L781
+.L779:
+  load 0 r2
+  writeb 0 r1 r2
+  add r1 1 r4
+  add r14 -964 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -76 r14 r4
+  bne r1 r0 .L781
+  load 0 r1
+  write -964 r14 r1
+.L781:
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r3
+  read -76 r14 r4
+  read -124 r14 r6
+  read -128 r14 r5
+  load 64 r1
+  bges r3 r1 .L789
+  load 0 r1
+  or r0 r1 r2
+  or r0 r4 r1
+.L784:
+  bges r2 r3 .L787
+  add r1 r2 r4
+  readb 0 r4 r4
+  add r14 -960 r7
+  add r7 r2 r7
+  writeb 0 r7 r4
+  add r2 1 r2
+  jump .L784
+.L787:
+  add r14 -960 r1
+  add r1 r3 r2
+  load 0 r1
+  writeb 0 r2 r1
+  load 6 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  write -80 r14 r2
+  blts r2 r0 .L881
+  add r14 -960 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_intern
+  read -80 r14 r2
+  read -124 r14 r6
+  read -128 r14 r5
+  addr2reg line_label r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read -964 r14 r1
+  addr2reg line_label_off r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L789:
+  or r0 r4 r5
+  addr2reg .Lstring.69 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L790:
+  load 0 r1
+  write -968 r14 r1
+  addr2reg byte_pool_pos r12
+  read 0 r12 r1
+  write -84 r14 r1
+  add r14 -968 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -120 r14 r5
+  beq r1 r0 .L797
+  read -968 r14 r1
+  and r1 255 r4
+  savpc r15
+  add r15 12 r15
+  jump byte_pool_emit
+  blts r1 r0 .L881
+  read -968 r14 r1
+  shiftrs r1 8 r1
+  and r1 255 r4
+  savpc r15
+  add r15 12 r15
+  jump byte_pool_emit
+  blts r1 r0 .L881
+  read -968 r14 r1
+  shiftrs r1 16 r1
+  and r1 255 r4
+  savpc r15
+  add r15 12 r15
+  jump byte_pool_emit
+  blts r1 r0 .L881
+  read -968 r14 r1
+  shiftrs r1 24 r1
+  and r1 255 r4
+  savpc r15
+  add r15 12 r15
+  jump byte_pool_emit
+  blts r1 r0 .L881
+  load 5 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -84 r14 r1
+  read -124 r14 r6
+  read -128 r14 r5
+  blts r2 r0 .L881
+  addr2reg line_byte_off r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_byte_len r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 4 r1
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L797:
+  addr2reg .Lstring.68 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L798:
+  load 0 r1
+  write -972 r14 r1
+  add r5 6 r4
+  savpc r15
+  add r15 12 r15
+  jump lstrip
+  or r0 r1 r4
+  addr2reg byte_pool_pos r12
+  read 0 r12 r1
+  write -88 r14 r1
+  add r14 -972 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -120 r14 r5
+  beq r1 r0 .L803
+  read -972 r14 r1
+  and r1 255 r4
+  savpc r15
+  add r15 12 r15
+  jump byte_pool_emit
+  blts r1 r0 .L881
+  read -972 r14 r1
+  shiftrs r1 8 r1
+  and r1 255 r4
+  savpc r15
+  add r15 12 r15
+  jump byte_pool_emit
+  blts r1 r0 .L881
+  load 5 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -88 r14 r1
+  read -124 r14 r6
+  read -128 r14 r5
+  blts r2 r0 .L881
+  addr2reg line_byte_off r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_byte_len r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 2 r1
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L803:
+  addr2reg .Lstring.66 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L804:
+  load 0 r1
+  write -976 r14 r1
+  add r5 5 r4
+  savpc r15
+  add r15 12 r15
+  jump lstrip
+  or r0 r1 r4
+  addr2reg byte_pool_pos r12
+  read 0 r12 r1
+  write -92 r14 r1
+  add r14 -976 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -120 r14 r5
+  beq r1 r0 .L808
+  read -976 r14 r1
+  and r1 255 r4
+  savpc r15
+  add r15 12 r15
+  jump byte_pool_emit
+  blts r1 r0 .L881
+  load 5 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r3
+  read -92 r14 r1
+  read -124 r14 r6
+  read -128 r14 r5
+  blts r3 r0 .L881
+  addr2reg line_byte_off r12
+  read 0 r12 r2
+  shiftl r3 2 r4
+  add r2 r4 r2
+  write 0 r2 r1
+  addr2reg line_byte_len r12
+  read 0 r12 r1
+  shiftl r3 2 r2
+  add r1 r2 r2
+  load 1 r1
+  write 0 r2 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r4
+  or r0 r5 r2
+  shiftl r3 2 r5
+  add r4 r5 r4
+  write 0 r4 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r3 2 r3
+  add r1 r3 r1
+  write 0 r1 r2
+  jump .L881
+.L808:
+  addr2reg .Lstring.64 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L809:
+  or r0 r1 r2
+  add r5 6 r1
+  or r0 r5 r4
+  or r0 r2 r5
+.L812:
+  readb 0 r1 r2
+  load 0 r3
+  beq r2 r0 .L814
+  xor r2 34 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L814:
+  beq r3 r0 .L816
+  add r1 1 r1
+  jump .L812
+.L816:
+  or r0 r2 r3
+  or r0 r5 r2
+  or r0 r4 r5
+  load 34 r4
+  bne r3 r4 .L859
+  or r0 r2 r5
+  add r1 1 r2
+  addr2reg byte_pool_pos r12
+  read 0 r12 r3
+  write -108 r14 r3
+.L820:
+  readb 0 r2 r1
+  load 0 r3
+  beq r1 r0 .L822
+  xor r1 34 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L822:
+  beq r3 r0 .L856
+  load 0 r3
+  load 92 r4
+  bne r1 r4 .L825
+  add r2 1 r3
+  readb 0 r3 r3
+  and r3 0xFF r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L825:
+  bne r3 r0 .L828
+  add r2 1 r2
+  write -104 r14 r2
+  jump .L854
+.L828:
+  add r2 1 r2
+  readb 0 r2 r1
+  load 110 r3
+  beq r1 r3 .L851
+  load 114 r3
+  beq r1 r3 .L850
+  load 116 r3
+  beq r1 r3 .L849
+  load 92 r3
+  beq r1 r3 .L848
+  load 34 r3
+  beq r1 r3 .L847
+  load 0 r3
+  load 48 r4
+  blts r1 r4 .L835
+  load 55 r3
+  slt r3 r1 r3
+  xor r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L835:
+  beq r3 r0 .L852
+  load 0 r3
+  load 0 r1
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L838:
+  write -100 r14 r2
+  load 0 r4
+  load 3 r7
+  blts r3 r7 .L840
+  or r0 r4 r7
+  jump .L841
+.L840:
+  readb 0 r2 r4
+  slt r4 48 r4
+  xor r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r7
+.L841:
+  load 0 r4
+  beq r7 r0 .L843
+  readb 0 r2 r7
+  load 55 r4
+  slt r4 r7 r4
+  xor r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L843:
+  beq r4 r0 .L845
+  shiftl r1 3 r1
+  readb 0 r2 r4
+  load 48 r7
+  sub r4 r7 r4
+  add r1 r4 r1
+  add r2 1 r2
+  add r3 1 r3
+  jump .L838
+.L845:
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump byte_pool_emit
+  read -100 r14 r2
+  blts r1 r0 .L881
+  read -124 r14 r6
+  read -128 r14 r5
+  jump .L820
+.L847:
+  load 34 r1
+  jump .L852
+.L848:
+  load 92 r1
+  jump .L852
+.L849:
+  load 9 r1
+  jump .L852
+.L850:
+  load 13 r1
+  jump .L852
+.L851:
+  load 10 r1
+.L852:
+  add r2 1 r2
+  write -104 r14 r2
+.L854:
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump byte_pool_emit
+  read -104 r14 r2
+  blts r1 r0 .L881
+  read -124 r14 r6
+  read -128 r14 r5
+  jump .L820
+.L856:
+  read -108 r14 r3
+  addr2reg byte_pool_pos r12
+  read 0 r12 r1
+  sub r1 r3 r1
+  write -96 r14 r1
+  load 5 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -96 r14 r1
+  read -108 r14 r3
+  read -124 r14 r6
+  read -128 r14 r5
+  blts r2 r0 .L881
+  addr2reg line_byte_off r12
+  read 0 r12 r4
+  shiftl r2 2 r7
+  add r4 r7 r4
+  write 0 r4 r3
+  addr2reg line_byte_len r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L859:
+  addr2reg .Lstring.62 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L860:
+  add r5 3 r1
+  readb 0 r1 r1
+  load 98 r2
+  beq r1 r2 .L863
+  add r5 7 r4
+  savpc r15
+  add r15 12 r15
+  jump lstrip
+  or r0 r1 r4
+  write -112 r14 r4
+  jump .L865
+.L863:
+  add r5 6 r4
+  savpc r15
+  add r15 12 r15
+  jump lstrip
+  or r0 r1 r4
+  write -112 r14 r4
+.L865:
+  load 7 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -112 r14 r4
+  write -116 r14 r2
+  blts r2 r0 .L881
+  savpc r15
+  add r15 12 r15
+  jump pool_intern
+  read -116 r14 r2
+  read -124 r14 r6
+  read -128 r14 r5
+  addr2reg line_text r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L867:
+  load 0 r1
+  write -980 r14 r1
+  add r5 7 r4
+  savpc r15
+  add r15 12 r15
+  jump lstrip
+  or r0 r1 r4
+  add r14 -980 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -120 r14 r5
+  beq r1 r0 .L870
+  load 9 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -124 r14 r6
+  read -128 r14 r5
+  blts r2 r0 .L881
+  read -980 r14 r1
+  addr2reg line_align r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  read 0 r6 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L870:
+  addr2reg .Lstring.58 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L881
+.L871:
+  load 3 r1
+  write 0 r6 r1
+  load 8 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -128 r14 r5
+  blts r2 r0 .L881
+  addr2reg line_dir_sec r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 3 r1
+  write 0 r3 r1
+  addr2reg line_section r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 3 r1
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L873:
+  load 2 r1
+  write 0 r6 r1
+  load 8 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -128 r14 r5
+  blts r2 r0 .L881
+  addr2reg line_dir_sec r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 2 r1
+  write 0 r3 r1
+  addr2reg line_section r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 2 r1
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L875:
+  load 1 r1
+  write 0 r6 r1
+  load 8 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -128 r14 r5
+  blts r2 r0 .L881
+  addr2reg line_dir_sec r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 1 r1
+  write 0 r3 r1
+  addr2reg line_section r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 1 r1
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L877:
+  load 0 r1
+  write 0 r6 r1
+  load 8 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -128 r14 r5
+  blts r2 r0 .L881
+  addr2reg line_dir_sec r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 0 r1
+  write 0 r3 r1
+  addr2reg line_section r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 0 r1
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  jump .L881
+.L879:
+  load 0 r1
+  write 0 r6 r1
+  load 8 r4
+  savpc r15
+  add r15 12 r15
+  jump new_line
+  or r0 r1 r2
+  read -128 r14 r5
+  blts r2 r0 .L881
+  addr2reg line_dir_sec r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 0 r1
+  write 0 r3 r1
+  addr2reg line_section r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 0 r1
+  write 0 r3 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+.L881:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parse_one_line */
+
+.data
+.balign 1
+.Lstring.81:
+	.ascii "line too long after .L rewrite\000"
+/* end data */
+
+
+.text
+; function parse_file
+parse_file:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 1568 r13
+  write -8 r14 r4
+  load 0 r1
+  write -1556 r14 r1
+  shiftl r4 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r4
+  add r14 -1560 r5
+  savpc r15
+  add r15 12 r15
+  jump read_file
+  read -8 r14 r4
+  write -16 r14 r1
+  beq r1 r0 .L909
+  load 0 r2
+.L886:
+  read -1560 r14 r3
+  bges r2 r3 .L908
+  load 0 r3
+.L888:
+  read -1560 r14 r6
+  load 0 r5
+  blts r2 r6 .L890
+  or r0 r5 r6
+  jump .L891
+.L890:
+  add r1 r2 r5
+  readb 0 r5 r5
+  xor r5 10 r5
+  sltu r0 r5 r5
+  xor r5 0 r5
+  sltu r0 r5 r6
+.L891:
+  load 0 r5
+  beq r6 r0 .L893
+  slt r3 511 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L893:
+  beq r5 r0 .L895
+  or r0 r2 r5
+  add r2 1 r2
+  add r1 r5 r5
+  readb 0 r5 r5
+  or r0 r3 r6
+  add r3 1 r3
+  add r14 -1552 r7
+  add r7 r6 r6
+  writeb 0 r6 r5
+  jump .L888
+.L895:
+  add r14 -1552 r5
+  add r5 r3 r5
+  load 0 r3
+  writeb 0 r5 r3
+  read -1560 r14 r5
+  load 0 r3
+  blts r2 r5 .L897
+  or r0 r3 r1
+  jump .L898
+.L897:
+  add r1 r2 r1
+  readb 0 r1 r1
+  xor r1 10 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L898:
+  bne r1 r0 .L900
+  write -12 r14 r2
+  jump .L902
+.L900:
+  add r2 1 r2
+  write -12 r14 r2
+.L902:
+  shiftl r4 2 r2
+  addr2reg file_prefix r1
+  add r1 r2 r1
+  read 0 r1 r7
+  load 512 r6
+  add r14 -1040 r5
+  add r14 -1552 r4
+  savpc r15
+  add r15 12 r15
+  jump rewrite_local_labels
+  beq r1 r0 .L906
+  load 512 r6
+  add r14 -528 r5
+  add r14 -1040 r4
+  savpc r15
+  add r15 12 r15
+  jump clean_line
+  or r0 r1 r3
+  read -12 r14 r2
+  read -16 r14 r1
+  read -8 r14 r4
+  beq r3 r0 .L886
+  add r14 -1556 r6
+  or r0 r4 r5
+  add r14 -528 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_one_line
+  read -12 r14 r2
+  read -16 r14 r1
+  read -8 r14 r4
+  addr2reg has_error r12
+  read 0 r12 r3
+  beq r3 r0 .L886
+  load32 -1 r1
+  jump .L910
+.L906:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.81 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+  jump .L910
+.L908:
+  load 0 r1
+  jump .L910
+.L909:
+  load32 -1 r1
+.L910:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parse_file */
+
+
+.text
+; function pass_collect_globals
+pass_collect_globals:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  load 0 r1
+.L914:
+  write -16 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r2
+  bges r1 r2 .L921
+  addr2reg line_kind r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 7 r3
+  bne r2 r3 .L920
+  or r0 r1 r2
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  write -12 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -12 r14 r4
+  load 1 r6
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r3
+  read -16 r14 r1
+  blts r3 r0 .L921
+  addr2reg sym_flags r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r3
+  read 0 r3 r2
+  or r2 1 r2
+  write 0 r3 r2
+.L920:
+  add r1 1 r1
+  jump .L914
+.L921:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pass_collect_globals */
+
+
+.text
+; function pass_find_conflicts
+pass_find_conflicts:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  load 0 r1
+.L925:
+  write -12 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r2
+  bges r1 r2 .L938
+  addr2reg line_kind r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 2 r3
+  bne r2 r3 .L937
+  addr2reg line_file_idx r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  write -8 r14 r2
+  or r0 r1 r2
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  write -4 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -4 r14 r4
+  load 1 r6
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r4
+  read -8 r14 r2
+  write -16 r14 r4
+  blts r4 r0 .L938
+  addr2reg sym_name r12
+  read 0 r12 r1
+  shiftl r4 2 r3
+  add r1 r3 r1
+  read 0 r1 r4
+  load 1 r6
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump def_find
+  read -12 r14 r1
+  read -16 r14 r4
+  read -8 r14 r2
+  addr2reg has_error r12
+  read 0 r12 r3
+  bne r3 r0 .L938
+  addr2reg sym_def_file r12
+  read 0 r12 r3
+  shiftl r4 2 r5
+  add r3 r5 r5
+  read 0 r5 r5
+  blts r5 r0 .L936
+  shiftl r4 2 r5
+  add r3 r5 r3
+  read 0 r3 r5
+  or r0 r2 r3
+  load 0 r2
+  beq r5 r3 .L934
+  addr2reg sym_flags r12
+  read 0 r12 r2
+  shiftl r4 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  and r2 3 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L934:
+  beq r2 r0 .L937
+  addr2reg sym_flags r12
+  read 0 r12 r2
+  shiftl r4 2 r3
+  add r2 r3 r3
+  read 0 r3 r2
+  or r2 2 r2
+  write 0 r3 r2
+  addr2reg conflict_count r12
+  read 0 r12 r2
+  add r2 1 r2
+  addr2reg conflict_count r12
+  write 0 r12 r2
+  jump .L937
+.L936:
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+.L937:
+  add r1 1 r1
+  jump .L925
+.L938:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pass_find_conflicts */
+
+.data
+.balign 1
+.Lstring.85:
+	.ascii "line too long after renaming: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.86:
+	.ascii "__%s__%s\000"
+/* end data */
+
+
+.text
+; function pass_rewrite_conflicts
+pass_rewrite_conflicts:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 536 r13
+  addr2reg conflict_count r12
+  read 0 r12 r1
+  beq r1 r0 .L963
+  load 0 r1
+.L943:
+  write -16 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r2
+  bges r1 r2 .L963
+  addr2reg line_file_idx r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  write -12 r14 r2
+  addr2reg line_kind r12
+  read 0 r12 r3
+  shiftl r1 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  load 1 r4
+  sub r3 r4 r3
+  load 11 r4
+  bge r3 r4 .L962
+  shiftl r3 2 r4
+  or r0 r2 r3
+  addr2reg .Ljt946 r2
+  add r2 r4 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L947:
+  or r0 r1 r2
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r2 2 r4
+  add r1 r4 r4
+  read 0 r4 r4
+  beq r4 r0 .L956
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  or r0 r3 r7
+  load 512 r6
+  add r14 -528 r5
+  savpc r15
+  add r15 12 r15
+  jump rewrite_label_words
+  or r0 r1 r2
+  read -16 r14 r1
+  blts r2 r0 .L954
+  beq r2 r0 .L962
+  or r0 r1 r2
+  addr2reg line_kind r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  load 2 r2
+  beq r1 r2 .L953
+  add r14 -528 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  add r14 -528 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strdup_n
+  or r0 r1 r2
+  read -16 r14 r1
+  addr2reg line_text r12
+  read 0 r12 r3
+  shiftl r1 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  jump .L962
+.L953:
+  add r14 -528 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_intern
+  or r0 r1 r2
+  read -16 r14 r1
+  addr2reg line_text r12
+  read 0 r12 r3
+  shiftl r1 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  jump .L962
+.L954:
+  or r0 r1 r2
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  addr2reg .Lstring.85 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L963
+.L956:
+  or r0 r2 r1
+  jump .L962
+.L957:
+  or r0 r1 r2
+  addr2reg line_label r12
+  read 0 r12 r1
+  shiftl r2 2 r4
+  add r1 r4 r4
+  read 0 r4 r5
+  load 0 r4
+  bne r5 r0 .L959
+  or r0 r2 r1
+  or r0 r3 r2
+  or r0 r4 r3
+  jump .L960
+.L959:
+  shiftl r2 2 r3
+  add r1 r3 r3
+  read 0 r3 r5
+  write -8 r14 r5
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -8 r14 r5
+  read -12 r14 r2
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump file_owns_conflict
+  or r0 r1 r3
+  read -16 r14 r1
+  read -12 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L960:
+  beq r3 r0 .L962
+  shiftl r2 2 r3
+  addr2reg file_prefix r2
+  add r2 r3 r2
+  read 0 r2 r7
+  or r0 r1 r2
+  addr2reg line_label r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.86 r6
+  load 512 r5
+  add r14 -528 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -28 r1
+  sub r13 r1 r13
+  add r14 -528 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_intern
+  or r0 r1 r2
+  read -16 r14 r1
+  addr2reg line_label r12
+  read 0 r12 r3
+  shiftl r1 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+.L962:
+  add r1 1 r1
+  jump .L943
+.L963:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt946:
+  .int .L947
+  .int .L947
+  .int .L962
+  .int .L957
+  .int .L962
+  .int .L957
+  .int .L962
+  .int .L962
+  .int .L962
+  .int .L962
+  .int .L957
+
+/* end function pass_rewrite_conflicts */
+
+
+.text
+; function remove_dead_lines
+remove_dead_lines:
+  load 0 r2
+  load 0 r1
+.L967:
+  addr2reg line_count r12
+  read 0 r12 r3
+  bges r2 r3 .L971
+  addr2reg line_flags r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  and r3 8 r3
+  bne r3 r0 .L970
+  addr2reg line_kind r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_text r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_section r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_file_idx r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_value r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_label r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_label_off r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_byte_off r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_byte_len r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_align r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_dir_sec r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_addr r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  addr2reg line_flags r12
+  read 0 r12 r4
+  shiftl r2 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  load32 -5 r5
+  and r3 r5 r3
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  add r1 1 r1
+.L970:
+  add r2 1 r2
+  jump .L967
+.L971:
+  addr2reg line_count r12
+  write 0 r12 r1
+  jumpr 0 r15
+
+/* end function remove_dead_lines */
+
+
+.text
+; function gc_mark
+gc_mark:
+  load 1 r1
+  blts r4 r0 .L977
+  addr2reg gc_why r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  load32 -1 r2
+  xor r1 r2 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L977:
+  bne r1 r0 .L979
+  addr2reg gc_why r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  addr2reg gc_queue r12
+  read 0 r12 r1
+  read 0 r6 r2
+  add r2 1 r3
+  write 0 r6 r3
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r4
+.L979:
+  jumpr 0 r15
+
+/* end function gc_mark */
+
+
+.text
+; function gc_mark_name
+gc_mark_name:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r7
+  write -16 r14 r6
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r2
+  read -12 r14 r6
+  read -16 r14 r5
+  blts r2 r0 .L984
+  addr2reg gc_sym r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump gc_mark
+.L984:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function gc_mark_name */
+
+.data
+.balign 1
+.Lstring.91:
+	.ascii "jump\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.92:
+	.ascii "jumpo\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.93:
+	.ascii "jumpr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.94:
+	.ascii "jumpro\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.95:
+	.ascii "halt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.96:
+	.ascii "reti\000"
+/* end data */
+
+
+.text
+; function gc_falls_through
+gc_falls_through:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  addr2reg gc_first r12
+  read 0 r12 r2
+  add r4 1 r1
+  shiftl r1 2 r1
+  add r2 r1 r1
+  read 0 r1 r1
+  load 1 r3
+  sub r1 r3 r1
+.L988:
+  shiftl r4 2 r3
+  add r2 r3 r3
+  read 0 r3 r3
+  blts r1 r3 .L1036
+  addr2reg line_text r12
+  read 0 r12 r3
+  shiftl r1 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  write -12 r14 r3
+  addr2reg line_kind r12
+  read 0 r12 r3
+  shiftl r1 2 r5
+  add r3 r5 r5
+  read 0 r5 r6
+  load 1 r5
+  load 10 r7
+  beq r6 r7 .L991
+  shiftl r1 2 r5
+  add r3 r5 r5
+  read 0 r5 r5
+  xor r5 11 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L991:
+  bne r5 r0 .L1035
+  shiftl r1 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  load 1 r5
+  beq r3 r5 .L994
+  load 1 r3
+  sub r1 r3 r1
+  jump .L988
+.L994:
+  read -12 r14 r4
+  load 0 r1
+  or r0 r1 r2
+  or r0 r4 r1
+.L997:
+  write -16 r14 r2
+  add r1 r2 r3
+  readb 0 r3 r4
+  load 0 r3
+  bne r4 r0 .L999
+  or r0 r3 r4
+  jump .L1000
+.L999:
+  add r1 r2 r3
+  readb 0 r3 r3
+  xor r3 32 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L1000:
+  load 0 r3
+  beq r4 r0 .L1002
+  add r1 r2 r3
+  readb 0 r3 r3
+  xor r3 9 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L1002:
+  beq r3 r0 .L1004
+  add r2 1 r2
+  jump .L997
+.L1004:
+  or r0 r1 r4
+  load 0 r1
+  load 4 r3
+  beq r2 r3 .L1007
+  or r0 r1 r3
+  jump .L1008
+.L1007:
+  load 4 r6
+  addr2reg .Lstring.91 r5
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  read -16 r14 r2
+  read -12 r14 r4
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r3
+.L1008:
+  load 1 r1
+  bne r3 r0 .L1012
+  load 0 r1
+  load 5 r3
+  bne r2 r3 .L1011
+  load 5 r6
+  addr2reg .Lstring.92 r5
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  read -16 r14 r2
+  read -12 r14 r4
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1011:
+  xor r1 0 r1
+  sltu r0 r1 r3
+  jump .L1013
+.L1012:
+  or r0 r1 r3
+.L1013:
+  load 1 r1
+  bne r3 r0 .L1017
+  load 0 r1
+  load 5 r3
+  bne r2 r3 .L1016
+  load 5 r6
+  addr2reg .Lstring.93 r5
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  read -16 r14 r2
+  read -12 r14 r4
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1016:
+  xor r1 0 r1
+  sltu r0 r1 r3
+  jump .L1018
+.L1017:
+  or r0 r1 r3
+.L1018:
+  load 1 r1
+  bne r3 r0 .L1022
+  load 0 r1
+  load 6 r3
+  bne r2 r3 .L1021
+  load 6 r6
+  addr2reg .Lstring.94 r5
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  read -16 r14 r2
+  read -12 r14 r4
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1021:
+  xor r1 0 r1
+  sltu r0 r1 r3
+  jump .L1023
+.L1022:
+  or r0 r1 r3
+.L1023:
+  load 1 r1
+  bne r3 r0 .L1027
+  load 0 r1
+  load 4 r3
+  bne r2 r3 .L1026
+  load 4 r6
+  addr2reg .Lstring.95 r5
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  read -16 r14 r2
+  read -12 r14 r4
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1026:
+  xor r1 0 r1
+  sltu r0 r1 r3
+  jump .L1028
+.L1027:
+  or r0 r1 r3
+.L1028:
+  load 1 r1
+  bne r3 r0 .L1032
+  load 0 r1
+  load 4 r3
+  bne r2 r3 .L1031
+  load 4 r6
+  addr2reg .Lstring.96 r5
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1031:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1032:
+  bne r1 r0 .L1034
+  load 1 r1
+  jump .L1037
+.L1034:
+  load 0 r1
+  jump .L1037
+.L1035:
+  load 1 r1
+  jump .L1037
+.L1036:
+  load 1 r1
+.L1037:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function gc_falls_through */
+
+
+.text
+; function gc_name
+gc_name:
+  addr2reg gc_first r12
+  read 0 r12 r2
+  shiftl r4 2 r1
+  add r2 r1 r1
+  read 0 r1 r1
+.L1041:
+  add r4 1 r3
+  shiftl r3 2 r3
+  add r2 r3 r3
+  read 0 r3 r3
+  bges r1 r3 .L1046
+  addr2reg line_kind r12
+  read 0 r12 r3
+  shiftl r1 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  load 2 r5
+  beq r3 r5 .L1044
+  add r1 1 r1
+  jump .L1041
+.L1044:
+  or r0 r1 r2
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  jump .L1047
+.L1046:
+  addr2reg .Lstring.37 r1
+.L1047:
+  jumpr 0 r15
+
+/* end function gc_name */
+
+.data
+.balign 1
+.Lstring.99:
+	.ascii "cannot open map: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.100:
+	.ascii "; gc-sections: kept %d of %d sections\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.101:
+	.ascii "fallthrough\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.102:
+	.ascii "root\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.103:
+	.ascii "dropped  %-32s %s\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.104:
+	.ascii "kept     %-32s %-16s %s\012\000"
+/* end data */
+
+
+.text
+; function gc_write_map
+gc_write_map:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 264 r13
+  write -8 r14 r5
+  or r0 r4 r5
+  write -12 r14 r5
+  or r0 r5 r1
+  load 26 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_open
+  or r0 r1 r4
+  read -8 r14 r7
+  read -12 r14 r5
+  write -28 r14 r4
+  blts r4 r0 .L1067
+  addr2reg gc_count r12
+  read 0 r12 r1
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.100 r6
+  load 224 r5
+  add r14 -256 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -28 r1
+  sub r13 r1 r13
+  add r14 -256 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -28 r14 r4
+  add r14 -256 r5
+  savpc r15
+  add r15 12 r15
+  jump sys_write
+  load 0 r1
+.L1053:
+  write -32 r14 r1
+  addr2reg gc_count r12
+  read 0 r12 r2
+  bges r1 r2 .L1065
+  addr2reg gc_why r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  write -16 r14 r2
+  addr2reg line_file_idx r12
+  read 0 r12 r3
+  addr2reg gc_first r12
+  read 0 r12 r4
+  shiftl r1 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  shiftl r3 2 r4
+  addr2reg file_prefix r3
+  add r3 r4 r3
+  read 0 r3 r3
+  write -24 r14 r3
+  load32 -2 r3
+  beq r2 r3 .L1058
+  addr2reg .Lstring.101 r3
+  blts r2 r0 .L1057
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump gc_name
+  or r0 r1 r3
+  read -32 r14 r1
+  read -16 r14 r2
+.L1057:
+  write -20 r14 r3
+  jump .L1060
+.L1058:
+  addr2reg .Lstring.102 r3
+  write -20 r14 r3
+.L1060:
+  load32 -1 r3
+  beq r2 r3 .L1062
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump gc_name
+  or r0 r1 r7
+  read -20 r14 r3
+  read -24 r14 r1
+  load 32 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 28 r4
+  write 0 r4 r3
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.104 r6
+  load 224 r5
+  add r14 -256 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -32 r1
+  sub r13 r1 r13
+  jump .L1063
+.L1062:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump gc_name
+  or r0 r1 r7
+  read -24 r14 r1
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.103 r6
+  load 224 r5
+  add r14 -256 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -28 r1
+  sub r13 r1 r13
+.L1063:
+  add r14 -256 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -28 r14 r2
+  add r14 -256 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_write
+  read -32 r14 r1
+  read -28 r14 r2
+  add r1 1 r1
+  jump .L1053
+.L1065:
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  jump .L1068
+.L1067:
+  addr2reg .Lstring.99 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+.L1068:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function gc_write_map */
+
+.data
+.balign 1
+.Lstring.106:
+	.ascii "OOM in gc-sections\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.107:
+	.ascii "Main\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.108:
+	.ascii "gc-sections: kept \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.109:
+	.ascii " of \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.110:
+	.ascii " sections\012\000"
+/* end data */
+
+
+.text
+; function pass_gc_sections
+pass_gc_sections:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 60 r13
+  write -48 r14 r4
+  load 0 r1
+  write -52 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r1
+  add r1 2 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg gc_first r12
+  write 0 r12 r1
+  addr2reg line_count r12
+  read 0 r12 r1
+  add r1 1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg gc_why r12
+  write 0 r12 r1
+  addr2reg line_count r12
+  read 0 r12 r1
+  add r1 1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg gc_queue r12
+  write 0 r12 r1
+  load32 65536 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  read -48 r14 r4
+  addr2reg gc_sym r12
+  write 0 r12 r1
+  addr2reg gc_first r12
+  read 0 r12 r3
+  load 1 r2
+  beq r3 r0 .L1073
+  addr2reg gc_why r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1074
+.L1073:
+  or r0 r2 r3
+.L1074:
+  load 1 r2
+  bne r3 r0 .L1076
+  addr2reg gc_queue r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1077
+.L1076:
+  or r0 r2 r3
+.L1077:
+  load 1 r2
+  bne r3 r0 .L1079
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L1080
+.L1079:
+  or r0 r2 r1
+.L1080:
+  bne r1 r0 .L1160
+  load 0 r1
+.L1082:
+  load 16384 r2
+  bges r1 r2 .L1085
+  addr2reg gc_sym r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load32 -1 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L1082
+.L1085:
+  load 0 r1
+  addr2reg gc_count r12
+  write 0 r12 r1
+  load 0 r1
+.L1086:
+  write -44 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r2
+  bges r1 r2 .L1100
+  load 1 r2
+  beq r1 r0 .L1089
+  addr2reg line_kind r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  xor r2 8 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1090
+.L1089:
+  or r0 r2 r3
+.L1090:
+  load 1 r2
+  bne r3 r0 .L1092
+  addr2reg line_file_idx r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  load 1 r4
+  sub r1 r4 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1092:
+  beq r2 r0 .L1094
+  addr2reg gc_first r12
+  read 0 r12 r2
+  addr2reg gc_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg gc_why r12
+  read 0 r12 r2
+  addr2reg gc_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r3
+  load32 -1 r2
+  write 0 r3 r2
+  addr2reg gc_count r12
+  read 0 r12 r2
+  add r2 1 r2
+  addr2reg gc_count r12
+  write 0 r12 r2
+.L1094:
+  addr2reg line_kind r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 2 r3
+  bne r2 r3 .L1099
+  or r0 r1 r2
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  write -40 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -40 r14 r4
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r4
+  read -44 r14 r1
+  blts r4 r0 .L1099
+  addr2reg gc_count r12
+  read 0 r12 r2
+  load 1 r3
+  sub r2 r3 r2
+  addr2reg gc_sym r12
+  read 0 r12 r3
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+.L1099:
+  add r1 1 r1
+  jump .L1086
+.L1100:
+  addr2reg gc_first r12
+  read 0 r12 r1
+  addr2reg gc_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  write 0 r1 r2
+  add r14 -52 r7
+  load32 -2 r6
+  load 4 r5
+  addr2reg .Lstring.107 r4
+  savpc r15
+  add r15 12 r15
+  jump gc_mark_name
+  load 0 r1
+  or r0 r1 r5
+.L1102:
+  read -52 r14 r1
+  bges r5 r1 .L1136
+  addr2reg gc_queue r12
+  read 0 r12 r1
+  add r5 1 r2
+  write -36 r14 r2
+  shiftl r5 2 r2
+  add r1 r2 r1
+  read 0 r1 r2
+  write -32 r14 r2
+  addr2reg gc_first r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+.L1104:
+  write -28 r14 r1
+  addr2reg gc_first r12
+  read 0 r12 r3
+  add r2 1 r4
+  shiftl r4 2 r4
+  add r3 r4 r4
+  read 0 r4 r4
+  bges r1 r4 .L1124
+  addr2reg line_text r12
+  read 0 r12 r3
+  shiftl r1 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  addr2reg line_kind r12
+  read 0 r12 r4
+  shiftl r1 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  load 1 r5
+  sub r4 r5 r4
+  load 11 r5
+  bge r4 r5 .L1123
+  shiftl r4 2 r5
+  addr2reg .Ljt1107 r4
+  add r4 r5 r4
+  read 0 r4 r4
+  jumpr 0 r4
+.L1108:
+  or r0 r3 r1
+.L1109:
+  write -16 r14 r1
+  readb 0 r1 r2
+  beq r2 r0 .L1121
+  load 0 r2
+.L1111:
+  write -20 r14 r2
+  add r1 r2 r3
+  readb 0 r3 r4
+  load 0 r3
+  beq r4 r0 .L1113
+  add r1 r2 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  or r0 r1 r3
+  read -20 r14 r2
+  read -16 r14 r1
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L1113:
+  beq r3 r0 .L1115
+  add r2 1 r2
+  jump .L1111
+.L1115:
+  or r0 r2 r3
+  read -32 r14 r2
+  beq r3 r0 .L1120
+  or r0 r1 r3
+  add r1 0 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_start
+  or r0 r1 r4
+  read -20 r14 r1
+  read -16 r14 r3
+  read -32 r14 r2
+  beq r4 r0 .L1119
+  add r14 -52 r7
+  or r0 r2 r6
+  or r0 r1 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump gc_mark_name
+  read -20 r14 r1
+  read -16 r14 r3
+  read -32 r14 r2
+.L1119:
+  add r3 r1 r1
+  jump .L1109
+.L1120:
+  add r1 1 r1
+  jump .L1109
+.L1121:
+  read -28 r14 r1
+  read -32 r14 r2
+  jump .L1123
+.L1122:
+  or r0 r1 r2
+  addr2reg line_label r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  read 0 r3 r4
+  write -24 r14 r4
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -24 r14 r4
+  read -32 r14 r2
+  add r14 -52 r7
+  or r0 r2 r6
+  savpc r15
+  add r15 12 r15
+  jump gc_mark_name
+  read -28 r14 r1
+  read -32 r14 r2
+.L1123:
+  add r1 1 r1
+  jump .L1104
+.L1124:
+  read -36 r14 r5
+  addr2reg line_section r12
+  read 0 r12 r1
+  shiftl r2 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r3
+  load 0 r1
+  bne r3 r0 .L1127
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump gc_falls_through
+  read -32 r14 r2
+  read -36 r14 r5
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1127:
+  beq r1 r0 .L1102
+  addr2reg line_file_idx r12
+  read 0 r12 r3
+  addr2reg gc_first r12
+  read 0 r12 r1
+  shiftl r2 2 r4
+  add r1 r4 r4
+  read 0 r4 r4
+  shiftl r4 2 r4
+  add r3 r4 r4
+  read 0 r4 r4
+  add r2 1 r2
+.L1129:
+  addr2reg gc_count r12
+  read 0 r12 r7
+  load 0 r6
+  bges r2 r7 .L1131
+  shiftl r2 2 r6
+  add r1 r6 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r3 r6 r6
+  read 0 r6 r6
+  xor r6 r4 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L1131:
+  beq r6 r0 .L1102
+  addr2reg line_section r12
+  read 0 r12 r6
+  shiftl r2 2 r7
+  add r1 r7 r7
+  read 0 r7 r7
+  shiftl r7 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  beq r6 r0 .L1134
+  add r2 1 r2
+  jump .L1129
+.L1134:
+  or r0 r2 r4
+  add r14 -52 r6
+  load32 -3 r5
+  savpc r15
+  add r15 12 r15
+  jump gc_mark
+  read -36 r14 r5
+  jump .L1102
+.L1136:
+  read -48 r14 r4
+  load 0 r2
+  load 0 r1
+  or r0 r1 r3
+.L1139:
+  write -12 r14 r3
+  addr2reg gc_count r12
+  read 0 r12 r1
+  bges r2 r1 .L1148
+  addr2reg gc_why r12
+  read 0 r12 r1
+  shiftl r2 2 r5
+  add r1 r5 r1
+  read 0 r1 r1
+  load32 -1 r5
+  bne r1 r5 .L1146
+  addr2reg gc_first r12
+  read 0 r12 r1
+  shiftl r2 2 r5
+  add r1 r5 r1
+  read 0 r1 r1
+.L1142:
+  addr2reg gc_first r12
+  read 0 r12 r5
+  add r2 1 r6
+  shiftl r6 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  bges r1 r5 .L1147
+  addr2reg line_kind r12
+  read 0 r12 r5
+  shiftl r1 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  load 7 r6
+  beq r5 r6 .L1145
+  addr2reg line_flags r12
+  read 0 r12 r5
+  shiftl r1 2 r6
+  add r5 r6 r6
+  read 0 r6 r5
+  or r5 8 r5
+  write 0 r6 r5
+.L1145:
+  add r1 1 r1
+  jump .L1142
+.L1146:
+  add r3 1 r3
+.L1147:
+  add r2 1 r2
+  jump .L1139
+.L1148:
+  or r0 r3 r5
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L1151
+  addr2reg .Lstring.108 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -12 r14 r5
+.L1151:
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L1154
+  addr2reg .Lstring.109 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L1154:
+  addr2reg gc_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  read -12 r14 r5
+  read -48 r14 r4
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L1157
+  addr2reg .Lstring.110 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -12 r14 r5
+  read -48 r14 r4
+.L1157:
+  beq r4 r0 .L1159
+  savpc r15
+  add r15 12 r15
+  jump gc_write_map
+.L1159:
+  savpc r15
+  add r15 12 r15
+  jump remove_dead_lines
+  addr2reg gc_first r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  addr2reg gc_why r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  addr2reg gc_queue r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  addr2reg gc_sym r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  jump .L1161
+.L1160:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.106 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+.L1161:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt1107:
+  .int .L1108
+  .int .L1123
+  .int .L1123
+  .int .L1122
+  .int .L1123
+  .int .L1122
+  .int .L1123
+  .int .L1123
+  .int .L1123
+  .int .L1123
+  .int .L1122
+
+/* end function pass_gc_sections */
+
+.data
+.balign 1
+.Lstring.111:
+	.ascii "self-copy\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.112:
+	.ascii "or r0 %a %a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.113:
+	.ascii "\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.114:
+	.ascii "add-zero\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.115:
+	.ascii "add %a 0 %a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.116:
+	.ascii "xor-zero\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.117:
+	.ascii "xor %a 0 %a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.118:
+	.ascii "jump-next\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.119:
+	.ascii "jump @l ; @l:\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.120:
+	.ascii "store-load\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.121:
+	.ascii "write #n r14 %a ; read #n r14 %a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.122:
+	.ascii "write #n r14 %a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.123:
+	.ascii "store-copy\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.124:
+	.ascii "write #n r14 %a ; read #n r14 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.125:
+	.ascii "write #n r14 %a ; or r0 %a %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.126:
+	.ascii "swap-same\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.127:
+	.ascii "or r0 %a %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.128:
+	.ascii "or r0 %a %b ; or r0 %a r12\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.129:
+	.ascii "or r0 %b %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.130:
+	.ascii "or r0 %b %a ; or r0 %b r12\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.131:
+	.ascii "swap-load\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.132:
+	.ascii "load #k %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.133:
+	.ascii "or r0 %a r12 ; or r0 %a %b ; load #k %a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.134:
+	.ascii "swap-copy\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.135:
+	.ascii "or r0 %c %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.136:
+	.ascii "or r0 %a r12 ; or r0 %a %b ; or r0 %c %a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.137:
+	.ascii "swap-add\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.138:
+	.ascii "add %c #k %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.139:
+	.ascii "or r0 %a r12 ; or r0 %a %b ; add %c #k %a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.140:
+	.ascii "swap-read\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.141:
+	.ascii "read #n %c %b ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.142:
+	.ascii "or r0 %a r12 ; or r0 %a %b ; read #n %c %a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.143:
+	.ascii "load #k %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.144:
+	.ascii "load #k r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.145:
+	.ascii "or r0 %c %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.146:
+	.ascii "or r0 %c r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.147:
+	.ascii "add %c #k %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.148:
+	.ascii "add %c #k r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.149:
+	.ascii "read #n %c %a ; or r0 %a r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.150:
+	.ascii "read #n %c r12 ; or r0 %b %a ; or r0 r12 %b\000"
+/* end data */
+
+.data
+.balign 4
+peep_rules:
+	.int .Lstring.111+0
+	.int .Lstring.112+0
+	.int .Lstring.113+0
+	.int .Lstring.114+0
+	.int .Lstring.115+0
+	.int .Lstring.113+0
+	.int .Lstring.116+0
+	.int .Lstring.117+0
+	.int .Lstring.113+0
+	.int .Lstring.118+0
+	.int .Lstring.119+0
+	.int .Lstring.113+0
+	.int .Lstring.120+0
+	.int .Lstring.121+0
+	.int .Lstring.122+0
+	.int .Lstring.123+0
+	.int .Lstring.124+0
+	.int .Lstring.125+0
+	.int .Lstring.126+0
+	.int .Lstring.127+0
+	.int .Lstring.128+0
+	.int .Lstring.126+0
+	.int .Lstring.129+0
+	.int .Lstring.130+0
+	.int .Lstring.131+0
+	.int .Lstring.132+0
+	.int .Lstring.133+0
+	.int .Lstring.134+0
+	.int .Lstring.135+0
+	.int .Lstring.136+0
+	.int .Lstring.137+0
+	.int .Lstring.138+0
+	.int .Lstring.139+0
+	.int .Lstring.140+0
+	.int .Lstring.141+0
+	.int .Lstring.142+0
+	.int .Lstring.131+0
+	.int .Lstring.143+0
+	.int .Lstring.144+0
+	.int .Lstring.134+0
+	.int .Lstring.145+0
+	.int .Lstring.146+0
+	.int .Lstring.137+0
+	.int .Lstring.147+0
+	.int .Lstring.148+0
+	.int .Lstring.140+0
+	.int .Lstring.149+0
+	.int .Lstring.150+0
+/* end data */
+
+
+.text
+; function peep_is_reg
+peep_is_reg:
+  add r4 0 r1
+  readb 0 r1 r2
+  load 1 r1
+  load 114 r3
+  bne r2 r3 .L1166
+  add r4 1 r1
+  readb 0 r1 r1
+  slt r1 48 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L1167
+.L1166:
+  or r0 r1 r2
+.L1167:
+  load 1 r1
+  bne r2 r0 .L1169
+  add r4 1 r1
+  readb 0 r1 r2
+  load 57 r1
+  slt r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1169:
+  bne r1 r0 .L1177
+  add r4 2 r1
+  readb 0 r1 r1
+  beq r1 r0 .L1176
+  add r4 2 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 48 r3
+  bges r2 r3 .L1173
+  or r0 r1 r2
+  jump .L1174
+.L1173:
+  add r4 2 r1
+  readb 0 r1 r2
+  load 57 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L1174:
+  load 0 r1
+  beq r2 r0 .L1178
+  add r4 3 r1
+  readb 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L1178
+.L1176:
+  load 1 r1
+  jump .L1178
+.L1177:
+  load 0 r1
+.L1178:
+  jumpr 0 r15
+
+/* end function peep_is_reg */
+
+
+.text
+; function peep_is_num
+peep_is_num:
+  add r4 0 r1
+  readb 0 r1 r1
+  load 45 r2
+  bne r1 r2 .L1183
+  add r4 1 r4
+.L1183:
+  add r4 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 48 r3
+  blts r2 r3 .L1185
+  add r4 0 r1
+  readb 0 r1 r2
+  load 57 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1185:
+  jumpr 0 r15
+
+/* end function peep_is_num */
+
+
+.text
+; function peep_is_label
+peep_is_label:
+  add r4 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 97 r3
+  bges r2 r3 .L1190
+  or r0 r1 r2
+  jump .L1191
+.L1190:
+  add r4 0 r1
+  readb 0 r1 r2
+  load 122 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L1191:
+  load 1 r1
+  bne r2 r0 .L1195
+  add r4 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 65 r3
+  blts r2 r3 .L1194
+  add r4 0 r1
+  readb 0 r1 r2
+  load 90 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1194:
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L1196
+.L1195:
+  or r0 r1 r2
+.L1196:
+  load 1 r1
+  bne r2 r0 .L1198
+  add r4 0 r1
+  readb 0 r1 r1
+  xor r1 95 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L1199
+.L1198:
+  or r0 r1 r2
+.L1199:
+  load 1 r1
+  bne r2 r0 .L1201
+  add r4 0 r1
+  readb 0 r1 r1
+  xor r1 46 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L1202
+.L1201:
+  or r0 r1 r2
+.L1202:
+  load 0 r1
+  beq r2 r0 .L1205
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  savpc r15
+  add r15 12 r15
+  jump peep_is_reg
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1204:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L1205:
+  jumpr 0 r15
+
+/* end function peep_is_label */
+
+.data
+.balign 1
+.Lstring.155:
+	.ascii "peephole rule too long: \000"
+/* end data */
+
+
+.text
+; function peep_split
+peep_split:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -20 r14 r6
+  write -16 r14 r5
+  or r0 r4 r1
+  write -28 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -28 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strdup_n
+  beq r1 r0 .L1224
+  load 0 r2
+  write -32 r14 r2
+.L1211:
+  write -12 r14 r1
+  beq r1 r0 .L1223
+  load 59 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strchr
+  or r0 r1 r3
+  read -12 r14 r1
+  read -32 r14 r2
+  read -16 r14 r5
+  write -24 r14 r3
+  beq r3 r0 .L1214
+  load 0 r4
+  writeb 0 r3 r4
+.L1214:
+  load 5 r3
+  bges r2 r3 .L1221
+  shiftl r2 4 r2
+  add r5 r2 r5
+  load 4 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tokenize
+  or r0 r1 r3
+  read -32 r14 r2
+  read -24 r14 r1
+  read -20 r14 r6
+  read -16 r14 r5
+  shiftl r2 2 r4
+  add r6 r4 r4
+  write 0 r4 r3
+  shiftl r2 2 r3
+  add r6 r3 r3
+  read 0 r3 r3
+  bles r3 r0 .L1217
+  add r2 1 r2
+.L1217:
+  bne r1 r0 .L1219
+  load 0 r1
+  jump .L1220
+.L1219:
+  add r1 1 r1
+.L1220:
+  write -32 r14 r2
+  jump .L1211
+.L1221:
+  read -28 r14 r5
+  addr2reg .Lstring.155 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  read -32 r14 r1
+  jump .L1225
+.L1223:
+  read -32 r14 r1
+  jump .L1225
+.L1224:
+  load 0 r1
+.L1225:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function peep_split */
+
+.data
+.balign 1
+.Lstring.157:
+	.ascii "peephole rule grows code: \000"
+/* end data */
+
+
+.text
+; function peep_init
+peep_init:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  load 0 r1
+.L1229:
+  write -16 r14 r1
+  load 16 r2
+  bges r1 r2 .L1239
+  load 12 r2
+  mults r1 r2 r3
+  addr2reg peep_rules r2
+  add r2 r3 r2
+  add r2 4 r2
+  read 0 r2 r4
+  load 80 r2
+  mults r1 r2 r3
+  addr2reg peep_pat r2
+  add r2 r3 r5
+  load 20 r2
+  mults r1 r2 r2
+  addr2reg peep_pat_ntok r1
+  add r1 r2 r6
+  savpc r15
+  add r15 12 r15
+  jump peep_split
+  or r0 r1 r2
+  read -16 r14 r1
+  shiftl r1 2 r4
+  addr2reg peep_pat_lines r3
+  add r3 r4 r3
+  write 0 r3 r2
+  load 12 r2
+  mults r1 r2 r3
+  addr2reg peep_rules r2
+  add r2 r3 r2
+  add r2 8 r2
+  read 0 r2 r4
+  load 80 r2
+  mults r1 r2 r3
+  addr2reg peep_rep r2
+  add r2 r3 r5
+  load 20 r2
+  mults r1 r2 r2
+  addr2reg peep_rep_ntok r1
+  add r1 r2 r6
+  savpc r15
+  add r15 12 r15
+  jump peep_split
+  or r0 r1 r2
+  read -16 r14 r1
+  shiftl r1 2 r4
+  addr2reg peep_rep_lines r3
+  add r3 r4 r3
+  write 0 r3 r2
+  shiftl r1 2 r3
+  addr2reg peep_pat_lines r2
+  add r2 r3 r2
+  read 0 r2 r2
+.L1231:
+  write -12 r14 r2
+  load 0 r3
+  bles r2 r0 .L1233
+  load 80 r3
+  mults r1 r3 r4
+  addr2reg peep_pat r3
+  add r3 r4 r3
+  load 1 r4
+  sub r2 r4 r4
+  shiftl r4 4 r4
+  add r3 r4 r3
+  add r3 0 r3
+  read 0 r3 r3
+  write -8 r14 r3
+  load 80 r3
+  mults r1 r3 r3
+  addr2reg peep_pat r1
+  add r1 r3 r1
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r4
+  read -12 r14 r2
+  read -16 r14 r1
+  read -8 r14 r3
+  load 1 r5
+  sub r4 r5 r4
+  add r3 r4 r3
+  readb 0 r3 r3
+  xor r3 58 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L1233:
+  beq r3 r0 .L1235
+  load 1 r3
+  sub r2 r3 r2
+  jump .L1231
+.L1235:
+  shiftl r1 2 r4
+  addr2reg peep_consumed r3
+  add r3 r4 r3
+  write 0 r3 r2
+  shiftl r1 2 r4
+  addr2reg peep_rep_lines r3
+  add r3 r4 r3
+  read 0 r3 r3
+  bles r3 r2 .L1237
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg peep_rules r1
+  add r1 r2 r1
+  read 0 r1 r5
+  addr2reg .Lstring.157 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  read -16 r14 r1
+.L1237:
+  shiftl r1 2 r3
+  addr2reg peep_hits r2
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L1229
+.L1239:
+  load 0 r1
+.L1240:
+  load 5 r2
+  bges r1 r2 .L1243
+  shiftl r1 2 r3
+  addr2reg peep_slot_line r2
+  add r2 r3 r3
+  load32 -1 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L1240
+.L1243:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function peep_init */
+
+
+.text
+; function peep_tokens
+peep_tokens:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  load32 1717986919 r1
+  mulshi r4 r1 r1
+  shiftrs r1 1 r1
+  shiftr r4 31 r2
+  add r1 r2 r2
+  shiftl r2 2 r1
+  add r1 r2 r1
+  sub r4 r1 r1
+  write -16 r14 r1
+  shiftl r1 2 r3
+  addr2reg peep_slot_line r2
+  add r2 r3 r2
+  read 0 r2 r2
+  beq r2 r4 .L1256
+  shiftl r1 2 r3
+  addr2reg peep_slot_line r2
+  add r2 r3 r2
+  write 0 r2 r4
+  shiftl r1 2 r3
+  addr2reg peep_ntok r2
+  add r2 r3 r3
+  load32 -1 r2
+  write 0 r3 r2
+  addr2reg line_kind r12
+  read 0 r12 r2
+  shiftl r4 2 r3
+  add r2 r3 r2
+  read 0 r2 r3
+  load 0 r2
+  load 1 r6
+  bne r3 r6 .L1249
+  addr2reg line_text r12
+  read 0 r12 r2
+  shiftl r4 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1249:
+  beq r2 r0 .L1256
+  load 0 r2
+.L1251:
+  addr2reg line_text r12
+  read 0 r12 r3
+  shiftl r4 2 r6
+  add r3 r6 r6
+  read 0 r6 r6
+  add r6 r2 r6
+  readb 0 r6 r7
+  load 0 r6
+  beq r7 r0 .L1253
+  slt r2 511 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L1253:
+  beq r6 r0 .L1255
+  shiftl r4 2 r6
+  add r3 r6 r3
+  read 0 r3 r3
+  add r3 r2 r3
+  readb 0 r3 r3
+  shiftl r1 9 r7
+  addr2reg peep_buf r6
+  add r6 r7 r6
+  add r6 r2 r6
+  writeb 0 r6 r3
+  add r2 1 r2
+  jump .L1251
+.L1255:
+  shiftl r1 9 r4
+  addr2reg peep_buf r3
+  add r3 r4 r3
+  add r3 r2 r3
+  load 0 r2
+  writeb 0 r3 r2
+  shiftl r1 9 r3
+  addr2reg peep_buf r2
+  add r2 r3 r4
+  shiftl r1 6 r2
+  addr2reg peep_toks r1
+  add r1 r2 r5
+  load 16 r6
+  savpc r15
+  add r15 12 r15
+  jump tokenize
+  or r0 r1 r2
+  read -16 r14 r1
+  read -12 r14 r5
+  shiftl r1 2 r4
+  addr2reg peep_ntok r3
+  add r3 r4 r3
+  write 0 r3 r2
+.L1256:
+  shiftl r1 6 r3
+  addr2reg peep_toks r2
+  add r2 r3 r2
+  write 0 r5 r2
+  shiftl r1 2 r2
+  addr2reg peep_ntok r1
+  add r1 r2 r1
+  read 0 r1 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function peep_tokens */
+
+
+.text
+; function peep_lookup
+peep_lookup:
+  load 0 r1
+.L1261:
+  addr2reg peep_nvars r12
+  read 0 r12 r2
+  bges r1 r2 .L1267
+  shiftl r1 1 r3
+  addr2reg peep_var r2
+  add r2 r3 r2
+  add r2 0 r2
+  readb 0 r2 r3
+  add r4 0 r2
+  readb 0 r2 r5
+  load 0 r2
+  bne r3 r5 .L1264
+  shiftl r1 1 r3
+  addr2reg peep_var r2
+  add r2 r3 r2
+  add r2 1 r2
+  readb 0 r2 r2
+  add r4 1 r3
+  readb 0 r3 r3
+  xor r2 r3 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1264:
+  bne r2 r0 .L1266
+  add r1 1 r1
+  jump .L1261
+.L1266:
+  shiftl r1 6 r2
+  addr2reg peep_val r1
+  add r1 r2 r1
+  jump .L1268
+.L1267:
+  load 0 r1
+.L1268:
+  jumpr 0 r15
+
+/* end function peep_lookup */
+
+
+.text
+; function peep_bind
+peep_bind:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -20 r14 r4
+  or r0 r5 r4
+  or r0 r6 r5
+  write -16 r14 r5
+  write -32 r14 r4
+  add r4 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 37 r3
+  bne r2 r3 .L1273
+  or r0 r1 r2
+  jump .L1274
+.L1273:
+  add r4 0 r1
+  readb 0 r1 r1
+  xor r1 35 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L1274:
+  load 0 r1
+  beq r2 r0 .L1276
+  add r4 0 r1
+  readb 0 r1 r1
+  xor r1 64 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1276:
+  bne r1 r0 .L1312
+  savpc r15
+  add r15 12 r15
+  jump peep_lookup
+  or r0 r1 r4
+  read -16 r14 r5
+  or r0 r4 r1
+  read -32 r14 r4
+  bne r1 r0 .L1310
+  add r4 0 r1
+  readb 0 r1 r1
+  load 37 r2
+  beq r1 r2 .L1284
+  add r4 0 r1
+  readb 0 r1 r1
+  load 35 r2
+  beq r1 r2 .L1282
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump peep_is_label
+  read -16 r14 r5
+  read -32 r14 r4
+  bne r1 r0 .L1304
+  load 0 r1
+  jump .L1313
+.L1282:
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump peep_is_num
+  read -16 r14 r5
+  read -32 r14 r4
+  bne r1 r0 .L1304
+  load 0 r1
+  jump .L1313
+.L1284:
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump peep_is_reg
+  read -16 r14 r5
+  read -20 r14 r4
+  beq r1 r0 .L1309
+  load 0 r1
+  or r0 r5 r6
+.L1287:
+  write -24 r14 r1
+  shiftl r4 2 r3
+  addr2reg peep_pat_lines r2
+  add r2 r3 r2
+  read 0 r2 r2
+  bges r1 r2 .L1294
+  load 0 r2
+.L1289:
+  write -28 r14 r2
+  load 20 r3
+  mults r4 r3 r5
+  addr2reg peep_pat_ntok r3
+  add r3 r5 r3
+  shiftl r1 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  bges r2 r3 .L1293
+  load 80 r3
+  mults r4 r3 r4
+  or r0 r1 r3
+  addr2reg peep_pat r1
+  add r1 r4 r1
+  shiftl r3 4 r3
+  add r1 r3 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  or r0 r6 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -28 r14 r2
+  read -24 r14 r1
+  read -16 r14 r6
+  read -20 r14 r4
+  beq r3 r0 .L1292
+  add r2 1 r2
+  jump .L1289
+.L1292:
+  load 0 r1
+  jump .L1313
+.L1293:
+  add r1 1 r1
+  jump .L1287
+.L1294:
+  or r0 r6 r5
+  load 0 r1
+  or r0 r5 r6
+.L1297:
+  write -12 r14 r1
+  addr2reg peep_nvars r12
+  read 0 r12 r2
+  bges r1 r2 .L1303
+  shiftl r1 1 r3
+  addr2reg peep_var r2
+  add r2 r3 r2
+  add r2 0 r2
+  readb 0 r2 r3
+  load 0 r2
+  load 37 r4
+  bne r3 r4 .L1300
+  shiftl r1 6 r2
+  addr2reg peep_val r1
+  add r1 r2 r4
+  or r0 r6 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -12 r14 r1
+  read -16 r14 r6
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1300:
+  bne r2 r0 .L1302
+  add r1 1 r1
+  jump .L1297
+.L1302:
+  load 0 r1
+  jump .L1313
+.L1303:
+  or r0 r6 r5
+  read -32 r14 r4
+.L1304:
+  addr2reg peep_nvars r12
+  read 0 r12 r2
+  load 1 r1
+  load 8 r3
+  bges r2 r3 .L1306
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  read -16 r14 r5
+  read -32 r14 r4
+  slt r1 64 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1306:
+  bne r1 r0 .L1308
+  add r4 0 r1
+  readb 0 r1 r1
+  addr2reg peep_nvars r12
+  read 0 r12 r2
+  shiftl r2 1 r3
+  addr2reg peep_var r2
+  add r2 r3 r2
+  add r2 0 r2
+  writeb 0 r2 r1
+  add r4 1 r1
+  readb 0 r1 r1
+  addr2reg peep_nvars r12
+  read 0 r12 r2
+  shiftl r2 1 r3
+  addr2reg peep_var r2
+  add r2 r3 r2
+  add r2 1 r2
+  writeb 0 r2 r1
+  addr2reg peep_nvars r12
+  read 0 r12 r1
+  shiftl r1 6 r2
+  addr2reg peep_val r1
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  addr2reg peep_nvars r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg peep_nvars r12
+  write 0 r12 r1
+  load 1 r1
+  jump .L1313
+.L1308:
+  load 0 r1
+  jump .L1313
+.L1309:
+  load 0 r1
+  jump .L1313
+.L1310:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  xor r1 0 r1
+  sltu r1 1 r1
+  jump .L1313
+.L1312:
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  xor r1 0 r1
+  sltu r1 1 r1
+.L1313:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function peep_bind */
+
+
+.text
+; function peep_match
+peep_match:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 108 r13
+  write -24 r14 r5
+  write -32 r14 r4
+  load 0 r1
+  addr2reg peep_nvars r12
+  write 0 r12 r1
+  shiftl r4 2 r2
+  addr2reg peep_pat_lines r1
+  add r1 r2 r1
+  read 0 r1 r1
+  blts r6 r1 .L1337
+  load 0 r1
+  or r0 r1 r2
+.L1319:
+  write -28 r14 r2
+  shiftl r4 2 r3
+  addr2reg peep_pat_lines r1
+  add r1 r3 r1
+  read 0 r1 r1
+  bges r2 r1 .L1336
+  shiftl r2 2 r1
+  add r5 r1 r1
+  read 0 r1 r1
+  write -20 r14 r1
+  load 80 r1
+  mults r4 r1 r3
+  addr2reg peep_pat r1
+  add r1 r3 r1
+  shiftl r2 4 r2
+  add r1 r2 r1
+  add r1 0 r1
+  read 0 r1 r5
+  write -12 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  read -12 r14 r5
+  read -20 r14 r2
+  load 1 r3
+  sub r1 r3 r1
+  add r5 r1 r1
+  readb 0 r1 r1
+  load 58 r3
+  beq r1 r3 .L1329
+  add r14 -100 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump peep_tokens
+  or r0 r1 r3
+  read -28 r14 r2
+  read -32 r14 r4
+  write -4 r14 r3
+  load 20 r1
+  mults r4 r1 r5
+  addr2reg peep_pat_ntok r1
+  add r1 r5 r1
+  shiftl r2 2 r5
+  add r1 r5 r1
+  read 0 r1 r1
+  bne r3 r1 .L1328
+  load 0 r1
+.L1323:
+  write -8 r14 r1
+  bges r1 r3 .L1327
+  load 80 r3
+  mults r4 r3 r5
+  or r0 r2 r3
+  addr2reg peep_pat r2
+  add r2 r5 r2
+  shiftl r3 4 r3
+  add r2 r3 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r5
+  or r0 r1 r2
+  read -100 r14 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump peep_bind
+  or r0 r1 r5
+  read -8 r14 r1
+  read -28 r14 r2
+  read -4 r14 r3
+  read -32 r14 r4
+  beq r5 r0 .L1326
+  add r1 1 r1
+  jump .L1323
+.L1326:
+  load 0 r1
+  jump .L1338
+.L1327:
+  read -24 r14 r5
+  jump .L1333
+.L1328:
+  load 0 r1
+  jump .L1338
+.L1329:
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  read -12 r14 r5
+  read -20 r14 r2
+  load 1 r3
+  sub r1 r3 r3
+  write -16 r14 r3
+  addr2reg line_kind r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r2
+  load 1 r1
+  load 2 r4
+  bne r2 r4 .L1331
+  slt r3 64 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1331:
+  bne r1 r0 .L1335
+  or r0 r3 r6
+  add r14 -96 r4
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -16 r14 r3
+  read -20 r14 r2
+  read -32 r14 r4
+  add r14 -96 r1
+  add r1 r3 r3
+  load 0 r1
+  writeb 0 r3 r1
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r6
+  add r14 -96 r5
+  savpc r15
+  add r15 12 r15
+  jump peep_bind
+  read -28 r14 r2
+  read -24 r14 r5
+  read -32 r14 r4
+  beq r1 r0 .L1334
+.L1333:
+  add r2 1 r2
+  jump .L1319
+.L1334:
+  load 0 r1
+  jump .L1338
+.L1335:
+  load 0 r1
+  jump .L1338
+.L1336:
+  load 1 r1
+  jump .L1338
+.L1337:
+  load 0 r1
+.L1338:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function peep_match */
+
+.data
+.balign 1
+.Lstring.163:
+	.ascii "savpc\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.164:
+	.ascii "beq\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.165:
+	.ascii "bne\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.166:
+	.ascii "bgt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.167:
+	.ascii "bge\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.168:
+	.ascii "blt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.169:
+	.ascii "ble\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.170:
+	.ascii "bgts\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.171:
+	.ascii "bges\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.172:
+	.ascii "blts\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.173:
+	.ascii "bles\000"
+/* end data */
+
+
+.text
+; function peep_pin
+peep_pin:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  load 0 r1
+  or r0 r1 r4
+.L1343:
+  write -16 r14 r4
+  addr2reg line_count r12
+  read 0 r12 r1
+  bges r4 r1 .L1422
+  add r14 -28 r5
+  savpc r15
+  add r15 12 r15
+  jump peep_tokens
+  or r0 r1 r2
+  read -16 r14 r4
+  write -8 r14 r2
+  bles r2 r0 .L1421
+  read -28 r14 r1
+  add r1 0 r1
+  read 0 r1 r4
+  write -4 r14 r4
+  addr2reg .Lstring.163 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r4
+  or r0 r4 r1
+  read -4 r14 r4
+  read -8 r14 r2
+  beq r3 r0 .L1402
+  add r4 0 r3
+  readb 0 r3 r5
+  load 1 r3
+  load 98 r6
+  beq r5 r6 .L1348
+  addr2reg .Lstring.92 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r4
+  or r0 r4 r1
+  read -4 r14 r4
+  read -8 r14 r2
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L1348:
+  beq r3 r0 .L1401
+  add r4 0 r3
+  readb 0 r3 r5
+  load 0 r3
+  load 98 r6
+  beq r5 r6 .L1351
+  or r0 r3 r5
+  jump .L1352
+.L1351:
+  addr2reg .Lstring.164 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r4
+  or r0 r4 r1
+  read -4 r14 r4
+  read -8 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+.L1352:
+  load 0 r3
+  bne r5 r0 .L1354
+  or r0 r3 r5
+  jump .L1355
+.L1354:
+  addr2reg .Lstring.165 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r4
+  or r0 r4 r1
+  read -4 r14 r4
+  read -8 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+.L1355:
+  load 0 r3
+  bne r5 r0 .L1357
+  or r0 r3 r5
+  jump .L1358
+.L1357:
+  addr2reg .Lstring.166 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r4
+  or r0 r4 r1
+  read -4 r14 r4
+  read -8 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+.L1358:
+  load 0 r3
+  bne r5 r0 .L1360
+  or r0 r3 r5
+  jump .L1361
+.L1360:
+  addr2reg .Lstring.167 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r4
+  or r0 r4 r1
+  read -4 r14 r4
+  read -8 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+.L1361:
+  load 0 r3
+  bne r5 r0 .L1363
+  or r0 r3 r5
+  jump .L1364
+.L1363:
+  addr2reg .Lstring.168 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r4
+  or r0 r4 r1
+  read -4 r14 r4
+  read -8 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+.L1364:
+  load 0 r3
+  bne r5 r0 .L1366
+  or r0 r3 r5
+  jump .L1367
+.L1366:
+  addr2reg .Lstring.169 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r4
+  or r0 r4 r1
+  read -4 r14 r4
+  read -8 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+.L1367:
+  load 0 r3
+  bne r5 r0 .L1369
+  or r0 r3 r5
+  jump .L1370
+.L1369:
+  addr2reg .Lstring.170 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r4
+  or r0 r4 r1
+  read -4 r14 r4
+  read -8 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+.L1370:
+  load 0 r3
+  bne r5 r0 .L1372
+  or r0 r3 r5
+  jump .L1373
+.L1372:
+  addr2reg .Lstring.171 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r4
+  or r0 r4 r1
+  read -4 r14 r4
+  read -8 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+.L1373:
+  load 0 r3
+  bne r5 r0 .L1375
+  or r0 r3 r5
+  jump .L1376
+.L1375:
+  addr2reg .Lstring.172 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r4
+  or r0 r4 r1
+  read -4 r14 r4
+  read -8 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+.L1376:
+  load 0 r3
+  bne r5 r0 .L1378
+  or r0 r1 r4
+  or r0 r3 r1
+  jump .L1379
+.L1378:
+  addr2reg .Lstring.173 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -16 r14 r4
+  read -8 r14 r2
+  xor r1 0 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1379:
+  bne r1 r0 .L1421
+  read -28 r14 r1
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump peep_is_num
+  or r0 r1 r3
+  read -16 r14 r4
+  read -8 r14 r2
+  load 1 r1
+  beq r3 r0 .L1382
+  read -28 r14 r1
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  add r14 -24 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -16 r14 r4
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1382:
+  bne r1 r0 .L1421
+  addr2reg line_flags r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r2
+  read 0 r2 r1
+  or r1 4 r1
+  write 0 r2 r1
+  read -24 r14 r2
+  blts r2 r0 .L1385
+  or r0 r2 r1
+  jump .L1386
+.L1385:
+  sub r0 r2 r1
+.L1386:
+  shiftrs r1 31 r3
+  shiftr r3 30 r3
+  add r1 r3 r1
+  shiftrs r1 2 r1
+  bgts r2 r0 .L1388
+  load32 -1 r2
+  jump .L1389
+.L1388:
+  load 1 r2
+.L1389:
+  or r0 r2 r3
+  add r4 r3 r2
+.L1390:
+  load 0 r5
+  bgts r1 r0 .L1392
+  or r0 r5 r6
+  jump .L1393
+.L1392:
+  slt r2 r0 r5
+  xor r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r6
+.L1393:
+  load 0 r5
+  beq r6 r0 .L1395
+  addr2reg line_count r12
+  read 0 r12 r5
+  slt r2 r5 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L1395:
+  beq r5 r0 .L1421
+  addr2reg line_flags r12
+  read 0 r12 r5
+  shiftl r2 2 r6
+  add r5 r6 r6
+  read 0 r6 r5
+  or r5 4 r5
+  write 0 r6 r5
+  addr2reg line_kind r12
+  read 0 r12 r5
+  shiftl r2 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  load 1 r6
+  sub r5 r6 r5
+  load 11 r6
+  bge r5 r6 .L1400
+  shiftl r5 2 r6
+  addr2reg .Ljt1398 r5
+  add r5 r6 r5
+  read 0 r5 r5
+  jumpr 0 r5
+.L1399:
+  load 1 r5
+  sub r1 r5 r1
+.L1400:
+  add r2 r3 r2
+  jump .L1390
+.L1401:
+  or r0 r1 r4
+  jump .L1421
+.L1402:
+  or r0 r1 r4
+  addr2reg line_flags r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r2
+  read 0 r2 r1
+  or r1 4 r1
+  write 0 r2 r1
+  add r4 1 r1
+.L1404:
+  write -12 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r3
+  load 0 r2
+  bges r1 r3 .L1406
+  addr2reg line_kind r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  xor r2 2 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1406:
+  beq r2 r0 .L1420
+  addr2reg line_flags r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  read 0 r3 r2
+  or r2 4 r2
+  write 0 r3 r2
+  add r14 -20 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump peep_tokens
+  or r0 r1 r3
+  read -12 r14 r1
+  load 0 r2
+  bles r3 r0 .L1417
+  read -20 r14 r1
+  add r1 0 r1
+  read 0 r1 r4
+  addr2reg .Lstring.91 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -12 r14 r1
+  load 1 r2
+  beq r3 r0 .L1410
+  read -20 r14 r1
+  add r1 0 r1
+  read 0 r1 r4
+  addr2reg .Lstring.92 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -12 r14 r1
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1411
+.L1410:
+  or r0 r2 r3
+.L1411:
+  load 1 r2
+  bne r3 r0 .L1413
+  read -20 r14 r1
+  add r1 0 r1
+  read 0 r1 r4
+  addr2reg .Lstring.93 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -12 r14 r1
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1414
+.L1413:
+  or r0 r2 r3
+.L1414:
+  load 1 r2
+  bne r3 r0 .L1416
+  read -20 r14 r1
+  add r1 0 r1
+  read 0 r1 r4
+  addr2reg .Lstring.94 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -12 r14 r1
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1416:
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1417:
+  bne r2 r0 .L1419
+  add r1 1 r1
+  jump .L1404
+.L1419:
+  read -16 r14 r4
+  jump .L1421
+.L1420:
+  read -16 r14 r4
+.L1421:
+  add r4 1 r4
+  jump .L1343
+.L1422:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt1398:
+  .int .L1399
+  .int .L1400
+  .int .L1399
+  .int .L1399
+  .int .L1399
+  .int .L1399
+  .int .L1400
+  .int .L1400
+  .int .L1400
+  .int .L1399
+  .int .L1399
+
+/* end function peep_pin */
+
+.data
+.balign 1
+.Lstring.175:
+	.ascii " \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.176:
+	.ascii "%s%s\000"
+/* end data */
+
+
+.text
+; function peep_apply
+peep_apply:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 552 r13
+  write -32 r14 r5
+  write -16 r14 r4
+  load 0 r1
+.L1426:
+  write -20 r14 r1
+  shiftl r4 2 r3
+  addr2reg peep_rep_lines r2
+  add r2 r3 r2
+  read 0 r2 r2
+  bges r1 r2 .L1448
+  load 0 r3
+  load 0 r2
+.L1428:
+  write -28 r14 r3
+  write -24 r14 r2
+  load 20 r5
+  mults r4 r5 r6
+  addr2reg peep_rep_ntok r5
+  add r5 r6 r5
+  shiftl r1 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  bges r3 r5 .L1445
+  load 80 r5
+  mults r4 r5 r5
+  or r0 r1 r4
+  addr2reg peep_rep r1
+  add r1 r5 r1
+  shiftl r4 4 r4
+  add r1 r4 r1
+  shiftl r3 2 r4
+  add r1 r4 r1
+  read 0 r1 r1
+  write -12 r14 r1
+  readb 0 r1 r4
+  load 1 r5
+  load 37 r6
+  beq r4 r6 .L1431
+  xor r4 35 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r6
+  jump .L1432
+.L1431:
+  or r0 r5 r6
+.L1432:
+  load 1 r5
+  bne r6 r0 .L1434
+  xor r4 64 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+  jump .L1435
+.L1434:
+  or r0 r5 r4
+.L1435:
+  bne r4 r0 .L1437
+  or r0 r2 r5
+  load 0 r2
+  jump .L1438
+.L1437:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump peep_lookup
+  read -28 r14 r3
+  read -24 r14 r5
+  or r0 r1 r2
+  read -12 r14 r1
+.L1438:
+  add r14 -544 r4
+  add r4 r5 r4
+  load 512 r6
+  sub r6 r5 r5
+  bne r3 r0 .L1440
+  addr2reg .Lstring.113 r3
+  jump .L1441
+.L1440:
+  addr2reg .Lstring.175 r3
+.L1441:
+  or r0 r3 r7
+  beq r2 r0 .L1443
+  or r0 r2 r1
+.L1443:
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.176 r6
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  or r0 r1 r5
+  read -28 r14 r3
+  read -24 r14 r2
+  read -20 r14 r1
+  read -16 r14 r4
+  load32 -28 r6
+  sub r13 r6 r13
+  add r2 r5 r2
+  add r3 1 r3
+  jump .L1428
+.L1445:
+  add r14 -544 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  add r14 -544 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strdup_n
+  or r0 r1 r2
+  read -20 r14 r1
+  read -32 r14 r5
+  read -16 r14 r4
+  addr2reg line_text r12
+  read 0 r12 r3
+  shiftl r1 2 r6
+  add r5 r6 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r3 r6 r3
+  write 0 r3 r2
+  shiftl r1 2 r2
+  add r5 r2 r2
+  read 0 r2 r2
+  load32 1717986919 r3
+  mulshi r2 r3 r3
+  shiftrs r3 1 r3
+  shiftr r2 31 r6
+  add r3 r6 r6
+  shiftl r6 2 r3
+  add r3 r6 r3
+  sub r2 r3 r2
+  shiftl r2 2 r3
+  addr2reg peep_slot_line r2
+  add r2 r3 r3
+  load32 -1 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L1426
+.L1448:
+  read -32 r14 r5
+.L1449:
+  shiftl r4 2 r3
+  addr2reg peep_consumed r2
+  add r2 r3 r2
+  read 0 r2 r2
+  bges r1 r2 .L1452
+  addr2reg line_flags r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r5 r3 r3
+  read 0 r3 r3
+  shiftl r3 2 r3
+  add r2 r3 r3
+  read 0 r3 r2
+  or r2 8 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L1449
+.L1452:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function peep_apply */
+
+.data
+.balign 1
+.Lstring.178:
+	.ascii "Peephole:\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.179:
+	.ascii ", \000"
+/* end data */
+
+
+.text
+; function pass_peephole
+pass_peephole:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 60 r13
+  savpc r15
+  add r15 12 r15
+  jump peep_init
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L1516
+  savpc r15
+  add r15 12 r15
+  jump peep_pin
+  load 0 r1
+.L1457:
+  write -32 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r2
+  bges r1 r2 .L1482
+  addr2reg line_flags r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  and r2 8 r2
+  bne r2 r0 .L1481
+  load 0 r2
+  or r0 r2 r4
+  or r0 r1 r2
+.L1461:
+  write -24 r14 r4
+  addr2reg line_count r12
+  read 0 r12 r5
+  load 0 r3
+  bges r1 r5 .L1463
+  slt r4 5 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L1463:
+  beq r3 r0 .L1467
+  addr2reg line_flags r12
+  read 0 r12 r3
+  shiftl r1 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  and r3 8 r3
+  bne r3 r0 .L1466
+  or r0 r4 r3
+  add r4 1 r4
+  shiftl r3 2 r5
+  add r14 -52 r3
+  add r3 r5 r3
+  write 0 r3 r1
+.L1466:
+  add r1 1 r1
+  jump .L1461
+.L1467:
+  load 0 r1
+  or r0 r1 r3
+.L1469:
+  write -28 r14 r3
+  load 16 r1
+  bges r3 r1 .L1479
+  or r0 r4 r6
+  add r14 -52 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump peep_match
+  read -28 r14 r3
+  read -24 r14 r4
+  beq r1 r0 .L1478
+  load 0 r2
+  load 0 r1
+.L1472:
+  shiftl r3 2 r6
+  addr2reg peep_consumed r5
+  add r5 r6 r5
+  read 0 r5 r5
+  bges r2 r5 .L1476
+  addr2reg line_flags r12
+  read 0 r12 r5
+  shiftl r2 2 r7
+  add r14 -52 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  and r5 4 r5
+  beq r5 r0 .L1475
+  load 1 r1
+.L1475:
+  add r2 1 r2
+  jump .L1472
+.L1476:
+  bne r1 r0 .L1478
+  add r14 -52 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump peep_apply
+  read -28 r14 r3
+  read -32 r14 r1
+  shiftl r3 2 r3
+  addr2reg peep_hits r2
+  add r2 r3 r3
+  read 0 r3 r2
+  add r2 1 r2
+  write 0 r3 r2
+  jump .L1480
+.L1478:
+  add r3 1 r3
+  jump .L1469
+.L1479:
+  read -32 r14 r1
+.L1480:
+  addr2reg has_error r12
+  read 0 r12 r2
+  bne r2 r0 .L1516
+.L1481:
+  or r0 r1 r2
+  add r1 1 r1
+  jump .L1457
+.L1482:
+  savpc r15
+  add r15 12 r15
+  jump remove_dead_lines
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L1485
+  addr2reg .Lstring.178 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L1485:
+  load 0 r1
+.L1486:
+  write -16 r14 r1
+  load 16 r2
+  bges r1 r2 .L1514
+  load 0 r2
+.L1488:
+  write -8 r14 r2
+  bges r2 r1 .L1491
+  load 12 r3
+  mults r2 r3 r3
+  addr2reg peep_rules r2
+  add r2 r3 r2
+  read 0 r2 r4
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg peep_rules r1
+  add r1 r2 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -8 r14 r2
+  read -16 r14 r1
+  beq r3 r0 .L1491
+  add r2 1 r2
+  jump .L1488
+.L1491:
+  blts r2 r1 .L1513
+  load 0 r2
+  write -12 r14 r2
+  or r0 r1 r2
+.L1494:
+  write -20 r14 r2
+  load 16 r3
+  bges r2 r3 .L1499
+  load 12 r3
+  mults r2 r3 r3
+  addr2reg peep_rules r2
+  add r2 r3 r2
+  read 0 r2 r4
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg peep_rules r1
+  add r1 r2 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -20 r14 r1
+  read -12 r14 r2
+  or r0 r1 r3
+  read -16 r14 r1
+  bne r4 r0 .L1497
+  shiftl r3 2 r5
+  addr2reg peep_hits r4
+  add r4 r5 r4
+  read 0 r4 r4
+  add r2 r4 r2
+.L1497:
+  add r3 1 r3
+  write -12 r14 r2
+  or r0 r3 r2
+  jump .L1494
+.L1499:
+  read -12 r14 r4
+  bne r1 r0 .L1502
+  addr2reg .Lstring.175 r2
+  jump .L1503
+.L1502:
+  addr2reg .Lstring.179 r2
+.L1503:
+  addr2reg verbose r12
+  read 0 r12 r3
+  beq r3 r0 .L1506
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -12 r14 r4
+  read -16 r14 r1
+.L1506:
+  load 12 r2
+  mults r1 r2 r2
+  addr2reg peep_rules r1
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg verbose r12
+  read 0 r12 r2
+  beq r2 r0 .L1510
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -12 r14 r4
+.L1510:
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L1512
+  addr2reg .Lstring.175 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -12 r14 r4
+.L1512:
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  read -16 r14 r1
+.L1513:
+  add r1 1 r1
+  jump .L1486
+.L1514:
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L1516
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L1516:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pass_peephole */
+
+.data
+.balign 1
+.Lstring.181:
+	.ascii "too many lines for header\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.182:
+	.ascii "jump Main\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.183:
+	.ascii "nop\000"
+/* end data */
+
+
+.text
+; function prepend_header
+prepend_header:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg line_count r12
+  read 0 r12 r1
+  add r1 3 r2
+  load32 49152 r3
+  bgts r2 r3 .L1529
+  load 1 r2
+  sub r1 r2 r1
+.L1521:
+  blts r1 r0 .L1524
+  addr2reg line_kind r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_text r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_file_idx r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_value r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_label r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_label_off r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_byte_off r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_byte_len r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_align r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_dir_sec r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_addr r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  addr2reg line_flags r12
+  read 0 r12 r3
+  shiftl r1 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r1 3 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  load 1 r2
+  sub r1 r2 r1
+  jump .L1521
+.L1524:
+  addr2reg line_count r12
+  read 0 r12 r1
+  add r1 3 r1
+  addr2reg line_count r12
+  write 0 r12 r1
+  addr2reg line_kind r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 1 r1
+  write 0 r2 r1
+  addr2reg .Lstring.182 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  addr2reg .Lstring.182 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strdup_n
+  addr2reg line_text r12
+  read 0 r12 r2
+  add r2 0 r2
+  write 0 r2 r1
+  addr2reg line_section r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_value r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_label r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_label_off r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_byte_off r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_byte_len r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_align r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_dir_sec r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_addr r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_flags r12
+  read 0 r12 r1
+  add r1 0 r2
+  load 1 r1
+  write 0 r2 r1
+  addr2reg line_kind r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 1 r1
+  write 0 r2 r1
+  addr2reg .Lstring.183 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  addr2reg .Lstring.183 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strdup_n
+  addr2reg line_text r12
+  read 0 r12 r2
+  add r2 4 r2
+  write 0 r2 r1
+  addr2reg line_section r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_value r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_label r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_label_off r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_byte_off r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_byte_len r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_align r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_dir_sec r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_addr r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_flags r12
+  read 0 r12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_kind r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 3 r1
+  write 0 r2 r1
+  addr2reg line_text r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_section r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_value r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_label r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_label_off r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_byte_off r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_byte_len r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_align r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_dir_sec r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_addr r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_flags r12
+  read 0 r12 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  jump .L1530
+.L1529:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.181 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+.L1530:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function prepend_header */
+
+
+.text
+; function out_clone_from
+out_clone_from:
+  addr2reg line_kind r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_kind r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_text r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg line_section r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_section r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_file_idx r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg line_value r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_value r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg line_label r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_label r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg line_label_off r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_label_off r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg line_byte_off r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_byte_off r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg line_byte_len r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_byte_len r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg line_align r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_align r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg line_dir_sec r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_dir_sec r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg out_addr r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg line_flags r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg out_flags r12
+  read 0 r12 r2
+  addr2reg out_count r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg out_count r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg out_count r12
+  write 0 r12 r1
+  jumpr 0 r15
+
+/* end function out_clone_from */
+
+
+.text
+; function out_emit_dw
+out_emit_dw:
+  addr2reg out_kind r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  load 3 r1
+  write 0 r2 r1
+  addr2reg out_text r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg out_section r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  addr2reg out_file_idx r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r6
+  addr2reg out_value r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r4
+  addr2reg out_label r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg out_label_off r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg out_byte_off r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg out_byte_len r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg out_align r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg out_dir_sec r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  write 0 r1 r5
+  addr2reg out_addr r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg out_flags r12
+  read 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg out_count r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg out_count r12
+  write 0 r12 r1
+  jumpr 0 r15
+
+/* end function out_emit_dw */
+
+.data
+.balign 1
+.Lstring.187:
+	.ascii "OOM allocating output line arrays\000"
+/* end data */
+
+
+.text
+; function alloc_out_arrays
+alloc_out_arrays:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_kind r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_text r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_section r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_file_idx r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_value r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_label r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_label_off r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_byte_off r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_byte_len r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_align r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_dir_sec r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_addr r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg out_flags r12
+  write 0 r12 r1
+  addr2reg out_kind r12
+  read 0 r12 r3
+  load 1 r2
+  beq r3 r0 .L1543
+  addr2reg out_text r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1544
+.L1543:
+  or r0 r2 r3
+.L1544:
+  load 1 r2
+  bne r3 r0 .L1546
+  addr2reg out_section r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1547
+.L1546:
+  or r0 r2 r3
+.L1547:
+  load 1 r2
+  bne r3 r0 .L1549
+  addr2reg out_file_idx r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1550
+.L1549:
+  or r0 r2 r3
+.L1550:
+  load 1 r2
+  bne r3 r0 .L1552
+  addr2reg out_value r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1553
+.L1552:
+  or r0 r2 r3
+.L1553:
+  load 1 r2
+  bne r3 r0 .L1555
+  addr2reg out_label r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1556
+.L1555:
+  or r0 r2 r3
+.L1556:
+  load 1 r2
+  bne r3 r0 .L1558
+  addr2reg out_label_off r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1559
+.L1558:
+  or r0 r2 r3
+.L1559:
+  load 1 r2
+  bne r3 r0 .L1561
+  addr2reg out_byte_off r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1562
+.L1561:
+  or r0 r2 r3
+.L1562:
+  load 1 r2
+  bne r3 r0 .L1564
+  addr2reg out_byte_len r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1565
+.L1564:
+  or r0 r2 r3
+.L1565:
+  load 1 r2
+  bne r3 r0 .L1567
+  addr2reg out_align r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1568
+.L1567:
+  or r0 r2 r3
+.L1568:
+  load 1 r2
+  bne r3 r0 .L1570
+  addr2reg out_dir_sec r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1571
+.L1570:
+  or r0 r2 r3
+.L1571:
+  load 1 r2
+  bne r3 r0 .L1573
+  addr2reg out_addr r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L1574
+.L1573:
+  or r0 r2 r3
+.L1574:
+  load 1 r2
+  bne r3 r0 .L1576
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L1577
+.L1576:
+  or r0 r2 r1
+.L1577:
+  bne r1 r0 .L1579
+  load 0 r1
+  jump .L1581
+.L1579:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.187 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+.L1581:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function alloc_out_arrays */
+
+
+.text
+; function swap_out_to_in
+swap_out_to_in:
+  addr2reg line_kind r12
+  read 0 r12 r1
+  addr2reg out_kind r12
+  read 0 r12 r2
+  addr2reg line_kind r12
+  write 0 r12 r2
+  addr2reg out_kind r12
+  write 0 r12 r1
+  addr2reg line_text r12
+  read 0 r12 r1
+  addr2reg out_text r12
+  read 0 r12 r2
+  addr2reg line_text r12
+  write 0 r12 r2
+  addr2reg out_text r12
+  write 0 r12 r1
+  addr2reg line_section r12
+  read 0 r12 r1
+  addr2reg out_section r12
+  read 0 r12 r2
+  addr2reg line_section r12
+  write 0 r12 r2
+  addr2reg out_section r12
+  write 0 r12 r1
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  addr2reg out_file_idx r12
+  read 0 r12 r2
+  addr2reg line_file_idx r12
+  write 0 r12 r2
+  addr2reg out_file_idx r12
+  write 0 r12 r1
+  addr2reg line_value r12
+  read 0 r12 r1
+  addr2reg out_value r12
+  read 0 r12 r2
+  addr2reg line_value r12
+  write 0 r12 r2
+  addr2reg out_value r12
+  write 0 r12 r1
+  addr2reg line_label r12
+  read 0 r12 r1
+  addr2reg out_label r12
+  read 0 r12 r2
+  addr2reg line_label r12
+  write 0 r12 r2
+  addr2reg out_label r12
+  write 0 r12 r1
+  addr2reg line_label_off r12
+  read 0 r12 r1
+  addr2reg out_label_off r12
+  read 0 r12 r2
+  addr2reg line_label_off r12
+  write 0 r12 r2
+  addr2reg out_label_off r12
+  write 0 r12 r1
+  addr2reg line_byte_off r12
+  read 0 r12 r1
+  addr2reg out_byte_off r12
+  read 0 r12 r2
+  addr2reg line_byte_off r12
+  write 0 r12 r2
+  addr2reg out_byte_off r12
+  write 0 r12 r1
+  addr2reg line_byte_len r12
+  read 0 r12 r1
+  addr2reg out_byte_len r12
+  read 0 r12 r2
+  addr2reg line_byte_len r12
+  write 0 r12 r2
+  addr2reg out_byte_len r12
+  write 0 r12 r1
+  addr2reg line_align r12
+  read 0 r12 r1
+  addr2reg out_align r12
+  read 0 r12 r2
+  addr2reg line_align r12
+  write 0 r12 r2
+  addr2reg out_align r12
+  write 0 r12 r1
+  addr2reg line_dir_sec r12
+  read 0 r12 r1
+  addr2reg out_dir_sec r12
+  read 0 r12 r2
+  addr2reg line_dir_sec r12
+  write 0 r12 r2
+  addr2reg out_dir_sec r12
+  write 0 r12 r1
+  addr2reg line_addr r12
+  read 0 r12 r1
+  addr2reg out_addr r12
+  read 0 r12 r2
+  addr2reg line_addr r12
+  write 0 r12 r2
+  addr2reg out_addr r12
+  write 0 r12 r1
+  addr2reg line_flags r12
+  read 0 r12 r1
+  addr2reg out_flags r12
+  read 0 r12 r2
+  addr2reg line_flags r12
+  write 0 r12 r2
+  addr2reg out_flags r12
+  write 0 r12 r1
+  addr2reg out_count r12
+  read 0 r12 r1
+  addr2reg line_count r12
+  write 0 r12 r1
+  jumpr 0 r15
+
+/* end function swap_out_to_in */
+
+.data
+.balign 1
+.Lstring.190:
+	.ascii "line array full\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.191:
+	.ascii "load %d r%d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.192:
+	.ascii "loadhi %d r%d\000"
+/* end data */
+
+
+.text
+; function pass_expand_pseudo
+pass_expand_pseudo:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 104 r13
+  load 0 r1
+  addr2reg out_count r12
+  write 0 r12 r1
+  load 0 r1
+.L1589:
+  write -32 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r2
+  bges r1 r2 .L1602
+  addr2reg out_count r12
+  read 0 r12 r2
+  add r2 2 r2
+  load32 49152 r3
+  bgts r2 r3 .L1601
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump out_clone_from
+  read -32 r14 r1
+  addr2reg line_kind r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  read 0 r3 r3
+  load 10 r4
+  beq r3 r4 .L1594
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 11 r3
+  bne r2 r3 .L1600
+  addr2reg out_count r12
+  read 0 r12 r2
+  load 1 r3
+  sub r2 r3 r2
+  write -12 r14 r2
+  addr2reg out_kind r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r4
+  load 12 r3
+  write 0 r4 r3
+  addr2reg out_text r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r4
+  load 0 r3
+  write 0 r4 r3
+  or r0 r2 r3
+  addr2reg out_flags r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r3
+  read 0 r3 r2
+  or r2 2 r2
+  write 0 r3 r2
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump out_clone_from
+  read -32 r14 r1
+  read -12 r14 r2
+  add r2 1 r3
+  addr2reg out_kind r12
+  read 0 r12 r2
+  shiftl r3 2 r4
+  add r2 r4 r4
+  load 13 r2
+  write 0 r4 r2
+  addr2reg out_text r12
+  read 0 r12 r2
+  shiftl r3 2 r4
+  add r2 r4 r4
+  load 0 r2
+  write 0 r4 r2
+  addr2reg out_flags r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  jump .L1600
+.L1594:
+  addr2reg line_value r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  or r0 r1 r3
+  addr2reg line_label_off r12
+  read 0 r12 r1
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  write -20 r14 r1
+  shiftr r2 16 r3
+  load32 65535 r4
+  and r3 r4 r7
+  write -16 r14 r7
+  load32 65535 r3
+  and r2 r3 r7
+  addr2reg out_count r12
+  read 0 r12 r2
+  load 1 r3
+  sub r2 r3 r2
+  write -24 r14 r2
+  or r0 r2 r4
+  addr2reg out_kind r12
+  read 0 r12 r2
+  shiftl r4 2 r3
+  add r2 r3 r3
+  load 1 r2
+  write 0 r3 r2
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.191 r6
+  load 64 r5
+  add r14 -96 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -28 r1
+  sub r13 r1 r13
+  add r14 -96 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  add r14 -96 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strdup_n
+  or r0 r1 r2
+  read -32 r14 r1
+  read -24 r14 r4
+  read -16 r14 r7
+  addr2reg out_text r12
+  read 0 r12 r3
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  beq r7 r0 .L1600
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump out_clone_from
+  read -24 r14 r2
+  read -16 r14 r7
+  read -20 r14 r1
+  add r2 1 r3
+  write -28 r14 r3
+  addr2reg out_kind r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r3
+  load 1 r2
+  write 0 r3 r2
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.192 r6
+  load 64 r5
+  add r14 -96 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -28 r1
+  sub r13 r1 r13
+  add r14 -96 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  add r14 -96 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strdup_n
+  or r0 r1 r2
+  read -32 r14 r1
+  read -28 r14 r3
+  addr2reg out_text r12
+  read 0 r12 r4
+  shiftl r3 2 r5
+  add r4 r5 r4
+  write 0 r4 r2
+  addr2reg out_value r12
+  read 0 r12 r2
+  shiftl r3 2 r4
+  add r2 r4 r4
+  load 0 r2
+  write 0 r4 r2
+  addr2reg out_label_off r12
+  read 0 r12 r2
+  shiftl r3 2 r4
+  add r2 r4 r4
+  load 0 r2
+  write 0 r4 r2
+  addr2reg out_flags r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+.L1600:
+  add r1 1 r1
+  jump .L1589
+.L1601:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.190 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  jump .L1603
+.L1602:
+  savpc r15
+  add r15 12 r15
+  jump swap_out_to_in
+.L1603:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pass_expand_pseudo */
+
+
+.text
+; function pack_flush
+pack_flush:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  addr2reg pack_len r12
+  read 0 r12 r1
+  beq r1 r0 .L1614
+.L1607:
+  addr2reg pack_len r12
+  read 0 r12 r2
+  shiftrs r2 31 r1
+  shiftr r1 30 r1
+  add r2 r1 r1
+  and r1 -4 r1
+  sub r2 r1 r1
+  beq r1 r0 .L1609
+  add r2 1 r1
+  addr2reg pack_len r12
+  write 0 r12 r1
+  addr2reg pack_tmp r1
+  add r1 r2 r2
+  load 0 r1
+  writeb 0 r2 r1
+  jump .L1607
+.L1609:
+  load 0 r1
+.L1610:
+  write -16 r14 r1
+  addr2reg pack_len r12
+  read 0 r12 r2
+  bges r1 r2 .L1613
+  or r0 r1 r2
+  addr2reg pack_tmp r1
+  add r1 r2 r1
+  readbu 0 r1 r1
+  add r2 1 r4
+  addr2reg pack_tmp r3
+  add r3 r4 r3
+  readbu 0 r3 r3
+  shiftl r3 8 r3
+  or r1 r3 r1
+  add r2 2 r4
+  addr2reg pack_tmp r3
+  add r3 r4 r3
+  readbu 0 r3 r3
+  shiftl r3 16 r3
+  or r1 r3 r1
+  add r2 3 r3
+  addr2reg pack_tmp r2
+  add r2 r3 r2
+  readbu 0 r2 r2
+  shiftl r2 24 r2
+  or r1 r2 r4
+  addr2reg pack_section r12
+  read 0 r12 r5
+  addr2reg pack_file_idx r12
+  read 0 r12 r6
+  savpc r15
+  add r15 12 r15
+  jump out_emit_dw
+  read -16 r14 r1
+  add r1 4 r1
+  jump .L1610
+.L1613:
+  load 0 r1
+  addr2reg pack_len r12
+  write 0 r12 r1
+.L1614:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pack_flush */
+
+.data
+.balign 1
+.Lstring.195:
+	.ascii "pack buffer overflow\000"
+/* end data */
+
+
+.text
+; function pack_append
+pack_append:
+  addr2reg pack_len r12
+  read 0 r12 r1
+  bne r1 r0 .L1619
+  addr2reg pack_section r12
+  write 0 r12 r6
+  addr2reg pack_file_idx r12
+  write 0 r12 r7
+.L1619:
+  load 0 r1
+.L1620:
+  bges r1 r5 .L1626
+  addr2reg pack_len r12
+  read 0 r12 r6
+  load32 262144 r2
+  bges r6 r2 .L1624
+  addr2reg byte_pool r12
+  read 0 r12 r2
+  add r4 r1 r3
+  add r2 r3 r2
+  readbu 0 r2 r2
+  add r6 1 r3
+  addr2reg pack_len r12
+  write 0 r12 r3
+  addr2reg pack_tmp r3
+  add r3 r6 r3
+  writeb 0 r3 r2
+  add r1 1 r1
+  jump .L1620
+.L1624:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.195 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+.L1625:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L1626:
+  jumpr 0 r15
+
+/* end function pack_append */
+
+
+.text
+; function pass_pack_elf
+pass_pack_elf:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  load 0 r1
+  addr2reg out_count r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg pack_len r12
+  write 0 r12 r1
+  load 0 r1
+.L1629:
+  write -16 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r2
+  bges r1 r2 .L1634
+  addr2reg line_kind r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 5 r3
+  beq r2 r3 .L1632
+  savpc r15
+  add r15 12 r15
+  jump pack_flush
+  read -16 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump out_clone_from
+  read -16 r14 r1
+  jump .L1633
+.L1632:
+  addr2reg line_byte_off r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r4
+  addr2reg line_byte_len r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r5
+  addr2reg line_section r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r6
+  or r0 r1 r2
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r7
+  savpc r15
+  add r15 12 r15
+  jump pack_append
+  read -16 r14 r1
+.L1633:
+  add r1 1 r1
+  jump .L1629
+.L1634:
+  savpc r15
+  add r15 12 r15
+  jump pack_flush
+  savpc r15
+  add r15 12 r15
+  jump swap_out_to_in
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pass_pack_elf */
+
+
+.text
+; function pass_remove_meta_and_sort
+pass_remove_meta_and_sort:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  load 0 r1
+  addr2reg out_count r12
+  write 0 r12 r1
+  load 0 r1
+  or r0 r1 r2
+.L1640:
+  write -12 r14 r2
+  load 4 r1
+  bges r2 r1 .L1649
+  load 0 r1
+.L1642:
+  write -16 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r3
+  bges r1 r3 .L1648
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r1 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  bne r3 r2 .L1647
+  addr2reg line_kind r12
+  read 0 r12 r3
+  shiftl r1 2 r4
+  add r3 r4 r4
+  read 0 r4 r4
+  load 7 r5
+  beq r4 r5 .L1647
+  shiftl r1 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  load 8 r4
+  beq r3 r4 .L1647
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump out_clone_from
+  read -16 r14 r1
+  read -12 r14 r2
+.L1647:
+  add r1 1 r1
+  jump .L1642
+.L1648:
+  add r2 1 r2
+  jump .L1640
+.L1649:
+  savpc r15
+  add r15 12 r15
+  jump swap_out_to_in
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pass_remove_meta_and_sort */
+
+
+.text
+; function pass_handle_balign
+pass_handle_balign:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  load 0 r1
+  addr2reg out_count r12
+  write 0 r12 r1
+  load 0 r1
+.L1654:
+  write -16 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r2
+  bges r1 r2 .L1658
+  addr2reg line_kind r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 9 r3
+  beq r2 r3 .L1657
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump out_clone_from
+  read -16 r14 r1
+.L1657:
+  add r1 1 r1
+  jump .L1654
+.L1658:
+  savpc r15
+  add r15 12 r15
+  jump swap_out_to_in
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pass_handle_balign */
+
+
+.text
+; function pass_extract_labels
+pass_extract_labels:
+  load 0 r1
+  addr2reg out_count r12
+  write 0 r12 r1
+  load 0 r2
+  load 0 r1
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r1
+.L1664:
+  write -16 r14 r2
+  addr2reg line_count r12
+  read 0 r12 r1
+  bges r2 r1 .L1671
+  addr2reg line_kind r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  load 2 r3
+  beq r1 r3 .L1667
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump out_clone_from
+  read -16 r14 r2
+  read -12 r14 r1
+  addr2reg line_addr r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg out_addr r12
+  read 0 r12 r3
+  addr2reg out_count r12
+  read 0 r12 r4
+  load 1 r5
+  sub r4 r5 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  add r1 4 r1
+  jump .L1669
+.L1667:
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r4
+  addr2reg line_file_idx r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump add_label
+  or r0 r1 r5
+  read -16 r14 r2
+  read -12 r14 r1
+  blts r5 r0 .L1672
+  addr2reg label_addr r12
+  read 0 r12 r3
+  shiftl r5 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg line_section r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  addr2reg label_sec r12
+  read 0 r12 r4
+  shiftl r5 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+.L1669:
+  add r2 1 r2
+  write -12 r14 r1
+  jump .L1664
+.L1671:
+  savpc r15
+  add r15 12 r15
+  jump swap_out_to_in
+.L1672:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pass_extract_labels */
+
+.data
+.balign 1
+.Lstring.201:
+	.ascii "undefined symbol: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.203:
+	.ascii "too many relocations\000"
+/* end data */
+
+
+.text
+; function label_ref
+label_ref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 76 r13
+  write -68 r14 r8
+  read 12 r14 r2
+  write -60 r14 r2
+  read 8 r14 r1
+  write -12 r14 r1
+  write -28 r14 r7
+  write -64 r14 r6
+  write -32 r14 r5
+  or r0 r4 r5
+  write -52 r14 r5
+  addr2reg assemble_only r12
+  read 0 r12 r1
+  beq r1 r0 .L1702
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump find_label
+  or r0 r1 r4
+  read -60 r14 r2
+  read -28 r14 r1
+  read -64 r14 r3
+  or r0 r3 r6
+  read -32 r14 r3
+  read -52 r14 r5
+  load 0 r7
+  write -8 r14 r7
+  slt r4 r0 r8
+  xor r8 1 r8
+  read -8 r14 r7
+  bne r8 r0 .L1678
+  write -16 r14 r7
+  jump .L1680
+.L1678:
+  addr2reg label_sec r12
+  read 0 r12 r1
+  shiftl r4 2 r7
+  add r1 r7 r1
+  read -12 r14 r7
+  read 0 r1 r1
+  xor r1 r7 r7
+  read -28 r14 r1
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r8
+  write -16 r14 r8
+.L1680:
+  load 0 r7
+  write -20 r14 r7
+  read -16 r14 r8
+  read -20 r14 r7
+  beq r8 r0 .L1684
+  load 1 r7
+  write -24 r14 r7
+  load 3 r7
+  xor r3 r7 r8
+  sltu r8 1 r8
+  read -24 r14 r7
+  bne r8 r0 .L1683
+  xor r3 4 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L1683:
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L1684:
+  bne r7 r0 .L1700
+  blts r4 r0 .L1687
+  write -36 r14 r4
+  or r0 r6 r4
+  jump .L1690
+.L1687:
+  or r0 r5 r1
+  load 0 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump add_label
+  or r0 r1 r5
+  read -60 r14 r2
+  read -28 r14 r1
+  read -64 r14 r3
+  or r0 r3 r4
+  read -32 r14 r3
+  blts r5 r0 .L1699
+  addr2reg label_sec r12
+  read 0 r12 r6
+  shiftl r5 2 r7
+  add r6 r7 r7
+  load 255 r6
+  write 0 r7 r6
+  write -36 r14 r5
+.L1690:
+  addr2reg obj_reloc_count r12
+  read 0 r12 r7
+  load 8192 r5
+  bges r7 r5 .L1697
+  shiftl r1 8 r5
+  or r5 r3 r6
+  write -44 r14 r6
+  read -36 r14 r5
+  addr2reg obj_relocs r12
+  read 0 r12 r6
+  write -40 r14 r6
+  shiftl r7 1 r6
+  add r6 r7 r7
+  read -40 r14 r6
+  shiftl r7 2 r7
+  add r6 r7 r7
+  read -44 r14 r6
+  write 0 r7 r6
+  addr2reg obj_relocs r12
+  read 0 r12 r6
+  write -48 r14 r6
+  addr2reg obj_reloc_count r12
+  read 0 r12 r7
+  shiftl r7 1 r6
+  add r6 r7 r7
+  read -48 r14 r6
+  add r7 1 r7
+  shiftl r7 2 r7
+  add r6 r7 r6
+  write 0 r6 r5
+  addr2reg obj_relocs r12
+  read 0 r12 r5
+  addr2reg obj_reloc_count r12
+  read 0 r12 r7
+  shiftl r7 1 r6
+  add r6 r7 r6
+  add r6 2 r6
+  shiftl r6 2 r6
+  add r5 r6 r5
+  write 0 r5 r4
+  addr2reg obj_reloc_count r12
+  read 0 r12 r4
+  add r4 1 r4
+  addr2reg obj_reloc_count r12
+  write 0 r12 r4
+  load 1 r4
+  load 3 r5
+  beq r3 r5 .L1693
+  xor r3 4 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  jump .L1694
+.L1693:
+  or r0 r4 r3
+.L1694:
+  bne r3 r0 .L1696
+  load 0 r1
+.L1696:
+  write 0 r2 r1
+  load 0 r1
+  jump .L1707
+.L1697:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+  jump .L1707
+.L1699:
+  load32 -1 r1
+  jump .L1707
+.L1700:
+  or r0 r6 r3
+  addr2reg label_addr r12
+  read 0 r12 r1
+  shiftl r4 2 r4
+  add r1 r4 r1
+  read 0 r1 r1
+  add r1 r3 r1
+  write 0 r2 r1
+  load 0 r1
+  jump .L1707
+.L1702:
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump find_label
+  or r0 r1 r4
+  read -60 r14 r2
+  read -64 r14 r3
+  read -52 r14 r5
+  write -56 r14 r4
+  bges r4 r0 .L1704
+  addr2reg .Lstring.201 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  read -56 r14 r4
+  read -60 r14 r2
+  read -64 r14 r3
+.L1704:
+  blts r4 r0 .L1706
+  addr2reg label_addr r12
+  read 0 r12 r1
+  shiftl r4 2 r4
+  add r1 r4 r1
+  read 0 r1 r1
+  add r1 r3 r1
+  write 0 r2 r1
+  load 0 r1
+  jump .L1707
+.L1706:
+  load32 -1 r1
+.L1707:
+  read -68 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function label_ref */
+
+
+.text
+; function add_reloc
+add_reloc:
+  addr2reg reloc_count r12
+  read 0 r12 r3
+  load 8192 r1
+  bges r3 r1 .L1712
+  shiftl r4 8 r1
+  and r5 255 r2
+  or r1 r2 r1
+  addr2reg reloc_entries r12
+  read 0 r12 r2
+  add r3 1 r4
+  addr2reg reloc_count r12
+  write 0 r12 r4
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  jumpr 0 r15
+.L1712:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+.L1713:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function add_reloc */
+
+
+.text
+; function encode_load_label
+encode_load_label:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  or r0 r6 r7
+  write -16 r14 r5
+  addr2reg line_value r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r2
+  write -12 r14 r2
+  addr2reg line_label r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -8 r14 r1
+  bne r5 r0 .L1718
+  load 1 r1
+  jump .L1719
+.L1718:
+  load 2 r1
+.L1719:
+  or r0 r1 r5
+  addr2reg line_label_off r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r6
+  addr2reg line_section r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r4
+  add r14 -20 r3
+  write 0 r4 r3
+  read -8 r14 r4
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump label_ref
+  read -12 r14 r2
+  read -16 r14 r5
+  load32 -16 r3
+  sub r13 r3 r13
+  blts r1 r0 .L1727
+  bne r5 r0 .L1722
+  read -20 r14 r1
+  load32 65535 r3
+  and r1 r3 r3
+  jump .L1723
+.L1722:
+  read -20 r14 r1
+  shiftrs r1 16 r1
+  load32 65535 r3
+  and r1 r3 r3
+.L1723:
+  bne r5 r0 .L1725
+  load 12 r1
+  jump .L1726
+.L1725:
+  load 13 r1
+.L1726:
+  shiftl r1 24 r4
+  load32 268435456 r1
+  or r1 r4 r1
+  shiftl r3 8 r3
+  or r1 r3 r1
+  and r2 15 r3
+  shiftl r3 4 r3
+  or r1 r3 r1
+  and r2 15 r2
+  or r1 r2 r1
+  jump .L1728
+.L1727:
+  load 0 r1
+.L1728:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function encode_load_label */
+
+.data
+.balign 1
+.Lstring.207:
+	.ascii "empty instruction\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.208:
+	.ascii "ccache\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.209:
+	.ascii "ccached\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.210:
+	.ascii "savpc needs 1 arg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.211:
+	.ascii "savpc bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.212:
+	.ascii "readintid\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.213:
+	.ascii "readintid needs 1 arg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.214:
+	.ascii "readintid bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.215:
+	.ascii "read\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.216:
+	.ascii "readb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.217:
+	.ascii "readbu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.218:
+	.ascii "readh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.219:
+	.ascii "readhu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.220:
+	.ascii "read* needs 3 args\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.221:
+	.ascii "read* bad imm\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.222:
+	.ascii "read* bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.223:
+	.ascii "bad read variant\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.224:
+	.ascii "write\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.225:
+	.ascii "writeb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.226:
+	.ascii "writeh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.227:
+	.ascii "write* needs 3 args\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.228:
+	.ascii "write* bad imm\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.229:
+	.ascii "write* bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.230:
+	.ascii "bad write variant\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.231:
+	.ascii "push\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.232:
+	.ascii "push needs 1 arg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.233:
+	.ascii "push bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.234:
+	.ascii "pop\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.235:
+	.ascii "pop needs 1 arg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.236:
+	.ascii "pop bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.237:
+	.ascii "jump needs 1 arg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.238:
+	.ascii "jump bad imm\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.239:
+	.ascii "jumpo needs 1 arg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.240:
+	.ascii "jumpo bad imm\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.241:
+	.ascii "jumpr needs 2 args\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.242:
+	.ascii "jumpr bad imm\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.243:
+	.ascii "jumpr bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.244:
+	.ascii "jumpro needs 2 args\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.245:
+	.ascii "jumpro bad imm\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.246:
+	.ascii "jumpro bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.247:
+	.ascii "branch needs 3 args\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.248:
+	.ascii "branch bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.249:
+	.ascii "branch bad imm\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.250:
+	.ascii "or\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.251:
+	.ascii "and\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.252:
+	.ascii "xor\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.253:
+	.ascii "add\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.254:
+	.ascii "sub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.255:
+	.ascii "shiftl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.256:
+	.ascii "shiftr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.257:
+	.ascii "shiftrs\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.258:
+	.ascii "slt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.259:
+	.ascii "sltu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.260:
+	.ascii "arith needs 3 args: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.261:
+	.ascii "arith bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.262:
+	.ascii "arith bad imm: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.263:
+	.ascii "not\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.264:
+	.ascii "not needs 2 args\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.265:
+	.ascii "not bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.266:
+	.ascii "load\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.267:
+	.ascii "load needs 2 args\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.268:
+	.ascii "load bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.269:
+	.ascii "load bad imm\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.270:
+	.ascii "loadhi\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.271:
+	.ascii "loadhi needs 2 args\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.272:
+	.ascii "loadhi bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.273:
+	.ascii "loadhi bad imm\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.274:
+	.ascii "mults\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.275:
+	.ascii "multu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.276:
+	.ascii "multfp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.277:
+	.ascii "divs\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.278:
+	.ascii "divu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.279:
+	.ascii "divfp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.280:
+	.ascii "mods\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.281:
+	.ascii "modu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.282:
+	.ascii "fmul\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.283:
+	.ascii "fadd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.284:
+	.ascii "fsub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.285:
+	.ascii "fld\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.286:
+	.ascii "fsthi\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.287:
+	.ascii "fstlo\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.288:
+	.ascii "mulshi\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.289:
+	.ascii "multuhi\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.290:
+	.ascii "multi-cycle arith needs 3 args: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.291:
+	.ascii "mc-arith bad reg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.292:
+	.ascii "mc-arith bad imm: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.293:
+	.ascii "unknown instruction: \000"
+/* end data */
+
+
+.text
+; function encode_instr
+encode_instr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 676 r13
+  or r0 r4 r3
+  or r0 r5 r4
+  write -68 r14 r4
+  write -44 r14 r3
+  load 0 r1
+  or r0 r4 r5
+  or r0 r3 r4
+.L1733:
+  addr2reg line_text r12
+  read 0 r12 r2
+  shiftl r4 2 r3
+  add r2 r3 r3
+  read 0 r3 r3
+  add r3 r1 r3
+  readb 0 r3 r6
+  load 0 r3
+  beq r6 r0 .L1735
+  slt r1 511 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L1735:
+  beq r3 r0 .L1737
+  shiftl r4 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 r1 r2
+  readb 0 r2 r2
+  add r14 -668 r3
+  add r3 r1 r3
+  writeb 0 r3 r2
+  add r1 1 r1
+  jump .L1733
+.L1737:
+  add r14 -668 r2
+  add r2 r1 r2
+  load 0 r1
+  writeb 0 r2 r1
+  load 16 r6
+  add r14 -156 r5
+  add r14 -668 r4
+  savpc r15
+  add r15 12 r15
+  jump tokenize
+  write -4 r14 r1
+  or r0 r1 r2
+  bne r1 r0 8
+  jump .L2125
+  add r14 -156 r1
+  add r1 0 r1
+  read 0 r1 r1
+  write -80 r14 r1
+  addr2reg .Lstring.95 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -80 r14 r1
+  bne r2 r0 8
+  jump .L2124
+  addr2reg .Lstring.183 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -80 r14 r1
+  bne r2 r0 8
+  jump .L2123
+  addr2reg .Lstring.208 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -80 r14 r1
+  bne r2 r0 8
+  jump .L2122
+  addr2reg .Lstring.209 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -80 r14 r1
+  bne r2 r0 8
+  jump .L2121
+  addr2reg .Lstring.96 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -80 r14 r1
+  bne r2 r0 8
+  jump .L2120
+  addr2reg .Lstring.163 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  bne r3 r0 8
+  jump .L2112
+  addr2reg .Lstring.212 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  bne r3 r0 8
+  jump .L2104
+  addr2reg .Lstring.215 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  load 1 r3
+  beq r4 r0 .L1747
+  addr2reg .Lstring.216 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+  jump .L1748
+.L1747:
+  or r0 r3 r4
+.L1748:
+  load 1 r3
+  bne r4 r0 .L1750
+  addr2reg .Lstring.217 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+  jump .L1751
+.L1750:
+  or r0 r3 r4
+.L1751:
+  load 1 r3
+  bne r4 r0 .L1753
+  addr2reg .Lstring.218 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+  jump .L1754
+.L1753:
+  or r0 r3 r4
+.L1754:
+  load 1 r3
+  bne r4 r0 .L1756
+  addr2reg .Lstring.219 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L1756:
+  beq r3 r0 8
+  jump .L2066
+  addr2reg .Lstring.224 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  load 1 r3
+  beq r4 r0 .L1759
+  addr2reg .Lstring.225 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+  jump .L1760
+.L1759:
+  or r0 r3 r4
+.L1760:
+  load 1 r3
+  bne r4 r0 .L1762
+  addr2reg .Lstring.226 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L1762:
+  beq r3 r0 8
+  jump .L2043
+  addr2reg .Lstring.231 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  bne r3 r0 8
+  jump .L2035
+  addr2reg .Lstring.234 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  bne r3 r0 8
+  jump .L2027
+  addr2reg .Lstring.91 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r5
+  read -80 r14 r1
+  read -4 r14 r2
+  read -68 r14 r4
+  read -44 r14 r3
+  bne r5 r0 8
+  jump .L2011
+  addr2reg .Lstring.92 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  bne r3 r0 8
+  jump .L2003
+  addr2reg .Lstring.93 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  bne r3 r0 8
+  jump .L1992
+  addr2reg .Lstring.94 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  bne r3 r0 8
+  jump .L1981
+  addr2reg .Lstring.164 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1799
+  addr2reg .Lstring.165 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1796
+  addr2reg .Lstring.166 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1794
+  addr2reg .Lstring.167 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1792
+  addr2reg .Lstring.168 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1790
+  addr2reg .Lstring.169 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1788
+  addr2reg .Lstring.170 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1786
+  addr2reg .Lstring.171 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1784
+  addr2reg .Lstring.172 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1782
+  addr2reg .Lstring.173 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r5
+  read -80 r14 r1
+  read -4 r14 r2
+  load 255 r4
+  load 0 r3
+  beq r5 r0 .L1780
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  jump .L1798
+.L1780:
+  load 6 r4
+  load 1 r3
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  jump .L1798
+.L1782:
+  load 5 r4
+  load 1 r3
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  jump .L1798
+.L1784:
+  load 2 r4
+  load 1 r3
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  jump .L1798
+.L1786:
+  load 1 r4
+  load 1 r3
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  jump .L1798
+.L1788:
+  load 6 r4
+  load 0 r3
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  jump .L1798
+.L1790:
+  load 5 r4
+  load 0 r3
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  jump .L1798
+.L1792:
+  load 2 r4
+  load 0 r3
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  jump .L1798
+.L1794:
+  load 1 r4
+  load 0 r3
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  jump .L1798
+.L1796:
+  load 4 r4
+  load 0 r3
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+.L1798:
+  write -48 r14 r4
+  jump .L1801
+.L1799:
+  load 0 r4
+  load 0 r3
+  write -48 r14 r3
+  or r0 r4 r3
+.L1801:
+  write -60 r14 r3
+  load 255 r4
+  beq r3 r4 8
+  jump .L1954
+  addr2reg .Lstring.250 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1821
+  addr2reg .Lstring.251 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1820
+  addr2reg .Lstring.252 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1819
+  addr2reg .Lstring.253 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1818
+  addr2reg .Lstring.254 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1817
+  addr2reg .Lstring.255 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1816
+  addr2reg .Lstring.256 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1815
+  addr2reg .Lstring.257 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1814
+  addr2reg .Lstring.258 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1813
+  addr2reg .Lstring.259 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r5
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  load32 -1 r4
+  bne r5 r0 .L1822
+  load 11 r4
+  jump .L1822
+.L1813:
+  load 10 r4
+  jump .L1822
+.L1814:
+  load 14 r4
+  jump .L1822
+.L1815:
+  load 6 r4
+  jump .L1822
+.L1816:
+  load 5 r4
+  jump .L1822
+.L1817:
+  load 4 r4
+  jump .L1822
+.L1818:
+  load 3 r4
+  jump .L1822
+.L1819:
+  load 2 r4
+  jump .L1822
+.L1820:
+  load 1 r4
+  jump .L1822
+.L1821:
+  load 0 r4
+.L1822:
+  write -40 r14 r4
+  bges r4 r0 .L1941
+  addr2reg .Lstring.263 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1931
+  addr2reg .Lstring.266 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1908
+  addr2reg .Lstring.270 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -80 r14 r1
+  read -4 r14 r2
+  beq r3 r0 .L1886
+  addr2reg .Lstring.274 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1871
+  addr2reg .Lstring.275 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1869
+  addr2reg .Lstring.276 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1867
+  addr2reg .Lstring.277 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1865
+  addr2reg .Lstring.278 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1863
+  addr2reg .Lstring.279 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1861
+  addr2reg .Lstring.280 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1859
+  addr2reg .Lstring.281 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1857
+  addr2reg .Lstring.282 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1855
+  addr2reg .Lstring.283 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1853
+  addr2reg .Lstring.284 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1851
+  addr2reg .Lstring.285 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1849
+  addr2reg .Lstring.286 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1847
+  addr2reg .Lstring.287 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1845
+  addr2reg .Lstring.288 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -80 r14 r1
+  read -4 r14 r2
+  read -44 r14 r3
+  beq r4 r0 .L1843
+  addr2reg .Lstring.289 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -4 r14 r1
+  read -44 r14 r3
+  load32 -1 r2
+  bne r4 r0 .L1873
+  load 15 r2
+  jump .L1873
+.L1843:
+  or r0 r2 r1
+  load 14 r2
+  jump .L1873
+.L1845:
+  or r0 r2 r1
+  load 13 r2
+  jump .L1873
+.L1847:
+  or r0 r2 r1
+  load 12 r2
+  jump .L1873
+.L1849:
+  or r0 r2 r1
+  load 11 r2
+  jump .L1873
+.L1851:
+  or r0 r2 r1
+  load 10 r2
+  jump .L1873
+.L1853:
+  or r0 r2 r1
+  load 9 r2
+  jump .L1873
+.L1855:
+  or r0 r2 r1
+  load 8 r2
+  jump .L1873
+.L1857:
+  or r0 r2 r1
+  load 7 r2
+  jump .L1873
+.L1859:
+  or r0 r2 r1
+  load 6 r2
+  jump .L1873
+.L1861:
+  or r0 r2 r1
+  load 5 r2
+  jump .L1873
+.L1863:
+  or r0 r2 r1
+  load 4 r2
+  jump .L1873
+.L1865:
+  or r0 r2 r1
+  load 3 r2
+  jump .L1873
+.L1867:
+  or r0 r2 r1
+  load 2 r2
+  jump .L1873
+.L1869:
+  or r0 r2 r1
+  load 1 r2
+  jump .L1873
+.L1871:
+  or r0 r2 r1
+  load 0 r2
+.L1873:
+  write -16 r14 r2
+  bges r2 r0 .L1875
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  addr2reg .Lstring.293 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load 0 r1
+  jump .L2127
+.L1875:
+  load 4 r2
+  bne r1 r2 .L1885
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  write -12 r14 r1
+  add r14 -156 r1
+  add r1 12 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r2
+  read -12 r14 r4
+  write -8 r14 r2
+  load 1 r1
+  blts r4 r0 .L1878
+  slt r2 r0 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1878:
+  bne r1 r0 .L1884
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r3
+  read -16 r14 r1
+  read -8 r14 r2
+  read -12 r14 r4
+  bges r3 r0 .L1883
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  or r0 r1 r5
+  read -16 r14 r1
+  read -8 r14 r2
+  read -12 r14 r4
+  read -44 r14 r3
+  beq r5 r0 .L1882
+  and r1 15 r1
+  shiftl r1 24 r3
+  load32 805306368 r1
+  or r1 r3 r1
+  read -92 r14 r3
+  load32 65535 r5
+  and r3 r5 r3
+  shiftl r3 8 r3
+  or r1 r3 r1
+  and r4 15 r3
+  shiftl r3 4 r3
+  or r1 r3 r1
+  and r2 15 r2
+  or r1 r2 r1
+  jump .L2127
+.L1882:
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  addr2reg .Lstring.292 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load 0 r1
+  jump .L2127
+.L1883:
+  and r1 15 r1
+  shiftl r1 24 r5
+  load32 536870912 r1
+  or r1 r5 r1
+  and r4 15 r4
+  shiftl r4 8 r4
+  or r1 r4 r1
+  and r3 15 r3
+  shiftl r3 4 r3
+  or r1 r3 r1
+  and r2 15 r2
+  or r1 r2 r1
+  jump .L2127
+.L1884:
+  addr2reg .Lstring.291 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load 0 r1
+  jump .L2127
+.L1885:
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  addr2reg .Lstring.290 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load 0 r1
+  jump .L2127
+.L1886:
+  or r0 r2 r1
+  load 3 r2
+  bne r1 r2 .L1906
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r2
+  read -68 r14 r4
+  read -44 r14 r3
+  write -20 r14 r2
+  blts r2 r0 .L1904
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 48 r5
+  bges r2 r5 .L1891
+  or r0 r1 r2
+  jump .L1892
+.L1891:
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r2
+  load 57 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L1892:
+  load 1 r1
+  bne r2 r0 .L1894
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r1
+  xor r1 45 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L1895
+.L1894:
+  or r0 r1 r2
+.L1895:
+  load 1 r1
+  bne r2 r0 .L1897
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r1
+  xor r1 43 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1897:
+  bne r1 r0 .L1901
+  add r14 -156 r1
+  add r1 4 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  addr2reg line_section r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r6
+  add r14 -92 r5
+  write 0 r6 r5
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  load 0 r6
+  load 2 r5
+  savpc r15
+  add r15 12 r15
+  jump label_ref
+  read -20 r14 r2
+  load32 -16 r3
+  sub r13 r3 r13
+  blts r1 r0 .L1900
+  read -92 r14 r1
+  shiftrs r1 16 r1
+  load32 65535 r3
+  and r1 r3 r1
+  write -92 r14 r1
+  jump .L1902
+.L1900:
+  load 0 r1
+  jump .L2127
+.L1901:
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -20 r14 r2
+  beq r1 r0 .L1903
+.L1902:
+  read -92 r14 r1
+  load32 65535 r3
+  and r1 r3 r1
+  shiftl r1 8 r3
+  load32 486539264 r1
+  or r1 r3 r1
+  and r2 15 r3
+  shiftl r3 4 r3
+  or r1 r3 r1
+  and r2 15 r2
+  or r1 r2 r1
+  jump .L2127
+.L1903:
+  addr2reg .Lstring.273 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load 0 r1
+  jump .L2127
+.L1904:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.272 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1906:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.271 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1908:
+  or r0 r2 r1
+  load 3 r2
+  bne r1 r2 .L1929
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r2
+  read -68 r14 r4
+  read -44 r14 r3
+  write -24 r14 r2
+  blts r2 r0 .L1927
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 48 r5
+  bges r2 r5 .L1913
+  or r0 r1 r2
+  jump .L1914
+.L1913:
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r2
+  load 57 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L1914:
+  load 1 r1
+  bne r2 r0 .L1916
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r1
+  xor r1 45 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L1917
+.L1916:
+  or r0 r1 r2
+.L1917:
+  load 1 r1
+  bne r2 r0 .L1919
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r1
+  xor r1 43 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1919:
+  bne r1 r0 .L1923
+  add r14 -156 r1
+  add r1 4 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  addr2reg line_section r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r6
+  add r14 -92 r5
+  write 0 r6 r5
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  load 0 r6
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump label_ref
+  read -68 r14 r4
+  load32 -16 r2
+  sub r13 r2 r13
+  blts r1 r0 .L1922
+  read -92 r14 r1
+  load32 65535 r2
+  and r1 r2 r1
+  write -92 r14 r1
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump add_reloc
+  read -24 r14 r2
+  jump .L1924
+.L1922:
+  load 0 r1
+  jump .L2127
+.L1923:
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -24 r14 r2
+  beq r1 r0 .L1925
+.L1924:
+  read -92 r14 r1
+  load32 65535 r3
+  and r1 r3 r1
+  shiftl r1 8 r3
+  load32 469762048 r1
+  or r1 r3 r1
+  and r2 15 r3
+  shiftl r3 4 r3
+  or r1 r3 r1
+  and r2 15 r2
+  or r1 r2 r1
+  jump .L2127
+.L1925:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.269 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1927:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.268 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1929:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.267 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1931:
+  or r0 r2 r1
+  load 3 r2
+  bne r1 r2 .L1939
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  write -28 r14 r1
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r2
+  read -28 r14 r1
+  load 1 r3
+  blts r1 r0 .L1935
+  slt r2 r0 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L1935:
+  bne r3 r0 .L1937
+  and r1 15 r1
+  shiftl r1 8 r3
+  load32 117440512 r1
+  or r1 r3 r1
+  and r2 15 r2
+  or r1 r2 r1
+  jump .L2127
+.L1937:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.265 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1939:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.264 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1941:
+  or r0 r2 r1
+  load 4 r2
+  bne r1 r2 .L1953
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  write -36 r14 r1
+  add r14 -156 r1
+  add r1 12 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r2
+  read -36 r14 r4
+  write -32 r14 r2
+  load 1 r1
+  blts r4 r0 .L1945
+  slt r2 r0 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1945:
+  bne r1 r0 .L1951
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r3
+  read -40 r14 r1
+  read -32 r14 r2
+  read -36 r14 r4
+  bges r3 r0 .L1950
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  or r0 r1 r5
+  read -40 r14 r1
+  read -32 r14 r2
+  read -36 r14 r4
+  read -44 r14 r3
+  beq r5 r0 .L1949
+  and r1 15 r1
+  shiftl r1 24 r3
+  load32 268435456 r1
+  or r1 r3 r1
+  read -92 r14 r3
+  load32 65535 r5
+  and r3 r5 r3
+  shiftl r3 8 r3
+  or r1 r3 r1
+  and r4 15 r3
+  shiftl r3 4 r3
+  or r1 r3 r1
+  and r2 15 r2
+  or r1 r2 r1
+  jump .L2127
+.L1949:
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  addr2reg .Lstring.262 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load 0 r1
+  jump .L2127
+.L1950:
+  and r1 15 r1
+  shiftl r1 24 r5
+  load 0 r1
+  or r1 r5 r1
+  and r4 15 r4
+  shiftl r4 8 r4
+  or r1 r4 r1
+  and r3 15 r3
+  shiftl r3 4 r3
+  or r1 r3 r1
+  and r2 15 r2
+  or r1 r2 r1
+  jump .L2127
+.L1951:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.261 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1953:
+  addr2reg line_text r12
+  read 0 r12 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  addr2reg .Lstring.260 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load 0 r1
+  jump .L2127
+.L1954:
+  or r0 r2 r1
+  load 4 r2
+  bne r1 r2 .L1979
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  write -56 r14 r1
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r4
+  read -56 r14 r5
+  or r0 r4 r1
+  read -68 r14 r4
+  read -44 r14 r3
+  write -52 r14 r1
+  load 1 r2
+  blts r5 r0 .L1958
+  slt r1 r0 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L1959
+.L1958:
+  or r0 r2 r1
+.L1959:
+  bne r1 r0 .L1977
+  add r14 -156 r1
+  add r1 12 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 48 r5
+  bges r2 r5 .L1962
+  or r0 r1 r2
+  jump .L1963
+.L1962:
+  add r14 -156 r1
+  add r1 12 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r2
+  load 57 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L1963:
+  load 1 r1
+  bne r2 r0 .L1965
+  add r14 -156 r1
+  add r1 12 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r1
+  xor r1 45 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L1966
+.L1965:
+  or r0 r1 r2
+.L1966:
+  load 1 r1
+  bne r2 r0 .L1968
+  add r14 -156 r1
+  add r1 12 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r1
+  xor r1 43 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1968:
+  bne r1 r0 .L1972
+  add r14 -156 r1
+  add r1 12 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  addr2reg line_section r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r6
+  add r14 -84 r5
+  write 0 r6 r5
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  load 0 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump label_ref
+  or r0 r1 r6
+  read -60 r14 r3
+  read -48 r14 r2
+  read -52 r14 r4
+  read -56 r14 r5
+  read -68 r14 r1
+  load32 -16 r7
+  sub r13 r7 r13
+  blts r6 r0 .L1971
+  read -84 r14 r6
+  sub r6 r1 r1
+  jump .L1974
+.L1971:
+  load 0 r1
+  jump .L2127
+.L1972:
+  add r14 -156 r1
+  add r1 12 r1
+  read 0 r1 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  read -60 r14 r3
+  read -48 r14 r2
+  read -52 r14 r4
+  read -56 r14 r5
+  beq r1 r0 .L1975
+  read -92 r14 r1
+.L1974:
+  load32 65535 r6
+  and r1 r6 r1
+  shiftl r1 12 r6
+  load32 1610612736 r1
+  or r1 r6 r1
+  and r5 15 r5
+  shiftl r5 8 r5
+  or r1 r5 r1
+  and r4 15 r4
+  shiftl r4 4 r4
+  or r1 r4 r1
+  and r3 7 r3
+  shiftl r3 1 r3
+  or r1 r3 r1
+  and r2 1 r2
+  or r1 r2 r1
+  jump .L2127
+.L1975:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.249 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1977:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.248 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1979:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.247 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1981:
+  or r0 r2 r1
+  load 3 r2
+  bne r1 r2 .L1990
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  beq r1 r0 .L1988
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r2
+  blts r2 r0 .L1986
+  read -92 r14 r1
+  load32 65535 r3
+  and r1 r3 r1
+  shiftl r1 12 r3
+  load32 -2147483648 r1
+  or r1 r3 r1
+  and r2 15 r2
+  shiftl r2 4 r2
+  or r1 r2 r1
+  or r1 1 r1
+  jump .L2127
+.L1986:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.246 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1988:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.245 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1990:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.244 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1992:
+  or r0 r2 r1
+  load 3 r2
+  bne r1 r2 .L2001
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  beq r1 r0 .L1999
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r2
+  blts r2 r0 .L1997
+  read -92 r14 r1
+  load32 65535 r3
+  and r1 r3 r1
+  shiftl r1 12 r3
+  load32 -2147483648 r1
+  or r1 r3 r1
+  and r2 15 r2
+  shiftl r2 4 r2
+  or r1 r2 r1
+  jump .L2127
+.L1997:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.243 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L1999:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.242 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2001:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.241 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2003:
+  or r0 r2 r1
+  load 2 r2
+  bne r1 r2 .L2009
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  beq r1 r0 .L2007
+  read -92 r14 r1
+  load32 134217727 r2
+  and r1 r2 r1
+  shiftl r1 1 r2
+  load32 -1879048192 r1
+  or r1 r2 r1
+  or r1 1 r1
+  jump .L2127
+.L2007:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.240 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2009:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.239 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2011:
+  or r0 r2 r1
+  addr2reg line_flags r12
+  read 0 r12 r2
+  shiftl r3 2 r5
+  add r2 r5 r2
+  read 0 r2 r2
+  and r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  write -64 r14 r2
+  load 2 r2
+  bne r1 r2 .L2025
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r2
+  load 0 r1
+  load 48 r5
+  blts r2 r5 .L2015
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r2
+  load 57 r1
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2015:
+  bne r1 r0 .L2021
+  add r14 -156 r1
+  add r1 4 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  addr2reg line_section r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r6
+  add r14 -88 r5
+  write 0 r6 r5
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  load 0 r6
+  load 3 r5
+  savpc r15
+  add r15 12 r15
+  jump label_ref
+  or r0 r1 r2
+  read -64 r14 r1
+  read -68 r14 r4
+  load32 -16 r3
+  sub r13 r3 r13
+  blts r2 r0 .L2020
+  bne r1 r0 .L2019
+  read -88 r14 r1
+  sub r1 r4 r1
+  load32 134217727 r2
+  and r1 r2 r1
+  shiftl r1 1 r2
+  load32 -1879048192 r1
+  or r1 r2 r1
+  or r1 1 r1
+  jump .L2127
+.L2019:
+  load 2 r5
+  savpc r15
+  add r15 12 r15
+  jump add_reloc
+  read -88 r14 r1
+  load32 134217727 r2
+  and r1 r2 r1
+  shiftl r1 1 r2
+  load32 -1879048192 r1
+  or r1 r2 r1
+  jump .L2127
+.L2020:
+  load 0 r1
+  jump .L2127
+.L2021:
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  beq r1 r0 .L2023
+  read -92 r14 r1
+  load32 134217727 r2
+  and r1 r2 r1
+  shiftl r1 1 r2
+  load32 -1879048192 r1
+  or r1 r2 r1
+  jump .L2127
+.L2023:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.238 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2025:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.237 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2027:
+  or r0 r2 r1
+  load 2 r2
+  bne r1 r2 .L2033
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  blts r1 r0 .L2031
+  and r1 15 r2
+  load32 -1610612736 r1
+  or r1 r2 r1
+  jump .L2127
+.L2031:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.236 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2033:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.235 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2035:
+  or r0 r2 r1
+  load 2 r2
+  bne r1 r2 .L2041
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  blts r1 r0 .L2039
+  and r1 15 r1
+  shiftl r1 4 r2
+  load32 -1342177280 r1
+  or r1 r2 r1
+  jump .L2127
+.L2039:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.233 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2041:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.232 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2043:
+  or r0 r2 r1
+  load 4 r2
+  bne r1 r2 .L2064
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  beq r1 r0 .L2062
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  write -72 r14 r1
+  add r14 -156 r1
+  add r1 12 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r3
+  read -72 r14 r4
+  read -80 r14 r1
+  load 1 r2
+  blts r4 r0 .L2048
+  slt r3 r0 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L2048:
+  bne r2 r0 .L2060
+  add r1 5 r2
+  readb 0 r2 r2
+  beq r2 r0 .L2057
+  add r1 5 r2
+  readb 0 r2 r2
+  load 98 r5
+  beq r2 r5 .L2055
+  add r1 5 r1
+  readb 0 r1 r1
+  load 104 r2
+  beq r1 r2 .L2054
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.230 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2054:
+  load 2 r1
+  jump .L2056
+.L2055:
+  load 1 r1
+.L2056:
+  or r0 r1 r2
+  jump .L2059
+.L2057:
+  load 0 r1
+  or r0 r1 r2
+.L2059:
+  read -92 r14 r1
+  load32 65535 r5
+  and r1 r5 r1
+  shiftl r1 12 r5
+  load32 -805306368 r1
+  or r1 r5 r1
+  and r4 15 r4
+  shiftl r4 8 r4
+  or r1 r4 r1
+  and r3 15 r3
+  shiftl r3 4 r3
+  or r1 r3 r1
+  or r1 r2 r1
+  jump .L2127
+.L2060:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.229 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2062:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.228 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2064:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.227 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2066:
+  or r0 r2 r1
+  load 4 r2
+  bne r1 r2 .L2102
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -92 r5
+  savpc r15
+  add r15 12 r15
+  jump parse_number
+  beq r1 r0 .L2100
+  add r14 -156 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  write -76 r14 r1
+  add r14 -156 r1
+  add r1 12 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  or r0 r1 r2
+  read -76 r14 r4
+  read -80 r14 r1
+  load 1 r3
+  blts r4 r0 .L2071
+  slt r2 r0 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L2071:
+  bne r3 r0 .L2098
+  add r1 4 r3
+  readb 0 r3 r3
+  beq r3 r0 .L2095
+  add r1 4 r3
+  readb 0 r3 r5
+  load 0 r3
+  load 98 r6
+  bne r5 r6 .L2075
+  add r1 5 r3
+  readb 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L2075:
+  bne r3 r0 .L2093
+  add r1 4 r3
+  readb 0 r3 r5
+  load 0 r3
+  load 98 r6
+  bne r5 r6 .L2078
+  add r1 5 r3
+  readb 0 r3 r3
+  xor r3 117 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L2078:
+  bne r3 r0 .L2091
+  add r1 4 r3
+  readb 0 r3 r5
+  load 0 r3
+  load 104 r6
+  bne r5 r6 .L2081
+  add r1 5 r3
+  readb 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L2081:
+  bne r3 r0 .L2089
+  add r1 4 r3
+  readb 0 r3 r5
+  load 0 r3
+  load 104 r6
+  beq r5 r6 .L2084
+  or r0 r3 r1
+  jump .L2085
+.L2084:
+  add r1 5 r1
+  readb 0 r1 r1
+  xor r1 117 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2085:
+  bne r1 r0 .L2088
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.223 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2088:
+  load 6 r1
+  jump .L2090
+.L2089:
+  load 2 r1
+.L2090:
+  or r0 r1 r3
+  jump .L2097
+.L2091:
+  load 5 r1
+  or r0 r1 r3
+  jump .L2097
+.L2093:
+  load 1 r1
+  or r0 r1 r3
+  jump .L2097
+.L2095:
+  load 0 r1
+  or r0 r1 r3
+.L2097:
+  read -92 r14 r1
+  load32 65535 r5
+  and r1 r5 r1
+  shiftl r1 12 r5
+  load32 -536870912 r1
+  or r1 r5 r1
+  and r4 15 r4
+  shiftl r4 8 r4
+  or r1 r4 r1
+  shiftl r3 4 r3
+  or r1 r3 r1
+  and r2 15 r2
+  or r1 r2 r1
+  jump .L2127
+.L2098:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.222 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2100:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.221 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2102:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.220 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2104:
+  or r0 r2 r1
+  load 2 r2
+  bne r1 r2 .L2110
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  blts r1 r0 .L2108
+  and r1 15 r2
+  load32 -1073741824 r1
+  or r1 r2 r1
+  jump .L2127
+.L2108:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.214 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2110:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.213 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2112:
+  or r0 r2 r1
+  load 2 r2
+  bne r1 r2 .L2118
+  add r14 -156 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_register
+  blts r1 r0 .L2116
+  and r1 15 r2
+  load32 1342177280 r1
+  or r1 r2 r1
+  jump .L2127
+.L2116:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.211 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2118:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.210 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2127
+.L2120:
+  load32 1073741824 r1
+  jump .L2127
+.L2121:
+  load32 1879048193 r1
+  jump .L2127
+.L2122:
+  load32 1879048192 r1
+  jump .L2127
+.L2123:
+  load 0 r1
+  jump .L2127
+.L2124:
+  load32 -1 r1
+  jump .L2127
+.L2125:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.207 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+.L2127:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function encode_instr */
+
+.data
+.balign 1
+.Lstring.295:
+	.ascii "internal: unhandled line kind in encode pass\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.296:
+	.ascii "output too large\000"
+/* end data */
+
+
+.text
+; function pass_encode
+pass_encode:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  load 0 r1
+  addr2reg output_count r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg reloc_count r12
+  write 0 r12 r1
+  load 0 r2
+  load 0 r1
+.L2131:
+  write -16 r14 r2
+  write -12 r14 r1
+  addr2reg line_count r12
+  read 0 r12 r3
+  bges r2 r3 .L2148
+  addr2reg line_kind r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  load 1 r4
+  sub r3 r4 r3
+  load 13 r4
+  bge r3 r4 .L2147
+  shiftl r3 2 r4
+  addr2reg .Ljt2134 r3
+  add r3 r4 r3
+  read 0 r3 r3
+  jumpr 0 r3
+.L2135:
+  or r0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump encode_instr
+  or r0 r1 r3
+  read -16 r14 r2
+  read -12 r14 r1
+  jump .L2143
+.L2136:
+  addr2reg line_value r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  jump .L2143
+.L2137:
+  addr2reg line_label r12
+  read 0 r12 r3
+  shiftl r2 2 r4
+  add r3 r4 r3
+  read 0 r3 r4
+  addr2reg line_label_off r12
+  read 0 r12 r3
+  shiftl r2 2 r5
+  add r3 r5 r3
+  read 0 r3 r6
+  or r0 r2 r3
+  addr2reg line_section r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r7
+  add r14 -20 r5
+  write 0 r7 r5
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump label_ref
+  or r0 r1 r3
+  read -16 r14 r2
+  read -12 r14 r1
+  load32 -16 r4
+  sub r13 r4 r13
+  blts r3 r0 .L2139
+  read -20 r14 r3
+  write -4 r14 r3
+  load 0 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump add_reloc
+  read -16 r14 r2
+  read -12 r14 r1
+  read -4 r14 r3
+  jump .L2143
+.L2139:
+  load 1 r3
+  addr2reg has_error r12
+  write 0 r12 r3
+  load 0 r3
+  jump .L2143
+.L2140:
+  or r0 r1 r6
+  load 0 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump encode_load_label
+  or r0 r1 r3
+  read -16 r14 r2
+  read -12 r14 r1
+  write -8 r14 r3
+  addr2reg line_flags r12
+  read 0 r12 r4
+  shiftl r2 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  and r4 2 r4
+  beq r4 r0 .L2143
+  load 1 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump add_reloc
+  read -16 r14 r2
+  read -12 r14 r1
+  read -8 r14 r3
+  jump .L2143
+.L2142:
+  or r0 r1 r6
+  load 1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump encode_load_label
+  or r0 r1 r3
+  read -16 r14 r2
+  read -12 r14 r1
+.L2143:
+  addr2reg output_count r12
+  read 0 r12 r5
+  load32 262144 r4
+  bges r5 r4 .L2146
+  addr2reg output_words r12
+  read 0 r12 r4
+  add r5 1 r6
+  addr2reg output_count r12
+  write 0 r12 r6
+  shiftl r5 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  add r1 4 r1
+  addr2reg has_error r12
+  read 0 r12 r3
+  bne r3 r0 .L2152
+  add r2 1 r2
+  jump .L2131
+.L2146:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.296 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  jump .L2152
+.L2147:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.295 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  jump .L2152
+.L2148:
+  addr2reg assemble_only r12
+  read 0 r12 r2
+  load 0 r1
+  bne r2 r0 .L2150
+  addr2reg output_count r12
+  read 0 r12 r1
+  slt r1 3 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2150:
+  beq r1 r0 .L2152
+  addr2reg output_count r12
+  read 0 r12 r1
+  addr2reg output_words r12
+  read 0 r12 r2
+  add r2 8 r2
+  write 0 r2 r1
+.L2152:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt2134:
+  .int .L2135
+  .int .L2147
+  .int .L2136
+  .int .L2137
+  .int .L2147
+  .int .L2137
+  .int .L2147
+  .int .L2147
+  .int .L2147
+  .int .L2147
+  .int .L2147
+  .int .L2140
+  .int .L2142
+
+/* end function pass_encode */
+
+.data
+.balign 1
+.Lstring.298:
+	.ascii "output too large for reloc table\000"
+/* end data */
+
+
+.text
+; function pass_append_reloc
+pass_append_reloc:
+  addr2reg reloc_count r12
+  read 0 r12 r1
+  beq r1 r0 .L2163
+  addr2reg output_count r12
+  read 0 r12 r3
+  add r3 1 r2
+  add r2 r1 r2
+  load32 262144 r4
+  bgts r2 r4 .L2161
+  addr2reg output_words r12
+  read 0 r12 r2
+  add r3 1 r4
+  addr2reg output_count r12
+  write 0 r12 r4
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  load 0 r1
+.L2158:
+  addr2reg reloc_count r12
+  read 0 r12 r2
+  bges r1 r2 .L2163
+  addr2reg reloc_entries r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  addr2reg output_words r12
+  read 0 r12 r3
+  addr2reg output_count r12
+  read 0 r12 r4
+  add r4 1 r5
+  addr2reg output_count r12
+  write 0 r12 r5
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L2158
+.L2161:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.298 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+.L2162:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L2163:
+  jumpr 0 r15
+
+/* end function pass_append_reloc */
+
+.data
+.balign 1
+.Lstring.300:
+	.ascii "cannot open output: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.301:
+	.ascii "write failed\000"
+/* end data */
+
+
+.text
+; function write_words
+write_words:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -12 r14 r6
+  write -20 r14 r5
+  or r0 r4 r5
+  write -16 r14 r5
+  or r0 r5 r1
+  load 26 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_open
+  or r0 r1 r4
+  read -12 r14 r6
+  read -20 r14 r5
+  read -16 r14 r1
+  write -32 r14 r4
+  blts r4 r0 .L2179
+  load 0 r1
+  or r0 r4 r2
+.L2169:
+  write -24 r14 r1
+  write -28 r14 r6
+  bles r6 r0 .L2177
+  load 256 r3
+  bles r6 r3 .L2173
+  load 256 r3
+  or r0 r3 r6
+.L2173:
+  shiftl r1 2 r1
+  add r5 r1 r5
+  shiftl r6 2 r6
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_write
+  or r0 r1 r3
+  read -24 r14 r1
+  read -28 r14 r6
+  read -32 r14 r2
+  read -20 r14 r5
+  shiftrs r3 31 r4
+  shiftr r4 30 r4
+  add r3 r4 r3
+  shiftrs r3 2 r3
+  bles r3 r0 .L2175
+  add r1 r3 r1
+  sub r6 r3 r6
+  jump .L2169
+.L2175:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.301 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -32 r14 r4
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  load32 -1 r1
+  jump .L2181
+.L2177:
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  read -24 r14 r1
+  jump .L2181
+.L2179:
+  or r0 r1 r5
+  addr2reg .Lstring.300 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+.L2181:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function write_words */
+
+
+.text
+; function obj_section_words
+obj_section_words:
+  load 0 r1
+.L2185:
+  load 4 r2
+  bges r1 r2 .L2188
+  shiftl r1 2 r2
+  add r4 r2 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L2185
+.L2188:
+  load 0 r1
+.L2189:
+  addr2reg line_count r12
+  read 0 r12 r2
+  bges r1 r2 .L2192
+  addr2reg line_section r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r4 r2 r3
+  read 0 r3 r2
+  add r2 1 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L2189
+.L2192:
+  jumpr 0 r15
+
+/* end function obj_section_words */
+
+.data
+.balign 1
+.Lstring.305:
+	.ascii "OOM writing object\000"
+/* end data */
+
+
+.text
+; function build_object
+build_object:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 88 r13
+  write -64 r14 r4
+  add r14 -80 r4
+  savpc r15
+  add r15 12 r15
+  jump obj_section_words
+  load 0 r2
+  load 0 r1
+  write -56 r14 r2
+  or r0 r1 r2
+.L2197:
+  write -60 r14 r2
+  addr2reg label_count r12
+  read 0 r12 r1
+  bges r2 r1 .L2201
+  addr2reg label_names r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r3
+  read -56 r14 r1
+  read -60 r14 r2
+  add r3 1 r3
+  add r1 r3 r1
+  add r2 1 r2
+  write -56 r14 r1
+  jump .L2197
+.L2201:
+  or r0 r1 r2
+  read -56 r14 r1
+  add r1 3 r1
+  shiftrs r1 31 r3
+  shiftr r3 30 r3
+  add r1 r3 r1
+  shiftrs r1 2 r3
+  write -16 r14 r3
+  addr2reg output_count r12
+  read 0 r12 r4
+  load 8 r1
+  add r1 r4 r1
+  shiftl r2 1 r4
+  add r4 r2 r2
+  add r1 r2 r1
+  addr2reg obj_reloc_count r12
+  read 0 r12 r4
+  shiftl r4 1 r2
+  add r2 r4 r2
+  add r1 r2 r1
+  add r1 r3 r5
+  write -52 r14 r5
+  shiftl r5 2 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  read -52 r14 r5
+  read -16 r14 r3
+  read -64 r14 r4
+  write -48 r14 r1
+  beq r1 r0 .L2238
+  add r1 0 r6
+  load32 1328689986 r2
+  write 0 r6 r2
+  load 0 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L2205:
+  load 4 r6
+  bges r1 r6 .L2208
+  shiftl r1 2 r7
+  add r14 -80 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  load 1 r7
+  add r7 r1 r7
+  shiftl r7 2 r7
+  add r2 r7 r7
+  write 0 r7 r6
+  add r1 1 r1
+  jump .L2205
+.L2208:
+  or r0 r2 r1
+  addr2reg label_count r12
+  read 0 r12 r2
+  add r1 20 r4
+  write 0 r4 r2
+  addr2reg obj_reloc_count r12
+  read 0 r12 r2
+  add r1 24 r4
+  write 0 r4 r2
+  add r1 28 r2
+  write 0 r2 r3
+  or r0 r1 r2
+  add r1 32 r1
+  load 0 r4
+.L2210:
+  addr2reg output_count r12
+  read 0 r12 r6
+  bges r4 r6 .L2213
+  addr2reg output_words r12
+  read 0 r12 r6
+  shiftl r4 2 r7
+  add r6 r7 r6
+  read 0 r6 r7
+  or r0 r1 r6
+  add r1 4 r1
+  write 0 r6 r7
+  add r4 1 r4
+  jump .L2210
+.L2213:
+  addr2reg label_count r12
+  read 0 r12 r5
+  shiftl r5 1 r4
+  add r4 r5 r4
+  shiftl r4 2 r4
+  add r1 r4 r4
+  addr2reg obj_reloc_count r12
+  read 0 r12 r6
+  shiftl r6 1 r5
+  add r5 r6 r5
+  shiftl r5 2 r5
+  add r4 r5 r4
+  write -36 r14 r4
+  load 0 r5
+.L2214:
+  bges r5 r3 .L2217
+  shiftl r5 2 r6
+  add r4 r6 r7
+  load 0 r6
+  write 0 r7 r6
+  add r5 1 r5
+  jump .L2214
+.L2217:
+  load 0 r3
+  load 0 r2
+.L2218:
+  write -44 r14 r3
+  write -40 r14 r2
+  addr2reg label_count r12
+  read 0 r12 r5
+  bges r3 r5 .L2231
+  or r0 r1 r6
+  addr2reg label_names r12
+  read 0 r12 r1
+  shiftl r3 2 r5
+  add r1 r5 r1
+  read 0 r1 r1
+  write -28 r14 r1
+  addr2reg label_global r12
+  read 0 r12 r5
+  shiftl r3 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  bne r5 r0 .L2225
+  add r1 0 r5
+  readb 0 r5 r5
+  load 0 r7
+  write -20 r14 r7
+  load 46 r7
+  xor r5 r7 r7
+  sltu r7 1 r7
+  read -20 r14 r5
+  beq r7 r0 .L2222
+  add r1 1 r5
+  readb 0 r5 r5
+  xor r5 76 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L2222:
+  bne r5 r0 .L2224
+  load 1 r5
+  jump .L2226
+.L2224:
+  load 0 r5
+  jump .L2226
+.L2225:
+  load 2 r5
+.L2226:
+  add r6 4 r7
+  write 0 r6 r2
+  shiftl r5 8 r5
+  write -24 r14 r5
+  addr2reg label_sec r12
+  read 0 r12 r5
+  shiftl r3 2 r6
+  add r5 r6 r6
+  read -24 r14 r5
+  read 0 r6 r6
+  and r6 255 r6
+  or r5 r6 r6
+  add r7 4 r5
+  write 0 r7 r6
+  addr2reg label_sec r12
+  read 0 r12 r6
+  shiftl r3 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  load 255 r7
+  beq r6 r7 .L2228
+  or r0 r3 r6
+  addr2reg label_addr r12
+  read 0 r12 r3
+  shiftl r6 2 r6
+  add r3 r6 r3
+  read 0 r3 r3
+  jump .L2229
+.L2228:
+  load 0 r3
+.L2229:
+  add r5 4 r6
+  write -32 r14 r6
+  write 0 r5 r3
+  add r4 r2 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -44 r14 r3
+  read -40 r14 r2
+  read -32 r14 r1
+  read -36 r14 r4
+  add r5 1 r5
+  add r2 r5 r2
+  add r3 1 r3
+  jump .L2218
+.L2231:
+  read -48 r14 r2
+  read -52 r14 r5
+  read -64 r14 r4
+  load 0 r3
+.L2233:
+  addr2reg obj_reloc_count r12
+  read 0 r12 r7
+  shiftl r7 1 r6
+  add r6 r7 r6
+  bges r3 r6 .L2236
+  addr2reg obj_relocs r12
+  read 0 r12 r6
+  shiftl r3 2 r7
+  add r6 r7 r6
+  read 0 r6 r7
+  or r0 r1 r6
+  add r1 4 r1
+  write 0 r6 r7
+  add r3 1 r3
+  jump .L2233
+.L2236:
+  or r0 r2 r1
+  write 0 r4 r5
+  jump .L2240
+.L2238:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.305 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 0 r1
+.L2240:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function build_object */
+
+
+.text
+; function write_object
+write_object:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r4
+  add r14 -20 r4
+  savpc r15
+  add r15 12 r15
+  jump build_object
+  or r0 r1 r5
+  read -16 r14 r4
+  beq r5 r0 .L2245
+  read -20 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump write_words
+  jump .L2246
+.L2245:
+  load32 -1 r1
+.L2246:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function write_object */
+
+.data
+.balign 1
+.Lstring.308:
+	.ascii "not an object file: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.309:
+	.ascii "truncated object file: \000"
+/* end data */
+
+
+.text
+; function obj_open
+obj_open:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r5 r1
+  write -12 r14 r7
+  write -8 r14 r6
+  write -16 r14 r1
+  write 0 r4 r1
+  load 1 r2
+  load 8 r3
+  blts r7 r3 .L2251
+  add r6 0 r2
+  read 0 r2 r2
+  load32 1328689986 r3
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L2251:
+  bne r2 r0 .L2261
+  load 0 r3
+  load 0 r2
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L2254:
+  load 4 r5
+  bges r3 r5 .L2257
+  load 1 r5
+  add r5 r3 r5
+  shiftl r5 2 r5
+  add r6 r5 r5
+  read 0 r5 r5
+  add r4 44 r6
+  shiftl r3 2 r7
+  add r6 r7 r7
+  read -8 r14 r6
+  write 0 r7 r5
+  add r4 28 r5
+  shiftl r3 2 r7
+  add r5 r7 r5
+  write 0 r5 r1
+  add r4 44 r5
+  shiftl r3 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  shiftl r5 2 r5
+  add r1 r5 r1
+  add r4 44 r5
+  shiftl r3 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  add r2 r5 r2
+  add r3 1 r3
+  jump .L2254
+.L2257:
+  add r6 20 r1
+  read 0 r1 r5
+  add r4 20 r1
+  write 0 r1 r5
+  add r6 24 r1
+  read 0 r1 r3
+  add r4 24 r1
+  write 0 r1 r3
+  add r6 28 r1
+  read 0 r1 r7
+  write -4 r14 r7
+  load 8 r1
+  add r1 r2 r1
+  shiftl r5 1 r7
+  add r7 r5 r7
+  add r1 r7 r1
+  shiftl r3 1 r7
+  add r7 r3 r7
+  add r1 r7 r1
+  read -4 r14 r7
+  add r1 r7 r1
+  read -12 r14 r7
+  slt r7 r1 r7
+  read -16 r14 r1
+  bne r7 r0 .L2259
+  add r6 32 r1
+  add r4 4 r6
+  write 0 r6 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  add r4 8 r2
+  write 0 r2 r1
+  shiftl r5 1 r2
+  add r2 r5 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  add r4 12 r2
+  write 0 r2 r1
+  shiftl r3 1 r2
+  add r2 r3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  add r4 16 r2
+  write 0 r2 r1
+  load 0 r1
+  jump .L2263
+.L2259:
+  or r0 r1 r5
+  addr2reg .Lstring.309 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+  jump .L2263
+.L2261:
+  or r0 r1 r5
+  addr2reg .Lstring.308 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+.L2263:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function obj_open */
+
+.data
+.balign 1
+.Lstring.311:
+	.ascii "too many objects\000"
+/* end data */
+
+
+.text
+; function link_add_object
+link_add_object:
+  or r0 r6 r7
+  or r0 r5 r6
+  or r0 r4 r5
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  addr2reg link_obj_count r12
+  read 0 r12 r1
+  load 128 r2
+  bges r1 r2 .L2289
+  load 76 r2
+  mults r1 r2 r2
+  addr2reg link_objs r1
+  add r1 r2 r1
+  write -28 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump obj_open
+  or r0 r1 r2
+  read -28 r14 r1
+  blts r2 r0 .L2288
+  load 0 r2
+.L2269:
+  write -32 r14 r2
+  add r1 20 r3
+  read 0 r3 r3
+  bges r2 r3 .L2287
+  add r1 16 r3
+  read 0 r3 r3
+  add r1 8 r4
+  read 0 r4 r4
+  shiftl r2 1 r5
+  add r5 r2 r5
+  shiftl r5 2 r5
+  add r4 r5 r5
+  read 0 r5 r5
+  add r3 r5 r7
+  write -20 r14 r7
+  shiftl r2 1 r3
+  add r3 r2 r3
+  add r3 1 r3
+  shiftl r3 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+  shiftr r3 8 r3
+  write -24 r14 r3
+  shiftl r2 1 r5
+  add r5 r2 r5
+  add r5 1 r5
+  shiftl r5 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  and r4 255 r5
+  write -16 r14 r5
+  beq r3 r0 .L2286
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -20 r14 r7
+  load 1 r6
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r4
+  read -32 r14 r2
+  read -16 r14 r5
+  read -24 r14 r3
+  read -20 r14 r7
+  read -28 r14 r1
+  blts r4 r0 .L2285
+  load 255 r6
+  beq r5 r6 .L2284
+  addr2reg sym_def_file r12
+  read 0 r12 r6
+  shiftl r4 2 r5
+  add r6 r5 r5
+  read 0 r5 r5
+  blts r5 r0 .L2281
+  load 1 r5
+  load 2 r6
+  beq r3 r6 .L2277
+  addr2reg sym_flags r12
+  read 0 r12 r5
+  shiftl r4 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  and r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L2277:
+  bne r5 r0 .L2279
+  addr2reg sym_flags r12
+  read 0 r12 r5
+  shiftl r4 2 r6
+  add r5 r6 r6
+  read 0 r6 r5
+  or r5 2 r5
+  write 0 r6 r5
+  jump .L2282
+.L2279:
+  or r0 r7 r5
+  addr2reg .Lstring.35 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+  jump .L2291
+.L2281:
+  addr2reg link_obj_count r12
+  read 0 r12 r5
+  shiftl r4 2 r7
+  add r6 r7 r6
+  write 0 r6 r5
+  addr2reg sym_label r12
+  read 0 r12 r5
+  shiftl r4 2 r6
+  add r5 r6 r5
+  write 0 r5 r2
+.L2282:
+  load 2 r5
+  bne r3 r5 .L2286
+  addr2reg sym_flags r12
+  read 0 r12 r3
+  shiftl r4 2 r4
+  add r3 r4 r4
+  read 0 r4 r3
+  or r3 1 r3
+  write 0 r4 r3
+  jump .L2286
+.L2284:
+  addr2reg sym_flags r12
+  read 0 r12 r3
+  shiftl r4 2 r4
+  add r3 r4 r4
+  read 0 r4 r3
+  or r3 4 r3
+  write 0 r4 r3
+  jump .L2286
+.L2285:
+  load32 -1 r1
+  jump .L2291
+.L2286:
+  add r2 1 r2
+  jump .L2269
+.L2287:
+  addr2reg link_obj_count r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg link_obj_count r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2291
+.L2288:
+  load32 -1 r1
+  jump .L2291
+.L2289:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.311 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+.L2291:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function link_add_object */
+
+
+.text
+; function read_words_at
+read_words_at:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r7
+  write -4 r14 r6
+  write -8 r14 r4
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump sys_lseek
+  read -12 r14 r7
+  read -4 r14 r6
+  read -8 r14 r4
+  blts r1 r0 .L2304
+  load 0 r1
+.L2296:
+  write -16 r14 r1
+  bges r1 r7 .L2303
+  sub r7 r1 r2
+  load 256 r3
+  bgts r2 r3 .L2299
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L2300
+.L2299:
+  or r0 r1 r2
+  load 256 r1
+.L2300:
+  shiftl r2 2 r2
+  add r6 r2 r5
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump sys_read
+  or r0 r1 r2
+  read -16 r14 r1
+  read -12 r14 r7
+  read -4 r14 r6
+  read -8 r14 r4
+  add r2 3 r2
+  shiftrs r2 31 r3
+  shiftr r3 30 r3
+  add r2 r3 r2
+  shiftrs r2 2 r2
+  bles r2 r0 .L2302
+  add r1 r2 r1
+  jump .L2296
+.L2302:
+  load32 -1 r1
+  jump .L2305
+.L2303:
+  load 0 r1
+  jump .L2305
+.L2304:
+  load32 -1 r1
+.L2305:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function read_words_at */
+
+.data
+.balign 1
+.Lstring.314:
+	.ascii "too many archives\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.315:
+	.ascii "not an archive: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.316:
+	.ascii "OOM reading archive\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.317:
+	.ascii "truncated archive: \000"
+/* end data */
+
+
+.text
+; function link_add_archive
+link_add_archive:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  or r0 r4 r5
+  write -12 r14 r5
+  addr2reg link_arc_count r12
+  read 0 r12 r1
+  load 8 r2
+  bges r1 r2 .L2328
+  shiftl r1 5 r2
+  addr2reg link_arcs r1
+  add r1 r2 r1
+  write -16 r14 r1
+  write 0 r1 r5
+  or r0 r5 r1
+  load 1 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_open
+  or r0 r1 r4
+  read -16 r14 r1
+  read -12 r14 r5
+  add r1 4 r2
+  write 0 r2 r4
+  blts r4 r0 .L2327
+  load 4 r7
+  add r14 -32 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump read_words_at
+  or r0 r1 r3
+  read -16 r14 r1
+  read -12 r14 r5
+  load 1 r2
+  blts r3 r0 .L2312
+  add r14 -32 r2
+  add r2 0 r2
+  read 0 r2 r2
+  load32 1093808962 r3
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L2312:
+  bne r2 r0 .L2326
+  add r14 -32 r2
+  add r2 4 r2
+  read 0 r2 r3
+  add r1 20 r2
+  write 0 r2 r3
+  add r14 -32 r2
+  add r2 8 r2
+  read 0 r2 r2
+  add r1 24 r1
+  write 0 r1 r2
+  shiftl r3 1 r1
+  add r1 r3 r1
+  shiftl r2 1 r2
+  add r1 r2 r1
+  add r14 -32 r2
+  add r2 12 r2
+  read 0 r2 r2
+  add r1 r2 r7
+  write -8 r14 r7
+  add r7 1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  or r0 r1 r2
+  read -16 r14 r1
+  add r1 8 r3
+  write 0 r3 r2
+  add r1 20 r1
+  read 0 r1 r1
+  add r1 1 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  or r0 r1 r2
+  read -8 r14 r7
+  read -16 r14 r1
+  add r1 28 r3
+  write 0 r3 r2
+  add r1 8 r3
+  read 0 r3 r6
+  load 1 r3
+  beq r6 r0 .L2315
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L2316
+.L2315:
+  or r0 r3 r2
+.L2316:
+  bne r2 r0 .L2324
+  add r1 4 r1
+  read 0 r1 r4
+  load 16 r5
+  savpc r15
+  add r15 12 r15
+  jump read_words_at
+  or r0 r1 r2
+  read -16 r14 r1
+  read -12 r14 r5
+  blts r2 r0 .L2323
+  add r1 8 r2
+  read 0 r2 r2
+  add r1 20 r3
+  read 0 r3 r4
+  shiftl r4 1 r3
+  add r3 r4 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  add r1 12 r3
+  write 0 r3 r2
+  add r1 24 r3
+  read 0 r3 r3
+  shiftl r3 1 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  add r1 16 r3
+  write 0 r3 r2
+  load 0 r2
+.L2319:
+  add r1 20 r3
+  read 0 r3 r3
+  bges r2 r3 .L2322
+  add r1 28 r3
+  read 0 r3 r3
+  add r3 r2 r4
+  load 0 r3
+  writeb 0 r4 r3
+  add r2 1 r2
+  jump .L2319
+.L2322:
+  addr2reg link_arc_count r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg link_arc_count r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L2330
+.L2323:
+  addr2reg .Lstring.317 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+  jump .L2330
+.L2324:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.316 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+  jump .L2330
+.L2326:
+  addr2reg .Lstring.315 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+  jump .L2330
+.L2327:
+  addr2reg .Lstring.42 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+  jump .L2330
+.L2328:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.314 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+.L2330:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function link_add_archive */
+
+.data
+.balign 1
+.Lstring.319:
+	.ascii "OOM reading archive member\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.320:
+	.ascii "  pulled \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.321:
+	.ascii " from \000"
+/* end data */
+
+
+.text
+; function link_pull_members
+link_pull_members:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  load 1 r1
+  or r0 r1 r2
+.L2335:
+  beq r2 r0 .L2376
+  load 0 r2
+  load 0 r1
+.L2337:
+  write -48 r14 r1
+  addr2reg link_arc_count r12
+  read 0 r12 r3
+  bges r1 r3 .L2335
+  shiftl r1 5 r3
+  addr2reg link_arcs r1
+  add r1 r3 r1
+  write -44 r14 r1
+  load 0 r3
+.L2339:
+  write -24 r14 r2
+  write -40 r14 r3
+  add r1 24 r4
+  read 0 r4 r4
+  bges r3 r4 .L2374
+  add r1 12 r4
+  read 0 r4 r4
+  shiftl r3 1 r5
+  add r5 1 r5
+  shiftl r5 2 r5
+  add r4 r5 r5
+  read 0 r5 r5
+  write -36 r14 r5
+  add r1 28 r6
+  read 0 r6 r6
+  add r6 r5 r5
+  readb 0 r5 r5
+  bne r5 r0 .L2373
+  or r0 r4 r2
+  add r1 16 r1
+  read 0 r1 r1
+  shiftl r3 1 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r1 r2 r4
+  write -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -20 r14 r4
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r6
+  read -24 r14 r2
+  read -40 r14 r3
+  read -36 r14 r4
+  read -44 r14 r1
+  load 1 r5
+  blts r6 r0 .L2346
+  addr2reg sym_flags r12
+  read 0 r12 r5
+  shiftl r6 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  and r5 4 r5
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r7
+  jump .L2347
+.L2346:
+  or r0 r5 r7
+.L2347:
+  load 1 r5
+  bne r7 r0 .L2349
+  addr2reg sym_def_file r12
+  read 0 r12 r5
+  shiftl r6 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  slt r5 r0 r5
+  xor r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L2349:
+  bne r5 r0 .L2373
+  add r1 8 r1
+  read 0 r1 r1
+  shiftl r4 1 r2
+  add r2 r4 r2
+  add r2 1 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r6
+  write -32 r14 r6
+  add r6 1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  or r0 r1 r5
+  read -32 r14 r6
+  read -36 r14 r4
+  read -44 r14 r1
+  write -28 r14 r5
+  beq r5 r0 .L2371
+  add r1 4 r3
+  or r0 r4 r2
+  read 0 r3 r4
+  add r1 8 r1
+  read 0 r1 r1
+  shiftl r2 1 r3
+  add r3 r2 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  or r0 r5 r1
+  read 0 r2 r5
+  or r0 r6 r7
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump read_words_at
+  or r0 r1 r2
+  read -28 r14 r5
+  read -32 r14 r6
+  read -36 r14 r4
+  read -44 r14 r1
+  blts r2 r0 .L2370
+  add r1 28 r2
+  read 0 r2 r2
+  add r2 r4 r3
+  load 1 r2
+  writeb 0 r3 r2
+  addr2reg verbose r12
+  read 0 r12 r2
+  beq r2 r0 .L2355
+  addr2reg .Lstring.320 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -28 r14 r5
+  read -32 r14 r6
+  read -36 r14 r4
+  read -44 r14 r1
+.L2355:
+  add r1 16 r2
+  read 0 r2 r2
+  add r1 8 r3
+  read 0 r3 r3
+  shiftl r4 1 r7
+  add r7 r4 r7
+  add r7 2 r7
+  shiftl r7 2 r7
+  add r3 r7 r3
+  read 0 r3 r3
+  add r2 r3 r2
+  addr2reg verbose r12
+  read 0 r12 r3
+  beq r3 r0 .L2359
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -28 r14 r5
+  read -32 r14 r6
+  read -36 r14 r4
+  read -44 r14 r1
+.L2359:
+  addr2reg verbose r12
+  read 0 r12 r2
+  beq r2 r0 .L2361
+  addr2reg .Lstring.321 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -28 r14 r5
+  read -32 r14 r6
+  read -36 r14 r4
+  read -44 r14 r1
+.L2361:
+  read 0 r1 r2
+  addr2reg verbose r12
+  read 0 r12 r3
+  beq r3 r0 .L2365
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -28 r14 r5
+  read -32 r14 r6
+  read -36 r14 r4
+  read -44 r14 r1
+.L2365:
+  addr2reg verbose r12
+  read 0 r12 r2
+  beq r2 r0 .L2367
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -28 r14 r5
+  read -32 r14 r6
+  read -36 r14 r4
+  read -44 r14 r1
+.L2367:
+  or r0 r1 r2
+  add r1 16 r1
+  read 0 r1 r1
+  add r2 8 r2
+  read 0 r2 r2
+  shiftl r4 1 r3
+  add r3 r4 r3
+  add r3 2 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump link_add_object
+  or r0 r1 r2
+  read -40 r14 r3
+  read -44 r14 r1
+  blts r2 r0 .L2369
+  load 1 r2
+  jump .L2373
+.L2369:
+  load32 -1 r1
+  jump .L2381
+.L2370:
+  read 0 r1 r5
+  addr2reg .Lstring.317 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+  jump .L2381
+.L2371:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.319 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+  jump .L2381
+.L2373:
+  add r3 1 r3
+  jump .L2339
+.L2374:
+  read -48 r14 r1
+  add r1 1 r1
+  jump .L2337
+.L2376:
+  load 0 r1
+.L2377:
+  write -16 r14 r1
+  addr2reg link_arc_count r12
+  read 0 r12 r2
+  bges r1 r2 .L2380
+  shiftl r1 5 r2
+  addr2reg link_arcs r1
+  add r1 r2 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  read -16 r14 r1
+  add r1 1 r1
+  jump .L2377
+.L2380:
+  load 0 r1
+.L2381:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function link_pull_members */
+
+.data
+.balign 1
+.Lstring.323:
+	.ascii "bad symbol section: \000"
+/* end data */
+
+
+.text
+; function link_sym_addr
+link_sym_addr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r6
+  add r4 16 r1
+  read 0 r1 r1
+  add r4 8 r2
+  read 0 r2 r2
+  shiftl r5 1 r3
+  add r3 r5 r3
+  shiftl r3 2 r3
+  add r2 r3 r3
+  read 0 r3 r3
+  add r1 r3 r1
+  write -16 r14 r1
+  shiftl r5 1 r3
+  add r3 r5 r3
+  add r3 1 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  and r2 255 r3
+  load 255 r2
+  beq r3 r2 .L2386
+  or r0 r1 r12
+  or r0 r5 r1
+  or r0 r12 r5
+  jump .L2394
+.L2386:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -16 r14 r1
+  load 0 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r2
+  read -16 r14 r5
+  read -12 r14 r6
+  load 1 r1
+  blts r2 r0 .L2389
+  addr2reg sym_def_file r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  slt r1 r0 r1
+  xor r1 0 r1
+  sltu r0 r1 r3
+  jump .L2390
+.L2389:
+  or r0 r1 r3
+.L2390:
+  load 1 r1
+  bne r3 r0 .L2392
+  addr2reg sym_flags r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  and r1 2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2392:
+  bne r1 r0 .L2398
+  addr2reg sym_def_file r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  load 76 r3
+  mults r1 r3 r3
+  addr2reg link_objs r1
+  add r1 r3 r4
+  addr2reg sym_label r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r4 8 r2
+  read 0 r2 r2
+  shiftl r1 1 r3
+  add r3 r1 r3
+  add r3 1 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  and r2 255 r3
+.L2394:
+  load 4 r2
+  bges r3 r2 .L2397
+  or r0 r1 r5
+  add r4 60 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r4 8 r2
+  read 0 r2 r2
+  shiftl r5 1 r7
+  add r7 r5 r5
+  add r5 2 r5
+  shiftl r5 2 r5
+  add r2 r5 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  add r4 28 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  sub r1 r2 r1
+  write 0 r6 r1
+  load 0 r1
+  jump .L2399
+.L2397:
+  addr2reg .Lstring.323 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+  jump .L2399
+.L2398:
+  addr2reg .Lstring.201 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+.L2399:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function link_sym_addr */
+
+.data
+.balign 1
+.Lstring.325:
+	.ascii "bad object relocation\000"
+/* end data */
+
+
+.text
+; function link_patch
+link_patch:
+  or r0 r4 r1
+  or r0 r7 r4
+  sub r6 r4 r2
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 5 r3
+  blt r5 r3 .L2405
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.325 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  jump .L2414
+.L2405:
+  shiftl r5 2 r5
+  addr2reg .Ljt2405 r3
+  add r3 r5 r3
+  read 0 r3 r3
+  jumpr 0 r3
+.L2406:
+  write 0 r1 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump add_reloc
+  jump .L2414
+.L2407:
+  read 0 r1 r2
+  load32 -16776961 r3
+  and r2 r3 r2
+  load32 65535 r3
+  and r6 r3 r3
+  shiftl r3 8 r3
+  or r2 r3 r2
+  write 0 r1 r2
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump add_reloc
+  jump .L2414
+.L2408:
+  or r0 r1 r4
+  read 0 r4 r1
+  load32 -16776961 r2
+  and r1 r2 r1
+  shiftr r6 16 r2
+  load32 65535 r3
+  and r2 r3 r2
+  shiftl r2 8 r2
+  or r1 r2 r1
+  write 0 r4 r1
+  jump .L2414
+.L2410:
+  or r0 r1 r4
+  read 0 r4 r1
+  load32 -268435455 r3
+  and r1 r3 r1
+  load32 134217727 r3
+  and r2 r3 r2
+  shiftl r2 1 r2
+  or r1 r2 r1
+  write 0 r4 r1
+  jump .L2414
+.L2412:
+  or r0 r1 r4
+  read 0 r4 r1
+  load32 -268431361 r3
+  and r1 r3 r1
+  load32 65535 r3
+  and r2 r3 r2
+  shiftl r2 12 r2
+  or r1 r2 r1
+  write 0 r4 r1
+.L2414:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt2405:
+  .int .L2406
+  .int .L2407
+  .int .L2408
+  .int .L2410
+  .int .L2412
+
+/* end function link_patch */
+
+.data
+.balign 1
+.Lstring.327:
+	.ascii "LBL %08x %s\012\000"
+/* end data */
+
+
+.text
+; function link_objects
+link_objects:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 232 r13
+  write -224 r14 r8
+  load 12 r2
+  load 0 r1
+.L2418:
+  write -16 r14 r2
+  load 4 r3
+  bges r1 r3 .L2424
+  load 0 r3
+.L2420:
+  addr2reg link_obj_count r12
+  read 0 r12 r4
+  bges r3 r4 .L2423
+  load 76 r4
+  mults r3 r4 r5
+  addr2reg link_objs r4
+  add r4 r5 r4
+  add r4 60 r4
+  shiftl r1 2 r5
+  add r4 r5 r4
+  write 0 r4 r2
+  load 76 r4
+  mults r3 r4 r5
+  addr2reg link_objs r4
+  add r4 r5 r4
+  add r4 44 r4
+  shiftl r1 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  shiftl r4 2 r4
+  add r2 r4 r2
+  add r3 1 r3
+  jump .L2420
+.L2423:
+  add r1 1 r1
+  jump .L2418
+.L2424:
+  shiftrs r2 31 r1
+  shiftr r1 30 r1
+  add r2 r1 r1
+  shiftrs r1 2 r1
+  load32 262144 r2
+  bgts r1 r2 .L2466
+  addr2reg .Lstring.107 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  load 0 r6
+  addr2reg .Lstring.107 r4
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r2
+  load 1 r1
+  blts r2 r0 .L2428
+  addr2reg sym_def_file r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  slt r1 r0 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2428:
+  bne r1 r0 .L2465
+  addr2reg sym_def_file r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  load 76 r3
+  mults r1 r3 r3
+  addr2reg link_objs r1
+  add r1 r3 r4
+  addr2reg sym_label r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  add r14 -220 r6
+  savpc r15
+  add r15 12 r15
+  jump link_sym_addr
+  blts r1 r0 .L2467
+  load 0 r1
+  addr2reg output_count r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg reloc_count r12
+  write 0 r12 r1
+  load 2 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump add_reloc
+  read -16 r14 r2
+  read -220 r14 r1
+  load32 134217727 r3
+  and r1 r3 r1
+  shiftl r1 1 r3
+  load32 -1879048192 r1
+  or r1 r3 r1
+  addr2reg output_words r12
+  read 0 r12 r3
+  addr2reg output_count r12
+  read 0 r12 r4
+  add r4 1 r5
+  addr2reg output_count r12
+  write 0 r12 r5
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r1
+  addr2reg output_words r12
+  read 0 r12 r1
+  addr2reg output_count r12
+  read 0 r12 r3
+  add r3 1 r4
+  addr2reg output_count r12
+  write 0 r12 r4
+  shiftl r3 2 r3
+  add r1 r3 r3
+  load 0 r1
+  write 0 r3 r1
+  shiftrs r2 31 r1
+  shiftr r1 30 r1
+  add r2 r1 r1
+  shiftrs r1 2 r1
+  addr2reg output_words r12
+  read 0 r12 r2
+  addr2reg output_count r12
+  read 0 r12 r3
+  add r3 1 r4
+  addr2reg output_count r12
+  write 0 r12 r4
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  load 0 r1
+  or r0 r1 r3
+.L2432:
+  write -52 r14 r3
+  load 4 r1
+  bges r3 r1 .L2454
+  load 0 r1
+.L2434:
+  write -72 r14 r1
+  addr2reg link_obj_count r12
+  read 0 r12 r2
+  bges r1 r2 .L2453
+  load 76 r2
+  mults r1 r2 r2
+  addr2reg link_objs r1
+  add r1 r2 r1
+  write -60 r14 r1
+  addr2reg output_count r12
+  read 0 r12 r5
+  write -80 r14 r5
+  add r1 28 r2
+  shiftl r3 2 r4
+  add r2 r4 r2
+  read 0 r2 r2
+  write -56 r14 r2
+  add r1 44 r4
+  shiftl r3 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  shiftl r4 2 r4
+  add r2 r4 r5
+  write -76 r14 r5
+  load 0 r4
+.L2436:
+  add r1 44 r5
+  shiftl r3 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  bges r4 r5 .L2439
+  add r1 4 r5
+  read 0 r5 r5
+  shiftrs r2 31 r6
+  shiftr r6 30 r6
+  add r2 r6 r6
+  shiftrs r6 2 r6
+  add r6 r4 r6
+  shiftl r6 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  addr2reg output_words r12
+  read 0 r12 r6
+  write -68 r14 r6
+  addr2reg output_count r12
+  read 0 r12 r7
+  add r7 1 r6
+  addr2reg output_count r12
+  write 0 r12 r6
+  read -68 r14 r6
+  shiftl r7 2 r7
+  add r6 r7 r6
+  write 0 r6 r5
+  add r4 1 r4
+  jump .L2436
+.L2439:
+  load 0 r4
+.L2440:
+  write -64 r14 r4
+  add r1 24 r5
+  read 0 r5 r5
+  bges r4 r5 .L2451
+  or r0 r3 r7
+  add r1 12 r3
+  read 0 r3 r3
+  shiftl r4 1 r5
+  add r5 r4 r5
+  shiftl r5 2 r5
+  add r3 r5 r5
+  read 0 r5 r5
+  shiftr r5 8 r6
+  write -36 r14 r6
+  load 1 r5
+  write -32 r14 r5
+  slt r6 r2 r8
+  read -32 r14 r5
+  bne r8 r0 .L2444
+  read -76 r14 r5
+  slt r6 r5 r6
+  read -80 r14 r5
+  xor r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r8
+  jump .L2445
+.L2444:
+  or r0 r5 r8
+  read -80 r14 r5
+.L2445:
+  or r0 r5 r6
+  read -76 r14 r5
+  bne r8 r0 .L2449
+  or r0 r3 r2
+  shiftl r4 1 r3
+  add r3 r4 r3
+  add r3 1 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r5
+  add r14 -216 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump link_sym_addr
+  or r0 r1 r5
+  read -64 r14 r4
+  read -36 r14 r3
+  read -56 r14 r2
+  read -60 r14 r1
+  blts r5 r0 .L2467
+  read -216 r14 r5
+  add r1 12 r6
+  read 0 r6 r6
+  shiftl r4 1 r7
+  add r7 r4 r7
+  add r7 2 r7
+  shiftl r7 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  add r5 r6 r6
+  write -40 r14 r6
+  write -216 r14 r6
+  addr2reg output_words r12
+  read 0 r12 r5
+  sub r3 r2 r6
+  shiftrs r6 31 r7
+  shiftr r7 30 r7
+  add r6 r7 r7
+  read -80 r14 r6
+  shiftrs r7 2 r7
+  add r6 r7 r6
+  shiftl r6 2 r6
+  add r5 r6 r8
+  write -48 r14 r8
+  read -40 r14 r6
+  add r1 12 r5
+  read 0 r5 r5
+  write -44 r14 r5
+  read -52 r14 r7
+  shiftl r4 1 r5
+  add r5 r4 r5
+  read -44 r14 r4
+  shiftl r5 2 r5
+  add r4 r5 r5
+  read -48 r14 r4
+  read 0 r5 r5
+  and r5 255 r5
+  add r1 60 r1
+  shiftl r7 2 r7
+  add r1 r7 r1
+  read 0 r1 r1
+  add r1 r3 r1
+  sub r1 r2 r7
+  savpc r15
+  add r15 12 r15
+  jump link_patch
+  read -64 r14 r4
+  read -52 r14 r3
+  read -76 r14 r6
+  read -56 r14 r2
+  read -80 r14 r5
+  read -60 r14 r1
+  jump .L2450
+.L2449:
+  or r0 r7 r3
+  or r0 r5 r12
+  or r0 r6 r5
+  or r0 r12 r6
+.L2450:
+  add r4 1 r4
+  jump .L2440
+.L2451:
+  read -72 r14 r1
+  add r1 1 r1
+  jump .L2434
+.L2453:
+  add r3 1 r3
+  jump .L2432
+.L2454:
+  addr2reg dump_labels r12
+  read 0 r12 r1
+  beq r1 r0 .L2467
+  load 0 r1
+.L2456:
+  write -28 r14 r1
+  addr2reg link_obj_count r12
+  read 0 r12 r2
+  bges r1 r2 .L2467
+  load 76 r2
+  mults r1 r2 r2
+  addr2reg link_objs r1
+  add r1 r2 r1
+  write -20 r14 r1
+  load 0 r2
+.L2458:
+  write -24 r14 r2
+  add r1 20 r3
+  read 0 r3 r3
+  bges r2 r3 .L2463
+  or r0 r2 r3
+  add r1 8 r2
+  read 0 r2 r2
+  shiftl r3 1 r4
+  add r4 r3 r4
+  add r4 1 r4
+  shiftl r4 2 r4
+  add r2 r4 r2
+  read 0 r2 r2
+  and r2 255 r2
+  load 255 r4
+  beq r2 r4 .L2461
+  add r14 -84 r6
+  or r0 r3 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump link_sym_addr
+  read -24 r14 r3
+  read -20 r14 r1
+  read -84 r14 r7
+  or r0 r1 r2
+  add r1 16 r1
+  read 0 r1 r1
+  add r2 8 r2
+  read 0 r2 r2
+  shiftl r3 1 r4
+  add r4 r3 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.327 r6
+  load 128 r5
+  add r14 -212 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -28 r1
+  sub r13 r1 r13
+  add r14 -212 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -24 r14 r2
+  read -20 r14 r1
+  jump .L2462
+.L2461:
+  or r0 r3 r2
+.L2462:
+  add r2 1 r2
+  jump .L2458
+.L2463:
+  read -28 r14 r1
+  add r1 1 r1
+  jump .L2456
+.L2465:
+  addr2reg .Lstring.107 r5
+  addr2reg .Lstring.201 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L2467
+.L2466:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.296 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+.L2467:
+  read -224 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function link_objects */
+
+
+.text
+; function has_suffix
+has_suffix:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  write -8 r14 r1
+  read -12 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r2
+  read -8 r14 r1
+  read -12 r14 r5
+  read -16 r14 r4
+  load 0 r3
+  bges r1 r2 .L2472
+  or r0 r3 r1
+  jump .L2473
+.L2472:
+  add r4 r1 r1
+  sub r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2473:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function has_suffix */
+
+.data
+.balign 1
+.Lstring.330:
+	.ascii ".a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.331:
+	.ascii ".o\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.332:
+	.ascii "assemble with -c before linking with objects: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.333:
+	.ascii "Linking \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.334:
+	.ascii " objects\012\000"
+/* end data */
+
+
+.text
+; function link_from_objects
+link_from_objects:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -8 r14 r5
+  write -12 r14 r4
+  beq r4 r0 .L2478
+  addr2reg sym_name r12
+  read 0 r12 r4
+  load32 65536 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  load 0 r1
+  addr2reg sym_count r12
+  write 0 r12 r1
+.L2478:
+  addr2reg .Lstring.107 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  load 1 r6
+  addr2reg .Lstring.107 r4
+  savpc r15
+  add r15 12 r15
+  jump sym_find_n
+  or r0 r1 r2
+  blts r2 r0 .L2507
+  addr2reg sym_flags r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r2
+  read 0 r2 r1
+  or r1 4 r1
+  write 0 r2 r1
+  load 0 r1
+.L2481:
+  write -16 r14 r1
+  addr2reg num_files r12
+  read 0 r12 r2
+  bges r1 r2 .L2495
+  shiftl r1 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r4
+  addr2reg .Lstring.330 r5
+  savpc r15
+  add r15 12 r15
+  jump has_suffix
+  or r0 r1 r2
+  read -16 r14 r1
+  bne r2 r0 .L2492
+  shiftl r1 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r4
+  addr2reg .Lstring.331 r5
+  savpc r15
+  add r15 12 r15
+  jump has_suffix
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+  bne r2 r0 .L2488
+  beq r4 r0 .L2487
+  shiftl r1 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  or r0 r5 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump link_add_object
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+  bges r2 r0 .L2493
+  load32 -1 r1
+  jump .L2508
+.L2487:
+  shiftl r1 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r5
+  addr2reg .Lstring.332 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -1 r1
+  jump .L2508
+.L2488:
+  shiftl r1 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r4
+  add r14 -20 r5
+  savpc r15
+  add r15 12 r15
+  jump read_file_words
+  or r0 r1 r5
+  read -16 r14 r1
+  beq r5 r0 .L2491
+  shiftl r1 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r4
+  read -20 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump link_add_object
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+  bges r2 r0 .L2493
+  load32 -1 r1
+  jump .L2508
+.L2491:
+  load32 -1 r1
+  jump .L2508
+.L2492:
+  shiftl r1 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump link_add_archive
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+  blts r2 r0 .L2494
+.L2493:
+  add r1 1 r1
+  jump .L2481
+.L2494:
+  load32 -1 r1
+  jump .L2508
+.L2495:
+  savpc r15
+  add r15 12 r15
+  jump link_pull_members
+  blts r1 r0 .L2506
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2498
+  addr2reg .Lstring.333 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2498:
+  addr2reg link_obj_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2501
+  addr2reg .Lstring.334 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2501:
+  savpc r15
+  add r15 12 r15
+  jump link_objects
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2505
+  savpc r15
+  add r15 12 r15
+  jump pass_append_reloc
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2504
+  load 0 r1
+  jump .L2508
+.L2504:
+  load32 -1 r1
+  jump .L2508
+.L2505:
+  load32 -1 r1
+  jump .L2508
+.L2506:
+  load32 -1 r1
+  jump .L2508
+.L2507:
+  load32 -1 r1
+.L2508:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function link_from_objects */
+
+.data
+.balign 1
+.Lstring.336:
+	.ascii "OOM writing archive\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.337:
+	.ascii "Archived \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.338:
+	.ascii " objects, \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.339:
+	.ascii " symbols\012\000"
+/* end data */
+
+
+.text
+; function write_archive
+write_archive:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 716 r13
+  write -708 r14 r8
+  write -108 r14 r4
+  load 0 r3
+  load 0 r2
+  load 0 r1
+  write -88 r14 r3
+  write -84 r14 r2
+  or r0 r1 r3
+.L2513:
+  write -112 r14 r3
+  addr2reg num_files r12
+  read 0 r12 r1
+  bges r3 r1 .L2530
+  shiftl r3 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r4
+  add r14 -116 r5
+  savpc r15
+  add r15 12 r15
+  jump read_file_words
+  read -112 r14 r3
+  shiftl r3 2 r4
+  add r14 -704 r2
+  add r2 r4 r2
+  write 0 r2 r1
+  shiftl r3 2 r2
+  add r14 -704 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  beq r1 r0 .L2529
+  shiftl r3 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r5
+  shiftl r3 2 r2
+  add r14 -704 r1
+  add r1 r2 r1
+  read 0 r1 r6
+  read -116 r14 r7
+  add r14 -192 r4
+  savpc r15
+  add r15 12 r15
+  jump obj_open
+  read -112 r14 r3
+  blts r1 r0 .L2528
+  add r14 -192 r1
+  add r1 16 r1
+  read 0 r1 r1
+  shiftl r3 2 r4
+  add r14 -704 r2
+  add r2 r4 r2
+  read 0 r2 r2
+  sub r1 r2 r1
+  shiftrs r1 31 r2
+  shiftr r2 30 r2
+  add r1 r2 r1
+  shiftrs r1 2 r1
+  shiftl r3 2 r4
+  add r14 -704 r2
+  add r2 r4 r2
+  read 0 r2 r2
+  add r2 28 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  shiftl r3 2 r4
+  add r14 -448 r2
+  add r2 r4 r2
+  write 0 r2 r1
+  shiftl r3 2 r2
+  addr2reg file_prefix r1
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r3
+  read -88 r14 r2
+  read -84 r14 r1
+  add r3 3 r3
+  add r1 r3 r1
+  load 0 r3
+.L2517:
+  write -100 r14 r1
+  write -104 r14 r3
+  add r14 -192 r4
+  add r4 20 r4
+  read 0 r4 r4
+  bges r3 r4 .L2525
+  add r14 -192 r4
+  add r4 8 r4
+  read 0 r4 r4
+  shiftl r3 1 r5
+  add r5 r3 r5
+  add r5 1 r5
+  shiftl r5 2 r5
+  add r4 r5 r5
+  read 0 r5 r5
+  and r5 255 r6
+  load 1 r7
+  write -92 r14 r7
+  load 255 r7
+  xor r6 r7 r7
+  sltu r7 1 r7
+  read -92 r14 r6
+  bne r7 r0 .L2520
+  shiftr r5 8 r5
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+  jump .L2521
+.L2520:
+  or r0 r6 r5
+.L2521:
+  bne r5 r0 .L2524
+  or r0 r2 r1
+  or r0 r4 r2
+  add r1 1 r1
+  write -96 r14 r1
+  add r14 -192 r1
+  add r1 16 r1
+  read 0 r1 r1
+  shiftl r3 1 r4
+  add r4 r3 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r4
+  read -100 r14 r1
+  read -104 r14 r3
+  read -96 r14 r2
+  add r4 1 r4
+  add r1 r4 r1
+.L2524:
+  add r3 1 r3
+  jump .L2517
+.L2525:
+  read -112 r14 r3
+  add r3 1 r3
+  write -88 r14 r2
+  write -84 r14 r1
+  jump .L2513
+.L2528:
+  load32 -1 r1
+  jump .L2575
+.L2529:
+  load32 -1 r1
+  jump .L2575
+.L2530:
+  read -88 r14 r4
+  read -84 r14 r2
+  add r2 3 r2
+  shiftrs r2 31 r3
+  shiftr r3 30 r3
+  add r2 r3 r2
+  shiftrs r2 2 r2
+  write -12 r14 r2
+  shiftl r1 1 r3
+  add r3 r1 r5
+  load 4 r3
+  add r3 r5 r3
+  shiftl r4 1 r5
+  add r3 r5 r3
+  add r3 r2 r6
+  load 0 r3
+  or r0 r2 r5
+  or r0 r4 r2
+  or r0 r3 r4
+  or r0 r6 r3
+.L2533:
+  write -76 r14 r3
+  bges r4 r1 .L2536
+  shiftl r4 2 r7
+  add r14 -448 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  add r3 r6 r3
+  add r4 1 r4
+  jump .L2533
+.L2536:
+  or r0 r3 r6
+  shiftl r6 2 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  or r0 r1 r5
+  read -76 r14 r6
+  read -88 r14 r4
+  read -12 r14 r1
+  write -80 r14 r5
+  beq r5 r0 .L2573
+  add r5 0 r3
+  load32 1093808962 r2
+  write 0 r3 r2
+  addr2reg num_files r12
+  read 0 r12 r3
+  or r0 r5 r2
+  add r5 4 r5
+  write 0 r5 r3
+  add r2 8 r3
+  write 0 r3 r4
+  add r2 12 r3
+  write 0 r3 r1
+  add r2 16 r2
+  addr2reg num_files r12
+  read 0 r12 r5
+  shiftl r5 1 r3
+  add r3 r5 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  shiftl r4 1 r3
+  shiftl r3 2 r3
+  add r2 r3 r5
+  write -72 r14 r5
+  load 0 r2
+  or r0 r6 r3
+  or r0 r4 r12
+  or r0 r2 r4
+  or r0 r12 r2
+.L2540:
+  bges r4 r1 .L2543
+  shiftl r4 2 r6
+  add r5 r6 r7
+  load 0 r6
+  write 0 r7 r6
+  add r4 1 r4
+  jump .L2540
+.L2543:
+  or r0 r2 r4
+  read -80 r14 r2
+  add r2 16 r2
+  addr2reg num_files r12
+  read 0 r12 r6
+  shiftl r6 1 r3
+  add r3 r6 r6
+  load 4 r3
+  add r3 r6 r3
+  shiftl r4 1 r4
+  add r3 r4 r3
+  add r3 r1 r1
+  shiftl r1 2 r3
+  load 0 r4
+  load 0 r1
+  or r0 r4 r12
+  or r0 r1 r4
+  or r0 r12 r1
+.L2546:
+  write -64 r14 r3
+  write -52 r14 r1
+  write -68 r14 r4
+  addr2reg num_files r12
+  read 0 r12 r6
+  bges r4 r6 .L2549
+  add r2 4 r6
+  write 0 r2 r3
+  shiftl r4 2 r3
+  add r14 -448 r2
+  add r2 r3 r2
+  read 0 r2 r3
+  or r0 r1 r2
+  add r6 4 r1
+  write 0 r6 r3
+  add r1 4 r3
+  write -60 r14 r3
+  write 0 r1 r2
+  or r0 r4 r1
+  add r5 r2 r4
+  shiftl r1 2 r2
+  addr2reg file_prefix r1
+  add r1 r2 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  read -52 r14 r1
+  read -72 r14 r5
+  add r5 r1 r4
+  addr2reg .Lstring.331 r5
+  savpc r15
+  add r15 12 r15
+  jump strcat
+  read -52 r14 r1
+  read -72 r14 r5
+  add r5 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r2
+  read -64 r14 r3
+  read -52 r14 r1
+  read -68 r14 r4
+  read -80 r14 r7
+  add r2 1 r2
+  add r1 r2 r1
+  write -56 r14 r1
+  or r0 r4 r1
+  add r7 r3 r4
+  shiftl r1 2 r3
+  add r14 -704 r2
+  add r2 r3 r2
+  read 0 r2 r5
+  shiftl r1 2 r2
+  add r14 -448 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -64 r14 r3
+  read -68 r14 r4
+  read -56 r14 r1
+  read -60 r14 r2
+  read -72 r14 r5
+  shiftl r4 2 r7
+  add r14 -448 r6
+  add r6 r7 r6
+  read -80 r14 r7
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r3 r6 r3
+  add r4 1 r4
+  jump .L2546
+.L2549:
+  load 0 r3
+  write -16 r14 r2
+  write -20 r14 r1
+  or r0 r3 r4
+.L2551:
+  write -36 r14 r4
+  addr2reg num_files r12
+  read 0 r12 r1
+  bges r4 r1 .L2564
+  shiftl r4 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r5
+  shiftl r4 2 r2
+  add r14 -704 r1
+  add r1 r2 r1
+  read 0 r1 r6
+  shiftl r4 2 r2
+  add r14 -448 r1
+  add r1 r2 r1
+  read 0 r1 r7
+  add r14 -192 r4
+  savpc r15
+  add r15 12 r15
+  jump obj_open
+  read -16 r14 r2
+  read -20 r14 r1
+  load 0 r3
+.L2553:
+  write -44 r14 r1
+  write -48 r14 r3
+  add r14 -192 r4
+  add r4 20 r4
+  read 0 r4 r4
+  bges r3 r4 .L2561
+  add r14 -192 r4
+  add r4 8 r4
+  read 0 r4 r5
+  shiftl r3 1 r4
+  add r4 r3 r4
+  add r4 1 r4
+  shiftl r4 2 r4
+  add r5 r4 r4
+  read 0 r4 r7
+  add r14 -192 r4
+  add r4 16 r4
+  read 0 r4 r4
+  write -24 r14 r4
+  read -24 r14 r4
+  shiftl r3 1 r6
+  add r6 r3 r6
+  shiftl r6 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  add r4 r5 r4
+  write -32 r14 r4
+  or r0 r2 r6
+  and r7 255 r2
+  load 1 r5
+  write -28 r14 r5
+  load 255 r5
+  xor r2 r5 r8
+  sltu r8 1 r8
+  or r0 r1 r2
+  read -36 r14 r1
+  read -72 r14 r5
+  bne r8 r0 .L2556
+  shiftr r7 8 r7
+  xor r7 0 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+  jump .L2557
+.L2556:
+  read -28 r14 r7
+.L2557:
+  bne r7 r0 .L2559
+  add r6 4 r3
+  write 0 r6 r2
+  add r3 4 r6
+  write -40 r14 r6
+  write 0 r3 r1
+  or r0 r4 r1
+  add r5 r2 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  read -32 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -44 r14 r1
+  read -48 r14 r3
+  read -36 r14 r4
+  read -40 r14 r2
+  read -72 r14 r5
+  add r6 1 r6
+  add r1 r6 r1
+  jump .L2560
+.L2559:
+  or r0 r1 r4
+  or r0 r2 r1
+  or r0 r6 r2
+.L2560:
+  add r3 1 r3
+  jump .L2553
+.L2561:
+  read -36 r14 r4
+  read -72 r14 r5
+  add r4 1 r4
+  write -16 r14 r2
+  write -20 r14 r1
+  jump .L2551
+.L2564:
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2566
+  addr2reg .Lstring.337 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2566:
+  addr2reg num_files r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  read -88 r14 r4
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2569
+  addr2reg .Lstring.338 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -88 r14 r4
+.L2569:
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  read -76 r14 r6
+  read -80 r14 r5
+  read -108 r14 r4
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2572
+  addr2reg .Lstring.339 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -76 r14 r6
+  read -80 r14 r5
+  read -108 r14 r4
+.L2572:
+  savpc r15
+  add r15 12 r15
+  jump write_words
+  jump .L2575
+.L2573:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.336 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+.L2575:
+  read -708 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function write_archive */
+
+.data
+.balign 1
+.Lstring.341:
+	.ascii "OOM allocating buffers\000"
+/* end data */
+
+
+.text
+; function allocate_buffers
+allocate_buffers:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load32 524288 r1
+  addr2reg str_pool_size r12
+  write 0 r12 r1
+  load32 524288 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg str_pool r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg str_pool_pos r12
+  write 0 r12 r1
+  load32 262144 r1
+  addr2reg byte_pool_size r12
+  write 0 r12 r1
+  load32 262144 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg byte_pool r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg byte_pool_pos r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_kind r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_text r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_section r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_file_idx r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_value r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_label r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_label_off r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_byte_off r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_byte_len r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_align r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_dir_sec r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_addr r12
+  write 0 r12 r1
+  load32 196608 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg line_flags r12
+  write 0 r12 r1
+  load32 32768 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg label_names r12
+  write 0 r12 r1
+  load32 32768 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg label_addr r12
+  write 0 r12 r1
+  load32 32768 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg label_file r12
+  write 0 r12 r1
+  load32 32768 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg label_global r12
+  write 0 r12 r1
+  load32 32768 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg label_sec r12
+  write 0 r12 r1
+  load32 65536 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg sym_name r12
+  write 0 r12 r1
+  load32 65536 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg sym_label r12
+  write 0 r12 r1
+  load32 65536 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg sym_def_file r12
+  write 0 r12 r1
+  load32 65536 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg sym_flags r12
+  write 0 r12 r1
+  load32 65536 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg def_name r12
+  write 0 r12 r1
+  load32 65536 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg def_file r12
+  write 0 r12 r1
+  load32 1048576 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg output_words r12
+  write 0 r12 r1
+  load32 32768 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg reloc_entries r12
+  write 0 r12 r1
+  load32 98304 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg obj_relocs r12
+  write 0 r12 r1
+  addr2reg str_pool r12
+  read 0 r12 r3
+  load 1 r2
+  beq r3 r0 .L2580
+  addr2reg byte_pool r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L2581
+.L2580:
+  or r0 r2 r3
+.L2581:
+  load 1 r2
+  bne r3 r0 .L2583
+  addr2reg line_kind r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L2584
+.L2583:
+  or r0 r2 r3
+.L2584:
+  load 1 r2
+  bne r3 r0 .L2586
+  addr2reg line_text r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L2587
+.L2586:
+  or r0 r2 r3
+.L2587:
+  load 1 r2
+  bne r3 r0 .L2589
+  addr2reg label_names r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L2590
+.L2589:
+  or r0 r2 r3
+.L2590:
+  load 1 r2
+  bne r3 r0 .L2592
+  addr2reg label_addr r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L2593
+.L2592:
+  or r0 r2 r3
+.L2593:
+  load 1 r2
+  bne r3 r0 .L2595
+  addr2reg output_words r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L2596
+.L2595:
+  or r0 r2 r3
+.L2596:
+  load 1 r2
+  bne r3 r0 .L2598
+  addr2reg reloc_entries r12
+  read 0 r12 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L2599
+.L2598:
+  or r0 r2 r3
+.L2599:
+  load 1 r2
+  bne r3 r0 .L2601
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L2601:
+  load 1 r1
+  bne r2 r0 .L2603
+  addr2reg label_sec r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L2604
+.L2603:
+  or r0 r1 r2
+.L2604:
+  load 1 r1
+  bne r2 r0 .L2606
+  addr2reg sym_name r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L2607
+.L2606:
+  or r0 r1 r2
+.L2607:
+  load 1 r1
+  bne r2 r0 .L2609
+  addr2reg sym_label r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L2610
+.L2609:
+  or r0 r1 r2
+.L2610:
+  load 1 r1
+  bne r2 r0 .L2612
+  addr2reg sym_def_file r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L2613
+.L2612:
+  or r0 r1 r2
+.L2613:
+  load 1 r1
+  bne r2 r0 .L2615
+  addr2reg sym_flags r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L2616
+.L2615:
+  or r0 r1 r2
+.L2616:
+  load 1 r1
+  bne r2 r0 .L2618
+  addr2reg def_name r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L2619
+.L2618:
+  or r0 r1 r2
+.L2619:
+  load 1 r1
+  bne r2 r0 .L2621
+  addr2reg def_file r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2621:
+  bne r1 r0 .L2625
+  addr2reg sym_name r12
+  read 0 r12 r4
+  load32 65536 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  addr2reg def_name r12
+  read 0 r12 r4
+  load32 65536 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  savpc r15
+  add r15 12 r15
+  jump alloc_out_arrays
+  blts r1 r0 .L2624
+  load 0 r1
+  jump .L2627
+.L2624:
+  load32 -1 r1
+  jump .L2627
+.L2625:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.341 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load32 -1 r1
+.L2627:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function allocate_buffers */
+
+.data
+.balign 1
+.Lstring.343:
+	.ascii "Usage: asm-link [-v] [-p] [--gc-sections [--map file]] -o output.bin\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.344:
+	.ascii "                input1.asm [input2.asm ...]\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.345:
+	.ascii "       asm-link [-v] [-p] -c -o output.o input.asm\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.346:
+	.ascii "       asm-link -a -o output.a input1.o [input2.o ...]\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.347:
+	.ascii "       asm-link [-v] [-p] -o output.bin input1.o [input.asm] [lib.a ...]\012\000"
+/* end data */
+
+
+.text
+; function usage
+usage:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lstring.343 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.344 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.345 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.346 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.347 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function usage */
+
+.data
+.balign 1
+.Lstring.349:
+	.ascii "-o\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.350:
+	.ascii "-v\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.351:
+	.ascii "-d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.352:
+	.ascii "-p\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.353:
+	.ascii "-c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.354:
+	.ascii "-a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.355:
+	.ascii "--gc-sections\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.356:
+	.ascii "--map\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.357:
+	.ascii "-h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.358:
+	.ascii "--help\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.359:
+	.ascii "too many input files\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.360:
+	.ascii "-c takes exactly one input file\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.361:
+	.ascii "objects link with at most one .asm input\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.362:
+	.ascii "Wrote \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.363:
+	.ascii " words to \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.364:
+	.ascii "Reading \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.365:
+	.ascii " input files\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.366:
+	.ascii "Parsed \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.367:
+	.ascii " lines\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.368:
+	.ascii "Found \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.369:
+	.ascii " cross-file label conflicts\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.370:
+	.ascii "--gc-sections needs every input as .asm, without -c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.371:
+	.ascii "After ELF pack: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.372:
+	.ascii "Labels: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.373:
+	.ascii "Program lines: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.374:
+	.ascii "Encoded \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.375:
+	.ascii " words, \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.376:
+	.ascii " relocations\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.377:
+	.ascii "Wrote object with \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.378:
+	.ascii " symbols, \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.379:
+	.ascii " references\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.380:
+	.ascii "asm-link: aborted\012\000"
+/* end data */
+
+
+.text
+; function asm_link_main
+.global asm_link_main
+asm_link_main:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 188 r13
+  write -44 r14 r5
+  write -40 r14 r4
+  load 0 r1
+  addr2reg num_files r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg output_path r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg verbose r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg peephole r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg assemble_only r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg make_archive r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg gc_sections r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg map_path r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 2 r1
+  blts r4 r1 .L2841
+  savpc r15
+  add r15 12 r15
+  jump allocate_buffers
+  read -44 r14 r5
+  read -40 r14 r4
+  blts r1 r0 .L2840
+  load 1 r1
+.L2637:
+  write -48 r14 r1
+  bges r1 r4 .L2667
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.349 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -48 r14 r1
+  read -44 r14 r5
+  read -40 r14 r4
+  beq r2 r0 .L2663
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.350 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -48 r14 r1
+  read -44 r14 r5
+  read -40 r14 r4
+  beq r2 r0 .L2662
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.351 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -48 r14 r1
+  read -44 r14 r5
+  read -40 r14 r4
+  beq r2 r0 .L2661
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.352 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -48 r14 r1
+  read -44 r14 r5
+  read -40 r14 r4
+  beq r2 r0 .L2660
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.353 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -48 r14 r1
+  read -44 r14 r5
+  read -40 r14 r4
+  beq r2 r0 .L2659
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.354 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -48 r14 r1
+  read -44 r14 r5
+  read -40 r14 r4
+  beq r2 r0 .L2658
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.355 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -48 r14 r1
+  read -44 r14 r5
+  read -40 r14 r4
+  beq r2 r0 .L2657
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.356 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -48 r14 r1
+  read -44 r14 r5
+  read -40 r14 r4
+  beq r2 r0 .L2654
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.357 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -48 r14 r1
+  read -44 r14 r5
+  load 1 r2
+  beq r3 r0 .L2648
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.358 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -48 r14 r1
+  read -44 r14 r5
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L2648:
+  bne r2 r0 .L2653
+  addr2reg num_files r12
+  read 0 r12 r3
+  load 64 r2
+  bges r3 r2 .L2651
+  shiftl r1 2 r2
+  add r5 r2 r2
+  read 0 r2 r2
+  shiftl r3 2 r4
+  addr2reg file_paths r3
+  add r3 r4 r3
+  write 0 r3 r2
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump make_prefix
+  or r0 r1 r2
+  read -48 r14 r1
+  read -44 r14 r5
+  read -40 r14 r4
+  addr2reg num_files r12
+  read 0 r12 r3
+  shiftl r3 2 r6
+  addr2reg file_prefix r3
+  add r3 r6 r3
+  write 0 r3 r2
+  addr2reg num_files r12
+  read 0 r12 r2
+  add r2 1 r2
+  addr2reg num_files r12
+  write 0 r12 r2
+  jump .L2665
+.L2651:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.359 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 1 r1
+  jump .L2842
+.L2653:
+  savpc r15
+  add r15 12 r15
+  jump usage
+  load 0 r1
+  jump .L2842
+.L2654:
+  add r1 1 r2
+  bges r2 r4 .L2656
+  add r1 1 r1
+  shiftl r1 2 r2
+  add r5 r2 r2
+  read 0 r2 r2
+  addr2reg map_path r12
+  write 0 r12 r2
+  jump .L2665
+.L2656:
+  savpc r15
+  add r15 12 r15
+  jump usage
+  load 1 r1
+  jump .L2842
+.L2657:
+  load 1 r2
+  addr2reg gc_sections r12
+  write 0 r12 r2
+  jump .L2665
+.L2658:
+  load 1 r2
+  addr2reg make_archive r12
+  write 0 r12 r2
+  jump .L2665
+.L2659:
+  load 1 r2
+  addr2reg assemble_only r12
+  write 0 r12 r2
+  jump .L2665
+.L2660:
+  load 1 r2
+  addr2reg peephole r12
+  write 0 r12 r2
+  jump .L2665
+.L2661:
+  load 1 r2
+  addr2reg dump_labels r12
+  write 0 r12 r2
+  jump .L2665
+.L2662:
+  load 1 r2
+  addr2reg verbose r12
+  write 0 r12 r2
+  jump .L2665
+.L2663:
+  add r1 1 r2
+  bges r2 r4 .L2666
+  add r1 1 r1
+  shiftl r1 2 r2
+  add r5 r2 r2
+  read 0 r2 r2
+  addr2reg output_path r12
+  write 0 r12 r2
+.L2665:
+  add r1 1 r1
+  jump .L2637
+.L2666:
+  savpc r15
+  add r15 12 r15
+  jump usage
+  load 1 r1
+  jump .L2842
+.L2667:
+  addr2reg num_files r12
+  read 0 r12 r2
+  beq r2 r0 .L2839
+  addr2reg output_path r12
+  read 0 r12 r4
+  beq r4 r0 .L2838
+  addr2reg assemble_only r12
+  read 0 r12 r3
+  load 0 r1
+  beq r3 r0 .L2673
+  load 1 r1
+  load 1 r5
+  bne r2 r5 .L2672
+  addr2reg make_archive r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2672:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2673:
+  bne r1 r0 .L2836
+  addr2reg make_archive r12
+  read 0 r12 r1
+  bne r1 r0 .L2829
+  load 0 r2
+  load32 -1 r1
+  beq r3 r0 .L2677
+  write -16 r14 r2
+  write -12 r14 r1
+  jump .L2700
+.L2677:
+  load 0 r4
+  load 0 r3
+  load32 -1 r2
+  load 0 r1
+  write -28 r14 r3
+  write -24 r14 r2
+  write -32 r14 r1
+.L2679:
+  or r0 r4 r2
+  write -36 r14 r2
+  addr2reg num_files r12
+  read 0 r12 r1
+  bges r2 r1 .L2689
+  shiftl r2 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r4
+  addr2reg .Lstring.331 r5
+  savpc r15
+  add r15 12 r15
+  jump has_suffix
+  or r0 r1 r6
+  read -36 r14 r2
+  read -28 r14 r3
+  read -24 r14 r4
+  read -32 r14 r1
+  load 1 r5
+  bne r6 r0 .L2682
+  shiftl r2 2 r2
+  addr2reg file_paths r1
+  add r1 r2 r1
+  read 0 r1 r4
+  addr2reg .Lstring.330 r5
+  savpc r15
+  add r15 12 r15
+  jump has_suffix
+  or r0 r1 r5
+  read -36 r14 r2
+  read -28 r14 r3
+  or r0 r2 r4
+  read -24 r14 r2
+  read -32 r14 r1
+  xor r5 0 r5
+  sltu r0 r5 r5
+  jump .L2683
+.L2682:
+  or r0 r2 r12
+  or r0 r4 r2
+  or r0 r12 r4
+.L2683:
+  bne r5 r0 .L2686
+  add r1 1 r1
+  or r0 r4 r2
+  jump .L2687
+.L2686:
+  load 1 r3
+.L2687:
+  add r4 1 r4
+  write -28 r14 r3
+  write -24 r14 r2
+  write -32 r14 r1
+  jump .L2679
+.L2689:
+  read -28 r14 r3
+  read -24 r14 r2
+  read -32 r14 r1
+  load 0 r4
+  beq r3 r0 .L2692
+  load 1 r4
+  slt r4 r1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L2692:
+  bne r4 r0 .L2827
+  or r0 r2 r4
+  load 0 r2
+  bne r3 r0 .L2695
+  or r0 r2 r1
+  jump .L2696
+.L2695:
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2696:
+  bne r1 r0 .L2812
+  beq r3 r0 .L2699
+  load 1 r1
+  addr2reg assemble_only r12
+  write 0 r12 r1
+.L2699:
+  write -16 r14 r3
+  write -12 r14 r4
+.L2700:
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2702
+  addr2reg .Lstring.364 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2702:
+  addr2reg num_files r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  read -16 r14 r3
+  read -12 r14 r2
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2705
+  addr2reg .Lstring.365 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -16 r14 r3
+  read -12 r14 r2
+.L2705:
+  load 0 r1
+.L2706:
+  write -20 r14 r1
+  addr2reg num_files r12
+  read 0 r12 r4
+  bges r1 r4 .L2714
+  load 0 r4
+  beq r3 r0 .L2709
+  xor r1 r2 r4
+  sltu r0 r4 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L2709:
+  bne r4 r0 .L2713
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump parse_file
+  or r0 r1 r5
+  read -20 r14 r1
+  read -16 r14 r3
+  read -12 r14 r2
+  load 1 r4
+  blts r5 r0 .L2712
+  addr2reg has_error r12
+  read 0 r12 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L2712:
+  bne r4 r0 .L2833
+.L2713:
+  add r1 1 r1
+  jump .L2706
+.L2714:
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2716
+  addr2reg .Lstring.366 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2716:
+  addr2reg line_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2719
+  addr2reg .Lstring.367 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2719:
+  savpc r15
+  add r15 12 r15
+  jump pass_collect_globals
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+  savpc r15
+  add r15 12 r15
+  jump pass_find_conflicts
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2723
+  addr2reg .Lstring.368 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2723:
+  addr2reg conflict_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2726
+  addr2reg .Lstring.369 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2726:
+  savpc r15
+  add r15 12 r15
+  jump pass_rewrite_conflicts
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+  addr2reg gc_sections r12
+  read 0 r12 r1
+  beq r1 r0 .L2730
+  addr2reg assemble_only r12
+  read 0 r12 r1
+  bne r1 r0 .L2811
+  addr2reg map_path r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump pass_gc_sections
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+.L2730:
+  addr2reg peephole r12
+  read 0 r12 r1
+  beq r1 r0 .L2732
+  savpc r15
+  add r15 12 r15
+  jump pass_peephole
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+.L2732:
+  addr2reg assemble_only r12
+  read 0 r12 r1
+  bne r1 r0 .L2734
+  savpc r15
+  add r15 12 r15
+  jump prepend_header
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+.L2734:
+  savpc r15
+  add r15 12 r15
+  jump pass_expand_pseudo
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+  savpc r15
+  add r15 12 r15
+  jump pass_pack_elf
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2738
+  addr2reg .Lstring.371 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2738:
+  addr2reg line_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2741
+  addr2reg .Lstring.367 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2741:
+  savpc r15
+  add r15 12 r15
+  jump pass_remove_meta_and_sort
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+  savpc r15
+  add r15 12 r15
+  jump pass_handle_balign
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+  savpc r15
+  add r15 12 r15
+  jump pass_extract_labels
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2746
+  addr2reg .Lstring.372 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2746:
+  addr2reg label_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2749
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2749:
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2751
+  addr2reg .Lstring.373 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2751:
+  addr2reg line_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2754
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2754:
+  addr2reg dump_labels r12
+  read 0 r12 r1
+  beq r1 r0 .L2759
+  load 0 r1
+.L2756:
+  write -8 r14 r1
+  addr2reg label_count r12
+  read 0 r12 r2
+  bges r1 r2 .L2759
+  addr2reg label_addr r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r7
+  or r0 r1 r2
+  addr2reg label_names r12
+  read 0 r12 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.327 r6
+  load 128 r5
+  add r14 -180 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -28 r1
+  sub r13 r1 r13
+  add r14 -180 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -8 r14 r1
+  add r1 1 r1
+  jump .L2756
+.L2759:
+  savpc r15
+  add r15 12 r15
+  jump pass_encode
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2762
+  addr2reg .Lstring.374 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2762:
+  addr2reg output_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2765
+  addr2reg .Lstring.375 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2765:
+  addr2reg reloc_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  read -16 r14 r3
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2768
+  addr2reg .Lstring.376 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -16 r14 r3
+.L2768:
+  bne r3 r0 .L2794
+  addr2reg assemble_only r12
+  read 0 r12 r1
+  bne r1 r0 .L2784
+  savpc r15
+  add r15 12 r15
+  jump pass_append_reloc
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2833
+  addr2reg output_path r12
+  read 0 r12 r4
+  addr2reg output_words r12
+  read 0 r12 r5
+  addr2reg output_count r12
+  read 0 r12 r6
+  savpc r15
+  add r15 12 r15
+  jump write_words
+  blts r1 r0 .L2833
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2776
+  addr2reg .Lstring.362 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2776:
+  addr2reg output_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2779
+  addr2reg .Lstring.363 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2779:
+  addr2reg output_path r12
+  read 0 r12 r4
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2782
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2782:
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2833
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  jump .L2833
+.L2784:
+  addr2reg output_path r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump write_object
+  blts r1 r0 .L2833
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2787
+  addr2reg .Lstring.377 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2787:
+  addr2reg label_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2790
+  addr2reg .Lstring.378 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2790:
+  addr2reg obj_reloc_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2793
+  addr2reg .Lstring.379 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2793:
+  load 0 r1
+  jump .L2842
+.L2794:
+  add r14 -52 r4
+  savpc r15
+  add r15 12 r15
+  jump build_object
+  or r0 r1 r4
+  load 1 r1
+  beq r4 r0 .L2796
+  read -52 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump link_from_objects
+  slt r1 r0 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2796:
+  bne r1 r0 .L2833
+  addr2reg output_path r12
+  read 0 r12 r4
+  addr2reg output_words r12
+  read 0 r12 r5
+  addr2reg output_count r12
+  read 0 r12 r6
+  savpc r15
+  add r15 12 r15
+  jump write_words
+  blts r1 r0 .L2833
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2802
+  addr2reg .Lstring.362 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2802:
+  addr2reg output_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2805
+  addr2reg .Lstring.363 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2805:
+  addr2reg output_path r12
+  read 0 r12 r4
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2808
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2808:
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2810
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2810:
+  load 0 r1
+  jump .L2842
+.L2811:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.370 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  jump .L2833
+.L2812:
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump link_from_objects
+  blts r1 r0 .L2833
+  addr2reg output_path r12
+  read 0 r12 r4
+  addr2reg output_words r12
+  read 0 r12 r5
+  addr2reg output_count r12
+  read 0 r12 r6
+  savpc r15
+  add r15 12 r15
+  jump write_words
+  blts r1 r0 .L2833
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2818
+  addr2reg .Lstring.362 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2818:
+  addr2reg output_count r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vmsg_int
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2821
+  addr2reg .Lstring.363 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2821:
+  addr2reg output_path r12
+  read 0 r12 r4
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2824
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2824:
+  addr2reg verbose r12
+  read 0 r12 r1
+  beq r1 r0 .L2826
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+.L2826:
+  load 0 r1
+  jump .L2842
+.L2827:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.361 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 1 r1
+  jump .L2842
+.L2829:
+  savpc r15
+  add r15 12 r15
+  jump write_archive
+  or r0 r1 r2
+  load 1 r1
+  blts r2 r0 .L2831
+  addr2reg has_error r12
+  read 0 r12 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L2831:
+  bne r1 r0 .L2833
+  load 0 r1
+  jump .L2842
+.L2833:
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L2835
+  load 0 r1
+  jump .L2842
+.L2835:
+  addr2reg .Lstring.380 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  jump .L2842
+.L2836:
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.360 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  load 1 r1
+  jump .L2842
+.L2838:
+  savpc r15
+  add r15 12 r15
+  jump usage
+  load 1 r1
+  jump .L2842
+.L2839:
+  savpc r15
+  add r15 12 r15
+  jump usage
+  load 1 r1
+  jump .L2842
+.L2840:
+  load 1 r1
+  jump .L2842
+.L2841:
+  savpc r15
+  add r15 12 r15
+  jump usage
+  load 1 r1
+.L2842:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function asm_link_main */
+
+.data
+.balign 1
+_getcwd_buf:
+	.fill 128,1,0
+/* end data */
+
+.data
+.balign 4
+line_kind:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_text:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_section:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_file_idx:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_value:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_label:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_label_off:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_byte_off:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_byte_len:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_align:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_dir_sec:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_addr:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_flags:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+line_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+label_names:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+label_addr:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+label_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+label_file:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+label_global:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+label_sec:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+sym_name:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+sym_label:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+sym_def_file:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+sym_flags:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+sym_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+def_name:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+def_file:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+def_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+str_pool:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+str_pool_pos:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+str_pool_size:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+byte_pool:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+byte_pool_pos:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+byte_pool_size:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+output_words:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+output_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+reloc_entries:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+reloc_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+obj_relocs:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+obj_reloc_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+file_paths:
+	.fill 256,1,0
+/* end data */
+
+.data
+.balign 4
+file_prefix:
+	.fill 256,1,0
+/* end data */
+
+.data
+.balign 4
+num_files:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+output_path:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+verbose:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+has_error:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+dump_labels:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+peephole:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+assemble_only:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+make_archive:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+gc_sections:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+map_path:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+conflict_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+gc_first:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+gc_why:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+gc_queue:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+gc_sym:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+gc_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+peep_pat:
+	.fill 1280,1,0
+/* end data */
+
+.data
+.balign 4
+peep_pat_ntok:
+	.fill 320,1,0
+/* end data */
+
+.data
+.balign 4
+peep_pat_lines:
+	.fill 64,1,0
+/* end data */
+
+.data
+.balign 4
+peep_consumed:
+	.fill 64,1,0
+/* end data */
+
+.data
+.balign 4
+peep_rep:
+	.fill 1280,1,0
+/* end data */
+
+.data
+.balign 4
+peep_rep_ntok:
+	.fill 320,1,0
+/* end data */
+
+.data
+.balign 4
+peep_rep_lines:
+	.fill 64,1,0
+/* end data */
+
+.data
+.balign 4
+peep_hits:
+	.fill 64,1,0
+/* end data */
+
+.data
+.balign 1
+peep_buf:
+	.fill 2560,1,0
+/* end data */
+
+.data
+.balign 4
+peep_toks:
+	.fill 320,1,0
+/* end data */
+
+.data
+.balign 4
+peep_ntok:
+	.fill 20,1,0
+/* end data */
+
+.data
+.balign 4
+peep_slot_line:
+	.fill 20,1,0
+/* end data */
+
+.data
+.balign 1
+peep_var:
+	.fill 16,1,0
+/* end data */
+
+.data
+.balign 1
+peep_val:
+	.fill 512,1,0
+/* end data */
+
+.data
+.balign 4
+peep_nvars:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_kind:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_text:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_section:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_file_idx:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_value:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_label:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_label_off:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_byte_off:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_byte_len:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_align:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_dir_sec:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_addr:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_flags:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 1
+pack_tmp:
+	.fill 262144,1,0
+/* end data */
+
+.data
+.balign 4
+pack_len:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+pack_section:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+pack_file_idx:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+link_objs:
+	.fill 9728,1,0
+/* end data */
+
+.data
+.balign 4
+link_obj_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+link_arcs:
+	.fill 256,1,0
+/* end data */
+
+.data
+.balign 4
+link_arc_count:
+	.fill 4,1,0
+/* end data */
+
+
+.text
+; function emsg
+emsg:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emsg */
+
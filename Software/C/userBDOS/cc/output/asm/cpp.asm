@@ -0,0 +1,7204 @@
+
+.text
+; function out_write
+out_write:
+  or r0 r5 r6
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg out_fp r12
+  read 0 r12 r7
+  bne r7 r0 .L4
+  bles r6 r0 .L5
+  or r0 r4 r1
+  addr2reg out_fd r12
+  read 0 r12 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump sys_write
+  jump .L5
+.L4:
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump fwrite
+.L5:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function out_write */
+
+
+.text
+; function out_text
+out_text:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r1
+.L9:
+  write -16 r14 r1
+  readb 0 r1 r2
+  beq r2 r0 .L13
+  load 1 r3
+  bne r2 r3 .L12
+  sub r1 r4 r5
+  savpc r15
+  add r15 12 r15
+  jump out_write
+  read -16 r14 r4
+  or r0 r4 r1
+  add r4 1 r4
+.L12:
+  add r1 1 r1
+  jump .L9
+.L13:
+  sub r1 r4 r5
+  savpc r15
+  add r15 12 r15
+  jump out_write
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function out_text */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "cpp: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii ":%d: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "\012\000"
+/* end data */
+
+
+.text
+; function emsg
+emsg:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 88 r13
+  write -16 r14 r4
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -16 r14 r4
+  or r0 r4 r1
+  addr2reg cur_filename r12
+  read 0 r12 r4
+  bne r4 r0 .L19
+  or r0 r1 r4
+  jump .L20
+.L19:
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg cur_line r12
+  read 0 r12 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.7 r6
+  load 64 r5
+  add r14 -80 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  add r14 -80 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -16 r14 r4
+.L20:
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emsg */
+
+
+.text
+; function emsg2
+emsg2:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 88 r13
+  write -16 r14 r5
+  write -12 r14 r4
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -12 r14 r4
+  or r0 r4 r1
+  addr2reg cur_filename r12
+  read 0 r12 r4
+  bne r4 r0 .L26
+  or r0 r1 r4
+  jump .L27
+.L26:
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg cur_line r12
+  read 0 r12 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.7 r6
+  load 64 r5
+  add r14 -80 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  add r14 -80 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -12 r14 r4
+.L27:
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  addr2reg has_error r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emsg2 */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "string pool exhausted\000"
+/* end data */
+
+
+.text
+; function pool_strndup
+pool_strndup:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r5 r2
+  or r0 r4 r5
+  write -16 r14 r2
+  addr2reg str_pool_pos r12
+  read 0 r12 r3
+  add r3 r2 r1
+  add r1 1 r1
+  addr2reg str_pool_size r12
+  read 0 r12 r4
+  bgts r1 r4 .L33
+  addr2reg str_pool r12
+  read 0 r12 r1
+  add r1 r3 r1
+  write -12 r14 r1
+  or r0 r2 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -12 r14 r1
+  read -16 r14 r5
+  add r1 r5 r3
+  load 0 r2
+  writeb 0 r3 r2
+  addr2reg str_pool_pos r12
+  read 0 r12 r2
+  add r5 1 r3
+  add r2 r3 r2
+  addr2reg str_pool_pos r12
+  write 0 r12 r2
+  jump .L34
+.L33:
+  addr2reg .Lstring.11 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load 0 r1
+.L34:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pool_strndup */
+
+
+.text
+; function pool_alloc
+pool_alloc:
+  addr2reg str_pool_pos r12
+  read 0 r12 r1
+  add r1 3 r1
+  load32 -4 r2
+  and r1 r2 r2
+  addr2reg str_pool_pos r12
+  write 0 r12 r2
+  add r2 r4 r1
+  addr2reg str_pool_size r12
+  read 0 r12 r3
+  bgts r1 r3 .L39
+  addr2reg str_pool r12
+  read 0 r12 r1
+  add r1 r2 r1
+  add r2 r4 r2
+  addr2reg str_pool_pos r12
+  write 0 r12 r2
+  jumpr 0 r15
+.L39:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lstring.11 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load 0 r1
+.L40:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function pool_alloc */
+
+
+.text
+; function name_hash
+name_hash:
+  load 5381 r1
+.L44:
+  load 1 r3
+  or r0 r5 r2
+  sub r5 r3 r5
+  bles r2 r0 .L46
+  shiftl r1 5 r2
+  add r2 r1 r1
+  or r0 r4 r2
+  add r4 1 r4
+  readb 0 r2 r2
+  and r2 0xFF r2
+  add r1 r2 r1
+  jump .L44
+.L46:
+  jumpr 0 r15
+
+/* end function name_hash */
+
+
+.text
+; function macro_find
+macro_find:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -20 r14 r6
+  write -24 r14 r5
+  write -16 r14 r4
+  and r6 1023 r1
+  shiftl r1 2 r2
+  addr2reg macro_heads r1
+  add r1 r2 r1
+  read 0 r1 r1
+  load 1 r2
+  sub r1 r2 r1
+.L50:
+  write -28 r14 r1
+  blts r1 r0 .L60
+  load 28 r2
+  mults r1 r2 r3
+  addr2reg macros r2
+  add r2 r3 r2
+  write -32 r14 r2
+  add r2 8 r3
+  read 0 r3 r7
+  load 0 r3
+  beq r7 r6 .L53
+  or r0 r3 r7
+  jump .L54
+.L53:
+  add r2 4 r3
+  read 0 r3 r3
+  xor r3 r5 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r7
+.L54:
+  load 0 r3
+  bne r7 r0 .L56
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L57
+.L56:
+  or r0 r4 r1
+  read 0 r2 r4
+  or r0 r5 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  or r0 r1 r3
+  read -28 r14 r1
+  or r0 r1 r2
+  read -32 r14 r1
+  read -20 r14 r6
+  read -24 r14 r5
+  read -16 r14 r4
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L57:
+  bne r3 r0 .L59
+  add r1 12 r1
+  read 0 r1 r1
+  load 1 r2
+  sub r1 r2 r1
+  jump .L50
+.L59:
+  or r0 r2 r1
+  jump .L61
+.L60:
+  load32 -1 r1
+.L61:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function macro_find */
+
+
+.text
+; function macro_lookup
+macro_lookup:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump name_hash
+  or r0 r1 r6
+  read -12 r14 r5
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump macro_find
+  load 0 r2
+  blts r1 r0 .L66
+  load 28 r2
+  mults r1 r2 r3
+  addr2reg macros r2
+  add r2 r3 r2
+  add r2 20 r2
+  read 0 r2 r2
+  load32 -2 r3
+  xor r2 r3 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L66:
+  beq r2 r0 .L68
+  load32 -1 r1
+.L68:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function macro_lookup */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "too many macros\000"
+/* end data */
+
+
+.text
+; function macro_define
+macro_define:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  read 8 r14 r1
+  write -20 r14 r1
+  write -24 r14 r7
+  write -16 r14 r6
+  or r0 r5 r2
+  write -12 r14 r2
+  write -4 r14 r4
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump name_hash
+  or r0 r1 r3
+  read -12 r14 r2
+  read -4 r14 r4
+  write -8 r14 r3
+  or r0 r3 r6
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump macro_find
+  read -16 r14 r4
+  read -12 r14 r2
+  or r0 r4 r3
+  read -4 r14 r4
+  blts r1 r0 .L73
+  or r0 r3 r4
+  jump .L76
+.L73:
+  addr2reg macro_count r12
+  read 0 r12 r1
+  load 2048 r3
+  bges r1 r3 .L89
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump pool_strndup
+  or r0 r1 r6
+  read -8 r14 r3
+  read -16 r14 r4
+  read -12 r14 r2
+  beq r6 r0 .L88
+  addr2reg macro_count r12
+  read 0 r12 r1
+  add r1 1 r5
+  addr2reg macro_count r12
+  write 0 r12 r5
+  load 28 r5
+  mults r1 r5 r7
+  addr2reg macros r5
+  add r5 r7 r5
+  write 0 r5 r6
+  add r5 4 r6
+  write 0 r6 r2
+  add r5 8 r2
+  write 0 r2 r3
+  and r3 1023 r2
+  shiftl r2 2 r6
+  addr2reg macro_heads r2
+  add r2 r6 r2
+  read 0 r2 r2
+  add r5 12 r5
+  write 0 r5 r2
+  add r1 1 r2
+  and r3 1023 r3
+  shiftl r3 2 r5
+  addr2reg macro_heads r3
+  add r3 r5 r3
+  write 0 r3 r2
+.L76:
+  write -32 r14 r1
+  load 28 r2
+  mults r1 r2 r2
+  addr2reg macros r1
+  add r1 r2 r2
+  write -28 r14 r2
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strndup
+  or r0 r1 r4
+  read -32 r14 r1
+  read -28 r14 r2
+  read -24 r14 r3
+  add r2 16 r5
+  write 0 r5 r4
+  beq r4 r0 .L87
+  add r2 20 r2
+  write 0 r2 r3
+  bles r3 r0 .L90
+  shiftl r3 2 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_alloc
+  read -28 r14 r2
+  read -20 r14 r4
+  read -24 r14 r3
+  add r2 24 r5
+  write 0 r5 r1
+  beq r1 r0 .L86
+  load 0 r1
+.L82:
+  bges r1 r3 .L85
+  shiftl r1 2 r5
+  add r4 r5 r5
+  read 0 r5 r5
+  add r2 24 r6
+  read 0 r6 r6
+  shiftl r1 2 r7
+  add r6 r7 r6
+  write 0 r6 r5
+  add r1 1 r1
+  jump .L82
+.L85:
+  read -32 r14 r1
+  jump .L90
+.L86:
+  load32 -1 r1
+  jump .L90
+.L87:
+  load32 -1 r1
+  jump .L90
+.L88:
+  load32 -1 r1
+  jump .L90
+.L89:
+  addr2reg .Lstring.18 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load32 -1 r1
+.L90:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function macro_define */
+
+
+.text
+; function is_id_start
+is_id_start:
+  load 1 r1
+  load 95 r2
+  beq r4 r2 .L97
+  load 0 r1
+  load 97 r2
+  blts r4 r2 .L96
+  load 122 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L96:
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L98
+.L97:
+  or r0 r1 r2
+.L98:
+  load 1 r1
+  bne r2 r0 .L102
+  load 0 r1
+  load 65 r2
+  blts r4 r2 .L101
+  load 90 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L101:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L102:
+  jumpr 0 r15
+
+/* end function is_id_start */
+
+
+.text
+; function is_id_cont
+is_id_cont:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_start
+  or r0 r1 r2
+  read -16 r14 r4
+  load 1 r1
+  bne r2 r0 .L109
+  load 0 r1
+  load 48 r2
+  blts r4 r2 .L108
+  load 57 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L108:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L109:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function is_id_cont */
+
+
+.text
+; function skip_hws
+skip_hws:
+  or r0 r4 r1
+  or r0 r1 r4
+.L113:
+  readb 0 r4 r1
+  load 1 r2
+  load 32 r3
+  beq r1 r3 .L115
+  xor r1 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L116
+.L115:
+  or r0 r2 r1
+.L116:
+  beq r1 r0 .L118
+  add r4 1 r4
+  jump .L113
+.L118:
+  or r0 r4 r1
+  jumpr 0 r15
+
+/* end function skip_hws */
+
+
+.text
+; function load_file
+load_file:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -24 r14 r5
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump sys_open
+  or r0 r1 r4
+  write -20 r14 r4
+  blts r4 r0 .L132
+  load 2 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump sys_lseek
+  write -16 r14 r1
+  read -20 r14 r4
+  load 0 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump sys_lseek
+  read -16 r14 r6
+  read -20 r14 r4
+  blts r6 r0 .L131
+  add r6 1 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  read -16 r14 r6
+  read -20 r14 r4
+  write -32 r14 r1
+  beq r1 r0 .L130
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump sys_read
+  write -28 r14 r1
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  read -28 r14 r2
+  read -32 r14 r1
+  read -24 r14 r5
+  blts r2 r0 .L129
+  add r1 r2 r4
+  load 0 r3
+  writeb 0 r4 r3
+  beq r5 r0 .L133
+  write 0 r5 r2
+  jump .L133
+.L129:
+  load 0 r1
+  jump .L133
+.L130:
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  load 0 r1
+  jump .L133
+.L131:
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  load 0 r1
+  jump .L133
+.L132:
+  load 0 r1
+.L133:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function load_file */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "%s/%s\000"
+/* end data */
+
+
+.text
+; function resolve_include
+resolve_include:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r5 r2
+  or r0 r4 r5
+  write -4 r14 r7
+  write -12 r14 r6
+  write -8 r14 r5
+  load 0 r1
+  beq r2 r0 .L138
+  addr2reg include_depth r12
+  read 0 r12 r2
+  load 0 r1
+  slt r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L138:
+  beq r1 r0 .L144
+  addr2reg include_depth r12
+  read 0 r12 r1
+  load 1 r2
+  sub r1 r2 r1
+  shiftl r1 2 r2
+  addr2reg quote_dir_stack r1
+  add r1 r2 r1
+  or r0 r7 r2
+  read 0 r1 r7
+  load 0 r1
+  beq r7 r0 .L141
+  add r7 0 r1
+  readb 0 r1 r1
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L141:
+  bne r1 r0 .L143
+  or r0 r2 r7
+  jump .L144
+.L143:
+  load 28 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 24 r1
+  write 0 r1 r5
+  or r0 r6 r1
+  addr2reg .Lstring.24 r6
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  read -12 r14 r6
+  load32 -28 r1
+  sub r13 r1 r13
+  load 1 r5
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_open
+  or r0 r1 r4
+  read -4 r14 r7
+  read -12 r14 r6
+  read -8 r14 r5
+  bges r4 r0 .L155
+.L144:
+  load 0 r1
+  or r0 r5 r4
+.L146:
+  write -16 r14 r1
+  addr2reg include_dir_count r12
+  read 0 r12 r2
+  bges r1 r2 .L151
+  shiftl r1 2 r2
+  addr2reg include_dirs r1
+  add r1 r2 r1
+  or r0 r7 r2
+  read 0 r1 r7
+  load 28 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 24 r1
+  write 0 r1 r4
+  or r0 r6 r1
+  addr2reg .Lstring.24 r6
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  read -12 r14 r6
+  load32 -28 r1
+  sub r13 r1 r13
+  load 1 r5
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_open
+  or r0 r1 r2
+  read -16 r14 r1
+  read -4 r14 r7
+  read -12 r14 r6
+  read -8 r14 r4
+  bges r2 r0 .L149
+  add r1 1 r1
+  jump .L146
+.L149:
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  load 0 r1
+  jump .L156
+.L151:
+  or r0 r4 r5
+  or r0 r5 r1
+  load 1 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_open
+  or r0 r1 r4
+  bges r4 r0 .L154
+  load32 -1 r1
+  jump .L156
+.L154:
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  read -4 r14 r7
+  read -12 r14 r6
+  read -8 r14 r5
+  or r0 r6 r1
+  or r0 r7 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strncpy
+  read -4 r14 r7
+  read -12 r14 r6
+  load 1 r1
+  sub r7 r1 r1
+  add r6 r1 r2
+  load 0 r1
+  writeb 0 r2 r1
+  load 0 r1
+  jump .L156
+.L155:
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+  load 0 r1
+.L156:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function resolve_include */
+
+
+.text
+; function path_dirname
+path_dirname:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -4 r14 r6
+  write -16 r14 r5
+  or r0 r4 r5
+  write -8 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  read -4 r14 r6
+  read -16 r14 r5
+  or r0 r5 r2
+  read -8 r14 r5
+  load 1 r3
+  sub r1 r3 r1
+  or r0 r5 r4
+  or r0 r2 r5
+.L161:
+  blts r1 r0 .L165
+  add r4 r1 r2
+  readb 0 r2 r2
+  load 47 r3
+  beq r2 r3 .L164
+  load 1 r2
+  sub r1 r2 r1
+  jump .L161
+.L164:
+  or r0 r5 r2
+  or r0 r4 r5
+  jump .L166
+.L165:
+  or r0 r5 r2
+  or r0 r4 r5
+.L166:
+  blts r1 r0 .L172
+  bges r1 r6 .L169
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L171
+.L169:
+  or r0 r2 r1
+  load 1 r2
+  sub r6 r2 r2
+.L171:
+  write -12 r14 r2
+  or r0 r2 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -12 r14 r1
+  read -16 r14 r5
+  add r5 r1 r2
+  load 0 r1
+  writeb 0 r2 r1
+  jump .L174
+.L172:
+  or r0 r2 r5
+  add r5 0 r2
+  load 0 r1
+  writeb 0 r2 r1
+.L174:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function path_dirname */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "line too long\000"
+/* end data */
+
+
+.text
+; function read_logical_line
+read_logical_line:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  write -36 r14 r8
+  write -32 r14 r7
+  write -12 r14 r6
+  or r0 r4 r1
+  write -16 r14 r5
+  readb 0 r1 r2
+  beq r2 r0 .L195
+  load 0 r3
+  load 0 r2
+  or r0 r1 r4
+  or r0 r3 r1
+.L180:
+  write -28 r14 r4
+  write -24 r14 r1
+  write -20 r14 r2
+  readb 0 r4 r3
+  beq r3 r0 .L191
+  load 0 r7
+  load 92 r6
+  xor r3 r6 r8
+  sltu r8 1 r8
+  read -12 r14 r6
+  beq r8 r0 .L183
+  add r4 1 r7
+  readb 0 r7 r7
+  xor r7 10 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L183:
+  bne r7 r0 .L190
+  load 10 r7
+  beq r3 r7 .L188
+  load 1 r7
+  sub r6 r7 r7
+  bges r1 r7 .L187
+  add r4 1 r4
+  or r0 r1 r7
+  add r1 1 r1
+  add r5 r7 r7
+  writeb 0 r7 r3
+  jump .L180
+.L187:
+  addr2reg .Lstring.27 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  read -28 r14 r1
+  read -24 r14 r3
+  read -20 r14 r2
+  read -32 r14 r7
+  read -16 r14 r5
+  jump .L192
+.L188:
+  or r0 r1 r3
+  or r0 r4 r1
+  read -32 r14 r7
+  or r0 r1 r4
+  add r1 1 r1
+  add r2 1 r2
+  jump .L192
+.L190:
+  add r4 2 r4
+  add r2 1 r2
+  jump .L180
+.L191:
+  or r0 r1 r3
+  read -32 r14 r7
+  or r0 r4 r1
+.L192:
+  add r5 r3 r4
+  load 0 r3
+  writeb 0 r4 r3
+  bne r2 r0 .L194
+  load 1 r2
+.L194:
+  write 0 r7 r2
+  jump .L196
+.L195:
+  load 0 r1
+.L196:
+  read -36 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function read_logical_line */
+
+
+.text
+; function strip_comments
+strip_comments:
+  or r0 r4 r3
+  read 0 r5 r1
+  beq r1 r0 .L212
+  or r0 r3 r1
+  or r0 r3 r4
+.L201:
+  readb 0 r4 r2
+  load 0 r3
+  beq r2 r0 .L205
+  add r4 0 r3
+  readb 0 r3 r6
+  load 0 r3
+  load 42 r7
+  bne r6 r7 .L204
+  add r4 1 r3
+  readb 0 r3 r3
+  xor r3 47 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L204:
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L205:
+  beq r3 r0 .L207
+  add r4 1 r4
+  jump .L201
+.L207:
+  or r0 r1 r3
+  or r0 r2 r1
+  or r0 r4 r2
+  bne r1 r0 .L210
+  load 0 r1
+  writeb 0 r3 r1
+  jump .L257
+.L210:
+  or r0 r2 r4
+  add r2 2 r2
+  load 0 r1
+  write 0 r5 r1
+  add r3 1 r1
+  load 32 r4
+  writeb 0 r3 r4
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L213
+.L212:
+  or r0 r3 r1
+  or r0 r3 r2
+.L213:
+  or r0 r1 r4
+.L214:
+  readb 0 r4 r3
+  beq r3 r0 .L256
+  load 1 r1
+  load 34 r6
+  beq r3 r6 .L217
+  xor r3 39 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L217:
+  bne r1 r0 .L240
+  add r4 0 r1
+  readb 0 r1 r6
+  load 0 r1
+  load 47 r7
+  bne r6 r7 .L220
+  add r4 1 r1
+  readb 0 r1 r1
+  xor r1 47 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L220:
+  bne r1 r0 .L239
+  add r4 0 r1
+  readb 0 r1 r6
+  load 0 r1
+  load 47 r7
+  bne r6 r7 .L223
+  add r4 1 r1
+  readb 0 r1 r1
+  xor r1 42 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L223:
+  bne r1 r0 .L226
+  or r0 r4 r1
+  add r4 1 r4
+  add r2 1 r1
+  writeb 0 r2 r3
+  or r0 r1 r2
+  jump .L214
+.L226:
+  or r0 r4 r1
+  or r0 r2 r4
+  add r1 2 r1
+.L228:
+  readb 0 r1 r2
+  load 0 r3
+  beq r2 r0 .L232
+  add r1 0 r3
+  readb 0 r3 r6
+  load 0 r3
+  load 42 r7
+  bne r6 r7 .L231
+  add r1 1 r3
+  readb 0 r3 r3
+  xor r3 47 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L231:
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L232:
+  beq r3 r0 .L234
+  add r1 1 r1
+  jump .L228
+.L234:
+  beq r2 r0 .L237
+  or r0 r4 r3
+  add r1 2 r4
+  add r3 1 r1
+  load 32 r2
+  writeb 0 r3 r2
+  or r0 r1 r2
+  jump .L214
+.L237:
+  or r0 r4 r2
+  load 1 r1
+  write 0 r5 r1
+  or r0 r2 r1
+  add r2 1 r2
+  load 32 r3
+  writeb 0 r1 r3
+  load 0 r1
+  writeb 0 r2 r1
+  jump .L257
+.L239:
+  load 0 r1
+  writeb 0 r4 r1
+  jump .L256
+.L240:
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  add r4 1 r4
+  add r3 1 r1
+  writeb 0 r3 r2
+.L242:
+  or r0 r1 r3
+  readb 0 r4 r6
+  load 0 r1
+  beq r6 r0 .L244
+  xor r6 r2 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L244:
+  beq r1 r0 .L251
+  load 0 r1
+  load 92 r7
+  bne r6 r7 .L247
+  add r4 1 r1
+  readb 0 r1 r1
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L247:
+  bne r1 r0 .L249
+  or r0 r4 r1
+  add r4 1 r4
+  add r3 1 r1
+  writeb 0 r3 r6
+  jump .L242
+.L249:
+  or r0 r4 r1
+  or r0 r3 r4
+  or r0 r6 r3
+  add r1 1 r1
+  add r4 1 r6
+  writeb 0 r4 r3
+  add r1 1 r4
+  readb 0 r1 r3
+  add r6 1 r1
+  writeb 0 r6 r3
+  jump .L242
+.L251:
+  bne r6 r0 .L253
+  or r0 r4 r1
+  or r0 r3 r4
+  jump .L255
+.L253:
+  add r4 1 r4
+  add r3 1 r1
+  writeb 0 r3 r6
+  or r0 r4 r12
+  or r0 r1 r4
+  or r0 r12 r1
+.L255:
+  or r0 r4 r2
+  or r0 r1 r4
+  jump .L214
+.L256:
+  load 0 r1
+  writeb 0 r2 r1
+.L257:
+  jumpr 0 r15
+
+/* end function strip_comments */
+
+
+.text
+; function param_index
+param_index:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -24 r14 r7
+  write -16 r14 r6
+  write -28 r14 r5
+  write -20 r14 r4
+  load 0 r1
+.L261:
+  write -32 r14 r1
+  bges r1 r6 .L266
+  shiftl r1 2 r1
+  add r7 r1 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  or r0 r5 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r3
+  read -32 r14 r1
+  read -24 r14 r7
+  read -16 r14 r6
+  read -28 r14 r5
+  read -20 r14 r4
+  load 0 r2
+  bne r3 r0 .L264
+  shiftl r1 2 r2
+  add r7 r2 r2
+  read 0 r2 r2
+  add r2 r5 r2
+  readb 0 r2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L264:
+  bne r2 r0 .L267
+  add r1 1 r1
+  jump .L261
+.L266:
+  load32 -1 r1
+.L267:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function param_index */
+
+
+.text
+; function put_arg
+put_arg:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 28 r13
+  write -20 r14 r8
+  read 8 r14 r8
+  or r0 r7 r1
+  or r0 r5 r3
+  or r0 r4 r2
+  or r0 r6 r4
+  write -16 r14 r1
+  read 0 r1 r1
+.L271:
+  readb 0 r2 r5
+  beq r5 r0 .L279
+  load 0 r6
+  beq r3 r0 .L274
+  xor r5 1 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L274:
+  bne r6 r0 .L278
+  add r1 1 r6
+  bges r6 r8 .L277
+  or r0 r1 r6
+  add r1 1 r1
+  add r4 r6 r6
+  writeb 0 r6 r5
+  jump .L278
+.L277:
+  load32 -1 r1
+  jump .L281
+.L278:
+  add r2 1 r2
+  jump .L271
+.L279:
+  read -16 r14 r2
+  write 0 r2 r1
+  load 0 r1
+.L281:
+  read -20 r14 r8
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function put_arg */
+
+
+.text
+; function stringify
+stringify:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 28 r13
+  write -20 r14 r8
+  write -12 r14 r7
+  write -16 r14 r6
+  read 0 r6 r1
+  add r1 1 r2
+  bges r2 r7 .L334
+  add r1 1 r2
+  add r5 r1 r3
+  load 34 r1
+  writeb 0 r3 r1
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L287:
+  or r0 r2 r3
+  readb 0 r4 r2
+  beq r2 r0 .L332
+  load 1 r6
+  beq r2 r6 .L330
+  add r1 4 r6
+  bges r6 r7 .L329
+  shiftl r3 24 r7
+  shiftrs r7 24 r7
+  load 0 r6
+  bne r7 r0 .L294
+  load 1 r6
+  load 32 r7
+  beq r2 r7 .L293
+  xor r2 9 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L293:
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L294:
+  bne r6 r0 .L322
+  shiftl r3 24 r7
+  shiftrs r7 24 r7
+  load 0 r6
+  bne r7 r0 .L297
+  or r0 r6 r7
+  jump .L298
+.L297:
+  xor r2 92 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r7
+.L298:
+  load 0 r6
+  beq r7 r0 .L300
+  add r4 1 r6
+  readb 0 r6 r6
+  and r6 0xFF r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L300:
+  bne r6 r0 .L316
+  shiftl r3 24 r7
+  shiftrs r7 24 r7
+  load 0 r6
+  xor r7 r0 r8
+  sltu r8 1 r8
+  read -12 r14 r7
+  beq r8 r0 .L305
+  load 1 r6
+  load 34 r7
+  xor r2 r7 r8
+  sltu r8 1 r8
+  read -12 r14 r7
+  bne r8 r0 .L304
+  xor r2 39 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L304:
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L305:
+  bne r6 r0 .L311
+  shiftl r3 24 r8
+  shiftrs r8 24 r8
+  load 0 r6
+  read -12 r14 r7
+  beq r8 r0 .L308
+  shiftl r3 24 r6
+  shiftrs r6 24 r6
+  xor r2 r6 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L308:
+  bne r6 r0 .L310
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  jump .L313
+.L310:
+  or r0 r2 r3
+  load 0 r2
+  jump .L313
+.L311:
+  or r0 r2 r3
+  or r0 r3 r2
+.L313:
+  load 34 r6
+  bne r3 r6 .L315
+  or r0 r1 r6
+  add r1 1 r1
+  add r5 r6 r7
+  load 92 r6
+  writeb 0 r7 r6
+  read -12 r14 r7
+.L315:
+  or r0 r1 r6
+  add r1 1 r1
+  add r5 r6 r6
+  writeb 0 r6 r3
+  jump .L331
+.L316:
+  or r0 r3 r2
+  or r0 r1 r3
+  add r1 1 r1
+  add r5 r3 r6
+  load 92 r3
+  writeb 0 r6 r3
+  add r1 1 r6
+  add r5 r1 r3
+  load 92 r1
+  writeb 0 r3 r1
+  add r4 1 r4
+  readb 0 r4 r3
+  load 1 r1
+  load 34 r7
+  xor r3 r7 r8
+  sltu r8 1 r8
+  read -12 r14 r7
+  bne r8 r0 .L319
+  xor r3 92 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L319:
+  beq r1 r0 .L321
+  or r0 r6 r1
+  add r6 1 r6
+  add r5 r1 r7
+  load 92 r1
+  writeb 0 r7 r1
+  read -12 r14 r7
+.L321:
+  add r6 1 r1
+  add r5 r6 r6
+  writeb 0 r6 r3
+  jump .L331
+.L322:
+  or r0 r3 r2
+.L323:
+  add r4 1 r3
+  readb 0 r3 r6
+  load 1 r3
+  load 32 r7
+  beq r6 r7 .L325
+  add r4 1 r3
+  readb 0 r3 r3
+  xor r3 9 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L325:
+  beq r3 r0 .L327
+  add r4 1 r4
+  jump .L323
+.L327:
+  read -12 r14 r7
+  or r0 r1 r3
+  add r1 1 r1
+  add r5 r3 r6
+  load 32 r3
+  writeb 0 r6 r3
+  jump .L331
+.L329:
+  load32 -1 r1
+  jump .L335
+.L330:
+  or r0 r3 r2
+.L331:
+  add r4 1 r4
+  jump .L287
+.L332:
+  or r0 r1 r2
+  read -16 r14 r6
+  add r2 1 r1
+  add r5 r2 r3
+  load 34 r2
+  writeb 0 r3 r2
+  write 0 r6 r1
+  load 0 r1
+  jump .L335
+.L334:
+  load32 -1 r1
+.L335:
+  read -20 r14 r8
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function stringify */
+
+
+.text
+; function substitute_params
+substitute_params:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 144 r13
+  write -136 r14 r8
+  read 20 r14 r1
+  write -80 r14 r1
+  read 16 r14 r3
+  write -108 r14 r3
+  read 12 r14 r2
+  write -84 r14 r2
+  read 8 r14 r3
+  write -112 r14 r3
+  read -108 r14 r3
+  write -116 r14 r7
+  write -120 r14 r6
+  write -124 r14 r5
+  read 0 r3 r3
+  write -128 r14 r3
+  write -132 r14 r3
+  load 0 r5
+  write -76 r14 r5
+.L340:
+  write -96 r14 r4
+  readb 0 r4 r6
+  beq r6 r0 .L434
+  load 1 r5
+  load 34 r7
+  beq r6 r7 .L343
+  xor r6 39 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L343:
+  bne r5 r0 .L410
+  add r4 0 r5
+  readb 0 r5 r5
+  load 0 r7
+  write -8 r14 r7
+  load 35 r7
+  xor r5 r7 r8
+  sltu r8 1 r8
+  read -124 r14 r5
+  read -8 r14 r7
+  beq r8 r0 .L346
+  add r4 1 r7
+  readb 0 r7 r7
+  xor r7 35 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L346:
+  bne r7 r0 .L400
+  or r0 r6 r2
+  load 0 r1
+  load 35 r3
+  bne r2 r3 .L350
+  slt r5 r0 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L350:
+  beq r1 r0 .L365
+  or r0 r4 r3
+  add r4 1 r4
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  or r0 r1 r8
+  write -72 r14 r8
+  or r0 r8 r3
+.L353:
+  write -64 r14 r3
+  readb 0 r3 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  read -64 r14 r3
+  beq r1 r0 .L355
+  add r3 1 r3
+  jump .L353
+.L355:
+  or r0 r3 r4
+  read -96 r14 r3
+  read -72 r14 r8
+  read -80 r14 r1
+  read -84 r14 r2
+  read -124 r14 r5
+  load 0 r6
+  write -12 r14 r6
+  sltu r8 r4 r7
+  read -12 r14 r6
+  bne r7 r0 .L358
+  write -16 r14 r6
+  jump .L360
+.L358:
+  readb 0 r8 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_start
+  or r0 r1 r6
+  read -64 r14 r4
+  read -96 r14 r3
+  read -72 r14 r8
+  read -80 r14 r2
+  or r0 r2 r1
+  read -84 r14 r2
+  read -124 r14 r5
+  xor r6 0 r6
+  sltu r0 r6 r7
+  write -16 r14 r7
+.L360:
+  load32 -1 r6
+  write -20 r14 r6
+  read -16 r14 r7
+  read -120 r14 r6
+  bne r7 r0 .L362
+  or r0 r3 r4
+  read -116 r14 r7
+  read -20 r14 r3
+  jump .L364
+.L362:
+  or r0 r4 r2
+  or r0 r8 r4
+  or r0 r5 r1
+  sub r2 r4 r5
+  or r0 r6 r7
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump param_index
+  or r0 r1 r3
+  read -96 r14 r4
+  read -80 r14 r2
+  or r0 r2 r1
+  read -84 r14 r2
+  read -116 r14 r7
+.L364:
+  bges r3 r0 .L395
+.L365:
+  readb 0 r4 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_start
+  or r0 r1 r6
+  read -96 r14 r4
+  read -128 r14 r3
+  read -80 r14 r2
+  or r0 r2 r1
+  read -84 r14 r2
+  read -124 r14 r5
+  beq r6 r0 .L391
+  or r0 r4 r3
+.L367:
+  write -52 r14 r3
+  readb 0 r3 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  read -52 r14 r3
+  beq r1 r0 .L369
+  add r3 1 r3
+  jump .L367
+.L369:
+  or r0 r3 r1
+  read -96 r14 r4
+  read -120 r14 r6
+  read -124 r14 r5
+  sub r1 r4 r8
+  write -36 r14 r8
+  or r0 r6 r7
+  or r0 r5 r6
+  or r0 r8 r5
+  or r0 r4 r3
+  savpc r15
+  add r15 12 r15
+  jump param_index
+  or r0 r1 r3
+  read -52 r14 r4
+  or r0 r3 r5
+  read -96 r14 r3
+  read -36 r14 r8
+  read -80 r14 r2
+  or r0 r2 r1
+  read -84 r14 r2
+  write -40 r14 r5
+  bges r5 r0 .L376
+  or r0 r3 r4
+  read -132 r14 r3
+  add r3 r8 r5
+  bges r5 r1 .L375
+  or r0 r4 r1
+  add r2 r3 r4
+  or r0 r8 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -52 r14 r4
+  read -36 r14 r8
+  read -128 r14 r3
+  read -80 r14 r2
+  read -84 r14 r1
+  read -124 r14 r5
+  read -132 r14 r6
+  add r6 r8 r7
+  read -120 r14 r6
+  write -132 r14 r7
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  jump .L388
+.L375:
+  load32 -1 r1
+  jump .L436
+.L376:
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  or r0 r1 r5
+  read -76 r14 r8
+  read -40 r14 r3
+  read -80 r14 r2
+  read -84 r14 r1
+  read -116 r14 r7
+  load 1 r6
+  read -112 r14 r4
+  bne r8 r0 .L381
+  add r5 0 r4
+  readb 0 r4 r4
+  load 0 r6
+  write -44 r14 r6
+  load 35 r6
+  xor r4 r6 r8
+  sltu r8 1 r8
+  read -44 r14 r6
+  or r0 r3 r4
+  read -112 r14 r3
+  bne r8 r0 .L379
+  or r0 r6 r5
+  jump .L380
+.L379:
+  add r5 1 r5
+  readb 0 r5 r5
+  xor r5 35 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L380:
+  xor r5 0 r5
+  sltu r0 r5 r5
+  jump .L382
+.L381:
+  or r0 r3 r12
+  or r0 r4 r3
+  or r0 r12 r4
+  or r0 r6 r5
+.L382:
+  bne r5 r0 .L386
+  shiftl r4 2 r4
+  add r3 r4 r3
+  read 0 r3 r4
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r14 -132 r7
+  or r0 r1 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump put_arg
+  write -48 r14 r1
+  read -52 r14 r4
+  read -128 r14 r3
+  read -80 r14 r2
+  read -84 r14 r1
+  read -120 r14 r6
+  read -124 r14 r5
+  load32 -12 r7
+  sub r13 r7 r13
+  read -48 r14 r7
+  blts r7 r0 .L385
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  jump .L388
+.L385:
+  load32 -1 r1
+  jump .L436
+.L386:
+  or r0 r4 r3
+  shiftl r3 2 r3
+  add r7 r3 r3
+  read 0 r3 r4
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r14 -132 r7
+  or r0 r1 r6
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump put_arg
+  write -56 r14 r1
+  read -52 r14 r4
+  or r0 r4 r3
+  read -128 r14 r4
+  read -80 r14 r2
+  read -84 r14 r1
+  read -120 r14 r6
+  read -124 r14 r5
+  load32 -12 r7
+  sub r13 r7 r13
+  read -56 r14 r7
+  blts r7 r0 .L390
+.L388:
+  load 0 r7
+  write -60 r14 r7
+  read -116 r14 r7
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  read -60 r14 r12
+  write -76 r14 r12
+  jump .L340
+.L390:
+  load32 -1 r1
+  jump .L436
+.L391:
+  read -132 r14 r7
+  add r7 1 r6
+  bges r6 r1 .L394
+  add r4 1 r8
+  write -28 r14 r8
+  readb 0 r4 r4
+  write -24 r14 r4
+  read -120 r14 r6
+  add r7 1 r4
+  write -132 r14 r4
+  read -24 r14 r4
+  add r2 r7 r7
+  writeb 0 r7 r4
+  read -116 r14 r7
+  load 0 r4
+  write -32 r14 r4
+  read -28 r14 r4
+  read -32 r14 r12
+  write -76 r14 r12
+  jump .L340
+.L394:
+  load32 -1 r1
+  jump .L436
+.L395:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  shiftl r3 2 r3
+  add r7 r3 r3
+  read 0 r3 r4
+  or r0 r2 r7
+  add r14 -132 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump stringify
+  or r0 r1 r7
+  read -64 r14 r4
+  or r0 r4 r3
+  read -128 r14 r4
+  read -80 r14 r2
+  read -84 r14 r1
+  read -120 r14 r6
+  read -124 r14 r5
+  blts r7 r0 .L399
+  load 0 r7
+  write -68 r14 r7
+  read -116 r14 r7
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  read -68 r14 r12
+  write -76 r14 r12
+  jump .L340
+.L399:
+  load32 -1 r1
+  jump .L436
+.L400:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L401:
+  read -132 r14 r4
+  load 0 r5
+  bles r4 r3 .L405
+  load 1 r5
+  sub r4 r5 r5
+  add r1 r5 r5
+  readb 0 r5 r6
+  load 1 r5
+  load 32 r7
+  beq r6 r7 .L404
+  load 1 r5
+  sub r4 r5 r5
+  add r1 r5 r5
+  readb 0 r5 r5
+  xor r5 9 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L404:
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L405:
+  beq r5 r0 .L407
+  load 1 r5
+  sub r4 r5 r4
+  write -132 r14 r4
+  jump .L401
+.L407:
+  read -96 r14 r4
+  or r0 r4 r3
+  add r4 2 r4
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  write -88 r14 r1
+  read -128 r14 r3
+  read -80 r14 r2
+  read -84 r14 r1
+  read -116 r14 r7
+  read -120 r14 r6
+  read -124 r14 r5
+  load 1 r4
+  write -92 r14 r4
+  read -88 r14 r4
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  read -92 r14 r12
+  write -76 r14 r12
+  jump .L340
+.L410:
+  or r0 r4 r3
+  or r0 r6 r4
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  read -132 r14 r5
+  add r5 1 r6
+  bges r6 r2 .L433
+  add r3 1 r3
+  add r5 1 r6
+  write -132 r14 r6
+  add r1 r5 r5
+  writeb 0 r5 r4
+.L413:
+  readb 0 r3 r5
+  load 0 r6
+  beq r5 r0 .L415
+  xor r5 r4 r6
+  sltu r0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L415:
+  beq r6 r0 .L425
+  load 0 r6
+  load 92 r7
+  bne r5 r7 .L418
+  add r3 1 r6
+  readb 0 r6 r6
+  and r6 0xFF r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L418:
+  beq r6 r0 .L421
+  read -132 r14 r6
+  add r6 2 r7
+  bges r7 r2 .L424
+  add r3 1 r3
+  add r6 1 r7
+  write -132 r14 r7
+  add r1 r6 r6
+  writeb 0 r6 r5
+.L421:
+  read -132 r14 r6
+  add r6 1 r5
+  bges r5 r2 .L423
+  or r0 r3 r8
+  add r3 1 r3
+  readb 0 r8 r5
+  add r6 1 r7
+  write -132 r14 r7
+  add r1 r6 r6
+  writeb 0 r6 r5
+  jump .L413
+.L423:
+  load32 -1 r1
+  jump .L436
+.L424:
+  load32 -1 r1
+  jump .L436
+.L425:
+  or r0 r3 r8
+  or r0 r5 r4
+  read -128 r14 r3
+  read -120 r14 r6
+  read -124 r14 r5
+  bne r4 r0 .L428
+  or r0 r8 r4
+  jump .L430
+.L428:
+  read -132 r14 r7
+  add r7 1 r5
+  bges r5 r2 .L432
+  add r8 1 r8
+  write -100 r14 r8
+  read -124 r14 r5
+  add r7 1 r6
+  write -132 r14 r6
+  read -120 r14 r6
+  add r1 r7 r7
+  writeb 0 r7 r4
+  read -100 r14 r4
+.L430:
+  load 0 r7
+  write -104 r14 r7
+  read -116 r14 r7
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  read -104 r14 r12
+  write -76 r14 r12
+  jump .L340
+.L432:
+  load32 -1 r1
+  jump .L436
+.L433:
+  load32 -1 r1
+  jump .L436
+.L434:
+  read -108 r14 r2
+  read -132 r14 r1
+  write 0 r2 r1
+  load 0 r1
+.L436:
+  read -136 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function substitute_params */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "__FILE__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "\042%s\042\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "__LINE__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "%d\000"
+/* end data */
+
+
+.text
+; function expand_builtin
+expand_builtin:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r7
+  write -12 r14 r6
+  write -8 r14 r4
+  load 1 r1
+  load 8 r2
+  bne r5 r2 .L441
+  add r4 0 r1
+  readb 0 r1 r1
+  xor r1 95 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L442
+.L441:
+  or r0 r1 r2
+.L442:
+  load 1 r1
+  bne r2 r0 .L444
+  add r4 1 r1
+  readb 0 r1 r1
+  xor r1 95 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L444:
+  bne r1 r0 .L456
+  load 8 r6
+  addr2reg .Lstring.34 r5
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  or r0 r1 r2
+  read -16 r14 r7
+  read -12 r14 r4
+  or r0 r4 r1
+  read -8 r14 r4
+  beq r2 r0 .L449
+  load 8 r6
+  addr2reg .Lstring.37 r5
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  read -16 r14 r7
+  read -12 r14 r4
+  beq r1 r0 .L448
+  load 0 r1
+  jump .L457
+.L448:
+  or r0 r7 r1
+  addr2reg cur_line r12
+  read 0 r12 r7
+  load 24 r2
+  sub r13 r2 r13
+  addr2reg .Lstring.38 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  read -16 r14 r7
+  load32 -24 r2
+  sub r13 r2 r13
+  jump .L454
+.L449:
+  or r0 r1 r4
+  or r0 r7 r1
+  addr2reg cur_filename r12
+  read 0 r12 r7
+  bne r7 r0 .L453
+  addr2reg .Lstring.35 r2
+  or r0 r2 r7
+.L453:
+  load 24 r2
+  sub r13 r2 r13
+  addr2reg .Lstring.36 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  read -16 r14 r7
+  load32 -24 r2
+  sub r13 r2 r13
+.L454:
+  blts r1 r7 .L457
+  load32 -1 r1
+  jump .L457
+.L456:
+  load 0 r1
+.L457:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function expand_builtin */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "macro arg too long\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.41:
+	.ascii "too many macro args\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "wrong arg count for macro \000"
+/* end data */
+
+
+.text
+; function expand_pass
+expand_pass:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 12584 r13
+  write -12576 r14 r8
+  write -140 r14 r7
+  write -116 r14 r6
+  write -124 r14 r5
+  load 0 r2
+  load 0 r1
+  or r0 r2 r3
+  write -144 r14 r1
+.L462:
+  write -112 r14 r4
+  write -120 r14 r3
+  readb 0 r4 r1
+  write -136 r14 r1
+  bne r1 r0 8
+  jump .L646
+  load 1 r2
+  load 34 r7
+  beq r1 r7 .L465
+  xor r1 39 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L465:
+  bne r2 r0 .L623
+  load 1 r2
+  write -16 r14 r2
+  load 1 r2
+  xor r1 r2 r2
+  sltu r2 1 r2
+  write -12 r14 r2
+  read -144 r14 r2
+  read -140 r14 r7
+  read -12 r14 r12
+  bne r12 r0 .L468
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_start
+  or r0 r1 r2
+  read -112 r14 r4
+  read -120 r14 r3
+  read -144 r14 r1
+  read -140 r14 r7
+  read -116 r14 r6
+  read -124 r14 r5
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L469
+.L468:
+  or r0 r2 r1
+  read -16 r14 r2
+.L469:
+  bne r2 r0 .L474
+  add r3 1 r2
+  bges r2 r6 .L473
+  add r4 1 r2
+  write -20 r14 r2
+  readb 0 r4 r2
+  write -24 r14 r2
+  read -20 r14 r4
+  add r3 1 r2
+  write -28 r14 r2
+  read -24 r14 r2
+  add r5 r3 r3
+  writeb 0 r3 r2
+  read -28 r14 r3
+  write -144 r14 r1
+  jump .L462
+.L473:
+  load32 -1 r1
+  jump .L648
+.L474:
+  readb 0 r4 r1
+  load 1 r2
+  bne r1 r2 .L476
+  or r0 r4 r1
+  add r4 1 r4
+.L476:
+  write -108 r14 r4
+  readb 0 r4 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  read -108 r14 r4
+  beq r1 r0 .L478
+  add r4 1 r4
+  jump .L476
+.L478:
+  read -112 r14 r1
+  read -120 r14 r3
+  read -116 r14 r6
+  read -124 r14 r5
+  sub r4 r1 r2
+  write -104 r14 r2
+  readb 0 r1 r2
+  load 1 r7
+  xor r2 r7 r7
+  sltu r7 1 r7
+  read -104 r14 r2
+  bne r7 r0 .L482
+  or r0 r1 r4
+  or r0 r2 r5
+  or r0 r4 r2
+  savpc r15
+  add r15 12 r15
+  jump macro_lookup
+  read -108 r14 r4
+  read -112 r14 r2
+  read -120 r14 r3
+  read -116 r14 r6
+  read -124 r14 r5
+  jump .L484
+.L482:
+  or r0 r1 r2
+  load32 -1 r1
+.L484:
+  write -88 r14 r1
+  slt r1 r0 r7
+  write -32 r14 r7
+  read -140 r14 r7
+  read -32 r14 r12
+  bne r12 r0 .L612
+.L485:
+  beq r7 r0 .L489
+  read 0 r7 r2
+  beq r2 r1 .L488
+  add r7 4 r2
+  read 0 r2 r7
+  jump .L485
+.L488:
+  read -112 r14 r2
+  jump .L490
+.L489:
+  read -112 r14 r2
+.L490:
+  or r0 r7 r8
+  read -140 r14 r7
+  bne r8 r0 .L607
+  write -12572 r14 r1
+  add r14 -12572 r2
+  add r2 4 r2
+  write 0 r2 r7
+  load 28 r2
+  mults r1 r2 r7
+  addr2reg macros r2
+  add r2 r7 r2
+  add r2 20 r2
+  read 0 r2 r2
+  blts r2 r0 .L604
+  or r0 r4 r2
+.L493:
+  readb 0 r2 r1
+  load 1 r6
+  load 32 r7
+  beq r1 r7 .L495
+  or r0 r3 r7
+  xor r1 9 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  jump .L496
+.L495:
+  or r0 r3 r7
+  or r0 r6 r3
+.L496:
+  beq r3 r0 .L500
+  or r0 r7 r1
+  add r2 1 r2
+  or r0 r1 r3
+  jump .L493
+.L500:
+  or r0 r2 r4
+  or r0 r7 r3
+  or r0 r1 r2
+  read -112 r14 r1
+  read -116 r14 r6
+  load 40 r7
+  xor r2 r7 r7
+  sltu r0 r7 r7
+  read -104 r14 r2
+  bne r7 r0 .L599
+  or r0 r4 r2
+  add r4 1 r4
+  add r14 -12564 r1
+  add r1 0 r2
+  add r14 -12500 r1
+  write 0 r2 r1
+  load 0 r3
+  load 0 r2
+  load 1 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+.L504:
+  write -84 r14 r1
+  or r0 r1 r6
+  readb 0 r4 r1
+  load 0 r5
+  beq r1 r0 .L506
+  load 0 r5
+  slt r5 r3 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L506:
+  beq r5 r0 .L556
+  load 4092 r5
+  bges r2 r5 .L555
+  load 1 r5
+  load 34 r7
+  beq r1 r7 .L510
+  xor r1 39 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L510:
+  bne r5 r0 .L537
+  load 40 r5
+  beq r1 r5 .L535
+  load 41 r5
+  beq r1 r5 .L530
+  load 0 r5
+  write -40 r14 r5
+  load 44 r5
+  xor r1 r5 r5
+  sltu r5 1 r5
+  write -36 r14 r5
+  read -120 r14 r7
+  read -124 r14 r5
+  read -36 r14 r12
+  bne r12 r0 .L515
+  read -40 r14 r12
+  write -48 r14 r12
+  jump .L517
+.L515:
+  xor r3 1 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+  write -44 r14 r5
+  read -120 r14 r7
+  read -124 r14 r5
+  read -44 r14 r12
+  write -48 r14 r12
+.L517:
+  read -48 r14 r12
+  bne r12 r0 .L520
+  add r4 1 r4
+  or r0 r2 r5
+  add r2 1 r2
+  add r14 -12500 r7
+  add r7 r5 r5
+  writeb 0 r5 r1
+  or r0 r6 r1
+  jump .L504
+.L520:
+  or r0 r7 r1
+  add r2 1 r7
+  write -56 r14 r7
+  add r14 -12500 r7
+  add r7 r2 r7
+  load 0 r2
+  writeb 0 r7 r2
+  add r6 1 r2
+  load 16 r7
+  slt r2 r7 r7
+  xor r7 1 r7
+  read -56 r14 r2
+  bne r7 r0 .L529
+  add r6 1 r6
+  write -52 r14 r6
+  add r14 -12500 r7
+  add r7 r2 r2
+  shiftl r6 2 r7
+  add r14 -12564 r6
+  add r6 r7 r6
+  write 0 r6 r2
+  add r4 1 r4
+.L523:
+  readb 0 r4 r2
+  load 1 r6
+  load 32 r7
+  beq r2 r7 .L525
+  xor r2 9 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L526
+.L525:
+  or r0 r6 r2
+.L526:
+  beq r2 r0 .L528
+  add r4 1 r4
+  jump .L523
+.L528:
+  read -52 r14 r1
+  read -56 r14 r2
+  jump .L504
+.L529:
+  addr2reg .Lstring.41 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load32 -3 r1
+  jump .L648
+.L530:
+  or r0 r6 r12
+  or r0 r1 r6
+  or r0 r12 r1
+  load 1 r5
+  sub r3 r5 r3
+  beq r3 r0 .L533
+  add r4 1 r4
+  or r0 r2 r5
+  add r2 1 r2
+  add r14 -12500 r7
+  add r7 r5 r5
+  writeb 0 r5 r6
+  jump .L504
+.L533:
+  add r4 1 r4
+  write -76 r14 r4
+  jump .L557
+.L535:
+  or r0 r6 r12
+  or r0 r1 r6
+  or r0 r12 r1
+  add r3 1 r3
+  add r4 1 r4
+  or r0 r2 r5
+  add r2 1 r2
+  add r14 -12500 r7
+  add r7 r5 r5
+  writeb 0 r5 r6
+  jump .L504
+.L537:
+  or r0 r1 r6
+  add r4 1 r4
+  or r0 r2 r1
+  add r2 1 r2
+  add r14 -12500 r5
+  add r5 r1 r1
+  writeb 0 r1 r6
+  or r0 r6 r1
+.L540:
+  readb 0 r4 r5
+  load 0 r6
+  bne r5 r0 .L542
+  or r0 r6 r7
+  jump .L543
+.L542:
+  xor r5 r1 r6
+  sltu r0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r7
+.L543:
+  load 0 r6
+  beq r7 r0 .L545
+  slt r2 4092 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L545:
+  beq r6 r0 .L552
+  load 0 r6
+  load 92 r7
+  bne r5 r7 .L548
+  add r4 1 r6
+  readb 0 r6 r6
+  and r6 0xFF r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L548:
+  bne r6 r0 .L550
+  add r4 1 r4
+  or r0 r2 r6
+  add r2 1 r2
+  add r14 -12500 r7
+  add r7 r6 r6
+  writeb 0 r6 r5
+  jump .L540
+.L550:
+  or r0 r2 r12
+  or r0 r5 r2
+  or r0 r12 r5
+  or r0 r4 r12
+  or r0 r2 r4
+  or r0 r12 r2
+  add r2 1 r2
+  add r5 1 r7
+  add r14 -12500 r6
+  add r6 r5 r5
+  writeb 0 r5 r4
+  add r2 1 r4
+  readb 0 r2 r5
+  add r7 1 r2
+  add r14 -12500 r6
+  add r6 r7 r6
+  writeb 0 r6 r5
+  jump .L540
+.L552:
+  or r0 r1 r6
+  read -84 r14 r1
+  bne r5 r6 .L504
+  add r4 1 r4
+  or r0 r2 r6
+  add r2 1 r2
+  add r14 -12500 r7
+  add r7 r6 r6
+  writeb 0 r6 r5
+  jump .L504
+.L555:
+  addr2reg .Lstring.40 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load32 -3 r1
+  jump .L648
+.L556:
+  or r0 r6 r1
+  write -76 r14 r4
+.L557:
+  bne r3 r0 .L598
+  add r14 -12500 r3
+  add r3 r2 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r1 1 r2
+  write -80 r14 r2
+  load 0 r1
+.L559:
+  write -72 r14 r1
+  bges r1 r2 .L574
+  shiftl r1 2 r2
+  add r14 -12564 r1
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r2
+  read -72 r14 r1
+  read -120 r14 r3
+  read -124 r14 r5
+.L561:
+  load 0 r4
+  bles r2 r0 .L565
+  shiftl r1 2 r6
+  add r14 -12564 r4
+  add r4 r6 r4
+  read 0 r4 r4
+  load 1 r6
+  sub r2 r6 r6
+  add r4 r6 r4
+  readb 0 r4 r6
+  load 1 r4
+  load 32 r7
+  beq r6 r7 .L564
+  shiftl r1 2 r6
+  add r14 -12564 r4
+  add r4 r6 r4
+  read 0 r4 r4
+  load 1 r6
+  sub r2 r6 r6
+  add r4 r6 r4
+  readb 0 r4 r4
+  xor r4 9 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L564:
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L565:
+  beq r4 r0 .L567
+  shiftl r1 2 r6
+  add r14 -12564 r4
+  add r4 r6 r4
+  read 0 r4 r4
+  load 1 r6
+  sub r2 r6 r2
+  add r4 r2 r6
+  load 0 r4
+  writeb 0 r6 r4
+  jump .L561
+.L567:
+  read -116 r14 r6
+.L568:
+  shiftl r1 2 r4
+  add r14 -12564 r2
+  add r2 r4 r2
+  read 0 r2 r2
+  add r2 0 r2
+  readb 0 r2 r4
+  load 1 r2
+  load 32 r7
+  beq r4 r7 .L570
+  shiftl r1 2 r4
+  add r14 -12564 r2
+  add r2 r4 r2
+  read 0 r2 r2
+  add r2 0 r2
+  readb 0 r2 r2
+  xor r2 9 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L570:
+  beq r2 r0 .L572
+  shiftl r1 2 r4
+  add r14 -12564 r2
+  add r2 r4 r4
+  read 0 r4 r2
+  add r2 1 r2
+  write 0 r4 r2
+  jump .L568
+.L572:
+  read -80 r14 r2
+  add r1 1 r1
+  jump .L559
+.L574:
+  read -80 r14 r2
+  read -88 r14 r1
+  read -140 r14 r7
+  load 28 r3
+  mults r1 r3 r4
+  addr2reg macros r3
+  add r3 r4 r3
+  add r3 20 r3
+  read 0 r3 r3
+  beq r3 r0 .L579
+  load 28 r3
+  mults r1 r3 r3
+  addr2reg macros r1
+  add r1 r3 r1
+  add r1 20 r1
+  read 0 r1 r1
+  beq r2 r1 .L584
+  read -88 r14 r1
+  load 28 r2
+  mults r1 r2 r2
+  addr2reg macros r1
+  add r1 r2 r1
+  read 0 r1 r5
+  addr2reg .Lstring.42 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -3 r1
+  jump .L648
+.L579:
+  load 0 r1
+  load 1 r3
+  bne r2 r3 .L581
+  add r14 -12564 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r1 0 r1
+  readb 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L581:
+  beq r1 r0 .L596
+  load 0 r1
+  or r0 r1 r2
+.L584:
+  write -60 r14 r2
+  load 0 r3
+  load 0 r1
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L586:
+  write -64 r14 r1
+  write -68 r14 r3
+  bges r3 r2 .L590
+  add r14 -8404 r2
+  add r2 r1 r2
+  shiftl r3 2 r5
+  add r14 -4308 r4
+  add r4 r5 r4
+  write 0 r4 r2
+  shiftl r3 2 r4
+  add r14 -12564 r2
+  add r2 r4 r2
+  read 0 r2 r4
+  shiftl r3 2 r3
+  add r14 -4308 r2
+  add r2 r3 r2
+  read 0 r2 r5
+  load 4096 r2
+  sub r2 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump expand_pass
+  read -68 r14 r3
+  blts r1 r0 .L648
+  shiftl r3 2 r2
+  add r14 -4308 r1
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r4
+  read -64 r14 r1
+  read -68 r14 r3
+  read -60 r14 r2
+  read -140 r14 r7
+  add r4 1 r4
+  add r1 r4 r1
+  add r3 1 r3
+  jump .L586
+.L590:
+  read -88 r14 r1
+  load 0 r2
+  write -148 r14 r2
+  load 28 r2
+  mults r1 r2 r3
+  addr2reg macros r2
+  add r2 r3 r2
+  add r2 16 r2
+  read 0 r2 r4
+  load 28 r2
+  mults r1 r2 r3
+  addr2reg macros r2
+  add r2 r3 r2
+  add r2 20 r2
+  read 0 r2 r5
+  load 28 r2
+  mults r1 r2 r2
+  addr2reg macros r1
+  add r1 r2 r1
+  add r1 24 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 20 r3
+  load 4096 r2
+  write 0 r3 r2
+  add r1 16 r3
+  add r14 -148 r2
+  write 0 r3 r2
+  add r1 12 r3
+  add r14 -4244 r2
+  write 0 r3 r2
+  add r1 8 r2
+  add r14 -4308 r1
+  write 0 r2 r1
+  add r14 -12564 r7
+  savpc r15
+  add r15 12 r15
+  jump substitute_params
+  read -120 r14 r3
+  read -116 r14 r6
+  read -124 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+  blts r1 r0 .L595
+  read -148 r14 r2
+  add r14 -4244 r1
+  add r1 r2 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r5 r3 r5
+  sub r6 r3 r6
+  add r14 -12572 r7
+  add r14 -4244 r4
+  savpc r15
+  add r15 12 r15
+  jump expand_pass
+  read -120 r14 r3
+  read -124 r14 r5
+  blts r1 r0 .L648
+  add r5 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  read -76 r14 r4
+  read -120 r14 r3
+  read -140 r14 r7
+  read -116 r14 r6
+  read -124 r14 r5
+  add r3 r1 r3
+  load 1 r1
+  write -144 r14 r1
+  jump .L462
+.L595:
+  load32 -1 r1
+  jump .L648
+.L596:
+  read -88 r14 r1
+  load 28 r2
+  mults r1 r2 r2
+  addr2reg macros r1
+  add r1 r2 r1
+  read 0 r1 r5
+  addr2reg .Lstring.42 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  load32 -3 r1
+  jump .L648
+.L598:
+  load32 -2 r1
+  jump .L648
+.L599:
+  or r0 r1 r4
+  add r3 r2 r1
+  bges r1 r6 .L603
+  or r0 r4 r1
+  add r5 r3 r4
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -108 r14 r4
+  read -120 r14 r3
+  read -144 r14 r1
+  read -104 r14 r2
+  read -140 r14 r7
+  read -116 r14 r6
+  read -124 r14 r5
+  add r3 r2 r3
+  load 1 r2
+  addr2reg fn_name_pending r12
+  write 0 r12 r2
+  write -144 r14 r1
+  jump .L462
+.L603:
+  load32 -1 r1
+  jump .L648
+.L604:
+  load 28 r2
+  mults r1 r2 r2
+  addr2reg macros r1
+  add r1 r2 r1
+  add r1 16 r1
+  read 0 r1 r4
+  add r5 r3 r5
+  sub r6 r3 r6
+  add r14 -12572 r7
+  savpc r15
+  add r15 12 r15
+  jump expand_pass
+  read -120 r14 r3
+  read -124 r14 r5
+  blts r1 r0 .L648
+  add r5 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  read -108 r14 r4
+  read -120 r14 r3
+  read -140 r14 r7
+  read -116 r14 r6
+  read -124 r14 r5
+  add r3 r1 r3
+  load 1 r1
+  write -144 r14 r1
+  jump .L462
+.L607:
+  or r0 r2 r4
+  read -104 r14 r2
+  add r3 r2 r1
+  add r1 1 r1
+  bges r1 r6 .L611
+  or r0 r3 r1
+  add r3 1 r3
+  write -92 r14 r3
+  add r5 r1 r6
+  load 1 r1
+  writeb 0 r6 r1
+  or r0 r4 r1
+  add r5 r3 r4
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -108 r14 r4
+  read -144 r14 r1
+  read -92 r14 r3
+  read -104 r14 r2
+  read -140 r14 r7
+  read -116 r14 r6
+  read -124 r14 r5
+  add r3 r2 r3
+  write -144 r14 r1
+  jump .L462
+.L611:
+  load32 -1 r1
+  jump .L648
+.L612:
+  or r0 r2 r4
+  read -104 r14 r2
+  or r0 r6 r1
+  add r5 r3 r6
+  sub r1 r3 r7
+  or r0 r2 r5
+  or r0 r4 r2
+  savpc r15
+  add r15 12 r15
+  jump expand_builtin
+  or r0 r1 r2
+  read -108 r14 r4
+  or r0 r2 r1
+  read -112 r14 r2
+  read -120 r14 r3
+  read -116 r14 r6
+  read -124 r14 r5
+  write -100 r14 r1
+  blts r1 r0 .L622
+  xor r1 r0 r1
+  sltu r1 1 r1
+  write -96 r14 r1
+  read -144 r14 r1
+  read -140 r14 r7
+  read -96 r14 r12
+  bne r12 r0 .L616
+  read -100 r14 r2
+  jump .L619
+.L616:
+  or r0 r2 r4
+  read -104 r14 r2
+  add r3 r2 r1
+  bges r1 r6 .L621
+  or r0 r4 r1
+  add r5 r3 r4
+  or r0 r2 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -108 r14 r4
+  read -120 r14 r3
+  read -144 r14 r1
+  read -104 r14 r2
+  read -140 r14 r7
+  read -116 r14 r6
+  read -124 r14 r5
+.L619:
+  add r3 r2 r3
+  write -144 r14 r1
+  jump .L462
+.L621:
+  load32 -1 r1
+  jump .L648
+.L622:
+  load32 -1 r1
+  jump .L648
+.L623:
+  add r3 1 r2
+  bges r2 r6 .L645
+  add r4 1 r4
+  or r0 r3 r2
+  add r3 1 r3
+  add r5 r2 r2
+  writeb 0 r2 r1
+.L625:
+  readb 0 r4 r2
+  load 0 r7
+  bne r2 r0 .L627
+  or r0 r7 r1
+  jump .L628
+.L627:
+  xor r2 r1 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L628:
+  beq r1 r0 .L639
+  load 0 r7
+  load 92 r1
+  xor r2 r1 r8
+  sltu r8 1 r8
+  read -136 r14 r1
+  beq r8 r0 .L631
+  add r4 1 r7
+  readb 0 r7 r7
+  and r7 0xFF r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L631:
+  bne r7 r0 .L635
+  add r3 1 r7
+  bges r7 r6 .L634
+  add r4 1 r4
+  or r0 r3 r7
+  add r3 1 r3
+  add r5 r7 r7
+  writeb 0 r7 r2
+  jump .L625
+.L634:
+  load32 -1 r1
+  jump .L648
+.L635:
+  or r0 r4 r12
+  or r0 r2 r4
+  or r0 r12 r2
+  or r0 r3 r12
+  or r0 r4 r3
+  or r0 r12 r4
+  add r4 2 r7
+  bges r7 r6 .L638
+  add r2 1 r2
+  add r4 1 r7
+  add r5 r4 r4
+  writeb 0 r4 r3
+  add r2 1 r4
+  readb 0 r2 r2
+  add r7 1 r3
+  add r5 r7 r7
+  writeb 0 r7 r2
+  jump .L625
+.L638:
+  load32 -1 r1
+  jump .L648
+.L639:
+  read -144 r14 r1
+  read -140 r14 r7
+  beq r2 r0 .L643
+  add r3 1 r7
+  bges r7 r6 .L644
+  add r4 1 r4
+  write -128 r14 r4
+  read -140 r14 r7
+  add r3 1 r4
+  write -132 r14 r4
+  read -128 r14 r4
+  add r5 r3 r3
+  writeb 0 r3 r2
+  read -132 r14 r3
+.L643:
+  write -144 r14 r1
+  jump .L462
+.L644:
+  load32 -1 r1
+  jump .L648
+.L645:
+  load32 -1 r1
+  jump .L648
+.L646:
+  read -144 r14 r1
+  add r5 r3 r3
+  load 0 r2
+  writeb 0 r3 r2
+.L648:
+  read -12576 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function expand_pass */
+
+
+.text
+; function expand_line
+expand_line:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  read 8 r14 r3
+  write -32 r14 r3
+  write -8 r14 r6
+  or r0 r5 r2
+  or r0 r7 r5
+  write -16 r14 r5
+  write -12 r14 r2
+  load 0 r1
+  addr2reg fn_name_pending r12
+  write 0 r12 r1
+  load 0 r7
+  or r0 r5 r6
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump expand_pass
+  read -16 r14 r5
+  read -8 r14 r2
+  or r0 r2 r3
+  read -12 r14 r2
+  load 0 r4
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L653:
+  write -28 r14 r1
+  write -20 r14 r3
+  write -24 r14 r4
+  load 0 r6
+  bgts r2 r0 .L655
+  or r0 r6 r7
+  jump .L656
+.L655:
+  addr2reg fn_name_pending r12
+  read 0 r12 r6
+  xor r6 0 r6
+  sltu r0 r6 r7
+.L656:
+  load 0 r6
+  bne r7 r0 .L658
+  or r0 r6 r4
+  jump .L659
+.L658:
+  slt r4 50 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L659:
+  beq r4 r0 .L664
+  load 0 r2
+  addr2reg fn_name_pending r12
+  write 0 r12 r2
+  load 0 r7
+  or r0 r5 r6
+  or r0 r3 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump expand_pass
+  or r0 r1 r2
+  read -28 r14 r1
+  read -20 r14 r3
+  read -24 r14 r4
+  read -16 r14 r5
+  blts r2 r0 .L663
+  add r4 1 r4
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+  jump .L653
+.L663:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  read -32 r14 r3
+  jump .L665
+.L664:
+  read -32 r14 r3
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L665:
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function expand_line */
+
+.data
+.balign 1
+.Lstring.44:
+	.ascii "||\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.45:
+	.ascii "&&\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.46:
+	.ascii "|\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.47:
+	.ascii "^\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.48:
+	.ascii "&\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.49:
+	.ascii "==\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.50:
+	.ascii "!=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.51:
+	.ascii "<=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.52:
+	.ascii ">=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.53:
+	.ascii "<<\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.54:
+	.ascii ">>\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.55:
+	.ascii "<\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.56:
+	.ascii ">\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.57:
+	.ascii "+\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.58:
+	.ascii "-\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.59:
+	.ascii "*\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.60:
+	.ascii "/\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.61:
+	.ascii "%\000"
+/* end data */
+
+.data
+.balign 4
+ex_ops:
+	.int .Lstring.44+0
+	.int 1
+	.int .Lstring.45+0
+	.int 2
+	.int .Lstring.46+0
+	.int 3
+	.int .Lstring.47+0
+	.int 4
+	.int .Lstring.48+0
+	.int 5
+	.int .Lstring.49+0
+	.int 6
+	.int .Lstring.50+0
+	.int 6
+	.int .Lstring.51+0
+	.int 7
+	.int .Lstring.52+0
+	.int 7
+	.int .Lstring.53+0
+	.int 8
+	.int .Lstring.54+0
+	.int 8
+	.int .Lstring.55+0
+	.int 7
+	.int .Lstring.56+0
+	.int 7
+	.int .Lstring.57+0
+	.int 9
+	.int .Lstring.58+0
+	.int 9
+	.int .Lstring.59+0
+	.int 10
+	.int .Lstring.60+0
+	.int 10
+	.int .Lstring.61+0
+	.int 10
+/* end data */
+
+
+.text
+; function ex_ws
+ex_ws:
+.L669:
+  addr2reg ex_p r12
+  read 0 r12 r1
+  readb 0 r1 r3
+  load 1 r2
+  load 32 r4
+  beq r3 r4 .L671
+  readb 0 r1 r2
+  xor r2 9 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L672
+.L671:
+  or r0 r2 r3
+.L672:
+  load 1 r2
+  bne r3 r0 .L674
+  readb 0 r1 r2
+  xor r2 1 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L674:
+  beq r2 r0 .L676
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  jump .L669
+.L676:
+  jumpr 0 r15
+
+/* end function ex_ws */
+
+
+.text
+; function ex_char
+ex_char:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg ex_p r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  readb 0 r1 r2
+  load 92 r3
+  beq r2 r3 .L681
+  add r1 1 r2
+  addr2reg ex_p r12
+  write 0 r12 r2
+  readb 0 r1 r1
+  and r1 0xFF r1
+  jump .L706
+.L681:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  readb 0 r1 r2
+  load 97 r3
+  sub r2 r3 r2
+  load 24 r3
+  bge r2 r3 .L686
+  shiftl r2 2 r3
+  addr2reg .Ljt683 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L684:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  load 7 r1
+  jump .L706
+.L685:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  load 8 r1
+  jump .L706
+.L686:
+  readb 0 r1 r3
+  load 0 r2
+  load 48 r4
+  blts r3 r4 .L688
+  readb 0 r1 r3
+  load 55 r2
+  slt r2 r3 r2
+  xor r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L688:
+  bne r2 r0 .L690
+  add r1 1 r2
+  addr2reg ex_p r12
+  write 0 r12 r2
+  readb 0 r1 r1
+  and r1 0xFF r1
+  jump .L706
+.L690:
+  load 0 r3
+  load 0 r2
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+.L692:
+  load 0 r4
+  load 3 r5
+  blts r3 r5 .L694
+  or r0 r4 r5
+  jump .L695
+.L694:
+  readb 0 r1 r4
+  slt r4 48 r4
+  xor r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L695:
+  load 0 r4
+  beq r5 r0 .L697
+  readb 0 r1 r5
+  load 55 r4
+  slt r4 r5 r4
+  xor r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L697:
+  beq r4 r0 .L699
+  shiftl r2 3 r2
+  or r0 r1 r4
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  readb 0 r4 r4
+  load 48 r5
+  sub r4 r5 r4
+  add r2 r4 r2
+  add r3 1 r3
+  jump .L692
+.L699:
+  or r0 r2 r1
+  jump .L706
+.L700:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  load 12 r1
+  jump .L706
+.L701:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  load 10 r1
+  jump .L706
+.L702:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  load 13 r1
+  jump .L706
+.L703:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  load 9 r1
+  jump .L706
+.L704:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  load 11 r1
+  jump .L706
+.L705:
+  add r1 1 r4
+  load 16 r6
+  addr2reg ex_p r5
+  savpc r15
+  add r15 12 r15
+  jump strtoul
+.L706:
+  addr2reg ex_p r12
+  read 0 r12 r2
+  readb 0 r2 r3
+  load 39 r4
+  bne r3 r4 .L708
+  add r2 1 r2
+  addr2reg ex_p r12
+  write 0 r12 r2
+  jump .L709
+.L708:
+  load 1 r1
+  addr2reg ex_bad r12
+  write 0 r12 r1
+  load 0 r1
+.L709:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt683:
+  .int .L684
+  .int .L685
+  .int .L686
+  .int .L686
+  .int .L686
+  .int .L700
+  .int .L686
+  .int .L686
+  .int .L686
+  .int .L686
+  .int .L686
+  .int .L686
+  .int .L686
+  .int .L701
+  .int .L686
+  .int .L686
+  .int .L686
+  .int .L702
+  .int .L686
+  .int .L703
+  .int .L686
+  .int .L704
+  .int .L686
+  .int .L705
+
+/* end function ex_char */
+
+
+.text
+; function ex_unary
+ex_unary:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  savpc r15
+  add r15 12 r15
+  jump ex_ws
+  addr2reg ex_p r12
+  read 0 r12 r1
+  readb 0 r1 r2
+  load 126 r3
+  beq r2 r3 .L743
+  load 126 r3
+  bge r2 r3 .L718
+  load 33 r3
+  sub r2 r3 r2
+  load 13 r3
+  bge r2 r3 .L718
+  shiftl r2 2 r3
+  addr2reg .Ljt716 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L717:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_unary
+  xor r1 0 r1
+  sltu r1 1 r1
+  jump .L744
+.L718:
+  readb 0 r1 r3
+  load 0 r2
+  load 48 r4
+  blts r3 r4 .L720
+  readb 0 r1 r3
+  load 57 r2
+  slt r2 r3 r2
+  xor r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L720:
+  bne r2 r0 .L726
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_start
+  beq r1 r0 .L725
+.L722:
+  addr2reg ex_p r12
+  read 0 r12 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  beq r1 r0 .L724
+  addr2reg ex_p r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  jump .L722
+.L724:
+  load 0 r1
+  jump .L744
+.L725:
+  load 1 r1
+  addr2reg ex_bad r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L744
+.L726:
+  load 0 r6
+  addr2reg ex_p r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strtoul
+.L727:
+  addr2reg ex_p r12
+  read 0 r12 r2
+  readb 0 r2 r4
+  load 1 r3
+  load 117 r5
+  beq r4 r5 .L729
+  readb 0 r2 r3
+  xor r3 85 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+  jump .L730
+.L729:
+  or r0 r3 r4
+.L730:
+  load 1 r3
+  bne r4 r0 .L732
+  readb 0 r2 r3
+  xor r3 108 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+  jump .L733
+.L732:
+  or r0 r3 r4
+.L733:
+  load 1 r3
+  bne r4 r0 .L735
+  readb 0 r2 r3
+  xor r3 76 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L735:
+  beq r3 r0 .L744
+  add r2 1 r2
+  addr2reg ex_p r12
+  write 0 r12 r2
+  jump .L727
+.L737:
+  savpc r15
+  add r15 12 r15
+  jump ex_char
+  jump .L744
+.L738:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_cond
+  write -16 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_ws
+  read -16 r14 r1
+  addr2reg ex_p r12
+  read 0 r12 r2
+  readb 0 r2 r3
+  load 41 r4
+  bne r3 r4 .L740
+  add r2 1 r2
+  addr2reg ex_p r12
+  write 0 r12 r2
+  jump .L744
+.L740:
+  load 1 r1
+  addr2reg ex_bad r12
+  write 0 r12 r1
+  load 0 r1
+  jump .L744
+.L741:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_unary
+  jump .L744
+.L742:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_unary
+  sub r0 r1 r1
+  jump .L744
+.L743:
+  add r1 1 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_unary
+  xor r1 -1 r1
+.L744:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt716:
+  .int .L717
+  .int .L718
+  .int .L718
+  .int .L718
+  .int .L718
+  .int .L718
+  .int .L737
+  .int .L738
+  .int .L718
+  .int .L718
+  .int .L741
+  .int .L718
+  .int .L742
+
+/* end function ex_unary */
+
+.data
+.balign 1
+.Lstring.66:
+	.ascii "division by zero in #if\000"
+/* end data */
+
+
+.text
+; function ex_binary
+ex_binary:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  write -36 r14 r8
+  write -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump ex_unary
+  load32 -559030611 r2
+  write -24 r14 r1
+  write -4 r14 r2
+.L749:
+  savpc r15
+  add r15 12 r15
+  jump ex_ws
+  read -4 r14 r1
+  load 0 r2
+.L750:
+  write -12 r14 r2
+  load 18 r3
+  bges r2 r3 .L754
+  shiftl r2 3 r2
+  addr2reg ex_ops r1
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  read -12 r14 r2
+  write -8 r14 r1
+  addr2reg ex_p r12
+  read 0 r12 r4
+  shiftl r2 3 r3
+  addr2reg ex_ops r2
+  add r2 r3 r2
+  read 0 r2 r5
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump strncmp
+  or r0 r1 r3
+  read -12 r14 r2
+  read -8 r14 r1
+  beq r3 r0 .L753
+  add r2 1 r2
+  jump .L750
+.L753:
+  or r0 r2 r3
+  read -24 r14 r2
+  read -28 r14 r4
+  jump .L755
+.L754:
+  or r0 r2 r3
+  read -24 r14 r2
+  read -28 r14 r4
+.L755:
+  write -32 r14 r1
+  load 1 r5
+  load 18 r6
+  beq r3 r6 .L757
+  shiftl r3 3 r5
+  or r0 r4 r7
+  addr2reg ex_ops r4
+  add r4 r5 r4
+  add r4 4 r4
+  read 0 r4 r4
+  slt r4 r7 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+  jump .L758
+.L757:
+  or r0 r5 r4
+.L758:
+  bne r4 r0 .L830
+  shiftl r3 3 r5
+  addr2reg ex_ops r4
+  add r4 r5 r4
+  read 0 r4 r6
+  write -20 r14 r6
+  shiftl r3 3 r4
+  or r0 r1 r3
+  addr2reg ex_ops r1
+  add r1 r4 r1
+  add r1 4 r1
+  read 0 r1 r1
+  addr2reg ex_p r12
+  read 0 r12 r4
+  add r4 r3 r3
+  addr2reg ex_p r12
+  write 0 r12 r3
+  add r6 0 r3
+  readb 0 r3 r4
+  load 0 r3
+  load 38 r5
+  beq r4 r5 .L761
+  or r0 r3 r4
+  jump .L762
+.L761:
+  add r6 1 r3
+  readb 0 r3 r3
+  xor r3 38 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L762:
+  load 0 r3
+  bne r4 r0 .L764
+  or r0 r3 r4
+  jump .L765
+.L764:
+  xor r2 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L765:
+  load 1 r3
+  bne r4 r0 .L773
+  add r6 0 r3
+  readb 0 r3 r4
+  load 0 r3
+  load 124 r5
+  beq r4 r5 .L768
+  or r0 r3 r4
+  jump .L769
+.L768:
+  add r6 1 r3
+  readb 0 r3 r3
+  xor r3 124 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L769:
+  load 0 r3
+  bne r4 r0 .L771
+  or r0 r3 r2
+  jump .L772
+.L771:
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L772:
+  xor r2 0 r2
+  sltu r0 r2 r5
+  jump .L774
+.L773:
+  or r0 r3 r5
+.L774:
+  write -16 r14 r5
+  addr2reg ex_skip r12
+  read 0 r12 r2
+  add r2 r5 r2
+  addr2reg ex_skip r12
+  write 0 r12 r2
+  add r1 1 r4
+  savpc r15
+  add r15 12 r15
+  jump ex_binary
+  or r0 r1 r3
+  read -32 r14 r1
+  read -24 r14 r2
+  read -16 r14 r5
+  read -20 r14 r6
+  addr2reg ex_skip r12
+  read 0 r12 r4
+  sub r4 r5 r5
+  addr2reg ex_skip r12
+  write 0 r12 r5
+  add r6 0 r4
+  readb 0 r4 r4
+  load 62 r7
+  xor r4 r7 r8
+  sltu r8 1 r8
+  read -28 r14 r7
+  bne r8 r0 .L823
+  load 62 r7
+  blt r4 r7 .L790
+  load 124 r7
+  xor r4 r7 r8
+  sltu r8 1 r8
+  read -28 r14 r7
+  bne r8 r0 .L784
+  load 124 r7
+  sltu r4 r7 r8
+  read -28 r14 r7
+  bne r8 r0 .L780
+  or r0 r7 r4
+  jump .L802
+.L780:
+  load 94 r7
+  xor r4 r7 r8
+  sltu r8 1 r8
+  read -28 r14 r7
+  bne r8 r0 .L782
+  load 94 r7
+  sltu r4 r7 r7
+  read -28 r14 r4
+  jump .L802
+.L782:
+  or r0 r7 r4
+  xor r2 r3 r2
+  jump .L829
+.L784:
+  or r0 r7 r4
+  or r0 r4 r7
+  add r6 1 r4
+  readb 0 r4 r4
+  bne r4 r0 .L787
+  or r2 r3 r2
+  jump .L789
+.L787:
+  or r0 r2 r4
+  load 1 r2
+  bne r4 r0 .L789
+  xor r3 0 r2
+  sltu r0 r2 r2
+.L789:
+  or r0 r7 r4
+  jump .L829
+.L790:
+  load 60 r7
+  xor r4 r7 r8
+  sltu r8 1 r8
+  read -28 r14 r7
+  bne r8 r0 .L817
+  load 60 r7
+  blt r4 r7 .L798
+  load 61 r7
+  xor r4 r7 r8
+  sltu r8 1 r8
+  read -28 r14 r7
+  bne r8 r0 .L796
+  load 61 r7
+  sltu r4 r7 r4
+  read -28 r14 r7
+  bne r4 r0 .L795
+  or r0 r7 r4
+  jump .L802
+.L795:
+  or r0 r7 r4
+  jump .L802
+.L796:
+  xor r2 r3 r2
+  sltu r2 1 r2
+  or r0 r7 r4
+  jump .L829
+.L798:
+  load 33 r7
+  sub r4 r7 r4
+  load 13 r7
+  sltu r4 r7 r8
+  read -28 r14 r7
+  bne r8 r0 .L800
+  or r0 r7 r4
+  jump .L802
+.L800:
+  shiftl r4 2 r7
+  addr2reg .Ljt800 r4
+  add r4 r7 r7
+  read -28 r14 r4
+  read 0 r7 r7
+  jumpr 0 r7
+.L801:
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  jump .L829
+.L802:
+  beq r3 r0 .L806
+  readb 0 r6 r5
+  load 47 r6
+  beq r5 r6 .L805
+  mods r2 r3 r2
+  jump .L829
+.L805:
+  divs r2 r3 r2
+  jump .L829
+.L806:
+  or r0 r5 r2
+  bne r2 r0 .L809
+  addr2reg .Lstring.66 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  read -32 r14 r1
+  read -28 r14 r4
+.L809:
+  load 0 r2
+  jump .L829
+.L810:
+  add r6 1 r5
+  readb 0 r5 r5
+  bne r5 r0 .L812
+  and r2 r3 r2
+  jump .L829
+.L812:
+  or r0 r2 r5
+  load 0 r2
+  beq r5 r0 .L829
+  xor r3 0 r2
+  sltu r0 r2 r2
+  jump .L829
+.L814:
+  mults r2 r3 r2
+  jump .L829
+.L815:
+  add r2 r3 r2
+  jump .L829
+.L816:
+  sub r2 r3 r2
+  jump .L829
+.L817:
+  or r0 r7 r4
+  add r6 1 r5
+  readb 0 r5 r5
+  load 61 r7
+  beq r5 r7 .L822
+  load 60 r6
+  beq r5 r6 .L821
+  slt r2 r3 r2
+  jump .L829
+.L821:
+  shiftl r2 r3 r2
+  jump .L829
+.L822:
+  slt r3 r2 r2
+  xor r2 1 r2
+  jump .L829
+.L823:
+  or r0 r7 r4
+  add r6 1 r5
+  readb 0 r5 r5
+  load 61 r7
+  beq r5 r7 .L828
+  load 62 r6
+  beq r5 r6 .L827
+  slt r3 r2 r2
+  jump .L829
+.L827:
+  shiftrs r2 r3 r2
+  jump .L829
+.L828:
+  slt r2 r3 r2
+  xor r2 1 r2
+.L829:
+  write -24 r14 r2
+  write -4 r14 r1
+  jump .L749
+.L830:
+  or r0 r2 r1
+  read -36 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt800:
+  .int .L801
+  .int .L802
+  .int .L802
+  .int .L802
+  .int .L802
+  .int .L810
+  .int .L802
+  .int .L802
+  .int .L802
+  .int .L814
+  .int .L815
+  .int .L802
+  .int .L816
+
+/* end function ex_binary */
+
+
+.text
+; function ex_cond
+ex_cond:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump ex_binary
+  write -16 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_ws
+  read -16 r14 r1
+  addr2reg ex_p r12
+  read 0 r12 r2
+  readb 0 r2 r3
+  load 63 r4
+  bne r3 r4 .L839
+  add r2 1 r2
+  addr2reg ex_p r12
+  write 0 r12 r2
+  or r0 r1 r2
+  addr2reg ex_skip r12
+  read 0 r12 r1
+  xor r2 0 r2
+  sltu r2 1 r2
+  add r1 r2 r1
+  addr2reg ex_skip r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_cond
+  write -12 r14 r1
+  read -16 r14 r1
+  or r0 r1 r2
+  addr2reg ex_skip r12
+  read 0 r12 r1
+  xor r2 0 r2
+  sltu r2 1 r2
+  sub r1 r2 r1
+  addr2reg ex_skip r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_ws
+  read -16 r14 r1
+  addr2reg ex_p r12
+  read 0 r12 r2
+  readb 0 r2 r3
+  load 58 r4
+  bne r3 r4 .L838
+  add r2 1 r2
+  addr2reg ex_p r12
+  write 0 r12 r2
+  or r0 r1 r3
+  addr2reg ex_skip r12
+  read 0 r12 r1
+  xor r3 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  add r1 r2 r1
+  addr2reg ex_skip r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_cond
+  or r0 r1 r2
+  read -12 r14 r1
+  read -16 r14 r3
+  addr2reg ex_skip r12
+  read 0 r12 r4
+  xor r3 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r5 1 r5
+  sub r4 r5 r4
+  addr2reg ex_skip r12
+  write 0 r12 r4
+  bne r3 r0 .L839
+  or r0 r2 r1
+  jump .L839
+.L838:
+  load 1 r1
+  addr2reg ex_bad r12
+  write 0 r12 r1
+  load 0 r1
+.L839:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ex_cond */
+
+.data
+.balign 1
+.Lstring.69:
+	.ascii "#if expression too long\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.70:
+	.ascii "defined\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.71:
+	.ascii "missing identifier after defined\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.72:
+	.ascii "missing ')' after defined\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.73:
+	.ascii "bad macro call in #if\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.74:
+	.ascii "bad #if expression\000"
+/* end data */
+
+
+.text
+; function eval_if
+eval_if:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 12332 r13
+  load 0 r1
+.L843:
+  write -32 r14 r4
+  write -28 r14 r1
+  or r0 r1 r2
+  readb 0 r4 r1
+  beq r1 r0 .L876
+  add r2 4 r2
+  load 4096 r3
+  bges r2 r3 .L875
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_start
+  or r0 r1 r2
+  read -32 r14 r4
+  read -28 r14 r1
+  bne r2 r0 .L847
+  or r0 r4 r2
+  add r4 1 r4
+  readb 0 r2 r2
+  or r0 r1 r3
+  add r1 1 r1
+  add r14 -12324 r5
+  add r5 r3 r3
+  writeb 0 r3 r2
+  jump .L843
+.L847:
+  or r0 r4 r2
+  or r0 r2 r4
+.L849:
+  write -8 r14 r4
+  readb 0 r4 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  read -8 r14 r4
+  beq r1 r0 .L851
+  add r4 1 r4
+  jump .L849
+.L851:
+  read -32 r14 r2
+  read -28 r14 r1
+  sub r4 r2 r5
+  load 0 r3
+  load 7 r6
+  bne r5 r6 .L855
+  or r0 r2 r4
+  load 7 r6
+  addr2reg .Lstring.70 r5
+  or r0 r4 r2
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  or r0 r1 r3
+  read -8 r14 r4
+  read -32 r14 r2
+  read -28 r14 r1
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L855:
+  bne r3 r0 .L859
+  or r0 r1 r3
+  sub r4 r2 r1
+  add r3 r1 r1
+  load 4096 r5
+  bges r1 r5 .L858
+  or r0 r4 r1
+  add r14 -12324 r4
+  add r4 r3 r4
+  sub r1 r2 r6
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -8 r14 r4
+  read -32 r14 r2
+  read -28 r14 r1
+  sub r4 r2 r2
+  add r1 r2 r1
+  jump .L843
+.L858:
+  addr2reg .Lstring.69 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load 0 r1
+  jump .L886
+.L859:
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  or r0 r1 r4
+  readb 0 r4 r1
+  xor r1 40 r1
+  sltu r1 1 r2
+  write -20 r14 r2
+  beq r2 r0 .L861
+  add r4 1 r4
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  or r0 r1 r4
+.L861:
+  write -24 r14 r4
+.L862:
+  write -12 r14 r4
+  readb 0 r4 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  read -12 r14 r4
+  beq r1 r0 .L864
+  add r4 1 r4
+  jump .L862
+.L864:
+  or r0 r4 r1
+  read -24 r14 r4
+  beq r1 r4 .L874
+  sub r1 r4 r5
+  savpc r15
+  add r15 12 r15
+  jump macro_lookup
+  or r0 r1 r3
+  read -12 r14 r4
+  read -28 r14 r1
+  read -20 r14 r2
+  bges r3 r0 .L869
+  load 48 r3
+  or r0 r1 r12
+  or r0 r3 r1
+  or r0 r12 r3
+  jump .L870
+.L869:
+  or r0 r1 r3
+  load 49 r1
+.L870:
+  add r3 1 r5
+  add r14 -12324 r6
+  add r6 r3 r3
+  writeb 0 r3 r1
+  add r5 1 r1
+  write -16 r14 r1
+  add r14 -12324 r3
+  add r3 r5 r5
+  load 32 r3
+  writeb 0 r5 r3
+  beq r2 r0 .L843
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  or r0 r1 r2
+  read -16 r14 r1
+  readb 0 r2 r3
+  load 41 r4
+  bne r3 r4 .L873
+  add r2 1 r4
+  jump .L843
+.L873:
+  addr2reg .Lstring.72 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load 0 r1
+  jump .L886
+.L874:
+  addr2reg .Lstring.71 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load 0 r1
+  jump .L886
+.L875:
+  addr2reg .Lstring.69 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load 0 r1
+  jump .L886
+.L876:
+  or r0 r2 r1
+  add r14 -12324 r2
+  add r2 r1 r2
+  load 0 r1
+  writeb 0 r2 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  add r14 -36 r1
+  write 0 r2 r1
+  load 4096 r7
+  add r14 -4132 r6
+  add r14 -8228 r5
+  add r14 -12324 r4
+  savpc r15
+  add r15 12 r15
+  jump expand_line
+  load32 -12 r2
+  sub r13 r2 r13
+  blts r1 r0 .L883
+  read -36 r14 r1
+  addr2reg ex_p r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg ex_bad r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg ex_skip r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_cond
+  write -4 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump ex_ws
+  read -4 r14 r1
+  addr2reg ex_bad r12
+  read 0 r12 r3
+  load 1 r2
+  bne r3 r0 .L880
+  addr2reg ex_p r12
+  read 0 r12 r2
+  readb 0 r2 r2
+  and r2 0xFF r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L880:
+  bne r2 r0 .L882
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L886
+.L882:
+  addr2reg .Lstring.74 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  load 0 r1
+  jump .L886
+.L883:
+  load32 -3 r2
+  beq r1 r2 .L885
+  addr2reg .Lstring.73 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+.L885:
+  load 0 r1
+.L886:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function eval_if */
+
+.data
+.balign 1
+.Lstring.76:
+	.ascii "bad #define\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.77:
+	.ascii "bad macro param\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.78:
+	.ascii "too many macro params\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.79:
+	.ascii "macro params too long\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.80:
+	.ascii "bad macro params\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.81:
+	.ascii "macro body too long\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.82:
+	.ascii "##\000"
+/* end data */
+
+
+.text
+; function handle_define
+handle_define:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 10444 r13
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  or r0 r1 r4
+  write -64 r14 r4
+  readb 0 r4 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_start
+  read -64 r14 r4
+  beq r1 r0 .L955
+  or r0 r4 r1
+.L891:
+  write -16 r14 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  or r0 r1 r2
+  read -16 r14 r1
+  beq r2 r0 .L893
+  add r1 1 r1
+  jump .L891
+.L893:
+  read -64 r14 r4
+  sub r1 r4 r5
+  write -60 r14 r5
+  readb 0 r1 r3
+  load32 -1 r2
+  load 40 r5
+  beq r3 r5 .L896
+  or r0 r1 r4
+  write -52 r14 r2
+  jump .L929
+.L896:
+  add r1 1 r1
+  load 0 r3
+  load 0 r2
+.L897:
+  write -28 r14 r3
+  write -32 r14 r2
+  readb 0 r1 r5
+  beq r5 r0 .L926
+.L898:
+  write -36 r14 r1
+  readb 0 r1 r5
+  load 1 r6
+  load 32 r7
+  beq r5 r7 .L900
+  xor r5 9 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L900:
+  beq r6 r0 .L902
+  add r1 1 r1
+  jump .L898
+.L902:
+  load 41 r1
+  beq r5 r1 .L924
+  and r5 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_start
+  or r0 r1 r2
+  read -36 r14 r1
+  beq r2 r0 .L923
+.L904:
+  write -24 r14 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  or r0 r1 r2
+  read -24 r14 r1
+  beq r2 r0 .L906
+  add r1 1 r1
+  jump .L904
+.L906:
+  or r0 r1 r4
+  read -36 r14 r1
+  read -28 r14 r3
+  read -32 r14 r2
+  sub r4 r1 r5
+  write -20 r14 r5
+  load 16 r4
+  bges r3 r4 .L922
+  add r2 r5 r4
+  add r4 1 r4
+  load 2048 r6
+  bgts r4 r6 .L921
+  or r0 r3 r4
+  add r14 -10372 r3
+  add r3 r2 r3
+  shiftl r4 2 r6
+  add r14 -10436 r4
+  add r4 r6 r4
+  write 0 r4 r3
+  add r14 -10372 r3
+  add r3 r2 r4
+  or r0 r5 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -24 r14 r1
+  read -28 r14 r3
+  read -32 r14 r2
+  read -20 r14 r5
+  read -64 r14 r4
+  add r2 r5 r7
+  add r14 -10372 r6
+  add r6 r7 r7
+  load 0 r6
+  writeb 0 r7 r6
+  add r5 1 r5
+  add r2 r5 r2
+  add r3 1 r3
+.L910:
+  readb 0 r1 r5
+  load 1 r6
+  load 32 r7
+  beq r5 r7 .L912
+  xor r5 9 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L912:
+  beq r6 r0 .L914
+  add r1 1 r1
+  jump .L910
+.L914:
+  load 44 r4
+  bne r5 r4 .L917
+  add r1 1 r1
+  read -64 r14 r4
+  jump .L897
+.L917:
+  or r0 r1 r4
+  load 41 r1
+  beq r5 r1 .L920
+  addr2reg .Lstring.80 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  jump .L956
+.L920:
+  or r0 r4 r1
+  add r4 1 r4
+  jump .L927
+.L921:
+  addr2reg .Lstring.79 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  jump .L956
+.L922:
+  addr2reg .Lstring.78 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  jump .L956
+.L923:
+  addr2reg .Lstring.77 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  jump .L956
+.L924:
+  read -36 r14 r4
+  read -28 r14 r3
+  or r0 r4 r1
+  add r4 1 r4
+  jump .L927
+.L926:
+  or r0 r1 r4
+.L927:
+  or r0 r3 r7
+  write -52 r14 r7
+.L929:
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  or r0 r1 r5
+  write -40 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r2
+  read -52 r14 r7
+  read -40 r14 r5
+  read -64 r14 r4
+  or r0 r7 r3
+  or r0 r5 r1
+.L931:
+  write -44 r14 r2
+  load 0 r5
+  bles r2 r0 .L935
+  load 1 r5
+  sub r2 r5 r5
+  add r1 r5 r5
+  readb 0 r5 r6
+  load 1 r5
+  load 32 r7
+  beq r6 r7 .L934
+  load 1 r5
+  sub r2 r5 r5
+  add r1 r5 r5
+  readb 0 r5 r5
+  xor r5 9 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L934:
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L935:
+  beq r5 r0 .L937
+  load 1 r5
+  sub r2 r5 r2
+  jump .L931
+.L937:
+  or r0 r1 r5
+  load 4096 r1
+  bges r2 r1 .L954
+  or r0 r2 r6
+  add r14 -8324 r4
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -44 r14 r2
+  read -52 r14 r7
+  add r14 -8324 r1
+  add r1 r2 r2
+  load 0 r1
+  writeb 0 r2 r1
+  load 0 r1
+  bges r7 r0 .L941
+  addr2reg .Lstring.82 r5
+  add r14 -8324 r4
+  savpc r15
+  add r15 12 r15
+  jump strstr
+  read -52 r14 r7
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L941:
+  beq r1 r0 .L944
+  load 0 r1
+  write -132 r14 r1
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 20 r3
+  load 4096 r2
+  write 0 r3 r2
+  add r1 16 r3
+  add r14 -132 r2
+  write 0 r3 r2
+  add r1 12 r3
+  add r14 -4228 r2
+  write 0 r3 r2
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r7
+  load 0 r6
+  load32 -1 r5
+  add r14 -8324 r4
+  savpc r15
+  add r15 12 r15
+  jump substitute_params
+  load32 -24 r2
+  sub r13 r2 r13
+  blts r1 r0 .L953
+  read -132 r14 r6
+  add r14 -4228 r5
+  add r14 -8324 r4
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -52 r14 r7
+  read -132 r14 r2
+  add r14 -8324 r1
+  add r1 r2 r2
+  load 0 r1
+  writeb 0 r2 r1
+.L944:
+  load 0 r1
+  or r0 r7 r3
+.L946:
+  write -56 r14 r1
+  bges r1 r3 .L951
+  shiftl r1 2 r2
+  add r14 -10436 r1
+  add r1 r2 r1
+  read 0 r1 r4
+  write -48 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -48 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strndup
+  or r0 r1 r2
+  read -56 r14 r1
+  read -52 r14 r3
+  shiftl r1 2 r5
+  add r14 -128 r4
+  add r4 r5 r4
+  write 0 r4 r2
+  shiftl r1 2 r4
+  add r14 -128 r2
+  add r2 r4 r2
+  read 0 r2 r2
+  beq r2 r0 .L956
+  add r1 1 r1
+  jump .L946
+.L951:
+  read -52 r14 r7
+  read -60 r14 r5
+  read -64 r14 r4
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  add r14 -128 r1
+  write 0 r2 r1
+  add r14 -8324 r6
+  savpc r15
+  add r15 12 r15
+  jump macro_define
+  load32 -12 r1
+  sub r13 r1 r13
+  jump .L956
+.L953:
+  addr2reg .Lstring.81 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  jump .L956
+.L954:
+  addr2reg .Lstring.81 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  jump .L956
+.L955:
+  addr2reg .Lstring.76 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+.L956:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function handle_define */
+
+
+.text
+; function branch_active
+branch_active:
+  load 0 r1
+.L960:
+  addr2reg cond_depth r12
+  read 0 r12 r2
+  bges r1 r2 .L964
+  shiftl r1 2 r3
+  addr2reg cond_active r2
+  add r2 r3 r2
+  read 0 r2 r2
+  beq r2 r0 .L963
+  add r1 1 r1
+  jump .L960
+.L963:
+  load 0 r1
+  jump .L965
+.L964:
+  load 1 r1
+.L965:
+  jumpr 0 r15
+
+/* end function branch_active */
+
+.data
+.balign 1
+.Lstring.85:
+	.ascii "conditional nesting too deep\000"
+/* end data */
+
+
+.text
+; function cond_push
+cond_push:
+  addr2reg cond_depth r12
+  read 0 r12 r1
+  load 64 r2
+  bges r1 r2 .L970
+  shiftl r1 2 r2
+  addr2reg cond_active r1
+  add r1 r2 r1
+  write 0 r1 r4
+  addr2reg cond_depth r12
+  read 0 r12 r1
+  shiftl r1 2 r2
+  addr2reg cond_taken r1
+  add r1 r2 r1
+  write 0 r1 r4
+  addr2reg cond_depth r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg cond_depth r12
+  write 0 r12 r1
+  jumpr 0 r15
+.L970:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lstring.85 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+.L971:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function cond_push */
+
+.data
+.balign 1
+.Lstring.87:
+	.ascii "missing identifier\000"
+/* end data */
+
+
+.text
+; function handle_ifdef
+handle_ifdef:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  or r0 r1 r4
+  write -16 r14 r4
+  or r0 r4 r1
+.L976:
+  write -8 r14 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  or r0 r1 r2
+  read -8 r14 r1
+  beq r2 r0 .L978
+  add r1 1 r1
+  jump .L976
+.L978:
+  read -16 r14 r4
+  sub r1 r4 r5
+  beq r5 r0 .L993
+  savpc r15
+  add r15 12 r15
+  jump macro_lookup
+  read -12 r14 r5
+  slt r1 r0 r1
+  xor r1 1 r4
+  beq r5 r0 .L982
+  xor r4 0 r1
+  sltu r1 1 r4
+.L982:
+  addr2reg cond_depth r12
+  read 0 r12 r3
+  bles r3 r0 .L992
+  load 1 r2
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L985:
+  bges r2 r3 .L989
+  shiftl r2 2 r6
+  addr2reg cond_active r5
+  add r5 r6 r5
+  read 0 r5 r5
+  bne r5 r0 .L988
+  load 0 r1
+.L988:
+  add r2 1 r2
+  jump .L985
+.L989:
+  bne r1 r0 .L992
+  load 0 r1
+  or r0 r1 r4
+.L992:
+  savpc r15
+  add r15 12 r15
+  jump cond_push
+  jump .L994
+.L993:
+  addr2reg .Lstring.87 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+.L994:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function handle_ifdef */
+
+.data
+.balign 1
+.Lstring.89:
+	.ascii "#else without #if\000"
+/* end data */
+
+
+.text
+; function handle_else
+handle_else:
+  addr2reg cond_depth r12
+  read 0 r12 r3
+  beq r3 r0 .L1010
+  load 1 r2
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L1000:
+  load 1 r4
+  sub r3 r4 r4
+  bges r2 r4 .L1004
+  shiftl r2 2 r5
+  addr2reg cond_active r4
+  add r4 r5 r4
+  read 0 r4 r4
+  bne r4 r0 .L1003
+  load 0 r1
+.L1003:
+  add r2 1 r2
+  jump .L1000
+.L1004:
+  or r0 r1 r2
+  load 1 r1
+  beq r2 r0 .L1007
+  load 1 r1
+  sub r3 r1 r1
+  shiftl r1 2 r2
+  addr2reg cond_taken r1
+  add r1 r2 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1007:
+  bne r1 r0 .L1009
+  load 1 r1
+  sub r3 r1 r1
+  shiftl r1 2 r2
+  addr2reg cond_active r1
+  add r1 r2 r2
+  load 1 r1
+  write 0 r2 r1
+  addr2reg cond_depth r12
+  read 0 r12 r1
+  load 1 r2
+  sub r1 r2 r1
+  shiftl r1 2 r2
+  addr2reg cond_taken r1
+  add r1 r2 r2
+  load 1 r1
+  write 0 r2 r1
+  jumpr 0 r15
+.L1009:
+  load 1 r1
+  sub r3 r1 r1
+  shiftl r1 2 r2
+  addr2reg cond_active r1
+  add r1 r2 r2
+  load 0 r1
+  write 0 r2 r1
+  jumpr 0 r15
+.L1010:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  addr2reg .Lstring.89 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+.L1011:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function handle_else */
+
+.data
+.balign 1
+.Lstring.91:
+	.ascii "#endif without #if\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.94:
+	.ascii "#elif without #if\000"
+/* end data */
+
+
+.text
+; function handle_elif
+handle_elif:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  addr2reg cond_depth r12
+  read 0 r12 r1
+  load 1 r2
+  sub r1 r2 r3
+  write -16 r14 r3
+  beq r1 r0 .L1029
+  load 1 r2
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L1017:
+  bges r2 r3 .L1021
+  shiftl r2 2 r6
+  addr2reg cond_active r5
+  add r5 r6 r5
+  read 0 r5 r5
+  bne r5 r0 .L1020
+  load 0 r1
+.L1020:
+  add r2 1 r2
+  jump .L1017
+.L1021:
+  or r0 r1 r2
+  shiftl r3 2 r5
+  addr2reg cond_active r1
+  add r1 r5 r5
+  load 0 r1
+  write 0 r5 r1
+  load 0 r1
+  bne r2 r0 .L1024
+  or r0 r1 r2
+  jump .L1025
+.L1024:
+  shiftl r3 2 r2
+  addr2reg cond_taken r1
+  add r1 r2 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L1025:
+  load 0 r1
+  beq r2 r0 .L1027
+  savpc r15
+  add r15 12 r15
+  jump eval_if
+  read -16 r14 r3
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1027:
+  beq r1 r0 .L1030
+  shiftl r3 2 r2
+  addr2reg cond_active r1
+  add r1 r2 r2
+  load 1 r1
+  write 0 r2 r1
+  shiftl r3 2 r2
+  addr2reg cond_taken r1
+  add r1 r2 r2
+  load 1 r1
+  write 0 r2 r1
+  jump .L1030
+.L1029:
+  addr2reg .Lstring.94 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+.L1030:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function handle_elif */
+
+
+.text
+; function handle_undef
+handle_undef:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  or r0 r1 r4
+  write -16 r14 r4
+  or r0 r4 r1
+.L1035:
+  write -12 r14 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  or r0 r1 r2
+  read -12 r14 r1
+  beq r2 r0 .L1037
+  add r1 1 r1
+  jump .L1035
+.L1037:
+  read -16 r14 r4
+  beq r1 r4 .L1041
+  sub r1 r4 r5
+  savpc r15
+  add r15 12 r15
+  jump macro_lookup
+  blts r1 r0 .L1042
+  load 28 r2
+  mults r1 r2 r2
+  addr2reg macros r1
+  add r1 r2 r1
+  add r1 20 r2
+  load32 -2 r1
+  write 0 r2 r1
+  jump .L1042
+.L1041:
+  addr2reg .Lstring.87 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+.L1042:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function handle_undef */
+
+.data
+.balign 1
+.Lstring.97:
+	.ascii "bad #include\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.98:
+	.ascii "include path too long\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.99:
+	.ascii "unterminated #include\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.100:
+	.ascii "cannot find include: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.101:
+	.ascii "include depth exceeded\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.102:
+	.ascii "cannot read: \000"
+/* end data */
+
+
+.text
+; function handle_include
+handle_include:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 1048 r13
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  readb 0 r1 r2
+  load 0 r3
+  load 34 r4
+  beq r2 r4 .L1047
+  xor r2 60 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L1047:
+  bne r3 r0 .L1071
+  xor r2 34 r2
+  sltu r2 1 r5
+  bne r5 r0 .L1050
+  load 62 r2
+  jump .L1051
+.L1050:
+  load 34 r2
+.L1051:
+  or r0 r2 r3
+  add r1 1 r1
+  load 0 r2
+  or r0 r5 r4
+.L1053:
+  readb 0 r1 r5
+  load 0 r6
+  beq r5 r0 .L1055
+  shiftl r3 24 r6
+  shiftrs r6 24 r6
+  xor r5 r6 r6
+  sltu r0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L1055:
+  beq r6 r0 .L1059
+  load 255 r6
+  bges r2 r6 .L1058
+  add r1 1 r1
+  or r0 r2 r6
+  add r2 1 r2
+  add r14 -1040 r7
+  add r7 r6 r6
+  writeb 0 r6 r5
+  jump .L1053
+.L1058:
+  addr2reg .Lstring.98 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  jump .L1072
+.L1059:
+  or r0 r4 r5
+  add r14 -1040 r4
+  add r4 r2 r4
+  load 0 r2
+  writeb 0 r4 r2
+  readb 0 r1 r1
+  shiftl r3 24 r2
+  shiftrs r2 24 r2
+  bne r1 r2 .L1070
+  load 512 r7
+  add r14 -784 r6
+  add r14 -1040 r4
+  savpc r15
+  add r15 12 r15
+  jump resolve_include
+  blts r1 r0 .L1069
+  addr2reg include_depth r12
+  read 0 r12 r1
+  load 16 r2
+  bges r1 r2 .L1068
+  load 0 r5
+  add r14 -784 r4
+  savpc r15
+  add r15 12 r15
+  jump load_file
+  or r0 r1 r4
+  write -8 r14 r4
+  beq r4 r0 .L1067
+  load 256 r6
+  add r14 -272 r5
+  add r14 -784 r4
+  savpc r15
+  add r15 12 r15
+  jump path_dirname
+  add r14 -272 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  add r14 -272 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strndup
+  read -8 r14 r4
+  addr2reg include_depth r12
+  read 0 r12 r2
+  shiftl r2 2 r3
+  addr2reg quote_dir_stack r2
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg include_depth r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg include_depth r12
+  write 0 r12 r1
+  addr2reg cur_filename r12
+  read 0 r12 r2
+  write -16 r14 r2
+  addr2reg cur_line r12
+  read 0 r12 r1
+  write -12 r14 r1
+  add r14 -784 r5
+  savpc r15
+  add r15 12 r15
+  jump process_text
+  read -12 r14 r1
+  read -16 r14 r2
+  addr2reg include_depth r12
+  read 0 r12 r3
+  load 1 r4
+  sub r3 r4 r3
+  addr2reg include_depth r12
+  write 0 r12 r3
+  addr2reg cur_filename r12
+  write 0 r12 r2
+  addr2reg cur_line r12
+  write 0 r12 r1
+  jump .L1072
+.L1067:
+  add r14 -784 r5
+  addr2reg .Lstring.102 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L1072
+.L1068:
+  addr2reg .Lstring.101 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  jump .L1072
+.L1069:
+  add r14 -1040 r5
+  addr2reg .Lstring.100 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L1072
+.L1070:
+  addr2reg .Lstring.99 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  jump .L1072
+.L1071:
+  addr2reg .Lstring.97 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+.L1072:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function handle_include */
+
+.data
+.balign 1
+.Lstring.104:
+	.ascii "ifdef\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.105:
+	.ascii "ifndef\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.106:
+	.ascii "if\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.107:
+	.ascii "elif\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.108:
+	.ascii "else\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.109:
+	.ascii "endif\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.110:
+	.ascii "define\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.111:
+	.ascii "include\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.112:
+	.ascii "undef\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.113:
+	.ascii "error\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.114:
+	.ascii "#error \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.115:
+	.ascii "pragma\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.116:
+	.ascii "unsupported directive: #\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.117:
+	.ascii "unterminated macro call\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.118:
+	.ascii "expansion buffer overflow\000"
+/* end data */
+
+
+.text
+; function process_text
+process_text:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16524 r13
+  load 0 r1
+  write -4224 r14 r1
+  addr2reg cur_filename r12
+  write 0 r12 r5
+  load 1 r1
+  addr2reg cur_line r12
+  write 0 r12 r1
+.L1076:
+  add r14 -4228 r7
+  load 4096 r6
+  add r14 -16516 r5
+  savpc r15
+  add r15 12 r15
+  jump read_logical_line
+  or r0 r1 r4
+  write -44 r14 r4
+  beq r4 r0 .L1160
+  add r14 -4224 r5
+  add r14 -16516 r4
+  savpc r15
+  add r15 12 r15
+  jump strip_comments
+  add r14 -16516 r4
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  readb 0 r1 r2
+  load 35 r3
+  beq r2 r3 .L1098
+  savpc r15
+  add r15 12 r15
+  jump branch_active
+  beq r1 r0 .L1097
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  add r14 -56 r1
+  write 0 r2 r1
+  load 4096 r7
+  add r14 -8324 r6
+  add r14 -12420 r5
+  add r14 -16516 r4
+  savpc r15
+  add r15 12 r15
+  jump expand_line
+  read -44 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  write -24 r14 r4
+.L1081:
+  write -12 r14 r1
+  load32 -2 r2
+  bne r1 r2 .L1089
+  add r14 -16516 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  write -16 r14 r1
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  read -24 r14 r4
+  read -16 r14 r2
+  readb 0 r1 r3
+  load 1 r1
+  load 35 r5
+  beq r3 r5 .L1084
+  add r2 2 r1
+  slt r1 4096 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1084:
+  bne r1 r0 .L1088
+  add r14 -16516 r1
+  add r1 r2 r3
+  load 32 r1
+  writeb 0 r3 r1
+  add r14 -16516 r1
+  add r1 r2 r1
+  add r1 1 r5
+  load 4096 r1
+  sub r1 r2 r1
+  load 1 r2
+  sub r1 r2 r6
+  add r14 -52 r7
+  savpc r15
+  add r15 12 r15
+  jump read_logical_line
+  or r0 r1 r4
+  read -12 r14 r1
+  read -16 r14 r2
+  write -20 r14 r4
+  beq r4 r0 .L1090
+  add r14 -16516 r1
+  add r1 r2 r1
+  add r1 1 r4
+  add r14 -4224 r5
+  savpc r15
+  add r15 12 r15
+  jump strip_comments
+  read -4228 r14 r1
+  read -52 r14 r2
+  add r1 r2 r1
+  write -4228 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  add r14 -56 r1
+  write 0 r2 r1
+  load 4096 r7
+  add r14 -8324 r6
+  add r14 -12420 r5
+  add r14 -16516 r4
+  savpc r15
+  add r15 12 r15
+  jump expand_line
+  read -20 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  write -24 r14 r4
+  jump .L1081
+.L1088:
+  read -12 r14 r1
+  jump .L1090
+.L1089:
+  read -12 r14 r1
+.L1090:
+  load32 -2 r2
+  beq r1 r2 .L1095
+  load32 -1 r2
+  beq r1 r2 .L1094
+  blts r1 r0 .L1096
+  read -56 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump out_text
+  jump .L1096
+.L1094:
+  addr2reg .Lstring.118 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  jump .L1096
+.L1095:
+  addr2reg .Lstring.117 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+.L1096:
+  load 1 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump out_write
+  read -24 r14 r4
+  addr2reg cur_line r12
+  read 0 r12 r1
+  read -4228 r14 r2
+  add r1 r2 r1
+  addr2reg cur_line r12
+  write 0 r12 r1
+  jump .L1076
+.L1097:
+  load 1 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump out_write
+  read -44 r14 r4
+  addr2reg cur_line r12
+  read 0 r12 r1
+  read -4228 r14 r2
+  add r1 r2 r1
+  addr2reg cur_line r12
+  write 0 r12 r1
+  jump .L1076
+.L1098:
+  add r1 1 r4
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  write -48 r14 r1
+.L1099:
+  write -28 r14 r1
+  readb 0 r1 r1
+  and r1 0xFF r4
+  savpc r15
+  add r15 12 r15
+  jump is_id_cont
+  or r0 r1 r2
+  read -28 r14 r1
+  beq r2 r0 .L1101
+  add r1 1 r1
+  jump .L1099
+.L1101:
+  or r0 r1 r5
+  read -48 r14 r1
+  sub r5 r1 r2
+  write -36 r14 r2
+  load 0 r1
+  write -124 r14 r1
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r2
+  read -28 r14 r5
+  load 4096 r1
+  blts r2 r1 .L1105
+  load 4095 r1
+  or r0 r1 r2
+.L1105:
+  write -32 r14 r2
+  or r0 r2 r6
+  or r0 r5 r1
+  add r14 -4220 r4
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -32 r14 r2
+  add r14 -4220 r1
+  add r1 r2 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -124 r5
+  add r14 -4220 r4
+  savpc r15
+  add r15 12 r15
+  jump strip_comments
+  read -36 r14 r2
+  read -48 r14 r5
+  load 0 r1
+  load 5 r3
+  bne r2 r3 .L1107
+  load 5 r6
+  or r0 r5 r1
+  addr2reg .Lstring.104 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  read -36 r14 r2
+  read -48 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1107:
+  bne r1 r0 .L1158
+  load 0 r1
+  load 6 r3
+  bne r2 r3 .L1110
+  load 6 r6
+  or r0 r5 r1
+  addr2reg .Lstring.105 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  read -36 r14 r2
+  read -48 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1110:
+  bne r1 r0 .L1157
+  load 0 r1
+  load 2 r3
+  bne r2 r3 .L1113
+  load 2 r6
+  or r0 r5 r1
+  addr2reg .Lstring.106 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  read -36 r14 r2
+  read -48 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1113:
+  bne r1 r0 .L1153
+  load 0 r1
+  load 4 r3
+  bne r2 r3 .L1116
+  load 4 r6
+  or r0 r5 r1
+  addr2reg .Lstring.107 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  read -36 r14 r2
+  read -48 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1116:
+  bne r1 r0 .L1152
+  load 0 r1
+  load 4 r3
+  bne r2 r3 .L1119
+  load 4 r6
+  or r0 r5 r1
+  addr2reg .Lstring.108 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  read -36 r14 r2
+  read -48 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1119:
+  bne r1 r0 .L1151
+  load 0 r1
+  load 5 r3
+  bne r2 r3 .L1122
+  load 5 r6
+  or r0 r5 r1
+  addr2reg .Lstring.109 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1122:
+  bne r1 r0 .L1148
+  savpc r15
+  add r15 12 r15
+  jump branch_active
+  read -36 r14 r2
+  read -48 r14 r5
+  beq r1 r0 .L1159
+  load 0 r1
+  load 6 r3
+  bne r2 r3 .L1126
+  load 6 r6
+  or r0 r5 r1
+  addr2reg .Lstring.110 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  read -36 r14 r2
+  read -48 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1126:
+  bne r1 r0 .L1147
+  load 0 r1
+  load 7 r3
+  bne r2 r3 .L1129
+  load 7 r6
+  or r0 r5 r1
+  addr2reg .Lstring.111 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  read -36 r14 r2
+  read -48 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1129:
+  bne r1 r0 .L1146
+  load 0 r1
+  load 5 r3
+  bne r2 r3 .L1132
+  load 5 r6
+  or r0 r5 r1
+  addr2reg .Lstring.112 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  read -36 r14 r2
+  read -48 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1132:
+  bne r1 r0 .L1145
+  load 0 r1
+  load 5 r3
+  bne r2 r3 .L1135
+  load 5 r6
+  or r0 r5 r1
+  addr2reg .Lstring.113 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  read -36 r14 r2
+  read -48 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1135:
+  bne r1 r0 .L1144
+  load 0 r1
+  load 6 r3
+  bne r2 r3 .L1138
+  load 6 r6
+  or r0 r5 r1
+  addr2reg .Lstring.115 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  read -36 r14 r2
+  read -48 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1138:
+  bne r1 r0 .L1159
+  beq r2 r0 .L1159
+  load 60 r1
+  blts r2 r1 .L1143
+  load 60 r1
+  or r0 r1 r2
+.L1143:
+  write -40 r14 r2
+  or r0 r2 r6
+  add r14 -120 r4
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -40 r14 r2
+  add r14 -120 r1
+  add r1 r2 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -120 r5
+  addr2reg .Lstring.116 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L1159
+.L1144:
+  add r14 -4220 r4
+  savpc r15
+  add r15 12 r15
+  jump skip_hws
+  or r0 r1 r5
+  addr2reg .Lstring.114 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg2
+  jump .L1159
+.L1145:
+  add r14 -4220 r4
+  savpc r15
+  add r15 12 r15
+  jump handle_undef
+  jump .L1159
+.L1146:
+  add r14 -4220 r4
+  savpc r15
+  add r15 12 r15
+  jump handle_include
+  jump .L1159
+.L1147:
+  add r14 -4220 r4
+  savpc r15
+  add r15 12 r15
+  jump handle_define
+  jump .L1159
+.L1148:
+  addr2reg cond_depth r12
+  read 0 r12 r1
+  beq r1 r0 .L1150
+  load 1 r2
+  sub r1 r2 r1
+  addr2reg cond_depth r12
+  write 0 r12 r1
+  jump .L1159
+.L1150:
+  addr2reg .Lstring.91 r4
+  savpc r15
+  add r15 12 r15
+  jump emsg
+  jump .L1159
+.L1151:
+  savpc r15
+  add r15 12 r15
+  jump handle_else
+  jump .L1159
+.L1152:
+  add r14 -4220 r4
+  savpc r15
+  add r15 12 r15
+  jump handle_elif
+  jump .L1159
+.L1153:
+  savpc r15
+  add r15 12 r15
+  jump branch_active
+  or r0 r1 r2
+  load 0 r1
+  bne r2 r0 .L1155
+  or r0 r1 r4
+  jump .L1156
+.L1155:
+  add r14 -4220 r4
+  savpc r15
+  add r15 12 r15
+  jump eval_if
+  xor r1 0 r1
+  sltu r0 r1 r4
+.L1156:
+  savpc r15
+  add r15 12 r15
+  jump cond_push
+  jump .L1159
+.L1157:
+  load 1 r5
+  add r14 -4220 r4
+  savpc r15
+  add r15 12 r15
+  jump handle_ifdef
+  jump .L1159
+.L1158:
+  load 0 r5
+  add r14 -4220 r4
+  savpc r15
+  add r15 12 r15
+  jump handle_ifdef
+.L1159:
+  load 1 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump out_write
+  read -44 r14 r4
+  addr2reg cur_line r12
+  read 0 r12 r1
+  read -4228 r14 r2
+  add r1 r2 r1
+  addr2reg cur_line r12
+  write 0 r12 r1
+  jump .L1076
+.L1160:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function process_text */
+
+.data
+.balign 1
+.Lstring.121:
+	.ascii "__STDC__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.122:
+	.ascii "1\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.123:
+	.ascii "__STDC_VERSION__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.124:
+	.ascii "201112L\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.125:
+	.ascii "__ORDER_LITTLE_ENDIAN__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.126:
+	.ascii "1234\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.127:
+	.ascii "__ORDER_BIG_ENDIAN__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.128:
+	.ascii "4321\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.129:
+	.ascii "__BYTE_ORDER__\000"
+/* end data */
+
+.data
+.balign 4
+.Ldefs.120:
+	.int .Lstring.121+0
+	.int .Lstring.122+0
+	.int .Lstring.123+0
+	.int .Lstring.124+0
+	.int .Lstring.125+0
+	.int .Lstring.126+0
+	.int .Lstring.127+0
+	.int .Lstring.128+0
+	.int .Lstring.129+0
+	.int .Lstring.125+0
+/* end data */
+
+
+.text
+; function predefine
+predefine:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  load 0 r1
+.L1164:
+  write -16 r14 r1
+  load 10 r2
+  bges r1 r2 .L1167
+  shiftl r1 2 r3
+  addr2reg .Ldefs.120 r2
+  add r2 r3 r2
+  read 0 r2 r4
+  write -12 r14 r4
+  shiftl r1 2 r2
+  addr2reg .Ldefs.120 r1
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -16 r14 r1
+  read -12 r14 r4
+  add r1 1 r1
+  shiftl r1 2 r2
+  addr2reg .Ldefs.120 r1
+  add r1 r2 r1
+  read 0 r1 r6
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load32 -1 r7
+  savpc r15
+  add r15 12 r15
+  jump macro_define
+  read -16 r14 r1
+  load32 -12 r2
+  sub r13 r2 r13
+  add r1 2 r1
+  jump .L1164
+.L1167:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function predefine */
+
+.data
+.balign 1
+.Lstring.131:
+	.ascii "usage: cpp [-D NAME[=VAL]] [-I PATH] [-o output] input.c\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.133:
+	.ascii "cpp: out of memory\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.134:
+	.ascii "-D\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.135:
+	.ascii "-I\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.136:
+	.ascii "-o\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.137:
+	.ascii "cpp: cannot open output\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.138:
+	.ascii "cpp: cannot read input\012\000"
+/* end data */
+
+
+.text
+; function cpp_main
+.global cpp_main
+cpp_main:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 312 r13
+  write -48 r14 r5
+  write -36 r14 r4
+  load32 1048576 r1
+  addr2reg str_pool_size r12
+  write 0 r12 r1
+  load32 1048576 r4
+  savpc r15
+  add r15 12 r15
+  jump malloc
+  addr2reg str_pool r12
+  write 0 r12 r1
+  beq r1 r0 .L1213
+  savpc r15
+  add r15 12 r15
+  jump predefine
+  read -48 r14 r5
+  read -36 r14 r4
+  load 1 r3
+  load 0 r2
+  load 0 r1
+  write -44 r14 r2
+  write -40 r14 r1
+.L1173:
+  write -12 r14 r3
+  bges r3 r4 .L1195
+  shiftl r3 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.134 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -12 r14 r3
+  read -48 r14 r5
+  read -36 r14 r4
+  load 0 r1
+  bne r2 r0 .L1176
+  add r3 1 r1
+  slt r1 r4 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1176:
+  bne r1 r0 .L1190
+  shiftl r3 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.135 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r7
+  read -12 r14 r3
+  read -44 r14 r2
+  read -40 r14 r1
+  read -48 r14 r5
+  read -36 r14 r4
+  load 0 r6
+  bne r7 r0 .L1179
+  add r3 1 r6
+  slt r6 r4 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L1179:
+  bne r6 r0 .L1186
+  shiftl r3 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  addr2reg .Lstring.136 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r7
+  read -12 r14 r3
+  read -44 r14 r2
+  read -40 r14 r1
+  read -48 r14 r5
+  read -36 r14 r4
+  load 0 r6
+  bne r7 r0 .L1182
+  add r3 1 r6
+  slt r6 r4 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L1182:
+  bne r6 r0 .L1185
+  shiftl r3 2 r6
+  add r5 r6 r6
+  read 0 r6 r6
+  add r6 0 r6
+  readb 0 r6 r6
+  load 45 r7
+  beq r6 r7 .L1193
+  shiftl r3 2 r2
+  add r5 r2 r2
+  read 0 r2 r2
+  jump .L1193
+.L1185:
+  add r3 1 r3
+  shiftl r3 2 r1
+  add r5 r1 r1
+  read 0 r1 r1
+  jump .L1193
+.L1186:
+  addr2reg include_dir_count r12
+  read 0 r12 r6
+  load 16 r7
+  bges r6 r7 .L1193
+  add r3 1 r3
+  write -20 r14 r3
+  shiftl r3 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strndup
+  write -24 r14 r1
+  read -44 r14 r2
+  read -40 r14 r1
+  read -20 r14 r3
+  read -48 r14 r5
+  read -36 r14 r4
+  addr2reg include_dir_count r12
+  read 0 r12 r6
+  add r6 1 r7
+  addr2reg include_dir_count r12
+  write 0 r12 r7
+  shiftl r6 2 r7
+  addr2reg include_dirs r6
+  add r6 r7 r7
+  read -24 r14 r6
+  write 0 r7 r6
+  jump .L1193
+.L1190:
+  add r3 1 r3
+  write -32 r14 r3
+  shiftl r3 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  write -28 r14 r4
+  load 61 r5
+  savpc r15
+  add r15 12 r15
+  jump strchr
+  read -28 r14 r4
+  bne r1 r0 .L1192
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  read -28 r14 r4
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load32 -1 r7
+  addr2reg .Lstring.122 r6
+  savpc r15
+  add r15 12 r15
+  jump macro_define
+  read -44 r14 r2
+  read -40 r14 r1
+  read -32 r14 r3
+  read -48 r14 r5
+  read -36 r14 r4
+  load32 -12 r6
+  sub r13 r6 r13
+  jump .L1193
+.L1192:
+  sub r1 r4 r5
+  add r1 1 r6
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load32 -1 r7
+  savpc r15
+  add r15 12 r15
+  jump macro_define
+  read -44 r14 r2
+  read -40 r14 r1
+  read -32 r14 r3
+  read -48 r14 r5
+  read -36 r14 r4
+  load32 -12 r6
+  sub r13 r6 r13
+.L1193:
+  add r3 1 r3
+  write -44 r14 r2
+  write -40 r14 r1
+  jump .L1173
+.L1195:
+  read -44 r14 r5
+  read -40 r14 r4
+  beq r5 r0 .L1211
+  bne r4 r0 .L1199
+  load 1 r1
+  addr2reg out_fd r12
+  write 0 r12 r1
+  addr2reg __stdout_file r1
+  addr2reg out_fp r12
+  write 0 r12 r1
+  jump .L1200
+.L1199:
+  load 26 r5
+  savpc r15
+  add r15 12 r15
+  jump sys_open
+  read -44 r14 r5
+  addr2reg out_fd r12
+  write 0 r12 r1
+  blts r1 r0 .L1210
+.L1200:
+  or r0 r5 r1
+  load 0 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump load_file
+  or r0 r1 r4
+  read -44 r14 r5
+  write -8 r14 r4
+  beq r4 r0 .L1209
+  load 256 r6
+  or r0 r5 r1
+  add r14 -304 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump path_dirname
+  add r14 -304 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r5
+  add r14 -304 r4
+  savpc r15
+  add r15 12 r15
+  jump pool_strndup
+  read -44 r14 r5
+  read -8 r14 r4
+  addr2reg include_depth r12
+  read 0 r12 r2
+  add r2 1 r3
+  addr2reg include_depth r12
+  write 0 r12 r3
+  shiftl r2 2 r3
+  addr2reg quote_dir_stack r2
+  add r2 r3 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump process_text
+  addr2reg include_depth r12
+  read 0 r12 r1
+  load 1 r2
+  sub r1 r2 r1
+  addr2reg include_depth r12
+  write 0 r12 r1
+  addr2reg out_fd r12
+  read 0 r12 r4
+  load 1 r1
+  bles r4 r1 .L1206
+  savpc r15
+  add r15 12 r15
+  jump sys_close
+.L1206:
+  addr2reg str_pool r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  addr2reg has_error r12
+  read 0 r12 r1
+  bne r1 r0 .L1208
+  load 0 r1
+  jump .L1214
+.L1208:
+  load 1 r1
+  jump .L1214
+.L1209:
+  addr2reg .Lstring.138 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  jump .L1214
+.L1210:
+  addr2reg .Lstring.137 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  jump .L1214
+.L1211:
+  addr2reg .Lstring.131 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+  jump .L1214
+.L1213:
+  addr2reg .Lstring.133 r4
+  savpc r15
+  add r15 12 r15
+  jump sys_putstr
+  load 1 r1
+.L1214:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function cpp_main */
+
+.data
+.balign 4
+str_pool:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+str_pool_pos:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+str_pool_size:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+macros:
+	.fill 57344,1,0
+/* end data */
+
+.data
+.balign 4
+macro_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+macro_heads:
+	.fill 4096,1,0
+/* end data */
+
+.data
+.balign 4
+include_dirs:
+	.fill 64,1,0
+/* end data */
+
+.data
+.balign 4
+include_dir_count:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+quote_dir_stack:
+	.fill 64,1,0
+/* end data */
+
+.data
+.balign 4
+include_depth:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+cond_active:
+	.fill 256,1,0
+/* end data */
+
+.data
+.balign 4
+cond_taken:
+	.fill 256,1,0
+/* end data */
+
+.data
+.balign 4
+cond_depth:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_fp:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+out_fd:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+has_error:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+cur_filename:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+cur_line:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+fn_name_pending:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+ex_p:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+ex_bad:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+ex_skip:
+	.fill 4,1,0
+/* end data */
+
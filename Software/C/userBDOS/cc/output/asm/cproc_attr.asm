@@ -0,0 +1,721 @@
+
+.text
+; function strip
+strip:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r1
+  write -16 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r2
+  read -16 r14 r1
+  load 0 r3
+  load 4 r4
+  bge r2 r4 .L3
+  or r0 r3 r4
+  jump .L4
+.L3:
+  add r1 0 r3
+  readb 0 r3 r3
+  xor r3 95 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L4:
+  load 0 r3
+  bne r4 r0 .L6
+  or r0 r3 r4
+  jump .L7
+.L6:
+  add r1 1 r3
+  readb 0 r3 r3
+  xor r3 95 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L7:
+  load 0 r3
+  bne r4 r0 .L9
+  or r0 r3 r4
+  jump .L10
+.L9:
+  load 2 r3
+  sub r2 r3 r3
+  add r1 r3 r3
+  readb 0 r3 r3
+  xor r3 95 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L10:
+  load 0 r3
+  beq r4 r0 .L12
+  load 1 r3
+  sub r2 r3 r3
+  add r1 r3 r3
+  readb 0 r3 r3
+  xor r3 95 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L12:
+  beq r3 r0 .L14
+  load 2 r3
+  sub r2 r3 r2
+  add r1 r2 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r1 2 r1
+.L14:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function strip */
+
+.data
+.balign 1
+.Lstring.3:
+	.ascii "\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.4:
+	.ascii "gnu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "after attribute prefix\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "GNU \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "aligned\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "invalid alignment %llu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "after alignment\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "constructor\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "destructor\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "packed\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "noinline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "always_inline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "%sattribute '%s' is not supported here\000"
+/* end data */
+
+
+.text
+; function parseattr
+parseattr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  write -16 r14 r6
+  write -32 r14 r5
+  write -48 r14 r4
+  addr2reg tok r12
+  read 0 r12 r1
+  load 4 r2
+  bne r1 r2 .L90
+  addr2reg tok+20 r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump strip
+  write -20 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -20 r14 r7
+  read -16 r14 r6
+  read -32 r14 r5
+  read -48 r14 r4
+  bne r6 r0 .L28
+  load 96 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -20 r14 r7
+  read -32 r14 r5
+  read -48 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L22
+  load 1 r1
+  or r0 r1 r6
+  jump .L28
+.L22:
+  addr2reg .Lstring.4 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  beq r1 r0 .L25
+  load 0 r1
+  write -24 r14 r1
+  jump .L27
+.L25:
+  load 2 r1
+  write -24 r14 r1
+.L27:
+  addr2reg .Lstring.5 r5
+  load 4 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strip
+  or r0 r1 r7
+  read -24 r14 r6
+  read -32 r14 r5
+  read -48 r14 r4
+.L28:
+  write -36 r14 r7
+  load 2 r1
+  beq r6 r1 .L35
+  load 2 r1
+  blt r6 r1 .L33
+  addr2reg .Lstring.3 r2
+  load 0 r1
+  or r0 r2 r6
+  or r0 r1 r2
+  jump .L68
+.L33:
+  addr2reg .Lstring.3 r2
+  load 0 r1
+  or r0 r2 r6
+  or r0 r1 r2
+  jump .L68
+.L35:
+  addr2reg .Lstring.7 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -36 r14 r7
+  beq r1 r0 .L51
+  addr2reg .Lstring.10 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -36 r14 r7
+  read -32 r14 r5
+  read -48 r14 r4
+  beq r1 r0 .L49
+  addr2reg .Lstring.11 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -36 r14 r7
+  read -32 r14 r5
+  read -48 r14 r4
+  beq r1 r0 .L47
+  addr2reg .Lstring.12 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -36 r14 r7
+  read -32 r14 r5
+  read -48 r14 r4
+  beq r1 r0 .L45
+  addr2reg .Lstring.13 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -36 r14 r7
+  read -32 r14 r5
+  read -48 r14 r4
+  beq r1 r0 .L43
+  addr2reg .Lstring.14 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -36 r14 r7
+  read -32 r14 r5
+  read -48 r14 r4
+  load 0 r1
+  bne r2 r0 .L42
+  load 32 r1
+.L42:
+  or r0 r1 r2
+  jump .L66
+.L43:
+  load 16 r1
+  or r0 r1 r2
+  jump .L66
+.L45:
+  load 8 r1
+  or r0 r1 r2
+  jump .L66
+.L47:
+  load 4 r1
+  or r0 r1 r2
+  jump .L66
+.L49:
+  load 2 r1
+  or r0 r1 r2
+  jump .L66
+.L51:
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -36 r14 r7
+  read -32 r14 r5
+  read -48 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L54
+  beq r4 r0 .L64
+  add r4 4 r2
+  load 16 r1
+  write 0 r2 r1
+  jump .L64
+.L54:
+  load 0 r5
+  addr2reg filescope r4
+  savpc r15
+  add r15 12 r15
+  jump intconstexpr
+  read -48 r14 r4
+  write -28 r14 r1
+  load 1 r2
+  beq r1 r0 .L56
+  load 1 r2
+  sub r1 r2 r2
+  and r1 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L57
+.L56:
+  or r0 r2 r3
+.L57:
+  load 1 r2
+  bne r3 r0 .L59
+  load32 2147483647 r2
+  sltu r2 r1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L59:
+  beq r2 r0 .L61
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r6
+  addr2reg .Lstring.8 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -28 r14 r1
+  read -48 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L61:
+  beq r4 r0 .L63
+  add r4 4 r2
+  write 0 r2 r1
+.L63:
+  addr2reg .Lstring.9 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -36 r14 r7
+  read -32 r14 r5
+  read -48 r14 r4
+.L64:
+  load 1 r1
+  or r0 r1 r2
+.L66:
+  addr2reg .Lstring.6 r1
+  or r0 r1 r6
+.L68:
+  write -44 r14 r2
+  bne r2 r0 .L85
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  and r1 0xFF r1
+  beq r1 r0 .L89
+  load 1 r1
+.L71:
+  bles r1 r0 .L89
+  addr2reg tok r12
+  read 0 r12 r2
+  load 67 r3
+  beq r2 r3 .L82
+  load 67 r3
+  blt r2 r3 .L76
+  write -40 r14 r1
+  jump .L84
+.L76:
+  load 66 r3
+  beq r2 r3 .L80
+  load 66 r3
+  blt r2 r3 .L79
+  write -40 r14 r1
+  jump .L84
+.L79:
+  write -40 r14 r1
+  jump .L84
+.L80:
+  add r1 1 r1
+  write -40 r14 r1
+  jump .L84
+.L82:
+  load 1 r2
+  sub r1 r2 r1
+  write -40 r14 r1
+.L84:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -40 r14 r1
+  jump .L71
+.L85:
+  and r2 r5 r1
+  bne r1 r0 .L87
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.15 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -44 r14 r2
+  read -48 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L87:
+  beq r4 r0 .L89
+  read 0 r4 r1
+  or r1 r2 r1
+  write 0 r4 r1
+.L89:
+  load 1 r1
+  jump .L91
+.L90:
+  load 0 r1
+.L91:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parseattr */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "to end attribute specifier\000"
+/* end data */
+
+
+.text
+; function attrspec
+attrspec:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  addr2reg tok r12
+  read 0 r12 r2
+  load 1 r1
+  load 64 r3
+  bne r2 r3 .L96
+  load 64 r4
+  savpc r15
+  add r15 12 r15
+  jump peek
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L96:
+  bne r1 r0 .L101
+.L97:
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump parseattr
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r2
+  load 1 r1
+  bne r2 r0 .L99
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L99:
+  bne r1 r0 .L97
+  addr2reg .Lstring.17 r5
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg .Lstring.17 r5
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  load 1 r1
+  jump .L102
+.L101:
+  load 0 r1
+.L102:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function attrspec */
+
+
+.text
+; function attr
+.global attr
+attr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump attrspec
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r1
+  beq r1 r0 .L108
+.L106:
+  savpc r15
+  add r15 12 r15
+  jump attrspec
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L106
+  load 1 r1
+  jump .L109
+.L108:
+  load 0 r1
+.L109:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function attr */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "after '__attribute__' to begin attribute specifier\000"
+/* end data */
+
+
+.text
+; function gnuattrspec
+gnuattrspec:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  load 63 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r1
+  beq r1 r0 .L121
+.L113:
+  load 2 r6
+  savpc r15
+  add r15 12 r15
+  jump parseattr
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r2
+  load 1 r1
+  bne r2 r0 .L115
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L115:
+  bne r1 r0 .L113
+  addr2reg .Lstring.20 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg .Lstring.20 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -12 r14 r5
+  read -16 r14 r4
+.L117:
+  load 2 r6
+  savpc r15
+  add r15 12 r15
+  jump parseattr
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r2
+  load 1 r1
+  bne r2 r0 .L119
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L119:
+  bne r1 r0 .L117
+  addr2reg .Lstring.17 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg .Lstring.17 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  load 1 r1
+  jump .L122
+.L121:
+  load 0 r1
+.L122:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function gnuattrspec */
+
+
+.text
+; function gnuattr
+.global gnuattr
+gnuattr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump gnuattrspec
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r1
+  beq r1 r0 .L128
+.L126:
+  savpc r15
+  add r15 12 r15
+  jump gnuattrspec
+  read -12 r14 r5
+  read -16 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L126
+  load 1 r1
+  jump .L129
+.L128:
+  load 0 r1
+.L129:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function gnuattr */
+
@@ -0,0 +1,6816 @@
+.data
+.balign 4
+tentativedefnsend:
+	.int tentativedefns+0
+/* end data */
+
+
+.text
+; function mkdecl
+.global mkdecl
+mkdecl:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  read 8 r14 r1
+  write -12 r14 r1
+  write -16 r14 r7
+  write -28 r14 r6
+  write -24 r14 r5
+  write -20 r14 r4
+  load 44 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  write -32 r14 r1
+  load 44 r6
+  load 0 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memset
+  read -32 r14 r1
+  read -12 r14 r5
+  read -16 r14 r3
+  read -28 r14 r2
+  read -24 r14 r4
+  read -20 r14 r6
+  write 0 r1 r6
+  add r1 4 r6
+  write 0 r6 r4
+  add r1 8 r6
+  write 0 r6 r5
+  add r1 12 r5
+  write 0 r5 r2
+  add r1 16 r5
+  write 0 r5 r3
+  load 0 r3
+  load 1 r5
+  bne r4 r5 .L3
+  xor r2 0 r3
+  sltu r0 r3 r3
+.L3:
+  beq r3 r0 .L5
+  add r2 8 r2
+  read 0 r2 r2
+  add r1 36 r3
+  write 0 r3 r2
+.L5:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkdecl */
+
+.data
+.balign 1
+.Lstring.3:
+	.ascii "storage class not allowed in this declaration\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.4:
+	.ascii "invalid combination of storage class specifiers\000"
+/* end data */
+
+
+.text
+; function storageclass
+storageclass:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+  addr2reg tok r12
+  read 0 r12 r1
+  load 39 r2
+  beq r1 r2 .L27
+  load 39 r2
+  blt r1 r2 .L17
+  load 45 r2
+  beq r1 r2 .L16
+  load 45 r2
+  bge r1 r2 .L24
+  load 43 r2
+  beq r1 r2 .L15
+  load 43 r2
+  sltu r1 r2 r1
+  jump .L24
+.L15:
+  load 64 r1
+  jump .L28
+.L16:
+  load 2 r1
+  jump .L28
+.L17:
+  load 23 r2
+  beq r1 r2 .L26
+  load 23 r2
+  blt r1 r2 .L22
+  load 33 r2
+  beq r1 r2 .L21
+  load 33 r2
+  sltu r1 r2 r1
+  jump .L24
+.L21:
+  load 32 r1
+  jump .L28
+.L22:
+  load 10 r2
+  beq r1 r2 .L25
+  load 10 r2
+  sltu r1 r2 r1
+.L24:
+  load 0 r1
+  jump .L46
+.L25:
+  load 16 r1
+  jump .L28
+.L26:
+  load 4 r1
+  jump .L28
+.L27:
+  load 8 r1
+.L28:
+  or r0 r1 r2
+  write -16 r14 r2
+  bne r4 r0 .L30
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.3 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r2
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L30:
+  read 0 r4 r1
+  load 8 r3
+  beq r1 r3 .L42
+  load 8 r3
+  blt r1 r3 .L36
+  load 64 r3
+  beq r1 r3 .L35
+  load 64 r3
+  sltu r1 r3 r1
+  jump .L40
+.L35:
+  load 12 r1
+  jump .L43
+.L36:
+  load 4 r3
+  beq r1 r3 .L42
+  load 4 r3
+  bge r1 r3 .L40
+  beq r1 r0 .L41
+  sltu r1 r0 r1
+.L40:
+  load 0 r1
+  jump .L43
+.L41:
+  load32 -1 r1
+  jump .L43
+.L42:
+  load 64 r1
+.L43:
+  xor r1 -1 r1
+  and r2 r1 r1
+  beq r1 r0 .L45
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.4 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r2
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L45:
+  read 0 r4 r1
+  or r1 r2 r1
+  write 0 r4 r1
+  savpc r15
+  add r15 12 r15
+  jump next
+  load 1 r1
+.L46:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function storageclass */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "_Atomic type qualifier is not yet supported\000"
+/* end data */
+
+
+.text
+; function typequal
+typequal:
+  addr2reg tok r12
+  read 0 r12 r1
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 51 r2
+  beq r1 r2 .L62
+  load 51 r2
+  blt r1 r2 .L55
+  load 53 r2
+  beq r1 r2 .L54
+  load 53 r2
+  sltu r1 r2 r1
+  jump .L59
+.L54:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.6 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L59
+.L55:
+  load 34 r2
+  beq r1 r2 .L61
+  load 34 r2
+  bge r1 r2 .L59
+  load 15 r2
+  beq r1 r2 .L60
+  load 15 r2
+  sltu r1 r2 r1
+.L59:
+  load 0 r1
+  jump .L64
+.L60:
+  read 0 r4 r1
+  or r1 2 r1
+  write 0 r4 r1
+  jump .L63
+.L61:
+  read 0 r4 r1
+  or r1 4 r1
+  write 0 r4 r1
+  jump .L63
+.L62:
+  read 0 r4 r1
+  or r1 8 r1
+  write 0 r4 r1
+.L63:
+  savpc r15
+  add r15 12 r15
+  jump next
+  load 1 r1
+.L64:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function typequal */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "function specifier not allowed in this declaration\000"
+/* end data */
+
+
+.text
+; function funcspec
+funcspec:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  addr2reg tok r12
+  read 0 r12 r1
+  load 61 r2
+  beq r1 r2 .L74
+  load 61 r2
+  bge r1 r2 .L72
+  load 29 r2
+  beq r1 r2 .L73
+  load 29 r2
+  sltu r1 r2 r1
+.L72:
+  load 0 r1
+  jump .L78
+.L73:
+  load 2 r1
+  jump .L75
+.L74:
+  load 4 r1
+.L75:
+  or r0 r1 r2
+  write -12 r14 r2
+  bne r4 r0 .L77
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.8 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -12 r14 r2
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L77:
+  read 0 r4 r1
+  or r1 r2 r1
+  write 0 r4 r1
+  savpc r15
+  add r15 12 r15
+  jump next
+  load 1 r1
+.L78:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function funcspec */
+
+.data
+.balign 4
+.Linttypes.10:
+	.int typeuint+0
+	.int typeint+0
+	.int typeulong+0
+	.int typelong+0
+	.int typeullong+0
+	.int typellong+0
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "internal error: unknown tag kind\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "no type in enum type specifier\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "redeclaration of tag '%s' with different kind\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "redefinition of tag '%s'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "struct/union has no members\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "expected integer constant expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "un\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "no %ssigned integer type can represent enumerator value\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "enumerator '%s' value cannot be represented in underlying type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "i < LEN(inttypes)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "BuildTools/cproc/decl.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "to close enum specifier\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "no integer type can represent all enumerator values\000"
+/* end data */
+
+
+.text
+; function tagspec
+tagspec:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 212 r13
+  write -200 r14 r8
+  write -204 r14 r9
+  write -156 r14 r4
+  addr2reg tok r12
+  read 0 r12 r1
+  load 41 r2
+  beq r1 r2 .L94
+  load 41 r2
+  blt r1 r2 .L88
+  load 48 r2
+  beq r1 r2 .L86
+  load 48 r2
+  sltu r1 r2 r1
+  jump .L90
+.L86:
+  load 16 r2
+  load 0 r1
+  write -24 r14 r2
+  write -12 r14 r1
+  jump .L96
+.L88:
+  load 22 r2
+  beq r1 r2 .L92
+  load 22 r2
+  sltu r1 r2 r1
+.L90:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.11 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  load32 -559030611 r2
+  load 0 r1
+  write -24 r14 r2
+  write -12 r14 r1
+  jump .L96
+.L92:
+  load 6 r2
+  load 0 r1
+  write -24 r14 r2
+  write -12 r14 r1
+  jump .L96
+.L94:
+  load 15 r2
+  load 8 r1
+  write -24 r14 r2
+  write -12 r14 r1
+.L96:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -12 r14 r5
+  load 0 r1
+  write -184 r14 r1
+  add r14 -184 r4
+  savpc r15
+  add r15 12 r15
+  jump attr
+  read -12 r14 r5
+  add r14 -184 r4
+  savpc r15
+  add r15 12 r15
+  jump gnuattr
+  read -24 r14 r3
+  read -156 r14 r2
+  addr2reg tok r12
+  read 0 r12 r4
+  load 0 r1
+  load 4 r5
+  beq r4 r5 .L98
+  or r0 r1 r6
+  jump .L99
+.L98:
+  addr2reg tok+20 r12
+  read 0 r12 r6
+  write -16 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -24 r14 r3
+  read -16 r14 r6
+  read -156 r14 r2
+.L99:
+  write -36 r14 r6
+  load 0 r1
+  load 6 r4
+  beq r3 r4 .L101
+  or r0 r1 r4
+  jump .L102
+.L101:
+  load 95 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -36 r14 r6
+  read -24 r14 r3
+  read -156 r14 r2
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r4
+.L102:
+  load 0 r1
+  bne r4 r0 .L104
+  write -40 r14 r1
+  jump .L107
+.L104:
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r3
+  load 0 r1
+  write 0 r3 r1
+  load 0 r7
+  load 0 r6
+  or r0 r2 r5
+  add r14 -196 r4
+  savpc r15
+  add r15 12 r15
+  jump declspecs
+  read -36 r14 r6
+  read -24 r14 r3
+  read -156 r14 r2
+  load32 -12 r1
+  sub r13 r1 r13
+  read -196 r14 r1
+  write -20 r14 r1
+  bne r1 r0 .L106
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.12 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -36 r14 r6
+  read -24 r14 r3
+  read -20 r14 r2
+  or r0 r2 r1
+  read -156 r14 r2
+  load32 -24 r4
+  sub r13 r4 r13
+.L106:
+  write -40 r14 r1
+.L107:
+  load 0 r1
+  beq r6 r0 .L112
+  addr2reg tok r12
+  read 0 r12 r1
+  load 0 r3
+  load 68 r4
+  bne r1 r4 .L110
+  or r0 r3 r1
+  jump .L111
+.L110:
+  xor r1 97 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L111:
+  xor r1 0 r3
+  or r0 r6 r1
+  sltu r0 r3 r6
+  or r0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump scopegettag
+  read -36 r14 r6
+  read -24 r14 r3
+.L112:
+  write -32 r14 r1
+  bne r1 r0 .L119
+  load 6 r1
+  beq r3 r1 .L115
+  load 0 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump mktype
+  read -36 r14 r6
+  read -156 r14 r2
+  add r1 12 r4
+  load 0 r3
+  write 0 r4 r3
+  add r1 8 r4
+  load 0 r3
+  write 0 r4 r3
+  add r1 40 r3
+  write 0 r3 r6
+  add r1 40 r3
+  add r3 4 r4
+  load 0 r3
+  write 0 r4 r3
+  jump .L116
+.L115:
+  load 30 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump mktype
+  read -40 r14 r2
+  read -36 r14 r6
+  or r0 r2 r3
+  read -156 r14 r2
+  add r1 20 r4
+  write 0 r4 r3
+.L116:
+  write -28 r14 r1
+  add r1 36 r4
+  or r0 r1 r3
+  load 1 r1
+  writeb 0 r4 r1
+  bne r6 r0 .L118
+  or r0 r3 r1
+  jump .L121
+.L118:
+  or r0 r6 r1
+  or r0 r3 r6
+  or r0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump scopeputtag
+  read -28 r14 r1
+  read -36 r14 r6
+  jump .L121
+.L119:
+  read 0 r1 r2
+  beq r2 r3 .L121
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.13 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -32 r14 r1
+  read -36 r14 r6
+  load32 -24 r2
+  sub r13 r2 r13
+.L121:
+  write -160 r14 r1
+  addr2reg tok r12
+  read 0 r12 r2
+  load 68 r3
+  bne r2 r3 .L233
+  add r1 36 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L124
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.14 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L124:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -160 r14 r1
+  read -40 r14 r2
+  or r0 r2 r4
+  read -156 r14 r2
+  read 0 r1 r3
+  load 15 r5
+  beq r3 r5 .L223
+  load 15 r5
+  blt r3 r5 .L130
+  load 16 r4
+  beq r3 r4 .L223
+  or r0 r3 r2
+  load 16 r3
+  sltu r2 r3 r2
+  jump .L232
+.L130:
+  or r0 r3 r2
+  or r0 r4 r3
+  load 6 r4
+  beq r2 r4 .L133
+  load 6 r3
+  sltu r2 r3 r2
+  jump .L232
+.L133:
+  or r0 r3 r2
+  bne r2 r0 .L136
+  addr2reg typeint r1
+  jump .L137
+.L136:
+  add r1 20 r2
+  read 0 r2 r2
+  add r2 12 r3
+  read 0 r3 r3
+  add r1 12 r4
+  write 0 r4 r3
+  add r2 8 r3
+  read 0 r3 r3
+  add r1 8 r4
+  write 0 r4 r3
+  add r2 40 r2
+  readbu 0 r2 r2
+  add r1 40 r3
+  writeb 0 r3 r2
+  add r1 36 r3
+  load 0 r2
+  writeb 0 r3 r2
+.L137:
+  load 0 r5
+  load 0 r4
+  load 0 r3
+  load 0 r2
+  write -52 r14 r1
+  write -96 r14 r5
+  write -44 r14 r4
+  write -88 r14 r3
+  write -92 r14 r2
+.L139:
+  addr2reg tok r12
+  read 0 r12 r1
+  load 4 r2
+  bne r1 r2 .L197
+  addr2reg tok+20 r12
+  read 0 r12 r2
+  write -76 r14 r2
+  savpc r15
+  add r15 12 r15
+  jump next
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump attr
+  load 99 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r3
+  read -52 r14 r1
+  read -44 r14 r4
+  read -156 r14 r2
+  and r3 0xFF r3
+  bne r3 r0 .L158
+  load 0 r2
+  beq r4 r0 .L143
+  or r0 r2 r3
+  jump .L144
+.L143:
+  add r1 40 r2
+  readbu 0 r2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L144:
+  load 1 r2
+  bne r3 r0 .L148
+  load 0 r2
+  load32 -2147483648 r3
+  bne r4 r3 .L147
+  add r1 40 r2
+  readbu 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L147:
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L148:
+  bne r2 r0 .L153
+  add r1 40 r2
+  readbu 0 r2 r6
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typehasint
+  or r0 r1 r5
+  read -52 r14 r1
+  read -44 r14 r4
+  read -160 r14 r3
+  read -76 r14 r2
+  and r5 0xFF r5
+  beq r5 r0 .L151
+  or r0 r2 r12
+  or r0 r4 r2
+  or r0 r12 r4
+  jump .L177
+.L151:
+  add r3 20 r3
+  read 0 r3 r3
+  beq r3 r0 .L168
+  write -48 r14 r4
+  jump .L167
+.L153:
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L155
+  addr2reg .Lstring.18 r1
+  jump .L156
+.L155:
+  addr2reg .Lstring.17 r1
+.L156:
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.19 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -52 r14 r1
+  read -44 r14 r4
+  read -76 r14 r2
+  load32 -24 r3
+  sub r13 r3 r13
+  or r0 r2 r12
+  or r0 r4 r2
+  or r0 r12 r4
+  jump .L177
+.L158:
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump condexpr
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  or r0 r1 r2
+  read -52 r14 r1
+  read -160 r14 r3
+  write -84 r14 r2
+  read 0 r2 r5
+  load 1 r4
+  load 1 r6
+  bne r5 r6 .L161
+  add r2 8 r4
+  read 0 r4 r4
+  add r4 4 r4
+  read 0 r4 r4
+  and r4 2 r4
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L161:
+  beq r4 r0 .L163
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.16 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -52 r14 r1
+  read -160 r14 r3
+  read -84 r14 r2
+  load32 -24 r4
+  sub r13 r4 r13
+.L163:
+  add r2 32 r4
+  read 0 r4 r4
+  write -80 r14 r4
+  add r3 20 r3
+  read 0 r3 r3
+  beq r3 r0 .L178
+  add r2 8 r2
+  read 0 r2 r2
+  add r2 40 r2
+  readbu 0 r2 r6
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typehasint
+  or r0 r1 r3
+  read -52 r14 r1
+  read -80 r14 r4
+  read -76 r14 r2
+  and r3 0xFF r3
+  beq r3 r0 .L166
+  or r0 r4 r12
+  or r0 r2 r4
+  or r0 r12 r2
+  jump .L182
+.L166:
+  write -48 r14 r4
+.L167:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r2 r6
+  addr2reg .Lstring.20 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -48 r14 r4
+  read -52 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L168:
+  write -72 r14 r4
+  add r1 40 r2
+  readbu 0 r2 r2
+  write -56 r14 r2
+  load 0 r3
+.L169:
+  write -64 r14 r3
+  load 3 r5
+  bge r3 r5 .L173
+  shiftl r3 3 r3
+  addr2reg .Linttypes.10 r1
+  add r1 r3 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  write -60 r14 r1
+  or r0 r2 r6
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typehasint
+  or r0 r1 r5
+  read -64 r14 r3
+  read -72 r14 r4
+  read -60 r14 r1
+  read -56 r14 r2
+  and r5 0xFF r5
+  bne r5 r0 .L172
+  add r3 1 r3
+  jump .L169
+.L172:
+  read -76 r14 r2
+  jump .L174
+.L173:
+  read -76 r14 r2
+.L174:
+  write -68 r14 r1
+  load 3 r5
+  blt r3 r5 .L176
+  load 282 r6
+  addr2reg .Lstring.22 r5
+  addr2reg .Lstring.21 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -68 r14 r1
+  read -72 r14 r4
+  read -76 r14 r2
+.L176:
+  or r0 r2 r12
+  or r0 r4 r2
+  or r0 r12 r4
+.L177:
+  write -108 r14 r2
+  jump .L183
+.L178:
+  or r0 r2 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 40 r1
+  readbu 0 r1 r6
+  or r0 r4 r5
+  addr2reg typeint r4
+  savpc r15
+  add r15 12 r15
+  jump typehasint
+  or r0 r1 r3
+  read -80 r14 r4
+  read -84 r14 r1
+  or r0 r4 r2
+  read -76 r14 r4
+  and r3 0xFF r3
+  bne r3 r0 .L181
+  add r1 8 r1
+  read 0 r1 r1
+  jump .L182
+.L181:
+  addr2reg typeint r1
+.L182:
+  write -108 r14 r2
+.L183:
+  write -100 r14 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r3
+  load 0 r2
+  write 0 r3 r2
+  load 0 r7
+  or r0 r1 r6
+  load 3 r5
+  savpc r15
+  add r15 12 r15
+  jump mkdecl
+  or r0 r1 r2
+  read -108 r14 r4
+  write -104 r14 r2
+  load32 -12 r1
+  sub r13 r1 r13
+  add r2 36 r1
+  write 0 r1 r4
+  or r0 r4 r8
+  savpc r15
+  add r15 12 r15
+  jump mkintconst
+  or r0 r1 r5
+  read -100 r14 r1
+  read -108 r14 r8
+  read -88 r14 r4
+  read -92 r14 r3
+  read -104 r14 r2
+  add r2 20 r6
+  write 0 r6 r5
+  or r0 r1 r9
+  read -96 r14 r1
+  add r2 32 r5
+  write 0 r5 r1
+  or r0 r4 r1
+  read -156 r14 r4
+  add r9 40 r5
+  readbu 0 r5 r6
+  load 0 r5
+  beq r6 r0 .L185
+  load32 -2147483648 r5
+  sltu r8 r5 r5
+  xor r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L185:
+  bne r5 r0 .L189
+  ble r8 r1 .L188
+  or r0 r8 r1
+.L188:
+  write -112 r14 r1
+  write -116 r14 r3
+  jump .L192
+.L189:
+  sub r0 r8 r5
+  ble r5 r3 .L191
+  sub r0 r8 r3
+.L191:
+  write -112 r14 r1
+  write -116 r14 r3
+.L192:
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump scopeputdecl
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r5
+  read -100 r14 r1
+  read -108 r14 r8
+  or r0 r1 r3
+  read -160 r14 r1
+  read -104 r14 r2
+  read -156 r14 r4
+  and r5 0xFF r5
+  xor r5 r0 r5
+  sltu r5 1 r5
+  write -120 r14 r5
+  read -112 r14 r7
+  read -116 r14 r5
+  read -120 r14 r12
+  bne r12 r0 .L195
+  add r8 1 r8
+  write -52 r14 r3
+  write -96 r14 r2
+  write -44 r14 r8
+  write -88 r14 r7
+  write -92 r14 r5
+  jump .L139
+.L195:
+  or r0 r3 r1
+  write -124 r14 r1
+  write -152 r14 r2
+  write -132 r14 r7
+  write -136 r14 r5
+  jump .L198
+.L197:
+  read -52 r14 r12
+  write -124 r14 r12
+  read -96 r14 r12
+  write -152 r14 r12
+  read -88 r14 r12
+  write -132 r14 r12
+  read -92 r14 r12
+  write -136 r14 r12
+.L198:
+  addr2reg .Lstring.23 r5
+  load 69 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -124 r14 r1
+  read -132 r14 r4
+  read -136 r14 r2
+  or r0 r1 r3
+  read -160 r14 r1
+  add r1 20 r5
+  read 0 r5 r5
+  bne r5 r0 .L232
+  load 0 r5
+  load32 -2147483648 r6
+  bgt r2 r6 .L201
+  load32 2147483647 r5
+  sltu r5 r4 r5
+  xor r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L201:
+  bne r5 r0 .L218
+  or r0 r3 r1
+  load 0 r3
+  sltu r3 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r5
+  write -128 r14 r5
+  load 0 r2
+  or r0 r2 r3
+.L205:
+  write -144 r14 r3
+  load 3 r2
+  bge r3 r2 .L211
+  shiftl r3 3 r2
+  addr2reg .Linttypes.10 r1
+  add r1 r2 r1
+  and r5 0xFF r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -140 r14 r1
+  load 0 r6
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typehasint
+  or r0 r1 r6
+  read -144 r14 r3
+  read -132 r14 r4
+  read -136 r14 r2
+  read -140 r14 r1
+  read -128 r14 r5
+  and r6 0xFF r7
+  load 0 r6
+  beq r7 r0 .L208
+  sub r0 r2 r5
+  load 1 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump typehasint
+  or r0 r1 r6
+  read -144 r14 r3
+  read -132 r14 r4
+  read -136 r14 r2
+  read -140 r14 r1
+  read -128 r14 r5
+  and r6 0xFF r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L208:
+  bne r6 r0 .L210
+  add r3 1 r3
+  jump .L205
+.L210:
+  or r0 r3 r4
+  read -152 r14 r2
+  or r0 r1 r3
+  read -160 r14 r1
+  jump .L212
+.L211:
+  or r0 r3 r4
+  read -152 r14 r2
+  or r0 r1 r3
+  read -160 r14 r1
+.L212:
+  write -148 r14 r3
+  load 3 r5
+  bne r4 r5 .L214
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.24 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -148 r14 r1
+  read -152 r14 r2
+  or r0 r1 r3
+  read -160 r14 r1
+  load32 -24 r4
+  sub r13 r4 r13
+.L214:
+  add r1 20 r4
+  write 0 r4 r3
+.L215:
+  beq r2 r0 .L222
+  add r2 12 r3
+  write 0 r3 r1
+  add r2 32 r2
+  read 0 r2 r2
+  jump .L215
+.L218:
+  bne r2 r0 .L220
+  addr2reg typeuint r2
+  jump .L221
+.L220:
+  addr2reg typeint r2
+.L221:
+  add r1 20 r3
+  write 0 r3 r2
+.L222:
+  add r1 20 r2
+  read 0 r2 r2
+  add r2 12 r3
+  read 0 r3 r3
+  add r1 12 r4
+  write 0 r4 r3
+  add r2 8 r3
+  read 0 r3 r3
+  add r1 8 r4
+  write 0 r4 r3
+  add r2 40 r2
+  readbu 0 r2 r2
+  add r1 40 r3
+  writeb 0 r3 r2
+  jump .L232
+.L223:
+  write -176 r14 r1
+  add r1 40 r1
+  add r1 4 r1
+  add r14 -176 r3
+  add r3 4 r3
+  write 0 r3 r1
+  add r14 -176 r1
+  add r1 8 r3
+  load 0 r1
+  write 0 r3 r1
+  read -184 r14 r1
+  and r1 8 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  add r14 -176 r3
+  add r3 12 r3
+  writeb 0 r3 r1
+  or r0 r2 r4
+.L225:
+  add r14 -176 r5
+  savpc r15
+  add r15 12 r15
+  jump structdecl
+  read -156 r14 r4
+  addr2reg tok r12
+  read 0 r12 r1
+  load 69 r2
+  bne r1 r2 .L225
+  read -160 r14 r1
+  add r1 40 r1
+  add r1 4 r1
+  read 0 r1 r1
+  bne r1 r0 .L230
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.15 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L230:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -160 r14 r1
+  add r14 -176 r2
+  add r2 12 r2
+  readbu 0 r2 r2
+  bne r2 r0 .L232
+  add r1 12 r2
+  read 0 r2 r2
+  add r1 8 r3
+  read 0 r3 r3
+  add r2 r3 r2
+  load 1 r4
+  sub r2 r4 r2
+  sub r0 r3 r3
+  and r2 r3 r2
+  add r1 12 r3
+  write 0 r3 r2
+.L232:
+  add r1 36 r3
+  load 0 r2
+  writeb 0 r3 r2
+.L233:
+  read -200 r14 r8
+  read -204 r14 r9
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function tagspec */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "duplicate 'short'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "too many 'long'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "duplicate 'signed'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "duplicate 'unsigned'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "_Complex is not yet supported\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "_Atomic is not yet supported\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "after 'typeof'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "to close 'typeof'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "alignment specifier not allowed in this declaration\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "after 'alignas'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "invalid alignment: %llu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "to close 'alignas' specifier\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "multiple types in declaration specifiers\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.39:
+	.ascii "invalid combination of type specifiers\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "declaration has no type specifier\000"
+/* end data */
+
+
+.text
+; function declspecs
+declspecs:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 200 r13
+  write -192 r14 r8
+  read 8 r14 r3
+  write -132 r14 r3
+  or r0 r7 r1
+  or r0 r6 r7
+  write -136 r14 r5
+  write -160 r14 r4
+  write -140 r14 r1
+  write -156 r14 r7
+  load 0 r2
+  write -188 r14 r2
+  load 0 r2
+  write -184 r14 r2
+  beq r7 r0 .L238
+  load 0 r2
+  write 0 r7 r2
+.L238:
+  beq r1 r0 .L240
+  load 0 r2
+  write 0 r1 r2
+.L240:
+  beq r3 r0 .L242
+  load 0 r1
+  write 0 r3 r1
+.L242:
+  load 0 r3
+  load 0 r2
+  load 0 r1
+  write -116 r14 r3
+  write -124 r14 r2
+  write -120 r14 r1
+.L244:
+  add r14 -188 r4
+  savpc r15
+  add r15 12 r15
+  jump typequal
+  write -16 r14 r1
+  read -116 r14 r6
+  read -124 r14 r5
+  read -120 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  load 1 r7
+  write -20 r14 r7
+  read -16 r14 r8
+  read -20 r14 r7
+  bne r8 r0 .L248
+  read -156 r14 r7
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump storageclass
+  or r0 r1 r7
+  read -116 r14 r6
+  read -124 r14 r5
+  read -120 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  xor r7 0 r7
+  sltu r0 r7 r8
+  write -24 r14 r8
+  jump .L249
+.L248:
+  write -24 r14 r7
+.L249:
+  load 1 r7
+  write -28 r14 r7
+  read -24 r14 r8
+  read -28 r14 r7
+  bne r8 r0 .L251
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump funcspec
+  or r0 r1 r7
+  read -116 r14 r6
+  read -124 r14 r5
+  read -120 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  xor r7 0 r7
+  sltu r0 r7 r8
+  jump .L252
+.L251:
+  or r0 r7 r8
+.L252:
+  read -156 r14 r7
+  bne r8 r0 .L433
+  addr2reg tok r12
+  read 0 r12 r3
+  write -96 r14 r3
+  load 4 r7
+  sub r3 r7 r3
+  load 60 r7
+  bge r3 r7 .L325
+  shiftl r3 2 r7
+  addr2reg .Ljt255 r3
+  add r3 r7 r7
+  read -132 r14 r3
+  read 0 r7 r7
+  jumpr 0 r7
+.L256:
+  load 1 r1
+  bne r6 r0 .L258
+  xor r5 0 r1
+  sltu r0 r1 r1
+.L258:
+  bne r1 r0 .L264
+  addr2reg tok+20 r12
+  read 0 r12 r5
+  load 1 r6
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump scopegetdecl
+  or r0 r1 r2
+  read -120 r14 r4
+  load 1 r1
+  beq r2 r0 .L261
+  add r2 4 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L261:
+  bne r1 r0 .L263
+  add r2 12 r1
+  read 0 r1 r6
+  write -36 r14 r6
+  read -188 r14 r1
+  add r2 16 r2
+  read 0 r2 r2
+  or r1 r2 r1
+  write -188 r14 r1
+  add r4 1 r4
+  write -32 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -124 r14 r5
+  read -32 r14 r4
+  read -36 r14 r6
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  jump .L318
+.L263:
+  read -116 r14 r6
+  read -124 r14 r5
+  read -140 r14 r1
+  read -156 r14 r7
+  jump .L326
+.L264:
+  read -116 r14 r6
+  read -124 r14 r5
+  read -140 r14 r1
+  read -156 r14 r7
+  jump .L326
+.L265:
+  read -156 r14 r7
+  jump .L326
+.L266:
+  bne r3 r0 .L268
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.34 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L268:
+  savpc r15
+  add r15 12 r15
+  jump next
+  addr2reg .Lstring.35 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -136 r14 r2
+  load 0 r6
+  load 0 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump typename
+  read -132 r14 r3
+  read -136 r14 r2
+  bne r1 r0 .L270
+  load 0 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump intconstexpr
+  read -132 r14 r3
+  jump .L271
+.L270:
+  add r1 8 r1
+  read 0 r1 r1
+.L271:
+  write -44 r14 r1
+  load 1 r2
+  sub r1 r2 r2
+  and r1 r2 r4
+  load 1 r2
+  bne r4 r0 .L273
+  load32 2147483647 r2
+  sltu r2 r1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L273:
+  beq r2 r0 .L275
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r6
+  addr2reg .Lstring.36 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -44 r14 r1
+  read -132 r14 r3
+  load32 -24 r2
+  sub r13 r2 r13
+.L275:
+  read 0 r3 r2
+  ble r1 r2 .L277
+  write 0 r3 r1
+.L277:
+  addr2reg .Lstring.37 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -116 r14 r6
+  read -124 r14 r5
+  read -120 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  jump .L318
+.L278:
+  add r4 1 r4
+  write -48 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -124 r14 r5
+  read -48 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  addr2reg typebool r6
+  jump .L318
+.L279:
+  or r5 4 r5
+  write -56 r14 r5
+  add r4 1 r4
+  write -52 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -116 r14 r6
+  read -52 r14 r4
+  read -56 r14 r5
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  jump .L318
+.L280:
+  or r5 64 r5
+  write -64 r14 r5
+  add r4 1 r4
+  write -60 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -116 r14 r6
+  read -60 r14 r4
+  read -64 r14 r5
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  jump .L318
+.L281:
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump tagspec
+  or r0 r1 r6
+  read -124 r14 r5
+  read -120 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  add r4 1 r4
+  jump .L318
+.L282:
+  or r5 32 r5
+  write -72 r14 r5
+  add r4 1 r4
+  write -68 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -116 r14 r6
+  read -68 r14 r4
+  read -72 r14 r5
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  jump .L318
+.L283:
+  or r5 16 r5
+  write -80 r14 r5
+  add r4 1 r4
+  write -76 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -116 r14 r6
+  read -76 r14 r4
+  read -80 r14 r5
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  jump .L318
+.L284:
+  and r5 512 r1
+  beq r1 r0 .L286
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.27 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -124 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L286:
+  and r5 256 r1
+  beq r1 r0 .L288
+  or r5 512 r5
+.L288:
+  or r5 256 r5
+  write -84 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -116 r14 r6
+  read -120 r14 r4
+  read -84 r14 r5
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  jump .L318
+.L289:
+  and r5 128 r1
+  beq r1 r0 .L291
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.26 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -124 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L291:
+  or r5 128 r5
+  write -88 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -116 r14 r6
+  read -120 r14 r4
+  read -88 r14 r5
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  jump .L318
+.L292:
+  and r5 1024 r1
+  beq r1 r0 .L294
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.28 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -124 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L294:
+  or r5 1024 r5
+  write -92 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -116 r14 r6
+  read -120 r14 r4
+  read -92 r14 r5
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  jump .L318
+.L295:
+  savpc r15
+  add r15 12 r15
+  jump next
+  addr2reg .Lstring.32 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -136 r14 r2
+  add r14 -184 r6
+  add r14 -188 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump typename
+  or r0 r1 r6
+  read -120 r14 r4
+  read -136 r14 r2
+  beq r6 r0 .L297
+  write -104 r14 r6
+  jump .L304
+.L297:
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump expr
+  read -120 r14 r4
+  read -96 r14 r2
+  add r1 5 r3
+  readbu 0 r3 r3
+  beq r3 r0 .L299
+  add r1 20 r1
+  read 0 r1 r1
+.L299:
+  add r1 8 r3
+  read 0 r3 r6
+  load 46 r3
+  bne r2 r3 .L301
+  read -188 r14 r2
+  add r1 12 r3
+  read 0 r3 r3
+  or r2 r3 r2
+  write -188 r14 r2
+.L301:
+  add r6 4 r2
+  read 0 r2 r2
+  and r2 64 r2
+  beq r2 r0 .L303
+  write -184 r14 r1
+.L303:
+  write -104 r14 r6
+.L304:
+  add r4 1 r4
+  write -100 r14 r4
+  addr2reg .Lstring.33 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -104 r14 r6
+  read -124 r14 r5
+  read -100 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  jump .L318
+.L305:
+  and r5 2048 r1
+  beq r1 r0 .L307
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.29 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -124 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L307:
+  or r5 2048 r5
+  write -108 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -116 r14 r6
+  read -120 r14 r4
+  read -108 r14 r5
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  jump .L318
+.L308:
+  add r4 1 r4
+  write -112 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -124 r14 r5
+  read -112 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  addr2reg typevoid r6
+  jump .L318
+.L309:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.31 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -116 r14 r6
+  read -124 r14 r5
+  read -120 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  load32 -24 r7
+  sub r13 r7 r13
+  jump .L318
+.L310:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.30 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -116 r14 r6
+  read -124 r14 r5
+  read -120 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  load32 -24 r7
+  sub r13 r7 r13
+  jump .L318
+.L311:
+  load 0 r2
+  write -180 r14 r2
+  bne r1 r0 .L313
+  load 0 r1
+  jump .L314
+.L313:
+  load 48 r1
+.L314:
+  or r0 r1 r5
+  add r14 -180 r4
+  savpc r15
+  add r15 12 r15
+  jump gnuattr
+  read -116 r14 r6
+  read -124 r14 r5
+  read -120 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  read -180 r14 r7
+  and r7 16 r7
+  beq r7 r0 .L316
+  read 0 r1 r7
+  or r7 8 r7
+  write 0 r1 r7
+.L316:
+  read -180 r14 r7
+  and r7 32 r7
+  beq r7 r0 .L318
+  read 0 r1 r7
+  or r7 16 r7
+  write 0 r1 r7
+.L318:
+  write -144 r14 r6
+  write -148 r14 r5
+  write -152 r14 r4
+  load 1 r7
+  write -128 r14 r7
+  load 1 r7
+  slt r7 r4 r8
+  read -128 r14 r7
+  bne r8 r0 .L322
+  load 0 r7
+  beq r6 r0 .L321
+  xor r5 0 r7
+  sltu r0 r7 r7
+.L321:
+  xor r7 0 r7
+  sltu r0 r7 r8
+  jump .L323
+.L322:
+  or r0 r7 r8
+.L323:
+  read -156 r14 r7
+  beq r8 r0 .L433
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.38 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -144 r14 r6
+  read -148 r14 r5
+  read -152 r14 r4
+  read -132 r14 r3
+  read -140 r14 r1
+  read -136 r14 r2
+  load32 -24 r7
+  sub r13 r7 r13
+  read -156 r14 r7
+  jump .L433
+.L325:
+  read -156 r14 r7
+.L326:
+  load 1152 r2
+  beq r5 r2 .L413
+  load 1152 r2
+  blt r5 r2 .L366
+  load 2064 r2
+  beq r5 r2 .L364
+  load 2064 r2
+  blt r5 r2 .L348
+  load 2320 r2
+  beq r5 r2 .L346
+  load 2320 r2
+  blt r5 r2 .L338
+  load 2832 r2
+  beq r5 r2 .L336
+  load 2832 r2
+  bge r5 r2 .L406
+  load 2816 r2
+  beq r5 r2 .L336
+  load 2816 r1
+  sltu r5 r1 r1
+  jump .L406
+.L336:
+  addr2reg typeullong r2
+  or r0 r2 r6
+  jump .L415
+.L338:
+  load 2192 r2
+  beq r5 r2 .L344
+  load 2192 r2
+  blt r5 r2 .L342
+  load 2304 r2
+  beq r5 r2 .L346
+  load 2304 r1
+  sltu r5 r1 r1
+  jump .L406
+.L342:
+  load 2176 r2
+  beq r5 r2 .L344
+  load 2176 r1
+  sltu r5 r1 r1
+  jump .L406
+.L344:
+  addr2reg typeushort r2
+  or r0 r2 r6
+  jump .L415
+.L346:
+  addr2reg typeulong r2
+  or r0 r2 r6
+  jump .L415
+.L348:
+  load 1792 r2
+  beq r5 r2 .L386
+  load 1792 r2
+  blt r5 r2 .L358
+  load 2048 r2
+  beq r5 r2 .L364
+  load 2048 r2
+  blt r5 r2 .L356
+  load 2052 r2
+  beq r5 r2 .L354
+  load 2052 r1
+  sltu r5 r1 r1
+  jump .L406
+.L354:
+  addr2reg typeuchar r2
+  or r0 r2 r6
+  jump .L415
+.L356:
+  load 1808 r2
+  beq r5 r2 .L386
+  load 1808 r1
+  sltu r5 r1 r1
+  jump .L406
+.L358:
+  load 1280 r2
+  beq r5 r2 .L411
+  load 1280 r2
+  blt r5 r2 .L362
+  load 1296 r2
+  beq r5 r2 .L411
+  load 1296 r1
+  sltu r5 r1 r1
+  jump .L406
+.L362:
+  load 1168 r2
+  beq r5 r2 .L413
+  load 1168 r1
+  sltu r5 r1 r1
+  jump .L406
+.L364:
+  addr2reg typeuint r2
+  or r0 r2 r6
+  jump .L415
+.L366:
+  load 256 r2
+  beq r5 r2 .L411
+  load 256 r2
+  blt r5 r2 .L388
+  load 784 r2
+  beq r5 r2 .L386
+  load 784 r2
+  blt r5 r2 .L378
+  load 1028 r2
+  beq r5 r2 .L376
+  load 1028 r2
+  blt r5 r2 .L374
+  load 1040 r2
+  beq r5 r2 .L402
+  load 1040 r1
+  sltu r5 r1 r1
+  jump .L406
+.L374:
+  load 1024 r2
+  beq r5 r2 .L402
+  load 1024 r1
+  sltu r5 r1 r1
+  jump .L406
+.L376:
+  addr2reg typeschar r2
+  or r0 r2 r6
+  jump .L415
+.L378:
+  load 320 r2
+  beq r5 r2 .L384
+  load 320 r2
+  blt r5 r2 .L382
+  load 768 r2
+  beq r5 r2 .L386
+  load 768 r1
+  sltu r5 r1 r1
+  jump .L406
+.L382:
+  load 272 r2
+  beq r5 r2 .L411
+  load 272 r1
+  sltu r5 r1 r1
+  jump .L406
+.L384:
+  addr2reg typeldouble r2
+  or r0 r2 r6
+  jump .L415
+.L386:
+  addr2reg typellong r2
+  or r0 r2 r6
+  jump .L415
+.L388:
+  load 32 r2
+  beq r5 r2 .L409
+  load 32 r2
+  blt r5 r2 .L398
+  load 128 r2
+  beq r5 r2 .L413
+  load 128 r2
+  blt r5 r2 .L394
+  load 144 r2
+  beq r5 r2 .L413
+  load 144 r1
+  sltu r5 r1 r1
+  jump .L406
+.L394:
+  load 64 r2
+  beq r5 r2 .L396
+  load 64 r1
+  sltu r5 r1 r1
+  jump .L406
+.L396:
+  addr2reg typedouble r2
+  or r0 r2 r6
+  jump .L415
+.L398:
+  load 4 r2
+  beq r5 r2 .L407
+  load 4 r2
+  blt r5 r2 .L404
+  load 16 r2
+  beq r5 r2 .L402
+  load 16 r1
+  sltu r5 r1 r1
+  jump .L406
+.L402:
+  addr2reg typeint r2
+  or r0 r2 r6
+  jump .L415
+.L404:
+  beq r5 r0 .L415
+  sltu r5 r0 r1
+.L406:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.39 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -116 r14 r6
+  read -140 r14 r1
+  read -156 r14 r7
+  load32 -24 r2
+  sub r13 r2 r13
+  jump .L415
+.L407:
+  addr2reg typechar r2
+  or r0 r2 r6
+  jump .L415
+.L409:
+  addr2reg typefloat r2
+  or r0 r2 r6
+  jump .L415
+.L411:
+  addr2reg typelong r2
+  or r0 r2 r6
+  jump .L415
+.L413:
+  addr2reg typeshort r2
+  or r0 r2 r6
+.L415:
+  write -40 r14 r6
+  load 0 r2
+  beq r6 r0 .L417
+  or r0 r2 r1
+  jump .L429
+.L417:
+  read -188 r14 r3
+  load 1 r2
+  bne r3 r0 .L421
+  load 0 r2
+  beq r7 r0 .L420
+  read 0 r7 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L420:
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L422
+.L421:
+  or r0 r2 r3
+.L422:
+  load 1 r2
+  bne r3 r0 .L427
+  load 0 r2
+  bne r1 r0 .L425
+  or r0 r2 r1
+  jump .L426
+.L425:
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L426:
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L428
+.L427:
+  or r0 r2 r1
+.L428:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L429:
+  beq r1 r0 .L431
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.40 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L431:
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump attr
+  read -160 r14 r2
+  read -40 r14 r6
+  write -172 r14 r6
+  add r14 -172 r1
+  add r1 4 r3
+  read -188 r14 r1
+  write 0 r3 r1
+  add r14 -172 r1
+  add r1 8 r3
+  read -184 r14 r1
+  write 0 r3 r1
+  add r14 -172 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r2 0 r3
+  write 0 r3 r1
+  add r14 -172 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r2 4 r3
+  write 0 r3 r1
+  add r14 -172 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -192 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L433:
+  write -116 r14 r6
+  write -124 r14 r5
+  write -120 r14 r4
+  jump .L244
+
+.rdata
+.balign 4
+.Ljt255:
+  .int .L256
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L266
+  .int .L265
+  .int .L265
+  .int .L278
+  .int .L265
+  .int .L265
+  .int .L279
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L280
+  .int .L265
+  .int .L281
+  .int .L265
+  .int .L265
+  .int .L282
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L283
+  .int .L284
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L289
+  .int .L292
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L281
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L295
+  .int .L295
+  .int .L281
+  .int .L305
+  .int .L308
+  .int .L265
+  .int .L265
+  .int .L309
+  .int .L265
+  .int .L310
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L265
+  .int .L311
+
+/* end function declspecs */
+
+
+.text
+; function istypename
+istypename:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 1 r6
+  savpc r15
+  add r15 12 r15
+  jump scopegetdecl
+  load 0 r2
+  bne r1 r0 .L438
+  or r0 r2 r1
+  jump .L439
+.L438:
+  add r1 4 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L439:
+  xor r1 0 r1
+  sltu r0 r1 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function istypename */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "after parenthesized declarator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.44:
+	.ascii "identifier not allowed in abstract declarator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.45:
+	.ascii "expected '(' or identifier\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.46:
+	.ascii "to close function declarator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.47:
+	.ascii "array length expression must have integer type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.48:
+	.ascii "after array length\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.49:
+	.ascii "attribute not allowed after parenthesized declarator\000"
+/* end data */
+
+
+.text
+; function declaratortypes
+declaratortypes:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 112 r13
+  write -104 r14 r8
+  read 8 r14 r1
+  write -80 r14 r1
+  write -96 r14 r7
+  write -88 r14 r6
+  write -92 r14 r5
+  write -84 r14 r4
+.L443:
+  load 75 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  and r1 0xFF r1
+  beq r1 r0 .L447
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump attr
+  load 0 r1
+  write -100 r14 r1
+.L445:
+  add r14 -100 r4
+  savpc r15
+  add r15 12 r15
+  jump typequal
+  bne r1 r0 .L445
+  read -100 r14 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump mkpointertype
+  or r0 r1 r2
+  read -92 r14 r1
+  add r2 24 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump listinsert
+  read -92 r14 r1
+  jump .L443
+.L447:
+  read -96 r14 r5
+  read -88 r14 r6
+  read -92 r14 r1
+  beq r6 r0 .L450
+  load 0 r2
+  write 0 r6 r2
+.L450:
+  add r1 4 r1
+  read 0 r1 r3
+  write -72 r14 r3
+  or r0 r6 r8
+  read 0 r3 r6
+  write -68 r14 r6
+  addr2reg tok r12
+  read 0 r12 r4
+  load 66 r1
+  beq r4 r1 .L462
+  load 66 r1
+  sltu r4 r1 r1
+  write -8 r14 r1
+  read -80 r14 r1
+  read -84 r14 r2
+  read -8 r14 r12
+  beq r12 r0 .L455
+  load 4 r1
+  xor r4 r1 r1
+  sltu r1 1 r1
+  write -12 r14 r1
+  read -80 r14 r1
+  read -84 r14 r2
+  read -12 r14 r12
+  bne r12 r0 .L458
+  load 4 r7
+  sltu r4 r7 r4
+.L455:
+  and r1 0xFF r1
+  bne r1 r0 .L457
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.45 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -68 r14 r6
+  read -72 r14 r3
+  read -96 r14 r5
+  read -84 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L457:
+  load 1 r1
+  jump .L478
+.L458:
+  or r0 r8 r6
+  bne r6 r0 .L461
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.44 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -88 r14 r6
+  load32 -24 r1
+  sub r13 r1 r13
+.L461:
+  addr2reg tok+20 r12
+  read 0 r12 r1
+  write 0 r6 r1
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -68 r14 r6
+  read -72 r14 r3
+  read -96 r14 r5
+  read -84 r14 r2
+  load 1 r1
+  jump .L478
+.L462:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -80 r14 r3
+  read -96 r14 r5
+  read -88 r14 r6
+  read -92 r14 r1
+  read -84 r14 r2
+  and r3 0xFF r4
+  bne r4 r0 .L464
+  or r0 r5 r12
+  or r0 r1 r5
+  or r0 r12 r1
+  jump .L477
+.L464:
+  addr2reg tok r12
+  read 0 r12 r4
+  load 66 r7
+  beq r4 r7 .L476
+  load 66 r7
+  blt r4 r7 .L471
+  load 75 r7
+  beq r4 r7 .L470
+  or r0 r4 r1
+  load 75 r3
+  sltu r1 r3 r1
+  jump .L475
+.L470:
+  or r0 r5 r12
+  or r0 r1 r5
+  or r0 r12 r1
+  jump .L477
+.L471:
+  or r0 r4 r1
+  load 4 r3
+  beq r1 r3 .L474
+  load 4 r3
+  sltu r1 r3 r1
+  jump .L475
+.L474:
+  addr2reg tok+20 r12
+  read 0 r12 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump istypename
+  or r0 r1 r4
+  read -80 r14 r3
+  read -96 r14 r5
+  read -88 r14 r6
+  or r0 r5 r1
+  read -92 r14 r5
+  read -84 r14 r2
+  and r4 0xFF r4
+  beq r4 r0 .L477
+.L475:
+  write -16 r14 r2
+  jump .L485
+.L476:
+  or r0 r5 r12
+  or r0 r1 r5
+  or r0 r12 r1
+.L477:
+  and r3 0xFF r3
+  load 12 r4
+  sub r13 r4 r13
+  or r0 r13 r4
+  add r4 8 r4
+  write 0 r4 r3
+  or r0 r1 r7
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump declaratortypes
+  load32 -12 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.43 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -68 r14 r6
+  read -72 r14 r3
+  read -96 r14 r5
+  read -84 r14 r2
+  load 0 r1
+.L478:
+  write -76 r14 r2
+  write -56 r14 r1
+  or r0 r2 r4
+  addr2reg tok r12
+  read 0 r12 r2
+  load 64 r7
+  beq r2 r7 .L527
+  load 64 r3
+  blt r2 r3 .L521
+  load 66 r1
+  bne r2 r1 .L520
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -76 r14 r2
+  write -16 r14 r2
+.L485:
+  load 0 r5
+  load 14 r4
+  savpc r15
+  add r15 12 r15
+  jump mktype
+  or r0 r1 r3
+  read -16 r14 r2
+  write -48 r14 r3
+  add r3 32 r4
+  load 0 r1
+  write 0 r4 r1
+  add r3 40 r4
+  load 0 r1
+  writeb 0 r4 r1
+  add r3 40 r1
+  add r1 4 r4
+  load 0 r1
+  write 0 r4 r1
+  add r3 40 r1
+  add r1 8 r4
+  load 0 r1
+  write 0 r4 r1
+  add r3 40 r1
+  add r1 4 r4
+  write -20 r14 r4
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  write -40 r14 r1
+  read -20 r14 r4
+  load 0 r1
+  write -24 r14 r1
+  write -28 r14 r4
+.L487:
+  load 98 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r3
+  read -24 r14 r1
+  read -40 r14 r2
+  and r3 0xFF r3
+  bne r3 r0 .L497
+  addr2reg tok r12
+  read 0 r12 r3
+  load 67 r4
+  beq r3 r4 .L495
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump parameter
+  read -28 r14 r4
+  read -40 r14 r2
+  read -48 r14 r3
+  write -36 r14 r1
+  read 0 r1 r5
+  beq r5 r0 .L491
+  or r0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump scopeputdecl
+  read -28 r14 r4
+  read -36 r14 r1
+  read -48 r14 r3
+.L491:
+  write 0 r4 r1
+  add r1 32 r4
+  write -32 r14 r4
+  add r3 40 r1
+  add r1 8 r2
+  read 0 r2 r1
+  add r1 1 r1
+  write 0 r2 r1
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r5
+  read -32 r14 r4
+  read -36 r14 r1
+  read -40 r14 r2
+  read -48 r14 r3
+  and r5 0xFF r5
+  beq r5 r0 .L494
+  write -24 r14 r1
+  write -28 r14 r4
+  jump .L487
+.L494:
+  write -44 r14 r1
+  jump .L500
+.L495:
+  or r0 r1 r2
+  write -44 r14 r2
+  jump .L500
+.L497:
+  or r0 r1 r2
+  read -48 r14 r3
+  add r3 40 r3
+  or r0 r2 r1
+  load 1 r2
+  writeb 0 r3 r2
+  write -44 r14 r1
+.L500:
+  addr2reg .Lstring.46 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -44 r14 r2
+  read -40 r14 r4
+  read -48 r14 r3
+  read -68 r14 r5
+  read -72 r14 r1
+  or r0 r5 r6
+  read -96 r14 r5
+  load 0 r7
+  bne r5 r0 .L502
+  or r0 r7 r6
+  jump .L503
+.L502:
+  read 0 r1 r7
+  xor r7 r6 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L503:
+  bne r6 r0 .L506
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  or r0 r1 r2
+  or r0 r2 r4
+  read -44 r14 r2
+  read -48 r14 r3
+  read -72 r14 r1
+  write -52 r14 r4
+  jump .L508
+.L506:
+  write 0 r5 r4
+  add r4 44 r4
+  read 0 r4 r4
+  write -52 r14 r4
+.L508:
+  add r3 40 r4
+  add r4 8 r4
+  read 0 r4 r5
+  load 0 r4
+  load 1 r6
+  beq r5 r6 .L510
+  or r0 r4 r5
+  jump .L511
+.L510:
+  add r3 40 r4
+  readbu 0 r4 r4
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L511:
+  load 0 r4
+  bne r5 r0 .L513
+  or r0 r4 r5
+  jump .L514
+.L513:
+  add r2 12 r4
+  read 0 r4 r4
+  read 0 r4 r4
+  xor r4 1 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L514:
+  load 0 r4
+  bne r5 r0 .L516
+  or r0 r4 r2
+  jump .L517
+.L516:
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L517:
+  beq r2 r0 .L519
+  add r3 40 r2
+  add r2 4 r4
+  load 0 r2
+  write 0 r4 r2
+  add r3 40 r2
+  add r2 8 r4
+  load 0 r2
+  write 0 r4 r2
+.L519:
+  read 0 r1 r4
+  add r3 24 r5
+  savpc r15
+  add r15 12 r15
+  jump listinsert
+  read -52 r14 r2
+  read -68 r14 r5
+  read -72 r14 r3
+  read -96 r14 r4
+  load 1 r1
+  jump .L545
+.L520:
+  load 66 r1
+  sltu r2 r1 r1
+  jump .L526
+.L521:
+  load 63 r3
+  bne r2 r3 .L525
+  and r1 0xFF r1
+  bne r1 r0 .L524
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.49 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L524:
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump gnuattr
+  read -76 r14 r2
+  read -56 r14 r1
+  read -68 r14 r5
+  read -72 r14 r3
+  read -96 r14 r4
+  jump .L545
+.L525:
+  load 63 r1
+  sltu r2 r1 r1
+.L526:
+  read -104 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L527:
+  or r0 r4 r2
+  or r0 r5 r4
+  or r0 r6 r5
+  and r1 0xFF r7
+  load 0 r6
+  beq r7 r0 .L530
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump attr
+  or r0 r1 r6
+  read -76 r14 r2
+  read -56 r14 r1
+  read -68 r14 r5
+  read -72 r14 r3
+  read -96 r14 r4
+  and r6 0xFF r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L530:
+  bne r6 r0 .L545
+  savpc r15
+  add r15 12 r15
+  jump next
+  load 0 r6
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump mkarraytype
+  write -64 r14 r1
+.L532:
+  load 39 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r2
+  read -64 r14 r1
+  and r2 0xFF r3
+  load 1 r2
+  bne r3 r0 .L534
+  add r1 40 r1
+  add r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump typequal
+  or r0 r1 r2
+  read -64 r14 r1
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L534:
+  bne r2 r0 .L532
+  read -72 r14 r3
+  addr2reg tok r12
+  read 0 r12 r4
+  load 0 r2
+  load 75 r5
+  bne r4 r5 .L538
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump peek
+  or r0 r1 r2
+  read -64 r14 r1
+  read -72 r14 r3
+  and r2 0xFF r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L538:
+  bne r2 r0 .L543
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r4
+  read -76 r14 r2
+  read -64 r14 r1
+  read -72 r14 r3
+  and r4 0xFF r4
+  bne r4 r0 .L544
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump assignexpr
+  or r0 r1 r2
+  read -64 r14 r1
+  write -60 r14 r2
+  add r2 8 r3
+  read 0 r3 r3
+  add r3 4 r3
+  read 0 r3 r3
+  and r3 2 r3
+  bne r3 r0 .L542
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.47 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -60 r14 r2
+  read -64 r14 r1
+  load32 -24 r3
+  sub r13 r3 r13
+.L542:
+  add r1 40 r3
+  write 0 r3 r2
+  add r1 36 r2
+  load 0 r1
+  writeb 0 r2 r1
+  addr2reg .Lstring.48 r5
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -64 r14 r1
+  read -72 r14 r3
+  jump .L544
+.L543:
+  add r1 4 r4
+  read 0 r4 r2
+  or r2 64 r2
+  write 0 r4 r2
+  add r1 36 r4
+  load 0 r2
+  writeb 0 r4 r2
+.L544:
+  read 0 r3 r4
+  add r1 24 r5
+  savpc r15
+  add r15 12 r15
+  jump listinsert
+  read -76 r14 r2
+  read -68 r14 r5
+  read -72 r14 r3
+  read -96 r14 r4
+  load 1 r1
+.L545:
+  or r0 r5 r6
+  or r0 r4 r5
+  jump .L478
+
+/* end function declaratortypes */
+
+.data
+.balign 1
+.Lstring.51:
+	.ascii "function declarator specifies function return type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.52:
+	.ascii "function declarator specifies array return type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.53:
+	.ascii "array element has incomplete type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.54:
+	.ascii "array element has function type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.55:
+	.ascii "array length must be non-negative\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.56:
+	.ascii "array length is too large\000"
+/* end data */
+
+
+.text
+; function declarator
+declarator:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 48 r13
+  read 12 r14 r1
+  read 8 r14 r2
+  write -24 r14 r6
+  or r0 r7 r6
+  or r0 r2 r7
+  write -32 r14 r4
+  or r0 r5 r4
+  add r14 -40 r2
+  write -40 r14 r2
+  add r14 -40 r2
+  add r2 4 r3
+  add r14 -40 r2
+  write 0 r3 r2
+  beq r7 r0 .L550
+  load 0 r2
+  write 0 r7 r2
+.L550:
+  and r1 0xFF r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -40 r5
+  savpc r15
+  add r15 12 r15
+  jump declaratortypes
+  read -24 r14 r1
+  load32 -12 r2
+  sub r13 r2 r13
+  read -40 r14 r2
+.L551:
+  add r14 -40 r3
+  beq r2 r3 .L579
+  or r0 r2 r3
+  read 0 r2 r2
+  write -20 r14 r2
+  load 24 r4
+  sub r3 r4 r4
+  write -28 r14 r4
+  add r4 32 r3
+  read 0 r3 r3
+  write -16 r14 r3
+  read 0 r1 r5
+  add r4 20 r6
+  write 0 r6 r5
+  add r1 4 r5
+  read 0 r5 r5
+  add r4 32 r6
+  write 0 r6 r5
+  add r4 4 r6
+  read 0 r6 r5
+  read 0 r1 r7
+  add r7 4 r7
+  read 0 r7 r7
+  and r7 64 r7
+  or r5 r7 r5
+  write 0 r6 r5
+  read 0 r4 r5
+  load 14 r6
+  beq r5 r6 .L574
+  load 14 r6
+  bge r5 r6 .L578
+  load 13 r6
+  beq r5 r6 .L557
+  load 13 r6
+  sltu r5 r6 r5
+  jump .L578
+.L557:
+  read 0 r1 r5
+  add r5 36 r5
+  readbu 0 r5 r5
+  beq r5 r0 .L559
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.53 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r3
+  read -28 r14 r4
+  read -20 r14 r2
+  read -24 r14 r1
+  load32 -24 r5
+  sub r13 r5 r13
+.L559:
+  read 0 r1 r5
+  read 0 r5 r5
+  load 14 r6
+  bne r5 r6 .L561
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.54 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r3
+  read -28 r14 r4
+  read -20 r14 r2
+  read -24 r14 r1
+  load32 -24 r5
+  sub r13 r5 r13
+.L561:
+  read 0 r1 r5
+  add r5 8 r5
+  read 0 r5 r5
+  add r4 8 r6
+  write 0 r6 r5
+  add r4 12 r6
+  load 0 r5
+  write 0 r6 r5
+  add r4 40 r5
+  read 0 r5 r5
+  beq r5 r0 .L578
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  or r0 r1 r6
+  read -16 r14 r3
+  read -28 r14 r4
+  read -20 r14 r2
+  read -24 r14 r1
+  write -12 r14 r6
+  read 0 r6 r5
+  load 0 r7
+  write -4 r14 r7
+  load 1 r7
+  xor r5 r7 r7
+  sltu r7 1 r7
+  read -4 r14 r5
+  beq r7 r0 .L565
+  read 0 r1 r5
+  add r5 12 r5
+  read 0 r5 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L565:
+  bne r5 r0 .L567
+  add r4 4 r7
+  read 0 r7 r5
+  or r5 64 r5
+  write 0 r7 r5
+  add r4 40 r5
+  write 0 r5 r6
+  add r4 40 r5
+  add r5 8 r6
+  load 0 r5
+  write 0 r6 r5
+  jump .L578
+.L567:
+  add r6 8 r5
+  read 0 r5 r5
+  add r5 40 r5
+  readbu 0 r5 r7
+  load 0 r5
+  beq r7 r0 .L569
+  add r6 32 r5
+  read 0 r5 r5
+  shiftr r5 63 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L569:
+  beq r5 r0 .L571
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.55 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -12 r14 r6
+  read -16 r14 r3
+  read -28 r14 r4
+  read -20 r14 r2
+  read -24 r14 r1
+  load32 -24 r5
+  sub r13 r5 r13
+.L571:
+  add r6 32 r5
+  read 0 r5 r5
+  write -8 r14 r5
+  read 0 r1 r5
+  add r5 12 r5
+  read 0 r5 r7
+  load32 -1 r5
+  divu r5 r7 r7
+  read -8 r14 r5
+  ble r5 r7 .L573
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.56 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -12 r14 r6
+  read -16 r14 r3
+  read -28 r14 r4
+  read -20 r14 r2
+  read -24 r14 r1
+  load32 -24 r5
+  sub r13 r5 r13
+.L573:
+  read 0 r1 r5
+  add r5 12 r5
+  read 0 r5 r5
+  add r6 32 r6
+  read 0 r6 r6
+  mults r5 r6 r5
+  add r4 12 r6
+  write 0 r6 r5
+  jump .L578
+.L574:
+  read 0 r1 r5
+  read 0 r5 r5
+  load 14 r6
+  bne r5 r6 .L576
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.51 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r3
+  read -28 r14 r4
+  read -20 r14 r2
+  read -24 r14 r1
+  load32 -24 r5
+  sub r13 r5 r13
+.L576:
+  read 0 r1 r5
+  read 0 r5 r5
+  load 13 r6
+  bne r5 r6 .L578
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.52 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r3
+  read -28 r14 r4
+  read -20 r14 r2
+  read -24 r14 r1
+  load32 -24 r5
+  sub r13 r5 r13
+.L578:
+  write 0 r1 r4
+  add r1 4 r4
+  write 0 r4 r3
+  jump .L551
+.L579:
+  read -32 r14 r2
+  add r1 0 r3
+  read 0 r3 r3
+  add r2 0 r4
+  write 0 r4 r3
+  add r1 4 r3
+  read 0 r3 r3
+  add r2 4 r4
+  write 0 r4 r3
+  add r1 8 r1
+  read 0 r1 r1
+  add r2 8 r2
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function declarator */
+
+.data
+.balign 1
+.Lstring.58:
+	.ascii "no type in parameter declaration\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.59:
+	.ascii "parameter declaration has invalid storage-class specifier\000"
+/* end data */
+
+
+.text
+; function parameter
+parameter:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 80 r13
+  write -16 r14 r4
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump attr
+  read -16 r14 r5
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r7
+  add r14 -20 r6
+  add r14 -72 r4
+  savpc r15
+  add r15 12 r15
+  jump declspecs
+  read -16 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  read -72 r14 r1
+  write -32 r14 r1
+  add r14 -72 r2
+  add r2 4 r2
+  add r14 -32 r3
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  bne r1 r0 .L586
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.58 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L586:
+  read -20 r14 r1
+  load 0 r2
+  bne r1 r0 .L588
+  or r0 r2 r1
+  jump .L589
+.L588:
+  xor r1 32 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L589:
+  beq r1 r0 .L591
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.59 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L591:
+  load 16 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 12 r3
+  load 1 r2
+  write 0 r3 r2
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -36 r7
+  add r14 -60 r6
+  add r14 -32 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -60 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -32 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -60 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -32 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -60 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump declarator
+  load32 -16 r1
+  sub r13 r1 r13
+  read -48 r14 r4
+  write -32 r14 r4
+  add r14 -48 r1
+  add r1 4 r1
+  add r14 -32 r2
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  add r14 -32 r1
+  add r1 4 r5
+  savpc r15
+  add r15 12 r15
+  jump typeadjust
+  or r0 r1 r6
+  write -32 r14 r6
+  read -36 r14 r4
+  add r14 -32 r1
+  add r1 4 r1
+  read 0 r1 r7
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump mkdecl
+  load32 -12 r2
+  sub r13 r2 r13
+  add r1 36 r2
+  add r2 4 r3
+  load 2 r2
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function parameter */
+
+.data
+.balign 1
+.Lstring.61:
+	.ascii "struct has member '%s' after flexible array member\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.62:
+	.ascii "struct member '%s' has incomplete type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.63:
+	.ascii "struct member '%s' contains flexible array member\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.64:
+	.ascii "struct member '%s' has function type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.65:
+	.ascii "struct member '%s' has variably modified type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.66:
+	.ascii "mt.type->align > 0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.67:
+	.ascii "specified alignment of struct member '%s' is less strict than is required by type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.68:
+	.ascii "bit-field '%s' has invalid type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.69:
+	.ascii "alignment specified for bit-field '%s'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.70:
+	.ascii "bit-field '%s' in packed struct is not supported\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.71:
+	.ascii "bit-field '%s' with zero width must not have declarator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.72:
+	.ascii "bit-field '%s' exceeds width of underlying type\000"
+/* end data */
+
+
+.text
+; function addmember
+addmember:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 92 r13
+  write -84 r14 r8
+  read 8 r14 r8
+  write -36 r14 r8
+  write -64 r14 r7
+  or r0 r6 r1
+  or r0 r5 r6
+  or r0 r4 r3
+  write -20 r14 r1
+  write -76 r14 r6
+  write -68 r14 r3
+  read 0 r3 r2
+  write -80 r14 r2
+  read 0 r2 r4
+  load 0 r5
+  write -4 r14 r5
+  load 15 r5
+  xor r4 r5 r5
+  sltu r5 1 r5
+  read -4 r14 r4
+  beq r5 r0 .L597
+  add r2 37 r4
+  readbu 0 r4 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L597:
+  beq r4 r0 .L600
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.61 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r2
+  read -36 r14 r8
+  read -20 r14 r6
+  or r0 r6 r1
+  read -76 r14 r6
+  read -68 r14 r3
+  load32 -24 r4
+  sub r13 r4 r13
+.L600:
+  read 0 r6 r4
+  add r4 36 r5
+  readbu 0 r5 r5
+  beq r5 r0 .L605
+  read 0 r4 r4
+  load 13 r5
+  beq r4 r5 .L604
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.62 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r2
+  read -36 r14 r8
+  read -20 r14 r6
+  or r0 r6 r1
+  read -76 r14 r6
+  read -68 r14 r3
+  load32 -24 r4
+  sub r13 r4 r13
+.L604:
+  add r2 37 r5
+  load 1 r4
+  writeb 0 r5 r4
+.L605:
+  read 0 r6 r4
+  add r4 37 r4
+  readbu 0 r4 r4
+  beq r4 r0 .L610
+  read 0 r2 r4
+  load 15 r5
+  bne r4 r5 .L609
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.63 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r2
+  read -36 r14 r8
+  read -20 r14 r6
+  or r0 r6 r1
+  read -76 r14 r6
+  read -68 r14 r3
+  load32 -24 r4
+  sub r13 r4 r13
+.L609:
+  add r2 37 r5
+  load 1 r4
+  writeb 0 r5 r4
+.L610:
+  read 0 r6 r4
+  read 0 r4 r4
+  load 14 r5
+  bne r4 r5 .L613
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.64 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r2
+  read -36 r14 r8
+  read -20 r14 r6
+  or r0 r6 r1
+  read -76 r14 r6
+  read -68 r14 r3
+  load32 -24 r4
+  sub r13 r4 r13
+.L613:
+  read 0 r6 r4
+  add r4 4 r4
+  read 0 r4 r4
+  and r4 64 r4
+  beq r4 r0 .L616
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.65 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r2
+  read -36 r14 r8
+  read -20 r14 r6
+  or r0 r6 r1
+  read -76 r14 r6
+  read -68 r14 r3
+  load32 -24 r4
+  sub r13 r4 r13
+.L616:
+  read 0 r6 r4
+  add r4 8 r4
+  read 0 r4 r4
+  bgts r4 r0 .L618
+  load 781 r6
+  addr2reg .Lstring.22 r5
+  addr2reg .Lstring.66 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -80 r14 r2
+  read -36 r14 r8
+  read -20 r14 r6
+  or r0 r6 r1
+  read -76 r14 r6
+  read -68 r14 r3
+.L618:
+  load 1 r4
+  bne r1 r0 .L620
+  load32 -1 r4
+  xor r8 r4 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L620:
+  bne r4 r0 .L622
+  load 0 r4
+  jump .L623
+.L622:
+  load 24 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r4
+  read -80 r14 r2
+  read -36 r14 r8
+  read -20 r14 r6
+  or r0 r6 r1
+  read -76 r14 r6
+  read -68 r14 r3
+  write -8 r14 r4
+  or r0 r4 r5
+  read 0 r6 r4
+  add r5 4 r5
+  write 0 r5 r4
+  read -8 r14 r4
+  or r0 r4 r5
+  add r6 4 r4
+  read 0 r4 r4
+  add r5 8 r5
+  write 0 r5 r4
+  read -8 r14 r4
+  write 0 r4 r1
+  add r4 20 r5
+  load 0 r4
+  write 0 r5 r4
+  read -8 r14 r4
+  add r3 4 r5
+  read 0 r5 r5
+  write 0 r5 r4
+  add r4 20 r4
+  add r3 4 r5
+  write 0 r5 r4
+  read -8 r14 r4
+.L623:
+  write -72 r14 r4
+  load32 -1 r5
+  beq r8 r5 .L653
+  read 0 r6 r5
+  add r5 4 r5
+  read 0 r5 r5
+  and r5 2 r5
+  xor r5 r0 r5
+  sltu r5 1 r5
+  write -12 r14 r5
+  read -36 r14 r8
+  read -64 r14 r5
+  read -12 r14 r12
+  beq r12 r0 .L627
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.68 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -72 r14 r4
+  read -80 r14 r2
+  read -36 r14 r8
+  read -20 r14 r6
+  or r0 r6 r1
+  read -76 r14 r6
+  read -68 r14 r3
+  load32 -24 r5
+  sub r13 r5 r13
+  read -64 r14 r5
+.L627:
+  beq r5 r0 .L630
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.69 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -72 r14 r4
+  read -80 r14 r2
+  read -36 r14 r8
+  read -20 r14 r6
+  or r0 r6 r1
+  read -76 r14 r6
+  read -68 r14 r3
+  load32 -24 r5
+  sub r13 r5 r13
+.L630:
+  add r3 12 r5
+  readbu 0 r5 r5
+  beq r5 r0 .L633
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.70 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -72 r14 r4
+  read -80 r14 r2
+  read -36 r14 r8
+  read -20 r14 r6
+  or r0 r6 r1
+  read -76 r14 r6
+  read -68 r14 r3
+  load32 -24 r5
+  sub r13 r5 r13
+.L633:
+  load 0 r5
+  write -16 r14 r5
+  xor r8 r0 r7
+  sltu r7 1 r7
+  read -16 r14 r5
+  beq r7 r0 .L635
+  xor r1 0 r5
+  sltu r0 r5 r5
+.L635:
+  beq r5 r0 .L638
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.71 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -72 r14 r4
+  read -80 r14 r2
+  read -36 r14 r8
+  read -20 r14 r6
+  or r0 r6 r1
+  read -76 r14 r6
+  read -68 r14 r3
+  load32 -24 r5
+  sub r13 r5 r13
+.L638:
+  read 0 r6 r5
+  add r5 12 r5
+  read 0 r5 r5
+  shiftl r5 3 r5
+  ble r8 r5 .L641
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r6 r1
+  addr2reg .Lstring.72 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -72 r14 r4
+  read -80 r14 r2
+  read -76 r14 r6
+  read -68 r14 r3
+  load32 -24 r1
+  sub r13 r1 r13
+.L641:
+  read 0 r6 r5
+  write -24 r14 r5
+  add r5 8 r1
+  read 0 r1 r1
+  write -60 r14 r1
+  read 0 r2 r1
+  load 15 r5
+  xor r1 r5 r1
+  sltu r1 1 r1
+  write -28 r14 r1
+  read -60 r14 r1
+  read -24 r14 r5
+  read -36 r14 r8
+  read -28 r14 r12
+  bne r12 r0 .L645
+  beq r4 r0 .L666
+  add r4 12 r5
+  load 0 r3
+  write 0 r5 r3
+  add r4 16 r5
+  load 0 r3
+  writeh 0 r5 r3
+  read 0 r6 r3
+  add r3 12 r3
+  read 0 r3 r3
+  shiftl r3 3 r3
+  sub r3 r8 r3
+  add r4 16 r5
+  add r5 2 r5
+  writeh 0 r5 r3
+  add r2 12 r3
+  read 0 r3 r5
+  read 0 r6 r3
+  add r3 12 r6
+  read 0 r6 r6
+  bge r5 r6 .L666
+  add r3 12 r3
+  read 0 r3 r3
+  add r2 12 r5
+  write 0 r5 r3
+  jump .L666
+.L645:
+  add r2 12 r1
+  read 0 r1 r1
+  write -32 r14 r1
+  add r5 12 r7
+  read 0 r7 r7
+  add r1 r7 r1
+  load 1 r7
+  sub r1 r7 r1
+  add r5 12 r5
+  read 0 r5 r5
+  sub r0 r5 r5
+  and r1 r5 r1
+  write -48 r14 r1
+  read -32 r14 r5
+  read -36 r14 r8
+  load 1 r1
+  write -44 r14 r1
+  xor r8 r0 r1
+  sltu r1 1 r1
+  write -40 r14 r1
+  read -48 r14 r1
+  read -40 r14 r12
+  bne r12 r0 .L647
+  read -48 r14 r1
+  sub r1 r5 r1
+  shiftl r1 3 r1
+  add r3 8 r5
+  read 0 r5 r5
+  add r1 r5 r5
+  read -48 r14 r1
+  sltu r5 r8 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+  jump .L648
+.L647:
+  read -44 r14 r5
+.L648:
+  beq r5 r0 .L650
+  add r2 12 r5
+  write 0 r5 r1
+  add r3 8 r5
+  load 0 r1
+  write 0 r5 r1
+.L650:
+  beq r4 r0 .L652
+  add r2 12 r1
+  read 0 r1 r1
+  add r3 8 r5
+  read 0 r5 r5
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r5 1 r5
+  sub r1 r5 r1
+  read 0 r6 r5
+  add r5 12 r5
+  read 0 r5 r5
+  sub r0 r5 r5
+  and r1 r5 r5
+  write -52 r14 r5
+  add r4 12 r1
+  write 0 r1 r5
+  add r2 12 r1
+  read 0 r1 r1
+  write -56 r14 r1
+  read -52 r14 r5
+  read -56 r14 r1
+  sub r1 r5 r1
+  shiftl r1 3 r1
+  add r3 8 r5
+  read 0 r5 r5
+  sub r1 r5 r5
+  add r4 16 r1
+  writeh 0 r1 r5
+  read 0 r6 r1
+  add r1 12 r1
+  read 0 r1 r1
+  shiftl r1 3 r1
+  sub r1 r8 r1
+  shiftl r5 16 r5
+  shiftrs r5 16 r5
+  sub r1 r5 r1
+  add r4 16 r5
+  add r5 2 r5
+  writeh 0 r5 r1
+.L652:
+  add r2 12 r6
+  read 0 r6 r1
+  add r3 8 r5
+  read 0 r5 r5
+  sub r8 r5 r5
+  add r5 7 r5
+  shiftr r5 3 r5
+  add r1 r5 r5
+  read -60 r14 r1
+  write 0 r6 r5
+  or r0 r3 r5
+  add r3 8 r3
+  read 0 r3 r3
+  sub r3 r8 r3
+  and r3 7 r3
+  add r5 8 r5
+  write 0 r5 r3
+  jump .L666
+.L653:
+  add r4 16 r7
+  load 0 r5
+  writeh 0 r7 r5
+  add r4 16 r5
+  add r5 2 r7
+  load 0 r5
+  writeh 0 r7 r5
+  read -64 r14 r5
+  read 0 r6 r7
+  add r7 8 r7
+  read 0 r7 r7
+  blts r5 r7 .L655
+  or r0 r5 r1
+  jump .L661
+.L655:
+  beq r5 r0 .L658
+  or r0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.67 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -72 r14 r4
+  read -80 r14 r2
+  read -76 r14 r6
+  read -68 r14 r3
+  load32 -24 r1
+  sub r13 r1 r13
+.L658:
+  add r3 12 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L660
+  read 0 r6 r1
+  add r1 8 r1
+  read 0 r1 r1
+  jump .L661
+.L660:
+  load 1 r1
+.L661:
+  read 0 r2 r5
+  load 15 r7
+  beq r5 r7 .L664
+  add r4 12 r7
+  load 0 r5
+  write 0 r7 r5
+  or r0 r6 r5
+  add r2 12 r6
+  read 0 r6 r6
+  read 0 r5 r5
+  add r5 12 r7
+  read 0 r7 r7
+  bge r6 r7 .L665
+  add r5 12 r5
+  read 0 r5 r5
+  add r2 12 r6
+  write 0 r6 r5
+  jump .L665
+.L664:
+  add r2 12 r5
+  read 0 r5 r5
+  add r5 r1 r5
+  load 1 r7
+  sub r5 r7 r5
+  sub r0 r1 r7
+  and r5 r7 r5
+  add r4 12 r7
+  write 0 r7 r5
+  read 0 r6 r6
+  add r6 12 r6
+  read 0 r6 r6
+  add r5 r6 r5
+  add r2 12 r6
+  write 0 r6 r5
+.L665:
+  add r3 8 r5
+  load 0 r3
+  write 0 r5 r3
+.L666:
+  load 0 r3
+  beq r4 r0 .L668
+  add r2 8 r3
+  read 0 r3 r3
+  slt r3 r1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L668:
+  beq r3 r0 .L670
+  add r2 8 r2
+  write 0 r2 r1
+.L670:
+  read -84 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function addmember */
+
+.data
+.balign 1
+.Lstring.74:
+	.ascii "after static_assert\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.75:
+	.ascii "after static assertion expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.76:
+	.ascii "static assertion failed: %.*s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.77:
+	.ascii "static assertion failed\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.78:
+	.ascii "after static assertion\000"
+/* end data */
+
+
+.text
+; function staticassert
+staticassert:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  write -12 r14 r4
+  load 40 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  and r1 0xFF r1
+  beq r1 r0 .L680
+  addr2reg .Lstring.74 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -12 r14 r4
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump intconstexpr
+  write -16 r14 r1
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r2
+  read -16 r14 r1
+  and r2 0xFF r2
+  bne r2 r0 .L677
+  bne r1 r0 .L679
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.77 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L679
+.L677:
+  addr2reg .Lstring.75 r6
+  load 7 r5
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokencheck
+  load 1 r5
+  add r14 -24 r4
+  savpc r15
+  add r15 12 r15
+  jump stringconcat
+  read -16 r14 r1
+  bne r1 r0 .L679
+  read -24 r14 r1
+  load 1 r2
+  sub r1 r2 r6
+  add r14 -24 r1
+  add r1 4 r1
+  read 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.76 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L679:
+  addr2reg .Lstring.78 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg .Lstring.78 r5
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  load 1 r1
+  jump .L681
+.L680:
+  load 0 r1
+.L681:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function staticassert */
+
+.data
+.balign 1
+.Lstring.80:
+	.ascii "no type in struct member declaration\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.81:
+	.ascii "struct declaration must declare at least one member\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.82:
+	.ascii "or ';' after declarator\000"
+/* end data */
+
+
+.text
+; function structdecl
+structdecl:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 128 r13
+  write -16 r14 r5
+  or r0 r4 r5
+  write -12 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump staticassert
+  and r1 0xFF r1
+  bne r1 r0 .L706
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump attr
+  read -12 r14 r5
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  add r14 -20 r1
+  write 0 r2 r1
+  load 0 r7
+  load 0 r6
+  add r14 -120 r4
+  savpc r15
+  add r15 12 r15
+  jump declspecs
+  load32 -12 r1
+  sub r13 r1 r13
+  read -120 r14 r1
+  write -8 r14 r1
+  write -48 r14 r1
+  add r14 -120 r2
+  add r2 4 r2
+  add r14 -48 r3
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  bne r1 r0 .L687
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.80 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L687:
+  addr2reg tok r12
+  read 0 r12 r2
+  load 97 r3
+  beq r2 r3 .L697
+.L688:
+  load 95 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -12 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L693
+  load 16 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 12 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -24 r7
+  add r14 -84 r6
+  add r14 -48 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -84 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -48 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -84 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -48 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -84 r2
+  add r2 8 r2
+  write 0 r2 r1
+  or r0 r4 r5
+  add r14 -72 r4
+  savpc r15
+  add r15 12 r15
+  jump declarator
+  load32 -16 r1
+  sub r13 r1 r13
+  read -72 r14 r1
+  write -36 r14 r1
+  add r14 -72 r1
+  add r1 4 r1
+  add r14 -36 r2
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  load 95 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -16 r14 r5
+  read -12 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L691
+  load32 -1 r1
+  jump .L692
+.L691:
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump intconstexpr
+  read -16 r14 r5
+.L692:
+  read -24 r14 r6
+  read -20 r14 r7
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  or r0 r5 r1
+  add r14 -60 r5
+  add r14 -36 r2
+  add r2 0 r2
+  read 0 r2 r2
+  add r14 -60 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r14 -36 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r14 -60 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r14 -36 r2
+  add r2 8 r2
+  read 0 r2 r2
+  add r14 -60 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump addmember
+  load32 -12 r1
+  sub r13 r1 r13
+  jump .L694
+.L693:
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump intconstexpr
+  read -16 r14 r5
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 0 r7
+  load 0 r6
+  or r0 r5 r1
+  add r14 -96 r5
+  add r14 -48 r2
+  add r2 0 r2
+  read 0 r2 r2
+  add r14 -96 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r14 -48 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r14 -96 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r14 -48 r2
+  add r2 8 r2
+  read 0 r2 r2
+  add r14 -96 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump addmember
+  load32 -12 r1
+  sub r13 r1 r13
+.L694:
+  addr2reg tok r12
+  read 0 r12 r1
+  load 97 r2
+  beq r1 r2 .L696
+  addr2reg .Lstring.82 r5
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -16 r14 r5
+  read -12 r14 r4
+  jump .L688
+.L696:
+  savpc r15
+  add r15 12 r15
+  jump next
+  jump .L706
+.L697:
+  read 0 r1 r3
+  load 0 r2
+  load 15 r4
+  bne r3 r4 .L699
+  or r0 r2 r3
+  jump .L700
+.L699:
+  read 0 r1 r2
+  xor r2 16 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L700:
+  load 1 r2
+  bne r3 r0 .L702
+  add r1 40 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L703
+.L702:
+  or r0 r2 r1
+.L703:
+  beq r1 r0 .L705
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.81 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L705:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -16 r14 r4
+  read -20 r14 r7
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load32 -1 r1
+  write 0 r2 r1
+  load 0 r6
+  add r14 -108 r5
+  add r14 -48 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -108 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -48 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -108 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -48 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -108 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump addmember
+  load32 -12 r1
+  sub r13 r1 r13
+.L706:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function structdecl */
+
+
+.text
+; function typename
+.global typename
+typename:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 72 r13
+  write -8 r14 r6
+  write -12 r14 r5
+  or r0 r4 r5
+  write -4 r14 r5
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r7
+  load 0 r6
+  add r14 -64 r4
+  savpc r15
+  add r15 12 r15
+  jump declspecs
+  read -4 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  read -64 r14 r1
+  write -28 r14 r1
+  add r14 -64 r2
+  add r2 4 r2
+  add r14 -28 r3
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  beq r1 r0 .L714
+  load 16 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 12 r3
+  load 1 r2
+  write 0 r3 r2
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r7
+  add r14 -52 r6
+  add r14 -28 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -52 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -28 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -52 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -28 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -52 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -40 r4
+  savpc r15
+  add r15 12 r15
+  jump declarator
+  read -8 r14 r6
+  read -12 r14 r5
+  load32 -16 r1
+  sub r13 r1 r13
+  read -40 r14 r1
+  add r14 -40 r2
+  add r2 4 r2
+  read 0 r2 r4
+  add r2 4 r2
+  read 0 r2 r2
+  beq r5 r0 .L712
+  read 0 r5 r3
+  write -16 r14 r3
+  read -16 r14 r3
+  or r3 r4 r3
+  write 0 r5 r3
+.L712:
+  beq r6 r0 .L714
+  write 0 r6 r2
+.L714:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function typename */
+
+
+.text
+; function getlinkage
+getlinkage:
+  and r5 8 r1
+  bne r1 r0 .L727
+  and r5 4 r2
+  load 1 r1
+  bne r2 r0 .L720
+  xor r4 2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L720:
+  bne r1 r0 .L724
+  and r7 0xFF r1
+  bne r1 r0 .L723
+  load 0 r1
+  jump .L730
+.L723:
+  load 2 r1
+  jump .L730
+.L724:
+  bne r6 r0 .L726
+  load 2 r1
+  jump .L730
+.L726:
+  add r6 8 r1
+  read 0 r1 r1
+  jump .L730
+.L727:
+  and r7 0xFF r1
+  bne r1 r0 .L729
+  load 0 r1
+  jump .L730
+.L729:
+  load 1 r1
+.L730:
+  jumpr 0 r15
+
+/* end function getlinkage */
+
+.data
+.balign 1
+.Lstring.86:
+	.ascii "function\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.87:
+	.ascii "object\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.88:
+	.ascii "%s '%s' with no linkage redeclared\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.89:
+	.ascii "%s '%s' redeclared with different linkage\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.90:
+	.ascii "%s '%s' redeclared with incompatible type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.91:
+	.ascii "%s '%s' redeclared with different assembler name\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.92:
+	.ascii "'%s' redeclared with different kind\000"
+/* end data */
+
+
+.text
+; function declcommon
+declcommon:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 124 r13
+  write -116 r14 r8
+  read 20 r14 r1
+  write -112 r14 r1
+  read 16 r14 r2
+  write -68 r14 r2
+  read 12 r14 r3
+  write -80 r14 r3
+  read 8 r14 r3
+  write -108 r14 r3
+  write -92 r14 r7
+  or r0 r6 r7
+  or r0 r5 r12
+  or r0 r4 r5
+  or r0 r12 r4
+  or r0 r2 r12
+  or r0 r5 r2
+  or r0 r12 r5
+  write -104 r14 r7
+  write -72 r14 r4
+  write -76 r14 r2
+  load 2 r3
+  beq r4 r3 .L735
+  addr2reg .Lstring.87 r3
+  jump .L736
+.L735:
+  addr2reg .Lstring.86 r3
+.L736:
+  or r0 r3 r6
+  write -100 r14 r6
+  bne r1 r0 .L776
+  add r2 44 r3
+  read 0 r3 r3
+  beq r3 r0 .L740
+  or r0 r3 r4
+  load 1 r6
+  or r0 r7 r5
+  savpc r15
+  add r15 12 r15
+  jump scopegetdecl
+  read -68 r14 r5
+  read -72 r14 r4
+  read -76 r14 r2
+.L740:
+  write -20 r14 r1
+  addr2reg filescope r3
+  xor r2 r3 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r7
+  or r0 r1 r6
+  or r0 r4 r3
+  savpc r15
+  add r15 12 r15
+  jump getlinkage
+  read -100 r14 r6
+  read -108 r14 r4
+  read -92 r14 r5
+  read -104 r14 r7
+  read -76 r14 r2
+  write -56 r14 r1
+  load 0 r3
+  write -8 r14 r3
+  xor r1 r0 r1
+  sltu r0 r1 r1
+  write -4 r14 r1
+  read -80 r14 r1
+  read -72 r14 r3
+  read -4 r14 r12
+  bne r12 r0 .L742
+  read -8 r14 r12
+  write -16 r14 r12
+  jump .L744
+.L742:
+  add r2 44 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  write -12 r14 r1
+  read -80 r14 r1
+  read -72 r14 r3
+  read -12 r14 r12
+  write -16 r14 r12
+.L744:
+  read -16 r14 r12
+  bne r12 r0 .L746
+  write -60 r14 r5
+  or r0 r4 r2
+  or r0 r3 r4
+  or r0 r1 r3
+  read -56 r14 r1
+  jump .L775
+.L746:
+  add r2 44 r1
+  read 0 r1 r1
+  addr2reg filescope r2
+  xor r1 r2 r2
+  sltu r0 r2 r2
+  read -20 r14 r1
+  beq r2 r0 .L748
+  load 0 r6
+  or r0 r7 r5
+  addr2reg filescope r4
+  savpc r15
+  add r15 12 r15
+  jump scopegetdecl
+  read -100 r14 r6
+  read -108 r14 r4
+  read -92 r14 r5
+  read -104 r14 r7
+  read -72 r14 r3
+.L748:
+  write -48 r14 r1
+  load 0 r2
+  write -24 r14 r2
+  read -56 r14 r2
+  bne r1 r0 .L750
+  read -24 r14 r12
+  write -32 r14 r12
+  jump .L752
+.L750:
+  add r1 8 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  write -28 r14 r2
+  read -56 r14 r2
+  read -72 r14 r3
+  read -28 r14 r12
+  write -32 r14 r12
+.L752:
+  read -32 r14 r12
+  bne r12 r0 .L754
+  or r0 r2 r1
+  or r0 r4 r2
+  or r0 r3 r4
+  read -80 r14 r3
+  jump .L774
+.L754:
+  add r1 4 r5
+  read 0 r5 r5
+  beq r5 r3 .L756
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r7 r6
+  addr2reg .Lstring.92 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -48 r14 r1
+  read -56 r14 r2
+  read -100 r14 r6
+  read -108 r14 r4
+  read -104 r14 r7
+  load32 -24 r3
+  sub r13 r3 r13
+.L756:
+  add r1 8 r3
+  read 0 r3 r3
+  beq r3 r2 .L758
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.89 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -48 r14 r1
+  read -108 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L758:
+  add r1 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  or r0 r1 r2
+  read -48 r14 r1
+  read -100 r14 r6
+  read -108 r14 r4
+  read -92 r14 r5
+  read -104 r14 r7
+  and r2 0xFF r3
+  write -36 r14 r3
+  read -80 r14 r2
+  load 1 r3
+  write -40 r14 r3
+  read -36 r14 r3
+  xor r3 r0 r8
+  sltu r8 1 r8
+  read -40 r14 r3
+  bne r8 r0 .L760
+  or r0 r2 r3
+  add r1 16 r2
+  read 0 r2 r2
+  xor r3 r2 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L761
+.L760:
+  or r0 r3 r2
+.L761:
+  beq r2 r0 .L763
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.90 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -48 r14 r1
+  read -100 r14 r6
+  read -108 r14 r4
+  read -92 r14 r5
+  read -104 r14 r7
+  load32 -24 r2
+  sub r13 r2 r13
+.L763:
+  beq r5 r0 .L771
+  add r1 24 r2
+  read 0 r2 r2
+  load 1 r3
+  write -44 r14 r3
+  xor r2 r0 r8
+  sltu r8 1 r8
+  read -44 r14 r3
+  bne r8 r0 .L767
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -48 r14 r1
+  read -100 r14 r6
+  read -108 r14 r4
+  read -92 r14 r5
+  read -104 r14 r7
+  xor r2 0 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L768
+.L767:
+  or r0 r3 r2
+.L768:
+  beq r2 r0 .L770
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.91 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -48 r14 r1
+  read -108 r14 r4
+  read -92 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+.L770:
+  write -52 r14 r5
+  jump .L773
+.L771:
+  add r1 24 r2
+  read 0 r2 r5
+  write -52 r14 r5
+.L773:
+  add r1 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typecomposite
+  or r0 r1 r4
+  read -52 r14 r5
+  read -56 r14 r1
+  read -80 r14 r3
+  read -104 r14 r7
+  or r0 r4 r2
+  read -72 r14 r4
+.L774:
+  write -60 r14 r5
+.L775:
+  load 12 r5
+  sub r13 r5 r13
+  or r0 r13 r5
+  add r5 8 r5
+  write 0 r5 r1
+  or r0 r7 r1
+  or r0 r3 r7
+  or r0 r2 r6
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkdecl
+  read -60 r14 r5
+  read -76 r14 r2
+  write -64 r14 r1
+  load32 -12 r3
+  sub r13 r3 r13
+  add r1 24 r3
+  write 0 r3 r5
+  or r0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump scopeputdecl
+  read -64 r14 r1
+  jump .L794
+.L776:
+  add r1 8 r3
+  read 0 r3 r3
+  bne r3 r0 .L778
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.88 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -112 r14 r1
+  read -68 r14 r5
+  read -72 r14 r4
+  read -76 r14 r2
+  load32 -24 r3
+  sub r13 r3 r13
+.L778:
+  addr2reg filescope r3
+  xor r2 r3 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r7
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump getlinkage
+  or r0 r1 r3
+  read -100 r14 r6
+  read -112 r14 r1
+  read -108 r14 r4
+  read -104 r14 r7
+  add r1 8 r2
+  read 0 r2 r2
+  beq r2 r3 .L780
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.89 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -112 r14 r1
+  read -108 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L780:
+  add r1 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typecompatible
+  or r0 r1 r2
+  read -100 r14 r6
+  read -112 r14 r1
+  read -108 r14 r4
+  read -92 r14 r5
+  read -104 r14 r7
+  and r2 0xFF r3
+  write -84 r14 r3
+  read -80 r14 r2
+  load 1 r3
+  write -88 r14 r3
+  read -84 r14 r3
+  xor r3 r0 r8
+  sltu r8 1 r8
+  read -88 r14 r3
+  bne r8 r0 .L782
+  add r1 16 r3
+  read 0 r3 r3
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L783
+.L782:
+  or r0 r3 r2
+.L783:
+  beq r2 r0 .L785
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.90 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -100 r14 r6
+  read -112 r14 r1
+  read -108 r14 r4
+  read -92 r14 r5
+  read -104 r14 r7
+  load32 -24 r2
+  sub r13 r2 r13
+.L785:
+  load 0 r2
+  beq r5 r0 .L791
+  add r1 24 r2
+  read 0 r2 r2
+  load 1 r3
+  write -96 r14 r3
+  xor r2 r0 r8
+  sltu r8 1 r8
+  read -96 r14 r3
+  bne r8 r0 .L789
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -100 r14 r6
+  read -112 r14 r1
+  read -108 r14 r4
+  read -104 r14 r7
+  xor r2 0 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L790
+.L789:
+  or r0 r3 r2
+.L790:
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L791:
+  beq r2 r0 .L793
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.91 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -112 r14 r1
+  read -108 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L793:
+  add r1 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump typecomposite
+  or r0 r1 r2
+  read -112 r14 r1
+  add r1 12 r3
+  write 0 r3 r2
+.L794:
+  read -116 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function declcommon */
+
+.data
+.balign 1
+.Lstring.94:
+	.ascii "object '%s' has incomplete type\000"
+/* end data */
+
+
+.text
+; function defineobj
+defineobj:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r7 r1
+  or r0 r6 r2
+  or r0 r5 r6
+  write -4 r14 r1
+  write -8 r14 r2
+  write -12 r14 r6
+  write -16 r14 r4
+  add r4 12 r3
+  read 0 r3 r3
+  add r3 36 r3
+  readbu 0 r3 r3
+  beq r3 r0 .L799
+  read 0 r4 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.94 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -4 r14 r4
+  read -8 r14 r2
+  read -12 r14 r6
+  or r0 r4 r1
+  read -16 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+.L799:
+  add r4 36 r3
+  read 0 r3 r5
+  add r4 12 r3
+  read 0 r3 r3
+  add r3 8 r7
+  read 0 r7 r7
+  bges r5 r7 .L801
+  add r3 8 r3
+  read 0 r3 r3
+  add r4 36 r5
+  write 0 r5 r3
+.L801:
+  add r4 36 r3
+  add r3 4 r3
+  read 0 r3 r3
+  load 2 r5
+  beq r3 r5 .L804
+  or r0 r6 r5
+  or r0 r4 r1
+  savpc r15
+  add r15 12 r15
+  jump emitdata
+  read -16 r14 r1
+  or r0 r1 r4
+  jump .L806
+.L804:
+  or r0 r1 r12
+  or r0 r4 r1
+  or r0 r12 r4
+  and r2 0xFF r7
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinit
+  read -16 r14 r4
+.L806:
+  add r4 28 r2
+  load 1 r1
+  writeb 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function defineobj */
+
+.data
+.balign 1
+.Lstring.96:
+	.ascii "block scope declaration containing 'thread_local' must contain 'static' or 'extern'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.97:
+	.ascii "external declaration must not contain 'auto'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.98:
+	.ascii "external declaration must not contain 'register'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.99:
+	.ascii "after __asm__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.100:
+	.ascii "for assembler name\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.101:
+	.ascii "after assembler name\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.102:
+	.ascii "typedef '%s' declared with alignment specifier\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.103:
+	.ascii "typedef '%s' declared with assembler label\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.104:
+	.ascii "typedef '%s' redefined with different type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.105:
+	.ascii "object '%s' requires alignment %d, which is stricter than specified alignment %d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.106:
+	.ascii "static\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.107:
+	.ascii "thread\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.108:
+	.ascii "object '%s' with %s storage duration cannot have variably modified type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.109:
+	.ascii "external\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.110:
+	.ascii "internal\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.111:
+	.ascii "object '%s' with block scope and %s linkage cannot have initializer\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.112:
+	.ascii "object '%s' redefined\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.113:
+	.ascii "function '%s' declared with alignment specifier\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.114:
+	.ascii "function '%s' with block scope may only have storage class 'extern'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.115:
+	.ascii "function definition not allowed\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.116:
+	.ascii "function '%s' redefined\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.117:
+	.ascii "funcscope\000"
+/* end data */
+
+
+.text
+; function decl
+.global decl
+decl:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 208 r13
+  write -200 r14 r8
+  or r0 r5 r8
+  write -124 r14 r8
+  write -128 r14 r4
+  xor r8 0 r1
+  sltu r1 1 r1
+  write -8 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump staticassert
+  and r1 0xFF r1
+  beq r1 r0 8
+  jump .L960
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump attr
+  read -128 r14 r4
+  and r1 0xFF r2
+  load 0 r1
+  beq r2 r0 .L813
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -128 r14 r4
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L813:
+  beq r1 r0 8
+  jump .L959
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  add r14 -132 r1
+  write 0 r2 r1
+  add r14 -144 r7
+  add r14 -148 r6
+  or r0 r4 r5
+  add r14 -196 r4
+  savpc r15
+  add r15 12 r15
+  jump declspecs
+  read -124 r14 r8
+  load32 -12 r1
+  sub r13 r1 r13
+  read -196 r14 r1
+  write -160 r14 r1
+  add r14 -196 r2
+  add r2 4 r2
+  add r14 -160 r3
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write -120 r14 r2
+  write 0 r3 r2
+  bne r1 r0 8
+  jump .L958
+  bne r8 r0 .L820
+  read -148 r14 r1
+  and r1 16 r1
+  beq r1 r0 .L818
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.97 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L818:
+  read -148 r14 r1
+  and r1 32 r1
+  beq r1 r0 .L822
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.98 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L822
+.L820:
+  read -148 r14 r1
+  load 64 r2
+  bne r1 r2 .L822
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.96 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L822:
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r2
+  read -8 r14 r1
+  read -128 r14 r4
+  and r2 0xFF r2
+  bne r2 r0 .L957
+  write -12 r14 r1
+.L824:
+  load 16 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 12 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 8 r2
+  add r14 -136 r1
+  write 0 r2 r1
+  add r14 -140 r7
+  add r14 -184 r6
+  add r14 -160 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -184 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -160 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -184 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -160 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -184 r2
+  add r2 8 r2
+  write 0 r2 r1
+  or r0 r4 r5
+  add r14 -172 r4
+  savpc r15
+  add r15 12 r15
+  jump declarator
+  load32 -16 r1
+  sub r13 r1 r13
+  read -172 r14 r2
+  write -112 r14 r2
+  add r14 -172 r1
+  add r1 4 r1
+  read 0 r1 r3
+  write -84 r14 r3
+  load 62 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r3
+  read -12 r14 r1
+  read -112 r14 r2
+  read -128 r14 r4
+  and r3 0xFF r3
+  bne r3 r0 .L827
+  load 0 r3
+  write -80 r14 r3
+  write -48 r14 r1
+  jump .L829
+.L827:
+  addr2reg .Lstring.99 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg .Lstring.100 r5
+  load 7 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  write -16 r14 r1
+  addr2reg .Lstring.101 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -16 r14 r7
+  read -112 r14 r2
+  read -128 r14 r4
+  load 0 r1
+  write -80 r14 r7
+  write -48 r14 r1
+.L829:
+  read -148 r14 r1
+  and r1 2 r1
+  bne r1 r0 .L835
+  read 0 r2 r1
+  load 14 r2
+  beq r1 r2 .L832
+  load 1 r1
+  jump .L833
+.L832:
+  load 2 r1
+.L833:
+  or r0 r1 r5
+  write -92 r14 r5
+  jump .L837
+.L835:
+  load 0 r1
+  write -92 r14 r1
+.L837:
+  read -140 r14 r5
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump scopegetdecl
+  read -80 r14 r7
+  read -92 r14 r5
+  read -84 r14 r3
+  read -112 r14 r2
+  read -128 r14 r4
+  write -88 r14 r1
+  load 0 r6
+  beq r1 r0 .L839
+  add r1 4 r6
+  read 0 r6 r6
+  xor r6 r5 r6
+  sltu r0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L839:
+  beq r6 r0 .L841
+  read -140 r14 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.92 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r7
+  read -88 r14 r1
+  read -92 r14 r5
+  read -84 r14 r3
+  read -112 r14 r2
+  read -128 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+.L841:
+  load 1 r6
+  beq r5 r6 .L904
+  load 1 r6
+  blt r5 r6 .L891
+  load 2 r6
+  beq r5 r6 .L845
+  load 2 r1
+  sltu r5 r1 r1
+  jump .L952
+.L845:
+  read -132 r14 r6
+  beq r6 r0 .L847
+  read -140 r14 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.113 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r7
+  read -88 r14 r1
+  read -92 r14 r5
+  read -84 r14 r3
+  read -112 r14 r2
+  read -128 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+.L847:
+  load 0 r6
+  write -20 r14 r6
+  read -124 r14 r8
+  read -20 r14 r6
+  bne r8 r0 .L849
+  write -24 r14 r6
+  jump .L851
+.L849:
+  read -148 r14 r6
+  xor r6 0 r6
+  sltu r0 r6 r8
+  write -24 r14 r8
+.L851:
+  load 0 r6
+  write -28 r14 r6
+  read -24 r14 r8
+  read -28 r14 r6
+  beq r8 r0 .L853
+  read -148 r14 r6
+  xor r6 4 r6
+  sltu r0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L853:
+  beq r6 r0 .L855
+  read -140 r14 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.114 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r7
+  read -88 r14 r1
+  read -92 r14 r5
+  read -84 r14 r3
+  read -112 r14 r2
+  read -128 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+.L855:
+  read -140 r14 r6
+  write -44 r14 r6
+  read -148 r14 r6
+  write -32 r14 r6
+  load 24 r6
+  sub r13 r6 r13
+  or r0 r13 r6
+  write -40 r14 r6
+  add r6 20 r6
+  write 0 r6 r1
+  read -40 r14 r1
+  or r0 r1 r6
+  read -32 r14 r1
+  add r6 16 r6
+  write 0 r6 r1
+  read -40 r14 r1
+  add r1 12 r6
+  write 0 r6 r3
+  read -44 r14 r6
+  add r1 8 r1
+  write 0 r1 r2
+  savpc r15
+  add r15 12 r15
+  jump declcommon
+  or r0 r1 r2
+  write -60 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump mkglobal
+  or r0 r1 r4
+  read -48 r14 r1
+  read -60 r14 r2
+  read -88 r14 r3
+  add r2 20 r5
+  write 0 r5 r4
+  add r2 8 r4
+  read 0 r4 r5
+  load 0 r4
+  load 2 r6
+  beq r5 r6 .L857
+  or r0 r4 r5
+  jump .L858
+.L857:
+  read -144 r14 r4
+  and r4 2 r4
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L858:
+  load 0 r4
+  bne r5 r0 .L860
+  or r0 r4 r5
+  jump .L861
+.L860:
+  read -148 r14 r4
+  and r4 4 r4
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L861:
+  load 0 r4
+  bne r5 r0 .L863
+  or r0 r4 r3
+  jump .L867
+.L863:
+  load 1 r4
+  beq r3 r0 .L865
+  add r3 36 r3
+  readbu 0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  jump .L866
+.L865:
+  or r0 r4 r3
+.L866:
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L867:
+  xor r3 0 r3
+  sltu r0 r3 r3
+  add r2 36 r4
+  writeb 0 r4 r3
+  read -144 r14 r3
+  and r3 4 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  add r2 36 r4
+  add r4 1 r4
+  writeb 0 r4 r3
+  read -144 r14 r3
+  and r3 8 r4
+  bne r4 r0 .L874
+  and r3 16 r4
+  bne r4 r0 .L873
+  and r3 2 r4
+  load 0 r3
+  beq r4 r0 .L871
+  add r2 36 r3
+  add r3 4 r3
+  read 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L871:
+  beq r3 r0 .L875
+  add r2 36 r2
+  add r2 4 r3
+  load 1 r2
+  write 0 r3 r2
+  jump .L875
+.L873:
+  add r2 36 r2
+  add r2 4 r3
+  load 2 r2
+  write 0 r3 r2
+  jump .L875
+.L874:
+  add r2 36 r2
+  add r2 4 r3
+  load32 -1 r2
+  write 0 r3 r2
+.L875:
+  addr2reg tok r12
+  read 0 r12 r2
+  load 68 r3
+  beq r2 r3 .L878
+  read -136 r14 r4
+  beq r4 r0 .L952
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  jump .L952
+.L878:
+  read -60 r14 r2
+  read -112 r14 r6
+  bne r1 r0 .L881
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.115 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -60 r14 r2
+  read -112 r14 r6
+  load32 -24 r1
+  sub r13 r1 r13
+.L881:
+  add r2 28 r1
+  readbu 0 r1 r1
+  beq r1 r0 .L883
+  read -140 r14 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.116 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -60 r14 r2
+  read -112 r14 r6
+  load32 -24 r1
+  sub r13 r1 r13
+.L883:
+  read -136 r14 r1
+  bne r1 r0 .L885
+  load 1121 r6
+  addr2reg .Lstring.22 r5
+  addr2reg .Lstring.117 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -60 r14 r2
+  read -112 r14 r6
+.L885:
+  read -136 r14 r1
+  write -52 r14 r1
+  read -140 r14 r5
+  or r0 r1 r7
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump mkfunc
+  or r0 r1 r4
+  read -52 r14 r1
+  write -56 r14 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump stmt
+  read -56 r14 r4
+  read -52 r14 r1
+  read -60 r14 r2
+  add r2 36 r3
+  add r3 1 r3
+  readbu 0 r3 r3
+  beq r3 r0 .L887
+  savpc r15
+  add r15 12 r15
+  jump funchlt
+  read -56 r14 r4
+  read -52 r14 r1
+  read -60 r14 r2
+.L887:
+  add r2 36 r3
+  readbu 0 r3 r3
+  beq r3 r0 .L889
+  or r0 r1 r4
+  jump .L890
+.L889:
+  add r2 8 r1
+  read 0 r1 r1
+  xor r1 2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump emitfunc
+  read -52 r14 r4
+.L890:
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  read -56 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delfunc
+  read -60 r14 r2
+  add r2 28 r2
+  load 1 r1
+  writeb 0 r2 r1
+  load 1 r1
+  jump .L961
+.L891:
+  beq r5 r0 .L893
+  sltu r5 r0 r1
+  jump .L952
+.L893:
+  read -132 r14 r4
+  beq r4 r0 .L895
+  read -140 r14 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.102 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r7
+  read -88 r14 r1
+  read -84 r14 r3
+  read -112 r14 r2
+  load32 -24 r4
+  sub r13 r4 r13
+.L895:
+  beq r7 r0 .L897
+  read -140 r14 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.103 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -88 r14 r1
+  read -84 r14 r3
+  read -112 r14 r2
+  load32 -24 r4
+  sub r13 r4 r13
+.L897:
+  beq r1 r0 .L903
+  add r1 12 r1
+  read 0 r1 r4
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump typesame
+  or r0 r1 r2
+  read -88 r14 r1
+  read -84 r14 r3
+  and r2 0xFF r4
+  load 1 r2
+  beq r4 r0 .L900
+  add r1 16 r1
+  read 0 r1 r1
+  xor r1 r3 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L901
+.L900:
+  or r0 r2 r1
+.L901:
+  beq r1 r0 .L952
+  read -140 r14 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.104 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L952
+.L903:
+  read -140 r14 r4
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r5
+  load 0 r1
+  write 0 r5 r1
+  or r0 r3 r7
+  or r0 r2 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump mkdecl
+  or r0 r1 r5
+  read -128 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  savpc r15
+  add r15 12 r15
+  jump scopeputdecl
+  jump .L952
+.L904:
+  read -132 r14 r6
+  write -68 r14 r6
+  load 0 r6
+  write -64 r14 r6
+  read -68 r14 r6
+  bne r6 r0 .L906
+  read -64 r14 r12
+  write -76 r14 r12
+  jump .L908
+.L906:
+  add r2 8 r7
+  read 0 r7 r7
+  slt r6 r7 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+  write -72 r14 r6
+  read -80 r14 r7
+  read -68 r14 r6
+  read -72 r14 r12
+  write -76 r14 r12
+.L908:
+  read -76 r14 r12
+  beq r12 r0 .L911
+  or r0 r6 r1
+  read -140 r14 r6
+  add r2 8 r2
+  read 0 r2 r7
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.105 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r7
+  read -88 r14 r1
+  read -92 r14 r5
+  read -84 r14 r3
+  read -112 r14 r2
+  read -128 r14 r4
+  load32 -28 r6
+  sub r13 r6 r13
+.L911:
+  read -140 r14 r6
+  write -108 r14 r6
+  read -148 r14 r6
+  write -96 r14 r6
+  load 24 r6
+  sub r13 r6 r13
+  or r0 r13 r6
+  write -104 r14 r6
+  add r6 20 r6
+  write 0 r6 r1
+  read -104 r14 r1
+  or r0 r1 r6
+  read -96 r14 r1
+  add r6 16 r6
+  write 0 r6 r1
+  read -104 r14 r1
+  add r1 12 r6
+  write 0 r6 r3
+  read -108 r14 r6
+  add r1 8 r1
+  write 0 r1 r2
+  or r0 r4 r1
+  savpc r15
+  add r15 12 r15
+  jump declcommon
+  or r0 r1 r4
+  read -112 r14 r2
+  read -120 r14 r1
+  read -124 r14 r5
+  write -116 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  add r4 36 r3
+  read 0 r3 r6
+  read -132 r14 r3
+  bges r6 r3 .L913
+  add r4 36 r6
+  write 0 r6 r3
+.L913:
+  add r4 8 r3
+  read 0 r3 r6
+  load 0 r3
+  bne r6 r0 .L915
+  read -148 r14 r3
+  and r3 8 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L915:
+  bne r3 r0 .L926
+  read -148 r14 r1
+  and r1 64 r1
+  bne r1 r0 .L918
+  load 0 r1
+  jump .L919
+.L918:
+  load 1 r1
+.L919:
+  add r4 36 r3
+  add r3 4 r3
+  write 0 r3 r1
+  add r2 4 r2
+  read 0 r2 r2
+  and r2 64 r2
+  beq r2 r0 .L924
+  read -140 r14 r6
+  beq r1 r0 .L922
+  addr2reg .Lstring.107 r1
+  jump .L923
+.L922:
+  addr2reg .Lstring.106 r1
+.L923:
+  or r0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.108 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -116 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L924:
+  savpc r15
+  add r15 12 r15
+  jump mkglobal
+  or r0 r1 r2
+  read -116 r14 r4
+  read -120 r14 r1
+  read -124 r14 r5
+  add r4 20 r3
+  write 0 r3 r2
+  or r0 r1 r2
+  jump .L927
+.L926:
+  add r4 36 r2
+  add r2 4 r3
+  or r0 r1 r2
+  load 2 r1
+  write 0 r3 r1
+.L927:
+  beq r2 r0 .L929
+  or r0 r5 r1
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+.L929:
+  load 99 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  or r0 r1 r2
+  read -116 r14 r4
+  read -124 r14 r5
+  read -128 r14 r1
+  and r2 0xFF r2
+  bne r2 r0 .L940
+  read -148 r14 r1
+  and r1 4 r1
+  bne r1 r0 .L952
+  add r4 8 r1
+  read 0 r1 r2
+  load 0 r1
+  beq r2 r0 .L933
+  add r4 36 r1
+  add r1 4 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L933:
+  bne r1 r0 .L936
+  load 0 r2
+  load 0 r1
+  or r0 r5 r12
+  or r0 r1 r5
+  or r0 r12 r1
+  or r0 r2 r12
+  or r0 r5 r2
+  or r0 r12 r5
+  jump .L951
+.L936:
+  add r4 28 r1
+  readbu 0 r1 r2
+  load 0 r1
+  bne r2 r0 .L938
+  add r4 29 r1
+  readbu 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L938:
+  beq r1 r0 .L952
+  add r4 29 r2
+  load 1 r1
+  writeb 0 r2 r1
+  addr2reg tentativedefnsend r12
+  read 0 r12 r1
+  write 0 r1 r4
+  add r4 32 r1
+  addr2reg tentativedefnsend r12
+  write 0 r12 r1
+  jump .L952
+.L940:
+  load 0 r2
+  beq r5 r0 .L942
+  add r4 8 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L942:
+  beq r2 r0 .L947
+  read -140 r14 r6
+  add r4 8 r1
+  read 0 r1 r1
+  load 2 r2
+  beq r1 r2 .L945
+  addr2reg .Lstring.110 r1
+  jump .L946
+.L945:
+  addr2reg .Lstring.109 r1
+.L946:
+  or r0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.111 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -116 r14 r4
+  read -128 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L947:
+  add r4 28 r2
+  readbu 0 r2 r2
+  bne r2 r0 .L949
+  or r0 r4 r12
+  or r0 r1 r4
+  or r0 r12 r1
+  jump .L950
+.L949:
+  read -140 r14 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.112 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -116 r14 r4
+  or r0 r4 r1
+  read -128 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L950:
+  add r1 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump parseinit
+  or r0 r1 r5
+  read -116 r14 r4
+  read -124 r14 r1
+  load 1 r2
+.L951:
+  and r2 0xFF r6
+  or r0 r1 r7
+  savpc r15
+  add r15 12 r15
+  jump defineobj
+.L952:
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  and r1 0xFF r1
+  bne r1 r0 .L956
+  addr2reg .Lstring.82 r5
+  load 110 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -120 r14 r1
+  read -124 r14 r5
+  read -128 r14 r4
+  load 0 r2
+  write -12 r14 r2
+  jump .L824
+.L956:
+  load 1 r1
+  jump .L961
+.L957:
+  load 1 r1
+  jump .L961
+.L958:
+  load 0 r1
+  jump .L961
+.L959:
+  load 1 r1
+  jump .L961
+.L960:
+  load 1 r1
+.L961:
+  read -200 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function decl */
+
+.data
+.balign 4
+.Lstrings.119:
+	.fill 16,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.120:
+	.ascii "expr->kind == EXPRSTRING\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.121:
+	.ascii "string\000"
+/* end data */
+
+
+.text
+; function stringdecl
+.global stringdecl
+stringdecl:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  or r0 r4 r7
+  write -8 r14 r7
+  addr2reg .Lstrings.119 r12
+  read 0 r12 r1
+  bne r1 r0 .L966
+  load 64 r5
+  addr2reg .Lstrings.119 r4
+  savpc r15
+  add r15 12 r15
+  jump mapinit
+  read -8 r14 r7
+.L966:
+  read 0 r7 r1
+  load 2 r2
+  beq r1 r2 .L968
+  load 1156 r6
+  addr2reg .Lstring.22 r5
+  addr2reg .Lstring.120 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -8 r14 r7
+.L968:
+  add r7 32 r1
+  add r1 4 r1
+  read 0 r1 r5
+  add r7 32 r1
+  read 0 r1 r6
+  add r14 -32 r4
+  savpc r15
+  add r15 12 r15
+  jump mapkey
+  add r14 -32 r5
+  addr2reg .Lstrings.119 r4
+  savpc r15
+  add r15 12 r15
+  jump mapput
+  or r0 r1 r2
+  read -8 r14 r7
+  write -12 r14 r2
+  read 0 r2 r1
+  bne r1 r0 .L970
+  add r7 8 r1
+  read 0 r1 r6
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r7
+  load 1 r5
+  addr2reg .Lstring.121 r4
+  savpc r15
+  add r15 12 r15
+  jump mkdecl
+  write -16 r14 r1
+  or r0 r1 r2
+  load32 -12 r1
+  sub r13 r1 r13
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump mkglobal
+  read -16 r14 r2
+  read -8 r14 r7
+  add r2 20 r2
+  write 0 r2 r1
+  add r7 8 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r5
+  load 0 r1
+  writeh -20 r14 r1
+  add r14 -20 r1
+  add r1 2 r2
+  load 0 r1
+  writeh 0 r2 r1
+  read -20 r14 r6
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump mkinit
+  or r0 r1 r5
+  read -16 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdata
+  read -16 r14 r1
+  read -12 r14 r2
+  write 0 r2 r1
+.L970:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function stringdecl */
+
+
+.text
+; function emittentativedefns
+.global emittentativedefns
+emittentativedefns:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  addr2reg tentativedefns r12
+  read 0 r12 r1
+.L974:
+  write -16 r14 r1
+  beq r1 r0 .L978
+  add r1 28 r2
+  readbu 0 r2 r2
+  bne r2 r0 .L977
+  load 0 r7
+  load 0 r6
+  load 0 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump defineobj
+  read -16 r14 r1
+.L977:
+  add r1 32 r1
+  read 0 r1 r1
+  jump .L974
+.L978:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emittentativedefns */
+
+.data
+.balign 4
+tentativedefns:
+	.fill 4,1,0
+/* end data */
+
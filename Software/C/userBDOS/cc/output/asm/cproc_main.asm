@@ -0,0 +1,504 @@
+.data
+.balign 1
+.Lstring.2:
+	.ascii "usage: %s [input]\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.4:
+	.ascii "cproc-qbe\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "w\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "open %s:\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "<stdin>\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "unexpected ';' at top-level\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "expected declaration or function definition\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "write failed\000"
+/* end data */
+
+
+.text
+; function cproc_main
+.global cproc_main
+cproc_main:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 92 r13
+  write -84 r14 r8
+  write -16 r14 r4
+  write -20 r14 r5
+  add r5 0 r1
+  read 0 r1 r4
+  addr2reg .Lstring.4 r5
+  savpc r15
+  add r15 12 r15
+  jump progname
+  read -20 r14 r5
+  read -16 r14 r4
+  addr2reg argv0 r12
+  write 0 r12 r1
+  load 0 r3
+  load 0 r2
+  load 0 r1
+  write -80 r14 r3
+  or r0 r2 r7
+.L3:
+  write -64 r14 r7
+  bles r4 r0 .L6
+  add r5 4 r5
+  load 1 r2
+  sub r4 r2 r4
+.L6:
+  load 1 r2
+  beq r4 r0 .L8
+  read 0 r5 r2
+  add r2 0 r2
+  readb 0 r2 r2
+  xor r2 45 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L8:
+  bne r2 r0 .L60
+  read 0 r5 r2
+  add r2 1 r3
+  readb 0 r3 r3
+  load 0 r6
+  write -24 r14 r6
+  load 45 r6
+  xor r3 r6 r8
+  sltu r8 1 r8
+  read -80 r14 r6
+  read -24 r14 r3
+  beq r8 r0 .L11
+  add r2 2 r3
+  readb 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L11:
+  bne r3 r0 .L58
+  add r2 1 r2
+  load 0 r3
+  write -40 r14 r7
+  or r0 r1 r7
+  or r0 r3 r1
+.L14:
+  write -52 r14 r4
+  write -60 r14 r5
+  write -44 r14 r6
+  write -48 r14 r7
+  write -56 r14 r2
+  write -36 r14 r1
+  shiftl r1 24 r3
+  shiftrs r3 24 r3
+  load 0 r1
+  bne r3 r0 .L16
+  readb 0 r2 r1
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L16:
+  beq r1 r0 .L56
+  readb 0 r2 r1
+  load 111 r3
+  beq r1 r3 .L43
+  load 111 r3
+  sltu r1 r3 r3
+  write -28 r14 r3
+  read -44 r14 r6
+  read -40 r14 r3
+  read -28 r14 r12
+  bne r12 r0 .L34
+  load 116 r7
+  beq r1 r7 .L22
+  or r0 r1 r3
+  load 116 r1
+  sltu r3 r1 r1
+  jump .L38
+.L22:
+  add r2 1 r1
+  readb 0 r1 r1
+  bne r1 r0 .L29
+  add r5 4 r1
+  read 0 r1 r1
+  bne r1 r0 .L26
+  addr2reg argv0 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.2 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  savpc r15
+  add r15 12 r15
+  jump abort
+  read -52 r14 r4
+  read -60 r14 r5
+  read -44 r14 r6
+  read -40 r14 r2
+  or r0 r2 r8
+  read -56 r14 r2
+  load 0 r1
+  jump .L28
+.L26:
+  or r0 r3 r8
+  load 1 r3
+  sub r4 r3 r4
+  add r5 4 r5
+.L28:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L32
+.L29:
+  or r0 r3 r8
+  or r0 r2 r1
+  add r2 1 r2
+  or r0 r2 r1
+.L32:
+  load 1 r3
+  or r0 r1 r7
+  or r0 r3 r1
+  or r0 r8 r3
+  jump .L54
+.L34:
+  or r0 r1 r3
+  or r0 r2 r1
+  or r0 r7 r2
+  load 69 r6
+  xor r3 r6 r6
+  sltu r6 1 r6
+  write -32 r14 r6
+  read -40 r14 r8
+  read -36 r14 r7
+  read -32 r14 r12
+  bne r12 r0 .L40
+  or r0 r3 r1
+  load 69 r2
+  sltu r1 r2 r1
+.L38:
+  addr2reg argv0 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.2 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  read -52 r14 r4
+  read -60 r14 r5
+  read -44 r14 r6
+  read -40 r14 r2
+  or r0 r2 r3
+  read -48 r14 r2
+  read -56 r14 r1
+  read -36 r14 r7
+  or r0 r1 r12
+  or r0 r7 r1
+  or r0 r12 r7
+  jump .L54
+.L40:
+  or r0 r8 r3
+  or r0 r7 r6
+  load 1 r7
+  or r0 r7 r12
+  or r0 r6 r7
+  or r0 r12 r6
+  or r0 r1 r12
+  or r0 r7 r1
+  or r0 r12 r7
+  jump .L54
+.L43:
+  or r0 r2 r1
+  or r0 r7 r2
+  add r1 1 r3
+  readb 0 r3 r3
+  bne r3 r0 .L50
+  add r5 4 r3
+  read 0 r3 r3
+  bne r3 r0 .L48
+  addr2reg argv0 r12
+  read 0 r12 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.2 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  savpc r15
+  add r15 12 r15
+  jump abort
+  read -52 r14 r4
+  read -60 r14 r5
+  read -44 r14 r6
+  read -48 r14 r2
+  read -56 r14 r1
+  load 0 r3
+  jump .L49
+.L48:
+  load 1 r7
+  sub r4 r7 r4
+  add r5 4 r5
+.L49:
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+  jump .L52
+.L50:
+  add r1 1 r1
+  or r0 r1 r3
+.L52:
+  load 1 r7
+  or r0 r3 r12
+  or r0 r7 r3
+  or r0 r12 r7
+  or r0 r1 r12
+  or r0 r3 r1
+  or r0 r12 r3
+.L54:
+  add r7 1 r7
+  write -40 r14 r3
+  or r0 r2 r12
+  or r0 r7 r2
+  or r0 r12 r7
+  jump .L14
+.L56:
+  read -40 r14 r3
+  write -80 r14 r6
+  or r0 r7 r1
+  or r0 r3 r7
+  jump .L3
+.L58:
+  add r5 4 r5
+  load 1 r2
+  sub r4 r2 r4
+  write -68 r14 r4
+  write -72 r14 r5
+  jump .L61
+.L60:
+  write -68 r14 r4
+  write -72 r14 r5
+.L61:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump targinit
+  read -68 r14 r4
+  read -72 r14 r5
+  or r0 r5 r1
+  read -64 r14 r5
+  load 0 r2
+  beq r5 r0 .L63
+  addr2reg __stdout_file r6
+  or r0 r5 r1
+  addr2reg .Lstring.5 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump freopen
+  or r0 r1 r2
+  read -68 r14 r4
+  read -72 r14 r5
+  or r0 r5 r1
+  read -64 r14 r5
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L63:
+  bne r2 r0 .L65
+  or r0 r1 r5
+  jump .L66
+.L65:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.6 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -68 r14 r4
+  read -72 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L66:
+  beq r4 r0 .L70
+.L67:
+  load 1 r2
+  or r0 r4 r1
+  sub r4 r2 r4
+  write -76 r14 r4
+  beq r1 r0 .L69
+  shiftl r4 2 r1
+  add r5 r1 r1
+  read 0 r1 r4
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump scanfrom
+  read -72 r14 r5
+  read -76 r14 r4
+  jump .L67
+.L69:
+  savpc r15
+  add r15 12 r15
+  jump scanopen
+  jump .L71
+.L70:
+  addr2reg __stdin_file r5
+  addr2reg .Lstring.7 r4
+  savpc r15
+  add r15 12 r15
+  jump scanfrom
+.L71:
+  savpc r15
+  add r15 12 r15
+  jump ppinit
+  read -80 r14 r6
+  and r6 0xFF r1
+  bne r1 r0 .L79
+  savpc r15
+  add r15 12 r15
+  jump scopeinit
+.L73:
+  addr2reg tok r12
+  read 0 r12 r1
+  load 1 r2
+  beq r1 r2 .L78
+  load 0 r5
+  addr2reg filescope r4
+  savpc r15
+  add r15 12 r15
+  jump decl
+  and r1 0xFF r1
+  bne r1 r0 .L73
+  addr2reg tok r12
+  read 0 r12 r1
+  load 97 r2
+  bne r1 r2 .L77
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.8 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L77:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L73
+.L78:
+  savpc r15
+  add r15 12 r15
+  jump emittentativedefns
+  jump .L82
+.L79:
+  addr2reg ppflags r12
+  read 0 r12 r1
+  or r1 1 r1
+  addr2reg ppflags r12
+  write 0 r12 r1
+.L80:
+  addr2reg tok r12
+  read 0 r12 r1
+  load 1 r2
+  beq r1 r2 .L82
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokenprint
+  savpc r15
+  add r15 12 r15
+  jump next
+  jump .L80
+.L82:
+  addr2reg __stdout_file r4
+  savpc r15
+  add r15 12 r15
+  jump fflush
+  addr2reg __stdout_file r4
+  savpc r15
+  add r15 12 r15
+  jump ferror
+  beq r1 r0 .L84
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+.L84:
+  load 0 r1
+  read -84 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function cproc_main */
+
@@ -0,0 +1,522 @@
+
+.text
+; function hash
+hash:
+  add r4 r5 r2
+  load32 -2128831035 r1
+.L2:
+  beq r4 r2 .L5
+  readbu 0 r4 r3
+  xor r1 r3 r1
+  load32 16777619 r3
+  mults r1 r3 r1
+  add r4 1 r4
+  jump .L2
+.L5:
+  jumpr 0 r15
+
+/* end function hash */
+
+
+.text
+; function mapkey
+.global mapkey
+mapkey:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r1
+  or r0 r5 r4
+  or r0 r6 r5
+  write -16 r14 r1
+  add r1 4 r2
+  write 0 r2 r4
+  add r1 8 r1
+  write 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump hash
+  read -16 r14 r4
+  write 0 r4 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mapkey */
+
+.data
+.balign 1
+.Lstring.4:
+	.ascii "!(cap & cap - 1)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "BuildTools/cproc/map.c\000"
+/* end data */
+
+
+.text
+; function mapinit
+.global mapinit
+mapinit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r5
+  write -12 r14 r4
+  load 1 r1
+  sub r5 r1 r1
+  and r5 r1 r1
+  beq r1 r0 .L14
+  load 33 r6
+  addr2reg .Lstring.5 r5
+  addr2reg .Lstring.4 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r5
+  read -12 r14 r4
+.L14:
+  load 0 r1
+  write 0 r4 r1
+  add r4 4 r1
+  write 0 r1 r5
+  load 12 r6
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump xreallocarray
+  read -16 r14 r5
+  read -12 r14 r4
+  add r4 8 r2
+  write 0 r2 r1
+  load 4 r6
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump xreallocarray
+  read -16 r14 r5
+  read -12 r14 r4
+  add r4 12 r2
+  write 0 r2 r1
+  load 0 r1
+.L15:
+  bge r1 r5 .L18
+  add r4 8 r2
+  read 0 r2 r2
+  load 12 r3
+  mults r1 r3 r3
+  add r2 r3 r2
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L15
+.L18:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mapinit */
+
+
+.text
+; function mapfree
+.global mapfree
+mapfree:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r5
+  write -12 r14 r4
+  beq r5 r0 .L27
+  load 0 r1
+.L23:
+  write -16 r14 r1
+  add r4 4 r2
+  read 0 r2 r2
+  bge r1 r2 .L27
+  add r4 8 r2
+  read 0 r2 r2
+  load 12 r3
+  mults r1 r3 r3
+  add r2 r3 r2
+  add r2 4 r2
+  read 0 r2 r2
+  beq r2 r0 .L26
+  or r0 r1 r2
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r5
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+.L26:
+  add r1 1 r1
+  jump .L23
+.L27:
+  add r4 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -12 r14 r4
+  add r4 12 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mapfree */
+
+
+.text
+; function keyequal
+keyequal:
+  or r0 r4 r1
+  read 0 r1 r3
+  read 0 r5 r4
+  load 1 r2
+  bne r3 r4 .L33
+  add r1 8 r2
+  read 0 r2 r2
+  add r5 8 r3
+  read 0 r3 r3
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L33:
+  bne r2 r0 .L35
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  add r1 4 r2
+  read 0 r2 r4
+  add r5 4 r2
+  read 0 r2 r5
+  add r1 8 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump memcmp
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L36
+.L35:
+  load 0 r1
+  jumpr 0 r15
+.L36:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function keyequal */
+
+
+.text
+; function keyindex
+keyindex:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r5
+  write -12 r14 r4
+  read 0 r5 r1
+  add r4 4 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r2
+  and r1 r2 r1
+.L40:
+  write -16 r14 r1
+  or r0 r1 r2
+  add r4 8 r1
+  read 0 r1 r1
+  load 12 r3
+  mults r2 r3 r3
+  add r1 r3 r3
+  add r3 4 r3
+  read 0 r3 r6
+  load 0 r3
+  bne r6 r0 .L42
+  or r0 r2 r1
+  or r0 r3 r2
+  jump .L43
+.L42:
+  load 12 r3
+  mults r2 r3 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump keyequal
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+  and r2 0xFF r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L43:
+  beq r2 r0 .L45
+  add r1 1 r1
+  add r4 4 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r2
+  and r1 r2 r1
+  jump .L40
+.L45:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function keyindex */
+
+
+.text
+; function mapput
+.global mapput
+mapput:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -32 r14 r5
+  write -16 r14 r4
+  add r4 4 r1
+  read 0 r1 r3
+  write -24 r14 r3
+  shiftr r3 1 r1
+  read 0 r4 r2
+  bge r1 r2 .L63
+  add r4 8 r1
+  read 0 r1 r1
+  write -12 r14 r1
+  add r4 12 r1
+  read 0 r1 r1
+  write -28 r14 r1
+  add r4 4 r1
+  shiftl r3 1 r5
+  write 0 r1 r5
+  load 12 r6
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump xreallocarray
+  read -16 r14 r4
+  add r4 8 r2
+  write 0 r2 r1
+  add r4 4 r1
+  read 0 r1 r5
+  load 4 r6
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump xreallocarray
+  or r0 r1 r5
+  read -28 r14 r4
+  read -12 r14 r1
+  read -24 r14 r3
+  or r0 r4 r2
+  read -16 r14 r4
+  add r4 12 r6
+  write 0 r6 r5
+  load 0 r5
+  or r0 r2 r12
+  or r0 r5 r2
+  or r0 r12 r5
+.L51:
+  add r4 4 r6
+  read 0 r6 r6
+  bge r2 r6 .L54
+  add r4 8 r6
+  read 0 r6 r6
+  load 12 r7
+  mults r2 r7 r7
+  add r6 r7 r6
+  add r6 4 r7
+  load 0 r6
+  write 0 r7 r6
+  add r2 1 r2
+  jump .L51
+.L54:
+  or r0 r5 r2
+  load 0 r5
+  or r0 r2 r12
+  or r0 r5 r2
+  or r0 r12 r5
+.L57:
+  write -20 r14 r2
+  bge r2 r3 .L61
+  load 12 r6
+  mults r2 r6 r6
+  add r1 r6 r6
+  add r6 4 r6
+  read 0 r6 r6
+  beq r6 r0 .L60
+  load 12 r3
+  mults r2 r3 r2
+  add r1 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump keyindex
+  or r0 r1 r7
+  read -20 r14 r2
+  read -12 r14 r1
+  read -16 r14 r4
+  load 12 r3
+  mults r2 r3 r3
+  add r1 r3 r5
+  add r4 8 r3
+  read 0 r3 r3
+  load 12 r6
+  mults r7 r6 r6
+  add r3 r6 r3
+  read 0 r5 r6
+  write 0 r3 r6
+  add r5 4 r5
+  add r3 4 r6
+  read 0 r5 r3
+  write 0 r6 r3
+  read -24 r14 r3
+  add r5 4 r5
+  add r6 4 r6
+  read 0 r5 r5
+  write 0 r6 r5
+  read -28 r14 r5
+  shiftl r2 2 r6
+  add r5 r6 r5
+  read 0 r5 r6
+  add r4 12 r5
+  read 0 r5 r5
+  shiftl r7 2 r7
+  add r5 r7 r7
+  read -28 r14 r5
+  write 0 r7 r6
+.L60:
+  add r2 1 r2
+  jump .L57
+.L61:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -32 r14 r5
+  read -16 r14 r4
+.L63:
+  savpc r15
+  add r15 12 r15
+  jump keyindex
+  or r0 r1 r2
+  read -32 r14 r5
+  read -16 r14 r4
+  add r4 8 r1
+  read 0 r1 r1
+  load 12 r3
+  mults r2 r3 r3
+  add r1 r3 r3
+  add r3 4 r3
+  read 0 r3 r3
+  bne r3 r0 .L65
+  load 12 r3
+  mults r2 r3 r3
+  add r1 r3 r3
+  read 0 r5 r1
+  write 0 r3 r1
+  add r5 4 r1
+  add r3 4 r3
+  read 0 r1 r5
+  write 0 r3 r5
+  add r1 4 r1
+  add r3 4 r3
+  read 0 r1 r1
+  write 0 r3 r1
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  load 0 r1
+  write 0 r3 r1
+  read 0 r4 r1
+  add r1 1 r1
+  write 0 r4 r1
+.L65:
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mapput */
+
+
+.text
+; function mapget
+.global mapget
+mapget:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump keyindex
+  or r0 r1 r2
+  read -16 r14 r4
+  add r4 8 r1
+  read 0 r1 r1
+  load 12 r3
+  mults r2 r3 r3
+  add r1 r3 r1
+  add r1 4 r1
+  read 0 r1 r1
+  bne r1 r0 .L71
+  load 0 r1
+  jump .L72
+.L71:
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+.L72:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mapget */
+
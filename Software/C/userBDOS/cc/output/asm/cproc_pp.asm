@@ -0,0 +1,3307 @@
+
+.text
+; function ppinit
+.global ppinit
+ppinit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 64 r5
+  addr2reg macros r4
+  savpc r15
+  add r15 12 r15
+  jump mapinit
+  savpc r15
+  add r15 12 r15
+  jump next
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ppinit */
+
+
+.text
+; function macroequal
+macroequal:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -32 r14 r5
+  write -24 r14 r4
+  read 0 r4 r1
+  read 0 r5 r2
+  bne r1 r2 .L31
+  load 1 r2
+  bne r1 r2 .L16
+  add r4 16 r1
+  read 0 r1 r1
+  add r5 16 r2
+  read 0 r2 r2
+  bne r1 r2 .L30
+  add r4 12 r1
+  read 0 r1 r1
+  add r5 12 r2
+  read 0 r2 r2
+.L9:
+  write -28 r14 r1
+  write -20 r14 r2
+  add r4 12 r3
+  read 0 r3 r3
+  add r4 16 r4
+  read 0 r4 r4
+  shiftl r4 3 r4
+  add r3 r4 r3
+  bge r1 r3 .L15
+  read 0 r1 r4
+  read 0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r5
+  read -28 r14 r1
+  read -20 r14 r2
+  read -24 r14 r4
+  load 1 r3
+  bne r5 r0 .L12
+  add r1 4 r3
+  read 0 r3 r3
+  add r2 4 r5
+  read 0 r5 r5
+  xor r3 r5 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L12:
+  bne r3 r0 .L14
+  add r1 8 r1
+  add r2 8 r2
+  jump .L9
+.L14:
+  load 0 r1
+  jump .L32
+.L15:
+  read -32 r14 r5
+  read -24 r14 r4
+.L16:
+  add r4 28 r1
+  read 0 r1 r1
+  add r5 28 r2
+  read 0 r2 r2
+  bne r1 r2 .L29
+  add r4 24 r1
+  read 0 r1 r1
+  add r5 24 r2
+  read 0 r2 r2
+.L18:
+  write -16 r14 r1
+  write -12 r14 r2
+  add r4 24 r3
+  read 0 r3 r3
+  add r4 28 r5
+  read 0 r5 r5
+  load 24 r6
+  mults r5 r6 r5
+  add r3 r5 r3
+  bge r1 r3 .L28
+  read 0 r1 r3
+  read 0 r2 r5
+  bne r3 r5 .L27
+  add r1 20 r3
+  read 0 r3 r3
+  load 0 r5
+  bne r3 r0 .L22
+  or r0 r5 r3
+  jump .L24
+.L22:
+  or r0 r3 r4
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r1
+  read -12 r14 r2
+  read -24 r14 r4
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L24:
+  bne r3 r0 .L26
+  add r1 24 r1
+  add r2 24 r2
+  jump .L18
+.L26:
+  load 0 r1
+  jump .L32
+.L27:
+  load 0 r1
+  jump .L32
+.L28:
+  load 1 r1
+  jump .L32
+.L29:
+  load 0 r1
+  jump .L32
+.L30:
+  load 0 r1
+  jump .L32
+.L31:
+  load 0 r1
+.L32:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function macroequal */
+
+
+.text
+; function macroparam
+macroparam:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r5
+  write -12 r14 r4
+  read 0 r5 r1
+  load 4 r2
+  bne r1 r2 .L40
+  load 0 r1
+.L37:
+  write -16 r14 r1
+  add r4 16 r2
+  read 0 r2 r2
+  bge r1 r2 .L40
+  or r0 r1 r2
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r2 3 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  add r5 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+  beq r2 r0 .L41
+  add r1 1 r1
+  jump .L37
+.L40:
+  load32 -1 r1
+.L41:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function macroparam */
+
+
+.text
+; function macroget
+macroget:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  or r0 r4 r5
+  write -16 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -16 r14 r5
+  add r14 -28 r4
+  savpc r15
+  add r15 12 r15
+  jump mapkey
+  add r14 -28 r5
+  addr2reg macros r4
+  savpc r15
+  add r15 12 r15
+  jump mapget
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function macroget */
+
+
+.text
+; function macrodone
+macrodone:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r4 8 r2
+  load 0 r1
+  writeb 0 r2 r1
+  read 0 r4 r2
+  load 0 r1
+  load 1 r3
+  bne r2 r3 .L50
+  add r4 16 r1
+  read 0 r1 r2
+  load 0 r1
+  sltu r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L50:
+  beq r1 r0 .L52
+  add r4 20 r1
+  read 0 r1 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r4
+  add r4 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+.L52:
+  addr2reg macrodepth r12
+  read 0 r12 r1
+  load 1 r2
+  sub r1 r2 r1
+  addr2reg macrodepth r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function macrodone */
+
+
+.text
+; function macrovarargs
+macrovarargs:
+  read 0 r4 r2
+  load 0 r1
+  load 1 r3
+  beq r2 r3 .L58
+  or r0 r1 r2
+  jump .L59
+.L58:
+  add r4 16 r1
+  read 0 r1 r2
+  load 0 r1
+  sltu r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L59:
+  load 0 r1
+  beq r2 r0 .L61
+  add r4 12 r1
+  read 0 r1 r1
+  add r4 16 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 3 r2
+  add r1 r2 r1
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 4 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L61:
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jumpr 0 r15
+
+/* end function macrovarargs */
+
+
+.text
+; function ctxpush
+ctxpush:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -4 r14 r7
+  write -8 r14 r6
+  write -12 r14 r5
+  write -16 r14 r4
+  load 12 r5
+  addr2reg ctx r4
+  savpc r15
+  add r15 12 r15
+  jump arrayadd
+  read -4 r14 r7
+  read -8 r14 r6
+  read -12 r14 r5
+  read -16 r14 r4
+  write 0 r1 r4
+  add r1 4 r2
+  write 0 r2 r5
+  add r1 8 r2
+  write 0 r2 r6
+  ble r5 r0 .L67
+  and r7 0xFF r2
+  add r4 0 r3
+  add r3 5 r3
+  writeb 0 r3 r2
+.L67:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ctxpush */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "t\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "BuildTools/cproc/pp.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "i != -1\000"
+/* end data */
+
+
+.text
+; function ctxnext
+ctxnext:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+.L70:
+  load 12 r5
+  addr2reg ctx r4
+  savpc r15
+  add r15 12 r15
+  jump arraylast
+  or r0 r1 r3
+  or r0 r3 r1
+.L72:
+  write -16 r14 r1
+  addr2reg ctx+4 r12
+  read 0 r12 r2
+  beq r2 r0 .L78
+  add r1 4 r3
+  read 0 r3 r3
+  bne r3 r0 .L77
+  add r1 8 r2
+  read 0 r2 r4
+  beq r4 r0 .L76
+  savpc r15
+  add r15 12 r15
+  jump macrodone
+  read -16 r14 r1
+.L76:
+  load 12 r2
+  sub r1 r2 r1
+  addr2reg ctx+4 r12
+  read 0 r12 r2
+  load 12 r3
+  sub r2 r3 r2
+  addr2reg ctx+4 r12
+  write 0 r12 r2
+  jump .L72
+.L77:
+  or r0 r1 r3
+  jump .L79
+.L78:
+  or r0 r1 r3
+.L79:
+  beq r2 r0 .L104
+  add r3 8 r1
+  read 0 r1 r2
+  write -32 r14 r2
+  load 0 r1
+  beq r2 r0 .L82
+  read 0 r2 r1
+  xor r1 1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L82:
+  beq r1 r0 .L103
+  read 0 r3 r5
+  add r5 5 r1
+  readbu 0 r1 r1
+  write -28 r14 r1
+  read 0 r5 r1
+  load 111 r3
+  beq r1 r3 .L95
+  load 111 r3
+  bge r1 r3 .L94
+  load 4 r3
+  bne r1 r3 .L92
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump macroparam
+  read -16 r14 r3
+  read -32 r14 r2
+  load32 -1 r4
+  beq r1 r4 .L103
+  add r3 4 r5
+  read 0 r5 r4
+  load 1 r6
+  sub r4 r6 r4
+  write 0 r5 r4
+  read 0 r3 r4
+  add r4 24 r4
+  write 0 r3 r4
+  add r2 20 r2
+  read 0 r2 r2
+  shiftl r1 5 r3
+  add r2 r3 r3
+  add r3 4 r3
+  read 0 r3 r3
+  beq r3 r0 .L70
+  read -28 r14 r7
+  shiftl r1 5 r3
+  add r2 r3 r3
+  read 0 r3 r4
+  shiftl r1 5 r1
+  add r2 r1 r1
+  add r1 4 r1
+  read 0 r1 r5
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump ctxpush
+  or r0 r1 r3
+  jump .L103
+.L92:
+  read -16 r14 r3
+  load 4 r2
+  sltu r1 r2 r1
+  jump .L103
+.L94:
+  read -16 r14 r3
+  jump .L103
+.L95:
+  read -16 r14 r3
+  or r0 r2 r1
+  add r3 4 r4
+  read 0 r4 r2
+  load 1 r6
+  sub r2 r6 r2
+  write 0 r4 r2
+  add r5 24 r5
+  write -20 r14 r5
+  write 0 r3 r5
+  add r3 4 r4
+  load 1 r6
+  sub r2 r6 r2
+  write 0 r4 r2
+  add r5 24 r2
+  write 0 r3 r2
+  bne r5 r0 .L100
+  load 182 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -20 r14 r5
+  read -32 r14 r1
+.L100:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump macroparam
+  or r0 r1 r2
+  read -28 r14 r7
+  read -32 r14 r1
+  write -24 r14 r2
+  load32 -1 r3
+  bne r2 r3 .L102
+  load 184 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -24 r14 r2
+  read -28 r14 r7
+  read -32 r14 r1
+.L102:
+  add r1 20 r1
+  read 0 r1 r1
+  shiftl r2 5 r2
+  add r1 r2 r1
+  add r1 8 r4
+  load 0 r6
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump ctxpush
+  or r0 r1 r3
+.L103:
+  add r3 4 r2
+  read 0 r2 r1
+  load 1 r4
+  sub r1 r4 r1
+  write 0 r2 r1
+  read 0 r3 r1
+  add r1 24 r2
+  write 0 r3 r2
+  jump .L105
+.L104:
+  load 0 r1
+.L105:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ctxnext */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "after #define\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "after '...'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "or ')' after macro parameter\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "__VA_ARGS__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "of macro parameter name or '...'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "'##' operator is not yet implemented\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "__VA_ARGS__ can only be used in variadic function-like macros\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "after '#' operator\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "'%s' is not a macro parameter name\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "redefinition of macro '%s'\000"
+/* end data */
+
+
+.text
+; function define
+define:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 92 r13
+  load 0 r1
+  write -84 r14 r1
+  add r14 -84 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -84 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r1
+  write -72 r14 r1
+  add r14 -72 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -72 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 32 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  write -48 r14 r1
+  addr2reg .Lstring.14 r6
+  load 4 r5
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokencheck
+  read -48 r14 r2
+  add r2 4 r3
+  write 0 r3 r1
+  add r2 8 r2
+  load 0 r1
+  writeb 0 r2 r1
+  load 24 r5
+  add r14 -72 r4
+  savpc r15
+  add r15 12 r15
+  jump arrayadd
+  write -44 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+  read -44 r14 r1
+  read -48 r14 r2
+  read 0 r1 r4
+  load 0 r3
+  load 66 r5
+  bne r4 r5 .L110
+  add r1 5 r3
+  readbu 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L110:
+  bne r3 r0 .L112
+  load 0 r3
+  write 0 r2 r3
+  jump .L125
+.L112:
+  load 1 r1
+  write 0 r2 r1
+  load 0 r1
+  write -8 r14 r1
+.L114:
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+  read -8 r14 r1
+  addr2reg tok r12
+  read 0 r12 r2
+  load 67 r3
+  beq r2 r3 .L123
+  beq r1 r0 .L119
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 4 r1
+  beq r1 r0 .L118
+  addr2reg .Lstring.15 r6
+  load 67 r5
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokencheck
+.L118:
+  addr2reg .Lstring.16 r6
+  load 110 r5
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokencheck
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+.L119:
+  load 8 r5
+  add r14 -84 r4
+  savpc r15
+  add r15 12 r15
+  jump arrayadd
+  write -40 r14 r1
+  add r1 4 r3
+  load 0 r2
+  write 0 r3 r2
+  addr2reg tok r12
+  read 0 r12 r2
+  load 98 r3
+  beq r2 r3 .L121
+  addr2reg .Lstring.18 r6
+  load 4 r5
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokencheck
+  or r0 r1 r2
+  read -40 r14 r1
+  write 0 r1 r2
+  jump .L122
+.L121:
+  addr2reg .Lstring.17 r2
+  write 0 r1 r2
+  add r1 4 r3
+  load 4 r2
+  write 0 r3 r2
+.L122:
+  write -8 r14 r1
+  jump .L114
+.L123:
+  read -44 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+  read -44 r14 r1
+  read -48 r14 r2
+.L125:
+  read -84 r14 r3
+  add r2 12 r4
+  write 0 r4 r3
+  add r14 -84 r3
+  add r3 4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  add r2 16 r4
+  write 0 r4 r3
+  or r0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump macroparam
+  or r0 r1 r3
+  read -44 r14 r1
+  write -24 r14 r3
+.L127:
+  write -20 r14 r1
+  read 0 r1 r2
+  load 0 r3
+  load 2 r4
+  beq r2 r4 .L129
+  xor r2 1 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L129:
+  beq r3 r0 .L148
+  load 112 r3
+  bne r2 r3 .L132
+  add r1 8 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.19 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -20 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L132:
+  read 0 r1 r4
+  write -28 r14 r4
+  load 24 r5
+  add r14 -72 r4
+  savpc r15
+  add r15 12 r15
+  jump arrayadd
+  write -36 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+  read -24 r14 r3
+  read -36 r14 r1
+  read -48 r14 r2
+  read 0 r1 r5
+  load 0 r4
+  load 4 r6
+  beq r5 r6 .L134
+  or r0 r4 r5
+  jump .L135
+.L134:
+  add r1 20 r1
+  read 0 r1 r4
+  addr2reg .Lstring.17 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r4
+  read -24 r14 r3
+  read -36 r14 r1
+  read -48 r14 r2
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L135:
+  load 0 r4
+  beq r5 r0 .L137
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump macrovarargs
+  or r0 r1 r4
+  read -24 r14 r3
+  read -36 r14 r1
+  read -48 r14 r2
+  and r4 0xFF r4
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L137:
+  beq r4 r0 .L139
+  add r1 8 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.20 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -24 r14 r3
+  read -36 r14 r1
+  read -48 r14 r2
+  load32 -24 r4
+  sub r13 r4 r13
+.L139:
+  read 0 r2 r4
+  load 1 r5
+  bne r4 r5 .L147
+  load32 -1 r4
+  beq r3 r4 .L142
+  or r0 r3 r4
+  add r2 12 r3
+  read 0 r3 r3
+  shiftl r4 3 r4
+  add r3 r4 r3
+  add r3 4 r4
+  read 0 r4 r3
+  or r3 1 r3
+  write 0 r4 r3
+.L142:
+  or r0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump macroparam
+  or r0 r1 r3
+  read -36 r14 r1
+  read -28 r14 r4
+  read -48 r14 r2
+  write -32 r14 r3
+  load 111 r5
+  bne r4 r5 .L146
+  addr2reg .Lstring.21 r6
+  load 4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tokencheck
+  read -32 r14 r3
+  read -36 r14 r1
+  read -48 r14 r2
+  load32 -1 r4
+  bne r3 r4 .L145
+  add r1 8 r4
+  add r1 20 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.22 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -32 r14 r3
+  read -36 r14 r1
+  read -48 r14 r2
+  load32 -24 r4
+  sub r13 r4 r13
+.L145:
+  or r0 r3 r4
+  add r2 12 r3
+  read 0 r3 r3
+  shiftl r4 3 r4
+  add r3 r4 r3
+  add r3 4 r4
+  read 0 r4 r3
+  or r3 2 r3
+  write 0 r4 r3
+  load32 -1 r3
+.L146:
+  write -24 r14 r3
+  jump .L127
+.L147:
+  write -24 r14 r3
+  jump .L127
+.L148:
+  read -48 r14 r2
+  read -72 r14 r3
+  add r2 24 r4
+  write 0 r4 r3
+  add r14 -72 r3
+  add r3 4 r3
+  read 0 r3 r3
+  load32 -1431655765 r4
+  multuhi r3 r4 r3
+  shiftr r3 4 r3
+  load 1 r4
+  sub r3 r4 r3
+  add r2 28 r4
+  write 0 r4 r3
+  read 0 r1 r3
+  addr2reg tok r12
+  write 0 r12 r3
+  add r1 4 r1
+  read 0 r1 r3
+  addr2reg tok+4 r12
+  write 0 r12 r3
+  add r1 4 r1
+  read 0 r1 r3
+  addr2reg tok+8 r12
+  write 0 r12 r3
+  add r1 4 r1
+  read 0 r1 r3
+  addr2reg tok+12 r12
+  write 0 r12 r3
+  add r1 4 r1
+  read 0 r1 r3
+  addr2reg tok+16 r12
+  write 0 r12 r3
+  add r1 4 r1
+  read 0 r1 r1
+  addr2reg tok+20 r12
+  write 0 r12 r1
+  add r2 4 r1
+  read 0 r1 r5
+  write -12 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -12 r14 r5
+  add r14 -60 r4
+  savpc r15
+  add r15 12 r15
+  jump mapkey
+  add r14 -60 r5
+  addr2reg macros r4
+  savpc r15
+  add r15 12 r15
+  jump mapput
+  read -48 r14 r2
+  write -16 r14 r1
+  read 0 r1 r5
+  load 0 r3
+  beq r5 r0 .L151
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump macroequal
+  or r0 r1 r3
+  read -16 r14 r1
+  read -48 r14 r2
+  and r3 0xFF r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L151:
+  beq r3 r0 .L153
+  add r2 4 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.23 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r1
+  read -48 r14 r2
+  load32 -24 r3
+  sub r13 r3 r13
+.L153:
+  write 0 r1 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function define */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "after #undef\000"
+/* end data */
+
+
+.text
+; function undef
+undef:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  addr2reg .Lstring.25 r6
+  load 4 r5
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokencheck
+  or r0 r1 r4
+  write -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -8 r14 r4
+  or r0 r4 r5
+  add r14 -28 r4
+  savpc r15
+  add r15 12 r15
+  jump mapkey
+  add r14 -28 r5
+  addr2reg macros r4
+  savpc r15
+  add r15 12 r15
+  jump mapput
+  or r0 r1 r2
+  read -8 r14 r4
+  write -16 r14 r2
+  read 0 r2 r1
+  write -12 r14 r1
+  beq r1 r0 .L159
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -12 r14 r1
+  add r1 12 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -12 r14 r1
+  add r1 24 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r2
+  load 0 r1
+  write 0 r2 r1
+.L159:
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function undef */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "newline, or number after '#'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "if\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "#if directive is not implemented\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "ifdef\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "#ifdef directive is not implemented\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "ifndef\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "#ifndef directive is not implemented\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "elif\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "#elif directive is not implemented\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "endif\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "#endif directive is not implemented\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "include\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.39:
+	.ascii "#include directive is not implemented\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "define\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.41:
+	.ascii "undef\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "line\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "after #line\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.44:
+	.ascii "error\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.45:
+	.ascii "#error directive is not implemented\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.46:
+	.ascii "pragma\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.47:
+	.ascii "invalid preprocessor directive #%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.48:
+	.ascii "after preprocessing directive\000"
+/* end data */
+
+
+.text
+; function directive
+directive:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 48 r13
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+  addr2reg tok r12
+  read 0 r12 r1
+  load 2 r2
+  beq r1 r2 .L202
+  addr2reg ppflags r12
+  read 0 r12 r1
+  write -16 r14 r1
+  or r1 1 r1
+  addr2reg ppflags r12
+  write 0 r12 r1
+  addr2reg tok r12
+  read 0 r12 r1
+  load 5 r2
+  beq r1 r2 .L194
+  addr2reg .Lstring.27 r6
+  load 4 r5
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokencheck
+  or r0 r1 r4
+  write -8 r14 r4
+  addr2reg .Lstring.28 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -8 r14 r4
+  beq r1 r0 .L193
+  addr2reg .Lstring.30 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -8 r14 r4
+  beq r1 r0 .L192
+  addr2reg .Lstring.32 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -8 r14 r4
+  beq r1 r0 .L191
+  addr2reg .Lstring.34 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -8 r14 r4
+  beq r1 r0 .L190
+  addr2reg .Lstring.36 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -8 r14 r4
+  beq r1 r0 .L189
+  addr2reg .Lstring.38 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -8 r14 r4
+  beq r1 r0 .L188
+  addr2reg .Lstring.40 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -8 r14 r4
+  beq r1 r0 .L187
+  addr2reg .Lstring.41 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -8 r14 r4
+  beq r1 r0 .L186
+  addr2reg .Lstring.42 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -8 r14 r4
+  beq r1 r0 .L184
+  addr2reg .Lstring.44 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -8 r14 r4
+  beq r1 r0 .L183
+  addr2reg .Lstring.46 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  read -8 r14 r4
+  bne r1 r0 .L182
+.L176:
+  addr2reg tok r12
+  read 0 r12 r1
+  load 0 r2
+  load 2 r3
+  bne r1 r3 .L178
+  or r0 r2 r1
+  jump .L179
+.L178:
+  xor r1 1 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L179:
+  beq r1 r0 .L181
+  savpc r15
+  add r15 12 r15
+  jump next
+  jump .L176
+.L181:
+  read -8 r14 r4
+  jump .L201
+.L182:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r4 r6
+  addr2reg .Lstring.47 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L201
+.L183:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.45 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L201
+.L184:
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+  addr2reg .Lstring.43 r6
+  load 5 r5
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokencheck
+  read -8 r14 r4
+  write -12 r14 r4
+  jump .L196
+.L186:
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+  savpc r15
+  add r15 12 r15
+  jump undef
+  read -8 r14 r4
+  jump .L201
+.L187:
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+  savpc r15
+  add r15 12 r15
+  jump define
+  read -8 r14 r4
+  jump .L201
+.L188:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.39 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L201
+.L189:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.37 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L201
+.L190:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.35 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L201
+.L191:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.33 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L201
+.L192:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.31 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L201
+.L193:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.29 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -8 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L201
+.L194:
+  load 0 r1
+  write -12 r14 r1
+.L196:
+  addr2reg tok+20 r12
+  read 0 r12 r4
+  load 0 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump strtoull
+  add r14 -28 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -28 r1
+  add r1 8 r2
+  load 1 r1
+  write 0 r2 r1
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+  addr2reg tok+8 r12
+  read 0 r12 r1
+  write -28 r14 r1
+  addr2reg tok r12
+  read 0 r12 r1
+  load 7 r2
+  bne r1 r2 .L198
+  addr2reg tok+20 r12
+  read 0 r12 r4
+  load 34 r5
+  savpc r15
+  add r15 12 r15
+  jump strchr
+  add r1 1 r4
+  write -28 r14 r4
+  load 34 r5
+  savpc r15
+  add r15 12 r15
+  jump strchr
+  or r0 r1 r2
+  load 0 r1
+  writeb 0 r2 r1
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+.L198:
+  addr2reg tok r12
+  read 0 r12 r1
+  load 5 r2
+  bne r1 r2 .L200
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump scan
+  jump .L198
+.L200:
+  add r14 -40 r4
+  add r14 -28 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -40 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -28 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -40 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -28 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r14 -40 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump scansetloc
+  read -12 r14 r4
+.L201:
+  savpc r15
+  add r15 12 r15
+  jump free
+  addr2reg .Lstring.48 r6
+  load 2 r5
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokencheck
+  read -16 r14 r1
+  addr2reg ppflags r12
+  write 0 r12 r1
+.L202:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function directive */
+
+.data
+.balign 1
+.Lnewline.50:
+	.byte 1
+/* end data */
+
+
+.text
+; function nextinto
+nextinto:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+.L205:
+  savpc r15
+  add r15 12 r15
+  jump scan
+  read -16 r14 r4
+  addr2reg .Lnewline.50 r12
+  readbu 0 r12 r2
+  load 0 r1
+  beq r2 r0 .L207
+  read 0 r4 r1
+  xor r1 111 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L207:
+  beq r1 r0 .L209
+  savpc r15
+  add r15 12 r15
+  jump directive
+  read -16 r14 r4
+  jump .L205
+.L209:
+  addr2reg tok r12
+  read 0 r12 r1
+  xor r1 2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  addr2reg .Lnewline.50 r12
+  writeb 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function nextinto */
+
+.data
+.balign 4
+.Lpending.53:
+	.fill 12,1,0
+/* end data */
+
+
+.text
+; function peekparen
+peekparen:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  savpc r15
+  add r15 12 r15
+  jump ctxnext
+  bne r1 r0 .L220
+  load 0 r1
+  addr2reg .Lpending.53+4 r12
+  write 0 r12 r1
+.L215:
+  load 24 r5
+  addr2reg .Lpending.53 r4
+  savpc r15
+  add r15 12 r15
+  jump arrayadd
+  write -16 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump nextinto
+  read -16 r14 r1
+  read 0 r1 r1
+  load 2 r2
+  beq r1 r2 .L215
+  load 66 r2
+  beq r1 r2 .L219
+  addr2reg .Lpending.53 r12
+  read 0 r12 r4
+  addr2reg .Lpending.53+4 r12
+  read 0 r12 r1
+  load32 -1431655765 r2
+  multuhi r1 r2 r1
+  shiftr r1 4 r5
+  add r4 0 r1
+  add r1 5 r1
+  readbu 0 r1 r7
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump ctxpush
+  load 0 r1
+  jump .L223
+.L219:
+  load 1 r1
+  jump .L223
+.L220:
+  read 0 r1 r1
+  load 66 r2
+  beq r1 r2 .L222
+  load 12 r5
+  addr2reg ctx r4
+  savpc r15
+  add r15 12 r15
+  jump arraylast
+  read 0 r1 r2
+  load 24 r3
+  sub r2 r3 r2
+  write 0 r1 r2
+  add r1 4 r2
+  read 0 r2 r1
+  add r1 1 r1
+  write 0 r2 r1
+  load 0 r1
+  jump .L223
+.L222:
+  load 1 r1
+.L223:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function peekparen */
+
+.data
+.balign 1
+.Lstring.55:
+	.ascii " \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.56:
+	.ascii "\134\000"
+/* end data */
+
+
+.text
+; function stringize
+stringize:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -4 r14 r5
+  write -12 r14 r4
+  add r5 5 r1
+  readbu 0 r1 r2
+  load 1 r1
+  bne r2 r0 .L228
+  read 0 r5 r1
+  xor r1 2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L229
+.L228:
+  or r0 r1 r2
+.L229:
+  load 0 r1
+  bne r2 r0 .L231
+  or r0 r1 r2
+  jump .L232
+.L231:
+  add r4 4 r1
+  read 0 r1 r2
+  load 1 r1
+  sltu r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L232:
+  load 0 r1
+  beq r2 r0 .L234
+  read 0 r4 r1
+  add r4 4 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r2
+  add r1 r2 r1
+  readb 0 r1 r1
+  xor r1 32 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L234:
+  beq r1 r0 .L236
+  load 1 r6
+  addr2reg .Lstring.55 r5
+  savpc r15
+  add r15 12 r15
+  jump arrayaddbuf
+  read -4 r14 r5
+  read -12 r14 r4
+.L236:
+  add r5 20 r1
+  read 0 r1 r1
+  bne r1 r0 .L238
+  read 0 r5 r1
+  shiftl r1 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r1
+.L238:
+  write -8 r14 r1
+  read 0 r5 r2
+  load 1 r3
+  load 7 r5
+  beq r2 r5 .L240
+  xor r2 6 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L241
+.L240:
+  or r0 r3 r2
+.L241:
+  beq r2 r0 .L250
+.L242:
+  write -16 r14 r1
+  readb 0 r1 r2
+  beq r2 r0 .L252
+  load 1 r3
+  load 92 r5
+  beq r2 r5 .L245
+  xor r2 34 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L246
+.L245:
+  or r0 r3 r2
+.L246:
+  beq r2 r0 .L248
+  load 1 r6
+  addr2reg .Lstring.56 r5
+  savpc r15
+  add r15 12 r15
+  jump arrayaddbuf
+  read -16 r14 r1
+  read -12 r14 r4
+.L248:
+  load 1 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump arrayaddbuf
+  read -16 r14 r1
+  read -12 r14 r4
+  add r1 1 r1
+  jump .L242
+.L250:
+  beq r1 r0 .L252
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -8 r14 r1
+  read -12 r14 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump arrayaddbuf
+.L252:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function stringize */
+
+
+.text
+; function expand
+expand:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r4
+  read 0 r4 r1
+  load 4 r2
+  bne r1 r2 .L267
+  add r4 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump macroget
+  read -8 r14 r4
+  write -16 r14 r1
+  load 1 r2
+  beq r1 r0 .L258
+  add r1 8 r2
+  readbu 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L258:
+  beq r2 r0 .L260
+  add r4 4 r3
+  load 1 r2
+  writeb 0 r3 r2
+.L260:
+  add r4 4 r2
+  readbu 0 r2 r2
+  bne r2 r0 .L266
+  add r4 5 r2
+  readbu 0 r2 r7
+  write -12 r14 r7
+  read 0 r1 r2
+  load 1 r3
+  bne r2 r3 .L264
+  savpc r15
+  add r15 12 r15
+  jump peekparen
+  or r0 r1 r2
+  read -16 r14 r1
+  and r2 0xFF r2
+  beq r2 r0 .L265
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump expandfunc
+  read -12 r14 r7
+  read -16 r14 r1
+.L264:
+  add r1 24 r2
+  read 0 r2 r4
+  add r1 28 r2
+  read 0 r2 r5
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump ctxpush
+  read -16 r14 r1
+  add r1 8 r2
+  load 1 r1
+  writeb 0 r2 r1
+  addr2reg macrodepth r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg macrodepth r12
+  write 0 r12 r1
+  load 1 r1
+  jump .L268
+.L265:
+  load 0 r1
+  jump .L268
+.L266:
+  load 0 r1
+  jump .L268
+.L267:
+  load 0 r1
+.L268:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function expand */
+
+.data
+.balign 1
+.Lstring.59:
+	.ascii "\042\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.60:
+	.ascii "EOF when reading macro parameters\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.61:
+	.ascii "not enough arguments for macro '%s'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.62:
+	.ascii "too many arguments for macro '%s'\000"
+/* end data */
+
+
+.text
+; function expandfunc
+expandfunc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 96 r13
+  or r0 r4 r2
+  write -60 r14 r2
+  addr2reg macrodepth r12
+  read 0 r12 r3
+  write -4 r14 r3
+  load 0 r1
+  write -76 r14 r1
+  add r14 -76 r1
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r3
+  load 0 r1
+  write 0 r3 r1
+  add r2 16 r1
+  read 0 r1 r5
+  load 32 r6
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump xreallocarray
+  write -64 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump ctxnext
+  read -64 r14 r6
+  read -4 r14 r3
+  read -60 r14 r2
+  bne r1 r0 .L274
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump nextinto
+  read -64 r14 r6
+  read -4 r14 r3
+  read -60 r14 r2
+  addr2reg tok r1
+.L274:
+  load 0 r5
+  load 0 r4
+.L275:
+  write -44 r14 r5
+  write -8 r14 r3
+  write -12 r14 r4
+  write -16 r14 r1
+  add r2 16 r7
+  read 0 r7 r7
+  bge r5 r7 .L317
+  add r2 12 r2
+  read 0 r2 r2
+  shiftl r5 3 r7
+  add r2 r7 r2
+  write -36 r14 r2
+  add r2 4 r7
+  read 0 r7 r7
+  and r7 2 r7
+  beq r7 r0 .L278
+  load 0 r1
+  write -88 r14 r1
+  add r14 -88 r1
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  load 1 r6
+  addr2reg .Lstring.59 r5
+  add r14 -88 r4
+  savpc r15
+  add r15 12 r15
+  jump arrayaddbuf
+  read -44 r14 r5
+  read -8 r14 r3
+  read -12 r14 r2
+  read -16 r14 r1
+  or r0 r2 r4
+  read -36 r14 r2
+  read -64 r14 r6
+.L278:
+  shiftl r5 5 r5
+  add r6 r5 r5
+  add r5 4 r6
+  load 0 r5
+  write 0 r6 r5
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  or r0 r4 r12
+  or r0 r2 r4
+  or r0 r12 r2
+.L280:
+  write -20 r14 r3
+  write -52 r14 r2
+  write -40 r14 r4
+  read 0 r4 r5
+  load 1 r6
+  bne r5 r6 .L283
+  add r4 8 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.60 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -20 r14 r3
+  read -52 r14 r2
+  read -40 r14 r4
+  read -36 r14 r1
+  load32 -24 r5
+  sub r13 r5 r13
+.L283:
+  or r0 r3 r5
+  addr2reg macrodepth r12
+  read 0 r12 r3
+  write -48 r14 r3
+  ble r3 r5 .L285
+  write -28 r14 r5
+  write -32 r14 r2
+  jump .L302
+.L285:
+  load 0 r5
+  bne r2 r0 .L291
+  read 0 r4 r6
+  load 1 r5
+  load 67 r7
+  beq r6 r7 .L290
+  load 0 r5
+  load 110 r7
+  bne r6 r7 .L289
+  add r1 4 r5
+  read 0 r5 r5
+  and r5 4 r5
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L289:
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L290:
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L291:
+  bne r5 r0 .L308
+  read 0 r4 r5
+  load 67 r6
+  beq r5 r6 .L298
+  load 67 r6
+  bge r5 r6 .L299
+  load 66 r6
+  beq r5 r6 .L297
+  load 66 r6
+  sltu r5 r6 r5
+  jump .L299
+.L297:
+  add r2 1 r2
+  jump .L299
+.L298:
+  load 1 r5
+  sub r2 r5 r2
+.L299:
+  write -24 r14 r2
+  add r1 4 r5
+  read 0 r5 r5
+  and r5 2 r5
+  beq r5 r0 .L301
+  or r0 r4 r5
+  add r14 -88 r4
+  savpc r15
+  add r15 12 r15
+  jump stringize
+  read -24 r14 r2
+  read -40 r14 r4
+  read -48 r14 r3
+  read -36 r14 r1
+.L301:
+  write -28 r14 r3
+  write -32 r14 r2
+.L302:
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 1 r2
+  load 0 r1
+  beq r2 r0 .L304
+  savpc r15
+  add r15 12 r15
+  jump expand
+  read -40 r14 r4
+  and r1 0xFF r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L304:
+  beq r1 r0 .L306
+  load 24 r6
+  or r0 r4 r5
+  add r14 -76 r4
+  savpc r15
+  add r15 12 r15
+  jump arrayaddbuf
+  read -44 r14 r5
+  read -64 r14 r6
+  shiftl r5 5 r1
+  add r6 r1 r1
+  add r1 4 r2
+  read 0 r2 r1
+  add r1 1 r1
+  write 0 r2 r1
+.L306:
+  savpc r15
+  add r15 12 r15
+  jump ctxnext
+  or r0 r1 r4
+  read -28 r14 r3
+  read -32 r14 r2
+  read -44 r14 r5
+  read -36 r14 r1
+  read -64 r14 r6
+  bne r4 r0 .L280
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump nextinto
+  read -28 r14 r3
+  read -32 r14 r2
+  read -44 r14 r5
+  read -36 r14 r1
+  read -64 r14 r6
+  addr2reg tok r4
+  jump .L280
+.L308:
+  or r0 r1 r2
+  or r0 r4 r1
+  add r2 4 r2
+  read 0 r2 r2
+  and r2 2 r2
+  beq r2 r0 .L311
+  load 2 r6
+  addr2reg .Lstring.59 r5
+  add r14 -88 r4
+  savpc r15
+  add r15 12 r15
+  jump arrayaddbuf
+  read -40 r14 r1
+  read -44 r14 r5
+  read -64 r14 r6
+  read -88 r14 r2
+  shiftl r5 5 r3
+  add r6 r3 r3
+  add r3 8 r3
+  load 7 r4
+  write 0 r3 r4
+  add r3 4 r3
+  load 0 r4
+  write 0 r3 r4
+  add r3 4 r3
+  load 0 r4
+  write 0 r3 r4
+  add r3 4 r3
+  load 0 r4
+  write 0 r3 r4
+  add r3 4 r3
+  load 0 r4
+  write 0 r3 r4
+  add r3 4 r3
+  write 0 r3 r2
+.L311:
+  or r0 r1 r4
+  read 0 r1 r1
+  load 67 r2
+  beq r1 r2 .L316
+  savpc r15
+  add r15 12 r15
+  jump ctxnext
+  read -52 r14 r2
+  read -44 r14 r5
+  read -48 r14 r3
+  read -64 r14 r6
+  read -60 r14 r4
+  bne r1 r0 .L314
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump nextinto
+  read -52 r14 r2
+  read -44 r14 r5
+  read -48 r14 r3
+  read -64 r14 r6
+  read -60 r14 r4
+  addr2reg tok r1
+.L314:
+  add r5 1 r5
+  or r0 r4 r12
+  or r0 r2 r4
+  or r0 r12 r2
+  jump .L275
+.L316:
+  or r0 r4 r1
+  read -44 r14 r5
+  read -64 r14 r6
+  read -60 r14 r2
+.L317:
+  write -56 r14 r1
+  add r5 1 r3
+  add r2 16 r4
+  read 0 r4 r4
+  bge r3 r4 .L319
+  add r1 8 r4
+  add r2 4 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.61 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -56 r14 r1
+  read -64 r14 r6
+  read -60 r14 r2
+  load32 -24 r3
+  sub r13 r3 r13
+.L319:
+  read 0 r1 r3
+  load 67 r4
+  beq r3 r4 .L321
+  add r1 8 r4
+  add r2 4 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.62 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -64 r14 r6
+  read -60 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L321:
+  read -76 r14 r1
+  load 0 r3
+  or r0 r2 r4
+  or r0 r3 r2
+.L323:
+  add r4 16 r3
+  read 0 r3 r3
+  bge r2 r3 .L326
+  shiftl r2 5 r3
+  add r6 r3 r3
+  write 0 r3 r1
+  shiftl r2 5 r3
+  add r6 r3 r3
+  add r3 4 r3
+  read 0 r3 r3
+  load 24 r5
+  mults r3 r5 r3
+  add r1 r3 r1
+  add r2 1 r2
+  jump .L323
+.L326:
+  or r0 r4 r2
+  add r2 20 r1
+  write 0 r1 r6
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function expandfunc */
+
+.data
+.balign 1
+.Lstring.65:
+	.ascii "_Alignas\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.66:
+	.ascii "_Alignof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.67:
+	.ascii "_Atomic\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.68:
+	.ascii "_Bool\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.69:
+	.ascii "_Complex\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.70:
+	.ascii "_Decimal128\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.71:
+	.ascii "_Decimal32\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.72:
+	.ascii "_Decimal64\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.73:
+	.ascii "_Generic\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.74:
+	.ascii "_Imaginary\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.75:
+	.ascii "_Noreturn\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.76:
+	.ascii "_Static_assert\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.77:
+	.ascii "_Thread_local\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.78:
+	.ascii "__alignof__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.79:
+	.ascii "__asm\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.80:
+	.ascii "__asm__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.81:
+	.ascii "__attribute__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.82:
+	.ascii "__inline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.83:
+	.ascii "__inline__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.84:
+	.ascii "__signed\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.85:
+	.ascii "__signed__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.86:
+	.ascii "__thread\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.87:
+	.ascii "__typeof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.88:
+	.ascii "__typeof__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.89:
+	.ascii "__volatile__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.90:
+	.ascii "alignas\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.91:
+	.ascii "alignof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.92:
+	.ascii "auto\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.93:
+	.ascii "bool\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.94:
+	.ascii "break\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.95:
+	.ascii "case\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.96:
+	.ascii "char\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.97:
+	.ascii "const\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.98:
+	.ascii "constexpr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.99:
+	.ascii "continue\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.100:
+	.ascii "default\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.101:
+	.ascii "do\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.102:
+	.ascii "double\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.103:
+	.ascii "else\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.104:
+	.ascii "enum\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.105:
+	.ascii "extern\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.106:
+	.ascii "false\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.107:
+	.ascii "float\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.108:
+	.ascii "for\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.109:
+	.ascii "goto\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.110:
+	.ascii "inline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.111:
+	.ascii "int\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.112:
+	.ascii "long\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.113:
+	.ascii "nullptr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.114:
+	.ascii "register\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.115:
+	.ascii "restrict\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.116:
+	.ascii "return\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.117:
+	.ascii "short\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.118:
+	.ascii "signed\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.119:
+	.ascii "sizeof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.120:
+	.ascii "static\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.121:
+	.ascii "static_assert\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.122:
+	.ascii "struct\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.123:
+	.ascii "switch\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.124:
+	.ascii "thread_local\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.125:
+	.ascii "true\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.126:
+	.ascii "typedef\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.127:
+	.ascii "typeof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.128:
+	.ascii "typeof_unqual\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.129:
+	.ascii "union\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.130:
+	.ascii "unsigned\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.131:
+	.ascii "void\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.132:
+	.ascii "volatile\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.133:
+	.ascii "while\000"
+/* end data */
+
+.data
+.balign 4
+.Lkeywords.64:
+	.int .Lstring.65+0
+	.int 8
+	.int .Lstring.66+0
+	.int 9
+	.int .Lstring.67+0
+	.int 53
+	.int .Lstring.68+0
+	.int 11
+	.int .Lstring.69+0
+	.int 55
+	.int .Lstring.70+0
+	.int 56
+	.int .Lstring.71+0
+	.int 57
+	.int .Lstring.72+0
+	.int 58
+	.int .Lstring.73+0
+	.int 59
+	.int .Lstring.74+0
+	.int 60
+	.int .Lstring.75+0
+	.int 61
+	.int .Lstring.76+0
+	.int 40
+	.int .Lstring.77+0
+	.int 43
+	.int .Lstring.78+0
+	.int 9
+	.int .Lstring.79+0
+	.int 62
+	.int .Lstring.80+0
+	.int 62
+	.int .Lstring.81+0
+	.int 63
+	.int .Lstring.82+0
+	.int 29
+	.int .Lstring.83+0
+	.int 29
+	.int .Lstring.84+0
+	.int 37
+	.int .Lstring.85+0
+	.int 37
+	.int .Lstring.86+0
+	.int 43
+	.int .Lstring.87+0
+	.int 46
+	.int .Lstring.88+0
+	.int 46
+	.int .Lstring.89+0
+	.int 51
+	.int .Lstring.90+0
+	.int 8
+	.int .Lstring.91+0
+	.int 9
+	.int .Lstring.92+0
+	.int 10
+	.int .Lstring.93+0
+	.int 11
+	.int .Lstring.94+0
+	.int 12
+	.int .Lstring.95+0
+	.int 13
+	.int .Lstring.96+0
+	.int 14
+	.int .Lstring.97+0
+	.int 15
+	.int .Lstring.98+0
+	.int 16
+	.int .Lstring.99+0
+	.int 17
+	.int .Lstring.100+0
+	.int 18
+	.int .Lstring.101+0
+	.int 19
+	.int .Lstring.102+0
+	.int 20
+	.int .Lstring.103+0
+	.int 21
+	.int .Lstring.104+0
+	.int 22
+	.int .Lstring.105+0
+	.int 23
+	.int .Lstring.106+0
+	.int 24
+	.int .Lstring.107+0
+	.int 25
+	.int .Lstring.108+0
+	.int 26
+	.int .Lstring.109+0
+	.int 27
+	.int .Lstring.28+0
+	.int 28
+	.int .Lstring.110+0
+	.int 29
+	.int .Lstring.111+0
+	.int 30
+	.int .Lstring.112+0
+	.int 31
+	.int .Lstring.113+0
+	.int 32
+	.int .Lstring.114+0
+	.int 33
+	.int .Lstring.115+0
+	.int 34
+	.int .Lstring.116+0
+	.int 35
+	.int .Lstring.117+0
+	.int 36
+	.int .Lstring.118+0
+	.int 37
+	.int .Lstring.119+0
+	.int 38
+	.int .Lstring.120+0
+	.int 39
+	.int .Lstring.121+0
+	.int 40
+	.int .Lstring.122+0
+	.int 41
+	.int .Lstring.123+0
+	.int 42
+	.int .Lstring.124+0
+	.int 43
+	.int .Lstring.125+0
+	.int 44
+	.int .Lstring.126+0
+	.int 45
+	.int .Lstring.127+0
+	.int 46
+	.int .Lstring.128+0
+	.int 47
+	.int .Lstring.129+0
+	.int 48
+	.int .Lstring.130+0
+	.int 49
+	.int .Lstring.131+0
+	.int 50
+	.int .Lstring.132+0
+	.int 51
+	.int .Lstring.133+0
+	.int 52
+/* end data */
+
+
+.text
+; function keyword
+keyword:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+  load 0 r2
+  load 70 r1
+.L332:
+  write -4 r14 r2
+  write -8 r14 r1
+  bge r2 r1 .L338
+  add r2 r1 r1
+  shiftr r1 1 r1
+  write -16 r14 r1
+  or r0 r1 r2
+  add r4 20 r1
+  read 0 r1 r4
+  shiftl r2 3 r2
+  addr2reg .Lkeywords.64 r1
+  add r1 r2 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r5
+  read -4 r14 r2
+  read -8 r14 r1
+  or r0 r2 r3
+  read -16 r14 r2
+  read -12 r14 r4
+  beq r5 r0 .L337
+  blts r5 r0 .L336
+  add r2 1 r2
+  jump .L332
+.L336:
+  or r0 r2 r1
+  or r0 r3 r2
+  jump .L332
+.L337:
+  add r4 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r1
+  read -12 r14 r4
+  shiftl r1 3 r2
+  addr2reg .Lkeywords.64 r1
+  add r1 r2 r1
+  add r1 4 r1
+  read 0 r1 r1
+  write 0 r4 r1
+  add r4 20 r2
+  load 0 r1
+  write 0 r2 r1
+.L338:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function keyword */
+
+
+.text
+; function next
+.global next
+next:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+.L341:
+  savpc r15
+  add r15 12 r15
+  jump ctxnext
+  bne r1 r0 .L343
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump nextinto
+  addr2reg tok r1
+.L343:
+  write -16 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump expand
+  or r0 r1 r2
+  read -16 r14 r1
+  and r2 0xFF r3
+  load 1 r2
+  bne r3 r0 .L348
+  read 0 r1 r3
+  load 0 r2
+  load 2 r4
+  bne r3 r4 .L347
+  addr2reg ppflags r12
+  read 0 r12 r2
+  and r2 1 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L347:
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L348:
+  bne r2 r0 .L341
+  or r0 r1 r2
+  read 0 r2 r1
+  addr2reg tok r12
+  write 0 r12 r1
+  add r2 4 r2
+  read 0 r2 r3
+  addr2reg tok+4 r12
+  write 0 r12 r3
+  add r2 4 r2
+  read 0 r2 r3
+  addr2reg tok+8 r12
+  write 0 r12 r3
+  add r2 4 r2
+  read 0 r2 r3
+  addr2reg tok+12 r12
+  write 0 r12 r3
+  add r2 4 r2
+  read 0 r2 r3
+  addr2reg tok+16 r12
+  write 0 r12 r3
+  add r2 4 r2
+  read 0 r2 r2
+  addr2reg tok+20 r12
+  write 0 r12 r2
+  load 4 r2
+  bne r1 r2 .L352
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump keyword
+.L352:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function next */
+
+.data
+.balign 4
+.Lpending.136:
+	.fill 24,1,0
+/* end data */
+
+
+.text
+; function peek
+.global peek
+peek:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -20 r14 r4
+  addr2reg tok r12
+  read 0 r12 r6
+  write -16 r14 r6
+  addr2reg tok+4 r12
+  read 0 r12 r5
+  write -12 r14 r5
+  addr2reg tok+8 r12
+  read 0 r12 r4
+  write -8 r14 r4
+  addr2reg tok+12 r12
+  read 0 r12 r3
+  write -4 r14 r3
+  addr2reg tok+16 r12
+  read 0 r12 r2
+  write -28 r14 r2
+  addr2reg tok+20 r12
+  read 0 r12 r1
+  write -24 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -4 r14 r3
+  read -8 r14 r4
+  read -12 r14 r5
+  read -16 r14 r6
+  read -20 r14 r1
+  addr2reg tok r12
+  read 0 r12 r7
+  xor r7 r1 r1
+  sltu r1 1 r1
+  write -32 r14 r1
+  read -24 r14 r1
+  read -28 r14 r2
+  read -32 r14 r12
+  bne r12 r0 .L357
+  addr2reg .Lpending.136 r12
+  write 0 r12 r7
+  addr2reg tok+4 r12
+  read 0 r12 r7
+  addr2reg .Lpending.136+4 r12
+  write 0 r12 r7
+  addr2reg tok+8 r12
+  read 0 r12 r7
+  addr2reg .Lpending.136+8 r12
+  write 0 r12 r7
+  addr2reg tok+12 r12
+  read 0 r12 r7
+  addr2reg .Lpending.136+12 r12
+  write 0 r12 r7
+  addr2reg tok+16 r12
+  read 0 r12 r7
+  addr2reg .Lpending.136+16 r12
+  write 0 r12 r7
+  addr2reg tok+20 r12
+  read 0 r12 r7
+  addr2reg .Lpending.136+20 r12
+  write 0 r12 r7
+  addr2reg tok r12
+  write 0 r12 r6
+  addr2reg tok+4 r12
+  write 0 r12 r5
+  addr2reg tok+8 r12
+  write 0 r12 r4
+  addr2reg tok+12 r12
+  write 0 r12 r3
+  addr2reg tok+16 r12
+  write 0 r12 r2
+  addr2reg tok+20 r12
+  write 0 r12 r1
+  addr2reg .Lpending.136+5 r12
+  readbu 0 r12 r7
+  load 0 r6
+  load 1 r5
+  addr2reg .Lpending.136 r4
+  savpc r15
+  add r15 12 r15
+  jump ctxpush
+  load 0 r1
+  jump .L358
+.L357:
+  savpc r15
+  add r15 12 r15
+  jump next
+  load 1 r1
+.L358:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function peek */
+
+
+.text
+; function expect
+.global expect
+expect:
+  or r0 r5 r6
+  or r0 r4 r5
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  addr2reg tok r4
+  savpc r15
+  add r15 12 r15
+  jump tokencheck
+  write -16 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -16 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function expect */
+
+
+.text
+; function consume
+.global consume
+consume:
+  addr2reg tok r12
+  read 0 r12 r1
+  bne r1 r4 .L367
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  savpc r15
+  add r15 12 r15
+  jump next
+  load 1 r1
+  jump .L368
+.L367:
+  load 0 r1
+  jumpr 0 r15
+.L368:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function consume */
+
+.data
+.balign 4
+.globl ppflags
+ppflags:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+ctx:
+	.fill 12,1,0
+/* end data */
+
+.data
+.balign 4
+macros:
+	.fill 16,1,0
+/* end data */
+
+.data
+.balign 4
+macrodepth:
+	.fill 4,1,0
+/* end data */
+
@@ -0,0 +1,9986 @@
+.data
+.balign 1
+.Lstring.2:
+	.ascii "multiple 'case' labels with same value\000"
+/* end data */
+
+
+.text
+; function switchcase
+.global switchcase
+switchcase:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r6
+  load 24 r6
+  savpc r15
+  add r15 12 r15
+  jump treeinsert
+  read -12 r14 r6
+  write -16 r14 r1
+  add r1 16 r2
+  readbu 0 r2 r2
+  bne r2 r0 .L3
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.2 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r1
+  read -12 r14 r6
+  load32 -24 r2
+  sub r13 r2 r13
+.L3:
+  add r1 20 r1
+  write 0 r1 r6
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function switchcase */
+
+.data
+.balign 4
+.Lid.4:
+	.fill 4,1,0
+/* end data */
+
+
+.text
+; function mkblock
+.global mkblock
+mkblock:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -16 r14 r4
+  load 7 r2
+  write 0 r1 r2
+  add r1 8 r2
+  write 0 r2 r4
+  addr2reg .Lid.4 r12
+  read 0 r12 r2
+  add r2 1 r2
+  addr2reg .Lid.4 r12
+  write 0 r12 r2
+  add r1 4 r3
+  write 0 r3 r2
+  add r1 12 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 56 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 56 r2
+  add r2 24 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 24 r2
+  add r2 20 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 84 r3
+  load 0 r2
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkblock */
+
+.data
+.balign 4
+.Lid.6:
+	.fill 4,1,0
+/* end data */
+
+
+.text
+; function mkglobal
+.global mkglobal
+mkglobal:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -16 r14 r4
+  load 1 r2
+  write 0 r1 r2
+  add r4 4 r2
+  read 0 r2 r3
+  load 0 r2
+  load 1 r5
+  bne r3 r5 .L13
+  add r4 36 r2
+  add r2 4 r2
+  read 0 r2 r2
+  xor r2 1 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L13:
+  beq r2 r0 .L15
+  load 17 r2
+  write 0 r1 r2
+.L15:
+  add r4 24 r2
+  read 0 r2 r2
+  bne r2 r0 .L20
+  read 0 r4 r2
+  add r1 8 r3
+  write 0 r3 r2
+  add r4 8 r2
+  read 0 r2 r2
+  beq r2 r0 .L18
+  load 0 r2
+  jump .L19
+.L18:
+  addr2reg .Lid.6 r12
+  read 0 r12 r2
+  add r2 1 r2
+  addr2reg .Lid.6 r12
+  write 0 r12 r2
+.L19:
+  add r1 4 r3
+  write 0 r3 r2
+  jump .L21
+.L20:
+  add r1 8 r3
+  write 0 r3 r2
+  add r1 4 r3
+  load 0 r2
+  write 0 r3 r2
+.L21:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkglobal */
+
+
+.text
+; function mkintconst
+.global mkintconst
+mkintconst:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -16 r14 r4
+  load 2 r2
+  write 0 r1 r2
+  add r1 8 r2
+  write 0 r2 r4
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkintconst */
+
+.data
+.balign 4
+.Lub.10:
+	.byte 119
+	.byte 98
+	.fill 2,1,0
+	.int 30
+	.int 22
+/* end data */
+
+.data
+.balign 4
+.Lsb.11:
+	.byte 119
+	.byte 98
+	.fill 2,1,0
+	.int 29
+	.int 22
+/* end data */
+
+.data
+.balign 4
+.Luh.12:
+	.byte 119
+	.byte 104
+	.fill 2,1,0
+	.int 28
+	.int 21
+/* end data */
+
+.data
+.balign 4
+.Lsh.13:
+	.byte 119
+	.byte 104
+	.fill 2,1,0
+	.int 27
+	.int 21
+/* end data */
+
+.data
+.balign 4
+.Lw.14:
+	.byte 119
+	.byte 119
+	.fill 2,1,0
+	.int 26
+	.int 20
+/* end data */
+
+.data
+.balign 4
+.Ll.15:
+	.byte 108
+	.byte 108
+	.fill 2,1,0
+	.int 25
+	.int 19
+/* end data */
+
+.data
+.balign 4
+.Ls.16:
+	.byte 115
+	.byte 115
+	.fill 2,1,0
+	.int 24
+	.int 18
+/* end data */
+
+.data
+.balign 4
+.Ld.17:
+	.byte 100
+	.byte 100
+	.fill 2,1,0
+	.int 23
+	.int 17
+/* end data */
+
+.data
+.balign 4
+.Lv.18:
+	.byte 0
+	.fill 11,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "long double is not yet supported\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "BuildTools/cproc/qbe.c\000"
+/* end data */
+
+
+.text
+; function qbetype
+qbetype:
+  addr2reg typevoid r1
+  beq r5 r1 .L57
+  add r5 4 r1
+  read 0 r1 r1
+  and r1 16 r2
+  beq r2 r0 .L53
+  add r5 12 r2
+  read 0 r2 r2
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 16 r3
+  beq r2 r3 .L51
+  load 16 r3
+  bge r2 r3 .L52
+  load 1 r3
+  sub r2 r3 r2
+  load 8 r3
+  bge r2 r3 .L52
+  shiftl r2 2 r3
+  addr2reg .Ljt34 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L35:
+  add r5 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L37
+  addr2reg .Lub.10 r1
+  jump .L38
+.L37:
+  addr2reg .Lsb.11 r1
+.L38:
+  add r1 0 r2
+  read 0 r2 r2
+  add r4 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r4 4 r3
+  write 0 r3 r2
+  add r1 8 r1
+  read 0 r1 r1
+  add r4 8 r2
+  write 0 r2 r1
+  jump .L58
+.L39:
+  add r5 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L41
+  addr2reg .Luh.12 r1
+  jump .L42
+.L41:
+  addr2reg .Lsh.13 r1
+.L42:
+  add r1 0 r2
+  read 0 r2 r2
+  add r4 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r4 4 r3
+  write 0 r3 r2
+  add r1 8 r1
+  read 0 r1 r1
+  add r4 8 r2
+  write 0 r2 r1
+  jump .L58
+.L43:
+  and r1 32 r1
+  bne r1 r0 .L45
+  addr2reg .Lw.14 r1
+  jump .L46
+.L45:
+  addr2reg .Ls.16 r1
+.L46:
+  add r1 0 r2
+  read 0 r2 r2
+  add r4 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r4 4 r3
+  write 0 r3 r2
+  add r1 8 r1
+  read 0 r1 r1
+  add r4 8 r2
+  write 0 r2 r1
+  jump .L58
+.L47:
+  and r1 32 r1
+  bne r1 r0 .L49
+  addr2reg .Ll.15 r1
+  jump .L50
+.L49:
+  addr2reg .Ld.17 r1
+.L50:
+  add r1 0 r2
+  read 0 r2 r2
+  add r4 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r4 4 r3
+  write 0 r3 r2
+  add r1 8 r1
+  read 0 r1 r1
+  add r4 8 r2
+  write 0 r2 r1
+  jump .L58
+.L51:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+.L52:
+  load 219 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  jump .L58
+.L53:
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 16 r1
+  read 0 r1 r1
+  load 4 r2
+  beq r1 r2 .L55
+  addr2reg .Ll.15 r1
+  jump .L56
+.L55:
+  addr2reg .Lw.14 r1
+.L56:
+  add r1 0 r2
+  read 0 r2 r2
+  add r4 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r4 4 r3
+  write 0 r3 r2
+  add r1 8 r1
+  read 0 r1 r1
+  add r4 8 r2
+  write 0 r2 r1
+  jumpr 0 r15
+.L57:
+  addr2reg .Lv.18 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r4 0 r2
+  write 0 r2 r1
+  addr2reg .Lv.18 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r4 4 r2
+  write 0 r2 r1
+  addr2reg .Lv.18 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r4 8 r2
+  write 0 r2 r1
+  jumpr 0 r15
+.L58:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt34:
+  .int .L35
+  .int .L39
+  .int .L52
+  .int .L43
+  .int .L52
+  .int .L52
+  .int .L52
+  .int .L47
+
+/* end function qbetype */
+
+
+.text
+; function functemp
+functemp:
+  load 5 r1
+  write 0 r5 r1
+  add r5 8 r2
+  load 0 r1
+  write 0 r2 r1
+  add r4 44 r2
+  read 0 r2 r1
+  add r1 1 r1
+  write 0 r2 r1
+  add r5 4 r2
+  write 0 r2 r1
+  jumpr 0 r15
+
+/* end function functemp */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "add\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "sub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "neg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "div\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "mul\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "multfp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "divfp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "udiv\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "rem\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "urem\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "or\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "xor\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "and\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "sar\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "shr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "shl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.39:
+	.ascii "stored\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "stores\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.41:
+	.ascii "storel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "storew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "storeh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.44:
+	.ascii "storeb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.45:
+	.ascii "loadd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.46:
+	.ascii "loads\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.47:
+	.ascii "loadl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.48:
+	.ascii "loadw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.49:
+	.ascii "loadsh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.50:
+	.ascii "loaduh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.51:
+	.ascii "loadsb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.52:
+	.ascii "loadub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.53:
+	.ascii "alloc4\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.54:
+	.ascii "alloc8\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.55:
+	.ascii "alloc16\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.56:
+	.ascii "ceqw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.57:
+	.ascii "cnew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.58:
+	.ascii "cslew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.59:
+	.ascii "csltw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.60:
+	.ascii "csgew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.61:
+	.ascii "csgtw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.62:
+	.ascii "culew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.63:
+	.ascii "cultw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.64:
+	.ascii "cugew\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.65:
+	.ascii "cugtw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.66:
+	.ascii "ceql\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.67:
+	.ascii "cnel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.68:
+	.ascii "cslel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.69:
+	.ascii "csltl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.70:
+	.ascii "csgel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.71:
+	.ascii "csgtl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.72:
+	.ascii "culel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.73:
+	.ascii "cultl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.74:
+	.ascii "cugel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.75:
+	.ascii "cugtl\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.76:
+	.ascii "ceqs\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.77:
+	.ascii "cnes\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.78:
+	.ascii "cles\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.79:
+	.ascii "clts\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.80:
+	.ascii "cges\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.81:
+	.ascii "cgts\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.82:
+	.ascii "cos\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.83:
+	.ascii "cuos\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.84:
+	.ascii "ceqd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.85:
+	.ascii "cned\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.86:
+	.ascii "cled\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.87:
+	.ascii "cltd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.88:
+	.ascii "cged\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.89:
+	.ascii "cgtd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.90:
+	.ascii "cod\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.91:
+	.ascii "cuod\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.92:
+	.ascii "extsw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.93:
+	.ascii "extuw\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.94:
+	.ascii "extsh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.95:
+	.ascii "extuh\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.96:
+	.ascii "extsb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.97:
+	.ascii "extub\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.98:
+	.ascii "exts\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.99:
+	.ascii "truncd\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.100:
+	.ascii "stosi\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.101:
+	.ascii "stoui\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.102:
+	.ascii "dtosi\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.103:
+	.ascii "dtoui\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.104:
+	.ascii "swtof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.105:
+	.ascii "uwtof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.106:
+	.ascii "sltof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.107:
+	.ascii "ultof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.108:
+	.ascii "cast\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.109:
+	.ascii "copy\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.110:
+	.ascii "call\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.111:
+	.ascii "vastart\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.112:
+	.ascii "vaarg\000"
+/* end data */
+
+.data
+.balign 4
+instname:
+	.fill 4,1,0
+	.int .Lstring.23+0
+	.int .Lstring.24+0
+	.int .Lstring.25+0
+	.int .Lstring.26+0
+	.int .Lstring.27+0
+	.int .Lstring.28+0
+	.int .Lstring.29+0
+	.int .Lstring.30+0
+	.int .Lstring.31+0
+	.int .Lstring.32+0
+	.int .Lstring.33+0
+	.int .Lstring.34+0
+	.int .Lstring.35+0
+	.int .Lstring.36+0
+	.int .Lstring.37+0
+	.int .Lstring.38+0
+	.int .Lstring.39+0
+	.int .Lstring.40+0
+	.int .Lstring.41+0
+	.int .Lstring.42+0
+	.int .Lstring.43+0
+	.int .Lstring.44+0
+	.int .Lstring.45+0
+	.int .Lstring.46+0
+	.int .Lstring.47+0
+	.int .Lstring.48+0
+	.int .Lstring.49+0
+	.int .Lstring.50+0
+	.int .Lstring.51+0
+	.int .Lstring.52+0
+	.int .Lstring.53+0
+	.int .Lstring.54+0
+	.int .Lstring.55+0
+	.int .Lstring.56+0
+	.int .Lstring.57+0
+	.int .Lstring.58+0
+	.int .Lstring.59+0
+	.int .Lstring.60+0
+	.int .Lstring.61+0
+	.int .Lstring.62+0
+	.int .Lstring.63+0
+	.int .Lstring.64+0
+	.int .Lstring.65+0
+	.int .Lstring.66+0
+	.int .Lstring.67+0
+	.int .Lstring.68+0
+	.int .Lstring.69+0
+	.int .Lstring.70+0
+	.int .Lstring.71+0
+	.int .Lstring.72+0
+	.int .Lstring.73+0
+	.int .Lstring.74+0
+	.int .Lstring.75+0
+	.int .Lstring.76+0
+	.int .Lstring.77+0
+	.int .Lstring.78+0
+	.int .Lstring.79+0
+	.int .Lstring.80+0
+	.int .Lstring.81+0
+	.int .Lstring.82+0
+	.int .Lstring.83+0
+	.int .Lstring.84+0
+	.int .Lstring.85+0
+	.int .Lstring.86+0
+	.int .Lstring.87+0
+	.int .Lstring.88+0
+	.int .Lstring.89+0
+	.int .Lstring.90+0
+	.int .Lstring.91+0
+	.int .Lstring.92+0
+	.int .Lstring.93+0
+	.int .Lstring.94+0
+	.int .Lstring.95+0
+	.int .Lstring.96+0
+	.int .Lstring.97+0
+	.int .Lstring.98+0
+	.int .Lstring.99+0
+	.int .Lstring.100+0
+	.int .Lstring.101+0
+	.int .Lstring.102+0
+	.int .Lstring.103+0
+	.int .Lstring.104+0
+	.int .Lstring.105+0
+	.int .Lstring.106+0
+	.int .Lstring.107+0
+	.int .Lstring.108+0
+	.int .Lstring.109+0
+	.int .Lstring.110+0
+	.int .Lstring.111+0
+	.int .Lstring.112+0
+/* end data */
+
+
+.text
+; function mkinst
+mkinst:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  read 8 r14 r3
+  write -12 r14 r3
+  write -16 r14 r7
+  write -24 r14 r6
+  write -28 r14 r5
+  write -20 r14 r4
+  load 28 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -12 r14 r3
+  read -16 r14 r6
+  read -24 r14 r5
+  read -28 r14 r2
+  read -20 r14 r4
+  write -32 r14 r1
+  write 0 r1 r2
+  add r1 4 r7
+  write 0 r7 r5
+  add r1 20 r7
+  add r7 0 r7
+  write 0 r7 r6
+  add r1 20 r6
+  add r6 4 r6
+  write 0 r6 r3
+  load 0 r3
+  bne r5 r0 .L67
+  or r0 r3 r2
+  jump .L68
+.L67:
+  xor r2 91 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L68:
+  bne r2 r0 .L70
+  add r1 8 r3
+  load 0 r2
+  write 0 r3 r2
+  jump .L71
+.L70:
+  add r1 8 r5
+  savpc r15
+  add r15 12 r15
+  jump functemp
+  read -32 r14 r1
+.L71:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkinst */
+
+.data
+.balign 1
+.Lstring.115:
+	.ascii "dead\000"
+/* end data */
+
+
+.text
+; function funcinst
+funcinst:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  read 8 r14 r1
+  write -12 r14 r1
+  or r0 r4 r2
+  write -16 r14 r7
+  write -20 r14 r6
+  write -24 r14 r5
+  write -28 r14 r2
+  add r2 24 r3
+  read 0 r3 r3
+  add r3 56 r3
+  read 0 r3 r3
+  beq r3 r0 .L76
+  addr2reg .Lstring.115 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  or r0 r1 r5
+  read -28 r14 r2
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -12 r14 r1
+  read -16 r14 r7
+  read -20 r14 r6
+  read -24 r14 r5
+  read -28 r14 r2
+.L76:
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r1
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump mkinst
+  read -28 r14 r2
+  write -32 r14 r1
+  load32 -12 r3
+  sub r13 r3 r13
+  add r2 24 r2
+  read 0 r2 r2
+  add r2 12 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump arrayaddptr
+  read -32 r14 r1
+  add r1 8 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function funcinst */
+
+.data
+.balign 1
+.Lstring.117:
+	.ascii "internal error; unsupported conversion\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.118:
+	.ascii "internal error; unknown integer conversion\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.119:
+	.ascii "src->prop & PROPFLOAT\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.120:
+	.ascii "internal error; unknown floating point conversion\000"
+/* end data */
+
+
+.text
+; function convert
+convert:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -20 r14 r7
+  write -32 r14 r4
+  read 0 r6 r1
+  load 12 r2
+  bne r1 r2 .L83
+  addr2reg typeulong r1
+  or r0 r1 r6
+.L83:
+  write -24 r14 r6
+  read 0 r5 r1
+  load 12 r2
+  bne r1 r2 .L86
+  addr2reg typeulong r1
+  or r0 r1 r5
+.L86:
+  write -12 r14 r5
+  read 0 r5 r1
+  load 1 r2
+  beq r1 r2 .L182
+  add r6 4 r1
+  read 0 r1 r1
+  and r1 4 r2
+  load 1 r1
+  beq r2 r0 .L89
+  add r5 4 r1
+  read 0 r1 r1
+  and r1 4 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L89:
+  beq r1 r0 .L91
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.117 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -12 r14 r5
+  read -24 r14 r6
+  read -20 r14 r7
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L91:
+  read 0 r5 r1
+  load 2 r2
+  beq r1 r2 .L155
+  add r5 4 r1
+  read 0 r1 r1
+  and r1 2 r1
+  bne r1 r0 .L117
+  add r5 12 r1
+  read 0 r1 r1
+  load 8 r2
+  beq r1 r2 .L95
+  load 115 r1
+  jump .L96
+.L95:
+  load 100 r1
+.L96:
+  write -8 r14 r1
+  add r6 4 r2
+  read 0 r2 r2
+  and r2 2 r3
+  bne r3 r0 .L107
+  and r2 32 r2
+  bne r2 r0 .L99
+  load 339 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.119 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r5
+  read -24 r14 r6
+  or r0 r6 r1
+  read -8 r14 r6
+  read -20 r14 r7
+  read -32 r14 r4
+  jump .L100
+.L99:
+  or r0 r6 r12
+  or r0 r1 r6
+  or r0 r12 r1
+.L100:
+  add r1 12 r2
+  read 0 r2 r2
+  add r5 12 r3
+  read 0 r3 r3
+  write -16 r14 r3
+  beq r2 r3 .L106
+  or r0 r2 r1
+  read -16 r14 r2
+  blt r1 r2 .L104
+  load 77 r1
+  jump .L105
+.L104:
+  load 76 r1
+.L105:
+  or r0 r1 r5
+  jump .L153
+.L106:
+  or r0 r7 r1
+  jump .L183
+.L107:
+  or r0 r6 r12
+  or r0 r1 r6
+  or r0 r12 r1
+  add r1 40 r2
+  readbu 0 r2 r2
+  bne r2 r0 .L113
+  add r1 12 r1
+  read 0 r1 r1
+  load 8 r2
+  beq r1 r2 .L111
+  load 83 r1
+  jump .L112
+.L111:
+  load 85 r1
+.L112:
+  or r0 r1 r5
+  jump .L153
+.L113:
+  add r1 12 r1
+  read 0 r1 r1
+  load 8 r2
+  beq r1 r2 .L115
+  load 82 r1
+  jump .L116
+.L115:
+  load 84 r1
+.L116:
+  or r0 r1 r5
+  jump .L153
+.L117:
+  or r0 r6 r1
+  add r5 12 r2
+  read 0 r2 r3
+  load 8 r2
+  beq r3 r2 .L120
+  load 119 r2
+  jump .L121
+.L120:
+  load 108 r2
+.L121:
+  or r0 r2 r6
+  add r1 4 r2
+  read 0 r2 r2
+  and r2 2 r2
+  bne r2 r0 .L131
+  add r5 40 r2
+  readbu 0 r2 r2
+  bne r2 r0 .L127
+  add r1 12 r1
+  read 0 r1 r1
+  load 8 r2
+  beq r1 r2 .L125
+  load 79 r1
+  jump .L126
+.L125:
+  load 81 r1
+.L126:
+  or r0 r1 r5
+  jump .L153
+.L127:
+  add r1 12 r1
+  read 0 r1 r1
+  load 8 r2
+  beq r1 r2 .L129
+  load 78 r1
+  jump .L130
+.L129:
+  load 80 r1
+.L130:
+  or r0 r1 r5
+  jump .L153
+.L131:
+  add r1 12 r2
+  read 0 r2 r2
+  ble r3 r2 .L154
+  load 2 r3
+  beq r2 r3 .L149
+  load 2 r3
+  blt r2 r3 .L141
+  load 4 r3
+  beq r2 r3 .L137
+  or r0 r2 r1
+  or r0 r1 r2
+  load 4 r1
+  sltu r2 r1 r1
+  jump .L144
+.L137:
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L139
+  load 71 r1
+  jump .L140
+.L139:
+  load 70 r1
+.L140:
+  or r0 r1 r5
+  jump .L153
+.L141:
+  load 1 r3
+  beq r2 r3 .L145
+  or r0 r2 r1
+  load 1 r2
+  sltu r1 r2 r1
+.L144:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.118 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L183
+.L145:
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L147
+  load 75 r1
+  jump .L148
+.L147:
+  load 74 r1
+.L148:
+  or r0 r1 r5
+  jump .L153
+.L149:
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L151
+  load 73 r1
+  jump .L152
+.L151:
+  load 72 r1
+.L152:
+  or r0 r1 r5
+.L153:
+  load 0 r1
+  jump .L181
+.L154:
+  or r0 r7 r1
+  jump .L183
+.L155:
+  add r6 4 r1
+  read 0 r1 r1
+  and r1 2 r2
+  bne r2 r0 .L169
+  and r1 32 r1
+  bne r1 r0 .L158
+  load 303 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.119 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -24 r14 r6
+.L158:
+  add r6 12 r1
+  read 0 r1 r1
+  load 8 r2
+  beq r1 r2 .L166
+  load 8 r2
+  bge r1 r2 .L163
+  load 4 r2
+  beq r1 r2 .L164
+  load 4 r2
+  sltu r1 r2 r1
+.L163:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.120 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L183
+.L164:
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -20 r14 r7
+  read -32 r14 r4
+  load 3 r2
+  write 0 r1 r2
+  add r1 8 r3
+  load 0 r2
+  write 0 r3 r2
+  load 55 r2
+  jump .L168
+.L166:
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -20 r14 r7
+  read -32 r14 r4
+  load 4 r2
+  write 0 r1 r2
+  add r1 8 r3
+  load 0 r2
+  write 0 r3 r2
+  load 63 r2
+.L168:
+  or r0 r2 r5
+  jump .L179
+.L169:
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -24 r14 r6
+  read -20 r14 r7
+  read -32 r14 r4
+  write -28 r14 r1
+  load 2 r2
+  write 0 r1 r2
+  add r1 8 r3
+  load 0 r2
+  write 0 r3 r2
+  add r6 12 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r2
+  load 8 r3
+  bge r2 r3 .L175
+  shiftl r2 2 r3
+  addr2reg .Ljt172 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L173:
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 119 r6
+  load 75 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r7
+  read -28 r14 r1
+  read -32 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  load 35 r2
+  jump .L178
+.L174:
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 119 r6
+  load 73 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r7
+  read -28 r14 r1
+  read -32 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  load 35 r2
+  jump .L178
+.L175:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.118 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L183
+.L176:
+  load 35 r2
+  jump .L178
+.L177:
+  load 45 r2
+.L178:
+  or r0 r2 r5
+.L179:
+  load 119 r2
+  or r0 r2 r6
+.L181:
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L183
+.L182:
+  load 0 r1
+.L183:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt172:
+  .int .L173
+  .int .L174
+  .int .L175
+  .int .L176
+  .int .L175
+  .int .L175
+  .int .L175
+  .int .L177
+
+/* end function convert */
+
+.data
+.balign 1
+.Lstring.122:
+	.ascii "t->kind == TYPEARRAY\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.123:
+	.ascii "t->base->size || t->base->kind == TYPEARRAY\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.124:
+	.ascii "t->u.array.length\000"
+/* end data */
+
+
+.text
+; function calcvla
+calcvla:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -32 r14 r5
+  write -28 r14 r4
+  add r5 4 r1
+  read 0 r1 r1
+  and r1 64 r1
+  beq r1 r0 .L208
+  add r5 20 r1
+  read 0 r1 r1
+  beq r1 r0 .L190
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump calcvla
+  read -32 r14 r5
+  read -28 r14 r4
+.L190:
+  read 0 r5 r1
+  load 1 r2
+  load 14 r3
+  beq r1 r3 .L192
+  add r5 12 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L192:
+  bne r2 r0 .L208
+  load 13 r2
+  beq r1 r2 .L195
+  load 360 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.122 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r5
+  read -28 r14 r4
+.L195:
+  add r5 40 r1
+  add r1 8 r1
+  read 0 r1 r1
+  bne r1 r0 .L208
+  add r5 20 r1
+  read 0 r1 r1
+  add r1 12 r2
+  read 0 r2 r3
+  load 1 r2
+  bne r3 r0 .L198
+  read 0 r1 r1
+  xor r1 13 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L199
+.L198:
+  or r0 r2 r1
+.L199:
+  bne r1 r0 .L201
+  load 362 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.123 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r5
+  read -28 r14 r4
+.L201:
+  add r5 40 r1
+  read 0 r1 r1
+  bne r1 r0 .L203
+  load 363 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.124 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r5
+  read -28 r14 r4
+.L203:
+  add r5 40 r1
+  read 0 r1 r5
+  add r5 8 r1
+  read 0 r1 r6
+  write -16 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r7
+  read -16 r14 r6
+  read -28 r14 r4
+  addr2reg typeulong r5
+  savpc r15
+  add r15 12 r15
+  jump convert
+  or r0 r1 r7
+  read -32 r14 r5
+  read -28 r14 r4
+  write -24 r14 r7
+  add r5 20 r1
+  read 0 r1 r1
+  add r1 12 r2
+  read 0 r2 r2
+  bne r2 r0 .L205
+  add r1 48 r1
+  read 0 r1 r1
+  jump .L207
+.L205:
+  add r1 12 r1
+  read 0 r1 r2
+  write -20 r14 r2
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -20 r14 r2
+  read -24 r14 r7
+  read -28 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+.L207:
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 108 r6
+  load 5 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  read -32 r14 r5
+  load32 -12 r2
+  sub r13 r2 r13
+  add r5 40 r2
+  add r2 8 r2
+  write 0 r2 r1
+.L208:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function calcvla */
+
+.data
+.balign 1
+.Lstring.126:
+	.ascii "!d->type->incomplete\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.127:
+	.ascii "d->type->kind == TYPEARRAY\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.128:
+	.ascii "d->type->u.array.size\000"
+/* end data */
+
+
+.text
+; function funcalloc
+funcalloc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 72 r13
+  write -60 r14 r5
+  write -64 r14 r4
+  add r5 12 r1
+  read 0 r1 r1
+  add r1 36 r1
+  readbu 0 r1 r1
+  beq r1 r0 .L213
+  load 378 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.126 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -60 r14 r5
+  read -64 r14 r4
+.L213:
+  add r5 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump calcvla
+  read -60 r14 r5
+  read -64 r14 r4
+  add r4 24 r1
+  read 0 r1 r3
+  write -56 r14 r3
+  add r5 12 r1
+  read 0 r1 r1
+  add r1 12 r2
+  read 0 r2 r2
+  bne r2 r0 .L219
+  read 0 r1 r1
+  load 13 r2
+  beq r1 r2 .L216
+  load 385 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.127 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -60 r14 r5
+  read -64 r14 r4
+.L216:
+  add r5 12 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r1
+  bne r1 r0 .L218
+  load 386 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.128 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -60 r14 r5
+  read -64 r14 r4
+.L218:
+  add r5 12 r1
+  read 0 r1 r1
+  add r1 40 r1
+  add r1 8 r1
+  read 0 r1 r7
+  jump .L221
+.L219:
+  add r4 20 r1
+  read 0 r1 r1
+  add r4 24 r2
+  write 0 r2 r1
+  add r5 12 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r1
+  write -12 r14 r1
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r7
+  read -12 r14 r1
+  read -60 r14 r5
+  read -64 r14 r4
+  load 2 r2
+  write 0 r7 r2
+  add r7 8 r2
+  write 0 r2 r1
+.L221:
+  write -24 r14 r7
+  add r5 36 r1
+  read 0 r1 r1
+  write -40 r14 r1
+  load 16 r2
+  beq r1 r2 .L236
+  load 16 r2
+  bge r1 r2 .L227
+  load 1 r2
+  sub r1 r2 r2
+  load 8 r3
+  bge r2 r3 .L227
+  shiftl r2 2 r3
+  addr2reg .Ljt225 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L226:
+  load 31 r1
+  jump .L237
+.L227:
+  addr2reg targ r12
+  read 0 r12 r2
+  add r2 16 r2
+  read 0 r2 r2
+  load 4 r3
+  beq r2 r3 .L230
+  load 108 r2
+  write -20 r14 r2
+  jump .L232
+.L230:
+  load 119 r2
+  write -20 r14 r2
+.L232:
+  load 16 r2
+  sub r1 r2 r2
+  write -16 r14 r2
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -24 r14 r7
+  read -16 r14 r2
+  read -20 r14 r6
+  read -64 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r7
+  read -64 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  jump .L236
+.L235:
+  load 32 r1
+  jump .L237
+.L236:
+  load 33 r1
+.L237:
+  or r0 r1 r5
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 16 r1
+  read 0 r1 r1
+  load 4 r2
+  beq r1 r2 .L239
+  load 108 r1
+  jump .L240
+.L239:
+  load 119 r1
+.L240:
+  or r0 r1 r6
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r2
+  read -40 r14 r1
+  read -56 r14 r3
+  read -60 r14 r5
+  read -64 r14 r4
+  write -36 r14 r2
+  load32 -12 r6
+  sub r13 r6 r13
+  load 16 r6
+  bgts r1 r6 .L242
+  or r0 r3 r1
+  jump .L257
+.L242:
+  addr2reg targ r12
+  read 0 r12 r2
+  add r2 16 r2
+  read 0 r2 r2
+  load 4 r3
+  beq r2 r3 .L245
+  load 108 r2
+  write -32 r14 r2
+  jump .L247
+.L245:
+  load 119 r2
+  write -32 r14 r2
+.L247:
+  load 16 r2
+  sub r1 r2 r3
+  write -28 r14 r3
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -28 r14 r3
+  read -32 r14 r6
+  read -36 r14 r2
+  read -64 r14 r4
+  load 2 r5
+  write 0 r1 r5
+  add r1 8 r5
+  write 0 r5 r3
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r1
+  or r0 r2 r7
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  write -48 r14 r1
+  read -40 r14 r1
+  load32 -12 r2
+  sub r13 r2 r13
+  addr2reg targ r12
+  read 0 r12 r2
+  add r2 16 r2
+  read 0 r2 r2
+  load 4 r3
+  beq r2 r3 .L252
+  load 108 r2
+  write -52 r14 r2
+  jump .L254
+.L252:
+  load 119 r2
+  write -52 r14 r2
+.L254:
+  sub r0 r1 r2
+  write -44 r14 r2
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -44 r14 r2
+  read -52 r14 r6
+  read -48 r14 r7
+  read -64 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 13 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r2
+  read -56 r14 r1
+  read -60 r14 r5
+  read -64 r14 r4
+  load32 -12 r3
+  sub r13 r3 r13
+.L257:
+  add r5 20 r3
+  write 0 r3 r2
+  add r4 24 r2
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt225:
+  .int .L226
+  .int .L226
+  .int .L227
+  .int .L226
+  .int .L227
+  .int .L227
+  .int .L227
+  .int .L235
+
+/* end function funcalloc */
+
+
+.text
+; function funcbits
+funcbits:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  add r14 -36 r1
+  write 0 r1 r7
+  or r0 r5 r1
+  write -24 r14 r4
+  or r0 r6 r4
+  write -4 r14 r4
+  write -12 r14 r1
+  add r1 12 r2
+  read 0 r2 r2
+  load 4 r3
+  ble r2 r3 .L264
+  load 108 r3
+  write -32 r14 r3
+  jump .L266
+.L264:
+  load 119 r3
+  write -32 r14 r3
+.L266:
+  add r14 -36 r3
+  add r3 2 r3
+  readh 0 r3 r3
+  bne r3 r0 .L268
+  or r0 r4 r2
+  jump .L271
+.L268:
+  add r2 3 r1
+  load32 -4 r4
+  and r1 r4 r1
+  sub r1 r2 r1
+  shiftl r1 3 r1
+  add r3 r1 r3
+  write -8 r14 r3
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r2
+  read -8 r14 r3
+  read -32 r14 r6
+  read -4 r14 r1
+  read -24 r14 r4
+  load 2 r5
+  write 0 r2 r5
+  add r2 8 r5
+  write 0 r5 r3
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  load 16 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  read -8 r14 r3
+  or r0 r1 r2
+  read -12 r14 r1
+  load32 -12 r4
+  sub r13 r4 r13
+.L271:
+  write -28 r14 r2
+  readh -36 r14 r4
+  add r3 r4 r3
+  write -20 r14 r3
+  bne r3 r0 .L273
+  or r0 r2 r1
+  jump .L280
+.L273:
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L276
+  load 15 r1
+  write -16 r14 r1
+  jump .L278
+.L276:
+  load 14 r1
+  write -16 r14 r1
+.L278:
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r2
+  read -28 r14 r1
+  read -16 r14 r5
+  read -20 r14 r3
+  read -32 r14 r6
+  read -24 r14 r4
+  load 2 r7
+  write 0 r2 r7
+  add r2 8 r7
+  write 0 r7 r3
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r2
+  sub r13 r2 r13
+.L280:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function funcbits */
+
+.data
+.balign 1
+.Lstring.131:
+	.ascii "(align & align - 1) == 0\000"
+/* end data */
+
+
+.text
+; function funccopy
+funccopy:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 76 r13
+  write -68 r14 r8
+  read 8 r14 r8
+  write -8 r14 r8
+  write -56 r14 r7
+  write -16 r14 r6
+  write -12 r14 r5
+  write -48 r14 r4
+  load 1 r1
+  sub r8 r1 r1
+  and r8 r1 r1
+  beq r1 r0 .L285
+  load 433 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.131 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -8 r14 r8
+.L285:
+  load 2 r1
+  beq r8 r1 .L302
+  load 2 r1
+  blt r8 r1 .L291
+  load 4 r1
+  beq r8 r1 .L289
+  load 4 r1
+  sltu r8 r1 r1
+  jump .L293
+.L289:
+  load 26 r3
+  load 20 r2
+  load 119 r1
+  write -32 r14 r8
+  write -60 r14 r3
+  write -64 r14 r2
+  write -52 r14 r1
+  jump .L304
+.L291:
+  load 1 r1
+  beq r8 r1 .L300
+  load 1 r1
+  sltu r8 r1 r1
+.L293:
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 16 r1
+  read 0 r1 r1
+  load 4 r2
+  beq r1 r2 .L296
+  load 8 r4
+  load 25 r3
+  load 19 r2
+  load 108 r1
+  or r0 r1 r6
+  jump .L298
+.L296:
+  load 4 r4
+  load 26 r3
+  load 20 r2
+  load 119 r1
+  or r0 r1 r6
+.L298:
+  or r0 r3 r1
+  or r0 r4 r8
+  or r0 r2 r5
+  write -32 r14 r8
+  write -60 r14 r1
+  write -64 r14 r5
+  write -52 r14 r6
+  jump .L304
+.L300:
+  load 30 r3
+  load 22 r2
+  load 119 r1
+  write -32 r14 r8
+  write -60 r14 r3
+  write -64 r14 r2
+  write -52 r14 r1
+  jump .L304
+.L302:
+  load 28 r3
+  load 21 r2
+  load 119 r1
+  write -32 r14 r8
+  write -60 r14 r3
+  write -64 r14 r2
+  write -52 r14 r1
+.L304:
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r3
+  read -32 r14 r8
+  read -60 r14 r5
+  read -52 r14 r6
+  read -12 r14 r2
+  read -48 r14 r1
+  write -40 r14 r3
+  load 2 r4
+  write 0 r3 r4
+  read -16 r14 r4
+  add r3 8 r3
+  write 0 r3 r8
+  load 0 r3
+  write -28 r14 r2
+  write -20 r14 r3
+.L307:
+  write -24 r14 r4
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r3
+  load 0 r2
+  write 0 r3 r2
+  or r0 r4 r7
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r7
+  read -28 r14 r5
+  or r0 r5 r2
+  read -64 r14 r5
+  read -48 r14 r1
+  load32 -12 r3
+  sub r13 r3 r13
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  load 0 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  read -24 r14 r4
+  read -20 r14 r2
+  read -32 r14 r8
+  read -40 r14 r3
+  read -56 r14 r5
+  read -48 r14 r1
+  load32 -12 r6
+  sub r13 r6 r13
+  add r2 r8 r2
+  write -44 r14 r2
+  bge r2 r5 .L317
+  addr2reg targ r12
+  read 0 r12 r2
+  add r2 16 r2
+  read 0 r2 r2
+  load 4 r5
+  beq r2 r5 .L311
+  load 108 r2
+  jump .L312
+.L311:
+  load 119 r2
+.L312:
+  or r0 r2 r6
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r3
+  or r0 r4 r7
+  load 1 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  write -36 r14 r1
+  read -28 r14 r5
+  read -40 r14 r3
+  read -48 r14 r1
+  load32 -12 r2
+  sub r13 r2 r13
+  addr2reg targ r12
+  read 0 r12 r2
+  add r2 16 r2
+  read 0 r2 r2
+  load 4 r4
+  beq r2 r4 .L314
+  load 108 r2
+  jump .L315
+.L314:
+  load 119 r2
+.L315:
+  or r0 r2 r6
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r3
+  or r0 r5 r7
+  load 1 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r5
+  read -32 r14 r8
+  read -40 r14 r3
+  read -36 r14 r4
+  read -44 r14 r2
+  read -48 r14 r1
+  load32 -12 r6
+  sub r13 r6 r13
+  read -52 r14 r6
+  write -28 r14 r5
+  read -60 r14 r5
+  write -20 r14 r2
+  jump .L307
+.L317:
+  read -68 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function funccopy */
+
+.data
+.balign 1
+.Lstring.133:
+	.ascii "volatile store is not yet supported\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.134:
+	.ascii "cannot store to 'const' object\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.135:
+	.ascii "!lval.bits.before && !lval.bits.after || tp & PROPINT\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.136:
+	.ascii "tp & PROPSCALAR\000"
+/* end data */
+
+
+.text
+; function funcstore
+funcstore:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 104 r13
+  write -96 r14 r8
+  read 8 r14 r1
+  write -80 r14 r1
+  or r0 r7 r3
+  or r0 r5 r2
+  or r0 r6 r5
+  write -72 r14 r3
+  write -12 r14 r5
+  write -20 r14 r2
+  write -68 r14 r4
+  and r5 8 r6
+  beq r6 r0 .L322
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.133 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r1
+  read -72 r14 r3
+  read -12 r14 r5
+  read -20 r14 r2
+  read -68 r14 r4
+  load32 -24 r6
+  sub r13 r6 r13
+.L322:
+  and r5 2 r5
+  beq r5 r0 .L324
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.134 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -80 r14 r1
+  read -72 r14 r3
+  read -20 r14 r2
+  read -68 r14 r4
+  load32 -24 r5
+  sub r13 r5 r13
+.L324:
+  add r2 4 r5
+  read 0 r5 r5
+  write -16 r14 r5
+  add r3 4 r6
+  readh 0 r6 r7
+  load 0 r6
+  beq r7 r0 .L326
+  or r0 r6 r7
+  jump .L327
+.L326:
+  add r3 6 r6
+  readh 0 r6 r6
+  xor r6 0 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r7
+.L327:
+  load 1 r6
+  bne r7 r0 .L329
+  and r5 2 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L329:
+  bne r6 r0 .L331
+  load 474 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.135 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+  or r0 r1 r5
+  read -80 r14 r1
+  read -72 r14 r3
+  read -20 r14 r2
+  read -68 r14 r4
+.L331:
+  read 0 r2 r6
+  load 12 r7
+  sub r6 r7 r6
+  load 5 r7
+  blt r6 r7 .L334
+  or r0 r5 r1
+  jump .L339
+.L334:
+  shiftl r6 2 r7
+  addr2reg .Ljt334 r6
+  add r6 r7 r6
+  read 0 r6 r6
+  jumpr 0 r6
+.L335:
+  or r0 r5 r1
+  addr2reg typeulong r2
+  jump .L339
+.L337:
+  read 0 r3 r5
+  add r2 12 r3
+  read 0 r3 r7
+  add r2 8 r2
+  read 0 r2 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump funccopy
+  read -80 r14 r1
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L353
+.L338:
+  or r0 r5 r1
+.L339:
+  write -28 r14 r2
+  and r1 16 r1
+  bne r1 r0 .L341
+  load 486 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.136 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -28 r14 r2
+.L341:
+  or r0 r2 r5
+  add r14 -92 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -28 r14 r2
+  read -80 r14 r1
+  read -72 r14 r3
+  read -68 r14 r4
+  read -92 r14 r7
+  add r14 -92 r5
+  add r5 4 r5
+  read 0 r5 r8
+  write -36 r14 r8
+  add r5 4 r5
+  read 0 r5 r5
+  write -64 r14 r5
+  add r3 4 r5
+  readh 0 r5 r5
+  write -24 r14 r5
+  add r3 4 r6
+  add r6 2 r6
+  readh 0 r6 r6
+  add r5 r6 r6
+  bne r6 r0 .L343
+  read -64 r14 r5
+  write -76 r14 r1
+  jump .L352
+.L343:
+  or r0 r6 r4
+  or r0 r5 r3
+  or r0 r7 r1
+  add r2 12 r2
+  read 0 r2 r2
+  shiftl r2 3 r5
+  load 32 r2
+  sub r2 r5 r2
+  add r2 r4 r4
+  load32 -1 r2
+  shiftr r2 r4 r2
+  shiftl r2 r3 r2
+  write -40 r14 r2
+  shiftl r1 24 r6
+  shiftrs r6 24 r6
+  write -56 r14 r6
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r2
+  read -56 r14 r6
+  read -24 r14 r3
+  read -80 r14 r1
+  read -68 r14 r4
+  load 2 r5
+  write 0 r2 r5
+  add r2 8 r5
+  write 0 r5 r3
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  load 16 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r7
+  read -28 r14 r2
+  read -72 r14 r3
+  read -68 r14 r4
+  write -32 r14 r7
+  load32 -12 r1
+  sub r13 r1 r13
+  add r3 4 r3
+  or r0 r7 r1
+  read 0 r3 r7
+  or r0 r1 r6
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump funcbits
+  write -60 r14 r1
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -32 r14 r7
+  read -56 r14 r6
+  read -40 r14 r2
+  read -68 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 13 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  write -52 r14 r1
+  read -56 r14 r6
+  read -36 r14 r5
+  read -72 r14 r3
+  read -68 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  read 0 r3 r7
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  write -44 r14 r1
+  read -40 r14 r1
+  load32 -12 r2
+  sub r13 r2 r13
+  xor r1 -1 r2
+  write -48 r14 r2
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -44 r14 r7
+  read -48 r14 r2
+  read -56 r14 r6
+  read -68 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 13 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  read -52 r14 r7
+  read -56 r14 r6
+  read -68 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 11 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r2
+  read -60 r14 r1
+  read -64 r14 r5
+  read -72 r14 r3
+  read -68 r14 r4
+  load32 -12 r6
+  sub r13 r6 r13
+  write -76 r14 r1
+  or r0 r2 r1
+.L352:
+  read 0 r3 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  read -76 r14 r1
+  load32 -12 r2
+  sub r13 r2 r13
+.L353:
+  read -96 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt334:
+  .int .L335
+  .int .L337
+  .int .L338
+  .int .L337
+  .int .L337
+
+/* end function funcstore */
+
+
+.text
+; function funcload
+funcload:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  write -8 r14 r4
+  write -12 r14 r6
+  write -16 r14 r5
+  read 0 r5 r1
+  load 15 r2
+  beq r1 r2 .L364
+  load 15 r2
+  blt r1 r2 .L361
+  load 16 r2
+  beq r1 r2 .L364
+  load 16 r2
+  sltu r1 r2 r1
+  jump .L363
+.L361:
+  load 13 r2
+  beq r1 r2 .L364
+  load 13 r2
+  sltu r1 r2 r1
+.L363:
+  add r14 -28 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -12 r14 r6
+  read -8 r14 r4
+  read -28 r14 r2
+  add r14 -28 r1
+  add r1 4 r1
+  read 0 r1 r5
+  or r0 r6 r1
+  shiftl r2 24 r6
+  shiftrs r6 24 r6
+  read 0 r1 r7
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r6
+  read -12 r14 r1
+  read -16 r14 r5
+  read -8 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  add r1 4 r1
+  read 0 r1 r7
+  savpc r15
+  add r15 12 r15
+  jump funcbits
+  jump .L365
+.L364:
+  read 0 r6 r1
+.L365:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function funcload */
+
+.data
+.balign 1
+.Lstring.139:
+	.ascii "start\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.140:
+	.ascii "__func__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.141:
+	.ascii "body\000"
+/* end data */
+
+
+.text
+; function mkfunc
+.global mkfunc
+mkfunc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  write -28 r14 r7
+  write -8 r14 r6
+  write -32 r14 r5
+  write -4 r14 r4
+  load 56 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -8 r14 r6
+  read -32 r14 r4
+  read -4 r14 r2
+  write -16 r14 r1
+  write 0 r1 r2
+  add r1 8 r2
+  write 0 r2 r4
+  add r1 16 r1
+  write 0 r1 r6
+  addr2reg .Lstring.139 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  or r0 r1 r2
+  read -16 r14 r1
+  add r1 24 r3
+  write 0 r3 r2
+  add r1 20 r3
+  write 0 r3 r2
+  add r1 44 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 48 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 52 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 28 r4
+  load 8 r5
+  savpc r15
+  add r15 12 r15
+  jump mapinit
+  read -8 r14 r6
+  add r6 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emittype
+  read -8 r14 r6
+  add r6 40 r1
+  add r1 8 r1
+  read 0 r1 r5
+  load 12 r6
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump xreallocarray
+  or r0 r1 r3
+  read -16 r14 r1
+  read -8 r14 r6
+  or r0 r1 r2
+  add r1 12 r1
+  write 0 r1 r3
+  add r6 40 r1
+  add r1 4 r1
+  read 0 r1 r2
+  write -20 r14 r3
+.L370:
+  write -24 r14 r2
+  beq r2 r0 .L377
+  add r2 12 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emittype
+  read -20 r14 r3
+  read -16 r14 r1
+  or r0 r3 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump functemp
+  read -24 r14 r2
+  read -20 r14 r3
+  read -16 r14 r1
+  read 0 r2 r4
+  beq r4 r0 .L375
+  add r2 12 r4
+  read 0 r4 r4
+  add r4 16 r4
+  read 0 r4 r4
+  bne r4 r0 .L374
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump funcalloc
+  read -24 r14 r2
+  read -20 r14 r3
+  read -16 r14 r1
+  add r2 12 r4
+  read 0 r4 r5
+  add r2 20 r2
+  read 0 r2 r2
+  write -40 r14 r2
+  add r14 -40 r2
+  add r2 4 r4
+  load 0 r2
+  write 0 r4 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r3
+  add r14 -48 r7
+  add r14 -40 r2
+  add r2 0 r2
+  read 0 r2 r2
+  add r14 -48 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r14 -40 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r14 -48 r3
+  add r3 4 r3
+  write 0 r3 r2
+  load 0 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump funcstore
+  read -24 r14 r2
+  read -20 r14 r3
+  read -16 r14 r1
+  load32 -12 r4
+  sub r13 r4 r13
+  jump .L375
+.L374:
+  add r2 20 r4
+  write 0 r4 r3
+.L375:
+  add r2 32 r2
+  read 0 r2 r2
+  add r3 12 r3
+  write -20 r14 r3
+  jump .L370
+.L377:
+  read -32 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  add r1 1 r6
+  load 2 r5
+  addr2reg typechar r4
+  savpc r15
+  add r15 12 r15
+  jump mkarraytype
+  or r0 r1 r6
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r7
+  load 1 r5
+  addr2reg .Lstring.140 r4
+  savpc r15
+  add r15 12 r15
+  jump mkdecl
+  write -12 r14 r1
+  load32 -12 r2
+  sub r13 r2 r13
+  add r1 36 r2
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkglobal
+  or r0 r1 r2
+  read -12 r14 r1
+  read -28 r14 r4
+  add r1 20 r3
+  write 0 r3 r2
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump scopeputdecl
+  read -12 r14 r1
+  read -16 r14 r2
+  add r2 4 r2
+  write 0 r2 r1
+  addr2reg .Lstring.141 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  or r0 r1 r5
+  read -16 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -16 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkfunc */
+
+
+.text
+; function delfunc
+.global delfunc
+delfunc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+.L382:
+  add r4 20 r1
+  or r0 r4 r2
+  read 0 r1 r4
+  write -8 r14 r4
+  beq r4 r0 .L392
+  add r4 84 r1
+  read 0 r1 r1
+  add r2 20 r2
+  write 0 r2 r1
+  add r4 12 r1
+  read 0 r1 r2
+  or r0 r4 r1
+.L385:
+  write -12 r14 r2
+  or r0 r1 r3
+  add r1 12 r1
+  read 0 r1 r1
+  add r3 16 r3
+  read 0 r3 r3
+  add r1 r3 r3
+  beq r2 r3 .L388
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -12 r14 r2
+  read -8 r14 r1
+  add r2 4 r2
+  jump .L385
+.L388:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -8 r14 r4
+  add r4 56 r1
+  read 0 r1 r1
+  load 5 r2
+  bne r1 r2 .L391
+  add r4 56 r1
+  add r1 16 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -8 r14 r4
+.L391:
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r4
+  jump .L382
+.L392:
+  or r0 r2 r4
+  add r4 28 r4
+  addr2reg free r5
+  savpc r15
+  add r15 12 r15
+  jump mapfree
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function delfunc */
+
+
+.text
+; function functype
+.global functype
+functype:
+  add r4 16 r1
+  read 0 r1 r1
+  jumpr 0 r15
+
+/* end function functype */
+
+
+.text
+; function funclabel
+.global funclabel
+funclabel:
+  add r4 24 r1
+  read 0 r1 r1
+  add r1 84 r1
+  write 0 r1 r5
+  add r4 24 r1
+  write 0 r1 r5
+  jumpr 0 r15
+
+/* end function funclabel */
+
+
+.text
+; function funcjmp
+.global funcjmp
+funcjmp:
+  add r4 24 r1
+  read 0 r1 r1
+  add r1 56 r2
+  read 0 r2 r2
+  bne r2 r0 .L407
+  add r1 56 r3
+  load 1 r2
+  write 0 r3 r2
+  add r1 56 r1
+  add r1 8 r1
+  add r1 0 r1
+  write 0 r1 r5
+.L407:
+  jumpr 0 r15
+
+/* end function funcjmp */
+
+.data
+.balign 1
+.Lstring.147:
+	.ascii "t->prop & PROPSCALAR\000"
+/* end data */
+
+
+.text
+; function funcjnz
+.global funcjnz
+funcjnz:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 60 r13
+  write -52 r14 r8
+  read 8 r14 r8
+  write -40 r14 r8
+  or r0 r7 r3
+  or r0 r5 r1
+  write -44 r14 r3
+  write -20 r14 r6
+  write -12 r14 r1
+  write -16 r14 r4
+  add r4 24 r2
+  read 0 r2 r2
+  write -48 r14 r2
+  add r2 56 r5
+  read 0 r5 r5
+  bne r5 r0 .L427
+  add r4 48 r5
+  read 0 r5 r5
+  bne r1 r5 .L413
+  add r4 52 r5
+  read 0 r5 r5
+  add r2 56 r7
+  add r7 24 r7
+  write 0 r7 r5
+  read -40 r14 r8
+.L413:
+  bne r6 r0 .L415
+  or r0 r1 r4
+  or r0 r8 r1
+  jump .L426
+.L415:
+  add r6 4 r5
+  read 0 r5 r5
+  and r5 16 r5
+  bne r5 r0 .L417
+  load 626 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.147 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -48 r14 r2
+  read -44 r14 r3
+  read -20 r14 r6
+  read -12 r14 r4
+  or r0 r4 r1
+  read -16 r14 r4
+.L417:
+  add r6 4 r5
+  read 0 r5 r5
+  and r5 2 r8
+  write -24 r14 r8
+  load 0 r7
+  write -28 r14 r7
+  read -24 r14 r8
+  read -28 r14 r7
+  beq r8 r0 .L419
+  add r6 12 r7
+  read 0 r7 r7
+  sltu r7 4 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L419:
+  bne r7 r0 .L425
+  and r5 32 r7
+  write -32 r14 r7
+  read -40 r14 r8
+  load 1 r5
+  write -36 r14 r5
+  read -32 r14 r7
+  read -36 r14 r5
+  bne r7 r0 .L422
+  add r6 12 r5
+  read 0 r5 r7
+  load 4 r5
+  sltu r5 r7 r5
+  read -40 r14 r8
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L422:
+  bne r5 r0 .L424
+  or r0 r1 r4
+  or r0 r8 r1
+  jump .L426
+.L424:
+  or r0 r1 r7
+  addr2reg typebool r5
+  savpc r15
+  add r15 12 r15
+  jump convert
+  or r0 r1 r4
+  read -48 r14 r2
+  read -40 r14 r1
+  read -44 r14 r3
+  jump .L426
+.L425:
+  or r0 r1 r7
+  addr2reg typeint r5
+  savpc r15
+  add r15 12 r15
+  jump convert
+  or r0 r1 r4
+  read -48 r14 r2
+  read -40 r14 r1
+  read -44 r14 r3
+.L426:
+  add r2 56 r6
+  load 2 r5
+  write 0 r6 r5
+  add r2 56 r5
+  add r5 4 r5
+  write 0 r5 r4
+  add r2 56 r4
+  add r4 8 r4
+  add r4 0 r4
+  write 0 r4 r3
+  add r2 56 r2
+  add r2 8 r2
+  add r2 4 r2
+  write 0 r2 r1
+.L427:
+  read -52 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function funcjnz */
+
+
+.text
+; function funcret
+.global funcret
+funcret:
+  add r4 24 r1
+  read 0 r1 r1
+  add r1 56 r2
+  read 0 r2 r2
+  bne r2 r0 .L432
+  add r1 56 r3
+  load 3 r2
+  write 0 r3 r2
+  add r1 56 r1
+  add r1 4 r1
+  write 0 r1 r5
+.L432:
+  jumpr 0 r15
+
+/* end function funcret */
+
+
+.text
+; function funchlt
+.global funchlt
+funchlt:
+  add r4 24 r1
+  read 0 r1 r1
+  add r1 56 r2
+  read 0 r2 r2
+  bne r2 r0 .L437
+  add r1 56 r2
+  load 4 r1
+  write 0 r2 r1
+.L437:
+  jumpr 0 r15
+
+/* end function funchlt */
+
+
+.text
+; function funcgoto
+.global funcgoto
+funcgoto:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  write -4 r14 r4
+  or r0 r5 r4
+  write -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -8 r14 r4
+  or r0 r4 r5
+  add r14 -28 r4
+  savpc r15
+  add r15 12 r15
+  jump mapkey
+  read -4 r14 r4
+  add r4 28 r4
+  add r14 -28 r5
+  savpc r15
+  add r15 12 r15
+  jump mapput
+  or r0 r1 r2
+  write -12 r14 r2
+  read 0 r2 r1
+  bne r1 r0 .L442
+  load 8 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  write -16 r14 r1
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  or r0 r1 r3
+  read -16 r14 r1
+  read -12 r14 r2
+  write 0 r1 r3
+  write 0 r2 r1
+.L442:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function funcgoto */
+
+.data
+.balign 1
+.Lstring.152:
+	.ascii "identifier '%s' is not an object or function\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.153:
+	.ascii "data \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.154:
+	.ascii " = { b \042%s\042, b 0 }\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.155:
+	.ascii "expression is not an object\000"
+/* end data */
+
+
+.text
+; function funclval
+funclval:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 48 r13
+  or r0 r5 r2
+  write -24 r14 r2
+  write -32 r14 r4
+  load 0 r1
+  write -40 r14 r1
+  add r14 -40 r1
+  add r1 4 r3
+  load 0 r1
+  write 0 r3 r1
+  read 0 r6 r1
+  load 4 r3
+  bne r1 r3 .L447
+  add r6 32 r1
+  add r14 -40 r3
+  add r3 4 r3
+  readhu 0 r1 r5
+  writeh 0 r3 r5
+  add r1 2 r1
+  add r3 2 r3
+  readhu 0 r1 r1
+  writeh 0 r3 r1
+  add r6 20 r1
+  read 0 r1 r6
+.L447:
+  write -28 r14 r6
+  read 0 r6 r1
+  load 8 r3
+  bge r1 r3 .L458
+  shiftl r1 2 r3
+  addr2reg .Ljt449 r1
+  add r1 r3 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L450:
+  add r6 32 r1
+  read 0 r1 r1
+  write -16 r14 r1
+  add r1 4 r3
+  read 0 r3 r3
+  load 0 r5
+  load 1 r6
+  bne r3 r6 .L452
+  or r0 r5 r3
+  jump .L453
+.L452:
+  xor r3 2 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L453:
+  beq r3 r0 .L455
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.152 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -32 r14 r4
+  read -16 r14 r1
+  read -24 r14 r2
+  load32 -24 r3
+  sub r13 r3 r13
+.L455:
+  add r2 4 r2
+  read 0 r2 r2
+  bne r1 r2 .L457
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.153 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -16 r14 r1
+  add r1 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  read -24 r14 r2
+  add r2 8 r1
+  read 0 r1 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.154 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -32 r14 r4
+  read -16 r14 r1
+  read -24 r14 r2
+  load32 -24 r3
+  sub r13 r3 r13
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+.L457:
+  add r1 20 r1
+  read 0 r1 r1
+  write -40 r14 r1
+  jump .L473
+.L458:
+  or r0 r2 r4
+  add r6 8 r1
+  read 0 r1 r1
+  read 0 r1 r3
+  load 0 r2
+  load 15 r5
+  bne r3 r5 .L460
+  or r0 r2 r1
+  jump .L461
+.L460:
+  read 0 r1 r1
+  xor r1 16 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L461:
+  beq r1 r0 .L463
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.155 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -28 r14 r6
+  read -24 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L463:
+  or r0 r6 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -32 r14 r4
+  write -40 r14 r1
+  jump .L473
+.L464:
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump stringdecl
+  read -32 r14 r4
+  add r1 20 r1
+  read 0 r1 r1
+  write -40 r14 r1
+  jump .L473
+.L465:
+  or r0 r2 r4
+  add r6 28 r1
+  read 0 r1 r5
+  beq r5 r0 .L468
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -28 r14 r6
+  read -24 r14 r4
+.L468:
+  add r6 32 r1
+  read 0 r1 r1
+  write -20 r14 r1
+  add r6 32 r2
+  add r2 4 r2
+  read 0 r2 r6
+  load 1 r7
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinit
+  read -32 r14 r4
+  read -20 r14 r1
+  add r1 20 r1
+  read 0 r1 r1
+  write -40 r14 r1
+  jump .L473
+.L469:
+  or r0 r2 r4
+  add r6 16 r1
+  read 0 r1 r1
+  load 75 r2
+  beq r1 r2 .L472
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.155 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -28 r14 r6
+  read -24 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L472:
+  add r6 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -32 r14 r4
+  write -40 r14 r1
+.L473:
+  add r14 -40 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r4 0 r2
+  write 0 r2 r1
+  add r14 -40 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r4 4 r2
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt449:
+  .int .L450
+  .int .L458
+  .int .L464
+  .int .L458
+  .int .L458
+  .int .L458
+  .int .L465
+  .int .L469
+
+/* end function funclval */
+
+.data
+.balign 1
+.Lstring.157:
+	.ascii "unimplemented declaration kind %d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.158:
+	.ascii "t->prop & PROPFLOAT\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.159:
+	.ascii "not a scalar\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.160:
+	.ascii "internal error; unknown unary expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.161:
+	.ascii "logic_right\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.162:
+	.ascii "logic_join\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.163:
+	.ascii "internal error; unimplemented binary expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.164:
+	.ascii "cond_true\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.165:
+	.ascii "cond_false\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.166:
+	.ascii "cond_join\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.167:
+	.ascii "va_arg with non-scalar type is not yet supported\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.168:
+	.ascii "internal error: unimplemented builtin\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.169:
+	.ascii "e->u.temp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.170:
+	.ascii "unimplemented expression %d\000"
+/* end data */
+
+
+.text
+; function funcexpr
+.global funcexpr
+funcexpr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 344 r13
+  or r0 r5 r2
+  write -136 r14 r2
+  write -140 r14 r4
+  add r2 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump calcvla
+  read -136 r14 r2
+  read -140 r14 r4
+  read 0 r2 r1
+  load 16 r3
+  bge r1 r3 .L564
+  shiftl r1 2 r3
+  addr2reg .Ljt479 r1
+  add r1 r3 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L480:
+  add r2 32 r1
+  read 0 r1 r1
+  add r1 4 r3
+  read 0 r3 r5
+  load 3 r3
+  beq r5 r3 .L487
+  load 3 r3
+  bge r5 r3 .L485
+  load 1 r3
+  beq r5 r3 .L486
+  load 1 r2
+  sltu r5 r2 r2
+.L485:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.157 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -136 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L564
+.L486:
+  add r2 8 r2
+  read 0 r2 r5
+  add r1 20 r1
+  read 0 r1 r1
+  write -152 r14 r1
+  add r14 -152 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -336 r6
+  add r14 -152 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -336 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -152 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -336 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcload
+  jump .L757
+.L487:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L757
+.L488:
+  add r2 8 r1
+  read 0 r1 r1
+  write -12 r14 r1
+  add r1 4 r3
+  read 0 r3 r3
+  and r3 2 r5
+  load 1 r4
+  bne r5 r0 .L490
+  read 0 r1 r4
+  xor r4 12 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L490:
+  bne r4 r0 .L500
+  and r3 32 r3
+  bne r3 r0 .L493
+  load 756 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.158 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r1
+  read -136 r14 r2
+.L493:
+  add r1 12 r1
+  read 0 r1 r1
+  load 4 r3
+  beq r1 r3 .L496
+  load 4 r1
+  write -20 r14 r1
+  jump .L498
+.L496:
+  load 3 r1
+  write -20 r14 r1
+.L498:
+  add r2 32 r1
+  read 0 r1 r2
+  write -16 r14 r2
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -16 r14 r2
+  read -20 r14 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  jump .L757
+.L500:
+  add r2 32 r1
+  read 0 r1 r2
+  write -24 r14 r2
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -24 r14 r2
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  jump .L757
+.L502:
+  add r2 32 r1
+  add r1 4 r1
+  read 0 r1 r5
+  load 4 r6
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump xreallocarray
+  write -56 r14 r1
+  read -136 r14 r2
+  add r2 32 r1
+  read 0 r1 r2
+  load 0 r1
+  write -60 r14 r1
+.L504:
+  write -64 r14 r2
+  beq r2 r0 .L508
+  add r2 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emittype
+  read -64 r14 r2
+  read -140 r14 r4
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r5
+  read -64 r14 r2
+  read -60 r14 r3
+  read -56 r14 r1
+  read -140 r14 r4
+  shiftl r3 2 r6
+  add r1 r6 r6
+  write 0 r6 r5
+  add r2 24 r2
+  read 0 r2 r2
+  add r3 1 r3
+  write -60 r14 r3
+  jump .L504
+.L508:
+  read -136 r14 r2
+  add r2 8 r1
+  read 0 r1 r1
+  write -32 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emittype
+  read -32 r14 r1
+  or r0 r1 r5
+  add r14 -276 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -136 r14 r2
+  read -140 r14 r4
+  readb -276 r14 r6
+  write -28 r14 r6
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r7
+  read -28 r14 r6
+  read -32 r14 r1
+  read -140 r14 r4
+  add r1 16 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 88 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  write -52 r14 r1
+  read -136 r14 r2
+  read -140 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  add r2 20 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r3
+  write -40 r14 r3
+  add r2 32 r1
+  read 0 r1 r1
+  load 0 r2
+  or r0 r2 r5
+  or r0 r3 r2
+  or r0 r1 r3
+.L511:
+  write -44 r14 r3
+  write -48 r14 r5
+  beq r3 r0 .L518
+  add r2 40 r1
+  readbu 0 r1 r6
+  load 0 r1
+  beq r6 r0 .L514
+  add r2 40 r1
+  add r1 8 r1
+  read 0 r1 r1
+  xor r5 r1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L514:
+  beq r1 r0 .L516
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r7
+  load 0 r6
+  load 92 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  read -44 r14 r3
+  load32 -12 r1
+  sub r13 r1 r13
+.L516:
+  add r3 8 r1
+  read 0 r1 r1
+  write -36 r14 r1
+  or r0 r1 r5
+  add r14 -264 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -48 r14 r5
+  read -36 r14 r1
+  read -56 r14 r2
+  read -140 r14 r4
+  readb -264 r14 r6
+  shiftl r5 2 r3
+  add r2 r3 r2
+  read 0 r2 r7
+  add r1 16 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 91 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  read -44 r14 r3
+  read -48 r14 r5
+  read -40 r14 r2
+  read -56 r14 r1
+  read -140 r14 r4
+  load32 -12 r6
+  sub r13 r6 r13
+  add r3 24 r3
+  read 0 r3 r3
+  add r5 1 r5
+  jump .L511
+.L518:
+  or r0 r2 r3
+  read -52 r14 r1
+  read -136 r14 r2
+  add r3 40 r6
+  readbu 0 r6 r7
+  load 0 r6
+  bne r7 r0 .L521
+  or r0 r6 r3
+  jump .L522
+.L521:
+  add r3 40 r3
+  add r3 8 r3
+  read 0 r3 r3
+  sltu r3 r5 r3
+  xor r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L522:
+  beq r3 r0 .L524
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r7
+  load 0 r6
+  load 92 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  read -52 r14 r1
+  read -136 r14 r2
+  read -140 r14 r4
+  load32 -12 r3
+  sub r13 r3 r13
+.L524:
+  add r2 20 r2
+  read 0 r2 r2
+  read 0 r2 r5
+  load 0 r3
+  load 7 r6
+  bne r5 r6 .L526
+  add r2 16 r3
+  read 0 r3 r3
+  xor r3 74 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L526:
+  bne r3 r0 8
+  jump .L757
+  add r2 20 r2
+  read 0 r2 r2
+  read 0 r2 r5
+  load 0 r3
+  beq r5 r0 .L529
+  or r0 r3 r2
+  jump .L530
+.L529:
+  add r2 32 r2
+  read 0 r2 r2
+  add r2 36 r2
+  add r2 1 r2
+  readbu 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L530:
+  bne r2 r0 8
+  jump .L757
+  savpc r15
+  add r15 12 r15
+  jump funchlt
+  read -52 r14 r1
+  jump .L757
+.L532:
+  or r0 r2 r6
+  or r0 r4 r5
+  add r14 -320 r4
+  savpc r15
+  add r15 12 r15
+  jump funclval
+  read -136 r14 r2
+  read -140 r14 r4
+  read -320 r14 r1
+  write -172 r14 r1
+  add r14 -320 r1
+  add r1 4 r1
+  add r14 -172 r3
+  add r3 4 r3
+  read 0 r1 r1
+  write 0 r3 r1
+  add r2 8 r1
+  read 0 r1 r5
+  add r14 -328 r6
+  add r14 -172 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -328 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -172 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -328 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcload
+  jump .L757
+.L533:
+  add r2 20 r1
+  read 0 r1 r6
+  or r0 r4 r5
+  add r14 -304 r4
+  savpc r15
+  add r15 12 r15
+  jump funclval
+  read -136 r14 r2
+  read -140 r14 r4
+  read -304 r14 r1
+  write -172 r14 r1
+  add r14 -304 r1
+  add r1 4 r1
+  add r14 -172 r3
+  add r3 4 r3
+  read 0 r1 r1
+  write 0 r3 r1
+  add r2 20 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r5
+  add r14 -312 r6
+  add r14 -172 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -312 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -172 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -312 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcload
+  write -88 r14 r1
+  read -136 r14 r2
+  add r2 8 r1
+  read 0 r1 r5
+  write -76 r14 r5
+  read 0 r5 r1
+  load 12 r2
+  beq r1 r2 .L545
+  add r5 4 r1
+  read 0 r1 r1
+  and r1 2 r2
+  bne r2 r0 .L543
+  and r1 32 r1
+  bne r1 r0 .L537
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.159 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L757
+.L537:
+  add r5 12 r1
+  read 0 r1 r1
+  load 4 r2
+  beq r1 r2 .L540
+  load 4 r1
+  write -68 r14 r1
+  jump .L542
+.L540:
+  load 3 r1
+  write -68 r14 r1
+.L542:
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r2
+  read -68 r14 r3
+  read -76 r14 r5
+  or r0 r2 r1
+  read -136 r14 r2
+  write 0 r1 r3
+  add r1 8 r4
+  load 1 r3
+  write 0 r4 r3
+  jump .L544
+.L543:
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r2
+  read -76 r14 r5
+  or r0 r2 r1
+  read -136 r14 r2
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r4
+  load 1 r3
+  write 0 r4 r3
+.L544:
+  write -80 r14 r1
+  jump .L548
+.L545:
+  add r5 20 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r3
+  write -72 r14 r3
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r2
+  read -72 r14 r3
+  read -76 r14 r5
+  or r0 r2 r1
+  read -136 r14 r2
+  load 2 r4
+  write 0 r1 r4
+  add r1 8 r4
+  write 0 r4 r3
+  write -80 r14 r1
+.L548:
+  add r2 16 r1
+  read 0 r1 r1
+  load 72 r2
+  beq r1 r2 .L551
+  load 2 r1
+  write -84 r14 r1
+  jump .L553
+.L551:
+  load 1 r1
+  write -84 r14 r1
+.L553:
+  add r14 -288 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -80 r14 r2
+  read -84 r14 r5
+  read -88 r14 r1
+  read -140 r14 r4
+  readb -288 r14 r6
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  read -136 r14 r2
+  read -140 r14 r4
+  load32 -12 r3
+  sub r13 r3 r13
+  add r2 8 r3
+  read 0 r3 r5
+  or r0 r2 r3
+  add r2 12 r2
+  read 0 r2 r6
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -296 r7
+  add r14 -172 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -296 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -172 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -296 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcstore
+  or r0 r1 r2
+  read -88 r14 r1
+  read -136 r14 r3
+  load32 -12 r4
+  sub r13 r4 r13
+  add r3 32 r3
+  readbu 0 r3 r3
+  beq r3 r0 8
+  jump .L757
+  or r0 r2 r1
+  jump .L757
+.L555:
+  add r2 16 r1
+  read 0 r1 r1
+  load 75 r3
+  beq r1 r3 .L566
+  load 75 r3
+  blt r1 r3 .L561
+  load 77 r3
+  beq r1 r3 .L560
+  load 77 r2
+  sltu r1 r2 r1
+  jump .L563
+.L560:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  write -92 r14 r1
+  read -136 r14 r2
+  add r2 8 r1
+  read 0 r1 r5
+  add r14 -236 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -92 r14 r7
+  read -140 r14 r4
+  readb -236 r14 r6
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 3 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L757
+.L561:
+  load 74 r3
+  beq r1 r3 .L565
+  load 74 r2
+  sltu r1 r2 r1
+.L563:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.160 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -136 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L564:
+  read 0 r2 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.170 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  jump .L757
+.L565:
+  add r2 20 r1
+  read 0 r1 r6
+  or r0 r4 r5
+  add r14 -252 r4
+  savpc r15
+  add r15 12 r15
+  jump funclval
+  read -252 r14 r1
+  write -172 r14 r1
+  add r14 -252 r2
+  add r2 4 r2
+  add r14 -172 r3
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  jump .L757
+.L566:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -136 r14 r2
+  read -140 r14 r4
+  add r2 8 r2
+  read 0 r2 r5
+  write -152 r14 r1
+  add r14 -152 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -244 r6
+  add r14 -152 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -244 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -152 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -244 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcload
+  jump .L757
+.L567:
+  add r2 28 r1
+  read 0 r1 r5
+  beq r5 r0 .L569
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -136 r14 r2
+  read -140 r14 r4
+.L569:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r7
+  read -136 r14 r2
+  read -140 r14 r4
+  add r2 8 r1
+  read 0 r1 r5
+  add r2 20 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump convert
+  jump .L757
+.L570:
+  add r2 32 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  write -104 r14 r1
+  read -136 r14 r2
+  read -140 r14 r4
+  add r2 16 r1
+  read 0 r1 r1
+  load 1 r3
+  load 93 r5
+  beq r1 r5 .L572
+  xor r1 92 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L573
+.L572:
+  or r0 r3 r1
+.L573:
+  bne r1 r0 .L692
+  add r2 32 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  write -96 r14 r1
+  read -136 r14 r2
+  add r2 32 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r1
+  read 0 r1 r3
+  load 12 r4
+  bne r3 r4 .L576
+  addr2reg typeulong r1
+.L576:
+  add r2 16 r3
+  read 0 r3 r3
+  load 74 r4
+  sub r3 r4 r4
+  load 18 r3
+  blt r4 r3 .L580
+  load 0 r1
+  or r0 r1 r5
+  jump .L689
+.L580:
+  load 0 r3
+  shiftl r4 2 r5
+  addr2reg .Ljt580 r4
+  add r4 r5 r4
+  read 0 r4 r4
+  jumpr 0 r4
+.L581:
+  load 13 r1
+  or r0 r1 r5
+  jump .L689
+.L583:
+  load 5 r1
+  or r0 r1 r5
+  jump .L689
+.L585:
+  load 1 r1
+  or r0 r1 r5
+  jump .L689
+.L587:
+  load 2 r1
+  or r0 r1 r5
+  jump .L689
+.L589:
+  or r0 r3 r5
+  jump .L689
+.L590:
+  add r1 4 r3
+  read 0 r3 r3
+  and r3 2 r4
+  load 1 r3
+  beq r4 r0 .L592
+  add r1 40 r1
+  readbu 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L593
+.L592:
+  or r0 r3 r1
+.L593:
+  bne r1 r0 .L595
+  load 8 r1
+  jump .L596
+.L595:
+  load 4 r1
+.L596:
+  or r0 r1 r5
+  jump .L689
+.L597:
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L599
+  load 10 r1
+  jump .L600
+.L599:
+  load 9 r1
+.L600:
+  or r0 r1 r5
+  jump .L689
+.L601:
+  load 16 r1
+  or r0 r1 r5
+  jump .L689
+.L603:
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L605
+  load 15 r1
+  jump .L606
+.L605:
+  load 14 r1
+.L606:
+  or r0 r1 r5
+  jump .L689
+.L607:
+  add r1 12 r3
+  read 0 r3 r3
+  load 4 r4
+  ble r3 r4 .L615
+  add r1 4 r3
+  read 0 r3 r3
+  and r3 32 r3
+  bne r3 r0 .L613
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L611
+  load 51 r1
+  jump .L612
+.L611:
+  load 47 r1
+.L612:
+  or r0 r1 r5
+  jump .L689
+.L613:
+  load 65 r1
+  or r0 r1 r5
+  jump .L689
+.L615:
+  add r1 4 r3
+  read 0 r3 r3
+  and r3 32 r3
+  bne r3 r0 .L620
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L618
+  load 41 r1
+  jump .L619
+.L618:
+  load 37 r1
+.L619:
+  or r0 r1 r5
+  jump .L689
+.L620:
+  load 57 r1
+  or r0 r1 r5
+  jump .L689
+.L622:
+  add r1 12 r3
+  read 0 r3 r3
+  load 4 r4
+  ble r3 r4 .L630
+  add r1 4 r3
+  read 0 r3 r3
+  and r3 32 r3
+  bne r3 r0 .L628
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L626
+  load 53 r1
+  jump .L627
+.L626:
+  load 49 r1
+.L627:
+  or r0 r1 r5
+  jump .L689
+.L628:
+  load 67 r1
+  or r0 r1 r5
+  jump .L689
+.L630:
+  add r1 4 r3
+  read 0 r3 r3
+  and r3 32 r3
+  bne r3 r0 .L635
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L633
+  load 43 r1
+  jump .L634
+.L633:
+  load 39 r1
+.L634:
+  or r0 r1 r5
+  jump .L689
+.L635:
+  load 59 r1
+  or r0 r1 r5
+  jump .L689
+.L637:
+  add r1 12 r3
+  read 0 r3 r3
+  load 4 r4
+  ble r3 r4 .L645
+  add r1 4 r3
+  read 0 r3 r3
+  and r3 32 r3
+  bne r3 r0 .L643
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L641
+  load 50 r1
+  jump .L642
+.L641:
+  load 46 r1
+.L642:
+  or r0 r1 r5
+  jump .L689
+.L643:
+  load 64 r1
+  or r0 r1 r5
+  jump .L689
+.L645:
+  add r1 4 r3
+  read 0 r3 r3
+  and r3 32 r3
+  bne r3 r0 .L650
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L648
+  load 40 r1
+  jump .L649
+.L648:
+  load 36 r1
+.L649:
+  or r0 r1 r5
+  jump .L689
+.L650:
+  load 56 r1
+  or r0 r1 r5
+  jump .L689
+.L652:
+  add r1 12 r3
+  read 0 r3 r3
+  load 4 r4
+  ble r3 r4 .L660
+  add r1 4 r3
+  read 0 r3 r3
+  and r3 32 r3
+  bne r3 r0 .L658
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L656
+  load 52 r1
+  jump .L657
+.L656:
+  load 48 r1
+.L657:
+  or r0 r1 r5
+  jump .L689
+.L658:
+  load 66 r1
+  or r0 r1 r5
+  jump .L689
+.L660:
+  add r1 4 r3
+  read 0 r3 r3
+  and r3 32 r3
+  bne r3 r0 .L665
+  add r1 40 r1
+  readbu 0 r1 r1
+  bne r1 r0 .L663
+  load 42 r1
+  jump .L664
+.L663:
+  load 38 r1
+.L664:
+  or r0 r1 r5
+  jump .L689
+.L665:
+  load 58 r1
+  or r0 r1 r5
+  jump .L689
+.L667:
+  add r1 12 r3
+  read 0 r3 r3
+  load 4 r4
+  ble r3 r4 .L672
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 32 r1
+  bne r1 r0 .L670
+  load 44 r1
+  jump .L671
+.L670:
+  load 62 r1
+.L671:
+  or r0 r1 r5
+  jump .L689
+.L672:
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 32 r1
+  bne r1 r0 .L674
+  load 34 r1
+  jump .L675
+.L674:
+  load 54 r1
+.L675:
+  or r0 r1 r5
+  jump .L689
+.L676:
+  add r1 12 r3
+  read 0 r3 r3
+  load 4 r4
+  ble r3 r4 .L681
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 32 r1
+  bne r1 r0 .L679
+  load 45 r1
+  jump .L680
+.L679:
+  load 63 r1
+.L680:
+  or r0 r1 r5
+  jump .L689
+.L681:
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 32 r1
+  bne r1 r0 .L683
+  load 35 r1
+  jump .L684
+.L683:
+  load 55 r1
+.L684:
+  or r0 r1 r5
+  jump .L689
+.L685:
+  load 12 r1
+  or r0 r1 r5
+  jump .L689
+.L687:
+  load 11 r1
+  or r0 r1 r5
+.L689:
+  write -100 r14 r5
+  bne r5 r0 .L691
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.163 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -136 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L691:
+  add r2 8 r1
+  read 0 r1 r5
+  add r14 -224 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -100 r14 r5
+  read -96 r14 r2
+  read -104 r14 r1
+  read -140 r14 r4
+  readb -224 r14 r6
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L757
+.L692:
+  addr2reg .Lstring.161 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -164 r2
+  add r2 0 r2
+  write 0 r2 r1
+  addr2reg .Lstring.162 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  read -104 r14 r5
+  read -136 r14 r2
+  read -140 r14 r4
+  add r14 -164 r3
+  add r3 4 r3
+  write 0 r3 r1
+  add r2 32 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r6
+  add r2 16 r1
+  read 0 r1 r1
+  load 93 r2
+  beq r1 r2 .L696
+  add r14 -164 r1
+  add r1 0 r1
+  read 0 r1 r7
+  add r14 -164 r1
+  add r1 4 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcjnz
+  load32 -12 r1
+  sub r13 r1 r13
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -136 r14 r2
+  read -140 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r5
+  load 0 r3
+  write 0 r5 r3
+  add r14 -164 r3
+  add r3 4 r3
+  read 0 r3 r3
+  add r3 24 r3
+  add r3 12 r3
+  add r3 0 r3
+  write 0 r3 r1
+  jump .L699
+.L696:
+  add r14 -164 r1
+  add r1 4 r1
+  read 0 r1 r7
+  add r14 -164 r1
+  add r1 0 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcjnz
+  load32 -12 r1
+  sub r13 r1 r13
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -136 r14 r2
+  read -140 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r5
+  load 1 r3
+  write 0 r5 r3
+  add r14 -164 r3
+  add r3 4 r3
+  read 0 r3 r3
+  add r3 24 r3
+  add r3 12 r3
+  add r3 0 r3
+  write 0 r3 r1
+.L699:
+  add r4 24 r1
+  read 0 r1 r1
+  add r14 -164 r3
+  add r3 4 r3
+  read 0 r3 r3
+  add r3 24 r3
+  add r3 4 r3
+  add r3 0 r3
+  write 0 r3 r1
+  add r14 -164 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r4 24 r3
+  read 0 r3 r3
+  add r3 84 r3
+  write 0 r3 r1
+  add r4 24 r3
+  write 0 r3 r1
+  add r2 32 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r7
+  read -136 r14 r2
+  read -140 r14 r4
+  add r2 32 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r6
+  addr2reg typebool r5
+  savpc r15
+  add r15 12 r15
+  jump convert
+  read -140 r14 r4
+  add r14 -164 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r2 24 r2
+  add r2 12 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r4 24 r1
+  read 0 r1 r1
+  add r14 -164 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r2 24 r2
+  add r2 4 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -164 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r4 24 r2
+  read 0 r2 r2
+  add r2 84 r2
+  write 0 r2 r1
+  add r4 24 r2
+  write 0 r2 r1
+  add r14 -164 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 24 r1
+  add r1 20 r5
+  savpc r15
+  add r15 12 r15
+  jump functemp
+  add r14 -164 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 24 r2
+  load 119 r1
+  write 0 r2 r1
+  add r14 -164 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 24 r1
+  add r1 20 r1
+  jump .L757
+.L704:
+  addr2reg .Lstring.164 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -164 r2
+  add r2 0 r2
+  write 0 r2 r1
+  addr2reg .Lstring.165 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -164 r2
+  add r2 4 r2
+  write 0 r2 r1
+  addr2reg .Lstring.166 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  read -136 r14 r2
+  read -140 r14 r4
+  add r14 -164 r3
+  add r3 8 r3
+  write 0 r3 r1
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r5
+  read -136 r14 r2
+  read -140 r14 r4
+  add r2 20 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r6
+  add r14 -164 r1
+  add r1 0 r1
+  read 0 r1 r7
+  add r14 -164 r1
+  add r1 4 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcjnz
+  read -136 r14 r2
+  read -140 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  add r14 -164 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r4 24 r3
+  read 0 r3 r3
+  add r3 84 r3
+  write 0 r3 r1
+  add r4 24 r3
+  write 0 r3 r1
+  add r2 32 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -140 r14 r4
+  add r14 -164 r2
+  add r2 8 r2
+  read 0 r2 r2
+  add r2 24 r2
+  add r2 12 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r4 24 r1
+  read 0 r1 r1
+  add r14 -164 r2
+  add r2 8 r2
+  read 0 r2 r2
+  add r2 24 r2
+  add r2 4 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -164 r1
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcjmp
+  read -136 r14 r2
+  read -140 r14 r4
+  add r14 -164 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r4 24 r3
+  read 0 r3 r3
+  add r3 84 r3
+  write 0 r3 r1
+  add r4 24 r3
+  write 0 r3 r1
+  add r2 32 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -136 r14 r2
+  read -140 r14 r4
+  add r14 -164 r3
+  add r3 8 r3
+  read 0 r3 r3
+  add r3 24 r3
+  add r3 12 r3
+  add r3 4 r3
+  write 0 r3 r1
+  add r4 24 r1
+  read 0 r1 r1
+  add r14 -164 r3
+  add r3 8 r3
+  read 0 r3 r3
+  add r3 24 r3
+  add r3 4 r3
+  add r3 4 r3
+  write 0 r3 r1
+  add r14 -164 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r4 24 r3
+  read 0 r3 r3
+  add r3 84 r3
+  write 0 r3 r1
+  add r4 24 r3
+  write 0 r3 r1
+  add r2 8 r1
+  read 0 r1 r1
+  addr2reg typevoid r2
+  beq r1 r2 .L712
+  add r14 -164 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 24 r1
+  add r1 20 r5
+  savpc r15
+  add r15 12 r15
+  jump functemp
+  read -136 r14 r2
+  add r2 8 r1
+  read 0 r1 r5
+  add r14 -212 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  readb -212 r14 r1
+  add r14 -164 r2
+  add r2 8 r2
+  read 0 r2 r2
+  add r2 24 r2
+  write 0 r2 r1
+  add r14 -164 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 24 r1
+  add r1 20 r1
+  jump .L757
+.L712:
+  load 0 r1
+  jump .L757
+.L713:
+  add r2 32 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -136 r14 r2
+  read -140 r14 r4
+  write -108 r14 r1
+  add r2 32 r3
+  read 0 r3 r3
+  read 0 r3 r5
+  load 14 r6
+  beq r5 r6 .L716
+  or r0 r3 r2
+  or r0 r2 r6
+  or r0 r4 r5
+  add r14 -192 r4
+  savpc r15
+  add r15 12 r15
+  jump funclval
+  read -108 r14 r1
+  read -136 r14 r2
+  read -140 r14 r4
+  read -192 r14 r3
+  write -172 r14 r3
+  add r14 -192 r3
+  add r3 4 r3
+  add r14 -172 r5
+  add r5 4 r5
+  read 0 r3 r3
+  write 0 r5 r3
+  add r2 32 r2
+  read 0 r2 r2
+  add r2 8 r3
+  read 0 r3 r5
+  add r2 12 r2
+  read 0 r2 r6
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -200 r7
+  add r14 -172 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -200 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -172 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -200 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcstore
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L757
+.L716:
+  or r0 r3 r2
+  add r2 32 r2
+  write 0 r2 r1
+  jump .L757
+.L718:
+  add r2 20 r1
+  read 0 r1 r5
+  or r0 r5 r1
+.L720:
+  write -112 r14 r1
+  add r1 24 r2
+  read 0 r2 r2
+  beq r2 r0 .L723
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -112 r14 r1
+  read -140 r14 r4
+  add r1 24 r1
+  read 0 r1 r1
+  jump .L720
+.L723:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  jump .L757
+.L725:
+  add r2 32 r1
+  read 0 r1 r1
+  load 19 r3
+  bge r1 r3 .L732
+  shiftl r1 2 r3
+  addr2reg .Ljt727 r1
+  add r1 r3 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L728:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r7
+  read -140 r14 r4
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 16 r1
+  read 0 r1 r1
+  load 4 r2
+  beq r1 r2 .L730
+  load 108 r1
+  jump .L731
+.L730:
+  load 119 r1
+.L731:
+  or r0 r1 r6
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 33 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L757
+.L732:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.168 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L746
+.L733:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -136 r14 r2
+  read -140 r14 r4
+  add r2 32 r3
+  add r3 4 r3
+  read 0 r3 r3
+  beq r3 r0 .L757
+  add r4 48 r3
+  write 0 r3 r1
+  add r2 32 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r4 52 r3
+  write 0 r3 r2
+  jump .L757
+.L735:
+  load 0 r1
+  jump .L757
+.L736:
+  add r2 28 r1
+  read 0 r1 r5
+  beq r5 r0 .L738
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -136 r14 r2
+  read -140 r14 r4
+.L738:
+  add r2 8 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 16 r1
+  bne r1 r0 .L740
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.167 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -136 r14 r2
+  read -140 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L740:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  write -116 r14 r1
+  read -136 r14 r2
+  add r2 8 r1
+  read 0 r1 r5
+  add r14 -184 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -116 r14 r7
+  read -140 r14 r4
+  readb -184 r14 r6
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 90 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L757
+.L741:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r7
+  read -140 r14 r4
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r6
+  load 89 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r1
+  sub r13 r1 r13
+  jump .L746
+.L742:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  write -120 r14 r1
+  read -136 r14 r2
+  read -140 r14 r4
+  add r2 20 r1
+  read 0 r1 r1
+  add r1 24 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -120 r14 r7
+  read -140 r14 r4
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 119 r6
+  load 6 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L757
+.L743:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  write -124 r14 r1
+  read -136 r14 r2
+  read -140 r14 r4
+  add r2 20 r1
+  read 0 r1 r1
+  add r1 24 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -124 r14 r7
+  read -140 r14 r4
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 119 r6
+  load 7 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L757
+.L744:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  write -128 r14 r1
+  read -136 r14 r2
+  read -140 r14 r4
+  add r2 20 r1
+  read 0 r1 r1
+  add r1 24 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r7
+  read -128 r14 r1
+  read -140 r14 r4
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 0 r6
+  load 20 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r1
+  sub r13 r1 r13
+  jump .L746
+.L745:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  write -132 r14 r1
+  read -136 r14 r2
+  read -140 r14 r4
+  add r2 20 r1
+  read 0 r1 r1
+  add r1 24 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r7
+  read -132 r14 r1
+  read -140 r14 r4
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 0 r6
+  load 22 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r1
+  sub r13 r1 r13
+.L746:
+  load 0 r1
+  jump .L757
+.L747:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r7
+  read -140 r14 r4
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 119 r6
+  load 26 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L757
+.L748:
+  add r2 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r7
+  read -140 r14 r4
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 119 r6
+  load 30 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L757
+.L749:
+  add r2 32 r1
+  read 0 r1 r1
+  bne r1 r0 .L751
+  load 1012 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.169 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -136 r14 r2
+.L751:
+  add r2 32 r1
+  read 0 r1 r1
+  jump .L757
+.L752:
+  add r2 32 r1
+  read 0 r1 r1
+  write -144 r14 r1
+  read 0 r1 r2
+  load 13 r3
+  beq r2 r3 .L754
+  load 1016 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.122 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -144 r14 r1
+  read -140 r14 r4
+.L754:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump calcvla
+  read -144 r14 r1
+  read -136 r14 r2
+  read -140 r14 r4
+  add r2 20 r3
+  read 0 r3 r5
+  beq r5 r0 .L756
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -144 r14 r1
+.L756:
+  add r1 40 r1
+  add r1 8 r1
+  read 0 r1 r1
+.L757:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt479:
+  .int .L480
+  .int .L488
+  .int .L564
+  .int .L502
+  .int .L532
+  .int .L533
+  .int .L532
+  .int .L555
+  .int .L567
+  .int .L570
+  .int .L704
+  .int .L713
+  .int .L718
+  .int .L725
+  .int .L749
+  .int .L752
+
+.rdata
+.balign 4
+.Ljt580:
+  .int .L581
+  .int .L583
+  .int .L585
+  .int .L587
+  .int .L589
+  .int .L589
+  .int .L590
+  .int .L597
+  .int .L601
+  .int .L603
+  .int .L607
+  .int .L622
+  .int .L637
+  .int .L652
+  .int .L667
+  .int .L676
+  .int .L685
+  .int .L687
+
+.rdata
+.balign 4
+.Ljt727:
+  .int .L728
+  .int .L732
+  .int .L733
+  .int .L732
+  .int .L732
+  .int .L732
+  .int .L732
+  .int .L735
+  .int .L736
+  .int .L732
+  .int .L732
+  .int .L732
+  .int .L741
+  .int .L742
+  .int .L743
+  .int .L744
+  .int .L745
+  .int .L747
+  .int .L748
+
+/* end function funcexpr */
+
+.data
+.balign 4
+.Lstore.172:
+	.fill 4,1,0
+	.int 22
+	.int 21
+	.fill 4,1,0
+	.int 20
+	.fill 12,1,0
+	.int 19
+/* end data */
+
+.data
+.balign 4
+.Lz.173:
+	.int 2
+	.fill 8,1,0
+/* end data */
+
+
+.text
+; function zero
+zero:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  write -36 r14 r8
+  read 8 r14 r8
+  write -12 r14 r8
+  or r0 r7 r2
+  or r0 r6 r1
+  write -24 r14 r1
+  write -16 r14 r5
+  write -20 r14 r4
+  load 1 r3
+.L761:
+  write -28 r14 r2
+  write -32 r14 r3
+  bge r2 r8 .L774
+  load 1 r6
+  sub r1 r6 r6
+  and r2 r6 r6
+  sub r1 r6 r6
+  and r6 r3 r6
+  beq r6 r0 .L772
+  beq r2 r0 .L771
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 16 r1
+  read 0 r1 r1
+  load 4 r2
+  beq r1 r2 .L767
+  load 108 r1
+  write -8 r14 r1
+  jump .L769
+.L767:
+  load 119 r1
+  write -8 r14 r1
+.L769:
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -28 r14 r2
+  read -8 r14 r6
+  read -16 r14 r5
+  read -20 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  or r0 r5 r7
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r5
+  read -32 r14 r3
+  read -20 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+.L771:
+  shiftl r3 2 r2
+  addr2reg .Lstore.172 r1
+  add r1 r2 r2
+  or r0 r5 r1
+  read 0 r2 r5
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  addr2reg .Lz.173 r7
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  read -28 r14 r2
+  read -32 r14 r3
+  read -12 r14 r8
+  read -24 r14 r1
+  read -16 r14 r5
+  read -20 r14 r4
+  load32 -12 r6
+  sub r13 r6 r13
+  add r2 r3 r2
+.L772:
+  bges r3 r1 .L761
+  shiftl r3 1 r3
+  jump .L761
+.L774:
+  read -36 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function zero */
+
+
+.text
+; function funcinit
+.global funcinit
+funcinit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 132 r13
+  write -124 r14 r8
+  write -8 r14 r7
+  write -12 r14 r6
+  or r0 r5 r1
+  write -76 r14 r1
+  write -80 r14 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcalloc
+  read -8 r14 r7
+  read -12 r14 r6
+  read -76 r14 r1
+  read -80 r14 r4
+  and r7 0xFF r2
+  beq r2 r0 .L838
+  load 0 r3
+  load 0 r2
+  or r0 r1 r5
+  or r0 r3 r1
+  write -96 r14 r2
+.L780:
+  write -92 r14 r6
+  write -16 r14 r1
+  beq r6 r0 .L836
+  add r5 20 r3
+  or r0 r5 r2
+  read 0 r3 r5
+  add r2 12 r2
+  read 0 r2 r2
+  add r2 8 r3
+  or r0 r6 r2
+  read 0 r3 r6
+  read 0 r2 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  savpc r15
+  add r15 12 r15
+  jump zero
+  read -92 r14 r6
+  read -16 r14 r1
+  read -76 r14 r5
+  read -80 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  add r6 12 r3
+  add r14 -104 r2
+  add r2 4 r7
+  readhu 0 r3 r2
+  writeh 0 r7 r2
+  add r3 2 r3
+  add r7 2 r7
+  readhu 0 r3 r3
+  write -28 r14 r3
+  writeh 0 r7 r3
+  add r6 8 r3
+  read 0 r3 r3
+  write -20 r14 r3
+  read 0 r3 r3
+  load 2 r7
+  xor r3 r7 r7
+  sltu r7 1 r7
+  read -20 r14 r3
+  bne r7 r0 .L800
+  add r6 4 r3
+  read 0 r3 r3
+  write -40 r14 r3
+  load 0 r7
+  write -24 r14 r7
+  sltu r1 r3 r8
+  read -24 r14 r7
+  bne r8 r0 .L784
+  or r0 r3 r2
+  or r0 r7 r3
+  jump .L788
+.L784:
+  read -28 r14 r3
+  shiftl r2 16 r8
+  shiftrs r8 16 r8
+  write -32 r14 r8
+  read -40 r14 r2
+  load 1 r7
+  write -36 r14 r7
+  read -32 r14 r8
+  read -36 r14 r7
+  bne r8 r0 .L786
+  read -40 r14 r2
+  shiftl r3 16 r3
+  shiftrs r3 16 r3
+  shiftl r3 16 r3
+  shiftr r3 16 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  jump .L787
+.L786:
+  or r0 r7 r3
+.L787:
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L788:
+  beq r3 r0 .L790
+  or r0 r5 r3
+  add r5 20 r5
+  read 0 r5 r5
+  add r3 12 r3
+  read 0 r3 r3
+  add r3 8 r3
+  read 0 r3 r6
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r2
+  or r0 r1 r7
+  savpc r15
+  add r15 12 r15
+  jump zero
+  read -92 r14 r6
+  read -76 r14 r5
+  read -80 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+.L790:
+  add r5 20 r1
+  read 0 r1 r7
+  write -52 r14 r7
+  write -104 r14 r7
+  read 0 r6 r2
+  write -48 r14 r2
+  ble r2 r0 .L798
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 16 r1
+  read 0 r1 r1
+  load 4 r2
+  beq r1 r2 .L794
+  load 108 r1
+  write -44 r14 r1
+  jump .L796
+.L794:
+  load 119 r1
+  write -44 r14 r1
+.L796:
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -44 r14 r6
+  read -48 r14 r2
+  read -52 r14 r7
+  read -80 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  read -92 r14 r6
+  read -80 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  write -104 r14 r1
+.L798:
+  add r6 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -92 r14 r6
+  read -80 r14 r4
+  add r6 8 r2
+  read 0 r2 r2
+  add r2 8 r2
+  read 0 r2 r5
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -112 r7
+  add r14 -104 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -112 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -104 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -112 r2
+  add r2 4 r2
+  write 0 r2 r1
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump funcstore
+  read -92 r14 r6
+  read -96 r14 r1
+  read -76 r14 r5
+  read -80 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  add r6 4 r2
+  read 0 r2 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L832
+.L800:
+  or r0 r3 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r3
+  write -88 r14 r3
+  load 0 r1
+  or r0 r1 r2
+  or r0 r3 r1
+.L803:
+  write -84 r14 r2
+  add r6 8 r3
+  read 0 r3 r3
+  add r3 32 r3
+  read 0 r3 r4
+  load 0 r3
+  blt r2 r4 .L805
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  jump .L806
+.L805:
+  or r0 r2 r3
+  mults r2 r1 r2
+  add r6 4 r4
+  read 0 r4 r4
+  read 0 r6 r5
+  sub r4 r5 r4
+  sltu r2 r4 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L806:
+  beq r2 r0 .L830
+  or r0 r1 r2
+  read 0 r6 r1
+  mults r3 r2 r2
+  add r1 r2 r2
+  write -56 r14 r2
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -56 r14 r2
+  read -76 r14 r5
+  read -80 r14 r4
+  write -60 r14 r1
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  addr2reg targ r12
+  read 0 r12 r2
+  add r2 16 r2
+  read 0 r2 r2
+  load 4 r3
+  beq r2 r3 .L811
+  load 108 r2
+  jump .L812
+.L811:
+  load 119 r2
+.L812:
+  or r0 r2 r6
+  add r5 20 r2
+  read 0 r2 r7
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r5
+  read -84 r14 r2
+  read -92 r14 r6
+  read -60 r14 r1
+  or r0 r2 r3
+  read -88 r14 r2
+  read -80 r14 r4
+  load32 -12 r7
+  sub r13 r7 r13
+  write -104 r14 r5
+  load 2 r5
+  beq r2 r5 .L825
+  load 2 r5
+  blt r2 r5 .L820
+  load 4 r5
+  beq r2 r5 .L817
+  load 4 r3
+  sltu r2 r3 r2
+  jump .L828
+.L817:
+  or r0 r3 r2
+  add r6 8 r1
+  read 0 r1 r1
+  add r1 32 r1
+  add r1 4 r1
+  read 0 r1 r1
+  or r0 r2 r3
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r2
+  write -64 r14 r2
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -92 r14 r6
+  read -64 r14 r2
+  read -80 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  jump .L828
+.L820:
+  load 1 r5
+  beq r2 r5 .L822
+  load 1 r3
+  sltu r2 r3 r2
+  jump .L828
+.L822:
+  or r0 r3 r2
+  add r6 8 r1
+  read 0 r1 r1
+  add r1 32 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r1 r2 r1
+  readbu 0 r1 r2
+  write -68 r14 r2
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -92 r14 r6
+  read -68 r14 r2
+  read -80 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  jump .L828
+.L825:
+  or r0 r3 r2
+  add r6 8 r1
+  read 0 r1 r1
+  add r1 32 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 1 r2
+  add r1 r2 r1
+  readhu 0 r1 r2
+  write -72 r14 r2
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -92 r14 r6
+  read -72 r14 r2
+  read -80 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+.L828:
+  add r6 8 r2
+  read 0 r2 r2
+  add r2 8 r2
+  read 0 r2 r2
+  add r2 20 r2
+  read 0 r2 r5
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -120 r7
+  add r14 -104 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r14 -120 r2
+  add r2 0 r2
+  write 0 r2 r1
+  add r14 -104 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -120 r2
+  add r2 4 r2
+  write 0 r2 r1
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump funcstore
+  read -84 r14 r2
+  read -92 r14 r6
+  read -88 r14 r1
+  read -76 r14 r5
+  read -80 r14 r4
+  load32 -12 r3
+  sub r13 r3 r13
+  add r2 1 r2
+  jump .L803
+.L830:
+  or r0 r3 r7
+  or r0 r1 r3
+  read -96 r14 r1
+  read -76 r14 r5
+  read -80 r14 r4
+  or r0 r1 r2
+  read 0 r6 r1
+  mults r7 r3 r3
+  add r1 r3 r1
+.L832:
+  bge r2 r1 .L834
+  or r0 r1 r2
+.L834:
+  add r6 16 r3
+  read 0 r3 r6
+  write -96 r14 r2
+  jump .L780
+.L836:
+  read -96 r14 r7
+  or r0 r5 r1
+  add r1 20 r2
+  read 0 r2 r5
+  add r1 12 r1
+  read 0 r1 r1
+  add r1 8 r2
+  read 0 r2 r6
+  add r1 12 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump zero
+  load32 -12 r1
+  sub r13 r1 r13
+.L838:
+  read -124 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function funcinit */
+
+
+.text
+; function caselist
+caselist:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  beq r4 r0 .L843
+  add r4 4 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump caselist
+  read -12 r14 r5
+  read -16 r14 r4
+  or r0 r5 r1
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump arrayaddptr
+  read -12 r14 r5
+  read -16 r14 r4
+  add r4 4 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump caselist
+.L843:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function caselist */
+
+
+.text
+; function caseruns
+caseruns:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  write -36 r14 r8
+  or r0 r5 r1
+  write -32 r14 r7
+  write -20 r14 r6
+  write -24 r14 r1
+  write -12 r14 r4
+  load 0 r2
+.L847:
+  write -28 r14 r2
+  bge r2 r6 .L866
+  or r0 r2 r3
+  add r2 1 r2
+  load 119 r5
+  beq r4 r5 .L850
+  write -16 r14 r2
+  jump .L865
+.L850:
+  shiftl r3 2 r4
+  add r1 r4 r4
+  read 0 r4 r4
+  read 0 r4 r4
+  load32 -1 r5
+  and r4 r5 r7
+  write -8 r14 r7
+  add r3 1 r4
+  or r0 r7 r5
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+.L852:
+  bge r4 r6 .L863
+  shiftl r4 2 r6
+  add r1 r6 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  load32 -1 r6
+  and r1 r6 r1
+  ble r1 r5 .L862
+  add r4 1 r5
+  sub r5 r2 r5
+  load 0 r6
+  load 4 r7
+  sltu r5 r7 r8
+  xor r8 1 r8
+  read -24 r14 r5
+  read -8 r14 r7
+  bne r8 r0 .L856
+  or r0 r6 r8
+  jump .L857
+.L856:
+  sub r1 r7 r6
+  add r4 1 r5
+  sub r5 r2 r7
+  shiftl r7 1 r5
+  add r5 r7 r7
+  read -24 r14 r5
+  sltu r6 r7 r6
+  read -8 r14 r7
+  xor r6 0 r6
+  sltu r0 r6 r8
+.L857:
+  read -20 r14 r6
+  bne r8 r0 .L859
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  jump .L860
+.L859:
+  or r0 r2 r3
+  add r4 1 r2
+.L860:
+  add r4 1 r4
+  or r0 r5 r12
+  or r0 r1 r5
+  or r0 r12 r1
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+  jump .L852
+.L862:
+  read -32 r14 r7
+  jump .L864
+.L863:
+  read -32 r14 r7
+.L864:
+  write -16 r14 r3
+.L865:
+  load 8 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump arrayadd
+  or r0 r1 r5
+  read -16 r14 r2
+  read -28 r14 r3
+  read -20 r14 r6
+  read -24 r14 r1
+  read -12 r14 r4
+  shiftl r3 2 r7
+  add r1 r7 r7
+  write 0 r5 r7
+  read -32 r14 r7
+  sub r2 r3 r3
+  add r5 4 r5
+  write 0 r5 r3
+  jump .L847
+.L866:
+  read -36 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function caseruns */
+
+
+.text
+; function funcjtab
+funcjtab:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -12 r14 r7
+  write -28 r14 r5
+  write -20 r14 r6
+  add r4 24 r1
+  read 0 r1 r1
+  write -32 r14 r1
+  read 0 r6 r1
+  add r1 0 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  load32 -1 r3
+  and r2 r3 r4
+  write -16 r14 r4
+  add r6 4 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  load32 -1 r2
+  and r1 r2 r1
+  sub r1 r4 r1
+  add r1 1 r3
+  write -24 r14 r3
+  load 4 r6
+  or r0 r3 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump xreallocarray
+  or r0 r1 r2
+  read -24 r14 r3
+  read -16 r14 r4
+  read -12 r14 r7
+  read -20 r14 r6
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L871:
+  bge r2 r3 .L874
+  shiftl r2 2 r5
+  add r1 r5 r5
+  write 0 r5 r7
+  add r2 1 r2
+  jump .L871
+.L874:
+  or r0 r1 r2
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L877:
+  add r6 4 r3
+  read 0 r3 r3
+  bge r2 r3 .L880
+  read 0 r6 r5
+  shiftl r2 2 r3
+  add r5 r3 r3
+  read 0 r3 r3
+  add r3 20 r3
+  read 0 r3 r3
+  shiftl r2 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  read 0 r5 r5
+  load32 -1 r7
+  and r5 r7 r5
+  sub r5 r4 r5
+  shiftl r5 2 r5
+  add r1 r5 r5
+  write 0 r5 r3
+  add r2 1 r2
+  jump .L877
+.L880:
+  or r0 r1 r2
+  read -24 r14 r3
+  read -32 r14 r1
+  read -28 r14 r5
+  add r1 56 r6
+  load 5 r4
+  write 0 r6 r4
+  add r1 56 r4
+  add r4 4 r4
+  write 0 r4 r5
+  add r1 56 r4
+  add r4 16 r4
+  write 0 r4 r2
+  add r1 56 r1
+  add r1 20 r1
+  write 0 r1 r3
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function funcjtab */
+
+.data
+.balign 1
+.Lstring.179:
+	.ascii "switch_ge\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.180:
+	.ascii "switch_ne\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.181:
+	.ascii "switch_lt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.182:
+	.ascii "switch_gt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.183:
+	.ascii "switch_tab\000"
+/* end data */
+
+
+.text
+; function casesearch
+casesearch:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 100 r13
+  read 12 r14 r1
+  write -68 r14 r1
+  read 8 r14 r2
+  write -72 r14 r2
+  write -56 r14 r6
+  write -48 r14 r5
+  write -52 r14 r7
+  write -64 r14 r4
+  beq r2 r0 .L917
+  shiftr r2 1 r1
+  shiftl r1 3 r1
+  add r7 r1 r3
+  write -60 r14 r3
+  add r3 4 r1
+  read 0 r1 r1
+  load 1 r2
+  bgt r1 r2 .L888
+  addr2reg .Lstring.180 r1
+  jump .L889
+.L888:
+  addr2reg .Lstring.179 r1
+.L889:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -92 r2
+  add r2 0 r2
+  write 0 r2 r1
+  addr2reg .Lstring.181 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -92 r2
+  add r2 4 r2
+  write 0 r2 r1
+  addr2reg .Lstring.182 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  read -60 r14 r3
+  add r14 -92 r2
+  add r2 8 r2
+  write 0 r2 r1
+  read 0 r3 r1
+  add r1 0 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  write -12 r14 r1
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -60 r14 r3
+  read -52 r14 r7
+  read -56 r14 r6
+  read -48 r14 r5
+  read -64 r14 r4
+  write -32 r14 r1
+  load 2 r2
+  write 0 r1 r2
+  or r0 r1 r2
+  read -12 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  add r3 4 r1
+  read 0 r1 r1
+  load 1 r2
+  sltu r2 r1 r2
+  read -32 r14 r1
+  bne r2 r0 .L905
+  load 119 r2
+  beq r5 r2 .L894
+  load 44 r2
+  jump .L895
+.L894:
+  load 34 r2
+.L895:
+  or r0 r2 r5
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  or r0 r6 r7
+  load 119 r6
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r5
+  read -60 r14 r3
+  read -64 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  read 0 r3 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r7
+  add r14 -92 r1
+  add r1 0 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump funcjnz
+  read -32 r14 r1
+  read -56 r14 r6
+  read -48 r14 r5
+  read -64 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  add r14 -92 r2
+  add r2 0 r2
+  read 0 r2 r2
+  add r4 24 r3
+  read 0 r3 r3
+  add r3 84 r3
+  write 0 r3 r2
+  add r4 24 r3
+  write 0 r3 r2
+  load 119 r2
+  beq r5 r2 .L899
+  load 51 r2
+  jump .L900
+.L899:
+  load 41 r2
+.L900:
+  or r0 r2 r5
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  or r0 r6 r7
+  load 119 r6
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r5
+  read -64 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  add r14 -92 r1
+  add r1 4 r1
+  read 0 r1 r7
+  add r14 -92 r1
+  add r1 8 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump funcjnz
+  read -60 r14 r3
+  read -52 r14 r7
+  read -56 r14 r6
+  read -48 r14 r5
+  read -64 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  add r14 -92 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r4 24 r2
+  read 0 r2 r2
+  add r2 84 r2
+  write 0 r2 r1
+  add r4 24 r2
+  write 0 r2 r1
+  read -68 r14 r1
+  sub r3 r7 r2
+  shiftrs r2 31 r3
+  shiftr r3 29 r3
+  add r2 r3 r2
+  shiftrs r2 3 r2
+  write -16 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -16 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump casesearch
+  read -60 r14 r3
+  read -52 r14 r7
+  read -56 r14 r6
+  read -48 r14 r5
+  read -64 r14 r4
+  load32 -16 r1
+  sub r13 r1 r13
+  add r14 -92 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r4 24 r2
+  read 0 r2 r2
+  add r2 84 r2
+  write 0 r2 r1
+  add r4 24 r2
+  write 0 r2 r1
+  read -68 r14 r1
+  add r3 8 r2
+  write -20 r14 r2
+  read -72 r14 r2
+  sub r3 r7 r3
+  shiftrs r3 31 r7
+  shiftr r7 29 r7
+  add r3 r7 r3
+  shiftrs r3 3 r3
+  sub r2 r3 r2
+  load 1 r3
+  sub r2 r3 r2
+  write -24 r14 r2
+  read -20 r14 r7
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -24 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump casesearch
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L919
+.L905:
+  ble r3 r7 .L910
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  or r0 r6 r7
+  load 119 r6
+  load 41 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  or r0 r1 r5
+  read -64 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  add r14 -92 r1
+  add r1 4 r1
+  read 0 r1 r7
+  add r14 -92 r1
+  add r1 0 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump funcjnz
+  read -60 r14 r3
+  read -52 r14 r7
+  read -56 r14 r6
+  read -48 r14 r5
+  read -64 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  add r14 -92 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r4 24 r2
+  read 0 r2 r2
+  add r2 84 r2
+  write 0 r2 r1
+  add r4 24 r2
+  write 0 r2 r1
+  read -68 r14 r1
+  sub r3 r7 r2
+  shiftrs r2 31 r3
+  shiftr r3 29 r3
+  add r2 r3 r2
+  shiftrs r2 3 r2
+  write -28 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -28 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump casesearch
+  read -32 r14 r1
+  read -56 r14 r6
+  read -64 r14 r4
+  load32 -16 r2
+  sub r13 r2 r13
+  add r14 -92 r2
+  add r2 0 r2
+  read 0 r2 r2
+  add r4 24 r3
+  read 0 r3 r3
+  add r3 84 r3
+  write 0 r3 r2
+  add r4 24 r3
+  write 0 r3 r2
+.L910:
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  or r0 r6 r7
+  load 119 r6
+  load 2 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  write -44 r14 r1
+  read -60 r14 r3
+  load32 -12 r1
+  sub r13 r1 r13
+  read 0 r3 r2
+  add r3 4 r1
+  read 0 r1 r1
+  load 1 r3
+  sub r1 r3 r1
+  shiftl r1 2 r1
+  add r2 r1 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  add r2 0 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  sub r1 r2 r1
+  add r1 1 r1
+  load32 -1 r2
+  and r1 r2 r2
+  write -36 r14 r2
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -36 r14 r2
+  read -44 r14 r5
+  read -64 r14 r4
+  load 2 r3
+  write 0 r1 r3
+  add r1 8 r3
+  write 0 r3 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  or r0 r5 r7
+  load 119 r6
+  load 41 r5
+  savpc r15
+  add r15 12 r15
+  jump funcinst
+  write -40 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.183 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  read -40 r14 r5
+  read -64 r14 r4
+  add r14 -92 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -92 r1
+  add r1 4 r1
+  read 0 r1 r7
+  add r14 -92 r1
+  add r1 8 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump funcjnz
+  read -44 r14 r5
+  read -60 r14 r3
+  read -68 r14 r1
+  read -64 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  add r14 -92 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r4 24 r6
+  read 0 r6 r6
+  add r6 84 r6
+  write 0 r6 r2
+  add r4 24 r6
+  write 0 r6 r2
+  or r0 r1 r7
+  or r0 r3 r6
+  savpc r15
+  add r15 12 r15
+  jump funcjtab
+  read -60 r14 r3
+  read -52 r14 r7
+  read -56 r14 r6
+  read -48 r14 r5
+  read -64 r14 r4
+  add r14 -92 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r4 24 r2
+  read 0 r2 r2
+  add r2 84 r2
+  write 0 r2 r1
+  add r4 24 r2
+  write 0 r2 r1
+  read -68 r14 r1
+  add r3 8 r2
+  write -76 r14 r2
+  read -72 r14 r2
+  sub r3 r7 r3
+  shiftrs r3 31 r7
+  shiftr r7 29 r7
+  add r3 r7 r3
+  shiftrs r3 3 r3
+  sub r2 r3 r2
+  load 1 r3
+  sub r2 r3 r2
+  write -80 r14 r2
+  read -76 r14 r7
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -80 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump casesearch
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L919
+.L917:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcjmp
+.L919:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function casesearch */
+
+
+.text
+; function funcswitch
+.global funcswitch
+funcswitch:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 76 r13
+  write -16 r14 r7
+  write -20 r14 r5
+  write -24 r14 r4
+  write -12 r14 r6
+  load 0 r1
+  write -56 r14 r1
+  add r14 -56 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -56 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r1
+  write -44 r14 r1
+  add r14 -44 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -44 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  add r6 4 r1
+  read 0 r1 r5
+  add r14 -68 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -12 r14 r6
+  readb -68 r14 r5
+  write -28 r14 r5
+  read 0 r6 r4
+  add r14 -56 r5
+  savpc r15
+  add r15 12 r15
+  jump caselist
+  read -28 r14 r5
+  or r0 r5 r1
+  read -56 r14 r5
+  add r14 -56 r2
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r2 2 r6
+  add r14 -44 r7
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump caseruns
+  read -28 r14 r5
+  read -16 r14 r1
+  read -20 r14 r6
+  read -24 r14 r4
+  read -44 r14 r7
+  add r14 -44 r2
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  write -32 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -32 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump casesearch
+  load32 -16 r1
+  sub r13 r1 r13
+  read -56 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -44 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function funcswitch */
+
+.data
+.balign 1
+.Lsigil.186:
+	.fill 1,1,0
+	.byte 36
+	.fill 3,1,0
+	.byte 37
+	.byte 58
+	.byte 64
+/* end data */
+
+.data
+.balign 1
+.Lstring.187:
+	.ascii "invalid value\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.188:
+	.ascii ".L\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.189:
+	.ascii ".%u\000"
+/* end data */
+
+
+.text
+; function emitname
+emitname:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  read 0 r4 r1
+  and r1 15 r2
+  write -12 r14 r2
+  load 1 r1
+  load 8 r3
+  bge r2 r3 .L928
+  addr2reg .Lsigil.186 r1
+  add r1 r2 r1
+  readb 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L928:
+  beq r1 r0 .L930
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.187 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -12 r14 r2
+  load32 -24 r1
+  sub r13 r1 r13
+.L930:
+  addr2reg .Lsigil.186 r1
+  add r1 r2 r1
+  readb 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -12 r14 r2
+  read -16 r14 r4
+  load 0 r1
+  load 1 r3
+  bne r2 r3 .L932
+  add r4 4 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L932:
+  beq r1 r0 .L934
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.188 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -16 r14 r4
+.L934:
+  add r4 8 r1
+  read 0 r1 r1
+  beq r1 r0 .L937
+  or r0 r1 r4
+  addr2reg __stdout_file r5
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -16 r14 r4
+.L937:
+  add r4 4 r1
+  read 0 r1 r5
+  beq r5 r0 .L939
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.189 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  load32 -24 r1
+  sub r13 r1 r13
+.L939:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitname */
+
+.data
+.balign 1
+.Lstring.191:
+	.ascii "%llu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.192:
+	.ascii "floating point not supported on this target\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.193:
+	.ascii "thread \000"
+/* end data */
+
+
+.text
+; function emitvalue
+emitvalue:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  read 0 r4 r1
+  and r1 15 r2
+  load 1 r3
+  sub r2 r3 r2
+  load 4 r3
+  bge r2 r3 .L947
+  shiftl r2 2 r3
+  addr2reg .Ljt944 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L945:
+  and r1 16 r1
+  beq r1 r0 .L947
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.193 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -16 r14 r4
+.L947:
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  jump .L951
+.L948:
+  add r4 8 r1
+  read 0 r1 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.191 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L951
+.L949:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.192 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L951
+.L950:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.192 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+.L951:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt944:
+  .int .L945
+  .int .L948
+  .int .L949
+  .int .L950
+
+/* end function emitvalue */
+
+.data
+.balign 1
+.Lstring.195:
+	.ascii "type has no QBE representation\000"
+/* end data */
+
+
+.text
+; function emitclass
+emitclass:
+  or r0 r4 r1
+  or r0 r5 r4
+  load 0 r2
+  beq r4 r0 .L956
+  read 0 r4 r2
+  xor r2 6 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L956:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  bne r2 r0 .L961
+  or r0 r1 r4
+  bne r4 r0 .L960
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.195 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L962
+.L960:
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  jump .L962
+.L961:
+  savpc r15
+  add r15 12 r15
+  jump emitname
+.L962:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitclass */
+
+.data
+.balign 4
+.Lid.197:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.198:
+	.ascii "type \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.199:
+	.ascii " = align %d { %llu }\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.200:
+	.ascii " = { \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.201:
+	.ascii "{ \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.202:
+	.ascii " %llu\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.203:
+	.ascii ", \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.204:
+	.ascii " } \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.205:
+	.ascii "}\000"
+/* end data */
+
+
+.text
+; function emittype
+emittype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 52 r13
+  write -32 r14 r4
+  add r4 16 r1
+  read 0 r1 r2
+  load 1 r1
+  bne r2 r0 .L970
+  read 0 r4 r1
+  load 0 r2
+  load 15 r3
+  bne r1 r3 .L968
+  or r0 r2 r1
+  jump .L969
+.L968:
+  xor r1 16 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L969:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L970:
+  bne r1 r0 .L1009
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r2
+  read -32 r14 r4
+  add r4 16 r1
+  write 0 r1 r2
+  load 6 r1
+  write 0 r2 r1
+  add r4 40 r1
+  read 0 r1 r1
+  add r4 16 r2
+  read 0 r2 r2
+  add r2 8 r2
+  write 0 r2 r1
+  addr2reg .Lid.197 r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg .Lid.197 r12
+  write 0 r12 r1
+  add r4 16 r2
+  read 0 r2 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r4 40 r1
+  add r1 4 r1
+  read 0 r1 r2
+.L972:
+  write -28 r14 r2
+  beq r2 r0 .L980
+  add r2 4 r1
+  read 0 r1 r1
+.L974:
+  read 0 r1 r3
+  load 13 r5
+  bne r3 r5 .L976
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L974
+.L976:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emittype
+  read -28 r14 r2
+  add r2 20 r1
+  read 0 r1 r2
+  read -32 r14 r4
+  jump .L972
+.L980:
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.198 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -32 r14 r4
+  add r4 16 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  read -32 r14 r4
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  beq r4 r1 .L1008
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.200 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -32 r14 r4
+  add r4 40 r1
+  add r1 4 r1
+  read 0 r1 r3
+  load 0 r1
+  write -8 r14 r1
+.L983:
+  write -12 r14 r3
+  beq r3 r0 .L1007
+  read 0 r4 r1
+  load 15 r2
+  beq r1 r2 .L986
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.201 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -12 r14 r3
+  read -8 r14 r2
+  read -32 r14 r4
+  jump .L993
+.L986:
+  add r3 20 r1
+  read 0 r1 r1
+.L987:
+  beq r1 r0 .L992
+  add r1 12 r2
+  read 0 r2 r2
+  add r3 12 r5
+  read 0 r5 r5
+  add r5 1 r6
+  add r6 8 r6
+  load 1 r7
+  sub r6 r7 r6
+  load32 -8 r7
+  and r6 r7 r6
+  bge r2 r6 .L992
+  bgt r2 r5 .L991
+  or r0 r1 r3
+.L991:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L987
+.L992:
+  add r3 12 r1
+  read 0 r1 r1
+  add r3 4 r2
+  read 0 r2 r2
+  add r2 12 r2
+  read 0 r2 r2
+  add r1 r2 r2
+.L993:
+  write -20 r14 r3
+  write -24 r14 r2
+  add r3 4 r1
+  read 0 r1 r1
+.L994:
+  write -16 r14 r1
+  read 0 r1 r5
+  load 13 r6
+  bne r5 r6 .L996
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L994
+.L996:
+  or r0 r1 r5
+  add r14 -44 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -16 r14 r1
+  add r14 -44 r2
+  add r2 1 r2
+  readb 0 r2 r4
+  add r1 16 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump emitclass
+  read -16 r14 r1
+  read -20 r14 r3
+  read -32 r14 r4
+  add r3 4 r2
+  read 0 r2 r5
+  add r5 12 r2
+  read 0 r2 r6
+  add r1 12 r2
+  read 0 r2 r2
+  ble r6 r2 .L999
+  or r0 r5 r1
+  add r1 12 r1
+  read 0 r1 r1
+  divu r1 r2 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.202 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L999:
+  read 0 r4 r1
+  load 15 r2
+  beq r1 r2 .L1001
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.204 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -20 r14 r3
+  read -24 r14 r2
+  read -32 r14 r4
+  add r3 20 r1
+  read 0 r1 r3
+  jump .L1006
+.L1001:
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -20 r14 r3
+  read -24 r14 r2
+  read -32 r14 r4
+.L1002:
+  add r3 20 r1
+  read 0 r1 r3
+  load 0 r1
+  beq r3 r0 .L1005
+  add r3 12 r1
+  read 0 r1 r1
+  sltu r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1005:
+  bne r1 r0 .L1002
+.L1006:
+  write -8 r14 r2
+  jump .L983
+.L1007:
+  addr2reg .Lstring.205 r4
+  savpc r15
+  add r15 12 r15
+  jump puts
+  jump .L1009
+.L1008:
+  add r4 8 r1
+  read 0 r1 r5
+  add r4 12 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.199 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  load32 -24 r1
+  sub r13 r1 r13
+.L1009:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emittype */
+
+.data
+.balign 1
+.Lstring.207:
+	.ascii "inst->kind < LEN(instname)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.208:
+	.ascii " =\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.209:
+	.ascii ", ...\000"
+/* end data */
+
+
+.text
+; function emitinst
+emitinst:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  write -40 r14 r5
+  write -16 r14 r4
+  read 0 r4 r1
+  write -20 r14 r1
+  load 9 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -20 r14 r1
+  read 0 r1 r2
+  load 91 r3
+  blt r2 r3 .L1014
+  load 1367 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.207 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -20 r14 r1
+.L1014:
+  add r1 8 r2
+  read 0 r2 r2
+  beq r2 r0 .L1016
+  add r1 8 r4
+  savpc r15
+  add r15 12 r15
+  jump emitvalue
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.208 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -20 r14 r1
+  add r1 4 r2
+  read 0 r2 r4
+  add r1 20 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump emitclass
+  load 32 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -20 r14 r1
+.L1016:
+  read 0 r1 r1
+  shiftl r1 2 r2
+  addr2reg instname r1
+  add r1 r2 r1
+  read 0 r1 r4
+  addr2reg __stdout_file r5
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  load 32 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -20 r14 r1
+  add r1 20 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitvalue
+  read -20 r14 r1
+  read -16 r14 r4
+  or r0 r1 r2
+  add r4 4 r1
+  write -24 r14 r1
+  read 0 r2 r3
+  load 88 r4
+  beq r3 r4 .L1022
+  load 88 r4
+  sltu r3 r4 r3
+  add r2 20 r2
+  add r2 4 r2
+  read 0 r2 r2
+  beq r2 r0 .L1021
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -20 r14 r1
+  add r1 20 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitvalue
+  read -24 r14 r1
+.L1021:
+  write -36 r14 r1
+  jump .L1037
+.L1022:
+  load 40 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -24 r14 r1
+  read -40 r14 r5
+  load 1 r2
+.L1023:
+  write -48 r14 r1
+  write -44 r14 r2
+  beq r1 r5 .L1035
+  read 0 r1 r1
+  write -28 r14 r1
+  read 0 r1 r3
+  load 92 r4
+  beq r3 r4 .L1032
+  load 91 r4
+  bne r3 r4 .L1035
+  bne r2 r0 .L1029
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -44 r14 r1
+  or r0 r1 r2
+  read -28 r14 r1
+  write -32 r14 r2
+  jump .L1031
+.L1029:
+  load 0 r2
+  write -32 r14 r2
+.L1031:
+  add r1 4 r2
+  read 0 r2 r4
+  add r1 20 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump emitclass
+  load 32 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -28 r14 r1
+  add r1 20 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitvalue
+  read -32 r14 r1
+  read -48 r14 r2
+  read -40 r14 r5
+  jump .L1033
+.L1032:
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.209 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -48 r14 r2
+  read -44 r14 r1
+  read -40 r14 r5
+.L1033:
+  add r2 4 r2
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L1023
+.L1035:
+  load 41 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -48 r14 r1
+  write -36 r14 r1
+.L1037:
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -36 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitinst */
+
+.data
+.balign 1
+.Lstring.211:
+	.ascii "\011ret\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.212:
+	.ascii "\011jmp \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.213:
+	.ascii "\011jnz \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.214:
+	.ascii ", %d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.215:
+	.ascii "\011hlt\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.216:
+	.ascii "\011jtab \000"
+/* end data */
+
+
+.text
+; function emitjump
+emitjump:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+  read 0 r4 r1
+  load 6 r2
+  blt r1 r2 .L1044
+  load 1455 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  jump .L1058
+.L1044:
+  shiftl r1 2 r2
+  addr2reg .Ljt1044 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L1045:
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.212 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -12 r14 r4
+  add r4 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  jump .L1058
+.L1046:
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.213 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -12 r14 r4
+  add r4 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitvalue
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -12 r14 r4
+  add r4 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -12 r14 r4
+  add r4 8 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  read -12 r14 r4
+  add r4 24 r1
+  read 0 r1 r1
+  beq r1 r0 .L1048
+  xor r1 1 r1
+  sltu r1 1 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.214 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  load32 -24 r1
+  sub r13 r1 r13
+.L1048:
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  jump .L1058
+.L1049:
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.211 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -12 r14 r4
+  add r4 4 r1
+  read 0 r1 r1
+  beq r1 r0 .L1051
+  addr2reg __stdout_file r5
+  load 32 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  read -12 r14 r4
+  add r4 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitvalue
+.L1051:
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  jump .L1058
+.L1052:
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.215 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  jump .L1058
+.L1053:
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.216 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -12 r14 r4
+  add r4 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitvalue
+  read -12 r14 r4
+  load 0 r1
+.L1054:
+  write -16 r14 r1
+  add r4 20 r2
+  read 0 r2 r2
+  bge r1 r2 .L1057
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -16 r14 r1
+  read -12 r14 r4
+  or r0 r1 r2
+  add r4 16 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  read -16 r14 r1
+  read -12 r14 r4
+  add r1 1 r1
+  jump .L1054
+.L1057:
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+.L1058:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt1044:
+  .int .L1058
+  .int .L1045
+  .int .L1046
+  .int .L1049
+  .int .L1052
+  .int .L1053
+
+/* end function emitjump */
+
+.data
+.balign 1
+.Lstring.218:
+	.ascii "main\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.219:
+	.ascii "export\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.220:
+	.ascii "noinline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.221:
+	.ascii "inline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.222:
+	.ascii "alwaysinline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.223:
+	.ascii "function \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.224:
+	.ascii "...\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.225:
+	.ascii ") {\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.226:
+	.ascii " =%c phi \000"
+/* end data */
+
+
+.text
+; function emitfunc
+.global emitfunc
+emitfunc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 64 r13
+  write -12 r14 r5
+  write -24 r14 r4
+  add r4 24 r1
+  read 0 r1 r1
+  add r1 56 r1
+  read 0 r1 r1
+  bne r1 r0 .L1069
+  add r4 8 r1
+  read 0 r1 r4
+  addr2reg .Lstring.218 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -24 r14 r4
+  load 0 r1
+  beq r2 r0 .L1064
+  or r0 r1 r2
+  jump .L1065
+.L1064:
+  add r4 16 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r1
+  addr2reg typeint r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L1065:
+  load 0 r1
+  bne r2 r0 .L1067
+  or r0 r1 r5
+  jump .L1068
+.L1067:
+  load 12 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r5
+  read -24 r14 r4
+  load 2 r1
+  write 0 r5 r1
+  add r5 8 r2
+  load 0 r1
+  write 0 r2 r1
+.L1068:
+  savpc r15
+  add r15 12 r15
+  jump funcret
+  read -12 r14 r5
+  read -24 r14 r4
+.L1069:
+  and r5 0xFF r1
+  beq r1 r0 .L1071
+  addr2reg .Lstring.219 r4
+  savpc r15
+  add r15 12 r15
+  jump puts
+  read -24 r14 r4
+.L1071:
+  read 0 r4 r1
+  add r1 36 r1
+  add r1 4 r1
+  read 0 r1 r1
+  load 2 r2
+  beq r1 r2 .L1080
+  load 2 r2
+  blt r1 r2 .L1077
+  load32 -1 r2
+  beq r1 r2 .L1076
+  load32 -1 r2
+  sltu r1 r2 r1
+  jump .L1081
+.L1076:
+  addr2reg .Lstring.220 r4
+  savpc r15
+  add r15 12 r15
+  jump puts
+  jump .L1081
+.L1077:
+  load 1 r2
+  beq r1 r2 .L1079
+  load 1 r2
+  sltu r1 r2 r1
+  jump .L1081
+.L1079:
+  addr2reg .Lstring.221 r4
+  savpc r15
+  add r15 12 r15
+  jump puts
+  jump .L1081
+.L1080:
+  addr2reg .Lstring.222 r4
+  savpc r15
+  add r15 12 r15
+  jump puts
+.L1081:
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.223 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -24 r14 r4
+  add r4 16 r1
+  read 0 r1 r1
+  add r1 20 r2
+  read 0 r2 r2
+  addr2reg typevoid r3
+  beq r2 r3 .L1083
+  add r1 20 r1
+  read 0 r1 r5
+  add r14 -56 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -24 r14 r4
+  or r0 r4 r1
+  readb -56 r14 r4
+  add r1 16 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r1
+  add r1 16 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump emitclass
+  load 32 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -24 r14 r4
+.L1083:
+  read 0 r4 r1
+  add r1 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  load 40 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -24 r14 r4
+  add r4 16 r1
+  read 0 r1 r1
+  add r1 40 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r4 12 r2
+  read 0 r2 r2
+  write -28 r14 r2
+.L1085:
+  write -32 r14 r1
+  beq r1 r0 .L1091
+  add r4 16 r2
+  read 0 r2 r2
+  add r2 44 r2
+  read 0 r2 r2
+  beq r1 r2 .L1088
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -32 r14 r1
+.L1088:
+  add r1 12 r1
+  read 0 r1 r5
+  add r14 -44 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  read -32 r14 r1
+  readb -44 r14 r4
+  add r1 12 r1
+  read 0 r1 r1
+  add r1 16 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump emitclass
+  load 32 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -28 r14 r2
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  read -32 r14 r1
+  read -28 r14 r2
+  read -24 r14 r4
+  add r1 32 r1
+  read 0 r1 r1
+  add r2 12 r2
+  write -28 r14 r2
+  jump .L1085
+.L1091:
+  add r4 16 r1
+  read 0 r1 r1
+  add r1 40 r2
+  readbu 0 r2 r2
+  beq r2 r0 .L1095
+  add r1 40 r1
+  add r1 4 r1
+  read 0 r1 r1
+  beq r1 r0 .L1094
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+.L1094:
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.224 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+.L1095:
+  addr2reg .Lstring.225 r4
+  savpc r15
+  add r15 12 r15
+  jump puts
+  read -24 r14 r4
+  add r4 20 r1
+  read 0 r1 r1
+.L1096:
+  write -20 r14 r1
+  beq r1 r0 .L1105
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -20 r14 r1
+  add r1 24 r2
+  add r2 20 r2
+  read 0 r2 r2
+  beq r2 r0 .L1099
+  load 9 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -20 r14 r1
+  add r1 24 r1
+  add r1 20 r4
+  savpc r15
+  add r15 12 r15
+  jump emitvalue
+  read -20 r14 r1
+  add r1 24 r1
+  read 0 r1 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.226 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -20 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 24 r1
+  add r1 4 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  load 32 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -20 r14 r1
+  add r1 24 r1
+  add r1 12 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitvalue
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -20 r14 r1
+  add r1 24 r1
+  add r1 4 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  load 32 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -20 r14 r1
+  add r1 24 r1
+  add r1 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitvalue
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -20 r14 r1
+.L1099:
+  add r1 12 r2
+  read 0 r2 r2
+  add r1 12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r2 r1 r1
+  write -16 r14 r1
+.L1100:
+  beq r2 r1 .L1102
+  or r0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump emitinst
+  or r0 r1 r2
+  read -16 r14 r1
+  jump .L1100
+.L1102:
+  read -20 r14 r1
+  add r1 56 r4
+  savpc r15
+  add r15 12 r15
+  jump emitjump
+  read -20 r14 r1
+  add r1 84 r1
+  read 0 r1 r1
+  jump .L1096
+.L1105:
+  addr2reg .Lstring.205 r4
+  savpc r15
+  add r15 12 r15
+  jump puts
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitfunc */
+
+.data
+.balign 1
+.Lstring.228:
+	.ascii "not a address expr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.229:
+	.ascii "initializer is not a constant expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.230:
+	.ascii " + \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.231:
+	.ascii "%c_%.17g\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.232:
+	.ascii "\134%03o\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.233:
+	.ascii "%u \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.234:
+	.ascii ", z %llu\000"
+/* end data */
+
+
+.text
+; function dataitem
+dataitem:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -12 r14 r5
+  write -32 r14 r4
+  read 0 r4 r1
+  load 1 r2
+  sub r1 r2 r1
+  load 9 r2
+  bge r1 r2 .L1148
+  shiftl r1 2 r2
+  addr2reg .Ljt1111 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L1112:
+  add r4 8 r1
+  read 0 r1 r1
+  add r1 4 r2
+  read 0 r2 r2
+  and r2 32 r2
+  bne r2 r0 .L1114
+  add r4 32 r1
+  read 0 r1 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.191 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L1166
+.L1114:
+  add r1 12 r1
+  read 0 r1 r1
+  load 4 r2
+  beq r1 r2 .L1116
+  load 100 r1
+  jump .L1117
+.L1116:
+  load 115 r1
+.L1117:
+  or r0 r1 r5
+  add r4 32 r1
+  read 0 r1 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.231 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L1166
+.L1118:
+  add r4 8 r1
+  read 0 r1 r1
+  add r1 20 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r2
+  write -20 r14 r2
+  load 1 r1
+  beq r2 r1 .L1132
+  load 0 r1
+.L1120:
+  write -4 r14 r1
+  add r4 32 r3
+  read 0 r3 r6
+  load 0 r3
+  bge r1 r6 .L1122
+  mults r1 r2 r3
+  sltu r3 r5 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L1122:
+  beq r3 r0 .L1131
+  load 4 r3
+  beq r2 r3 .L1129
+  load 4 r3
+  bge r2 r3 .L1127
+  load 2 r3
+  beq r2 r3 .L1128
+  load 2 r1
+  sltu r2 r1 r1
+.L1127:
+  load 1574 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -4 r14 r1
+  read -20 r14 r2
+  read -12 r14 r5
+  read -32 r14 r4
+  jump .L1130
+.L1128:
+  or r0 r1 r2
+  add r4 32 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 1 r2
+  add r1 r2 r1
+  readhu 0 r1 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.233 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -4 r14 r1
+  read -20 r14 r2
+  read -12 r14 r5
+  read -32 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  jump .L1130
+.L1129:
+  or r0 r1 r2
+  add r4 32 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.233 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -4 r14 r1
+  read -20 r14 r2
+  read -12 r14 r5
+  read -32 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+.L1130:
+  add r1 1 r1
+  jump .L1120
+.L1131:
+  read -12 r14 r5
+  jump .L1146
+.L1132:
+  addr2reg __stdout_file r5
+  load 34 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  read -12 r14 r5
+  read -32 r14 r4
+  load 0 r1
+.L1133:
+  write -16 r14 r1
+  add r4 32 r2
+  read 0 r2 r3
+  load 0 r2
+  bge r1 r3 .L1135
+  sltu r1 r5 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1135:
+  beq r2 r0 .L1145
+  add r4 32 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r2 r1 r1
+  readbu 0 r1 r4
+  write -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump isprint
+  or r0 r1 r2
+  read -8 r14 r4
+  load 0 r1
+  bne r2 r0 .L1138
+  or r0 r1 r2
+  jump .L1139
+.L1138:
+  xor r4 34 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L1139:
+  load 0 r1
+  beq r2 r0 .L1141
+  xor r4 92 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1141:
+  bne r1 r0 .L1143
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r4 r5
+  addr2reg .Lstring.232 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -16 r14 r1
+  read -12 r14 r5
+  read -32 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  jump .L1144
+.L1143:
+  savpc r15
+  add r15 12 r15
+  jump putchar
+  read -16 r14 r1
+  read -12 r14 r5
+  read -32 r14 r4
+.L1144:
+  add r1 1 r1
+  jump .L1133
+.L1145:
+  addr2reg __stdout_file r5
+  load 34 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  read -16 r14 r1
+  read -20 r14 r2
+  read -12 r14 r5
+.L1146:
+  mults r1 r2 r3
+  bge r3 r5 .L1166
+  mults r1 r2 r1
+  sub r5 r1 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.234 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L1166
+.L1148:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.229 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L1166
+.L1149:
+  add r4 16 r1
+  read 0 r1 r1
+  load 74 r2
+  beq r1 r2 .L1151
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.228 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L1151:
+  add r4 20 r1
+  read 0 r1 r1
+  write -24 r14 r1
+  read 0 r1 r2
+  beq r2 r0 .L1153
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.229 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -24 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L1153:
+  add r1 32 r1
+  read 0 r1 r1
+  write -28 r14 r1
+  add r1 4 r2
+  read 0 r2 r3
+  load 0 r2
+  load 1 r4
+  bne r3 r4 .L1155
+  add r1 36 r2
+  add r2 4 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1155:
+  beq r2 r0 .L1157
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.229 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -28 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L1157:
+  add r1 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  jump .L1166
+.L1158:
+  add r4 16 r1
+  read 0 r1 r2
+  load 1 r1
+  load 76 r3
+  bne r2 r3 .L1160
+  add r4 32 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  xor r1 7 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L1161
+.L1160:
+  or r0 r1 r2
+.L1161:
+  load 1 r1
+  bne r2 r0 .L1163
+  add r4 32 r1
+  add r1 4 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  xor r1 1 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L1163:
+  beq r1 r0 .L1165
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.229 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L1165:
+  add r4 32 r1
+  read 0 r1 r4
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump dataitem
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.230 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -32 r14 r4
+  add r4 32 r1
+  add r1 4 r1
+  read 0 r1 r4
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump dataitem
+.L1166:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt1111:
+  .int .L1112
+  .int .L1118
+  .int .L1148
+  .int .L1148
+  .int .L1148
+  .int .L1148
+  .int .L1149
+  .int .L1148
+  .int .L1158
+
+/* end function dataitem */
+
+.data
+.balign 1
+.Lstring.236:
+	.ascii "export \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.237:
+	.ascii " = align %d { \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.238:
+	.ascii "cur->expr->kind == EXPRSTRING\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.239:
+	.ascii "init->expr->kind == EXPRCONST\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.240:
+	.ascii "b %u, \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.241:
+	.ascii "z %llu, \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.242:
+	.ascii "cur->expr->type->prop & PROPINT\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.243:
+	.ascii "cur->expr->kind == EXPRCONST\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.244:
+	.ascii "%c \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.245:
+	.ascii "offset <= d->type->size\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.246:
+	.ascii "z %llu \000"
+/* end data */
+
+
+.text
+; function emitdata
+.global emitdata
+emitdata:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 84 r13
+  write -60 r14 r5
+  write -64 r14 r4
+  add r4 36 r1
+  read 0 r1 r1
+  write -56 r14 r1
+.L1170:
+  write -52 r14 r5
+  beq r5 r0 .L1173
+  add r5 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump eval
+  read -52 r14 r5
+  add r5 8 r2
+  write 0 r2 r1
+  add r5 16 r1
+  read 0 r1 r5
+  jump .L1170
+.L1173:
+  read -64 r14 r4
+  add r4 36 r1
+  add r1 4 r1
+  read 0 r1 r1
+  load 1 r2
+  bne r1 r2 .L1176
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.193 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -64 r14 r4
+.L1176:
+  add r4 8 r1
+  read 0 r1 r1
+  load 2 r2
+  bne r1 r2 .L1178
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.236 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+.L1178:
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.153 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -64 r14 r4
+  add r4 20 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitname
+  read -56 r14 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.237 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -60 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r2
+  load 0 r1
+  write -44 r14 r2
+  write -48 r14 r1
+.L1180:
+  write -40 r14 r5
+  beq r5 r0 .L1226
+  or r0 r5 r1
+.L1182:
+  add r1 16 r1
+  read 0 r1 r1
+  write -36 r14 r1
+  load 0 r2
+  beq r1 r0 .L1184
+  read 0 r1 r2
+  shiftl r2 3 r2
+  add r1 12 r3
+  readh 0 r3 r3
+  add r2 r3 r2
+  add r5 4 r3
+  read 0 r3 r3
+  shiftl r3 3 r3
+  add r5 12 r4
+  add r4 2 r4
+  readh 0 r4 r4
+  sub r3 r4 r3
+  sltu r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L1184:
+  beq r2 r0 .L1199
+  add r5 8 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  load 2 r3
+  beq r2 r3 .L1187
+  load 1614 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.238 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -40 r14 r5
+  read -36 r14 r1
+.L1187:
+  add r1 8 r2
+  read 0 r2 r2
+  read 0 r2 r2
+  load 1 r3
+  beq r2 r3 .L1189
+  load 1615 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.239 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -40 r14 r5
+  read -36 r14 r1
+.L1189:
+  read 0 r1 r2
+  read 0 r5 r3
+  sub r2 r3 r2
+  add r5 8 r3
+  read 0 r3 r3
+  add r3 8 r4
+  read 0 r4 r4
+  add r4 20 r4
+  read 0 r4 r4
+  add r4 12 r4
+  read 0 r4 r4
+  divu r2 r4 r4
+  add r3 8 r2
+  read 0 r2 r2
+  add r2 20 r2
+  read 0 r2 r2
+  add r2 12 r2
+  read 0 r2 r2
+  load 2 r6
+  beq r2 r6 .L1198
+  load 2 r6
+  blt r2 r6 .L1195
+  load 4 r6
+  beq r2 r6 .L1194
+  load 4 r3
+  sltu r2 r3 r2
+  jump .L1182
+.L1194:
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 32 r2
+  read 0 r2 r2
+  add r3 32 r3
+  add r3 4 r3
+  read 0 r3 r3
+  shiftl r4 2 r4
+  add r3 r4 r3
+  write 0 r3 r2
+  jump .L1182
+.L1195:
+  load 1 r6
+  beq r2 r6 .L1197
+  load 1 r3
+  sltu r2 r3 r2
+  jump .L1182
+.L1197:
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 32 r2
+  read 0 r2 r2
+  add r3 32 r3
+  add r3 4 r3
+  read 0 r3 r3
+  add r3 r4 r3
+  writeb 0 r3 r2
+  jump .L1182
+.L1198:
+  add r1 8 r2
+  read 0 r2 r2
+  add r2 32 r2
+  read 0 r2 r2
+  add r3 32 r3
+  add r3 4 r3
+  read 0 r3 r3
+  shiftl r4 1 r4
+  add r3 r4 r3
+  writeh 0 r3 r2
+  jump .L1182
+.L1199:
+  read -44 r14 r3
+  read -48 r14 r2
+  read 0 r5 r1
+  add r5 12 r4
+  readh 0 r4 r4
+  shiftrs r4 31 r6
+  shiftr r6 29 r6
+  add r4 r6 r4
+  shiftrs r4 3 r4
+  add r1 r4 r1
+  write -20 r14 r1
+  or r0 r3 r4
+  add r5 4 r3
+  read 0 r3 r3
+  add r5 12 r6
+  add r6 2 r6
+  readh 0 r6 r6
+  add r6 7 r6
+  shiftrs r6 31 r7
+  shiftr r7 29 r7
+  add r6 r7 r6
+  shiftrs r6 3 r6
+  sub r3 r6 r3
+  write -24 r14 r3
+  load 0 r6
+  bge r4 r1 .L1202
+  xor r2 0 r6
+  sltu r0 r6 r6
+.L1202:
+  beq r6 r0 .L1205
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r2 r5
+  addr2reg .Lstring.240 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -40 r14 r5
+  read -44 r14 r3
+  or r0 r3 r2
+  read -24 r14 r3
+  read -20 r14 r1
+  load32 -24 r4
+  sub r13 r4 r13
+  add r2 1 r2
+  load 0 r4
+  or r0 r2 r12
+  or r0 r4 r2
+  or r0 r12 r4
+.L1205:
+  write -16 r14 r2
+  bge r4 r1 .L1208
+  or r0 r4 r3
+  sub r1 r3 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.241 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -16 r14 r2
+  read -40 r14 r5
+  read -24 r14 r3
+  read -20 r14 r1
+  load32 -24 r4
+  sub r13 r4 r13
+.L1208:
+  add r5 12 r4
+  readh 0 r4 r6
+  load 1 r4
+  bne r6 r0 .L1210
+  add r5 12 r4
+  add r4 2 r4
+  readh 0 r4 r4
+  shiftl r4 16 r4
+  shiftr r4 16 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L1210:
+  bne r4 r0 .L1215
+  add r5 8 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r5
+  read 0 r5 r1
+  load 13 r2
+  bne r1 r2 .L1213
+  add r5 20 r1
+  read 0 r1 r5
+.L1213:
+  add r14 -76 r4
+  savpc r15
+  add r15 12 r15
+  jump qbetype
+  add r14 -76 r1
+  add r1 1 r1
+  readb 0 r1 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.244 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -40 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  add r5 8 r1
+  read 0 r1 r4
+  add r5 4 r1
+  read 0 r1 r1
+  read 0 r5 r2
+  sub r1 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump dataitem
+  addr2reg __stdout_file r5
+  addr2reg .Lstring.203 r4
+  savpc r15
+  add r15 12 r15
+  jump fputs
+  read -16 r14 r2
+  read -24 r14 r3
+  read -36 r14 r5
+  or r0 r5 r1
+  jump .L1225
+.L1215:
+  add r5 8 r4
+  read 0 r4 r4
+  add r4 8 r4
+  read 0 r4 r4
+  add r4 4 r4
+  read 0 r4 r4
+  and r4 2 r4
+  bne r4 r0 .L1217
+  load 1634 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.242 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r2
+  read -40 r14 r5
+  read -24 r14 r3
+  read -20 r14 r1
+.L1217:
+  add r5 8 r4
+  read 0 r4 r4
+  read 0 r4 r4
+  load 1 r6
+  beq r4 r6 .L1219
+  load 1635 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.243 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r2
+  read -40 r14 r5
+  read -24 r14 r3
+  read -20 r14 r1
+.L1219:
+  add r5 8 r4
+  read 0 r4 r4
+  add r4 32 r4
+  read 0 r4 r4
+  add r5 12 r5
+  readh 0 r5 r5
+  shiftrs r5 31 r6
+  shiftr r6 29 r6
+  add r5 r6 r6
+  and r6 -8 r6
+  sub r5 r6 r5
+  shiftl r4 r5 r4
+  or r2 r4 r2
+.L1220:
+  write -28 r14 r1
+  write -32 r14 r2
+  bge r1 r3 .L1223
+  and r2 255 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.240 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -28 r14 r1
+  read -32 r14 r2
+  read -24 r14 r3
+  load32 -24 r4
+  sub r13 r4 r13
+  add r1 1 r1
+  shiftr r2 8 r2
+  jump .L1220
+.L1223:
+  read -40 r14 r1
+  read -24 r14 r3
+  read -36 r14 r5
+  add r1 12 r1
+  add r1 2 r1
+  readh 0 r1 r1
+  add r1 7 r4
+  or r0 r5 r1
+  shiftrs r4 31 r5
+  shiftr r5 29 r5
+  add r4 r5 r5
+  and r5 -8 r5
+  sub r4 r5 r5
+  load 127 r4
+  shiftrs r4 r5 r4
+  and r2 r4 r2
+.L1225:
+  or r0 r1 r5
+  write -44 r14 r3
+  write -48 r14 r2
+  jump .L1180
+.L1226:
+  read -44 r14 r3
+  read -48 r14 r5
+  read -64 r14 r4
+  beq r5 r0 .L1229
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.240 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  read -44 r14 r3
+  read -64 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  add r3 1 r3
+.L1229:
+  write -12 r14 r3
+  add r4 12 r1
+  read 0 r1 r1
+  add r1 12 r1
+  read 0 r1 r1
+  ble r3 r1 .L1231
+  load 1659 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.245 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r3
+  read -64 r14 r4
+.L1231:
+  add r4 12 r1
+  read 0 r1 r1
+  add r1 12 r2
+  read 0 r2 r2
+  bge r3 r2 .L1233
+  add r1 12 r1
+  read 0 r1 r1
+  sub r1 r3 r5
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.246 r4
+  savpc r15
+  add r15 12 r15
+  jump printf
+  load32 -24 r1
+  sub r13 r1 r13
+.L1233:
+  addr2reg .Lstring.205 r4
+  savpc r15
+  add r15 12 r15
+  jump puts
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitdata */
+
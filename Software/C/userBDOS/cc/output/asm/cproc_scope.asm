@@ -0,0 +1,581 @@
+.data
+.balign 1
+.Lstring.3:
+	.ascii "__builtin_alloca\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.4:
+	.ascii "__builtin_constant_p\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "__builtin_expect\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "__builtin_inff\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "__builtin_nanf\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "__builtin_offsetof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "__builtin_types_compatible_p\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "__builtin_unreachable\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "__builtin_va_arg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "__builtin_va_copy\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "__builtin_va_end\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "__builtin_va_start\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "__builtin_c23_va_start\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "__builtin_multfp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "__builtin_divfp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "__builtin_store\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "__builtin_storeb\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "__builtin_load\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "__builtin_loadb\000"
+/* end data */
+
+.data
+.balign 4
+.Lbuiltins.2:
+	.int .Lstring.3+0
+	.int 4
+	.fill 28,1,0
+	.int 0
+	.fill 4,1,0
+	.int .Lstring.4+0
+	.int 4
+	.fill 28,1,0
+	.int 1
+	.fill 4,1,0
+	.int .Lstring.5+0
+	.int 4
+	.fill 28,1,0
+	.int 2
+	.fill 4,1,0
+	.int .Lstring.6+0
+	.int 4
+	.fill 28,1,0
+	.int 3
+	.fill 4,1,0
+	.int .Lstring.7+0
+	.int 4
+	.fill 28,1,0
+	.int 4
+	.fill 4,1,0
+	.int .Lstring.8+0
+	.int 4
+	.fill 28,1,0
+	.int 5
+	.fill 4,1,0
+	.int .Lstring.9+0
+	.int 4
+	.fill 28,1,0
+	.int 6
+	.fill 4,1,0
+	.int .Lstring.10+0
+	.int 4
+	.fill 28,1,0
+	.int 7
+	.fill 4,1,0
+	.int .Lstring.11+0
+	.int 4
+	.fill 28,1,0
+	.int 8
+	.fill 4,1,0
+	.int .Lstring.12+0
+	.int 4
+	.fill 28,1,0
+	.int 9
+	.fill 4,1,0
+	.int .Lstring.13+0
+	.int 4
+	.fill 28,1,0
+	.int 10
+	.fill 4,1,0
+	.int .Lstring.14+0
+	.int 4
+	.fill 28,1,0
+	.int 12
+	.fill 4,1,0
+	.int .Lstring.15+0
+	.int 4
+	.fill 28,1,0
+	.int 12
+	.fill 4,1,0
+	.int .Lstring.16+0
+	.int 4
+	.fill 28,1,0
+	.int 13
+	.fill 4,1,0
+	.int .Lstring.17+0
+	.int 4
+	.fill 28,1,0
+	.int 14
+	.fill 4,1,0
+	.int .Lstring.18+0
+	.int 4
+	.fill 28,1,0
+	.int 15
+	.fill 4,1,0
+	.int .Lstring.19+0
+	.int 4
+	.fill 28,1,0
+	.int 16
+	.fill 4,1,0
+	.int .Lstring.20+0
+	.int 4
+	.fill 28,1,0
+	.int 17
+	.fill 4,1,0
+	.int .Lstring.21+0
+	.int 4
+	.fill 28,1,0
+	.int 18
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+.Lvalist.22:
+	.fill 44,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "__builtin_va_list\000"
+/* end data */
+
+
+.text
+; function scopeinit
+.global scopeinit
+scopeinit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  addr2reg .Lbuiltins.2 r1
+.L2:
+  write -16 r14 r1
+  addr2reg .Lbuiltins.2+836 r2
+  bge r1 r2 .L5
+  or r0 r1 r5
+  addr2reg filescope r4
+  savpc r15
+  add r15 12 r15
+  jump scopeputdecl
+  read -16 r14 r1
+  add r1 44 r1
+  jump .L2
+.L5:
+  addr2reg .Lstring.23 r1
+  addr2reg .Lvalist.22 r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg .Lvalist.22+4 r12
+  write 0 r12 r1
+  addr2reg targ r12
+  read 0 r12 r1
+  add r1 4 r1
+  read 0 r1 r1
+  addr2reg .Lvalist.22+12 r12
+  write 0 r12 r1
+  addr2reg .Lvalist.22 r5
+  addr2reg filescope r4
+  savpc r15
+  add r15 12 r15
+  jump scopeputdecl
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function scopeinit */
+
+
+.text
+; function mkscope
+.global mkscope
+mkscope:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  load 48 r4
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  read -16 r14 r4
+  add r1 16 r3
+  load 0 r2
+  write 0 r3 r2
+  load 0 r2
+  write 0 r1 r2
+  add r4 32 r2
+  read 0 r2 r2
+  add r1 32 r3
+  write 0 r3 r2
+  add r4 36 r2
+  read 0 r2 r2
+  add r1 36 r3
+  write 0 r3 r2
+  add r4 40 r2
+  read 0 r2 r2
+  add r1 40 r3
+  write 0 r3 r2
+  add r1 44 r2
+  write 0 r2 r4
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mkscope */
+
+
+.text
+; function delscope
+.global delscope
+delscope:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+  add r4 44 r1
+  read 0 r1 r1
+  write -16 r14 r1
+  add r4 16 r1
+  read 0 r1 r1
+  beq r1 r0 .L15
+  add r4 16 r4
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump mapfree
+  read -12 r14 r4
+.L15:
+  read 0 r4 r1
+  beq r1 r0 .L17
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump mapfree
+  read -12 r14 r4
+.L17:
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function delscope */
+
+
+.text
+; function scopegetdecl
+.global scopegetdecl
+scopegetdecl:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  write -12 r14 r6
+  write -8 r14 r4
+  write -4 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -4 r14 r5
+  add r14 -28 r4
+  savpc r15
+  add r15 12 r15
+  jump mapkey
+  read -12 r14 r6
+  read -8 r14 r4
+.L22:
+  write -16 r14 r4
+  add r4 16 r1
+  read 0 r1 r1
+  bne r1 r0 .L24
+  load 0 r1
+  jump .L25
+.L24:
+  add r4 16 r4
+  add r14 -28 r5
+  savpc r15
+  add r15 12 r15
+  jump mapget
+  read -16 r14 r4
+  read -12 r14 r6
+.L25:
+  add r4 44 r2
+  read 0 r2 r4
+  load 0 r2
+  beq r1 r0 .L28
+  or r0 r2 r3
+  jump .L29
+.L28:
+  xor r4 0 r2
+  sltu r0 r2 r3
+.L29:
+  load 0 r2
+  beq r3 r0 .L31
+  and r6 0xFF r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L31:
+  bne r2 r0 .L22
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function scopegetdecl */
+
+
+.text
+; function scopegettag
+.global scopegettag
+scopegettag:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  write -12 r14 r6
+  write -8 r14 r4
+  write -4 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -4 r14 r5
+  add r14 -28 r4
+  savpc r15
+  add r15 12 r15
+  jump mapkey
+  read -12 r14 r6
+  read -8 r14 r4
+.L36:
+  write -16 r14 r4
+  read 0 r4 r1
+  bne r1 r0 .L38
+  load 0 r1
+  jump .L39
+.L38:
+  add r14 -28 r5
+  savpc r15
+  add r15 12 r15
+  jump mapget
+  read -16 r14 r4
+  read -12 r14 r6
+.L39:
+  add r4 44 r2
+  read 0 r2 r4
+  load 0 r2
+  beq r1 r0 .L42
+  or r0 r2 r3
+  jump .L43
+.L42:
+  xor r4 0 r2
+  sltu r0 r2 r3
+.L43:
+  load 0 r2
+  beq r3 r0 .L45
+  and r6 0xFF r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L45:
+  bne r2 r0 .L36
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function scopegettag */
+
+
+.text
+; function scopeputdecl
+.global scopeputdecl
+scopeputdecl:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  write -16 r14 r5
+  write -12 r14 r4
+  add r4 16 r1
+  read 0 r1 r1
+  bne r1 r0 .L51
+  add r4 16 r4
+  load 32 r5
+  savpc r15
+  add r15 12 r15
+  jump mapinit
+  read -16 r14 r5
+.L51:
+  read 0 r5 r5
+  write -8 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -8 r14 r5
+  add r14 -28 r4
+  savpc r15
+  add r15 12 r15
+  jump mapkey
+  read -12 r14 r4
+  add r4 16 r4
+  add r14 -28 r5
+  savpc r15
+  add r15 12 r15
+  jump mapput
+  read -16 r14 r5
+  write 0 r1 r5
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function scopeputdecl */
+
+
+.text
+; function scopeputtag
+.global scopeputtag
+scopeputtag:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  write -16 r14 r6
+  write -8 r14 r5
+  write -12 r14 r4
+  read 0 r4 r1
+  bne r1 r0 .L57
+  load 32 r5
+  savpc r15
+  add r15 12 r15
+  jump mapinit
+  read -8 r14 r5
+.L57:
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r6
+  read -8 r14 r5
+  add r14 -28 r4
+  savpc r15
+  add r15 12 r15
+  jump mapkey
+  read -12 r14 r4
+  add r14 -28 r5
+  savpc r15
+  add r15 12 r15
+  jump mapput
+  read -16 r14 r6
+  write 0 r1 r6
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function scopeputtag */
+
+.data
+.balign 4
+.globl filescope
+filescope:
+	.fill 48,1,0
+/* end data */
+
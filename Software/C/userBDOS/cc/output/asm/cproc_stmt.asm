@@ -0,0 +1,1680 @@
+.data
+.balign 1
+.Lstring.2:
+	.ascii "'case' label must be in switch\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.3:
+	.ascii "switch_case\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.4:
+	.ascii "after case expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "'default' label must be in switch\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "multiple 'default' labels\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "after 'default'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "switch_default\000"
+/* end data */
+
+
+.text
+; function label
+label:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r5
+  write -8 r14 r4
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump attr
+  addr2reg tok r12
+  read 0 r12 r1
+  load 13 r2
+  beq r1 r2 .L17
+  load 13 r2
+  blt r1 r2 .L11
+  load 18 r2
+  beq r1 r2 .L6
+  load 18 r2
+  sltu r1 r2 r1
+  jump .L13
+.L6:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -16 r14 r1
+  add r1 40 r2
+  read 0 r2 r2
+  bne r2 r0 .L8
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.5 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L8:
+  add r1 40 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r1
+  beq r1 r0 .L10
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.6 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L10:
+  addr2reg .Lstring.7 r5
+  load 95 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r4
+  add r1 40 r3
+  read 0 r3 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r1 40 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  jump .L20
+.L11:
+  load 4 r2
+  beq r1 r2 .L14
+  load 4 r2
+  sltu r1 r2 r1
+.L13:
+  load 0 r1
+  jump .L21
+.L14:
+  addr2reg tok+20 r12
+  read 0 r12 r5
+  write -4 r14 r5
+  load 95 r4
+  savpc r15
+  add r15 12 r15
+  jump peek
+  read -4 r14 r5
+  read -8 r14 r4
+  and r1 0xFF r1
+  beq r1 r0 .L16
+  savpc r15
+  add r15 12 r15
+  jump funcgoto
+  read -8 r14 r4
+  add r1 4 r3
+  load 1 r2
+  writeb 0 r3 r2
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  jump .L20
+.L16:
+  load 0 r1
+  jump .L21
+.L17:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -16 r14 r1
+  add r1 40 r1
+  read 0 r1 r1
+  bne r1 r0 .L19
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.2 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L19:
+  addr2reg .Lstring.3 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  or r0 r1 r6
+  read -8 r14 r4
+  write -12 r14 r6
+  or r0 r6 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -16 r14 r1
+  load 1 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump intconstexpr
+  or r0 r1 r5
+  read -12 r14 r6
+  read -16 r14 r1
+  add r1 40 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump switchcase
+  addr2reg .Lstring.4 r5
+  load 95 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+.L20:
+  load 1 r1
+.L21:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function label */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "after expression statement\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "after 'if'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "controlling expression of if statement must have scalar type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "after expression\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "if_true\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "if_false\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "if_join\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "after 'switch'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "controlling expression of switch statement must have integer type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "switch_cond\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "switch_join\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "after 'while'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "controlling expression of loop must have scalar type\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "while_cond\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "while_body\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "while_join\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "do_body\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "do_cond\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "do_join\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "after 'do' statement\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "after 'for'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "for_cond\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "for_body\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "for_cont\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "for_join\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "after 'goto'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "after 'goto' statement\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "'continue' statement must be in loop\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.39:
+	.ascii "after 'continue' statement\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "'break' statement must be in loop or switch\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.41:
+	.ascii "after 'break' statement\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "after 'return' statement\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "inline assembly is not yet supported\000"
+/* end data */
+
+
+.text
+; function stmt
+.global stmt
+stmt:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 196 r13
+  write -136 r14 r5
+  write -156 r14 r4
+  load 0 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump attr
+  read -136 r14 r4
+  addr2reg tok r12
+  read 0 r12 r1
+  load 52 r2
+  beq r1 r2 .L108
+  load 52 r2
+  blt r1 r2 .L43
+  load 68 r2
+  beq r1 r2 .L35
+  load 68 r2
+  blt r1 r2 .L32
+  load 97 r2
+  beq r1 r2 .L31
+  load 97 r2
+  sltu r1 r2 r1
+  jump .L60
+.L31:
+  savpc r15
+  add r15 12 r15
+  jump next
+  jump .L114
+.L32:
+  load 62 r2
+  beq r1 r2 .L34
+  load 62 r2
+  sltu r1 r2 r1
+  jump .L60
+.L34:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.43 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L114
+.L35:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -136 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  or r0 r1 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -16 r14 r1
+.L36:
+  addr2reg tok r12
+  read 0 r12 r2
+  load 69 r3
+  beq r2 r3 .L41
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump label
+  or r0 r1 r2
+  read -16 r14 r1
+  read -156 r14 r4
+  and r2 0xFF r3
+  load 0 r2
+  bne r3 r0 .L39
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump decl
+  or r0 r1 r2
+  read -16 r14 r1
+  read -156 r14 r4
+  and r2 0xFF r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L39:
+  beq r2 r0 .L36
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump stmt
+  read -16 r14 r1
+  read -156 r14 r4
+  jump .L36
+.L41:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  savpc r15
+  add r15 12 r15
+  jump next
+  jump .L114
+.L43:
+  load 35 r2
+  beq r1 r2 .L102
+  load 35 r2
+  blt r1 r2 .L55
+  load 42 r2
+  beq r1 r2 .L47
+  load 42 r2
+  sltu r1 r2 r1
+  jump .L60
+.L47:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -136 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  write -28 r14 r1
+  addr2reg .Lstring.18 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump expr
+  write -20 r14 r1
+  addr2reg .Lstring.14 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -20 r14 r4
+  add r4 8 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  and r1 2 r1
+  bne r1 r0 .L49
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.19 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -20 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L49:
+  savpc r15
+  add r15 12 r15
+  jump exprpromote
+  or r0 r1 r5
+  write -24 r14 r5
+  load 0 r1
+  write -172 r14 r1
+  add r5 8 r1
+  read 0 r1 r1
+  add r14 -172 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -172 r1
+  add r1 8 r2
+  load 0 r1
+  write 0 r2 r1
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -188 r2
+  add r2 0 r2
+  write 0 r2 r1
+  addr2reg .Lstring.21 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  read -24 r14 r5
+  read -156 r14 r4
+  add r14 -188 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  write -40 r14 r1
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 0 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcjmp
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  or r0 r1 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -32 r14 r1
+  add r14 -188 r2
+  add r2 4 r2
+  read 0 r2 r2
+  add r1 32 r3
+  write 0 r3 r2
+  add r1 40 r3
+  add r14 -172 r2
+  write 0 r3 r2
+.L50:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump label
+  or r0 r1 r2
+  read -32 r14 r1
+  read -156 r14 r4
+  and r2 0xFF r2
+  bne r2 r0 .L50
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump stmt
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcjmp
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 0 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -40 r14 r5
+  read -156 r14 r4
+  add r14 -172 r1
+  add r1 8 r1
+  read 0 r1 r7
+  bne r7 r0 .L54
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r7
+.L54:
+  add r14 -172 r6
+  savpc r15
+  add r15 12 r15
+  jump funcswitch
+  read -32 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  write -36 r14 r1
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -36 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  jump .L114
+.L55:
+  load 12 r2
+  sub r1 r2 r1
+  load 17 r2
+  bge r1 r2 .L60
+  shiftl r1 2 r2
+  addr2reg .Ljt56 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L57:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -136 r14 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  add r1 32 r2
+  read 0 r2 r2
+  bne r2 r0 .L59
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.40 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -136 r14 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L59:
+  add r1 32 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcjmp
+  addr2reg .Lstring.41 r5
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  jump .L114
+.L60:
+  savpc r15
+  add r15 12 r15
+  jump expr
+  or r0 r1 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -44 r14 r1
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -44 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  addr2reg .Lstring.11 r5
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  jump .L114
+.L61:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -136 r14 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  add r1 36 r2
+  read 0 r2 r2
+  bne r2 r0 .L63
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.38 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -136 r14 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L63:
+  add r1 36 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcjmp
+  addr2reg .Lstring.39 r5
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  jump .L114
+.L64:
+  savpc r15
+  add r15 12 r15
+  jump next
+  addr2reg .Lstring.27 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -188 r2
+  add r2 0 r2
+  write 0 r2 r1
+  addr2reg .Lstring.28 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -188 r2
+  add r2 4 r2
+  write 0 r2 r1
+  addr2reg .Lstring.29 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  read -136 r14 r4
+  add r14 -188 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  or r0 r1 r4
+  or r0 r4 r2
+  read -156 r14 r4
+  write -48 r14 r2
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r2 36 r3
+  write 0 r3 r1
+  add r14 -188 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r2 32 r2
+  write 0 r2 r1
+  add r14 -188 r1
+  add r1 0 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -48 r14 r4
+  or r0 r4 r1
+  read -156 r14 r4
+.L65:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump label
+  or r0 r1 r2
+  read -48 r14 r1
+  read -156 r14 r4
+  and r2 0xFF r2
+  bne r2 r0 .L65
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump stmt
+  read -48 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  write -60 r14 r1
+  addr2reg .Lstring.30 r5
+  load 52 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg .Lstring.22 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -60 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump expr
+  or r0 r1 r5
+  write -52 r14 r5
+  add r5 8 r1
+  read 0 r1 r6
+  write -56 r14 r6
+  add r6 4 r1
+  read 0 r1 r1
+  and r1 16 r1
+  bne r1 r0 .L69
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.23 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L69:
+  addr2reg .Lstring.14 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -52 r14 r5
+  read -156 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r5
+  read -56 r14 r6
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 0 r1
+  read 0 r1 r7
+  add r14 -188 r1
+  add r1 8 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcjnz
+  read -156 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  add r14 -188 r1
+  add r1 8 r1
+  read 0 r1 r5
+  or r0 r4 r1
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -60 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  addr2reg .Lstring.30 r5
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  jump .L114
+.L70:
+  savpc r15
+  add r15 12 r15
+  jump next
+  addr2reg .Lstring.31 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -136 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  or r0 r1 r4
+  read -156 r14 r1
+  write -76 r14 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump decl
+  read -76 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L74
+  addr2reg tok r12
+  read 0 r12 r1
+  load 97 r2
+  beq r1 r2 .L73
+  savpc r15
+  add r15 12 r15
+  jump expr
+  or r0 r1 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -64 r14 r1
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -64 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+.L73:
+  load 0 r5
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+.L74:
+  addr2reg .Lstring.32 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -188 r2
+  add r2 0 r2
+  write 0 r2 r1
+  addr2reg .Lstring.33 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -188 r2
+  add r2 4 r2
+  write 0 r2 r1
+  addr2reg .Lstring.34 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -188 r2
+  add r2 8 r2
+  write 0 r2 r1
+  addr2reg .Lstring.35 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  read -156 r14 r4
+  add r14 -188 r2
+  add r2 12 r2
+  write 0 r2 r1
+  add r14 -188 r1
+  add r1 0 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -76 r14 r4
+  addr2reg tok r12
+  read 0 r12 r1
+  load 97 r2
+  beq r1 r2 .L78
+  savpc r15
+  add r15 12 r15
+  jump expr
+  or r0 r1 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -72 r14 r1
+  add r1 8 r2
+  read 0 r2 r6
+  write -68 r14 r6
+  add r6 4 r2
+  read 0 r2 r2
+  and r2 16 r2
+  bne r2 r0 .L77
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.23 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -72 r14 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L77:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r5
+  read -68 r14 r6
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r7
+  add r14 -188 r1
+  add r1 12 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcjnz
+  read -72 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+.L78:
+  load 0 r5
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -76 r14 r4
+  addr2reg tok r12
+  read 0 r12 r1
+  load 67 r2
+  beq r1 r2 .L81
+  savpc r15
+  add r15 12 r15
+  jump expr
+  or r0 r1 r4
+  write -88 r14 r4
+  jump .L83
+.L81:
+  load 0 r1
+  write -88 r14 r1
+.L83:
+  load 0 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -76 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  or r0 r1 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -80 r14 r1
+  add r14 -188 r2
+  add r2 12 r2
+  read 0 r2 r2
+  add r1 32 r3
+  write 0 r3 r2
+  add r14 -188 r2
+  add r2 8 r2
+  read 0 r2 r2
+  add r1 36 r3
+  write 0 r3 r2
+.L84:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump label
+  or r0 r1 r2
+  read -80 r14 r1
+  read -156 r14 r4
+  and r2 0xFF r2
+  bne r2 r0 .L84
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump stmt
+  read -80 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  write -84 r14 r1
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -88 r14 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  beq r1 r0 .L88
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  read -88 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -156 r14 r4
+.L88:
+  add r14 -188 r1
+  add r1 0 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcjmp
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 12 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -84 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  jump .L114
+.L89:
+  savpc r15
+  add r15 12 r15
+  jump next
+  addr2reg .Lstring.36 r5
+  load 4 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  or r0 r1 r5
+  read -156 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump funcgoto
+  read -156 r14 r4
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcjmp
+  addr2reg .Lstring.37 r5
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  jump .L114
+.L90:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -136 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  write -104 r14 r1
+  addr2reg .Lstring.12 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -104 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump expr
+  or r0 r1 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -92 r14 r1
+  add r1 8 r2
+  read 0 r2 r6
+  write -100 r14 r6
+  add r6 4 r2
+  read 0 r2 r2
+  and r2 16 r2
+  bne r2 r0 .L92
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.13 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -92 r14 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L92:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  write -96 r14 r1
+  read -92 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  addr2reg .Lstring.14 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg .Lstring.15 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -188 r2
+  add r2 0 r2
+  write 0 r2 r1
+  addr2reg .Lstring.16 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  read -96 r14 r5
+  read -100 r14 r6
+  read -156 r14 r4
+  add r14 -188 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -188 r1
+  add r1 0 r1
+  read 0 r1 r7
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcjnz
+  read -156 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  add r14 -188 r1
+  add r1 0 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -104 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  or r0 r1 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -108 r14 r1
+.L93:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump label
+  or r0 r1 r2
+  read -108 r14 r1
+  read -156 r14 r4
+  and r2 0xFF r2
+  bne r2 r0 .L93
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump stmt
+  read -108 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  write -112 r14 r1
+  load 21 r4
+  savpc r15
+  add r15 12 r15
+  jump consume
+  read -156 r14 r4
+  and r1 0xFF r1
+  bne r1 r0 .L97
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -112 r14 r4
+  jump .L101
+.L97:
+  addr2reg .Lstring.17 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  read -156 r14 r4
+  add r14 -188 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -188 r1
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcjmp
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -112 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  or r0 r1 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -116 r14 r1
+.L98:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump label
+  or r0 r1 r2
+  read -116 r14 r1
+  read -156 r14 r4
+  and r2 0xFF r2
+  bne r2 r0 .L98
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump stmt
+  read -116 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  write -120 r14 r1
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -120 r14 r4
+.L101:
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  jump .L114
+.L102:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -156 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump functype
+  or r0 r1 r2
+  read -136 r14 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -124 r14 r2
+  add r2 20 r2
+  read 0 r2 r2
+  addr2reg typevoid r3
+  bne r2 r3 .L105
+  load 0 r1
+  or r0 r1 r5
+  jump .L107
+.L105:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump expr
+  or r0 r1 r4
+  read -124 r14 r1
+  add r1 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump exprassign
+  or r0 r1 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -128 r14 r1
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  write -132 r14 r1
+  read -128 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delexpr
+  read -132 r14 r5
+  read -156 r14 r4
+.L107:
+  savpc r15
+  add r15 12 r15
+  jump funcret
+  addr2reg .Lstring.42 r5
+  load 97 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  jump .L114
+.L108:
+  savpc r15
+  add r15 12 r15
+  jump next
+  read -136 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  write -148 r14 r1
+  addr2reg .Lstring.22 r5
+  load 66 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  read -148 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump expr
+  or r0 r1 r5
+  write -140 r14 r5
+  add r5 8 r1
+  read 0 r1 r6
+  write -144 r14 r6
+  add r6 4 r1
+  read 0 r1 r1
+  and r1 16 r1
+  bne r1 r0 .L110
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.23 r5
+  addr2reg tok+8 r4
+  savpc r15
+  add r15 12 r15
+  jump error
+  load32 -24 r1
+  sub r13 r1 r13
+.L110:
+  addr2reg .Lstring.14 r5
+  load 67 r4
+  savpc r15
+  add r15 12 r15
+  jump expect
+  addr2reg .Lstring.24 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -188 r2
+  add r2 0 r2
+  write 0 r2 r1
+  addr2reg .Lstring.25 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  add r14 -188 r2
+  add r2 4 r2
+  write 0 r2 r1
+  addr2reg .Lstring.26 r4
+  savpc r15
+  add r15 12 r15
+  jump mkblock
+  read -156 r14 r4
+  add r14 -188 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -188 r1
+  add r1 0 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -140 r14 r5
+  read -156 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump funcexpr
+  or r0 r1 r5
+  read -144 r14 r6
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r7
+  add r14 -188 r1
+  add r1 8 r1
+  read 0 r1 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump funcjnz
+  read -156 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  add r14 -188 r1
+  add r1 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -148 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump mkscope
+  or r0 r1 r4
+  or r0 r4 r1
+  read -156 r14 r4
+  write -152 r14 r1
+  add r14 -188 r2
+  add r2 0 r2
+  read 0 r2 r2
+  add r1 36 r3
+  write 0 r3 r2
+  add r14 -188 r2
+  add r2 8 r2
+  read 0 r2 r2
+  add r1 32 r3
+  write 0 r3 r2
+.L111:
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump label
+  or r0 r1 r2
+  read -152 r14 r1
+  read -156 r14 r4
+  and r2 0xFF r2
+  bne r2 r0 .L111
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump stmt
+  read -152 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delscope
+  write -160 r14 r1
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 0 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funcjmp
+  read -156 r14 r4
+  add r14 -188 r1
+  add r1 8 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump funclabel
+  read -160 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump delscope
+.L114:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt56:
+  .int .L57
+  .int .L60
+  .int .L60
+  .int .L60
+  .int .L60
+  .int .L61
+  .int .L60
+  .int .L64
+  .int .L60
+  .int .L60
+  .int .L60
+  .int .L60
+  .int .L60
+  .int .L60
+  .int .L70
+  .int .L89
+  .int .L90
+
+/* end function stmt */
+
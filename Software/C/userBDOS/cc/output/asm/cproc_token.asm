@@ -0,0 +1,1203 @@
+.data
+.balign 1
+.Lstring.1:
+	.ascii "alignas\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.2:
+	.ascii "alignof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.3:
+	.ascii "auto\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.4:
+	.ascii "bool\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "break\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "case\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.7:
+	.ascii "char\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "const\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "constexpr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "continue\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "default\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "do\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "double\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "else\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "enum\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "extern\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "false\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "float\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "for\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "goto\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "if\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "inline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "int\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "long\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "nullptr\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "register\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "restrict\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "return\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "short\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "signed\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "sizeof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "static\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "static_assert\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "struct\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "switch\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.36:
+	.ascii "thread_local\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "true\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.38:
+	.ascii "typedef\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.39:
+	.ascii "typeof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.40:
+	.ascii "typeof_unqual\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.41:
+	.ascii "union\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.42:
+	.ascii "unsigned\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "void\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.44:
+	.ascii "volatile\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.45:
+	.ascii "while\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.46:
+	.ascii "_Atomic\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.47:
+	.ascii "_BitInt\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.48:
+	.ascii "_Complex\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.49:
+	.ascii "_Decimal128\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.50:
+	.ascii "_Decimal32\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.51:
+	.ascii "_Decimal64\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.52:
+	.ascii "_Generic\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.53:
+	.ascii "_Imaginary\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.54:
+	.ascii "_Noreturn\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.55:
+	.ascii "__asm__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.56:
+	.ascii "__attribute__\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.57:
+	.ascii "[\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.58:
+	.ascii "]\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.59:
+	.ascii "(\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.60:
+	.ascii ")\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.61:
+	.ascii "{\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.62:
+	.ascii "}\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.63:
+	.ascii ".\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.64:
+	.ascii "->\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.65:
+	.ascii "++\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.66:
+	.ascii "--\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.67:
+	.ascii "&\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.68:
+	.ascii "*\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.69:
+	.ascii "+\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.70:
+	.ascii "-\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.71:
+	.ascii "~\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.72:
+	.ascii "!\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.73:
+	.ascii "/\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.74:
+	.ascii "%\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.75:
+	.ascii "<<\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.76:
+	.ascii ">>\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.77:
+	.ascii "<\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.78:
+	.ascii ">\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.79:
+	.ascii "<=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.80:
+	.ascii ">=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.81:
+	.ascii "==\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.82:
+	.ascii "!=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.83:
+	.ascii "^\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.84:
+	.ascii "|\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.85:
+	.ascii "&&\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.86:
+	.ascii "||\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.87:
+	.ascii "?\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.88:
+	.ascii ":\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.89:
+	.ascii "::\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.90:
+	.ascii ";\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.91:
+	.ascii "...\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.92:
+	.ascii "=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.93:
+	.ascii "*=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.94:
+	.ascii "/=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.95:
+	.ascii "%=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.96:
+	.ascii "+=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.97:
+	.ascii "-=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.98:
+	.ascii "<<=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.99:
+	.ascii ">>=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.100:
+	.ascii "&=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.101:
+	.ascii "^=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.102:
+	.ascii "|=\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.103:
+	.ascii ",\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.104:
+	.ascii "#\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.105:
+	.ascii "##\000"
+/* end data */
+
+.data
+.balign 4
+.globl tokstr
+tokstr:
+	.fill 32,1,0
+	.int .Lstring.1+0
+	.int .Lstring.2+0
+	.int .Lstring.3+0
+	.int .Lstring.4+0
+	.int .Lstring.5+0
+	.int .Lstring.6+0
+	.int .Lstring.7+0
+	.int .Lstring.8+0
+	.int .Lstring.9+0
+	.int .Lstring.10+0
+	.int .Lstring.11+0
+	.int .Lstring.12+0
+	.int .Lstring.13+0
+	.int .Lstring.14+0
+	.int .Lstring.15+0
+	.int .Lstring.16+0
+	.int .Lstring.17+0
+	.int .Lstring.18+0
+	.int .Lstring.19+0
+	.int .Lstring.20+0
+	.int .Lstring.21+0
+	.int .Lstring.22+0
+	.int .Lstring.23+0
+	.int .Lstring.24+0
+	.int .Lstring.25+0
+	.int .Lstring.26+0
+	.int .Lstring.27+0
+	.int .Lstring.28+0
+	.int .Lstring.29+0
+	.int .Lstring.30+0
+	.int .Lstring.31+0
+	.int .Lstring.32+0
+	.int .Lstring.33+0
+	.int .Lstring.34+0
+	.int .Lstring.35+0
+	.int .Lstring.36+0
+	.int .Lstring.37+0
+	.int .Lstring.38+0
+	.int .Lstring.39+0
+	.int .Lstring.40+0
+	.int .Lstring.41+0
+	.int .Lstring.42+0
+	.int .Lstring.43+0
+	.int .Lstring.44+0
+	.int .Lstring.45+0
+	.int .Lstring.46+0
+	.int .Lstring.47+0
+	.int .Lstring.48+0
+	.int .Lstring.49+0
+	.int .Lstring.50+0
+	.int .Lstring.51+0
+	.int .Lstring.52+0
+	.int .Lstring.53+0
+	.int .Lstring.54+0
+	.int .Lstring.55+0
+	.int .Lstring.56+0
+	.int .Lstring.57+0
+	.int .Lstring.58+0
+	.int .Lstring.59+0
+	.int .Lstring.60+0
+	.int .Lstring.61+0
+	.int .Lstring.62+0
+	.int .Lstring.63+0
+	.int .Lstring.64+0
+	.int .Lstring.65+0
+	.int .Lstring.66+0
+	.int .Lstring.67+0
+	.int .Lstring.68+0
+	.int .Lstring.69+0
+	.int .Lstring.70+0
+	.int .Lstring.71+0
+	.int .Lstring.72+0
+	.int .Lstring.73+0
+	.int .Lstring.74+0
+	.int .Lstring.75+0
+	.int .Lstring.76+0
+	.int .Lstring.77+0
+	.int .Lstring.78+0
+	.int .Lstring.79+0
+	.int .Lstring.80+0
+	.int .Lstring.81+0
+	.int .Lstring.82+0
+	.int .Lstring.83+0
+	.int .Lstring.84+0
+	.int .Lstring.85+0
+	.int .Lstring.86+0
+	.int .Lstring.87+0
+	.int .Lstring.88+0
+	.int .Lstring.89+0
+	.int .Lstring.90+0
+	.int .Lstring.91+0
+	.int .Lstring.92+0
+	.int .Lstring.93+0
+	.int .Lstring.94+0
+	.int .Lstring.95+0
+	.int .Lstring.96+0
+	.int .Lstring.97+0
+	.int .Lstring.98+0
+	.int .Lstring.99+0
+	.int .Lstring.100+0
+	.int .Lstring.101+0
+	.int .Lstring.102+0
+	.int .Lstring.103+0
+	.int .Lstring.104+0
+	.int .Lstring.105+0
+/* end data */
+
+.data
+.balign 1
+.Lstring.107:
+	.ascii "\012\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.108:
+	.ascii "cannot print token %d\000"
+/* end data */
+
+
+.text
+; function tokenprint
+.global tokenprint
+tokenprint:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+  add r4 5 r1
+  readbu 0 r1 r1
+  beq r1 r0 .L3
+  addr2reg __stdout_file r5
+  load 32 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  read -12 r14 r4
+.L3:
+  read 0 r4 r5
+  load 1 r1
+  sub r5 r1 r1
+  load 7 r2
+  bge r1 r2 .L8
+  shiftl r1 2 r2
+  addr2reg .Ljt5 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L6:
+  addr2reg .Lstring.107 r1
+  or r0 r1 r4
+  jump .L10
+.L8:
+  shiftl r5 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r4
+  jump .L10
+.L9:
+  add r4 20 r1
+  read 0 r1 r4
+.L10:
+  write -16 r14 r4
+  bne r4 r0 .L12
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.108 r4
+  savpc r15
+  add r15 12 r15
+  jump fatal
+  read -16 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L12:
+  addr2reg __stdout_file r5
+  savpc r15
+  add r15 12 r15
+  jump fputs
+.L13:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt5:
+  .int .L13
+  .int .L6
+  .int .L8
+  .int .L9
+  .int .L9
+  .int .L9
+  .int .L9
+
+/* end function tokenprint */
+
+.data
+.balign 1
+.Lstring.110:
+	.ascii "EOF\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.111:
+	.ascii "identifier\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.112:
+	.ascii "number\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.113:
+	.ascii "character\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.114:
+	.ascii "string\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.115:
+	.ascii "newline\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.116:
+	.ascii "%s '%s'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.117:
+	.ascii "%s %s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.118:
+	.ascii "%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.119:
+	.ascii "<U+%04x>\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.120:
+	.ascii "'%s'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.121:
+	.ascii "<unknown>\000"
+/* end data */
+
+
+.text
+; function tokendesc
+tokendesc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r7 r1
+  write -8 r14 r5
+  write -12 r14 r4
+  load 1 r2
+  sub r6 r2 r2
+  load 7 r3
+  blt r2 r3 .L21
+  load 113 r1
+  blt r6 r1 .L19
+  load 0 r1
+  jump .L20
+.L19:
+  shiftl r6 2 r2
+  addr2reg tokstr r1
+  add r1 r2 r1
+  read 0 r1 r1
+.L20:
+  load 0 r3
+  load 1 r2
+  jump .L29
+.L21:
+  shiftl r2 2 r3
+  addr2reg .Ljt21 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L22:
+  addr2reg .Lstring.110 r3
+  load 1 r2
+  jump .L29
+.L23:
+  addr2reg .Lstring.115 r3
+  load 1 r2
+  jump .L29
+.L24:
+  load 0 r3
+  load 1 r2
+  jump .L29
+.L25:
+  addr2reg .Lstring.111 r3
+  load 1 r2
+  jump .L29
+.L26:
+  addr2reg .Lstring.112 r3
+  load 1 r2
+  jump .L29
+.L27:
+  addr2reg .Lstring.113 r3
+  load 0 r2
+  jump .L29
+.L28:
+  addr2reg .Lstring.114 r3
+  load 0 r2
+.L29:
+  or r0 r3 r7
+  write -16 r14 r1
+  load 0 r3
+  beq r7 r0 .L31
+  xor r1 0 r3
+  sltu r0 r3 r3
+.L31:
+  bne r3 r0 .L41
+  bne r7 r0 .L40
+  load 0 r2
+  load 3 r3
+  bne r6 r3 .L35
+  readbu 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump isprint
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  read -12 r14 r4
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L35:
+  bne r2 r0 .L39
+  bne r1 r0 .L38
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.121 r6
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L45
+.L38:
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r7
+  addr2reg .Lstring.120 r6
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L45
+.L39:
+  readbu 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.119 r6
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L45
+.L40:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.118 r6
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L45
+.L41:
+  and r2 0xFF r2
+  bne r2 r0 .L43
+  addr2reg .Lstring.117 r2
+  jump .L44
+.L43:
+  addr2reg .Lstring.116 r2
+.L44:
+  or r0 r2 r6
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump snprintf
+  load32 -28 r1
+  sub r13 r1 r13
+.L45:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt21:
+  .int .L22
+  .int .L23
+  .int .L24
+  .int .L25
+  .int .L26
+  .int .L27
+  .int .L28
+
+/* end function tokendesc */
+
+.data
+.balign 1
+.Lstring.123:
+	.ascii "expected %s %s, saw %s\000"
+/* end data */
+
+
+.text
+; function tokencheck
+.global tokencheck
+tokencheck:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 152 r13
+  write -12 r14 r6
+  or r0 r5 r6
+  write -16 r14 r4
+  read 0 r4 r1
+  beq r1 r6 .L50
+  load 0 r7
+  load 64 r5
+  add r14 -144 r4
+  savpc r15
+  add r15 12 r15
+  jump tokendesc
+  read -16 r14 r4
+  read 0 r4 r6
+  add r4 20 r1
+  read 0 r1 r7
+  load 64 r5
+  add r14 -80 r4
+  savpc r15
+  add r15 12 r15
+  jump tokendesc
+  read -12 r14 r7
+  read -16 r14 r4
+  add r4 8 r4
+  load 28 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 24 r2
+  add r14 -80 r1
+  write 0 r2 r1
+  add r14 -144 r6
+  addr2reg .Lstring.123 r5
+  savpc r15
+  add r15 12 r15
+  jump error
+  read -16 r14 r4
+  load32 -28 r1
+  sub r13 r1 r13
+.L50:
+  add r4 20 r1
+  read 0 r1 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function tokencheck */
+
+.data
+.balign 1
+.Lstring.125:
+	.ascii "%s:%zu:%zu: error: \000"
+/* end data */
+
+
+.text
+; function error
+.global error
+error:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  write 8 r14 r4
+  write 12 r14 r5
+  write 16 r14 r6
+  write 20 r14 r7
+  sub r13 28 r13
+  write -16 r14 r5
+  read 0 r4 r6
+  add r4 4 r1
+  read 0 r1 r7
+  add r4 8 r1
+  read 0 r1 r1
+  load 28 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 24 r2
+  write 0 r2 r1
+  addr2reg .Lstring.125 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r5
+  load32 -28 r1
+  sub r13 r1 r13
+  add r14 16 r1
+  write -20 r14 r1
+  read -20 r14 r6
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump vfprintf
+  addr2reg __stderr_file r5
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump putc
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump exit
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function error */
+
+.data
+.balign 4
+.globl tok
+tok:
+	.fill 24,1,0
+/* end data */
+
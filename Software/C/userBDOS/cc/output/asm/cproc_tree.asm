@@ -0,0 +1,319 @@
+
+.text
+; function rot
+rot:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r6 r7
+  or r0 r5 r6
+  write -12 r14 r4
+  add r6 4 r1
+  shiftl r7 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 4 r2
+  xor r7 0 r3
+  sltu r3 1 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r6 12 r3
+  read 0 r3 r3
+  write -16 r14 r3
+  bne r2 r0 .L4
+  load 0 r3
+  jump .L5
+.L4:
+  add r2 12 r3
+  read 0 r3 r3
+.L5:
+  add r1 4 r4
+  shiftl r7 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  bne r4 r0 .L8
+  load 0 r4
+  jump .L9
+.L8:
+  add r4 12 r4
+  read 0 r4 r4
+.L9:
+  bgts r3 r4 .L12
+  add r6 4 r4
+  shiftl r7 2 r5
+  add r4 r5 r5
+  read -12 r14 r4
+  write 0 r5 r2
+  read -16 r14 r2
+  add r1 4 r5
+  xor r7 0 r7
+  sltu r7 1 r7
+  shiftl r7 2 r7
+  add r5 r7 r5
+  write 0 r5 r6
+  add r3 1 r5
+  add r6 12 r6
+  write 0 r6 r5
+  or r0 r1 r5
+  add r3 2 r1
+  add r5 12 r3
+  write 0 r3 r1
+  or r0 r5 r1
+  jump .L14
+.L12:
+  or r0 r1 r5
+  or r0 r2 r1
+  add r1 4 r2
+  xor r7 0 r4
+  sltu r4 1 r4
+  shiftl r4 2 r4
+  add r2 r4 r2
+  read 0 r2 r2
+  write -4 r14 r2
+  add r6 4 r2
+  shiftl r7 2 r4
+  add r2 r4 r4
+  read -4 r14 r2
+  write 0 r4 r2
+  add r1 4 r2
+  shiftl r7 2 r4
+  add r2 r4 r2
+  read 0 r2 r2
+  write -8 r14 r2
+  add r5 4 r2
+  xor r7 0 r4
+  sltu r4 1 r4
+  shiftl r4 2 r4
+  add r2 r4 r4
+  read -8 r14 r2
+  write 0 r4 r2
+  add r1 4 r2
+  xor r7 0 r4
+  sltu r4 1 r4
+  shiftl r4 2 r4
+  add r2 r4 r2
+  read -12 r14 r4
+  write 0 r2 r6
+  add r1 4 r2
+  shiftl r7 2 r7
+  add r2 r7 r7
+  read -16 r14 r2
+  write 0 r7 r5
+  add r6 12 r6
+  write 0 r6 r3
+  add r5 12 r5
+  write 0 r5 r3
+  add r3 1 r3
+  add r1 12 r5
+  write 0 r5 r3
+.L14:
+  write 0 r4 r1
+  add r1 12 r1
+  read 0 r1 r1
+  sub r1 r2 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rot */
+
+
+.text
+; function balance
+balance:
+  read 0 r4 r3
+  add r3 4 r1
+  add r1 0 r1
+  read 0 r1 r1
+  bne r1 r0 .L21
+  load 0 r1
+  jump .L22
+.L21:
+  add r1 12 r1
+  read 0 r1 r1
+.L22:
+  add r3 4 r2
+  add r2 4 r2
+  read 0 r2 r2
+  bne r2 r0 .L25
+  or r0 r1 r2
+  load 0 r1
+  jump .L27
+.L25:
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  add r1 12 r1
+  read 0 r1 r1
+.L27:
+  sub r2 r1 r5
+  add r5 1 r5
+  load 3 r6
+  blt r5 r6 .L29
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  slt r2 r1 r6
+  or r0 r3 r5
+  savpc r15
+  add r15 12 r15
+  jump rot
+  jump .L35
+.L29:
+  or r0 r1 r4
+  or r0 r2 r1
+  add r3 12 r2
+  read 0 r2 r2
+  blts r1 r4 .L32
+  add r1 1 r1
+  jump .L34
+.L32:
+  or r0 r4 r1
+  add r1 1 r1
+.L34:
+  add r3 12 r3
+  write 0 r3 r1
+  sub r1 r2 r1
+  jumpr 0 r15
+.L35:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function balance */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "sz > sizeof(*n)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/cproc/tree.c\000"
+/* end data */
+
+
+.text
+; function treeinsert
+.global treeinsert
+treeinsert:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 232 r13
+  or r0 r4 r2
+  or r0 r6 r4
+  write -16 r14 r4
+  write -24 r14 r5
+  read 0 r2 r1
+  add r14 -224 r3
+  add r3 0 r3
+  write 0 r3 r2
+  load 1 r2
+  or r0 r4 r6
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L40:
+  write -20 r14 r1
+  beq r2 r0 .L45
+  read 0 r2 r4
+  beq r5 r4 .L43
+  add r2 4 r3
+  sltu r4 r5 r4
+  shiftl r4 2 r4
+  add r3 r4 r3
+  or r0 r1 r4
+  add r1 1 r1
+  shiftl r4 2 r7
+  add r14 -224 r4
+  add r4 r7 r4
+  write 0 r4 r3
+  or r0 r2 r3
+  add r2 4 r2
+  read 0 r3 r3
+  sltu r3 r5 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  jump .L40
+.L43:
+  or r0 r2 r1
+  add r1 16 r3
+  load 0 r2
+  writeb 0 r3 r2
+  jump .L54
+.L45:
+  or r0 r6 r4
+  load 20 r1
+  bgt r4 r1 .L48
+  load 85 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r4
+.L48:
+  savpc r15
+  add r15 12 r15
+  jump xmalloc
+  or r0 r1 r2
+  read -20 r14 r1
+  read -24 r14 r5
+  write -32 r14 r2
+  write 0 r2 r5
+  add r2 4 r3
+  add r3 4 r4
+  load 0 r3
+  write 0 r4 r3
+  add r2 4 r3
+  add r3 0 r4
+  load 0 r3
+  write 0 r4 r3
+  add r2 12 r4
+  load 1 r3
+  write 0 r4 r3
+  load 1 r3
+  sub r1 r3 r1
+  shiftl r1 2 r4
+  add r14 -224 r3
+  add r3 r4 r3
+  read 0 r3 r3
+  write 0 r3 r2
+.L49:
+  load 0 r2
+  beq r1 r0 .L51
+  load 1 r2
+  sub r1 r2 r1
+  write -28 r14 r1
+  shiftl r1 2 r2
+  add r14 -224 r1
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump balance
+  or r0 r1 r2
+  read -28 r14 r1
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L51:
+  bne r2 r0 .L49
+  read -32 r14 r1
+  add r1 16 r3
+  load 1 r2
+  writeb 0 r3 r2
+.L54:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function treeinsert */
+
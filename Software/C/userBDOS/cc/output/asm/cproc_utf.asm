@@ -0,0 +1,266 @@
+.data
+.balign 1
+.Lstring.2:
+	.ascii "0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.3:
+	.ascii "BuildTools/cproc/utf.c\000"
+/* end data */
+
+
+.text
+; function utf8enc
+.global utf8enc
+utf8enc:
+  load 128 r1
+  blt r5 r1 .L11
+  load 2048 r1
+  blt r5 r1 .L10
+  load 1 r1
+  load32 55296 r2
+  blt r5 r2 .L5
+  load32 57344 r1
+  sub r5 r1 r1
+  sltu r1 8192 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L5:
+  bne r1 r0 .L9
+  load32 65536 r1
+  sub r5 r1 r1
+  load32 1048576 r2
+  blt r1 r2 .L8
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 31 r6
+  addr2reg .Lstring.3 r5
+  addr2reg .Lstring.2 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  load 0 r1
+  jump .L12
+.L8:
+  shiftr r5 18 r2
+  load 240 r1
+  or r1 r2 r1
+  add r4 0 r2
+  writeb 0 r2 r1
+  shiftr r5 12 r1
+  and r1 63 r2
+  load 128 r1
+  or r1 r2 r1
+  add r4 1 r2
+  writeb 0 r2 r1
+  shiftr r5 6 r1
+  and r1 63 r2
+  load 128 r1
+  or r1 r2 r1
+  add r4 2 r2
+  writeb 0 r2 r1
+  and r5 63 r2
+  load 128 r1
+  or r1 r2 r1
+  add r4 3 r2
+  writeb 0 r2 r1
+  load 4 r1
+  jumpr 0 r15
+.L9:
+  shiftr r5 12 r2
+  load 224 r1
+  or r1 r2 r1
+  add r4 0 r2
+  writeb 0 r2 r1
+  shiftr r5 6 r1
+  and r1 63 r2
+  load 128 r1
+  or r1 r2 r1
+  add r4 1 r2
+  writeb 0 r2 r1
+  and r5 63 r2
+  load 128 r1
+  or r1 r2 r1
+  add r4 2 r2
+  writeb 0 r2 r1
+  load 3 r1
+  jumpr 0 r15
+.L10:
+  shiftr r5 6 r2
+  load 192 r1
+  or r1 r2 r1
+  add r4 0 r2
+  writeb 0 r2 r1
+  and r5 63 r2
+  load 128 r1
+  or r1 r2 r1
+  add r4 1 r2
+  writeb 0 r2 r1
+  load 2 r1
+  jumpr 0 r15
+.L11:
+  add r4 0 r1
+  writeb 0 r1 r5
+  load 1 r1
+  jumpr 0 r15
+.L12:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function utf8enc */
+
+
+.text
+; function utf8dec
+.global utf8dec
+utf8dec:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r5 0 r1
+  readbu 0 r1 r1
+  load 128 r2
+  blts r1 r2 .L39
+  and r1 224 r2
+  load 192 r3
+  beq r2 r3 .L23
+  and r1 240 r2
+  load 224 r3
+  beq r2 r3 .L22
+  and r1 248 r2
+  load 240 r3
+  beq r2 r3 .L20
+  load32 -1 r1
+  jump .L40
+.L20:
+  and r1 7 r2
+  load 4 r1
+  jump .L24
+.L22:
+  and r1 15 r2
+  load 3 r1
+  jump .L24
+.L23:
+  and r1 31 r2
+  load 2 r1
+.L24:
+  blt r6 r1 .L38
+  load 1 r3
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+  or r0 r1 r12
+  or r0 r3 r1
+  or r0 r12 r3
+.L27:
+  bge r2 r3 .L32
+  add r5 1 r5
+  readbu 0 r5 r4
+  and r4 192 r6
+  load 128 r7
+  bne r6 r7 .L31
+  shiftl r1 6 r1
+  and r4 63 r4
+  or r1 r4 r1
+  add r2 1 r2
+  jump .L27
+.L31:
+  load32 -1 r1
+  jump .L40
+.L32:
+  or r0 r1 r2
+  or r0 r3 r1
+  read -16 r14 r4
+  load 1 r3
+  load32 1114112 r5
+  bge r2 r5 .L35
+  load32 55296 r3
+  sub r2 r3 r3
+  sltu r3 512 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L35:
+  bne r3 r0 .L37
+  write 0 r4 r2
+  jump .L40
+.L37:
+  load32 -1 r1
+  jump .L40
+.L38:
+  load32 -1 r1
+  jump .L40
+.L39:
+  write 0 r4 r1
+  load 1 r1
+.L40:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function utf8dec */
+
+
+.text
+; function utf16enc
+.global utf16enc
+utf16enc:
+  load 1 r1
+  load32 55296 r2
+  blt r5 r2 .L45
+  load32 57344 r1
+  sub r5 r1 r1
+  sltu r1 8192 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L45:
+  bne r1 r0 .L49
+  load32 65536 r1
+  sub r5 r1 r1
+  load32 1048576 r2
+  blt r1 r2 .L48
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 86 r6
+  addr2reg .Lstring.3 r5
+  addr2reg .Lstring.2 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  load 0 r1
+  jump .L50
+.L48:
+  shiftr r1 10 r2
+  and r2 1023 r3
+  load32 55296 r2
+  or r2 r3 r2
+  add r4 0 r3
+  writeh 0 r3 r2
+  and r1 1023 r2
+  load32 56320 r1
+  or r1 r2 r1
+  add r4 2 r2
+  writeh 0 r2 r1
+  load 2 r1
+  jumpr 0 r15
+.L49:
+  add r4 0 r1
+  writeh 0 r1 r5
+  load 1 r1
+  jumpr 0 r15
+.L50:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function utf16enc */
+
@@ -0,0 +1,1311 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "BuildTools/QBE/alias.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "unreachable\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "a->type != ABot\000"
+/* end data */
+
+
+.text
+; function getalias
+.global getalias
+getalias:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r6
+  add r14 -20 r1
+  write 0 r1 r5
+  write -16 r14 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -12 r14 r6
+  or r0 r1 r2
+  read -16 r14 r1
+  load 1 r3
+  beq r2 r3 .L30
+  load 1 r3
+  bge r2 r3 .L23
+  beq r2 r0 .L24
+  or r0 r2 r1
+  sltu r1 r0 r1
+.L23:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -12 r14 r6
+  read -16 r14 r1
+  or r0 r1 r2
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L25
+.L24:
+  or r0 r1 r2
+.L25:
+  add r6 4 r1
+  read 0 r1 r1
+  read -20 r14 r3
+  shiftr r3 3 r3
+  load 160 r4
+  mults r3 r4 r3
+  add r1 r3 r1
+  add r1 128 r1
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r4
+  read 0 r1 r5
+  write 0 r4 r5
+  add r1 4 r1
+  add r4 4 r4
+  read 0 r1 r5
+  write 0 r4 r5
+  add r1 4 r1
+  add r4 4 r4
+  read 0 r1 r5
+  write 0 r4 r5
+  add r1 4 r1
+  add r4 4 r4
+  read 0 r1 r5
+  write 0 r4 r5
+  add r1 4 r1
+  add r4 4 r4
+  read 0 r1 r1
+  write 0 r4 r1
+  and r3 1 r4
+  bne r4 r0 .L27
+  or r0 r3 r1
+  jump .L28
+.L27:
+  read 0 r1 r1
+  write 0 r2 r1
+.L28:
+  bne r1 r0 .L34
+  load 15 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  jump .L34
+.L30:
+  add r6 8 r2
+  read 0 r2 r2
+  read -20 r14 r3
+  shiftr r3 3 r3
+  shiftl r3 5 r3
+  add r2 r3 r2
+  read 0 r2 r3
+  load 2 r4
+  beq r3 r4 .L32
+  load 2 r3
+  write 0 r1 r3
+  jump .L33
+.L32:
+  load 4 r3
+  write 0 r1 r3
+  add r2 4 r3
+  add r1 12 r4
+  read 0 r3 r5
+  write 0 r4 r5
+  add r3 4 r3
+  add r4 4 r4
+  read 0 r3 r3
+  write 0 r4 r3
+.L33:
+  add r2 16 r2
+  read 0 r2 r2
+  add r1 8 r3
+  write 0 r3 r2
+  add r1 20 r2
+  load 0 r1
+  write 0 r2 r1
+.L34:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function getalias */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "ap.type == ACon || ap.type == AUnk\000"
+/* end data */
+
+
+.text
+; function alias
+.global alias
+alias:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 112 r13
+  read 16 r14 r1
+  write -12 r14 r1
+  read 12 r14 r2
+  write -16 r14 r2
+  read 8 r14 r2
+  write -20 r14 r2
+  or r0 r7 r2
+  add r14 -84 r3
+  write 0 r3 r2
+  write -24 r14 r6
+  or r0 r1 r6
+  write -28 r14 r5
+  or r0 r4 r1
+  add r14 -88 r2
+  write 0 r2 r1
+  read -88 r14 r5
+  add r14 -80 r4
+  savpc r15
+  add r15 12 r15
+  jump getalias
+  read -12 r14 r6
+  read -84 r14 r5
+  add r14 -56 r4
+  savpc r15
+  add r15 12 r15
+  jump getalias
+  read -16 r14 r2
+  read -20 r14 r4
+  read -24 r14 r3
+  read -28 r14 r6
+  add r14 -80 r1
+  add r1 8 r5
+  read 0 r5 r1
+  add r1 r6 r1
+  write 0 r5 r1
+  add r14 -56 r5
+  add r5 8 r5
+  read 0 r5 r5
+  sub r1 r5 r1
+  write 0 r2 r1
+  add r14 -80 r1
+  add r1 8 r1
+  read 0 r1 r2
+  add r14 -56 r1
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 r4 r5
+  load 0 r4
+  blts r2 r5 .L39
+  or r0 r4 r1
+  jump .L40
+.L39:
+  add r2 r3 r2
+  slt r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L40:
+  write -32 r14 r1
+  read -80 r14 r2
+  and r2 1 r4
+  load 0 r3
+  beq r4 r0 .L42
+  read -56 r14 r3
+  and r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L42:
+  bne r3 r0 .L76
+  load 0 r3
+  load 4 r4
+  bne r2 r4 .L45
+  read -56 r14 r3
+  xor r3 4 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L45:
+  bne r3 r0 .L71
+  load 0 r3
+  load 2 r4
+  beq r2 r4 .L48
+  or r0 r3 r4
+  jump .L49
+.L48:
+  read -56 r14 r3
+  xor r3 2 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L49:
+  load 1 r3
+  bne r4 r0 .L53
+  read -56 r14 r4
+  load 0 r3
+  bne r2 r4 .L52
+  add r14 -80 r3
+  add r3 4 r3
+  read 0 r3 r3
+  add r14 -56 r4
+  add r4 4 r4
+  read 0 r4 r4
+  xor r3 r4 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L52:
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L53:
+  bne r3 r0 .L63
+  load 0 r1
+  load 6 r3
+  bne r2 r3 .L56
+  read -56 r14 r1
+  xor r1 1 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L56:
+  bne r1 r0 .L62
+  read -56 r14 r3
+  load 0 r1
+  load 6 r4
+  bne r3 r4 .L59
+  xor r2 1 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L59:
+  bne r1 r0 .L61
+  load 0 r1
+  jump .L82
+.L61:
+  load 1 r1
+  jump .L82
+.L62:
+  load 1 r1
+  jump .L82
+.L63:
+  load 1 r3
+  load 2 r4
+  beq r2 r4 .L65
+  xor r2 6 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L66
+.L65:
+  or r0 r3 r2
+.L66:
+  bne r2 r0 .L68
+  load 67 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.12 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -32 r14 r1
+.L68:
+  bne r1 r0 .L70
+  load 0 r1
+  jump .L82
+.L70:
+  load 2 r1
+  jump .L82
+.L71:
+  add r14 -80 r1
+  add r1 12 r1
+  add r14 -56 r2
+  add r2 12 r2
+  add r14 -96 r5
+  add r2 0 r3
+  read 0 r3 r3
+  add r14 -96 r4
+  add r4 0 r4
+  write 0 r4 r3
+  add r2 4 r2
+  read 0 r2 r2
+  add r14 -96 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r14 -104 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -104 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -104 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump symeq
+  or r0 r1 r2
+  read -32 r14 r1
+  beq r2 r0 .L75
+  bne r1 r0 .L74
+  load 0 r1
+  jump .L82
+.L74:
+  load 2 r1
+  jump .L82
+.L75:
+  load 1 r1
+  jump .L82
+.L76:
+  add r14 -80 r2
+  add r2 4 r2
+  read 0 r2 r3
+  add r14 -56 r2
+  add r2 4 r2
+  read 0 r2 r4
+  load 0 r2
+  beq r3 r4 .L78
+  or r0 r2 r1
+  jump .L79
+.L78:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L79:
+  bne r1 r0 .L81
+  load 0 r1
+  jump .L82
+.L81:
+  load 2 r1
+.L82:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function alias */
+
+
+.text
+; function escapes
+.global escapes
+escapes:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r5
+  bne r1 r0 .L89
+  add r5 4 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 128 r1
+  read 0 r1 r2
+  and r2 1 r3
+  load 1 r2
+  beq r3 r0 .L88
+  add r1 20 r1
+  read 0 r1 r1
+  read 0 r1 r1
+  xor r1 3 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L90
+.L88:
+  or r0 r2 r1
+  jump .L90
+.L89:
+  load 1 r1
+.L90:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function escapes */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "rtype(r) <= RType\000"
+/* end data */
+
+
+.text
+; function esc
+esc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  load 3 r2
+  bles r1 r2 .L95
+  load 102 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.15 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+.L95:
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r5
+  bne r1 r0 .L98
+  add r5 4 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 128 r1
+  read 0 r1 r2
+  and r2 1 r2
+  beq r2 r0 .L98
+  add r1 20 r1
+  read 0 r1 r2
+  load 3 r1
+  write 0 r2 r1
+.L98:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function esc */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "astack(a->type)\000"
+/* end data */
+
+
+.text
+; function store
+store:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -8 r14 r6
+  write -12 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -8 r14 r6
+  read -12 r14 r5
+  bne r1 r0 .L114
+  add r6 4 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 128 r1
+  write -16 r14 r1
+  add r1 20 r2
+  read 0 r2 r2
+  beq r2 r0 .L114
+  read 0 r1 r2
+  and r2 1 r2
+  bne r2 r0 .L105
+  load 120 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.17 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+  read -12 r14 r5
+.L105:
+  add r1 8 r2
+  read 0 r2 r3
+  load 1 r2
+  load 32 r4
+  bges r5 r4 .L109
+  load 1 r2
+  blts r3 r0 .L108
+  slt r3 32 r2
+  xor r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L108:
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L109:
+  bne r2 r0 .L111
+  load 1 r2
+  shiftl r2 r5 r2
+  load 1 r4
+  sub r2 r4 r2
+  shiftl r2 r3 r3
+  jump .L113
+.L111:
+  load32 -1 r2
+  or r0 r2 r3
+.L113:
+  add r1 20 r1
+  read 0 r1 r1
+  add r1 12 r1
+  add r1 4 r2
+  read 0 r2 r1
+  or r1 r3 r1
+  write 0 r2 r1
+.L114:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function store */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "rtype(p->to) == RTmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "a->type == ABot\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "rtype(i->to) == RTmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "a\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "i->op == Oblit1\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "rtype(i->arg[0]) == RInt\000"
+/* end data */
+
+
+.text
+; function fillalias
+.global fillalias
+fillalias:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 108 r13
+  write -32 r14 r4
+  load 0 r1
+.L118:
+  add r4 16 r2
+  read 0 r2 r2
+  bges r1 r2 .L121
+  add r4 4 r2
+  read 0 r2 r2
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r2
+  add r2 128 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L118
+.L121:
+  load 0 r1
+.L122:
+  write -44 r14 r1
+  add r4 28 r2
+  read 0 r2 r2
+  bge r1 r2 .L189
+  or r0 r1 r2
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -48 r14 r1
+  read 0 r1 r1
+.L124:
+  write -36 r14 r1
+  beq r1 r0 .L135
+  load 0 r2
+.L126:
+  write -40 r14 r2
+  add r1 12 r3
+  read 0 r3 r3
+  bge r2 r3 .L129
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump esc
+  read -40 r14 r2
+  read -36 r14 r1
+  read -32 r14 r4
+  add r2 1 r2
+  jump .L126
+.L129:
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -36 r14 r1
+  read -32 r14 r4
+  beq r2 r0 .L131
+  load 151 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -36 r14 r1
+  read -32 r14 r4
+.L131:
+  add r4 4 r2
+  read 0 r2 r2
+  read 0 r1 r3
+  shiftr r3 3 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r2 r3 r2
+  add r2 128 r2
+  write -28 r14 r2
+  read 0 r2 r3
+  beq r3 r0 .L133
+  load 153 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -36 r14 r1
+  read -28 r14 r2
+  read -32 r14 r4
+.L133:
+  load 6 r3
+  write 0 r2 r3
+  read 0 r1 r3
+  shiftr r3 3 r3
+  add r2 4 r5
+  write 0 r5 r3
+  add r2 8 r5
+  load 0 r3
+  write 0 r5 r3
+  add r2 20 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L124
+.L135:
+  read -48 r14 r1
+  add r1 4 r2
+  read 0 r2 r2
+.L137:
+  write -12 r14 r2
+  or r0 r1 r3
+  add r1 4 r1
+  read 0 r1 r1
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r1 r3 r1
+  bge r2 r1 .L184
+  add r2 4 r1
+  load 0 r2
+  write -52 r14 r2
+  read -52 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -12 r14 r2
+  read -32 r14 r4
+  load 0 r1
+  beq r3 r0 .L140
+  or r0 r1 r3
+  jump .L156
+.L140:
+  add r2 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -12 r14 r2
+  read -32 r14 r4
+  beq r1 r0 .L142
+  load 162 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.21 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r2
+  read -32 r14 r4
+.L142:
+  add r4 4 r1
+  read 0 r1 r1
+  add r2 4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r1 r3 r1
+  add r1 128 r3
+  write -4 r14 r3
+  read 0 r3 r1
+  beq r1 r0 .L144
+  load 164 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r2
+  read -4 r14 r3
+  read -32 r14 r4
+.L144:
+  read 0 r2 r1
+  shiftl r1 2 r5
+  shiftr r5 2 r7
+  load 0 r5
+  load 83 r6
+  bles r6 r7 .L146
+  or r0 r5 r1
+  jump .L147
+.L146:
+  shiftl r1 2 r1
+  shiftr r1 2 r5
+  load 85 r1
+  slt r1 r5 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L147:
+  bne r1 r0 .L149
+  load 6 r1
+  write 0 r3 r1
+  add r3 20 r5
+  load 0 r1
+  write 0 r5 r1
+  jump .L155
+.L149:
+  load 1 r1
+  write 0 r3 r1
+  add r3 20 r1
+  write 0 r1 r3
+  add r3 12 r3
+  load32 -1 r1
+  write 0 r3 r1
+  add r2 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -12 r14 r2
+  read -4 r14 r3
+  read -32 r14 r4
+  load 1 r5
+  bne r1 r5 .L155
+  add r4 8 r1
+  read 0 r1 r1
+  add r2 8 r5
+  add r5 0 r5
+  read 0 r5 r5
+  shiftr r5 3 r5
+  shiftl r5 5 r5
+  add r1 r5 r5
+  add r5 16 r1
+  read 0 r1 r1
+  read 0 r5 r5
+  load 1 r6
+  bne r5 r6 .L155
+  load 0 r5
+  bgts r0 r1 .L153
+  load 32 r5
+  slt r5 r1 r5
+  xor r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L153:
+  beq r5 r0 .L155
+  add r3 12 r5
+  write 0 r5 r1
+.L155:
+  add r2 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  add r3 4 r5
+  write 0 r5 r1
+  add r3 8 r5
+  load 0 r1
+  write 0 r5 r1
+.L156:
+  write -8 r14 r3
+  read 0 r2 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 88 r5
+  bne r1 r5 .L160
+  bne r3 r0 .L159
+  load 184 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.22 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -8 r14 r3
+  read -12 r14 r2
+  read -32 r14 r4
+.L159:
+  add r2 8 r1
+  add r1 0 r1
+  or r0 r4 r6
+  read 0 r1 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump getalias
+  read -12 r14 r2
+  read -32 r14 r4
+.L160:
+  read 0 r2 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 1 r3
+  bne r1 r3 .L165
+  add r2 8 r1
+  add r1 0 r1
+  or r0 r4 r6
+  read 0 r1 r5
+  add r14 -100 r4
+  savpc r15
+  add r15 12 r15
+  jump getalias
+  read -12 r14 r2
+  read -32 r14 r4
+  add r2 8 r1
+  add r1 4 r1
+  or r0 r4 r6
+  read 0 r1 r5
+  add r14 -76 r4
+  savpc r15
+  add r15 12 r15
+  jump getalias
+  read -8 r14 r3
+  read -12 r14 r2
+  read -100 r14 r1
+  load 2 r4
+  beq r1 r4 .L164
+  read -76 r14 r4
+  load 2 r5
+  bne r4 r5 .L165
+  write 0 r3 r1
+  add r14 -100 r1
+  add r1 4 r4
+  add r3 4 r1
+  read 0 r4 r5
+  write 0 r1 r5
+  add r4 4 r4
+  add r1 4 r5
+  read 0 r4 r1
+  write 0 r5 r1
+  add r4 4 r4
+  add r5 4 r5
+  read 0 r4 r6
+  write 0 r5 r6
+  add r4 4 r4
+  add r5 4 r5
+  read 0 r4 r6
+  write 0 r5 r6
+  add r4 4 r4
+  add r5 4 r5
+  read 0 r4 r4
+  write 0 r5 r4
+  add r3 8 r3
+  add r14 -76 r4
+  add r4 8 r4
+  read 0 r4 r4
+  add r1 r4 r1
+  write 0 r3 r1
+  jump .L165
+.L164:
+  read -76 r14 r1
+  write 0 r3 r1
+  add r14 -76 r1
+  add r1 4 r4
+  add r3 4 r1
+  read 0 r4 r5
+  write 0 r1 r5
+  add r4 4 r4
+  add r1 4 r5
+  read 0 r4 r1
+  write 0 r5 r1
+  add r4 4 r4
+  add r5 4 r5
+  read 0 r4 r6
+  write 0 r5 r6
+  add r4 4 r4
+  add r5 4 r5
+  read 0 r4 r6
+  write 0 r5 r6
+  add r4 4 r4
+  add r5 4 r5
+  read 0 r4 r4
+  write 0 r5 r4
+  add r3 8 r3
+  add r14 -100 r4
+  add r4 8 r4
+  read 0 r4 r4
+  add r1 r4 r1
+  write 0 r3 r1
+.L165:
+  add r2 4 r1
+  load 0 r2
+  write -52 r14 r2
+  read -52 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r6
+  read -8 r14 r3
+  read -12 r14 r2
+  read -48 r14 r1
+  read -32 r14 r4
+  load 1 r5
+  bne r6 r0 .L167
+  read 0 r3 r3
+  xor r3 6 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  jump .L168
+.L167:
+  or r0 r5 r3
+.L168:
+  beq r3 r0 .L175
+  read 0 r2 r3
+  shiftl r3 2 r5
+  shiftr r5 2 r5
+  load 92 r6
+  beq r5 r6 .L175
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 59 r5
+  sub r3 r5 r5
+  load 6 r3
+  sltu r3 r5 r3
+  xor r3 1 r3
+  bne r3 r0 .L172
+  add r2 8 r1
+  add r1 0 r1
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump esc
+  read -12 r14 r2
+  read -48 r14 r1
+  read -32 r14 r4
+.L172:
+  read 0 r2 r3
+  shiftl r3 2 r5
+  shiftr r5 2 r5
+  load 53 r6
+  sub r5 r6 r6
+  load 5 r5
+  sltu r5 r6 r5
+  xor r5 1 r5
+  bne r5 r0 .L175
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 121 r5
+  beq r3 r5 .L175
+  add r2 8 r1
+  add r1 4 r1
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump esc
+  read -12 r14 r2
+  read -48 r14 r1
+  read -32 r14 r4
+.L175:
+  read 0 r2 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 92 r5
+  bne r3 r5 .L181
+  add r2 16 r2
+  write -16 r14 r2
+  read 0 r2 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 93 r3
+  beq r1 r3 .L178
+  load 209 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.23 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r2
+.L178:
+  add r2 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r2
+  load 2 r3
+  beq r1 r3 .L180
+  load 210 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.24 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r2
+.L180:
+  add r2 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump abs
+  or r0 r1 r5
+  read -16 r14 r2
+  read -32 r14 r4
+  load 16 r1
+  sub r2 r1 r1
+  add r1 8 r1
+  add r1 4 r1
+  or r0 r4 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump store
+  read -16 r14 r2
+  read -48 r14 r1
+  read -32 r14 r4
+.L181:
+  write -24 r14 r2
+  read 0 r2 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 53 r5
+  sub r3 r5 r3
+  load 5 r5
+  bgt r3 r5 .L183
+  add r2 8 r1
+  add r1 4 r1
+  write -20 r14 r1
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump storesz
+  or r0 r1 r5
+  read -20 r14 r1
+  read -32 r14 r4
+  or r0 r4 r6
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump store
+  read -24 r14 r2
+  read -48 r14 r1
+  read -32 r14 r4
+.L183:
+  add r2 16 r2
+  jump .L137
+.L184:
+  read -44 r14 r2
+  read -48 r14 r1
+  read -32 r14 r4
+  add r1 12 r3
+  readh 0 r3 r3
+  load 9 r5
+  bne r3 r5 .L187
+  or r0 r2 r1
+  jump .L188
+.L187:
+  add r1 12 r1
+  add r1 4 r1
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump esc
+  read -44 r14 r1
+  read -32 r14 r4
+.L188:
+  add r1 1 r1
+  jump .L122
+.L189:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function fillalias */
+
@@ -0,0 +1,4007 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/b32p3/../all.h\000"
+/* end data */
+
+
+.text
+; function memarg
+memarg:
+  load 59 r1
+  sub r5 r1 r2
+  load 1 r1
+  load 6 r3
+  ble r2 r3 .L19
+  xor r5 124 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L19:
+  bne r1 r0 .L23
+  load 53 r1
+  sub r5 r1 r1
+  load 5 r2
+  ble r1 r2 .L22
+  load 0 r1
+  jump .L24
+.L22:
+  add r6 12 r1
+  xor r4 r1 r1
+  sltu r1 1 r1
+  jump .L24
+.L23:
+  add r6 8 r1
+  xor r4 r1 r1
+  sltu r1 1 r1
+.L24:
+  jumpr 0 r15
+
+/* end function memarg */
+
+
+.text
+; function immarg
+immarg:
+  addr2reg b32p3_op r1
+  add r1 r5 r1
+  readb 0 r1 r2
+  load 0 r1
+  beq r2 r0 .L29
+  add r6 12 r1
+  xor r4 r1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L29:
+  jumpr 0 r15
+
+/* end function immarg */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "isel\000"
+/* end data */
+
+
+.text
+; function fixarg
+fixarg:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 116 r13
+  write -108 r14 r8
+  write -60 r14 r7
+  write -40 r14 r6
+  write -80 r14 r4
+  read 0 r4 r1
+  write -64 r14 r1
+  write -92 r14 r1
+  write -96 r14 r1
+  bne r6 r0 .L35
+  load 88 r1
+  write -44 r14 r1
+  jump .L37
+.L35:
+  read 0 r6 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  write -44 r14 r1
+.L37:
+  load 1 r1
+  beq r5 r1 .L39
+  write -72 r14 r5
+  jump .L41
+.L39:
+  load 0 r1
+  write -72 r14 r1
+.L41:
+  read -96 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -72 r14 r5
+  read -64 r14 r1
+  read -40 r14 r6
+  read -80 r14 r4
+  load 1 r3
+  xor r2 r3 r3
+  sltu r3 1 r3
+  write -16 r14 r3
+  read -44 r14 r7
+  read -60 r14 r3
+  read -16 r14 r12
+  bne r12 r0 .L57
+  load 1 r3
+  bge r2 r3 .L73
+  beq r2 r0 .L46
+  sltu r2 r0 r2
+  jump .L73
+.L46:
+  read -96 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r2
+  read -72 r14 r5
+  read -64 r14 r1
+  read -60 r14 r6
+  or r0 r6 r3
+  read -40 r14 r6
+  read -80 r14 r4
+  bne r2 r0 .L73
+  add r3 4 r2
+  read 0 r2 r2
+  write -20 r14 r2
+  shiftr r1 3 r3
+  load 160 r7
+  mults r3 r7 r3
+  add r2 r3 r2
+  add r2 104 r2
+  read 0 r2 r2
+  write -28 r14 r2
+  load32 -1 r3
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  write -24 r14 r2
+  read -20 r14 r2
+  read -44 r14 r7
+  read -60 r14 r3
+  read -24 r14 r12
+  bne r12 r0 .L53
+  or r0 r3 r6
+  load 0 r3
+  beq r5 r0 .L51
+  or r0 r3 r2
+  jump .L52
+.L51:
+  shiftr r1 3 r3
+  load 160 r5
+  mults r3 r5 r3
+  add r2 r3 r2
+  add r2 108 r2
+  readh 0 r2 r2
+  xor r2 1 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L52:
+  jump .L73
+.L53:
+  or r0 r7 r5
+  or r0 r5 r2
+  savpc r15
+  add r15 12 r15
+  jump memarg
+  or r0 r1 r2
+  read -72 r14 r5
+  read -28 r14 r1
+  read -60 r14 r6
+  read -80 r14 r4
+  bne r2 r0 .L56
+  or r0 r6 r3
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  or r0 r1 r2
+  read -72 r14 r5
+  read -28 r14 r1
+  write -100 r14 r2
+  read -100 r14 r2
+  write -32 r14 r2
+  write -92 r14 r2
+  load32 536870911 r2
+  and r1 r2 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 4 r1
+  write -88 r14 r1
+  load 0 r1
+  write -84 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -84 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -88 r14 r7
+  read -92 r14 r6
+  load 91 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -32 r14 r1
+  read -80 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  jump .L73
+.L56:
+  load32 536870911 r2
+  and r1 r2 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 4 r1
+  write -92 r14 r1
+  jump .L73
+.L57:
+  or r0 r7 r2
+  add r3 8 r3
+  read 0 r3 r3
+  shiftr r1 3 r7
+  shiftl r7 5 r7
+  add r3 r7 r3
+  write -56 r14 r3
+  read 0 r3 r3
+  load 0 r7
+  write -36 r14 r7
+  load 2 r7
+  xor r3 r7 r8
+  sltu r8 1 r8
+  read -56 r14 r3
+  read -36 r14 r7
+  bne r8 r0 .L60
+  or r0 r7 r2
+  jump .L62
+.L60:
+  or r0 r2 r5
+  or r0 r5 r7
+  savpc r15
+  add r15 12 r15
+  jump memarg
+  or r0 r1 r2
+  read -72 r14 r5
+  read -56 r14 r3
+  read -64 r14 r1
+  read -40 r14 r6
+  read -80 r14 r4
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L62:
+  bne r2 r0 .L73
+  read 0 r3 r2
+  load 0 r3
+  write -52 r14 r3
+  load 1 r3
+  xor r2 r3 r2
+  sltu r2 1 r2
+  write -48 r14 r2
+  read -56 r14 r3
+  read -44 r14 r7
+  read -60 r14 r2
+  read -48 r14 r12
+  bne r12 r0 .L65
+  or r0 r2 r6
+  read -52 r14 r2
+  jump .L67
+.L65:
+  or r0 r7 r5
+  savpc r15
+  add r15 12 r15
+  jump immarg
+  or r0 r1 r2
+  read -72 r14 r5
+  read -56 r14 r3
+  read -64 r14 r1
+  read -60 r14 r6
+  read -80 r14 r4
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L67:
+  beq r2 r0 .L72
+  add r3 16 r2
+  read 0 r2 r2
+  load 0 r7
+  write -68 r14 r7
+  load32 -32768 r7
+  slt r2 r7 r8
+  xor r8 1 r8
+  read -68 r14 r7
+  bne r8 r0 .L70
+  or r0 r7 r2
+  jump .L71
+.L70:
+  load32 32768 r3
+  slt r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L71:
+  bne r2 r0 .L73
+.L72:
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -72 r14 r5
+  write -104 r14 r1
+  read -104 r14 r1
+  write -76 r14 r1
+  write -92 r14 r1
+  load 0 r1
+  write -88 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -88 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -96 r14 r7
+  read -92 r14 r6
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -76 r14 r1
+  read -80 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+.L73:
+  write 0 r4 r1
+  read -108 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function fixarg */
+
+
+.text
+; function negate
+negate:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  write -16 r14 r4
+  write -8 r14 r5
+  or r0 r5 r6
+  load 0 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -8 r14 r5
+  write -24 r14 r1
+  read -24 r14 r1
+  write -12 r14 r1
+  write -20 r14 r1
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  read -16 r14 r4
+  write -28 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -28 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -20 r14 r7
+  read 0 r4 r6
+  load 0 r5
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -12 r14 r1
+  read -16 r14 r4
+  load32 -12 r2
+  sub r13 r2 r13
+  write 0 r4 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function negate */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "BuildTools/QBE/b32p3/isel.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "b32p3: unsupported comparison %d\000"
+/* end data */
+
+
+.text
+; function selcmp
+selcmp:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 72 r13
+  or r0 r4 r1
+  write -28 r14 r7
+  write -8 r14 r6
+  write -20 r14 r1
+  load 1 r2
+  bne r5 r2 .L84
+  load 0 r2
+  or r0 r2 r5
+.L84:
+  write -32 r14 r5
+  load 10 r2
+  blt r6 r2 .L87
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.14 r5
+  addr2reg .Lstring.13 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -28 r14 r7
+  read -8 r14 r6
+  read -20 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  load32 -559030611 r3
+  load32 -559030611 r2
+  jump .L98
+.L87:
+  shiftl r6 2 r3
+  addr2reg .Ljt87 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L88:
+  or r0 r7 r6
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  or r0 r1 r2
+  read -20 r14 r1
+  write -64 r14 r2
+  read -64 r14 r2
+  write -40 r14 r2
+  read 0 r1 r2
+  shiftr r2 30 r5
+  add r1 4 r1
+  load 0 r2
+  write -36 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -36 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -40 r14 r7
+  read 0 r1 r6
+  load 104 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -32 r14 r5
+  read -20 r14 r1
+  load32 -12 r2
+  sub r13 r2 r13
+  or r0 r1 r2
+  add r1 8 r1
+  add r1 0 r1
+  add r2 8 r2
+  add r2 4 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  read 0 r2 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -40 r14 r6
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -32 r14 r5
+  read -28 r14 r7
+  load32 -12 r1
+  sub r13 r1 r13
+  addr2reg curi r12
+  read 0 r12 r6
+  write -12 r14 r6
+  add r6 8 r1
+  add r1 0 r4
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+  read -32 r14 r5
+  read -12 r14 r6
+  read -28 r14 r7
+  add r6 8 r1
+  add r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+  jump .L106
+.L89:
+  or r0 r7 r6
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  or r0 r1 r2
+  read -20 r14 r1
+  write -60 r14 r2
+  read -60 r14 r2
+  write -40 r14 r2
+  read 0 r1 r2
+  shiftr r2 30 r5
+  add r1 4 r1
+  load 0 r2
+  write -36 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -36 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -40 r14 r7
+  read 0 r1 r6
+  load 105 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -32 r14 r5
+  read -20 r14 r1
+  load32 -12 r2
+  sub r13 r2 r13
+  or r0 r1 r2
+  add r1 8 r1
+  add r1 0 r1
+  add r2 8 r2
+  add r2 4 r2
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  read 0 r2 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -40 r14 r6
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -32 r14 r5
+  read -28 r14 r7
+  load32 -12 r1
+  sub r13 r1 r13
+  addr2reg curi r12
+  read 0 r12 r6
+  write -16 r14 r6
+  add r6 8 r1
+  add r1 0 r4
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+  read -32 r14 r5
+  read -16 r14 r6
+  read -28 r14 r7
+  add r6 8 r1
+  add r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+  jump .L106
+.L90:
+  load 0 r3
+  load 1 r2
+  jump .L98
+.L91:
+  load 1 r3
+  load 0 r2
+  jump .L98
+.L92:
+  load 1 r3
+  load 1 r2
+  jump .L98
+.L93:
+  load 0 r3
+  load 0 r2
+  jump .L98
+.L94:
+  load 0 r3
+  load 1 r2
+  jump .L98
+.L95:
+  load 1 r3
+  load 0 r2
+  jump .L98
+.L96:
+  load 1 r3
+  load 1 r2
+  jump .L98
+.L97:
+  load 0 r3
+  load 0 r2
+.L98:
+  load 6 r4
+  bges r6 r4 .L100
+  load 32 r4
+  jump .L101
+.L100:
+  load 36 r4
+.L101:
+  load32 1073741823 r5
+  and r4 r5 r4
+  read 0 r1 r5
+  load32 -1073741824 r6
+  and r5 r6 r5
+  or r4 r5 r4
+  write 0 r1 r4
+  beq r3 r0 .L103
+  add r1 8 r3
+  add r3 0 r3
+  read 0 r3 r3
+  add r1 8 r4
+  add r4 4 r4
+  add r1 8 r5
+  add r5 0 r5
+  read 0 r4 r4
+  write 0 r5 r4
+  add r1 8 r4
+  add r4 4 r4
+  write 0 r4 r3
+.L103:
+  beq r2 r0 .L105
+  add r1 4 r4
+  or r0 r7 r5
+  savpc r15
+  add r15 12 r15
+  jump negate
+  read -20 r14 r1
+.L105:
+  add r14 -56 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -56 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -56 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r2
+  read 0 r2 r2
+  add r14 -56 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r1
+  add r14 -56 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump emiti
+  read -32 r14 r5
+  read -28 r14 r7
+  addr2reg curi r12
+  read 0 r12 r6
+  write -24 r14 r6
+  add r6 8 r1
+  add r1 0 r4
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+  read -32 r14 r5
+  read -24 r14 r6
+  read -28 r14 r7
+  add r6 8 r1
+  add r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+.L106:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt87:
+  .int .L88
+  .int .L89
+  .int .L90
+  .int .L91
+  .int .L92
+  .int .L93
+  .int .L94
+  .int .L95
+  .int .L96
+  .int .L97
+
+/* end function selcmp */
+
+
+.text
+; function log2u
+log2u:
+  load 1 r1
+  beq r4 r0 .L111
+  load 1 r1
+  sub r4 r1 r1
+  and r4 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L111:
+  bne r1 r0 .L116
+  load 0 r1
+.L113:
+  load 1 r2
+  ble r4 r2 .L117
+  shiftr r4 1 r4
+  add r1 1 r1
+  jump .L113
+.L116:
+  load32 -1 r1
+.L117:
+  jumpr 0 r15
+
+/* end function log2u */
+
+
+.text
+; function magics
+magics:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 44 r13
+  write -36 r14 r8
+  write -28 r14 r6
+  write -32 r14 r5
+  load32 -2147483648 r1
+  modu r1 r4 r2
+  load32 2147483647 r1
+  sub r1 r2 r6
+  write -16 r14 r6
+  load32 -2147483648 r1
+  divu r1 r6 r1
+  mults r1 r6 r3
+  load32 -2147483648 r2
+  sub r2 r3 r2
+  load32 -2147483648 r3
+  divu r3 r4 r5
+  mults r5 r4 r7
+  load32 -2147483648 r3
+  sub r3 r7 r3
+  load 31 r7
+  write -4 r14 r1
+.L122:
+  add r7 1 r7
+  write -24 r14 r7
+  read -4 r14 r1
+  shiftl r1 1 r1
+  shiftl r2 1 r2
+  blt r2 r6 .L124
+  add r1 1 r1
+  sub r2 r6 r2
+.L124:
+  shiftl r5 1 r5
+  shiftl r3 1 r3
+  blt r3 r4 .L126
+  add r5 1 r5
+  sub r3 r4 r3
+.L126:
+  sub r4 r3 r7
+  load 1 r6
+  write -12 r14 r6
+  sltu r1 r7 r6
+  write -8 r14 r6
+  read -16 r14 r6
+  read -8 r14 r12
+  bne r12 r0 .L131
+  load 0 r6
+  write -20 r14 r6
+  read -16 r14 r6
+  xor r1 r7 r8
+  sltu r8 1 r8
+  read -20 r14 r7
+  beq r8 r0 .L130
+  xor r2 0 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L130:
+  xor r7 0 r7
+  sltu r0 r7 r8
+  jump .L132
+.L131:
+  read -12 r14 r8
+.L132:
+  read -24 r14 r7
+  beq r8 r0 .L134
+  write -4 r14 r1
+  jump .L122
+.L134:
+  or r0 r5 r1
+  read -28 r14 r6
+  read -32 r14 r5
+  add r1 1 r1
+  write 0 r5 r1
+  load 32 r1
+  sub r7 r1 r1
+  write 0 r6 r1
+  read -36 r14 r8
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function magics */
+
+
+.text
+; function magicu
+magicu:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 40 r13
+  write -28 r14 r7
+  write -32 r14 r5
+  write -16 r14 r6
+  load 0 r1
+  write 0 r6 r1
+  load32 2147483647 r1
+  divu r1 r4 r2
+  mults r2 r4 r3
+  load32 2147483647 r1
+  sub r1 r3 r3
+  load 0 r5
+  load 31 r1
+  or r0 r5 r12
+  or r0 r2 r5
+  or r0 r12 r2
+.L141:
+  add r1 1 r1
+  load 32 r6
+  beq r1 r6 .L143
+  shiftl r2 1 r2
+  jump .L144
+.L143:
+  load 1 r2
+.L144:
+  add r3 1 r6
+  sub r4 r3 r7
+  sltu r6 r7 r7
+  xor r7 1 r7
+  read -16 r14 r6
+  bne r7 r0 .L148
+  load32 -2147483648 r7
+  blt r5 r7 .L147
+  load 1 r7
+  write 0 r6 r7
+.L147:
+  shiftl r5 1 r5
+  shiftl r3 1 r3
+  add r3 1 r3
+  jump .L151
+.L148:
+  load32 2147483647 r7
+  blt r5 r7 .L150
+  load 1 r7
+  write 0 r6 r7
+.L150:
+  shiftl r5 1 r5
+  add r5 1 r5
+  shiftl r3 1 r3
+  add r3 1 r3
+  sub r3 r4 r3
+.L151:
+  load 1 r6
+  sub r4 r6 r6
+  sub r6 r3 r7
+  write -12 r14 r7
+  load 0 r6
+  write -24 r14 r6
+  load 64 r6
+  slt r1 r6 r6
+  write -20 r14 r6
+  read -12 r14 r7
+  read -16 r14 r6
+  read -20 r14 r12
+  bne r12 r0 .L154
+  read -24 r14 r7
+  jump .L155
+.L154:
+  sltu r2 r7 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L155:
+  bne r7 r0 .L141
+  or r0 r5 r2
+  read -28 r14 r7
+  read -32 r14 r5
+  add r2 1 r2
+  write 0 r5 r2
+  load 32 r2
+  sub r1 r2 r1
+  write 0 r7 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function magicu */
+
+
+.text
+; function emitsel
+emitsel:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  read 12 r14 r1
+  write -8 r14 r1
+  or r0 r7 r1
+  add r14 -24 r2
+  write 0 r2 r1
+  or r0 r6 r1
+  add r14 -28 r2
+  write 0 r2 r1
+  write -12 r14 r5
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read 8 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -24 r14 r7
+  read -28 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -8 r14 r7
+  read -12 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  addr2reg curi r12
+  read 0 r12 r6
+  write -16 r14 r6
+  add r6 8 r1
+  add r1 0 r4
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+  load 0 r1
+  write -20 r14 r1
+  read -20 r14 r5
+  read 8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -16 r14 r6
+  read -8 r14 r7
+  read -12 r14 r5
+  bne r1 r0 .L163
+  add r6 8 r1
+  add r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+.L163:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emitsel */
+
+
+.text
+; function tmp
+tmp:
+  or r0 r4 r6
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 12 r13
+  load 0 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  write -4 r14 r1
+  read -4 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function tmp */
+
+
+.text
+; function con
+con:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 12 r13
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -4 r14 r1
+  read -4 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function con */
+
+
+.text
+; function selmulc
+selmulc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 80 r13
+  read 8 r14 r1
+  write -32 r14 r1
+  or r0 r7 r2
+  or r0 r6 r1
+  write -16 r14 r2
+  add r14 -44 r3
+  write 0 r3 r1
+  or r0 r5 r1
+  add r14 -48 r3
+  write 0 r3 r1
+  write -28 r14 r4
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump log2u
+  or r0 r1 r4
+  read -32 r14 r1
+  read -16 r14 r2
+  read -28 r14 r5
+  bges r4 r0 .L193
+  load 0 r3
+  load32 -2147483648 r6
+  beq r2 r6 .L177
+  sub r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump log2u
+  or r0 r1 r4
+  read -32 r14 r1
+  read -16 r14 r2
+  read -28 r14 r5
+  slt r4 r0 r3
+  xor r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L177:
+  write -24 r14 r4
+  bne r3 r0 .L188
+  load 1 r1
+  sub r2 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump log2u
+  or r0 r1 r4
+  read -32 r14 r1
+  read -16 r14 r2
+  load 1 r3
+  bgts r4 r0 .L181
+  add r2 1 r4
+  savpc r15
+  add r15 12 r15
+  jump log2u
+  or r0 r1 r4
+  read -32 r14 r1
+  read -16 r14 r2
+  load 1 r3
+  slt r3 r4 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+  write -20 r14 r4
+  jump .L182
+.L181:
+  write -20 r14 r4
+.L182:
+  bne r3 r0 .L184
+  or r0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -32 r14 r1
+  read -28 r14 r5
+  write -52 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -52 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -48 r14 r6
+  load 8 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L196
+.L184:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r3
+  read -20 r14 r4
+  read -32 r14 r1
+  read -16 r14 r2
+  read -28 r14 r5
+  write -60 r14 r3
+  read -60 r14 r3
+  write -40 r14 r3
+  load 1 r3
+  sub r2 r3 r2
+  load 1 r3
+  shiftl r3 r4 r3
+  beq r2 r3 .L186
+  load 2 r2
+  jump .L187
+.L186:
+  load 1 r2
+.L187:
+  or r0 r2 r4
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -44 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -40 r14 r7
+  read -48 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -20 r14 r4
+  read -32 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -32 r14 r1
+  write -56 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -56 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -40 r14 r6
+  load 0 r5
+  load 16 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L196
+.L188:
+  bne r4 r0 .L190
+  add r14 -44 r2
+  jump .L191
+.L190:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -32 r14 r1
+  read -28 r14 r5
+  write -68 r14 r2
+  add r14 -68 r2
+.L191:
+  read 0 r2 r2
+  write -40 r14 r2
+  load 0 r2
+  write -36 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -36 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -40 r14 r7
+  read -48 r14 r6
+  load 3 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -24 r14 r4
+  read -32 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  beq r4 r0 .L196
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -32 r14 r1
+  write -64 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -64 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -40 r14 r6
+  load 0 r5
+  load 16 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L196
+.L193:
+  beq r4 r0 .L195
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -32 r14 r1
+  read -28 r14 r5
+  write -72 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -72 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -48 r14 r6
+  load 16 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L196
+.L195:
+  load 0 r2
+  write -40 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -40 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -48 r14 r6
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+.L196:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function selmulc */
+
+
+.text
+; function seldivs
+seldivs:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 108 r13
+  read 8 r14 r1
+  write -16 r14 r1
+  write -4 r14 r7
+  or r0 r6 r2
+  add r14 -44 r3
+  write 0 r3 r2
+  or r0 r5 r2
+  add r14 -48 r3
+  write 0 r3 r2
+  write -8 r14 r4
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  read -4 r14 r4
+  write -100 r14 r1
+  read -100 r14 r1
+  write -28 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump log2u
+  or r0 r1 r3
+  read -16 r14 r1
+  read -4 r14 r4
+  write -12 r14 r3
+  bgts r3 r0 .L211
+  add r14 -20 r6
+  add r14 -24 r5
+  savpc r15
+  add r15 12 r15
+  jump magics
+  read -16 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  write -72 r14 r2
+  read -72 r14 r2
+  write -40 r14 r2
+  read -24 r14 r2
+  blts r2 r0 .L202
+  add r14 -40 r2
+  jump .L203
+.L202:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  write -68 r14 r2
+  add r14 -68 r2
+.L203:
+  read 0 r2 r2
+  write -36 r14 r2
+  read -20 r14 r2
+  bne r2 r0 .L205
+  add r14 -36 r2
+  jump .L206
+.L205:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  write -64 r14 r2
+  add r14 -64 r2
+.L206:
+  read 0 r2 r2
+  write -32 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -28 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -32 r14 r7
+  read -48 r14 r6
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  or r0 r1 r5
+  load 31 r4
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -60 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -60 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -28 r14 r6
+  load 0 r5
+  load 15 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  read -20 r14 r4
+  beq r4 r0 .L208
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -56 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -56 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -36 r14 r7
+  read -32 r14 r6
+  load 0 r5
+  load 14 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+.L208:
+  read -40 r14 r5
+  read -36 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -16 r14 r1
+  bne r2 r0 .L210
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -44 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -40 r14 r7
+  read -36 r14 r6
+  load 0 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+.L210:
+  read -24 r14 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -52 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -52 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -40 r14 r6
+  load 0 r5
+  load 106 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L214
+.L211:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -12 r14 r3
+  read -16 r14 r1
+  write -92 r14 r2
+  read -92 r14 r2
+  write -36 r14 r2
+  or r0 r1 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  write -96 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -96 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -36 r14 r7
+  read -48 r14 r6
+  load 14 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -28 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -36 r14 r6
+  load 0 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -12 r14 r3
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  load 1 r2
+  beq r3 r2 .L213
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -12 r14 r3
+  read -16 r14 r1
+  write -76 r14 r2
+  read -76 r14 r2
+  write -40 r14 r2
+  load 32 r2
+  sub r2 r3 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -80 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -80 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -40 r14 r7
+  read -28 r14 r6
+  load 0 r5
+  load 15 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  or r0 r1 r5
+  load 31 r4
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -84 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -84 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -40 r14 r6
+  load 0 r5
+  load 14 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L214
+.L213:
+  or r0 r1 r5
+  load 31 r4
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -88 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -88 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -28 r14 r6
+  load 0 r5
+  load 15 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+.L214:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function seldivs */
+
+
+.text
+; function seldivu
+seldivu:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 112 r13
+  read 8 r14 r1
+  write -16 r14 r1
+  or r0 r7 r1
+  or r0 r6 r2
+  write -8 r14 r1
+  add r14 -48 r3
+  write 0 r3 r2
+  or r0 r5 r2
+  add r14 -52 r3
+  write 0 r3 r2
+  write -12 r14 r4
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump log2u
+  or r0 r1 r4
+  read -16 r14 r1
+  or r0 r4 r2
+  read -8 r14 r4
+  bgts r2 r0 .L236
+  load32 -2147483648 r2
+  bge r4 r2 .L235
+  add r14 -20 r7
+  add r14 -24 r6
+  add r14 -28 r5
+  savpc r15
+  add r15 12 r15
+  jump magicu
+  read -16 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  write -88 r14 r2
+  read -88 r14 r2
+  write -44 r14 r2
+  read -24 r14 r2
+  beq r2 r0 .L227
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  write -68 r14 r2
+  read -68 r14 r2
+  write -40 r14 r2
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  write -72 r14 r2
+  read -72 r14 r2
+  write -36 r14 r2
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  write -76 r14 r2
+  read -76 r14 r2
+  write -32 r14 r2
+  read -20 r14 r2
+  load 1 r3
+  bles r2 r3 .L222
+  load 1 r3
+  sub r2 r3 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  read -12 r14 r5
+  write -64 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -64 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -32 r14 r7
+  read -52 r14 r6
+  load 15 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+.L222:
+  read -20 r14 r2
+  load 1 r3
+  bgts r2 r3 .L225
+  add r14 -52 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L226
+.L225:
+  or r0 r1 r2
+  add r14 -32 r1
+.L226:
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r4
+  write 0 r4 r2
+  read -44 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -36 r14 r7
+  read 0 r1 r6
+  load 0 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  or r0 r1 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -56 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -56 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -40 r14 r7
+  read -36 r14 r6
+  load 0 r5
+  load 15 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -44 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -48 r14 r7
+  read -40 r14 r6
+  load 0 r5
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  read -28 r14 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -60 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -60 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -48 r14 r7
+  read -44 r14 r6
+  load 0 r5
+  load 107 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L238
+.L227:
+  read -20 r14 r4
+  beq r4 r0 .L229
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  read -12 r14 r5
+  write -84 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -84 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -52 r14 r6
+  load 15 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+.L229:
+  read -20 r14 r2
+  bne r2 r0 .L232
+  add r14 -52 r2
+  write -4 r14 r2
+  or r0 r1 r2
+  jump .L234
+.L232:
+  or r0 r1 r2
+  add r14 -44 r1
+  write -4 r14 r1
+.L234:
+  read -28 r14 r4
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r3
+  read -4 r14 r1
+  read -16 r14 r2
+  write -80 r14 r3
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r4
+  write 0 r4 r2
+  read -80 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -48 r14 r7
+  read 0 r1 r6
+  load 0 r5
+  load 107 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L238
+.L235:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  write -92 r14 r2
+  read -92 r14 r2
+  write -44 r14 r2
+  or r0 r1 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  read -12 r14 r5
+  write -96 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -96 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -44 r14 r7
+  read -52 r14 r6
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  read -8 r14 r4
+  load32 -16 r2
+  sub r13 r2 r13
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -100 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -100 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -48 r14 r7
+  read -44 r14 r6
+  load 0 r5
+  load 36 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L238
+.L236:
+  or r0 r2 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  read -12 r14 r5
+  write -104 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -104 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -48 r14 r7
+  read -52 r14 r6
+  load 15 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+.L238:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function seldivu */
+
+
+.text
+; function selrems2
+selrems2:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 80 r13
+  read 8 r14 r1
+  write -16 r14 r1
+  write -12 r14 r7
+  or r0 r6 r2
+  add r14 -36 r3
+  write 0 r3 r2
+  or r0 r5 r2
+  add r14 -40 r3
+  write 0 r3 r2
+  write -8 r14 r4
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  write -56 r14 r2
+  read -56 r14 r2
+  write -32 r14 r2
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  write -60 r14 r2
+  read -60 r14 r2
+  write -28 r14 r2
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  write -64 r14 r2
+  read -64 r14 r2
+  write -24 r14 r2
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  or r0 r1 r2
+  read -16 r14 r1
+  read -8 r14 r5
+  write -68 r14 r2
+  read -68 r14 r2
+  write -20 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -20 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -36 r14 r7
+  read -40 r14 r6
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  read -12 r14 r3
+  load32 -16 r2
+  sub r13 r2 r13
+  load 1 r2
+  shiftl r2 r3 r2
+  sub r0 r2 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -72 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -72 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -24 r14 r7
+  read -20 r14 r6
+  load 0 r5
+  load 11 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -28 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -36 r14 r7
+  read -24 r14 r6
+  load 0 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  read -12 r14 r3
+  load32 -16 r2
+  sub r13 r2 r13
+  load 1 r2
+  beq r3 r2 .L243
+  load 32 r2
+  sub r2 r3 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -44 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -44 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -32 r14 r7
+  read -28 r14 r6
+  load 0 r5
+  load 15 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -16 r14 r1
+  load32 -16 r2
+  sub r13 r2 r13
+  or r0 r1 r5
+  load 31 r4
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -48 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -48 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -36 r14 r7
+  read -32 r14 r6
+  load 0 r5
+  load 14 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  jump .L244
+.L243:
+  or r0 r1 r5
+  load 31 r4
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r2
+  read -16 r14 r1
+  write -52 r14 r2
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -52 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -36 r14 r7
+  read -28 r14 r6
+  load 0 r5
+  load 15 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+.L244:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function selrems2 */
+
+
+.text
+; function selconst
+selconst:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 108 r13
+  write -48 r14 r5
+  write -28 r14 r4
+  read 0 r4 r1
+  shiftr r1 30 r2
+  shiftrs r2 1 r2
+  bne r2 r0 .L311
+  shiftr r1 30 r5
+  write -44 r14 r5
+  add r4 8 r1
+  add r1 0 r1
+  read 0 r1 r1
+  write -64 r14 r1
+  add r4 8 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -44 r14 r5
+  read -48 r14 r2
+  read -28 r14 r4
+  load 1 r3
+  beq r1 r3 .L253
+  read 0 r4 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r3
+  load 1 r1
+  load 8 r6
+  bne r3 r6 .L251
+  read -64 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -44 r14 r5
+  read -48 r14 r2
+  read -28 r14 r4
+  xor r1 1 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L251:
+  bne r1 r0 .L310
+  add r4 8 r1
+  add r1 4 r1
+  read 0 r1 r1
+  write -64 r14 r1
+  add r4 8 r1
+  add r1 0 r1
+  add r4 8 r3
+  add r3 4 r3
+  read 0 r1 r1
+  write 0 r3 r1
+.L253:
+  add r2 8 r1
+  read 0 r1 r1
+  add r4 8 r3
+  add r3 4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  shiftl r3 5 r3
+  add r1 r3 r1
+  write -16 r14 r1
+  read 0 r1 r6
+  load 1 r3
+  load 1 r7
+  bne r6 r7 .L255
+  read -64 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -16 r14 r1
+  read -44 r14 r5
+  read -48 r14 r2
+  read -28 r14 r4
+  xor r3 1 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L255:
+  bne r3 r0 .L309
+  add r1 16 r1
+  read 0 r1 r3
+  write -32 r14 r3
+  load 1 r1
+  load 1 r6
+  beq r3 r6 .L263
+  load 0 r1
+  load32 -1 r6
+  bne r3 r6 .L262
+  read 0 r4 r1
+  shiftl r1 2 r6
+  shiftr r6 2 r6
+  load 1 r7
+  write -20 r14 r7
+  load 4 r7
+  xor r6 r7 r7
+  sltu r7 1 r7
+  read -20 r14 r6
+  bne r7 r0 .L260
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  xor r1 5 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L261
+.L260:
+  or r0 r6 r1
+.L261:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L262:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L263:
+  beq r1 r0 .L266
+  read 0 r4 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 4 r6
+  sub r1 r6 r1
+  load 4 r6
+  blt r1 r6 .L299
+.L266:
+  read 0 r4 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 4 r6
+  sub r1 r6 r1
+  load 5 r6
+  bge r1 r6 .L297
+  shiftl r1 2 r6
+  addr2reg .Ljt268 r1
+  add r1 r6 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L269:
+  beq r3 r0 .L297
+  load32 -2147483648 r1
+  beq r3 r1 .L274
+  bgts r3 r0 .L273
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  read -44 r14 r5
+  read -48 r14 r2
+  read -28 r14 r4
+  write -88 r14 r1
+  read -88 r14 r1
+  write -60 r14 r1
+  add r4 4 r1
+  load 0 r3
+  write -52 r14 r3
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r4
+  write 0 r4 r2
+  read -52 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -60 r14 r7
+  read 0 r1 r6
+  load 3 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -32 r14 r3
+  read -48 r14 r2
+  load32 -16 r1
+  sub r13 r1 r13
+  sub r0 r3 r7
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r2
+  read -64 r14 r6
+  read -60 r14 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump seldivs
+  load32 -12 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L273:
+  or r0 r2 r1
+  add r4 4 r2
+  load 12 r4
+  sub r13 r4 r13
+  or r0 r13 r4
+  add r4 8 r4
+  write 0 r4 r1
+  or r0 r3 r7
+  read -64 r14 r6
+  or r0 r5 r1
+  read 0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump seldivs
+  load32 -12 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L274:
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  read -44 r14 r5
+  read -48 r14 r2
+  read -28 r14 r4
+  write -92 r14 r1
+  read -92 r14 r1
+  write -60 r14 r1
+  add r4 4 r1
+  load 0 r3
+  write -52 r14 r3
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r4
+  write 0 r4 r2
+  read -52 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -60 r14 r7
+  read 0 r1 r6
+  load 104 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -32 r14 r3
+  read -48 r14 r2
+  load32 -16 r1
+  sub r13 r1 r13
+  or r0 r2 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump con
+  read -48 r14 r2
+  write -96 r14 r1
+  or r0 r2 r1
+  load 16 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 12 r3
+  write 0 r3 r1
+  read -96 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -64 r14 r7
+  read -60 r14 r6
+  load 0 r5
+  load 13 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L275:
+  beq r3 r0 .L297
+  load 1 r6
+  load32 -559030611 r1
+  load32 -2147483648 r7
+  beq r3 r7 .L280
+  bges r3 r0 .L279
+  sub r0 r3 r3
+.L279:
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump log2u
+  or r0 r1 r7
+  read -32 r14 r3
+  read -44 r14 r5
+  read -48 r14 r2
+  read -28 r14 r4
+  load 0 r1
+  slt r1 r7 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L281
+.L280:
+  or r0 r1 r7
+  or r0 r6 r1
+.L281:
+  bne r1 r0 .L287
+  blts r3 r0 .L284
+  write -24 r14 r3
+  jump .L286
+.L284:
+  sub r0 r3 r3
+  write -24 r14 r3
+.L286:
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  read -48 r14 r2
+  write -80 r14 r1
+  read -80 r14 r1
+  write -60 r14 r1
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  read -44 r14 r5
+  read -48 r14 r2
+  read -28 r14 r4
+  write -84 r14 r1
+  read -84 r14 r1
+  write -56 r14 r1
+  add r4 4 r1
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r4
+  write 0 r4 r2
+  read -56 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -64 r14 r7
+  read 0 r1 r6
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -24 r14 r3
+  read -48 r14 r2
+  load32 -16 r1
+  sub r13 r1 r13
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r2
+  or r0 r3 r7
+  read -60 r14 r6
+  read -56 r14 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump selmulc
+  read -24 r14 r3
+  read -48 r14 r2
+  load32 -12 r1
+  sub r13 r1 r13
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r2
+  or r0 r3 r7
+  read -64 r14 r6
+  read -60 r14 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump seldivs
+  load32 -12 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L287:
+  or r0 r2 r1
+  add r4 4 r2
+  load32 -2147483648 r4
+  bne r3 r4 .L290
+  load 31 r3
+  or r0 r3 r7
+.L290:
+  load 12 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 8 r3
+  write 0 r3 r1
+  read -64 r14 r6
+  or r0 r5 r1
+  read 0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump selrems2
+  load32 -12 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L291:
+  beq r3 r0 .L297
+  or r0 r2 r1
+  add r4 4 r2
+  load 12 r4
+  sub r13 r4 r13
+  or r0 r13 r4
+  add r4 8 r4
+  write 0 r4 r1
+  or r0 r3 r7
+  read -64 r14 r6
+  or r0 r5 r1
+  read 0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump seldivu
+  load32 -12 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L293:
+  beq r3 r0 .L297
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump log2u
+  read -32 r14 r3
+  read -48 r14 r2
+  read -28 r14 r4
+  bgts r1 r0 .L296
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  read -48 r14 r2
+  write -68 r14 r1
+  read -68 r14 r1
+  write -60 r14 r1
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump tmp
+  read -44 r14 r5
+  read -48 r14 r2
+  read -28 r14 r4
+  write -72 r14 r1
+  read -72 r14 r1
+  write -56 r14 r1
+  add r4 4 r1
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r4
+  write 0 r4 r2
+  read -56 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -64 r14 r7
+  read 0 r1 r6
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  read -32 r14 r3
+  read -48 r14 r2
+  load32 -16 r1
+  sub r13 r1 r13
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r2
+  or r0 r3 r7
+  read -60 r14 r6
+  read -56 r14 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump selmulc
+  read -32 r14 r3
+  read -48 r14 r2
+  load32 -12 r1
+  sub r13 r1 r13
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r2
+  or r0 r3 r7
+  read -64 r14 r6
+  read -60 r14 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump seldivu
+  load32 -12 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L296:
+  add r4 4 r1
+  write -36 r14 r1
+  load 1 r1
+  sub r3 r1 r4
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r3
+  read -36 r14 r1
+  read -44 r14 r5
+  read -48 r14 r2
+  write -76 r14 r3
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r4
+  write 0 r4 r2
+  read -76 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -64 r14 r7
+  read 0 r1 r6
+  load 11 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L297:
+  load 0 r1
+  jump .L312
+.L298:
+  or r0 r2 r1
+  add r4 4 r2
+  load 12 r4
+  sub r13 r4 r13
+  or r0 r13 r4
+  add r4 8 r4
+  write 0 r4 r1
+  or r0 r3 r7
+  read -64 r14 r6
+  or r0 r5 r1
+  read 0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump selmulc
+  load32 -12 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L299:
+  shiftl r1 2 r6
+  or r0 r4 r1
+  addr2reg .Ljt299 r4
+  add r4 r6 r4
+  read 0 r4 r4
+  jumpr 0 r4
+.L300:
+  blts r3 r0 .L302
+  load 88 r3
+  jump .L303
+.L302:
+  load 3 r3
+.L303:
+  or r0 r3 r4
+  add r1 4 r1
+  load 0 r3
+  write -60 r14 r3
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r6
+  write 0 r6 r2
+  read -60 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -64 r14 r7
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L304:
+  or r0 r1 r4
+  jump .L308
+.L305:
+  or r0 r1 r4
+  add r4 4 r1
+  load 0 r3
+  write -60 r14 r3
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r4
+  write 0 r4 r2
+  read -60 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -64 r14 r7
+  read 0 r1 r6
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L307:
+  or r0 r1 r4
+.L308:
+  add r4 4 r1
+  write -40 r14 r1
+  or r0 r2 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump con
+  or r0 r1 r3
+  read -40 r14 r1
+  read -44 r14 r5
+  read -48 r14 r2
+  write -100 r14 r3
+  load 0 r3
+  write -60 r14 r3
+  load 16 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 12 r4
+  write 0 r4 r2
+  read -60 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read -100 r14 r7
+  read 0 r1 r6
+  load 88 r4
+  savpc r15
+  add r15 12 r15
+  jump emitsel
+  load32 -16 r1
+  sub r13 r1 r13
+  load 1 r1
+  jump .L312
+.L309:
+  load 0 r1
+  jump .L312
+.L310:
+  load 0 r1
+  jump .L312
+.L311:
+  load 0 r1
+.L312:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt268:
+  .int .L269
+  .int .L275
+  .int .L291
+  .int .L293
+  .int .L298
+
+.rdata
+.balign 4
+.Ljt299:
+  .int .L300
+  .int .L304
+  .int .L305
+  .int .L307
+
+/* end function selconst */
+
+
+.text
+; function sel
+sel:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 96 r13
+  or r0 r5 r7
+  write -32 r14 r7
+  write -16 r14 r4
+  read 0 r4 r1
+  shiftl r1 2 r2
+  shiftr r2 2 r2
+  load 83 r3
+  sub r2 r3 r2
+  load 2 r3
+  ble r2 r3 .L321
+  shiftl r1 2 r1
+  shiftr r1 2 r4
+  add r14 -36 r6
+  add r14 -40 r5
+  savpc r15
+  add r15 12 r15
+  jump iscmp
+  read -32 r14 r7
+  read -16 r14 r4
+  bne r1 r0 .L320
+  or r0 r7 r5
+  or r0 r4 r1
+  add r14 -72 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -72 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -72 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r2
+  read 0 r2 r2
+  add r14 -72 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r1
+  add r14 -72 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump selconst
+  read -16 r14 r4
+  bne r1 r0 .L322
+  read 0 r4 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 90 r2
+  beq r1 r2 .L322
+  or r0 r4 r1
+  add r14 -56 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -56 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -56 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r2
+  read 0 r2 r2
+  add r14 -56 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r1
+  add r14 -56 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump emiti
+  read -16 r14 r4
+  addr2reg curi r12
+  read 0 r12 r6
+  write -24 r14 r6
+  add r6 8 r1
+  add r1 0 r1
+  write -12 r14 r1
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump argcls
+  or r0 r1 r5
+  read -12 r14 r4
+  read -24 r14 r6
+  read -32 r14 r7
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+  read -24 r14 r6
+  read -16 r14 r4
+  add r6 8 r1
+  add r1 4 r1
+  write -20 r14 r1
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump argcls
+  or r0 r1 r5
+  read -20 r14 r4
+  read -24 r14 r6
+  read -32 r14 r7
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+  jump .L322
+.L320:
+  read -40 r14 r5
+  read -36 r14 r6
+  or r0 r4 r1
+  add r14 -88 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -88 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -88 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r2
+  read 0 r2 r2
+  add r14 -88 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r1
+  add r14 -88 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump selcmp
+  jump .L322
+.L321:
+  addr2reg curi r12
+  read 0 r12 r1
+  load 16 r2
+  sub r1 r2 r6
+  write -28 r14 r6
+  add r4 4 r1
+  add r4 8 r2
+  add r2 0 r2
+  or r0 r7 r6
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump salloc
+  read -28 r14 r6
+  read -32 r14 r7
+  add r6 8 r1
+  add r1 0 r4
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+.L322:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function sel */
+
+
+.text
+; function selbrarg
+selbrarg:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r6
+  write -8 r14 r5
+  write -16 r14 r4
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -12 r14 r7
+  read -16 r14 r4
+  load 0 r1
+  load 1 r3
+  beq r2 r3 .L327
+  or r0 r1 r2
+  jump .L328
+.L327:
+  add r7 8 r1
+  read 0 r1 r1
+  read 0 r4 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  xor r1 1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L328:
+  load 0 r1
+  beq r2 r0 .L330
+  add r7 8 r1
+  read 0 r1 r1
+  read 0 r4 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  add r1 16 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L330:
+  bne r1 r0 .L335
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -12 r14 r7
+  read -8 r14 r6
+  read -16 r14 r4
+  load 1 r2
+  bne r1 r2 .L334
+  load 0 r1
+  or r0 r1 r6
+.L334:
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+.L335:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function selbrarg */
+
+
+.text
+; function seljtab
+seljtab:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 64 r13
+  or r0 r5 r7
+  write -16 r14 r4
+  write -8 r14 r7
+  or r0 r7 r6
+  load 0 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -8 r14 r7
+  write -40 r14 r1
+  read -40 r14 r1
+  write -36 r14 r1
+  or r0 r7 r6
+  load 0 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -8 r14 r7
+  write -44 r14 r1
+  read -44 r14 r1
+  write -32 r14 r1
+  or r0 r7 r6
+  load 0 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -8 r14 r7
+  write -48 r14 r1
+  read -48 r14 r1
+  write -28 r14 r1
+  or r0 r7 r6
+  load 0 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  write -52 r14 r1
+  read -52 r14 r1
+  write -12 r14 r1
+  write -24 r14 r1
+  load 0 r1
+  write -20 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -20 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -28 r14 r7
+  read -24 r14 r6
+  load 0 r5
+  load 65 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  load32 -12 r1
+  sub r13 r1 r13
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -32 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -36 r14 r7
+  read -28 r14 r6
+  load 0 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  load32 -12 r1
+  sub r13 r1 r13
+  load 0 r1
+  write -28 r14 r1
+  load 0 r1
+  write -24 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -24 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -28 r14 r7
+  read -36 r14 r6
+  load 0 r5
+  load 108 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -8 r14 r7
+  read -16 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  add r4 12 r1
+  add r1 4 r1
+  write -4 r14 r1
+  or r0 r7 r5
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  or r0 r1 r2
+  read -4 r14 r1
+  write -56 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r3
+  read -56 r14 r2
+  add r3 8 r3
+  write 0 r3 r2
+  read 0 r1 r7
+  read -32 r14 r6
+  load 0 r5
+  load 16 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -8 r14 r7
+  load32 -12 r1
+  sub r13 r1 r13
+  addr2reg curi r12
+  read 0 r12 r6
+  add r6 8 r1
+  add r1 0 r4
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+  read -12 r14 r1
+  read -16 r14 r4
+  add r4 12 r2
+  add r2 4 r2
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function seljtab */
+
+
+.text
+; function seljmp
+seljmp:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 68 r13
+  write -28 r14 r5
+  write -20 r14 r4
+  add r4 12 r1
+  readh 0 r1 r1
+  load 32 r2
+  beq r1 r2 .L361
+  load 12 r2
+  bne r1 r2 .L362
+  add r4 12 r1
+  add r1 4 r1
+  read 0 r1 r2
+  write -12 r14 r2
+  write -44 r14 r2
+  read -44 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -12 r14 r2
+  read -28 r14 r5
+  read -20 r14 r4
+  load 0 r1
+  beq r3 r0 .L346
+  or r0 r1 r2
+  jump .L347
+.L346:
+  add r5 4 r1
+  read 0 r1 r1
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 92 r1
+  read 0 r1 r1
+  xor r1 1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L347:
+  load 0 r1
+  beq r2 r0 .L353
+  add r4 4 r1
+  read 0 r1 r1
+  add r4 8 r2
+  read 0 r2 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+.L349:
+  add r4 4 r2
+  read 0 r2 r3
+  load 0 r2
+  beq r1 r3 .L352
+  load 16 r2
+  sub r1 r2 r1
+  write -16 r14 r1
+  add r1 4 r1
+  read -44 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -16 r14 r1
+  read -20 r14 r4
+  beq r2 r0 .L349
+  read -28 r14 r5
+  jump .L353
+.L352:
+  read -28 r14 r5
+  read -20 r14 r4
+  or r0 r2 r1
+.L353:
+  write -32 r14 r1
+  load 0 r2
+  bne r1 r0 .L355
+  or r0 r2 r3
+  jump .L356
+.L355:
+  read 0 r1 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r4
+  add r14 -40 r6
+  add r14 -36 r5
+  savpc r15
+  add r15 12 r15
+  jump iscmp
+  or r0 r1 r2
+  read -32 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L356:
+  load 0 r2
+  beq r3 r0 .L358
+  read -36 r14 r2
+  shiftrs r2 1 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L358:
+  bne r2 r0 .L360
+  add r4 12 r1
+  add r1 4 r4
+  or r0 r5 r7
+  load 0 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+  jump .L362
+.L360:
+  add r14 -60 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -60 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r2
+  add r14 -60 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 8 r2
+  read 0 r2 r2
+  add r14 -60 r3
+  add r3 8 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r1
+  add r14 -60 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump emiti
+  read -28 r14 r5
+  or r0 r5 r1
+  addr2reg curi r12
+  read 0 r12 r5
+  write -24 r14 r5
+  add r5 8 r2
+  add r2 0 r4
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump selbrarg
+  read -24 r14 r5
+  read -28 r14 r1
+  add r5 8 r2
+  add r2 4 r4
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump selbrarg
+  read -32 r14 r1
+  load 90 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  jump .L362
+.L361:
+  savpc r15
+  add r15 12 r15
+  jump seljtab
+.L362:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function seljmp */
+
+.data
+.balign 1
+.Lstring.31:
+	.ascii "invalid alloc size %lld\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "alloc too large\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.33:
+	.ascii "n+1 < p->narg\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "\012> After instruction selection:\012\000"
+/* end data */
+
+
+.text
+; function b32p3_isel
+.global b32p3_isel
+b32p3_isel:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 88 r13
+  write -52 r14 r4
+  read 0 r4 r3
+  write -36 r14 r3
+  load 4 r2
+  load 83 r1
+  or r0 r1 r5
+  or r0 r4 r1
+.L367:
+  write -40 r14 r2
+  write -64 r14 r5
+  load 85 r4
+  bgts r5 r4 .L382
+  add r3 4 r4
+  read 0 r4 r4
+.L369:
+  write -48 r14 r4
+  add r3 4 r6
+  read 0 r6 r6
+  add r3 8 r7
+  read 0 r7 r7
+  shiftl r7 4 r7
+  add r6 r7 r6
+  bge r4 r6 .L381
+  read 0 r4 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  bne r6 r5 .L379
+  add r4 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r5
+  read -48 r14 r4
+  read -40 r14 r2
+  read -36 r14 r3
+  read -52 r14 r1
+  load 1 r6
+  bne r5 r6 .L380
+  add r1 8 r5
+  read 0 r5 r5
+  add r4 8 r6
+  add r6 0 r6
+  read 0 r6 r6
+  shiftr r6 3 r6
+  shiftl r6 5 r6
+  add r5 r6 r5
+  add r5 16 r5
+  read 0 r5 r5
+  write -32 r14 r5
+  load 1 r6
+  blts r5 r0 .L374
+  load32 2147483632 r6
+  slt r5 r6 r6
+  xor r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L374:
+  beq r6 r0 .L376
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.31 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -48 r14 r4
+  read -40 r14 r2
+  read -32 r14 r5
+  read -36 r14 r3
+  read -52 r14 r1
+  load32 -24 r6
+  sub r13 r6 r13
+.L376:
+  add r5 r2 r5
+  load 1 r6
+  sub r5 r6 r5
+  sub r0 r2 r6
+  and r5 r6 r5
+  shiftrs r5 31 r6
+  shiftr r6 30 r6
+  add r5 r6 r5
+  shiftrs r5 2 r6
+  write -44 r14 r6
+  add r1 48 r5
+  read 0 r5 r7
+  load32 2147483647 r5
+  sub r5 r7 r5
+  bles r6 r5 .L378
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.32 r5
+  addr2reg .Lstring.13 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -48 r14 r4
+  read -40 r14 r2
+  read -44 r14 r6
+  read -36 r14 r3
+  read -52 r14 r1
+  load32 -24 r5
+  sub r13 r5 r13
+.L378:
+  add r1 48 r5
+  read 0 r5 r5
+  write -60 r14 r5
+  add r1 4 r5
+  read 0 r5 r5
+  write -56 r14 r5
+  add r4 4 r5
+  read 0 r5 r5
+  shiftr r5 3 r5
+  load 160 r7
+  mults r5 r7 r7
+  read -56 r14 r5
+  add r5 r7 r7
+  read -60 r14 r5
+  add r7 104 r7
+  write 0 r7 r5
+  add r1 48 r7
+  read 0 r7 r5
+  add r5 r6 r6
+  read -64 r14 r5
+  write 0 r7 r6
+  load 90 r6
+  write 0 r4 r6
+  add r4 4 r6
+  load 0 r7
+  write 0 r6 r7
+  add r6 4 r6
+  load 0 r7
+  write 0 r6 r7
+  add r6 4 r7
+  load 0 r6
+  write 0 r7 r6
+.L379:
+  add r4 16 r4
+  jump .L369
+.L380:
+  read -64 r14 r5
+.L381:
+  add r5 1 r5
+  shiftl r2 1 r2
+  jump .L367
+.L382:
+  or r0 r1 r4
+  read 0 r4 r3
+  or r0 r4 r1
+.L385:
+  write -16 r14 r3
+  beq r3 r0 .L408
+  addr2reg insb r12
+  read 0 r12 r2
+  load32 4194304 r4
+  add r2 r4 r2
+  addr2reg curi r12
+  write 0 r12 r2
+  or r0 r1 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump seljmp
+  read -16 r14 r3
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump succlist
+  or r0 r1 r2
+  read -16 r14 r3
+.L387:
+  write -28 r14 r2
+  read 0 r2 r1
+  beq r1 r0 .L401
+  read 0 r1 r1
+.L389:
+  write -20 r14 r1
+  beq r1 r0 .L399
+  or r0 r1 r2
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L392:
+  write -24 r14 r2
+  add r1 8 r4
+  read 0 r4 r4
+  shiftl r2 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  beq r4 r3 .L396
+  add r2 1 r4
+  add r1 12 r5
+  read 0 r5 r5
+  blt r4 r5 .L395
+  load 616 r6
+  addr2reg .Lstring.13 r5
+  addr2reg .Lstring.33 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -24 r14 r2
+  read -20 r14 r1
+  read -16 r14 r3
+.L395:
+  add r2 1 r2
+  jump .L392
+.L396:
+  or r0 r2 r4
+  or r0 r1 r2
+  read -52 r14 r1
+  add r2 4 r3
+  read 0 r3 r3
+  shiftl r4 2 r4
+  add r3 r4 r4
+  add r2 16 r2
+  read 0 r2 r5
+  or r0 r1 r7
+  load 0 r6
+  savpc r15
+  add r15 12 r15
+  jump fixarg
+  read -20 r14 r1
+  read -16 r14 r3
+  read -52 r14 r4
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L389
+.L399:
+  read -28 r14 r2
+  read -52 r14 r1
+  add r2 4 r2
+  jump .L387
+.L401:
+  read -52 r14 r1
+  add r3 4 r2
+  read 0 r2 r2
+  add r3 8 r4
+  read 0 r4 r4
+  shiftl r4 4 r4
+  add r2 r4 r2
+.L403:
+  add r3 4 r3
+  read 0 r3 r3
+  beq r2 r3 .L405
+  load 16 r3
+  sub r2 r3 r2
+  write -12 r14 r2
+  or r0 r1 r5
+  add r14 -80 r4
+  add r2 0 r1
+  read 0 r1 r1
+  add r14 -80 r3
+  add r3 0 r3
+  write 0 r3 r1
+  add r2 4 r1
+  read 0 r1 r1
+  add r14 -80 r3
+  add r3 4 r3
+  write 0 r3 r1
+  add r2 8 r1
+  read 0 r1 r1
+  add r14 -80 r3
+  add r3 8 r3
+  write 0 r3 r1
+  add r2 12 r1
+  read 0 r1 r1
+  add r14 -80 r2
+  add r2 12 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump sel
+  read -16 r14 r3
+  read -12 r14 r2
+  read -52 r14 r1
+  jump .L403
+.L405:
+  read -16 r14 r3
+  addr2reg insb r12
+  read 0 r12 r1
+  load32 4194304 r2
+  add r1 r2 r1
+  addr2reg curi r12
+  read 0 r12 r2
+  sub r1 r2 r1
+  shiftrs r1 31 r2
+  shiftr r2 28 r2
+  add r1 r2 r1
+  shiftrs r1 4 r6
+  add r3 8 r1
+  write 0 r1 r6
+  add r3 4 r4
+  addr2reg curi r12
+  read 0 r12 r5
+  savpc r15
+  add r15 12 r15
+  jump idup
+  read -16 r14 r3
+  read -52 r14 r1
+  add r3 44 r2
+  read 0 r2 r3
+  jump .L385
+.L408:
+  addr2reg debug+73 r12
+  readb 0 r12 r1
+  beq r1 r0 .L410
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.34 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -52 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+.L410:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function b32p3_isel */
+
@@ -0,0 +1,1754 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/b32p3/../all.h\000"
+/* end data */
+
+
+.text
+; function regbit
+regbit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump isreg
+  or r0 r1 r2
+  load 1 r1
+  beq r2 r0 .L19
+  read -4 r14 r1
+  shiftr r1 3 r1
+  xor r1 12 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L19:
+  bne r1 r0 .L21
+  read -4 r14 r1
+  shiftr r1 3 r2
+  load 1 r1
+  shiftl r1 r2 r1
+  jump .L22
+.L21:
+  load 0 r1
+.L22:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function regbit */
+
+
+.text
+; function barrier
+barrier:
+  read 0 r4 r1
+  shiftl r1 2 r2
+  shiftr r2 2 r3
+  load 1 r2
+  load 124 r4
+  beq r3 r4 .L27
+  shiftl r1 2 r2
+  shiftr r2 2 r2
+  xor r2 96 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L28
+.L27:
+  or r0 r2 r3
+.L28:
+  load 1 r2
+  bne r3 r0 .L30
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  xor r1 89 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L31
+.L30:
+  or r0 r2 r1
+.L31:
+  jumpr 0 r15
+
+/* end function barrier */
+
+
+.text
+; function mknode
+mknode:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  read 0 r5 r1
+  write 0 r4 r1
+  add r5 4 r1
+  add r4 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  add r5 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump regbit
+  write -8 r14 r1
+  read -12 r14 r5
+  add r5 8 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump regbit
+  or r0 r1 r2
+  read -8 r14 r1
+  read -12 r14 r5
+  read -16 r14 r4
+  or r1 r2 r1
+  add r4 16 r2
+  write 0 r2 r1
+  add r5 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump regbit
+  read -12 r14 r5
+  read -16 r14 r4
+  add r4 20 r2
+  write 0 r2 r1
+  add r4 24 r3
+  load 0 r2
+  write 0 r3 r2
+  add r4 28 r3
+  load 0 r2
+  write 0 r3 r2
+  read 0 r5 r2
+  shiftl r2 2 r3
+  shiftr r3 2 r3
+  load 59 r6
+  sub r3 r6 r3
+  load 6 r6
+  ble r3 r6 .L44
+  shiftl r2 2 r3
+  shiftr r3 2 r3
+  load 53 r6
+  sub r3 r6 r3
+  load 5 r6
+  ble r3 r6 .L43
+  shiftl r2 2 r3
+  shiftr r3 2 r3
+  load 88 r6
+  beq r3 r6 .L39
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 94 r3
+  bne r2 r3 .L45
+  add r4 20 r2
+  add r4 16 r3
+  read 0 r3 r3
+  or r1 r3 r1
+  write 0 r2 r1
+  jump .L45
+.L39:
+  add r5 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -12 r14 r5
+  read -16 r14 r4
+  load 4 r2
+  bne r1 r2 .L41
+  add r5 8 r1
+  add r1 0 r1
+  add r4 24 r2
+  read 0 r1 r1
+  write 0 r2 r1
+.L41:
+  add r5 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -12 r14 r5
+  read -16 r14 r4
+  load 4 r2
+  bne r1 r2 .L45
+  add r5 4 r1
+  add r4 28 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  jump .L45
+.L43:
+  add r5 8 r1
+  add r1 4 r1
+  add r4 28 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  jump .L45
+.L44:
+  add r5 8 r1
+  add r1 0 r1
+  add r4 24 r2
+  read 0 r1 r1
+  write 0 r2 r1
+.L45:
+  add r4 32 r2
+  load 0 r1
+  write 0 r2 r1
+  add r4 36 r2
+  load 0 r1
+  write 0 r2 r1
+  add r4 40 r2
+  load 0 r1
+  write 0 r2 r1
+  add r4 44 r2
+  load 0 r1
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mknode */
+
+
+.text
+; function ismem
+ismem:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r4
+  add r4 24 r1
+  load 0 r2
+  write -20 r14 r2
+  read -20 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -16 r14 r4
+  load 1 r1
+  beq r2 r0 .L51
+  add r4 28 r1
+  load 0 r2
+  write -20 r14 r2
+  read -20 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L51:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ismem */
+
+
+.text
+; function isld
+isld:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r4
+  add r4 24 r1
+  load 0 r2
+  write -20 r14 r2
+  read -20 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -16 r14 r4
+  load 0 r1
+  bne r2 r0 .L56
+  add r4 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L56:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function isld */
+
+
+.text
+; function overlap
+overlap:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 36 r13
+  write -16 r14 r6
+  add r14 -24 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -28 r2
+  write 0 r2 r1
+  load 0 r1
+  write -20 r14 r1
+  read -20 r14 r5
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  load 1 r1
+  bne r2 r0 .L61
+  load 0 r1
+  write -20 r14 r1
+  read -20 r14 r5
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L61:
+  bne r1 r0 .L88
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  load 0 r1
+  load 4 r3
+  bne r2 r3 .L64
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  xor r1 4 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L64:
+  bne r1 r0 .L87
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -16 r14 r6
+  load 0 r1
+  load 1 r3
+  bne r2 r3 .L67
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r6
+  xor r1 1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L67:
+  bne r1 r0 .L78
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  load 0 r1
+  load 4 r3
+  beq r2 r3 .L70
+  or r0 r1 r2
+  jump .L71
+.L70:
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  xor r1 1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L71:
+  load 1 r1
+  bne r2 r0 .L75
+  read -28 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  load 0 r1
+  load 1 r3
+  bne r2 r3 .L74
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  xor r1 4 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L74:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L75:
+  bne r1 r0 .L77
+  load 1 r1
+  jump .L89
+.L77:
+  load 0 r1
+  jump .L89
+.L78:
+  add r6 8 r1
+  read 0 r1 r1
+  read -28 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r3
+  read -24 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r4
+  read 0 r3 r2
+  load 1 r1
+  load 2 r5
+  bne r2 r5 .L80
+  read 0 r4 r1
+  xor r1 2 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L80:
+  bne r1 r0 .L86
+  add r3 4 r1
+  add r1 4 r1
+  read 0 r1 r1
+  add r4 4 r2
+  add r2 4 r2
+  read 0 r2 r2
+  bne r1 r2 .L85
+  add r3 16 r1
+  read 0 r1 r2
+  add r4 16 r1
+  read 0 r1 r1
+  sub r2 r1 r6
+  load 0 r5
+  load 4 r7
+  blts r6 r7 .L84
+  or r0 r5 r1
+  jump .L89
+.L84:
+  sub r1 r2 r1
+  slt r1 4 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L89
+.L85:
+  load 0 r1
+  jump .L89
+.L86:
+  load 1 r1
+  jump .L89
+.L87:
+  read -28 r14 r1
+  shiftr r1 3 r1
+  read -24 r14 r2
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  jump .L89
+.L88:
+  load 0 r1
+.L89:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function overlap */
+
+
+.text
+; function after
+after:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r6
+  write -16 r14 r5
+  write -12 r14 r4
+  add r4 20 r1
+  read 0 r1 r1
+  add r5 16 r2
+  read 0 r2 r3
+  add r5 20 r2
+  read 0 r2 r2
+  or r3 r2 r3
+  and r1 r3 r3
+  load 1 r1
+  bne r3 r0 .L94
+  add r4 16 r1
+  read 0 r1 r1
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L94:
+  bne r1 r0 .L104
+  add r4 28 r1
+  add r5 24 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump overlap
+  or r0 r1 r2
+  read -8 r14 r6
+  read -16 r14 r5
+  read -12 r14 r4
+  load 1 r1
+  bne r2 r0 .L97
+  add r4 28 r1
+  add r5 28 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump overlap
+  read -8 r14 r6
+  read -16 r14 r5
+  read -12 r14 r4
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L98
+.L97:
+  or r0 r1 r2
+.L98:
+  load 1 r1
+  bne r2 r0 .L100
+  add r4 24 r1
+  add r5 28 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump overlap
+  read -12 r14 r4
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L100:
+  bne r1 r0 .L103
+  add r4 24 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -16 r14 r5
+  load 0 r1
+  bne r2 r0 .L105
+  add r5 24 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L105
+.L103:
+  load 1 r1
+  jump .L105
+.L104:
+  load 1 r1
+.L105:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function after */
+
+
+.text
+; function lat
+lat:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump isld
+  or r0 r1 r2
+  read -12 r14 r5
+  read -16 r14 r4
+  load 0 r1
+  beq r2 r0 .L110
+  add r4 20 r1
+  read 0 r1 r1
+  and r1 r5 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L110:
+  bne r1 r0 .L112
+  load 1 r1
+  jump .L113
+.L112:
+  load 2 r1
+.L113:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function lat */
+
+
+.text
+; function sameline
+sameline:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  write -8 r14 r5
+  write -4 r14 r4
+  add r4 24 r1
+  load 0 r2
+  write -24 r14 r2
+  read -24 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -8 r14 r5
+  read -4 r14 r4
+  bne r1 r0 .L118
+  add r4 24 r1
+  jump .L119
+.L118:
+  add r4 28 r1
+.L119:
+  read 0 r1 r1
+  write -24 r14 r1
+  add r5 24 r1
+  load 0 r2
+  write -20 r14 r2
+  read -20 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -8 r14 r5
+  bne r1 r0 .L121
+  add r5 24 r1
+  jump .L122
+.L121:
+  add r5 28 r1
+.L122:
+  read 0 r1 r1
+  write -20 r14 r1
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  load 0 r1
+  load 4 r3
+  bne r2 r3 .L124
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  xor r1 4 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L124:
+  bne r1 r0 .L126
+  read -20 r14 r5
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  jump .L128
+.L126:
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  write -12 r14 r1
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  or r0 r1 r2
+  read -12 r14 r1
+  sub r1 r2 r2
+  load 0 r1
+  load 8 r3
+  bges r2 r3 .L128
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  write -16 r14 r1
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rsval
+  or r0 r1 r2
+  read -16 r14 r1
+  sub r1 r2 r1
+  slt r1 8 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L128:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function sameline */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "best >= 0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "BuildTools/QBE/b32p3/sched.c\000"
+/* end data */
+
+
+.text
+; function schedule
+schedule:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 156 r13
+  write -148 r14 r8
+  read 8 r14 r1
+  write -140 r14 r1
+  write -136 r14 r7
+  write -144 r14 r6
+  or r0 r5 r2
+  or r0 r4 r1
+  write -132 r14 r2
+  write -124 r14 r1
+  load 0 r3
+.L132:
+  write -128 r14 r3
+  or r0 r1 r5
+  bges r3 r2 .L136
+  or r0 r5 r1
+  load 48 r2
+  mults r3 r2 r4
+  addr2reg nd r2
+  add r2 r4 r4
+  shiftl r3 4 r2
+  add r1 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump mknode
+  read -128 r14 r3
+  read -132 r14 r2
+  read -124 r14 r1
+  add r3 1 r3
+  jump .L132
+.L136:
+  read -140 r14 r5
+  read -144 r14 r4
+  read -132 r14 r2
+  load 0 r1
+.L138:
+  write -120 r14 r1
+  bges r1 r2 .L149
+  load 0 r3
+.L140:
+  write -116 r14 r3
+  bges r3 r1 .L148
+  or r0 r4 r6
+  load 0 r4
+  bne r6 r0 .L143
+  or r0 r4 r6
+  jump .L144
+.L143:
+  load 1 r4
+  sub r2 r4 r4
+  xor r1 r4 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r6
+.L144:
+  load 1 r4
+  bne r6 r0 .L146
+  load 48 r2
+  mults r3 r2 r3
+  addr2reg nd r2
+  add r2 r3 r4
+  load 48 r2
+  mults r1 r2 r3
+  addr2reg nd r2
+  or r0 r5 r1
+  add r2 r3 r5
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump after
+  or r0 r1 r4
+  read -116 r14 r3
+  read -120 r14 r1
+  read -132 r14 r2
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L146:
+  shiftl r3 6 r6
+  addr2reg dep r5
+  add r5 r6 r5
+  add r5 r1 r5
+  writeb 0 r5 r4
+  load 48 r4
+  mults r1 r4 r5
+  addr2reg nd r4
+  add r4 r5 r4
+  add r4 32 r7
+  read 0 r7 r5
+  shiftl r3 6 r6
+  addr2reg dep r4
+  add r4 r6 r6
+  read -144 r14 r4
+  add r6 r1 r6
+  readb 0 r6 r6
+  add r5 r6 r6
+  read -140 r14 r5
+  write 0 r7 r6
+  add r3 1 r3
+  jump .L140
+.L148:
+  add r1 1 r1
+  jump .L138
+.L149:
+  read -136 r14 r3
+.L150:
+  or r0 r2 r1
+  load 1 r2
+  sub r1 r2 r2
+  write -104 r14 r2
+  bles r1 r0 .L159
+  or r0 r3 r1
+  load 48 r3
+  mults r2 r3 r3
+  addr2reg nd r2
+  add r2 r3 r3
+  write -108 r14 r3
+  or r0 r1 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump lat
+  or r0 r1 r4
+  read -108 r14 r3
+  read -104 r14 r2
+  or r0 r2 r1
+  read -132 r14 r2
+  add r3 36 r5
+  write 0 r5 r4
+  add r1 1 r4
+.L152:
+  write -112 r14 r4
+  bges r4 r2 .L157
+  shiftl r1 6 r6
+  addr2reg dep r5
+  add r5 r6 r5
+  add r5 r4 r5
+  readb 0 r5 r5
+  beq r5 r0 .L156
+  load 48 r1
+  mults r4 r1 r2
+  addr2reg nd r1
+  add r1 r2 r1
+  add r1 16 r1
+  read 0 r1 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump lat
+  or r0 r1 r5
+  read -112 r14 r4
+  read -108 r14 r3
+  read -104 r14 r2
+  or r0 r2 r1
+  read -132 r14 r2
+  load 48 r6
+  mults r4 r6 r7
+  addr2reg nd r6
+  add r6 r7 r6
+  add r6 36 r6
+  read 0 r6 r6
+  add r5 r6 r5
+  add r3 36 r6
+  read 0 r6 r6
+  bles r5 r6 .L156
+  add r3 36 r6
+  write 0 r6 r5
+.L156:
+  add r4 1 r4
+  jump .L152
+.L157:
+  read -136 r14 r3
+  or r0 r1 r2
+  jump .L150
+.L159:
+  read -132 r14 r2
+  load 0 r4
+  load 0 r3
+  load 0 r1
+  write -92 r14 r4
+  or r0 r3 r5
+  write -96 r14 r1
+.L162:
+  write -100 r14 r5
+  bges r5 r2 .L212
+  load 0 r4
+  load32 -1 r3
+  load 0 r1
+  or r0 r4 r6
+  or r0 r3 r4
+  or r0 r1 r3
+.L165:
+  write -52 r14 r6
+  write -60 r14 r4
+  write -56 r14 r3
+  bges r6 r2 .L199
+  load 48 r1
+  mults r6 r1 r5
+  addr2reg nd r1
+  add r1 r5 r1
+  write -64 r14 r1
+  add r1 44 r5
+  read 0 r5 r7
+  write -16 r14 r7
+  read -92 r14 r8
+  load 1 r5
+  write -20 r14 r5
+  read -16 r14 r7
+  read -20 r14 r5
+  bne r7 r0 .L168
+  add r1 32 r5
+  read 0 r5 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L168:
+  read -96 r14 r7
+  bne r5 r0 .L197
+  add r1 40 r2
+  read 0 r2 r5
+  slt r7 r5 r2
+  write -24 r14 r2
+  read -132 r14 r2
+  read -24 r14 r12
+  bne r12 r0 .L171
+  or r0 r7 r5
+.L171:
+  write -48 r14 r5
+  load 0 r7
+  write -28 r14 r7
+  read -92 r14 r8
+  bne r8 r0 .L173
+  read -28 r14 r12
+  write -32 r14 r12
+  jump .L175
+.L173:
+  or r0 r8 r4
+  savpc r15
+  add r15 12 r15
+  jump ismem
+  or r0 r1 r7
+  read -52 r14 r4
+  or r0 r4 r6
+  read -60 r14 r4
+  read -56 r14 r3
+  read -48 r14 r5
+  read -64 r14 r1
+  read -132 r14 r2
+  xor r7 0 r7
+  sltu r0 r7 r8
+  write -32 r14 r8
+.L175:
+  load 0 r7
+  write -36 r14 r7
+  read -32 r14 r8
+  read -36 r14 r7
+  bne r8 r0 .L177
+  write -40 r14 r7
+  jump .L179
+.L177:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump ismem
+  or r0 r1 r7
+  read -52 r14 r4
+  or r0 r4 r6
+  read -60 r14 r4
+  read -56 r14 r3
+  read -48 r14 r5
+  read -64 r14 r1
+  read -132 r14 r2
+  xor r7 0 r7
+  sltu r0 r7 r7
+  write -40 r14 r7
+.L179:
+  load 0 r7
+  write -44 r14 r7
+  read -92 r14 r8
+  read -40 r14 r12
+  bne r12 r0 .L181
+  read -44 r14 r7
+  jump .L182
+.L181:
+  or r0 r1 r5
+  or r0 r8 r4
+  savpc r15
+  add r15 12 r15
+  jump sameline
+  or r0 r1 r7
+  read -52 r14 r4
+  or r0 r4 r6
+  read -60 r14 r4
+  read -56 r14 r3
+  read -48 r14 r5
+  read -64 r14 r1
+  read -132 r14 r2
+  xor r7 0 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L182:
+  beq r7 r0 .L184
+  add r5 1 r5
+.L184:
+  or r0 r5 r7
+  load 1 r5
+  write -68 r14 r5
+  slt r4 r0 r8
+  read -68 r14 r5
+  bne r8 r0 .L187
+  slt r7 r3 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+  write -72 r14 r5
+  jump .L188
+.L187:
+  write -72 r14 r5
+.L188:
+  load 1 r5
+  write -76 r14 r5
+  read -92 r14 r8
+  read -72 r14 r12
+  bne r12 r0 .L193
+  load 0 r5
+  write -84 r14 r5
+  xor r7 r3 r5
+  sltu r5 1 r5
+  write -80 r14 r5
+  read -92 r14 r8
+  read -80 r14 r12
+  bne r12 r0 .L191
+  or r0 r8 r1
+  read -84 r14 r5
+  jump .L192
+.L191:
+  add r1 36 r1
+  read 0 r1 r5
+  write -88 r14 r5
+  load 48 r1
+  mults r4 r1 r5
+  addr2reg nd r1
+  add r1 r5 r1
+  read -88 r14 r5
+  add r1 36 r1
+  read 0 r1 r1
+  slt r1 r5 r5
+  read -92 r14 r1
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L192:
+  xor r5 0 r5
+  sltu r0 r5 r8
+  jump .L194
+.L193:
+  or r0 r8 r1
+  read -76 r14 r8
+.L194:
+  read -96 r14 r5
+  beq r8 r0 .L198
+  or r0 r7 r3
+  or r0 r6 r4
+  jump .L198
+.L197:
+  or r0 r8 r1
+  or r0 r7 r5
+.L198:
+  add r6 1 r6
+  jump .L165
+.L199:
+  read -100 r14 r5
+  bges r4 r0 .L202
+  load 199 r6
+  addr2reg .Lstring.18 r5
+  addr2reg .Lstring.17 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -60 r14 r4
+  read -56 r14 r3
+  read -100 r14 r5
+  read -132 r14 r2
+.L202:
+  load 48 r1
+  mults r4 r1 r6
+  addr2reg nd r1
+  add r1 r6 r1
+  write -12 r14 r1
+  add r1 44 r7
+  load 1 r6
+  write 0 r7 r6
+  or r0 r5 r6
+  read -124 r14 r5
+  shiftl r6 4 r6
+  add r5 r6 r6
+  read 0 r1 r5
+  write 0 r6 r5
+  add r1 4 r5
+  add r6 4 r6
+  read 0 r5 r7
+  write 0 r6 r7
+  add r5 4 r5
+  add r6 4 r6
+  read 0 r5 r7
+  write 0 r6 r7
+  add r5 4 r5
+  add r6 4 r6
+  read 0 r5 r5
+  write 0 r6 r5
+  add r4 1 r5
+.L203:
+  write -8 r14 r5
+  bges r5 r2 .L208
+  shiftl r4 6 r7
+  addr2reg dep r6
+  add r6 r7 r6
+  add r6 r5 r6
+  readb 0 r6 r6
+  beq r6 r0 .L207
+  load 48 r2
+  mults r5 r2 r3
+  addr2reg nd r2
+  add r2 r3 r7
+  write -4 r14 r7
+  add r7 32 r3
+  read 0 r3 r2
+  load 1 r4
+  sub r2 r4 r2
+  write 0 r3 r2
+  add r7 16 r2
+  read 0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump lat
+  read -8 r14 r5
+  read -60 r14 r4
+  read -56 r14 r3
+  read -4 r14 r7
+  read -132 r14 r2
+  add r3 r1 r6
+  add r7 40 r1
+  read 0 r1 r1
+  slt r1 r6 r8
+  read -12 r14 r1
+  beq r8 r0 .L207
+  add r7 40 r7
+  write 0 r7 r6
+.L207:
+  add r5 1 r5
+  jump .L203
+.L208:
+  read -100 r14 r5
+  read -124 r14 r4
+  add r3 1 r3
+  add r5 1 r5
+  write -92 r14 r1
+  write -96 r14 r3
+  jump .L162
+.L212:
+  read -148 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function schedule */
+
+
+.text
+; function fused
+fused:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r4
+  add r4 12 r1
+  readh 0 r1 r2
+  load 1 r1
+  load 12 r3
+  bne r2 r3 .L217
+  add r4 8 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L217:
+  bne r1 r0 .L222
+  add r4 4 r1
+  read 0 r1 r1
+  add r4 8 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+  write -16 r14 r1
+  read 0 r1 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r4
+  add r14 -20 r6
+  add r14 -20 r5
+  savpc r15
+  add r15 12 r15
+  jump iscmp
+  or r0 r1 r3
+  read -16 r14 r1
+  read -12 r14 r4
+  load 1 r2
+  beq r3 r0 .L220
+  add r1 4 r1
+  add r4 12 r2
+  add r2 4 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -16 r14 r1
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L220:
+  beq r2 r0 .L223
+  load 0 r1
+  jump .L223
+.L222:
+  load 0 r1
+.L223:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function fused */
+
+
+.text
+; function b32p3_sched
+.global b32p3_sched
+b32p3_sched:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 76 r13
+  write -68 r14 r8
+  or r0 r4 r2
+  write -64 r14 r2
+  read 0 r2 r1
+.L227:
+  or r0 r1 r2
+  write -60 r14 r2
+  beq r2 r0 .L277
+  or r0 r2 r1
+.L229:
+  write -40 r14 r1
+  add r1 12 r3
+  readh 0 r3 r4
+  load 0 r3
+  load 11 r5
+  beq r4 r5 .L231
+  or r0 r3 r4
+  jump .L232
+.L231:
+  add r1 20 r3
+  read 0 r3 r3
+  add r1 44 r4
+  read 0 r4 r4
+  xor r3 r4 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L232:
+  load 0 r3
+  bne r4 r0 .L234
+  or r0 r3 r4
+  jump .L235
+.L234:
+  add r1 20 r3
+  read 0 r3 r3
+  add r3 80 r3
+  read 0 r3 r3
+  xor r3 1 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L235:
+  load 0 r3
+  bne r4 r0 .L237
+  or r0 r3 r2
+  jump .L238
+.L237:
+  add r1 20 r3
+  read 0 r3 r3
+  xor r3 r2 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L238:
+  beq r2 r0 .L241
+  add r1 20 r1
+  read 0 r1 r1
+  write -56 r14 r1
+  or r0 r1 r2
+  add r1 8 r1
+  read 0 r1 r1
+  write -44 r14 r1
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump fused
+  or r0 r1 r3
+  read -60 r14 r1
+  read -44 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r3
+  sub r2 r3 r5
+  write -52 r14 r5
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 r5 r1
+  shiftl r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r3
+  read -60 r14 r1
+  write -48 r14 r3
+  add r1 4 r2
+  read 0 r2 r5
+  add r1 8 r1
+  read 0 r1 r6
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  or r0 r1 r4
+  read -52 r14 r5
+  read -56 r14 r2
+  add r2 4 r2
+  or r0 r5 r1
+  read 0 r2 r5
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  read -60 r14 r1
+  read -48 r14 r3
+  read -52 r14 r5
+  read -56 r14 r2
+  add r1 4 r4
+  write 0 r4 r3
+  add r1 8 r4
+  read 0 r4 r3
+  add r3 r5 r3
+  write 0 r4 r3
+  add r2 4 r4
+  read 0 r4 r3
+  shiftl r5 4 r6
+  add r3 r6 r3
+  write 0 r4 r3
+  add r2 8 r4
+  read 0 r4 r3
+  sub r3 r5 r3
+  write 0 r4 r3
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L229
+.L241:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fused
+  or r0 r1 r4
+  read -40 r14 r1
+  read -60 r14 r2
+  write -36 r14 r4
+  load 0 r3
+  bne r4 r0 .L243
+  or r0 r3 r2
+  jump .L244
+.L243:
+  xor r1 r2 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L244:
+  bne r2 r0 .L247
+  add r1 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump regbit
+  or r0 r1 r6
+  read -60 r14 r1
+  write -32 r14 r6
+  jump .L249
+.L247:
+  add r4 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump regbit
+  write -12 r14 r1
+  read -36 r14 r4
+  add r4 8 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump regbit
+  or r0 r1 r3
+  read -60 r14 r1
+  read -12 r14 r2
+  or r2 r3 r6
+  write -32 r14 r6
+.L249:
+  add r1 4 r2
+  read 0 r2 r8
+  or r0 r1 r2
+  add r1 8 r1
+  read 0 r1 r1
+  shiftl r1 4 r1
+  add r8 r1 r3
+  write -24 r14 r3
+.L250:
+  write -16 r14 r8
+  bge r8 r3 .L275
+  or r0 r8 r4
+  savpc r15
+  add r15 12 r15
+  jump barrier
+  or r0 r1 r5
+  read -16 r14 r8
+  read -32 r14 r6
+  read -40 r14 r1
+  or r0 r1 r7
+  read -60 r14 r1
+  read -24 r14 r3
+  read -36 r14 r4
+  read -64 r14 r2
+  bne r5 r0 .L273
+  or r0 r8 r2
+  or r0 r8 r1
+.L253:
+  write -28 r14 r1
+  load 0 r4
+  blt r1 r3 .L255
+  or r0 r4 r5
+  jump .L256
+.L255:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump barrier
+  or r0 r1 r4
+  read -28 r14 r1
+  read -16 r14 r2
+  read -24 r14 r3
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L256:
+  load 0 r4
+  beq r5 r0 .L258
+  sub r1 r2 r4
+  shiftrs r4 31 r5
+  shiftr r5 28 r5
+  add r4 r5 r4
+  shiftrs r4 4 r4
+  slt r4 64 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L258:
+  beq r4 r0 .L260
+  add r1 16 r1
+  jump .L253
+.L260:
+  or r0 r2 r8
+  or r0 r1 r2
+  read -40 r14 r7
+  read -60 r14 r1
+  sub r2 r8 r4
+  shiftrs r4 31 r5
+  shiftr r5 28 r5
+  add r4 r5 r4
+  shiftrs r4 4 r5
+  load 1 r4
+  slt r4 r5 r6
+  read -36 r14 r4
+  bne r6 r0 .L263
+  read -32 r14 r6
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  or r0 r4 r5
+  read -64 r14 r4
+  jump .L272
+.L263:
+  load 0 r4
+  write -20 r14 r4
+  read -36 r14 r4
+  read -32 r14 r6
+  bne r4 r0 .L265
+  read -20 r14 r7
+  jump .L266
+.L265:
+  xor r7 r1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r7
+.L266:
+  load 0 r1
+  read -64 r14 r4
+  bne r7 r0 .L268
+  or r0 r6 r12
+  or r0 r1 r6
+  or r0 r12 r1
+  jump .L269
+.L268:
+  or r0 r6 r1
+  xor r2 r3 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L269:
+  beq r2 r3 .L271
+  load 0 r1
+.L271:
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r4
+  or r0 r1 r7
+  or r0 r8 r4
+  savpc r15
+  add r15 12 r15
+  jump schedule
+  read -28 r14 r1
+  read -32 r14 r6
+  read -40 r14 r7
+  read -60 r14 r2
+  read -24 r14 r3
+  read -36 r14 r5
+  load32 -12 r4
+  sub r13 r4 r13
+  read -64 r14 r4
+.L272:
+  or r0 r1 r8
+  or r0 r7 r1
+  jump .L250
+.L273:
+  or r0 r4 r5
+  or r0 r2 r4
+  or r0 r1 r2
+  or r0 r7 r1
+  add r8 16 r8
+  jump .L250
+.L275:
+  read -40 r14 r1
+  read -64 r14 r2
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L227
+.L277:
+  read -68 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function b32p3_sched */
+
+.data
+.balign 4
+nd:
+	.fill 3072,1,0
+/* end data */
+
+.data
+.balign 1
+dep:
+	.fill 4096,1,0
+/* end data */
+
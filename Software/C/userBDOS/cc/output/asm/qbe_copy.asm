@@ -0,0 +1,1601 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+
+.text
+; function iscon
+iscon:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r6
+  write -12 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -16 r14 r6
+  read -12 r14 r5
+  load 0 r1
+  load 1 r3
+  beq r2 r3 .L19
+  or r0 r1 r2
+  jump .L20
+.L19:
+  add r6 8 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  xor r1 1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L20:
+  load 0 r1
+  beq r2 r0 .L22
+  add r6 8 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  add r1 16 r1
+  read 0 r1 r1
+  xor r1 r5 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L22:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function iscon */
+
+.data
+.balign 4
+.Lextcpy.9:
+	.int 0
+	.int 42
+	.int 84
+	.int 40
+	.int 80
+	.int 32
+	.int 64
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "KBASE(t->cls) == 0\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.11:
+	.ascii "BuildTools/QBE/copy.c\000"
+/* end data */
+
+
+.text
+; function iscopy
+iscopy:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -8 r14 r6
+  add r14 -20 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  write -16 r14 r1
+  read 0 r1 r2
+  shiftl r2 2 r3
+  shiftr r3 2 r3
+  load 88 r4
+  beq r3 r4 .L48
+  load 88 r4
+  bge r3 r4 .L31
+  load 1 r4
+  sub r3 r4 r3
+  load 16 r4
+  bge r3 r4 .L31
+  shiftl r3 2 r4
+  addr2reg .Ljt29 r3
+  add r3 r4 r3
+  read 0 r3 r3
+  jumpr 0 r3
+.L30:
+  add r1 8 r1
+  add r1 4 r1
+  load 0 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  jump .L49
+.L31:
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 66 r3
+  sub r2 r3 r3
+  load 5 r2
+  sltu r2 r3 r2
+  xor r2 1 r3
+  load 1 r2
+  beq r3 r0 .L33
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -8 r14 r6
+  read -16 r14 r1
+  xor r2 0 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L33:
+  bne r2 r0 .L46
+  read 0 r1 r2
+  shiftl r2 2 r3
+  shiftr r3 2 r4
+  load 1 r3
+  load 70 r5
+  beq r4 r5 .L36
+  shiftl r2 2 r3
+  shiftr r3 2 r3
+  xor r3 71 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L36:
+  beq r3 r0 .L38
+  shiftr r2 30 r2
+  beq r2 r0 .L45
+.L38:
+  add r6 4 r2
+  read 0 r2 r2
+  read -20 r14 r3
+  shiftr r3 3 r3
+  load 160 r4
+  mults r3 r4 r3
+  add r2 r3 r2
+  write -12 r14 r2
+  add r2 108 r3
+  readh 0 r3 r3
+  shiftrs r3 1 r3
+  beq r3 r0 .L40
+  load 51 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.10 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r2
+  read -16 r14 r1
+.L40:
+  read 0 r1 r1
+  shiftr r1 30 r4
+  load 0 r3
+  load 1 r5
+  bne r4 r5 .L42
+  add r2 108 r3
+  readh 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L42:
+  bne r3 r0 .L44
+  add r2 152 r2
+  read 0 r2 r2
+  shiftl r2 2 r3
+  addr2reg .Lextcpy.9 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 66 r3
+  sub r1 r3 r3
+  load 1 r1
+  add r1 r3 r3
+  load 1 r1
+  shiftl r1 r3 r1
+  and r1 r2 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L49
+.L44:
+  load 0 r1
+  jump .L49
+.L45:
+  load 1 r1
+  jump .L49
+.L46:
+  load 0 r1
+  jump .L49
+.L47:
+  add r1 8 r1
+  add r1 4 r1
+  load 1 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  jump .L49
+.L48:
+  load 1 r1
+.L49:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt29:
+  .int .L30
+  .int .L30
+  .int .L31
+  .int .L47
+  .int .L31
+  .int .L47
+  .int .L31
+  .int .L47
+  .int .L31
+  .int .L31
+  .int .L31
+  .int .L30
+  .int .L30
+  .int .L30
+  .int .L30
+  .int .L30
+
+/* end function iscopy */
+
+
+.text
+; function copyof
+copyof:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  write -16 r14 r5
+  add r14 -24 r1
+  write 0 r1 r4
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -16 r14 r5
+  load 0 r1
+  bne r2 r0 .L54
+  read -24 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r1
+  add r5 r1 r1
+  load 0 r2
+  write -20 r14 r2
+  read -20 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -16 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L54:
+  bne r1 r0 .L56
+  read -24 r14 r1
+  jump .L57
+.L56:
+  read -24 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r1
+.L57:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function copyof */
+
+
+.text
+; function phisimpl
+phisimpl:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 140 r13
+  read 16 r14 r1
+  write -72 r14 r1
+  read 12 r14 r1
+  write -52 r14 r1
+  read 8 r14 r2
+  write -76 r14 r2
+  write -68 r14 r7
+  write -56 r14 r6
+  or r0 r5 r1
+  add r14 -128 r3
+  write 0 r3 r1
+  write -4 r14 r4
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump bszero
+  read -52 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump bszero
+  read -52 r14 r4
+  read -68 r14 r7
+  read -56 r14 r3
+  read -4 r14 r1
+  load 0 r2
+  write -116 r14 r2
+  add r14 -116 r2
+  add r2 4 r5
+  load 0 r2
+  write 0 r5 r2
+  add r14 -116 r2
+  add r2 8 r5
+  load 0 r2
+  write 0 r5 r2
+  add r14 -116 r2
+  add r2 12 r5
+  load 0 r2
+  write 0 r5 r2
+  add r14 -116 r2
+  add r2 16 r5
+  load 0 r2
+  write 0 r5 r2
+  add r14 -116 r2
+  add r2 20 r5
+  load 0 r2
+  write 0 r5 r2
+  read 0 r7 r6
+  load 1 r2
+  write -92 r14 r2
+  add r14 -92 r2
+  add r2 4 r5
+  load 0 r2
+  write 0 r5 r2
+  add r14 -92 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r6 0 r2
+  add r14 -92 r1
+  write 0 r2 r1
+  load 1 r1
+.L61:
+  write -28 r14 r6
+  beq r1 r0 .L89
+  load 1 r2
+  sub r1 r2 r1
+  write -80 r14 r1
+  shiftl r1 2 r2
+  add r6 r2 r2
+  read 0 r2 r5
+  write -16 r14 r5
+  read 0 r5 r2
+  load 0 r5
+  write -12 r14 r5
+  load 2 r5
+  xor r2 r5 r2
+  sltu r2 1 r2
+  write -8 r14 r2
+  read -16 r14 r5
+  read -72 r14 r7
+  read -76 r14 r2
+  read -8 r14 r12
+  bne r12 r0 .L64
+  read -12 r14 r7
+  jump .L65
+.L64:
+  add r5 8 r1
+  read 0 r1 r4
+  or r0 r7 r6
+  read -128 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump iscopy
+  or r0 r1 r7
+  read -28 r14 r6
+  read -16 r14 r5
+  read -80 r14 r1
+  read -52 r14 r4
+  read -76 r14 r2
+  read -56 r14 r3
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L65:
+  bne r7 r0 .L70
+  read 0 r5 r2
+  load 1 r5
+  xor r2 r5 r2
+  sltu r2 1 r2
+  write -20 r14 r2
+  read -16 r14 r5
+  read -72 r14 r7
+  read -76 r14 r2
+  read -20 r14 r12
+  bne r12 r0 .L68
+  or r0 r7 r5
+  read -68 r14 r7
+  jump .L61
+.L68:
+  add r5 8 r5
+  read 0 r5 r7
+  read 0 r7 r5
+  shiftr r5 3 r5
+  write -124 r14 r5
+  write -60 r14 r7
+  jump .L72
+.L70:
+  add r5 8 r5
+  read 0 r5 r5
+  add r5 4 r5
+  read 0 r5 r5
+  shiftr r5 3 r5
+  write -124 r14 r5
+  add r14 -116 r7
+  write -60 r14 r7
+.L72:
+  write -24 r14 r5
+  read 0 r2 r7
+  shiftl r7 5 r7
+  blt r5 r7 .L75
+  load 512 r6
+  addr2reg .Lstring.6 r5
+  addr2reg .Lstring.5 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -24 r14 r5
+  read -28 r14 r6
+  read -80 r14 r1
+  read -52 r14 r4
+  read -76 r14 r2
+  read -56 r14 r3
+.L75:
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r5 5 r7
+  shiftl r7 2 r7
+  add r2 r7 r2
+  read 0 r2 r2
+  write -32 r14 r2
+  read -76 r14 r2
+  and r5 31 r7
+  load 1 r5
+  shiftl r5 r7 r7
+  read -32 r14 r5
+  and r5 r7 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+  write -36 r14 r5
+  read -72 r14 r5
+  read -68 r14 r7
+  read -36 r14 r12
+  bne r12 r0 .L61
+  read -124 r14 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -60 r14 r1
+  read -56 r14 r3
+  load 0 r2
+.L78:
+  write -64 r14 r2
+  add r1 12 r4
+  read 0 r4 r4
+  bge r2 r4 .L83
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  or r0 r3 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump copyof
+  write -132 r14 r1
+  read -132 r14 r1
+  write -48 r14 r1
+  write -120 r14 r1
+  read -128 r14 r5
+  read -120 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r5
+  read -64 r14 r2
+  read -60 r14 r1
+  read -52 r14 r4
+  read -56 r14 r3
+  bne r5 r0 .L82
+  read -120 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -48 r14 r1
+  read -52 r14 r4
+  bne r2 r0 .L95
+  shiftr r1 3 r5
+  savpc r15
+  add r15 12 r15
+  jump bsset
+  read -64 r14 r2
+  read -60 r14 r1
+  read -52 r14 r4
+  read -56 r14 r3
+.L82:
+  add r2 1 r2
+  jump .L78
+.L83:
+  read -80 r14 r1
+  read -72 r14 r5
+  read -68 r14 r7
+  add r5 4 r2
+  read 0 r2 r3
+  read -124 r14 r4
+  load 160 r2
+  mults r4 r2 r2
+  add r3 r2 r2
+  add r2 84 r2
+  read 0 r2 r2
+  write -40 r14 r2
+  load 160 r5
+  mults r4 r5 r4
+  add r3 r4 r3
+  add r3 92 r3
+  read 0 r3 r3
+  load 12 r4
+  mults r3 r4 r3
+  add r2 r3 r5
+  write -44 r14 r5
+  sub r5 r2 r3
+  load32 715827883 r2
+  mulshi r3 r2 r2
+  shiftrs r2 1 r2
+  shiftr r3 31 r3
+  add r2 r3 r2
+  add r1 r2 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -44 r14 r5
+  read -40 r14 r2
+  read -80 r14 r1
+  read -52 r14 r4
+  read -68 r14 r7
+  read -56 r14 r3
+  read 0 r7 r6
+.L85:
+  bge r2 r5 .L88
+  or r0 r1 r7
+  add r1 1 r1
+  shiftl r7 2 r7
+  add r6 r7 r7
+  write 0 r7 r2
+  add r2 12 r2
+  jump .L85
+.L88:
+  read -72 r14 r5
+  read -76 r14 r2
+  read -68 r14 r7
+  jump .L61
+.L89:
+  read -76 r14 r2
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump bsdiff
+  read -52 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump bscount
+  read -76 r14 r2
+  bne r1 r0 .L95
+  load 0 r1
+  write -124 r14 r1
+.L92:
+  add r14 -124 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump bsiter
+  read -76 r14 r2
+  read -56 r14 r3
+  beq r1 r0 .L95
+  read -124 r14 r1
+  shiftl r1 2 r1
+  add r3 r1 r4
+  read -128 r14 r1
+  write 0 r4 r1
+  read -124 r14 r1
+  add r1 1 r1
+  write -124 r14 r1
+  jump .L92
+.L95:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function phisimpl */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "rtype(*pr) != RTmp || !req(cpy[pr->val], R)\000"
+/* end data */
+
+
+.text
+; function subst
+subst:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -12 r14 r5
+  read -16 r14 r4
+  load 1 r1
+  bne r2 r0 .L100
+  read 0 r4 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r1
+  add r5 r1 r1
+  load 0 r2
+  write -20 r14 r2
+  read -20 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -12 r14 r5
+  read -16 r14 r4
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L100:
+  bne r1 r0 .L102
+  load 124 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.15 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r5
+  read -16 r14 r4
+.L102:
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump copyof
+  read -16 r14 r4
+  write -24 r14 r1
+  read -24 r14 r1
+  write 0 r4 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function subst */
+
+.data
+.balign 1
+.Lstring.17:
+	.ascii "rtype(p->to) == RTmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "!req(r, R)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "rtype(i->to) <= RTmp\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "\012> Copy information:\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "\012%10s not seen!\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "\012%10s copy of \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "\012\012> After copy elimination:\012\000"
+/* end data */
+
+
+.text
+; function copy
+.global copy
+copy:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 164 r13
+  write -156 r14 r8
+  or r0 r4 r1
+  write -112 r14 r1
+  add r1 16 r1
+  read 0 r1 r5
+  add r14 -144 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -112 r14 r1
+  add r1 16 r1
+  read 0 r1 r5
+  add r14 -136 r4
+  savpc r15
+  add r15 12 r15
+  jump bsinit
+  read -112 r14 r1
+  add r1 16 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  write -88 r14 r1
+  load 0 r6
+  load 4 r5
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r2
+  read -112 r14 r1
+  write -128 r14 r2
+  load 0 r2
+  or r0 r1 r4
+  or r0 r2 r7
+.L108:
+  write -104 r14 r7
+  add r4 28 r1
+  read 0 r1 r1
+  bge r7 r1 .L159
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r7 2 r2
+  add r1 r2 r1
+  read 0 r1 r3
+  write -108 r14 r3
+  read 0 r3 r1
+.L110:
+  write -92 r14 r1
+  beq r1 r0 .L145
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -92 r14 r1
+  read -88 r14 r2
+  beq r3 r0 .L113
+  load 150 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.17 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -92 r14 r1
+  read -88 r14 r2
+.L113:
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r1
+  add r2 r1 r1
+  load 0 r2
+  write -120 r14 r2
+  read -120 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -92 r14 r1
+  read -104 r14 r7
+  read -108 r14 r3
+  read -88 r14 r2
+  read -112 r14 r8
+  beq r4 r0 .L143
+  load 0 r3
+  write -124 r14 r3
+  load 0 r6
+  load 0 r5
+  load 0 r4
+  load 0 r3
+  write -60 r14 r3
+  or r0 r5 r3
+.L116:
+  write -100 r14 r6
+  write -96 r14 r3
+  write -64 r14 r4
+  add r1 12 r5
+  read 0 r5 r5
+  bge r6 r5 .L131
+  add r1 8 r5
+  read 0 r5 r5
+  shiftl r6 2 r7
+  add r5 r7 r5
+  read -104 r14 r7
+  read 0 r5 r5
+  add r5 48 r5
+  read 0 r5 r5
+  sltu r5 r7 r8
+  read -60 r14 r5
+  read -104 r14 r7
+  beq r8 r0 .L129
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r6 2 r3
+  add r1 r3 r1
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump copyof
+  write -152 r14 r1
+  read -152 r14 r4
+  write -68 r14 r4
+  write -120 r14 r4
+  load 0 r1
+  write -116 r14 r1
+  read -116 r14 r5
+  read -124 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r5
+  read -60 r14 r4
+  read -64 r14 r1
+  or r0 r4 r2
+  read -68 r14 r4
+  load 1 r3
+  bne r5 r0 .L120
+  load 1 r1
+  write -116 r14 r1
+  read -116 r14 r5
+  read -124 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -60 r14 r4
+  read -64 r14 r1
+  or r0 r4 r2
+  read -68 r14 r4
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L120:
+  bne r3 r0 .L122
+  write -84 r14 r1
+  write -80 r14 r2
+  jump .L124
+.L122:
+  write -124 r14 r4
+  write -84 r14 r4
+  write -80 r14 r4
+.L124:
+  read -124 r14 r5
+  read -120 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  write -72 r14 r1
+  read -80 r14 r4
+  or r0 r4 r5
+  read -84 r14 r4
+  read -100 r14 r6
+  read -96 r14 r3
+  read -92 r14 r1
+  read -88 r14 r2
+  load 1 r7
+  write -76 r14 r7
+  read -72 r14 r8
+  read -76 r14 r7
+  bne r8 r0 .L126
+  load 1 r1
+  write -116 r14 r1
+  read -116 r14 r5
+  read -120 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r7
+  read -80 r14 r4
+  or r0 r4 r5
+  read -84 r14 r4
+  read -100 r14 r6
+  read -96 r14 r3
+  read -92 r14 r1
+  read -88 r14 r2
+  xor r7 0 r7
+  sltu r0 r7 r8
+  jump .L127
+.L126:
+  or r0 r7 r8
+.L127:
+  read -104 r14 r7
+  beq r8 r0 .L129
+  add r3 1 r3
+.L129:
+  add r6 1 r6
+  write -60 r14 r5
+  jump .L116
+.L131:
+  load 0 r1
+  write -120 r14 r1
+  read -120 r14 r5
+  read -124 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  beq r1 r0 .L133
+  load 163 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.18 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+.L133:
+  read -124 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -60 r14 r5
+  read -64 r14 r4
+  or r0 r5 r6
+  read -96 r14 r5
+  read -92 r14 r1
+  read -88 r14 r2
+  load 0 r7
+  write -48 r14 r7
+  xor r3 r0 r3
+  sltu r3 1 r3
+  write -44 r14 r3
+  read -108 r14 r3
+  read -112 r14 r8
+  read -44 r14 r12
+  bne r12 r0 .L135
+  read -104 r14 r7
+  write -56 r14 r6
+  read -48 r14 r6
+  jump .L138
+.L135:
+  or r0 r4 r5
+  add r8 40 r1
+  read 0 r1 r1
+  add r8 4 r2
+  read 0 r2 r2
+  shiftr r5 3 r4
+  load 160 r5
+  mults r4 r5 r4
+  add r2 r4 r2
+  add r2 96 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  or r0 r3 r5
+  savpc r15
+  add r15 12 r15
+  jump dom
+  or r0 r1 r3
+  read -64 r14 r5
+  or r0 r5 r4
+  read -96 r14 r5
+  read -92 r14 r1
+  read -104 r14 r7
+  read -88 r14 r2
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r6
+  write -52 r14 r6
+  read -108 r14 r3
+  read -112 r14 r8
+  read -52 r14 r6
+  write -56 r14 r4
+.L138:
+  or r0 r8 r4
+  bne r6 r0 .L142
+  add r1 12 r6
+  read 0 r6 r6
+  xor r5 r6 r6
+  sltu r6 1 r6
+  read -56 r14 r5
+  bne r6 r0 .L141
+  read 0 r1 r3
+  shiftr r3 3 r5
+  shiftl r5 2 r5
+  add r2 r5 r5
+  write 0 r5 r3
+  load 20 r3
+  sub r13 r3 r13
+  or r0 r13 r3
+  add r3 16 r5
+  write 0 r5 r4
+  add r3 12 r5
+  add r14 -136 r4
+  write 0 r5 r4
+  add r3 8 r4
+  add r14 -144 r3
+  write 0 r4 r3
+  add r14 -128 r7
+  or r0 r2 r6
+  read -124 r14 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump phisimpl
+  read -92 r14 r1
+  read -104 r14 r7
+  read -108 r14 r3
+  read -88 r14 r2
+  read -112 r14 r4
+  load32 -20 r5
+  sub r13 r5 r13
+  jump .L144
+.L141:
+  read 0 r1 r6
+  shiftr r6 3 r6
+  shiftl r6 2 r6
+  add r2 r6 r6
+  write 0 r6 r5
+  jump .L144
+.L142:
+  read 0 r1 r5
+  shiftr r5 3 r6
+  shiftl r6 2 r6
+  add r2 r6 r6
+  write 0 r6 r5
+  jump .L144
+.L143:
+  or r0 r8 r4
+.L144:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L110
+.L145:
+  read -108 r14 r3
+  add r3 4 r1
+  read 0 r1 r1
+.L147:
+  write -40 r14 r1
+  add r3 4 r2
+  read 0 r2 r2
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r2
+  bge r1 r2 .L157
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -40 r14 r1
+  read -88 r14 r2
+  bles r3 r0 .L150
+  load 175 r6
+  addr2reg .Lstring.11 r5
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -40 r14 r1
+  read -88 r14 r2
+.L150:
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r1
+  add r2 r1 r1
+  load 0 r2
+  write -120 r14 r2
+  read -120 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r5
+  read -40 r14 r1
+  read -108 r14 r3
+  read -88 r14 r2
+  read -112 r14 r4
+  beq r5 r0 .L155
+  add r1 8 r1
+  add r1 0 r1
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump copyof
+  or r0 r1 r2
+  read -40 r14 r1
+  read -112 r14 r4
+  write -148 r14 r2
+  read -148 r14 r2
+  write -36 r14 r2
+  write -124 r14 r2
+  or r0 r4 r6
+  read -124 r14 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump iscopy
+  or r0 r1 r6
+  read -40 r14 r1
+  read -36 r14 r4
+  read -108 r14 r3
+  read -88 r14 r2
+  or r0 r4 r5
+  read -112 r14 r4
+  bne r6 r0 .L153
+  or r0 r4 r8
+  add r1 4 r4
+  read 0 r4 r4
+  shiftr r4 3 r5
+  shiftl r5 2 r5
+  add r2 r5 r5
+  write 0 r5 r4
+  jump .L156
+.L153:
+  or r0 r4 r8
+  or r0 r5 r4
+  add r1 4 r5
+  read 0 r5 r5
+  shiftr r5 3 r5
+  shiftl r5 2 r5
+  add r2 r5 r5
+  write 0 r5 r4
+  jump .L156
+.L155:
+  or r0 r4 r8
+.L156:
+  add r1 16 r1
+  jump .L147
+.L157:
+  read -104 r14 r7
+  read -88 r14 r2
+  read -112 r14 r4
+  add r7 1 r7
+  jump .L108
+.L159:
+  or r0 r4 r1
+  read -88 r14 r4
+  read 0 r1 r1
+  or r0 r1 r2
+  or r0 r4 r1
+.L162:
+  write -32 r14 r2
+  beq r2 r0 .L185
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L164:
+  write -20 r14 r1
+  read 0 r1 r3
+  write -24 r14 r3
+  beq r3 r0 .L174
+  read 0 r3 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r1
+  add r2 r1 r1
+  read 0 r1 r1
+  write -124 r14 r1
+  read 0 r3 r5
+  read -124 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -20 r14 r1
+  read -24 r14 r3
+  read -88 r14 r2
+  beq r4 r0 .L173
+  load 0 r1
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L168:
+  write -28 r14 r3
+  add r1 12 r4
+  read 0 r4 r4
+  bge r3 r4 .L171
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r3 2 r3
+  add r1 r3 r4
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump subst
+  read -28 r14 r3
+  read -24 r14 r1
+  read -88 r14 r2
+  add r3 1 r3
+  jump .L168
+.L171:
+  or r0 r1 r3
+  add r3 20 r1
+  jump .L164
+.L173:
+  add r3 20 r3
+  read 0 r3 r3
+  write 0 r1 r3
+  jump .L164
+.L174:
+  read -32 r14 r1
+  add r1 4 r3
+  read 0 r3 r3
+.L176:
+  write -16 r14 r3
+  or r0 r1 r4
+  add r1 4 r1
+  read 0 r1 r1
+  add r4 8 r4
+  read 0 r4 r4
+  shiftl r4 4 r4
+  add r1 r4 r1
+  bge r3 r1 .L181
+  add r3 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r1
+  add r2 r1 r1
+  read 0 r1 r1
+  write -124 r14 r1
+  add r3 4 r1
+  read 0 r1 r5
+  read -124 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -16 r14 r3
+  read -32 r14 r1
+  read -88 r14 r2
+  beq r4 r0 .L179
+  add r3 8 r1
+  add r1 0 r4
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump subst
+  read -16 r14 r3
+  read -88 r14 r2
+  add r3 8 r1
+  add r1 4 r4
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump subst
+  read -16 r14 r3
+  read -32 r14 r1
+  read -88 r14 r2
+  jump .L180
+.L179:
+  load 90 r4
+  write 0 r3 r4
+  add r3 4 r4
+  load 0 r5
+  write 0 r4 r5
+  add r4 4 r4
+  load 0 r5
+  write 0 r4 r5
+  add r4 4 r5
+  load 0 r4
+  write 0 r5 r4
+.L180:
+  add r3 16 r3
+  jump .L176
+.L181:
+  read -32 r14 r1
+  add r1 12 r1
+  add r1 4 r4
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump subst
+  read -32 r14 r1
+  read -88 r14 r2
+  add r1 44 r1
+  read 0 r1 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L162
+.L185:
+  addr2reg debug+67 r12
+  readb 0 r12 r1
+  beq r1 r0 .L197
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.20 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -88 r14 r4
+  read -112 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  load 32 r2
+  or r0 r4 r12
+  or r0 r1 r4
+  or r0 r12 r1
+.L188:
+  write -12 r14 r2
+  add r4 16 r3
+  read 0 r3 r3
+  bges r2 r3 .L196
+  shiftl r2 2 r2
+  add r1 r2 r1
+  load 0 r2
+  write -120 r14 r2
+  read -120 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -12 r14 r1
+  or r0 r1 r2
+  read -88 r14 r1
+  read -112 r14 r4
+  bne r3 r0 .L192
+  shiftl r2 2 r3
+  add r1 r3 r1
+  shiftl r2 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -120 r14 r2
+  read -120 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -12 r14 r1
+  read -88 r14 r2
+  read -112 r14 r4
+  bne r3 r0 .L194
+  or r0 r1 r2
+  add r4 4 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.22 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r1
+  read -88 r14 r2
+  read -112 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  shiftl r1 2 r1
+  add r2 r1 r1
+  addr2reg __stderr_file r6
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -12 r14 r1
+  read -88 r14 r2
+  read -112 r14 r4
+  jump .L194
+.L192:
+  or r0 r2 r1
+  or r0 r1 r2
+  add r4 4 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.21 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r1
+  read -88 r14 r2
+  read -112 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+.L194:
+  add r1 1 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L188
+.L196:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.23 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -112 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+.L197:
+  read -128 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  read -88 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -156 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function copy */
+
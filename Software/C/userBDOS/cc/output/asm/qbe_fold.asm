@@ -0,0 +1,2726 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+
+.text
+; function iscon
+iscon:
+  read 0 r4 r1
+  load 1 r2
+  bne r1 r2 .L21
+  bne r5 r0 .L20
+  add r4 16 r1
+  read 0 r1 r1
+  xor r1 r6 r1
+  sltu r1 1 r1
+  jump .L22
+.L20:
+  add r4 16 r1
+  read 0 r1 r1
+  xor r1 r6 r1
+  sltu r1 1 r1
+  jump .L22
+.L21:
+  load 0 r1
+.L22:
+  jumpr 0 r15
+
+/* end function iscon */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "BuildTools/QBE/fold.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "unreachable\000"
+/* end data */
+
+
+.text
+; function latval
+latval:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  load 1 r2
+  beq r1 r2 .L32
+  load 1 r2
+  bge r1 r2 .L30
+  beq r1 r0 .L31
+  sltu r1 r0 r1
+.L30:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r5
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L33
+.L31:
+  addr2reg val r12
+  read 0 r12 r1
+  read -4 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  jump .L33
+.L32:
+  read -4 r14 r1
+  shiftr r1 3 r1
+.L33:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function latval */
+
+
+.text
+; function latmerge
+latmerge:
+  or r0 r5 r1
+  or r0 r4 r2
+  beq r1 r0 .L42
+  load 1 r3
+  beq r2 r0 .L39
+  xor r2 r1 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L40
+.L39:
+  or r0 r3 r2
+.L40:
+  bne r2 r0 .L43
+  load32 -1 r1
+  jump .L43
+.L42:
+  or r0 r2 r1
+.L43:
+  jumpr 0 r15
+
+/* end function latmerge */
+
+
+.text
+; function update
+update:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -16 r14 r6
+  write -32 r14 r4
+  addr2reg val r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump latmerge
+  read -16 r14 r6
+  read -32 r14 r4
+  write -28 r14 r1
+  addr2reg val r12
+  read 0 r12 r2
+  shiftl r4 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  beq r1 r2 .L53
+  add r6 4 r1
+  read 0 r1 r1
+  load 160 r2
+  mults r4 r2 r2
+  add r1 r2 r1
+  write -20 r14 r1
+  load 0 r2
+.L48:
+  write -24 r14 r2
+  add r1 92 r1
+  read 0 r1 r1
+  bge r2 r1 .L51
+  addr2reg nuse r12
+  read 0 r12 r1
+  add r1 1 r5
+  addr2reg nuse r12
+  write 0 r12 r5
+  addr2reg usewrk r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -24 r14 r2
+  read -20 r14 r1
+  add r1 84 r3
+  read 0 r3 r3
+  load 12 r4
+  mults r2 r4 r4
+  add r3 r4 r3
+  addr2reg usewrk r12
+  read 0 r12 r4
+  addr2reg nuse r12
+  read 0 r12 r5
+  load 1 r6
+  sub r5 r6 r5
+  shiftl r5 2 r5
+  add r4 r5 r4
+  write 0 r4 r3
+  add r2 1 r2
+  jump .L48
+.L51:
+  read -28 r14 r1
+  read -32 r14 r4
+  addr2reg val r12
+  read 0 r12 r2
+  shiftl r4 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+.L53:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function update */
+
+
+.text
+; function deadedge
+deadedge:
+  addr2reg edge r12
+  read 0 r12 r1
+  shiftl r4 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  load 0 r2
+.L57:
+  addr2reg nedge r12
+  read 0 r12 r3
+  shiftl r4 2 r6
+  add r3 r6 r3
+  read 0 r3 r3
+  bge r2 r3 .L63
+  load 12 r3
+  mults r2 r3 r3
+  add r1 r3 r3
+  read 0 r3 r6
+  load 0 r3
+  bne r6 r5 .L60
+  load 12 r3
+  mults r2 r3 r3
+  add r1 r3 r3
+  add r3 4 r3
+  read 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L60:
+  bne r3 r0 .L62
+  add r2 1 r2
+  jump .L57
+.L62:
+  load 0 r1
+  jump .L64
+.L63:
+  load 1 r1
+.L64:
+  jumpr 0 r15
+
+/* end function deadedge */
+
+
+.text
+; function visitphi
+visitphi:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -32 r14 r6
+  write -20 r14 r5
+  write -24 r14 r4
+  load 0 r2
+  load 0 r1
+  write -16 r14 r2
+  or r0 r1 r2
+.L69:
+  write -28 r14 r2
+  add r4 12 r1
+  read 0 r1 r1
+  bge r2 r1 .L74
+  add r4 8 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump deadedge
+  or r0 r1 r3
+  read -16 r14 r1
+  read -28 r14 r2
+  read -20 r14 r5
+  read -24 r14 r4
+  bne r3 r0 .L72
+  add r4 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump latval
+  or r0 r1 r5
+  read -16 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump latmerge
+  read -28 r14 r2
+  read -20 r14 r5
+  read -24 r14 r4
+.L72:
+  add r2 1 r2
+  write -16 r14 r1
+  jump .L69
+.L74:
+  read -16 r14 r5
+  read -32 r14 r6
+  read 0 r4 r1
+  shiftr r1 3 r4
+  savpc r15
+  add r15 12 r15
+  jump update
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function visitphi */
+
+
+.text
+; function visitins
+visitins:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  add r4 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -12 r14 r1
+  read -16 r14 r4
+  bne r2 r0 .L101
+  read 0 r4 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 24 r3
+  mults r2 r3 r3
+  addr2reg optab r2
+  add r2 r3 r2
+  add r2 20 r2
+  read 0 r2 r2
+  bne r2 r0 .L83
+  load32 -1 r2
+  or r0 r1 r6
+  or r0 r2 r5
+  jump .L100
+.L83:
+  add r4 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump latval
+  write -8 r14 r1
+  read -16 r14 r4
+  add r4 8 r1
+  add r1 4 r1
+  load 0 r2
+  write -20 r14 r2
+  read -20 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -8 r14 r6
+  read -12 r14 r1
+  read -16 r14 r4
+  beq r2 r0 .L86
+  load 1 r2
+  or r0 r2 r3
+  jump .L87
+.L86:
+  add r4 8 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump latval
+  or r0 r1 r3
+  read -8 r14 r6
+  read -12 r14 r1
+  read -16 r14 r4
+.L87:
+  load 1 r2
+  load32 -1 r5
+  beq r6 r5 .L89
+  xor r3 -1 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L89:
+  bne r2 r0 .L97
+  load 1 r2
+  beq r6 r0 .L92
+  xor r3 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L92:
+  bne r2 r0 .L94
+  read 0 r4 r2
+  shiftl r2 2 r4
+  shiftr r4 2 r4
+  shiftr r2 30 r5
+  add r1 8 r2
+  read 0 r2 r2
+  shiftl r6 5 r6
+  add r2 r6 r6
+  shiftl r3 5 r3
+  add r2 r3 r7
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump opfold
+  or r0 r1 r5
+  read -12 r14 r6
+  read -16 r14 r4
+  load32 -12 r1
+  sub r13 r1 r13
+  jump .L100
+.L94:
+  or r0 r1 r6
+  load 0 r1
+  or r0 r1 r5
+  jump .L100
+.L97:
+  or r0 r1 r6
+  load32 -1 r1
+  or r0 r1 r5
+.L100:
+  add r4 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r4
+  savpc r15
+  add r15 12 r15
+  jump update
+.L101:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function visitins */
+
+
+.text
+; function flowedge
+flowedge:
+  add r4 4 r1
+  read 0 r1 r1
+  load 1 r2
+  bne r1 r2 .L106
+  add r4 4 r2
+  load 2 r1
+  write 0 r2 r1
+  addr2reg flowrk r12
+  read 0 r12 r1
+  add r4 8 r2
+  write 0 r2 r1
+  addr2reg flowrk r12
+  write 0 r12 r4
+.L106:
+  jumpr 0 r15
+
+/* end function flowedge */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "edge[n][0].dead\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "edge[n][1].dead\000"
+/* end data */
+
+
+.text
+; function visitjmp
+visitjmp:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r6
+  write -16 r14 r5
+  write -4 r14 r4
+  add r4 12 r1
+  readh 0 r1 r1
+  load 31 r2
+  beq r1 r2 .L147
+  load 31 r2
+  blt r1 r2 .L131
+  load 32 r2
+  beq r1 r2 .L114
+  load 32 r2
+  sltu r1 r2 r2
+  jump .L135
+.L114:
+  add r4 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump latval
+  or r0 r1 r2
+  read -12 r14 r6
+  read -16 r14 r5
+  read -4 r14 r4
+  load 0 r1
+  load32 -1 r3
+  bne r2 r3 .L116
+  or r0 r1 r3
+  jump .L117
+.L116:
+  xor r2 0 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r3
+.L117:
+  load 0 r1
+  bne r3 r0 .L119
+  or r0 r1 r3
+  jump .L120
+.L119:
+  add r6 8 r1
+  read 0 r1 r1
+  shiftl r2 5 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  xor r1 1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r3
+.L120:
+  load32 -1 r1
+  bne r3 r0 .L122
+  or r0 r1 r3
+  jump .L123
+.L122:
+  add r6 8 r1
+  read 0 r1 r1
+  shiftl r2 5 r2
+  add r1 r2 r1
+  add r1 16 r1
+  read 0 r1 r3
+.L123:
+  load 0 r1
+  blts r3 r0 .L125
+  add r4 40 r1
+  read 0 r1 r1
+  sltu r3 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L125:
+  bne r1 r0 .L130
+  load 0 r1
+.L127:
+  write -8 r14 r1
+  add r4 32 r2
+  read 0 r2 r2
+  bge r1 r2 .L147
+  or r0 r1 r2
+  addr2reg edge r12
+  read 0 r12 r1
+  shiftl r5 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  load 2 r3
+  add r3 r2 r2
+  load 12 r3
+  mults r2 r3 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump flowedge
+  read -8 r14 r1
+  read -16 r14 r5
+  read -4 r14 r4
+  add r1 1 r1
+  jump .L127
+.L130:
+  addr2reg edge r12
+  read 0 r12 r1
+  shiftl r5 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r4 36 r2
+  read 0 r2 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r3
+  load 2 r2
+  add r2 r3 r2
+  load 12 r3
+  mults r2 r3 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump flowedge
+  jump .L147
+.L131:
+  load 12 r2
+  beq r1 r2 .L138
+  load 12 r2
+  bge r1 r2 .L135
+  load 11 r2
+  beq r1 r2 .L137
+  load 11 r2
+  sltu r1 r2 r2
+.L135:
+  load 1 r2
+  sub r1 r2 r1
+  load 9 r2
+  ble r1 r2 .L147
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r5
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L147
+.L137:
+  addr2reg flowrk r12
+  read 0 r12 r1
+  addr2reg edge r12
+  read 0 r12 r2
+  shiftl r5 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 0 r2
+  add r2 8 r2
+  write 0 r2 r1
+  addr2reg edge r12
+  read 0 r12 r1
+  shiftl r5 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 0 r1
+  addr2reg flowrk r12
+  write 0 r12 r1
+  jump .L147
+.L138:
+  add r4 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump latval
+  or r0 r1 r2
+  read -12 r14 r6
+  read -16 r14 r5
+  load32 -1 r1
+  beq r2 r1 .L146
+  add r6 8 r1
+  read 0 r1 r1
+  shiftl r2 5 r2
+  add r1 r2 r4
+  load 0 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  read -16 r14 r5
+  bne r1 r0 .L143
+  addr2reg edge r12
+  read 0 r12 r1
+  shiftl r5 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 16 r1
+  read 0 r1 r1
+  bne r1 r0 .L142
+  load 154 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r5
+.L142:
+  addr2reg flowrk r12
+  read 0 r12 r1
+  addr2reg edge r12
+  read 0 r12 r2
+  shiftl r5 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 0 r2
+  add r2 8 r2
+  write 0 r2 r1
+  addr2reg edge r12
+  read 0 r12 r1
+  shiftl r5 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 0 r1
+  addr2reg flowrk r12
+  write 0 r12 r1
+  jump .L147
+.L143:
+  addr2reg edge r12
+  read 0 r12 r1
+  shiftl r5 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  bne r1 r0 .L145
+  load 149 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.18 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r5
+.L145:
+  addr2reg flowrk r12
+  read 0 r12 r1
+  addr2reg edge r12
+  read 0 r12 r2
+  shiftl r5 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 12 r2
+  add r2 8 r2
+  write 0 r2 r1
+  addr2reg edge r12
+  read 0 r12 r1
+  shiftl r5 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 12 r1
+  addr2reg flowrk r12
+  write 0 r12 r1
+  jump .L147
+.L146:
+  addr2reg flowrk r12
+  read 0 r12 r1
+  addr2reg edge r12
+  read 0 r12 r2
+  shiftl r5 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 12 r2
+  add r2 8 r2
+  write 0 r2 r1
+  addr2reg edge r12
+  read 0 r12 r2
+  shiftl r5 2 r1
+  add r2 r1 r1
+  read 0 r1 r1
+  add r1 12 r1
+  shiftl r5 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 0 r2
+  add r2 8 r2
+  write 0 r2 r1
+  addr2reg edge r12
+  read 0 r12 r1
+  shiftl r5 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 0 r1
+  addr2reg flowrk r12
+  write 0 r12 r1
+.L147:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function visitjmp */
+
+
+.text
+; function initedge
+initedge:
+  bne r5 r0 .L152
+  load32 -1 r1
+  write 0 r4 r1
+  jump .L153
+.L152:
+  add r5 48 r1
+  read 0 r1 r1
+  write 0 r4 r1
+.L153:
+  add r4 4 r2
+  load 1 r1
+  write 0 r2 r1
+  add r4 8 r2
+  load 0 r1
+  write 0 r2 r1
+  jumpr 0 r15
+
+/* end function initedge */
+
+
+.text
+; function renref
+renref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  read 0 r4 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r4
+  bne r1 r0 .L159
+  addr2reg val r12
+  read 0 r12 r1
+  read 0 r4 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  load32 -1 r2
+  bne r1 r2 .L160
+.L159:
+  load 0 r1
+  jump .L161
+.L160:
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 1 r1
+  write 0 r4 r1
+  load 1 r1
+.L161:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function renref */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "b->jmp.type != Jjmp || !edge[n][0].dead || flowrk == &edge[n][0]\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.24:
+	.ascii "\012> SCCP findings:\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "\012%10s: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "Top\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "\012 dead code: \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "%s \000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.29:
+	.ascii "(none)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "\012\012> After constant folding:\012\000"
+/* end data */
+
+
+.text
+; function fold
+.global fold
+fold:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 88 r13
+  write -64 r14 r4
+  add r4 16 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  read -64 r14 r4
+  addr2reg val r12
+  write 0 r12 r1
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  read -64 r14 r4
+  addr2reg edge r12
+  write 0 r12 r1
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  addr2reg nedge r12
+  write 0 r12 r1
+  load 0 r6
+  load 4 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -64 r14 r4
+  addr2reg usewrk r12
+  write 0 r12 r1
+  load 0 r1
+.L165:
+  add r4 16 r2
+  read 0 r2 r2
+  bges r1 r2 .L168
+  addr2reg val r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load 0 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L165
+.L168:
+  load 0 r1
+  or r0 r1 r3
+.L170:
+  write -52 r14 r3
+  add r4 28 r1
+  read 0 r1 r1
+  bge r3 r1 .L177
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -56 r14 r1
+  add r1 52 r4
+  load 0 r2
+  write 0 r4 r2
+  add r1 32 r1
+  read 0 r1 r2
+  load 2 r1
+  add r1 r2 r1
+  addr2reg nedge r12
+  read 0 r12 r2
+  shiftl r3 2 r4
+  add r2 r4 r2
+  write 0 r2 r1
+  addr2reg nedge r12
+  read 0 r12 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  load 12 r2
+  mults r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r2
+  read -52 r14 r3
+  read -56 r14 r1
+  addr2reg edge r12
+  read 0 r12 r4
+  shiftl r3 2 r5
+  add r4 r5 r4
+  write 0 r4 r2
+  addr2reg edge r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 0 r4
+  add r1 20 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump initedge
+  read -52 r14 r3
+  read -56 r14 r1
+  addr2reg edge r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 12 r4
+  add r1 24 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump initedge
+  read -52 r14 r3
+  read -56 r14 r1
+  load 0 r2
+.L172:
+  write -60 r14 r2
+  add r1 32 r4
+  read 0 r4 r4
+  bge r2 r4 .L175
+  or r0 r3 r4
+  addr2reg edge r12
+  read 0 r12 r3
+  shiftl r4 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  load 2 r4
+  add r4 r2 r4
+  load 12 r5
+  mults r4 r5 r4
+  add r3 r4 r4
+  add r1 28 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump initedge
+  read -60 r14 r2
+  read -52 r14 r3
+  read -56 r14 r1
+  add r2 1 r2
+  jump .L172
+.L175:
+  read -64 r14 r4
+  add r3 1 r3
+  jump .L170
+.L177:
+  read 0 r4 r5
+  add r14 -80 r4
+  savpc r15
+  add r15 12 r15
+  jump initedge
+  read -64 r14 r4
+  add r14 -80 r1
+  addr2reg flowrk r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg nuse r12
+  write 0 r12 r1
+.L178:
+  addr2reg flowrk r12
+  read 0 r12 r1
+  bne r1 r0 .L263
+  addr2reg nuse r12
+  read 0 r12 r2
+  beq r2 r0 .L197
+  addr2reg usewrk r12
+  read 0 r12 r1
+  load 1 r3
+  sub r2 r3 r2
+  addr2reg nuse r12
+  write 0 r12 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 4 r2
+  read 0 r2 r5
+  or r0 r1 r3
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r5 2 r2
+  add r1 r2 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  add r4 52 r2
+  read 0 r2 r2
+  beq r2 r0 .L196
+  read 0 r3 r2
+  load 2 r6
+  beq r2 r6 .L194
+  load 2 r6
+  blt r2 r6 .L188
+  load 3 r3
+  beq r2 r3 .L187
+  or r0 r2 r1
+  load 3 r2
+  sltu r1 r2 r1
+  jump .L191
+.L187:
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump visitjmp
+  read -64 r14 r4
+  jump .L178
+.L188:
+  or r0 r1 r4
+  or r0 r2 r1
+  or r0 r3 r2
+  load 1 r3
+  beq r1 r3 .L192
+  load 1 r2
+  sltu r1 r2 r1
+.L191:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r5
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -64 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L178
+.L192:
+  or r0 r2 r1
+  add r1 8 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump visitphi
+  read -64 r14 r4
+  jump .L178
+.L194:
+  or r0 r1 r4
+  or r0 r3 r1
+  add r1 8 r2
+  or r0 r4 r1
+  read 0 r2 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump visitins
+  read -64 r14 r4
+  jump .L178
+.L196:
+  or r0 r1 r4
+  jump .L178
+.L197:
+  addr2reg debug+70 r12
+  readb 0 r12 r1
+  beq r1 r0 .L206
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.24 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -64 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 32 r1
+.L199:
+  write -32 r14 r1
+  add r4 16 r2
+  read 0 r2 r2
+  bges r1 r2 .L205
+  addr2reg val r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  load32 -1 r3
+  beq r2 r3 .L204
+  or r0 r1 r2
+  add r4 4 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.25 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -64 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  or r0 r1 r2
+  addr2reg val r12
+  read 0 r12 r1
+  shiftl r2 2 r3
+  add r1 r3 r3
+  read 0 r3 r3
+  beq r3 r0 .L203
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 1 r1
+  write -68 r14 r1
+  addr2reg __stderr_file r6
+  or r0 r4 r5
+  read -68 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump printref
+  read -32 r14 r1
+  read -64 r14 r4
+  jump .L204
+.L203:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.26 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -32 r14 r1
+  read -64 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+.L204:
+  add r1 1 r1
+  jump .L199
+.L205:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.27 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -64 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L206:
+  load 0 r1
+  write -20 r14 r1
+.L208:
+  write -24 r14 r4
+  read 0 r4 r3
+  write -28 r14 r3
+  beq r3 r0 .L256
+  add r3 52 r1
+  read 0 r1 r1
+  beq r1 r0 .L252
+  or r0 r3 r1
+.L211:
+  read 0 r1 r2
+  write -12 r14 r2
+  beq r2 r0 .L222
+  addr2reg val r12
+  read 0 r12 r4
+  read 0 r2 r5
+  shiftr r5 3 r5
+  shiftl r5 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  load32 -1 r5
+  bne r4 r5 .L221
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L215:
+  write -16 r14 r2
+  add r1 12 r4
+  read 0 r4 r4
+  bge r2 r4 .L219
+  add r1 8 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r4
+  add r3 48 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump deadedge
+  or r0 r1 r4
+  read -16 r14 r2
+  read -12 r14 r1
+  read -28 r14 r3
+  bne r4 r0 .L218
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump renref
+  read -16 r14 r2
+  read -12 r14 r1
+  read -28 r14 r3
+.L218:
+  add r2 1 r2
+  jump .L215
+.L219:
+  or r0 r1 r2
+  add r2 20 r1
+  jump .L211
+.L221:
+  add r2 20 r2
+  read 0 r2 r2
+  write 0 r1 r2
+  jump .L211
+.L222:
+  add r3 4 r1
+  read 0 r1 r1
+.L223:
+  write -4 r14 r1
+  add r3 4 r2
+  read 0 r2 r2
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r2
+  bge r1 r2 .L235
+  add r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump renref
+  or r0 r1 r2
+  read -4 r14 r1
+  read -28 r14 r3
+  bne r2 r0 .L233
+  load 0 r2
+.L226:
+  write -8 r14 r2
+  load 2 r3
+  bge r2 r3 .L229
+  add r1 8 r1
+  shiftl r2 2 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump renref
+  read -8 r14 r2
+  read -4 r14 r1
+  add r2 1 r2
+  jump .L226
+.L229:
+  read -28 r14 r3
+  read 0 r1 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 53 r4
+  sub r2 r4 r2
+  load 5 r4
+  bgt r2 r4 .L234
+  add r1 8 r1
+  add r1 0 r1
+  load 1 r2
+  write -68 r14 r2
+  read -68 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -4 r14 r1
+  read -28 r14 r3
+  beq r2 r0 .L234
+  load 90 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r4
+  write 0 r2 r4
+  add r2 4 r2
+  load 0 r4
+  write 0 r2 r4
+  add r2 4 r4
+  load 0 r2
+  write 0 r4 r2
+  jump .L234
+.L233:
+  load 90 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r4
+  write 0 r2 r4
+  add r2 4 r2
+  load 0 r4
+  write 0 r2 r4
+  add r2 4 r4
+  load 0 r2
+  write 0 r4 r2
+.L234:
+  add r1 16 r1
+  jump .L223
+.L235:
+  read -28 r14 r3
+  add r3 12 r1
+  add r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump renref
+  read -20 r14 r2
+  read -28 r14 r3
+  read -64 r14 r4
+  add r3 12 r1
+  readh 0 r1 r5
+  load 0 r1
+  load 12 r6
+  bne r5 r6 .L238
+  add r3 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -20 r14 r2
+  read -28 r14 r3
+  read -64 r14 r4
+  xor r1 1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L238:
+  beq r1 r0 .L243
+  add r4 8 r1
+  read 0 r1 r1
+  add r3 12 r2
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r4
+  load 0 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  read -28 r14 r3
+  bne r1 r0 .L241
+  add r3 24 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump edgedel
+  read -20 r14 r2
+  read -28 r14 r3
+  read -64 r14 r4
+  jump .L242
+.L241:
+  add r3 20 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump edgedel
+  read -20 r14 r2
+  read -28 r14 r3
+  read -64 r14 r4
+  add r3 24 r1
+  read 0 r1 r1
+  add r3 20 r5
+  write 0 r5 r1
+  add r3 24 r5
+  load 0 r1
+  write 0 r5 r1
+.L242:
+  add r3 12 r5
+  load 11 r1
+  writeh 0 r5 r1
+  add r3 12 r1
+  add r1 4 r5
+  load 0 r1
+  write 0 r5 r1
+.L243:
+  add r3 12 r1
+  readh 0 r1 r5
+  load 0 r1
+  load 32 r6
+  bne r5 r6 .L245
+  add r3 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -20 r14 r2
+  read -28 r14 r3
+  read -64 r14 r4
+  xor r1 1 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L245:
+  beq r1 r0 .L251
+  add r4 8 r1
+  read 0 r1 r5
+  add r3 12 r1
+  add r1 4 r1
+  read 0 r1 r6
+  shiftr r6 3 r1
+  shiftl r1 5 r1
+  add r5 r1 r1
+  add r1 16 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r6 3 r6
+  shiftl r6 5 r6
+  add r5 r6 r5
+  read 0 r5 r6
+  load 0 r5
+  load 1 r7
+  bne r6 r7 .L248
+  add r3 40 r5
+  read 0 r5 r5
+  sltu r1 r5 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L248:
+  beq r5 r0 .L251
+  or r0 r1 r4
+  add r3 28 r1
+  read 0 r1 r1
+  add r3 36 r2
+  read 0 r2 r2
+  shiftl r4 2 r4
+  add r2 r4 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  add r3 20 r1
+  write 0 r1 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump jtabdel
+  read -20 r14 r2
+  read -28 r14 r3
+  read -64 r14 r4
+  add r3 12 r5
+  load 11 r1
+  writeh 0 r5 r1
+  add r3 12 r1
+  add r1 4 r5
+  load 0 r1
+  write 0 r5 r1
+.L251:
+  add r3 44 r1
+  jump .L255
+.L252:
+  addr2reg debug+70 r12
+  readb 0 r12 r1
+  beq r1 r0 .L254
+  add r3 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.28 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -28 r14 r3
+  load32 -24 r1
+  sub r13 r1 r13
+.L254:
+  add r3 20 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump edgedel
+  read -28 r14 r3
+  add r3 24 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump edgedel
+  read -28 r14 r3
+  load 0 r5
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump jtabdel
+  read -24 r14 r4
+  read -28 r14 r3
+  or r0 r4 r1
+  read -64 r14 r4
+  add r3 44 r2
+  read 0 r2 r2
+  write 0 r1 r2
+  load 1 r2
+.L255:
+  or r0 r1 r4
+  write -20 r14 r2
+  jump .L208
+.L256:
+  read -20 r14 r2
+  addr2reg debug+70 r12
+  readb 0 r12 r1
+  beq r1 r0 .L261
+  bne r2 r0 .L260
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.29 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+.L260:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.30 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -64 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+.L261:
+  addr2reg val r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  addr2reg edge r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  addr2reg nedge r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  addr2reg usewrk r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L263:
+  add r1 8 r2
+  read 0 r2 r2
+  addr2reg flowrk r12
+  write 0 r12 r2
+  add r1 8 r3
+  load 0 r2
+  write 0 r3 r2
+  read 0 r1 r3
+  write -40 r14 r3
+  load 1 r2
+  load32 -1 r5
+  beq r3 r5 .L265
+  add r1 4 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L265:
+  bne r2 r0 .L178
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -48 r14 r1
+  read 0 r1 r1
+  or r0 r3 r2
+.L268:
+  write -44 r14 r1
+  beq r1 r0 .L271
+  or r0 r4 r6
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump visitphi
+  read -44 r14 r1
+  read -40 r14 r2
+  read -64 r14 r4
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L268
+.L271:
+  read -48 r14 r1
+  or r0 r2 r3
+  add r1 52 r2
+  read 0 r2 r2
+  bne r2 r0 .L279
+  add r1 4 r2
+  read 0 r2 r2
+.L274:
+  write -36 r14 r2
+  or r0 r1 r3
+  add r1 4 r1
+  read 0 r1 r1
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r1 r3 r1
+  bge r2 r1 .L277
+  or r0 r4 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump visitins
+  read -36 r14 r2
+  read -48 r14 r1
+  read -64 r14 r4
+  add r2 16 r2
+  jump .L274
+.L277:
+  read -48 r14 r1
+  read -40 r14 r3
+  or r0 r4 r6
+  or r0 r3 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump visitjmp
+  read -48 r14 r1
+  read -40 r14 r3
+  read -64 r14 r4
+.L279:
+  add r1 52 r5
+  read 0 r5 r2
+  add r2 1 r2
+  write 0 r5 r2
+  add r1 12 r1
+  readh 0 r1 r2
+  load 1 r1
+  load 11 r5
+  bne r2 r5 .L281
+  addr2reg edge r12
+  read 0 r12 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L282
+.L281:
+  or r0 r1 r2
+.L282:
+  load 1 r1
+  bne r2 r0 .L284
+  addr2reg flowrk r12
+  read 0 r12 r1
+  addr2reg edge r12
+  read 0 r12 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L284:
+  bne r1 r0 .L178
+  load 259 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.23 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -64 r14 r4
+  jump .L178
+
+/* end function fold */
+
+
+.text
+; function foldint
+foldint:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 116 r13
+  write -108 r14 r8
+  read 8 r14 r1
+  write -40 r14 r1
+  write -60 r14 r7
+  write -68 r14 r6
+  write -48 r14 r5
+  write -76 r14 r4
+  load 8 r6
+  load 0 r5
+  add r14 -88 r4
+  savpc r15
+  add r15 12 r15
+  jump memset
+  read -40 r14 r4
+  read -60 r14 r3
+  read -68 r14 r1
+  or r0 r4 r7
+  read -48 r14 r4
+  add r3 16 r2
+  read 0 r2 r2
+  write -56 r14 r2
+  or r0 r3 r8
+  add r7 16 r3
+  read 0 r3 r3
+  write -52 r14 r3
+  load 1 r5
+  beq r4 r5 .L305
+  load 2 r5
+  beq r4 r5 .L295
+  read 0 r8 r5
+  load 1 r6
+  write -12 r14 r6
+  load 2 r6
+  xor r5 r6 r6
+  sltu r6 1 r6
+  read -12 r14 r5
+  bne r6 r0 .L292
+  read 0 r7 r5
+  xor r5 2 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L292:
+  bne r5 r0 .L294
+  load 1 r5
+  jump .L310
+.L294:
+  load 1 r1
+  jump .L402
+.L295:
+  read 0 r8 r5
+  load 2 r6
+  xor r5 r6 r5
+  sltu r5 1 r5
+  read -40 r14 r7
+  bne r5 r0 .L299
+  read 0 r7 r5
+  load 2 r6
+  beq r5 r6 .L298
+  load 1 r5
+  jump .L310
+.L298:
+  load 1 r1
+  jump .L402
+.L299:
+  read 0 r7 r5
+  load 2 r6
+  xor r5 r6 r5
+  sltu r0 r5 r5
+  read -40 r14 r7
+  bne r5 r0 .L304
+  or r0 r7 r4
+  add r8 4 r1
+  add r4 4 r2
+  add r14 -96 r5
+  add r2 0 r3
+  read 0 r3 r3
+  add r14 -96 r4
+  add r4 0 r4
+  write 0 r4 r3
+  add r2 4 r2
+  read 0 r2 r2
+  add r14 -96 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r14 -104 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -104 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -104 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump symeq
+  or r0 r1 r5
+  read -52 r14 r3
+  read -56 r14 r2
+  read -40 r14 r4
+  read -68 r14 r1
+  or r0 r4 r7
+  read -48 r14 r4
+  beq r5 r0 .L303
+  load 1 r5
+  jump .L310
+.L303:
+  load 1 r1
+  jump .L402
+.L304:
+  add r8 4 r5
+  read 0 r5 r6
+  write -88 r14 r6
+  add r5 4 r5
+  add r14 -88 r6
+  add r6 4 r6
+  read 0 r5 r5
+  write 0 r6 r5
+  load 2 r5
+  jump .L310
+.L305:
+  read 0 r8 r5
+  load 2 r6
+  xor r5 r6 r5
+  sltu r5 1 r5
+  read -40 r14 r7
+  bne r5 r0 .L308
+  read 0 r7 r5
+  load 1 r6
+  write -16 r14 r6
+  load 2 r6
+  xor r5 r6 r6
+  sltu r6 1 r6
+  read -16 r14 r5
+  beq r6 r0 .L310
+  add r7 4 r5
+  read 0 r5 r6
+  write -88 r14 r6
+  add r5 4 r5
+  add r14 -88 r6
+  add r6 4 r6
+  read 0 r5 r5
+  write 0 r6 r5
+  load 2 r5
+  jump .L310
+.L308:
+  read 0 r7 r5
+  load 2 r6
+  xor r5 r6 r5
+  sltu r5 1 r5
+  read -40 r14 r7
+  bne r5 r0 .L401
+  add r8 4 r5
+  read 0 r5 r6
+  write -88 r14 r6
+  add r5 4 r5
+  add r14 -88 r6
+  add r6 4 r6
+  read 0 r5 r5
+  write 0 r6 r5
+  load 2 r5
+.L310:
+  write -80 r14 r5
+  load 1 r6
+  write -20 r14 r6
+  load 4 r6
+  xor r4 r6 r8
+  sltu r8 1 r8
+  read -20 r14 r6
+  bne r8 r0 .L313
+  xor r4 5 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r8
+  write -24 r14 r8
+  jump .L314
+.L313:
+  write -24 r14 r6
+.L314:
+  load 1 r6
+  write -28 r14 r6
+  read -24 r14 r8
+  read -28 r14 r6
+  bne r8 r0 .L317
+  xor r4 6 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r8
+  write -32 r14 r8
+  jump .L318
+.L317:
+  write -32 r14 r6
+.L318:
+  load 1 r6
+  write -36 r14 r6
+  read -32 r14 r8
+  read -36 r14 r6
+  bne r8 r0 .L320
+  xor r4 7 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L320:
+  beq r6 r0 .L331
+  or r0 r7 r4
+  load 0 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  or r0 r1 r6
+  read -80 r14 r5
+  read -52 r14 r3
+  read -56 r14 r2
+  read -40 r14 r4
+  read -68 r14 r1
+  or r0 r4 r7
+  read -48 r14 r4
+  bne r6 r0 .L400
+  load 1 r6
+  write -44 r14 r6
+  load 4 r6
+  xor r4 r6 r8
+  sltu r8 1 r8
+  read -44 r14 r6
+  bne r8 r0 .L325
+  xor r4 5 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L325:
+  beq r6 r0 .L331
+  or r0 r7 r4
+  load32 -1 r6
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  or r0 r1 r6
+  read -80 r14 r5
+  read -52 r14 r3
+  read -56 r14 r2
+  read -60 r14 r7
+  read -68 r14 r4
+  or r0 r4 r1
+  read -48 r14 r4
+  beq r6 r0 .L331
+  or r0 r1 r4
+  load32 -2147483648 r6
+  or r0 r4 r5
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  read -80 r14 r5
+  read -52 r14 r3
+  read -56 r14 r2
+  read -48 r14 r4
+  bne r1 r0 .L399
+.L331:
+  load 66 r1
+  blt r4 r1 .L344
+  load 66 r1
+  sub r4 r1 r1
+  load 17 r6
+  sltu r1 r6 r6
+  write -64 r14 r6
+  read -60 r14 r7
+  or r0 r1 r6
+  read -76 r14 r1
+  read -64 r14 r12
+  beq r12 r0 .L367
+  or r0 r6 r1
+  shiftl r1 2 r6
+  addr2reg .Ljt334 r1
+  add r1 r6 r6
+  read -76 r14 r1
+  read 0 r6 r6
+  jumpr 0 r6
+.L335:
+  shiftl r2 24 r2
+  shiftrs r2 24 r2
+  jump .L398
+.L336:
+  and r2 0xFF r2
+  jump .L398
+.L337:
+  shiftl r2 16 r2
+  shiftrs r2 16 r2
+  jump .L398
+.L338:
+  shiftl r2 16 r2
+  shiftr r2 16 r2
+  jump .L398
+.L339:
+  load 0 r2
+  jump .L398
+.L340:
+  or r0 r7 r3
+  read 0 r3 r4
+  load 2 r6
+  bne r4 r6 .L398
+  add r3 4 r3
+  read 0 r3 r4
+  write -88 r14 r4
+  add r3 4 r3
+  add r14 -88 r4
+  add r4 4 r4
+  read 0 r3 r3
+  write 0 r4 r3
+  load 2 r3
+  or r0 r3 r5
+  jump .L398
+.L344:
+  load 1 r1
+  sub r4 r1 r1
+  load 16 r6
+  sltu r1 r6 r6
+  write -72 r14 r6
+  read -68 r14 r7
+  or r0 r1 r6
+  read -76 r14 r1
+  read -72 r14 r12
+  beq r12 r0 .L367
+  or r0 r6 r1
+  shiftl r1 2 r6
+  addr2reg .Ljt346 r1
+  add r1 r6 r6
+  read -76 r14 r1
+  read 0 r6 r6
+  jumpr 0 r6
+.L347:
+  add r2 r3 r2
+  jump .L398
+.L348:
+  sub r2 r3 r2
+  jump .L398
+.L349:
+  sub r0 r2 r2
+  jump .L398
+.L350:
+  or r0 r7 r4
+  bne r4 r0 .L353
+  divs r2 r3 r2
+  jump .L398
+.L353:
+  divs r2 r3 r2
+  jump .L398
+.L354:
+  or r0 r7 r4
+  bne r4 r0 .L357
+  mods r2 r3 r2
+  jump .L398
+.L357:
+  mods r2 r3 r2
+  jump .L398
+.L358:
+  or r0 r7 r4
+  bne r4 r0 .L361
+  divu r2 r3 r2
+  jump .L398
+.L361:
+  divu r2 r3 r2
+  jump .L398
+.L362:
+  or r0 r7 r4
+  bne r4 r0 .L365
+  modu r2 r3 r2
+  jump .L398
+.L365:
+  modu r2 r3 r2
+  jump .L398
+.L366:
+  mults r2 r3 r2
+  jump .L398
+.L367:
+  load 0 r6
+  load 17 r7
+  bgts r7 r4 .L369
+  load 36 r6
+  slt r6 r4 r6
+  xor r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L369:
+  bne r6 r0 .L371
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r5
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -80 r14 r5
+  read -76 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  load32 -2147483648 r2
+  jump .L398
+.L371:
+  load 26 r6
+  bles r4 r6 .L373
+  load 10 r6
+  sub r4 r6 r4
+.L373:
+  load 17 r6
+  sub r4 r6 r4
+  load 10 r6
+  blt r4 r6 .L376
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r5
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -80 r14 r5
+  read -76 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+  load32 -2147483648 r2
+  jump .L398
+.L376:
+  shiftl r4 2 r6
+  addr2reg .Ljt376 r4
+  add r4 r6 r4
+  read 0 r4 r4
+  jumpr 0 r4
+.L377:
+  xor r2 r3 r2
+  sltu r2 1 r2
+  jump .L398
+.L378:
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  jump .L398
+.L379:
+  slt r2 r3 r2
+  xor r2 1 r2
+  jump .L398
+.L380:
+  slt r3 r2 r2
+  jump .L398
+.L381:
+  slt r3 r2 r2
+  xor r2 1 r2
+  jump .L398
+.L382:
+  slt r2 r3 r2
+  jump .L398
+.L383:
+  sltu r2 r3 r2
+  xor r2 1 r2
+  jump .L398
+.L384:
+  sltu r3 r2 r2
+  jump .L398
+.L385:
+  sltu r3 r2 r2
+  xor r2 1 r2
+  jump .L398
+.L386:
+  sltu r2 r3 r2
+  jump .L398
+.L387:
+  and r2 r3 r2
+  jump .L398
+.L388:
+  or r2 r3 r2
+  jump .L398
+.L389:
+  xor r2 r3 r2
+  jump .L398
+.L390:
+  or r0 r7 r4
+  shiftl r4 5 r6
+  load 31 r4
+  or r4 r6 r4
+  and r3 r4 r3
+  shiftrs r2 r3 r2
+  jump .L398
+.L393:
+  or r0 r7 r4
+  shiftl r4 5 r6
+  load 31 r4
+  or r4 r6 r4
+  and r3 r4 r3
+  shiftr r2 r3 r2
+  jump .L398
+.L396:
+  or r0 r7 r4
+  shiftl r4 5 r6
+  load 31 r4
+  or r4 r6 r4
+  and r3 r4 r3
+  shiftl r2 r3 r2
+.L398:
+  read -88 r14 r4
+  add r14 -88 r3
+  add r3 4 r3
+  read 0 r3 r3
+  write 0 r1 r5
+  add r1 4 r1
+  write 0 r1 r4
+  add r1 4 r1
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r1
+  jump .L402
+.L399:
+  load 1 r1
+  jump .L402
+.L400:
+  load 1 r1
+  jump .L402
+.L401:
+  load 1 r1
+.L402:
+  read -108 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt334:
+  .int .L335
+  .int .L336
+  .int .L337
+  .int .L338
+  .int .L398
+  .int .L398
+  .int .L367
+  .int .L367
+  .int .L339
+  .int .L339
+  .int .L339
+  .int .L339
+  .int .L367
+  .int .L367
+  .int .L367
+  .int .L367
+  .int .L340
+
+.rdata
+.balign 4
+.Ljt346:
+  .int .L347
+  .int .L348
+  .int .L349
+  .int .L350
+  .int .L354
+  .int .L358
+  .int .L362
+  .int .L366
+  .int .L367
+  .int .L367
+  .int .L387
+  .int .L388
+  .int .L389
+  .int .L390
+  .int .L393
+  .int .L396
+
+.rdata
+.balign 4
+.Ljt376:
+  .int .L377
+  .int .L378
+  .int .L379
+  .int .L380
+  .int .L381
+  .int .L382
+  .int .L383
+  .int .L384
+  .int .L385
+  .int .L386
+
+/* end function foldint */
+
+
+.text
+; function foldflt
+foldflt:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r6
+  or r0 r4 r2
+  write -16 r14 r2
+  load 1 r1
+  write 0 r2 r1
+  add r2 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r3
+  load 0 r1
+  write 0 r3 r1
+  add r2 16 r4
+  load 8 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  read -12 r14 r1
+  read -16 r14 r2
+  bne r1 r0 .L407
+  load 1 r1
+  jump .L408
+.L407:
+  load 2 r1
+.L408:
+  add r2 24 r2
+  writeb 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function foldflt */
+
+.data
+.balign 1
+.Lstring.34:
+	.ascii "!(cls == Ks || cls == Kd) || c.flt\000"
+/* end data */
+
+
+.text
+; function opfold
+opfold:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 60 r13
+  read 8 r14 r1
+  write -8 r14 r1
+  or r0 r7 r1
+  or r0 r6 r7
+  or r0 r5 r2
+  or r0 r4 r5
+  write -12 r14 r2
+  load 1 r3
+  beq r2 r0 .L414
+  xor r2 1 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L414:
+  bne r3 r0 .L416
+  xor r2 3 r2
+  sltu r2 1 r6
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump foldflt
+  read -8 r14 r5
+  read -12 r14 r2
+  load32 -12 r1
+  sub r13 r1 r13
+  jump .L417
+.L416:
+  xor r2 1 r2
+  sltu r2 1 r6
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump foldint
+  read -8 r14 r5
+  read -12 r14 r2
+  load32 -12 r3
+  sub r13 r3 r13
+  bne r1 r0 .L426
+.L417:
+  and r2 1 r1
+  bne r1 r0 .L419
+  add r14 -48 r1
+  add r1 16 r2
+  read 0 r2 r1
+  load32 -1 r3
+  and r1 r3 r1
+  write 0 r2 r1
+.L419:
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump newcon
+  read -12 r14 r2
+  write -52 r14 r1
+  read -52 r14 r1
+  write -16 r14 r1
+  load 1 r3
+  load 2 r4
+  beq r2 r4 .L421
+  xor r2 3 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L421:
+  load 1 r2
+  beq r3 r0 .L423
+  add r14 -48 r2
+  add r2 24 r2
+  readb 0 r2 r2
+  and r2 0xFF r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L423:
+  bne r2 r0 .L425
+  load 590 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.34 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r1
+.L425:
+  shiftr r1 3 r1
+  jump .L427
+.L426:
+  load32 -1 r1
+.L427:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function opfold */
+
+.data
+.balign 4
+val:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+flowrk:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+edge:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+nedge:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+usewrk:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+nuse:
+	.fill 4,1,0
+/* end data */
+
@@ -0,0 +1,3863 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+
+.text
+; function refadd
+refadd:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  addr2reg nref r12
+  read 0 r12 r1
+  add r1 1 r1
+  shiftl r1 1 r1
+  addr2reg nrefh r12
+  read 0 r12 r3
+  write -4 r14 r3
+  ble r1 r3 .L29
+  addr2reg refh r12
+  read 0 r12 r4
+  write -8 r14 r4
+  bne r3 r0 .L20
+  load 256 r1
+  jump .L21
+.L20:
+  shiftl r3 1 r1
+.L21:
+  addr2reg nrefh r12
+  write 0 r12 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  read -8 r14 r4
+  read -4 r14 r3
+  addr2reg refh r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg nref r12
+  write 0 r12 r1
+  load 0 r1
+  or r0 r1 r2
+  or r0 r4 r1
+.L23:
+  write -12 r14 r2
+  bge r2 r3 .L27
+  shiftl r2 2 r4
+  add r1 r4 r4
+  read 0 r4 r4
+  beq r4 r0 .L26
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  load 1 r2
+  sub r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump refadd
+  read -12 r14 r2
+  read -8 r14 r1
+  read -4 r14 r3
+.L26:
+  add r2 1 r2
+  jump .L23
+.L27:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r4
+.L29:
+  load32 -1640531535 r1
+  mults r4 r1 r1
+.L30:
+  addr2reg nrefh r12
+  read 0 r12 r2
+  load 1 r3
+  sub r2 r3 r2
+  and r1 r2 r1
+  addr2reg refh r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  read 0 r3 r3
+  add r4 1 r5
+  beq r3 r5 .L35
+  shiftl r1 2 r3
+  add r2 r3 r3
+  read 0 r3 r3
+  beq r3 r0 .L33
+  add r1 1 r1
+  jump .L30
+.L33:
+  or r0 r1 r3
+  add r4 1 r1
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  addr2reg nref r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg nref r12
+  write 0 r12 r1
+.L35:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function refadd */
+
+
+.text
+; function refhas
+refhas:
+  addr2reg nrefh r12
+  read 0 r12 r2
+  beq r2 r0 .L45
+  load32 -1640531535 r1
+  mults r4 r1 r1
+.L40:
+  load 1 r3
+  sub r2 r3 r3
+  and r1 r3 r1
+  addr2reg refh r12
+  read 0 r12 r3
+  shiftl r1 2 r5
+  add r3 r5 r5
+  read 0 r5 r5
+  add r4 1 r6
+  beq r5 r6 .L44
+  shiftl r1 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  beq r3 r0 .L43
+  add r1 1 r1
+  jump .L40
+.L43:
+  load 0 r1
+  jump .L46
+.L44:
+  load 1 r1
+  jump .L46
+.L45:
+  load 0 r1
+.L46:
+  jumpr 0 r15
+
+/* end function refhas */
+
+
+.text
+; function inlref
+.global inlref
+inlref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  savpc r15
+  add r15 12 r15
+  jump intern
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump refadd
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function inlref */
+
+
+.text
+; function refarg
+refarg:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -16 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r5
+  load 1 r2
+  bne r1 r2 .L56
+  add r5 8 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  read 0 r1 r2
+  load 2 r3
+  bne r2 r3 .L56
+  add r1 4 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump refadd
+.L56:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function refarg */
+
+
+.text
+; function refs
+refs:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -20 r14 r4
+  read 0 r4 r1
+.L60:
+  write -32 r14 r1
+  beq r1 r0 .L76
+  read 0 r1 r1
+.L62:
+  write -24 r14 r1
+  beq r1 r0 .L68
+  load 0 r2
+.L64:
+  write -28 r14 r2
+  add r1 12 r3
+  read 0 r3 r3
+  bge r2 r3 .L67
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump refarg
+  read -28 r14 r2
+  read -24 r14 r1
+  read -20 r14 r4
+  add r2 1 r2
+  jump .L64
+.L67:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L62
+.L68:
+  read -32 r14 r1
+  add r1 4 r2
+  read 0 r2 r2
+.L70:
+  write -16 r14 r2
+  or r0 r1 r3
+  add r1 4 r1
+  read 0 r1 r1
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r1 r3 r1
+  bge r2 r1 .L73
+  add r2 8 r1
+  add r1 0 r1
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump refarg
+  read -16 r14 r2
+  read -20 r14 r4
+  add r2 8 r1
+  add r1 4 r1
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump refarg
+  read -16 r14 r2
+  read -32 r14 r1
+  read -20 r14 r4
+  add r2 16 r2
+  jump .L70
+.L73:
+  read -32 r14 r1
+  add r1 12 r1
+  add r1 4 r1
+  or r0 r4 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump refarg
+  read -32 r14 r1
+  read -20 r14 r4
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L60
+.L76:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function refs */
+
+
+.text
+; function cost
+cost:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -12 r14 r4
+  add r4 16 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r2
+  read -12 r14 r4
+  write -20 r14 r2
+  read 0 r4 r1
+  add r1 4 r1
+  read 0 r1 r1
+.L80:
+  read 0 r4 r3
+  add r3 4 r5
+  read 0 r5 r5
+  add r3 8 r6
+  read 0 r6 r6
+  shiftl r6 4 r6
+  add r5 r6 r5
+  bge r1 r5 .L84
+  read 0 r1 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 83 r5
+  sub r3 r5 r3
+  load 2 r5
+  bgt r3 r5 .L83
+  add r1 4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  add r2 r3 r5
+  load 1 r3
+  writeb 0 r5 r3
+.L83:
+  add r1 16 r1
+  jump .L80
+.L84:
+  load 0 r1
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L86:
+  write -24 r14 r1
+  beq r1 r0 .L122
+  read 0 r1 r4
+.L88:
+  beq r4 r0 .L91
+  add r3 1 r3
+  add r4 20 r4
+  read 0 r4 r4
+  jump .L88
+.L91:
+  add r1 4 r4
+  read 0 r4 r4
+.L92:
+  write -32 r14 r4
+  write -28 r14 r3
+  add r1 4 r5
+  read 0 r5 r5
+  add r1 8 r6
+  read 0 r6 r6
+  shiftl r6 4 r6
+  add r5 r6 r5
+  bge r4 r5 .L116
+  read 0 r4 r5
+  shiftl r5 2 r6
+  shiftr r6 2 r6
+  load 109 r7
+  sub r6 r7 r6
+  load 1 r7
+  write -16 r14 r7
+  load 6 r7
+  sltu r7 r6 r7
+  xor r7 1 r7
+  read -16 r14 r6
+  bne r7 r0 .L95
+  shiftl r5 2 r6
+  shiftr r6 2 r6
+  load 83 r7
+  sub r6 r7 r7
+  load 2 r6
+  sltu r6 r7 r6
+  xor r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r7
+  jump .L96
+.L95:
+  or r0 r6 r7
+.L96:
+  load 1 r6
+  bne r7 r0 .L98
+  shiftl r5 2 r6
+  shiftr r6 2 r6
+  xor r6 89 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r7
+  jump .L99
+.L98:
+  or r0 r6 r7
+.L99:
+  load 1 r6
+  bne r7 r0 .L101
+  shiftl r5 2 r6
+  shiftr r6 2 r6
+  xor r6 90 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L101:
+  bne r6 r0 .L115
+  shiftl r5 2 r5
+  shiftr r5 2 r5
+  load 59 r6
+  sub r5 r6 r6
+  load 0 r5
+  load 6 r7
+  ble r6 r7 .L104
+  or r0 r5 r6
+  jump .L105
+.L104:
+  add r4 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r5
+  read -32 r14 r4
+  read -28 r14 r3
+  read -24 r14 r1
+  read -20 r14 r2
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r6
+.L105:
+  load 0 r5
+  beq r6 r0 .L107
+  add r4 8 r5
+  add r5 0 r5
+  read 0 r5 r5
+  shiftr r5 3 r5
+  add r2 r5 r5
+  readb 0 r5 r5
+  and r5 0xFF r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L107:
+  bne r5 r0 .L115
+  read 0 r4 r5
+  shiftl r5 2 r5
+  shiftr r5 2 r5
+  load 53 r6
+  sub r5 r6 r6
+  load 0 r5
+  load 5 r7
+  ble r6 r7 .L110
+  or r0 r5 r6
+  jump .L111
+.L110:
+  add r4 8 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r5
+  read -32 r14 r4
+  read -28 r14 r3
+  read -24 r14 r1
+  read -20 r14 r2
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r6
+.L111:
+  load 0 r5
+  beq r6 r0 .L113
+  add r4 8 r5
+  add r5 4 r5
+  read 0 r5 r5
+  shiftr r5 3 r5
+  add r2 r5 r5
+  readb 0 r5 r5
+  and r5 0xFF r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L113:
+  bne r5 r0 .L115
+  add r3 1 r3
+.L115:
+  add r4 16 r4
+  jump .L92
+.L116:
+  add r1 12 r4
+  readh 0 r4 r4
+  load 0 r5
+  load 11 r6
+  bne r4 r6 .L118
+  or r0 r5 r4
+  jump .L119
+.L118:
+  load 1 r5
+  sub r4 r5 r5
+  load 9 r4
+  sltu r4 r5 r4
+  xor r4 1 r4
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L119:
+  beq r4 r0 .L121
+  add r3 1 r3
+.L121:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L86
+.L122:
+  or r0 r3 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function cost */
+
+
+.text
+; function inlinable
+inlinable:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r4
+  add r4 52 r1
+  readb 0 r1 r2
+  load 1 r1
+  bne r2 r0 .L128
+  add r4 32 r1
+  read 0 r1 r1
+  slt r1 r0 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L129
+.L128:
+  or r0 r1 r2
+.L129:
+  load 1 r1
+  bne r2 r0 .L131
+  read 0 r4 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L131:
+  bne r1 r0 .L156
+  read 0 r4 r1
+.L133:
+  write -12 r14 r1
+  beq r1 r0 .L155
+  add r1 12 r2
+  readh 0 r2 r2
+  load 9 r3
+  beq r2 r3 .L154
+  add r1 4 r2
+  read 0 r2 r2
+.L136:
+  write -16 r14 r2
+  add r1 4 r3
+  read 0 r3 r3
+  add r1 8 r5
+  read 0 r5 r5
+  shiftl r5 4 r5
+  add r3 r5 r3
+  bge r2 r3 .L153
+  read 0 r2 r3
+  shiftl r3 2 r5
+  shiftr r5 2 r5
+  load 114 r6
+  beq r5 r6 .L152
+  load 114 r6
+  blt r5 r6 .L142
+  load 115 r6
+  beq r5 r6 .L152
+  load 115 r6
+  sltu r5 r6 r5
+  jump .L146
+.L142:
+  load 87 r6
+  beq r5 r6 .L152
+  load 87 r6
+  bge r5 r6 .L146
+  load 86 r6
+  beq r5 r6 .L152
+  load 86 r6
+  sltu r5 r6 r5
+.L146:
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 83 r5
+  sub r3 r5 r3
+  load 2 r5
+  bgt r3 r5 .L150
+  read 0 r4 r5
+  load 1 r3
+  bne r1 r5 .L149
+  add r2 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -16 r14 r2
+  read -12 r14 r1
+  read -8 r14 r4
+  xor r3 1 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L149:
+  bne r3 r0 .L151
+.L150:
+  add r2 16 r2
+  jump .L136
+.L151:
+  load 0 r1
+  jump .L157
+.L152:
+  load 0 r1
+  jump .L157
+.L153:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L133
+.L154:
+  load 0 r1
+  jump .L157
+.L155:
+  load 1 r1
+  jump .L157
+.L156:
+  load 0 r1
+.L157:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function inlinable */
+
+
+.text
+; function insdup
+insdup:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r5 r2
+  write -8 r14 r4
+  write -12 r14 r2
+  shiftl r2 4 r1
+  add r1 1 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r6
+  read -12 r14 r2
+  read -8 r14 r5
+  write -16 r14 r1
+  beq r2 r0 .L162
+  shiftl r2 4 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -16 r14 r1
+.L162:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function insdup */
+
+
+.text
+; function saveblks
+saveblks:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  or r0 r4 r2
+  write -4 r14 r2
+  add r2 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r4
+  read -4 r14 r2
+  write -8 r14 r4
+  read 0 r2 r3
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L167:
+  beq r3 r0 .L170
+  or r0 r2 r5
+  add r2 1 r2
+  add r3 48 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r4 r6 r6
+  write 0 r6 r5
+  add r3 44 r3
+  read 0 r3 r3
+  jump .L167
+.L170:
+  load 204 r1
+  mults r2 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  read -8 r14 r4
+  read -4 r14 r2
+  write -20 r14 r1
+  read 0 r2 r2
+  or r0 r1 r5
+  or r0 r2 r1
+.L172:
+  write -28 r14 r1
+  beq r1 r0 .L218
+  bne r1 r0 .L176
+  load 0 r2
+  or r0 r2 r3
+  jump .L177
+.L176:
+  add r1 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r4 r2 r2
+  read 0 r2 r2
+  load 204 r3
+  mults r2 r3 r2
+  add r5 r2 r3
+.L177:
+  write -32 r14 r3
+  add r3 124 r4
+  add r1 124 r5
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  read -28 r14 r1
+  read -32 r14 r3
+  read -8 r14 r4
+  add r1 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r4 r2 r2
+  read 0 r2 r2
+  add r3 48 r3
+  write 0 r3 r2
+  add r1 4 r2
+  read 0 r2 r4
+  add r1 8 r1
+  read 0 r1 r5
+  addr2reg emalloc r6
+  savpc r15
+  add r15 12 r15
+  jump insdup
+  or r0 r1 r2
+  read -28 r14 r1
+  read -32 r14 r3
+  read -20 r14 r5
+  read -8 r14 r4
+  add r3 4 r6
+  write 0 r6 r2
+  add r1 8 r2
+  read 0 r2 r2
+  add r3 8 r6
+  write 0 r6 r2
+  add r1 12 r2
+  add r3 12 r6
+  read 0 r2 r7
+  write 0 r6 r7
+  add r2 4 r2
+  add r6 4 r6
+  read 0 r2 r2
+  write 0 r6 r2
+  add r1 20 r2
+  read 0 r2 r2
+  bne r2 r0 .L179
+  load 0 r2
+  jump .L180
+.L179:
+  add r2 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r4 r2 r2
+  read 0 r2 r2
+  load 204 r6
+  mults r2 r6 r2
+  add r5 r2 r2
+.L180:
+  add r3 20 r6
+  write 0 r6 r2
+  add r1 24 r2
+  read 0 r2 r2
+  bne r2 r0 .L182
+  load 0 r2
+  jump .L183
+.L182:
+  add r2 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r4 r2 r2
+  read 0 r2 r2
+  load 204 r4
+  mults r2 r4 r2
+  add r5 r2 r2
+.L183:
+  add r3 24 r4
+  write 0 r4 r2
+  add r1 32 r2
+  read 0 r2 r2
+  beq r2 r0 .L195
+  or r0 r2 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r2
+  read -28 r14 r1
+  read -32 r14 r3
+  read -20 r14 r5
+  read -8 r14 r4
+  add r3 28 r6
+  write 0 r6 r2
+  load 0 r2
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+.L187:
+  add r1 32 r6
+  read 0 r6 r6
+  bge r3 r6 .L193
+  add r1 28 r6
+  read 0 r6 r6
+  shiftl r3 2 r7
+  add r6 r7 r7
+  read 0 r7 r7
+  bne r7 r0 .L190
+  load 0 r6
+  jump .L191
+.L190:
+  shiftl r3 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r4 r6 r6
+  read 0 r6 r6
+  load 204 r7
+  mults r6 r7 r6
+  add r5 r6 r6
+.L191:
+  add r2 28 r2
+  read 0 r2 r2
+  shiftl r3 2 r7
+  add r2 r7 r7
+  read -32 r14 r2
+  write 0 r7 r6
+  add r3 1 r3
+  jump .L187
+.L193:
+  or r0 r2 r3
+  add r3 32 r2
+  write 0 r2 r6
+  add r1 40 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r4
+  read -28 r14 r1
+  read -32 r14 r3
+  add r3 36 r2
+  write 0 r2 r4
+  add r1 36 r2
+  read 0 r2 r5
+  add r1 40 r1
+  read 0 r1 r1
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -28 r14 r1
+  read -32 r14 r3
+  add r1 40 r2
+  read 0 r2 r2
+  add r3 40 r4
+  write 0 r4 r2
+.L195:
+  read 0 r1 r1
+  write -24 r14 r3
+.L197:
+  write -16 r14 r1
+  beq r1 r0 .L210
+  load 24 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r3
+  read -16 r14 r1
+  write -12 r14 r3
+  read 0 r1 r2
+  write 0 r3 r2
+  add r1 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r4
+  read -16 r14 r1
+  read -12 r14 r3
+  add r3 4 r2
+  write 0 r2 r4
+  add r1 4 r2
+  read 0 r2 r5
+  add r1 12 r1
+  read 0 r1 r1
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -16 r14 r1
+  add r1 12 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r2
+  read -16 r14 r1
+  read -12 r14 r3
+  read -20 r14 r5
+  read -8 r14 r4
+  add r3 8 r6
+  write 0 r6 r2
+  load 0 r2
+.L199:
+  add r1 12 r6
+  read 0 r6 r6
+  bge r2 r6 .L206
+  add r1 8 r6
+  read 0 r6 r6
+  shiftl r2 2 r7
+  add r6 r7 r7
+  read 0 r7 r7
+  bne r7 r0 .L203
+  load 0 r5
+  or r0 r5 r6
+  jump .L204
+.L203:
+  shiftl r2 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r4 r6 r6
+  read 0 r6 r6
+  load 204 r7
+  mults r6 r7 r6
+  add r5 r6 r6
+.L204:
+  add r3 8 r5
+  read 0 r5 r5
+  shiftl r2 2 r7
+  add r5 r7 r7
+  read -20 r14 r5
+  write 0 r7 r6
+  add r2 1 r2
+  jump .L199
+.L206:
+  read -24 r14 r2
+  write 0 r2 r3
+  add r3 20 r2
+  add r1 20 r1
+  read 0 r1 r1
+  write -24 r14 r2
+  jump .L197
+.L210:
+  read -28 r14 r1
+  read -32 r14 r3
+  read -20 r14 r5
+  read -8 r14 r4
+  add r1 44 r2
+  read 0 r2 r2
+  bne r2 r0 .L213
+  load 0 r2
+  jump .L216
+.L213:
+  bne r2 r0 .L215
+  load 0 r2
+  jump .L216
+.L215:
+  add r2 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r4 r2 r2
+  read 0 r2 r2
+  load 204 r6
+  mults r2 r6 r2
+  add r5 r2 r2
+.L216:
+  add r3 44 r3
+  write 0 r3 r2
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L172
+.L218:
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -20 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function saveblks */
+
+
+.text
+; function freeblks
+freeblks:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+.L222:
+  write -16 r14 r4
+  beq r4 r0 .L228
+  add r4 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r4
+  add r4 28 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r4
+  add r4 36 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r4
+  read 0 r4 r1
+.L224:
+  write -4 r14 r1
+  beq r1 r0 .L226
+  add r1 20 r2
+  read 0 r2 r2
+  write -8 r14 r2
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -4 r14 r1
+  add r1 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -4 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -8 r14 r1
+  jump .L224
+.L226:
+  read -16 r14 r4
+  add r4 44 r1
+  read 0 r1 r4
+  jump .L222
+.L228:
+  read -12 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function freeblks */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "inl\000"
+/* end data */
+
+
+.text
+; function mapref
+mapref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -16 r14 r5
+  add r14 -24 r1
+  write 0 r1 r4
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r5
+  load 1 r2
+  beq r1 r2 .L244
+  load 1 r2
+  bge r1 r2 .L238
+  beq r1 r0 .L239
+  sltu r1 r0 r1
+.L238:
+  read -24 r14 r1
+  jump .L249
+.L239:
+  read -24 r14 r2
+  shiftr r2 3 r1
+  load 32 r3
+  blts r1 r3 .L243
+  add r5 8 r1
+  read 0 r1 r1
+  shiftr r2 3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  load 0 r2
+  write -20 r14 r2
+  read -20 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -16 r14 r5
+  beq r1 r0 .L242
+  add r5 4 r1
+  read 0 r1 r1
+  add r1 4 r1
+  read 0 r1 r1
+  read -24 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 108 r2
+  or r0 r5 r1
+  readh 0 r2 r5
+  read 0 r1 r6
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -16 r14 r5
+  write -32 r14 r1
+  add r5 8 r1
+  read 0 r1 r1
+  read -24 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  read -32 r14 r1
+  write 0 r2 r1
+.L242:
+  add r5 8 r1
+  read 0 r1 r1
+  read -24 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  jump .L249
+.L243:
+  read -24 r14 r1
+  jump .L249
+.L244:
+  read -24 r14 r2
+  shiftr r2 3 r1
+  beq r1 r0 .L248
+  add r5 12 r1
+  read 0 r1 r1
+  shiftr r2 3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  load 0 r2
+  write -20 r14 r2
+  read -20 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -16 r14 r5
+  beq r1 r0 .L247
+  add r5 4 r1
+  read 0 r1 r1
+  add r1 8 r1
+  read 0 r1 r1
+  read -24 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r4
+  read 0 r5 r5
+  savpc r15
+  add r15 12 r15
+  jump newcon
+  read -16 r14 r5
+  write -28 r14 r1
+  add r5 12 r1
+  read 0 r1 r1
+  read -24 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  read -28 r14 r1
+  write 0 r2 r1
+.L247:
+  add r5 12 r1
+  read 0 r1 r1
+  read -24 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  jump .L249
+.L248:
+  load 1 r1
+  write -20 r14 r1
+  read -20 r14 r1
+.L249:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mapref */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "%s.%d\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "%s.%s\000"
+/* end data */
+
+
+.text
+; function expand
+expand:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 240 r13
+  write -232 r14 r8
+  read 8 r14 r8
+  write -148 r14 r8
+  or r0 r7 r2
+  or r0 r6 r1
+  write -156 r14 r2
+  write -136 r14 r1
+  write -132 r14 r5
+  write -144 r14 r4
+  or r0 r2 r3
+  add r5 4 r2
+  read 0 r2 r2
+  shiftl r3 4 r3
+  add r2 r3 r2
+  read 0 r2 r6
+  write -140 r14 r6
+  write -180 r14 r6
+  add r2 4 r2
+  write -16 r14 r2
+  add r14 -180 r3
+  add r3 4 r3
+  read 0 r2 r2
+  write -160 r14 r2
+  write 0 r3 r2
+  read -16 r14 r2
+  add r2 4 r2
+  write -20 r14 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  read -20 r14 r2
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  or r0 r1 r2
+  add r8 152 r1
+  read 0 r1 r1
+  load 0 r3
+  or r0 r5 r12
+  or r0 r3 r5
+  or r0 r12 r3
+  or r0 r2 r12
+  or r0 r5 r2
+  or r0 r12 r5
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L254:
+  write -24 r14 r1
+  beq r2 r0 .L257
+  add r1 1 r1
+  add r2 44 r2
+  read 0 r2 r2
+  jump .L254
+.L257:
+  write -200 r14 r4
+  add r14 -200 r1
+  add r1 4 r1
+  write 0 r1 r8
+  add r8 16 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -148 r14 r8
+  add r14 -200 r2
+  add r2 8 r2
+  write 0 r2 r1
+  add r8 20 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r2
+  read -24 r14 r1
+  add r14 -200 r3
+  add r3 12 r3
+  write 0 r3 r2
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  add r14 -200 r2
+  add r2 16 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump newblk
+  read -132 r14 r5
+  read -144 r14 r4
+  write -128 r14 r1
+  add r4 28 r3
+  read 0 r3 r7
+  add r7 1 r2
+  write 0 r3 r2
+  add r1 48 r2
+  write 0 r2 r7
+  add r1 124 r4
+  add r5 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.21 r5
+  savpc r15
+  add r15 12 r15
+  jump strf
+  read -156 r14 r2
+  read -132 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  add r5 4 r1
+  read 0 r1 r1
+  add r2 1 r3
+  shiftl r3 4 r3
+  add r1 r3 r4
+  add r5 8 r1
+  read 0 r1 r1
+  add r2 1 r2
+  sub r1 r2 r5
+  addr2reg alloc r6
+  savpc r15
+  add r15 12 r15
+  jump insdup
+  or r0 r1 r3
+  read -128 r14 r1
+  read -156 r14 r2
+  read -132 r14 r5
+  add r1 4 r4
+  write 0 r4 r3
+  or r0 r2 r3
+  add r5 8 r2
+  read 0 r2 r2
+  add r3 1 r3
+  sub r2 r3 r2
+  add r1 8 r3
+  write 0 r3 r2
+  add r5 12 r2
+  add r1 12 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  add r5 20 r2
+  read 0 r2 r2
+  add r1 20 r3
+  write 0 r3 r2
+  add r5 24 r2
+  read 0 r2 r2
+  add r1 24 r3
+  write 0 r3 r2
+  add r5 28 r2
+  read 0 r2 r2
+  add r1 28 r3
+  write 0 r3 r2
+  add r5 32 r2
+  read 0 r2 r2
+  add r1 32 r3
+  write 0 r3 r2
+  add r5 36 r2
+  read 0 r2 r2
+  add r1 36 r3
+  write 0 r3 r2
+  add r5 40 r2
+  read 0 r2 r2
+  add r1 40 r3
+  write 0 r3 r2
+  add r5 44 r2
+  read 0 r2 r2
+  add r1 44 r3
+  write 0 r3 r2
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump succlist
+  or r0 r1 r3
+  read -128 r14 r1
+  read -136 r14 r2
+  read -132 r14 r5
+  or r0 r1 r4
+  or r0 r3 r1
+  or r0 r5 r3
+.L259:
+  or r0 r2 r5
+  write -152 r14 r1
+  read 0 r1 r1
+  beq r1 r0 .L271
+  read 0 r1 r1
+.L261:
+  beq r1 r0 .L268
+  load 0 r2
+.L263:
+  add r1 12 r6
+  read 0 r6 r6
+  bge r2 r6 .L267
+  add r1 8 r6
+  read 0 r6 r6
+  shiftl r2 2 r7
+  add r6 r7 r7
+  read 0 r7 r7
+  bne r7 r3 .L266
+  shiftl r2 2 r7
+  add r6 r7 r6
+  write 0 r6 r4
+.L266:
+  add r2 1 r2
+  jump .L263
+.L267:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L261
+.L268:
+  read -152 r14 r1
+  add r1 4 r1
+  read -136 r14 r2
+  jump .L259
+.L271:
+  read -148 r14 r8
+  add r8 152 r1
+  read 0 r1 r1
+  load 0 r2
+  write -124 r14 r2
+.L274:
+  write -120 r14 r1
+  beq r1 r0 .L278
+  savpc r15
+  add r15 12 r15
+  jump newblk
+  or r0 r1 r3
+  read -120 r14 r1
+  read -124 r14 r2
+  read -148 r14 r8
+  read -144 r14 r4
+  add r14 -200 r5
+  add r5 16 r5
+  read 0 r5 r5
+  shiftl r2 2 r6
+  add r5 r6 r5
+  write 0 r5 r3
+  add r4 28 r5
+  read 0 r5 r3
+  add r3 1 r4
+  write 0 r5 r4
+  add r14 -200 r4
+  add r4 16 r4
+  read 0 r4 r4
+  shiftl r2 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  add r4 48 r4
+  write 0 r4 r3
+  or r0 r2 r3
+  add r14 -200 r2
+  add r2 16 r2
+  read 0 r2 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 124 r4
+  add r8 54 r6
+  add r1 124 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.22 r5
+  savpc r15
+  add r15 12 r15
+  jump strf
+  read -120 r14 r1
+  read -124 r14 r2
+  read -148 r14 r8
+  read -144 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+  add r1 44 r1
+  read 0 r1 r1
+  add r2 1 r2
+  write -124 r14 r2
+  jump .L274
+.L278:
+  read -156 r14 r2
+  read -136 r14 r1
+  sub r2 r1 r6
+  write -116 r14 r6
+  add r1 r6 r1
+  add r1 1 r1
+  shiftl r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r2
+  read -136 r14 r1
+  read -132 r14 r5
+  write -104 r14 r2
+  add r5 4 r3
+  read 0 r3 r5
+  or r0 r1 r6
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  read -104 r14 r2
+  read -116 r14 r6
+  read -148 r14 r8
+  read -136 r14 r1
+  read -132 r14 r5
+  add r8 152 r3
+  read 0 r3 r3
+  add r3 4 r3
+  read 0 r3 r4
+  load 0 r3
+  or r0 r5 r12
+  or r0 r3 r5
+  or r0 r12 r3
+  or r0 r1 r12
+  or r0 r5 r1
+  or r0 r12 r5
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L281:
+  write -108 r14 r4
+  write -112 r14 r2
+  bge r2 r6 .L286
+  read 0 r4 r7
+  write -100 r14 r7
+  shiftl r7 2 r6
+  shiftr r6 2 r6
+  load 109 r7
+  sub r6 r7 r6
+  load 6 r7
+  sltu r7 r6 r8
+  xor r8 1 r8
+  read -100 r14 r7
+  read -116 r14 r6
+  beq r8 r0 .L285
+  or r0 r2 r3
+  or r0 r7 r2
+  shiftr r2 30 r2
+  shiftl r2 30 r2
+  load32 -1073741824 r6
+  and r2 r6 r2
+  or r2 88 r2
+  add r5 r3 r3
+  shiftl r3 4 r3
+  add r1 r3 r1
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r4 4 r1
+  add r14 -200 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mapref
+  or r0 r1 r6
+  read -108 r14 r4
+  read -112 r14 r2
+  read -104 r14 r1
+  read -136 r14 r5
+  read -132 r14 r3
+  write -228 r14 r6
+  add r5 r2 r6
+  shiftl r6 4 r6
+  add r1 r6 r6
+  add r6 4 r7
+  read -228 r14 r6
+  write 0 r7 r6
+  add r3 4 r6
+  read 0 r6 r6
+  add r5 r2 r7
+  shiftl r7 4 r7
+  add r6 r7 r6
+  add r6 8 r6
+  add r6 0 r6
+  add r5 r2 r7
+  shiftl r7 4 r7
+  add r1 r7 r7
+  add r7 8 r7
+  add r7 0 r7
+  read 0 r6 r6
+  write 0 r7 r6
+  read -116 r14 r6
+  add r2 1 r2
+.L285:
+  add r4 16 r4
+  jump .L281
+.L286:
+  or r0 r1 r2
+  read -116 r14 r6
+  read -148 r14 r8
+  or r0 r5 r1
+  or r0 r3 r5
+  add r5 4 r3
+  write 0 r3 r2
+  add r1 r6 r1
+  add r5 8 r2
+  write 0 r2 r1
+  add r5 12 r2
+  load 11 r1
+  writeh 0 r2 r1
+  add r5 12 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -200 r1
+  add r1 16 r1
+  read 0 r1 r1
+  add r1 0 r1
+  read 0 r1 r1
+  add r5 20 r2
+  write 0 r2 r1
+  add r5 24 r2
+  load 0 r1
+  write 0 r2 r1
+  add r5 28 r2
+  load 0 r1
+  write 0 r2 r1
+  add r5 32 r2
+  load 0 r1
+  write 0 r2 r1
+  add r5 36 r2
+  load 0 r1
+  write 0 r2 r1
+  add r5 40 r2
+  load 0 r1
+  write 0 r2 r1
+  add r8 152 r1
+  read 0 r1 r2
+  load 0 r3
+  load 0 r1
+  write -44 r14 r1
+  or r0 r3 r1
+.L289:
+  write -84 r14 r2
+  write -96 r14 r1
+  beq r2 r0 .L336
+  or r0 r1 r3
+  add r14 -200 r1
+  add r1 16 r1
+  read 0 r1 r1
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r7
+  write -88 r14 r7
+  add r2 8 r1
+  read 0 r1 r1
+  add r1 1 r1
+  shiftl r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -84 r14 r2
+  read -44 r14 r3
+  read -88 r14 r7
+  add r7 4 r4
+  write 0 r4 r1
+  load 0 r1
+  or r0 r1 r4
+  or r0 r7 r1
+.L292:
+  write -76 r14 r4
+  write -80 r14 r3
+  add r2 8 r5
+  read 0 r5 r5
+  bge r4 r5 .L298
+  add r2 4 r5
+  read 0 r5 r5
+  shiftl r4 4 r6
+  add r5 r6 r5
+  read 0 r5 r6
+  write -72 r14 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 109 r7
+  sub r6 r7 r6
+  load 6 r7
+  sltu r7 r6 r7
+  xor r7 1 r7
+  read -72 r14 r6
+  bne r7 r0 .L297
+  or r0 r6 r4
+  or r0 r5 r2
+  add r1 4 r3
+  read 0 r3 r3
+  add r1 8 r5
+  read 0 r5 r5
+  shiftl r5 4 r5
+  add r3 r5 r3
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  or r0 r1 r2
+  add r1 4 r1
+  read 0 r1 r1
+  add r2 8 r4
+  read 0 r4 r2
+  add r2 1 r3
+  write 0 r4 r3
+  shiftl r2 4 r2
+  add r1 r2 r5
+  write -92 r14 r5
+  add r5 4 r1
+  add r14 -200 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mapref
+  read -92 r14 r5
+  write -216 r14 r1
+  add r5 4 r2
+  read -216 r14 r1
+  write 0 r2 r1
+  add r5 8 r1
+  add r1 0 r1
+  add r14 -200 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mapref
+  read -92 r14 r5
+  write -220 r14 r1
+  add r5 8 r1
+  add r1 0 r2
+  read -220 r14 r1
+  write 0 r2 r1
+  add r5 8 r1
+  add r1 4 r1
+  add r14 -200 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mapref
+  or r0 r1 r6
+  read -76 r14 r4
+  read -80 r14 r3
+  read -84 r14 r2
+  read -92 r14 r5
+  read -88 r14 r1
+  write -224 r14 r6
+  add r5 8 r6
+  add r6 4 r7
+  read -224 r14 r6
+  write 0 r7 r6
+  read 0 r5 r5
+  shiftl r5 2 r5
+  shiftr r5 2 r5
+  load 83 r6
+  sub r5 r6 r5
+  load 2 r6
+  bgt r5 r6 .L297
+  add r3 1 r3
+.L297:
+  add r4 1 r4
+  jump .L292
+.L298:
+  or r0 r1 r7
+  add r2 12 r1
+  add r7 12 r3
+  read 0 r1 r4
+  write 0 r3 r4
+  add r1 4 r1
+  add r3 4 r3
+  read 0 r1 r1
+  write 0 r3 r1
+  add r2 12 r1
+  add r1 4 r1
+  add r14 -200 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mapref
+  read -84 r14 r2
+  read -88 r14 r7
+  write -212 r14 r1
+  add r7 12 r1
+  add r1 4 r3
+  read -212 r14 r1
+  write 0 r3 r1
+  add r2 20 r1
+  read 0 r1 r3
+  beq r3 r0 .L301
+  add r14 -200 r1
+  add r1 16 r1
+  read 0 r1 r1
+  add r3 48 r3
+  read 0 r3 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  add r7 20 r3
+  write 0 r3 r1
+.L301:
+  add r2 24 r1
+  read 0 r1 r3
+  beq r3 r0 .L303
+  add r14 -200 r1
+  add r1 16 r1
+  read 0 r1 r1
+  add r3 48 r3
+  read 0 r3 r3
+  shiftl r3 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  add r7 24 r3
+  write 0 r3 r1
+.L303:
+  add r2 32 r1
+  read 0 r1 r1
+  beq r1 r0 .L311
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -84 r14 r2
+  read -88 r14 r7
+  read -132 r14 r3
+  add r7 28 r4
+  write 0 r4 r1
+  load 0 r1
+  or r0 r1 r4
+  or r0 r7 r1
+.L306:
+  add r2 32 r5
+  read 0 r5 r5
+  bge r4 r5 .L309
+  add r14 -200 r5
+  add r5 16 r5
+  read 0 r5 r5
+  add r2 28 r6
+  read 0 r6 r6
+  shiftl r4 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  add r1 28 r6
+  read 0 r6 r6
+  shiftl r4 2 r7
+  add r6 r7 r6
+  write 0 r6 r5
+  add r4 1 r4
+  jump .L306
+.L309:
+  or r0 r1 r7
+  add r7 32 r1
+  write 0 r1 r5
+  add r2 40 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r4
+  read -84 r14 r2
+  read -88 r14 r7
+  add r7 36 r1
+  write 0 r1 r4
+  add r2 36 r1
+  read 0 r1 r5
+  add r2 40 r1
+  read 0 r1 r1
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -84 r14 r2
+  read -88 r14 r7
+  add r2 40 r1
+  read 0 r1 r1
+  add r7 40 r3
+  write 0 r3 r1
+.L311:
+  add r2 12 r1
+  readh 0 r1 r1
+  load 1 r3
+  sub r1 r3 r1
+  load 9 r3
+  bgt r1 r3 .L317
+  add r14 -180 r1
+  add r1 4 r1
+  load 0 r2
+  write -164 r14 r2
+  read -164 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -84 r14 r2
+  read -88 r14 r7
+  read -128 r14 r4
+  read -140 r14 r6
+  load 0 r1
+  bne r3 r0 .L314
+  add r2 12 r1
+  readh 0 r1 r1
+  xor r1 10 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L314:
+  beq r1 r0 .L316
+  shiftr r6 30 r1
+  shiftl r1 30 r1
+  load32 -1073741824 r3
+  and r1 r3 r1
+  or r1 88 r6
+  add r7 12 r1
+  add r1 4 r1
+  read 0 r1 r3
+  write -52 r14 r3
+  add r7 4 r1
+  read 0 r1 r1
+  write -48 r14 r1
+  add r7 8 r3
+  read 0 r3 r5
+  add r5 1 r1
+  write 0 r3 r1
+  read -48 r14 r1
+  read -52 r14 r3
+  shiftl r5 4 r5
+  add r1 r5 r1
+  read -160 r14 r5
+  write 0 r1 r6
+  add r1 4 r1
+  write 0 r1 r5
+  add r1 4 r1
+  write 0 r1 r3
+  add r1 4 r3
+  load 0 r1
+  write 0 r3 r1
+.L316:
+  add r7 12 r3
+  load 11 r1
+  writeh 0 r3 r1
+  add r7 12 r1
+  add r1 4 r3
+  load 0 r1
+  write 0 r3 r1
+  add r7 20 r1
+  write 0 r1 r4
+.L317:
+  read 0 r2 r2
+  write -68 r14 r7
+.L319:
+  write -60 r14 r2
+  beq r2 r0 .L329
+  load 24 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -56 r14 r1
+  read -60 r14 r2
+  add r14 -200 r5
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump mapref
+  or r0 r1 r3
+  read -60 r14 r2
+  read -56 r14 r1
+  write -208 r14 r3
+  read -208 r14 r3
+  write 0 r1 r3
+  add r2 16 r3
+  read 0 r3 r3
+  add r1 16 r4
+  write 0 r4 r3
+  or r0 r1 r3
+  add r2 12 r1
+  read 0 r1 r1
+  add r3 12 r3
+  write 0 r3 r1
+  add r2 12 r1
+  read 0 r1 r4
+  load 1 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -60 r14 r2
+  read -56 r14 r3
+  add r3 4 r3
+  write 0 r3 r1
+  add r2 12 r1
+  read 0 r1 r4
+  load 1 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -60 r14 r2
+  read -56 r14 r3
+  add r3 8 r3
+  write 0 r3 r1
+  load 0 r1
+  or r0 r1 r3
+  or r0 r2 r1
+.L322:
+  write -64 r14 r3
+  add r1 12 r2
+  read 0 r2 r2
+  bge r3 r2 .L325
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  add r14 -200 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mapref
+  or r0 r1 r4
+  read -64 r14 r3
+  read -60 r14 r1
+  read -56 r14 r2
+  write -204 r14 r4
+  add r2 4 r4
+  read 0 r4 r4
+  shiftl r3 2 r5
+  add r4 r5 r5
+  read -204 r14 r4
+  write 0 r5 r4
+  add r14 -200 r4
+  add r4 16 r4
+  read 0 r4 r4
+  add r1 8 r5
+  read 0 r5 r5
+  shiftl r3 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  add r5 48 r5
+  read 0 r5 r5
+  shiftl r5 2 r5
+  add r4 r5 r4
+  read 0 r4 r4
+  add r2 8 r5
+  read 0 r5 r5
+  shiftl r3 2 r6
+  add r5 r6 r5
+  write 0 r5 r4
+  add r3 1 r3
+  jump .L322
+.L325:
+  or r0 r1 r2
+  read -68 r14 r3
+  read -56 r14 r1
+  write 0 r3 r1
+  add r1 20 r1
+  add r2 20 r2
+  read 0 r2 r2
+  write -68 r14 r1
+  jump .L319
+.L329:
+  read -80 r14 r3
+  read -84 r14 r2
+  read -96 r14 r1
+  read -88 r14 r7
+  read -128 r14 r4
+  read -140 r14 r6
+  add r2 44 r5
+  read 0 r5 r5
+  bne r5 r0 .L332
+  or r0 r4 r5
+  jump .L333
+.L332:
+  add r14 -200 r5
+  add r5 16 r5
+  read 0 r5 r5
+  add r1 1 r6
+  shiftl r6 2 r6
+  add r5 r6 r5
+  read -140 r14 r6
+  read 0 r5 r5
+.L333:
+  add r7 44 r7
+  write 0 r7 r5
+  read -160 r14 r5
+  add r2 44 r2
+  read 0 r2 r2
+  add r1 1 r1
+  write -44 r14 r3
+  jump .L289
+.L336:
+  read -44 r14 r2
+  read -128 r14 r1
+  read -132 r14 r5
+  read -144 r14 r4
+  add r14 -200 r3
+  add r3 16 r3
+  read 0 r3 r3
+  add r3 0 r3
+  read 0 r3 r3
+  add r5 44 r5
+  write 0 r5 r3
+  beq r2 r0 .L360
+  add r14 -200 r2
+  add r2 16 r2
+  read 0 r2 r2
+  add r2 0 r2
+  read 0 r2 r3
+  write -32 r14 r3
+  read 0 r4 r4
+  write -36 r14 r4
+  load 0 r2
+  or r0 r4 r12
+  or r0 r2 r4
+  or r0 r12 r2
+  or r0 r1 r12
+  or r0 r4 r1
+  or r0 r12 r4
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L340:
+  write -40 r14 r3
+  add r2 8 r5
+  read 0 r5 r5
+  load 0 r6
+  bge r3 r5 .L342
+  add r2 4 r6
+  read 0 r6 r6
+  shiftl r3 4 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 109 r7
+  sub r6 r7 r7
+  load 6 r6
+  sltu r6 r7 r6
+  xor r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L342:
+  beq r6 r0 .L344
+  add r3 1 r3
+  jump .L340
+.L344:
+  read -44 r14 r2
+  add r5 r2 r1
+  shiftl r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r7
+  read -40 r14 r3
+  read -36 r14 r4
+  write -28 r14 r7
+  add r4 4 r1
+  read 0 r1 r5
+  or r0 r3 r6
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  read -40 r14 r3
+  read -28 r14 r7
+  or r0 r3 r1
+  read -32 r14 r3
+  load 0 r2
+  or r0 r7 r4
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L347:
+  add r1 8 r5
+  read 0 r5 r5
+  bge r2 r5 .L351
+  add r1 4 r5
+  read 0 r5 r5
+  shiftl r2 4 r6
+  add r5 r6 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 83 r7
+  sub r6 r7 r6
+  load 2 r7
+  bgt r6 r7 .L350
+  shiftl r2 4 r6
+  add r5 r6 r5
+  or r0 r3 r6
+  add r3 1 r3
+  shiftl r6 4 r6
+  add r4 r6 r6
+  read 0 r5 r7
+  write 0 r6 r7
+  add r5 4 r5
+  add r6 4 r6
+  read 0 r5 r7
+  write 0 r6 r7
+  add r5 4 r5
+  add r6 4 r6
+  read 0 r5 r7
+  write 0 r6 r7
+  add r5 4 r5
+  add r6 4 r6
+  read 0 r5 r5
+  write 0 r6 r5
+.L350:
+  add r2 1 r2
+  jump .L347
+.L351:
+  or r0 r3 r1
+  read -40 r14 r3
+  or r0 r4 r7
+  read -36 r14 r4
+  shiftl r1 4 r2
+  or r0 r4 r1
+  add r7 r2 r4
+  add r1 4 r2
+  read 0 r2 r2
+  shiftl r3 4 r5
+  add r2 r5 r5
+  add r1 8 r1
+  read 0 r1 r1
+  sub r1 r3 r6
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  read -44 r14 r2
+  read -28 r14 r7
+  read -36 r14 r4
+  read -32 r14 r3
+  read -128 r14 r1
+  add r4 4 r5
+  write 0 r5 r7
+  add r4 8 r4
+  read 0 r4 r5
+  add r5 r2 r2
+  write 0 r4 r2
+  load 0 r4
+  load 0 r2
+  or r0 r1 r12
+  or r0 r4 r1
+  or r0 r12 r4
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L354:
+  add r1 8 r5
+  read 0 r5 r5
+  bge r3 r5 .L358
+  add r1 4 r5
+  read 0 r5 r6
+  shiftl r3 4 r5
+  add r6 r5 r5
+  read 0 r5 r5
+  shiftl r5 2 r5
+  shiftr r5 2 r5
+  load 83 r7
+  sub r5 r7 r7
+  load 2 r5
+  sltu r5 r7 r5
+  xor r5 1 r5
+  bne r5 r0 .L357
+  shiftl r3 4 r5
+  add r6 r5 r5
+  or r0 r2 r7
+  add r2 1 r2
+  shiftl r7 4 r7
+  add r6 r7 r6
+  read 0 r5 r7
+  write 0 r6 r7
+  add r5 4 r5
+  add r6 4 r6
+  read 0 r5 r7
+  write 0 r6 r7
+  add r5 4 r5
+  add r6 4 r6
+  read 0 r5 r7
+  write 0 r6 r7
+  add r5 4 r5
+  add r6 4 r6
+  read 0 r5 r5
+  write 0 r6 r5
+.L357:
+  add r3 1 r3
+  jump .L354
+.L358:
+  or r0 r1 r3
+  or r0 r4 r1
+  add r3 8 r3
+  write 0 r3 r2
+.L360:
+  read -232 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function expand */
+
+
+.text
+; function inlcalls
+inlcalls:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 80 r13
+  write -72 r14 r8
+  or r0 r4 r2
+  write -60 r14 r2
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump cost
+  or r0 r1 r4
+  read -60 r14 r2
+  read 0 r2 r1
+.L364:
+  beq r1 r0 .L408
+  load 0 r3
+.L366:
+  write -32 r14 r1
+  write -28 r14 r3
+  write -24 r14 r4
+  add r1 8 r5
+  read 0 r5 r5
+  bge r3 r5 .L407
+  add r1 4 r5
+  read 0 r5 r5
+  shiftl r3 4 r6
+  add r5 r6 r6
+  write -20 r14 r6
+  read 0 r6 r5
+  shiftl r5 2 r5
+  shiftr r5 2 r5
+  load 1 r7
+  write -16 r14 r7
+  load 124 r7
+  xor r5 r7 r7
+  sltu r0 r7 r7
+  read -16 r14 r5
+  bne r7 r0 .L369
+  add r6 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r5
+  read -32 r14 r1
+  read -28 r14 r3
+  read -24 r14 r4
+  read -20 r14 r6
+  read -60 r14 r2
+  xor r5 1 r5
+  sltu r0 r5 r5
+  xor r5 0 r5
+  sltu r0 r5 r7
+  jump .L370
+.L369:
+  or r0 r5 r7
+.L370:
+  load 1 r5
+  bne r7 r0 .L372
+  add r6 8 r1
+  add r1 4 r1
+  load 0 r2
+  write -68 r14 r2
+  read -68 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r5
+  read -32 r14 r1
+  read -28 r14 r3
+  read -24 r14 r4
+  read -20 r14 r6
+  read -60 r14 r2
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L372:
+  bne r5 r0 .L406
+  add r2 8 r5
+  read 0 r5 r5
+  add r6 8 r6
+  add r6 0 r6
+  read 0 r6 r6
+  shiftr r6 3 r6
+  shiftl r6 5 r6
+  add r5 r6 r5
+  read 0 r5 r6
+  load 1 r7
+  write -36 r14 r7
+  load 2 r7
+  xor r6 r7 r7
+  sltu r0 r7 r7
+  read -36 r14 r6
+  bne r7 r0 .L375
+  add r5 4 r6
+  read 0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r7
+  jump .L376
+.L375:
+  or r0 r6 r7
+.L376:
+  load 1 r6
+  bne r7 r0 .L378
+  add r5 16 r6
+  read 0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L378:
+  bne r6 r0 .L406
+  add r5 4 r5
+  add r5 4 r5
+  read 0 r5 r6
+  addr2reg inls r12
+  read 0 r12 r5
+.L381:
+  beq r5 r0 .L384
+  add r5 148 r7
+  read 0 r7 r7
+  beq r7 r6 .L385
+  add r5 172 r5
+  read 0 r5 r5
+  jump .L381
+.L384:
+  load 0 r5
+.L385:
+  write -48 r14 r5
+  load 1 r6
+  beq r5 r0 .L387
+  add r5 164 r6
+  read 0 r6 r6
+  xor r6 0 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L387:
+  bne r6 r0 .L406
+  add r5 160 r6
+  read 0 r6 r6
+  write -64 r14 r6
+  or r0 r2 r8
+  add r4 r6 r2
+  load 0 r6
+  write -40 r14 r6
+  load 1500 r6
+  slt r6 r2 r6
+  or r0 r4 r2
+  read -40 r14 r4
+  bne r6 r0 .L390
+  or r0 r3 r12
+  or r0 r4 r3
+  or r0 r12 r4
+  jump .L391
+.L390:
+  or r0 r3 r4
+  add r5 136 r3
+  add r3 2 r3
+  readb 0 r3 r3
+  slt r3 2 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L391:
+  bne r3 r0 .L405
+  or r0 r4 r3
+  or r0 r2 r12
+  or r0 r4 r2
+  or r0 r12 r4
+.L393:
+  load 0 r6
+  ble r2 r0 .L395
+  add r1 4 r6
+  read 0 r6 r6
+  load 1 r7
+  sub r2 r7 r7
+  shiftl r7 4 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  xor r6 116 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L395:
+  beq r6 r0 .L397
+  load 1 r6
+  sub r2 r6 r2
+  jump .L393
+.L397:
+  or r0 r3 r12
+  or r0 r4 r3
+  or r0 r12 r4
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  read -60 r14 r8
+  load 0 r6
+  write -44 r14 r6
+  sltu r0 r3 r7
+  read -44 r14 r6
+  beq r7 r0 .L400
+  add r1 4 r6
+  read 0 r6 r6
+  load 1 r7
+  sub r3 r7 r7
+  shiftl r7 4 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 116 r7
+  sub r6 r7 r7
+  load 7 r6
+  sltu r6 r7 r6
+  read -60 r14 r8
+  xor r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L400:
+  bne r6 r0 .L404
+  or r0 r5 r6
+  sub r4 r3 r5
+  add r6 156 r6
+  read 0 r6 r6
+  xor r5 r6 r5
+  sltu r0 r5 r5
+  write -52 r14 r5
+  read -48 r14 r5
+  read -64 r14 r6
+  read -60 r14 r8
+  read -52 r14 r12
+  bne r12 r0 .L403
+  add r2 r6 r2
+  write -56 r14 r2
+  read -60 r14 r2
+  load 12 r6
+  sub r13 r6 r13
+  or r0 r13 r6
+  add r6 8 r6
+  write 0 r6 r5
+  or r0 r4 r7
+  or r0 r3 r6
+  or r0 r1 r5
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump expand
+  read -56 r14 r4
+  read -60 r14 r2
+  load32 -12 r3
+  sub r13 r3 r13
+  load32 -1 r3
+  jump .L406
+.L403:
+  or r0 r4 r3
+  or r0 r2 r4
+  or r0 r8 r2
+  jump .L406
+.L404:
+  or r0 r4 r3
+  or r0 r2 r4
+  or r0 r8 r2
+  jump .L406
+.L405:
+  or r0 r4 r3
+  or r0 r2 r4
+  or r0 r8 r2
+.L406:
+  add r3 1 r3
+  jump .L366
+.L407:
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L364
+.L408:
+  read -72 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function inlcalls */
+
+
+.text
+; function inlfn
+.global inlfn
+inlfn:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump inlcalls
+  read -12 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump cost
+  or r0 r1 r3
+  read -12 r14 r4
+  write -8 r14 r3
+  add r4 138 r1
+  readb 0 r1 r2
+  load 2 r1
+  beq r2 r1 .L416
+  bne r2 r0 .L414
+  load 8 r1
+  jump .L415
+.L414:
+  load 40 r1
+.L415:
+  or r0 r1 r5
+  jump .L418
+.L416:
+  load 2000 r1
+  or r0 r1 r5
+.L418:
+  write -4 r14 r5
+  load 1 r1
+  blts r2 r0 .L420
+  savpc r15
+  add r15 12 r15
+  jump inlinable
+  read -4 r14 r5
+  read -8 r14 r3
+  read -12 r14 r4
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L421
+.L420:
+  or r0 r1 r2
+.L421:
+  load 1 r1
+  bne r2 r0 .L427
+  load 0 r1
+  bles r3 r5 .L426
+  add r4 136 r1
+  readb 0 r1 r2
+  load 1 r1
+  bne r2 r0 .L425
+  add r4 136 r1
+  add r1 2 r1
+  readb 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L425:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L426:
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L427:
+  bne r1 r0 .L436
+  load 176 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  read -12 r14 r4
+  write -16 r14 r1
+  read 0 r4 r2
+  write 0 r1 r2
+  add r4 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r1
+  read 0 r2 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 4 r3
+  or r0 r4 r1
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  add r1 16 r1
+  read 0 r1 r1
+  load 160 r2
+  mults r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r4
+  read -16 r14 r1
+  or r0 r1 r2
+  read -12 r14 r1
+  add r2 4 r2
+  write 0 r2 r4
+  add r1 4 r2
+  read 0 r2 r5
+  add r1 16 r1
+  read 0 r1 r1
+  load 160 r2
+  mults r1 r2 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -12 r14 r1
+  add r1 20 r1
+  read 0 r1 r1
+  shiftl r1 5 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r4
+  read -16 r14 r1
+  or r0 r1 r2
+  read -12 r14 r1
+  add r2 8 r2
+  write 0 r2 r4
+  add r1 8 r2
+  read 0 r2 r5
+  add r1 20 r1
+  read 0 r1 r1
+  shiftl r1 5 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -12 r14 r4
+  add r4 54 r4
+  savpc r15
+  add r15 12 r15
+  jump intern
+  read -16 r14 r2
+  read -12 r14 r4
+  add r2 148 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump saveblks
+  or r0 r1 r2
+  read -16 r14 r1
+  read -4 r14 r5
+  read -8 r14 r3
+  read -12 r14 r4
+  add r1 152 r6
+  write 0 r6 r2
+  read 0 r4 r2
+  add r2 4 r2
+  read 0 r2 r2
+.L429:
+  read 0 r4 r7
+  add r7 4 r6
+  read 0 r6 r6
+  add r7 8 r7
+  read 0 r7 r7
+  shiftl r7 4 r7
+  add r6 r7 r6
+  bge r2 r6 .L433
+  read 0 r2 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 109 r7
+  sub r6 r7 r6
+  load 6 r7
+  bgt r6 r7 .L432
+  add r1 156 r7
+  read 0 r7 r6
+  add r6 1 r6
+  write 0 r7 r6
+.L432:
+  add r2 16 r2
+  jump .L429
+.L433:
+  add r1 160 r2
+  write 0 r2 r3
+  slt r5 r3 r2
+  xor r2 1 r2
+  add r1 164 r3
+  write 0 r3 r2
+  add r4 136 r2
+  readb 0 r2 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  add r1 168 r3
+  write 0 r3 r2
+  addr2reg inls r12
+  read 0 r12 r2
+  add r1 172 r3
+  write 0 r3 r2
+  addr2reg inls r12
+  write 0 r12 r1
+  add r1 168 r2
+  read 0 r2 r2
+  bne r2 r0 .L435
+  savpc r15
+  add r15 12 r15
+  jump refs
+  read -16 r14 r1
+.L435:
+  add r1 168 r1
+  read 0 r1 r1
+  jump .L437
+.L436:
+  savpc r15
+  add r15 12 r15
+  jump refs
+  load 0 r1
+.L437:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function inlfn */
+
+
+.text
+; function restore
+restore:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  write -44 r14 r4
+  load 148 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r2
+  read -44 r14 r1
+  write -48 r14 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r4
+  write 0 r2 r4
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  load 1 r6
+  load 160 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r4
+  read -48 r14 r1
+  read -44 r14 r2
+  add r1 4 r3
+  write 0 r3 r4
+  add r2 4 r2
+  read 0 r2 r5
+  add r1 16 r1
+  read 0 r1 r1
+  load 160 r2
+  mults r1 r2 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -48 r14 r1
+  add r1 20 r1
+  read 0 r1 r4
+  load 1 r6
+  load 32 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r4
+  read -48 r14 r1
+  read -44 r14 r2
+  add r1 8 r3
+  write 0 r3 r4
+  add r2 8 r2
+  read 0 r2 r5
+  add r1 20 r1
+  read 0 r1 r1
+  shiftl r1 5 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  load 1 r6
+  load 48 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r2
+  read -48 r14 r1
+  add r1 12 r3
+  write 0 r3 r2
+  add r1 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -40 r14 r1
+  read -44 r14 r1
+  add r1 152 r1
+  read 0 r1 r1
+  load 0 r2
+  write -36 r14 r2
+.L442:
+  write -32 r14 r1
+  beq r1 r0 .L446
+  savpc r15
+  add r15 12 r15
+  jump newblk
+  or r0 r1 r3
+  read -32 r14 r1
+  read -36 r14 r2
+  read -40 r14 r4
+  shiftl r2 2 r5
+  add r4 r5 r5
+  write 0 r5 r3
+  add r1 44 r1
+  read 0 r1 r1
+  add r2 1 r2
+  write -36 r14 r2
+  jump .L442
+.L446:
+  read -40 r14 r4
+  read -44 r14 r1
+  add r1 152 r1
+  read 0 r1 r1
+  load 0 r2
+.L448:
+  write -24 r14 r1
+  write -28 r14 r2
+  beq r1 r0 .L478
+  shiftl r2 2 r2
+  add r4 r2 r2
+  read 0 r2 r5
+  write -20 r14 r5
+  add r5 124 r4
+  add r1 124 r5
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  read -24 r14 r1
+  read -28 r14 r2
+  read -20 r14 r5
+  add r5 48 r3
+  write 0 r3 r2
+  add r5 4 r4
+  add r1 4 r2
+  read 0 r2 r5
+  add r1 8 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump idup
+  read -24 r14 r1
+  read -20 r14 r5
+  read -40 r14 r4
+  add r1 8 r2
+  read 0 r2 r2
+  add r5 8 r3
+  write 0 r3 r2
+  add r1 12 r2
+  add r5 12 r3
+  read 0 r2 r6
+  write 0 r3 r6
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  add r1 20 r2
+  read 0 r2 r2
+  bne r2 r0 .L451
+  load 0 r2
+  jump .L452
+.L451:
+  add r2 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r4 r2 r2
+  read 0 r2 r2
+.L452:
+  add r5 20 r3
+  write 0 r3 r2
+  add r1 24 r2
+  read 0 r2 r2
+  bne r2 r0 .L454
+  load 0 r2
+  jump .L455
+.L454:
+  add r2 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r4 r2 r2
+  read 0 r2 r2
+.L455:
+  add r5 24 r3
+  write 0 r3 r2
+  add r1 32 r2
+  read 0 r2 r4
+  beq r4 r0 .L461
+  load 1 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r3
+  read -24 r14 r1
+  read -20 r14 r5
+  read -40 r14 r4
+  or r0 r5 r2
+  add r5 28 r5
+  write 0 r5 r3
+  load 0 r3
+.L457:
+  add r1 32 r5
+  read 0 r5 r5
+  bge r3 r5 .L460
+  add r1 28 r5
+  read 0 r5 r5
+  shiftl r3 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  add r5 48 r5
+  read 0 r5 r5
+  shiftl r5 2 r5
+  add r4 r5 r5
+  read 0 r5 r5
+  add r2 28 r6
+  read 0 r6 r6
+  shiftl r3 2 r7
+  add r6 r7 r6
+  write 0 r6 r5
+  add r3 1 r3
+  jump .L457
+.L460:
+  add r2 32 r2
+  write 0 r2 r5
+  add r1 40 r1
+  read 0 r1 r4
+  load 1 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r4
+  read -24 r14 r1
+  read -20 r14 r5
+  add r5 36 r2
+  write 0 r2 r4
+  add r1 36 r2
+  read 0 r2 r5
+  add r1 40 r1
+  read 0 r1 r1
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -24 r14 r1
+  read -20 r14 r5
+  add r1 40 r2
+  read 0 r2 r2
+  add r5 40 r3
+  write 0 r3 r2
+.L461:
+  read 0 r1 r1
+  write -16 r14 r5
+.L463:
+  write -12 r14 r1
+  beq r1 r0 .L472
+  load 24 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r3
+  read -12 r14 r1
+  write -8 r14 r3
+  read 0 r1 r2
+  write 0 r3 r2
+  add r1 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r4
+  load 1 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r4
+  read -12 r14 r1
+  read -8 r14 r3
+  add r3 4 r2
+  write 0 r2 r4
+  add r1 4 r2
+  read 0 r2 r5
+  add r1 12 r1
+  read 0 r1 r1
+  shiftl r1 2 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -12 r14 r1
+  add r1 12 r1
+  read 0 r1 r4
+  load 1 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r2
+  read -12 r14 r1
+  read -8 r14 r3
+  read -40 r14 r4
+  add r3 8 r5
+  write 0 r5 r2
+  load 0 r2
+.L465:
+  add r1 12 r5
+  read 0 r5 r5
+  bge r2 r5 .L468
+  add r1 8 r5
+  read 0 r5 r5
+  shiftl r2 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  add r5 48 r5
+  read 0 r5 r5
+  shiftl r5 2 r5
+  add r4 r5 r5
+  read 0 r5 r5
+  add r3 8 r6
+  read 0 r6 r6
+  shiftl r2 2 r7
+  add r6 r7 r6
+  write 0 r6 r5
+  add r2 1 r2
+  jump .L465
+.L468:
+  read -16 r14 r2
+  write 0 r2 r3
+  add r3 20 r2
+  add r1 20 r1
+  read 0 r1 r1
+  write -16 r14 r2
+  jump .L463
+.L472:
+  read -24 r14 r1
+  read -28 r14 r2
+  read -20 r14 r5
+  read -40 r14 r4
+  add r1 44 r3
+  read 0 r3 r3
+  bne r3 r0 .L475
+  load 0 r3
+  jump .L476
+.L475:
+  add r2 1 r3
+  shiftl r3 2 r3
+  add r4 r3 r3
+  read 0 r3 r3
+.L476:
+  add r5 44 r5
+  write 0 r5 r3
+  add r1 44 r1
+  read 0 r1 r1
+  add r2 1 r2
+  jump .L448
+.L478:
+  read -48 r14 r1
+  add r4 0 r3
+  read 0 r3 r3
+  write 0 r1 r3
+  add r1 28 r3
+  write 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function restore */
+
+
+.text
+; function inlflush
+.global inlflush
+inlflush:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -28 r14 r4
+.L483:
+  addr2reg inls r12
+  read 0 r12 r2
+  load 0 r1
+.L484:
+  write -32 r14 r2
+  write -20 r14 r1
+  beq r2 r0 .L492
+  add r2 168 r3
+  read 0 r3 r5
+  load 0 r3
+  bne r5 r0 .L487
+  or r0 r1 r12
+  or r0 r3 r1
+  or r0 r12 r3
+  or r0 r4 r12
+  or r0 r1 r4
+  or r0 r12 r1
+  jump .L488
+.L487:
+  add r2 148 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump refhas
+  or r0 r1 r4
+  read -32 r14 r2
+  read -20 r14 r1
+  or r0 r1 r3
+  read -28 r14 r1
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L488:
+  bne r4 r0 .L490
+  or r0 r1 r4
+  or r0 r3 r1
+  jump .L491
+.L490:
+  add r2 168 r3
+  load 0 r1
+  write 0 r3 r1
+  or r0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump restore
+  or r0 r1 r4
+  write -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump refs
+  read -24 r14 r4
+  read -28 r14 r1
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -32 r14 r2
+  read -28 r14 r4
+  load 1 r1
+.L491:
+  add r2 172 r2
+  read 0 r2 r2
+  jump .L484
+.L492:
+  bne r1 r0 .L483
+.L493:
+  addr2reg inls r12
+  read 0 r12 r4
+  write -16 r14 r4
+  beq r4 r0 .L495
+  add r4 172 r1
+  read 0 r1 r1
+  addr2reg inls r12
+  write 0 r12 r1
+  add r4 152 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump freeblks
+  read -16 r14 r4
+  add r4 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r4
+  add r4 8 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  jump .L493
+.L495:
+  addr2reg refh r12
+  read 0 r12 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  load 0 r1
+  addr2reg refh r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg nrefh r12
+  write 0 r12 r1
+  load 0 r1
+  addr2reg nref r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function inlflush */
+
+.data
+.balign 4
+inls:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+refh:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+nrefh:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+nref:
+	.fill 4,1,0
+/* end data */
+
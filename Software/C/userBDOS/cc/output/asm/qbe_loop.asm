@@ -0,0 +1,5723 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+
+.text
+; function isin
+isin:
+  addr2reg ninloop r12
+  read 0 r12 r2
+  load 0 r1
+  bge r5 r2 .L19
+  addr2reg inloop r12
+  read 0 r12 r1
+  shiftl r5 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r4 20 r2
+  read 0 r2 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L19:
+  jumpr 0 r15
+
+/* end function isin */
+
+
+.text
+; function invariant
+invariant:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  write -12 r14 r6
+  add r14 -24 r1
+  write 0 r1 r5
+  write -16 r14 r4
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  load 1 r2
+  beq r1 r2 .L32
+  load 1 r2
+  bge r1 r2 .L27
+  beq r1 r0 .L28
+  sltu r1 r0 r1
+.L27:
+  load 0 r1
+  jump .L33
+.L28:
+  load 0 r1
+  write -20 r14 r1
+  read -20 r14 r5
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -12 r14 r6
+  read -16 r14 r4
+  bne r1 r0 .L31
+  read -24 r14 r2
+  shiftr r2 3 r3
+  load 0 r1
+  load 32 r5
+  blts r3 r5 .L33
+  add r6 4 r1
+  read 0 r1 r1
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 96 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump isin
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L33
+.L31:
+  load 1 r1
+  jump .L33
+.L32:
+  load 1 r1
+.L33:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function invariant */
+
+
+.text
+; function conbits
+conbits:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r6
+  write -16 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -12 r14 r6
+  read -16 r14 r5
+  load 1 r2
+  bne r1 r2 .L40
+  add r6 8 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  read 0 r1 r2
+  load 1 r3
+  bne r2 r3 .L39
+  add r1 16 r1
+  read 0 r1 r1
+  write 0 r5 r1
+  load 1 r1
+  jump .L41
+.L39:
+  load 0 r1
+  jump .L41
+.L40:
+  load 0 r1
+.L41:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function conbits */
+
+
+.text
+; function iscon
+iscon:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  write -16 r14 r5
+  add r14 -24 r1
+  write 0 r1 r4
+  add r14 -20 r5
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  or r0 r1 r2
+  read -16 r14 r5
+  load 0 r1
+  beq r2 r0 .L46
+  read -20 r14 r1
+  xor r1 r5 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L46:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function iscon */
+
+
+.text
+; function addins
+addins:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r6
+  write -16 r14 r5
+  write -12 r14 r4
+  read 0 r5 r2
+  or r0 r5 r1
+  add r2 1 r5
+  write 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -8 r14 r6
+  read -16 r14 r5
+  read -12 r14 r4
+  read 0 r4 r1
+  read 0 r5 r2
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 4 r2
+  add r1 r2 r2
+  read 0 r6 r1
+  write 0 r2 r1
+  add r6 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function addins */
+
+
+.text
+; function append
+append:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -4 r14 r5
+  write -12 r14 r6
+  write -16 r14 r4
+  beq r6 r0 .L55
+  add r4 8 r1
+  read 0 r1 r1
+  add r1 r6 r1
+  shiftl r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -16 r14 r4
+  write -8 r14 r1
+  add r4 4 r2
+  read 0 r2 r5
+  add r4 8 r2
+  read 0 r2 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  or r0 r1 r4
+  read -12 r14 r6
+  read -4 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  read -8 r14 r1
+  read -12 r14 r6
+  read -16 r14 r4
+  add r4 4 r2
+  write 0 r2 r1
+  add r4 8 r2
+  read 0 r2 r1
+  add r1 r6 r1
+  write 0 r2 r1
+.L55:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function append */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "%s.%d\000"
+/* end data */
+
+
+.text
+; function addpre
+addpre:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  write -36 r14 r8
+  write -32 r14 r4
+  add r4 28 r1
+  read 0 r1 r2
+  write -28 r14 r2
+  load 0 r1
+  or r0 r1 r6
+  or r0 r4 r1
+.L60:
+  write -24 r14 r6
+  bge r6 r2 .L106
+  add r1 40 r1
+  read 0 r1 r1
+  shiftl r6 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  write -8 r14 r5
+  load 0 r4
+  load 0 r3
+  load 0 r2
+  load 0 r1
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  write -20 r14 r1
+.L63:
+  write -16 r14 r3
+  add r5 80 r1
+  read 0 r1 r1
+  bge r4 r1 .L70
+  add r5 76 r1
+  read 0 r1 r7
+  shiftl r4 2 r1
+  add r7 r1 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r1
+  sltu r1 r6 r8
+  xor r8 1 r8
+  read -20 r14 r1
+  read -24 r14 r6
+  bne r8 r0 .L67
+  or r0 r7 r3
+  shiftl r4 2 r7
+  add r3 r7 r3
+  read 0 r3 r3
+  add r2 1 r2
+  jump .L68
+.L67:
+  load 1 r1
+.L68:
+  add r4 1 r4
+  write -20 r14 r1
+  jump .L63
+.L70:
+  or r0 r2 r4
+  read -20 r14 r2
+  read -32 r14 r1
+  load 1 r7
+  xor r2 r0 r8
+  sltu r8 1 r8
+  read -28 r14 r2
+  bne r8 r0 .L73
+  xor r4 1 r4
+  sltu r0 r4 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+  jump .L74
+.L73:
+  or r0 r7 r4
+.L74:
+  bne r4 r0 .L105
+  add r3 20 r4
+  read 0 r4 r7
+  load 0 r4
+  beq r7 r5 .L77
+  or r0 r4 r5
+  jump .L78
+.L77:
+  add r3 24 r4
+  read 0 r4 r4
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L78:
+  load 0 r4
+  bne r5 r0 .L80
+  or r0 r4 r3
+  jump .L81
+.L80:
+  add r3 32 r3
+  read 0 r3 r3
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L81:
+  bne r3 r0 .L105
+  savpc r15
+  add r15 12 r15
+  jump newblk
+  or r0 r1 r4
+  read -8 r14 r5
+  read -32 r14 r1
+  write -12 r14 r4
+  add r1 28 r2
+  read 0 r2 r7
+  add r7 1 r1
+  write 0 r2 r1
+  add r4 48 r1
+  write 0 r1 r7
+  add r4 124 r4
+  add r5 124 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.14 r5
+  savpc r15
+  add r15 12 r15
+  jump strf
+  read -16 r14 r3
+  read -24 r14 r6
+  read -12 r14 r4
+  read -8 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  load 1 r1
+  addr2reg changed r12
+  write 0 r12 r1
+  add r4 12 r2
+  load 11 r1
+  writeh 0 r2 r1
+  add r4 20 r1
+  write 0 r1 r5
+  add r3 20 r1
+  read 0 r1 r1
+  bne r1 r5 .L84
+  add r3 20 r1
+  write 0 r1 r4
+.L84:
+  add r3 24 r1
+  read 0 r1 r1
+  bne r1 r5 .L86
+  add r3 24 r1
+  write 0 r1 r4
+.L86:
+  load 0 r1
+.L87:
+  add r3 32 r2
+  read 0 r2 r2
+  bge r1 r2 .L91
+  add r3 28 r2
+  read 0 r2 r2
+  shiftl r1 2 r7
+  add r2 r7 r7
+  read 0 r7 r7
+  bne r7 r5 .L90
+  shiftl r1 2 r7
+  add r2 r7 r2
+  write 0 r2 r4
+.L90:
+  add r1 1 r1
+  jump .L87
+.L91:
+  read 0 r5 r1
+.L92:
+  beq r1 r0 .L99
+  load 0 r2
+.L94:
+  add r1 12 r6
+  read 0 r6 r6
+  bge r2 r6 .L98
+  add r1 8 r6
+  read 0 r6 r6
+  shiftl r2 2 r7
+  add r6 r7 r7
+  read 0 r7 r7
+  bne r7 r3 .L97
+  shiftl r2 2 r7
+  add r6 r7 r6
+  write 0 r6 r4
+.L97:
+  add r2 1 r2
+  jump .L94
+.L98:
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L92
+.L99:
+  read -24 r14 r6
+  read -32 r14 r1
+  read 0 r1 r3
+  or r0 r3 r2
+.L102:
+  or r0 r2 r3
+  add r2 44 r2
+  read 0 r2 r2
+  bne r2 r5 .L102
+  read -28 r14 r2
+  add r3 44 r3
+  write 0 r3 r4
+  add r4 44 r3
+  write 0 r3 r5
+.L105:
+  add r6 1 r6
+  jump .L60
+.L106:
+  read -28 r14 r2
+  or r0 r1 r4
+  add r4 28 r1
+  read 0 r1 r1
+  beq r1 r2 .L109
+  savpc r15
+  add r15 12 r15
+  jump fillrpo
+  read -32 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillpreds
+.L109:
+  read -36 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function addpre */
+
+
+.text
+; function findloop
+findloop:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 76 r13
+  write -68 r14 r8
+  write -64 r14 r6
+  write -32 r14 r5
+  write -28 r14 r4
+  addr2reg nloopid r12
+  read 0 r12 r1
+  add r1 1 r2
+  addr2reg nloopid r12
+  write 0 r12 r2
+  write 0 r4 r5
+  add r4 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  write 0 r1 r2
+  add r1 4 r1
+  load 1 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  load 0 r2
+  load 0 r1
+.L113:
+  add r5 80 r3
+  read 0 r3 r3
+  bge r2 r3 .L118
+  add r5 76 r3
+  read 0 r3 r3
+  shiftl r2 2 r6
+  add r3 r6 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  add r5 48 r7
+  read 0 r7 r7
+  bge r6 r7 .L116
+  shiftl r2 2 r6
+  add r3 r6 r3
+  read 0 r3 r3
+  add r4 4 r6
+  write 0 r6 r3
+  jump .L117
+.L116:
+  shiftl r2 2 r6
+  add r3 r6 r3
+  read 0 r3 r3
+  add r4 8 r6
+  write 0 r6 r3
+  add r1 1 r1
+.L117:
+  add r2 1 r2
+  jump .L113
+.L118:
+  read -64 r14 r6
+  load 1 r2
+  beq r1 r0 .L121
+  read 0 r6 r2
+  xor r5 r2 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L121:
+  bne r2 r0 .L163
+  load 1 r2
+  ble r1 r2 .L124
+  add r4 8 r2
+  load 0 r1
+  write 0 r2 r1
+.L124:
+  add r6 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r6
+  read -32 r14 r5
+  read -28 r14 r4
+  write -60 r14 r6
+  add r6 0 r1
+  write 0 r1 r5
+  add r4 20 r1
+  read 0 r1 r1
+  addr2reg inloop r12
+  read 0 r12 r2
+  add r5 48 r3
+  read 0 r3 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  load 1 r1
+  or r0 r1 r2
+.L126:
+  beq r2 r0 .L139
+  load 1 r1
+  sub r2 r1 r2
+  shiftl r2 2 r1
+  add r6 r1 r1
+  read 0 r1 r1
+  write -40 r14 r1
+  load 0 r3
+.L128:
+  write -44 r14 r3
+  write -36 r14 r2
+  add r1 80 r6
+  read 0 r6 r6
+  bge r3 r6 .L138
+  load 0 r7
+  xor r1 r5 r8
+  sltu r8 1 r8
+  read -60 r14 r6
+  beq r8 r0 .L131
+  add r1 76 r6
+  read 0 r6 r6
+  shiftl r3 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  add r5 48 r7
+  read 0 r7 r7
+  sltu r6 r7 r7
+  read -60 r14 r6
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L131:
+  bne r7 r0 .L137
+  addr2reg inloop r12
+  read 0 r12 r6
+  write -20 r14 r6
+  add r1 76 r6
+  read 0 r6 r7
+  write -24 r14 r7
+  shiftl r3 2 r6
+  add r7 r6 r7
+  read -20 r14 r6
+  read 0 r7 r7
+  add r7 48 r7
+  read 0 r7 r7
+  shiftl r7 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  add r4 20 r7
+  read 0 r7 r7
+  xor r6 r7 r8
+  sltu r8 1 r8
+  read -24 r14 r7
+  read -60 r14 r6
+  bne r8 r0 .L137
+  or r0 r7 r1
+  shiftl r3 2 r2
+  add r1 r2 r2
+  or r0 r5 r1
+  read 0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump dom
+  or r0 r1 r6
+  read -44 r14 r3
+  read -36 r14 r2
+  read -40 r14 r1
+  read -32 r14 r5
+  read -28 r14 r4
+  beq r6 r0 .L136
+  add r4 20 r6
+  read 0 r6 r6
+  write -52 r14 r6
+  addr2reg inloop r12
+  read 0 r12 r6
+  write -48 r14 r6
+  add r1 76 r6
+  read 0 r6 r6
+  shiftl r3 2 r7
+  add r6 r7 r7
+  read -48 r14 r6
+  read 0 r7 r7
+  add r7 48 r7
+  read 0 r7 r7
+  shiftl r7 2 r7
+  add r6 r7 r7
+  read -52 r14 r6
+  write 0 r7 r6
+  add r1 76 r6
+  read 0 r6 r6
+  shiftl r3 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  add r2 1 r7
+  write -56 r14 r7
+  or r0 r2 r7
+  read -60 r14 r2
+  shiftl r7 2 r7
+  add r2 r7 r7
+  read -56 r14 r2
+  write 0 r7 r6
+  read -60 r14 r6
+  jump .L137
+.L136:
+  load 0 r1
+  jump .L164
+.L137:
+  add r3 1 r3
+  jump .L128
+.L138:
+  read -60 r14 r6
+  jump .L126
+.L139:
+  read -64 r14 r6
+  add r6 28 r1
+  read 0 r1 r1
+  add r5 48 r2
+  read 0 r2 r2
+  sub r1 r2 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -64 r14 r6
+  read -32 r14 r5
+  read -28 r14 r4
+  add r4 12 r2
+  write 0 r2 r1
+  add r5 48 r1
+  read 0 r1 r3
+.L141:
+  add r6 28 r1
+  read 0 r1 r1
+  bge r3 r1 .L151
+  add r6 40 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  addr2reg inloop r12
+  read 0 r12 r2
+  shiftl r3 2 r7
+  add r2 r7 r2
+  read 0 r2 r2
+  add r4 20 r7
+  read 0 r7 r7
+  bne r2 r7 .L150
+  add r4 12 r2
+  read 0 r2 r2
+  write -16 r14 r2
+  add r4 16 r6
+  read 0 r6 r7
+  add r7 1 r2
+  write 0 r6 r2
+  read -16 r14 r2
+  read -64 r14 r6
+  shiftl r7 2 r7
+  add r2 r7 r2
+  write 0 r2 r1
+  beq r1 r5 .L150
+  load 0 r2
+.L145:
+  add r1 80 r6
+  read 0 r6 r6
+  bge r2 r6 .L149
+  add r1 76 r6
+  read 0 r6 r6
+  shiftl r2 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  add r1 48 r7
+  read 0 r7 r7
+  blt r6 r7 .L148
+  add r4 24 r7
+  load 0 r6
+  write 0 r7 r6
+.L148:
+  add r2 1 r2
+  jump .L145
+.L149:
+  read -64 r14 r6
+.L150:
+  add r3 1 r3
+  jump .L141
+.L151:
+  add r4 4 r1
+  read 0 r1 r1
+  load 1 r2
+  beq r1 r0 .L153
+  add r1 20 r2
+  read 0 r2 r2
+  xor r2 r5 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L154
+.L153:
+  or r0 r2 r3
+.L154:
+  load 1 r2
+  bne r3 r0 .L156
+  add r1 24 r2
+  read 0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L157
+.L156:
+  or r0 r2 r3
+.L157:
+  load 1 r2
+  bne r3 r0 .L159
+  add r1 32 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L160
+.L159:
+  or r0 r2 r1
+.L160:
+  bne r1 r0 .L162
+  load 1 r6
+  load 16 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -28 r14 r4
+  add r4 28 r2
+  write 0 r2 r1
+  load 1 r6
+  load 16 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -28 r14 r4
+  add r4 36 r2
+  write 0 r2 r1
+  load 1 r1
+  jump .L164
+.L162:
+  load 0 r1
+  jump .L164
+.L163:
+  load 0 r1
+.L164:
+  read -68 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function findloop */
+
+
+.text
+; function loopsize
+loopsize:
+  load 0 r2
+  load 0 r1
+  or r0 r2 r6
+  or r0 r1 r2
+.L169:
+  add r4 16 r1
+  read 0 r1 r1
+  bge r6 r1 .L180
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r6 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  add r1 4 r3
+  read 0 r3 r5
+  or r0 r5 r3
+.L172:
+  add r1 8 r7
+  read 0 r7 r7
+  shiftl r7 4 r7
+  add r5 r7 r7
+  bge r3 r7 .L175
+  read 0 r3 r7
+  shiftl r7 2 r7
+  shiftr r7 2 r7
+  xor r7 90 r7
+  sltu r0 r7 r7
+  add r2 r7 r2
+  add r3 16 r3
+  jump .L172
+.L175:
+  read 0 r1 r1
+.L176:
+  beq r1 r0 .L179
+  add r2 1 r2
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L176
+.L179:
+  add r6 1 r6
+  jump .L169
+.L180:
+  or r0 r2 r1
+  jumpr 0 r15
+
+/* end function loopsize */
+
+
+.text
+; function hoist
+hoist:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 60 r13
+  write -28 r14 r5
+  write -32 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump loopsize
+  or r0 r1 r2
+  read -28 r14 r5
+  read -32 r14 r4
+  load 24 r1
+  slt r1 r2 r3
+  write -44 r14 r3
+  load 0 r1
+.L185:
+  write -48 r14 r1
+  add r4 16 r2
+  read 0 r2 r2
+  bge r1 r2 .L226
+  or r0 r1 r2
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r2
+  write -24 r14 r2
+  add r2 4 r1
+  read 0 r1 r1
+.L187:
+  write -36 r14 r1
+  add r2 4 r6
+  read 0 r6 r6
+  add r2 8 r7
+  read 0 r7 r7
+  shiftl r7 4 r7
+  add r6 r7 r6
+  bge r1 r6 .L224
+  read 0 r1 r6
+  shiftl r6 2 r6
+  shiftr r6 2 r6
+  load 24 r7
+  mults r6 r7 r7
+  addr2reg optab r6
+  add r6 r7 r6
+  add r6 20 r6
+  read 0 r6 r7
+  load 1 r6
+  beq r7 r0 .L190
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r6
+  read -36 r14 r1
+  read -24 r14 r2
+  read -44 r14 r3
+  read -28 r14 r5
+  read -32 r14 r4
+  xor r6 0 r6
+  sltu r0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L190:
+  bne r6 r0 .L223
+  read 0 r1 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 0 r6
+  load 88 r7
+  xor r3 r7 r7
+  sltu r7 1 r7
+  read -44 r14 r3
+  beq r7 r0 .L193
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r6
+  read -36 r14 r1
+  read -24 r14 r2
+  read -44 r14 r3
+  read -28 r14 r5
+  read -32 r14 r4
+  xor r6 1 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L193:
+  bne r6 r0 .L223
+  or r0 r2 r6
+  read 0 r1 r2
+  shiftl r2 2 r2
+  shiftr r2 2 r2
+  load 4 r7
+  sub r2 r7 r2
+  load 5 r7
+  blt r2 r7 .L198
+  or r0 r6 r2
+  beq r3 r0 .L202
+  jump .L223
+.L198:
+  shiftl r2 2 r3
+  addr2reg .Ljt198 r2
+  add r2 r3 r2
+  read 0 r2 r2
+  jumpr 0 r2
+.L199:
+  add r1 8 r1
+  add r1 4 r1
+  or r0 r5 r6
+  add r14 -52 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  or r0 r1 r7
+  read -36 r14 r1
+  read -24 r14 r2
+  read -44 r14 r3
+  read -28 r14 r5
+  read -32 r14 r4
+  load 1 r6
+  beq r7 r0 .L201
+  read -52 r14 r6
+  xor r6 0 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L201:
+  bne r6 r0 .L223
+.L202:
+  add r1 8 r1
+  add r1 0 r1
+  or r0 r5 r6
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump invariant
+  or r0 r1 r7
+  read -36 r14 r1
+  read -24 r14 r2
+  read -44 r14 r3
+  read -28 r14 r5
+  read -32 r14 r4
+  load 1 r6
+  beq r7 r0 .L204
+  add r1 8 r1
+  add r1 4 r1
+  or r0 r5 r6
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump invariant
+  or r0 r1 r6
+  read -36 r14 r1
+  read -24 r14 r2
+  read -44 r14 r3
+  read -28 r14 r5
+  read -32 r14 r4
+  xor r6 0 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L204:
+  bne r6 r0 .L223
+  add r4 28 r2
+  read 0 r2 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L207:
+  write -20 r14 r1
+  add r4 28 r3
+  read 0 r3 r3
+  add r4 32 r5
+  read 0 r5 r5
+  shiftl r5 4 r5
+  add r3 r5 r3
+  bge r1 r3 .L221
+  read 0 r1 r3
+  shiftl r3 2 r5
+  shiftr r5 2 r6
+  write -8 r14 r6
+  read 0 r2 r5
+  shiftl r5 2 r6
+  shiftr r6 2 r7
+  write -12 r14 r7
+  read -8 r14 r6
+  load 0 r7
+  write -16 r14 r7
+  read -12 r14 r7
+  xor r6 r7 r7
+  sltu r7 1 r7
+  read -16 r14 r6
+  bne r7 r0 .L210
+  or r0 r6 r5
+  jump .L211
+.L210:
+  shiftr r3 30 r3
+  shiftr r5 30 r5
+  xor r3 r5 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+.L211:
+  load 0 r3
+  bne r5 r0 .L213
+  or r0 r3 r5
+  jump .L214
+.L213:
+  add r1 8 r1
+  add r1 0 r1
+  add r2 8 r2
+  add r2 0 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -20 r14 r2
+  or r0 r2 r1
+  read -36 r14 r2
+  read -32 r14 r4
+  xor r3 0 r3
+  sltu r0 r3 r5
+.L214:
+  load 0 r3
+  bne r5 r0 .L216
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L217
+.L216:
+  add r1 8 r1
+  add r1 4 r1
+  add r2 8 r2
+  add r2 4 r2
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -20 r14 r2
+  read -36 r14 r1
+  read -32 r14 r4
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L217:
+  bne r3 r0 .L220
+  add r2 16 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  jump .L207
+.L220:
+  read 0 r1 r3
+  load32 -1073741824 r5
+  and r3 r5 r5
+  load 88 r3
+  or r3 r5 r3
+  write 0 r1 r3
+  add r2 4 r2
+  add r1 8 r3
+  add r3 0 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  add r1 8 r2
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+  jump .L222
+.L221:
+  or r0 r2 r1
+.L222:
+  or r0 r4 r2
+  add r4 28 r4
+  add r2 32 r5
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump addins
+  read -36 r14 r1
+  read -24 r14 r2
+  read -28 r14 r5
+  read -32 r14 r4
+  add r4 4 r3
+  read 0 r3 r3
+  add r3 48 r3
+  read 0 r3 r6
+  add r5 4 r3
+  read 0 r3 r3
+  write -40 r14 r3
+  add r1 4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  load 160 r7
+  mults r3 r7 r7
+  read -40 r14 r3
+  add r3 r7 r7
+  read -44 r14 r3
+  add r7 96 r7
+  write 0 r7 r6
+  load 90 r6
+  write 0 r1 r6
+  add r1 4 r6
+  load 0 r7
+  write 0 r6 r7
+  add r6 4 r6
+  load 0 r7
+  write 0 r6 r7
+  add r6 4 r7
+  load 0 r6
+  write 0 r7 r6
+  load 1 r6
+  addr2reg changed r12
+  write 0 r12 r6
+.L223:
+  add r1 16 r1
+  jump .L187
+.L224:
+  read -48 r14 r1
+  add r1 1 r1
+  jump .L185
+.L226:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt198:
+  .int .L199
+  .int .L199
+  .int .L199
+  .int .L199
+  .int .L202
+
+/* end function hoist */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "iv\000"
+/* end data */
+
+
+.text
+; function preop
+preop:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 80 r13
+  read 8 r14 r1
+  write -16 r14 r1
+  or r0 r7 r2
+  add r14 -48 r3
+  write 0 r3 r2
+  or r0 r6 r2
+  add r14 -52 r3
+  write 0 r3 r2
+  write -4 r14 r5
+  or r0 r1 r5
+  write -8 r14 r4
+  or r0 r5 r6
+  add r14 -44 r5
+  read -52 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  or r0 r1 r4
+  read -16 r14 r5
+  read -4 r14 r2
+  read -8 r14 r3
+  load 0 r1
+  beq r4 r0 .L231
+  or r0 r5 r6
+  add r14 -40 r5
+  read -48 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  read -16 r14 r5
+  read -4 r14 r2
+  read -8 r14 r3
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L231:
+  beq r1 r0 .L239
+  load 2 r1
+  beq r2 r1 .L273
+  load 2 r1
+  blt r2 r1 .L237
+  load 8 r1
+  beq r2 r1 .L236
+  load 8 r1
+  sltu r2 r1 r1
+  jump .L239
+.L236:
+  read -44 r14 r1
+  read -40 r14 r2
+  mults r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -64 r14 r1
+  read -64 r14 r1
+  jump .L274
+.L237:
+  load 1 r1
+  beq r2 r1 .L272
+  load 1 r1
+  sltu r2 r1 r1
+.L239:
+  load 2 r1
+  beq r2 r1 .L255
+  load 2 r1
+  blt r2 r1 .L251
+  load 8 r1
+  beq r2 r1 .L243
+  load 8 r1
+  sltu r2 r1 r1
+  jump .L256
+.L243:
+  or r0 r5 r6
+  load 0 r5
+  read -52 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  or r0 r1 r2
+  read -16 r14 r5
+  load 1 r1
+  bne r2 r0 .L245
+  or r0 r5 r6
+  load 0 r5
+  read -48 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  read -16 r14 r5
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L245:
+  bne r1 r0 .L250
+  or r0 r5 r6
+  load 1 r5
+  read -52 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  read -16 r14 r5
+  bne r1 r0 .L249
+  or r0 r5 r6
+  load 1 r5
+  read -48 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  read -4 r14 r2
+  read -8 r14 r3
+  beq r1 r0 .L256
+  read -52 r14 r1
+  jump .L274
+.L249:
+  read -48 r14 r1
+  jump .L274
+.L250:
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -60 r14 r1
+  read -60 r14 r1
+  jump .L274
+.L251:
+  load 1 r1
+  beq r2 r1 .L253
+  load 1 r1
+  sltu r2 r1 r1
+  jump .L256
+.L253:
+  or r0 r5 r6
+  load 0 r5
+  read -52 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  read -16 r14 r5
+  beq r1 r0 .L255
+  read -48 r14 r1
+  jump .L274
+.L255:
+  or r0 r5 r6
+  load 0 r5
+  read -48 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  read -4 r14 r2
+  read -8 r14 r3
+  bne r1 r0 .L271
+.L256:
+  add r3 28 r1
+  read 0 r1 r1
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L258:
+  write -12 r14 r3
+  add r1 28 r4
+  read 0 r4 r4
+  add r1 32 r5
+  read 0 r5 r5
+  shiftl r5 4 r5
+  add r4 r5 r4
+  bge r3 r4 .L269
+  read 0 r3 r4
+  shiftl r4 2 r5
+  shiftr r5 2 r6
+  load 0 r5
+  bne r6 r2 .L261
+  shiftr r4 30 r4
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L261:
+  load 0 r4
+  bne r5 r0 .L263
+  or r0 r4 r5
+  jump .L264
+.L263:
+  add r3 8 r1
+  add r1 0 r1
+  read -52 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -12 r14 r3
+  read -4 r14 r2
+  read -8 r14 r1
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L264:
+  load 0 r4
+  beq r5 r0 .L266
+  add r3 8 r1
+  add r1 4 r1
+  read -48 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -12 r14 r3
+  read -4 r14 r2
+  read -8 r14 r1
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L266:
+  bne r4 r0 .L268
+  add r3 16 r3
+  jump .L258
+.L268:
+  add r3 4 r1
+  read 0 r1 r1
+  jump .L274
+.L269:
+  read -16 r14 r5
+  or r0 r5 r6
+  load 0 r5
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -16 r14 r5
+  read -4 r14 r2
+  read -8 r14 r3
+  write -56 r14 r1
+  read -56 r14 r1
+  write -36 r14 r1
+  add r3 4 r4
+  read 0 r4 r4
+  add r4 48 r4
+  read 0 r4 r4
+  add r5 4 r5
+  read 0 r5 r5
+  shiftr r1 3 r6
+  load 160 r7
+  mults r6 r7 r6
+  add r5 r6 r5
+  add r5 96 r5
+  write 0 r5 r4
+  add r3 28 r4
+  add r3 32 r5
+  load 0 r3
+  write -32 r14 r3
+  load32 1073741823 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -32 r14 r2
+  load32 1073741823 r3
+  and r2 r3 r3
+  load 0 r2
+  or r2 r3 r2
+  write -32 r14 r2
+  add r14 -32 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -32 r1
+  add r1 8 r2
+  read -52 r14 r1
+  write 0 r2 r1
+  add r14 -32 r1
+  add r1 12 r2
+  read -48 r14 r1
+  write 0 r2 r1
+  add r14 -32 r6
+  savpc r15
+  add r15 12 r15
+  jump addins
+  read -36 r14 r1
+  jump .L274
+.L271:
+  read -52 r14 r1
+  jump .L274
+.L272:
+  read -44 r14 r1
+  read -40 r14 r2
+  add r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -72 r14 r1
+  read -72 r14 r1
+  jump .L274
+.L273:
+  read -44 r14 r1
+  read -40 r14 r2
+  sub r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -68 r14 r1
+  read -68 r14 r1
+.L274:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function preop */
+
+
+.text
+; function ivstep
+ivstep:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 64 r13
+  read 8 r14 r1
+  write -44 r14 r1
+  write -48 r14 r7
+  or r0 r5 r2
+  write -36 r14 r2
+  write -16 r14 r4
+  add r2 16 r1
+  read 0 r1 r3
+  load 1 r1
+  bne r3 r0 .L279
+  add r2 12 r1
+  read 0 r1 r1
+  xor r1 2 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r3
+  jump .L280
+.L279:
+  or r0 r1 r3
+.L280:
+  load 1 r1
+  bne r3 r0 .L282
+  add r4 8 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L282:
+  bne r1 r0 .L329
+  load 0 r1
+  write 0 r6 r1
+  load 0 r1
+  write -56 r14 r1
+  load 0 r3
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L285:
+  write -20 r14 r2
+  load 2 r5
+  bge r3 r5 .L290
+  add r1 8 r5
+  read 0 r5 r5
+  shiftl r3 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  add r4 4 r7
+  read 0 r7 r7
+  beq r5 r7 .L288
+  add r1 4 r2
+  read 0 r2 r2
+  shiftl r3 2 r5
+  add r2 r5 r2
+  read 0 r2 r2
+  write -56 r14 r2
+  jump .L289
+.L288:
+  add r1 4 r5
+  read 0 r5 r5
+  shiftl r3 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  write 0 r6 r5
+.L289:
+  add r3 1 r3
+  jump .L285
+.L290:
+  load 0 r1
+  write -52 r14 r1
+  read -52 r14 r5
+  read 0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r7
+  read -20 r14 r3
+  read -44 r14 r6
+  read -48 r14 r2
+  or r0 r2 r1
+  read -36 r14 r2
+  read -16 r14 r4
+  load 1 r5
+  bne r7 r0 .L292
+  read -56 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r5
+  read -20 r14 r3
+  read -44 r14 r6
+  read -48 r14 r2
+  or r0 r2 r1
+  read -36 r14 r2
+  read -16 r14 r4
+  xor r5 0 r5
+  sltu r0 r5 r5
+  xor r5 0 r5
+  sltu r0 r5 r7
+  jump .L293
+.L292:
+  or r0 r5 r7
+.L293:
+  load 1 r5
+  bne r7 r0 .L295
+  load 0 r1
+  write -52 r14 r1
+  read -52 r14 r5
+  read -56 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  read -20 r14 r3
+  read -44 r14 r6
+  read -48 r14 r2
+  or r0 r2 r5
+  read -36 r14 r2
+  read -16 r14 r4
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L296
+.L295:
+  or r0 r1 r12
+  or r0 r5 r1
+  or r0 r12 r5
+.L296:
+  bne r1 r0 .L328
+  add r6 4 r1
+  read 0 r1 r7
+  write -24 r14 r7
+  shiftr r3 3 r1
+  load 160 r7
+  mults r1 r7 r1
+  read -24 r14 r7
+  add r7 r1 r1
+  add r1 80 r1
+  read 0 r1 r1
+  write -40 r14 r1
+  load 1 r7
+  write -32 r14 r7
+  xor r1 r0 r7
+  sltu r7 1 r7
+  write -28 r14 r7
+  read -24 r14 r7
+  read -28 r14 r12
+  bne r12 r0 .L300
+  or r0 r3 r2
+  or r0 r7 r1
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 96 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump isin
+  or r0 r1 r4
+  read -40 r14 r1
+  read -44 r14 r6
+  read -48 r14 r2
+  or r0 r2 r3
+  read -36 r14 r2
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+  jump .L301
+.L300:
+  or r0 r5 r3
+  read -32 r14 r4
+.L301:
+  bne r4 r0 .L327
+  read 0 r1 r4
+  shiftl r4 2 r4
+  shiftr r4 2 r5
+  load 0 r4
+  load 1 r7
+  beq r5 r7 .L304
+  or r0 r4 r5
+  jump .L305
+.L304:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -40 r14 r1
+  read -44 r14 r6
+  read -48 r14 r2
+  or r0 r2 r3
+  read -36 r14 r2
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L305:
+  load 0 r4
+  beq r5 r0 .L308
+  or r0 r3 r2
+  add r1 8 r1
+  add r1 4 r1
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  or r0 r1 r4
+  read -40 r14 r1
+  read -44 r14 r6
+  read -48 r14 r2
+  or r0 r2 r3
+  read -36 r14 r2
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L308:
+  bne r4 r0 .L326
+  read 0 r1 r4
+  shiftl r4 2 r4
+  shiftr r4 2 r5
+  load 0 r4
+  load 1 r7
+  beq r5 r7 .L311
+  or r0 r4 r5
+  jump .L312
+.L311:
+  add r1 8 r1
+  add r1 4 r1
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -40 r14 r1
+  read -44 r14 r6
+  read -48 r14 r2
+  or r0 r2 r3
+  read -36 r14 r2
+  xor r4 0 r4
+  sltu r0 r4 r5
+.L312:
+  load 0 r4
+  beq r5 r0 .L315
+  or r0 r3 r2
+  add r1 8 r1
+  add r1 0 r1
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  or r0 r1 r4
+  read -40 r14 r1
+  read -44 r14 r6
+  read -48 r14 r2
+  or r0 r2 r3
+  read -36 r14 r2
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L315:
+  bne r4 r0 .L325
+  read 0 r1 r4
+  shiftl r4 2 r4
+  shiftr r4 2 r5
+  load 0 r4
+  load 2 r7
+  beq r5 r7 .L318
+  or r0 r3 r2
+  jump .L319
+.L318:
+  add r1 8 r1
+  add r1 0 r1
+  read 0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -40 r14 r1
+  read -44 r14 r6
+  read -48 r14 r2
+  xor r3 0 r3
+  sltu r0 r3 r4
+.L319:
+  load 0 r3
+  bne r4 r0 .L321
+  or r0 r3 r1
+  jump .L322
+.L321:
+  add r1 8 r1
+  add r1 4 r1
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  read -48 r14 r2
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L322:
+  bne r1 r0 .L324
+  load 0 r1
+  jump .L330
+.L324:
+  read 0 r2 r1
+  sub r0 r1 r1
+  write 0 r2 r1
+  load 1 r1
+  jump .L330
+.L325:
+  load 1 r1
+  jump .L330
+.L326:
+  load 1 r1
+  jump .L330
+.L327:
+  load 0 r1
+  jump .L330
+.L328:
+  load 0 r1
+  jump .L330
+.L329:
+  load 0 r1
+.L330:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function ivstep */
+
+
+.text
+; function affof
+affof:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  load 1 r1
+  bne r2 r0 .L335
+  read -4 r14 r1
+  shiftr r1 3 r1
+  slt r1 32 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L336
+.L335:
+  or r0 r1 r2
+.L336:
+  load 1 r1
+  bne r2 r0 .L338
+  read -4 r14 r1
+  shiftr r1 3 r1
+  addr2reg naff r12
+  read 0 r12 r2
+  slt r1 r2 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L339
+.L338:
+  or r0 r1 r2
+.L339:
+  load 1 r1
+  bne r2 r0 .L341
+  addr2reg aff r12
+  read 0 r12 r1
+  read -4 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+  add r1 12 r1
+  read 0 r1 r1
+  addr2reg niv r12
+  read 0 r12 r2
+  xor r1 r2 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L341:
+  bne r1 r0 .L343
+  addr2reg aff r12
+  read 0 r12 r1
+  read -4 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+  jump .L344
+.L343:
+  load 0 r1
+.L344:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function affof */
+
+
+.text
+; function needed
+needed:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  write -28 r14 r5
+  write -20 r14 r4
+  add r6 4 r1
+  read 0 r1 r1
+  load 160 r2
+  mults r5 r2 r2
+  add r1 r2 r1
+  write -24 r14 r1
+  add r1 84 r2
+  read 0 r2 r2
+.L348:
+  write -32 r14 r2
+  or r0 r1 r3
+  add r1 84 r1
+  read 0 r1 r1
+  add r3 92 r3
+  read 0 r3 r3
+  load 12 r6
+  mults r3 r6 r3
+  add r1 r3 r1
+  bge r2 r1 .L360
+  read 0 r2 r3
+  load 1 r1
+  load 2 r6
+  bne r3 r6 .L351
+  add r2 4 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump isin
+  read -32 r14 r2
+  read -28 r14 r5
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L351:
+  bne r1 r0 .L359
+  add r2 8 r1
+  read 0 r1 r1
+  write -16 r14 r1
+  add r1 8 r1
+  add r1 0 r1
+  shiftl r5 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -36 r14 r2
+  read -36 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r7
+  read -32 r14 r2
+  read -16 r14 r1
+  read -24 r14 r3
+  read -28 r14 r5
+  read -20 r14 r4
+  load 0 r6
+  bne r7 r0 .L354
+  add r1 8 r1
+  add r1 4 r1
+  shiftl r5 3 r2
+  load32 -8 r3
+  and r2 r3 r2
+  or r2 0 r2
+  write -36 r14 r2
+  read -36 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r6
+  read -32 r14 r2
+  read -16 r14 r1
+  read -24 r14 r3
+  read -28 r14 r5
+  read -20 r14 r4
+  xor r6 0 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L354:
+  bne r6 r0 .L357
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump affof
+  or r0 r1 r3
+  read -32 r14 r2
+  read -24 r14 r1
+  read -28 r14 r5
+  read -20 r14 r4
+  bne r3 r0 .L358
+  load 1 r1
+  jump .L361
+.L357:
+  or r0 r3 r1
+.L358:
+  add r2 12 r2
+  jump .L348
+.L359:
+  load 1 r1
+  jump .L361
+.L360:
+  load 0 r1
+.L361:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function needed */
+
+
+.text
+; function reduce
+reduce:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 288 r13
+  write -280 r14 r8
+  or r0 r5 r8
+  write -124 r14 r6
+  write -144 r14 r8
+  write -120 r14 r4
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  add r14 -216 r7
+  add r14 -228 r6
+  or r0 r8 r5
+  savpc r15
+  add r15 12 r15
+  jump ivstep
+  read -124 r14 r6
+  load32 -12 r2
+  sub r13 r2 r13
+  bne r1 r0 8
+  jump .L464
+  addr2reg naff r12
+  read 0 r12 r1
+  add r6 16 r2
+  read 0 r2 r5
+  bges r1 r5 .L367
+  addr2reg aff r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -124 r14 r6
+  addr2reg aff r12
+  read 0 r12 r1
+  addr2reg naff r12
+  read 0 r12 r2
+  shiftl r2 4 r3
+  add r1 r3 r4
+  add r6 16 r1
+  read 0 r1 r1
+  sub r1 r2 r1
+  shiftl r1 4 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  read -124 r14 r6
+  add r6 16 r1
+  read 0 r1 r1
+  addr2reg naff r12
+  write 0 r12 r1
+.L367:
+  addr2reg niv r12
+  read 0 r12 r1
+  add r1 1 r1
+  addr2reg niv r12
+  write 0 r12 r1
+  or r0 r6 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  read -124 r14 r6
+  write -272 r14 r1
+  read -272 r14 r5
+  write -12 r14 r5
+  or r0 r6 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  read -12 r14 r5
+  read -124 r14 r6
+  read -144 r14 r8
+  read -120 r14 r4
+  write -276 r14 r1
+  read -276 r14 r3
+  addr2reg niv r12
+  read 0 r12 r1
+  addr2reg aff r12
+  read 0 r12 r2
+  read 0 r8 r7
+  shiftr r7 3 r7
+  shiftl r7 4 r7
+  add r2 r7 r2
+  write 0 r2 r5
+  add r2 4 r2
+  write 0 r2 r3
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r2
+  write 0 r2 r1
+  load 0 r1
+.L368:
+  write -140 r14 r1
+  add r4 16 r2
+  read 0 r2 r2
+  bge r1 r2 .L429
+  or r0 r1 r2
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -132 r14 r1
+  add r1 4 r2
+  read 0 r2 r2
+.L370:
+  write -128 r14 r2
+  add r1 4 r3
+  read 0 r3 r3
+  add r1 8 r5
+  read 0 r5 r5
+  shiftl r5 4 r5
+  add r3 r5 r3
+  bge r2 r3 .L427
+  read 0 r2 r3
+  shiftr r3 30 r5
+  load 1 r3
+  bne r5 r0 .L373
+  add r2 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r3
+  read -128 r14 r2
+  read -132 r14 r1
+  read -124 r14 r6
+  read -120 r14 r4
+  xor r3 0 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+  jump .L374
+.L373:
+  or r0 r3 r5
+.L374:
+  load 1 r3
+  bne r5 r0 .L376
+  add r2 4 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  addr2reg naff r12
+  read 0 r12 r5
+  slt r3 r5 r3
+  xor r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L376:
+  bne r3 r0 .L426
+  add r2 8 r1
+  add r1 0 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump affof
+  or r0 r1 r3
+  read -128 r14 r2
+  read -132 r14 r1
+  read -124 r14 r6
+  read -120 r14 r4
+  add r2 8 r5
+  add r5 4 r5
+  read 0 r5 r5
+  write -224 r14 r5
+  load 0 r5
+  bne r3 r0 .L382
+  read 0 r2 r5
+  shiftl r5 2 r1
+  shiftr r1 2 r1
+  load 1 r7
+  write -84 r14 r7
+  load 1 r7
+  xor r1 r7 r8
+  sltu r8 1 r8
+  read -132 r14 r1
+  read -84 r14 r7
+  bne r8 r0 .L380
+  shiftl r5 2 r5
+  shiftr r5 2 r5
+  xor r5 8 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+  jump .L381
+.L380:
+  or r0 r7 r5
+.L381:
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L382:
+  beq r5 r0 .L384
+  add r2 8 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump affof
+  or r0 r1 r3
+  read -128 r14 r2
+  read -132 r14 r1
+  read -124 r14 r6
+  read -120 r14 r4
+  add r2 8 r5
+  add r5 0 r5
+  read 0 r5 r5
+  write -224 r14 r5
+.L384:
+  write -116 r14 r3
+  load 1 r5
+  beq r3 r0 .L388
+  read 0 r2 r5
+  shiftl r5 2 r5
+  shiftr r5 2 r5
+  load 0 r7
+  write -88 r14 r7
+  load 88 r7
+  xor r5 r7 r7
+  sltu r0 r7 r7
+  or r0 r1 r5
+  read -88 r14 r1
+  beq r7 r0 .L387
+  read -224 r14 r5
+  savpc r15
+  add r15 12 r15
+  jump invariant
+  read -116 r14 r3
+  read -128 r14 r2
+  read -132 r14 r5
+  read -124 r14 r6
+  read -120 r14 r4
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L387:
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L389
+.L388:
+  or r0 r1 r12
+  or r0 r5 r1
+  or r0 r12 r5
+.L389:
+  bne r1 r0 .L425
+  addr2reg aff r12
+  read 0 r12 r1
+  add r2 4 r5
+  read 0 r5 r5
+  shiftr r5 3 r5
+  shiftl r5 4 r5
+  add r1 r5 r5
+  write -108 r14 r5
+  read 0 r2 r1
+  write -92 r14 r1
+  shiftl r1 2 r5
+  shiftr r5 2 r7
+  load 8 r5
+  beq r7 r5 .L407
+  load 8 r1
+  blt r7 r1 .L401
+  load 88 r1
+  xor r7 r1 r1
+  sltu r1 1 r1
+  write -96 r14 r1
+  read -92 r14 r1
+  read -108 r14 r5
+  read -96 r14 r12
+  bne r12 r0 .L400
+  or r0 r7 r3
+  read -132 r14 r5
+  load 88 r7
+  blt r3 r7 .L397
+  or r0 r5 r1
+  jump .L426
+.L397:
+  load 16 r7
+  beq r3 r7 .L407
+  or r0 r5 r1
+  or r0 r3 r7
+  load 16 r3
+  sltu r7 r3 r3
+  jump .L426
+.L400:
+  read 0 r3 r1
+  write 0 r5 r1
+  add r3 4 r3
+  add r5 4 r1
+  read 0 r3 r7
+  write 0 r1 r7
+  add r3 4 r3
+  add r1 4 r7
+  read 0 r3 r1
+  write 0 r7 r1
+  read -132 r14 r1
+  add r3 4 r3
+  add r7 4 r7
+  read 0 r3 r3
+  write 0 r7 r3
+  jump .L424
+.L401:
+  load 2 r1
+  xor r7 r1 r1
+  sltu r1 1 r1
+  write -100 r14 r1
+  read -108 r14 r5
+  read -132 r14 r1
+  read -100 r14 r12
+  bne r12 r0 .L406
+  load 2 r5
+  bge r7 r5 .L426
+  load 1 r1
+  xor r7 r1 r1
+  sltu r1 1 r1
+  write -104 r14 r1
+  read -108 r14 r5
+  read -132 r14 r1
+  read -104 r14 r12
+  bne r12 r0 .L406
+  or r0 r7 r3
+  load 1 r5
+  sltu r3 r5 r3
+  jump .L426
+.L406:
+  read 0 r3 r1
+  write 0 r5 r1
+  read 0 r2 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r5
+  add r3 4 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r6
+  read -224 r14 r7
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump preop
+  read -116 r14 r3
+  read -128 r14 r2
+  read -108 r14 r5
+  read -124 r14 r6
+  read -120 r14 r4
+  write -268 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  add r5 4 r7
+  read -268 r14 r1
+  write 0 r7 r1
+  read -132 r14 r1
+  add r3 8 r3
+  read 0 r3 r3
+  add r3 1 r3
+  add r5 8 r7
+  write 0 r7 r3
+  jump .L424
+.L407:
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  load 16 r2
+  beq r1 r2 .L415
+  add r14 -212 r5
+  read -224 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  or r0 r1 r5
+  read -116 r14 r3
+  read -128 r14 r2
+  read -124 r14 r6
+  read -120 r14 r4
+  load 1 r1
+  beq r5 r0 .L410
+  read -212 r14 r1
+  load 1 r5
+  sub r1 r5 r5
+  and r1 r5 r1
+  xor r1 0 r1
+  sltu r0 r1 r5
+  jump .L411
+.L410:
+  or r0 r1 r5
+.L411:
+  load 1 r1
+  beq r5 r0 .L413
+  load 3 r1
+.L413:
+  or r0 r1 r7
+  write -136 r14 r7
+  jump .L423
+.L415:
+  add r14 -212 r5
+  read -224 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  or r0 r1 r5
+  read -128 r14 r2
+  read -132 r14 r1
+  read -124 r14 r6
+  read -120 r14 r4
+  load 1 r3
+  beq r5 r0 .L417
+  read -212 r14 r3
+  slt r3 r0 r3
+  xor r3 0 r3
+  sltu r0 r3 r5
+  jump .L418
+.L417:
+  or r0 r3 r5
+.L418:
+  load 1 r3
+  bne r5 r0 .L420
+  read -212 r14 r5
+  load 31 r3
+  slt r3 r5 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L420:
+  bne r3 r0 .L426
+  read -212 r14 r2
+  load 1 r1
+  shiftl r1 r2 r4
+  or r0 r6 r5
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  read -116 r14 r3
+  read -128 r14 r2
+  read -124 r14 r6
+  read -120 r14 r4
+  write -264 r14 r1
+  read -264 r14 r1
+  write -224 r14 r1
+  load 1 r1
+  write -136 r14 r1
+.L423:
+  addr2reg aff r12
+  read 0 r12 r1
+  add r2 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  shiftl r2 4 r2
+  add r1 r2 r5
+  write -112 r14 r5
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  read -224 r14 r7
+  read 0 r3 r6
+  load 8 r5
+  savpc r15
+  add r15 12 r15
+  jump preop
+  read -116 r14 r3
+  read -112 r14 r5
+  read -124 r14 r6
+  read -120 r14 r4
+  write -256 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -256 r14 r1
+  write 0 r5 r1
+  add r3 4 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r6
+  read -224 r14 r7
+  read 0 r1 r6
+  load 8 r5
+  savpc r15
+  add r15 12 r15
+  jump preop
+  read -116 r14 r3
+  read -128 r14 r2
+  read -112 r14 r5
+  read -124 r14 r6
+  read -120 r14 r4
+  write -260 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  add r5 4 r7
+  read -260 r14 r1
+  write 0 r7 r1
+  read -136 r14 r7
+  read -132 r14 r1
+  add r3 8 r3
+  read 0 r3 r3
+  add r3 r7 r3
+  add r5 8 r7
+  write 0 r7 r3
+.L424:
+  addr2reg niv r12
+  read 0 r12 r3
+  add r5 12 r5
+  write 0 r5 r3
+  jump .L426
+.L425:
+  or r0 r5 r1
+.L426:
+  add r2 16 r2
+  jump .L370
+.L427:
+  read -140 r14 r1
+  add r1 1 r1
+  jump .L368
+.L429:
+  load 0 r2
+  load 0 r1
+.L430:
+  write -80 r14 r2
+  add r4 16 r3
+  read 0 r3 r3
+  bge r2 r3 .L464
+  or r0 r2 r3
+  add r4 12 r2
+  read 0 r2 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  write -68 r14 r2
+  add r2 4 r3
+  read 0 r3 r3
+  write -52 r14 r1
+.L433:
+  write -48 r14 r3
+  add r2 4 r1
+  read 0 r1 r1
+  or r0 r2 r7
+  add r2 8 r2
+  read 0 r2 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+  bge r3 r1 .L462
+  add r3 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump affof
+  read -48 r14 r3
+  or r0 r1 r2
+  read -52 r14 r1
+  read -124 r14 r6
+  read -120 r14 r4
+  write -20 r14 r2
+  load 1 r7
+  xor r2 r0 r8
+  sltu r8 1 r8
+  read -144 r14 r5
+  bne r8 r0 .L436
+  add r3 4 r1
+  read 0 r5 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r5
+  read -48 r14 r3
+  read -52 r14 r1
+  read -20 r14 r2
+  read -124 r14 r6
+  read -120 r14 r4
+  xor r5 0 r5
+  sltu r0 r5 r7
+.L436:
+  load 1 r5
+  bne r7 r0 .L438
+  add r2 8 r5
+  read 0 r5 r5
+  slt r5 2 r5
+  xor r5 0 r5
+  sltu r0 r5 r8
+  jump .L439
+.L438:
+  or r0 r5 r8
+.L439:
+  load 1 r5
+  write -16 r14 r5
+  read -68 r14 r7
+  read -16 r14 r5
+  bne r8 r0 .L441
+  load 0 r5
+  read 0 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump iscon
+  or r0 r1 r2
+  read -48 r14 r3
+  read -52 r14 r1
+  read -68 r14 r7
+  read -124 r14 r6
+  read -144 r14 r5
+  read -120 r14 r4
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L442
+.L441:
+  or r0 r5 r2
+  read -144 r14 r5
+.L442:
+  bne r2 r0 .L459
+  add r3 4 r1
+  read 0 r1 r1
+  shiftr r1 3 r2
+  write -40 r14 r2
+  or r0 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump needed
+  or r0 r1 r5
+  read -48 r14 r3
+  read -52 r14 r1
+  read -20 r14 r2
+  read -68 r14 r7
+  read -124 r14 r6
+  read -120 r14 r4
+  xor r5 r0 r8
+  sltu r8 1 r8
+  read -144 r14 r5
+  bne r8 r0 .L458
+  or r0 r2 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r6
+  read -228 r14 r7
+  read 0 r1 r6
+  load 8 r5
+  savpc r15
+  add r15 12 r15
+  jump preop
+  or r0 r1 r2
+  read -20 r14 r1
+  read -124 r14 r6
+  read -120 r14 r4
+  write -240 r14 r2
+  load32 -12 r2
+  sub r13 r2 r13
+  read -240 r14 r2
+  write -224 r14 r2
+  add r1 4 r1
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r6
+  read 0 r1 r7
+  read -224 r14 r6
+  load 1 r5
+  savpc r15
+  add r15 12 r15
+  jump preop
+  read -124 r14 r6
+  write -244 r14 r1
+  load32 -12 r1
+  sub r13 r1 r13
+  read -244 r14 r2
+  write -56 r14 r2
+  write -224 r14 r2
+  read -216 r14 r4
+  or r0 r6 r5
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  or r0 r1 r2
+  read -20 r14 r1
+  read -124 r14 r6
+  read -120 r14 r4
+  write -248 r14 r2
+  load 12 r2
+  sub r13 r2 r13
+  or r0 r13 r2
+  add r2 8 r2
+  write 0 r2 r6
+  read -248 r14 r7
+  read 0 r1 r6
+  load 8 r5
+  savpc r15
+  add r15 12 r15
+  jump preop
+  or r0 r1 r2
+  read -52 r14 r1
+  write -252 r14 r2
+  load32 -12 r2
+  sub r13 r2 r13
+  read -252 r14 r2
+  write -60 r14 r2
+  write -220 r14 r2
+  load 0 r2
+.L446:
+  write -24 r14 r2
+  bges r2 r1 .L452
+  shiftl r2 2 r2
+  add r14 -208 r1
+  add r1 r2 r1
+  read -224 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -24 r14 r2
+  read -52 r14 r1
+  load 0 r3
+  beq r4 r0 .L449
+  shiftl r2 2 r2
+  add r14 -192 r1
+  add r1 r2 r1
+  read -220 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r3
+  read -24 r14 r2
+  read -52 r14 r1
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L449:
+  bne r3 r0 .L451
+  add r2 1 r2
+  jump .L446
+.L451:
+  or r0 r2 r5
+  read -48 r14 r3
+  read -40 r14 r2
+  read -124 r14 r6
+  read -120 r14 r4
+  jump .L453
+.L452:
+  or r0 r2 r5
+  read -48 r14 r3
+  read -52 r14 r1
+  read -40 r14 r2
+  read -124 r14 r6
+  read -120 r14 r4
+.L453:
+  slt r5 r1 r7
+  write -28 r14 r7
+  read -68 r14 r7
+  read -28 r14 r12
+  bne r12 r0 .L457
+  or r0 r7 r2
+  read -144 r14 r5
+  load 4 r7
+  beq r1 r7 .L460
+  load 0 r5
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -124 r14 r6
+  write -232 r14 r1
+  read -232 r14 r5
+  write -44 r14 r5
+  load 0 r5
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -44 r14 r5
+  read -124 r14 r6
+  read -120 r14 r4
+  write -236 r14 r1
+  read -236 r14 r3
+  write -36 r14 r3
+  read 0 r4 r1
+  add r1 48 r1
+  read 0 r1 r1
+  add r6 4 r2
+  read 0 r2 r2
+  shiftr r5 3 r5
+  load 160 r7
+  mults r5 r7 r5
+  add r2 r5 r2
+  add r2 96 r2
+  write 0 r2 r1
+  add r4 8 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r1
+  add r6 4 r2
+  read 0 r2 r2
+  shiftr r3 3 r3
+  load 160 r4
+  mults r3 r4 r3
+  add r2 r3 r2
+  add r2 96 r2
+  write 0 r2 r1
+  load 24 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -44 r14 r5
+  write -32 r14 r1
+  write 0 r1 r5
+  add r1 16 r3
+  or r0 r1 r2
+  load 0 r1
+  write 0 r3 r1
+  add r2 12 r2
+  load 2 r1
+  write 0 r2 r1
+  load 1 r6
+  load 4 r5
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -32 r14 r2
+  add r2 4 r2
+  write 0 r2 r1
+  load 1 r6
+  load 4 r5
+  load 2 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r3
+  read -32 r14 r1
+  read -44 r14 r5
+  read -60 r14 r2
+  read -56 r14 r6
+  read -120 r14 r4
+  add r1 8 r7
+  write 0 r7 r3
+  read -36 r14 r3
+  add r1 4 r7
+  read 0 r7 r7
+  add r7 0 r7
+  write 0 r7 r6
+  add r4 4 r6
+  read 0 r6 r6
+  add r1 8 r7
+  read 0 r7 r7
+  add r7 0 r7
+  write 0 r7 r6
+  add r1 4 r6
+  read 0 r6 r6
+  add r6 4 r6
+  write 0 r6 r3
+  add r4 8 r6
+  read 0 r6 r6
+  add r1 8 r7
+  read 0 r7 r7
+  add r7 4 r7
+  write 0 r7 r6
+  read 0 r4 r6
+  read 0 r6 r6
+  add r1 20 r7
+  write 0 r7 r6
+  read 0 r4 r6
+  write 0 r6 r1
+  or r0 r4 r8
+  add r4 36 r4
+  or r0 r5 r1
+  add r8 40 r5
+  load 0 r6
+  write -160 r14 r6
+  load 1 r6
+  write -160 r14 r6
+  load 1 r6
+  write -160 r14 r6
+  add r14 -160 r6
+  add r6 4 r6
+  write 0 r6 r3
+  add r14 -160 r3
+  add r3 8 r3
+  write 0 r3 r1
+  add r14 -160 r1
+  add r1 12 r1
+  write 0 r1 r2
+  add r14 -160 r6
+  savpc r15
+  add r15 12 r15
+  jump addins
+  read -48 r14 r3
+  read -52 r14 r1
+  read -44 r14 r5
+  read -40 r14 r2
+  read -124 r14 r6
+  read -120 r14 r4
+  shiftl r2 3 r2
+  load32 -8 r7
+  and r2 r7 r2
+  or r2 0 r7
+  load 88 r2
+  write 0 r3 r2
+  add r3 4 r2
+  write 0 r2 r7
+  add r2 4 r2
+  write 0 r2 r5
+  add r2 4 r7
+  load 0 r2
+  write 0 r7 r2
+  load 1 r2
+  addr2reg changed r12
+  write 0 r12 r2
+  shiftl r1 2 r7
+  add r14 -208 r2
+  add r2 r7 r7
+  read -56 r14 r2
+  write 0 r7 r2
+  shiftl r1 2 r7
+  add r14 -192 r2
+  add r2 r7 r7
+  read -60 r14 r2
+  write 0 r7 r2
+  read -68 r14 r2
+  add r1 1 r7
+  write -64 r14 r7
+  shiftl r1 2 r7
+  add r14 -176 r1
+  add r1 r7 r7
+  read -64 r14 r1
+  write 0 r7 r5
+  read -144 r14 r5
+  jump .L460
+.L457:
+  shiftl r2 3 r2
+  load32 -8 r7
+  and r2 r7 r2
+  or r2 0 r7
+  write -72 r14 r7
+  read -68 r14 r2
+  shiftl r5 2 r7
+  add r14 -176 r5
+  add r5 r7 r5
+  read 0 r5 r7
+  write -76 r14 r7
+  read -72 r14 r7
+  load 88 r5
+  write 0 r3 r5
+  add r3 4 r5
+  write 0 r5 r7
+  read -76 r14 r7
+  add r5 4 r5
+  write 0 r5 r7
+  add r5 4 r7
+  load 0 r5
+  write 0 r7 r5
+  read -144 r14 r5
+  load 1 r7
+  addr2reg changed r12
+  write 0 r12 r7
+  jump .L460
+.L458:
+  or r0 r7 r2
+  jump .L460
+.L459:
+  or r0 r7 r2
+.L460:
+  add r3 16 r3
+  write -52 r14 r1
+  jump .L433
+.L462:
+  read -52 r14 r1
+  read -80 r14 r2
+  read -124 r14 r6
+  read -144 r14 r5
+  read -120 r14 r4
+  add r2 1 r2
+  jump .L430
+.L464:
+  read -280 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function reduce */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "BuildTools/QBE/loop.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "unreachable\000"
+/* end data */
+
+
+.text
+; function cmpeval
+cmpeval:
+  load 10 r1
+  blt r4 r1 .L469
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.26 r5
+  addr2reg .Lstring.25 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L480
+.L469:
+  shiftl r4 2 r2
+  addr2reg .Ljt469 r1
+  add r1 r2 r1
+  read 0 r1 r1
+  jumpr 0 r1
+.L470:
+  xor r5 r6 r1
+  sltu r1 1 r1
+  jumpr 0 r15
+.L471:
+  xor r5 r6 r1
+  sltu r0 r1 r1
+  jumpr 0 r15
+.L472:
+  slt r5 r6 r1
+  xor r1 1 r1
+  jumpr 0 r15
+.L473:
+  slt r6 r5 r1
+  jumpr 0 r15
+.L474:
+  slt r6 r5 r1
+  xor r1 1 r1
+  jumpr 0 r15
+.L475:
+  slt r5 r6 r1
+  jumpr 0 r15
+.L476:
+  sltu r5 r6 r1
+  xor r1 1 r1
+  jumpr 0 r15
+.L477:
+  sltu r6 r5 r1
+  jumpr 0 r15
+.L478:
+  sltu r6 r5 r1
+  xor r1 1 r1
+  jumpr 0 r15
+.L479:
+  sltu r5 r6 r1
+  jumpr 0 r15
+.L480:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+.rdata
+.balign 4
+.Ljt469:
+  .int .L470
+  .int .L471
+  .int .L472
+  .int .L473
+  .int .L474
+  .int .L475
+  .int .L476
+  .int .L477
+  .int .L478
+  .int .L479
+
+/* end function cmpeval */
+
+
+.text
+; function tripcount
+tripcount:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 84 r13
+  write -28 r14 r5
+  write -20 r14 r4
+  read 0 r4 r3
+  write -36 r14 r3
+  add r4 24 r1
+  read 0 r1 r2
+  load 1 r1
+  beq r2 r0 .L485
+  add r4 8 r1
+  read 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L486
+.L485:
+  or r0 r1 r2
+.L486:
+  load 1 r1
+  bne r2 r0 .L488
+  add r3 12 r1
+  readh 0 r1 r1
+  xor r1 12 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L489
+.L488:
+  or r0 r1 r2
+.L489:
+  load 1 r1
+  bne r2 r0 .L491
+  add r3 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -36 r14 r3
+  read -20 r14 r4
+  xor r1 0 r1
+  sltu r0 r1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L491:
+  bne r1 r0 .L561
+  add r3 20 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump isin
+  write -32 r14 r1
+  read -36 r14 r3
+  read -20 r14 r4
+  add r3 24 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump isin
+  read -32 r14 r7
+  read -36 r14 r3
+  read -20 r14 r4
+  beq r7 r1 .L560
+  load 0 r2
+  load 0 r1
+  or r0 r2 r6
+  or r0 r1 r2
+.L495:
+  write -44 r14 r6
+  write -40 r14 r2
+  add r4 16 r1
+  read 0 r1 r1
+  bge r6 r1 .L516
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r6 2 r5
+  add r1 r5 r1
+  read 0 r1 r1
+  write -48 r14 r1
+  add r1 32 r5
+  read 0 r5 r5
+  bne r5 r0 .L515
+  beq r1 r3 .L504
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump succlist
+  read -20 r14 r4
+.L499:
+  write -24 r14 r1
+  read 0 r1 r1
+  beq r1 r0 .L503
+  add r1 48 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump isin
+  or r0 r1 r2
+  read -24 r14 r1
+  read -20 r14 r4
+  beq r2 r0 .L502
+  add r1 4 r1
+  jump .L499
+.L502:
+  load 0 r1
+  jump .L562
+.L503:
+  read -44 r14 r6
+  read -40 r14 r2
+  read -48 r14 r1
+.L504:
+  add r1 4 r3
+  read 0 r3 r5
+  or r0 r5 r3
+.L506:
+  add r1 8 r7
+  read 0 r7 r7
+  shiftl r7 4 r7
+  add r5 r7 r7
+  bge r3 r7 .L509
+  read 0 r3 r7
+  shiftl r7 2 r7
+  shiftr r7 2 r7
+  xor r7 90 r7
+  sltu r0 r7 r7
+  add r2 r7 r2
+  add r3 16 r3
+  jump .L506
+.L509:
+  read -32 r14 r7
+  read -36 r14 r3
+  read -28 r14 r5
+  read 0 r1 r1
+.L511:
+  beq r1 r0 .L514
+  add r2 1 r2
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L511
+.L514:
+  add r6 1 r6
+  jump .L495
+.L515:
+  load 0 r1
+  jump .L562
+.L516:
+  read -28 r14 r6
+  add r6 4 r1
+  read 0 r1 r2
+  add r3 12 r1
+  add r1 4 r1
+  read 0 r1 r4
+  shiftr r4 3 r1
+  load 160 r5
+  mults r1 r5 r1
+  add r2 r1 r1
+  add r1 80 r1
+  read 0 r1 r1
+  write -8 r14 r1
+  load 1 r5
+  beq r1 r0 .L519
+  shiftr r4 3 r4
+  load 160 r5
+  mults r4 r5 r4
+  add r2 r4 r2
+  add r2 96 r2
+  read 0 r2 r2
+  add r3 48 r3
+  read 0 r3 r3
+  xor r2 r3 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L520
+.L519:
+  or r0 r5 r3
+.L520:
+  load 1 r2
+  bne r3 r0 .L522
+  read 0 r1 r1
+  shiftl r1 2 r1
+  shiftr r1 2 r4
+  add r14 -64 r6
+  add r14 -68 r5
+  savpc r15
+  add r15 12 r15
+  jump iscmp
+  or r0 r1 r2
+  read -8 r14 r1
+  read -28 r14 r6
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+  jump .L523
+.L522:
+  or r0 r2 r3
+.L523:
+  load 1 r2
+  bne r3 r0 .L525
+  read -68 r14 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L525:
+  bne r2 r0 .L559
+  add r1 8 r2
+  add r2 0 r2
+  read 0 r2 r2
+  write -76 r14 r2
+  add r1 8 r1
+  add r1 4 r1
+  add r14 -56 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  or r0 r1 r2
+  read -8 r14 r1
+  read -36 r14 r3
+  read -28 r14 r6
+  bne r2 r0 .L529
+  add r1 8 r1
+  add r1 0 r1
+  add r14 -56 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  or r0 r1 r2
+  read -8 r14 r1
+  beq r2 r0 .L558
+  add r1 8 r1
+  add r1 4 r1
+  read 0 r1 r1
+  write -76 r14 r1
+  read -64 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump cmpop
+  read -36 r14 r3
+  write -64 r14 r1
+.L529:
+  read 0 r3 r5
+  or r0 r5 r1
+.L531:
+  write -12 r14 r1
+  beq r1 r0 .L535
+  read -76 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r2
+  read -12 r14 r1
+  bne r2 r0 .L534
+  add r1 20 r1
+  read 0 r1 r1
+  jump .L531
+.L534:
+  or r0 r1 r5
+  read -28 r14 r6
+  read -20 r14 r4
+  jump .L536
+.L535:
+  or r0 r1 r5
+  read -28 r14 r6
+  read -20 r14 r4
+.L536:
+  load 1 r1
+  beq r5 r0 .L538
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r1
+  add r1 8 r1
+  write 0 r1 r6
+  add r14 -52 r7
+  add r14 -72 r6
+  savpc r15
+  add r15 12 r15
+  jump ivstep
+  read -28 r14 r6
+  load32 -12 r2
+  sub r13 r2 r13
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+  jump .L539
+.L538:
+  or r0 r1 r2
+.L539:
+  load 1 r1
+  bne r2 r0 .L541
+  add r14 -60 r5
+  read -72 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump conbits
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L541:
+  bne r1 r0 .L557
+  load 0 r1
+.L543:
+  write -16 r14 r1
+  load 8 r2
+  bgts r1 r2 .L548
+  read -64 r14 r4
+  read -60 r14 r5
+  read -56 r14 r6
+  savpc r15
+  add r15 12 r15
+  jump cmpeval
+  or r0 r1 r2
+  read -16 r14 r1
+  read -32 r14 r7
+  bne r2 r7 .L547
+  read -60 r14 r2
+  read -52 r14 r3
+  add r2 r3 r2
+  write -60 r14 r2
+  add r1 1 r1
+  jump .L543
+.L547:
+  read -40 r14 r2
+  jump .L549
+.L548:
+  read -16 r14 r1
+  read -40 r14 r2
+.L549:
+  load 1 r3
+  beq r1 r0 .L551
+  load 8 r3
+  slt r3 r1 r3
+  xor r3 0 r3
+  sltu r0 r3 r4
+  jump .L552
+.L551:
+  or r0 r3 r4
+.L552:
+  load 1 r3
+  bne r4 r0 .L554
+  mults r1 r2 r3
+  load 64 r2
+  sltu r2 r3 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  jump .L555
+.L554:
+  or r0 r3 r2
+.L555:
+  beq r2 r0 .L562
+  load 0 r1
+  jump .L562
+.L557:
+  load 0 r1
+  jump .L562
+.L558:
+  load 0 r1
+  jump .L562
+.L559:
+  load 0 r1
+  jump .L562
+.L560:
+  load 0 r1
+  jump .L562
+.L561:
+  load 0 r1
+.L562:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function tripcount */
+
+
+.text
+; function unmap
+unmap:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -8 r14 r7
+  write -16 r14 r6
+  add r14 -20 r1
+  write 0 r1 r5
+  write -12 r14 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -8 r14 r7
+  read -16 r14 r6
+  read -12 r14 r4
+  load 0 r1
+  beq r2 r0 .L567
+  or r0 r1 r2
+  jump .L568
+.L567:
+  read -20 r14 r1
+  shiftr r1 3 r1
+  slt r1 32 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L568:
+  load 0 r1
+  beq r2 r0 .L570
+  add r7 4 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 96 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump isin
+  read -16 r14 r6
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L570:
+  bne r1 r0 .L572
+  read -20 r14 r1
+  jump .L573
+.L572:
+  read -20 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 2 r1
+  add r6 r1 r1
+  read 0 r1 r1
+.L573:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function unmap */
+
+.data
+.balign 1
+.Lstring.30:
+	.ascii "unr\000"
+/* end data */
+
+
+.text
+; function unroll
+unroll:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 292 r13
+  write -284 r14 r8
+  write -240 r14 r5
+  write -216 r14 r6
+  write -220 r14 r4
+  read 0 r4 r3
+  write -224 r14 r3
+  add r6 16 r1
+  read 0 r1 r1
+  write -4 r14 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -236 r14 r1
+  read -4 r14 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -232 r14 r1
+  addr2reg ninloop r12
+  read 0 r12 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -224 r14 r3
+  read -216 r14 r6
+  read -220 r14 r4
+  write -228 r14 r1
+  load 0 r2
+.L577:
+  add r4 16 r5
+  read 0 r5 r5
+  bge r2 r5 .L580
+  add r4 12 r5
+  read 0 r5 r5
+  shiftl r2 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  add r5 48 r5
+  read 0 r5 r5
+  shiftl r5 2 r5
+  add r1 r5 r5
+  write 0 r5 r2
+  add r2 1 r2
+  jump .L577
+.L580:
+  read -240 r14 r7
+  mults r7 r5 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -212 r14 r1
+  read -240 r14 r7
+  read -220 r14 r4
+  load 0 r1
+.L582:
+  write -208 r14 r1
+  add r4 16 r2
+  read 0 r2 r2
+  mults r7 r2 r3
+  bge r1 r3 .L585
+  savpc r15
+  add r15 12 r15
+  jump newblk
+  or r0 r1 r2
+  read -208 r14 r1
+  read -212 r14 r5
+  read -216 r14 r6
+  read -220 r14 r4
+  shiftl r1 2 r3
+  add r5 r3 r3
+  write 0 r3 r2
+  add r6 28 r6
+  read 0 r6 r2
+  add r2 1 r3
+  write 0 r6 r3
+  shiftl r1 2 r3
+  add r5 r3 r3
+  read 0 r3 r3
+  add r3 48 r3
+  write 0 r3 r2
+  shiftl r1 2 r2
+  add r5 r2 r2
+  read 0 r2 r2
+  or r0 r4 r3
+  add r2 124 r4
+  add r3 12 r2
+  read 0 r2 r2
+  add r3 16 r3
+  read 0 r3 r3
+  modu r1 r3 r3
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r2 124 r6
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.14 r5
+  savpc r15
+  add r15 12 r15
+  jump strf
+  read -208 r14 r1
+  read -212 r14 r5
+  read -216 r14 r6
+  read -240 r14 r7
+  read -220 r14 r4
+  load32 -24 r2
+  sub r13 r2 r13
+  add r1 1 r1
+  jump .L582
+.L585:
+  read -212 r14 r5
+  read -236 r14 r1
+  read -216 r14 r6
+  read -240 r14 r7
+  read -220 r14 r4
+  load 0 r3
+  write -8 r14 r3
+  read -232 r14 r3
+  write -184 r14 r1
+  or r0 r7 r1
+  write -200 r14 r3
+  read -8 r14 r7
+.L588:
+  write -204 r14 r7
+  bges r7 r1 .L682
+  mults r7 r2 r1
+  shiftl r1 2 r1
+  add r5 r1 r5
+  write -180 r14 r5
+  load 0 r1
+.L590:
+  write -172 r14 r1
+  add r4 16 r2
+  read 0 r2 r2
+  bge r1 r2 .L603
+  or r0 r1 r2
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r2
+  write -196 r14 r2
+  read 0 r2 r2
+.L592:
+  write -176 r14 r2
+  beq r2 r0 .L595
+  add r2 16 r1
+  read 0 r1 r5
+  addr2reg .Lstring.30 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  or r0 r1 r3
+  read -176 r14 r2
+  read -172 r14 r1
+  read -184 r14 r8
+  read -180 r14 r5
+  read -216 r14 r6
+  write -280 r14 r3
+  read 0 r2 r3
+  shiftr r3 3 r3
+  shiftl r3 2 r3
+  add r8 r3 r4
+  read -280 r14 r3
+  write 0 r4 r3
+  shiftl r1 2 r3
+  add r5 r3 r3
+  read 0 r3 r3
+  add r3 48 r3
+  read 0 r3 r3
+  write -192 r14 r3
+  add r6 4 r3
+  read 0 r3 r3
+  write -188 r14 r3
+  read 0 r2 r3
+  shiftr r3 3 r3
+  shiftl r3 2 r3
+  add r8 r3 r3
+  read 0 r3 r3
+  shiftr r3 3 r3
+  load 160 r4
+  mults r3 r4 r4
+  read -188 r14 r3
+  add r3 r4 r4
+  read -192 r14 r3
+  add r4 96 r4
+  write 0 r4 r3
+  add r2 20 r2
+  read 0 r2 r2
+  jump .L592
+.L595:
+  read -196 r14 r2
+  add r2 4 r1
+  read 0 r1 r3
+.L597:
+  write -160 r14 r3
+  add r2 4 r1
+  read 0 r1 r1
+  add r2 8 r2
+  read 0 r2 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+  bge r3 r1 .L601
+  add r3 4 r1
+  load 0 r2
+  write -244 r14 r2
+  read -244 r14 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  or r0 r1 r4
+  read -160 r14 r3
+  read -172 r14 r1
+  read -184 r14 r8
+  read -196 r14 r2
+  read -180 r14 r5
+  read -216 r14 r6
+  bne r4 r0 .L600
+  read 0 r3 r1
+  shiftr r1 30 r5
+  addr2reg .Lstring.30 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  or r0 r1 r2
+  read -160 r14 r3
+  read -172 r14 r1
+  read -184 r14 r8
+  read -180 r14 r5
+  read -216 r14 r6
+  write -276 r14 r2
+  add r3 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r2
+  add r8 r2 r4
+  read -276 r14 r2
+  write 0 r4 r2
+  shiftl r1 2 r2
+  add r5 r2 r2
+  read 0 r2 r2
+  add r2 48 r2
+  read 0 r2 r2
+  write -168 r14 r2
+  add r6 4 r2
+  read 0 r2 r2
+  write -164 r14 r2
+  add r3 4 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  shiftl r2 2 r2
+  add r8 r2 r2
+  read 0 r2 r2
+  shiftr r2 3 r2
+  load 160 r4
+  mults r2 r4 r4
+  read -164 r14 r2
+  add r2 r4 r4
+  read -168 r14 r2
+  add r4 96 r4
+  write 0 r4 r2
+  read -196 r14 r2
+.L600:
+  add r3 16 r3
+  jump .L597
+.L601:
+  read -172 r14 r1
+  read -184 r14 r8
+  read -180 r14 r5
+  read -216 r14 r6
+  read -220 r14 r4
+  add r1 1 r1
+  jump .L590
+.L603:
+  read -184 r14 r8
+  read -204 r14 r7
+  read -180 r14 r5
+  load 0 r1
+.L605:
+  write -148 r14 r1
+  add r4 16 r2
+  read 0 r2 r2
+  write -36 r14 r2
+  bge r1 r2 .L679
+  or r0 r1 r2
+  add r4 12 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  write -152 r14 r1
+  read -148 r14 r1
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r2
+  write -156 r14 r2
+  read -152 r14 r1
+  load 0 r2
+  write -40 r14 r2
+  read -224 r14 r3
+  xor r1 r3 r3
+  sltu r3 1 r3
+  read -40 r14 r2
+  bne r3 r0 .L608
+  or r0 r1 r6
+  or r0 r2 r1
+  jump .L613
+.L608:
+  read 0 r1 r2
+  load 0 r1
+.L609:
+  beq r2 r0 .L612
+  add r1 1 r1
+  add r2 20 r2
+  read 0 r2 r2
+  jump .L609
+.L612:
+  read -152 r14 r6
+.L613:
+  add r6 8 r2
+  read 0 r2 r2
+  add r1 r2 r1
+  shiftl r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r5
+  read -184 r14 r8
+  read -156 r14 r2
+  read -152 r14 r6
+  read -224 r14 r3
+  read -220 r14 r4
+  or r0 r6 r1
+  add r2 4 r6
+  write 0 r6 r5
+  read 0 r1 r5
+  or r0 r3 r6
+  or r0 r1 r3
+  write -144 r14 r2
+.L615:
+  or r0 r5 r1
+  write -140 r14 r1
+  beq r1 r0 .L643
+  or r0 r6 r5
+  beq r3 r5 .L626
+  load 24 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r2
+  read -140 r14 r1
+  read -184 r14 r8
+  write -92 r14 r2
+  read 0 r1 r3
+  shiftr r3 3 r3
+  shiftl r3 2 r3
+  add r8 r3 r3
+  read 0 r3 r3
+  write 0 r2 r3
+  add r1 16 r3
+  read 0 r3 r3
+  add r2 16 r4
+  write 0 r4 r3
+  or r0 r2 r3
+  add r1 12 r2
+  read 0 r2 r2
+  add r3 12 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r4
+  load 1 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r2
+  read -140 r14 r1
+  read -92 r14 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r1 12 r1
+  read 0 r1 r4
+  load 1 r6
+  load 4 r5
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r2
+  read -140 r14 r1
+  read -184 r14 r8
+  read -92 r14 r3
+  read -216 r14 r6
+  read -220 r14 r4
+  add r3 8 r3
+  write 0 r3 r2
+  load 0 r2
+  or r0 r2 r3
+.L620:
+  write -96 r14 r3
+  add r1 12 r2
+  read 0 r2 r2
+  bge r3 r2 .L623
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  or r0 r6 r7
+  or r0 r8 r6
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump unmap
+  or r0 r1 r5
+  read -96 r14 r3
+  read -140 r14 r1
+  read -92 r14 r2
+  read -216 r14 r6
+  read -220 r14 r4
+  write -268 r14 r5
+  add r2 4 r5
+  read 0 r5 r5
+  shiftl r3 2 r7
+  add r5 r7 r7
+  read -268 r14 r5
+  write 0 r7 r5
+  add r1 8 r5
+  read 0 r5 r5
+  shiftl r3 2 r7
+  add r5 r7 r7
+  read -228 r14 r5
+  read 0 r7 r7
+  add r7 48 r7
+  read 0 r7 r7
+  shiftl r7 2 r7
+  add r5 r7 r7
+  read -180 r14 r5
+  read 0 r7 r7
+  shiftl r7 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  write -100 r14 r5
+  add r2 8 r5
+  read 0 r5 r5
+  shiftl r3 2 r7
+  add r5 r7 r7
+  read -100 r14 r5
+  write 0 r7 r5
+  read -184 r14 r8
+  read -180 r14 r5
+  add r3 1 r3
+  jump .L620
+.L623:
+  read -144 r14 r3
+  read -204 r14 r7
+  read -92 r14 r2
+  write 0 r3 r2
+  read -180 r14 r5
+  add r2 20 r2
+  write -108 r14 r2
+  jump .L641
+.L626:
+  or r0 r2 r3
+  add r2 4 r2
+  read 0 r2 r2
+  add r3 8 r6
+  read 0 r6 r3
+  add r3 1 r5
+  write 0 r6 r5
+  shiftl r3 4 r3
+  add r2 r3 r2
+  write -132 r14 r2
+  add r1 16 r3
+  read 0 r3 r3
+  shiftl r3 30 r3
+  load32 -1073741824 r5
+  and r3 r5 r3
+  or r3 88 r5
+  read 0 r1 r3
+  shiftr r3 3 r3
+  shiftl r3 2 r3
+  add r8 r3 r3
+  read 0 r3 r3
+  write 0 r2 r5
+  add r2 4 r2
+  write 0 r2 r3
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+  load 0 r2
+  or r0 r2 r5
+.L628:
+  write -136 r14 r5
+  add r1 12 r2
+  read 0 r2 r2
+  bge r5 r2 .L639
+  add r1 8 r2
+  read 0 r2 r3
+  shiftl r5 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  add r4 4 r6
+  read 0 r6 r6
+  load 0 r7
+  write -116 r14 r7
+  xor r2 r6 r2
+  sltu r2 1 r2
+  write -112 r14 r2
+  read -204 r14 r7
+  read -132 r14 r2
+  read -216 r14 r6
+  read -112 r14 r12
+  bne r12 r0 .L631
+  read -116 r14 r7
+  jump .L632
+.L631:
+  xor r7 0 r7
+  sltu r7 1 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L632:
+  bne r7 r0 .L637
+  shiftl r5 2 r7
+  add r3 r7 r3
+  read 0 r3 r3
+  write -120 r14 r3
+  add r4 8 r3
+  read 0 r3 r7
+  write -124 r14 r7
+  read -120 r14 r3
+  load 0 r7
+  write -128 r14 r7
+  read -124 r14 r7
+  xor r3 r7 r8
+  sltu r8 1 r8
+  read -204 r14 r3
+  read -128 r14 r7
+  beq r8 r0 .L635
+  load 0 r7
+  slt r7 r3 r7
+  xor r7 0 r7
+  sltu r0 r7 r7
+.L635:
+  read -200 r14 r8
+  beq r7 r0 .L638
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r5 2 r2
+  add r1 r2 r1
+  or r0 r6 r7
+  or r0 r8 r6
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump unmap
+  or r0 r1 r3
+  read -136 r14 r5
+  read -140 r14 r1
+  read -132 r14 r2
+  read -216 r14 r6
+  read -220 r14 r4
+  write -272 r14 r3
+  add r2 8 r3
+  add r3 0 r7
+  read -272 r14 r3
+  write 0 r7 r3
+  read -200 r14 r8
+  read -204 r14 r3
+  jump .L638
+.L637:
+  add r1 4 r3
+  read 0 r3 r3
+  shiftl r5 2 r7
+  add r3 r7 r3
+  add r2 8 r7
+  add r7 0 r7
+  read 0 r3 r3
+  write 0 r7 r3
+  read -200 r14 r8
+  read -204 r14 r3
+.L638:
+  add r5 1 r5
+  jump .L628
+.L639:
+  read -144 r14 r2
+  read -184 r14 r8
+  read -204 r14 r7
+  read -180 r14 r5
+  read -216 r14 r6
+  write -108 r14 r2
+.L641:
+  add r1 20 r1
+  read 0 r1 r1
+  write -104 r14 r1
+  read -200 r14 r2
+  read -228 r14 r1
+  read -156 r14 r2
+  read -152 r14 r3
+  read -224 r14 r6
+  read -104 r14 r5
+  read -108 r14 r12
+  write -144 r14 r12
+  jump .L615
+.L643:
+  or r0 r3 r1
+  read -216 r14 r6
+  add r1 4 r3
+  read 0 r3 r3
+  or r0 r1 r12
+  or r0 r3 r1
+  or r0 r12 r3
+.L646:
+  write -88 r14 r1
+  or r0 r3 r5
+  add r3 4 r3
+  read 0 r3 r3
+  add r5 8 r5
+  read 0 r5 r5
+  shiftl r5 4 r5
+  add r3 r5 r3
+  bge r1 r3 .L650
+  read 0 r1 r3
+  shiftl r3 2 r3
+  shiftr r3 2 r3
+  load 90 r5
+  xor r3 r5 r5
+  sltu r5 1 r5
+  read -152 r14 r3
+  bne r5 r0 .L649
+  add r2 4 r3
+  read 0 r3 r3
+  write -80 r14 r3
+  add r2 8 r5
+  read 0 r5 r3
+  add r3 1 r2
+  write 0 r5 r2
+  read -80 r14 r2
+  shiftl r3 4 r3
+  add r2 r3 r3
+  write -84 r14 r3
+  read 0 r1 r2
+  write 0 r3 r2
+  add r1 4 r2
+  add r3 4 r3
+  read 0 r2 r5
+  write 0 r3 r5
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r5
+  write 0 r3 r5
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  add r1 4 r1
+  or r0 r6 r7
+  or r0 r8 r6
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump unmap
+  or r0 r1 r2
+  read -88 r14 r1
+  read -184 r14 r8
+  read -84 r14 r3
+  read -216 r14 r6
+  read -220 r14 r4
+  write -256 r14 r2
+  add r3 4 r3
+  read -256 r14 r2
+  write 0 r3 r2
+  add r1 8 r1
+  add r1 0 r1
+  or r0 r6 r7
+  or r0 r8 r6
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump unmap
+  or r0 r1 r2
+  read -88 r14 r1
+  read -184 r14 r8
+  read -84 r14 r3
+  read -216 r14 r6
+  read -220 r14 r4
+  write -260 r14 r2
+  add r3 8 r2
+  add r2 0 r3
+  read -260 r14 r2
+  write 0 r3 r2
+  add r1 8 r1
+  add r1 4 r1
+  or r0 r6 r7
+  or r0 r8 r6
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump unmap
+  or r0 r1 r5
+  read -88 r14 r1
+  read -184 r14 r8
+  read -84 r14 r3
+  read -156 r14 r2
+  read -216 r14 r6
+  read -220 r14 r4
+  write -264 r14 r5
+  add r3 8 r3
+  add r3 4 r5
+  read -264 r14 r3
+  write 0 r5 r3
+  read -152 r14 r3
+.L649:
+  add r1 16 r1
+  jump .L646
+.L650:
+  read -152 r14 r1
+  add r1 12 r3
+  readh 0 r3 r3
+  add r2 12 r5
+  writeh 0 r5 r3
+  or r0 r2 r3
+  add r1 12 r2
+  add r2 2 r2
+  readh 0 r2 r2
+  add r3 12 r3
+  add r3 2 r3
+  writeh 0 r3 r2
+  add r1 12 r1
+  add r1 4 r1
+  or r0 r6 r7
+  or r0 r8 r6
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump unmap
+  or r0 r1 r3
+  read -204 r14 r7
+  read -156 r14 r2
+  read -180 r14 r5
+  read -228 r14 r1
+  read -220 r14 r4
+  write -252 r14 r3
+  add r2 12 r3
+  add r3 4 r6
+  read -252 r14 r3
+  write 0 r6 r3
+  read -152 r14 r6
+  read -224 r14 r3
+  beq r6 r3 .L672
+  load 0 r2
+.L653:
+  or r0 r2 r3
+  write -64 r14 r3
+  load 2 r2
+  sltu r3 r2 r2
+  write -44 r14 r2
+  read -156 r14 r2
+  or r0 r3 r6
+  read -152 r14 r3
+  read -44 r14 r12
+  beq r12 r0 .L671
+  bne r6 r0 .L656
+  add r3 20 r3
+  read 0 r3 r3
+  jump .L657
+.L656:
+  add r3 24 r3
+  read 0 r3 r3
+.L657:
+  write -56 r14 r3
+  xor r3 r0 r6
+  sltu r6 1 r6
+  write -48 r14 r6
+  read -64 r14 r6
+  read -48 r14 r12
+  bne r12 r0 .L668
+  read -224 r14 r6
+  xor r3 r6 r2
+  sltu r0 r2 r2
+  write -52 r14 r2
+  read -64 r14 r6
+  read -156 r14 r2
+  read -52 r14 r12
+  bne r12 r0 .L664
+  read -240 r14 r2
+  add r7 1 r3
+  slt r3 r2 r2
+  write -60 r14 r2
+  read -64 r14 r3
+  or r0 r3 r6
+  read -56 r14 r3
+  read -156 r14 r2
+  read -60 r14 r12
+  beq r12 r0 .L665
+  or r0 r6 r3
+  or r0 r3 r6
+  add r4 16 r3
+  read 0 r3 r3
+  shiftl r3 2 r3
+  add r5 r3 r3
+  read 0 r3 r3
+  jump .L665
+.L664:
+  add r3 48 r3
+  read 0 r3 r3
+  shiftl r3 2 r3
+  add r1 r3 r3
+  read 0 r3 r3
+  shiftl r3 2 r3
+  add r5 r3 r3
+  read 0 r3 r3
+.L665:
+  bne r6 r0 .L667
+  add r2 20 r6
+  write 0 r6 r3
+  read -64 r14 r3
+  jump .L669
+.L667:
+  add r2 24 r6
+  write 0 r6 r3
+  read -64 r14 r3
+  jump .L669
+.L668:
+  or r0 r6 r3
+.L669:
+  add r3 1 r3
+  write -68 r14 r3
+  read -152 r14 r3
+  read -224 r14 r6
+  read -68 r14 r2
+  jump .L653
+.L671:
+  read -148 r14 r1
+  read -184 r14 r8
+  read -216 r14 r6
+  jump .L677
+.L672:
+  or r0 r2 r1
+  or r0 r3 r2
+  add r1 12 r5
+  load 11 r3
+  writeh 0 r5 r3
+  add r1 12 r1
+  add r1 4 r3
+  load 0 r1
+  write 0 r3 r1
+  add r2 20 r1
+  read 0 r1 r1
+  add r1 48 r1
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump isin
+  write -72 r14 r1
+  read -184 r14 r8
+  read -204 r14 r7
+  read -180 r14 r5
+  read -228 r14 r1
+  read -224 r14 r2
+  read -216 r14 r6
+  read -220 r14 r4
+  read -72 r14 r12
+  bne r12 r0 .L675
+  add r2 24 r2
+  read 0 r2 r2
+  jump .L676
+.L675:
+  add r2 20 r2
+  read 0 r2 r2
+.L676:
+  add r2 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read -156 r14 r2
+  read 0 r1 r1
+  shiftl r1 2 r1
+  add r5 r1 r1
+  read 0 r1 r1
+  add r2 20 r2
+  write 0 r2 r1
+  read -148 r14 r1
+.L677:
+  add r1 1 r1
+  write -76 r14 r1
+  read -200 r14 r2
+  read -228 r14 r1
+  read -76 r14 r1
+  jump .L605
+.L679:
+  read -200 r14 r2
+  read -228 r14 r1
+  add r7 1 r7
+  write -32 r14 r7
+  read -224 r14 r3
+  read -240 r14 r7
+  read -212 r14 r5
+  or r0 r7 r1
+  write -184 r14 r2
+  write -200 r14 r8
+  read -32 r14 r7
+  read -36 r14 r2
+  jump .L588
+.L682:
+  read -200 r14 r2
+  read -228 r14 r1
+  read -224 r14 r3
+  read 0 r3 r3
+.L684:
+  write -20 r14 r3
+  beq r3 r0 .L699
+  load 0 r5
+.L686:
+  write -28 r14 r5
+  add r3 12 r7
+  read 0 r7 r7
+  bge r5 r7 .L697
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r5 2 r5
+  add r3 r5 r3
+  read 0 r3 r3
+  add r4 4 r5
+  read 0 r5 r5
+  xor r3 r5 r3
+  sltu r3 1 r3
+  write -12 r14 r3
+  read -28 r14 r5
+  read -20 r14 r3
+  read -240 r14 r7
+  read -12 r14 r12
+  beq r12 r0 .L696
+  load 0 r1
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+.L690:
+  write -24 r14 r3
+  add r1 12 r5
+  read 0 r5 r5
+  bge r3 r5 .L694
+  add r1 8 r5
+  read 0 r5 r5
+  shiftl r3 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  add r4 8 r7
+  read 0 r7 r7
+  xor r5 r7 r7
+  sltu r7 1 r7
+  read -28 r14 r5
+  beq r7 r0 .L693
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r3 2 r3
+  add r1 r3 r1
+  or r0 r6 r7
+  or r0 r2 r6
+  read 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump unmap
+  or r0 r1 r7
+  read -24 r14 r3
+  read -28 r14 r5
+  read -20 r14 r1
+  read -200 r14 r2
+  read -216 r14 r6
+  read -220 r14 r4
+  write -248 r14 r7
+  or r0 r5 r7
+  add r1 4 r5
+  read 0 r5 r5
+  shiftl r7 2 r7
+  add r5 r7 r7
+  read -248 r14 r5
+  write 0 r7 r5
+  read -28 r14 r5
+.L693:
+  add r3 1 r3
+  jump .L690
+.L694:
+  or r0 r1 r3
+  read -228 r14 r1
+  read -240 r14 r7
+  load 1 r5
+  sub r7 r5 r5
+  add r4 16 r7
+  read 0 r7 r7
+  mults r5 r7 r5
+  add r4 8 r7
+  read 0 r7 r7
+  add r7 48 r7
+  read 0 r7 r7
+  shiftl r7 2 r7
+  add r1 r7 r7
+  read 0 r7 r7
+  add r5 r7 r7
+  read -212 r14 r5
+  shiftl r7 2 r7
+  add r5 r7 r5
+  read 0 r5 r5
+  write -16 r14 r5
+  read -28 r14 r5
+  or r0 r5 r7
+  add r3 8 r5
+  read 0 r5 r5
+  shiftl r7 2 r7
+  add r5 r7 r7
+  read -16 r14 r5
+  write 0 r7 r5
+  read -28 r14 r5
+  read -240 r14 r7
+.L696:
+  add r5 1 r5
+  jump .L686
+.L697:
+  read -212 r14 r5
+  read -240 r14 r7
+  add r3 20 r3
+  read 0 r3 r3
+  jump .L684
+.L699:
+  read -212 r14 r5
+  read -224 r14 r3
+  read -240 r14 r7
+  add r5 0 r1
+  read 0 r1 r1
+  add r4 4 r2
+  read 0 r2 r2
+  add r2 20 r2
+  write 0 r2 r1
+  read 0 r6 r1
+.L701:
+  or r0 r1 r2
+  add r1 44 r1
+  read 0 r1 r1
+  bne r1 r3 .L701
+  or r0 r2 r1
+  load 0 r2
+.L704:
+  add r4 16 r6
+  read 0 r6 r6
+  mults r7 r6 r6
+  bge r2 r6 .L707
+  or r0 r1 r6
+  shiftl r2 2 r1
+  add r5 r1 r1
+  read 0 r1 r1
+  add r6 44 r6
+  write 0 r6 r1
+  shiftl r2 2 r1
+  add r5 r1 r1
+  read 0 r1 r1
+  add r2 1 r2
+  jump .L704
+.L707:
+  add r1 44 r1
+  write 0 r1 r3
+  read -284 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function unroll */
+
+
+.text
+; function pure
+pure:
+  read 0 r4 r1
+  shiftl r1 2 r2
+  shiftr r2 2 r2
+  load 24 r3
+  mults r2 r3 r3
+  addr2reg optab r2
+  add r2 r3 r2
+  add r2 20 r2
+  read 0 r2 r3
+  load 1 r2
+  bne r3 r0 .L713
+  shiftl r1 2 r1
+  shiftr r1 2 r1
+  xor r1 88 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L713:
+  load 0 r1
+  beq r2 r0 .L716
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  add r4 4 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L715:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L716:
+  jumpr 0 r15
+
+/* end function pure */
+
+
+.text
+; function mark
+mark:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r7
+  write -8 r14 r6
+  write -16 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  read -12 r14 r7
+  read -8 r14 r6
+  read -16 r14 r5
+  load 0 r1
+  beq r2 r0 .L720
+  or r0 r1 r2
+  jump .L721
+.L720:
+  read -20 r14 r1
+  shiftr r1 3 r1
+  slt r1 32 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r2
+.L721:
+  load 0 r1
+  beq r2 r0 .L723
+  read -20 r14 r1
+  shiftr r1 3 r1
+  add r5 r1 r1
+  readb 0 r1 r1
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L723:
+  beq r1 r0 .L725
+  read -20 r14 r1
+  shiftr r1 3 r1
+  add r5 r1 r2
+  load 1 r1
+  writeb 0 r2 r1
+  read -20 r14 r1
+  shiftr r1 3 r1
+  read 0 r7 r2
+  add r2 1 r3
+  write 0 r7 r3
+  shiftl r2 2 r2
+  add r6 r2 r2
+  write 0 r2 r1
+.L725:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function mark */
+
+
+.text
+; function dce
+dce:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 60 r13
+  write -44 r14 r4
+  add r4 16 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -36 r14 r1
+  read -44 r14 r4
+  add r4 16 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -32 r14 r1
+  read -44 r14 r4
+  add r4 16 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r6
+  read -32 r14 r3
+  read -36 r14 r2
+  read -44 r14 r4
+  write -48 r14 r6
+  load 0 r1
+  write -52 r14 r1
+  read 0 r4 r1
+.L729:
+  write -28 r14 r1
+  bne r1 r0 .L760
+.L730:
+  read -52 r14 r1
+  beq r1 r0 .L740
+  load 1 r5
+  sub r1 r5 r1
+  write -52 r14 r1
+  shiftl r1 2 r1
+  add r3 r1 r1
+  read 0 r1 r5
+  shiftl r5 2 r1
+  add r6 r1 r1
+  read 0 r1 r1
+  write -20 r14 r1
+  bne r1 r0 .L734
+  add r4 4 r1
+  read 0 r1 r1
+  load 160 r7
+  mults r5 r7 r5
+  add r1 r5 r1
+  add r1 80 r1
+  read 0 r1 r1
+  write -16 r14 r1
+  beq r1 r0 .L730
+  add r1 8 r1
+  add r1 0 r1
+  add r14 -52 r7
+  or r0 r3 r6
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mark
+  read -16 r14 r1
+  read -32 r14 r3
+  read -36 r14 r2
+  add r1 8 r1
+  add r1 4 r1
+  add r14 -52 r7
+  or r0 r3 r6
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mark
+  read -48 r14 r6
+  read -32 r14 r3
+  read -36 r14 r2
+  read -44 r14 r4
+  jump .L730
+.L734:
+  load 0 r4
+.L735:
+  write -24 r14 r4
+  add r1 12 r5
+  read 0 r5 r5
+  bge r4 r5 .L739
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r4 2 r4
+  add r1 r4 r1
+  add r14 -52 r7
+  or r0 r3 r6
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mark
+  read -24 r14 r4
+  read -20 r14 r2
+  read -32 r14 r3
+  read -36 r14 r1
+  add r4 1 r4
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L735
+.L739:
+  read -48 r14 r6
+  read -44 r14 r4
+  jump .L730
+.L740:
+  read 0 r4 r1
+.L741:
+  write -8 r14 r1
+  beq r1 r0 .L759
+  or r0 r1 r3
+.L743:
+  read 0 r1 r4
+  beq r4 r0 .L748
+  read 0 r4 r5
+  shiftr r5 3 r5
+  add r2 r5 r5
+  readb 0 r5 r5
+  bne r5 r0 .L746
+  add r4 20 r4
+  read 0 r4 r4
+  write 0 r1 r4
+  jump .L743
+.L746:
+  or r0 r4 r1
+  add r1 20 r1
+  jump .L743
+.L748:
+  or r0 r3 r1
+  add r1 4 r2
+  read 0 r2 r2
+  or r0 r1 r3
+  or r0 r2 r1
+.L751:
+  write -12 r14 r1
+  add r3 4 r2
+  read 0 r2 r2
+  add r3 8 r3
+  read 0 r3 r3
+  shiftl r3 4 r3
+  add r2 r3 r2
+  bge r1 r2 .L757
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump pure
+  or r0 r1 r5
+  read -12 r14 r1
+  read -8 r14 r3
+  read -36 r14 r2
+  load 0 r4
+  beq r5 r0 .L754
+  add r1 4 r4
+  read 0 r4 r4
+  shiftr r4 3 r4
+  add r2 r4 r4
+  readb 0 r4 r4
+  xor r4 0 r4
+  sltu r4 1 r4
+  xor r4 0 r4
+  sltu r0 r4 r4
+.L754:
+  beq r4 r0 .L756
+  load 90 r4
+  write 0 r1 r4
+  add r1 4 r4
+  load 0 r5
+  write 0 r4 r5
+  add r4 4 r4
+  load 0 r5
+  write 0 r4 r5
+  add r4 4 r5
+  load 0 r4
+  write 0 r5 r4
+.L756:
+  add r1 16 r1
+  jump .L751
+.L757:
+  read -8 r14 r1
+  read -36 r14 r2
+  or r0 r1 r3
+  add r1 44 r1
+  read 0 r1 r1
+  jump .L741
+.L759:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+.L760:
+  read 0 r1 r5
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L762:
+  beq r5 r0 .L767
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  read 0 r5 r7
+  shiftr r7 3 r7
+  shiftl r7 2 r7
+  add r6 r7 r7
+  write 0 r7 r5
+  add r5 20 r5
+  read 0 r5 r5
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+  jump .L762
+.L767:
+  or r0 r2 r1
+  add r1 4 r2
+  read 0 r2 r4
+  or r0 r1 r3
+.L770:
+  write -40 r14 r4
+  add r3 4 r1
+  read 0 r1 r1
+  add r3 8 r2
+  read 0 r2 r2
+  shiftl r2 4 r2
+  add r1 r2 r1
+  bge r4 r1 .L775
+  savpc r15
+  add r15 12 r15
+  jump pure
+  or r0 r1 r5
+  read -40 r14 r4
+  read -28 r14 r3
+  or r0 r3 r2
+  read -32 r14 r3
+  read -36 r14 r1
+  beq r5 r0 .L773
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  jump .L774
+.L773:
+  or r0 r1 r2
+  add r4 4 r1
+  add r14 -52 r7
+  or r0 r3 r6
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mark
+  read -40 r14 r4
+  read -32 r14 r3
+  read -36 r14 r1
+  or r0 r1 r2
+  add r4 8 r1
+  add r1 0 r1
+  add r14 -52 r7
+  or r0 r3 r6
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mark
+  read -40 r14 r4
+  read -32 r14 r3
+  read -36 r14 r1
+  or r0 r1 r2
+  add r4 8 r1
+  add r1 4 r1
+  add r14 -52 r7
+  or r0 r3 r6
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mark
+  read -40 r14 r4
+  read -28 r14 r3
+  read -32 r14 r2
+  read -36 r14 r1
+.L774:
+  add r4 16 r4
+  jump .L770
+.L775:
+  read -28 r14 r1
+  read -32 r14 r3
+  read -36 r14 r2
+  add r1 12 r1
+  add r1 4 r1
+  add r14 -52 r7
+  or r0 r3 r6
+  or r0 r2 r5
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump mark
+  read -28 r14 r1
+  read -48 r14 r6
+  read -32 r14 r3
+  read -36 r14 r2
+  add r1 44 r1
+  read 0 r1 r1
+  read -44 r14 r4
+  jump .L729
+
+/* end function dce */
+
+.data
+.balign 1
+.Lstring.35:
+	.ascii "\012> After loop optimization:\012\000"
+/* end data */
+
+
+.text
+; function loopopt
+.global loopopt
+loopopt:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 56 r13
+  write -48 r14 r5
+  write -24 r14 r4
+  load 0 r1
+  addr2reg changed r12
+  write 0 r12 r1
+  savpc r15
+  add r15 12 r15
+  jump fillrpo
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillpreds
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump addpre
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filldom
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -24 r14 r4
+  add r4 28 r1
+  read 0 r1 r1
+  addr2reg ninloop r12
+  write 0 r12 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -24 r14 r4
+  addr2reg inloop r12
+  write 0 r12 r1
+  add r4 28 r1
+  read 0 r1 r1
+  load 44 r2
+  mults r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -44 r14 r1
+  load 1 r6
+  load 16 r5
+  load 0 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  or r0 r1 r2
+  read -44 r14 r1
+  read -24 r14 r4
+  addr2reg aff r12
+  write 0 r12 r2
+  load 0 r2
+  addr2reg naff r12
+  write 0 r12 r2
+  add r4 28 r2
+  read 0 r2 r2
+  load 0 r3
+.L782:
+  or r0 r2 r5
+  write -20 r14 r3
+  or r0 r3 r2
+  load 1 r3
+  sub r5 r3 r3
+  write -40 r14 r3
+  ble r5 r0 .L795
+  or r0 r2 r12
+  or r0 r3 r2
+  or r0 r12 r3
+  or r0 r1 r5
+  load 44 r1
+  mults r3 r1 r1
+  add r5 r1 r1
+  write -28 r14 r1
+  or r0 r2 r3
+  add r4 40 r2
+  read 0 r2 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r5
+  or r0 r4 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump findloop
+  or r0 r1 r6
+  read -20 r14 r3
+  read -28 r14 r1
+  read -40 r14 r2
+  read -44 r14 r5
+  read -24 r14 r4
+  beq r6 r0 .L794
+  add r3 1 r3
+  write -36 r14 r3
+  or r0 r4 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump hoist
+  read -28 r14 r1
+  read -24 r14 r4
+  add r1 8 r2
+  read 0 r2 r2
+  beq r2 r0 .L790
+  read 0 r1 r2
+  read 0 r2 r2
+.L787:
+  write -32 r14 r2
+  beq r2 r0 .L790
+  or r0 r4 r6
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump reduce
+  read -32 r14 r2
+  read -28 r14 r1
+  read -24 r14 r4
+  add r2 20 r2
+  read 0 r2 r2
+  jump .L787
+.L790:
+  add r1 4 r2
+  read 0 r2 r4
+  add r1 28 r2
+  read 0 r2 r5
+  add r1 32 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump append
+  read -28 r14 r1
+  read -24 r14 r4
+  add r1 8 r2
+  read 0 r2 r2
+  beq r2 r0 .L793
+  or r0 r2 r4
+  add r1 36 r2
+  read 0 r2 r5
+  add r1 40 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump append
+  read -24 r14 r4
+.L793:
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -36 r14 r3
+  read -40 r14 r2
+  read -44 r14 r1
+  read -24 r14 r4
+  jump .L782
+.L794:
+  or r0 r5 r1
+  jump .L782
+.L795:
+  or r0 r2 r3
+  read -48 r14 r5
+  beq r5 r0 .L818
+  load 0 r2
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+.L799:
+  write -16 r14 r3
+  bge r3 r2 .L808
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  load 44 r5
+  mults r3 r5 r5
+  add r2 r5 r5
+  add r5 24 r5
+  read 0 r5 r6
+  load 0 r5
+  bne r6 r0 .L803
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+  or r0 r1 r12
+  or r0 r3 r1
+  or r0 r12 r3
+  jump .L804
+.L803:
+  or r0 r4 r1
+  load 44 r4
+  mults r3 r4 r4
+  add r2 r4 r4
+  load 44 r5
+  mults r3 r5 r3
+  add r2 r3 r2
+  read 0 r2 r5
+  or r0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump findloop
+  or r0 r1 r5
+  read -16 r14 r2
+  read -20 r14 r3
+  read -44 r14 r1
+  read -24 r14 r4
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L804:
+  beq r5 r0 .L806
+  load 44 r5
+  mults r2 r5 r5
+  add r1 r5 r5
+  add r5 24 r6
+  load 0 r5
+  write 0 r6 r5
+.L806:
+  add r2 1 r2
+  or r0 r3 r12
+  or r0 r2 r3
+  or r0 r12 r2
+  jump .L799
+.L808:
+  or r0 r2 r3
+  load 0 r5
+  load32 -559030611 r2
+.L810:
+  write -12 r14 r5
+  bge r5 r3 .L818
+  load 44 r6
+  mults r5 r6 r6
+  add r1 r6 r6
+  add r6 24 r6
+  read 0 r6 r7
+  load 0 r6
+  bne r7 r0 .L813
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  or r0 r3 r12
+  or r0 r1 r3
+  or r0 r12 r1
+  jump .L814
+.L813:
+  or r0 r1 r2
+  load 44 r1
+  mults r5 r1 r3
+  or r0 r4 r1
+  add r2 r3 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump tripcount
+  or r0 r1 r3
+  read -12 r14 r5
+  read -20 r14 r1
+  read -44 r14 r2
+  read -24 r14 r4
+  xor r3 0 r6
+  sltu r0 r6 r6
+.L814:
+  write -8 r14 r3
+  beq r6 r0 .L816
+  or r0 r4 r1
+  load 44 r4
+  mults r5 r4 r4
+  add r2 r4 r4
+  or r0 r1 r6
+  or r0 r3 r5
+  savpc r15
+  add r15 12 r15
+  jump unroll
+  read -8 r14 r3
+  read -12 r14 r5
+  read -20 r14 r1
+  read -44 r14 r2
+  read -24 r14 r4
+  load 1 r6
+  addr2reg changed r12
+  write 0 r12 r6
+.L816:
+  add r5 1 r5
+  or r0 r1 r12
+  or r0 r3 r1
+  or r0 r12 r3
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L810
+.L818:
+  savpc r15
+  add r15 12 r15
+  jump fillrpo
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump fillpreds
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filldom
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump dce
+  read -24 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump filluse
+  addr2reg debug+79 r12
+  readb 0 r12 r1
+  beq r1 r0 .L820
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.35 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -24 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  addr2reg __stderr_file r5
+  savpc r15
+  add r15 12 r15
+  jump printfn
+.L820:
+  addr2reg changed r12
+  read 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function loopopt */
+
+.data
+.balign 4
+inloop:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+ninloop:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+nloopid:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+aff:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+naff:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+niv:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+changed:
+	.fill 4,1,0
+/* end data */
+
@@ -0,0 +1,2168 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "BuildTools/QBE/prof.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "profile: name too long\000"
+/* end data */
+
+
+.text
+; function word
+word:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -24 r14 r5
+  write -32 r14 r4
+.L17:
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  or r0 r1 r2
+  read -32 r14 r4
+  load 1 r1
+  load 32 r3
+  beq r2 r3 .L20
+  xor r2 9 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r3
+  jump .L21
+.L20:
+  or r0 r1 r3
+.L21:
+  load 1 r1
+  bne r3 r0 .L23
+  xor r2 10 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r3
+  jump .L24
+.L23:
+  or r0 r1 r3
+.L24:
+  load 1 r1
+  bne r3 r0 .L26
+  xor r2 13 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L26:
+  bne r1 r0 .L17
+  read -24 r14 r5
+  load 0 r1
+.L29:
+  write -20 r14 r2
+  write -16 r14 r1
+  load 0 r3
+  load32 -1 r6
+  bne r2 r6 .L31
+  or r0 r3 r6
+  jump .L32
+.L31:
+  xor r2 32 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r6
+.L32:
+  load 0 r3
+  bne r6 r0 .L34
+  or r0 r3 r6
+  jump .L35
+.L34:
+  xor r2 9 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r6
+.L35:
+  load 0 r3
+  bne r6 r0 .L37
+  or r0 r3 r6
+  jump .L38
+.L37:
+  xor r2 10 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r6
+.L38:
+  load 0 r3
+  beq r6 r0 .L40
+  xor r2 13 r3
+  sltu r0 r3 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L40:
+  beq r3 r0 .L45
+  load 79 r3
+  bne r1 r3 .L43
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r5
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -20 r14 r2
+  read -16 r14 r1
+  read -24 r14 r5
+  read -32 r14 r4
+  load32 -24 r3
+  sub r13 r3 r13
+.L43:
+  add r1 1 r3
+  write -28 r14 r3
+  add r5 r1 r1
+  writeb 0 r1 r2
+  savpc r15
+  add r15 12 r15
+  jump fgetc
+  or r0 r1 r2
+  read -28 r14 r1
+  read -24 r14 r5
+  read -32 r14 r4
+  jump .L29
+.L45:
+  add r5 r1 r3
+  load 0 r2
+  writeb 0 r3 r2
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function word */
+
+.data
+.balign 1
+.Lstring.12:
+	.ascii "r\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "cannot open profile '%s'\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.14:
+	.ascii "profile '%s': truncated line\000"
+/* end data */
+
+
+.text
+; function profread
+.global profread
+profread:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 280 r13
+  or r0 r4 r6
+  write -20 r14 r6
+  addr2reg .Lstring.12 r5
+  or r0 r6 r4
+  savpc r15
+  add r15 12 r15
+  jump fopen
+  or r0 r1 r4
+  read -20 r14 r6
+  write -32 r14 r4
+  bne r4 r0 .L51
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.13 r5
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -32 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+.L51:
+  or r0 r4 r1
+.L52:
+  add r14 -272 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump word
+  or r0 r1 r2
+  read -32 r14 r1
+  beq r2 r0 .L68
+  add r14 -192 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump word
+  or r0 r1 r3
+  read -32 r14 r1
+  read -20 r14 r4
+  load 1 r2
+  beq r3 r0 .L55
+  add r14 -112 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump word
+  read -20 r14 r4
+  xor r1 0 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+  jump .L56
+.L55:
+  or r0 r2 r1
+.L56:
+  beq r1 r0 .L58
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r4 r6
+  addr2reg .Lstring.14 r5
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+.L58:
+  add r14 -272 r4
+  savpc r15
+  add r15 12 r15
+  jump hash
+  or r0 r1 r2
+  shiftl r2 5 r1
+  sub r1 r2 r1
+  write -4 r14 r1
+  add r14 -192 r4
+  savpc r15
+  add r15 12 r15
+  jump hash
+  or r0 r1 r2
+  read -4 r14 r1
+  add r1 r2 r1
+  and r1 1023 r2
+  write -12 r14 r2
+  shiftl r2 2 r2
+  addr2reg ptab r1
+  add r1 r2 r1
+  read 0 r1 r1
+.L60:
+  write -8 r14 r1
+  beq r1 r0 .L65
+  read 0 r1 r4
+  add r14 -272 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -8 r14 r1
+  load 0 r2
+  bne r3 r0 .L63
+  add r1 4 r1
+  read 0 r1 r4
+  add r14 -192 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r2
+  read -8 r14 r1
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L63:
+  bne r2 r0 .L65
+  add r1 12 r1
+  read 0 r1 r1
+  jump .L60
+.L65:
+  bne r1 r0 .L67
+  load 16 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  write -16 r14 r1
+  add r14 -272 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  add r1 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r4
+  read -16 r14 r1
+  write 0 r1 r4
+  add r14 -272 r5
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  add r14 -192 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  add r1 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r4
+  read -16 r14 r1
+  add r1 4 r1
+  write 0 r1 r4
+  add r14 -192 r5
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  read -12 r14 r2
+  read -16 r14 r1
+  shiftl r2 2 r4
+  addr2reg ptab r3
+  add r3 r4 r3
+  read 0 r3 r3
+  add r1 12 r4
+  write 0 r4 r3
+  shiftl r2 2 r3
+  addr2reg ptab r2
+  add r2 r3 r2
+  write 0 r2 r1
+.L67:
+  add r1 8 r3
+  write -28 r14 r3
+  read 0 r3 r2
+  write -24 r14 r2
+  load 10 r6
+  load 0 r5
+  add r14 -112 r4
+  savpc r15
+  add r15 12 r15
+  jump strtoull
+  or r0 r1 r5
+  read -24 r14 r2
+  read -28 r14 r3
+  read -32 r14 r1
+  read -20 r14 r4
+  add r2 r5 r2
+  write 0 r3 r2
+  jump .L52
+.L68:
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fclose
+  load 1 r1
+  addr2reg nprof r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function profread */
+
+.data
+.balign 1
+.Lstring.16:
+	.ascii "profile: symbol too long for %s\000"
+/* end data */
+
+
+.text
+; function symref
+symref:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 156 r13
+  write -28 r14 r7
+  write -32 r14 r6
+  write -24 r14 r5
+  or r0 r4 r1
+  write -20 r14 r1
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  write -16 r14 r1
+  read -24 r14 r5
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  or r0 r1 r3
+  read -16 r14 r2
+  read -24 r14 r5
+  read -20 r14 r1
+  add r2 r3 r2
+  load 80 r3
+  bge r2 r3 .L75
+  or r0 r1 r5
+  jump .L76
+.L75:
+  load 24 r1
+  sub r13 r1 r13
+  or r0 r5 r6
+  addr2reg .Lstring.16 r5
+  addr2reg .Lstring.9 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -20 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+.L76:
+  add r14 -144 r4
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  read -24 r14 r5
+  add r14 -144 r4
+  savpc r15
+  add r15 12 r15
+  jump strcat
+  load 2 r1
+  write -64 r14 r1
+  add r14 -64 r1
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -144 r4
+  savpc r15
+  add r15 12 r15
+  jump intern
+  read -28 r14 r5
+  read -32 r14 r6
+  add r14 -64 r2
+  add r2 4 r2
+  add r2 4 r2
+  write 0 r2 r1
+  add r14 -64 r1
+  add r1 16 r1
+  write 0 r1 r6
+  add r14 -64 r4
+  savpc r15
+  add r15 12 r15
+  jump newcon
+  write -148 r14 r1
+  read -148 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function symref */
+
+.data
+.balign 1
+.Lstring.18:
+	.ascii "main\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.19:
+	.ascii "__prof_\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "__prof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.21:
+	.ascii "enter\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "prof\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.23:
+	.ascii "exit\000"
+/* end data */
+
+
+.text
+; function instrument
+instrument:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 116 r13
+  write -72 r14 r4
+  load 0 r1
+  addr2reg npname r12
+  write 0 r12 r1
+  read 0 r4 r2
+  load 0 r1
+.L81:
+  beq r2 r0 .L84
+  add r1 1 r1
+  addr2reg npname r12
+  write 0 r12 r1
+  add r2 44 r2
+  read 0 r2 r2
+  jump .L81
+.L84:
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -72 r14 r4
+  addr2reg pname r12
+  write 0 r12 r1
+  read 0 r4 r1
+  load 0 r2
+  or r0 r2 r3
+.L86:
+  write -76 r14 r1
+  write -60 r14 r3
+  beq r1 r0 .L108
+  add r1 124 r2
+  addr2reg pname r12
+  read 0 r12 r5
+  shiftl r3 2 r6
+  add r5 r6 r5
+  write 0 r5 r2
+  load 0 r2
+.L88:
+  write -44 r14 r2
+  add r1 8 r5
+  read 0 r5 r6
+  load 0 r5
+  bge r2 r6 .L90
+  add r1 4 r5
+  read 0 r5 r5
+  shiftl r2 4 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  shiftl r5 2 r5
+  shiftr r5 2 r5
+  load 109 r6
+  sub r5 r6 r6
+  load 6 r5
+  sltu r5 r6 r5
+  xor r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L90:
+  beq r5 r0 .L92
+  add r2 1 r2
+  jump .L88
+.L92:
+  read 0 r4 r3
+  load 0 r2
+  bne r1 r3 .L94
+  load 2 r2
+.L94:
+  write -16 r14 r2
+  add r1 12 r3
+  readh 0 r3 r3
+  load 1 r5
+  sub r3 r5 r5
+  load 0 r3
+  load 9 r6
+  bgt r5 r6 .L96
+  add r4 54 r4
+  addr2reg .Lstring.18 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -16 r14 r2
+  read -76 r14 r1
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L96:
+  beq r3 r0 .L98
+  add r2 1 r2
+.L98:
+  add r1 8 r1
+  read 0 r1 r1
+  add r1 r2 r1
+  add r1 3 r1
+  shiftl r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r7
+  read -44 r14 r2
+  read -76 r14 r1
+  write -68 r14 r7
+  add r1 4 r1
+  read 0 r1 r5
+  or r0 r2 r6
+  or r0 r7 r4
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  read -44 r14 r2
+  or r0 r2 r1
+  read -76 r14 r2
+  read -60 r14 r3
+  read -68 r14 r7
+  read -72 r14 r4
+  shiftl r1 4 r1
+  add r7 r1 r1
+  write -20 r14 r1
+  read 0 r4 r5
+  beq r2 r5 .L100
+  write -28 r14 r1
+  jump .L102
+.L100:
+  add r4 54 r5
+  or r0 r4 r7
+  load 0 r6
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump symref
+  or r0 r1 r2
+  read -20 r14 r1
+  read -72 r14 r4
+  write -104 r14 r2
+  read -104 r14 r2
+  add r1 16 r3
+  write -24 r14 r3
+  load 116 r3
+  write 0 r1 r3
+  add r1 4 r1
+  load 0 r3
+  write 0 r1 r3
+  add r1 4 r1
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  or r0 r4 r7
+  load 0 r6
+  addr2reg .Lstring.21 r5
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump symref
+  read -60 r14 r3
+  read -24 r14 r2
+  read -72 r14 r4
+  write -108 r14 r1
+  read -108 r14 r5
+  add r2 16 r1
+  load 124 r6
+  write 0 r2 r6
+  add r2 4 r2
+  load 0 r6
+  write 0 r2 r6
+  add r2 4 r2
+  write 0 r2 r5
+  add r2 4 r5
+  load 0 r2
+  write 0 r5 r2
+  write -28 r14 r1
+.L102:
+  add r4 54 r5
+  shiftl r3 2 r2
+  load 12 r1
+  add r1 r2 r6
+  or r0 r4 r7
+  addr2reg .Lstring.19 r4
+  savpc r15
+  add r15 12 r15
+  jump symref
+  read -72 r14 r4
+  write -88 r14 r1
+  read -88 r14 r3
+  write -36 r14 r3
+  or r0 r4 r6
+  load 0 r5
+  addr2reg .Lstring.22 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -72 r14 r4
+  write -92 r14 r1
+  read -92 r14 r1
+  write -32 r14 r1
+  or r0 r4 r6
+  load 0 r5
+  addr2reg .Lstring.22 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  or r0 r1 r5
+  read -28 r14 r1
+  read -32 r14 r4
+  read -36 r14 r3
+  or r0 r4 r2
+  read -72 r14 r4
+  write -96 r14 r5
+  read -96 r14 r6
+  write -48 r14 r6
+  add r1 16 r7
+  write -40 r14 r7
+  load 63 r5
+  write 0 r1 r5
+  add r1 4 r1
+  write 0 r1 r2
+  add r1 4 r1
+  write 0 r1 r3
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  or r0 r4 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  or r0 r1 r5
+  read -44 r14 r2
+  read -76 r14 r1
+  read -40 r14 r7
+  read -32 r14 r4
+  read -36 r14 r3
+  write -100 r14 r5
+  read -100 r14 r5
+  write -52 r14 r5
+  add r7 16 r5
+  load 1 r6
+  write 0 r7 r6
+  read -48 r14 r6
+  add r7 4 r7
+  write 0 r7 r6
+  add r7 4 r7
+  write 0 r7 r4
+  read -52 r14 r4
+  add r7 4 r7
+  write 0 r7 r4
+  add r5 16 r4
+  load 55 r7
+  write 0 r5 r7
+  add r5 4 r5
+  load 0 r7
+  write 0 r5 r7
+  add r5 4 r5
+  write 0 r5 r6
+  add r5 4 r5
+  write 0 r5 r3
+  add r1 4 r3
+  read 0 r3 r3
+  shiftl r2 4 r5
+  add r3 r5 r5
+  add r1 8 r1
+  read 0 r1 r1
+  sub r1 r2 r6
+  savpc r15
+  add r15 12 r15
+  jump icpy
+  or r0 r1 r2
+  read -76 r14 r1
+  read -60 r14 r3
+  read -68 r14 r7
+  read -72 r14 r4
+  write -64 r14 r2
+  add r1 12 r5
+  readh 0 r5 r5
+  load 1 r6
+  sub r5 r6 r5
+  load 0 r6
+  write -56 r14 r6
+  load 9 r6
+  sltu r6 r5 r6
+  xor r6 1 r6
+  read -56 r14 r5
+  beq r6 r0 .L104
+  add r4 54 r4
+  addr2reg .Lstring.18 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r5
+  read -76 r14 r1
+  read -60 r14 r3
+  read -64 r14 r2
+  read -68 r14 r7
+  read -72 r14 r4
+  xor r5 0 r5
+  sltu r5 1 r5
+  xor r5 0 r5
+  sltu r0 r5 r5
+.L104:
+  beq r5 r0 .L106
+  or r0 r4 r7
+  load 0 r6
+  addr2reg .Lstring.23 r5
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump symref
+  or r0 r1 r5
+  read -76 r14 r1
+  read -60 r14 r3
+  read -64 r14 r2
+  read -68 r14 r7
+  read -72 r14 r4
+  write -84 r14 r5
+  read -84 r14 r6
+  add r2 16 r5
+  write -80 r14 r5
+  load 124 r5
+  write 0 r2 r5
+  add r2 4 r5
+  load 0 r2
+  write 0 r5 r2
+  read -80 r14 r2
+  add r5 4 r5
+  write 0 r5 r6
+  add r5 4 r6
+  load 0 r5
+  write 0 r6 r5
+.L106:
+  add r1 4 r5
+  write 0 r5 r7
+  sub r2 r7 r2
+  shiftrs r2 31 r5
+  shiftr r5 28 r5
+  add r2 r5 r2
+  shiftrs r2 4 r2
+  add r1 8 r5
+  write 0 r5 r2
+  add r1 44 r1
+  read 0 r1 r1
+  add r3 1 r3
+  jump .L86
+.L108:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function instrument */
+
+
+.text
+; function profile
+.global profile
+profile:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  write -24 r14 r4
+  addr2reg profgen r12
+  read 0 r12 r1
+  bne r1 r0 .L128
+  addr2reg nprof r12
+  read 0 r12 r1
+  beq r1 r0 .L127
+  read 0 r4 r2
+.L114:
+  write -28 r14 r2
+  beq r2 r0 .L126
+  add r4 54 r4
+  add r2 124 r1
+  write -16 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump hash
+  or r0 r1 r2
+  read -16 r14 r4
+  shiftl r2 5 r1
+  sub r1 r2 r1
+  write -20 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump hash
+  or r0 r1 r2
+  read -20 r14 r1
+  read -24 r14 r4
+  add r1 r2 r1
+  and r1 1023 r1
+  shiftl r1 2 r2
+  addr2reg ptab r1
+  add r1 r2 r1
+  read 0 r1 r1
+.L118:
+  or r0 r1 r2
+  write -32 r14 r2
+  beq r2 r0 .L124
+  or r0 r4 r1
+  read 0 r2 r4
+  add r1 54 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r5
+  read -32 r14 r1
+  read -28 r14 r2
+  read -24 r14 r4
+  load 0 r3
+  bne r5 r0 .L121
+  add r1 4 r1
+  read 0 r1 r4
+  add r2 124 r5
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r3
+  read -32 r14 r1
+  read -28 r14 r2
+  read -24 r14 r4
+  xor r3 0 r3
+  sltu r3 1 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L121:
+  bne r3 r0 .L123
+  add r1 12 r1
+  read 0 r1 r1
+  jump .L118
+.L123:
+  add r1 8 r1
+  read 0 r1 r3
+  load 1 r1
+  add r1 r3 r1
+  add r2 120 r3
+  write 0 r3 r1
+  jump .L125
+.L124:
+  read -28 r14 r2
+.L125:
+  add r2 44 r1
+  read 0 r1 r2
+  jump .L114
+.L126:
+  load 0 r1
+  jump .L129
+.L127:
+  load 0 r1
+  jump .L129
+.L128:
+  savpc r15
+  add r15 12 r15
+  jump instrument
+  load 1 r1
+.L129:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function profile */
+
+.data
+.balign 1
+.Lstring.26:
+	.ascii "__prof_%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "__profn_%s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.28:
+	.ascii "\042%s\042\000"
+/* end data */
+
+
+.text
+; function profdat
+.global profdat
+profdat:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 312 r13
+  write -12 r14 r5
+  write -8 r14 r4
+  addr2reg profgen r12
+  read 0 r12 r1
+  beq r1 r0 .L142
+  load32 67108864 r1
+  write -304 r14 r1
+  add r14 -304 r1
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r4 54 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.26 r5
+  add r14 -292 r4
+  savpc r15
+  add r15 12 r15
+  jump strf
+  read -8 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  add r4 54 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.27 r5
+  add r14 -212 r4
+  savpc r15
+  add r15 12 r15
+  jump strf
+  read -12 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  load 0 r1
+  write -48 r14 r1
+  add r14 -48 r1
+  add r1 4 r1
+  add r14 -292 r2
+  write 0 r1 r2
+  add r1 4 r1
+  add r14 -304 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdat
+  read -12 r14 r5
+  load 4 r1
+  write -48 r14 r1
+  add r14 -48 r1
+  add r1 16 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdat
+  read -12 r14 r5
+  add r14 -48 r1
+  add r1 24 r2
+  load 1 r1
+  writeb 0 r2 r1
+  add r14 -48 r1
+  add r1 16 r2
+  add r14 -212 r1
+  write 0 r2 r1
+  add r14 -48 r1
+  add r1 16 r1
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdat
+  read -12 r14 r5
+  add r14 -48 r1
+  add r1 24 r2
+  load 0 r1
+  writeb 0 r2 r1
+  addr2reg npname r12
+  read 0 r12 r1
+  add r14 -48 r2
+  add r2 16 r2
+  write 0 r2 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdat
+  read -12 r14 r5
+  load 6 r1
+  write -48 r14 r1
+  addr2reg npname r12
+  read 0 r12 r1
+  shiftl r1 2 r1
+  add r14 -48 r2
+  add r2 16 r2
+  write 0 r2 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdat
+  read -12 r14 r5
+  load 1 r1
+  write -48 r14 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdat
+  read -12 r14 r5
+  load 0 r1
+  write -48 r14 r1
+  add r14 -48 r1
+  add r1 4 r1
+  add r14 -212 r2
+  write 0 r1 r2
+  add r1 4 r1
+  add r14 -304 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r1
+  load 0 r2
+  write 0 r1 r2
+  add r1 4 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdat
+  read -8 r14 r4
+  load 0 r1
+.L134:
+  write -16 r14 r1
+  addr2reg npname r12
+  read 0 r12 r2
+  bgt r1 r2 .L140
+  load 2 r2
+  write -48 r14 r2
+  add r14 -48 r2
+  add r2 25 r3
+  load 1 r2
+  writeb 0 r3 r2
+  bne r1 r0 .L137
+  add r4 54 r6
+  jump .L138
+.L137:
+  or r0 r1 r2
+  addr2reg pname r12
+  read 0 r12 r1
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r6
+.L138:
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.28 r5
+  add r14 -132 r4
+  savpc r15
+  add r15 12 r15
+  jump strf
+  read -12 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  add r14 -48 r1
+  add r1 16 r2
+  add r14 -132 r1
+  write 0 r2 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdat
+  read -12 r14 r5
+  add r14 -48 r1
+  add r1 25 r2
+  load 0 r1
+  writeb 0 r2 r1
+  add r14 -48 r1
+  add r1 16 r2
+  load 0 r1
+  write 0 r2 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdat
+  read -16 r14 r1
+  read -12 r14 r5
+  read -8 r14 r4
+  add r1 1 r1
+  jump .L134
+.L140:
+  read -12 r14 r5
+  load 1 r1
+  write -48 r14 r1
+  add r14 -48 r4
+  savpc r15
+  add r15 12 r15
+  jump emitdat
+.L142:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function profdat */
+
+
+.text
+; function edgew
+edgew:
+  addr2reg wt r12
+  read 0 r12 r1
+  add r4 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  add r4 12 r2
+  readh 0 r2 r2
+  load 32 r3
+  beq r2 r3 .L156
+  load 32 r3
+  bge r2 r3 .L157
+  load 12 r3
+  beq r2 r3 .L150
+  load 12 r3
+  sltu r2 r3 r2
+  jump .L157
+.L150:
+  add r4 20 r2
+  read 0 r2 r3
+  add r4 24 r2
+  read 0 r2 r2
+  beq r3 r2 .L157
+  add r4 12 r2
+  add r2 2 r2
+  readh 0 r2 r2
+  beq r2 r0 .L155
+  xor r2 1 r2
+  sltu r2 1 r2
+  xor r5 r3 r3
+  sltu r3 1 r3
+  beq r2 r3 .L154
+  shiftr r1 5 r1
+  jump .L157
+.L154:
+  shiftr r1 5 r2
+  sub r1 r2 r1
+  jump .L157
+.L155:
+  shiftr r1 1 r1
+  jump .L157
+.L156:
+  add r4 32 r2
+  read 0 r2 r2
+  divu r1 r2 r1
+.L157:
+  jumpr 0 r15
+
+/* end function edgew */
+
+
+.text
+; function edgecmp
+edgecmp:
+  add r4 8 r1
+  read 0 r1 r1
+  add r5 8 r2
+  read 0 r2 r2
+  bne r1 r2 .L170
+  add r4 12 r1
+  read 0 r1 r2
+  add r5 12 r1
+  read 0 r1 r1
+  bne r2 r1 .L169
+  read 0 r4 r1
+  add r1 48 r2
+  read 0 r2 r3
+  read 0 r5 r2
+  add r2 48 r6
+  read 0 r6 r6
+  bne r3 r6 .L166
+  add r4 4 r1
+  read 0 r1 r2
+  add r2 48 r1
+  read 0 r1 r3
+  add r5 4 r1
+  read 0 r1 r1
+  add r1 48 r6
+  read 0 r6 r6
+  blt r3 r6 .L165
+  add r2 48 r2
+  read 0 r2 r2
+  add r1 48 r1
+  read 0 r1 r1
+  sltu r1 r2 r1
+  jump .L173
+.L165:
+  load32 -1 r1
+  jump .L173
+.L166:
+  add r1 48 r1
+  read 0 r1 r1
+  add r2 48 r2
+  read 0 r2 r2
+  blt r1 r2 .L168
+  load 1 r1
+  jump .L173
+.L168:
+  load32 -1 r1
+  jump .L173
+.L169:
+  sub r1 r2 r1
+  jump .L173
+.L170:
+  blt r1 r2 .L172
+  load32 -1 r1
+  jump .L173
+.L172:
+  load 1 r1
+.L173:
+  jumpr 0 r15
+
+/* end function edgecmp */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "nb == fn->nblk && blk[0] == fn->start\000"
+/* end data */
+
+
+.text
+; function layout
+.global layout
+layout:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 188 r13
+  write -180 r14 r8
+  write -176 r14 r4
+  read 0 r4 r2
+  load 0 r1
+.L177:
+  beq r2 r0 .L185
+  add r2 120 r3
+  read 0 r3 r5
+  load 1 r3
+  bne r5 r0 .L182
+  add r2 12 r3
+  readh 0 r3 r5
+  load 0 r3
+  load 12 r6
+  bne r5 r6 .L181
+  add r2 12 r3
+  add r3 2 r3
+  readh 0 r3 r3
+  shiftl r3 16 r3
+  shiftr r3 16 r3
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L181:
+  xor r3 0 r3
+  sltu r0 r3 r3
+.L182:
+  beq r3 r0 .L184
+  load 1 r1
+.L184:
+  add r2 44 r2
+  read 0 r2 r2
+  jump .L177
+.L185:
+  beq r1 r0 .L303
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -176 r14 r4
+  addr2reg wt r12
+  write 0 r12 r1
+  load 0 r1
+.L187:
+  write -160 r14 r1
+  add r4 28 r2
+  read 0 r2 r2
+  bge r1 r2 .L204
+  or r0 r1 r2
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r2 2 r3
+  add r1 r3 r1
+  read 0 r1 r1
+  write -168 r14 r1
+  add r1 120 r3
+  read 0 r3 r3
+  bne r3 r0 .L201
+  beq r2 r0 .L199
+  load 0 r4
+  load 0 r3
+  or r0 r4 r12
+  or r0 r3 r4
+  or r0 r12 r3
+  or r0 r2 r12
+  or r0 r4 r2
+  or r0 r12 r4
+.L192:
+  write -172 r14 r3
+  write -164 r14 r2
+  add r1 80 r5
+  read 0 r5 r5
+  bge r3 r5 .L197
+  add r1 76 r5
+  read 0 r5 r5
+  shiftl r3 2 r6
+  add r5 r6 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  bge r6 r4 .L196
+  or r0 r5 r2
+  shiftl r3 2 r3
+  add r2 r3 r2
+  read 0 r2 r4
+  or r0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump edgew
+  or r0 r1 r5
+  read -172 r14 r3
+  read -164 r14 r2
+  read -160 r14 r4
+  read -168 r14 r1
+  add r2 r5 r2
+.L196:
+  add r3 1 r3
+  jump .L192
+.L197:
+  or r0 r4 r1
+  read -176 r14 r4
+  addr2reg wt r12
+  read 0 r12 r3
+  shiftl r1 2 r5
+  add r3 r5 r3
+  write 0 r3 r2
+  jump .L203
+.L199:
+  or r0 r2 r1
+  addr2reg wt r12
+  read 0 r12 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  load32 65536 r2
+  write 0 r3 r2
+  jump .L203
+.L201:
+  or r0 r2 r1
+  or r0 r3 r2
+  load 1 r3
+  sub r2 r3 r2
+  addr2reg wt r12
+  read 0 r12 r3
+  shiftl r1 2 r5
+  add r3 r5 r3
+  write 0 r3 r2
+.L203:
+  add r1 1 r1
+  jump .L187
+.L204:
+  read 0 r4 r3
+  load 0 r1
+  write -152 r14 r1
+.L206:
+  write -156 r14 r3
+  beq r3 r0 .L213
+  or r0 r3 r4
+  savpc r15
+  add r15 12 r15
+  jump succlist
+  or r0 r1 r2
+  read -156 r14 r3
+  read -152 r14 r1
+  read -176 r14 r4
+.L208:
+  read 0 r2 r5
+  beq r5 r0 .L211
+  add r1 1 r1
+  add r2 4 r2
+  jump .L208
+.L211:
+  add r3 44 r2
+  read 0 r2 r3
+  write -152 r14 r1
+  jump .L206
+.L213:
+  read -152 r14 r1
+  add r1 1 r1
+  shiftl r1 4 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -148 r14 r1
+  read -176 r14 r4
+  read 0 r4 r1
+  load 0 r2
+  write -108 r14 r2
+.L216:
+  write -116 r14 r1
+  beq r1 r0 .L233
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump succlist
+  or r0 r1 r3
+  read -116 r14 r1
+  read -108 r14 r2
+  read -176 r14 r4
+.L218:
+  write -132 r14 r3
+  write -112 r14 r2
+  or r0 r2 r5
+  read 0 r3 r2
+  write -120 r14 r2
+  beq r2 r0 .L230
+  read 0 r4 r7
+  load 1 r6
+  xor r2 r7 r7
+  sltu r7 1 r7
+  read -148 r14 r8
+  bne r7 r0 .L221
+  xor r2 r1 r6
+  sltu r6 1 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+.L221:
+  bne r6 r0 .L228
+  or r0 r2 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump edgew
+  or r0 r1 r7
+  read -112 r14 r2
+  read -116 r14 r1
+  or r0 r2 r5
+  read -120 r14 r2
+  addr2reg wt r12
+  read 0 r12 r3
+  write -128 r14 r3
+  add r2 48 r4
+  read 0 r4 r6
+  shiftl r6 2 r4
+  add r3 r4 r3
+  read 0 r3 r3
+  sltu r3 r7 r3
+  write -124 r14 r3
+  read -132 r14 r3
+  read -176 r14 r4
+  read -124 r14 r12
+  bne r12 r0 .L224
+  write -136 r14 r7
+  jump .L227
+.L224:
+  read -128 r14 r3
+  shiftl r6 2 r7
+  add r3 r7 r7
+  read -132 r14 r3
+  read 0 r7 r7
+  write -136 r14 r7
+.L227:
+  add r1 48 r7
+  read 0 r7 r7
+  add r7 1 r7
+  xor r6 r7 r6
+  sltu r6 1 r6
+  write -140 r14 r6
+  read -136 r14 r7
+  add r5 1 r8
+  write -144 r14 r8
+  read -148 r14 r8
+  shiftl r5 4 r5
+  add r8 r5 r6
+  read -140 r14 r5
+  write 0 r6 r1
+  add r6 4 r6
+  write 0 r6 r2
+  read -144 r14 r2
+  add r6 4 r6
+  write 0 r6 r7
+  read -148 r14 r8
+  add r6 4 r6
+  write 0 r6 r5
+  jump .L229
+.L228:
+  or r0 r5 r2
+.L229:
+  add r3 4 r3
+  jump .L218
+.L230:
+  or r0 r5 r2
+  read -148 r14 r8
+  add r1 44 r1
+  read 0 r1 r1
+  write -108 r14 r2
+  jump .L216
+.L233:
+  read -108 r14 r1
+  read -148 r14 r8
+  addr2reg edgecmp r7
+  load 16 r6
+  or r0 r1 r5
+  or r0 r8 r4
+  savpc r15
+  add r15 12 r15
+  jump qsort
+  read -176 r14 r4
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  write -60 r14 r1
+  read -176 r14 r4
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r2
+  read -60 r14 r3
+  read -148 r14 r8
+  read -176 r14 r4
+  write -48 r14 r2
+  load 0 r1
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+.L236:
+  add r4 28 r5
+  read 0 r5 r5
+  bge r2 r5 .L239
+  add r4 40 r5
+  read 0 r5 r5
+  shiftl r2 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  shiftl r2 2 r6
+  add r1 r6 r6
+  write 0 r6 r5
+  add r2 1 r2
+  jump .L236
+.L239:
+  or r0 r1 r2
+  read -108 r14 r1
+  load 0 r5
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+  or r0 r5 r6
+.L242:
+  write -104 r14 r6
+  bge r6 r2 .L261
+  shiftl r6 4 r2
+  add r8 r2 r2
+  read 0 r2 r5
+  shiftl r6 4 r2
+  add r8 r2 r2
+  add r2 4 r2
+  read 0 r2 r2
+  write -88 r14 r2
+  add r5 48 r2
+  read 0 r2 r6
+  write -100 r14 r6
+  shiftl r6 2 r2
+  add r1 r2 r2
+  read 0 r2 r2
+  write -64 r14 r2
+  read -88 r14 r2
+  add r2 48 r2
+  read 0 r2 r6
+  write -84 r14 r6
+  shiftl r6 2 r2
+  add r1 r2 r2
+  read 0 r2 r6
+  write -68 r14 r6
+  read -64 r14 r2
+  load 1 r6
+  write -72 r14 r6
+  read -68 r14 r6
+  xor r2 r6 r7
+  sltu r7 1 r7
+  read -88 r14 r2
+  read -72 r14 r6
+  bne r7 r0 .L246
+  read -100 r14 r6
+  shiftl r6 2 r6
+  add r3 r6 r6
+  read 0 r6 r6
+  xor r6 0 r6
+  sltu r0 r6 r6
+  write -76 r14 r6
+  jump .L247
+.L246:
+  write -76 r14 r6
+.L247:
+  load 1 r6
+  write -80 r14 r6
+  read -104 r14 r6
+  read -76 r14 r12
+  bne r12 r0 .L250
+  read -84 r14 r6
+  shiftl r6 2 r6
+  add r1 r6 r6
+  read 0 r6 r6
+  xor r6 r2 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  write -92 r14 r2
+  read -104 r14 r6
+  read -88 r14 r2
+  read -92 r14 r12
+  write -96 r14 r12
+  jump .L251
+.L250:
+  read -80 r14 r12
+  write -96 r14 r12
+.L251:
+  read -96 r14 r12
+  bne r12 r0 .L258
+  read -100 r14 r6
+  shiftl r6 2 r6
+  add r3 r6 r6
+  write 0 r6 r2
+.L254:
+  beq r2 r0 .L257
+  add r5 48 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r1 r6 r6
+  read 0 r6 r6
+  add r2 48 r7
+  read 0 r7 r7
+  shiftl r7 2 r7
+  add r1 r7 r7
+  write 0 r7 r6
+  add r2 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  jump .L254
+.L257:
+  read -104 r14 r4
+  read -108 r14 r2
+  read -148 r14 r8
+  jump .L259
+.L258:
+  or r0 r6 r4
+  read -108 r14 r2
+.L259:
+  add r4 1 r4
+  or r0 r4 r6
+  read -176 r14 r4
+  jump .L242
+.L261:
+  add r4 28 r1
+  read 0 r1 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -48 r14 r2
+  read -176 r14 r4
+  write -56 r14 r1
+  load 0 r3
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L263:
+  add r4 28 r5
+  read 0 r5 r5
+  bge r3 r5 .L267
+  shiftl r3 2 r5
+  add r1 r5 r5
+  read 0 r5 r5
+  add r5 48 r5
+  read 0 r5 r5
+  shiftl r5 2 r5
+  add r2 r5 r5
+  read 0 r5 r6
+  addr2reg wt r12
+  read 0 r12 r5
+  shiftl r3 2 r7
+  add r5 r7 r7
+  read 0 r7 r7
+  bge r6 r7 .L266
+  shiftl r3 2 r6
+  add r5 r6 r5
+  read 0 r5 r5
+  shiftl r3 2 r6
+  add r1 r6 r6
+  read 0 r6 r6
+  add r6 48 r6
+  read 0 r6 r6
+  shiftl r6 2 r6
+  add r2 r6 r6
+  write 0 r6 r5
+.L266:
+  add r3 1 r3
+  jump .L263
+.L267:
+  addr2reg wt r12
+  read 0 r12 r1
+  add r1 0 r1
+  read 0 r1 r1
+  shiftr r1 4 r6
+  write -52 r14 r6
+  shiftl r5 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -48 r14 r2
+  read -60 r14 r3
+  read -176 r14 r4
+  write -12 r14 r1
+  load 0 r6
+  load 0 r5
+  or r0 r5 r7
+  or r0 r1 r5
+  or r0 r2 r1
+.L269:
+  or r0 r6 r2
+  write -44 r14 r2
+  load 2 r6
+  bge r2 r6 .L292
+  load 0 r2
+  or r0 r2 r6
+  write -32 r14 r7
+.L272:
+  add r4 28 r2
+  read 0 r2 r2
+  bge r6 r2 .L289
+  or r0 r1 r2
+  add r4 40 r1
+  read 0 r1 r1
+  shiftl r6 2 r7
+  add r1 r7 r1
+  read 0 r1 r1
+  write -28 r14 r1
+  shiftl r6 2 r7
+  add r2 r7 r2
+  read 0 r2 r2
+  load 1 r7
+  write -24 r14 r7
+  xor r2 r1 r2
+  sltu r0 r2 r2
+  write -20 r14 r2
+  read -32 r14 r7
+  or r0 r1 r2
+  read -48 r14 r1
+  read -20 r14 r12
+  bne r12 r0 .L277
+  read -56 r14 r2
+  shiftl r6 2 r7
+  add r2 r7 r2
+  read -52 r14 r7
+  read 0 r2 r2
+  sltu r2 r7 r2
+  read -44 r14 r7
+  xor r2 r7 r2
+  sltu r0 r2 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+  write -36 r14 r2
+  read -32 r14 r7
+  or r0 r1 r2
+  read -28 r14 r1
+  read -36 r14 r12
+  write -40 r14 r12
+  jump .L278
+.L277:
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  read -24 r14 r12
+  write -40 r14 r12
+.L278:
+  read -40 r14 r12
+  bne r12 r0 .L286
+  or r0 r7 r2
+  or r0 r1 r12
+  or r0 r2 r1
+  or r0 r12 r2
+.L281:
+  beq r2 r0 .L284
+  or r0 r1 r7
+  add r1 1 r1
+  shiftl r7 2 r7
+  add r5 r7 r7
+  write 0 r7 r2
+  add r2 48 r2
+  read 0 r2 r2
+  shiftl r2 2 r2
+  add r3 r2 r2
+  read 0 r2 r2
+  jump .L281
+.L284:
+  read -44 r14 r7
+  read -48 r14 r2
+  or r0 r2 r12
+  or r0 r1 r2
+  or r0 r12 r1
+  jump .L287
+.L286:
+  or r0 r2 r1
+  or r0 r7 r2
+  read -44 r14 r7
+.L287:
+  add r6 1 r6
+  write -32 r14 r2
+  jump .L272
+.L289:
+  read -32 r14 r7
+  read -44 r14 r2
+  add r2 1 r2
+  write -16 r14 r2
+  read -52 r14 r6
+  read -56 r14 r2
+  read -16 r14 r6
+  jump .L269
+.L292:
+  or r0 r5 r1
+  add r4 28 r2
+  read 0 r2 r3
+  load 0 r2
+  beq r7 r3 .L295
+  or r0 r1 r5
+  or r0 r2 r1
+  jump .L296
+.L295:
+  or r0 r1 r5
+  read 0 r1 r1
+  read 0 r4 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L296:
+  bne r1 r0 .L298
+  load 371 r6
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.32 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r5
+  read -176 r14 r4
+.L298:
+  or r0 r5 r1
+.L299:
+  add r4 28 r2
+  read 0 r2 r2
+  load 1 r3
+  sub r2 r3 r2
+  shiftl r2 2 r2
+  add r5 r2 r2
+  bge r1 r2 .L302
+  add r1 4 r2
+  read 0 r2 r2
+  read 0 r1 r3
+  add r3 44 r3
+  write 0 r3 r2
+  add r1 4 r1
+  jump .L299
+.L302:
+  read 0 r1 r1
+  add r1 44 r2
+  load 0 r1
+  write 0 r2 r1
+.L303:
+  read -180 r14 r8
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function layout */
+
+.data
+.balign 4
+.globl profgen
+profgen:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+ptab:
+	.fill 4096,1,0
+/* end data */
+
+.data
+.balign 4
+nprof:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+pname:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+npname:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+wt:
+	.fill 4,1,0
+/* end data */
+
@@ -0,0 +1,2787 @@
+
+.text
+; function req
+req:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -4 r1
+  write 0 r1 r5
+  or r0 r4 r1
+  add r14 -8 r2
+  write 0 r2 r1
+  read -8 r14 r1
+  shiftl r1 29 r2
+  shiftr r2 29 r4
+  read -4 r14 r2
+  shiftl r2 29 r3
+  shiftr r3 29 r5
+  load 0 r3
+  beq r4 r5 .L3
+  or r0 r3 r1
+  jump .L4
+.L3:
+  shiftr r1 3 r1
+  shiftr r2 3 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L4:
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function req */
+
+
+.text
+; function rtype
+rtype:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 16 r13
+  add r14 -8 r1
+  write 0 r1 r4
+  load 0 r1
+  write -4 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump req
+  bne r1 r0 .L9
+  read -8 r14 r1
+  shiftl r1 29 r1
+  shiftr r1 29 r1
+  jump .L10
+.L9:
+  load32 -1 r1
+.L10:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rtype */
+
+
+.text
+; function rsval
+rsval:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r1
+  shiftr r1 3 r1
+  shiftl r1 3 r1
+  shiftrs r1 3 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function rsval */
+
+.data
+.balign 1
+.Lstring.5:
+	.ascii "elt < bs->nt * NBit\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.6:
+	.ascii "BuildTools/QBE/all.h\000"
+/* end data */
+
+.data
+.balign 4
+pool:
+	.int ptr+0
+/* end data */
+
+.data
+.balign 4
+nptr:
+	.int 1
+/* end data */
+
+.data
+.balign 1
+.Lstring.8:
+	.ascii "BuildTools/QBE/util.c\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.9:
+	.ascii "out of memory (insb)\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.10:
+	.ascii "out of memory (itbl)\000"
+/* end data */
+
+
+.text
+; function utilinit
+.global utilinit
+utilinit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  load 16 r5
+  load32 262144 r4
+  savpc r15
+  add r15 12 r15
+  jump calloc
+  addr2reg insb r12
+  write 0 r12 r1
+  bne r1 r0 .L19
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.9 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+.L19:
+  addr2reg insb r12
+  read 0 r12 r1
+  addr2reg curi r12
+  write 0 r12 r1
+  load 8 r5
+  load 4096 r4
+  savpc r15
+  add r15 12 r15
+  jump calloc
+  addr2reg itbl r12
+  write 0 r12 r1
+  bne r1 r0 .L21
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.10 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  load32 -24 r1
+  sub r13 r1 r13
+.L21:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function utilinit */
+
+
+.text
+; function hash
+.global hash
+hash:
+  load 0 r1
+.L25:
+  or r0 r1 r2
+  readb 0 r4 r1
+  beq r1 r0 .L28
+  shiftl r2 4 r3
+  add r3 r2 r2
+  add r1 r2 r1
+  add r4 1 r4
+  jump .L25
+.L28:
+  or r0 r2 r1
+  jumpr 0 r15
+
+/* end function hash */
+
+.data
+.balign 1
+.Lstring.13:
+	.ascii "%s: dying: \000"
+/* end data */
+
+
+.text
+; function die_
+.global die_
+die_:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  write 8 r14 r4
+  write 12 r14 r5
+  write 16 r14 r6
+  write 20 r14 r7
+  sub r13 28 r13
+  write -16 r14 r5
+  or r0 r4 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.13 r5
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r5
+  load32 -24 r1
+  sub r13 r1 r13
+  add r14 16 r1
+  write -20 r14 r1
+  read -20 r14 r6
+  addr2reg __stderr_file r4
+  savpc r15
+  add r15 12 r15
+  jump vfprintf
+  addr2reg __stderr_file r5
+  load 10 r4
+  savpc r15
+  add r15 12 r15
+  jump fputc
+  savpc r15
+  add r15 12 r15
+  jump abort
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function die_ */
+
+.data
+.balign 1
+.Lstring.15:
+	.ascii "emalloc, out of memory\000"
+/* end data */
+
+
+.text
+; function emalloc
+.global emalloc
+emalloc:
+  or r0 r4 r5
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump calloc
+  write -16 r14 r1
+  bne r1 r0 .L38
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.15 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -16 r14 r1
+  load32 -24 r2
+  sub r13 r2 r13
+.L38:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emalloc */
+
+
+.text
+; function alloc
+.global alloc
+alloc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  beq r4 r0 .L45
+  addr2reg nptr r12
+  read 0 r12 r1
+  load 256 r2
+  blts r1 r2 .L44
+  load 1024 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  read -16 r14 r4
+  addr2reg pool r12
+  read 0 r12 r2
+  add r1 0 r3
+  write 0 r3 r2
+  addr2reg pool r12
+  write 0 r12 r1
+  load 1 r1
+  addr2reg nptr r12
+  write 0 r12 r1
+.L44:
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  addr2reg pool r12
+  read 0 r12 r2
+  addr2reg nptr r12
+  read 0 r12 r3
+  add r3 1 r4
+  addr2reg nptr r12
+  write 0 r12 r4
+  shiftl r3 2 r3
+  add r2 r3 r2
+  write 0 r2 r1
+  jump .L46
+.L45:
+  load 0 r1
+.L46:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function alloc */
+
+
+.text
+; function freeall
+.global freeall
+freeall:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+.L49:
+  addr2reg pool r12
+  read 0 r12 r1
+  add r1 4 r1
+.L50:
+  write -16 r14 r1
+  addr2reg pool r12
+  read 0 r12 r2
+  addr2reg nptr r12
+  read 0 r12 r3
+  shiftl r3 2 r3
+  add r2 r3 r3
+  bge r1 r3 .L53
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -16 r14 r1
+  add r1 4 r1
+  jump .L50
+.L53:
+  or r0 r2 r4
+  add r4 0 r1
+  read 0 r1 r1
+  write -12 r14 r1
+  beq r1 r0 .L56
+  savpc r15
+  add r15 12 r15
+  jump free
+  read -12 r14 r1
+  addr2reg pool r12
+  write 0 r12 r1
+  load 256 r1
+  addr2reg nptr r12
+  write 0 r12 r1
+  jump .L49
+.L56:
+  load 1 r1
+  addr2reg nptr r12
+  write 0 r12 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function freeall */
+
+
+.text
+; function vnew
+.global vnew
+vnew:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r6
+  write -12 r14 r5
+  load 2 r1
+.L61:
+  write -16 r14 r1
+  bge r1 r4 .L63
+  shiftl r1 1 r1
+  jump .L61
+.L63:
+  or r0 r1 r2
+  beq r6 r0 .L66
+  addr2reg alloc r1
+  jump .L67
+.L66:
+  addr2reg emalloc r1
+.L67:
+  mults r2 r5 r2
+  add r2 16 r4
+  savpc r15
+  add r15 12 r15
+  jumpr 0 r1
+  read -16 r14 r2
+  read -8 r14 r6
+  read -12 r14 r5
+  load32 212581022 r3
+  write 0 r1 r3
+  add r1 12 r3
+  write 0 r3 r2
+  add r1 8 r2
+  write 0 r2 r5
+  add r1 4 r2
+  write 0 r2 r6
+  add r1 16 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function vnew */
+
+.data
+.balign 1
+.Lstring.20:
+	.ascii "v->mag == VMag\000"
+/* end data */
+
+
+.text
+; function vfree
+.global vfree
+vfree:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  load 16 r1
+  sub r4 r1 r4
+  write -16 r14 r4
+  read 0 r4 r1
+  load32 212581022 r2
+  beq r1 r2 .L73
+  load 149 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.20 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r4
+.L73:
+  add r4 4 r1
+  read 0 r1 r1
+  bne r1 r0 .L75
+  load 0 r1
+  write 0 r4 r1
+  savpc r15
+  add r15 12 r15
+  jump free
+.L75:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function vfree */
+
+.data
+.balign 1
+.Lstring.22:
+	.ascii "v+1 && v->mag == VMag\000"
+/* end data */
+
+
+.text
+; function vgrow
+.global vgrow
+vgrow:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r1
+  or r0 r5 r4
+  write -4 r14 r4
+  write -16 r14 r1
+  read 0 r1 r1
+  load 16 r2
+  sub r1 r2 r1
+  write -8 r14 r1
+  add r1 16 r3
+  load 0 r2
+  beq r3 r0 .L80
+  read 0 r1 r2
+  load32 212581022 r3
+  xor r2 r3 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L80:
+  bne r2 r0 .L82
+  load 163 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.22 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -8 r14 r1
+  read -4 r14 r4
+.L82:
+  add r1 12 r2
+  read 0 r2 r2
+  bge r2 r4 .L84
+  add r1 8 r2
+  read 0 r2 r5
+  or r0 r1 r3
+  add r1 4 r1
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -8 r14 r3
+  write -12 r14 r1
+  add r3 16 r5
+  add r3 12 r2
+  read 0 r2 r2
+  add r3 8 r3
+  read 0 r3 r3
+  mults r2 r3 r6
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -8 r14 r1
+  add r1 16 r4
+  savpc r15
+  add r15 12 r15
+  jump vfree
+  read -12 r14 r1
+  read -16 r14 r4
+  write 0 r4 r1
+.L84:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function vgrow */
+
+
+.text
+; function strf
+.global strf
+strf:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  write 8 r14 r4
+  write 12 r14 r5
+  write 16 r14 r6
+  write 20 r14 r7
+  sub r13 12 r13
+  or r0 r5 r6
+  add r14 16 r1
+  write -4 r14 r1
+  read -4 r14 r7
+  load 80 r5
+  savpc r15
+  add r15 12 r15
+  jump vsnprintf
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function strf */
+
+.data
+.balign 1
+.Lstring.25:
+	.ascii "interning table overflow\000"
+/* end data */
+
+
+.text
+; function intern
+.global intern
+intern:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 40 r13
+  or r0 r4 r5
+  write -16 r14 r5
+  load 0 r1
+  or r0 r5 r4
+  or r0 r1 r2
+  or r0 r5 r1
+.L93:
+  or r0 r2 r3
+  readb 0 r4 r2
+  beq r2 r0 .L96
+  shiftl r3 4 r5
+  add r5 r3 r3
+  add r2 r3 r2
+  add r4 1 r4
+  jump .L93
+.L96:
+  or r0 r3 r2
+  or r0 r1 r5
+  and r2 4095 r1
+  write -32 r14 r1
+  or r0 r1 r2
+  addr2reg itbl r12
+  read 0 r12 r1
+  shiftl r2 3 r2
+  add r1 r2 r1
+  write -20 r14 r1
+  read 0 r1 r2
+  write -24 r14 r2
+  load 0 r3
+  or r0 r5 r4
+.L99:
+  write -28 r14 r3
+  bge r3 r2 .L105
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r3 2 r2
+  add r1 r2 r1
+  read 0 r1 r5
+  or r0 r4 r1
+  savpc r15
+  add r15 12 r15
+  jump strcmp
+  or r0 r1 r5
+  read -28 r14 r3
+  read -24 r14 r2
+  read -20 r14 r4
+  read -16 r14 r1
+  beq r5 r0 .L103
+  add r3 1 r3
+  or r0 r4 r12
+  or r0 r1 r4
+  or r0 r12 r1
+  jump .L99
+.L103:
+  read -32 r14 r1
+  shiftl r3 12 r2
+  add r1 r2 r1
+  jump .L113
+.L105:
+  read -24 r14 r2
+  or r0 r4 r5
+  load32 1048576 r3
+  bne r2 r3 .L108
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.25 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -24 r14 r2
+  read -20 r14 r1
+  read -16 r14 r5
+  load32 -24 r3
+  sub r13 r3 r13
+.L108:
+  beq r2 r0 .L111
+  load 1 r3
+  sub r2 r3 r3
+  and r2 r3 r3
+  bne r3 r0 .L112
+  add r1 4 r4
+  add r2 r2 r5
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -16 r14 r5
+  jump .L112
+.L111:
+  load 0 r6
+  load 4 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump vnew
+  read -20 r14 r2
+  read -16 r14 r5
+  add r2 4 r2
+  write 0 r2 r1
+.L112:
+  or r0 r5 r4
+  savpc r15
+  add r15 12 r15
+  jump strlen
+  add r1 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emalloc
+  or r0 r1 r3
+  read -24 r14 r2
+  read -20 r14 r1
+  read -16 r14 r5
+  add r1 4 r4
+  read 0 r4 r4
+  shiftl r2 2 r6
+  add r4 r6 r4
+  write 0 r4 r3
+  add r2 1 r3
+  write 0 r1 r3
+  add r1 4 r1
+  read 0 r1 r1
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump strcpy
+  read -24 r14 r2
+  read -32 r14 r1
+  shiftl r2 12 r2
+  add r1 r2 r1
+.L113:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function intern */
+
+.data
+.balign 1
+.Lstring.27:
+	.ascii "id>>IBits < itbl[id&IMask].nstr\000"
+/* end data */
+
+
+.text
+; function str
+.global str
+str:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  shiftr r4 12 r1
+  addr2reg itbl r12
+  read 0 r12 r2
+  and r4 4095 r3
+  shiftl r3 3 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  blt r1 r2 .L118
+  load 213 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.27 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r4
+.L118:
+  addr2reg itbl r12
+  read 0 r12 r1
+  and r4 4095 r2
+  shiftl r2 3 r2
+  add r1 r2 r1
+  add r1 4 r1
+  read 0 r1 r1
+  shiftr r4 12 r2
+  shiftl r2 2 r2
+  add r1 r2 r1
+  read 0 r1 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function str */
+
+
+.text
+; function isreg
+.global isreg
+isreg:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 12 r13
+  add r14 -4 r1
+  write 0 r1 r4
+  read -4 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  or r0 r1 r2
+  load 0 r1
+  bne r2 r0 .L124
+  read -4 r14 r1
+  shiftr r1 3 r1
+  slt r1 32 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L124:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function isreg */
+
+
+.text
+; function iscmp
+.global iscmp
+iscmp:
+  load 0 r1
+  load 17 r2
+  bgts r2 r4 .L129
+  load 26 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L129:
+  bne r1 r0 .L143
+  load 0 r1
+  load 27 r2
+  bgts r2 r4 .L132
+  load 36 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L132:
+  bne r1 r0 .L142
+  load 0 r1
+  load 37 r2
+  bgts r2 r4 .L135
+  load 44 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L135:
+  bne r1 r0 .L141
+  load 0 r1
+  load 45 r2
+  bgts r2 r4 .L138
+  load 52 r1
+  slt r1 r4 r1
+  xor r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L138:
+  bne r1 r0 .L140
+  load 0 r1
+  jump .L145
+.L140:
+  load 10 r1
+  add r1 r4 r1
+  load 45 r2
+  sub r1 r2 r1
+  write 0 r6 r1
+  load 3 r1
+  write 0 r5 r1
+  jump .L144
+.L141:
+  load 10 r1
+  add r1 r4 r1
+  load 37 r2
+  sub r1 r2 r1
+  write 0 r6 r1
+  load 2 r1
+  write 0 r5 r1
+  jump .L144
+.L142:
+  load 27 r1
+  sub r4 r1 r1
+  write 0 r6 r1
+  load 1 r1
+  write 0 r5 r1
+  jump .L144
+.L143:
+  load 17 r1
+  sub r4 r1 r1
+  write 0 r6 r1
+  load 0 r1
+  write 0 r5 r1
+.L144:
+  load 1 r1
+.L145:
+  jumpr 0 r15
+
+/* end function iscmp */
+
+
+.text
+; function argcls
+.global argcls
+argcls:
+  read 0 r4 r2
+  shiftl r2 2 r1
+  shiftr r1 2 r1
+  load 24 r3
+  mults r1 r3 r3
+  addr2reg optab r1
+  add r1 r3 r1
+  add r1 4 r1
+  shiftl r5 3 r3
+  add r1 r3 r1
+  shiftr r2 30 r2
+  shiftl r2 1 r2
+  add r1 r2 r1
+  readh 0 r1 r1
+  jumpr 0 r15
+
+/* end function argcls */
+
+.data
+.balign 1
+.Lstring.32:
+	.ascii "emit, too many instructions\000"
+/* end data */
+
+
+.text
+; function emit
+.global emit
+emit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 32 r13
+  add r14 -20 r1
+  write 0 r1 r7
+  or r0 r6 r1
+  add r14 -24 r2
+  write 0 r2 r1
+  or r0 r5 r1
+  or r0 r4 r2
+  write -12 r14 r1
+  write -16 r14 r2
+  addr2reg curi r12
+  read 0 r12 r3
+  addr2reg insb r12
+  read 0 r12 r4
+  bne r3 r4 .L154
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.32 r5
+  addr2reg .Lstring.8 r4
+  savpc r15
+  add r15 12 r15
+  jump die_
+  read -12 r14 r1
+  read -16 r14 r2
+  load32 -24 r3
+  sub r13 r3 r13
+.L154:
+  load32 1073741823 r3
+  and r2 r3 r2
+  or r2 0 r2
+  shiftl r1 30 r1
+  load32 -1073741824 r3
+  and r1 r3 r1
+  load32 1073741823 r3
+  and r2 r3 r2
+  or r1 r2 r5
+  read -24 r14 r4
+  read -20 r14 r3
+  read 8 r14 r1
+  addr2reg curi r12
+  read 0 r12 r2
+  load 16 r6
+  sub r2 r6 r2
+  addr2reg curi r12
+  write 0 r12 r2
+  write 0 r2 r5
+  add r2 4 r2
+  write 0 r2 r4
+  add r2 4 r2
+  write 0 r2 r3
+  add r2 4 r2
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emit */
+
+
+.text
+; function emiti
+.global emiti
+emiti:
+  or r0 r4 r3
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  read 0 r3 r1
+  shiftl r1 2 r2
+  shiftr r2 2 r4
+  shiftr r1 30 r5
+  add r3 4 r1
+  add r3 8 r2
+  add r2 0 r2
+  add r3 8 r3
+  add r3 4 r3
+  load 12 r6
+  sub r13 r6 r13
+  or r0 r13 r6
+  read 0 r3 r3
+  add r6 8 r6
+  write 0 r6 r3
+  read 0 r2 r7
+  read 0 r1 r6
+  savpc r15
+  add r15 12 r15
+  jump emit
+  load32 -12 r1
+  sub r13 r1 r13
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function emiti */
+
+
+.text
+; function idup
+.global idup
+idup:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -8 r14 r5
+  write -12 r14 r4
+  write -16 r14 r6
+  shiftl r6 4 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  or r0 r1 r4
+  read -16 r14 r6
+  read -8 r14 r5
+  read -12 r14 r1
+  write 0 r1 r4
+  beq r6 r0 .L164
+  shiftl r6 4 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+.L164:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function idup */
+
+
+.text
+; function icpy
+.global icpy
+icpy:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r6
+  write -12 r14 r4
+  beq r6 r0 .L169
+  shiftl r6 4 r6
+  savpc r15
+  add r15 12 r15
+  jump memcpy
+  read -16 r14 r6
+  read -12 r14 r4
+.L169:
+  shiftl r6 4 r1
+  add r4 r1 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function icpy */
+
+.data
+.balign 4
+cmptab:
+	.int 1
+	.int 0
+	.int 0
+	.int 1
+	.int 5
+	.int 4
+	.int 4
+	.int 5
+	.int 3
+	.int 2
+	.int 2
+	.int 3
+	.int 9
+	.int 8
+	.int 8
+	.int 9
+	.int 7
+	.int 6
+	.int 6
+	.int 7
+	.int 15
+	.int 10
+	.int 14
+	.int 13
+	.int 13
+	.int 14
+	.int 12
+	.int 11
+	.int 11
+	.int 12
+	.int 10
+	.int 15
+	.int 17
+	.int 16
+	.int 16
+	.int 17
+/* end data */
+
+.data
+.balign 1
+.Lstring.37:
+	.ascii "0 <= c && c < NCmp\000"
+/* end data */
+
+
+.text
+; function cmpneg
+.global cmpneg
+cmpneg:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  load 0 r1
+  bgts r0 r4 .L175
+  slt r4 18 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L175:
+  bne r1 r0 .L177
+  load 311 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.37 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r4
+.L177:
+  shiftl r4 3 r2
+  addr2reg cmptab r1
+  add r1 r2 r1
+  add r1 0 r1
+  read 0 r1 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function cmpneg */
+
+
+.text
+; function cmpop
+.global cmpop
+cmpop:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  load 0 r1
+  bgts r0 r4 .L183
+  slt r4 18 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L183:
+  bne r1 r0 .L185
+  load 318 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.37 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r4
+.L185:
+  shiftl r4 3 r2
+  addr2reg cmptab r1
+  add r1 r2 r1
+  add r1 4 r1
+  read 0 r1 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function cmpop */
+
+
+.text
+; function clsmerge
+.global clsmerge
+clsmerge:
+  readh 0 r4 r1
+  load32 -1 r2
+  beq r1 r2 .L200
+  load 0 r2
+  beq r1 r0 .L192
+  or r0 r2 r3
+  jump .L193
+.L192:
+  shiftl r5 16 r2
+  shiftrs r2 16 r2
+  xor r2 1 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r3
+.L193:
+  load 1 r2
+  bne r3 r0 .L197
+  load 0 r2
+  load 1 r3
+  bne r1 r3 .L196
+  shiftl r5 16 r2
+  shiftrs r2 16 r2
+  xor r2 0 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L196:
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L197:
+  bne r2 r0 .L199
+  shiftl r5 16 r2
+  shiftrs r2 16 r2
+  xor r1 r2 r1
+  sltu r0 r1 r1
+  jump .L201
+.L199:
+  load 0 r1
+  writeh 0 r4 r1
+  load 0 r1
+  jump .L201
+.L200:
+  shiftl r5 16 r1
+  shiftrs r1 16 r1
+  writeh 0 r4 r1
+  load 0 r1
+.L201:
+  jumpr 0 r15
+
+/* end function clsmerge */
+
+
+.text
+; function phicls
+.global phicls
+phicls:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  or r0 r4 r1
+  write -12 r14 r5
+  write -16 r14 r1
+  load 160 r2
+  mults r1 r2 r2
+  add r5 r2 r2
+  add r2 124 r2
+  read 0 r2 r4
+  or r0 r1 r2
+  beq r4 r0 .L206
+  savpc r15
+  add r15 12 r15
+  jump phicls
+  read -12 r14 r5
+  read -16 r14 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r5 r2 r2
+  add r2 124 r2
+  write 0 r2 r1
+  jump .L207
+.L206:
+  or r0 r2 r1
+.L207:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function phicls */
+
+.data
+.balign 4
+.Ln.42:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 1
+.Lstring.43:
+	.ascii "%s.%d\000"
+/* end data */
+
+
+.text
+; function newtmp
+.global newtmp
+newtmp:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -8 r14 r5
+  write -4 r14 r4
+  write -16 r14 r6
+  add r6 16 r1
+  read 0 r1 r2
+  write -12 r14 r2
+  add r2 1 r5
+  write 0 r1 r5
+  add r6 4 r4
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -12 r14 r1
+  read -16 r14 r6
+  or r0 r1 r2
+  add r6 4 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r4
+  load 160 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  read -12 r14 r2
+  read -16 r14 r6
+  read -8 r14 r5
+  or r0 r6 r1
+  read -4 r14 r6
+  bne r6 r0 .L212
+  or r0 r1 r6
+  or r0 r2 r1
+  jump .L213
+.L212:
+  add r1 4 r1
+  read 0 r1 r1
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r4
+  addr2reg .Ln.42 r12
+  read 0 r12 r1
+  add r1 1 r7
+  addr2reg .Ln.42 r12
+  write 0 r12 r7
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.43 r5
+  savpc r15
+  add r15 12 r15
+  jump strf
+  read -12 r14 r1
+  read -16 r14 r6
+  read -8 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+.L213:
+  add r6 4 r2
+  read 0 r2 r2
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r2
+  add r2 108 r2
+  writeh 0 r2 r5
+  add r6 4 r2
+  read 0 r2 r2
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r2
+  add r2 104 r3
+  load32 -1 r2
+  write 0 r3 r2
+  add r6 4 r2
+  read 0 r2 r2
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r2
+  add r2 92 r3
+  load 1 r2
+  write 0 r3 r2
+  add r6 4 r2
+  read 0 r2 r2
+  load 160 r3
+  mults r1 r3 r3
+  add r2 r3 r2
+  add r2 88 r3
+  load 1 r2
+  write 0 r3 r2
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 0 r1
+  write -20 r14 r1
+  read -20 r14 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function newtmp */
+
+
+.text
+; function chuse
+.global chuse
+chuse:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r6
+  write -16 r14 r5
+  add r14 -20 r1
+  write 0 r1 r4
+  read -20 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -12 r14 r6
+  read -16 r14 r5
+  bne r1 r0 .L219
+  add r6 4 r1
+  read 0 r1 r1
+  read -20 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r1
+  add r1 92 r2
+  read 0 r2 r1
+  add r1 r5 r1
+  write 0 r2 r1
+.L219:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function chuse */
+
+
+.text
+; function symeq
+.global symeq
+symeq:
+  read 0 r4 r2
+  read 0 r5 r3
+  load 0 r1
+  bne r2 r3 .L224
+  add r4 4 r1
+  read 0 r1 r1
+  add r5 4 r2
+  read 0 r2 r2
+  xor r1 r2 r1
+  sltu r1 1 r1
+  xor r1 0 r1
+  sltu r0 r1 r1
+.L224:
+  jumpr 0 r15
+
+/* end function symeq */
+
+
+.text
+; function newcon
+.global newcon
+newcon:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 44 r13
+  write -4 r14 r5
+  write -8 r14 r4
+  load 1 r1
+.L228:
+  write -16 r14 r1
+  add r5 20 r2
+  read 0 r2 r2
+  bges r1 r2 .L237
+  add r5 8 r2
+  read 0 r2 r2
+  shiftl r1 5 r3
+  add r2 r3 r3
+  write -12 r14 r3
+  read 0 r4 r6
+  read 0 r3 r7
+  load 0 r2
+  beq r6 r7 .L231
+  or r0 r2 r6
+  jump .L232
+.L231:
+  add r4 4 r1
+  add r3 4 r2
+  add r14 -28 r5
+  add r2 0 r3
+  read 0 r3 r3
+  add r14 -28 r4
+  add r4 0 r4
+  write 0 r4 r3
+  add r2 4 r2
+  read 0 r2 r2
+  add r14 -28 r3
+  add r3 4 r3
+  write 0 r3 r2
+  add r14 -36 r4
+  add r1 0 r2
+  read 0 r2 r2
+  add r14 -36 r3
+  add r3 0 r3
+  write 0 r3 r2
+  add r1 4 r1
+  read 0 r1 r1
+  add r14 -36 r2
+  add r2 4 r2
+  write 0 r2 r1
+  savpc r15
+  add r15 12 r15
+  jump symeq
+  or r0 r1 r2
+  read -16 r14 r1
+  read -12 r14 r3
+  read -4 r14 r5
+  read -8 r14 r4
+  xor r2 0 r2
+  sltu r0 r2 r6
+.L232:
+  load 0 r2
+  beq r6 r0 .L234
+  add r4 16 r2
+  read 0 r2 r2
+  add r3 16 r3
+  read 0 r3 r3
+  xor r2 r3 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L234:
+  bne r2 r0 .L236
+  add r1 1 r1
+  jump .L228
+.L236:
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 1 r1
+  write -20 r14 r1
+  read -20 r14 r1
+  jump .L238
+.L237:
+  add r5 8 r4
+  add r5 20 r1
+  add r2 1 r5
+  write 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -16 r14 r1
+  read -4 r14 r5
+  read -8 r14 r4
+  add r5 8 r2
+  read 0 r2 r2
+  shiftl r1 5 r3
+  add r2 r3 r3
+  read 0 r4 r2
+  write 0 r3 r2
+  add r4 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r4
+  write 0 r3 r4
+  add r2 4 r2
+  add r3 4 r3
+  read 0 r2 r2
+  write 0 r3 r2
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 1 r1
+  write -20 r14 r1
+  read -20 r14 r1
+.L238:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function newcon */
+
+
+.text
+; function getcon
+.global getcon
+getcon:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -12 r14 r5
+  write -8 r14 r4
+  load 1 r1
+.L242:
+  write -16 r14 r1
+  add r5 20 r2
+  read 0 r2 r2
+  bges r1 r2 .L249
+  add r5 8 r2
+  read 0 r2 r2
+  shiftl r1 5 r3
+  add r2 r3 r3
+  read 0 r3 r6
+  load 0 r3
+  load 1 r7
+  beq r6 r7 .L245
+  or r0 r3 r2
+  jump .L246
+.L245:
+  shiftl r1 5 r3
+  add r2 r3 r2
+  add r2 16 r2
+  read 0 r2 r2
+  xor r2 r4 r2
+  sltu r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L246:
+  bne r2 r0 .L248
+  add r1 1 r1
+  jump .L242
+.L248:
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 1 r1
+  write -20 r14 r1
+  read -20 r14 r1
+  jump .L250
+.L249:
+  add r5 8 r4
+  add r5 20 r1
+  add r2 1 r5
+  write 0 r1 r5
+  savpc r15
+  add r15 12 r15
+  jump vgrow
+  read -16 r14 r1
+  read -12 r14 r5
+  read -8 r14 r4
+  add r5 8 r2
+  read 0 r2 r2
+  shiftl r1 5 r3
+  add r2 r3 r2
+  load 1 r3
+  write 0 r2 r3
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r2
+  write 0 r2 r4
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r2
+  load 0 r3
+  write 0 r2 r3
+  add r2 4 r3
+  load 0 r2
+  write 0 r3 r2
+  shiftl r1 3 r1
+  load32 -8 r2
+  and r1 r2 r1
+  or r1 1 r1
+  write -20 r14 r1
+  read -20 r14 r1
+.L250:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function getcon */
+
+
+.text
+; function addcon
+.global addcon
+addcon:
+  read 0 r4 r1
+  beq r1 r0 .L259
+  read 0 r5 r2
+  load 2 r3
+  bne r2 r3 .L257
+  load 2 r2
+  beq r1 r2 .L258
+  load 2 r1
+  write 0 r4 r1
+  add r5 4 r1
+  add r4 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+.L257:
+  add r4 16 r2
+  read 0 r2 r1
+  add r5 16 r3
+  read 0 r3 r3
+  add r1 r3 r1
+  write 0 r2 r1
+  jump .L260
+.L258:
+  load 0 r1
+  jump .L261
+.L259:
+  read 0 r5 r1
+  write 0 r4 r1
+  add r5 4 r1
+  add r4 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r3
+  write 0 r2 r3
+  add r1 4 r1
+  add r2 4 r2
+  read 0 r1 r1
+  write 0 r2 r1
+.L260:
+  load 1 r1
+.L261:
+  jumpr 0 r15
+
+/* end function addcon */
+
+.data
+.balign 1
+.Lstring.50:
+	.ascii "invalid alloc size %lld\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.51:
+	.ascii "isel\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.52:
+	.ascii "unlikely alloc argument %%%s for %%%s\000"
+/* end data */
+
+
+.text
+; function salloc
+.global salloc
+salloc:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 64 r13
+  or r0 r5 r1
+  or r0 r6 r5
+  write -16 r14 r5
+  add r14 -32 r2
+  write 0 r2 r1
+  or r0 r4 r1
+  add r14 -36 r2
+  write 0 r2 r1
+  add r5 53 r2
+  load 1 r1
+  writeb 0 r2 r1
+  read -32 r14 r4
+  savpc r15
+  add r15 12 r15
+  jump rtype
+  read -16 r14 r5
+  load 1 r2
+  beq r1 r2 .L267
+  or r0 r5 r6
+  load 1 r5
+  addr2reg .Lstring.51 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  read -16 r14 r5
+  write -40 r14 r1
+  read -40 r14 r1
+  write -28 r14 r1
+  or r0 r5 r6
+  load 1 r5
+  addr2reg .Lstring.51 r4
+  savpc r15
+  add r15 12 r15
+  jump newtmp
+  write -44 r14 r1
+  read -44 r14 r1
+  write -24 r14 r1
+  load 0 r1
+  write -20 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -20 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -28 r14 r7
+  read -36 r14 r6
+  load 1 r5
+  load 96 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  load32 -16 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -48 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -48 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -24 r14 r7
+  read -28 r14 r6
+  load 1 r5
+  load 11 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  load 15 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -52 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -52 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -32 r14 r7
+  read -24 r14 r6
+  load 1 r5
+  load 1 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  read -16 r14 r5
+  load32 -12 r1
+  sub r13 r1 r13
+  add r5 4 r1
+  read 0 r1 r1
+  read -32 r14 r2
+  shiftr r2 3 r3
+  load 160 r4
+  mults r3 r4 r3
+  add r1 r3 r3
+  add r3 104 r3
+  read 0 r3 r3
+  load32 -1 r4
+  beq r3 r4 .L272
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r5
+  read -36 r14 r2
+  shiftr r2 3 r2
+  load 160 r3
+  mults r2 r3 r2
+  add r1 r2 r6
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.52 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  load32 -24 r1
+  sub r13 r1 r13
+  jump .L272
+.L267:
+  add r5 8 r1
+  read 0 r1 r1
+  read -32 r14 r2
+  shiftr r2 3 r2
+  shiftl r2 5 r2
+  add r1 r2 r1
+  add r1 16 r1
+  read 0 r1 r1
+  write -12 r14 r1
+  load 1 r2
+  blts r1 r0 .L269
+  load32 2147483632 r2
+  slt r1 r2 r2
+  xor r2 1 r2
+  xor r2 0 r2
+  sltu r0 r2 r2
+.L269:
+  beq r2 r0 .L271
+  load 24 r2
+  sub r13 r2 r13
+  or r0 r1 r5
+  addr2reg .Lstring.50 r4
+  savpc r15
+  add r15 12 r15
+  jump err
+  read -12 r14 r1
+  read -16 r14 r5
+  load32 -24 r2
+  sub r13 r2 r13
+.L271:
+  add r1 15 r1
+  load32 -16 r2
+  and r1 r2 r4
+  savpc r15
+  add r15 12 r15
+  jump getcon
+  write -56 r14 r1
+  load 0 r1
+  write -28 r14 r1
+  load 12 r1
+  sub r13 r1 r13
+  or r0 r13 r2
+  read -28 r14 r1
+  add r2 8 r2
+  write 0 r2 r1
+  read -56 r14 r7
+  read -36 r14 r6
+  load 1 r5
+  load 96 r4
+  savpc r15
+  add r15 12 r15
+  jump emit
+  load32 -12 r1
+  sub r13 r1 r13
+.L272:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function salloc */
+
+
+.text
+; function bsinit
+.global bsinit
+bsinit:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r4
+  add r5 32 r1
+  load 1 r2
+  sub r1 r2 r1
+  shiftr r1 5 r1
+  write 0 r4 r1
+  shiftl r1 2 r4
+  savpc r15
+  add r15 12 r15
+  jump alloc
+  read -16 r14 r4
+  add r4 4 r2
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bsinit */
+
+
+.text
+; function bscount
+.global bscount
+bscount:
+  load 0 r2
+  load 0 r1
+.L280:
+  read 0 r4 r3
+  bge r2 r3 .L285
+  add r4 4 r3
+  read 0 r3 r3
+  shiftl r2 2 r5
+  add r3 r5 r3
+  read 0 r3 r5
+  load32 1431655765 r3
+  and r5 r3 r3
+  shiftr r5 1 r5
+  load32 1431655765 r6
+  and r5 r6 r5
+  add r3 r5 r5
+  load32 858993459 r3
+  and r5 r3 r3
+  shiftr r5 2 r5
+  load32 858993459 r6
+  and r5 r6 r5
+  add r3 r5 r5
+  load32 252645135 r3
+  and r5 r3 r3
+  shiftr r5 4 r5
+  load32 252645135 r6
+  and r5 r6 r5
+  add r3 r5 r3
+  shiftr r3 8 r5
+  add r3 r5 r3
+  shiftr r3 16 r5
+  add r3 r5 r3
+  and r3 63 r3
+  add r1 r3 r1
+  add r2 1 r2
+  jump .L280
+.L285:
+  jumpr 0 r15
+
+/* end function bscount */
+
+.data
+.balign 1
+.Lstring.59:
+	.ascii "elt < bsmax(bs)\000"
+/* end data */
+
+
+.text
+; function bsset
+.global bsset
+bsset:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r5
+  write -12 r14 r4
+  read 0 r4 r1
+  shiftl r1 5 r1
+  blt r5 r1 .L291
+  load 539 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.59 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r5
+  read -12 r14 r4
+.L291:
+  add r4 4 r1
+  read 0 r1 r1
+  shiftr r5 5 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  read 0 r2 r1
+  and r5 31 r4
+  load 1 r3
+  shiftl r3 r4 r3
+  or r1 r3 r1
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bsset */
+
+
+.text
+; function bsclr
+.global bsclr
+bsclr:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r5
+  write -12 r14 r4
+  read 0 r4 r1
+  shiftl r1 5 r1
+  blt r5 r1 .L298
+  load 546 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.59 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -16 r14 r5
+  read -12 r14 r4
+.L298:
+  add r4 4 r1
+  read 0 r1 r1
+  shiftr r5 5 r2
+  shiftl r2 2 r2
+  add r1 r2 r2
+  read 0 r2 r1
+  and r5 31 r4
+  load 1 r3
+  shiftl r3 r4 r3
+  xor r3 -1 r3
+  and r1 r3 r1
+  write 0 r2 r1
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bsclr */
+
+.data
+.balign 1
+.Lstring.62:
+	.ascii "a->nt == b->nt\000"
+/* end data */
+
+
+.text
+; function bscopy
+.global bscopy
+bscopy:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  read 0 r4 r1
+  read 0 r5 r2
+  beq r1 r2 .L304
+  load 561 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.62 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r5
+  read -16 r14 r4
+.L304:
+  load 0 r1
+.L305:
+  read 0 r4 r2
+  bge r1 r2 .L308
+  add r5 4 r2
+  read 0 r2 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r4 4 r3
+  read 0 r3 r3
+  shiftl r1 2 r6
+  add r3 r6 r3
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L305
+.L308:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bscopy */
+
+
+.text
+; function bsunion
+.global bsunion
+bsunion:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  read 0 r4 r1
+  read 0 r5 r2
+  beq r1 r2 .L313
+  load 562 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.62 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r5
+  read -16 r14 r4
+.L313:
+  load 0 r1
+.L314:
+  read 0 r4 r2
+  bge r1 r2 .L317
+  add r4 4 r2
+  read 0 r2 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  read 0 r3 r2
+  add r5 4 r6
+  read 0 r6 r6
+  shiftl r1 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  or r2 r6 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L314
+.L317:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bsunion */
+
+
+.text
+; function bsinter
+.global bsinter
+bsinter:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  read 0 r4 r1
+  read 0 r5 r2
+  beq r1 r2 .L322
+  load 563 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.62 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r5
+  read -16 r14 r4
+.L322:
+  load 0 r1
+.L323:
+  read 0 r4 r2
+  bge r1 r2 .L326
+  add r4 4 r2
+  read 0 r2 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  read 0 r3 r2
+  add r5 4 r6
+  read 0 r6 r6
+  shiftl r1 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  and r2 r6 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L323
+.L326:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bsinter */
+
+
+.text
+; function bsdiff
+.global bsdiff
+bsdiff:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  read 0 r4 r1
+  read 0 r5 r2
+  beq r1 r2 .L331
+  load 564 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.62 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r5
+  read -16 r14 r4
+.L331:
+  load 0 r1
+.L332:
+  read 0 r4 r2
+  bge r1 r2 .L335
+  add r4 4 r2
+  read 0 r2 r2
+  shiftl r1 2 r3
+  add r2 r3 r3
+  read 0 r3 r2
+  add r5 4 r6
+  read 0 r6 r6
+  shiftl r1 2 r7
+  add r6 r7 r6
+  read 0 r6 r6
+  xor r6 -1 r6
+  and r2 r6 r2
+  write 0 r3 r2
+  add r1 1 r1
+  jump .L332
+.L335:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bsdiff */
+
+
+.text
+; function bsequal
+.global bsequal
+bsequal:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -12 r14 r5
+  write -16 r14 r4
+  read 0 r4 r1
+  read 0 r5 r2
+  beq r1 r2 .L340
+  load 571 r6
+  addr2reg .Lstring.8 r5
+  addr2reg .Lstring.62 r4
+  savpc r15
+  add r15 12 r15
+  jump __assert_fail
+  read -12 r14 r5
+  read -16 r14 r4
+.L340:
+  load 0 r1
+.L341:
+  read 0 r4 r2
+  bge r1 r2 .L345
+  add r4 4 r2
+  read 0 r2 r2
+  shiftl r1 2 r3
+  add r2 r3 r2
+  read 0 r2 r2
+  add r5 4 r3
+  read 0 r3 r3
+  shiftl r1 2 r6
+  add r3 r6 r3
+  read 0 r3 r3
+  bne r2 r3 .L344
+  add r1 1 r1
+  jump .L341
+.L344:
+  load 0 r1
+  jump .L346
+.L345:
+  load 1 r1
+.L346:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bsequal */
+
+
+.text
+; function bszero
+.global bszero
+bszero:
+  or r0 r4 r1
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 8 r13
+  add r1 4 r2
+  read 0 r2 r4
+  read 0 r1 r1
+  shiftl r1 2 r6
+  load 0 r5
+  savpc r15
+  add r15 12 r15
+  jump memset
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bszero */
+
+
+.text
+; function bsiter
+.global bsiter
+bsiter:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 24 r13
+  write -16 r14 r5
+  read 0 r5 r2
+  write -4 r14 r2
+  shiftr r2 5 r1
+  read 0 r4 r3
+  bge r1 r3 .L361
+  add r4 4 r2
+  read 0 r2 r6
+  shiftl r1 2 r2
+  add r6 r2 r2
+  read 0 r2 r2
+  write -8 r14 r2
+  read -4 r14 r2
+  and r2 31 r7
+  load 1 r2
+  shiftl r2 r7 r2
+  load 1 r7
+  sub r2 r7 r7
+  read -8 r14 r2
+  xor r7 -1 r7
+  and r2 r7 r2
+.L355:
+  bne r2 r0 .L359
+  add r1 1 r1
+  bge r1 r3 .L358
+  shiftl r1 2 r2
+  add r6 r2 r2
+  read 0 r2 r2
+  jump .L355
+.L358:
+  load 0 r1
+  jump .L362
+.L359:
+  or r0 r2 r4
+  shiftl r1 5 r1
+  write -12 r14 r1
+  savpc r15
+  add r15 12 r15
+  jump firstbit
+  or r0 r1 r2
+  read -12 r14 r1
+  read -16 r14 r5
+  add r1 r2 r1
+  write 0 r5 r1
+  load 1 r1
+  jump .L362
+.L361:
+  load 0 r1
+.L362:
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function bsiter */
+
+.data
+.balign 1
+.Lstring.70:
+	.ascii "[\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.71:
+	.ascii " %s\000"
+/* end data */
+
+.data
+.balign 1
+.Lstring.72:
+	.ascii " ]\012\000"
+/* end data */
+
+
+.text
+; function dumpts
+.global dumpts
+dumpts:
+  write 0 r13 r14
+  write 4 r13 r15
+  or r0 r13 r14
+  sub r13 28 r13
+  write -8 r14 r5
+  write -12 r14 r4
+  or r0 r6 r4
+  write -16 r14 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.70 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  load 32 r1
+  write -20 r14 r1
+.L366:
+  add r14 -20 r5
+  savpc r15
+  add r15 12 r15
+  jump bsiter
+  read -16 r14 r6
+  read -8 r14 r5
+  beq r1 r0 .L369
+  read -20 r14 r1
+  load 160 r2
+  mults r1 r2 r2
+  or r0 r6 r1
+  add r5 r2 r6
+  load 24 r2
+  sub r13 r2 r13
+  addr2reg .Lstring.71 r5
+  or r0 r1 r4
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  read -16 r14 r6
+  read -8 r14 r5
+  read -12 r14 r4
+  load32 -24 r1
+  sub r13 r1 r13
+  read -20 r14 r1
+  add r1 1 r1
+  write -20 r14 r1
+  jump .L366
+.L369:
+  or r0 r6 r4
+  load 24 r1
+  sub r13 r1 r13
+  addr2reg .Lstring.72 r5
+  savpc r15
+  add r15 12 r15
+  jump fprintf
+  load32 -24 r1
+  sub r13 r1 r13
+  or r0 r14 r13
+  read 4 r14 r15
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function dumpts */
+
+.data
+.balign 4
+.globl typ
+typ:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+.globl insb
+insb:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+.globl curi
+curi:
+	.fill 4,1,0
+/* end data */
+
+.data
+.balign 4
+ptr:
+	.fill 1024,1,0
+/* end data */
+
+.data
+.balign 4
+itbl:
+	.fill 4,1,0
+/* end data */
+
+
+.text
+; function firstbit
+firstbit:
+  load32 65535 r1
+  and r4 r1 r2
+  load 0 r1
+  bne r2 r0 .L376
+  shiftr r4 16 r4
+  load 16 r1
+.L376:
+  and r4 255 r2
+  bne r2 r0 .L378
+  add r1 8 r1
+  shiftr r4 8 r4
+.L378:
+  and r4 15 r2
+  bne r2 r0 .L380
+  add r1 4 r1
+  shiftr r4 4 r4
+.L380:
+  write 0 r13 r14
+  or r0 r13 r14
+  sub r13 24 r13
+  load 4 r2
+  writeb -16 r14 r2
+  add r14 -16 r2
+  add r2 1 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 2 r3
+  load 1 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 3 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 4 r3
+  load 2 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 5 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 6 r3
+  load 1 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 7 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 8 r3
+  load 3 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 9 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 10 r3
+  load 1 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 11 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 12 r3
+  load 2 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 13 r3
+  load 0 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 14 r3
+  load 1 r2
+  writeb 0 r3 r2
+  add r14 -16 r2
+  add r2 15 r3
+  load 0 r2
+  writeb 0 r3 r2
+  and r4 15 r3
+  add r14 -16 r2
+  add r2 r3 r2
+  readb 0 r2 r2
+  add r1 r2 r1
+  or r0 r14 r13
+  read 0 r14 r14
+  jumpr 0 r15
+
+/* end function firstbit */
+
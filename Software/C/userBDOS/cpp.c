@@ -1,26 +1,36 @@
 /*
  * cpp.c — Minimal C preprocessor for FPGC self-hosting toolchain.
  *
- * Targets the subset of features actually used by libc/userlib/userBDOS:
+ * Targets the subset of features used by libc/userlib/userBDOS and doom:
  *   - #include <file>  / #include "file"     (search -I paths, then quote dir)
  *   - #define NAME [body]                    (object-like)
  *   - #define NAME(a, b, ...) body           (function-like)
- *   - #ifdef / #ifndef / #else / #endif      (no #if expression evaluation)
+ *   - # (stringification) and ## (token pasting) in macro bodies
+ *   - Macro calls whose arguments span several lines
+ *   - #undef
+ *   - #if / #elif EXPR with defined(), #ifdef / #ifndef / #else / #endif
+ *   - #error; #pragma is ignored
+ *   - __FILE__ / __LINE__, and the byte order macros gcc predefines
  *   - -D NAME[=VAL] command-line defines
  *   - -I PATH        include search paths (multiple allowed)
  *   - C-style /* ... *\/ and // ... comments stripped
  *   - Backslash-newline line continuation
  *
- * NOT supported (unused in the codebase outside of doom):
- *   - #if EXPR / #elif / #undef / #pragma / #error / #line
- *   - Token pasting (##) and stringification (#)
- *   - __FILE__ / __LINE__ / __DATE__ / __TIME__ / __COUNTER__
+ * NOT supported (unused in the codebase):
+ *   - #line / #warning / #include_next
+ *   - __DATE__ / __TIME__ / __COUNTER__
  *   - Variadic macros (...)
  *   - Computed includes (#include MACRO)
  *
+ * Macros live in a hash table keyed by name. Expansion works on text: an
+ * identifier that must not expand again (a macro found inside its own
+ * expansion) is prefixed with a PAINT byte, which is dropped on output.
+ *
  * Output mirrors `cpp -P` (no line markers).
  *
  * Defining CPP_HOST builds a host (gcc/Linux) variant with stdio for testing.
+ * Defining CC_DRIVER builds the BDOS variant as a stage of the cc driver:
+ * main takes argc/argv and output without -o goes to stdout through stdio.
  */
 
 #ifdef CPP_HOST
@@ -40,7 +50,8 @@
 /*  Limits and buffer sizes                                                  */
 /*===========================================================================*/
 
-#define MAX_MACROS         1024
+#define MAX_MACROS         2048
+#define MACRO_HASH_SIZE    1024    /* power of two */
 #define MAX_MACRO_PARAMS   16
 #define MAX_INCLUDE_DIRS   16
 #define MAX_INCLUDE_DEPTH  16
@@ -48,7 +59,7 @@
 #define LINE_BUF_BYTES     (4 * 1024)
 /* expand_pass uses several stack-allocated buffers of this size and recurses,
  * so keep the total frame under what b32p3's 16-bit signed immediates can
- * encode for `sub r13 imm` (~32 KB). 4 KB per buffer × 6 ≈ 24 KB. */
+ * encode for `sub r13 imm` (~32 KB). 4 KB per buffer × 3 ≈ 12 KB. */
 #define EXPAND_BUF_BYTES   (4 * 1024)
 #define ID_MAX_LEN         128
 
@@ -132,15 +143,23 @@ static char *str_pool;
 static int   str_pool_pos;
 static int   str_pool_size;
 
+/* A name keeps its entry once it has been defined, so #undef only marks
+ * the entry and a later #define of the same name reuses it. */
+#define MACRO_UNDEF  (-2)
+
 typedef struct {
   char *name;
+  int   nlen;
+  unsigned int hash;
+  int   next;          /* next entry of the hash chain + 1; 0 ends it */
   char *body;          /* may be empty */
-  int   nparams;       /* -1 = object-like; >=0 = function-like with N params */
-  char *params[MAX_MACRO_PARAMS];
+  int   nparams;       /* MACRO_UNDEF; -1 = object-like; >=0 = N params */
+  char **params;
 } Macro;
 
 static Macro macros[MAX_MACROS];
 static int   macro_count;
+static int   macro_heads[MACRO_HASH_SIZE];  /* first entry + 1; 0 = empty */
 
 static char *include_dirs[MAX_INCLUDE_DIRS];
 static int   include_dir_count;
@@ -154,7 +173,10 @@ static int cond_active[MAX_COND_DEPTH];
 static int cond_taken[MAX_COND_DEPTH];
 static int cond_depth;
 
-static FILE *out_fp;            /* host output stream */
+/* Marks an identifier that must never expand again; dropped on output. */
+#define PAINT '\x01'
+
+static FILE *out_fp;            /* host output stream, BDOS with CC_DRIVER */
 #ifndef CPP_HOST
 static int   out_fd;            /* BDOS output fd */
 #endif
@@ -177,15 +199,24 @@ static void out_flush(void) { if (out_fp) fflush(out_fp); else fflush(stdout); }
 #else
 static void out_write(const char *s, int n)
 {
-  if (n > 0) sys_write(out_fd, (void *)s, n);
+  if (out_fp) fwrite(s, 1, (size_t)n, out_fp);
+  else if (n > 0) sys_write(out_fd, (void *)s, n);
 }
 static void out_flush(void) { /* BRFS v2 is byte-native, nothing to flush. */ }
 #endif
 
-static void out_str(const char *s)
+static void out_text(const char *s)
 {
-  int n = (int)strlen(s);
-  out_write(s, n);
+  const char *run = s;
+  for (; *s; s++)
+  {
+    if (*s == PAINT)
+    {
+      out_write(run, (int)(s - run));
+      run = s + 1;
+    }
+  }
+  out_write(run, (int)(s - run));
 }
 
 /*===========================================================================*/
@@ -247,34 +278,74 @@ static char *pool_strdup(const char *s)
   return pool_strndup(s, (int)strlen(s));
 }
 
+/* Word-aligned block of n bytes. */
+static void *pool_alloc(int n)
+{
+  char *r;
+  str_pool_pos = (str_pool_pos + 3) & ~3;
+  if (str_pool_pos + n > str_pool_size)
+  {
+    emsg("string pool exhausted");
+    return NULL;
+  }
+  r = str_pool + str_pool_pos;
+  str_pool_pos += n;
+  return r;
+}
+
 /*===========================================================================*/
 /*  Macro table                                                              */
 /*===========================================================================*/
 
-static int macro_lookup(const char *name, int nlen)
+static unsigned int name_hash(const char *s, int n)
 {
-  int i;
-  for (i = 0; i < macro_count; i++)
+  unsigned int h = 5381;
+  while (n-- > 0) h = (h << 5) + h + (unsigned char)*s++;
+  return h;
+}
+
+/* Entry of name, defined or not; -1 if it never was. */
+static int macro_find(const char *name, int nlen, unsigned int h)
+{
+  int i = macro_heads[h & (MACRO_HASH_SIZE - 1)] - 1;
+  while (i >= 0)
   {
-    if ((int)strlen(macros[i].name) == nlen
-        && memcmp(macros[i].name, name, (size_t)nlen) == 0)
+    Macro *m = &macros[i];
+    if (m->hash == h && m->nlen == nlen
+        && memcmp(m->name, name, (size_t)nlen) == 0)
       return i;
+    i = m->next - 1;
   }
   return -1;
 }
 
+static int macro_lookup(const char *name, int nlen)
+{
+  int i = macro_find(name, nlen, name_hash(name, nlen));
+  if (i >= 0 && macros[i].nparams == MACRO_UNDEF) return -1;
+  return i;
+}
+
 static int macro_define(const char *name, int nlen,
                         const char *body,
                         int nparams, char **params)
 {
-  int idx = macro_lookup(name, nlen);
+  unsigned int h = name_hash(name, nlen);
+  int idx = macro_find(name, nlen, h);
   Macro *m;
   if (idx < 0)
   {
+    char *nm;
     if (macro_count >= MAX_MACROS) { emsg("too many macros"); return -1; }
+    nm = pool_strndup(name, nlen);
+    if (!nm) return -1;
     idx = macro_count++;
-    macros[idx].name = pool_strndup(name, nlen);
-    if (!macros[idx].name) return -1;
+    m = &macros[idx];
+    m->name = nm;
+    m->nlen = nlen;
+    m->hash = h;
+    m->next = macro_heads[h & (MACRO_HASH_SIZE - 1)];
+    macro_heads[h & (MACRO_HASH_SIZE - 1)] = idx + 1;
   }
   m = &macros[idx];
   m->body = pool_strdup(body);
@@ -283,6 +354,8 @@ static int macro_define(const char *name, int nlen,
   if (nparams > 0)
   {
     int i;
+    m->params = (char **)pool_alloc(nparams * (int)sizeof(char *));
+    if (!m->params) return -1;
     for (i = 0; i < nparams; i++) m->params[i] = params[i];
   }
   return idx;
@@ -491,40 +564,159 @@ static void strip_comments(char *s, int *in_block_p)
 /*  Macro expansion                                                          */
 /*===========================================================================*/
 
+/* Return codes of expand_pass besides 0 and 1. */
+#define EXP_OVERFLOW  (-1)   /* output buffer full, not reported yet */
+#define EXP_OPEN      (-2)   /* macro call not closed on this line */
+#define EXP_ERROR     (-3)   /* already reported */
+
+/* Macros being expanded, innermost first. */
+typedef struct Hide Hide;
+struct Hide {
+  int macro;
+  const Hide *up;
+};
+
+/* Set when a function-like macro name is left alone for want of a '('
+ * after it: the '(' may follow the expansion the name came from. */
+static int fn_name_pending;
+
+static int param_index(const char *p, int n, int nparams, char **params)
+{
+  int i;
+  for (i = 0; i < nparams; i++)
+    if (strncmp(params[i], p, (size_t)n) == 0 && params[i][n] == '\0')
+      return i;
+  return -1;
+}
+
+/* Append arg to dst, without paint when it is an operand of ##. */
+static int put_arg(const char *a, int strip, char *dst, int *dpos, int dstsz)
+{
+  int dp = *dpos;
+  for (; *a; a++)
+  {
+    if (strip && *a == PAINT) continue;
+    if (dp + 1 >= dstsz) return -1;
+    dst[dp++] = *a;
+  }
+  *dpos = dp;
+  return 0;
+}
+
+/* Append the spelling of arg as a string literal (the # operator):
+ * whitespace runs become one space, and '"' and '\' inside string and
+ * character literals are escaped. */
+static int stringify(const char *a, char *dst, int *dpos, int dstsz)
+{
+  int dp = *dpos;
+  char q = 0;
+  if (dp + 1 >= dstsz) return -1;
+  dst[dp++] = '"';
+  for (; *a; a++)
+  {
+    char c = *a;
+    if (c == PAINT) continue;
+    if (dp + 4 >= dstsz) return -1;
+    if (!q && (c == ' ' || c == '\t'))
+    {
+      while (a[1] == ' ' || a[1] == '\t') a++;
+      dst[dp++] = ' ';
+      continue;
+    }
+    if (q && c == '\\' && a[1])
+    {
+      dst[dp++] = '\\';
+      dst[dp++] = '\\';
+      c = *++a;
+      if (c == '"' || c == '\\') dst[dp++] = '\\';
+      dst[dp++] = c;
+      continue;
+    }
+    if (!q && (c == '"' || c == '\'')) q = c;
+    else if (q && c == q) q = 0;
+    if (c == '"') dst[dp++] = '\\';
+    dst[dp++] = c;
+  }
+  dst[dp++] = '"';
+  *dpos = dp;
+  return 0;
+}
+
 /* Substitute parameter references in `body` with corresponding `args`.
- * Result is appended to dst at *dpos (which is updated). dstsz is the
- * total size of dst. Returns 0 on success, -1 on overflow.
+ * Operands of # and ## take the argument as written (args), any other
+ * reference the macro-expanded one (exargs). With nparams < 0 only ## is
+ * applied. Result is appended to dst at *dpos (which is updated). dstsz is
+ * the total size of dst. Returns 0 on success, -1 on overflow.
  */
 static int substitute_params(const char *body,
-                             int nparams, char **params, char **args,
+                             int nparams, char **params,
+                             char **args, char **exargs,
                              char *dst, int *dpos, int dstsz)
 {
   const char *p = body;
+  int start = *dpos;
   int dp = *dpos;
+  int pasting = 0;        /* the previous token is the left side of ## */
   while (*p)
   {
+    if (*p == '"' || *p == '\'')
+    {
+      char q = *p;
+      if (dp + 1 >= dstsz) return -1;
+      dst[dp++] = *p++;
+      while (*p && *p != q)
+      {
+        if (*p == '\\' && p[1])
+        {
+          if (dp + 2 >= dstsz) return -1;
+          dst[dp++] = *p++;
+        }
+        if (dp + 1 >= dstsz) return -1;
+        dst[dp++] = *p++;
+      }
+      if (*p) { if (dp + 1 >= dstsz) return -1; dst[dp++] = *p++; }
+      pasting = 0;
+      continue;
+    }
+    if (p[0] == '#' && p[1] == '#')
+    {
+      while (dp > start && (dst[dp-1] == ' ' || dst[dp-1] == '\t')) dp--;
+      p = skip_hws(p + 2);
+      pasting = 1;
+      continue;
+    }
+    if (*p == '#' && nparams >= 0)
+    {
+      const char *q = skip_hws(p + 1);
+      const char *e = q;
+      int i = -1;
+      while (is_id_cont((unsigned char)*e)) e++;
+      if (e > q && is_id_start((unsigned char)*q))
+        i = param_index(q, (int)(e - q), nparams, params);
+      if (i >= 0)
+      {
+        if (stringify(args[i], dst, &dp, dstsz) < 0) return -1;
+        p = e;
+        pasting = 0;
+        continue;
+      }
+    }
     if (is_id_start((unsigned char)*p))
     {
       const char *q = p;
       int n;
-      int i, found = -1;
+      int i;
       while (is_id_cont((unsigned char)*q)) q++;
       n = (int)(q - p);
-      for (i = 0; i < nparams; i++)
+      i = param_index(p, n, nparams, params);
+      if (i >= 0)
       {
-        if ((int)strlen(params[i]) == n
-            && memcmp(params[i], p, (size_t)n) == 0)
+        const char *r = skip_hws(q);
+        if (pasting || (r[0] == '#' && r[1] == '#'))
         {
-          found = i; break;
+          if (put_arg(args[i], 1, dst, &dp, dstsz) < 0) return -1;
         }
-      }
-      if (found >= 0)
-      {
-        const char *a = args[found];
-        int alen = (int)strlen(a);
-        if (dp + alen >= dstsz) return -1;
-        memcpy(dst + dp, a, (size_t)alen);
-        dp += alen;
+        else if (put_arg(exargs[i], 0, dst, &dp, dstsz) < 0) return -1;
       }
       else
       {
@@ -533,26 +725,41 @@ static int substitute_params(const char *body,
         dp += n;
       }
       p = q;
+      pasting = 0;
+      continue;
     }
-    else
-    {
-      if (dp + 1 >= dstsz) return -1;
-      dst[dp++] = *p++;
-    }
+    if (dp + 1 >= dstsz) return -1;
+    dst[dp++] = *p++;
+    pasting = 0;
   }
   *dpos = dp;
   return 0;
 }
 
+/* Expand __FILE__ and __LINE__ at dst; returns chars written, 0 if id is
+ * neither, -1 on overflow. */
+static int expand_builtin(const char *id, int idlen, char *dst, int dstsz)
+{
+  int n;
+  if (idlen != 8 || id[0] != '_' || id[1] != '_') return 0;
+  if (memcmp(id, "__FILE__", 8) == 0)
+    n = snprintf(dst, (size_t)dstsz, "\"%s\"",
+                 cur_filename ? cur_filename : "");
+  else if (memcmp(id, "__LINE__", 8) == 0)
+    n = snprintf(dst, (size_t)dstsz, "%d", cur_line);
+  else
+    return 0;
+  return n < dstsz ? n : -1;
+}
+
 /* Expand all macros in `in`, write result to `out`. Returns 1 if any
- * expansion occurred (so caller may rescan). On error returns -1.
+ * expansion occurred, 0 if none, or one of the EXP_ codes.
  *
- * Hide list `hide` is a comma-separated list of macro names that must
- * NOT be expanded (to prevent infinite recursion of self-referential
- * macros, per ISO C "blue paint" rule).
+ * `hide` lists the macros that must NOT be expanded (to prevent infinite
+ * recursion of self-referential macros, per ISO C "blue paint" rule).
  */
 static int expand_pass(const char *in, char *out, int outsz,
-                       const char *hide)
+                       const Hide *hide)
 {
   const char *p = in;
   int op = 0;
@@ -563,89 +770,75 @@ static int expand_pass(const char *in, char *out, int outsz,
     if (*p == '"' || *p == '\'')
     {
       char q = *p;
-      if (op + 1 >= outsz) return -1;
+      if (op + 1 >= outsz) return EXP_OVERFLOW;
       out[op++] = *p++;
       while (*p && *p != q)
       {
         if (*p == '\\' && p[1])
         {
-          if (op + 2 >= outsz) return -1;
+          if (op + 2 >= outsz) return EXP_OVERFLOW;
           out[op++] = *p++;
           out[op++] = *p++;
           continue;
         }
-        if (op + 1 >= outsz) return -1;
+        if (op + 1 >= outsz) return EXP_OVERFLOW;
         out[op++] = *p++;
       }
-      if (*p) { if (op + 1 >= outsz) return -1; out[op++] = *p++; }
+      if (*p) { if (op + 1 >= outsz) return EXP_OVERFLOW; out[op++] = *p++; }
       continue;
     }
-    if (is_id_start((unsigned char)*p))
+    if (*p == PAINT || is_id_start((unsigned char)*p))
     {
       const char *id = p;
       int idlen;
       int midx;
+      const Hide *h;
+      Hide self;
+      if (*p == PAINT) p++;
       while (is_id_cont((unsigned char)*p)) p++;
       idlen = (int)(p - id);
 
-      /* Check hide list. */
-      if (hide && hide[0])
+      midx = *id == PAINT ? -1 : macro_lookup(id, idlen);
+      if (midx < 0)
       {
-        const char *h = hide;
-        int hidden = 0;
-        while (*h)
+        int n = expand_builtin(id, idlen, out + op, outsz - op);
+        if (n < 0) return EXP_OVERFLOW;
+        if (n == 0)
         {
-          const char *e = strchr(h, ',');
-          int hlen = e ? (int)(e - h) : (int)strlen(h);
-          if (hlen == idlen && memcmp(h, id, (size_t)idlen) == 0)
-          { hidden = 1; break; }
-          h += hlen + (e ? 1 : 0);
-          if (!e) break;
-        }
-        if (hidden)
-        {
-          if (op + idlen >= outsz) return -1;
+          if (op + idlen >= outsz) return EXP_OVERFLOW;
           memcpy(out + op, id, (size_t)idlen);
-          op += idlen;
-          continue;
+          n = idlen;
         }
+        op += n;
+        continue;
       }
 
-      midx = macro_lookup(id, idlen);
-      if (midx < 0)
+      /* Painted: a later rescan must not expand it either. */
+      for (h = hide; h; h = h->up) if (h->macro == midx) break;
+      if (h)
       {
-        if (op + idlen >= outsz) return -1;
+        if (op + idlen + 1 >= outsz) return EXP_OVERFLOW;
+        out[op++] = PAINT;
         memcpy(out + op, id, (size_t)idlen);
         op += idlen;
         continue;
       }
+      self.macro = midx;
+      self.up = hide;
 
       /* Object-like */
       if (macros[midx].nparams < 0)
       {
-        const char *body = macros[midx].body;
-        char hide2[ID_MAX_LEN * 4];
-        char tmp[EXPAND_BUF_BYTES];
-        int rc;
-        /* Build hide list = old hide + this name */
-        if (hide && hide[0])
-          snprintf(hide2, sizeof(hide2), "%s,%s", hide, macros[midx].name);
-        else
-          snprintf(hide2, sizeof(hide2), "%s", macros[midx].name);
-        rc = expand_pass(body, tmp, sizeof(tmp), hide2);
-        if (rc < 0) return -1;
-        {
-          int n = (int)strlen(tmp);
-          if (op + n >= outsz) return -1;
-          memcpy(out + op, tmp, (size_t)n);
-          op += n;
-        }
+        int rc = expand_pass(macros[midx].body, out + op, outsz - op, &self);
+        if (rc < 0) return rc;
+        op += (int)strlen(out + op);
         did = 1;
         continue;
       }
 
-      /* Function-like: peek for '(' (skip ws including newlines... but our
-       * input is one logical line, so just spaces/tabs). */
+      /* Function-like: peek for '('. A call whose arguments go on past
+       * the end of the line returns EXP_OPEN, and the caller joins the
+       * next line. */
       {
         const char *q = p;
         char *args[MAX_MACRO_PARAMS];
@@ -653,17 +846,16 @@ static int expand_pass(const char *in, char *out, int outsz,
         int  argpos = 0;
         int  nargs = 0;
         int  depth;
-        char tmp[EXPAND_BUF_BYTES];
-        char hide2[ID_MAX_LEN * 4];
         int  rc;
 
         while (*q == ' ' || *q == '\t') q++;
         if (*q != '(')
         {
           /* Not a call: emit the identifier verbatim. */
-          if (op + idlen >= outsz) return -1;
+          if (op + idlen >= outsz) return EXP_OVERFLOW;
           memcpy(out + op, id, (size_t)idlen);
           op += idlen;
+          fn_name_pending = 1;
           continue;
         }
         q++; /* past '(' */
@@ -673,17 +865,19 @@ static int expand_pass(const char *in, char *out, int outsz,
         depth = 1;
         while (*q && depth > 0)
         {
+          if (argpos >= (int)sizeof(argbuf) - 4)
+          { emsg("macro arg too long"); return EXP_ERROR; }
           if (*q == '"' || *q == '\'')
           {
             char qc = *q;
             argbuf[argpos++] = *q++;
-            while (*q && *q != qc)
+            while (*q && *q != qc && argpos < (int)sizeof(argbuf) - 4)
             {
               if (*q == '\\' && q[1])
               { argbuf[argpos++] = *q++; argbuf[argpos++] = *q++; continue; }
               argbuf[argpos++] = *q++;
             }
-            if (*q) argbuf[argpos++] = *q++;
+            if (*q == qc) argbuf[argpos++] = *q++;
             continue;
           }
           if (*q == '(') { depth++; argbuf[argpos++] = *q++; continue; }
@@ -697,7 +891,7 @@ static int expand_pass(const char *in, char *out, int outsz,
           {
             argbuf[argpos++] = '\0';
             if (nargs + 1 >= MAX_MACRO_PARAMS)
-            { emsg("too many macro args"); return -1; }
+            { emsg("too many macro args"); return EXP_ERROR; }
             nargs++;
             args[nargs] = &argbuf[argpos];
             q++;
@@ -705,10 +899,8 @@ static int expand_pass(const char *in, char *out, int outsz,
             continue;
           }
           argbuf[argpos++] = *q++;
-          if (argpos >= (int)sizeof(argbuf) - 4)
-          { emsg("macro arg too long"); return -1; }
         }
-        if (depth != 0) { emsg("unterminated macro call"); return -1; }
+        if (depth != 0) return EXP_OPEN;
         argbuf[argpos++] = '\0';
         nargs++;
 
@@ -731,14 +923,14 @@ static int expand_pass(const char *in, char *out, int outsz,
           if (!(nargs == 1 && args[0][0] == '\0'))
           {
             emsg2("wrong arg count for macro ", macros[midx].name);
-            return -1;
+            return EXP_ERROR;
           }
           nargs = 0;
         }
         else if (nargs != macros[midx].nparams)
         {
           emsg2("wrong arg count for macro ", macros[midx].name);
-          return -1;
+          return EXP_ERROR;
         }
 
         /* Pre-expand arguments (so MACRO(M(x)) sees expanded x). */
@@ -749,17 +941,11 @@ static int expand_pass(const char *in, char *out, int outsz,
           int i;
           for (i = 0; i < nargs; i++)
           {
-            char tmpa[EXPAND_BUF_BYTES];
-            int rc2 = expand_pass(args[i], tmpa, sizeof(tmpa), hide);
-            int alen;
-            if (rc2 < 0) return -1;
-            alen = (int)strlen(tmpa);
-            if (ep + alen + 1 >= (int)sizeof(expanded_argbuf))
-            { emsg("expansion buffer overflow"); return -1; }
             exargs[i] = expanded_argbuf + ep;
-            memcpy(expanded_argbuf + ep, tmpa, (size_t)alen);
-            ep += alen;
-            expanded_argbuf[ep++] = '\0';
+            rc = expand_pass(args[i], exargs[i],
+                             (int)sizeof(expanded_argbuf) - ep, hide);
+            if (rc < 0) return rc;
+            ep += (int)strlen(exargs[i]) + 1;
           }
 
           /* Substitute params in body. */
@@ -769,23 +955,15 @@ static int expand_pass(const char *in, char *out, int outsz,
             int rcs = substitute_params(macros[midx].body,
                                         macros[midx].nparams,
                                         macros[midx].params,
-                                        exargs, subst, &sp, sizeof(subst));
-            if (rcs < 0) { emsg("expansion buffer overflow"); return -1; }
+                                        args, exargs,
+                                        subst, &sp, sizeof(subst));
+            if (rcs < 0) return EXP_OVERFLOW;
             subst[sp] = '\0';
 
-            /* Recursive expand of result with this name in hide list. */
-            if (hide && hide[0])
-              snprintf(hide2, sizeof(hide2), "%s,%s", hide, macros[midx].name);
-            else
-              snprintf(hide2, sizeof(hide2), "%s", macros[midx].name);
-            rc = expand_pass(subst, tmp, sizeof(tmp), hide2);
-            if (rc < 0) return -1;
-            {
-              int n = (int)strlen(tmp);
-              if (op + n >= outsz) return -1;
-              memcpy(out + op, tmp, (size_t)n);
-              op += n;
-            }
+            /* Recursive expand of result with this name hidden. */
+            rc = expand_pass(subst, out + op, outsz - op, &self);
+            if (rc < 0) return rc;
+            op += (int)strlen(out + op);
             did = 1;
           }
         }
@@ -794,13 +972,272 @@ static int expand_pass(const char *in, char *out, int outsz,
         continue;
       }
     }
-    if (op + 1 >= outsz) return -1;
+    if (op + 1 >= outsz) return EXP_OVERFLOW;
     out[op++] = *p++;
   }
   out[op] = '\0';
   return did;
 }
 
+/* Expand all macros of one logical line into buf, using buf2 (both sz
+ * bytes) for rescans. A pass that leaves a function-like macro name behind
+ * is rescanned, since its '(' may come after the expansion that produced
+ * the name. Sets *result to the buffer holding the text. */
+static int expand_line(const char *line, char *buf, char *buf2, int sz,
+                       const char **result)
+{
+  const char *cur = buf;
+  char *other = buf2;
+  int iter = 0;
+  int rc;
+  fn_name_pending = 0;
+  rc = expand_pass(line, buf, sz, NULL);
+  while (rc > 0 && fn_name_pending && iter < 50)
+  {
+    fn_name_pending = 0;
+    rc = expand_pass(cur, other, sz, NULL);
+    if (rc < 0) break;
+    {
+      const char *t = cur;
+      cur = other;
+      other = (char *)t;
+    }
+    iter++;
+  }
+  *result = cur;
+  return rc;
+}
+
+/*===========================================================================*/
+/*  #if expressions                                                          */
+/*===========================================================================*/
+
+static const char *ex_p;     /* parse position */
+static int         ex_bad;   /* syntax error seen */
+static int         ex_skip;  /* >0 inside an operand that is not evaluated */
+
+/* Binary operators, lowest precedence first; a spelling comes before the
+ * ones that are its prefix. */
+static const struct { const char *op; int prec; } ex_ops[] = {
+  { "||", 1 }, { "&&", 2 }, { "|", 3 }, { "^", 4 }, { "&", 5 },
+  { "==", 6 }, { "!=", 6 }, { "<=", 7 }, { ">=", 7 }, { "<<", 8 },
+  { ">>", 8 }, { "<", 7 }, { ">", 7 }, { "+", 9 }, { "-", 9 },
+  { "*", 10 }, { "/", 10 }, { "%", 10 },
+};
+#define EX_NOPS ((int)(sizeof(ex_ops) / sizeof(ex_ops[0])))
+
+static long ex_cond(void);
+
+static void ex_ws(void)
+{
+  while (*ex_p == ' ' || *ex_p == '\t' || *ex_p == PAINT) ex_p++;
+}
+
+static long ex_char(void)
+{
+  long v;
+  ex_p++;                     /* past the opening quote */
+  if (*ex_p == '\\')
+  {
+    ex_p++;
+    switch (*ex_p)
+    {
+      case 'n': v = '\n'; ex_p++; break;
+      case 't': v = '\t'; ex_p++; break;
+      case 'r': v = '\r'; ex_p++; break;
+      case 'a': v = 7; ex_p++; break;
+      case 'b': v = 8; ex_p++; break;
+      case 'f': v = 12; ex_p++; break;
+      case 'v': v = 11; ex_p++; break;
+      case 'x':
+        v = (long)strtoul(ex_p + 1, (char **)&ex_p, 16);
+        break;
+      default:
+        if (*ex_p >= '0' && *ex_p <= '7')
+        {
+          int n = 0;
+          v = 0;
+          while (n < 3 && *ex_p >= '0' && *ex_p <= '7')
+          { v = v * 8 + (*ex_p++ - '0'); n++; }
+        }
+        else v = (unsigned char)*ex_p++;
+        break;
+    }
+  }
+  else v = (unsigned char)*ex_p++;
+  if (*ex_p != '\'') { ex_bad = 1; return 0; }
+  ex_p++;
+  return v;
+}
+
+static long ex_unary(void)
+{
+  long v;
+  ex_ws();
+  switch (*ex_p)
+  {
+    case '!': ex_p++; return !ex_unary();
+    case '~': ex_p++; return ~ex_unary();
+    case '-': ex_p++; return -ex_unary();
+    case '+': ex_p++; return ex_unary();
+    case '(':
+      ex_p++;
+      v = ex_cond();
+      ex_ws();
+      if (*ex_p != ')') { ex_bad = 1; return 0; }
+      ex_p++;
+      return v;
+    case '\'':
+      return ex_char();
+  }
+  if (*ex_p >= '0' && *ex_p <= '9')
+  {
+    v = (long)strtoul(ex_p, (char **)&ex_p, 0);
+    while (*ex_p == 'u' || *ex_p == 'U' || *ex_p == 'l' || *ex_p == 'L')
+      ex_p++;
+    return v;
+  }
+  /* Identifiers left after expansion are 0. */
+  if (is_id_start((unsigned char)*ex_p))
+  {
+    while (is_id_cont((unsigned char)*ex_p)) ex_p++;
+    return 0;
+  }
+  ex_bad = 1;
+  return 0;
+}
+
+static long ex_binary(int min_prec)
+{
+  long l = ex_unary();
+  for (;;)
+  {
+    const char *op;
+    int i, n, prec, skip;
+    long r;
+    ex_ws();
+    for (i = 0; i < EX_NOPS; i++)
+    {
+      n = (int)strlen(ex_ops[i].op);
+      if (strncmp(ex_p, ex_ops[i].op, (size_t)n) == 0) break;
+    }
+    if (i == EX_NOPS || ex_ops[i].prec < min_prec) return l;
+    op = ex_ops[i].op;
+    prec = ex_ops[i].prec;
+    ex_p += n;
+    skip = (op[0] == '&' && op[1] == '&' && !l)
+        || (op[0] == '|' && op[1] == '|' && l);
+    ex_skip += skip;
+    r = ex_binary(prec + 1);
+    ex_skip -= skip;
+    switch (op[0])
+    {
+      case '|': l = op[1] ? (l || r) : (l | r); break;
+      case '&': l = op[1] ? (l && r) : (l & r); break;
+      case '^': l = l ^ r; break;
+      case '=': l = l == r; break;
+      case '!': l = l != r; break;
+      case '<': l = op[1] == '=' ? l <= r : op[1] == '<' ? l << r : l < r; break;
+      case '>': l = op[1] == '=' ? l >= r : op[1] == '>' ? l >> r : l > r; break;
+      case '+': l = l + r; break;
+      case '-': l = l - r; break;
+      case '*': l = l * r; break;
+      default:
+        if (r == 0)
+        {
+          if (!ex_skip) emsg("division by zero in #if");
+          l = 0;
+        }
+        else l = op[0] == '/' ? l / r : l % r;
+        break;
+    }
+  }
+}
+
+static long ex_cond(void)
+{
+  long c = ex_binary(1);
+  long a, b;
+  ex_ws();
+  if (*ex_p != '?') return c;
+  ex_p++;
+  ex_skip += !c;
+  a = ex_cond();
+  ex_skip -= !c;
+  ex_ws();
+  if (*ex_p != ':') { ex_bad = 1; return 0; }
+  ex_p++;
+  ex_skip += !!c;
+  b = ex_cond();
+  ex_skip -= !!c;
+  return c ? a : b;
+}
+
+/* Evaluate the expression of #if or #elif: defined NAME and defined(NAME)
+ * first, then macros, then the C operators on long. */
+static int eval_if(const char *expr)
+{
+  char buf[LINE_BUF_BYTES];
+  char exp1[EXPAND_BUF_BYTES];
+  char exp2[EXPAND_BUF_BYTES];
+  const char *p = expr;
+  const char *res;
+  int bp = 0;
+  int rc;
+  long v;
+
+  while (*p)
+  {
+    if (bp + 4 >= (int)sizeof(buf)) { emsg("#if expression too long"); return 0; }
+    if (is_id_start((unsigned char)*p))
+    {
+      const char *id = p;
+      while (is_id_cont((unsigned char)*p)) p++;
+      if (p - id == 7 && memcmp(id, "defined", 7) == 0)
+      {
+        const char *name;
+        int paren;
+        p = skip_hws(p);
+        paren = *p == '(';
+        if (paren) p = skip_hws(p + 1);
+        name = p;
+        while (is_id_cont((unsigned char)*p)) p++;
+        if (p == name) { emsg("missing identifier after defined"); return 0; }
+        buf[bp++] = macro_lookup(name, (int)(p - name)) >= 0 ? '1' : '0';
+        buf[bp++] = ' ';
+        if (paren)
+        {
+          p = skip_hws(p);
+          if (*p != ')') { emsg("missing ')' after defined"); return 0; }
+          p++;
+        }
+        continue;
+      }
+      if (bp + (int)(p - id) >= (int)sizeof(buf))
+      { emsg("#if expression too long"); return 0; }
+      memcpy(buf + bp, id, (size_t)(p - id));
+      bp += (int)(p - id);
+      continue;
+    }
+    buf[bp++] = *p++;
+  }
+  buf[bp] = '\0';
+
+  rc = expand_line(buf, exp1, exp2, sizeof(exp1), &res);
+  if (rc < 0)
+  {
+    if (rc != EXP_ERROR) emsg("bad macro call in #if");
+    return 0;
+  }
+  ex_p = res;
+  ex_bad = 0;
+  ex_skip = 0;
+  v = ex_cond();
+  ex_ws();
+  if (ex_bad || *ex_p) { emsg("bad #if expression"); return 0; }
+  return v != 0;
+}
+
 /*===========================================================================*/
 /*  Directive handling                                                       */
 /*===========================================================================*/
@@ -867,6 +1304,17 @@ static void handle_define(const char *line)
       if (blen >= (int)sizeof(buf)) { emsg("macro body too long"); return; }
       memcpy(buf, body, (size_t)blen);
       buf[blen] = '\0';
+      /* An object-like body pastes the same on every use: do it once. */
+      if (nparams < 0 && strstr(buf, "##"))
+      {
+        char pasted[LINE_BUF_BYTES];
+        int pp = 0;
+        if (substitute_params(buf, -1, NULL, NULL, NULL,
+                              pasted, &pp, sizeof(pasted)) < 0)
+        { emsg("macro body too long"); return; }
+        memcpy(buf, pasted, (size_t)pp);
+        buf[pp] = '\0';
+      }
       /* Note: pool_strdup'd inside macro_define; pass params (which point
        * into paramsbuf on stack) — duplicate them too. */
       {
@@ -942,6 +1390,36 @@ static void handle_endif(void)
   cond_depth--;
 }
 
+static void handle_if(const char *line)
+{
+  cond_push(branch_active() && eval_if(line));
+}
+
+static void handle_elif(const char *line)
+{
+  int top = cond_depth - 1;
+  int outer = 1, i;
+  if (cond_depth == 0) { emsg("#elif without #if"); return; }
+  for (i = 0; i < top; i++) if (!cond_active[i]) outer = 0;
+  cond_active[top] = 0;
+  if (outer && !cond_taken[top] && eval_if(line))
+  {
+    cond_active[top] = 1;
+    cond_taken[top] = 1;
+  }
+}
+
+static void handle_undef(const char *line)
+{
+  const char *p = skip_hws(line);
+  const char *name = p;
+  int idx;
+  while (is_id_cont((unsigned char)*p)) p++;
+  if (p == name) { emsg("missing identifier"); return; }
+  idx = macro_lookup(name, (int)(p - name));
+  if (idx >= 0) macros[idx].nparams = MACRO_UNDEF;
+}
+
 static void handle_include(const char *line)
 {
   const char *p = skip_hws(line);
@@ -1001,6 +1479,7 @@ static void process_text(const char *text, const char *filename)
 {
   char line[LINE_BUF_BYTES];
   char expanded[EXPAND_BUF_BYTES];
+  char buf2[EXPAND_BUF_BYTES];
   const char *src = text;
   int lines_consumed;
   int in_block = 0;       /* tracks block comments across lines */
@@ -1044,6 +1523,14 @@ static void process_text(const char *text, const char *filename)
         {
           handle_ifdef(rest, 1);
         }
+        else if (dlen == 2 && memcmp(d, "if", 2) == 0)
+        {
+          handle_if(rest);
+        }
+        else if (dlen == 4 && memcmp(d, "elif", 4) == 0)
+        {
+          handle_elif(rest);
+        }
         else if (dlen == 4 && memcmp(d, "else", 4) == 0)
         {
           handle_else();
@@ -1058,6 +1545,12 @@ static void process_text(const char *text, const char *filename)
             handle_define(rest);
           else if (dlen == 7 && memcmp(d, "include", 7) == 0)
             handle_include(rest);
+          else if (dlen == 5 && memcmp(d, "undef", 5) == 0)
+            handle_undef(rest);
+          else if (dlen == 5 && memcmp(d, "error", 5) == 0)
+            emsg2("#error ", skip_hws(rest));
+          else if (dlen == 6 && memcmp(d, "pragma", 6) == 0)
+            ; /* no pragmas are recognised */
           else if (dlen == 0)
             ; /* null directive */
           else
@@ -1085,28 +1578,29 @@ static void process_text(const char *text, const char *filename)
       continue;
     }
 
-    /* expand macros (comments already stripped above) */
+    /* expand macros (comments already stripped above); a macro call left
+     * open takes in the following lines */
     {
-      int rc = expand_pass(line, expanded, sizeof(expanded), NULL);
-      const char *to_emit = expanded;
-      int iter = 0;
-      char buf2[EXPAND_BUF_BYTES];
-      const char *cur = expanded;
-      char *other = buf2;
-      while (rc > 0 && iter < 50)
+      const char *res;
+      int rc = expand_line(line, expanded, buf2, sizeof(expanded), &res);
+      while (rc == EXP_OPEN)
       {
-        rc = expand_pass(cur, other, sizeof(buf2), NULL);
-        if (rc < 0) break;
-        {
-          const char *t = cur;
-          cur = other;
-          /* swap by reusing expanded as the other buffer */
-          other = (char *)t;
-        }
-        iter++;
+        int len = (int)strlen(line);
+        int more;
+        const char *next = skip_hws(src);
+        if (*next == '#' || len + 2 >= (int)sizeof(line)) break;
+        line[len] = ' ';
+        next = read_logical_line(src, line + len + 1,
+                                 (int)sizeof(line) - len - 1, &more);
+        if (!next) break;
+        src = next;
+        strip_comments(line + len + 1, &in_block);
+        lines_consumed += more;
+        rc = expand_line(line, expanded, buf2, sizeof(expanded), &res);
       }
-      to_emit = cur;
-      out_str(to_emit);
+      if (rc == EXP_OPEN) emsg("unterminated macro call");
+      else if (rc == EXP_OVERFLOW) emsg("expansion buffer overflow");
+      else if (rc >= 0) out_text(res);
     }
     out_write("\n", 1);
     cur_line += lines_consumed;
@@ -1117,6 +1611,21 @@ static void process_text(const char *text, const char *filename)
 /*  Top-level                                                                */
 /*===========================================================================*/
 
+/* Macros gcc predefines that the sources test. B32P3 is little endian. */
+static void predefine(void)
+{
+  static const char *const defs[] = {
+    "__STDC__", "1",
+    "__STDC_VERSION__", "201112L",
+    "__ORDER_LITTLE_ENDIAN__", "1234",
+    "__ORDER_BIG_ENDIAN__", "4321",
+    "__BYTE_ORDER__", "__ORDER_LITTLE_ENDIAN__",
+  };
+  int i;
+  for (i = 0; i < (int)(sizeof(defs) / sizeof(defs[0])); i += 2)
+    macro_define(defs[i], (int)strlen(defs[i]), defs[i + 1], -1, NULL);
+}
+
 static void usage(void)
 {
   IO_PRINT_ERR(
@@ -1134,6 +1643,7 @@ int main(int argc, char **argv)
   str_pool_size = STR_POOL_BYTES;
   str_pool = (char *)malloc(STR_POOL_BYTES);
   if (!str_pool) { fprintf(stderr, "cpp: out of memory\n"); return 1; }
+  predefine();
 
   for (i = 1; i < argc; i++)
   {
@@ -1217,11 +1727,16 @@ int main(int argc, char **argv)
   return has_error ? 1 : 0;
 }
 #else
+#ifdef CC_DRIVER
+int main(int argc, char **argv)
+{
+#else
 int main()
 {
   /* BDOS entry: parse argv via sys_argc/argv, mirror host behavior. */
   int argc = sys_argc();
   char **argv = sys_argv();
+#endif
   int i;
   const char *input_path = NULL;
   const char *output_path = NULL;
@@ -1229,6 +1744,7 @@ int main()
   str_pool_size = STR_POOL_BYTES;
   str_pool = (char *)malloc(STR_POOL_BYTES);
   if (!str_pool) { sys_putstr("cpp: out of memory\n"); return 1; }
+  predefine();
 
   for (i = 1; i < argc; i++)
   {
@@ -1264,6 +1780,9 @@ int main()
   {
     /* No output file: write to stdout — BDOS shell captures via pipe. */
     out_fd = 1;
+#ifdef CC_DRIVER
+    out_fp = stdout;
+#endif
   }
 
   {
@@ -1277,7 +1796,10 @@ int main()
   }
 
   out_flush();
-  if (out_fd > 0) sys_close(out_fd);
+  if (out_fd > 1) sys_close(out_fd);
+#ifdef CC_DRIVER
+  free(str_pool);
+#endif
   return has_error ? 1 : 0;
 }
 #endif
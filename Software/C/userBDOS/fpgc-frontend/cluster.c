@@ -1,6 +1,7 @@
 #include <string.h>
 #include <syscall.h>
 #include <fnp.h>
+#include <cluster.h>
 #include "net.h"
 #include "tcp.h"
 #include "cluster.h"
@@ -8,9 +9,6 @@
 /* FNP message types — must match fnp.h */
 #define FNP_TYPE_TETRIS_BOARD      0x52
 #define FNP_TYPE_TETRIS_GA_STATUS  0x54
-#define FNP_TYPE_CLUSTER_PARAMS    0x40
-#define FNP_TYPE_CLUSTER_ASSIGN    0x41
-#define FNP_TYPE_CLUSTER_RESULT    0x42
 
 /* FNP header offsets (after 14-byte Ethernet header):
  * [14] Version  [15] Type  [16-17] Seq  [18] Flags  [19-20] Length  [21+] Data */
@@ -20,8 +18,9 @@
 #define FNP_HDR_LEN     19
 #define FNP_HDR_DATA    21
 
-/* Mandelbrot worker MAC address (Device 4: 02:B4:B4:00:00:04) */
-static int mbrot_worker_mac[6] = {0x02, 0xB4, 0xB4, 0x00, 0x00, 0x04};
+/* Coordinator for the mbrotc workers (userlib cluster runtime) */
+static cl_coord_t mbrot_cluster;
+static char mbrot_job[28];
 
 /* FNP sequence counter and frame buffer for outgoing messages */
 static int fnp_tx_seq;
@@ -54,7 +53,7 @@ void cluster_init(void)
     memset(sse_clients, 0, sizeof(sse_clients));
     hist_count = 0;
     fnp_tx_seq = 0;
-    fnp_init(); /* Initialize userlib FNP (reads MAC) */
+    cl_coord_init(&mbrot_cluster, MBROT_APP_ID); /* also runs fnp_init() */
 }
 
 /* Forward declaration */
@@ -179,9 +178,7 @@ static void push_mbrot_sse(struct tcp_conn *conn)
         return;
 
     /* How many pixels have been received so far? */
-    received_pixels = mbrot_state.chunks_received * MBROT_CHUNK_SIZE;
-    if (received_pixels > MBROT_PIXELS)
-        received_pixels = MBROT_PIXELS;
+    received_pixels = mbrot_state.rows_received * MBROT_WIDTH;
 
     offset = mbrot_state.last_sent_offset;
     if (offset >= received_pixels)
@@ -219,7 +216,7 @@ static void push_mbrot_sse(struct tcp_conn *conn)
 
     /* Send done event when all pixels received and streamed */
     if (mbrot_state.last_sent_offset >= MBROT_PIXELS
-        && mbrot_state.chunks_received >= mbrot_state.total_chunks)
+        && mbrot_state.rows_received >= MBROT_HEIGHT)
     {
         char done[32];
         int dpos;
@@ -319,6 +316,10 @@ void cluster_handle(const char *frame, int len)
 
     if (len < FNP_HDR_DATA) return;
 
+    /* Worker discovery, heartbeats and results */
+    if (cl_coord_handle_frame(&mbrot_cluster, (char *)frame, len))
+        return;
+
     msg_type = (int)(unsigned char)frame[FNP_HDR_TYPE];
     rx_flags = (int)(unsigned char)frame[FNP_HDR_FLAGS];
     payload_len = (int)read_u16(frame + FNP_HDR_LEN);
@@ -400,36 +401,26 @@ void cluster_handle(const char *frame, int len)
         }
         break;
 
-    case FNP_TYPE_CLUSTER_RESULT:
-        if (payload_len >= 4)
-        {
-            int chunk_idx;
-            int pixel_count;
-            int offset;
-
-            chunk_idx = (int)read_u32(payload);
-            pixel_count = payload_len - 4;
-            offset = chunk_idx * MBROT_CHUNK_SIZE;
-
-            if (offset + pixel_count <= MBROT_PIXELS)
-            {
-                memcpy(mbrot_state.pixels + offset,
-                       payload + 4, (unsigned int)pixel_count);
-                mbrot_state.chunks_received++;
-                mbrot_state.updated = 1;
-            }
-        }
-        break;
     }
 }
 
-/* Send an FNP frame using the userlib fnp_send() function.
- * Uses the same proven code path as mbroth.c. */
-static void cluster_fnp_send(int msg_type, const char *data, int data_len)
+/* Result fragment `frag` of unit `unit` is row unit * MBROT_UNIT_ROWS + frag.
+ * Rows arrive in any order; SSE streams the gap-free prefix. */
+static void mbrot_on_row(int unit, int frag, const char *data, int len,
+                         void *ctx)
 {
-    fnp_send(mbrot_worker_mac, msg_type, fnp_tx_seq, 0,
-             (char *)data, data_len, fnp_frame_buf);
-    fnp_tx_seq++;
+    int y;
+
+    y = unit * MBROT_UNIT_ROWS + frag;
+    if (y >= MBROT_HEIGHT || len > MBROT_WIDTH)
+        return;
+
+    memcpy(mbrot_state.pixels + y * MBROT_WIDTH, data, (unsigned int)len);
+    mbrot_state.row_done[y] = 1;
+    while (mbrot_state.rows_received < MBROT_HEIGHT
+           && mbrot_state.row_done[mbrot_state.rows_received])
+        mbrot_state.rows_received++;
+    mbrot_state.updated = 1;
 }
 
 /* Parse a URL-encoded form field value.
@@ -569,8 +560,8 @@ void cluster_handle_render_request(struct tcp_conn *conn, const char *body)
     mbrot_state.rendering = 1;
     mbrot_state.width = MBROT_WIDTH;
     mbrot_state.height = MBROT_HEIGHT;
-    mbrot_state.chunks_received = 0;
-    mbrot_state.total_chunks = MBROT_TOTAL_CHUNKS;
+    mbrot_state.rows_received = 0;
+    memset(mbrot_state.row_done, 0, MBROT_HEIGHT);
     mbrot_state.last_sent_offset = 0;
     mbrot_state.updated = 1;
 
@@ -598,34 +589,26 @@ void cluster_handle_render_request(struct tcp_conn *conn, const char *body)
     conn->http_state = HTTP_DONE;
 }
 
-/* Called from main event loop — sends deferred FNP messages */
+/* Called from main event loop — starts deferred renders and runs the
+ * cluster coordinator (dispatch, heartbeats, re-dispatch). */
 void cluster_poll(void)
 {
-    char params[28];
-    char assign[12];
-
-    if (!mbrot_state.send_pending)
-        return;
-
-    mbrot_state.send_pending = 0;
-
-    /* Build CLUSTER_PARAMS payload (28 bytes, matching mbroth.c) */
-    write_u32(params + 0,  mbrot_state.params[0]);
-    write_u32(params + 4,  mbrot_state.params[1]);
-    write_u32(params + 8,  mbrot_state.params[2]);
-    write_u32(params + 12, mbrot_state.params[3]);
-    write_u32(params + 16, mbrot_state.params[4]);
-    write_u32(params + 20, mbrot_state.params[5]);
-    write_u32(params + 24, mbrot_state.params[6]);
-
-    /* Send CLUSTER_PARAMS to mandelbrot worker */
-    cluster_fnp_send(FNP_TYPE_CLUSTER_PARAMS, params, 28);
-
-    /* Build CLUSTER_ASSIGN payload (12 bytes): worker, rows 0–240 */
-    write_u32(assign + 0, (unsigned int)(mbrot_worker_mac[5] - 0x02)); /* worker_id */
-    write_u32(assign + 4, 0);            /* y_start */
-    write_u32(assign + 8, MBROT_HEIGHT); /* y_end */
+    if (mbrot_state.send_pending)
+    {
+        mbrot_state.send_pending = 0;
+
+        /* Job parameters: 28 bytes, matching mbroth.c */
+        write_u32(mbrot_job + 0,  mbrot_state.params[0]);
+        write_u32(mbrot_job + 4,  mbrot_state.params[1]);
+        write_u32(mbrot_job + 8,  mbrot_state.params[2]);
+        write_u32(mbrot_job + 12, mbrot_state.params[3]);
+        write_u32(mbrot_job + 16, mbrot_state.params[4]);
+        write_u32(mbrot_job + 20, mbrot_state.params[5]);
+        write_u32(mbrot_job + 24, mbrot_state.params[6]);
+
+        cl_coord_start(&mbrot_cluster, mbrot_job, 28,
+                       MBROT_HEIGHT / MBROT_UNIT_ROWS, mbrot_on_row, 0);
+    }
 
-    /* Send CLUSTER_ASSIGN to mandelbrot worker */
-    cluster_fnp_send(FNP_TYPE_CLUSTER_ASSIGN, assign, 12);
+    cl_coord_poll(&mbrot_cluster);
 }
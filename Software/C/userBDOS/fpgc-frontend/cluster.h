@@ -11,8 +11,10 @@
 #define MBROT_WIDTH   320
 #define MBROT_HEIGHT  240
 #define MBROT_PIXELS  (MBROT_WIDTH * MBROT_HEIGHT)
-#define MBROT_CHUNK_SIZE 1020
-#define MBROT_TOTAL_CHUNKS ((MBROT_PIXELS + MBROT_CHUNK_SIZE - 1) / MBROT_CHUNK_SIZE)
+
+/* Cluster job for mbrotc workers (must match mbroth.c / mbrotc.c) */
+#define MBROT_APP_ID     0x4D42
+#define MBROT_UNIT_ROWS  4
 
 /* Cluster state */
 struct tetris_state {
@@ -37,10 +39,10 @@ struct mbrot_state {
     int rendering;
     int width;
     int height;
-    int chunks_received;
-    int total_chunks;
+    int rows_received;   /* rows received without a gap from row 0 */
     int last_sent_offset; /* next pixel offset to stream via SSE */
-    int send_pending;    /* 1 = need to send PARAMS+ASSIGN to worker */
+    int send_pending;    /* 1 = need to start a cluster job */
+    unsigned char row_done[MBROT_HEIGHT];
     unsigned int params[7]; /* center_re hi/lo, center_im hi/lo, scale hi/lo, max_iter */
     unsigned char pixels[MBROT_PIXELS];
     int updated;
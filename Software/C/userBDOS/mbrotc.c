@@ -1,27 +1,25 @@
 //
 // mbrotc.c — Cluster Mandelbrot worker program (userBDOS).
 //
-// Receives view parameters and row assignments from the coordinator via FNP,
-// computes Mandelbrot pixels using the FP64 coprocessor, and sends results
-// back in chunks.
+// Runs the userlib cluster worker loop: the job parameters are the view
+// (center, scale, max_iter), a work unit is UNIT_ROWS screen rows. Rows
+// are computed with the FP64 coprocessor and streamed back as one result
+// fragment each. Exits when the coordinator sends BYE or on Escape.
 //
 
 #include <syscall.h>
-#include <fnp.h>
+#include <cluster.h>
 
 // ---- Screen constants ----
 #define SCREEN_WIDTH  320
 #define SCREEN_HEIGHT 240
 
-// ---- Chunk constants ----
-#define CHUNK_HEADER_SIZE  4
-#define CHUNK_MAX_PIXELS   1020
-#define CHUNK_MAX_PAYLOAD  (CHUNK_HEADER_SIZE + CHUNK_MAX_PIXELS)
+// ---- Cluster job (must match mbroth.c) ----
+#define MBROT_APP_ID  0x4D42
+#define PARAMS_SIZE   28
+#define UNIT_ROWS     4
 
-// ---- Maximum iterations ----
-#define DEFAULT_MAX_ITER 128
-
-// ---- View parameters (received from coordinator) ----
+// ---- View parameters (from the job) ----
 int center_re_hi;
 unsigned int center_re_lo;
 int center_im_hi;
@@ -30,26 +28,9 @@ int scale_hi;
 unsigned int scale_lo;
 int max_iter;
 
-// ---- Assignment (received from coordinator) ----
-int assign_y_start;
-int assign_y_end;
-
-// ---- Coordinator MAC ----
-int coord_mac[6];
-
 // ---- Buffers ----
-char frame_buf[FNP_FRAME_BUF_SIZE];
-char chunk_payload[CHUNK_MAX_PAYLOAD];
 char pixel_buf[SCREEN_WIDTH];
 
-// ---- Sequence counter ----
-int tx_seq;
-
-// ---- State ----
-int has_params;
-int has_assign;
-int our_worker_id;
-
 // ---- Assembly FP64 helpers (mbrotc_asm.asm) ----
 extern void mbrotc_load_cre(int hi, int lo);
 extern void mbrotc_load_cim(int hi, int lo);
@@ -71,15 +52,7 @@ extern int  mbrotc_mandelbrot_pixel(int max_iter);
 
 // ---- Helpers ----
 
-void write_u32(char *buf, int offset, unsigned int val)
-{
-  buf[offset]     = (val >> 24) & 0xFF;
-  buf[offset + 1] = (val >> 16) & 0xFF;
-  buf[offset + 2] = (val >> 8) & 0xFF;
-  buf[offset + 3] = val & 0xFF;
-}
-
-unsigned int read_u32(char *buf, int offset)
+unsigned int read_u32(const char *buf, int offset)
 {
   return ((buf[offset] & 0xFF) << 24) |
          ((buf[offset + 1] & 0xFF) << 16) |
@@ -87,11 +60,11 @@ unsigned int read_u32(char *buf, int offset)
          (buf[offset + 3] & 0xFF);
 }
 
-// ---- Parse CLUSTER_PARAMS ----
-void parse_params(char *data, int data_len)
+// ---- Parse the job parameters ----
+int parse_params(const char *data, int data_len)
 {
-  if (data_len < 28)
-    return;
+  if (data_len < PARAMS_SIZE)
+    return 0;
 
   center_re_hi = (int)read_u32(data, 0);
   center_re_lo = read_u32(data, 4);
@@ -101,59 +74,29 @@ void parse_params(char *data, int data_len)
   scale_lo     = read_u32(data, 20);
   max_iter     = (int)read_u32(data, 24);
 
-  has_params = 1;
-}
-
-// ---- Parse CLUSTER_ASSIGN ----
-void parse_assign(char *data, int data_len)
-{
-  int target_id;
-
-  if (data_len < 12)
-    return;
-
-  target_id = (int)read_u32(data, 0);
-  if (target_id != our_worker_id)
-    return;
-
-  assign_y_start = (int)read_u32(data, 4);
-  assign_y_end   = (int)read_u32(data, 8);
-
-  has_assign = 1;
-}
-
-// ---- Send one CLUSTER_RESULT chunk ----
-void send_chunk(int chunk_index, char *pixels, int pixel_count)
-{
-  int payload_len;
-  int i;
-
-  write_u32(chunk_payload, 0, (unsigned int)chunk_index);
-  i = 0;
-  while (i < pixel_count)
-  {
-    chunk_payload[CHUNK_HEADER_SIZE + i] = pixels[i];
-    i = i + 1;
-  }
-
-  payload_len = CHUNK_HEADER_SIZE + pixel_count;
-
-  fnp_send_reliable(coord_mac, FNP_TYPE_CLUSTER_RESULT,
-                    chunk_payload, payload_len, frame_buf, &tx_seq);
+  return 1;
 }
 
-// ---- Compute assigned rows and send results ----
-void compute_and_send(void)
+// ---- Work unit: compute UNIT_ROWS rows and stream each one ----
+int mbrot_work(cl_node_t *node, const char *params, int params_len,
+               int unit, void *ctx)
 {
   int step_hi_cpu;
   unsigned int step_lo_cpu;
   int start_re_hi;
   unsigned int start_re_lo;
+  int y_start;
+  int y_end;
   int y;
   int x;
-  int chunk_index;
-  int chunk_pixel_count;
-  char chunk_pixels[CHUNK_MAX_PIXELS];
+
+  if (!parse_params(params, params_len))
+    return -1;
+
+  y_start = unit * UNIT_ROWS;
+  y_end = y_start + UNIT_ROWS;
+  if (y_end > SCREEN_HEIGHT)
+    y_end = SCREEN_HEIGHT;
 
   // Compute pixel step = scale / 320
   // 1/320 in Q32.32: {0, 0x00CCCCCD}
@@ -185,7 +128,7 @@ void compute_and_send(void)
 
   // Compute start_im for our first row
   // start_im = center_im - step * (120 - y_start)
-  mbrotc_load_f6(120 - assign_y_start, 0);
+  mbrotc_load_f6(120 - y_start, 0);
   mbrotc_load_f7(step_hi_cpu, step_lo_cpu);
   mbrotc_mul_f7_f6();  // f7 = step * (120 - y_start)
   {
@@ -196,11 +139,7 @@ void compute_and_send(void)
   mbrotc_load_cim(center_im_hi, center_im_lo);  // f1 = center_im
   mbrotc_sub_f1_f6();  // f1 = center_im - offset = start_im
 
-  // Initialize chunk tracking
-  chunk_index = 0;
-  chunk_pixel_count = 0;
-
-  for (y = assign_y_start; y < assign_y_end; y++)
+  for (y = y_start; y < y_end; y++)
   {
     // Reset c_re to start_re for this row
     mbrotc_load_cre(start_re_hi, start_re_lo);
@@ -219,31 +158,16 @@ void compute_and_send(void)
       mbrotc_advance_cre();
     }
 
-    // Copy row pixels into chunk buffer
-    x = 0;
-    while (x < SCREEN_WIDTH)
-    {
-      chunk_pixels[chunk_pixel_count] = pixel_buf[x];
-      chunk_pixel_count = chunk_pixel_count + 1;
-      x = x + 1;
-
-      if (chunk_pixel_count >= CHUNK_MAX_PIXELS)
-      {
-        send_chunk(chunk_index, chunk_pixels, chunk_pixel_count);
-        chunk_index = chunk_index + 1;
-        chunk_pixel_count = 0;
-      }
-    }
+    // Stream the row; also services the network (cancel, heartbeat)
+    if (cl_emit(node, pixel_buf, SCREEN_WIDTH) != 0)
+      return -1;
 
     // Advance c_im by step
     mbrotc_load_step(step_hi_cpu, step_lo_cpu);
     mbrotc_advance_cim();
   }
 
-  if (chunk_pixel_count > 0)
-  {
-    send_chunk(chunk_index, chunk_pixels, chunk_pixel_count);
-  }
+  return 0;
 }
 
 // ---- Print decimal integer ----
@@ -291,104 +215,16 @@ void print_int(int val)
 
 int main(void)
 {
-  int our_mac[6];
-  int rxlen;
-  int src_mac[6];
-  int msg_type;
-  int rx_seq;
-  int rx_flags;
-  char *rx_data;
-  int rx_data_len;
-  int frame_count;
-
-  fnp_init();
-  fnp_get_our_mac(our_mac);
-
-  our_worker_id = (our_mac[5] & 0xFF) - 0x02;
-
-  tx_seq = 0;
-  has_params = 0;
-  has_assign = 0;
-  max_iter = DEFAULT_MAX_ITER;
-  frame_count = 0;
-
-  sys_putstr("Mandelbrot Worker ");
-  {
-    char id_char;
-    id_char = '0' + our_worker_id;
-    sys_putc(id_char);
-  }
-  sys_putstr(" ready\n");
-  sys_putstr("Waiting for assignments...\n");
+  int units;
 
-  while (1)
-  {
-    if (sys_net_packet_count() > 0)
-    {
-      rxlen = sys_net_recv(frame_buf, FNP_FRAME_BUF_SIZE);
-
-      if (rxlen >= 14)
-      {
-        int dest_ok;
-        dest_ok = 1;
-        {
-          int dm;
-          for (dm = 0; dm < 6; dm++)
-          {
-            if ((frame_buf[dm] & 0xFF) != (our_mac[dm] & 0xFF))
-            {
-              dest_ok = 0;
-              break;
-            }
-          }
-        }
-
-        if (dest_ok && fnp_parse(frame_buf, rxlen, src_mac,
-                                  &msg_type, &rx_seq, &rx_flags,
-                                  &rx_data, &rx_data_len))
-        {
-          {
-            int i;
-            i = 0;
-            while (i < 6)
-            {
-              coord_mac[i] = src_mac[i];
-              i = i + 1;
-            }
-          }
-
-          if (msg_type == FNP_TYPE_CLUSTER_PARAMS)
-          {
-            parse_params(rx_data, rx_data_len);
-          }
-          else if (msg_type == FNP_TYPE_CLUSTER_ASSIGN)
-          {
-            parse_assign(rx_data, rx_data_len);
-
-            if (has_params && has_assign)
-            {
-              frame_count = frame_count + 1;
-              sys_putstr("Frame ");
-              print_int(frame_count);
-              sys_putstr(": rows ");
-              print_int(assign_y_start);
-              sys_putstr("-");
-              print_int(assign_y_end);
-              sys_putstr("...");
-
-              compute_and_send();
-
-              sys_putstr(" done\n");
-
-              has_assign = 0;
-            }
-          }
-        }
-      }
-    }
+  sys_putstr("Mandelbrot Worker ready\n");
+  sys_putstr("Waiting for a coordinator...\n");
 
-    sys_sleep(1);
-  }
+  units = cl_worker_run(MBROT_APP_ID, mbrot_work, 0);
+
+  sys_putstr("Worker done: ");
+  print_int(units);
+  sys_putstr(" units\n");
 
   return 0;
 }
@@ -1,16 +1,18 @@
-/*
- * mbroth.c — Cluster Mandelbrot coordinator (userBDOS).
- */
-
 //
 // mbroth.c — Cluster Mandelbrot coordinator (userBDOS).
-// Controls 4 worker FPGCs (MAC :02-:05) for a Mandelbrot zoom animation.
+// Farms a Mandelbrot zoom animation out to every mbrotc worker on the
+// network through the userlib cluster runtime. Each frame is one job of
+// SCREEN_HEIGHT / UNIT_ROWS units; rows are drawn as they stream in.
+//
+// Usage: mbroth [dev...]   — optionally start mbrotc on devices
+//        02:B4:B4:00:00:<dev> first (e.g. mbroth 2 3 4 5).
 //
 
 #include <syscall.h>
 #include <stdlib.h>
 #include <plot.h>
 #include <fnp.h>
+#include <cluster.h>
 #include <fixed64.h>
 
 // ---- ANSI / VFS shims for retired syscalls ----
@@ -45,41 +47,21 @@ int *backbuf;
 #define UPSCALE_W   288
 #define UPSCALE_H   216
 
-// ---- Worker configuration ----
-#define NUM_WORKERS   4
-#define ROWS_PER_WORKER (SCREEN_HEIGHT / NUM_WORKERS)  // 60
-
-int worker_mac_data[24] = {
-  0x02, 0xB4, 0xB4, 0x00, 0x00, 0x02,
-  0x02, 0xB4, 0xB4, 0x00, 0x00, 0x03,
-  0x02, 0xB4, 0xB4, 0x00, 0x00, 0x04,
-  0x02, 0xB4, 0xB4, 0x00, 0x00, 0x05
-};
-
-int *get_worker_mac(int w)
-{
-  return &worker_mac_data[w * 6];
-}
+// ---- Cluster job (must match mbrotc.c) ----
+#define MBROT_APP_ID  0x4D42
+#define PARAMS_SIZE   28
+#define UNIT_ROWS     4
+#define NUM_UNITS     (SCREEN_HEIGHT / UNIT_ROWS)  // 60
 
-// ---- Chunk tracking ----
-#define PIXELS_PER_WORKER  (ROWS_PER_WORKER * SCREEN_WIDTH)
-#define CHUNK_MAX_PIXELS   1020
-#define CHUNKS_PER_WORKER  19
-#define TOTAL_CHUNKS       (CHUNKS_PER_WORKER * NUM_WORKERS)
-#define CHUNK_HEADER_SIZE  4
+#define DISCOVER_MS   500
 
-int chunks_received[TOTAL_CHUNKS];
-int total_chunks_done;
+cl_coord_t cluster;
+char job_params[PARAMS_SIZE];
 
-// ---- Protocol frame buffer ----
+// ---- Launch support (FNP keycodes) ----
 char frame_buf[FNP_FRAME_BUF_SIZE];
-
-// ---- Sequence counter ----
 int tx_seq;
 
-// ---- ACK buffer ----
-char ack_data[2];
-
 // ---- Palette data ----
 #define NUM_PALETTES 5
 int current_palette;
@@ -108,14 +90,6 @@ void write_u32(char *buf, int offset, unsigned int val)
   buf[offset + 3] = val & 0xFF;
 }
 
-unsigned int read_u32(char *buf, int offset)
-{
-  return ((buf[offset] & 0xFF) << 24) |
-         ((buf[offset + 1] & 0xFF) << 16) |
-         ((buf[offset + 2] & 0xFF) << 8) |
-         (buf[offset + 3] & 0xFF);
-}
-
 // ---- Palette generation ----
 
 int lerp_color(int c0, int c1, int t)
@@ -217,105 +191,60 @@ void apply_palette(void)
 
 // ---- Worker management ----
 
-void launch_workers(void)
+// Start mbrotc on the devices named on the command line.
+void launch_workers(int argc, char **argv)
 {
-  int w;
-  for (w = 0; w < NUM_WORKERS; w++)
-  {
-    fnp_send_command(get_worker_mac(w), "mbrotc", frame_buf, &tx_seq);
-  }
-  sys_sleep(1000);
-}
+  int mac[6];
+  int i;
 
-int identify_worker(int *src_mac)
-{
-  int last_byte;
-  last_byte = src_mac[5] & 0xFF;
-  if (last_byte >= 0x02 && last_byte <= 0x05)
-  {
-    if (src_mac[0] == 0x02 && src_mac[1] == 0xB4 && src_mac[2] == 0xB4 &&
-        src_mac[3] == 0x00 && src_mac[4] == 0x00)
-    {
-      return last_byte - 0x02;
-    }
-  }
-  return -1;
-}
+  if (argc < 2)
+    return;
 
-void dispatch_workers(void)
-{
-  char params[28];
-  char assign[12];
-  int w;
-  int y_start;
-  int y_end;
-
-  write_u32(params, 0, (unsigned int)center_re.hi);
-  write_u32(params, 4, center_re.lo);
-  write_u32(params, 8, (unsigned int)center_im.hi);
-  write_u32(params, 12, center_im.lo);
-  write_u32(params, 16, (unsigned int)scale.hi);
-  write_u32(params, 20, scale.lo);
-  write_u32(params, 24, (unsigned int)max_iter_val);
-
-  for (w = 0; w < NUM_WORKERS; w++)
+  mac[0] = 0x02; mac[1] = 0xB4; mac[2] = 0xB4;
+  mac[3] = 0x00; mac[4] = 0x00;
+  for (i = 1; i < argc; i++)
   {
-    fnp_send(get_worker_mac(w), FNP_TYPE_CLUSTER_PARAMS, tx_seq, 0,
-             params, 28, frame_buf);
-    tx_seq = tx_seq + 1;
-
-    y_start = w * ROWS_PER_WORKER;
-    y_end = y_start + ROWS_PER_WORKER;
-    if (y_end > SCREEN_HEIGHT)
-      y_end = SCREEN_HEIGHT;
-    write_u32(assign, 0, (unsigned int)w);
-    write_u32(assign, 4, (unsigned int)y_start);
-    write_u32(assign, 8, (unsigned int)y_end);
-
-    fnp_send(get_worker_mac(w), FNP_TYPE_CLUSTER_ASSIGN, tx_seq, 0,
-             assign, 12, frame_buf);
-    tx_seq = tx_seq + 1;
+    mac[5] = atoi(argv[i]) & 0xFF;
+    fnp_send_command(mac, "mbrotc", frame_buf, &tx_seq);
   }
+  sys_sleep(1000);
 }
 
-int process_result_chunk(int worker_id, char *data, int data_len)
+// Result fragment `frag` of `unit` is screen row unit * UNIT_ROWS + frag.
+void on_row(int unit, int frag, const char *data, int len, void *ctx)
 {
-  unsigned int chunk_index;
-  int pixel_count;
-  int global_chunk;
-  int pixel_offset;
-  int i;
-
-  if (data_len < CHUNK_HEADER_SIZE)
-    return 0;
-
-  chunk_index = read_u32(data, 0);
-  pixel_count = data_len - CHUNK_HEADER_SIZE;
+  int y;
+  int base;
+  int x;
+  int px;
 
-  global_chunk = worker_id * CHUNKS_PER_WORKER + (int)chunk_index;
-  if (global_chunk < 0 || global_chunk >= TOTAL_CHUNKS)
-    return 0;
-
-  if (chunks_received[global_chunk])
-    return 0;
-
-  pixel_offset = worker_id * PIXELS_PER_WORKER + (int)chunk_index * CHUNK_MAX_PIXELS;
+  y = unit * UNIT_ROWS + frag;
+  if (y >= SCREEN_HEIGHT || len > SCREEN_WIDTH)
+    return;
 
-  i = 0;
-  while (i < pixel_count && (pixel_offset + i) < (SCREEN_WIDTH * SCREEN_HEIGHT))
+  base = y * SCREEN_WIDTH;
+  for (x = 0; x < len; x++)
   {
-    int px;
-    px = data[CHUNK_HEADER_SIZE + i] & 0xFF;
-    backbuf[pixel_offset + i] = px;
+    px = data[x] & 0xFF;
+    backbuf[base + x] = px;
     /* VRAMPX is byte-addressable. */
-    __builtin_storeb(PIXEL_FB_ADDR + (pixel_offset + i), px);
-    i = i + 1;
+    __builtin_storeb(PIXEL_FB_ADDR + base + x, px);
   }
+}
 
-  chunks_received[global_chunk] = 1;
-  total_chunks_done = total_chunks_done + 1;
-
-  return 1;
+// Render one frame of the current view on the cluster.
+int render_frame(void)
+{
+  write_u32(job_params, 0, (unsigned int)center_re.hi);
+  write_u32(job_params, 4, center_re.lo);
+  write_u32(job_params, 8, (unsigned int)center_im.hi);
+  write_u32(job_params, 12, center_im.lo);
+  write_u32(job_params, 16, (unsigned int)scale.hi);
+  write_u32(job_params, 20, scale.lo);
+  write_u32(job_params, 24, (unsigned int)max_iter_val);
+
+  cl_coord_start(&cluster, job_params, PARAMS_SIZE, NUM_UNITS, on_row, 0);
+  return cl_coord_run(&cluster, COLLECT_TIMEOUT_MS);
 }
 
 void blit_backbuf(void)
@@ -343,82 +272,6 @@ void upscale_to_fb(void)
   }
 }
 
-void reset_collection(void)
-{
-  int i;
-  for (i = 0; i < TOTAL_CHUNKS; i++)
-    chunks_received[i] = 0;
-  total_chunks_done = 0;
-}
-
-int try_collect_packets(void)
-{
-  int rxlen;
-  int src_mac[6];
-  int msg_type;
-  int rx_seq;
-  int rx_flags;
-  char *rx_data;
-  int rx_data_len;
-  int worker_id;
-  int collected;
-  int need_ack;
-  int ack_seq;
-  int ack_mac[6];
-
-  collected = 0;
-  while (sys_net_packet_count() > 0)
-  {
-    rxlen = sys_net_recv(frame_buf, FNP_FRAME_BUF_SIZE);
-    if (rxlen > 0 && fnp_parse(frame_buf, rxlen, src_mac,
-                                &msg_type, &rx_seq, &rx_flags,
-                                &rx_data, &rx_data_len))
-    {
-      need_ack = (rx_flags & FNP_FLAG_REQUIRES_ACK);
-      ack_seq = rx_seq;
-      if (need_ack)
-      {
-        ack_mac[0] = src_mac[0]; ack_mac[1] = src_mac[1];
-        ack_mac[2] = src_mac[2]; ack_mac[3] = src_mac[3];
-        ack_mac[4] = src_mac[4]; ack_mac[5] = src_mac[5];
-      }
-
-      if (msg_type == FNP_TYPE_CLUSTER_RESULT)
-      {
-        worker_id = identify_worker(src_mac);
-        if (worker_id >= 0)
-          collected = collected + process_result_chunk(worker_id, rx_data, rx_data_len);
-      }
-
-      if (need_ack)
-      {
-        ack_data[0] = (ack_seq >> 8) & 0xFF;
-        ack_data[1] = ack_seq & 0xFF;
-        fnp_send(ack_mac, FNP_TYPE_ACK, 0, 0, ack_data, 2, frame_buf);
-      }
-    }
-  }
-  return collected;
-}
-
-int collect_all(int timeout_ms)
-{
-  int elapsed;
-
-  elapsed = 0;
-  while (total_chunks_done < TOTAL_CHUNKS && elapsed < timeout_ms)
-  {
-    if (sys_net_packet_count() > 0)
-      try_collect_packets();
-    else
-    {
-      sys_sleep(5);
-      elapsed = elapsed + 5;
-    }
-  }
-  return (total_chunks_done >= TOTAL_CHUNKS) ? 1 : 0;
-}
-
 void update_max_iter(void)
 {
   int iter;
@@ -454,13 +307,18 @@ void reset_view(void)
 
 int main(void)
 {
+  int argc;
+  char **argv;
   int key;
   int keys;
   int running;
   struct fp64 zoom_factor;
   int ci;
 
-  fnp_init();
+  argc = sys_argc();
+  argv = sys_argv();
+
+  cl_coord_init(&cluster, MBROT_APP_ID);
   tx_seq = 0;
   current_palette = 3;
 
@@ -478,7 +336,8 @@ int main(void)
     return 1;
   }
 
-  launch_workers();
+  launch_workers(argc, argv);
+  cl_coord_discover(&cluster, DISCOVER_MS);
 
   backbuf = (int *)malloc(SCREEN_WIDTH * SCREEN_HEIGHT);
 
@@ -498,9 +357,7 @@ int main(void)
   fp64_make(&zoom_factor, 0, ZOOM_FACTOR_LO);
 
   // First frame: render without zoom preview
-  dispatch_workers();
-  reset_collection();
-  collect_all(COLLECT_TIMEOUT_MS);
+  render_frame();
   blit_backbuf();
 
   // Main render loop
@@ -544,10 +401,8 @@ int main(void)
       reset_view();
     }
 
-    dispatch_workers();
-    reset_collection();
     upscale_to_fb();
-    collect_all(COLLECT_TIMEOUT_MS);
+    render_frame();
   }
 
   // Cleanup: restore default RRRGGGBB palette
@@ -571,6 +426,7 @@ int main(void)
     __builtin_storeb(PIXEL_FB_ADDR + ci, 0);
   term_clear();
 
+  cl_coord_shutdown(&cluster);
   sys_close(g_tty_fd);
   sys_close(g_pixpal_fd);
 
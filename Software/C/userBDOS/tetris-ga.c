@@ -1,14 +1,21 @@
 /*
- * tetris-ga.c — Standalone Tetris GA (userBDOS).
+ * tetris-ga.c — Cluster Tetris GA (userBDOS).
  *
  * Runs a genetic algorithm that evolves AI Tetris players.
  * Single population of 20 chromosomes, 6 genes (Q16.16).
- * Sends TETRIS_BOARD snapshots and TETRIS_GA_STATUS to the
- * fpgc-frontend via FNP for live browser visualization.
+ * Each generation is one cluster job: the population is the job
+ * parameters and one game per chromosome is a work unit, so any number
+ * of `tetris-ga -w` workers share the games. With no workers the games
+ * are played locally. Sends TETRIS_BOARD snapshots and TETRIS_GA_STATUS
+ * to the fpgc-frontend via FNP for live browser visualization.
+ *
+ * Usage: tetris-ga       coordinator
+ *        tetris-ga -w    worker
  */
 
 #include <syscall.h>
 #include <fnp.h>
+#include <cluster.h>
 
 /* ---- Board constants ---- */
 #define BOARD_ROWS    22
@@ -134,6 +141,16 @@ int tx_seq;
 /* Frontend MAC (Device 2: 02:B4:B4:00:00:02) */
 int frontend_mac[6] = { 0x02, 0xB4, 0xB4, 0x00, 0x00, 0x02 };
 
+/* ---- Cluster job ---- */
+#define TETRIS_APP_ID  0x5447
+#define JOB_SIZE       (4 + POP_SIZE * NUM_GENES * 4)  /* seed + genes */
+#define RESULT_SIZE    (12 + VISIBLE_ROWS * BOARD_COLS)
+#define DISCOVER_MS    500
+
+cl_coord_t cluster;
+char job_params[JOB_SIZE];
+int live_boards;  /* ctx for local games: stream boards while playing */
+
 /* =========================================================================
  * RNG
  * ========================================================================= */
@@ -632,6 +649,14 @@ void write_u32(char *buf, int offset, unsigned int val)
   buf[offset + 3] = val & 0xFF;
 }
 
+unsigned int read_u32(const char *buf, int offset)
+{
+  return ((buf[offset] & 0xFF) << 24) |
+         ((buf[offset + 1] & 0xFF) << 16) |
+         ((buf[offset + 2] & 0xFF) << 8) |
+         (buf[offset + 3] & 0xFF);
+}
+
 /* Send board snapshot to frontend */
 void send_board_snapshot(void)
 {
@@ -841,6 +866,109 @@ void evolve_population(void)
   }
 }
 
+/* =========================================================================
+ * Cluster: one game per work unit
+ * ========================================================================= */
+
+/* Play chromosome `unit` of the generation in `params` and emit
+ * [score (4)] [lines (4)] [pieces (4)] [final board colors (200)].
+ * Runs on workers and, without workers, on the coordinator itself, where
+ * ctx is non-zero and boards are streamed to the frontend while playing. */
+int play_unit(cl_node_t *node, const char *params, int params_len,
+              int unit, void *ctx)
+{
+  char out[RESULT_SIZE];
+  int base;
+  int i;
+
+  if (params_len < JOB_SIZE || unit >= POP_SIZE)
+    return -1;
+
+  gen_seed = read_u32(params, 0);
+  base = 4 + unit * NUM_GENES * 4;
+  w_lines        = (int)read_u32(params, base + 0);
+  w_delta_height = (int)read_u32(params, base + 4);
+  w_holes        = (int)read_u32(params, base + 8);
+  w_big_wells    = (int)read_u32(params, base + 12);
+  w_max_hole_dist= (int)read_u32(params, base + 16);
+  w_bumpiness    = (int)read_u32(params, base + 20);
+  current_chromo = unit + 1;
+
+  init_game();
+  spawn_piece();
+
+  while (!game_over)
+  {
+    hard_drop_and_land();
+
+    if (game_pieces % BOARD_SEND_INTERVAL == 0)
+    {
+      if (ctx)
+      {
+        send_board_snapshot();
+        sys_yield();
+      }
+      /* Heartbeats, and stop if the game was handed to someone else. */
+      if (cl_service(node))
+        return -1;
+    }
+
+    if (!game_over)
+    {
+      spawn_piece();
+    }
+  }
+
+  write_u32(out, 0, (unsigned int)game_score);
+  write_u32(out, 4, (unsigned int)game_lines);
+  write_u32(out, 8, (unsigned int)game_pieces);
+  for (i = 0; i < VISIBLE_ROWS * BOARD_COLS; i++)
+    out[12 + i] = board_colors[i] & 0xFF;
+
+  return cl_emit(node, out, RESULT_SIZE);
+}
+
+/* A finished game: record it and show its final board. */
+void on_game(int unit, int frag, const char *data, int len, void *ctx)
+{
+  int i;
+
+  if (unit >= POP_SIZE || len < RESULT_SIZE)
+    return;
+
+  chromo_score[unit]  = (int)read_u32(data, 0);
+  chromo_lines[unit]  = (int)read_u32(data, 4);
+  chromo_pieces[unit] = (int)read_u32(data, 8);
+
+  game_score  = chromo_score[unit];
+  game_lines  = chromo_lines[unit];
+  game_pieces = chromo_pieces[unit];
+  for (i = 0; i < VISIBLE_ROWS * BOARD_COLS; i++)
+    board_colors[i] = data[12 + i] & 0xFF;
+  current_chromo = unit + 1;
+  send_board_snapshot();
+}
+
+/* Play every chromosome of the current generation on the cluster.
+ * Returns 0 if Escape was pressed. */
+int evaluate_generation(void)
+{
+  int i;
+
+  write_u32(job_params, 0, gen_seed);
+  for (i = 0; i < POP_SIZE * NUM_GENES; i++)
+    write_u32(job_params, 4 + i * 4, (unsigned int)chromo_genes[i]);
+
+  cl_coord_start(&cluster, job_params, JOB_SIZE, POP_SIZE, on_game,
+                 &live_boards);
+  while (!cl_coord_run(&cluster, 500))
+  {
+    if (sys_get_key_state() & KEYSTATE_ESCAPE)
+      return 0;
+  }
+  return 1;
+}
+
 /* =========================================================================
  * Print helpers
  * ========================================================================= */
@@ -889,13 +1017,15 @@ void print_int(int val)
 
 int main(void)
 {
-  int our_mac[6];
+  int argc;
+  char **argv;
   int keys;
   int chromo_idx;
   int g;
   int round_top;
   int total_score;
   int avg_score;
+  int seed;
   current_chromo = 0;
 
   /* Initialize piece data pointers */
@@ -907,10 +1037,23 @@ int main(void)
   piece_data[5] = t_t;
   piece_data[6] = t_z;
 
-  /* Initialize FNP */
-  fnp_init();
-  fnp_get_our_mac(our_mac);
+  argc = sys_argc();
+  argv = sys_argv();
+  if (argc > 1 && argv[1][0] == '-' && argv[1][1] == 'w')
+  {
+    sys_putstr("Tetris GA worker ready\n");
+    g = cl_worker_run(TETRIS_APP_ID, play_unit, 0);
+    sys_putstr("Worker done: ");
+    print_int(g);
+    sys_putstr(" games\n");
+    return 0;
+  }
+
+  /* Initialize cluster (and FNP) */
+  cl_coord_init(&cluster, TETRIS_APP_ID);
+  cl_coord_set_local(&cluster, play_unit);
   tx_seq = 0;
+  live_boards = 1;
 
   /* Initialize GA */
   ga_rng_seed(12345);
@@ -923,6 +1066,8 @@ int main(void)
 
   sys_putstr("Tetris GA started (pop=");
   print_int(POP_SIZE);
+  sys_putstr(", workers=");
+  print_int(cl_coord_discover(&cluster, DISCOVER_MS));
   sys_putstr(")\n");
 
   /* ---- Main loop: run generations forever ---- */
@@ -939,57 +1084,20 @@ int main(void)
     total_score = 0;
     mutation_count = 0;
 
-    /* Evaluate all chromosomes */
+    /* Evaluate all chromosomes (play_unit leaves gen_seed alone) */
+    seed = gen_seed;
+    if (!evaluate_generation())
+      goto done;
+    gen_seed = seed;
+
     for (chromo_idx = 0; chromo_idx < POP_SIZE; chromo_idx++)
     {
-      current_chromo = chromo_idx + 1;
-
-      /* Check for escape between games */
-      keys = sys_get_key_state();
-      if (keys & KEYSTATE_ESCAPE) goto done;
-
-      /* Load weights */
-      w_lines        = chromo_genes[chromo_idx * NUM_GENES + 0];
-      w_delta_height = chromo_genes[chromo_idx * NUM_GENES + 1];
-      w_holes        = chromo_genes[chromo_idx * NUM_GENES + 2];
-      w_big_wells    = chromo_genes[chromo_idx * NUM_GENES + 3];
-      w_max_hole_dist= chromo_genes[chromo_idx * NUM_GENES + 4];
-      w_bumpiness    = chromo_genes[chromo_idx * NUM_GENES + 5];
-
-      /* Play a game */
-      init_game();
-      spawn_piece();
-
-      while (!game_over)
-      {
-        hard_drop_and_land();
-
-        /* Send board snapshot periodically */
-        if (game_pieces % BOARD_SEND_INTERVAL == 0)
-        {
-          send_board_snapshot();
-          sys_yield();
-        }
-
-        if (!game_over)
-        {
-          spawn_piece();
-        }
-      }
-
-      /* Send final board snapshot */
-      send_board_snapshot();
-
-      /* Record result */
-      chromo_score[chromo_idx] = game_score;
-      chromo_lines[chromo_idx] = game_lines;
-      chromo_pieces[chromo_idx] = game_pieces;
-
-      total_score = total_score + game_score;
-      if (game_score > round_top) round_top = game_score;
-      if (game_score > best_ever_score)
+      total_score = total_score + chromo_score[chromo_idx];
+      if (chromo_score[chromo_idx] > round_top)
+        round_top = chromo_score[chromo_idx];
+      if (chromo_score[chromo_idx] > best_ever_score)
       {
-        best_ever_score = game_score;
+        best_ever_score = chromo_score[chromo_idx];
         for (g = 0; g < NUM_GENES; g++)
         {
           best_ever_genes[g] = chromo_genes[chromo_idx * NUM_GENES + g];
@@ -1023,6 +1131,7 @@ int main(void)
   }
 
 done:
+  cl_coord_shutdown(&cluster);
   sys_write(1, "\x1b[2J\x1b[H", 7);
   return 0;
 }
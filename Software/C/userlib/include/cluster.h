@@ -0,0 +1,202 @@
+#ifndef USERLIB_CLUSTER_H
+#define USERLIB_CLUSTER_H
+
+/*
+ * cluster.h — Cluster job runtime over FNP MESSAGE frames.
+ *
+ * One coordinator farms a job out to any number of worker FPGCs. A job
+ * is a parameter blob (sent once per worker) plus num_units small work
+ * units identified by their index. Workers compute a unit and stream
+ * its result back as one or more fragments.
+ *
+ * Coordinator features:
+ *   - discovery: HELLO broadcasts, workers answer with JOIN; workers
+ *     started later announce themselves and join a running job;
+ *   - liveness: workers send HEARTBEATs, silent workers are dropped and
+ *     their units requeued;
+ *   - parameter fan-out: JOB is broadcast once per job; a worker that
+ *     missed it answers its first WORK with NEED_JOB and gets a unicast
+ *     copy (NACK-based repair);
+ *   - dynamic queue: workers hold at most CL_WORKER_QUEUE units, so fast
+ *     workers pull more units than slow ones;
+ *   - work stealing: an idle worker takes a not-yet-started unit from the
+ *     back of the busiest worker's queue (the victim gets a CANCEL);
+ *   - straggler re-dispatch: once the queue is empty, idle workers get a
+ *     backup copy of the oldest unit past its deadline. Lost WORK or
+ *     RESULT frames are recovered the same way, so no frame needs an ACK;
+ *   - result streaming: on_result runs for every new fragment as it
+ *     arrives, duplicates from backup copies are filtered out;
+ *   - local fallback: with no live workers the coordinator runs units
+ *     itself through the same work function.
+ *
+ * The coordinator is frame-driven (cl_coord_handle_frame + cl_coord_poll)
+ * so programs with their own receive loop can embed it; cl_coord_run()
+ * is the blocking loop for everyone else.
+ *
+ * Wire format (FNP_TYPE_MESSAGE data):
+ *   [0xC1] [Op (1)] [Job (2)] [Unit (2)] [Op data]
+ * Job carries the app id for HELLO/JOIN/BYE.
+ */
+
+#include <fnp.h>
+
+/* ---- Protocol ---- */
+#define CL_MAGIC        0xC1
+#define CL_HEADER_SIZE  6
+#define CL_MAX_PARAMS   (FNP_MAX_DATA - CL_HEADER_SIZE)
+#define CL_MAX_RESULT   (FNP_MAX_DATA - CL_HEADER_SIZE - 1)
+
+#define CL_OP_HELLO     0x01    /* coord -> bcast: app id */
+#define CL_OP_JOIN      0x02    /* worker -> coord: app id */
+#define CL_OP_HEARTBEAT 0x03    /* worker -> coord: [free slots (1)] */
+#define CL_OP_JOB       0x04    /* coord -> bcast/worker: [params] */
+#define CL_OP_NEED_JOB  0x05    /* worker -> coord: params missing */
+#define CL_OP_WORK      0x06    /* coord -> worker: run unit */
+#define CL_OP_CANCEL    0x07    /* coord -> worker: drop queued unit */
+#define CL_OP_RESULT    0x08    /* worker -> coord: [frag (1)] [data] */
+#define CL_OP_UNIT_END  0x09    /* worker -> coord: [frag count (1)] */
+#define CL_OP_DONE      0x0A    /* coord -> bcast: job finished */
+#define CL_OP_BYE       0x0B    /* coord -> bcast: app id, workers exit */
+
+/* ---- Limits and timing ---- */
+#define CL_MAX_WORKERS      16
+#define CL_MAX_UNITS        256
+#define CL_MAX_FRAGS        32      /* fragments per unit (bitmask) */
+#define CL_WORKER_QUEUE     2       /* units in flight per worker */
+#define CL_HELLO_MS         1000
+#define CL_HEARTBEAT_MS     250
+#define CL_WORKER_TIMEOUT_MS 1500
+#define CL_MIN_DEADLINE_MS  300     /* floor for straggler deadline */
+#define CL_MAX_DISPATCH     4       /* copies of one unit, incl. first */
+
+/* Unit states */
+#define CL_UNIT_PENDING  0
+#define CL_UNIT_ASSIGNED 1
+#define CL_UNIT_DONE     2
+
+typedef struct cl_node cl_node_t;
+
+/* Work function: compute `unit` of a job and emit its result with
+ * cl_emit(). Runs on workers and, as local fallback, on the coordinator.
+ * Returning non-zero abandons the unit (nothing more is reported). */
+typedef int (*cl_work_fn)(cl_node_t *node, const char *params,
+                          int params_len, int unit, void *ctx);
+
+/* Result callback: fragment `frag` of `unit`, called once per fragment. */
+typedef void (*cl_result_fn)(int unit, int frag, const char *data, int len,
+                             void *ctx);
+
+typedef struct
+{
+    int mac[6];
+    int alive;
+    unsigned int last_seen;     /* us */
+    int job_sent;               /* job id whose params it has, -1 none */
+    int held[CL_WORKER_QUEUE];  /* units sent to it, -1 = free slot */
+    unsigned int held_at[CL_WORKER_QUEUE];
+    int units_done;
+    int stolen;                 /* units taken from its queue */
+} cl_worker_t;
+
+typedef struct
+{
+    int state;
+    int holders;                /* workers currently holding the unit */
+    int dispatches;
+    int frag_total;             /* -1 until UNIT_END arrives */
+    unsigned int frag_mask;
+    unsigned int sent_at;       /* us, latest dispatch */
+    unsigned int order;         /* dispatch stamp, orders worker queues */
+} cl_unit_t;
+
+typedef struct
+{
+    int jobs;
+    int units;
+    int redispatched;           /* backup copies (stragglers/lost) */
+    int stolen;
+    int requeued;               /* units of dead workers */
+    int duplicates;             /* fragments already seen */
+    int local_units;
+    int job_frames;             /* JOB frames sent (a broadcast counts 1) */
+    int job_repairs;            /* JOBs resent after NEED_JOB */
+} cl_stats_t;
+
+typedef struct
+{
+    int app_id;
+    int job_id;
+    int active;
+
+    cl_worker_t workers[CL_MAX_WORKERS];
+    int num_workers;
+
+    cl_unit_t units[CL_MAX_UNITS];
+    int num_units;
+    int units_done;
+    unsigned int order;
+    unsigned int avg_unit_us;   /* running average of unit latency */
+
+    const char *params;
+    int params_len;
+    cl_result_fn on_result;
+    cl_work_fn local_work;
+    void *ctx;
+
+    unsigned int last_hello;
+    cl_stats_t stats;
+
+    char frame_buf[FNP_FRAME_BUF_SIZE];
+    char tx_buf[FNP_MAX_DATA];
+} cl_coord_t;
+
+/* ---- Coordinator ---- */
+
+/* Initialise a coordinator for app_id. Calls fnp_init(). */
+void cl_coord_init(cl_coord_t *c, int app_id);
+
+/* Broadcast HELLO and collect JOINs for wait_ms. Returns live workers. */
+int cl_coord_discover(cl_coord_t *c, int wait_ms);
+
+/* Work function for the no-workers fallback (0 disables it). */
+void cl_coord_set_local(cl_coord_t *c, cl_work_fn fn);
+
+/* Start a job. params must stay valid until the job completes.
+ * Returns 0, or -1 if num_units/params_len are out of range. */
+int cl_coord_start(cl_coord_t *c, const char *params, int params_len,
+                   int num_units, cl_result_fn on_result, void *ctx);
+
+/* Feed one received frame. Returns 1 if it was a cluster frame. */
+int cl_coord_handle_frame(cl_coord_t *c, char *frame, int len);
+
+/* Timers and dispatch; never blocks (except a local-fallback unit).
+ * Returns 1 once every unit of the current job is done. */
+int cl_coord_poll(cl_coord_t *c);
+
+/* Receive, handle and poll until the job is done or timeout_ms passes
+ * (0 = no timeout). Returns 1 if the job completed. */
+int cl_coord_run(cl_coord_t *c, int timeout_ms);
+
+/* Tell workers to exit their cl_worker_run() loop. */
+void cl_coord_shutdown(cl_coord_t *c);
+
+/* Number of workers currently considered alive. */
+int cl_coord_live_workers(cl_coord_t *c);
+
+/* ---- Worker ---- */
+
+/* Run the worker loop for app_id until the coordinator sends BYE or the
+ * key state shows Escape. Returns the number of units completed. */
+int cl_worker_run(int app_id, cl_work_fn fn, void *ctx);
+
+/* ---- Both (inside a work function) ---- */
+
+/* Stream one result fragment of the running unit (len <= CL_MAX_RESULT).
+ * Returns 0, or -1 if the fragment limit is reached. */
+int cl_emit(cl_node_t *node, const char *data, int len);
+
+/* Service the network from a long work function: answers frames and
+ * sends heartbeats. Returns 1 if the running unit was cancelled. */
+int cl_service(cl_node_t *node);
+
+#endif /* USERLIB_CLUSTER_H */
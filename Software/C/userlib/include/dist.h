@@ -0,0 +1,193 @@
+#ifndef USERLIB_DIST_H
+#define USERLIB_DIST_H
+
+/*
+ * dist.h — Remote tasks over FNP MESSAGE frames.
+ *
+ * A coordinator hands tasks to worker FPGCs. A task is an input blob of any
+ * size; the worker runs a task function on it and sends back an output
+ * blob and a status. `cc -dist` uses it to send preprocessed sources to
+ * `cc -serve` workers, which return the assembly (see cc.c).
+ *
+ * Unlike the cluster runtime (cluster.h), blobs do not fit in one frame,
+ * so both directions are chunk streams with a sliding window: the sender
+ * keeps up to DIST_WINDOW chunks in flight, the receiver takes chunks in
+ * order and acknowledges the next one it wants, and the sender goes back
+ * to the first unacknowledged chunk after DIST_RETRY_MS of silence.
+ *
+ * A worker runs one task at a time and cannot answer frames while its
+ * task function runs, so the coordinator does not time out running
+ * workers until DIST_RUN_TIMEOUT_MS. Lost workers are covered instead by:
+ *   - transfer timeouts: a worker silent for DIST_XFER_TIMEOUT_MS during a
+ *     transfer is dropped and its task handed out again, and a worker that
+ *     reports idle while it should hold a task loses it the same way;
+ *   - backup copies: once no fresh tasks are left, idle workers get a copy
+ *     of the oldest task past its deadline; the first result wins and the
+ *     other holders get a CANCEL;
+ *   - local fallback: with no live workers, the coordinator runs tasks
+ *     itself through the same task function.
+ * Fresh tasks go out largest input first, so one long task does not end
+ * up last on an otherwise idle cluster.
+ *
+ * Wire format (FNP_TYPE_MESSAGE data):
+ *   [0xD1] [Op (1)] [Id (2)] [Seq (2)] [Op data]
+ * Id is the app id for HELLO/JOIN/IDLE/BYE and the dispatch id otherwise;
+ * Seq is the chunk index for INPUT/OUTPUT and the next wanted chunk for
+ * the ACKs.
+ */
+
+#include <fnp.h>
+
+/* ---- Protocol ---- */
+#define DIST_MAGIC        0xD1
+#define DIST_HEADER_SIZE  6
+#define DIST_CHUNK        (FNP_MAX_DATA - DIST_HEADER_SIZE - 5)
+
+#define DIST_OP_HELLO      0x01 /* coord -> bcast: app id */
+#define DIST_OP_JOIN       0x02 /* worker -> coord: app id */
+#define DIST_OP_IDLE       0x03 /* worker -> coord: app id, no task */
+#define DIST_OP_INPUT      0x04 /* coord -> worker: [total (4)] [chunk] */
+#define DIST_OP_INPUT_ACK  0x05 /* worker -> coord: Seq = next chunk */
+#define DIST_OP_OUTPUT     0x06 /* worker -> coord: [status (1)] [total (4)]
+                                   [chunk] */
+#define DIST_OP_OUTPUT_ACK 0x07 /* coord -> worker: Seq = next chunk */
+#define DIST_OP_CANCEL     0x08 /* coord -> worker: drop the task */
+#define DIST_OP_BYE        0x09 /* coord -> bcast: app id, workers exit */
+
+/* ---- Limits and timing ---- */
+#define DIST_MAX_WORKERS     16
+#define DIST_MAX_TASKS       256
+#define DIST_WINDOW          4      /* chunks in flight per transfer */
+#define DIST_HELLO_MS        1000
+#define DIST_IDLE_MS         250    /* idle heartbeat */
+#define DIST_RETRY_MS        100    /* resend unacknowledged chunks */
+#define DIST_XFER_TIMEOUT_MS 2000   /* silence during a transfer */
+#define DIST_RUN_TIMEOUT_MS  600000 /* silence while a task runs */
+#define DIST_MIN_DEADLINE_MS 2000   /* floor for backup copies */
+#define DIST_MAX_DISPATCH    3      /* copies of one task, incl. first */
+
+/* Task states */
+#define DIST_TASK_PENDING  0
+#define DIST_TASK_ASSIGNED 1
+#define DIST_TASK_DONE     2
+
+/* Worker states, as the coordinator sees them */
+#define DIST_W_IDLE    0
+#define DIST_W_SEND    1    /* input going out */
+#define DIST_W_RUN     2    /* task function running */
+#define DIST_W_RECV    3    /* output coming back */
+
+/* Task function: compute the output of in[0..in_len). Sets *out to a
+ * malloc'd buffer of *out_len bytes (or 0), which the runtime frees.
+ * Runs on workers and, as local fallback, on the coordinator. The return
+ * value is passed back as the status of the task (0 = success). */
+typedef int (*dist_task_fn)(const char *in, int in_len, char **out,
+                            int *out_len, void *ctx);
+
+typedef struct
+{
+    int mac[6];
+    int alive;
+    int state;
+    unsigned int last_seen;     /* us */
+    int task;                   /* task it works on, -1 none */
+    int id;                     /* dispatch id of that task */
+    int next;                   /* SEND: first unacked, RECV: wanted chunk */
+    int sent;                   /* SEND: chunks sent */
+    int top;                    /* SEND: chunks sent at least once */
+    unsigned int sent_at;       /* us, latest chunk or ACK sent */
+    char *buf;                  /* RECV: output so far */
+    int total;                  /* RECV: output size */
+    int tasks_done;
+} dist_worker_t;
+
+typedef struct
+{
+    const char *in;
+    int in_len;
+    char *out;                  /* malloc'd, owned by the caller once done */
+    int out_len;
+    int status;
+    int state;
+    int holders;
+    int dispatches;
+    unsigned int sent_at;       /* us, latest dispatch */
+    int worker;                 /* worker that finished it, -1 local */
+} dist_task_t;
+
+typedef struct
+{
+    int tasks;
+    int dispatched;
+    int backups;                /* backup copies of slow tasks */
+    int requeued;               /* tasks of dropped workers */
+    int cancelled;
+    int local_tasks;
+    int resent;                 /* chunks sent again */
+    int bytes_in;
+    int bytes_out;
+} dist_stats_t;
+
+typedef struct
+{
+    int app_id;
+    int next_id;
+
+    dist_worker_t workers[DIST_MAX_WORKERS];
+    int num_workers;
+
+    dist_task_t tasks[DIST_MAX_TASKS];
+    int num_tasks;
+    int tasks_done;
+    unsigned int avg_task_us;   /* running average of task latency */
+    unsigned int run_timeout_ms;
+
+    dist_task_fn local_task;
+    void *ctx;
+
+    unsigned int last_hello;
+    dist_stats_t stats;
+
+    char frame_buf[FNP_FRAME_BUF_SIZE];
+    char tx_buf[FNP_MAX_DATA];
+} dist_coord_t;
+
+/* ---- Coordinator ---- */
+
+/* Initialise a coordinator for app_id. Calls fnp_init(). */
+void dist_coord_init(dist_coord_t *c, int app_id);
+
+/* Broadcast HELLO and collect JOINs for wait_ms. Returns live workers. */
+int dist_coord_discover(dist_coord_t *c, int wait_ms);
+
+/* Task function for the no-workers fallback (0 disables it). */
+void dist_coord_set_local(dist_coord_t *c, dist_task_fn fn, void *ctx);
+
+/* Queue a task. in must stay valid until the task is done.
+ * Returns the task index, or -1 if the table is full. */
+int dist_coord_add(dist_coord_t *c, const char *in, int in_len);
+
+/* Feed one received frame. Returns 1 if it was a dist frame. */
+int dist_coord_handle_frame(dist_coord_t *c, char *frame, int len);
+
+/* Timers, retransmits and dispatch; never blocks (except a local-fallback
+ * task). Returns 1 once every queued task is done. */
+int dist_coord_poll(dist_coord_t *c);
+
+/* Receive, handle and poll until every task is done or timeout_ms passes
+ * (0 = no timeout). Returns 1 if all tasks completed. */
+int dist_coord_run(dist_coord_t *c, int timeout_ms);
+
+/* Tell workers to exit their dist_worker_run() loop. */
+void dist_coord_shutdown(dist_coord_t *c);
+
+/* Number of workers currently considered alive. */
+int dist_coord_live_workers(dist_coord_t *c);
+
+/* ---- Worker ---- */
+
+/* Run the worker loop for app_id until the coordinator sends BYE or the
+ * key state shows Escape. Returns the number of tasks completed. */
+int dist_worker_run(int app_id, dist_task_fn fn, void *ctx);
+
+#endif /* USERLIB_DIST_H */
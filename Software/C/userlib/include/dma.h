@@ -9,8 +9,10 @@
  * but lives in userlib so userBDOS programs link without pulling in
  * libfpgc.
  *
- * All transfers must be 32-byte (cache-line) aligned in both endpoints
- * and in the byte count.
+ * Addresses and byte counts are byte-granular (count must be > 0);
+ * line-aligned MEM2MEM copies are the fastest. Do not store to the
+ * first or last cache line of a destination while a transfer runs: the
+ * engine read-modify-writes partial lines.
  */
 
 /* DMA register block (MMIO). Mirrors libfpgc/include/fpgc.h. */
@@ -19,6 +21,7 @@
 #define FPGC_DMA_COUNT          0x1C000078
 #define FPGC_DMA_CTRL           0x1C00007C
 #define FPGC_DMA_STATUS         0x1C000080
+#define FPGC_DMA_DESC           0x1C000088
 
 /* DMA modes (low 4 bits of CTRL). */
 #define FPGC_DMA_MODE_MEM2MEM   0
@@ -29,8 +32,12 @@
 /* CTRL bit fields. */
 #define FPGC_DMA_CTRL_IRQ_EN    (1u << 4)
 #define FPGC_DMA_CTRL_SPI_SHIFT 5
+#define FPGC_DMA_CTRL_CHAIN     (1u << 8)
 #define FPGC_DMA_CTRL_START     (1u << 31)
 
+/* Descriptor ctrl word bit fields. */
+#define FPGC_DMA_DESC_2D        (1u << 8)
+
 /* STATUS bit fields. */
 #define FPGC_DMA_STATUS_BUSY    (1u << 0)
 #define FPGC_DMA_STATUS_DONE    (1u << 1)
@@ -45,7 +52,7 @@ typedef enum {
 
 /*
  * Synchronous SDRAM-to-SDRAM copy. Returns 0 on success, -1 on engine error
- * (alignment violation, count==0, etc.). Wraps the transfer with a
+ * (count==0, etc.). Wraps the transfer with a
  * cache_flush_data() before and after.
  */
 int dma_copy(unsigned int dst, unsigned int src, unsigned int count);
@@ -53,15 +60,25 @@ int dma_copy(unsigned int dst, unsigned int src, unsigned int count);
 /*
  * Synchronous SDRAM-to-VRAMPX blit.
  *
- *   src must be 32-byte aligned in SDRAM, dst must be 32-byte aligned and
- *   lie in the VRAMPX byte range (0x1EC00000..0x1EC20000), count must be
- *   a multiple of 32. Returns 0 on success and -1 on engine error.
+ *   src is any SDRAM byte address and [dst, dst + count) must lie in the
+ *   VRAMPX byte range (0x1EC00000..0x1EC20000). Returns 0 on success and
+ *   -1 on engine error.
  *
  * Flushes the L1d cache before the transfer; no post-invalidate (VRAMPX
  * is write-only from the CPU side).
  */
 int dma_blit_to_vram(unsigned int dst, unsigned int src, unsigned int count);
 
+/*
+ * Synchronous 2D SDRAM-to-VRAMPX blit: `rows` rows of `width` bytes,
+ * advancing the source by src_stride and the destination by dst_stride
+ * (both < 65536) per row, as a single hardware descriptor. Every row
+ * must satisfy the dma_blit_to_vram() range rule. Returns 0 or -1.
+ */
+int dma_blit_rect(unsigned int dst, unsigned int src, unsigned int width,
+                  unsigned int rows, unsigned int src_stride,
+                  unsigned int dst_stride);
+
 /*
  * Asynchronous start helpers; caller must poll dma_busy() / dma_status()
  * and is responsible for cache coherency.
@@ -75,6 +92,23 @@ int dma_busy(void);
 /* Reads STATUS once (also clears the sticky done/error bits). */
 unsigned int dma_status(void);
 
+/*
+ * Kernel-queued transfers (SYS_DMA_SUBMIT / SYS_DMA_WAIT).
+ *
+ * Unlike the helpers above, these go through the BDOS DMA request
+ * queue, so they never collide with kernel SD/flash/Ethernet DMA and
+ * the kernel handles cache maintenance. dma_submit_async() returns a
+ * handle (or -1); dma_wait_async() blocks the process (it is parked by
+ * the scheduler, not spinning) and returns 0 or -1; dma_poll_async()
+ * returns 1 while pending, then 0/-1 once and releases the handle.
+ * Only DMA_MEM2MEM and DMA_MEM2VRAM are accepted. Do not mix in-flight
+ * handles with the direct-MMIO helpers above.
+ */
+int dma_submit_async(unsigned int dst, unsigned int src, unsigned int count,
+                     dma_mode_t mode);
+int dma_wait_async(int handle);
+int dma_poll_async(int handle);
+
 /*
  * Issue a `ccached` instruction (data-cache flush + invalidate).
  * Implemented in dma_asm.asm because cproc has no inline-asm support.
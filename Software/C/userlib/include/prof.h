@@ -0,0 +1,28 @@
+#ifndef PROF_H
+#define PROF_H
+
+/*
+ * prof.h — Block counting runtime for profile-guided builds.
+ *
+ * Code compiled by QBE with -P counts the runs of every basic block in
+ * a record per function and calls __profenter() on each function entry.
+ * When main returns, __profexit() writes the counts of all functions that
+ * ran to PROF_FILE as "function block count" lines, the format QBE -p
+ * reads back. Programs that leave through sys_exit() write no profile.
+ */
+
+#define PROF_FILE "prof.txt"
+
+/* Record emitted by QBE after each function (__prof_<fn>) */
+struct prof_rec
+{
+    struct prof_rec *next;  /* 0 until the function first runs */
+    const char *names;      /* "fn\0block\0block\0..." */
+    int nblk;
+    unsigned int cnt[];
+};
+
+void __profenter(struct prof_rec *rec);
+void __profexit(void);
+
+#endif /* PROF_H */
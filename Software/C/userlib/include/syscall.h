@@ -59,6 +59,10 @@
 #define SYS_PIPE            60
 #define SYS_IOCTL           61
 
+/* DMA (70-71) */
+#define SYS_DMA_SUBMIT      70
+#define SYS_DMA_WAIT        71
+
 /* ---- Flags for sys_open() (must match kernel vfs.h) ---- */
 #define O_RDONLY    0x01
 #define O_WRONLY    0x02
@@ -176,6 +180,10 @@ int  sys_net_recv        (char *buf, int max_len);
 int  sys_net_packet_count(void);
 void sys_net_get_mac     (int *mac_buf);
 
+/* ---- DMA (kernel request queue) ---- */
+int  sys_dma_submit(const unsigned int *desc);
+int  sys_dma_wait  (int handle, int flags);
+
 /* ---- TTY event helpers ---- */
 int sys_tty_open_raw(int nonblocking);
 int sys_tty_event_read(int fd, int blocking);
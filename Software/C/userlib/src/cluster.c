@@ -0,0 +1,1027 @@
+/*
+ * cluster.c — Cluster job runtime over FNP MESSAGE frames.
+ *
+ * See cluster.h for the protocol. No frame is acknowledged: every loss
+ * shows up as a unit that does not complete, and the coordinator fixes
+ * that by handing the unit out again. Units are therefore idempotent and
+ * results are deduplicated per fragment.
+ */
+
+#include <syscall.h>
+#include <fnp.h>
+#include <cluster.h>
+
+#define CL_WQ_SIZE (CL_WORKER_QUEUE * 2)
+
+/* Worker (or local fallback) execution context */
+struct cl_node
+{
+    cl_coord_t *coord;          /* set for local fallback units */
+    int app_id;
+    int coord_mac[6];
+    int have_coord;
+
+    int job_id;                 /* job of params[], -1 none */
+    char params[CL_MAX_PARAMS];
+    int params_len;
+
+    int q_job[CL_WQ_SIZE];      /* queued units, FIFO */
+    int q_unit[CL_WQ_SIZE];
+    int q_len;
+
+    int run_job;                /* unit being computed, -1 none */
+    int run_unit;
+    int frags;
+    int cancelled;
+
+    int bye;
+    unsigned int last_beat;
+    unsigned int last_join;
+    unsigned int last_need;
+
+    char frame_buf[FNP_FRAME_BUF_SIZE];
+    char tx_buf[FNP_MAX_DATA];
+};
+
+static cl_node_t cl_self;
+
+static int cl_bcast_mac[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+/* ---- Helpers ---- */
+
+static unsigned int cl_now(void)
+{
+    return (unsigned int)sys_get_time_us();
+}
+
+static void cl_put_u16(char *buf, int offset, int val)
+{
+    buf[offset] = (val >> 8) & 0xFF;
+    buf[offset + 1] = val & 0xFF;
+}
+
+static int cl_get_u16(const char *buf, int offset)
+{
+    return ((buf[offset] & 0xFF) << 8) | (buf[offset + 1] & 0xFF);
+}
+
+static int cl_mac_eq(const int *a, const int *b)
+{
+    int i;
+    for (i = 0; i < 6; i++)
+    {
+        if ((a[i] & 0xFF) != (b[i] & 0xFF))
+            return 0;
+    }
+    return 1;
+}
+
+/* Send [magic][op][job][unit] + extra bytes already at tx_buf + 6. */
+static void cl_send(int *mac, int op, int job, int unit,
+                    char *tx_buf, int extra_len, char *frame_buf)
+{
+    tx_buf[0] = CL_MAGIC;
+    tx_buf[1] = op;
+    cl_put_u16(tx_buf, 2, job);
+    cl_put_u16(tx_buf, 4, unit);
+    fnp_send(mac, FNP_TYPE_MESSAGE, 0, 0, tx_buf,
+             CL_HEADER_SIZE + extra_len, frame_buf);
+}
+
+/* Parse a frame into op/job/unit/data. Returns 1 if it is a cluster frame. */
+static int cl_parse(char *frame, int len, int *src_mac, int *op, int *job,
+                    int *unit, char **data, int *data_len)
+{
+    int msg_type;
+    int seq;
+    int flags;
+    char *payload;
+    int payload_len;
+
+    if (!fnp_parse(frame, len, src_mac, &msg_type, &seq, &flags,
+                   &payload, &payload_len))
+        return 0;
+    if (msg_type != FNP_TYPE_MESSAGE || payload_len < CL_HEADER_SIZE)
+        return 0;
+    if ((payload[0] & 0xFF) != CL_MAGIC)
+        return 0;
+
+    *op = payload[1] & 0xFF;
+    *job = cl_get_u16(payload, 2);
+    *unit = cl_get_u16(payload, 4);
+    *data = payload + CL_HEADER_SIZE;
+    *data_len = payload_len - CL_HEADER_SIZE;
+    return 1;
+}
+
+/* =========================================================================
+ * Coordinator
+ * ========================================================================= */
+
+static int cl_held_count(cl_worker_t *w)
+{
+    int i;
+    int n;
+    n = 0;
+    for (i = 0; i < CL_WORKER_QUEUE; i++)
+    {
+        if (w->held[i] >= 0)
+            n++;
+    }
+    return n;
+}
+
+/* Remove `unit` from w's slots. Returns 1 if it was held. */
+static int cl_release(cl_coord_t *c, cl_worker_t *w, int unit)
+{
+    int i;
+    for (i = 0; i < CL_WORKER_QUEUE; i++)
+    {
+        if (w->held[i] == unit)
+        {
+            w->held[i] = -1;
+            c->units[unit].holders--;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int cl_find_worker(cl_coord_t *c, int *mac)
+{
+    int i;
+    for (i = 0; i < c->num_workers; i++)
+    {
+        if (cl_mac_eq(c->workers[i].mac, mac))
+            return i;
+    }
+    return -1;
+}
+
+static int cl_add_worker(cl_coord_t *c, int *mac)
+{
+    cl_worker_t *w;
+    int wi;
+    int i;
+
+    wi = cl_find_worker(c, mac);
+    if (wi < 0)
+    {
+        if (c->num_workers >= CL_MAX_WORKERS)
+            return -1;
+        wi = c->num_workers;
+        c->num_workers++;
+        w = &c->workers[wi];
+        for (i = 0; i < 6; i++)
+            w->mac[i] = mac[i] & 0xFF;
+        w->units_done = 0;
+        w->stolen = 0;
+        w->alive = 0;
+    }
+
+    w = &c->workers[wi];
+    if (!w->alive)
+    {
+        int s;
+        w->alive = 1;
+        w->job_sent = -1;
+        for (s = 0; s < CL_WORKER_QUEUE; s++)
+            w->held[s] = -1;
+    }
+    w->last_seen = cl_now();
+    return wi;
+}
+
+static void cl_worker_dead(cl_coord_t *c, cl_worker_t *w)
+{
+    int s;
+    w->alive = 0;
+    for (s = 0; s < CL_WORKER_QUEUE; s++)
+    {
+        if (w->held[s] >= 0)
+        {
+            c->units[w->held[s]].holders--;
+            w->held[s] = -1;
+            c->stats.requeued++;
+        }
+    }
+}
+
+static void cl_unit_complete(cl_coord_t *c, int unit)
+{
+    cl_unit_t *u;
+    unsigned int lat;
+    int i;
+
+    u = &c->units[unit];
+    u->state = CL_UNIT_DONE;
+    c->units_done++;
+    c->stats.units++;
+
+    lat = cl_now() - u->sent_at;
+    if (c->avg_unit_us == 0)
+        c->avg_unit_us = lat;
+    else
+        c->avg_unit_us = c->avg_unit_us - (c->avg_unit_us >> 2) + (lat >> 2);
+
+    /* Backup copies still running elsewhere are no longer needed. */
+    for (i = 0; i < c->num_workers; i++)
+    {
+        if (c->workers[i].alive && cl_release(c, &c->workers[i], unit))
+            cl_send(c->workers[i].mac, CL_OP_CANCEL, c->job_id, unit,
+                    c->tx_buf, 0, c->frame_buf);
+    }
+}
+
+static int cl_frags_full(cl_unit_t *u)
+{
+    unsigned int full;
+    if (u->frag_total < 0)
+        return 0;
+    if (u->frag_total >= CL_MAX_FRAGS)
+        full = 0xFFFFFFFF;
+    else
+        full = (1u << u->frag_total) - 1u;
+    return (u->frag_mask & full) == full;
+}
+
+static void cl_on_result(cl_coord_t *c, int unit, int frag,
+                         const char *data, int len)
+{
+    cl_unit_t *u;
+
+    if (unit >= c->num_units || frag >= CL_MAX_FRAGS)
+        return;
+    u = &c->units[unit];
+    if (u->state == CL_UNIT_DONE || (u->frag_mask & (1u << frag)))
+    {
+        c->stats.duplicates++;
+        return;
+    }
+    u->frag_mask |= 1u << frag;
+    if (c->on_result)
+        c->on_result(unit, frag, data, len, c->ctx);
+    if (cl_frags_full(u))
+        cl_unit_complete(c, unit);
+}
+
+static void cl_on_unit_end(cl_coord_t *c, int unit, int frags)
+{
+    cl_unit_t *u;
+
+    if (unit >= c->num_units)
+        return;
+    u = &c->units[unit];
+    if (u->state == CL_UNIT_DONE)
+        return;
+    u->frag_total = frags;
+    if (cl_frags_full(u))
+        cl_unit_complete(c, unit);
+}
+
+void cl_coord_init(cl_coord_t *c, int app_id)
+{
+    fnp_init();
+    c->app_id = app_id & 0xFFFF;
+    c->job_id = 0;
+    c->active = 0;
+    c->num_workers = 0;
+    c->num_units = 0;
+    c->units_done = 0;
+    c->order = 0;
+    c->avg_unit_us = 0;
+    c->params = 0;
+    c->params_len = 0;
+    c->on_result = 0;
+    c->local_work = 0;
+    c->ctx = 0;
+    c->last_hello = cl_now();
+    c->stats.jobs = 0;
+    c->stats.units = 0;
+    c->stats.redispatched = 0;
+    c->stats.stolen = 0;
+    c->stats.requeued = 0;
+    c->stats.duplicates = 0;
+    c->stats.local_units = 0;
+    c->stats.job_frames = 0;
+    c->stats.job_repairs = 0;
+}
+
+void cl_coord_set_local(cl_coord_t *c, cl_work_fn fn)
+{
+    c->local_work = fn;
+}
+
+/* Send the current job's parameters to one worker or to cl_bcast_mac. */
+static void cl_send_job(cl_coord_t *c, int *mac)
+{
+    int i;
+
+    for (i = 0; i < c->params_len; i++)
+        c->tx_buf[CL_HEADER_SIZE + i] = c->params[i];
+    cl_send(mac, CL_OP_JOB, c->job_id, 0, c->tx_buf, c->params_len,
+            c->frame_buf);
+    c->stats.job_frames++;
+}
+
+int cl_coord_live_workers(cl_coord_t *c)
+{
+    int i;
+    int n;
+    n = 0;
+    for (i = 0; i < c->num_workers; i++)
+    {
+        if (c->workers[i].alive)
+            n++;
+    }
+    return n;
+}
+
+int cl_coord_handle_frame(cl_coord_t *c, char *frame, int len)
+{
+    int src_mac[6];
+    int op;
+    int job;
+    int unit;
+    char *data;
+    int data_len;
+    int wi;
+    cl_worker_t *w;
+
+    if (!cl_parse(frame, len, src_mac, &op, &job, &unit, &data, &data_len))
+        return 0;
+
+    if (op == CL_OP_JOIN || op == CL_OP_HEARTBEAT)
+    {
+        if (job != c->app_id)
+            return 1;
+        wi = cl_add_worker(c, src_mac);
+        if (wi < 0)
+            return 1;
+        w = &c->workers[wi];
+
+        /* A broadcast JOIN comes from a worker that has not heard our
+         * HELLO yet; introduce ourselves so it accepts JOB broadcasts. */
+        if (op == CL_OP_JOIN && (frame[0] & 0xFF) == 0xFF)
+            cl_send(src_mac, CL_OP_HELLO, c->app_id, 0, c->tx_buf, 0,
+                    c->frame_buf);
+
+        /* An idle worker still holding units lost their WORK frames
+         * (or our CANCEL crossed its UNIT_END): give the slots back. */
+        if (op == CL_OP_HEARTBEAT && data_len >= 1 &&
+            (data[0] & 0xFF) >= CL_WORKER_QUEUE)
+        {
+            int s;
+            for (s = 0; s < CL_WORKER_QUEUE; s++)
+            {
+                if (w->held[s] >= 0 &&
+                    cl_now() - w->held_at[s] > CL_HEARTBEAT_MS * 1000u)
+                {
+                    c->units[w->held[s]].holders--;
+                    w->held[s] = -1;
+                }
+            }
+        }
+        return 1;
+    }
+
+    wi = cl_find_worker(c, src_mac);
+    if (wi < 0)
+        return 1;
+    w = &c->workers[wi];
+    w->last_seen = cl_now();
+    if (!w->alive)
+        cl_add_worker(c, src_mac);
+
+    if (!c->active || job != c->job_id)
+        return 1;
+
+    switch (op)
+    {
+    case CL_OP_NEED_JOB:
+        /* Missed the JOB broadcast: repair with a unicast copy. */
+        cl_send_job(c, w->mac);
+        w->job_sent = c->job_id;
+        c->stats.job_repairs++;
+        break;
+
+    case CL_OP_RESULT:
+        if (data_len >= 1)
+            cl_on_result(c, unit, data[0] & 0xFF, data + 1, data_len - 1);
+        break;
+
+    case CL_OP_UNIT_END:
+        if (data_len >= 1 && unit < c->num_units)
+        {
+            if (cl_release(c, w, unit))
+                w->units_done++;
+            cl_on_unit_end(c, unit, data[0] & 0xFF);
+        }
+        break;
+    }
+    return 1;
+}
+
+int cl_coord_discover(cl_coord_t *c, int wait_ms)
+{
+    unsigned int start;
+    int len;
+
+    cl_send(cl_bcast_mac, CL_OP_HELLO, c->app_id, 0, c->tx_buf, 0,
+            c->frame_buf);
+    c->last_hello = cl_now();
+
+    start = cl_now();
+    while (cl_now() - start < (unsigned int)wait_ms * 1000u)
+    {
+        if (sys_net_packet_count() > 0)
+        {
+            len = sys_net_recv(c->frame_buf, FNP_FRAME_BUF_SIZE);
+            if (len > 0)
+                cl_coord_handle_frame(c, c->frame_buf, len);
+        }
+        else
+            sys_sleep(1);
+    }
+    return cl_coord_live_workers(c);
+}
+
+int cl_coord_start(cl_coord_t *c, const char *params, int params_len,
+                   int num_units, cl_result_fn on_result, void *ctx)
+{
+    int i;
+    int s;
+    cl_unit_t *u;
+
+    if (num_units < 0 || num_units > CL_MAX_UNITS)
+        return -1;
+    if (params_len < 0 || params_len > CL_MAX_PARAMS)
+        return -1;
+
+    c->job_id = (c->job_id + 1) & 0xFFFF;
+    c->params = params;
+    c->params_len = params_len;
+    c->num_units = num_units;
+    c->units_done = 0;
+    c->on_result = on_result;
+    c->ctx = ctx;
+    c->active = 1;
+    c->stats.jobs++;
+
+    for (i = 0; i < num_units; i++)
+    {
+        u = &c->units[i];
+        u->state = CL_UNIT_PENDING;
+        u->holders = 0;
+        u->dispatches = 0;
+        u->frag_total = -1;
+        u->frag_mask = 0;
+        u->sent_at = 0;
+        u->order = 0;
+    }
+    for (i = 0; i < c->num_workers; i++)
+    {
+        for (s = 0; s < CL_WORKER_QUEUE; s++)
+            c->workers[i].held[s] = -1;
+    }
+
+    /* Parameters go out once for everyone. A worker that misses the
+     * broadcast asks with NEED_JOB when its first WORK arrives. */
+    if (cl_coord_live_workers(c) > 0)
+    {
+        cl_send_job(c, cl_bcast_mac);
+        for (i = 0; i < c->num_workers; i++)
+        {
+            if (c->workers[i].alive)
+                c->workers[i].job_sent = c->job_id;
+        }
+    }
+    return 0;
+}
+
+/* Take the last queued (not yet started) unit of the busiest worker. */
+static int cl_steal(cl_coord_t *c, int thief)
+{
+    int i;
+    int s;
+    int victim;
+    int most;
+    int n;
+    int best;
+    cl_worker_t *v;
+
+    victim = -1;
+    most = 1;
+    for (i = 0; i < c->num_workers; i++)
+    {
+        if (i == thief || !c->workers[i].alive)
+            continue;
+        n = cl_held_count(&c->workers[i]);
+        if (n > most)
+        {
+            most = n;
+            victim = i;
+        }
+    }
+    if (victim < 0)
+        return -1;
+
+    v = &c->workers[victim];
+    best = -1;
+    for (s = 0; s < CL_WORKER_QUEUE; s++)
+    {
+        n = v->held[s];
+        if (n >= 0 && c->units[n].holders == 1 &&
+            (best < 0 || c->units[n].order > c->units[best].order))
+            best = n;
+    }
+    if (best < 0)
+        return -1;
+
+    cl_release(c, v, best);
+    cl_send(v->mac, CL_OP_CANCEL, c->job_id, best, c->tx_buf, 0,
+            c->frame_buf);
+    v->stolen++;
+    c->stats.stolen++;
+    return best;
+}
+
+static int cl_pick_unit(cl_coord_t *c, int wi, unsigned int now)
+{
+    cl_worker_t *w;
+    cl_unit_t *u;
+    unsigned int deadline;
+    int i;
+    int best;
+
+    /* 1) Fresh units, then units nobody holds any more (lost frames). */
+    for (i = 0; i < c->num_units; i++)
+    {
+        u = &c->units[i];
+        if (u->state == CL_UNIT_PENDING ||
+            (u->state == CL_UNIT_ASSIGNED && u->holders == 0))
+            return i;
+    }
+
+    /* Only idle workers steal or run backups: a worker that is still
+     * busy would just move the queue around. */
+    w = &c->workers[wi];
+    if (cl_held_count(w) > 0)
+        return -1;
+
+    /* 2) Steal queued work from a busier worker. */
+    i = cl_steal(c, wi);
+    if (i >= 0)
+        return i;
+
+    /* 3) Backup copy of the oldest straggler. */
+    deadline = c->avg_unit_us * 3;
+    if (deadline < CL_MIN_DEADLINE_MS * 1000u)
+        deadline = CL_MIN_DEADLINE_MS * 1000u;
+
+    best = -1;
+    for (i = 0; i < c->num_units; i++)
+    {
+        u = &c->units[i];
+        if (u->state != CL_UNIT_ASSIGNED || u->dispatches >= CL_MAX_DISPATCH)
+            continue;
+        if (now - u->sent_at <= deadline)
+            continue;
+        if (best < 0 || u->order < c->units[best].order)
+            best = i;
+    }
+    if (best >= 0)
+        c->stats.redispatched++;
+    return best;
+}
+
+static void cl_assign(cl_coord_t *c, int wi, int unit, unsigned int now)
+{
+    cl_worker_t *w;
+    cl_unit_t *u;
+    int s;
+
+    w = &c->workers[wi];
+    if (w->job_sent != c->job_id)
+    {
+        cl_send_job(c, w->mac);
+        w->job_sent = c->job_id;
+    }
+
+    cl_send(w->mac, CL_OP_WORK, c->job_id, unit, c->tx_buf, 0,
+            c->frame_buf);
+
+    for (s = 0; s < CL_WORKER_QUEUE; s++)
+    {
+        if (w->held[s] < 0)
+        {
+            w->held[s] = unit;
+            w->held_at[s] = now;
+            break;
+        }
+    }
+
+    u = &c->units[unit];
+    u->state = CL_UNIT_ASSIGNED;
+    u->holders++;
+    u->dispatches++;
+    u->sent_at = now;
+    c->order++;
+    u->order = c->order;
+}
+
+static void cl_run_local(cl_coord_t *c, int unit)
+{
+    cl_node_t *n;
+    cl_unit_t *u;
+
+    n = &cl_self;
+    n->coord = c;
+    n->run_job = c->job_id;
+    n->run_unit = unit;
+    n->frags = 0;
+    n->cancelled = 0;
+
+    u = &c->units[unit];
+    u->state = CL_UNIT_ASSIGNED;
+    u->dispatches++;
+    u->sent_at = cl_now();
+    c->stats.local_units++;
+
+    if (c->local_work(n, c->params, c->params_len, unit, c->ctx) == 0 &&
+        !n->cancelled)
+        cl_on_unit_end(c, unit, n->frags);
+
+    n->run_job = -1;
+    n->coord = 0;
+}
+
+int cl_coord_poll(cl_coord_t *c)
+{
+    unsigned int now;
+    cl_worker_t *w;
+    int i;
+    int unit;
+    int live;
+
+    now = cl_now();
+
+    if (now - c->last_hello > CL_HELLO_MS * 1000u)
+    {
+        cl_send(cl_bcast_mac, CL_OP_HELLO, c->app_id, 0, c->tx_buf, 0,
+                c->frame_buf);
+        c->last_hello = now;
+    }
+
+    live = 0;
+    for (i = 0; i < c->num_workers; i++)
+    {
+        w = &c->workers[i];
+        if (!w->alive)
+            continue;
+        if (now - w->last_seen > CL_WORKER_TIMEOUT_MS * 1000u)
+            cl_worker_dead(c, w);
+        else
+            live++;
+    }
+
+    if (!c->active)
+        return c->units_done == c->num_units;
+
+    for (i = 0; i < c->num_workers; i++)
+    {
+        w = &c->workers[i];
+        if (!w->alive)
+            continue;
+        while (cl_held_count(w) < CL_WORKER_QUEUE)
+        {
+            unit = cl_pick_unit(c, i, now);
+            if (unit < 0)
+                break;
+            cl_assign(c, i, unit, now);
+        }
+    }
+
+    /* No workers: run one unit here and come back for the network. */
+    if (live == 0 && c->local_work && c->units_done < c->num_units)
+    {
+        for (i = 0; i < c->num_units; i++)
+        {
+            if (c->units[i].state != CL_UNIT_DONE && c->units[i].holders == 0)
+            {
+                cl_run_local(c, i);
+                break;
+            }
+        }
+    }
+
+    if (c->units_done == c->num_units)
+    {
+        c->active = 0;
+        cl_send(cl_bcast_mac, CL_OP_DONE, c->job_id, 0, c->tx_buf, 0,
+                c->frame_buf);
+        return 1;
+    }
+    return 0;
+}
+
+int cl_coord_run(cl_coord_t *c, int timeout_ms)
+{
+    unsigned int start;
+    int len;
+    int idle;
+
+    start = cl_now();
+    while (1)
+    {
+        idle = 1;
+        while (sys_net_packet_count() > 0)
+        {
+            len = sys_net_recv(c->frame_buf, FNP_FRAME_BUF_SIZE);
+            if (len > 0)
+                cl_coord_handle_frame(c, c->frame_buf, len);
+            idle = 0;
+        }
+        if (cl_coord_poll(c))
+            return 1;
+        if (timeout_ms > 0 &&
+            cl_now() - start > (unsigned int)timeout_ms * 1000u)
+            return 0;
+        if (idle)
+            sys_sleep(1);
+    }
+}
+
+void cl_coord_shutdown(cl_coord_t *c)
+{
+    c->active = 0;
+    cl_send(cl_bcast_mac, CL_OP_BYE, c->app_id, 0, c->tx_buf, 0,
+            c->frame_buf);
+}
+
+/* =========================================================================
+ * Worker
+ * ========================================================================= */
+
+static void cl_node_send(cl_node_t *n, int op, int job, int unit, int extra)
+{
+    if (n->have_coord)
+        cl_send(n->coord_mac, op, job, unit, n->tx_buf, extra, n->frame_buf);
+}
+
+static void cl_heartbeat(cl_node_t *n)
+{
+    int used;
+
+    used = n->q_len + (n->run_job >= 0 ? 1 : 0);
+    n->tx_buf[CL_HEADER_SIZE] = used >= CL_WORKER_QUEUE ? 0
+                                                        : CL_WORKER_QUEUE - used;
+    cl_node_send(n, CL_OP_HEARTBEAT, n->app_id, 0, 1);
+    n->last_beat = cl_now();
+}
+
+static void cl_drop_queued(cl_node_t *n, int job, int unit)
+{
+    int i;
+    int j;
+
+    j = 0;
+    for (i = 0; i < n->q_len; i++)
+    {
+        if (n->q_job[i] == job && (unit < 0 || n->q_unit[i] == unit))
+            continue;
+        n->q_job[j] = n->q_job[i];
+        n->q_unit[j] = n->q_unit[i];
+        j++;
+    }
+    n->q_len = j;
+}
+
+static void cl_node_frame(cl_node_t *n, char *frame, int len)
+{
+    int src_mac[6];
+    int op;
+    int job;
+    int unit;
+    char *data;
+    int data_len;
+    int i;
+
+    if (!cl_parse(frame, len, src_mac, &op, &job, &unit, &data, &data_len))
+        return;
+
+    switch (op)
+    {
+    case CL_OP_HELLO:
+        if (job != n->app_id)
+            return;
+        for (i = 0; i < 6; i++)
+            n->coord_mac[i] = src_mac[i];
+        n->have_coord = 1;
+        cl_node_send(n, CL_OP_JOIN, n->app_id, 0, 0);
+        break;
+
+    case CL_OP_BYE:
+        if (job == n->app_id && n->have_coord &&
+            cl_mac_eq(src_mac, n->coord_mac))
+        {
+            n->bye = 1;
+            n->cancelled = 1;
+        }
+        break;
+
+    case CL_OP_JOB:
+        /* JOB carries no app id: take broadcasts only from our own
+         * coordinator. A unicast JOB is always meant for us. */
+        if ((frame[0] & 0xFF) == 0xFF &&
+            !(n->have_coord && cl_mac_eq(src_mac, n->coord_mac)))
+            break;
+        for (i = 0; i < 6; i++)
+            n->coord_mac[i] = src_mac[i];
+        n->have_coord = 1;
+        if (job == n->job_id)
+            break;
+        /* A new job obsoletes everything from the previous one. */
+        for (i = 0; i < data_len && i < CL_MAX_PARAMS; i++)
+            n->params[i] = data[i];
+        n->params_len = i;
+        i = 0;
+        while (i < n->q_len)
+        {
+            if (n->q_job[i] != job)
+                cl_drop_queued(n, n->q_job[i], -1);
+            else
+                i++;
+        }
+        if (n->run_job >= 0 && n->run_job != job)
+            n->cancelled = 1;
+        n->job_id = job;
+        break;
+
+    case CL_OP_WORK:
+        for (i = 0; i < 6; i++)
+            n->coord_mac[i] = src_mac[i];
+        n->have_coord = 1;
+        if (n->q_len < CL_WQ_SIZE)
+        {
+            n->q_job[n->q_len] = job;
+            n->q_unit[n->q_len] = unit;
+            n->q_len++;
+        }
+        break;
+
+    case CL_OP_CANCEL:
+        cl_drop_queued(n, job, unit);
+        if (n->run_job == job && n->run_unit == unit)
+            n->cancelled = 1;
+        break;
+
+    case CL_OP_DONE:
+        cl_drop_queued(n, job, -1);
+        if (n->run_job == job)
+            n->cancelled = 1;
+        break;
+    }
+}
+
+int cl_service(cl_node_t *n)
+{
+    int len;
+
+    if (n->coord)
+    {
+        /* Local fallback: let workers that show up meanwhile join. */
+        while (sys_net_packet_count() > 0)
+        {
+            len = sys_net_recv(n->coord->frame_buf, FNP_FRAME_BUF_SIZE);
+            if (len > 0)
+                cl_coord_handle_frame(n->coord, n->coord->frame_buf, len);
+        }
+        return n->cancelled;
+    }
+
+    while (sys_net_packet_count() > 0)
+    {
+        len = sys_net_recv(n->frame_buf, FNP_FRAME_BUF_SIZE);
+        if (len > 0)
+            cl_node_frame(n, n->frame_buf, len);
+    }
+    if (cl_now() - n->last_beat > CL_HEARTBEAT_MS * 1000u)
+        cl_heartbeat(n);
+    return n->cancelled;
+}
+
+int cl_emit(cl_node_t *n, const char *data, int len)
+{
+    int i;
+
+    if (n->cancelled || n->frags >= CL_MAX_FRAGS || len > CL_MAX_RESULT)
+        return -1;
+
+    if (n->coord)
+        cl_on_result(n->coord, n->run_unit, n->frags, data, len);
+    else
+    {
+        n->tx_buf[CL_HEADER_SIZE] = n->frags;
+        for (i = 0; i < len; i++)
+            n->tx_buf[CL_HEADER_SIZE + 1 + i] = data[i];
+        cl_node_send(n, CL_OP_RESULT, n->run_job, n->run_unit, 1 + len);
+    }
+    n->frags++;
+    cl_service(n);
+    return 0;
+}
+
+int cl_worker_run(int app_id, cl_work_fn fn, void *ctx)
+{
+    cl_node_t *n;
+    unsigned int now;
+    int len;
+    int done;
+    int idle;
+
+    fnp_init();
+
+    n = &cl_self;
+    n->coord = 0;
+    n->app_id = app_id & 0xFFFF;
+    n->have_coord = 0;
+    n->job_id = -1;
+    n->params_len = 0;
+    n->q_len = 0;
+    n->run_job = -1;
+    n->run_unit = 0;
+    n->frags = 0;
+    n->cancelled = 0;
+    n->bye = 0;
+    n->last_beat = cl_now();
+    n->last_need = 0;
+    n->last_join = cl_now();
+
+    /* Announce ourselves in case the coordinator is already running. */
+    cl_send(cl_bcast_mac, CL_OP_JOIN, n->app_id, 0, n->tx_buf, 0,
+            n->frame_buf);
+
+    done = 0;
+    while (!n->bye)
+    {
+        idle = 1;
+        while (sys_net_packet_count() > 0)
+        {
+            len = sys_net_recv(n->frame_buf, FNP_FRAME_BUF_SIZE);
+            if (len > 0)
+                cl_node_frame(n, n->frame_buf, len);
+            idle = 0;
+        }
+        if (n->bye)
+            break;
+        if (sys_get_key_state() & KEYSTATE_ESCAPE)
+            break;
+
+        now = cl_now();
+        if (!n->have_coord && now - n->last_join > CL_HELLO_MS * 1000u)
+        {
+            cl_send(cl_bcast_mac, CL_OP_JOIN, n->app_id, 0, n->tx_buf, 0,
+                    n->frame_buf);
+            n->last_join = now;
+        }
+
+        if (n->q_len > 0 && n->q_job[0] != n->job_id)
+        {
+            /* WORK overtook (or lost) its JOB frame. */
+            if (now - n->last_need > CL_HEARTBEAT_MS * 1000u)
+            {
+                cl_node_send(n, CL_OP_NEED_JOB, n->q_job[0], 0, 0);
+                n->last_need = now;
+            }
+        }
+        else if (n->q_len > 0)
+        {
+            n->run_job = n->q_job[0];
+            n->run_unit = n->q_unit[0];
+            cl_drop_queued(n, n->run_job, n->run_unit);
+            n->frags = 0;
+            n->cancelled = 0;
+
+            if (fn(n, n->params, n->params_len, n->run_unit, ctx) == 0 &&
+                !n->cancelled)
+            {
+                n->tx_buf[CL_HEADER_SIZE] = n->frags;
+                cl_node_send(n, CL_OP_UNIT_END, n->run_job, n->run_unit, 1);
+                done++;
+            }
+            n->run_job = -1;
+
+            /* Report free slots right away: this is how workers pull. */
+            if (n->q_len == 0)
+                cl_heartbeat(n);
+            idle = 0;
+        }
+
+        if (cl_now() - n->last_beat > CL_HEARTBEAT_MS * 1000u)
+            cl_heartbeat(n);
+        if (idle)
+            sys_sleep(1);
+    }
+    return done;
+}
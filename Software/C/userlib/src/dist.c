@@ -0,0 +1,958 @@
+/*
+ * dist.c — Remote tasks over FNP MESSAGE frames.
+ *
+ * See dist.h for the protocol. Every transfer is a go-back-N stream: the
+ * receiver only takes the chunk it expects and answers every chunk with
+ * the index of the next one, the sender resends from the first
+ * unacknowledged chunk when the acknowledgements stop. A chunk carries the
+ * total size of its blob, so the first chunk to arrive tells the receiver
+ * how much to allocate.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <syscall.h>
+#include <fnp.h>
+#include <dist.h>
+
+/* Worker state */
+typedef struct
+{
+    int app_id;
+    int coord_mac[6];
+    int have_coord;
+
+    int id;                     /* dispatch id of the task, -1 none */
+    int state;                  /* DIST_W_IDLE, _RECV (input), _SEND */
+    int done_id;                /* last finished or cancelled id */
+
+    char *in;
+    int in_total;
+    int in_next;
+
+    char *out;
+    int out_len;
+    int status;
+    int out_next;               /* first unacknowledged chunk */
+    int out_sent;
+    unsigned int sent_at;
+    unsigned int last_heard;    /* us, last frame of the transfer */
+
+    int bye;
+    unsigned int last_beat;
+    unsigned int last_join;
+
+    char frame_buf[FNP_FRAME_BUF_SIZE];
+    char tx_buf[FNP_MAX_DATA];
+} dist_node_t;
+
+static dist_node_t dist_self;
+
+static int dist_bcast_mac[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+/* ---- Helpers ---- */
+
+static unsigned int dist_now(void)
+{
+    return (unsigned int)sys_get_time_us();
+}
+
+static void dist_put_u16(char *buf, int offset, int val)
+{
+    buf[offset] = (val >> 8) & 0xFF;
+    buf[offset + 1] = val & 0xFF;
+}
+
+static int dist_get_u16(const char *buf, int offset)
+{
+    return ((buf[offset] & 0xFF) << 8) | (buf[offset + 1] & 0xFF);
+}
+
+static void dist_put_u32(char *buf, int offset, int val)
+{
+    dist_put_u16(buf, offset, (val >> 16) & 0xFFFF);
+    dist_put_u16(buf, offset + 2, val & 0xFFFF);
+}
+
+static int dist_get_u32(const char *buf, int offset)
+{
+    return (dist_get_u16(buf, offset) << 16) | dist_get_u16(buf, offset + 2);
+}
+
+static int dist_mac_eq(const int *a, const int *b)
+{
+    int i;
+    for (i = 0; i < 6; i++)
+    {
+        if ((a[i] & 0xFF) != (b[i] & 0xFF))
+            return 0;
+    }
+    return 1;
+}
+
+/* Chunks of a blob; an empty blob still takes one to carry its size. */
+static int dist_chunks(int total)
+{
+    if (total <= 0)
+        return 1;
+    return (total + DIST_CHUNK - 1) / DIST_CHUNK;
+}
+
+/* Send [magic][op][id][seq] + extra bytes already at tx_buf + 6. */
+static void dist_send(int *mac, int op, int id, int seq,
+                      char *tx_buf, int extra_len, char *frame_buf)
+{
+    tx_buf[0] = DIST_MAGIC;
+    tx_buf[1] = op;
+    dist_put_u16(tx_buf, 2, id);
+    dist_put_u16(tx_buf, 4, seq);
+    fnp_send(mac, FNP_TYPE_MESSAGE, 0, 0, tx_buf,
+             DIST_HEADER_SIZE + extra_len, frame_buf);
+}
+
+/* Parse a frame into op/id/seq/data. Returns 1 if it is a dist frame. */
+static int dist_parse(char *frame, int len, int *src_mac, int *op, int *id,
+                      int *seq, char **data, int *data_len)
+{
+    int msg_type;
+    int fseq;
+    int flags;
+    char *payload;
+    int payload_len;
+
+    if (!fnp_parse(frame, len, src_mac, &msg_type, &fseq, &flags,
+                   &payload, &payload_len))
+        return 0;
+    if (msg_type != FNP_TYPE_MESSAGE || payload_len < DIST_HEADER_SIZE)
+        return 0;
+    if ((payload[0] & 0xFF) != DIST_MAGIC)
+        return 0;
+
+    *op = payload[1] & 0xFF;
+    *id = dist_get_u16(payload, 2);
+    *seq = dist_get_u16(payload, 4);
+    *data = payload + DIST_HEADER_SIZE;
+    *data_len = payload_len - DIST_HEADER_SIZE;
+    return 1;
+}
+
+/* =========================================================================
+ * Coordinator
+ * ========================================================================= */
+
+static int dist_find_worker(dist_coord_t *c, int *mac)
+{
+    int i;
+    for (i = 0; i < c->num_workers; i++)
+    {
+        if (dist_mac_eq(c->workers[i].mac, mac))
+            return i;
+    }
+    return -1;
+}
+
+/* Forget the task of w; it goes back to the queue if nobody else has it. */
+static void dist_release(dist_coord_t *c, dist_worker_t *w)
+{
+    if (w->task >= 0)
+        c->tasks[w->task].holders--;
+    w->task = -1;
+    w->id = -1;
+    if (w->buf)
+        free(w->buf);
+    w->buf = 0;
+    w->state = DIST_W_IDLE;
+}
+
+static int dist_add_worker(dist_coord_t *c, int *mac)
+{
+    dist_worker_t *w;
+    int wi;
+    int i;
+
+    wi = dist_find_worker(c, mac);
+    if (wi < 0)
+    {
+        if (c->num_workers >= DIST_MAX_WORKERS)
+            return -1;
+        wi = c->num_workers;
+        c->num_workers++;
+        w = &c->workers[wi];
+        for (i = 0; i < 6; i++)
+            w->mac[i] = mac[i] & 0xFF;
+        w->alive = 0;
+        w->task = -1;
+        w->buf = 0;
+        w->id = -1;
+        w->tasks_done = 0;
+    }
+
+    w = &c->workers[wi];
+    if (!w->alive)
+    {
+        w->alive = 1;
+        w->state = DIST_W_IDLE;
+    }
+    w->last_seen = dist_now();
+    return wi;
+}
+
+static void dist_worker_dead(dist_coord_t *c, dist_worker_t *w)
+{
+    if (w->task >= 0 && c->tasks[w->task].holders == 1)
+        c->stats.requeued++;
+    dist_release(c, w);
+    w->alive = 0;
+}
+
+static void dist_task_complete(dist_coord_t *c, int ti, int wi)
+{
+    dist_task_t *t;
+    dist_worker_t *w;
+    unsigned int lat;
+    int i;
+
+    t = &c->tasks[ti];
+    t->state = DIST_TASK_DONE;
+    t->worker = wi;
+    c->tasks_done++;
+
+    lat = dist_now() - t->sent_at;
+    if (c->avg_task_us == 0)
+        c->avg_task_us = lat;
+    else
+        c->avg_task_us = c->avg_task_us - (c->avg_task_us >> 2) + (lat >> 2);
+
+    /* Backup copies still running elsewhere are no longer needed. A
+     * worker inside its task function only sees the CANCEL afterwards,
+     * so it stays busy until it reports back. */
+    for (i = 0; i < c->num_workers; i++)
+    {
+        w = &c->workers[i];
+        if (i == wi || !w->alive || w->task != ti)
+            continue;
+        dist_send(w->mac, DIST_OP_CANCEL, w->id, 0, c->tx_buf, 0,
+                  c->frame_buf);
+        c->stats.cancelled++;
+        if (w->state == DIST_W_RUN)
+        {
+            t->holders--;
+            w->task = -1;
+        }
+        else
+            dist_release(c, w);
+    }
+}
+
+void dist_coord_init(dist_coord_t *c, int app_id)
+{
+    fnp_init();
+    c->app_id = app_id & 0xFFFF;
+    c->next_id = 1;
+    c->num_workers = 0;
+    c->num_tasks = 0;
+    c->tasks_done = 0;
+    c->avg_task_us = 0;
+    c->run_timeout_ms = DIST_RUN_TIMEOUT_MS;
+    c->local_task = 0;
+    c->ctx = 0;
+    c->last_hello = dist_now();
+    memset(&c->stats, 0, sizeof(c->stats));
+}
+
+void dist_coord_set_local(dist_coord_t *c, dist_task_fn fn, void *ctx)
+{
+    c->local_task = fn;
+    c->ctx = ctx;
+}
+
+int dist_coord_live_workers(dist_coord_t *c)
+{
+    int i;
+    int n;
+    n = 0;
+    for (i = 0; i < c->num_workers; i++)
+    {
+        if (c->workers[i].alive)
+            n++;
+    }
+    return n;
+}
+
+int dist_coord_add(dist_coord_t *c, const char *in, int in_len)
+{
+    dist_task_t *t;
+
+    if (c->num_tasks >= DIST_MAX_TASKS || in_len < 0)
+        return -1;
+    t = &c->tasks[c->num_tasks];
+    t->in = in;
+    t->in_len = in_len;
+    t->out = 0;
+    t->out_len = 0;
+    t->status = 0;
+    t->state = DIST_TASK_PENDING;
+    t->holders = 0;
+    t->dispatches = 0;
+    t->sent_at = 0;
+    t->worker = -1;
+    c->stats.tasks++;
+    return c->num_tasks++;
+}
+
+/* Send input chunks of w's task up to the end of the window. */
+static void dist_pump_input(dist_coord_t *c, dist_worker_t *w)
+{
+    dist_task_t *t;
+    int chunks;
+    int off;
+    int n;
+
+    t = &c->tasks[w->task];
+    chunks = dist_chunks(t->in_len);
+    while (w->sent < chunks && w->sent < w->next + DIST_WINDOW)
+    {
+        off = w->sent * DIST_CHUNK;
+        n = t->in_len - off;
+        if (n > DIST_CHUNK)
+            n = DIST_CHUNK;
+        dist_put_u32(c->tx_buf, DIST_HEADER_SIZE, t->in_len);
+        if (n > 0)
+            memcpy(c->tx_buf + DIST_HEADER_SIZE + 4, t->in + off, n);
+        dist_send(w->mac, DIST_OP_INPUT, w->id, w->sent, c->tx_buf, 4 + n,
+                  c->frame_buf);
+        c->stats.bytes_out += n;
+        w->sent++;
+        if (w->top < w->sent)
+            w->top = w->sent;
+        w->sent_at = dist_now();
+    }
+}
+
+/* One OUTPUT chunk from w for the task it runs. */
+static void dist_on_output(dist_coord_t *c, int wi, int seq,
+                           char *data, int data_len)
+{
+    dist_worker_t *w;
+    dist_task_t *t;
+    int total;
+    int n;
+
+    w = &c->workers[wi];
+    total = dist_get_u32(data, 1);
+    if (w->state != DIST_W_RECV)
+    {
+        w->buf = malloc(total > 0 ? total : 1);
+        if (!w->buf)
+        {
+            /* No room for the result: fail the task rather than have
+             * every worker compute it again. */
+            t = &c->tasks[w->task];
+            t->status = -1;
+            dist_send(w->mac, DIST_OP_CANCEL, w->id, 0, c->tx_buf, 0,
+                      c->frame_buf);
+            dist_release(c, w);
+            dist_task_complete(c, t - c->tasks, wi);
+            return;
+        }
+        w->state = DIST_W_RECV;
+        w->total = total;
+        w->next = 0;
+    }
+
+    if (seq == w->next && total == w->total)
+    {
+        n = data_len - 5;
+        if (n > w->total - seq * DIST_CHUNK)
+            n = w->total - seq * DIST_CHUNK;
+        if (n > 0)
+            memcpy(w->buf + seq * DIST_CHUNK, data + 5, n);
+        c->stats.bytes_in += n > 0 ? n : 0;
+        w->next++;
+    }
+    dist_send(w->mac, DIST_OP_OUTPUT_ACK, w->id, w->next, c->tx_buf, 0,
+              c->frame_buf);
+
+    if (w->next == dist_chunks(w->total))
+    {
+        t = &c->tasks[w->task];
+        t->out = w->buf;
+        t->out_len = w->total;
+        t->status = (signed char)data[0];
+        w->buf = 0;
+        w->tasks_done++;
+        dist_release(c, w);
+        dist_task_complete(c, t - c->tasks, wi);
+    }
+}
+
+int dist_coord_handle_frame(dist_coord_t *c, char *frame, int len)
+{
+    int src_mac[6];
+    int op;
+    int id;
+    int seq;
+    char *data;
+    int data_len;
+    int wi;
+    int bcast;
+    dist_worker_t *w;
+
+    if (!dist_parse(frame, len, src_mac, &op, &id, &seq, &data, &data_len))
+        return 0;
+
+    if (op == DIST_OP_JOIN || op == DIST_OP_IDLE)
+    {
+        if (id != c->app_id)
+            return 1;
+        /* Sent before our first chunk arrived; it does not count as a
+         * sign of life either, so a worker that ignores the task times
+         * out. */
+        wi = dist_find_worker(c, src_mac);
+        if (op == DIST_OP_IDLE && wi >= 0 && c->workers[wi].alive &&
+            c->workers[wi].state == DIST_W_SEND && c->workers[wi].next == 0)
+            return 1;
+        wi = dist_add_worker(c, src_mac);
+        if (wi < 0)
+            return 1;
+        w = &c->workers[wi];
+
+        /* A broadcast JOIN comes from a worker that (re)started and has
+         * not heard our HELLO yet. A worker that does that or reports idle
+         * while we think it has a task has lost it. */
+        bcast = (frame[0] & 0xFF) == 0xFF;
+        if (op == DIST_OP_JOIN && bcast)
+            dist_send(src_mac, DIST_OP_HELLO, c->app_id, 0, c->tx_buf, 0,
+                      c->frame_buf);
+        if ((op == DIST_OP_IDLE || bcast) && w->state != DIST_W_IDLE)
+        {
+            if (w->task >= 0 && c->tasks[w->task].holders == 1)
+                c->stats.requeued++;
+            dist_release(c, w);
+        }
+        return 1;
+    }
+
+    wi = dist_find_worker(c, src_mac);
+    if (wi < 0)
+        return 1;
+    w = &c->workers[wi];
+    w->last_seen = dist_now();
+    if (!w->alive)
+        dist_add_worker(c, src_mac);
+
+    if (id != w->id)
+    {
+        /* Output of a task that was taken away from this worker or is
+         * complete already (our last ACK got lost). */
+        if (op == DIST_OP_OUTPUT)
+            dist_send(w->mac, DIST_OP_CANCEL, id, 0, c->tx_buf, 0,
+                      c->frame_buf);
+        return 1;
+    }
+
+    switch (op)
+    {
+    case DIST_OP_INPUT_ACK:
+        if (w->state != DIST_W_SEND || seq <= w->next)
+            break;
+        w->next = seq;
+        if (w->sent < w->next)
+            w->sent = w->next;
+        if (w->next >= dist_chunks(c->tasks[w->task].in_len))
+        {
+            w->state = DIST_W_RUN;
+            w->sent_at = dist_now();
+        }
+        else
+            dist_pump_input(c, w);
+        break;
+
+    case DIST_OP_OUTPUT:
+        if (data_len < 5)
+            break;
+        if (w->task < 0)
+        {
+            /* Cancelled while it ran. */
+            dist_send(w->mac, DIST_OP_CANCEL, id, 0, c->tx_buf, 0,
+                      c->frame_buf);
+            break;
+        }
+        dist_on_output(c, wi, seq, data, data_len);
+        break;
+    }
+    return 1;
+}
+
+int dist_coord_discover(dist_coord_t *c, int wait_ms)
+{
+    unsigned int start;
+    int len;
+
+    dist_send(dist_bcast_mac, DIST_OP_HELLO, c->app_id, 0, c->tx_buf, 0,
+              c->frame_buf);
+    c->last_hello = dist_now();
+
+    start = dist_now();
+    while (dist_now() - start < (unsigned int)wait_ms * 1000u)
+    {
+        if (sys_net_packet_count() > 0)
+        {
+            len = sys_net_recv(c->frame_buf, FNP_FRAME_BUF_SIZE);
+            if (len > 0)
+                dist_coord_handle_frame(c, c->frame_buf, len);
+        }
+        else
+            sys_sleep(1);
+    }
+    return dist_coord_live_workers(c);
+}
+
+static int dist_pick_task(dist_coord_t *c, unsigned int now)
+{
+    dist_task_t *t;
+    unsigned int deadline;
+    int i;
+    int best;
+
+    /* 1) The largest task nobody holds: fresh ones and those of dropped
+     * workers. */
+    best = -1;
+    for (i = 0; i < c->num_tasks; i++)
+    {
+        t = &c->tasks[i];
+        if (t->state != DIST_TASK_DONE && t->holders == 0 &&
+            (best < 0 || t->in_len > c->tasks[best].in_len))
+            best = i;
+    }
+    if (best >= 0)
+        return best;
+
+    /* 2) Backup copy of the oldest task past its deadline. */
+    deadline = c->avg_task_us * 3;
+    if (deadline < DIST_MIN_DEADLINE_MS * 1000u)
+        deadline = DIST_MIN_DEADLINE_MS * 1000u;
+    for (i = 0; i < c->num_tasks; i++)
+    {
+        t = &c->tasks[i];
+        if (t->state != DIST_TASK_ASSIGNED ||
+            t->dispatches >= DIST_MAX_DISPATCH)
+            continue;
+        if (now - t->sent_at <= deadline)
+            continue;
+        if (best < 0 || now - t->sent_at > now - c->tasks[best].sent_at)
+            best = i;
+    }
+    if (best >= 0)
+        c->stats.backups++;
+    return best;
+}
+
+static void dist_assign(dist_coord_t *c, int wi, int ti, unsigned int now)
+{
+    dist_worker_t *w;
+    dist_task_t *t;
+
+    w = &c->workers[wi];
+    w->task = ti;
+    w->id = c->next_id;
+    c->next_id = (c->next_id + 1) & 0xFFFF;
+    w->state = DIST_W_SEND;
+    w->next = 0;
+    w->sent = 0;
+    w->top = 0;
+    w->last_seen = now;
+
+    t = &c->tasks[ti];
+    t->sent_at = now;
+    t->state = DIST_TASK_ASSIGNED;
+    t->holders++;
+    t->dispatches++;
+    c->stats.dispatched++;
+
+    dist_pump_input(c, w);
+}
+
+static void dist_run_local(dist_coord_t *c, int ti)
+{
+    dist_task_t *t;
+
+    t = &c->tasks[ti];
+    t->state = DIST_TASK_ASSIGNED;
+    t->dispatches++;
+    t->sent_at = dist_now();
+    c->stats.local_tasks++;
+    t->out = 0;
+    t->out_len = 0;
+    t->status = c->local_task(t->in, t->in_len, &t->out, &t->out_len,
+                              c->ctx);
+    dist_task_complete(c, ti, -1);
+}
+
+int dist_coord_poll(dist_coord_t *c)
+{
+    unsigned int now;
+    unsigned int timeout;
+    dist_worker_t *w;
+    int i;
+    int ti;
+    int live;
+
+    now = dist_now();
+
+    if (now - c->last_hello > DIST_HELLO_MS * 1000u)
+    {
+        dist_send(dist_bcast_mac, DIST_OP_HELLO, c->app_id, 0, c->tx_buf, 0,
+                  c->frame_buf);
+        c->last_hello = now;
+    }
+
+    live = 0;
+    for (i = 0; i < c->num_workers; i++)
+    {
+        w = &c->workers[i];
+        if (!w->alive)
+            continue;
+        timeout = w->state == DIST_W_RUN ? c->run_timeout_ms
+                                         : DIST_XFER_TIMEOUT_MS;
+        if (now - w->last_seen > timeout * 1000u)
+        {
+            /* With every chunk sent, the worker may have all of them and
+             * be running the task with our last ACKs lost. If it is
+             * missing one, it gives up and reports idle. */
+            if (w->state == DIST_W_SEND &&
+                w->top == dist_chunks(c->tasks[w->task].in_len))
+            {
+                w->state = DIST_W_RUN;
+                w->last_seen = now;
+            }
+            else
+            {
+                dist_worker_dead(c, w);
+                continue;
+            }
+        }
+        live++;
+
+        /* Go back to the first chunk the worker has not acknowledged. */
+        if (w->state == DIST_W_SEND &&
+            now - w->sent_at > DIST_RETRY_MS * 1000u)
+        {
+            c->stats.resent += w->sent - w->next;
+            w->sent = w->next;
+            dist_pump_input(c, w);
+        }
+    }
+
+    for (i = 0; i < c->num_workers; i++)
+    {
+        w = &c->workers[i];
+        if (!w->alive || w->state != DIST_W_IDLE)
+            continue;
+        ti = dist_pick_task(c, now);
+        if (ti < 0)
+            break;
+        dist_assign(c, i, ti, now);
+    }
+
+    /* No workers: run one task here and come back for the network. */
+    if (live == 0 && c->local_task && c->tasks_done < c->num_tasks)
+    {
+        for (i = 0; i < c->num_tasks; i++)
+        {
+            if (c->tasks[i].state != DIST_TASK_DONE &&
+                c->tasks[i].holders == 0)
+            {
+                dist_run_local(c, i);
+                break;
+            }
+        }
+    }
+
+    return c->tasks_done == c->num_tasks;
+}
+
+int dist_coord_run(dist_coord_t *c, int timeout_ms)
+{
+    unsigned int start;
+    int len;
+    int idle;
+
+    start = dist_now();
+    while (1)
+    {
+        idle = 1;
+        while (sys_net_packet_count() > 0)
+        {
+            len = sys_net_recv(c->frame_buf, FNP_FRAME_BUF_SIZE);
+            if (len > 0)
+                dist_coord_handle_frame(c, c->frame_buf, len);
+            idle = 0;
+        }
+        if (dist_coord_poll(c))
+            return 1;
+        if (timeout_ms > 0 &&
+            dist_now() - start > (unsigned int)timeout_ms * 1000u)
+            return 0;
+        if (idle)
+            sys_sleep(1);
+    }
+}
+
+void dist_coord_shutdown(dist_coord_t *c)
+{
+    dist_send(dist_bcast_mac, DIST_OP_BYE, c->app_id, 0, c->tx_buf, 0,
+              c->frame_buf);
+}
+
+/* =========================================================================
+ * Worker
+ * ========================================================================= */
+
+static void dist_node_send(dist_node_t *n, int op, int id, int seq,
+                           int extra)
+{
+    if (n->have_coord)
+        dist_send(n->coord_mac, op, id, seq, n->tx_buf, extra, n->frame_buf);
+}
+
+static void dist_idle_beat(dist_node_t *n)
+{
+    dist_node_send(n, DIST_OP_IDLE, n->app_id, 0, 0);
+    n->last_beat = dist_now();
+}
+
+/* Drop the current task and its buffers. */
+static void dist_node_reset(dist_node_t *n)
+{
+    if (n->in)
+        free(n->in);
+    if (n->out)
+        free(n->out);
+    n->in = 0;
+    n->out = 0;
+    if (n->id >= 0)
+        n->done_id = n->id;
+    n->id = -1;
+    n->state = DIST_W_IDLE;
+}
+
+static void dist_node_input(dist_node_t *n, int id, int seq, char *data,
+                            int data_len)
+{
+    int total;
+    int len;
+
+    if (data_len < 4)
+        return;
+    total = dist_get_u32(data, 0);
+
+    if (id != n->id)
+    {
+        if (id == n->done_id)
+            return;
+        /* A new task replaces whatever the coordinator gave up on. */
+        dist_node_reset(n);
+        n->in = malloc(total > 0 ? total : 1);
+        if (!n->in)
+            return;
+        n->id = id;
+        n->state = DIST_W_RECV;
+        n->in_total = total;
+        n->in_next = 0;
+    }
+
+    if (n->state == DIST_W_RECV && seq == n->in_next && total == n->in_total)
+    {
+        len = data_len - 4;
+        if (len > total - seq * DIST_CHUNK)
+            len = total - seq * DIST_CHUNK;
+        if (len > 0)
+            memcpy(n->in + seq * DIST_CHUNK, data + 4, len);
+        n->in_next++;
+    }
+    n->last_heard = dist_now();
+    /* Once the input is complete (and we are running or sending the
+     * result) resent chunks just get the final ACK again. */
+    dist_node_send(n, DIST_OP_INPUT_ACK, id,
+                   n->state == DIST_W_RECV ? n->in_next
+                                           : dist_chunks(total), 0);
+}
+
+static void dist_node_frame(dist_node_t *n, char *frame, int len)
+{
+    int src_mac[6];
+    int op;
+    int id;
+    int seq;
+    char *data;
+    int data_len;
+    int i;
+
+    if (!dist_parse(frame, len, src_mac, &op, &id, &seq, &data, &data_len))
+        return;
+
+    switch (op)
+    {
+    case DIST_OP_HELLO:
+        if (id != n->app_id)
+            return;
+        for (i = 0; i < 6; i++)
+            n->coord_mac[i] = src_mac[i];
+        n->have_coord = 1;
+        dist_node_send(n, DIST_OP_JOIN, n->app_id, 0, 0);
+        break;
+
+    case DIST_OP_BYE:
+        if (id == n->app_id && n->have_coord &&
+            dist_mac_eq(src_mac, n->coord_mac))
+            n->bye = 1;
+        break;
+
+    case DIST_OP_INPUT:
+        for (i = 0; i < 6; i++)
+            n->coord_mac[i] = src_mac[i];
+        n->have_coord = 1;
+        dist_node_input(n, id, seq, data, data_len);
+        break;
+
+    case DIST_OP_OUTPUT_ACK:
+        if (id != n->id || n->state != DIST_W_SEND || seq <= n->out_next)
+            break;
+        n->out_next = seq;
+        if (n->out_sent < seq)
+            n->out_sent = seq;
+        n->last_heard = dist_now();
+        if (n->out_next >= dist_chunks(n->out_len))
+        {
+            dist_node_reset(n);
+            /* Report right away: this is how workers pull. */
+            dist_idle_beat(n);
+        }
+        break;
+
+    case DIST_OP_CANCEL:
+        if (id == n->id)
+        {
+            dist_node_reset(n);
+            dist_idle_beat(n);
+        }
+        break;
+    }
+}
+
+/* Send output chunks up to the end of the window. */
+static void dist_pump_output(dist_node_t *n)
+{
+    int chunks;
+    int off;
+    int len;
+
+    chunks = dist_chunks(n->out_len);
+    while (n->out_sent < chunks && n->out_sent < n->out_next + DIST_WINDOW)
+    {
+        off = n->out_sent * DIST_CHUNK;
+        len = n->out_len - off;
+        if (len > DIST_CHUNK)
+            len = DIST_CHUNK;
+        n->tx_buf[DIST_HEADER_SIZE] = n->status;
+        dist_put_u32(n->tx_buf, DIST_HEADER_SIZE + 1, n->out_len);
+        if (len > 0)
+            memcpy(n->tx_buf + DIST_HEADER_SIZE + 5, n->out + off, len);
+        dist_node_send(n, DIST_OP_OUTPUT, n->id, n->out_sent, 5 + len);
+        n->out_sent++;
+        n->sent_at = dist_now();
+    }
+}
+
+int dist_worker_run(int app_id, dist_task_fn fn, void *ctx)
+{
+    dist_node_t *n;
+    unsigned int now;
+    int len;
+    int done;
+    int idle;
+
+    fnp_init();
+
+    n = &dist_self;
+    n->app_id = app_id & 0xFFFF;
+    n->have_coord = 0;
+    n->id = -1;
+    n->done_id = -1;
+    n->state = DIST_W_IDLE;
+    n->in = 0;
+    n->out = 0;
+    n->bye = 0;
+    n->last_beat = dist_now();
+    n->last_join = dist_now();
+
+    /* Announce ourselves in case the coordinator is already running. */
+    dist_send(dist_bcast_mac, DIST_OP_JOIN, n->app_id, 0, n->tx_buf, 0,
+              n->frame_buf);
+
+    done = 0;
+    while (!n->bye)
+    {
+        idle = 1;
+        while (sys_net_packet_count() > 0)
+        {
+            len = sys_net_recv(n->frame_buf, FNP_FRAME_BUF_SIZE);
+            if (len > 0)
+                dist_node_frame(n, n->frame_buf, len);
+            idle = 0;
+        }
+        if (n->bye)
+            break;
+        if (sys_get_key_state() & KEYSTATE_ESCAPE)
+            break;
+
+        now = dist_now();
+        if (!n->have_coord && now - n->last_join > DIST_HELLO_MS * 1000u)
+        {
+            dist_send(dist_bcast_mac, DIST_OP_JOIN, n->app_id, 0, n->tx_buf,
+                      0, n->frame_buf);
+            n->last_join = now;
+        }
+
+        if (n->state == DIST_W_RECV && n->in_next == dist_chunks(n->in_total))
+        {
+            /* Frames that arrive meanwhile wait in the receive ring; a
+             * CANCEL among them is seen before the result goes out. */
+            n->out = 0;
+            n->out_len = 0;
+            n->status = fn(n->in, n->in_total, &n->out, &n->out_len, ctx);
+            free(n->in);
+            n->in = 0;
+            n->state = DIST_W_SEND;
+            n->out_next = 0;
+            n->out_sent = 0;
+            n->sent_at = 0;
+            n->last_heard = dist_now();
+            done++;
+            continue;
+        }
+
+        if (n->state == DIST_W_SEND)
+        {
+            if (now - n->sent_at > DIST_RETRY_MS * 1000u)
+                n->out_sent = n->out_next;
+            dist_pump_output(n);
+        }
+        if (n->state != DIST_W_IDLE &&
+            now - n->last_heard > DIST_XFER_TIMEOUT_MS * 1000u)
+        {
+            /* The coordinator is gone or gave the task to someone else. */
+            dist_node_reset(n);
+            dist_idle_beat(n);
+        }
+
+        if (n->state == DIST_W_IDLE &&
+            dist_now() - n->last_beat > DIST_IDLE_MS * 1000u)
+            dist_idle_beat(n);
+        if (idle)
+            sys_sleep(1);
+    }
+    dist_node_reset(n);
+    return done;
+}
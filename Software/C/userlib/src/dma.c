@@ -3,6 +3,7 @@
  */
 
 #include <dma.h>
+#include <syscall.h>
 
 int
 dma_busy(void)
@@ -62,3 +63,58 @@ dma_blit_to_vram(unsigned int dst, unsigned int src, unsigned int count)
     if (status & FPGC_DMA_STATUS_ERROR) return -1;
     return 0;
 }
+
+int
+dma_blit_rect(unsigned int dst, unsigned int src, unsigned int width,
+              unsigned int rows, unsigned int src_stride,
+              unsigned int dst_stride)
+{
+    unsigned int buf[16];
+    unsigned int *desc;
+    unsigned int status;
+
+    /* One descriptor in a cache-line-aligned slice of the stack. */
+    desc = (unsigned int *)(((unsigned int)buf + 31u) & ~31u);
+    desc[0] = src;
+    desc[1] = dst;
+    desc[2] = width;
+    desc[3] = (unsigned int)FPGC_DMA_MODE_MEM2VRAM | FPGC_DMA_DESC_2D;
+    desc[4] = 0;
+    desc[5] = 0;
+    desc[6] = rows & 0xFFFFu;
+    desc[7] = ((dst_stride & 0xFFFFu) << 16) | (src_stride & 0xFFFFu);
+
+    /* The engine fetches the descriptor from SDRAM. */
+    cache_flush_data();
+    __builtin_store(FPGC_DMA_DESC, (int)desc);
+    __builtin_store(FPGC_DMA_CTRL,
+        (int)(FPGC_DMA_CTRL_START | FPGC_DMA_CTRL_CHAIN));
+    do { status = dma_status(); } while (status & FPGC_DMA_STATUS_BUSY);
+    if (status & FPGC_DMA_STATUS_ERROR) return -1;
+    return 0;
+}
+
+int
+dma_submit_async(unsigned int dst, unsigned int src, unsigned int count,
+                 dma_mode_t mode)
+{
+    unsigned int desc[4];
+
+    desc[0] = dst;
+    desc[1] = src;
+    desc[2] = count;
+    desc[3] = (unsigned int)mode;
+    return sys_dma_submit(desc);
+}
+
+int
+dma_wait_async(int handle)
+{
+    return sys_dma_wait(handle, 0);
+}
+
+int
+dma_poll_async(int handle)
+{
+    return sys_dma_wait(handle, 1);
+}
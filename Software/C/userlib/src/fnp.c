@@ -32,7 +32,7 @@ void fnp_init(void)
     int i;
     /* Kernel writes 6 sequential bytes; read into char buffer first,
      * then expand to int array (avoids byte-packing issues). */
-    syscall(SYS_NET_GET_MAC, (int)mac_bytes, 0, 0);
+    sys_net_get_mac((int *)mac_bytes);
     for (i = 0; i < 6; i++)
         fnp_our_mac[i] = mac_bytes[i] & 0xFF;
 }
@@ -0,0 +1,72 @@
+/*
+ * prof.c — Block counting runtime for profile-guided builds.
+ *
+ * See prof.h. Records are linked into a list the first time their
+ * function runs, so the dump only lists code that ran at least once.
+ */
+
+#include <syscall.h>
+#include <prof.h>
+
+static struct prof_rec *prof_list;
+
+void __profenter(struct prof_rec *rec)
+{
+    if (rec->next)
+        return;
+    /* the last record points to itself, so next is never 0 once listed */
+    rec->next = prof_list ? prof_list : rec;
+    prof_list = rec;
+}
+
+static void prof_puts(int fd, const char *s)
+{
+    int n = 0;
+
+    while (s[n])
+        n++;
+    sys_write(fd, s, n);
+}
+
+static void prof_putu(int fd, unsigned int v)
+{
+    char buf[11];
+    int n = sizeof(buf);
+
+    do {
+        buf[--n] = '0' + v % 10;
+        v /= 10;
+    } while (v);
+    sys_write(fd, buf + n, sizeof(buf) - n);
+}
+
+void __profexit(void)
+{
+    struct prof_rec *r;
+    const char *fn, *blk;
+    int fd, i;
+
+    fd = sys_open(PROF_FILE, O_WRONLY | O_CREAT | O_TRUNC);
+    if (fd < 0)
+        fd = STDOUT_FD;
+    for (r = prof_list; r; r = r->next == r ? 0 : r->next) {
+        fn = r->names;
+        blk = fn;
+        while (*blk)
+            blk++;
+        blk++;
+        for (i = 0; i < r->nblk; i++) {
+            prof_puts(fd, fn);
+            prof_puts(fd, " ");
+            prof_puts(fd, blk);
+            prof_puts(fd, " ");
+            prof_putu(fd, r->cnt[i]);
+            prof_puts(fd, "\n");
+            while (*blk)
+                blk++;
+            blk++;
+        }
+    }
+    if (fd != STDOUT_FD)
+        sys_close(fd);
+}
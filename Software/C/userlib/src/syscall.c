@@ -106,6 +106,11 @@ int  sys_net_recv        (char *buf, int max_len) { return syscall(SYS_NET_RECV,
 int  sys_net_packet_count(void)                   { return syscall(SYS_NET_PACKET_COUNT, 0, 0, 0); }
 void sys_net_get_mac     (int *mac_buf)           { syscall(SYS_NET_GET_MAC, (int)mac_buf, 0, 0); }
 
+/* ---- DMA ---- */
+
+int sys_dma_submit(const unsigned int *desc) { return syscall(SYS_DMA_SUBMIT, (int)desc, 0, 0); }
+int sys_dma_wait  (int handle, int flags)    { return syscall(SYS_DMA_WAIT,   handle, flags, 0); }
+
 /* ---- TTY event helpers ---- */
 
 int sys_tty_open_raw(int nonblocking)
@@ -7,16 +7,17 @@
 ; Result is returned in r1.
 ;
 ; NOTE: Uses the software stack (r13) instead of the hardware stack
-; to save registers.  The HW stack is reserved for the kernel's
-; context_enter/return mechanism.  Any user HW stack entries would
-; interfere with blocking syscall support (Phase 3+).
+; to save registers.  The HW stack holds the groups of code compiled
+; with QBE -H (see Software/ASM/crt0/hwstack.asm), and syscall is a
+; leaf in that scheme.  The kernel saves the user's HW stack entries
+; when a syscall blocks.
 
 .text
 
 syscall:
     ; r4=num, r5=a1, r6=a2, r7=a3 already in place from caller
     ; r15 = return address to our caller
-    ; Save r15 and r11 to software stack (not HW stack!)
+    ; Save r15 and r11 to software stack
     sub r13 8 r13               ; allocate 2 words on software stack
     write 4 r13 r15             ; save caller's return address
     write 0 r13 r11             ; save callee-saved r11
@@ -0,0 +1,16 @@
+// call_chain.c with its helpers kept out of line, so the calls are not inlined
+__attribute__((noinline))
+int double_it(int x) {
+    return x * 2;
+}
+
+__attribute__((noinline))
+int add_one(int x) {
+    return x + 1;
+}
+
+int main(void) {
+    return add_one(double_it(3)); // expected=0x07
+}
+
+void interrupt(void) {}
@@ -0,0 +1,11 @@
+// call_simple.c with its helpers kept out of line, so the calls are not inlined
+__attribute__((noinline))
+int add(int a, int b) {
+    return a + b;
+}
+
+int main(void) {
+    return add(3, 4); // expected=0x07
+}
+
+void interrupt(void) {}
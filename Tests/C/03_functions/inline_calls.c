@@ -0,0 +1,42 @@
+// Calls into small functions that QBE copies into the caller
+static int square(int x) {
+    return x * x;
+}
+
+static inline int clamp(int x, int lo, int hi) {
+    if (x < lo)
+        return lo;
+    if (x > hi)
+        return hi;
+    return x;
+}
+
+static void bump(int *p) {
+    *p = *p + 1;
+}
+
+static inline int sum_pair(int a, int b) {
+    int t[2];
+    t[0] = a;
+    t[1] = b;
+    return t[0] + t[1];
+}
+
+int fact(int n) {
+    if (n <= 1)
+        return 1;
+    return n * fact(n - 1);
+}
+
+int main(void) {
+    int i;
+    int acc = 0;
+    for (i = 0; i < 4; i++) {
+        acc = acc + clamp(square(i), 1, 5);
+        bump(&acc);
+    }
+    // 1 + 1 + 4 + 5 + 4 bumps = 15, + 3 + 24
+    return sum_pair(acc, 3) + fact(4); // expected=0x2A
+}
+
+void interrupt(void) {}
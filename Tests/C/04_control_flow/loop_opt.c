@@ -0,0 +1,64 @@
+// Loops that QBE -O2 hoists from, strength-reduces and unrolls
+// compile_flags=-O2
+int g[40];
+short h[40];
+
+int down(void) {
+    int s = 0;
+    for (int i = 10; i > 0; i--)
+        s += g[i] * i;
+    return s;
+}
+
+int stride(void) {
+    int s = 0;
+    for (int i = 0; i != 12; i += 3)
+        s += h[i];
+    return s;
+}
+
+int nested(int n) {
+    int s = 0;
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < 3; j++)
+            s += g[i * 3 + j] - h[j * 5 + i];
+    return s;
+}
+
+int early_exit(void) {
+    int s = 0;
+    for (int i = 0; i < 6; i++) {
+        if (g[i] > 20)
+            break;
+        if (i == 2)
+            continue;
+        s += g[i];
+    }
+    return s;
+}
+
+int scaled(int k) {
+    int s = 0;
+    for (int i = 0; i < 5; i++)
+        s += (i * k + 7) * g[i + k];
+    return s;
+}
+
+int fill(char *d) {
+    for (int i = 0; i < 8; i++)
+        d[i * 4] = i;
+    return d[12] + d[28];
+}
+
+int main(void) {
+    char buf[32];
+    for (int i = 0; i < 40; i++) {
+        g[i] = i * 5 - 7;
+        h[i] = (short)(100 - i * 3);
+    }
+    // 1540 + 346 - 720 + 30 + 815 + 10 = 2021 = 0x7E5
+    int s = down() + stride() + nested(4) + early_exit() + scaled(2) + fill(buf);
+    return s & 0xFF; // expected=0xE5
+}
+
+void interrupt(void) {}
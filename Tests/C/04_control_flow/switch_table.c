@@ -0,0 +1,26 @@
+// Dense cases go through a jump table, sparse ones through compares
+int classify(int x) {
+    switch (x) {
+    case -2: return 1;
+    case 0: return 2;
+    case 1: return 3;
+    case 2: return 4;
+    case 4: return 5;
+    case 5: return 6;
+    case 7: return 7;
+    case 1000: return 8;
+    default: return 0;
+    }
+}
+
+int main(void) {
+    int sum = 0;
+    for (int i = -4; i < 10; i++) {
+        sum += classify(i);
+    }
+    sum += classify(1000) + classify(999) + classify(-2147483647 - 1);
+    // 1+2+3+4+5+6+7 + 8 = 36
+    return sum; // expected=0x24
+}
+
+void interrupt(void) {}
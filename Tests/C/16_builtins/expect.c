@@ -0,0 +1,28 @@
+/* Test __builtin_expect.
+ * The value is passed through unchanged and folds in constant
+ * expressions; QBE moves the unlikely paths out of line. */
+
+#define likely(x) __builtin_expect(!!(x), 1)
+#define unlikely(x) __builtin_expect(!!(x), 0)
+
+int a[8] = {3, -1, 4, 1, -5, 9, 2, -6};
+
+int sum(int n) {
+    int s = 0;
+    for (int i = 0; likely(i < n); i++) {
+        if (unlikely(a[i] < 0))
+            s -= 2 * a[i];
+        else
+            s += a[i];
+    }
+    return s;
+}
+
+int main(void) {
+    int k[__builtin_expect(2, 0)];
+    k[0] = __builtin_expect(sum(8) + 1, 0); /* 19 + 24 + 1 */
+    k[1] = unlikely(k[0] == 44) ? 1 : 0;
+    return k[0] + k[1]; // expected=0x2D
+}
+
+void interrupt(void) {}
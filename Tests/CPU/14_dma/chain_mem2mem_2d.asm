@@ -0,0 +1,112 @@
+; Test: DMA descriptor chain (MEM2MEM + 2D MEM2MEM)
+;
+; Verifies the DMAengine chain mode (DMA_CTRL.CHAIN, bit 8):
+;   - the engine fetches descriptors from SDRAM starting at DMA_DESC;
+;   - descriptor A (0x2000) copies 64 bytes 0x1000 -> 0x1400 and has its
+;     per-descriptor IRQ bit set, so STATUS.desc (bit 3) becomes sticky;
+;   - descriptor A links to descriptor B (0x2020), a 2D MEM2MEM with
+;     2 rows of 32 bytes, src stride 32, dst stride 64:
+;       row 0: 0x1000 -> 0x1800, row 1: 0x1020 -> 0x1840;
+;     the 32-byte gap at 0x1820 must keep its sentinel;
+;   - B has next=0 so the chain ends with sticky done and DMA_DESC_CUR
+;     left pointing at B.
+;
+; Source words are 1..16, so:
+;   status (done|desc)      = 10
+;   [0x1400] = 1, [0x1438] = 15    (descriptor A, words 0 and 14)
+;   [0x1800] = 1, [0x185C] = 16    (descriptor B, row 0 word 0 / row 1 word 7)
+;   [0x1820] = 0x55                (untouched gap)
+;   DMA_DESC_CUR >> 5       = 0x101
+;
+; r15 = 10 + 1 + 15 + 1 + 16 + 85 + 257 = 385
+;
+; expected=385
+
+Main:
+    ; --- 1) Source: 16 words with values 1..16 at 0x1000 ---
+    load32 0x1000 r1
+    load 1 r2
+    load 17 r3
+FillSrc:
+    write 0 r1 r2
+    add r1 4 r1
+    add r2 1 r2
+    bne r2 r3 FillSrc
+
+    ; --- 2) Sentinel in the 2D gap ---
+    load32 0x1820 r1
+    load 0x55 r2
+    write 0 r1 r2
+
+    ; --- 3) Descriptor A at 0x2000: MEM2MEM 64 bytes, irq, next = B ---
+    load32 0x2000 r4
+    load32 0x1000 r2
+    write 0  r4 r2            ; w0 src
+    load32 0x1400 r2
+    write 4  r4 r2            ; w1 dst
+    load 64 r2
+    write 8  r4 r2            ; w2 count
+    load 0x10 r2
+    write 12 r4 r2            ; w3 ctrl: MEM2MEM | desc irq
+    load32 0x2020 r2
+    write 16 r4 r2            ; w4 next
+    write 20 r4 r0            ; w5 qspi_addr (unused)
+    write 24 r4 r0            ; w6 rows (unused)
+    write 28 r4 r0            ; w7 strides (unused)
+
+    ; --- 4) Descriptor B at 0x2020: 2D MEM2MEM, 2 rows x 32 bytes ---
+    load32 0x2020 r4
+    load32 0x1000 r2
+    write 0  r4 r2            ; w0 src
+    load32 0x1800 r2
+    write 4  r4 r2            ; w1 dst
+    load 32 r2
+    write 8  r4 r2            ; w2 count (bytes per row)
+    load32 0x100 r2
+    write 12 r4 r2            ; w3 ctrl: MEM2MEM | 2D
+    write 16 r4 r0            ; w4 next = 0 (end of list)
+    write 20 r4 r0            ; w5 qspi_addr (unused)
+    load 2 r2
+    write 24 r4 r2            ; w6 rows = 2
+    load32 0x00400020 r2
+    write 28 r4 r2            ; w7 dst stride 64 | src stride 32
+
+    ; --- 5) Descriptors and source must be in SDRAM before the fetch ---
+    ccached
+
+    ; --- 6) Start the chain ---
+    load32 0x1C000070 r5      ; DMA register block base (SRC)
+    load32 0x2000 r2
+    write 0x18 r5 r2          ; DMA_DESC = descriptor A
+    load32 0x80000100 r2
+    write 12 r5 r2            ; DMA_CTRL = start | chain
+
+    load 1 r8
+Poll:
+    read 16 r5 r9
+    and r9 r8 r10
+    bne r10 r0 Poll
+
+    ; --- 7) Invalidate L1d and read back ---
+    ccached
+    or r9 r0 r15              ; status
+
+    load32 0x1400 r1
+    read 0  r1 r2
+    add r15 r2 r15
+    read 0x38 r1 r2
+    add r15 r2 r15
+
+    load32 0x1800 r1
+    read 0  r1 r2
+    add r15 r2 r15
+    read 0x5C r1 r2
+    add r15 r2 r15
+    read 0x20 r1 r2
+    add r15 r2 r15
+
+    read 0x1C r5 r2           ; DMA_DESC_CUR
+    shiftr r2 5 r2
+    add r15 r2 r15
+
+    halt
@@ -0,0 +1,98 @@
+; Test: DMA 2D MEM2VRAM rectangle blit through a descriptor chain
+;
+; Verifies the 2D stride mode of the DMAengine chain (descriptor ctrl
+; bit 8) on the VRAMPX path:
+;   - a single-descriptor chain blits a 64x4 pixel rectangle from a packed
+;     SDRAM buffer (src stride 64) into the 320-byte-wide framebuffer
+;     (dst stride 320); every row is range-checked on its own, so the
+;     chain completes with STATUS = done (2);
+;   - a second chain places a 2-row rectangle on the last framebuffer row,
+;     so row 1 starts at 0x1EC20000 (one past VRAMPX). The engine must
+;     stop with STATUS = error (4) and leave DMA_DESC_CUR on that
+;     descriptor (0x2040, >> 5 = 0x102).
+;
+; VRAMPX is write-only from the CPU side, so only STATUS and DESC_CUR
+; are checked.
+;
+; r15 = ((good << 4) | bad) + (DESC_CUR >> 5) = 0x24 + 0x102 = 294
+;
+; expected=294
+
+Main:
+    ; --- 1) Source rectangle: 256 bytes at 0x1000 ---
+    load32 0x1000 r1
+    load32 0x1100 r3
+    load32 0x01020304 r2
+FillSrc:
+    write 0 r1 r2
+    add r1 4 r1
+    bne r1 r3 FillSrc
+
+    ; --- 2) Descriptor at 0x2000: 2D MEM2VRAM 64 x 4 rows ---
+    load32 0x2000 r4
+    load32 0x1000 r2
+    write 0  r4 r2            ; w0 src
+    load32 0x1EC00A00 r2
+    write 4  r4 r2            ; w1 dst (row 8, x = 0)
+    load 64 r2
+    write 8  r4 r2            ; w2 count (bytes per row)
+    load32 0x103 r2
+    write 12 r4 r2            ; w3 ctrl: MEM2VRAM | 2D
+    write 16 r4 r0            ; w4 next = 0
+    write 20 r4 r0            ; w5 qspi_addr (unused)
+    load 4 r2
+    write 24 r4 r2            ; w6 rows = 4
+    load32 0x01400040 r2
+    write 28 r4 r2            ; w7 dst stride 320 | src stride 64
+
+    ; --- 3) Descriptor at 0x2040: 2D MEM2VRAM running off the end ---
+    load32 0x2040 r4
+    load32 0x1000 r2
+    write 0  r4 r2            ; w0 src
+    load32 0x1EC1FEC0 r2
+    write 4  r4 r2            ; w1 dst (last framebuffer row)
+    load 64 r2
+    write 8  r4 r2            ; w2 count
+    load32 0x103 r2
+    write 12 r4 r2            ; w3 ctrl: MEM2VRAM | 2D
+    write 16 r4 r0            ; w4 next = 0
+    write 20 r4 r0            ; w5 qspi_addr (unused)
+    load 2 r2
+    write 24 r4 r2            ; w6 rows = 2
+    load32 0x01400040 r2
+    write 28 r4 r2            ; w7 dst stride 320 | src stride 64
+
+    ccached
+
+    load32 0x1C000070 r5      ; DMA register block base (SRC)
+    load 1 r8                 ; busy mask
+    load32 0x80000100 r7      ; CTRL: start | chain
+
+    ; --- 4) Good rectangle ---
+    load32 0x2000 r2
+    write 0x18 r5 r2          ; DMA_DESC
+    write 12 r5 r7
+PollGood:
+    read 16 r5 r9
+    and r9 r8 r10
+    bne r10 r0 PollGood
+    or r9 r0 r12
+
+    ; --- 5) Rectangle crossing the end of VRAMPX ---
+    load32 0x2040 r2
+    write 0x18 r5 r2          ; DMA_DESC
+    write 12 r5 r7
+PollBad:
+    read 16 r5 r9
+    and r9 r8 r10
+    bne r10 r0 PollBad
+    or r9 r0 r13
+
+    ; --- 6) Pack ---
+    shiftl r12 4 r12
+    or r12 r13 r15
+    read 0x1C r5 r2           ; DMA_DESC_CUR
+    shiftr r2 5 r2
+    add r15 r2 r15
+
+    halt
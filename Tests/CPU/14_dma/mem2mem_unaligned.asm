@@ -0,0 +1,76 @@
+; Test: DMA MEM2MEM unaligned copy (byte-granular head/tail)
+;
+; Copies 45 bytes from 0x1003 to 0x2005, so source and destination have
+; different line offsets and both the first and the last destination
+; line are partial:
+;   - the engine must shift bytes between the two offsets;
+;   - the bytes outside [0x2005, 0x2032) must keep their sentinel 0x55
+;     (read-modify-write of the head and tail lines).
+;
+; Source byte 0x1000 + k holds k, so:
+;   [0x2004] = 0x05040355   (sentinel, then source bytes 3, 4, 5)
+;   [0x2030] = 0x55552F2E   (source bytes 0x2E, 0x2F, then sentinel)
+;   [0x2000] and [0x2034] stay 0x55555555, STATUS = done (2)
+;
+; r15 = ([0x2004] ^ [0x2030]) + status = 0x50512C7B + 2 = 1347497085, or
+; 0 when a sentinel word was overwritten.
+;
+; expected=1347497085
+
+Main:
+    ; --- 1) Source bytes 0..63 at 0x1000 ---
+    load32 0x1000 r1
+    load32 0x1040 r3
+    load32 0x03020100 r2
+    load32 0x04040404 r4
+FillSrc:
+    write 0 r1 r2
+    add r1 4 r1
+    add r2 r4 r2
+    bne r1 r3 FillSrc
+
+    ; --- 2) Sentinel 0x55 over two destination lines ---
+    load32 0x2000 r1
+    load32 0x2040 r3
+    load32 0x55555555 r2
+FillDst:
+    write 0 r1 r2
+    add r1 4 r1
+    bne r1 r3 FillDst
+
+    ccached
+
+    ; --- 3) MEM2MEM 0x1003 -> 0x2005, 45 bytes ---
+    load32 0x1C000070 r5      ; DMA register block base (SRC)
+    load32 0x1003 r1
+    write 0  r5 r1            ; DMA_SRC
+    load32 0x2005 r1
+    write 4  r5 r1            ; DMA_DST
+    load 45 r1
+    write 8  r5 r1            ; DMA_COUNT
+    load32 0x80000000 r1
+    write 12 r5 r1            ; CTRL: start | MEM2MEM
+
+    load 1 r8
+Poll:
+    read 16 r5 r9
+    and r9 r8 r10
+    bne r10 r0 Poll
+
+    ; --- 4) Invalidate L1d and read back ---
+    ccached
+    load32 0x2000 r1
+    load32 0x55555555 r2
+    load 0 r15
+    read 0 r1 r12
+    bne r12 r2 Done           ; head line: bytes before the window
+    read 0x34 r1 r12
+    bne r12 r2 Done           ; tail line: bytes after the window
+
+    read 4 r1 r12
+    read 0x30 r1 r13
+    xor r12 r13 r15
+    add r15 r9 r15
+
+Done:
+    halt
@@ -10,9 +10,9 @@
 ; transfer, reading STATUS once must return {error=0, done=1, busy=0} = 2.
 ; A second STATUS read returns 0 because the sticky bits self-clear on read.
 ;
-; Then we exercise the alignment-validation path: a transfer with count=33
-; (not a multiple of 32) must complete immediately with error=1, so STATUS
-; reads back as 4 (sticky_error=1, sticky_done=0, busy=0).
+; Then we exercise the argument-validation path: a transfer with count=0
+; must complete immediately with error=1, so STATUS reads back as 4
+; (sticky_error=1, sticky_done=0, busy=0).
 ;
 ; r15 = (good_status << 4) | bad_status = 0x24 = 36.
 ;
@@ -58,9 +58,8 @@ PollGood:
     ; --- 5) r9 holds the good STATUS (done=1, error=0, busy=0) = 2 ---
     or r9 r0 r12
 
-    ; --- 6) Now trigger an alignment error: count=33 with same dst ---
-    load 33 r6
-    write 8  r5 r6            ; DMA_COUNT = 33 (not 32-aligned)
+    ; --- 6) Now trigger a validation error: count=0 with same dst ---
+    write 8  r5 r0            ; DMA_COUNT = 0
     write 0  r5 r1            ; DMA_SRC   = 0x1000 (defensive)
     write 4  r5 r2            ; DMA_DST   = 0x1EC00000
     load32 0x80000003 r7
@@ -0,0 +1,407 @@
+/*
+ * Host-side multi-process simulator for the userlib cluster runtime.
+ *
+ * Every simulated FPGC is a process: the parent is the coordinator, each
+ * worker is forked and runs cl_worker_run(). The real fnp.c and cluster.c
+ * are linked against a syscall shim in this file that carries raw FNP
+ * frames over AF_UNIX datagram sockets (one per node, addressed by the
+ * last MAC byte; FF:FF:FF:FF:FF:FF goes to every other node). The shim
+ * can drop frames at random, and workers can be made slow or crash, so
+ * the scheduler's recovery paths run without hardware.
+ *
+ * Compile:
+ *   gcc -O0 -Wall -I Software/C/userlib/include \
+ *       Tests/host/cluster_sim.c Software/C/userlib/src/cluster.c \
+ *       Software/C/userlib/src/fnp.c -o /tmp/cluster_sim
+ *
+ * Run: ./cluster_sim <scenario>   (basic, straggler, crash, lossy, late,
+ *      local) — exits 0 on success, nonzero on failure.
+ */
+
+#include "cluster.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define SIM_APP_ID    0x5349
+#define SIM_MAX_NODES (CL_MAX_WORKERS + 1)
+#define SIM_UNITS     40
+#define SIM_FRAGS     4
+#define SIM_FRAG_LEN  100
+#define SIM_JOBS      3
+
+/* ---------------------------------------------------------------- */
+/* Simulated network (syscall shim)                                 */
+/* ---------------------------------------------------------------- */
+
+static char     sim_dir[64];
+static int      sim_nodes;         /* coordinator + workers */
+static int      sim_self;          /* 0 = coordinator */
+static int      sim_fd = -1;
+static int      sim_drop_pct;
+static unsigned sim_rng;
+
+static void
+sim_path(int node, struct sockaddr_un *sa)
+{
+    memset(sa, 0, sizeof(*sa));
+    sa->sun_family = AF_UNIX;
+    snprintf(sa->sun_path, sizeof(sa->sun_path), "%s/n%d", sim_dir, node);
+}
+
+static void
+sim_attach(int node)
+{
+    struct sockaddr_un sa;
+
+    if (sim_fd >= 0)
+        close(sim_fd);
+    sim_self = node;
+    sim_rng = 0x9E3779B9u * (unsigned)(node + 1) ^ (unsigned)getpid();
+    sim_fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    sim_path(node, &sa);
+    unlink(sa.sun_path);
+    if (sim_fd < 0 || bind(sim_fd, (struct sockaddr *)&sa, sizeof(sa)) != 0) {
+        perror("sim bind");
+        exit(2);
+    }
+}
+
+static int
+sim_dropped(void)
+{
+    sim_rng = sim_rng * 1103515245u + 12345u;
+    return sim_drop_pct > 0 && (int)((sim_rng >> 16) % 100) < sim_drop_pct;
+}
+
+static void
+sim_deliver(int node, const char *buf, int len)
+{
+    struct sockaddr_un sa;
+
+    if (node == sim_self || node < 0 || node >= sim_nodes || sim_dropped())
+        return;
+    sim_path(node, &sa);
+    /* Dead or not-yet-started nodes just lose the frame, like a wire. */
+    sendto(sim_fd, buf, (size_t)len, MSG_DONTWAIT, (struct sockaddr *)&sa,
+           sizeof(sa));
+}
+
+int
+sys_net_send(char *buf, int len)
+{
+    int i;
+    int bcast;
+
+    bcast = 1;
+    for (i = 0; i < 6; i++)
+        if ((buf[i] & 0xFF) != 0xFF)
+            bcast = 0;
+
+    if (bcast) {
+        for (i = 0; i < sim_nodes; i++)
+            sim_deliver(i, buf, len);
+    } else {
+        sim_deliver((buf[5] & 0xFF) - 1, buf, len);
+    }
+    return 1;
+}
+
+int
+sys_net_recv(char *buf, int max_len)
+{
+    ssize_t n = recv(sim_fd, buf, (size_t)max_len, MSG_DONTWAIT);
+    return n < 0 ? 0 : (int)n;
+}
+
+int
+sys_net_packet_count(void)
+{
+    char c;
+    return recv(sim_fd, &c, 1, MSG_DONTWAIT | MSG_PEEK) >= 0 ? 1 : 0;
+}
+
+void
+sys_net_get_mac(int *mac_buf)
+{
+    char *b = (char *)mac_buf;
+    b[0] = 0x02; b[1] = (char)0xB4; b[2] = (char)0xB4;
+    b[3] = 0x00; b[4] = 0x00; b[5] = (char)(sim_self + 1);
+}
+
+void
+sys_sleep(int ms)
+{
+    usleep((useconds_t)ms * 1000);
+}
+
+int
+sys_get_time_us(void)
+{
+    /* userlib's time.h shadows <time.h> on the include path, so no
+     * clock_gettime(); wrapping at 32 bits matches the hardware counter. */
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int)(unsigned int)((unsigned long long)tv.tv_sec * 1000000ull
+                               + (unsigned long long)tv.tv_usec);
+}
+
+int
+sys_get_key_state(void)
+{
+    return 0;
+}
+
+/* ---------------------------------------------------------------- */
+/* Workload                                                         */
+/* ---------------------------------------------------------------- */
+
+/* params: [seed (1)] [ms per fragment (1)] */
+static int sim_slowdown = 1;       /* per worker */
+static int sim_crash_after = -1;   /* units before the worker dies */
+static int sim_units_run;
+
+static int
+frag_byte(int seed, int unit, int frag, int k)
+{
+    return (seed + unit * 31 + frag * 7 + k) & 0xFF;
+}
+
+static int
+sim_work(cl_node_t *node, const char *params, int params_len, int unit,
+         void *ctx)
+{
+    char out[SIM_FRAG_LEN];
+    int seed;
+    int ms;
+    int f;
+    int k;
+
+    (void)ctx;
+    if (params_len < 2)
+        return -1;
+    seed = params[0] & 0xFF;
+    ms = params[1] & 0xFF;
+
+    for (f = 0; f < SIM_FRAGS; f++) {
+        if (sim_crash_after >= 0 && sim_units_run >= sim_crash_after && f == 1)
+            _exit(0);  /* power cut halfway through a unit */
+        sys_sleep(ms * sim_slowdown);
+        for (k = 0; k < SIM_FRAG_LEN; k++)
+            out[k] = (char)frag_byte(seed, unit, f, k);
+        if (cl_emit(node, out, SIM_FRAG_LEN) != 0)
+            return -1;
+    }
+    sim_units_run++;
+    return 0;
+}
+
+/* ---------------------------------------------------------------- */
+/* Coordinator side                                                 */
+/* ---------------------------------------------------------------- */
+
+static cl_coord_t coord;
+static int seen[SIM_UNITS][SIM_FRAGS];
+static int bad_results;
+static int cur_seed;
+
+static void
+on_result(int unit, int frag, const char *data, int len, void *ctx)
+{
+    int k;
+
+    (void)ctx;
+    if (unit < 0 || unit >= SIM_UNITS || frag < 0 || frag >= SIM_FRAGS ||
+        len != SIM_FRAG_LEN) {
+        bad_results++;
+        return;
+    }
+    seen[unit][frag]++;
+    for (k = 0; k < len; k++)
+        if ((data[k] & 0xFF) != frag_byte(cur_seed, unit, frag, k)) {
+            bad_results++;
+            return;
+        }
+}
+
+static pid_t workers[SIM_MAX_NODES];
+
+static void
+spawn_worker(int node, int slowdown, int crash_after)
+{
+    pid_t pid = fork();
+
+    if (pid < 0) {
+        perror("fork");
+        exit(2);
+    }
+    if (pid == 0) {
+        prctl(PR_SET_PDEATHSIG, SIGKILL);
+        sim_attach(node);
+        sim_slowdown = slowdown;
+        sim_crash_after = crash_after;
+        cl_worker_run(SIM_APP_ID, sim_work, NULL);
+        _exit(0);
+    }
+    workers[node] = pid;
+}
+
+static void
+reap_workers(void)
+{
+    int i;
+    int tries;
+
+    /* BYE may have been dropped: give them a moment, then kill. */
+    for (tries = 0; tries < 50; tries++) {
+        int left = 0;
+        for (i = 1; i < sim_nodes; i++)
+            if (workers[i] > 0) {
+                if (waitpid(workers[i], NULL, WNOHANG) == workers[i])
+                    workers[i] = 0;
+                else
+                    left++;
+            }
+        if (!left)
+            break;
+        usleep(10000);
+    }
+    for (i = 1; i < sim_nodes; i++)
+        if (workers[i] > 0) {
+            kill(workers[i], SIGKILL);
+            waitpid(workers[i], NULL, 0);
+            workers[i] = 0;
+        }
+}
+
+static int
+run_job(int seed, int ms, int timeout_ms)
+{
+    char params[2];
+    int u;
+    int f;
+    int ok;
+
+    memset(seen, 0, sizeof(seen));
+    cur_seed = seed;
+    params[0] = (char)seed;
+    params[1] = (char)ms;
+
+    if (cl_coord_start(&coord, params, 2, SIM_UNITS, on_result, NULL) != 0)
+        return 0;
+    ok = cl_coord_run(&coord, timeout_ms);
+
+    for (u = 0; u < SIM_UNITS; u++)
+        for (f = 0; f < SIM_FRAGS; f++)
+            if (seen[u][f] != 1)
+                ok = 0;
+    return ok && bad_results == 0;
+}
+
+static void
+print_stats(const char *name, int ok, int elapsed_ms)
+{
+    printf("%-9s %s  %4d ms  workers=%d units=%d redispatched=%d stolen=%d "
+           "requeued=%d duplicates=%d local=%d job_frames=%d "
+           "job_repairs=%d\n",
+           name, ok ? "PASS" : "FAIL", elapsed_ms,
+           cl_coord_live_workers(&coord), coord.stats.units,
+           coord.stats.redispatched, coord.stats.stolen,
+           coord.stats.requeued, coord.stats.duplicates,
+           coord.stats.local_units, coord.stats.job_frames,
+           coord.stats.job_repairs);
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *scenario = argc > 1 ? argv[1] : "basic";
+    int n_workers = 4;
+    int ok = 1;
+    int j;
+    unsigned t0;
+
+    snprintf(sim_dir, sizeof(sim_dir), "/tmp/clsimXXXXXX");
+    if (!mkdtemp(sim_dir)) {
+        perror("mkdtemp");
+        return 2;
+    }
+
+    if (strcmp(scenario, "local") == 0)
+        n_workers = 0;
+    sim_nodes = n_workers + 1;
+    if (strcmp(scenario, "late") == 0)
+        sim_nodes = 2;
+    if (strcmp(scenario, "lossy") == 0)
+        sim_drop_pct = 10;
+
+    sim_attach(0);
+    for (j = 1; j <= n_workers && strcmp(scenario, "late") != 0; j++) {
+        int slow = (strcmp(scenario, "straggler") == 0 && j == 1) ? 20 : 1;
+        int crash = (strcmp(scenario, "crash") == 0 && j == 2) ? 3 : -1;
+        spawn_worker(j, slow, crash);
+    }
+
+    cl_coord_init(&coord, SIM_APP_ID);
+    if (strcmp(scenario, "local") == 0)
+        cl_coord_set_local(&coord, sim_work);
+
+    t0 = (unsigned)sys_get_time_us();
+    if (strcmp(scenario, "late") == 0) {
+        /* Nobody answers the first HELLO; the worker starts mid-job. */
+        ok = cl_coord_discover(&coord, 100) == 0;
+        cl_coord_start(&coord, "\x05\x02", 2, SIM_UNITS, on_result, NULL);
+        cur_seed = 5;
+        cl_coord_run(&coord, 200);
+        ok = ok && coord.units_done == 0;
+        spawn_worker(1, 1, -1);
+        ok = ok && cl_coord_run(&coord, 20000);
+        for (j = 0; j < SIM_UNITS * SIM_FRAGS; j++)
+            if (seen[j / SIM_FRAGS][j % SIM_FRAGS] != 1)
+                ok = 0;
+        ok = ok && bad_results == 0;
+    } else {
+        cl_coord_discover(&coord, 300);
+        if (cl_coord_live_workers(&coord) != n_workers &&
+            strcmp(scenario, "lossy") != 0) {
+            printf("discovery found %d of %d workers\n",
+                   cl_coord_live_workers(&coord), n_workers);
+            ok = 0;
+        }
+        for (j = 0; j < SIM_JOBS && ok; j++)
+            ok = run_job(j * 17 + 1, 2, 20000);
+    }
+
+    print_stats(scenario, ok,
+                (int)(((unsigned)sys_get_time_us() - t0) / 1000u));
+
+    if (ok && strcmp(scenario, "straggler") == 0)
+        ok = coord.stats.stolen + coord.stats.redispatched > 0;
+    if (ok && strcmp(scenario, "crash") == 0)
+        ok = coord.stats.requeued + coord.stats.redispatched > 0;
+    if (ok && strcmp(scenario, "local") == 0)
+        ok = coord.stats.local_units == SIM_UNITS * SIM_JOBS;
+    /* Without loss the parameters cost one broadcast per job. */
+    if (ok && strcmp(scenario, "basic") == 0)
+        ok = coord.stats.job_frames == SIM_JOBS;
+
+    cl_coord_shutdown(&coord);
+    reap_workers();
+
+    for (j = 0; j < sim_nodes; j++) {
+        struct sockaddr_un sa;
+        sim_path(j, &sa);
+        unlink(sa.sun_path);
+    }
+    rmdir(sim_dir);
+    return ok ? 0 : 1;
+}
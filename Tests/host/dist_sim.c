@@ -0,0 +1,451 @@
+/*
+ * Host-side multi-process simulator for the userlib dist runtime, running
+ * the compile workload of `cc -dist`.
+ *
+ * Every simulated FPGC is a process: the parent is the coordinator, each
+ * worker is forked and runs dist_worker_run(). The real fnp.c and dist.c
+ * are linked against a syscall shim in this file that carries raw FNP
+ * frames over AF_UNIX datagram sockets (one per node, addressed by the
+ * last MAC byte; FF:FF:FF:FF:FF:FF goes to every other node), as in
+ * cluster_sim.c. The shim can drop frames at random, and workers can be
+ * slow, crash halfway through a task or start late.
+ *
+ * A task is a preprocessed C file; the task function pipes it through the
+ * host cproc and qbe, as `cc -serve` runs them on a worker. The
+ * coordinator compiles every file locally as well and checks that each
+ * distributed result is identical.
+ *
+ * Compile:
+ *   gcc -O0 -Wall -I Software/C/userlib/include \
+ *       Tests/host/dist_sim.c Software/C/userlib/src/dist.c \
+ *       Software/C/userlib/src/fnp.c -o /tmp/dist_sim
+ *
+ * Run: ./dist_sim <scenario> <cproc> <qbe> <file.i>...
+ *      (basic, straggler, crash, lossy, late, local, error) — exits 0 on
+ *      success, nonzero on failure.
+ */
+
+#include "dist.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define SIM_APP_ID    0x4343
+#define SIM_MAX_NODES (DIST_MAX_WORKERS + 1)
+#define SIM_WORKERS   4
+
+/* ---------------------------------------------------------------- */
+/* Simulated network (syscall shim)                                 */
+/* ---------------------------------------------------------------- */
+
+static char     sim_dir[64];
+static int      sim_nodes;         /* coordinator + workers */
+static int      sim_self;          /* 0 = coordinator */
+static int      sim_fd = -1;
+static int      sim_drop_pct;
+static unsigned sim_rng;
+
+static void
+sim_path(int node, struct sockaddr_un *sa)
+{
+    memset(sa, 0, sizeof(*sa));
+    sa->sun_family = AF_UNIX;
+    snprintf(sa->sun_path, sizeof(sa->sun_path), "%s/n%d", sim_dir, node);
+}
+
+static void
+sim_attach(int node)
+{
+    struct sockaddr_un sa;
+
+    if (sim_fd >= 0)
+        close(sim_fd);
+    sim_self = node;
+    sim_rng = 0x9E3779B9u * (unsigned)(node + 1) ^ (unsigned)getpid();
+    sim_fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    sim_path(node, &sa);
+    unlink(sa.sun_path);
+    if (sim_fd < 0 || bind(sim_fd, (struct sockaddr *)&sa, sizeof(sa)) != 0) {
+        perror("sim bind");
+        exit(2);
+    }
+}
+
+static int
+sim_dropped(void)
+{
+    sim_rng = sim_rng * 1103515245u + 12345u;
+    return sim_drop_pct > 0 && (int)((sim_rng >> 16) % 100) < sim_drop_pct;
+}
+
+static void
+sim_deliver(int node, const char *buf, int len)
+{
+    struct sockaddr_un sa;
+
+    if (node == sim_self || node < 0 || node >= sim_nodes || sim_dropped())
+        return;
+    sim_path(node, &sa);
+    /* Dead or not-yet-started nodes just lose the frame, like a wire, and
+     * so does a full socket queue, like a full receive ring. */
+    sendto(sim_fd, buf, (size_t)len, MSG_DONTWAIT, (struct sockaddr *)&sa,
+           sizeof(sa));
+}
+
+int
+sys_net_send(char *buf, int len)
+{
+    int i;
+    int bcast;
+
+    bcast = 1;
+    for (i = 0; i < 6; i++)
+        if ((buf[i] & 0xFF) != 0xFF)
+            bcast = 0;
+
+    if (bcast) {
+        for (i = 0; i < sim_nodes; i++)
+            sim_deliver(i, buf, len);
+    } else {
+        sim_deliver((buf[5] & 0xFF) - 1, buf, len);
+    }
+    return 1;
+}
+
+int
+sys_net_recv(char *buf, int max_len)
+{
+    ssize_t n = recv(sim_fd, buf, (size_t)max_len, MSG_DONTWAIT);
+    return n < 0 ? 0 : (int)n;
+}
+
+int
+sys_net_packet_count(void)
+{
+    char c;
+    return recv(sim_fd, &c, 1, MSG_DONTWAIT | MSG_PEEK) >= 0 ? 1 : 0;
+}
+
+void
+sys_net_get_mac(int *mac_buf)
+{
+    char *b = (char *)mac_buf;
+    b[0] = 0x02; b[1] = (char)0xB4; b[2] = (char)0xB4;
+    b[3] = 0x00; b[4] = 0x00; b[5] = (char)(sim_self + 1);
+}
+
+void
+sys_sleep(int ms)
+{
+    usleep((useconds_t)ms * 1000);
+}
+
+int
+sys_get_time_us(void)
+{
+    /* userlib's time.h shadows <time.h> on the include path, so no
+     * clock_gettime(); wrapping at 32 bits matches the hardware counter. */
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int)(unsigned int)((unsigned long long)tv.tv_sec * 1000000ull
+                               + (unsigned long long)tv.tv_usec);
+}
+
+int
+sys_get_key_state(void)
+{
+    return 0;
+}
+
+/* ---------------------------------------------------------------- */
+/* Workload: cproc + qbe                                            */
+/* ---------------------------------------------------------------- */
+
+static const char *sim_cproc;
+static const char *sim_qbe;
+static int sim_slow_ms;            /* per task, per worker */
+static int sim_crash_at = -1;      /* task count at which the worker dies */
+static int sim_tasks_run;
+
+static char *
+read_file(const char *path, int *len)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf;
+    long n;
+
+    if (!f)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc((size_t)n + 1);
+    if (buf && fread(buf, 1, (size_t)n, f) != (size_t)n) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    *len = (int)n;
+    return buf;
+}
+
+/* cc -serve's task: cproc and qbe over the preprocessed source; on
+ * failure the output is the error text. */
+static int
+sim_compile(const char *in, int in_len, char **out, int *out_len, void *ctx)
+{
+    char src[128], asm_out[128], err[128], cmd[1024];
+    FILE *f;
+    int rc;
+
+    (void)ctx;
+    if (sim_crash_at >= 0 && sim_tasks_run >= sim_crash_at)
+        _exit(0);  /* power cut halfway through a task */
+    sim_tasks_run++;
+    if (sim_slow_ms)
+        usleep((useconds_t)sim_slow_ms * 1000);
+
+    snprintf(src, sizeof(src), "%s/w%d.i", sim_dir, sim_self);
+    snprintf(asm_out, sizeof(asm_out), "%s/w%d.asm", sim_dir, sim_self);
+    snprintf(err, sizeof(err), "%s/w%d.err", sim_dir, sim_self);
+    f = fopen(src, "wb");
+    if (!f)
+        return 1;
+    fwrite(in, 1, (size_t)in_len, f);
+    fclose(f);
+
+    snprintf(cmd, sizeof(cmd),
+             "bash -o pipefail -c '%s -t b32p3 < %s 2> %s | %s > %s 2>> %s'",
+             sim_cproc, src, err, sim_qbe, asm_out, err);
+    rc = system(cmd) != 0;
+    *out = read_file(rc ? err : asm_out, out_len);
+    if (!*out)
+        *out_len = 0;
+    return rc;
+}
+
+/* ---------------------------------------------------------------- */
+/* Coordinator side                                                 */
+/* ---------------------------------------------------------------- */
+
+#define SIM_MAX_FILES 64
+
+static dist_coord_t coord;
+static char *src[SIM_MAX_FILES];
+static int src_len[SIM_MAX_FILES];
+static char *want[SIM_MAX_FILES];
+static int want_len[SIM_MAX_FILES];
+static int want_status[SIM_MAX_FILES];
+static int nfiles;
+
+static pid_t workers[SIM_MAX_NODES];
+
+static void
+spawn_worker(int node, int slow_ms, int crash_at)
+{
+    pid_t pid = fork();
+
+    if (pid < 0) {
+        perror("fork");
+        exit(2);
+    }
+    if (pid == 0) {
+        prctl(PR_SET_PDEATHSIG, SIGKILL);
+        sim_attach(node);
+        sim_slow_ms = slow_ms;
+        sim_crash_at = crash_at;
+        dist_worker_run(SIM_APP_ID, sim_compile, NULL);
+        _exit(0);
+    }
+    workers[node] = pid;
+}
+
+static void
+reap_workers(void)
+{
+    int i;
+    int tries;
+
+    /* BYE may have been dropped: give them a moment, then kill. */
+    for (tries = 0; tries < 50; tries++) {
+        int left = 0;
+        for (i = 1; i < sim_nodes; i++)
+            if (workers[i] > 0) {
+                if (waitpid(workers[i], NULL, WNOHANG) == workers[i])
+                    workers[i] = 0;
+                else
+                    left++;
+            }
+        if (!left)
+            break;
+        usleep(10000);
+    }
+    for (i = 1; i < sim_nodes; i++)
+        if (workers[i] > 0) {
+            kill(workers[i], SIGKILL);
+            waitpid(workers[i], NULL, 0);
+            workers[i] = 0;
+        }
+}
+
+/* Every task done once, with the result of a local compile. */
+static int
+check_results(void)
+{
+    int ok = 1;
+    int i;
+
+    if (coord.tasks_done != nfiles)
+        return 0;
+    for (i = 0; i < nfiles; i++) {
+        dist_task_t *t = &coord.tasks[i];
+        if (t->status != want_status[i] ||
+            (t->status == 0 && (t->out_len != want_len[i] ||
+                                memcmp(t->out, want[i], want_len[i]) != 0))) {
+            printf("task %d: status %d (want %d), %d bytes (want %d)\n", i,
+                   t->status, want_status[i], t->out_len, want_len[i]);
+            ok = 0;
+        }
+    }
+    return ok;
+}
+
+static void
+print_stats(const char *name, int ok, int elapsed_ms)
+{
+    printf("%-9s %s  %5d ms  workers=%d tasks=%d dispatched=%d backups=%d "
+           "requeued=%d cancelled=%d local=%d resent=%d in=%d out=%d\n",
+           name, ok ? "PASS" : "FAIL", elapsed_ms,
+           dist_coord_live_workers(&coord), coord.stats.tasks,
+           coord.stats.dispatched, coord.stats.backups,
+           coord.stats.requeued, coord.stats.cancelled,
+           coord.stats.local_tasks, coord.stats.resent,
+           coord.stats.bytes_in, coord.stats.bytes_out);
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *scenario;
+    int n_workers = SIM_WORKERS;
+    int ok = 1;
+    int j;
+    unsigned t0;
+
+    if (argc < 5) {
+        fprintf(stderr, "usage: %s <scenario> <cproc> <qbe> <file.i>...\n",
+                argv[0]);
+        return 2;
+    }
+    scenario = argv[1];
+    sim_cproc = argv[2];
+    sim_qbe = argv[3];
+
+    snprintf(sim_dir, sizeof(sim_dir), "/tmp/dsimXXXXXX");
+    if (!mkdtemp(sim_dir)) {
+        perror("mkdtemp");
+        return 2;
+    }
+
+    for (j = 4; j < argc && nfiles < SIM_MAX_FILES; j++) {
+        src[nfiles] = read_file(argv[j], &src_len[nfiles]);
+        if (!src[nfiles]) {
+            perror(argv[j]);
+            return 2;
+        }
+        nfiles++;
+    }
+    if (strcmp(scenario, "error") == 0) {
+        static char bad[] = "int f( {\n";
+        src[nfiles] = bad;
+        src_len[nfiles] = (int)strlen(bad);
+        nfiles++;
+    }
+
+    /* Reference results, compiled right here */
+    sim_attach(0);
+    for (j = 0; j < nfiles; j++)
+        want_status[j] = sim_compile(src[j], src_len[j], &want[j],
+                                     &want_len[j], NULL);
+    sim_tasks_run = 0;
+
+    if (strcmp(scenario, "local") == 0)
+        n_workers = 0;
+    sim_nodes = n_workers + 1;
+    if (strcmp(scenario, "lossy") == 0)
+        sim_drop_pct = 10;
+
+    for (j = 1; j <= n_workers && strcmp(scenario, "late") != 0; j++) {
+        int slow = (strcmp(scenario, "straggler") == 0 && j == 1) ? 4000 : 0;
+        int crash = (strcmp(scenario, "crash") == 0 && j == 2) ? 0 : -1;
+        spawn_worker(j, slow, crash);
+    }
+
+    dist_coord_init(&coord, SIM_APP_ID);
+    coord.run_timeout_ms = 10000;
+    if (strcmp(scenario, "local") == 0)
+        dist_coord_set_local(&coord, sim_compile, NULL);
+
+    for (j = 0; j < nfiles; j++)
+        dist_coord_add(&coord, src[j], src_len[j]);
+
+    t0 = (unsigned)sys_get_time_us();
+    if (strcmp(scenario, "late") == 0) {
+        /* Nobody answers the first HELLO; workers start mid-build. */
+        ok = dist_coord_discover(&coord, 100) == 0;
+        dist_coord_run(&coord, 200);
+        ok = ok && coord.tasks_done == 0;
+        for (j = 1; j <= n_workers; j++)
+            spawn_worker(j, 0, -1);
+        ok = dist_coord_run(&coord, 60000) && ok;
+    } else {
+        dist_coord_discover(&coord, 300);
+        if (dist_coord_live_workers(&coord) != n_workers &&
+            strcmp(scenario, "lossy") != 0) {
+            printf("discovery found %d of %d workers\n",
+                   dist_coord_live_workers(&coord), n_workers);
+            ok = 0;
+        }
+        ok = dist_coord_run(&coord, 60000) && ok;
+    }
+    ok = ok && check_results();
+
+    print_stats(scenario, ok,
+                (int)(((unsigned)sys_get_time_us() - t0) / 1000u));
+
+    /* Without slow or dead workers each file goes out exactly once. */
+    if (ok && strcmp(scenario, "basic") == 0)
+        ok = coord.stats.dispatched == nfiles;
+    if (ok && strcmp(scenario, "straggler") == 0)
+        ok = coord.stats.backups > 0 && coord.stats.cancelled > 0;
+    if (ok && strcmp(scenario, "crash") == 0)
+        ok = coord.stats.requeued + coord.stats.backups > 0;
+    if (ok && strcmp(scenario, "lossy") == 0)
+        ok = coord.stats.resent > 0;
+    if (ok && strcmp(scenario, "local") == 0)
+        ok = coord.stats.local_tasks == nfiles;
+    if (ok && strcmp(scenario, "error") == 0)
+        ok = coord.tasks[nfiles - 1].status != 0 &&
+             coord.tasks[nfiles - 1].out_len == want_len[nfiles - 1] &&
+             want_len[nfiles - 1] > 0;
+
+    dist_coord_shutdown(&coord);
+    reap_workers();
+
+    {
+        char cmd[128];
+        snprintf(cmd, sizeof(cmd), "rm -rf %s", sim_dir);
+        if (system(cmd) != 0)
+            ok = 0;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+; Test: DMA descriptor chain under repeated IRQ injection.
+;
+; Runs a three-descriptor MEM2MEM chain per iteration while the
+; cpu_irq_inject_tb.v testbench pulses an unrelated interrupt line every
+; IRQ_PERIOD cycles. Completion is IRQ-driven: descriptors 0 and 1 raise
+; a per-descriptor DMA IRQ, DMA_CTRL.IRQ_EN raises one at the end of the
+; list, and the handler raises a flag when STATUS shows done (a flag
+; rather than a counter: a late per-descriptor IRQ may observe the same
+; sticky done as the end-of-list IRQ).
+;
+; Each chain depends on the previous descriptor having finished:
+;   desc 0: src  (0x4000) -> dstA (0x4100), 32 bytes, irq
+;   desc 1: dstA (0x4100) -> dstB (0x4200), 32 bytes, irq
+;   desc 2: dstB (0x4200) -> dstC (0x4300) 2D, 2 rows, src stride 0,
+;           dst stride 64 (so the line also lands at 0x4340)
+; The first source word is rewritten every iteration; both dstC copies
+; must carry it afterwards.
+;
+; Pass: r15 == N (every chain completed in order). Fail: r15 < N (a chain
+; wedged, lost its completion, or ran out of order).
+;
+; Select with: --preset chain (or IRQ_SWEEP_ASM=... IRQ_SWEEP_RAM=1; the
+; CPU only takes interrupts when running from RAM)
+;
+; expected=8
+
+; ===== Boot vectors (PC=0 = jump Start, PC=4 = jump IntH) =====
+    jump Start
+    jump IntH
+
+Start:
+    load32 0x1C000070 r8      ; DMA register block base
+    load32 0x3000 r7          ; completion flag (set by IntH)
+    load 0 r9                 ; iteration counter (will go to r15 at end)
+    load 8 r10                ; N iterations
+
+    ; --- Descriptor 0 at 0x5000 ---
+    load32 0x5000 r4
+    load32 0x4000 r1
+    write 0  r4 r1            ; src
+    load32 0x4100 r1
+    write 4  r4 r1            ; dst
+    load 32 r1
+    write 8  r4 r1            ; count
+    load 0x10 r1
+    write 12 r4 r1            ; MEM2MEM | desc irq
+    load32 0x5020 r1
+    write 16 r4 r1            ; next
+    write 20 r4 r0
+    write 24 r4 r0
+    write 28 r4 r0
+
+    ; --- Descriptor 1 at 0x5020 ---
+    load32 0x5020 r4
+    load32 0x4100 r1
+    write 0  r4 r1
+    load32 0x4200 r1
+    write 4  r4 r1
+    load 32 r1
+    write 8  r4 r1
+    load 0x10 r1
+    write 12 r4 r1            ; MEM2MEM | desc irq
+    load32 0x5040 r1
+    write 16 r4 r1
+    write 20 r4 r0
+    write 24 r4 r0
+    write 28 r4 r0
+
+    ; --- Descriptor 2 at 0x5040 (2D) ---
+    load32 0x5040 r4
+    load32 0x4200 r1
+    write 0  r4 r1
+    load32 0x4300 r1
+    write 4  r4 r1
+    load 32 r1
+    write 8  r4 r1            ; bytes per row
+    load32 0x100 r1
+    write 12 r4 r1            ; MEM2MEM | 2D
+    write 16 r4 r0            ; end of list
+    write 20 r4 r0
+    load 2 r1
+    write 24 r4 r1            ; rows
+    load32 0x00400000 r1
+    write 28 r4 r1            ; dst stride 64 | src stride 0
+
+LoopTop:
+    ; --- 1) New source word for this iteration ---
+    load32 0x4000 r1
+    add r9 0x100 r2
+    write 0 r1 r2
+    ccached
+
+    ; --- 2) Start the chain with the end-of-list IRQ ---
+    load32 0x5000 r1
+    write 0x18 r8 r1          ; DMA_DESC
+    load32 0x80000110 r3      ; CTRL: start | chain | irq_en
+    write 12 r8 r3
+    ; Clear the flag only now: a late IRQ from the previous chain still
+    ; sees its sticky done until START clears it. The three-descriptor
+    ; chain takes far longer than the next instruction to finish.
+    write 0 r7 r0
+
+    ; --- 3) Wait for IntH to flag this chain ---
+WaitIrq:
+    read 0 r7 r12
+    beq r12 r0 WaitIrq
+
+    ; --- 4) Check both 2D copies ---
+    ccached
+    load32 0x4300 r1
+    read 0 r1 r12
+    bne r12 r2 Fail
+    read 64 r1 r12
+    bne r12 r2 Fail
+
+    ; --- 5) loop ---
+    add r9 1 r9
+    bne r9 r10 LoopTop
+
+Fail:
+    or r9 r0 r15
+    halt
+
+; ===== Interrupt handler: flag DMA chain completion =====
+IntH:
+    push r1
+    push r2
+    push r3
+
+    readintid r1
+    load 7 r2
+    bne r1 r2 IntDone         ; not INTID_DMA
+
+    load32 0x1C000070 r2
+    read 16 r2 r3             ; DMA_STATUS
+    load 2 r2
+    and r3 r2 r3
+    beq r3 r0 IntDone         ; per-descriptor IRQ, chain still running
+
+    load32 0x3000 r2
+    load 1 r3
+    write 0 r2 r3
+
+IntDone:
+    pop r3
+    pop r2
+    pop r1
+    reti
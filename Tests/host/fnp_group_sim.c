@@ -0,0 +1,268 @@
+/*
+ * Host-side FNP board for the group (broadcast) transfer simulation.
+ *
+ * Each process is one simulated FPGC: it runs the kernel's fnp_group.c
+ * receiver against a directory on the host filesystem and answers the
+ * same frames the kernel fnp.c does for group uploads (GROUP_START /
+ * GROUP_DATA / GROUP_POLL, plus MKDIR and SYNC with an ACK). Frames are
+ * raw Ethernet + FNP, carried over AF_UNIX datagram sockets: the board
+ * listens on <dir>/n<id> and sends every reply to <dir>/host, where the
+ * test drives the real fnp_tool.py sender. Incoming and outgoing frames
+ * can be dropped at random, and the first frames can be dropped outright
+ * so the board misses GROUP_START.
+ *
+ * Compile:
+ *   gcc -O0 -Wall -I Software/C/kernel/include \
+ *       Tests/host/fnp_group_sim.c Software/C/kernel/src/fnp_group.c \
+ *       -o /tmp/fnp_group_sim
+ *
+ * Run: ./fnp_group_sim <dir> <board id> <drop %> <seed> [drop first N]
+ *      Files land under <dir>/fs<id>/. Exits after 30 s without frames.
+ */
+
+#include "fnp.h"
+#include "fnp_group.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#define SIM_IDLE_EXIT_S 30
+
+static int  g_sock;
+static struct sockaddr_un g_host;
+static int  g_board;
+static int  g_drop_pct;
+static int  g_drop_first;
+static char g_root[256];
+static int  g_fd = -1;
+static char g_path[512];
+
+static char g_rx[FNP_FRAME_MAX];
+static char g_tx[FNP_FRAME_MAX];
+static char g_reply[FNP_GROUP_STATUS_MAX];
+static struct fnp_group_rx g_group;
+
+static int
+sim_drop(void)
+{
+    return g_drop_pct > 0 && rand() % 100 < g_drop_pct;
+}
+
+/* Map an FPGC path to the board's directory on the host. */
+static void
+sim_host_path(const char *path, char *out, int max)
+{
+    snprintf(out, max, "%s%s%s", g_root, path[0] == '/' ? "" : "/", path);
+}
+
+static void
+sim_send(const char *src_frame, int type, int seq, const char *data, int len)
+{
+    int i;
+
+    if (sim_drop())
+        return;
+
+    for (i = 0; i < 6; i++)
+        g_tx[i] = src_frame[6 + i];
+    g_tx[6] = 0x02;
+    g_tx[7] = (char)0xB4;
+    g_tx[8] = (char)0xB4;
+    g_tx[9] = 0x00;
+    g_tx[10] = 0x00;
+    g_tx[11] = (char)g_board;
+    g_tx[12] = (char)0xB4;
+    g_tx[13] = (char)0xB4;
+    g_tx[FNP_HDR_VERSION] = 1;
+    g_tx[FNP_HDR_TYPE] = (char)type;
+    g_tx[FNP_HDR_SEQ] = (char)(seq >> 8);
+    g_tx[FNP_HDR_SEQ + 1] = (char)seq;
+    g_tx[FNP_HDR_FLAGS] = 0;
+    g_tx[FNP_HDR_LENGTH] = (char)(len >> 8);
+    g_tx[FNP_HDR_LENGTH + 1] = (char)len;
+    memcpy(g_tx + FNP_HDR_DATA, data, len);
+
+    sendto(g_sock, g_tx, FNP_HDR_DATA + len, 0,
+           (struct sockaddr *)&g_host, sizeof(g_host));
+}
+
+/* ---- struct fnp_group_io on the host filesystem ---- */
+
+static int
+sim_open(const char *path, unsigned int size_bytes, void *ctx)
+{
+    (void)ctx;
+    sim_host_path(path, g_path, sizeof(g_path));
+    unlink(g_path);
+    g_fd = open(g_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (g_fd < 0)
+        return -1;
+    if (ftruncate(g_fd, size_bytes) < 0)
+        return -1;
+    return 0;
+}
+
+static int
+sim_write(unsigned int offset, const char *data, int len, void *ctx)
+{
+    (void)ctx;
+    return pwrite(g_fd, data, len, offset) == len ? 0 : -1;
+}
+
+static void
+sim_close(int ok, void *ctx)
+{
+    (void)ctx;
+    if (g_fd >= 0)
+        close(g_fd);
+    g_fd = -1;
+    if (!ok)
+        unlink(g_path);
+}
+
+static const struct fnp_group_io sim_io = {
+    sim_open,
+    sim_write,
+    sim_close,
+    0
+};
+
+static void
+sim_frame(int len)
+{
+    int type;
+    int seq;
+    int data_len;
+    const char *data;
+    char ack[2];
+    char path[256];
+    int reply_len;
+
+    if (len < FNP_HDR_DATA)
+        return;
+    if ((g_rx[12] & 0xFF) != 0xB4 || (g_rx[13] & 0xFF) != 0xB4)
+        return;
+
+    type = g_rx[FNP_HDR_TYPE] & 0xFF;
+    seq = ((g_rx[FNP_HDR_SEQ] & 0xFF) << 8) | (g_rx[FNP_HDR_SEQ + 1] & 0xFF);
+    data_len = ((g_rx[FNP_HDR_LENGTH] & 0xFF) << 8)
+             | (g_rx[FNP_HDR_LENGTH + 1] & 0xFF);
+    if (data_len > len - FNP_HDR_DATA)
+        data_len = len - FNP_HDR_DATA;
+    data = g_rx + FNP_HDR_DATA;
+    ack[0] = g_rx[FNP_HDR_SEQ];
+    ack[1] = g_rx[FNP_HDR_SEQ + 1];
+
+    reply_len = 0;
+    switch (type)
+    {
+    case FNP_TYPE_GROUP_START:
+        reply_len = fnp_group_rx_start(&g_group, g_board, data, data_len,
+                                       g_reply);
+        break;
+    case FNP_TYPE_GROUP_DATA:
+        fnp_group_rx_data(&g_group, data, data_len);
+        break;
+    case FNP_TYPE_GROUP_POLL:
+        reply_len = fnp_group_rx_poll(&g_group, data, data_len, g_reply);
+        break;
+    case FNP_TYPE_MKDIR:
+        if (data_len < 1 || data_len > 127)
+            return;
+        memcpy(path, data, data_len);
+        path[data_len] = '\0';
+        sim_host_path(path, g_path, sizeof(g_path));
+        mkdir(g_path, 0755);
+        sim_send(g_rx, FNP_TYPE_ACK, seq, ack, 2);
+        return;
+    case FNP_TYPE_SYNC:
+        sim_send(g_rx, FNP_TYPE_ACK, seq, ack, 2);
+        return;
+    default:
+        return;
+    }
+
+    if (reply_len > 0)
+        sim_send(g_rx, FNP_TYPE_GROUP_STATUS, seq, g_reply, reply_len);
+}
+
+int
+main(int argc, char **argv)
+{
+    struct sockaddr_un self;
+    struct timeval tv;
+    int len;
+
+    if (argc < 5)
+    {
+        fprintf(stderr, "usage: %s <dir> <board id> <drop %%> <seed> "
+                        "[drop first N]\n", argv[0]);
+        return 2;
+    }
+    g_board = atoi(argv[2]);
+    g_drop_pct = atoi(argv[3]);
+    srand((unsigned int)atoi(argv[4]));
+    g_drop_first = argc > 5 ? atoi(argv[5]) : 0;
+
+    snprintf(g_root, sizeof(g_root), "%s/fs%d", argv[1], g_board);
+    mkdir(g_root, 0755);
+
+    g_sock = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (g_sock < 0)
+    {
+        perror("socket");
+        return 1;
+    }
+    memset(&self, 0, sizeof(self));
+    self.sun_family = AF_UNIX;
+    snprintf(self.sun_path, sizeof(self.sun_path), "%s/n%d", argv[1], g_board);
+    unlink(self.sun_path);
+    if (bind(g_sock, (struct sockaddr *)&self, sizeof(self)) < 0)
+    {
+        perror("bind");
+        return 1;
+    }
+    memset(&g_host, 0, sizeof(g_host));
+    g_host.sun_family = AF_UNIX;
+    snprintf(g_host.sun_path, sizeof(g_host.sun_path), "%s/host", argv[1]);
+
+    tv.tv_sec = SIM_IDLE_EXIT_S;
+    tv.tv_usec = 0;
+    setsockopt(g_sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    fnp_group_rx_init(&g_group, &sim_io);
+
+    /* Ready marker for the test harness */
+    printf("ready\n");
+    fflush(stdout);
+
+    for (;;)
+    {
+        len = recv(g_sock, g_rx, sizeof(g_rx), 0);
+        if (len < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (g_drop_first > 0)
+        {
+            g_drop_first--;
+            continue;
+        }
+        if (sim_drop())
+            continue;
+        sim_frame(len);
+    }
+
+    unlink(self.sun_path);
+    return 0;
+}
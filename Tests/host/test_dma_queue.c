@@ -0,0 +1,287 @@
+/*
+ * Host-side unit tests for the libfpgc DMA request queue.
+ *
+ * The real dma_queue.c is linked against a fake engine that stands in
+ * for dma.c: dma_start_ctrl() records the programmed transfer and
+ * dma_status() reports BUSY for a configurable number of reads before
+ * returning the sticky DONE/ERROR bits once (read-to-clear, like the
+ * Verilog STATUS register).
+ *
+ * Compile:
+ *   gcc -O0 -Wall -I Software/C/libfpgc/include \
+ *       Tests/host/test_dma_queue.c Software/C/libfpgc/io/dma_queue.c \
+ *       -o /tmp/test_dma_queue
+ *
+ * Run: ./test_dma_queue — exits 0 on success, nonzero on failure.
+ */
+
+#include "dma.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ---------------------------------------------------------------- */
+/* Fake DMAengine                                                   */
+/* ---------------------------------------------------------------- */
+
+static int          g_busy_reads;     /* STATUS reads left showing BUSY */
+static int          g_busy_per_start; /* BUSY reads for each new transfer */
+static int          g_fail_next;      /* next transfer finishes with ERROR */
+static unsigned int g_sticky;         /* pending DONE/ERROR bits */
+static int          g_running;
+static int          g_starts;
+static unsigned int g_last_ctrl;
+static unsigned int g_last_dst;
+static unsigned int g_last_src;
+static unsigned int g_last_count;
+static int          g_flushes;
+
+void
+dma_start_ctrl(unsigned int ctrl, unsigned int dst, unsigned int src,
+               unsigned int count, unsigned int qspi_addr)
+{
+    (void)qspi_addr;
+    g_last_ctrl = ctrl;
+    g_last_dst = dst;
+    g_last_src = src;
+    g_last_count = count;
+    g_starts++;
+    g_running = 1;
+    g_sticky = 0;
+    g_busy_reads = g_busy_per_start;
+}
+
+unsigned int
+dma_status(void)
+{
+    unsigned int s;
+
+    if (g_running && g_busy_reads > 0) {
+        g_busy_reads--;
+        return FPGC_DMA_STATUS_BUSY;
+    }
+    if (g_running) {
+        g_running = 0;
+        g_sticky = g_fail_next ? FPGC_DMA_STATUS_ERROR : FPGC_DMA_STATUS_DONE;
+        g_fail_next = 0;
+    }
+    s = g_sticky;
+    g_sticky = 0;
+    return s;
+}
+
+void
+cache_flush_data(void)
+{
+    g_flushes++;
+}
+
+/* ---------------------------------------------------------------- */
+
+static int g_failures = 0;
+
+#define CHECK(cond, msg, ...) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL %s:%d: " msg "\n", __FILE__, __LINE__, ##__VA_ARGS__); \
+        g_failures++; \
+    } \
+} while (0)
+
+#define RUN(fn) do { printf("  %s\n", #fn); fn(); } while (0)
+
+static int g_done_order[8];
+static int g_done_count;
+
+static void record_done(dma_req_t *req)
+{
+    if (g_done_count < 8)
+        g_done_order[g_done_count] = (int)(long)req->ctx;
+    g_done_count++;
+}
+
+static void reset(int use_irq, int busy_reads)
+{
+    dma_queue_init(use_irq);
+    g_busy_reads = 0;
+    g_busy_per_start = busy_reads;
+    g_fail_next = 0;
+    g_sticky = 0;
+    g_running = 0;
+    g_starts = 0;
+    g_last_ctrl = 0;
+    g_flushes = 0;
+    g_done_count = 0;
+    memset(g_done_order, 0, sizeof(g_done_order));
+}
+
+/* ---------------------------------------------------------------- */
+
+static void test_single_blocking(void) {
+    dma_req_t r;
+    reset(0, 3);
+    dma_req_init(&r, DMA_MEM2MEM, 0x1000, 0x2000, 64);
+    CHECK(dma_submit_wait(&r) == 0, "submit_wait failed");
+    CHECK(r.state == DMA_REQ_DONE, "state=%d", r.state);
+    CHECK(g_starts == 1, "starts=%d", g_starts);
+    CHECK(g_last_dst == 0x1000 && g_last_src == 0x2000 && g_last_count == 64,
+          "programmed dst=%x src=%x count=%u", g_last_dst, g_last_src, g_last_count);
+    CHECK((g_last_ctrl & FPGC_DMA_CTRL_START) != 0, "START not set");
+    CHECK((g_last_ctrl & FPGC_DMA_CTRL_IRQ_EN) == 0, "IRQ_EN set in poll mode");
+    CHECK(dma_queue_depth() == 0, "depth=%d", dma_queue_depth());
+    CHECK(dma_queue_get_stats()->mode[DMA_MEM2MEM].requests == 1, "mem2mem requests");
+    CHECK(dma_queue_get_stats()->mode[DMA_MEM2MEM].bytes == 64, "mem2mem bytes");
+}
+
+static void test_irq_mode_sets_irq_en(void) {
+    dma_req_t r;
+    reset(1, 0);
+    dma_req_init(&r, DMA_SPI2MEM, 0x1000, 0, 32);
+    r.spi_id = 5;
+    dma_submit(&r);
+    CHECK((g_last_ctrl & FPGC_DMA_CTRL_IRQ_EN) != 0, "IRQ_EN missing");
+    CHECK(((g_last_ctrl >> FPGC_DMA_CTRL_SPI_SHIFT) & 7u) == 5u, "spi id");
+    CHECK((g_last_ctrl & 0xFu) == (unsigned int)DMA_SPI2MEM, "mode");
+    dma_isr();
+    CHECK(r.state == DMA_REQ_DONE, "isr did not retire, state=%d", r.state);
+    CHECK(dma_queue_get_stats()->irqs == 1, "irq count");
+}
+
+static void test_fifo_chaining(void) {
+    dma_req_t r[3];
+    int i;
+    reset(1, 2);
+    for (i = 0; i < 3; i++) {
+        dma_req_init(&r[i], DMA_MEM2VRAM, 0x1EC00000u + 32u * i, 0x4000u, 32);
+        r[i].done = record_done;
+        r[i].ctx = (void *)(long)(i + 1);
+        CHECK(dma_submit(&r[i]) == 0, "submit %d", i);
+    }
+    CHECK(g_starts == 1, "only head should start, starts=%d", g_starts);
+    CHECK(r[0].state == DMA_REQ_ACTIVE && r[1].state == DMA_REQ_QUEUED,
+          "states %d %d", r[0].state, r[1].state);
+    CHECK(dma_queue_depth() == 3, "depth=%d", dma_queue_depth());
+
+    /* IRQ while still busy: nothing retires. */
+    dma_isr();
+    CHECK(r[0].state == DMA_REQ_ACTIVE, "retired while busy");
+
+    /* Drain via IRQs; each completion starts the next transfer. */
+    for (i = 0; i < 10 && dma_queue_depth() > 0; i++)
+        dma_isr();
+    CHECK(g_done_count == 3, "done_count=%d", g_done_count);
+    CHECK(g_done_order[0] == 1 && g_done_order[1] == 2 && g_done_order[2] == 3,
+          "order %d %d %d", g_done_order[0], g_done_order[1], g_done_order[2]);
+    CHECK(g_starts == 3, "starts=%d", g_starts);
+    CHECK(dma_queue_get_stats()->chained == 2, "chained=%u",
+          dma_queue_get_stats()->chained);
+    CHECK(dma_queue_get_stats()->max_depth == 3, "max_depth");
+}
+
+static void test_wait_on_queued_request(void) {
+    dma_req_t a, b;
+    reset(1, 4);
+    dma_req_init(&a, DMA_MEM2MEM, 0x1000, 0x2000, 32);
+    dma_req_init(&b, DMA_MEM2MEM, 0x3000, 0x4000, 32);
+    dma_submit(&a);
+    dma_submit(&b);
+    /* No IRQs delivered (e.g. waiting from interrupt context). */
+    CHECK(dma_wait(&b) == 0, "wait b");
+    CHECK(a.state == DMA_REQ_DONE && b.state == DMA_REQ_DONE, "states");
+    CHECK(g_last_dst == 0x3000, "b not programmed last");
+}
+
+static void test_error_reported(void) {
+    dma_req_t r;
+    reset(0, 1);
+    dma_req_init(&r, DMA_MEM2MEM, 0x1001, 0x2000, 32);
+    g_fail_next = 1;
+    CHECK(dma_submit_wait(&r) == -1, "expected error");
+    CHECK(r.state == DMA_REQ_ERROR, "state=%d", r.state);
+    CHECK((r.status & FPGC_DMA_STATUS_ERROR) != 0, "status=%x", r.status);
+    CHECK(dma_queue_get_stats()->mode[DMA_MEM2MEM].errors == 1, "errors");
+}
+
+static void test_double_submit_rejected(void) {
+    dma_req_t r;
+    reset(1, 5);
+    dma_req_init(&r, DMA_MEM2MEM, 0x1000, 0x2000, 32);
+    CHECK(dma_submit(&r) == 0, "first submit");
+    CHECK(dma_submit(&r) == -1, "second submit accepted");
+    CHECK(dma_queue_depth() == 1, "depth=%d", dma_queue_depth());
+    dma_wait(&r);
+    CHECK(dma_submit(&r) == 0, "resubmit after completion");
+    dma_wait(&r);
+}
+
+static void test_wait_unsubmitted(void) {
+    dma_req_t r;
+    reset(0, 0);
+    dma_req_init(&r, DMA_MEM2MEM, 0x1000, 0x2000, 32);
+    CHECK(dma_wait(&r) == -1, "wait on idle request");
+}
+
+static void test_isr_deferred_while_locked(void) {
+    dma_req_t r;
+    reset(1, 0);
+    dma_req_init(&r, DMA_MEM2MEM, 0x1000, 0x2000, 32);
+    r.done = record_done;
+    dma_submit(&r);
+    dma_queue_lock();
+    dma_isr();
+    CHECK(r.state == DMA_REQ_ACTIVE, "ISR ran while locked");
+    CHECK(dma_queue_locked(), "lock dropped");
+    dma_queue_unlock();
+    CHECK(r.state == DMA_REQ_DONE, "deferred ISR not replayed, state=%d", r.state);
+    CHECK(g_done_count == 1, "done_count=%d", g_done_count);
+}
+
+static void test_flush_merging(void) {
+    dma_req_t a, b;
+    reset(1, 0);
+    dma_req_init(&a, DMA_SPI2MEM, 0x1000, 0, 32);
+    a.flags = DMA_REQ_FLUSH_BEFORE | DMA_REQ_FLUSH_AFTER;
+    dma_req_init(&b, DMA_MEM2SPI, 0, 0x2000, 32);
+    b.flags = DMA_REQ_FLUSH_BEFORE;
+    dma_submit(&a);
+    dma_submit(&b);
+    CHECK(g_flushes == 1, "flushes after submit=%d", g_flushes);
+    dma_isr();  /* a done: flush-after doubles as b's flush-before */
+    CHECK(g_flushes == 2, "flushes after chain=%d", g_flushes);
+    dma_isr();
+    CHECK(b.state == DMA_REQ_DONE, "b state=%d", b.state);
+    CHECK(g_flushes == 2, "flushes at end=%d", g_flushes);
+}
+
+static void test_descriptor_chain(void) {
+    dma_req_t r;
+    reset(1, 2);
+    dma_req_init(&r, DMA_MEM2VRAM, 0, 0x4000, 64 * 4);
+    r.flags = DMA_REQ_CHAIN | DMA_REQ_FLUSH_BEFORE;
+    CHECK(dma_submit_wait(&r) == 0, "chain submit_wait failed");
+    CHECK((g_last_ctrl & FPGC_DMA_CTRL_CHAIN) != 0, "CHAIN missing");
+    CHECK((g_last_ctrl & 0xFu) == 0u, "mode bits set on chain start");
+    CHECK((g_last_ctrl & FPGC_DMA_CTRL_IRQ_EN) != 0, "IRQ_EN missing");
+    CHECK(g_last_src == 0x4000, "head=%x", g_last_src);
+    CHECK(g_flushes == 1, "flushes=%d", g_flushes);
+    CHECK(dma_queue_get_stats()->mode[DMA_MEM2VRAM].bytes == 256, "vram bytes");
+}
+
+int main(void) {
+    printf("dma queue host tests\n");
+    RUN(test_single_blocking);
+    RUN(test_irq_mode_sets_irq_en);
+    RUN(test_fifo_chaining);
+    RUN(test_wait_on_queued_request);
+    RUN(test_error_reported);
+    RUN(test_double_submit_rejected);
+    RUN(test_wait_unsubmitted);
+    RUN(test_isr_deferred_while_locked);
+    RUN(test_flush_merging);
+    RUN(test_descriptor_chain);
+    printf("\n");
+    if (g_failures == 0) {
+        printf("OK — all tests passed\n");
+        return 0;
+    }
+    printf("FAILED — %d failure(s)\n", g_failures);
+    return 1;
+}